@@ -32,9 +32,10 @@ void protobuf_AssignDesc_google_2fprotobuf_2fobjectivec_2ddescriptor_2eproto() {
       "google/protobuf/objectivec-descriptor.proto");
   GOOGLE_CHECK(file != NULL);
   ObjectiveCFileOptions_descriptor_ = file->message_type(0);
-  static const int ObjectiveCFileOptions_offsets_[2] = {
+  static const int ObjectiveCFileOptions_offsets_[3] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ObjectiveCFileOptions, package_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ObjectiveCFileOptions, class_prefix_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ObjectiveCFileOptions, mutable_messages_),
   };
   ObjectiveCFileOptions_reflection_ =
     new ::google::protobuf::internal::GeneratedMessageReflection(
@@ -80,11 +81,12 @@ void protobuf_AddDesc_google_2fprotobuf_2fobjectivec_2ddescriptor_2eproto() {
   ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
     "\n+google/protobuf/objectivec-descriptor."
     "proto\022\017google.protobuf\032 google/protobuf/"
-    "descriptor.proto\">\n\025ObjectiveCFileOption"
+    "descriptor.proto\"X\n\025ObjectiveCFileOption"
     "s\022\017\n\007package\030\001 \001(\t\022\024\n\014class_prefix\030\002 \001(\t"
-    ":f\n\027objectivec_file_options\022\034.google.pro"
-    "tobuf.FileOptions\030\352\007 \001(\0132&.google.protob"
-    "uf.ObjectiveCFileOptions", 264);
+    "\022\030\n\020mutable_messages\030\003 \001(\010:f\n\027objective"
+    "c_file_options\022\034.google.protobuf.FileOpti"
+    "ons\030\352\007 \001(\0132&.google.protobuf.ObjectiveC"
+    "FileOptions", 290);
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
     "google/protobuf/objectivec-descriptor.proto", &protobuf_RegisterTypes);
   ObjectiveCFileOptions::default_instance_ = new ObjectiveCFileOptions();
@@ -109,6 +111,7 @@ struct StaticDescriptorInitializer_google_2fprotobuf_2fobjectivec_2ddescriptor_2
 #ifndef _MSC_VER
 const int ObjectiveCFileOptions::kPackageFieldNumber;
 const int ObjectiveCFileOptions::kClassPrefixFieldNumber;
+const int ObjectiveCFileOptions::kMutableMessagesFieldNumber;
 #endif  // !_MSC_VER
 
 ObjectiveCFileOptions::ObjectiveCFileOptions()
@@ -129,6 +132,7 @@ void ObjectiveCFileOptions::SharedCtor() {
   _cached_size_ = 0;
   package_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
   class_prefix_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  mutable_messages_ = false;
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
@@ -179,6 +183,7 @@ void ObjectiveCFileOptions::Clear() {
         class_prefix_->clear();
       }
     }
+    mutable_messages_ = false;
   }
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
   mutable_unknown_fields()->Clear();
@@ -219,6 +224,22 @@ bool ObjectiveCFileOptions::MergePartialFromCodedStream(
         } else {
           goto handle_uninterpreted;
         }
+        if (input->ExpectTag(24)) goto parse_mutable_messages;
+        break;
+      }
+      
+      // optional bool mutable_messages = 3;
+      case 3: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_mutable_messages:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &mutable_messages_)));
+          set_has_mutable_messages();
+        } else {
+          goto handle_uninterpreted;
+        }
         if (input->ExpectAtEnd()) return true;
         break;
       }
@@ -259,6 +280,11 @@ void ObjectiveCFileOptions::SerializeWithCachedSizes(
       2, this->class_prefix(), output);
   }
   
+  // optional bool mutable_messages = 3;
+  if (has_mutable_messages()) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(3, this->mutable_messages(), output);
+  }
+  
   if (!unknown_fields().empty()) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         unknown_fields(), output);
@@ -287,6 +313,11 @@ void ObjectiveCFileOptions::SerializeWithCachedSizes(
         2, this->class_prefix(), target);
   }
   
+  // optional bool mutable_messages = 3;
+  if (has_mutable_messages()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(3, this->mutable_messages(), target);
+  }
+  
   if (!unknown_fields().empty()) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         unknown_fields(), target);
@@ -312,6 +343,11 @@ int ObjectiveCFileOptions::ByteSize() const {
           this->class_prefix());
     }
     
+    // optional bool mutable_messages = 3;
+    if (has_mutable_messages()) {
+      total_size += 1 + 1;
+    }
+    
   }
   if (!unknown_fields().empty()) {
     total_size +=
@@ -345,6 +381,9 @@ void ObjectiveCFileOptions::MergeFrom(const ObjectiveCFileOptions& from) {
     if (from.has_class_prefix()) {
       set_class_prefix(from.class_prefix());
     }
+    if (from.has_mutable_messages()) {
+      set_mutable_messages(from.mutable_messages());
+    }
   }
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
@@ -370,6 +409,7 @@ void ObjectiveCFileOptions::Swap(ObjectiveCFileOptions* other) {
   if (other != this) {
     std::swap(package_, other->package_);
     std::swap(class_prefix_, other->class_prefix_);
+    std::swap(mutable_messages_, other->mutable_messages_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
     std::swap(_cached_size_, other->_cached_size_);
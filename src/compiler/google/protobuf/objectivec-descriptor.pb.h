@@ -114,20 +114,30 @@ class ObjectiveCFileOptions : public ::google::protobuf::Message {
   inline ::std::string* mutable_class_prefix();
   inline ::std::string* release_class_prefix();
   
+  // optional bool mutable_messages = 3;
+  inline bool has_mutable_messages() const;
+  inline void clear_mutable_messages();
+  static const int kMutableMessagesFieldNumber = 3;
+  inline bool mutable_messages() const;
+  inline void set_mutable_messages(bool value);
+  
   // @@protoc_insertion_point(class_scope:google.protobuf.ObjectiveCFileOptions)
  private:
   inline void set_has_package();
   inline void clear_has_package();
   inline void set_has_class_prefix();
   inline void clear_has_class_prefix();
+  inline void set_has_mutable_messages();
+  inline void clear_has_mutable_messages();
   
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
   
   ::std::string* package_;
   ::std::string* class_prefix_;
+  bool mutable_messages_;
   
   mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(2 + 31) / 32];
+  ::google::protobuf::uint32 _has_bits_[(3 + 31) / 32];
   
   friend void  protobuf_AddDesc_google_2fprotobuf_2fobjectivec_2ddescriptor_2eproto();
   friend void protobuf_AssignDesc_google_2fprotobuf_2fobjectivec_2ddescriptor_2eproto();
@@ -263,6 +273,28 @@ inline ::std::string* ObjectiveCFileOptions::release_class_prefix() {
   }
 }
 
+// optional bool mutable_messages = 3;
+inline bool ObjectiveCFileOptions::has_mutable_messages() const {
+  return (_has_bits_[0] & 0x00000004u) != 0;
+}
+inline void ObjectiveCFileOptions::set_has_mutable_messages() {
+  _has_bits_[0] |= 0x00000004u;
+}
+inline void ObjectiveCFileOptions::clear_has_mutable_messages() {
+  _has_bits_[0] &= ~0x00000004u;
+}
+inline void ObjectiveCFileOptions::clear_mutable_messages() {
+  mutable_messages_ = false;
+  clear_has_mutable_messages();
+}
+inline bool ObjectiveCFileOptions::mutable_messages() const {
+  return mutable_messages_;
+}
+inline void ObjectiveCFileOptions::set_mutable_messages(bool value) {
+  set_has_mutable_messages();
+  mutable_messages_ = value;
+}
+
 
 // @@protoc_insertion_point(namespace_scope)
 
@@ -41,6 +41,17 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
         (*variables)["name"]                  = UnderscoresToCamelCase(descriptor);
         (*variables)["capitalized_name"]      = UnderscoresToCapitalizedCamelCase(descriptor);
         (*variables)["list_name"]             = UnderscoresToCamelCase(descriptor) + "Array";
+        (*variables)["array_class"]           = GetArrayClassName(descriptor);
+        if (!descriptor->is_repeated()) {
+          (*variables)["has_bit_word"] = HasBitWord(HasBitIndex(descriptor));
+          (*variables)["has_bit_mask"] = HasBitMask(HasBitIndex(descriptor));
+        }
+        (*variables)["detach"] =
+          "  if (prototype_ != nil) {\n"
+          "    [self detachFromPrototype];\n"
+          "  }\n";
+        (*variables)["frozen_word"] = HasBitWord(FrozenBitIndex(descriptor->containing_type()));
+        (*variables)["frozen_mask"] = HasBitMask(FrozenBitIndex(descriptor->containing_type()));
         (*variables)["number"] = SimpleItoa(descriptor->number());
         (*variables)["type"] = type;
         (*variables)["default"] = EnumValueName(default_value);
@@ -61,7 +72,7 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
 
 
   void EnumFieldGenerator::GenerateHasFieldHeader(io::Printer* printer) const {
-    printer->Print(variables_, "BOOL has$capitalized_name$_:1;\n");
+    // Declared by the message as part of its hasBits_ words.
   }
 
 
@@ -77,13 +88,13 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
 
   void EnumFieldGenerator::GeneratePropertyHeader(io::Printer* printer) const {
     printer->Print(variables_,
-      "@property (readonly) $type$ $name$;\n");
+      "@property (nonatomic, readonly) $type$ $name$;\n");
   }
 
 
   void EnumFieldGenerator::GenerateExtensionSource(io::Printer* printer) const {
     printer->Print(variables_,
-      "@property $type$ $name$;\n");
+      "@property (nonatomic) $type$ $name$;\n");
   }
 
 
@@ -98,12 +109,25 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
   void EnumFieldGenerator::GenerateSynthesizeSource(io::Printer* printer) const {
     printer->Print(variables_,
       "- (BOOL) has$capitalized_name$ {\n"
-      "  return !!has$capitalized_name$_;\n"
+      "  return ($has_bit_word$ & $has_bit_mask$) != 0;\n"
       "}\n"
       "- (void) setHas$capitalized_name$:(BOOL) value_ {\n"
-      "  has$capitalized_name$_ = !!value_;\n"
+      "  if (value_) {\n"
+      "    $has_bit_word$ |= $has_bit_mask$;\n"
+      "  } else {\n"
+      "    $has_bit_word$ &= ~$has_bit_mask$;\n"
+      "  }\n"
       "}\n"
       "@synthesize $name$;\n");
+
+    // An unset field's ivar is left zeroed, which only reads as the default
+    // when the default's number is zero.
+    if (descriptor_->default_value_enum()->number() != 0) {
+      printer->Print(variables_,
+        "- ($type$) $name$ {\n"
+        "  return ($has_bit_word$ & $has_bit_mask$) ? $name$ : $default$;\n"
+        "}\n");
+    }
   }
 
 
@@ -111,8 +135,8 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
   }
 
 
-  void EnumFieldGenerator::GenerateInitializationSource(io::Printer* printer) const {
-    printer->Print(variables_, "self.$name$ = $default$;\n");
+  void EnumFieldGenerator::GenerateResetSource(io::Printer* printer) const {
+    printer->Print(variables_, "$name$ = 0;\n");
   }
 
 
@@ -125,22 +149,40 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
   }
 
 
+  void EnumFieldGenerator::GenerateBuilderFieldHeader(io::Printer* printer) const {
+  }
+
+
+  void EnumFieldGenerator::GenerateBuilderFreezeSource(io::Printer* printer) const {
+  }
+
+
+  void EnumFieldGenerator::GenerateBuilderDropSource(io::Printer* printer) const {
+  }
+
+
+  void EnumFieldGenerator::GenerateBuilderResetSource(io::Printer* printer) const {
+  }
+
+
   void EnumFieldGenerator::GenerateBuilderMembersSource(io::Printer* printer) const {
     printer->Print(variables_,
       "- (BOOL) has$capitalized_name$ {\n"
-      "  return result.has$capitalized_name$;\n"
+      "  return (result->$has_bit_word$ & $has_bit_mask$) != 0;\n"
       "}\n"
       "- ($type$) $name$ {\n"
-      "  return result.$name$;\n"
+      "  return (result->$has_bit_word$ & $has_bit_mask$) ? result->$name$ : $default$;\n"
       "}\n"
       "- ($classname$_Builder*) set$capitalized_name$:($type$) value {\n"
-      "  result.has$capitalized_name$ = YES;\n"
-      "  result.$name$ = value;\n"
+      "$detach$"
+      "  result->$has_bit_word$ |= $has_bit_mask$;\n"
+      "  result->$name$ = value;\n"
       "  return self;\n"
       "}\n"
       "- ($classname$_Builder*) clear$capitalized_name$ {\n"
-      "  result.has$capitalized_name$ = NO;\n"
-      "  result.$name$ = $default$;\n"
+      "$detach$"
+      "  result->$has_bit_word$ &= ~$has_bit_mask$;\n"
+      "  result->$name$ = 0;\n"
       "  return self;\n"
       "}\n");
   }
@@ -152,8 +194,8 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
 
   void EnumFieldGenerator::GenerateMergingCodeSource(io::Printer* printer) const {
     printer->Print(variables_,
-      "if (other.has$capitalized_name$) {\n"
-      "  [self set$capitalized_name$:other.$name$];\n"
+      "if (other->$has_bit_word$ & $has_bit_mask$) {\n"
+      "  [self set$capitalized_name$:other->$name$];\n"
       "}\n");
   }
 
@@ -173,10 +215,17 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
     printer->Print(variables_,
       "int32_t value = [input readEnum];\n"
       "if ($type$IsValidValue(value)) {\n"
-      "  [self set$capitalized_name$:value];\n"
-      "} else {\n"
-      "  [unknownFields mergeVarintField:$number$ value:value];\n"
-      "}\n");
+      "  [self set$capitalized_name$:value];\n");
+    // Lite messages have nowhere to keep unrecognized values.
+    if (HasUnknownFields(descriptor_->file())) {
+      printer->Print(variables_,
+        "} else {\n"
+        "  if (unknownFields == nil) {\n"
+        "    unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];\n"
+        "  }\n"
+        "  [unknownFields mergeVarintField:$number$ value:value];\n");
+    }
+    printer->Print("}\n");
   }
 
 
@@ -186,8 +235,8 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
 
   void EnumFieldGenerator::GenerateSerializationCodeSource(io::Printer* printer) const {
     printer->Print(variables_,
-      "if (self.has$capitalized_name$) {\n"
-      "  [output writeEnum:$number$ value:self.$name$];\n"
+      "if ($has_bit_word$ & $has_bit_mask$) {\n"
+      "  [output writeEnum:$number$ value:$name$];\n"
       "}\n");
   }
 
@@ -196,37 +245,71 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
   }
 
 
+  void EnumFieldGenerator::GenerateMutableMembersHeader(io::Printer* printer) const {
+    printer->Print(variables_,
+      "- (void) set$capitalized_name$:($type$) value;\n"
+      "- (void) clear$capitalized_name$;\n");
+  }
+
+
   void EnumFieldGenerator::GenerateSerializedSizeCodeSource(io::Printer* printer) const {
     printer->Print(variables_,
-      "if (self.has$capitalized_name$) {\n"
-      "  size_ += computeEnumSize($number$, self.$name$);\n"
+      "if ($has_bit_word$ & $has_bit_mask$) {\n"
+      "  size_ += computeEnumSize($number$, $name$);\n"
       "}\n");
   }
 
 
   void EnumFieldGenerator::GenerateDescriptionCodeSource(io::Printer* printer) const {
     printer->Print(variables_,
-      "if (self.has$capitalized_name$) {\n"
-      "  [output appendFormat:@\"%@%@: %d\\n\", indent, @\"$name$\", self.$name$];\n"
+      "if ($has_bit_word$ & $has_bit_mask$) {\n"
+      "  [output appendFormat:@\"%@%@: %d\\n\", indent, @\"$name$\", $name$];\n"
       "}\n");
   }
 
 
   void EnumFieldGenerator::GenerateIsEqualCodeSource(io::Printer* printer) const {
     printer->Print(variables_,
-      "self.has$capitalized_name$ == otherMessage.has$capitalized_name$ &&\n"
-      "(!self.has$capitalized_name$ || self.$name$ == otherMessage.$name$) &&");
+      "($has_bit_word$ & $has_bit_mask$) == (otherMessage->$has_bit_word$ & $has_bit_mask$) &&\n"
+      "(!($has_bit_word$ & $has_bit_mask$) || $name$ == otherMessage->$name$) &&");
   }
 
 
   void EnumFieldGenerator::GenerateHashCodeSource(io::Printer* printer) const {
     printer->Print(variables_,
-      "if (self.has$capitalized_name$) {\n"
-      "  hashCode = hashCode * 31 + self.$name$;\n"
+      "if ($has_bit_word$ & $has_bit_mask$) {\n"
+      "  hashCode = PBGeneratedMessageHashMix(hashCode, (uint64_t)$name$);\n"
+      "}\n");
+  }
+
+
+  void EnumFieldGenerator::GenerateMutableMembersSource(io::Printer* printer) const {
+    printer->Print(variables_,
+      "- (void) set$capitalized_name$:($type$) value_ {\n"
+      "  if ($frozen_word$ & $frozen_mask$) {\n"
+      "    PBGeneratedMessageThrowFrozen(self);\n"
+      "  }\n"
+      "  $has_bit_word$ |= $has_bit_mask$;\n"
+      "  $name$ = value_;\n"
+      "}\n"
+      "- (void) clear$capitalized_name$ {\n"
+      "  if ($frozen_word$ & $frozen_mask$) {\n"
+      "    PBGeneratedMessageThrowFrozen(self);\n"
+      "  }\n"
+      "  $has_bit_word$ &= ~$has_bit_mask$;\n"
+      "  $name$ = 0;\n"
       "}\n");
   }
 
 
+  void EnumFieldGenerator::GenerateFreezeSource(io::Printer* printer) const {
+  }
+
+
+  void EnumFieldGenerator::GenerateMutableCopySource(io::Printer* printer) const {
+  }
+
+
   string EnumFieldGenerator::GetBoxedType() const {
     return ClassName(descriptor_->enum_type());
   }
@@ -247,7 +330,7 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
 
 
   void RepeatedEnumFieldGenerator::GenerateFieldHeader(io::Printer* printer) const {
-    printer->Print(variables_, "PBAppendableArray * $list_name$;\n");
+    printer->Print(variables_, "$array_class$ * $list_name$;\n");
     if (descriptor_->options().packed()) {
       printer->Print(variables_,
         "int32_t $name$MemoizedSerializedSize;\n");
@@ -260,13 +343,13 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
 
 
   void RepeatedEnumFieldGenerator::GeneratePropertyHeader(io::Printer* printer) const {
-    printer->Print(variables_, "@property (readonly, retain) PBArray * $name$;\n");
+    printer->Print(variables_, "@property (nonatomic, readonly, retain) PBArray * $name$;\n");
   }
 
 
   void RepeatedEnumFieldGenerator::GenerateExtensionSource(io::Printer* printer) const {
     printer->Print(variables_,
-      "@property (retain) PBAppendableArray * $list_name$;\n");
+      "@property (nonatomic, retain) $array_class$ * $list_name$;\n");
   }
 
   void RepeatedEnumFieldGenerator::GenerateSynthesizeSource(io::Printer* printer) const {
@@ -276,11 +359,12 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
 
   void RepeatedEnumFieldGenerator::GenerateDeallocSource(io::Printer* printer) const {
     printer->Print(variables_,
-      "self.$list_name$ = nil;\n");
+      "[$list_name$ release];\n");
   }
 
 
-  void RepeatedEnumFieldGenerator::GenerateInitializationSource(io::Printer* printer) const {
+  void RepeatedEnumFieldGenerator::GenerateResetSource(io::Printer* printer) const {
+    printer->Print(variables_, "$list_name$ = PBAppendableArrayReuse($list_name$);\n");
   }
 
 
@@ -295,6 +379,7 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
       "- ($type$)$name$AtIndex:(NSUInteger)index;\n"
       "- ($classname$_Builder *)add$capitalized_name$:($type$)value;\n"
       "- ($classname$_Builder *)set$capitalized_name$Array:(NSArray *)array;\n"
+      "- ($classname$_Builder *)set$capitalized_name$:(PBArray *)array;\n"
       "- ($classname$_Builder *)set$capitalized_name$Values:(const $type$ *)values count:(NSUInteger)count;\n"
       "- ($classname$_Builder *)clear$capitalized_name$;\n");
   }
@@ -320,40 +405,74 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
   }
 
 
+  void RepeatedEnumFieldGenerator::GenerateMutableMembersHeader(io::Printer* printer) const {
+    printer->Print(variables_,
+      "- (void)add$capitalized_name$:($type$)value;\n"
+      "- (void)set$capitalized_name$:(PBArray *)array;\n"
+      "- (void)clear$capitalized_name$;\n");
+  }
+
+
   void RepeatedEnumFieldGenerator::GenerateMembersSource(io::Printer* printer) const {
     printer->Print(variables_,
       "- (PBArray *)$name$ {\n"
       "  return $list_name$;\n"
       "}\n"
       "- ($type$)$name$AtIndex:(NSUInteger)index {\n"
-      "  return [$list_name$ int32AtIndex:index];\n"
+      "  return $array_class$ValueAtIndex($list_name$, index);\n"
       "}\n");
   }
 
+  void RepeatedEnumFieldGenerator::GenerateBuilderFieldHeader(io::Printer* printer) const {
+  }
+
+
+  void RepeatedEnumFieldGenerator::GenerateBuilderFreezeSource(io::Printer* printer) const {
+  }
+
+
+  void RepeatedEnumFieldGenerator::GenerateBuilderDropSource(io::Printer* printer) const {
+  }
+
+
+  void RepeatedEnumFieldGenerator::GenerateBuilderResetSource(io::Printer* printer) const {
+  }
+
+
   void RepeatedEnumFieldGenerator::GenerateBuilderMembersSource(io::Printer* printer) const {
     printer->Print(variables_,
       "- (PBAppendableArray *)$name$ {\n"
-      "  return result.$list_name$;\n"
+      "$detach$"
+      "  return result->$list_name$;\n"
       "}\n"
       "- ($type$)$name$AtIndex:(NSUInteger)index {\n"
       "  return [result $name$AtIndex:index];\n"
       "}\n"
       "- ($classname$_Builder *)add$capitalized_name$:($type$)value {\n"
-      "  if (result.$list_name$ == nil) {\n"
-      "    result.$list_name$ = [PBAppendableArray arrayWithValueType:PBArrayValueTypeInt32];\n"
+      "$detach$"
+      "  if (result->$list_name$ == nil) {\n"
+      "    result.$list_name$ = [$array_class$ array];\n"
       "  }\n"
-      "  [result.$list_name$ addInt32:value];\n"
+      "  $array_class$AddValue(result->$list_name$, value);\n"
       "  return self;\n"
       "}\n"
       "- ($classname$_Builder *)set$capitalized_name$Array:(NSArray *)array {\n"
-      "  result.$list_name$ = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeInt32];\n"
+      "$detach$"
+      "  result.$list_name$ = [$array_class$ arrayWithArray:array valueType:PBArrayValueTypeInt32];\n"
+      "  return self;\n"
+      "}\n"
+      "- ($classname$_Builder *)set$capitalized_name$:(PBArray *)array {\n"
+      "$detach$"
+      "  result.$list_name$ = array ? [$array_class$ arrayWithStorageOfArray:array] : nil;\n"
       "  return self;\n"
       "}\n"
       "- ($classname$_Builder *)set$capitalized_name$Values:(const $type$ *)values count:(NSUInteger)count {\n"
-      "  result.$list_name$ = [PBAppendableArray arrayWithValues:values count:count valueType:PBArrayValueTypeInt32];\n"
+      "$detach$"
+      "  result.$list_name$ = [$array_class$ arrayWithValues:values count:count valueType:PBArrayValueTypeInt32];\n"
       "  return self;\n"
       "}\n"
       "- ($classname$_Builder *)clear$capitalized_name$ {\n"
+      "$detach$"
       "  result.$list_name$ = nil;\n"
       "  return self;\n"
       "}\n");
@@ -361,54 +480,81 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
 
   void RepeatedEnumFieldGenerator::GenerateMergingCodeSource(io::Printer* printer) const {
     printer->Print(variables_,
-      "if (other.$list_name$.count > 0) {\n"
-      "  if (result.$list_name$ == nil) {\n"
-      "    result.$list_name$ = [[other.$list_name$ copyWithZone:[other.$list_name$ zone]] autorelease];\n"
+      "if (other->$list_name$.count > 0) {\n"
+      "  if (result->$list_name$ == nil) {\n"
+      "    result.$list_name$ = [[other->$list_name$ copyWithZone:[other->$list_name$ zone]] autorelease];\n"
       "  } else {\n"
-      "    [result.$list_name$ appendArray:other.$list_name$];\n"
+      "    [result->$list_name$ appendArray:other->$list_name$];\n"
       "  }\n"
       "}\n");
   }
 
   void RepeatedEnumFieldGenerator::GenerateBuildingCodeSource(io::Printer* printer) const {
+    printer->Print(variables_,
+      "[result->$list_name$ shrinkToFit];\n");
   }
 
   void RepeatedEnumFieldGenerator::GenerateParsingCodeSource(io::Printer* printer) const {
-    // If packed, set up the while loop
+    printer->Print(variables_,
+      "if (result->$list_name$ == nil) {\n"
+      "  result.$list_name$ = [$array_class$ array];\n"
+      "}\n");
+
+    // If packed, set up the while loop.  Every enum value takes at least one
+    // byte, so the buffered part of the payload bounds the count; otherwise
+    // loop over the run of identically tagged values already in the buffer.
     if (descriptor_->options().packed()) {
       printer->Print(variables_,
         "int32_t length = [input readRawVarint32];\n"
         "int32_t oldLimit = [input pushLimit:length];\n"
+        "[result->$list_name$ reserveCapacity:result->$list_name$.count + input.bytesBufferedUntilLimit inArena:input.arena];\n"
         "while (input.bytesUntilLimit > 0) {\n");
       printer->Indent();
+    } else {
+      printer->Print(variables_,
+        "const int32_t count = [input countBufferedRepeatedField:$tag$];\n"
+        "[result->$list_name$ reserveCapacity:result->$list_name$.count + count inArena:input.arena];\n"
+        "for (int32_t i = 0; i < count; ++i) {\n"
+        "  if (i > 0) {\n"
+        "    [input readTag];\n"
+        "  }\n");
+      printer->Indent();
     }
 
     printer->Print(variables_,
       "int32_t value = [input readEnum];\n"
       "if ($type$IsValidValue(value)) {\n"
-      "  [self add$capitalized_name$:value];\n"
-      "} else {\n"
-      "  [unknownFields mergeVarintField:$number$ value:value];\n"
-      "}\n");
+      "  [self add$capitalized_name$:value];\n");
+    if (HasUnknownFields(descriptor_->file())) {
+      printer->Print(variables_,
+        "} else {\n"
+        "  if (unknownFields == nil) {\n"
+        "    unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];\n"
+        "  }\n"
+        "  [unknownFields mergeVarintField:$number$ value:value];\n");
+    }
+    printer->Print("}\n");
 
+    printer->Outdent();
     if (descriptor_->options().packed()) {
-      printer->Outdent();
       printer->Print(variables_,
         "}\n"
         "[input popLimit:oldLimit];\n");
+    } else {
+      printer->Print("}\n");
     }
   }
 
   void RepeatedEnumFieldGenerator::GenerateSerializationCodeSource(io::Printer* printer) const {
     printer->Print(variables_,
-        "const NSUInteger $list_name$Count = self.$list_name$.count;\n"
-        "const $type$ *$list_name$Values = (const $type$ *)self.$list_name$.data;\n");
+        "const NSUInteger $list_name$Count = $list_name$.count;\n"
+        "const $type$ *$list_name$Values = (const $type$ *)$list_name$.data;\n");
 
     if (descriptor_->options().packed()) {
       printer->Print(variables_,
-        "if (self.$list_name$.count > 0) {\n"
+        "if ($list_name$.count > 0) {\n"
         "  [output writeRawVarint32:$tag$];\n"
-        "  [output writeRawVarint32:$name$MemoizedSerializedSize];\n"
+        "  [output writeRawVarint32:PBGeneratedMessageGetMemoizedSize(&$name$MemoizedSerializedSize)];\n"
         "}\n"
         "for (NSUInteger i = 0; i < $list_name$Count; ++i) {\n"
         "  [output writeEnumNoTag:$list_name$Values[i]];\n"
@@ -426,11 +572,11 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
     printer->Print(variables_,
       "{\n"
       "  int32_t dataSize = 0;\n"
-      "  const NSUInteger count = self.$list_name$.count;\n");
+      "  const NSUInteger count = $list_name$.count;\n");
     printer->Indent();
 
     printer->Print(variables_,
-      "const $type$ *values = (const $type$ *)self.$list_name$.data;\n"
+      "const $type$ *values = (const $type$ *)$list_name$.data;\n"
       "for (NSUInteger i = 0; i < count; ++i) {\n"
       "  dataSize += computeEnumSizeNoTag(values[i]);\n"
       "}\n");
@@ -451,7 +597,7 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
 
     if (descriptor_->options().packed()) {
       printer->Print(variables_,
-        "$name$MemoizedSerializedSize = dataSize;\n");
+        "PBGeneratedMessageSetMemoizedSize(&$name$MemoizedSerializedSize, dataSize);\n");
     }
 
     printer->Outdent();
@@ -461,23 +607,55 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
 
   void RepeatedEnumFieldGenerator::GenerateDescriptionCodeSource(io::Printer* printer) const {
     printer->Print(variables_,
-      "for (NSNumber* element in self.$list_name$) {\n"
-      "  [output appendFormat:@\"%@%@: %d\\n\", indent, @\"$name$\", element.intValue];\n"
-      "}\n");
+      "[$list_name$ enumerateInt32sUsingBlock:^(int32_t value, NSUInteger idx, BOOL *stop) {\n"
+      "  [output appendFormat:@\"%@%@: %d\\n\", indent, @\"$name$\", value];\n"
+      "}];\n");
   }
 
 
   void RepeatedEnumFieldGenerator::GenerateIsEqualCodeSource(io::Printer* printer) const {
-    printer->Print(variables_, "[self.$list_name$ isEqualToArray:otherMessage.$list_name$] &&");
+    printer->Print(variables_, "($list_name$.count == 0 ? otherMessage->$list_name$.count == 0 : [$list_name$ isEqualToArray:otherMessage->$list_name$]) &&");
   }
 
 
   void RepeatedEnumFieldGenerator::GenerateHashCodeSource(io::Printer* printer) const {
     printer->Print(variables_,
-      "for (NSNumber* element in self.$list_name$) {\n"
-      "  hashCode = hashCode * 31 + element.intValue;\n"
+      "hashCode = PBGeneratedMessageHashMix(hashCode, [$list_name$ hash64]);\n");
+  }
+
+
+  void RepeatedEnumFieldGenerator::GenerateMutableMembersSource(io::Printer* printer) const {
+    printer->Print(variables_,
+      "- (void)add$capitalized_name$:($type$)value {\n"
+      "  if ($frozen_word$ & $frozen_mask$) {\n"
+      "    PBGeneratedMessageThrowFrozen(self);\n"
+      "  }\n"
+      "  if ($list_name$ == nil) {\n"
+      "    self.$list_name$ = [$array_class$ array];\n"
+      "  }\n"
+      "  $array_class$AddValue($list_name$, value);\n"
+      "}\n"
+      "- (void)set$capitalized_name$:(PBArray *)array {\n"
+      "  if ($frozen_word$ & $frozen_mask$) {\n"
+      "    PBGeneratedMessageThrowFrozen(self);\n"
+      "  }\n"
+      "  self.$list_name$ = array ? [$array_class$ arrayWithStorageOfArray:array] : nil;\n"
+      "}\n"
+      "- (void)clear$capitalized_name$ {\n"
+      "  if ($frozen_word$ & $frozen_mask$) {\n"
+      "    PBGeneratedMessageThrowFrozen(self);\n"
+      "  }\n"
+      "  self.$list_name$ = nil;\n"
       "}\n");
   }
+
+
+  void RepeatedEnumFieldGenerator::GenerateFreezeSource(io::Printer* printer) const {
+  }
+
+
+  void RepeatedEnumFieldGenerator::GenerateMutableCopySource(io::Printer* printer) const {
+  }
 }  // namespace objectivec
 }  // namespace compiler
 }  // namespace protobuf
@@ -89,62 +89,7 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
       break;
     }
 
-    switch (descriptor_->type()) {
-      case FieldDescriptor::TYPE_INT32:
-        vars["extension_type"] = "PBExtensionTypeInt32";
-        break;
-      case FieldDescriptor::TYPE_UINT32:
-        vars["extension_type"] = "PBExtensionTypeUInt32";
-        break;
-      case FieldDescriptor::TYPE_SINT32:
-        vars["extension_type"] = "PBExtensionTypeSInt32";
-        break;
-      case FieldDescriptor::TYPE_FIXED32:
-        vars["extension_type"] = "PBExtensionTypeFixed32";
-        break;
-      case FieldDescriptor::TYPE_SFIXED32:
-        vars["extension_type"] = "PBExtensionTypeSFixed32";
-        break;
-      case FieldDescriptor::TYPE_INT64:
-        vars["extension_type"] = "PBExtensionTypeInt64";
-        break;
-      case FieldDescriptor::TYPE_UINT64:
-        vars["extension_type"] = "PBExtensionTypeUInt64";
-        break;
-      case FieldDescriptor::TYPE_SINT64:
-        vars["extension_type"] = "PBExtensionTypeSInt64";
-        break;
-      case FieldDescriptor::TYPE_FIXED64:
-        vars["extension_type"] = "PBExtensionTypeFixed64";
-        break;
-      case FieldDescriptor::TYPE_SFIXED64:
-        vars["extension_type"] = "PBExtensionTypeSFixed64";
-        break;
-      case FieldDescriptor::TYPE_FLOAT:
-        vars["extension_type"] = "PBExtensionTypeFloat";
-        break;
-      case FieldDescriptor::TYPE_DOUBLE:
-        vars["extension_type"] = "PBExtensionTypeDouble";
-        break;
-      case FieldDescriptor::TYPE_BOOL: 
-        vars["extension_type"] = "PBExtensionTypeBool";
-        break;
-      case FieldDescriptor::TYPE_STRING:
-        vars["extension_type"] = "PBExtensionTypeString";
-        break;
-      case FieldDescriptor::TYPE_BYTES:
-        vars["extension_type"] = "PBExtensionTypeBytes";
-        break;
-      case FieldDescriptor::TYPE_MESSAGE:
-        vars["extension_type"] = "PBExtensionTypeMessage";
-        break;
-      case FieldDescriptor::TYPE_ENUM:
-        vars["extension_type"] = "PBExtensionTypeEnum";
-        break;
-      case FieldDescriptor::TYPE_GROUP:
-        vars["extension_type"] = "PBExtensionTypeGroup";
-        break;
-    }
+    vars["extension_type"] = GetExtensionType(descriptor_);
 
     vars["default"] = descriptor_->is_repeated() 
       ? string("[PBArray arrayWithValueType:") + GetArrayValueType(descriptor_) + "]"
@@ -40,6 +40,7 @@ class FieldGenerator {
 
   virtual void GenerateHasFieldHeader(io::Printer* printer) const = 0;
   virtual void GenerateFieldHeader(io::Printer* printer) const = 0;
+  virtual void GenerateBuilderFieldHeader(io::Printer* printer) const = 0;
   virtual void GenerateHasPropertyHeader(io::Printer* printer) const = 0;
   virtual void GeneratePropertyHeader(io::Printer* printer) const = 0;
   virtual void GenerateMembersHeader(io::Printer* printer) const = 0;
@@ -49,13 +50,17 @@ class FieldGenerator {
   virtual void GenerateParsingCodeHeader(io::Printer* printer) const = 0;
   virtual void GenerateSerializationCodeHeader(io::Printer* printer) const = 0;
   virtual void GenerateSerializedSizeCodeHeader(io::Printer* printer) const = 0;
+  virtual void GenerateMutableMembersHeader(io::Printer* printer) const = 0;
 
   virtual void GenerateExtensionSource(io::Printer* printer) const = 0;
   virtual void GenerateSynthesizeSource(io::Printer* printer) const = 0;
   virtual void GenerateDeallocSource(io::Printer* printer) const = 0;
-  virtual void GenerateInitializationSource(io::Printer* printer) const = 0;
+  virtual void GenerateResetSource(io::Printer* printer) const = 0;
   virtual void GenerateMembersSource(io::Printer* printer) const = 0;
   virtual void GenerateBuilderMembersSource(io::Printer* printer) const = 0;
+  virtual void GenerateBuilderFreezeSource(io::Printer* printer) const = 0;
+  virtual void GenerateBuilderDropSource(io::Printer* printer) const = 0;
+  virtual void GenerateBuilderResetSource(io::Printer* printer) const = 0;
   virtual void GenerateMergingCodeSource(io::Printer* printer) const = 0;
   virtual void GenerateBuildingCodeSource(io::Printer* printer) const = 0;
   virtual void GenerateParsingCodeSource(io::Printer* printer) const = 0;
@@ -65,6 +70,11 @@ class FieldGenerator {
   virtual void GenerateIsEqualCodeSource(io::Printer* printer) const = 0;
   virtual void GenerateHashCodeSource(io::Printer* printer) const = 0;
 
+  // Only called for files with the mutable_messages option.
+  virtual void GenerateMutableMembersSource(io::Printer* printer) const = 0;
+  virtual void GenerateFreezeSource(io::Printer* printer) const = 0;
+  virtual void GenerateMutableCopySource(io::Printer* printer) const = 0;
+
  private:
   GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(FieldGenerator);
 };
@@ -157,9 +157,26 @@ namespace google { namespace protobuf { namespace compiler {namespace objectivec
       MessageGenerator(file_->message_type(i)).GenerateStaticVariablesSource(printer);
     }
 
+    // The registry is only built when first asked for, since it touches
+    // the extensions of every file this one depends on.
     printer->Print(
       "static PBExtensionRegistry* extensionRegistry = nil;\n"
       "+ (PBExtensionRegistry*) extensionRegistry {\n"
+      "  static dispatch_once_t onceToken;\n"
+      "  dispatch_once(&onceToken, ^{\n"
+      "    PBMutableExtensionRegistry* registry = [PBMutableExtensionRegistry registry];\n"
+      "    [$classname$ registerAllExtensions:registry];\n",
+      "classname", classname_);
+
+    for (int i = 0; i < file_->dependency_count(); i++) {
+      printer->Print(
+        "    [$dependency$ registerAllExtensions:registry];\n",
+        "dependency", FileClassName(file_->dependency(i)));
+    }
+
+    printer->Print(
+      "    extensionRegistry = [registry retain];\n"
+      "  });\n"
       "  return extensionRegistry;\n"
       "}\n"
       "\n"
@@ -178,19 +195,6 @@ namespace google { namespace protobuf { namespace compiler {namespace objectivec
       MessageGenerator(file_->message_type(i)).GenerateStaticVariablesInitialization(printer);
     }
 
-    printer->Print(
-      "PBMutableExtensionRegistry* registry = [PBMutableExtensionRegistry registry];\n"
-      "[self registerAllExtensions:registry];\n");
-
-    for (int i = 0; i < file_->dependency_count(); i++) {
-      printer->Print(
-        "[$dependency$ registerAllExtensions:registry];\n",
-        "dependency", FileClassName(file_->dependency(i)));
-    }
-
-    printer->Print(
-      "extensionRegistry = [registry retain];\n");
-
     printer->Outdent();
     printer->Outdent();
 
@@ -217,6 +217,12 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
   }
 
 
+  bool HasMutableMessages(const FileDescriptor* file) {
+    return file->options().HasExtension(objectivec_file_options) &&
+           file->options().GetExtension(objectivec_file_options).mutable_messages();
+  }
+
+
   string FileClassPrefix(const FileDescriptor* file) {
     if (IsBootstrapFile(file)) {
       return "PB";
@@ -539,6 +545,118 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
     return NULL;
   }
 
+  const char* GetArrayClassName(const FieldDescriptor* field) {
+    switch (field->type()) {
+      case FieldDescriptor::TYPE_INT32   : return "PBInt32Array" ;
+      case FieldDescriptor::TYPE_UINT32  : return "PBUInt32Array";
+      case FieldDescriptor::TYPE_SINT32  : return "PBInt32Array" ;
+      case FieldDescriptor::TYPE_FIXED32 : return "PBUInt32Array";
+      case FieldDescriptor::TYPE_SFIXED32: return "PBInt32Array" ;
+      case FieldDescriptor::TYPE_INT64   : return "PBInt64Array" ;
+      case FieldDescriptor::TYPE_UINT64  : return "PBUInt64Array";
+      case FieldDescriptor::TYPE_SINT64  : return "PBInt64Array" ;
+      case FieldDescriptor::TYPE_FIXED64 : return "PBUInt64Array";
+      case FieldDescriptor::TYPE_SFIXED64: return "PBInt64Array" ;
+      case FieldDescriptor::TYPE_FLOAT   : return "PBFloatArray" ;
+      case FieldDescriptor::TYPE_DOUBLE  : return "PBDoubleArray";
+      case FieldDescriptor::TYPE_BOOL    : return "PBBoolArray"  ;
+      case FieldDescriptor::TYPE_STRING  : return "PBObjectArray";
+      case FieldDescriptor::TYPE_BYTES   : return "PBObjectArray";
+      case FieldDescriptor::TYPE_ENUM    : return "PBInt32Array" ;
+      case FieldDescriptor::TYPE_GROUP   : return "PBObjectArray";
+      case FieldDescriptor::TYPE_MESSAGE : return "PBObjectArray";
+    }
+
+    GOOGLE_LOG(FATAL) << "Can't get here.";
+    return NULL;
+  }
+
+  const char* GetExtensionType(const FieldDescriptor* field) {
+    switch (field->type()) {
+      case FieldDescriptor::TYPE_INT32   : return "PBExtensionTypeInt32"   ;
+      case FieldDescriptor::TYPE_UINT32  : return "PBExtensionTypeUInt32"  ;
+      case FieldDescriptor::TYPE_SINT32  : return "PBExtensionTypeSInt32"  ;
+      case FieldDescriptor::TYPE_FIXED32 : return "PBExtensionTypeFixed32" ;
+      case FieldDescriptor::TYPE_SFIXED32: return "PBExtensionTypeSFixed32";
+      case FieldDescriptor::TYPE_INT64   : return "PBExtensionTypeInt64"   ;
+      case FieldDescriptor::TYPE_UINT64  : return "PBExtensionTypeUInt64"  ;
+      case FieldDescriptor::TYPE_SINT64  : return "PBExtensionTypeSInt64"  ;
+      case FieldDescriptor::TYPE_FIXED64 : return "PBExtensionTypeFixed64" ;
+      case FieldDescriptor::TYPE_SFIXED64: return "PBExtensionTypeSFixed64";
+      case FieldDescriptor::TYPE_FLOAT   : return "PBExtensionTypeFloat"   ;
+      case FieldDescriptor::TYPE_DOUBLE  : return "PBExtensionTypeDouble"  ;
+      case FieldDescriptor::TYPE_BOOL    : return "PBExtensionTypeBool"    ;
+      case FieldDescriptor::TYPE_STRING  : return "PBExtensionTypeString"  ;
+      case FieldDescriptor::TYPE_BYTES   : return "PBExtensionTypeBytes"   ;
+      case FieldDescriptor::TYPE_MESSAGE : return "PBExtensionTypeMessage" ;
+      case FieldDescriptor::TYPE_ENUM    : return "PBExtensionTypeEnum"    ;
+      case FieldDescriptor::TYPE_GROUP   : return "PBExtensionTypeGroup"   ;
+    }
+
+    GOOGLE_LOG(FATAL) << "Can't get here.";
+    return NULL;
+  }
+
+
+  bool IsLazy(const FieldDescriptor* field) {
+#if GOOGLE_PROTOBUF_VERSION >= 2005000
+    return field->type() == FieldDescriptor::TYPE_MESSAGE &&
+           !field->is_repeated() &&
+           field->options().lazy() &&
+           HasGeneratedMethods(field->file()) &&
+           !HasMutableMessages(field->file());
+#else
+    return false;
+#endif
+  }
+
+
+  int HasBitIndex(const FieldDescriptor* field) {
+    const Descriptor* descriptor = field->containing_type();
+    int index = 0;
+    for (int i = 0; i < descriptor->field_count() && descriptor->field(i) != field; i++) {
+      if (!descriptor->field(i)->is_repeated()) {
+        index++;
+      }
+    }
+    return index;
+  }
+
+
+  int InitializedBitIndex(const Descriptor* descriptor) {
+    int index = 0;
+    for (int i = 0; i < descriptor->field_count(); i++) {
+      if (!descriptor->field(i)->is_repeated()) {
+        index++;
+      }
+    }
+    return index;
+  }
+
+
+  int FrozenBitIndex(const Descriptor* descriptor) {
+    return InitializedBitIndex(descriptor) + 1;
+  }
+
+
+  int HasBitWordCount(const Descriptor* descriptor) {
+    if (HasMutableMessages(descriptor->file())) {
+      return FrozenBitIndex(descriptor) / 32 + 1;
+    }
+    return InitializedBitIndex(descriptor) / 32 + 1;
+  }
+
+
+  string HasBitWord(int index) {
+    return "hasBits_[" + SimpleItoa(index / 32) + "]";
+  }
+
+
+  string HasBitMask(int index) {
+    return "0x" + ToHex(1u << (index % 32)) + "u";
+  }
+
+
   // Escape C++ trigraphs by escaping question marks to \?
   string EscapeTrigraphs(const string& to_escape) {
     return StringReplace(to_escape, "?", "\\?", true);
@@ -109,6 +109,33 @@ string BoxValue(const FieldDescriptor* field, const string& value);
 
 const char* GetArrayValueType(const FieldDescriptor* field);
 
+// The typed PBAppendableArray subclass that stores values of this field.
+const char* GetArrayClassName(const FieldDescriptor* field);
+
+// The PBExtensionType constant ("PBExtensionTypeInt32") for the field's
+// type, used by extensions and by the field tables of CODE_SIZE messages.
+const char* GetExtensionType(const FieldDescriptor* field);
+
+// Singular message fields marked [lazy=true] keep the serialized bytes of
+// their value when parsed, and only parse them on first access.  Options
+// from protobuf releases without the lazy option, and fields of messages
+// that are parsed through a field table or can be changed in place, are
+// never lazy.
+bool IsLazy(const FieldDescriptor* field);
+
+// Every singular field has one bit in its message's uint32_t hasBits_ words,
+// numbered in declaration order.  The bit after the last field's records
+// that the message is known to be initialized, and in files with mutable
+// messages the one after that records that the message is frozen.
+int HasBitIndex(const FieldDescriptor* field);
+int InitializedBitIndex(const Descriptor* descriptor);
+int FrozenBitIndex(const Descriptor* descriptor);
+int HasBitWordCount(const Descriptor* descriptor);
+
+// The word ("hasBits_[1]") and mask ("0x4u") of a has bit.
+string HasBitWord(int index);
+string HasBitMask(int index);
+
 // Escape C++ trigraphs by escaping question marks to \?
 string EscapeTrigraphs(const string& to_escape);
 
@@ -118,7 +145,9 @@ inline bool HasUnknownFields(const FileDescriptor *file) {
 }
 
 // Does this file have generated parsing, serialization, and other
-// standard methods for which reflection-based fallback implementations exist?
+// standard methods?  If not (optimize_for = CODE_SIZE), each message
+// describes its fields in a static PBFieldTable, and the runtime's
+// PBFieldTable functions implement those methods for all of them.
 inline bool HasGeneratedMethods(const FileDescriptor *file) {
   return file->options().optimize_for() != FileOptions::CODE_SIZE;
 }
@@ -128,6 +157,10 @@ inline bool HasDescriptorMethods(const FileDescriptor *file) {
   return file->options().optimize_for() != FileOptions::LITE_RUNTIME;
 }
 
+// Can messages in this file be changed in place until they are frozen
+// (the mutable_messages Objective C file option)?
+bool HasMutableMessages(const FileDescriptor* file);
+
 }  // namespace objectivec
 }  // namespace compiler
 }  // namespace protobuf
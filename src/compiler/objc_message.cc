@@ -18,6 +18,7 @@
 #include "objc_message.h"
 
 #include <algorithm>
+#include <vector>
 #include <google/protobuf/stubs/hash.h>
 #include <google/protobuf/stubs/strutil.h>
 #include <google/protobuf/io/printer.h>
@@ -145,6 +146,29 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
         return false;
     }
 
+    // Packed fields memoize their payload size for the serializer.
+    static bool HasPackedFields(const Descriptor* type) {
+      for (int i = 0; i < type->field_count(); i++) {
+        if (type->field(i)->options().packed()) {
+          return true;
+        }
+      }
+      return false;
+    }
+
+    // Singular message fields are parsed and merged into through a
+    // sub-builder held by the message's builder.
+    static bool HasSubBuilders(const Descriptor* type) {
+      for (int i = 0; i < type->field_count(); i++) {
+        const FieldDescriptor* field = type->field(i);
+        if (field->cpp_type() == FieldDescriptor::CPPTYPE_MESSAGE &&
+            !field->is_repeated()) {
+          return true;
+        }
+      }
+      return false;
+    }
+
     static bool HasRequiredFields(const Descriptor* type) {
       hash_set<const Descriptor*> already_seen;
       return HasRequiredFields(type, &already_seen);
@@ -249,19 +273,21 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
   void MessageGenerator::GenerateMessageHeader(io::Printer* printer) {
     scoped_array<const FieldDescriptor*> sorted_fields(SortFieldsByType(descriptor_));
 
-    if (descriptor_->extension_range_count() > 0) {
-      printer->Print(
-        "@interface $classname$ : PBExtendableMessage {\n"
-        "@private\n",
-        "classname", ClassName(descriptor_));
-    } else {
-      printer->Print(
-        "@interface $classname$ : PBGeneratedMessage {\n"
-        "@private\n",
-        "classname", ClassName(descriptor_));
-    }
+    // The ivars are @package so that the builder, merging and isEqual: can
+    // read and write them without going through accessors.
+    printer->Print(
+      "@interface $classname$ : $superclass$$protocols$ {\n"
+      "@package\n",
+      "classname", ClassName(descriptor_),
+      "superclass", descriptor_->extension_range_count() > 0
+        ? "PBExtendableMessage" : "PBGeneratedMessage",
+      "protocols", HasMutableMessages(descriptor_->file())
+        ? " <NSCopying, NSMutableCopying>" : "");
 
     printer->Indent();
+    printer->Print(
+      "uint32_t hasBits_[$count$];\n",
+      "count", SimpleItoa(HasBitWordCount(descriptor_)));
     for (int i = 0; i < descriptor_->field_count(); i++) {
       field_generators_.get(sorted_fields[i]).GenerateHasFieldHeader(printer);
     }
@@ -281,6 +307,12 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
     for (int i = 0; i < descriptor_->field_count(); i++) {
       field_generators_.get(descriptor_->field(i)).GenerateMembersHeader(printer);
     }
+    if (HasMutableMessages(descriptor_->file())) {
+      printer->Print("\n");
+      for (int i = 0; i < descriptor_->field_count(); i++) {
+        field_generators_.get(descriptor_->field(i)).GenerateMutableMembersHeader(printer);
+      }
+    }
 
     printer->Print(
       "\n"
@@ -319,14 +351,25 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
 
 
   void MessageGenerator::GenerateSource(io::Printer* printer) {
+    if (!HasGeneratedMethods(descriptor_->file())) {
+      GenerateFieldTableSource(printer);
+    }
+
     printer->Print(
       "@interface $classname$ ()\n",
       "classname", ClassName(descriptor_));
     for (int i = 0; i < descriptor_->field_count(); i++) {
       field_generators_.get(descriptor_->field(i)).GenerateExtensionSource(printer);
     }
+    if (HasRequiredFields(descriptor_)) {
+      printer->Print("- (void) setInitialized;\n");
+    }
     printer->Print("@end\n\n");
 
+    // Declared ahead of the message so that it can hand the builder its
+    // prototype.
+    GenerateBuilderExtensionSource(printer);
+
     printer->Print("@implementation $classname$\n\n",
       "classname", ClassName(descriptor_));
 
@@ -344,58 +387,81 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
       "  [super dealloc];\n"
       "}\n");
 
+    // Puts the message back in its freshly initialized state for a builder
+    // or pool that is recycling it, keeping the storage of repeated fields
+    // that nothing else holds.
     printer->Print(
-      "- (id) init {\n"
-      "  if ((self = [super init])) {\n");
-    printer->Indent();
+      "- (void) clearForReuse {\n"
+      "  [super clearForReuse];\n"
+      "  memset(hasBits_, 0, sizeof(hasBits_));\n");
     printer->Indent();
     for (int i = 0; i < descriptor_->field_count(); i++) {
-      field_generators_.get(descriptor_->field(i)).GenerateInitializationSource(printer);
+      field_generators_.get(descriptor_->field(i)).GenerateResetSource(printer);
     }
     printer->Outdent();
-    printer->Outdent();
-    printer->Print(
-      "  }\n"
-      "  return self;\n"
-      "}\n");
+    printer->Print("}\n");
 
     for (int i = 0; i < descriptor_->extension_count(); i++) {
       ExtensionGenerator(ClassName(descriptor_), descriptor_->extension(i)).GenerateMembersSource(printer);
     }
 
-    printer->Print(
-      "static $classname$* default$classname$Instance = nil;\n"
-      "+ (void) initialize {\n"
-      "  if (self == [$classname$ class]) {\n"
-      "    default$classname$Instance = [[$classname$ alloc] init];\n",
-      "classname", ClassName(descriptor_));
+    if (!HasGeneratedMethods(descriptor_->file())) {
+      printer->Print(
+        "+ (void) initialize {\n"
+        "  if (self == [$classname$ class]) {\n"
+        "    PBFieldTableResolve(&$classname$_fieldTable, self);\n"
+        "  }\n"
+        "}\n",
+        "classname", ClassName(descriptor_));
+    }
 
+    // Default instances are only created when first asked for, so touching
+    // one message class does not initialize every class it refers to.
     printer->Print(
-      "  }\n"
-      "}\n"
+      "static $classname$* default$classname$Instance = nil;\n"
       "+ ($classname$*) defaultInstance {\n"
+      "  static dispatch_once_t onceToken;\n"
+      "  dispatch_once(&onceToken, ^{\n"
+      "    default$classname$Instance = [[$classname$ alloc] init];\n"
+      "$freeze_default$"
+      "  });\n"
       "  return default$classname$Instance;\n"
       "}\n"
       "- ($classname$*) defaultInstance {\n"
-      "  return default$classname$Instance;\n"
+      "  return [$classname$ defaultInstance];\n"
       "}\n",
-      "classname", ClassName(descriptor_));
+      "classname", ClassName(descriptor_),
+      "freeze_default", HasMutableMessages(descriptor_->file())
+        ? "    [default" + ClassName(descriptor_) + "Instance freeze];\n" : "");
 
     for (int i = 0; i < descriptor_->field_count(); i++) {
       field_generators_.get(descriptor_->field(i)).GenerateMembersSource(printer);
     }
 
+    if (HasMutableMessages(descriptor_->file())) {
+      GenerateMutableMethodsSource(printer);
+    }
+
     GenerateIsInitializedSource(printer);
     GenerateMessageSerializationMethodsSource(printer);
 
     GenerateParseFromMethodsSource(printer);
 
+    string share_prototype =
+      "  return [[[" + ClassName(descriptor_) + "_Builder alloc] initWithPrototype:prototype] autorelease];\n";
+    if (HasMutableMessages(descriptor_->file())) {
+      // Only frozen messages can be shared.
+      share_prototype =
+        "  if (![prototype isFrozen]) {\n"
+        "    return [[" + ClassName(descriptor_) + " builder] mergeFrom:prototype];\n"
+        "  }\n" + share_prototype;
+    }
     printer->Print(
       "+ ($classname$_Builder*) builder {\n"
       "  return [[[$classname$_Builder alloc] init] autorelease];\n"
       "}\n"
       "+ ($classname$_Builder*) builderWithPrototype:($classname$*) prototype {\n"
-      "  return [[$classname$ builder] mergeFrom:prototype];\n"
+      "$share_prototype$"
       "}\n"
       "- ($classname$_Builder*) builder {\n"
       "  return [$classname$ builder];\n"
@@ -403,9 +469,12 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
       "- ($classname$_Builder*) toBuilder {\n"
       "  return [$classname$ builderWithPrototype:self];\n"
       "}\n",
-      "classname", ClassName(descriptor_));
+      "classname", ClassName(descriptor_),
+      "share_prototype", share_prototype);
 
-    GenerateMessageDescriptionSource(printer);
+    if (HasDescriptorMethods(descriptor_->file())) {
+      GenerateMessageDescriptionSource(printer);
+    }
 
     GenerateMessageIsEqualSource(printer);
 
@@ -477,8 +546,14 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
     printer->Print(
       "@private\n"
       "  $classname$* result;\n"
-      "}\n",
+      "  $classname$* prototype_;\n",
       "classname", ClassName(descriptor_));
+    printer->Indent();
+    for (int i = 0; i < descriptor_->field_count(); i++) {
+      field_generators_.get(descriptor_->field(i)).GenerateBuilderFieldHeader(printer);
+    }
+    printer->Outdent();
+    printer->Print("}\n");
 
     GenerateCommonBuilderMethodsHeader(printer);
     GenerateBuilderParsingMethodsHeader(printer);
@@ -498,13 +573,21 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
       "- ($classname$*) defaultInstance;\n"
       "\n"
       "- ($classname$_Builder*) clear;\n"
-      "- ($classname$_Builder*) clone;\n",
+      "- ($classname$_Builder*) clone;\n"
+      "- ($classname$_Builder*) reset;\n"
+      "/**\n"
+      " * Clears message in place and makes it the result.  The caller must own\n"
+      " * the only reference to message: nothing else may hold it, including an\n"
+      " * enclosing message or a builder made from it with toBuilder.\n"
+      " */\n"
+      "- ($classname$_Builder*) recycle:($classname$*) message;\n",
       "classname", ClassName(descriptor_));
 
     printer->Print(
       "\n"
       "- ($classname$*) build;\n"
-      "- ($classname$*) buildPartial;\n",
+      "- ($classname$*) buildPartial;\n"
+      "- ($classname$*) newBuildPartial;\n",
       "classname", ClassName(descriptor_));
     printer->Indent();
 
@@ -544,6 +627,92 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
   }
 
 
+  // Messages in files optimized for code size describe their fields in a
+  // static table, which a shared engine in the runtime interprets in place of
+  // the generated parsing, serialization, isEqual: and hash code.
+  void MessageGenerator::GenerateFieldTableSource(io::Printer* printer) {
+    scoped_array<const FieldDescriptor*> sorted_fields(SortFieldsByNumber(descriptor_));
+
+    vector<const Descriptor::ExtensionRange*> sorted_extensions;
+    for (int i = 0; i < descriptor_->extension_range_count(); ++i) {
+      sorted_extensions.push_back(descriptor_->extension_range(i));
+    }
+    sort(sorted_extensions.begin(), sorted_extensions.end(),
+      ExtensionRangeOrdering());
+
+    map<string, string> vars;
+    vars["classname"] = ClassName(descriptor_);
+    vars["entry_count"] = SimpleItoa(descriptor_->field_count());
+    vars["range_count"] = SimpleItoa(sorted_extensions.size());
+    vars["entries"] = "NULL";
+    vars["ranges"] = "NULL";
+
+    if (descriptor_->field_count() > 0) {
+      vars["entries"] = vars["classname"] + "_fieldEntries";
+      printer->Print(vars,
+        "static PBFieldTableEntry $classname$_fieldEntries[] = {\n");
+      printer->Indent();
+
+      for (int i = 0; i < descriptor_->field_count(); i++) {
+        const FieldDescriptor* field = sorted_fields[i];
+        const string name = UnderscoresToCamelCase(field);
+
+        map<string, string> field_vars;
+        field_vars["number"] = SimpleItoa(field->number());
+        field_vars["type"] = GetExtensionType(field);
+        field_vars["flags"] = "0";
+        field_vars["has_bit"] = "-1";
+        field_vars["builder"] = "NULL";
+        field_vars["is_valid"] = "NULL";
+
+        if (field->is_repeated()) {
+          field_vars["flags"] = field->options().packed()
+            ? "PBFieldTableRepeated | PBFieldTablePacked"
+            : "PBFieldTableRepeated";
+          field_vars["ivar"] = name + "Array";
+        } else {
+          field_vars["has_bit"] = SimpleItoa(HasBitIndex(field));
+          field_vars["ivar"] = field->type() == FieldDescriptor::TYPE_BOOL
+            ? name + "_" : name;
+        }
+        if (field->cpp_type() == FieldDescriptor::CPPTYPE_MESSAGE) {
+          field_vars["builder"] = "\"" + ClassName(field->message_type()) + "_Builder\"";
+        } else if (field->cpp_type() == FieldDescriptor::CPPTYPE_ENUM) {
+          field_vars["is_valid"] =
+            "(BOOL (*)(int32_t))" + ClassName(field->enum_type()) + "IsValidValue";
+        }
+
+        printer->Print(field_vars,
+          "{ $number$, $type$, $flags$, $has_bit$, \"$ivar$\", $builder$, $is_valid$ },\n");
+      }
+
+      printer->Outdent();
+      printer->Print("};\n");
+    }
+
+    if (!sorted_extensions.empty()) {
+      vars["ranges"] = vars["classname"] + "_extensionRanges";
+      printer->Print(vars,
+        "static const int32_t $classname$_extensionRanges[] = {\n");
+      printer->Indent();
+      for (int i = 0; i < sorted_extensions.size(); i++) {
+        printer->Print(
+          "$start$, $end$,\n",
+          "start", SimpleItoa(sorted_extensions[i]->start),
+          "end", SimpleItoa(sorted_extensions[i]->end));
+      }
+      printer->Outdent();
+      printer->Print("};\n");
+    }
+
+    printer->Print(vars,
+      "static PBFieldTable $classname$_fieldTable = {\n"
+      "  $entries$, $entry_count$, $ranges$, $range_count$\n"
+      "};\n"
+      "\n");
+  }
+
+
   void MessageGenerator::GenerateMessageSerializationMethodsSource(io::Printer* printer) {
     scoped_array<const FieldDescriptor*> sorted_fields(SortFieldsByNumber(descriptor_));
 
@@ -554,25 +723,40 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
     sort(sorted_extensions.begin(), sorted_extensions.end(),
       ExtensionRangeOrdering());
 
+    const bool use_table = !HasGeneratedMethods(descriptor_->file());
+
     printer->Print(
       "- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output {\n");
     printer->Indent();
 
-    // Merge the fields and the extension ranges, both sorted by field number.
-    for (int i = 0, j = 0;
-      i < descriptor_->field_count() || j < sorted_extensions.size(); ) {
-        if (i == descriptor_->field_count()) {
-          GenerateSerializeOneExtensionRangeSource(printer, sorted_extensions[j++]);
-        } else if (j == sorted_extensions.size()) {
-          GenerateSerializeOneFieldSource(printer, sorted_fields[i++]);
-        } else if (sorted_fields[i]->number() < sorted_extensions[j]->start) {
-          GenerateSerializeOneFieldSource(printer, sorted_fields[i++]);
-        } else {
-          GenerateSerializeOneExtensionRangeSource(printer, sorted_extensions[j++]);
-        }
+    if (use_table) {
+      printer->Print(
+        "PBFieldTableWriteTo(&$classname$_fieldTable, self, output);\n",
+        "classname", ClassName(descriptor_));
+    } else {
+      if (HasPackedFields(descriptor_)) {
+        // Makes sure the packed field sizes are memoized.
+        printer->Print("[self serializedSize];\n");
+      }
+
+      // Merge the fields and the extension ranges, both sorted by field number.
+      for (int i = 0, j = 0;
+        i < descriptor_->field_count() || j < sorted_extensions.size(); ) {
+          if (i == descriptor_->field_count()) {
+            GenerateSerializeOneExtensionRangeSource(printer, sorted_extensions[j++]);
+          } else if (j == sorted_extensions.size()) {
+            GenerateSerializeOneFieldSource(printer, sorted_fields[i++]);
+          } else if (sorted_fields[i]->number() < sorted_extensions[j]->start) {
+            GenerateSerializeOneFieldSource(printer, sorted_fields[i++]);
+          } else {
+            GenerateSerializeOneExtensionRangeSource(printer, sorted_extensions[j++]);
+          }
+      }
     }
 
-    if (descriptor_->options().message_set_wire_format()) {
+    if (!HasUnknownFields(descriptor_->file())) {
+      // Nothing to write.
+    } else if (descriptor_->options().message_set_wire_format()) {
       printer->Print(
         "[self.unknownFields writeAsMessageSetTo:output];\n");
     } else {
@@ -584,16 +768,22 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
     printer->Print(
       "}\n"
       "- (int32_t) serializedSize {\n"
-      "  int32_t size_ = memoizedSerializedSize;\n"
+      "  int32_t size_ = PBGeneratedMessageGetMemoizedSize(&memoizedSerializedSize);\n"
       "  if (size_ != -1) {\n"
       "    return size_;\n"
       "  }\n"
-      "\n"
-      "  size_ = 0;\n");
+      "\n");
     printer->Indent();
 
-    for (int i = 0; i < descriptor_->field_count(); i++) {
-      field_generators_.get(sorted_fields[i]).GenerateSerializedSizeCodeSource(printer);
+    if (use_table) {
+      printer->Print(
+        "size_ = PBFieldTableSerializedSize(&$classname$_fieldTable, self);\n",
+        "classname", ClassName(descriptor_));
+    } else {
+      printer->Print("size_ = 0;\n");
+      for (int i = 0; i < descriptor_->field_count(); i++) {
+        field_generators_.get(sorted_fields[i]).GenerateSerializedSizeCodeSource(printer);
+      }
     }
 
     if (descriptor_->extension_range_count() > 0) {
@@ -601,7 +791,9 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
         "size_ += [self extensionsSerializedSize];\n");
     }
 
-    if (descriptor_->options().message_set_wire_format()) {
+    if (!HasUnknownFields(descriptor_->file())) {
+      // Nothing to count.
+    } else if (descriptor_->options().message_set_wire_format()) {
       printer->Print(
         "size_ += self.unknownFields.serializedSizeAsMessageSet;\n");
     } else {
@@ -610,8 +802,19 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
     }
 
     printer->Outdent();
+    if (HasMutableMessages(descriptor_->file())) {
+      // Until it is frozen, the message or anything it holds may change.
+      printer->Print(
+        "  if ($word$ & $mask$) {\n"
+        "    PBGeneratedMessageSetMemoizedSize(&memoizedSerializedSize, size_);\n"
+        "  }\n",
+        "word", HasBitWord(FrozenBitIndex(descriptor_)),
+        "mask", HasBitMask(FrozenBitIndex(descriptor_)));
+    } else {
+      printer->Print(
+        "  PBGeneratedMessageSetMemoizedSize(&memoizedSerializedSize, size_);\n");
+    }
     printer->Print(
-      "  memoizedSerializedSize = size_;\n"
       "  return size_;\n"
       "}\n");
   }
@@ -681,25 +884,38 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
     printer->Indent();
     printer->Indent();
 
-    // Merge the fields and the extension ranges, both sorted by field number.
-    for (int i = 0, j = 0;
-      i < descriptor_->field_count() || j < sorted_extensions.size(); ) {
-        if (i == descriptor_->field_count()) {
-          GenerateIsEqualOneExtensionRangeSource(printer, sorted_extensions[j++]);
-        } else if (j == sorted_extensions.size()) {
-          GenerateIsEqualOneFieldSource(printer, sorted_fields[i++]);
-        } else if (sorted_fields[i]->number() < sorted_extensions[j]->start) {
-          GenerateIsEqualOneFieldSource(printer, sorted_fields[i++]);
-        } else {
-          GenerateIsEqualOneExtensionRangeSource(printer, sorted_extensions[j++]);
-        }
-        printer->Print("\n");
+    if (!HasGeneratedMethods(descriptor_->file())) {
+      printer->Print(
+        "PBFieldTableIsEqual(&$classname$_fieldTable, self, otherMessage) &&\n",
+        "classname", ClassName(descriptor_));
+      for (int j = 0; j < sorted_extensions.size(); j++) {
+        GenerateIsEqualOneExtensionRangeSource(printer, sorted_extensions[j]);
+      }
+    } else {
+      // Merge the fields and the extension ranges, both sorted by field number.
+      for (int i = 0, j = 0;
+        i < descriptor_->field_count() || j < sorted_extensions.size(); ) {
+          if (i == descriptor_->field_count()) {
+            GenerateIsEqualOneExtensionRangeSource(printer, sorted_extensions[j++]);
+          } else if (j == sorted_extensions.size()) {
+            GenerateIsEqualOneFieldSource(printer, sorted_fields[i++]);
+          } else if (sorted_fields[i]->number() < sorted_extensions[j]->start) {
+            GenerateIsEqualOneFieldSource(printer, sorted_fields[i++]);
+          } else {
+            GenerateIsEqualOneExtensionRangeSource(printer, sorted_extensions[j++]);
+          }
+          printer->Print("\n");
+      }
     }
 
-    printer->Print(
-      "(self.unknownFields == otherMessage.unknownFields ||"
-      " (self.unknownFields != nil &&"
-      " [self.unknownFields isEqual:otherMessage.unknownFields]));\n");
+    if (HasUnknownFields(descriptor_->file())) {
+      printer->Print(
+        "(self.unknownFields == otherMessage.unknownFields ||"
+        " (self.unknownFields != nil &&"
+        " [self.unknownFields isEqual:otherMessage.unknownFields]));\n");
+    } else {
+      printer->Print("YES;\n");
+    }
 
     printer->Outdent();
     printer->Outdent();
@@ -718,32 +934,116 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
     sort(sorted_extensions.begin(), sorted_extensions.end(),
       ExtensionRangeOrdering());
 
+    // Built messages are immutable, so the hash is only computed once.
     printer->Print(
-      "- (NSUInteger) hash {\n");
+      "- (NSUInteger) hash {\n"
+      "  NSUInteger hash_ = PBGeneratedMessageGetMemoizedHash(&memoizedHash);\n"
+      "  if (hash_ != 0) {\n"
+      "    return hash_;\n"
+      "  }\n"
+      "\n");
     printer->Indent();
 
-    printer->Print("NSUInteger hashCode = 7;\n");
+    if (!HasGeneratedMethods(descriptor_->file())) {
+      printer->Print(
+        "uint64_t hashCode = PBFieldTableHash(&$classname$_fieldTable, self);\n",
+        "classname", ClassName(descriptor_));
+      for (int j = 0; j < sorted_extensions.size(); j++) {
+        GenerateHashOneExtensionRangeSource(printer, sorted_extensions[j]);
+      }
+    } else {
+      printer->Print("uint64_t hashCode = 7;\n");
+
+      // Merge the fields and the extension ranges, both sorted by field number.
+      for (int i = 0, j = 0;
+        i < descriptor_->field_count() || j < sorted_extensions.size(); ) {
+          if (i == descriptor_->field_count()) {
+            GenerateHashOneExtensionRangeSource(printer, sorted_extensions[j++]);
+          } else if (j == sorted_extensions.size()) {
+            GenerateHashOneFieldSource(printer, sorted_fields[i++]);
+          } else if (sorted_fields[i]->number() < sorted_extensions[j]->start) {
+            GenerateHashOneFieldSource(printer, sorted_fields[i++]);
+          } else {
+            GenerateHashOneExtensionRangeSource(printer, sorted_extensions[j++]);
+          }
+      }
+    }
 
-    // Merge the fields and the extension ranges, both sorted by field number.
-    for (int i = 0, j = 0;
-      i < descriptor_->field_count() || j < sorted_extensions.size(); ) {
-        if (i == descriptor_->field_count()) {
-          GenerateHashOneExtensionRangeSource(printer, sorted_extensions[j++]);
-        } else if (j == sorted_extensions.size()) {
-          GenerateHashOneFieldSource(printer, sorted_fields[i++]);
-        } else if (sorted_fields[i]->number() < sorted_extensions[j]->start) {
-          GenerateHashOneFieldSource(printer, sorted_fields[i++]);
-        } else {
-          GenerateHashOneExtensionRangeSource(printer, sorted_extensions[j++]);
-        }
+    if (HasUnknownFields(descriptor_->file())) {
+      printer->Print(
+        "hashCode = PBGeneratedMessageHashMix(hashCode, [self.unknownFields hash]);\n");
+    }
+    printer->Print("hash_ = PBGeneratedMessageHashFinish(hashCode);\n");
+    if (HasMutableMessages(descriptor_->file())) {
+      printer->Print(
+        "if ($word$ & $mask$) {\n"
+        "  PBGeneratedMessageSetMemoizedHash(&memoizedHash, hash_);\n"
+        "}\n",
+        "word", HasBitWord(FrozenBitIndex(descriptor_)),
+        "mask", HasBitMask(FrozenBitIndex(descriptor_)));
+    } else {
+      printer->Print("PBGeneratedMessageSetMemoizedHash(&memoizedHash, hash_);\n");
     }
+    printer->Print("return hash_;\n");
 
+    printer->Outdent();
     printer->Print(
-      "hashCode = hashCode * 31 + [self.unknownFields hash];\n"
-      "return hashCode;\n");
+      "}\n");
+  }
+
+
+  void MessageGenerator::GenerateMutableMethodsSource(io::Printer* printer) {
+    for (int i = 0; i < descriptor_->field_count(); i++) {
+      field_generators_.get(descriptor_->field(i)).GenerateMutableMembersSource(printer);
+    }
+
+    map<string, string> vars;
+    vars["classname"] = ClassName(descriptor_);
+    vars["frozen_word"] = HasBitWord(FrozenBitIndex(descriptor_));
+    vars["frozen_mask"] = HasBitMask(FrozenBitIndex(descriptor_));
+
+    printer->Print(vars,
+      "- (void) freeze {\n"
+      "  if ($frozen_word$ & $frozen_mask$) {\n"
+      "    return;\n"
+      "  }\n"
+      "  $frozen_word$ |= $frozen_mask$;\n"
+      "  [super freeze];\n");
+    printer->Indent();
+    for (int i = 0; i < descriptor_->field_count(); i++) {
+      field_generators_.get(descriptor_->field(i)).GenerateFreezeSource(printer);
+    }
+    printer->Outdent();
+    printer->Print(vars,
+      "}\n"
+      "- (BOOL) isFrozen {\n"
+      "  return ($frozen_word$ & $frozen_mask$) != 0;\n"
+      "}\n");
 
+    // A frozen message is its own copy.  Mutable copies go through a
+    // builder, which shares the field values, so the unfrozen messages
+    // among them are copied in turn.
+    printer->Print(vars,
+      "- (id) copyWithZone:(NSZone*) zone {\n"
+      "  if ($frozen_word$ & $frozen_mask$) {\n"
+      "    return [self retain];\n"
+      "  }\n"
+      "  $classname$* copy = [self mutableCopyWithZone:zone];\n"
+      "  [copy freeze];\n"
+      "  return copy;\n"
+      "}\n"
+      "- (id) mutableCopyWithZone:(NSZone*) zone {\n"
+      "  $classname$_Builder* builder = [[$classname$_Builder allocWithZone:zone] init];\n"
+      "  [builder mergeFrom:self];\n"
+      "  $classname$* copy = [builder newBuildPartial];\n"
+      "  [builder release];\n");
+    printer->Indent();
+    for (int i = 0; i < descriptor_->field_count(); i++) {
+      field_generators_.get(descriptor_->field(i)).GenerateMutableCopySource(printer);
+    }
     printer->Outdent();
     printer->Print(
+      "  return copy;\n"
       "}\n");
   }
 
@@ -829,34 +1129,117 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
   void MessageGenerator::GenerateHashOneExtensionRangeSource(
     io::Printer* printer, const Descriptor::ExtensionRange* range) {
       printer->Print(
-        "hashCode = hashCode * 31 + [self hashExtensionsFrom:$from$ to:$to$];\n",
+        "hashCode = PBGeneratedMessageHashMix(hashCode, [self hashExtensionsFrom:$from$ to:$to$]);\n",
         "from", SimpleItoa(range->start), "to", SimpleItoa(range->end));
   }
 
 
-  void MessageGenerator::GenerateBuilderSource(io::Printer* printer) {
+  void MessageGenerator::GenerateBuilderExtensionSource(io::Printer* printer) {
     printer->Print(
       "@interface $classname$_Builder()\n"
-      "@property (retain) $classname$* result;\n"
-      "@end\n"
-      "\n"
+      "@property (nonatomic, retain) $classname$* result;\n"
+      "- (id) initWithPrototype:($classname$*) prototype;\n"
+      "- (void) detachFromPrototype;\n",
+      "classname", ClassName(descriptor_));
+    if (HasSubBuilders(descriptor_)) {
+      printer->Print(
+        "- (void) freezeSubBuilders;\n"
+        "- (void) dropSubBuilders;\n"
+        "- (void) resetSubBuilders;\n");
+    }
+    printer->Print("@end\n\n");
+  }
+
+
+  void MessageGenerator::GenerateBuilderSource(io::Printer* printer) {
+    const bool has_sub_builders = HasSubBuilders(descriptor_);
+    printer->Print(
       "@implementation $classname$_Builder\n"
       "@synthesize result;\n"
-      "- (void) dealloc {\n"
+      "- (void) dealloc {\n",
+      "classname", ClassName(descriptor_));
+    if (has_sub_builders) {
+      printer->Print("  [self dropSubBuilders];\n");
+    }
+    // A result that was never handed out, and isn't a shared prototype,
+    // belongs to the builder alone, so it can go back to its pool.
+    printer->Print(
+      "  if (prototype_ == nil) {\n"
+      "    PBGeneratedMessageRecycle(result);\n"
+      "  }\n"
       "  self.result = nil;\n"
+      "  [prototype_ release];\n"
       "  [super dealloc];\n"
-      "}\n",
-      "classname", ClassName(descriptor_));
+      "}\n");
 
     printer->Print(
       "- (id) init {\n"
       "  if ((self = [super init])) {\n"
-      "    self.result = [[[$classname$ alloc] init] autorelease];\n"
+      "    result = [$classname$ recycledInstance];\n"
       "  }\n"
       "  return self;\n"
       "}\n",
       "classname", ClassName(descriptor_));
 
+    // Built messages never change, so a builder made from one can use it
+    // as its result until the first change, when the prototype is merged
+    // into a result of its own.  Repeated fields are copied with PBArray's
+    // copy, which shares their storage until one of them is appended to.
+    printer->Print(
+      "- (id) initWithPrototype:($classname$*) prototype {\n"
+      "  if ((self = [super init])) {\n"
+      "    self.result = prototype;\n"
+      "    prototype_ = [prototype retain];\n"
+      "  }\n"
+      "  return self;\n"
+      "}\n"
+      "- (void) detachFromPrototype {\n"
+      "  $classname$* prototype = prototype_;\n"
+      "  prototype_ = nil;\n"
+      "  self.result = [[[$classname$ alloc] init] autorelease];\n"
+      "  [self mergeFrom:prototype];\n"
+      "  [prototype release];\n"
+      "}\n"
+      "- ($result_class$*) internalGetMutableResult {\n"
+      "  if (prototype_ != nil) {\n"
+      "    [self detachFromPrototype];\n"
+      "  }\n"
+      "  return [self internalGetResult];\n"
+      "}\n",
+      "classname", ClassName(descriptor_),
+      "result_class", descriptor_->extension_range_count() > 0
+        ? "PBExtendableMessage" : "PBGeneratedMessage");
+
+    if (has_sub_builders) {
+      // Builds the values held by sub-builders into the result.  Anything
+      // that exposes the result, or copies it, has to call this first.
+      printer->Print("- (void) freezeSubBuilders {\n");
+      printer->Indent();
+      for (int i = 0; i < descriptor_->field_count(); i++) {
+        field_generators_.get(descriptor_->field(i)).GenerateBuilderFreezeSource(printer);
+      }
+      printer->Outdent();
+      printer->Print(
+        "}\n"
+        "- (void) dropSubBuilders {\n");
+      printer->Indent();
+      for (int i = 0; i < descriptor_->field_count(); i++) {
+        field_generators_.get(descriptor_->field(i)).GenerateBuilderDropSource(printer);
+      }
+      printer->Outdent();
+      // Resets the sub-builders in place of dropping them, so that a reset
+      // builder parses its sub-messages into the storage of the last ones.
+      printer->Print(
+        "}\n"
+        "- (void) resetSubBuilders {\n");
+      printer->Indent();
+      for (int i = 0; i < descriptor_->field_count(); i++) {
+        field_generators_.get(descriptor_->field(i)).GenerateBuilderResetSource(printer);
+      }
+      printer->Outdent();
+      printer->Print("}\n");
+    }
+
     GenerateCommonBuilderMethodsSource(printer);
     GenerateBuilderParsingMethodsSource(printer);
 
@@ -869,38 +1252,104 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
 
 
   void MessageGenerator::GenerateCommonBuilderMethodsSource(io::Printer* printer) {
-    if (descriptor_->extension_range_count() > 0) {
-      printer->Print(
-      "- (PBExtendableMessage*) internalGetResult {\n"
-      "  return result;\n"
-      "}\n");
-    } else {
-      printer->Print(
-      "- (PBGeneratedMessage*) internalGetResult {\n"
+    const bool has_sub_builders = HasSubBuilders(descriptor_);
+    map<string, string> vars;
+    vars["classname"] = ClassName(descriptor_);
+    vars["result_class"] = descriptor_->extension_range_count() > 0
+      ? "PBExtendableMessage" : "PBGeneratedMessage";
+    vars["freeze"] = has_sub_builders ? "  [self freezeSubBuilders];\n" : "";
+    vars["drop"] = has_sub_builders ? "  [self dropSubBuilders];\n" : "";
+    vars["reset"] = has_sub_builders ? "  [self resetSubBuilders];\n" : "";
+
+    printer->Print(vars,
+      "- ($result_class$*) internalGetResult {\n"
+      "$freeze$"
       "  return result;\n"
       "}\n");
-    }
 
-    printer->Print(
+    printer->Print(vars,
       "- ($classname$_Builder*) clear {\n"
-      "  self.result = [[[$classname$ alloc] init] autorelease];\n"
+      "$drop$"
+      "  if (prototype_ == nil) {\n"
+      "    PBGeneratedMessageRecycle(result);\n"
+      "  }\n"
+      "  [prototype_ release];\n"
+      "  prototype_ = nil;\n"
+      "  self.result = [[$classname$ recycledInstance] autorelease];\n"
       "  return self;\n"
       "}\n"
       "- ($classname$_Builder*) clone {\n"
-      "  return [$classname$ builderWithPrototype:result];\n"
+      "  if (prototype_ != nil) {\n"
+      "    return [[[$classname$_Builder alloc] initWithPrototype:prototype_] autorelease];\n"
+      "  }\n"
+      "$freeze$"
+      "  return [[$classname$ builder] mergeFrom:result];\n"
+      "}\n"
+      "- ($classname$_Builder*) reset {\n"
+      "$reset$"
+      "  if (result == nil || prototype_ != nil) {\n"
+      "    [prototype_ release];\n"
+      "    prototype_ = nil;\n"
+      "    self.result = [[$classname$ recycledInstance] autorelease];\n"
+      "  } else {\n"
+      "    [result clearForReuse];\n"
+      "  }\n"
+      "  return self;\n"
+      "}\n"
+      "- ($classname$_Builder*) recycle:($classname$*) message {\n"
+      "  if (message == [$classname$ defaultInstance]) {\n"
+      "    @throw [NSException exceptionWithName:@\"IllegalArgument\" reason:@\"Cannot recycle the default instance\" userInfo:nil];\n"
+      "  }\n"
+      "  [prototype_ release];\n"
+      "  prototype_ = nil;\n"
+      "  self.result = message;\n"
+      "  return [self reset];\n"
       "}\n"
       "- ($classname$*) defaultInstance {\n"
       "  return [$classname$ defaultInstance];\n"
-      "}\n",
-      "classname", ClassName(descriptor_));
+      "}\n");
 
-    printer->Print(
-      "- ($classname$*) build {\n"
-      "  [self checkInitialized];\n"
-      "  return [self buildPartial];\n"
+    if (HasRequiredFields(descriptor_)) {
+      // The built message is immutable, so it can remember that it has
+      // been checked, and the checks of any messages that contain it stop
+      // there.  A builder still holding its prototype returns that shared
+      // message as is, and other threads may be reading its has bits.
+      printer->Print(
+        "- ($classname$*) build {\n"
+        "  [self checkInitialized];\n"
+        "  BOOL shared = prototype_ != nil;\n"
+        "  $classname$* returnMe = [self buildPartial];\n"
+        "  if (!shared) {\n"
+        "    [returnMe setInitialized];\n"
+        "  }\n"
+        "  return returnMe;\n"
+        "}\n",
+        "classname", ClassName(descriptor_));
+    } else {
+      printer->Print(
+        "- ($classname$*) build {\n"
+        "  [self checkInitialized];\n"
+        "  return [self buildPartial];\n"
+        "}\n",
+        "classname", ClassName(descriptor_));
+    }
+    // newBuildPartial hands the result over at +1, which lets the parsers
+    // of enclosing messages store it without an autorelease.
+    printer->Print(vars,
+      "- ($classname$*) buildPartial {\n"
+      "  return [[self newBuildPartial] autorelease];\n"
       "}\n"
-      "- ($classname$*) buildPartial {\n",
-      "classname", ClassName(descriptor_));
+      "- ($classname$*) newBuildPartial {\n"
+      "  if (prototype_ != nil) {\n"
+      "    [prototype_ release];\n"
+      "    prototype_ = nil;\n"
+      "    $classname$* returnMe = result;\n"
+      "    result = nil;\n"
+      "    return returnMe;\n"
+      "  }\n");
+    if (has_sub_builders) {
+      printer->Print("  [self freezeSubBuilders];\n");
+    }
     printer->Indent();
 
     for (int i = 0; i < descriptor_->field_count(); i++) {
@@ -909,8 +1358,8 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
 
     printer->Outdent();
     printer->Print(
-      "  $classname$* returnMe = [[result retain] autorelease];\n"
-      "  self.result = nil;\n"
+      "  $classname$* returnMe = result;\n"
+      "  result = nil;\n"
       "  return returnMe;\n"
       "}\n",
       "classname", ClassName(descriptor_));
@@ -921,6 +1370,9 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
       //   fields are set so we can skip the merge.
       "  if (other == [$classname$ defaultInstance]) {\n"
       "    return self;\n"
+      "  }\n"
+      "  if (prototype_ != nil) {\n"
+      "    [self detachFromPrototype];\n"
       "  }\n",
       "classname", ClassName(descriptor_));
     printer->Indent();
@@ -936,8 +1388,11 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
         "  [self mergeExtensionFields:other];\n");
     }
 
+    if (HasUnknownFields(descriptor_->file())) {
+      printer->Print(
+        "  [self mergeUnknownFields:other.unknownFields];\n");
+    }
     printer->Print(
-      "  [self mergeUnknownFields:other.unknownFields];\n"
       "  return self;\n"
       "}\n");
   }
@@ -951,12 +1406,35 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
       "- ($classname$_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input {\n"
       "  return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];\n"
       "}\n"
-      "- ($classname$_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {\n",
+      "- ($classname$_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {\n"
+      "  if (prototype_ != nil) {\n"
+      "    [self detachFromPrototype];\n"
+      "  }\n",
       "classname", ClassName(descriptor_));
+
+    if (!HasGeneratedMethods(descriptor_->file())) {
+      // The table merges singular messages straight into the result.
+      if (HasSubBuilders(descriptor_)) {
+        printer->Print("  [self freezeSubBuilders];\n");
+      }
+      printer->Print(
+        "  PBFieldTableMergeFromCodedInputStream(&$classname$_fieldTable, self, result, input, extensionRegistry);\n"
+        "  return self;\n"
+        "}\n",
+        "classname", ClassName(descriptor_));
+      return;
+    }
+
     printer->Indent();
 
+    const bool has_unknown_fields = HasUnknownFields(descriptor_->file());
+    if (has_unknown_fields) {
+      // The unknown field builder is only created once an unknown field
+      // turns up, so messages without any keep the shared empty set.
+      printer->Print(
+        "PBUnknownFieldSet_Builder* unknownFields = nil;\n");
+    }
     printer->Print(
-      "PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];\n"
       "while (YES) {\n");
     printer->Indent();
 
@@ -965,17 +1443,47 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
       "switch (tag) {\n");
     printer->Indent();
 
-    printer->Print(
-      "case 0:\n"          // zero signals EOF / limit reached
-      "  [self setUnknownFields:[unknownFields build]];\n"
-      "  return self;\n"
-      "default: {\n"
-      "  if (![self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag]) {\n"
-      "    [self setUnknownFields:[unknownFields build]];\n"
-      "    return self;\n"   // it's an endgroup tag
-      "  }\n"
-      "  break;\n"
-      "}\n");
+    if (has_unknown_fields) {
+      printer->Print(
+        "case 0:\n"          // zero signals EOF / limit reached
+        "  if (unknownFields != nil) {\n"
+        "    [self setUnknownFields:[unknownFields build]];\n"
+        "  }\n"
+        "  return self;\n"
+        "default: {\n"
+        "  if (PBWireFormatGetTagWireType(tag) == PBWireFormatEndGroup) {\n"
+        "    if (unknownFields != nil) {\n"
+        "      [self setUnknownFields:[unknownFields build]];\n"
+        "    }\n"
+        "    return self;\n"
+        "  }\n"
+        "  if (unknownFields == nil) {\n"
+        "    unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];\n"
+        "  }\n"
+        "  [self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag];\n"
+        "  break;\n"
+        "}\n");
+    } else {
+      // Lite messages skip unknown fields on the wire rather than keep them.
+      // Extendable ones still have to look for extensions first.
+      printer->Print(
+        "case 0:\n"
+        "  return self;\n"
+        "default: {\n"
+        "  if (PBWireFormatGetTagWireType(tag) == PBWireFormatEndGroup) {\n"
+        "    return self;\n"
+        "  }\n");
+      if (descriptor_->extension_range_count() > 0) {
+        printer->Print(
+          "  [self parseUnknownField:input unknownFields:nil extensionRegistry:extensionRegistry tag:tag];\n");
+      } else {
+        printer->Print(
+          "  [input skipField:tag];\n");
+      }
+      printer->Print(
+        "  break;\n"
+        "}\n");
+    }
 
     for (int i = 0; i < descriptor_->field_count(); i++) {
       const FieldDescriptor* field = sorted_fields[i];
@@ -1006,22 +1514,58 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
 
 
   void MessageGenerator::GenerateIsInitializedSource(io::Printer* printer) {
+    const bool has_required_fields = HasRequiredFields(descriptor_);
+    if (has_required_fields && HasMutableMessages(descriptor_->file())) {
+      // A message that can still change has to be checked every time.
+      printer->Print(
+        "- (void) setInitialized {\n"
+        "  if ($frozen_word$ & $frozen_mask$) {\n"
+        "    $word$ |= $mask$;\n"
+        "  }\n"
+        "}\n",
+        "frozen_word", HasBitWord(FrozenBitIndex(descriptor_)),
+        "frozen_mask", HasBitMask(FrozenBitIndex(descriptor_)),
+        "word", HasBitWord(InitializedBitIndex(descriptor_)),
+        "mask", HasBitMask(InitializedBitIndex(descriptor_)));
+    } else if (has_required_fields) {
+      printer->Print(
+        "- (void) setInitialized {\n"
+        "  $word$ |= $mask$;\n"
+        "}\n",
+        "word", HasBitWord(InitializedBitIndex(descriptor_)),
+        "mask", HasBitMask(InitializedBitIndex(descriptor_)));
+    }
+
     printer->Print(
       "- (BOOL) isInitialized {\n");
     printer->Indent();
 
-    // Check that all required fields in this message are set.
-    // TODO(kenton):  We can optimize this when we switch to putting all the
-    //   "has" fields into a single bitfield.
+    if (has_required_fields) {
+      printer->Print(
+        "if (($word$ & $mask$) != 0) {\n"
+        "  return YES;\n"
+        "}\n",
+        "word", HasBitWord(InitializedBitIndex(descriptor_)),
+        "mask", HasBitMask(InitializedBitIndex(descriptor_)));
+    }
+
+    // Check that all required fields in this message are set, one has bits
+    // word at a time.
+    vector<uint32> required_masks(HasBitWordCount(descriptor_), 0);
     for (int i = 0; i < descriptor_->field_count(); i++) {
       const FieldDescriptor* field = descriptor_->field(i);
-
       if (field->is_required()) {
+        required_masks[HasBitIndex(field) / 32] |= 1u << (HasBitIndex(field) % 32);
+      }
+    }
+    for (int i = 0; i < HasBitWordCount(descriptor_); i++) {
+      if (required_masks[i] != 0) {
         printer->Print(
-          "if (!self.has$capitalized_name$) {\n"
+          "if ((hasBits_[$index$] & $mask$) != $mask$) {\n"
           "  return NO;\n"
           "}\n",
-          "capitalized_name", UnderscoresToCapitalizedCamelCase(field));
+          "index", SimpleItoa(i),
+          "mask", "0x" + ToHex(required_masks[i]) + "u");
       }
     }
 
@@ -1035,25 +1579,33 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
           vars["type"] = ClassName(field->message_type());
           vars["name"] = UnderscoresToCamelCase(field);
           vars["capitalized_name"] = UnderscoresToCapitalizedCamelCase(field);
+          vars["list_name"] = UnderscoresToCamelCase(field) + "Array";
+          // Only the parsed value of a lazy field can say whether its
+          // required fields are set, so checking one (as build does) parses
+          // it.  The getter keeps the parsed value, so reading the field
+          // afterwards costs nothing more.
+          vars["value"] = IsLazy(field) ? "self." + vars["name"] : vars["name"];
 
           switch (field->label()) {
             case FieldDescriptor::LABEL_REQUIRED:
               printer->Print(vars,
-                "if (!self.$name$.isInitialized) {\n"
+                "if (!$value$.isInitialized) {\n"
                 "  return NO;\n"
                 "}\n");
               break;
             case FieldDescriptor::LABEL_OPTIONAL:
+              vars["has_bit_word"] = HasBitWord(HasBitIndex(field));
+              vars["has_bit_mask"] = HasBitMask(HasBitIndex(field));
               printer->Print(vars,
-                "if (self.has$capitalized_name$) {\n"
-                "  if (!self.$name$.isInitialized) {\n"
+                "if (($has_bit_word$ & $has_bit_mask$) != 0) {\n"
+                "  if (!$value$.isInitialized) {\n"
                 "    return NO;\n"
                 "  }\n"
                 "}\n");
               break;
             case FieldDescriptor::LABEL_REPEATED:
               printer->Print(vars,
-                "for ($type$* element in self.$name$) {\n"
+                "for ($type$* element in $list_name$) {\n"
                 "  if (!element.isInitialized) {\n"
                 "    return NO;\n"
                 "  }\n"
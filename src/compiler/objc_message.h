@@ -63,6 +63,7 @@ class MessageGenerator {
   void GenerateIsInitializedHeader(io::Printer* printer);
 
 
+  void GenerateFieldTableSource(io::Printer* printer);
   void GenerateMessageSerializationMethodsSource(io::Printer* printer);
   void GenerateParseFromMethodsSource(io::Printer* printer);
   void GenerateSerializeOneFieldSource(io::Printer* printer,
@@ -82,12 +83,15 @@ class MessageGenerator {
   void GenerateIsEqualOneExtensionRangeSource(
       io::Printer* printer, const Descriptor::ExtensionRange* range);
 
+  void GenerateMutableMethodsSource(io::Printer* printer);
+
   void GenerateMessageHashSource(io::Printer* printer);
   void GenerateHashOneFieldSource(io::Printer* printer,
                                  const FieldDescriptor* field);
   void GenerateHashOneExtensionRangeSource(
       io::Printer* printer, const Descriptor::ExtensionRange* range);
 
+  void GenerateBuilderExtensionSource(io::Printer* printer);
   void GenerateBuilderSource(io::Printer* printer);
   void GenerateCommonBuilderMethodsSource(io::Printer* printer);
   void GenerateBuilderParsingMethodsSource(io::Printer* printer);
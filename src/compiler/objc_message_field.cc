@@ -36,6 +36,17 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
         (*variables)["name"] = name;
         (*variables)["capitalized_name"] = UnderscoresToCapitalizedCamelCase(descriptor);
         (*variables)["list_name"] = UnderscoresToCamelCase(descriptor) + "Array";
+        (*variables)["array_class"] = GetArrayClassName(descriptor);
+        if (!descriptor->is_repeated()) {
+          (*variables)["has_bit_word"] = HasBitWord(HasBitIndex(descriptor));
+          (*variables)["has_bit_mask"] = HasBitMask(HasBitIndex(descriptor));
+        }
+        (*variables)["detach"] =
+          "  if (prototype_ != nil) {\n"
+          "    [self detachFromPrototype];\n"
+          "  }\n";
+        (*variables)["frozen_word"] = HasBitWord(FrozenBitIndex(descriptor->containing_type()));
+        (*variables)["frozen_mask"] = HasBitMask(FrozenBitIndex(descriptor->containing_type()));
         (*variables)["number"] = SimpleItoa(descriptor->number());
         (*variables)["type"] = ClassName(descriptor->message_type());
         if (IsPrimitiveType(GetObjectiveCType(descriptor))) {
@@ -52,6 +63,16 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
         (*variables)["group_or_message"] =
           (descriptor->type() == FieldDescriptor::TYPE_GROUP) ?
           "Group" : "Message";
+
+        // A lazy field's ivar is nil until its bytes have been parsed, so
+        // it is read through its getter.
+        if (!descriptor->is_repeated() && IsLazy(descriptor)) {
+          (*variables)["value"] = "self." + name;
+          (*variables)["other_value"] = "otherMessage." + name;
+        } else {
+          (*variables)["value"] = name;
+          (*variables)["other_value"] = "otherMessage->" + name;
+        }
     }
   }  // namespace
 
@@ -67,12 +88,17 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
 
 
   void MessageFieldGenerator::GenerateHasFieldHeader(io::Printer* printer) const {
-    printer->Print(variables_, "BOOL has$capitalized_name$_:1;\n");
+    // Declared by the message as part of its hasBits_ words.
   }
 
 
   void MessageFieldGenerator::GenerateFieldHeader(io::Printer* printer) const {
     printer->Print(variables_, "$storage_type$ $name$$storage_attribute$;\n");
+    if (IsLazy(descriptor_)) {
+      printer->Print(variables_,
+        "NSData* $name$Bytes_;\n"
+        "PBExtensionRegistry* $name$Registry_;\n");
+    }
   }
 
 
@@ -82,13 +108,13 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
 
 
   void MessageFieldGenerator::GeneratePropertyHeader(io::Printer* printer) const {
-    printer->Print(variables_, "@property (readonly, retain)$storage_attribute$ $storage_type$ $name$;\n");
+    printer->Print(variables_, "@property (nonatomic, readonly, retain)$storage_attribute$ $storage_type$ $name$;\n");
   }
 
 
   void MessageFieldGenerator::GenerateExtensionSource(io::Printer* printer) const {
     printer->Print(variables_,
-      "@property (retain)$storage_attribute$ $storage_type$ $name$;\n");
+      "@property (nonatomic, retain)$storage_attribute$ $storage_type$ $name$;\n");
   }
 
 
@@ -99,22 +125,70 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
   void MessageFieldGenerator::GenerateSynthesizeSource(io::Printer* printer) const {
     printer->Print(variables_,
       "- (BOOL) has$capitalized_name$ {\n"
-      "  return !!has$capitalized_name$_;\n"
+      "  return ($has_bit_word$ & $has_bit_mask$) != 0;\n"
       "}\n"
       "- (void) setHas$capitalized_name$:(BOOL) value_ {\n"
-      "  has$capitalized_name$_ = !!value_;\n"
+      "  if (value_) {\n"
+      "    $has_bit_word$ |= $has_bit_mask$;\n"
+      "  } else {\n"
+      "    $has_bit_word$ &= ~$has_bit_mask$;\n"
+      "  }\n"
       "}\n"
       "@synthesize $name$;\n");
+
+    // The ivar stays nil until the field is set, and the getter falls back
+    // on the default instance, which is only created when first needed.
+    if (IsLazy(descriptor_)) {
+      // Built messages may be read from several threads, so the parsed
+      // value is published with a compare-and-swap.  The bytes are parsed
+      // with the registry the enclosing message was parsed with, so their
+      // extensions come out the same as if they had been parsed eagerly.
+      printer->Print(variables_,
+        "- ($storage_type$) $name$ {\n"
+        "  if ($name$ == nil) {\n"
+        "    if ($name$Bytes_ == nil) {\n"
+        "      return [$type$ defaultInstance];\n"
+        "    }\n"
+        "    $type$_Builder* builder = [[$type$_Builder alloc] init];\n"
+        "    @try {\n"
+        "      [builder mergeFromData:$name$Bytes_ extensionRegistry:$name$Registry_];\n"
+        "      PBGeneratedMessageSetLazyValue((id*)&$name$, [builder newBuildPartial]);\n"
+        "    } @finally {\n"
+        "      [builder release];\n"
+        "    }\n"
+        "  }\n"
+        "  return $name$;\n"
+        "}\n");
+    } else {
+      printer->Print(variables_,
+        "- ($storage_type$) $name$ {\n"
+        "  return $name$ != nil ? $name$ : [$type$ defaultInstance];\n"
+        "}\n");
+    }
   }
 
 
   void MessageFieldGenerator::GenerateDeallocSource(io::Printer* printer) const {
-    printer->Print(variables_, "self.$name$ = nil;\n");
+    printer->Print(variables_, "[$name$ release];\n");
+    if (IsLazy(descriptor_)) {
+      printer->Print(variables_,
+        "[$name$Bytes_ release];\n"
+        "[$name$Registry_ release];\n");
+    }
   }
 
 
-  void MessageFieldGenerator::GenerateInitializationSource(io::Printer* printer) const {
-    printer->Print(variables_, "self.$name$ = [$type$ defaultInstance];\n");
+  void MessageFieldGenerator::GenerateResetSource(io::Printer* printer) const {
+    if (IsLazy(descriptor_)) {
+      printer->Print(variables_,
+        "[$name$Bytes_ release];\n"
+        "$name$Bytes_ = nil;\n"
+        "[$name$Registry_ release];\n"
+        "$name$Registry_ = nil;\n");
+    }
+    printer->Print(variables_,
+      "[$name$ release];\n"
+      "$name$ = nil;\n");
   }
 
 
@@ -126,18 +200,51 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
       "- ($classname$_Builder*) set$capitalized_name$Builder:($type$_Builder*) builderForValue;\n"
       "- ($classname$_Builder*) merge$capitalized_name$:($storage_type$) value;\n"
       "- ($classname$_Builder*) clear$capitalized_name$;\n");
+    if (IsLazy(descriptor_)) {
+      printer->Print(variables_,
+        "- ($classname$_Builder*) merge$capitalized_name$Data:(NSData*) data\n"
+        "    extensionRegistry:(PBExtensionRegistry*) extensionRegistry;\n");
+    }
   }
 
-  void MessageFieldGenerator::GenerateBuilderMembersSource(io::Printer* printer) const {
+  void MessageFieldGenerator::GenerateBuilderFieldHeader(io::Printer* printer) const {
     printer->Print(variables_,
+      "$type$_Builder* $name$Builder_;\n"
+      "$type$_Builder* $name$SpareBuilder_;\n");
+  }
+
+
+  void MessageFieldGenerator::GenerateBuilderMembersSource(io::Printer* printer) const {
+    // While the field is being parsed or merged into, its value lives in
+    // $name$Builder_ and is only built into the result when the result is
+    // looked at.
+    map<string, string> vars(variables_);
+    vars["drop_bytes"] = "";
+    vars["drop_nested_bytes"] = "";
+    if (IsLazy(descriptor_)) {
+      const string& name = vars["name"];
+      vars["drop_bytes"] =
+        "  [result->" + name + "Bytes_ release];\n"
+        "  result->" + name + "Bytes_ = nil;\n"
+        "  [result->" + name + "Registry_ release];\n"
+        "  result->" + name + "Registry_ = nil;\n";
+      vars["drop_nested_bytes"] =
+        StringReplace("  " + vars["drop_bytes"], "\n  ", "\n    ", true);
+    }
+    printer->Print(vars,
       "- (BOOL) has$capitalized_name$ {\n"
-      "  return result.has$capitalized_name$;\n"
+      "  return (result->$has_bit_word$ & $has_bit_mask$) != 0;\n"
       "}\n"
       "- ($storage_type$) $name$ {\n"
+      "  [self freezeSubBuilders];\n"
       "  return result.$name$;\n"
       "}\n"
       "- ($classname$_Builder*) set$capitalized_name$:($storage_type$) value {\n"
-      "  result.has$capitalized_name$ = YES;\n"
+      "$detach$"
+      "  [$name$Builder_ release];\n"
+      "  $name$Builder_ = nil;\n"
+      "$drop_bytes$"
+      "  result->$has_bit_word$ |= $has_bit_mask$;\n"
       "  result.$name$ = value;\n"
       "  return self;\n"
       "}\n"
@@ -145,36 +252,137 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
       "  return [self set$capitalized_name$:[builderForValue build]];\n"
       "}\n"
       "- ($classname$_Builder*) merge$capitalized_name$:($storage_type$) value {\n"
-      "  if (result.has$capitalized_name$ &&\n"
-      "      result.$name$ != [$type$ defaultInstance]) {\n"
-      "    result.$name$ =\n"
-      "      [[[$type$ builderWithPrototype:result.$name$] mergeFrom:value] buildPartial];\n"
-      "  } else {\n"
-      "    result.$name$ = value;\n"
+      "$detach$");
+    if (IsLazy(descriptor_)) {
+      // Merging needs the parsed value, after which the bytes are stale.
+      printer->Print(vars,
+        "  if (result->$name$Bytes_ != nil) {\n"
+        "    [result $name$];\n"
+        "$drop_nested_bytes$"
+        "  }\n");
+    }
+    printer->Print(vars,
+      "  if ($name$Builder_ == nil) {\n"
+      "    if (!(result->$has_bit_word$ & $has_bit_mask$) ||\n"
+      "        result->$name$ == [$type$ defaultInstance]) {\n"
+      "      result->$has_bit_word$ |= $has_bit_mask$;\n"
+      "      result.$name$ = value;\n"
+      "      return self;\n"
+      "    }\n"
+      "    $name$Builder_ = $name$SpareBuilder_ != nil ? $name$SpareBuilder_ : [[$type$_Builder alloc] init];\n"
+      "    $name$SpareBuilder_ = nil;\n"
+      "    [$name$Builder_ mergeFrom:result->$name$];\n"
       "  }\n"
-      "  result.has$capitalized_name$ = YES;\n"
+      "  [$name$Builder_ mergeFrom:value];\n"
       "  return self;\n"
       "}\n"
       "- ($classname$_Builder*) clear$capitalized_name$ {\n"
-      "  result.has$capitalized_name$ = NO;\n"
-      "  result.$name$ = [$type$ defaultInstance];\n"
+      "$detach$"
+      "  [$name$Builder_ release];\n"
+      "  $name$Builder_ = nil;\n"
+      "$drop_bytes$"
+      "  result->$has_bit_word$ &= ~$has_bit_mask$;\n"
+      "  [result->$name$ release];\n"
+      "  result->$name$ = nil;\n"
       "  return self;\n"
       "}\n");
+
+    if (IsLazy(descriptor_)) {
+      // Serialized values concatenate into their merge, so while the field
+      // is unset or still unparsed the bytes are simply appended.  Bytes
+      // meant for another registry can't share one parse, so the value
+      // already there is parsed and the new bytes merged into it.
+      printer->Print(vars,
+        "- ($classname$_Builder*) merge$capitalized_name$Data:(NSData*) data\n"
+        "    extensionRegistry:(PBExtensionRegistry*) extensionRegistry {\n"
+        "$detach$"
+        "  if ($name$Builder_ == nil &&\n"
+        "      (!(result->$has_bit_word$ & $has_bit_mask$) ||\n"
+        "       (result->$name$Bytes_ != nil && result->$name$Registry_ == extensionRegistry))) {\n"
+        "    if (result->$name$Bytes_ == nil) {\n"
+        "      result->$name$Bytes_ = [data copy];\n"
+        "      result->$name$Registry_ = [extensionRegistry retain];\n"
+        "    } else {\n"
+        "      NSMutableData* merged = [result->$name$Bytes_ mutableCopy];\n"
+        "      [merged appendData:data];\n"
+        "      [result->$name$Bytes_ release];\n"
+        "      result->$name$Bytes_ = merged;\n"
+        "    }\n"
+        "    [result->$name$ release];\n"
+        "    result->$name$ = nil;\n"
+        "    result->$has_bit_word$ |= $has_bit_mask$;\n"
+        "    return self;\n"
+        "  }\n"
+        "  if ($name$Builder_ == nil) {\n"
+        "    $name$Builder_ = $name$SpareBuilder_ != nil ? $name$SpareBuilder_ : [[$type$_Builder alloc] init];\n"
+        "    $name$SpareBuilder_ = nil;\n"
+        "    [$name$Builder_ mergeFrom:result.$name$];\n"
+        "$drop_nested_bytes$"
+        "  }\n"
+        "  [$name$Builder_ mergeFromData:data extensionRegistry:extensionRegistry];\n"
+        "  return self;\n"
+        "}\n");
+    }
   }
 
 
-  void MessageFieldGenerator::GenerateMergingCodeHeader(io::Printer* printer) const {
+  void MessageFieldGenerator::GenerateBuilderFreezeSource(io::Printer* printer) const {
+    printer->Print(variables_,
+      "if ($name$Builder_ != nil) {\n"
+      "  $type$* value = [$name$Builder_ newBuildPartial];\n"
+      "  result.$name$ = value;\n"
+      "  [value release];\n"
+      "  [$name$Builder_ release];\n"
+      "  $name$Builder_ = nil;\n"
+      "}\n");
   }
 
 
-  void MessageFieldGenerator::GenerateMergingCodeSource(io::Printer* printer) const {
+  void MessageFieldGenerator::GenerateBuilderDropSource(io::Printer* printer) const {
+    printer->Print(variables_,
+      "[$name$Builder_ release];\n"
+      "$name$Builder_ = nil;\n"
+      "[$name$SpareBuilder_ release];\n"
+      "$name$SpareBuilder_ = nil;\n");
+  }
+
+
+  void MessageFieldGenerator::GenerateBuilderResetSource(io::Printer* printer) const {
+    // A sub-builder means the field is set, so the reset one is set aside
+    // until the next value parsed or merged into the field takes it back.
     printer->Print(variables_,
-      "if (other.has$capitalized_name$) {\n"
-      "  [self merge$capitalized_name$:other.$name$];\n"
+      "if ($name$Builder_ != nil) {\n"
+      "  [$name$Builder_ reset];\n"
+      "  [$name$SpareBuilder_ release];\n"
+      "  $name$SpareBuilder_ = $name$Builder_;\n"
+      "  $name$Builder_ = nil;\n"
       "}\n");
   }
 
 
+  void MessageFieldGenerator::GenerateMergingCodeHeader(io::Printer* printer) const {
+  }
+
+
+  void MessageFieldGenerator::GenerateMergingCodeSource(io::Printer* printer) const {
+    if (IsLazy(descriptor_)) {
+      printer->Print(variables_,
+        "if (other->$has_bit_word$ & $has_bit_mask$) {\n"
+        "  if (other->$name$Bytes_ != nil) {\n"
+        "    [self merge$capitalized_name$Data:other->$name$Bytes_ extensionRegistry:other->$name$Registry_];\n"
+        "  } else {\n"
+        "    [self merge$capitalized_name$:other->$name$];\n"
+        "  }\n"
+        "}\n");
+    } else {
+      printer->Print(variables_,
+        "if (other->$has_bit_word$ & $has_bit_mask$) {\n"
+        "  [self merge$capitalized_name$:other->$name$];\n"
+        "}\n");
+    }
+  }
+
+
   void MessageFieldGenerator::GenerateBuildingCodeHeader(io::Printer* printer) const {
   }
 
@@ -188,22 +396,33 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
 
 
   void MessageFieldGenerator::GenerateParsingCodeSource(io::Printer* printer) const {
+    if (IsLazy(descriptor_)) {
+      printer->Print(variables_,
+        "NSData* data = [input newData];\n"
+        "[self merge$capitalized_name$Data:data extensionRegistry:extensionRegistry];\n"
+        "[data release];\n");
+      return;
+    }
+
+    // A field that appears more than once keeps parsing into the same
+    // sub-builder; only the first occurrence copies an existing value.
     printer->Print(variables_,
-      "$type$_Builder* subBuilder = [$type$ builder];\n"
-      "if (self.has$capitalized_name$) {\n"
-      "  [subBuilder mergeFrom:self.$name$];\n"
+      "if ($name$Builder_ == nil) {\n"
+      "  $name$Builder_ = $name$SpareBuilder_ != nil ? $name$SpareBuilder_ : [[$type$_Builder alloc] init];\n"
+      "  $name$SpareBuilder_ = nil;\n"
+      "  if (result->$has_bit_word$ & $has_bit_mask$) {\n"
+      "    [$name$Builder_ mergeFrom:result->$name$];\n"
+      "  }\n"
+      "  result->$has_bit_word$ |= $has_bit_mask$;\n"
       "}\n");
 
     if (descriptor_->type() == FieldDescriptor::TYPE_GROUP) {
       printer->Print(variables_,
-        "[input readGroup:$number$ builder:subBuilder extensionRegistry:extensionRegistry];\n");
+        "[input readGroup:$number$ builder:$name$Builder_ extensionRegistry:extensionRegistry];\n");
     } else {
       printer->Print(variables_,
-        "[input readMessage:subBuilder extensionRegistry:extensionRegistry];\n");
+        "[input readMessage:$name$Builder_ extensionRegistry:extensionRegistry];\n");
     }
-
-    printer->Print(variables_,
-      "[self set$capitalized_name$:[subBuilder buildPartial]];\n");
   }
 
 
@@ -212,10 +431,23 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
 
 
   void MessageFieldGenerator::GenerateSerializationCodeSource(io::Printer* printer) const {
-    printer->Print(variables_,
-      "if (self.has$capitalized_name$) {\n"
-      "  [output write$group_or_message$:$number$ value:self.$name$];\n"
-      "}\n");
+    if (IsLazy(descriptor_)) {
+      // The retained bytes are the value's encoding, whether or not it has
+      // been parsed since.
+      printer->Print(variables_,
+        "if ($has_bit_word$ & $has_bit_mask$) {\n"
+        "  if ($name$Bytes_ != nil) {\n"
+        "    [output writeData:$number$ value:$name$Bytes_];\n"
+        "  } else {\n"
+        "    [output writeMessage:$number$ value:$name$];\n"
+        "  }\n"
+        "}\n");
+    } else {
+      printer->Print(variables_,
+        "if ($has_bit_word$ & $has_bit_mask$) {\n"
+        "  [output write$group_or_message$:$number$ value:$name$];\n"
+        "}\n");
+    }
   }
 
 
@@ -223,19 +455,42 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
   }
 
 
-  void MessageFieldGenerator::GenerateSerializedSizeCodeSource(io::Printer* printer) const {
+  void MessageFieldGenerator::GenerateMutableMembersHeader(io::Printer* printer) const {
     printer->Print(variables_,
-      "if (self.has$capitalized_name$) {\n"
-      "  size_ += compute$group_or_message$Size($number$, self.$name$);\n"
-      "}\n");
+      "- (void) set$capitalized_name$:($storage_type$) value;\n"
+      "- (void) clear$capitalized_name$;\n");
+    if (HasMutableMessages(descriptor_->message_type()->file())) {
+      printer->Print(variables_,
+        "/** The field's value, set to an unfrozen copy first if need be. */\n"
+        "- ($storage_type$) mutable$capitalized_name$;\n");
+    }
+  }
+
+
+  void MessageFieldGenerator::GenerateSerializedSizeCodeSource(io::Printer* printer) const {
+    if (IsLazy(descriptor_)) {
+      printer->Print(variables_,
+        "if ($has_bit_word$ & $has_bit_mask$) {\n"
+        "  if ($name$Bytes_ != nil) {\n"
+        "    size_ += computeDataSize($number$, $name$Bytes_);\n"
+        "  } else {\n"
+        "    size_ += computeMessageSize($number$, $name$);\n"
+        "  }\n"
+        "}\n");
+    } else {
+      printer->Print(variables_,
+        "if ($has_bit_word$ & $has_bit_mask$) {\n"
+        "  size_ += compute$group_or_message$Size($number$, $name$);\n"
+        "}\n");
+    }
   }
 
 
   void MessageFieldGenerator::GenerateDescriptionCodeSource(io::Printer* printer) const {
     printer->Print(variables_,
-      "if (self.has$capitalized_name$) {\n"
+      "if ($has_bit_word$ & $has_bit_mask$) {\n"
       "  [output appendFormat:@\"%@%@ {\\n\", indent, @\"$name$\"];\n"
-      "  [self.$name$ writeDescriptionTo:output\n"
+      "  [$value$ writeDescriptionTo:output\n"
       "                       withIndent:[NSString stringWithFormat:@\"%@  \", indent]];\n"
       "  [output appendFormat:@\"%@}\\n\", indent];\n"
       "}\n");
@@ -244,19 +499,77 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
 
   void MessageFieldGenerator::GenerateIsEqualCodeSource(io::Printer* printer) const {
     printer->Print(variables_,
-      "self.has$capitalized_name$ == otherMessage.has$capitalized_name$ &&\n"
-      "(!self.has$capitalized_name$ || [self.$name$ isEqual:otherMessage.$name$]) &&");
+      "($has_bit_word$ & $has_bit_mask$) == (otherMessage->$has_bit_word$ & $has_bit_mask$) &&\n"
+      "(!($has_bit_word$ & $has_bit_mask$) || [$value$ isEqual:$other_value$]) &&");
   }
 
 
   void MessageFieldGenerator::GenerateHashCodeSource(io::Printer* printer) const {
     printer->Print(variables_,
-      "if (self.has$capitalized_name$) {\n"
-      "  hashCode = hashCode * 31 + [self.$name$ hash];\n"
+      "if ($has_bit_word$ & $has_bit_mask$) {\n"
+      "  hashCode = PBGeneratedMessageHashMix(hashCode, [$value$ hash]);\n"
       "}\n");
   }
 
 
+  void MessageFieldGenerator::GenerateMutableMembersSource(io::Printer* printer) const {
+    printer->Print(variables_,
+      "- (void) set$capitalized_name$:($storage_type$) value_ {\n"
+      "  if ($frozen_word$ & $frozen_mask$) {\n"
+      "    PBGeneratedMessageThrowFrozen(self);\n"
+      "  }\n"
+      "  $has_bit_word$ |= $has_bit_mask$;\n"
+      "  [value_ retain];\n"
+      "  [$name$ release];\n"
+      "  $name$ = value_;\n"
+      "}\n"
+      "- (void) clear$capitalized_name$ {\n"
+      "  if ($frozen_word$ & $frozen_mask$) {\n"
+      "    PBGeneratedMessageThrowFrozen(self);\n"
+      "  }\n"
+      "  $has_bit_word$ &= ~$has_bit_mask$;\n"
+      "  [$name$ release];\n"
+      "  $name$ = nil;\n"
+      "}\n");
+
+    if (HasMutableMessages(descriptor_->message_type()->file())) {
+      printer->Print(variables_,
+        "- ($storage_type$) mutable$capitalized_name$ {\n"
+        "  if ($frozen_word$ & $frozen_mask$) {\n"
+        "    PBGeneratedMessageThrowFrozen(self);\n"
+        "  }\n"
+        "  if ($name$ == nil) {\n"
+        "    $name$ = [[$type$ alloc] init];\n"
+        "  } else if ([$name$ isFrozen]) {\n"
+        "    $type$* value_ = [$name$ mutableCopy];\n"
+        "    [$name$ release];\n"
+        "    $name$ = value_;\n"
+        "  }\n"
+        "  $has_bit_word$ |= $has_bit_mask$;\n"
+        "  return $name$;\n"
+        "}\n");
+    }
+  }
+
+
+  void MessageFieldGenerator::GenerateFreezeSource(io::Printer* printer) const {
+    printer->Print(variables_, "[$name$ freeze];\n");
+  }
+
+
+  void MessageFieldGenerator::GenerateMutableCopySource(io::Printer* printer) const {
+    // Frozen values are safe to share, and values of other files always are.
+    if (HasMutableMessages(descriptor_->message_type()->file())) {
+      printer->Print(variables_,
+        "if (copy->$name$ != nil && ![copy->$name$ isFrozen]) {\n"
+        "  $type$* value = [copy->$name$ mutableCopyWithZone:zone];\n"
+        "  [copy->$name$ release];\n"
+        "  copy->$name$ = value;\n"
+        "}\n");
+    }
+  }
+
+
   void MessageFieldGenerator::GenerateMembersSource(io::Printer* printer) const {
   }
 
@@ -281,7 +594,7 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
 
 
   void RepeatedMessageFieldGenerator::GenerateFieldHeader(io::Printer* printer) const {
-    printer->Print(variables_, "PBAppendableArray * $list_name$;\n");
+    printer->Print(variables_, "$array_class$ * $list_name$;\n");
   }
 
 
@@ -290,13 +603,13 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
 
 
   void RepeatedMessageFieldGenerator::GeneratePropertyHeader(io::Printer* printer) const {
-    printer->Print(variables_, "@property (readonly, retain) PBArray * $name$;\n");
+    printer->Print(variables_, "@property (nonatomic, readonly, retain) PBArray * $name$;\n");
   }
 
 
   void RepeatedMessageFieldGenerator::GenerateExtensionSource(io::Printer* printer) const {
     printer->Print(variables_,
-      "@property (retain) PBAppendableArray * $list_name$;\n");
+      "@property (nonatomic, retain) $array_class$ * $list_name$;\n");
   }
 
 
@@ -308,11 +621,12 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
 
   void RepeatedMessageFieldGenerator::GenerateDeallocSource(io::Printer* printer) const {
     printer->Print(variables_,
-      "self.$list_name$ = nil;\n");
+      "[$list_name$ release];\n");
   }
 
 
-  void RepeatedMessageFieldGenerator::GenerateInitializationSource(io::Printer* printer) const {
+  void RepeatedMessageFieldGenerator::GenerateResetSource(io::Printer* printer) const {
+    printer->Print(variables_, "$list_name$ = PBAppendableArrayReuse($list_name$);\n");
   }
 
 
@@ -327,7 +641,7 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
       "  return $list_name$;\n"
       "}\n"
       "- ($storage_type$)$name$AtIndex:(NSUInteger)index {\n"
-      "  return [$list_name$ objectAtIndex:index];\n"
+      "  return $array_class$ValueAtIndex($list_name$, index);\n"
       "}\n");
   }
 
@@ -342,30 +656,51 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
       "- ($classname$_Builder *)clear$capitalized_name$;\n");
   }
 
+  void RepeatedMessageFieldGenerator::GenerateBuilderFieldHeader(io::Printer* printer) const {
+  }
+
+
+  void RepeatedMessageFieldGenerator::GenerateBuilderFreezeSource(io::Printer* printer) const {
+  }
+
+
+  void RepeatedMessageFieldGenerator::GenerateBuilderDropSource(io::Printer* printer) const {
+  }
+
+
+  void RepeatedMessageFieldGenerator::GenerateBuilderResetSource(io::Printer* printer) const {
+  }
+
+
   void RepeatedMessageFieldGenerator::GenerateBuilderMembersSource(io::Printer* printer) const {
     printer->Print(variables_,
       "- (PBAppendableArray *)$name$ {\n"
-      "  return result.$list_name$;\n"
+      "$detach$"
+      "  return result->$list_name$;\n"
       "}\n"
       "- ($storage_type$)$name$AtIndex:(NSUInteger)index {\n"
       "  return [result $name$AtIndex:index];\n"
       "}\n"
       "- ($classname$_Builder *)add$capitalized_name$:($storage_type$)value {\n"
-      "  if (result.$list_name$ == nil) {\n"
-      "    result.$list_name$ = [PBAppendableArray arrayWithValueType:PBArrayValueTypeObject];\n"
+      "$detach$"
+      "  if (result->$list_name$ == nil) {\n"
+      "    result.$list_name$ = [$array_class$ array];\n"
       "  }\n"
-      "  [result.$list_name$ addObject:value];\n"
+      "  $array_class$AddValue(result->$list_name$, value);\n"
       "  return self;\n"
       "}\n"
       "- ($classname$_Builder *)set$capitalized_name$Array:(NSArray *)array {\n"
-      "  result.$list_name$ = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeObject];\n"
+      "$detach$"
+      "  result.$list_name$ = [$array_class$ arrayWithArray:array valueType:PBArrayValueTypeObject];\n"
       "  return self;\n"
       "}\n"
       "- ($classname$_Builder *)set$capitalized_name$Values:(const $storage_type$ *)values count:(NSUInteger)count {\n"
-      "  result.$list_name$ = [PBAppendableArray arrayWithValues:values count:count valueType:PBArrayValueTypeObject];\n"
+      "$detach$"
+      "  result.$list_name$ = [$array_class$ arrayWithValues:values count:count valueType:PBArrayValueTypeObject];\n"
       "  return self;\n"
       "}\n"
       "- ($classname$_Builder *)clear$capitalized_name$ {\n"
+      "$detach$"
       "  result.$list_name$ = nil;\n"
       "  return self;\n"
       "}\n");
@@ -392,54 +727,70 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
   }
 
 
+  void RepeatedMessageFieldGenerator::GenerateMutableMembersHeader(io::Printer* printer) const {
+    printer->Print(variables_,
+      "- (void)add$capitalized_name$:($storage_type$)value;\n"
+      "- (void)set$capitalized_name$:(NSArray *)array;\n"
+      "- (void)clear$capitalized_name$;\n");
+  }
+
+
   void RepeatedMessageFieldGenerator::GenerateMergingCodeSource(io::Printer* printer) const {
     printer->Print(variables_,
-      "if (other.$list_name$.count > 0) {\n"
-      "  if (result.$list_name$ == nil) {\n"
-      "    result.$list_name$ = [[other.$list_name$ copyWithZone:[other.$list_name$ zone]] autorelease];\n"
+      "if (other->$list_name$.count > 0) {\n"
+      "  if (result->$list_name$ == nil) {\n"
+      "    result.$list_name$ = [[other->$list_name$ copyWithZone:[other->$list_name$ zone]] autorelease];\n"
       "  } else {\n"
-      "    [result.$list_name$ appendArray:other.$list_name$];\n"
+      "    [result->$list_name$ appendArray:other->$list_name$];\n"
       "  }\n"
       "}\n");
   }
 
 
   void RepeatedMessageFieldGenerator::GenerateBuildingCodeSource(io::Printer* printer) const {
+    printer->Print(variables_,
+      "[result->$list_name$ shrinkToFit];\n");
   }
 
   void RepeatedMessageFieldGenerator::GenerateParsingCodeSource(io::Printer* printer) const {
     printer->Print(variables_,
-      "$type$_Builder* subBuilder = [$type$ builder];\n");
+      "$type$_Builder* subBuilder = [[$type$_Builder alloc] init];\n"
+      "@try {\n");
 
     if (descriptor_->type() == FieldDescriptor::TYPE_GROUP) {
       printer->Print(variables_,
-        "[input readGroup:$number$ builder:subBuilder extensionRegistry:extensionRegistry];\n");
+        "  [input readGroup:$number$ builder:subBuilder extensionRegistry:extensionRegistry];\n");
     } else {
       printer->Print(variables_,
-        "[input readMessage:subBuilder extensionRegistry:extensionRegistry];\n");
+        "  [input readMessage:subBuilder extensionRegistry:extensionRegistry];\n");
     }
 
     printer->Print(variables_,
-      "[self add$capitalized_name$:[subBuilder buildPartial]];\n");
+      "  $type$* value = [subBuilder newBuildPartial];\n"
+      "  [self add$capitalized_name$:value];\n"
+      "  [value release];\n"
+      "} @finally {\n"
+      "  [subBuilder release];\n"
+      "}\n");
   }
 
   void RepeatedMessageFieldGenerator::GenerateSerializationCodeSource(io::Printer* printer) const {
     printer->Print(variables_,
-      "for ($type$ *element in self.$list_name$) {\n"
+      "for ($type$ *element in $list_name$) {\n"
       "  [output write$group_or_message$:$number$ value:element];\n"
       "}\n");
   }
 
   void RepeatedMessageFieldGenerator::GenerateSerializedSizeCodeSource(io::Printer* printer) const {
     printer->Print(variables_,
-      "for ($type$ *element in self.$list_name$) {\n"
+      "for ($type$ *element in $list_name$) {\n"
       "  size_ += compute$group_or_message$Size($number$, element);\n"
       "}\n");
   }
 
   void RepeatedMessageFieldGenerator::GenerateDescriptionCodeSource(io::Printer* printer) const {
     printer->Print(variables_,
-      "for ($type$* element in self.$list_name$) {\n"
+      "for ($type$* element in $list_name$) {\n"
       "  [output appendFormat:@\"%@%@ {\\n\", indent, @\"$name$\"];\n"
       "  [element writeDescriptionTo:output\n"
       "                   withIndent:[NSString stringWithFormat:@\"%@  \", indent]];\n"
@@ -448,16 +799,66 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
   }
 
   void RepeatedMessageFieldGenerator::GenerateIsEqualCodeSource(io::Printer* printer) const {
-    printer->Print(variables_, "[self.$list_name$ isEqualToArray:otherMessage.$list_name$] &&");
+    printer->Print(variables_, "($list_name$.count == 0 ? otherMessage->$list_name$.count == 0 : [$list_name$ isEqualToArray:otherMessage->$list_name$]) &&");
   }
 
   void RepeatedMessageFieldGenerator::GenerateHashCodeSource(io::Printer* printer) const {
     printer->Print(variables_,
-      "for ($type$* element in self.$list_name$) {\n"
-      "  hashCode = hashCode * 31 + [element hash];\n"
+      "for ($type$* element in $list_name$) {\n"
+      "  hashCode = PBGeneratedMessageHashMix(hashCode, [element hash]);\n"
       "}\n");
   }
 
+
+  void RepeatedMessageFieldGenerator::GenerateMutableMembersSource(io::Printer* printer) const {
+    printer->Print(variables_,
+      "- (void)add$capitalized_name$:($storage_type$)value {\n"
+      "  if ($frozen_word$ & $frozen_mask$) {\n"
+      "    PBGeneratedMessageThrowFrozen(self);\n"
+      "  }\n"
+      "  if ($list_name$ == nil) {\n"
+      "    self.$list_name$ = [$array_class$ array];\n"
+      "  }\n"
+      "  $array_class$AddValue($list_name$, value);\n"
+      "}\n"
+      "- (void)set$capitalized_name$:(NSArray *)array {\n"
+      "  if ($frozen_word$ & $frozen_mask$) {\n"
+      "    PBGeneratedMessageThrowFrozen(self);\n"
+      "  }\n"
+      "  self.$list_name$ = array ? [$array_class$ arrayWithArray:array valueType:PBArrayValueTypeObject] : nil;\n"
+      "}\n"
+      "- (void)clear$capitalized_name$ {\n"
+      "  if ($frozen_word$ & $frozen_mask$) {\n"
+      "    PBGeneratedMessageThrowFrozen(self);\n"
+      "  }\n"
+      "  self.$list_name$ = nil;\n"
+      "}\n");
+  }
+
+
+  void RepeatedMessageFieldGenerator::GenerateFreezeSource(io::Printer* printer) const {
+    printer->Print(variables_,
+      "for ($type$* element in $list_name$) {\n"
+      "  [element freeze];\n"
+      "}\n");
+  }
+
+
+  void RepeatedMessageFieldGenerator::GenerateMutableCopySource(io::Printer* printer) const {
+    if (HasMutableMessages(descriptor_->message_type()->file())) {
+      printer->Print(variables_,
+        "if (copy->$list_name$.count > 0) {\n"
+        "  $array_class$* values = [$array_class$ array];\n"
+        "  for ($type$* element in copy->$list_name$) {\n"
+        "    $type$* value = [element isFrozen] ? [element retain] : [element mutableCopyWithZone:zone];\n"
+        "    $array_class$AddValue(values, value);\n"
+        "    [value release];\n"
+        "  }\n"
+        "  copy.$list_name$ = values;\n"
+        "}\n");
+    }
+  }
+
   string RepeatedMessageFieldGenerator::GetBoxedType() const {
     return ClassName(descriptor_->message_type());
   }
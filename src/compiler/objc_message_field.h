@@ -35,6 +35,7 @@ class MessageFieldGenerator : public FieldGenerator {
 
   void GenerateHasFieldHeader(io::Printer* printer) const;
   void GenerateFieldHeader(io::Printer* printer) const;
+  void GenerateBuilderFieldHeader(io::Printer* printer) const;
   void GenerateHasPropertyHeader(io::Printer* printer) const;
   void GeneratePropertyHeader(io::Printer* printer) const;
   void GenerateMembersHeader(io::Printer* printer) const;
@@ -44,13 +45,17 @@ class MessageFieldGenerator : public FieldGenerator {
   void GenerateParsingCodeHeader(io::Printer* printer) const;
   void GenerateSerializationCodeHeader(io::Printer* printer) const;
   void GenerateSerializedSizeCodeHeader(io::Printer* printer) const;
+  void GenerateMutableMembersHeader(io::Printer* printer) const;
 
   void GenerateExtensionSource(io::Printer* printer) const;
   void GenerateSynthesizeSource(io::Printer* printer) const;
   void GenerateDeallocSource(io::Printer* printer) const;
-  void GenerateInitializationSource(io::Printer* printer) const;
+  void GenerateResetSource(io::Printer* printer) const;
   void GenerateMembersSource(io::Printer* printer) const;
   void GenerateBuilderMembersSource(io::Printer* printer) const;
+  void GenerateBuilderFreezeSource(io::Printer* printer) const;
+  void GenerateBuilderDropSource(io::Printer* printer) const;
+  void GenerateBuilderResetSource(io::Printer* printer) const;
   void GenerateMergingCodeSource(io::Printer* printer) const;
   void GenerateBuildingCodeSource(io::Printer* printer) const;
   void GenerateParsingCodeSource(io::Printer* printer) const;
@@ -59,6 +64,9 @@ class MessageFieldGenerator : public FieldGenerator {
   void GenerateDescriptionCodeSource(io::Printer* printer) const;
   void GenerateIsEqualCodeSource(io::Printer* printer) const;
   void GenerateHashCodeSource(io::Printer* printer) const;
+  void GenerateMutableMembersSource(io::Printer* printer) const;
+  void GenerateFreezeSource(io::Printer* printer) const;
+  void GenerateMutableCopySource(io::Printer* printer) const;
 
   string GetBoxedType() const;
 
@@ -76,6 +84,7 @@ class RepeatedMessageFieldGenerator : public FieldGenerator {
 
   void GenerateHasFieldHeader(io::Printer* printer) const;
   void GenerateFieldHeader(io::Printer* printer) const;
+  void GenerateBuilderFieldHeader(io::Printer* printer) const;
   void GenerateHasPropertyHeader(io::Printer* printer) const;
   void GeneratePropertyHeader(io::Printer* printer) const;
   void GenerateMembersHeader(io::Printer* printer) const;
@@ -85,13 +94,17 @@ class RepeatedMessageFieldGenerator : public FieldGenerator {
   void GenerateParsingCodeHeader(io::Printer* printer) const;
   void GenerateSerializationCodeHeader(io::Printer* printer) const;
   void GenerateSerializedSizeCodeHeader(io::Printer* printer) const;
+  void GenerateMutableMembersHeader(io::Printer* printer) const;
 
   void GenerateExtensionSource(io::Printer* printer) const;
   void GenerateSynthesizeSource(io::Printer* printer) const;
   void GenerateDeallocSource(io::Printer* printer) const;
-  void GenerateInitializationSource(io::Printer* printer) const;
+  void GenerateResetSource(io::Printer* printer) const;
   void GenerateMembersSource(io::Printer* printer) const;
   void GenerateBuilderMembersSource(io::Printer* printer) const;
+  void GenerateBuilderFreezeSource(io::Printer* printer) const;
+  void GenerateBuilderDropSource(io::Printer* printer) const;
+  void GenerateBuilderResetSource(io::Printer* printer) const;
   void GenerateMergingCodeSource(io::Printer* printer) const;
   void GenerateBuildingCodeSource(io::Printer* printer) const;
   void GenerateParsingCodeSource(io::Printer* printer) const;
@@ -100,6 +113,9 @@ class RepeatedMessageFieldGenerator : public FieldGenerator {
   void GenerateDescriptionCodeSource(io::Printer* printer) const;
   void GenerateIsEqualCodeSource(io::Printer* printer) const;
   void GenerateHashCodeSource(io::Printer* printer) const;
+  void GenerateMutableMembersSource(io::Printer* printer) const;
+  void GenerateFreezeSource(io::Printer* printer) const;
+  void GenerateMutableCopySource(io::Printer* printer) const;
 
   string GetBoxedType() const;
 
@@ -86,6 +86,21 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
       return NULL;
     }
 
+    // printf-style format for a single unboxed array value.  The float and
+    // double precisions match what -[NSNumber description] prints.
+    const char* GetArrayValueFormat(const FieldDescriptor* field) {
+      switch (field->cpp_type()) {
+        case FieldDescriptor::CPPTYPE_INT32 : return "%d"    ;
+        case FieldDescriptor::CPPTYPE_UINT32: return "%u"    ;
+        case FieldDescriptor::CPPTYPE_INT64 : return "%lld"  ;
+        case FieldDescriptor::CPPTYPE_UINT64: return "%llu"  ;
+        case FieldDescriptor::CPPTYPE_FLOAT : return "%0.7g" ;
+        case FieldDescriptor::CPPTYPE_DOUBLE: return "%0.16g";
+        case FieldDescriptor::CPPTYPE_BOOL  : return "%d"    ;
+        default                             : return NULL;
+      }
+    }
+
     const char* GetCapitalizedArrayValueTypeName(const FieldDescriptor* field) {
       switch (field->type()) {
         case FieldDescriptor::TYPE_INT32   : return "Int32" ;
@@ -177,6 +192,26 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
         (*variables)["name"] = name;
         (*variables)["capitalized_name"] = UnderscoresToCapitalizedCamelCase(descriptor);
         (*variables)["list_name"] = UnderscoresToCamelCase(descriptor) + "Array";
+        if (!descriptor->is_repeated()) {
+          (*variables)["has_bit_word"] = HasBitWord(HasBitIndex(descriptor));
+          (*variables)["has_bit_mask"] = HasBitMask(HasBitIndex(descriptor));
+        }
+        // A builder made by toBuilder shares its result with the prototype
+        // until the first change.
+        (*variables)["detach"] =
+          "  if (prototype_ != nil) {\n"
+          "    [self detachFromPrototype];\n"
+          "  }\n";
+        (*variables)["frozen_word"] = HasBitWord(FrozenBitIndex(descriptor->containing_type()));
+        (*variables)["frozen_mask"] = HasBitMask(FrozenBitIndex(descriptor->containing_type()));
+        // Singular bools live in a one bit ivar, so reads have to normalize.
+        if (GetObjectiveCType(descriptor) == OBJECTIVECTYPE_BOOLEAN) {
+          (*variables)["ivar"] = name + "_";
+          (*variables)["normalize"] = "!!";
+        } else {
+          (*variables)["ivar"] = name;
+          (*variables)["normalize"] = "";
+        }
         (*variables)["number"] = SimpleItoa(descriptor->number());
         (*variables)["type"] = PrimitiveTypeName(descriptor);
 
@@ -193,8 +228,12 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
         }
 
         (*variables)["array_value_type"] = GetArrayValueType(descriptor);
+        (*variables)["array_class"] = GetArrayClassName(descriptor);
         (*variables)["array_value_type_name"] = GetArrayValueTypeName(descriptor);
         (*variables)["array_value_type_name_cap"] = GetCapitalizedArrayValueTypeName(descriptor);
+        if (IsPrimitiveType(GetObjectiveCType(descriptor))) {
+          (*variables)["array_value_format"] = GetArrayValueFormat(descriptor);
+        }
 
         (*variables)["default"] = DefaultValue(descriptor);
         (*variables)["capitalized_type"] = GetCapitalizedType(descriptor);
@@ -222,13 +261,18 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
 
 
   void PrimitiveFieldGenerator::GenerateHasFieldHeader(io::Printer* printer) const {
-    printer->Print(variables_, "BOOL has$capitalized_name$_:1;\n");
+    // Declared by the message as part of its hasBits_ words.
   }
 
 
   void PrimitiveFieldGenerator::GenerateFieldHeader(io::Printer* printer) const {
     if (descriptor_->type() ==  FieldDescriptor::TYPE_BOOL) {
-      printer->Print(variables_, "$storage_type$ $name$_:1;\n");
+      // Field tables address ivars by offset, which a bit field has none of.
+      if (HasGeneratedMethods(descriptor_->file())) {
+        printer->Print(variables_, "$storage_type$ $name$_:1;\n");
+      } else {
+        printer->Print(variables_, "$storage_type$ $name$_;\n");
+      }
     } else {
       printer->Print(variables_, "$storage_type$ $name$;\n");
     }
@@ -242,13 +286,13 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
   void PrimitiveFieldGenerator::GeneratePropertyHeader(io::Printer* printer) const {
     if (IsReferenceType(GetObjectiveCType(descriptor_))) {
       printer->Print(variables_,
-        "@property (readonly, retain)$storage_attribute$ $storage_type$ $name$;\n");
+        "@property (nonatomic, readonly, retain)$storage_attribute$ $storage_type$ $name$;\n");
     } else if (GetObjectiveCType(descriptor_) == OBJECTIVECTYPE_BOOLEAN) {
       printer->Print(variables_,
         "- (BOOL) $name$;\n");
     } else {
       printer->Print(variables_,
-        "@property (readonly) $storage_type$ $name$;\n");
+        "@property (nonatomic, readonly) $storage_type$ $name$;\n");
     }
   }
 
@@ -256,10 +300,10 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
   void PrimitiveFieldGenerator::GenerateExtensionSource(io::Printer* printer) const {
     if (IsReferenceType(GetObjectiveCType(descriptor_))) {
       printer->Print(variables_,
-        "@property (retain)$storage_attribute$ $storage_type$ $name$;\n");
+        "@property (nonatomic, retain)$storage_attribute$ $storage_type$ $name$;\n");
     } else {
       printer->Print(variables_,
-        "@property $storage_type$ $name$;\n");
+        "@property (nonatomic) $storage_type$ $name$;\n");
     }
   }
 
@@ -267,22 +311,67 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
   void PrimitiveFieldGenerator::GenerateSynthesizeSource(io::Printer* printer) const {
     printer->Print(variables_,
       "- (BOOL) has$capitalized_name$ {\n"
-      "  return !!has$capitalized_name$_;\n"
+      "  return ($has_bit_word$ & $has_bit_mask$) != 0;\n"
       "}\n"
       "- (void) setHas$capitalized_name$:(BOOL) value_ {\n"
-      "  has$capitalized_name$_ = !!value_;\n"
+      "  if (value_) {\n"
+      "    $has_bit_word$ |= $has_bit_mask$;\n"
+      "  } else {\n"
+      "    $has_bit_word$ &= ~$has_bit_mask$;\n"
+      "  }\n"
       "}\n");
 
+    // An unset field's ivar is left zeroed, so unless zero is already its
+    // default the getter has to supply it.
     if (GetObjectiveCType(descriptor_) == OBJECTIVECTYPE_BOOLEAN) {
-      printer->Print(variables_,
-        "- (BOOL) $name$ {\n"
-        "  return !!$name$_;\n"
-        "}\n"
-        "- (void) set$capitalized_name$:(BOOL) value_ {\n"
-        "  $name$_ = !!value_;\n"
-        "}\n");
+      if (descriptor_->default_value_bool()) {
+        printer->Print(variables_,
+          "- (BOOL) $name$ {\n"
+          "  return ($has_bit_word$ & $has_bit_mask$) ? !!$name$_ : YES;\n"
+          "}\n");
+      } else {
+        printer->Print(variables_,
+          "- (BOOL) $name$ {\n"
+          "  return !!$name$_;\n"
+          "}\n");
+      }
+      // Mutable messages have a public setter instead.
+      if (!HasMutableMessages(descriptor_->file())) {
+        printer->Print(variables_,
+          "- (void) set$capitalized_name$:(BOOL) value_ {\n"
+          "  $name$_ = !!value_;\n"
+          "}\n");
+      }
+    } else if (IsReferenceType(GetObjectiveCType(descriptor_))) {
+      printer->Print(variables_, "@synthesize $name$;\n");
+      if (HasPrefixString(DefaultValue(descriptor_), "@\"")) {
+        printer->Print(variables_,
+          "- ($storage_type$) $name$ {\n"
+          "  return ($has_bit_word$ & $has_bit_mask$) ? $name$ : $default$;\n"
+          "}\n");
+      } else {
+        // Defaults that aren't literals are made once and shared.
+        printer->Print(variables_,
+          "- ($storage_type$) $name$ {\n"
+          "  if ($has_bit_word$ & $has_bit_mask$) {\n"
+          "    return $name$;\n"
+          "  }\n"
+          "  static $storage_type$ defaultValue = nil;\n"
+          "  static dispatch_once_t onceToken;\n"
+          "  dispatch_once(&onceToken, ^{\n"
+          "    defaultValue = [$default$ retain];\n"
+          "  });\n"
+          "  return defaultValue;\n"
+          "}\n");
+      }
     } else {
       printer->Print(variables_, "@synthesize $name$;\n");
+      if (descriptor_->has_default_value()) {
+        printer->Print(variables_,
+          "- ($storage_type$) $name$ {\n"
+          "  return ($has_bit_word$ & $has_bit_mask$) ? $name$ : $default$;\n"
+          "}\n");
+      }
     }
   }
 
@@ -290,14 +379,20 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
   void PrimitiveFieldGenerator::GenerateDeallocSource(io::Printer* printer) const {
     if (IsReferenceType(GetObjectiveCType(descriptor_))) {
       printer->Print(variables_,
-        "self.$name$ = nil;\n");
+        "[$name$ release];\n");
     }
   }
 
 
-  void PrimitiveFieldGenerator::GenerateInitializationSource(io::Printer* printer) const {
-    printer->Print(variables_,
-      "self.$name$ = $default$;\n");
+  void PrimitiveFieldGenerator::GenerateResetSource(io::Printer* printer) const {
+    if (IsReferenceType(GetObjectiveCType(descriptor_))) {
+      printer->Print(variables_,
+        "[$name$ release];\n"
+        "$name$ = nil;\n");
+    } else {
+      printer->Print(variables_,
+        "$ivar$ = 0;\n");
+    }
   }
 
 
@@ -338,31 +433,86 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
   }
 
 
+  void PrimitiveFieldGenerator::GenerateMutableMembersHeader(io::Printer* printer) const {
+    printer->Print(variables_,
+      "- (void) set$capitalized_name$:($storage_type$) value;\n"
+      "- (void) clear$capitalized_name$;\n");
+  }
+
+
+  void PrimitiveFieldGenerator::GenerateBuilderFieldHeader(io::Printer* printer) const {
+  }
+
+
+  void PrimitiveFieldGenerator::GenerateBuilderFreezeSource(io::Printer* printer) const {
+  }
+
+
+  void PrimitiveFieldGenerator::GenerateBuilderDropSource(io::Printer* printer) const {
+  }
+
+
+  void PrimitiveFieldGenerator::GenerateBuilderResetSource(io::Printer* printer) const {
+  }
+
+
   void PrimitiveFieldGenerator::GenerateBuilderMembersSource(io::Printer* printer) const {
     printer->Print(variables_,
       "- (BOOL) has$capitalized_name$ {\n"
-      "  return result.has$capitalized_name$;\n"
-      "}\n"
-      "- ($storage_type$) $name$ {\n"
-      "  return result.$name$;\n"
-      "}\n"
-      "- ($classname$_Builder*) set$capitalized_name$:($storage_type$) value {\n"
-      "  result.has$capitalized_name$ = YES;\n"
-      "  result.$name$ = value;\n"
-      "  return self;\n"
-      "}\n"
-      "- ($classname$_Builder*) clear$capitalized_name$ {\n"
-      "  result.has$capitalized_name$ = NO;\n"
-      "  result.$name$ = $default$;\n"
-      "  return self;\n"
+      "  return (result->$has_bit_word$ & $has_bit_mask$) != 0;\n"
       "}\n");
+    if (IsReferenceType(GetObjectiveCType(descriptor_))) {
+      printer->Print(variables_,
+        "- ($storage_type$) $name$ {\n"
+        "  return [result $name$];\n"
+        "}\n");
+    } else if (descriptor_->has_default_value()) {
+      printer->Print(variables_,
+        "- ($storage_type$) $name$ {\n"
+        "  return (result->$has_bit_word$ & $has_bit_mask$) ? $normalize$result->$ivar$ : $default$;\n"
+        "}\n");
+    } else {
+      printer->Print(variables_,
+        "- ($storage_type$) $name$ {\n"
+        "  return $normalize$result->$ivar$;\n"
+        "}\n");
+    }
+    printer->Print(variables_,
+      "- ($classname$_Builder*) set$capitalized_name$:($storage_type$) value {\n"
+      "$detach$"
+      "  result->$has_bit_word$ |= $has_bit_mask$;\n");
+    if (IsReferenceType(GetObjectiveCType(descriptor_))) {
+      // Objects go through the property so the old value is released.
+      printer->Print(variables_,
+        "  result.$name$ = value;\n"
+        "  return self;\n"
+        "}\n"
+        "- ($classname$_Builder*) clear$capitalized_name$ {\n"
+        "$detach$"
+        "  result->$has_bit_word$ &= ~$has_bit_mask$;\n"
+        "  [result->$name$ release];\n"
+        "  result->$name$ = nil;\n"
+        "  return self;\n"
+        "}\n");
+    } else {
+      printer->Print(variables_,
+        "  result->$ivar$ = $normalize$value;\n"
+        "  return self;\n"
+        "}\n"
+        "- ($classname$_Builder*) clear$capitalized_name$ {\n"
+        "$detach$"
+        "  result->$has_bit_word$ &= ~$has_bit_mask$;\n"
+        "  result->$ivar$ = 0;\n"
+        "  return self;\n"
+        "}\n");
+    }
   }
 
 
   void PrimitiveFieldGenerator::GenerateMergingCodeSource(io::Printer* printer) const {
     printer->Print(variables_,
-      "if (other.has$capitalized_name$) {\n"
-      "  [self set$capitalized_name$:other.$name$];\n"
+      "if (other->$has_bit_word$ & $has_bit_mask$) {\n"
+      "  [self set$capitalized_name$:other->$ivar$];\n"
       "}\n");
   }
 
@@ -370,30 +520,37 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
   }
 
   void PrimitiveFieldGenerator::GenerateParsingCodeSource(io::Printer* printer) const {
-    printer->Print(variables_,
-      "[self set$capitalized_name$:[input read$capitalized_type$]];\n");
+    if (IsReferenceType(GetObjectiveCType(descriptor_))) {
+      printer->Print(variables_,
+        "$storage_type$ value = [input new$capitalized_type$];\n"
+        "[self set$capitalized_name$:value];\n"
+        "[value release];\n");
+    } else {
+      printer->Print(variables_,
+        "[self set$capitalized_name$:[input read$capitalized_type$]];\n");
+    }
   }
 
   void PrimitiveFieldGenerator::GenerateSerializationCodeSource(io::Printer* printer) const {
     printer->Print(variables_,
-      "if (self.has$capitalized_name$) {\n"
-      "  [output write$capitalized_type$:$number$ value:self.$name$];\n"
+      "if ($has_bit_word$ & $has_bit_mask$) {\n"
+      "  [output write$capitalized_type$:$number$ value:$normalize$$ivar$];\n"
       "}\n");
   }
 
   void PrimitiveFieldGenerator::GenerateSerializedSizeCodeSource(io::Printer* printer) const {
     printer->Print(variables_,
-      "if (self.has$capitalized_name$) {\n"
-      "  size_ += compute$capitalized_type$Size($number$, self.$name$);\n"
+      "if ($has_bit_word$ & $has_bit_mask$) {\n"
+      "  size_ += compute$capitalized_type$Size($number$, $normalize$$ivar$);\n"
       "}\n");
   }
 
   void PrimitiveFieldGenerator::GenerateDescriptionCodeSource(io::Printer* printer) const {
     printer->Print(variables_,
-      "if (self.has$capitalized_name$) {\n"
+      "if ($has_bit_word$ & $has_bit_mask$) {\n"
       "  [output appendFormat:@\"%@%@: %@\\n\", indent, @\"$name$\", ");
     printer->Print(variables_,
-      BoxValue(descriptor_, "self.$name$").c_str());
+      BoxValue(descriptor_, "$normalize$$ivar$").c_str());
     printer->Print(variables_,
       "];\n"
       "}\n");
@@ -401,25 +558,84 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
 
   void PrimitiveFieldGenerator::GenerateIsEqualCodeSource(io::Printer* printer) const {
     printer->Print(variables_,
-      "self.has$capitalized_name$ == otherMessage.has$capitalized_name$ &&\n"
-      "(!self.has$capitalized_name$ || ");
+      "($has_bit_word$ & $has_bit_mask$) == (otherMessage->$has_bit_word$ & $has_bit_mask$) &&\n"
+      "(!($has_bit_word$ & $has_bit_mask$) || ");
     if (ReturnsPrimitiveType(descriptor_)) {
-      printer->Print(variables_, "self.$name$ == otherMessage.$name$) &&");
+      printer->Print(variables_, "$normalize$$ivar$ == $normalize$otherMessage->$ivar$) &&");
     } else {
-      printer->Print(variables_, "[self.$name$ isEqual:otherMessage.$name$]) &&");
+      printer->Print(variables_, "[$normalize$$ivar$ isEqual:$normalize$otherMessage->$ivar$]) &&");
     }
   }
 
   void PrimitiveFieldGenerator::GenerateHashCodeSource(io::Printer* printer) const {
+    // Scalars are mixed in unboxed.
+    string value;
+    switch (GetObjectiveCType(descriptor_)) {
+      case OBJECTIVECTYPE_FLOAT:
+        value = "PBGeneratedMessageHashFloat($ivar$)";
+        break;
+      case OBJECTIVECTYPE_DOUBLE:
+        value = "PBGeneratedMessageHashDouble($ivar$)";
+        break;
+      case OBJECTIVECTYPE_STRING:
+      case OBJECTIVECTYPE_DATA:
+        value = "[$ivar$ hash]";
+        break;
+      default:
+        value = "(uint64_t)$normalize$$ivar$";
+        break;
+    }
     printer->Print(variables_,
-      "if (self.has$capitalized_name$) {\n");
-    printer->Print("  hashCode = hashCode * 31 + [");
-    printer->Print(variables_, BoxValue(descriptor_, "self.$name$").c_str());
-    printer->Print(
-      " hash];\n"
-      "}\n");
+      "if ($has_bit_word$ & $has_bit_mask$) {\n");
+    printer->Print(variables_,
+      ("  hashCode = PBGeneratedMessageHashMix(hashCode, " + value + ");\n").c_str());
+    printer->Print("}\n");
   }
 
+
+  void PrimitiveFieldGenerator::GenerateMutableMembersSource(io::Printer* printer) const {
+    printer->Print(variables_,
+      "- (void) set$capitalized_name$:($storage_type$) value_ {\n"
+      "  if ($frozen_word$ & $frozen_mask$) {\n"
+      "    PBGeneratedMessageThrowFrozen(self);\n"
+      "  }\n"
+      "  $has_bit_word$ |= $has_bit_mask$;\n");
+    if (IsReferenceType(GetObjectiveCType(descriptor_))) {
+      printer->Print(variables_,
+        "  [value_ retain];\n"
+        "  [$name$ release];\n"
+        "  $name$ = value_;\n");
+    } else {
+      printer->Print(variables_,
+        "  $ivar$ = $normalize$value_;\n");
+    }
+    printer->Print(variables_,
+      "}\n"
+      "- (void) clear$capitalized_name$ {\n"
+      "  if ($frozen_word$ & $frozen_mask$) {\n"
+      "    PBGeneratedMessageThrowFrozen(self);\n"
+      "  }\n"
+      "  $has_bit_word$ &= ~$has_bit_mask$;\n");
+    if (IsReferenceType(GetObjectiveCType(descriptor_))) {
+      printer->Print(variables_,
+        "  [$name$ release];\n"
+        "  $name$ = nil;\n");
+    } else {
+      printer->Print(variables_,
+        "  $ivar$ = 0;\n");
+    }
+    printer->Print("}\n");
+  }
+
+
+  void PrimitiveFieldGenerator::GenerateFreezeSource(io::Printer* printer) const {
+  }
+
+
+  void PrimitiveFieldGenerator::GenerateMutableCopySource(io::Printer* printer) const {
+  }
+
+
   RepeatedPrimitiveFieldGenerator::RepeatedPrimitiveFieldGenerator(const FieldDescriptor* descriptor)
     : descriptor_(descriptor) {
       SetPrimitiveVariables(descriptor, &variables_);
@@ -435,7 +651,7 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
 
 
   void RepeatedPrimitiveFieldGenerator::GenerateFieldHeader(io::Printer* printer) const {
-    printer->Print(variables_, "PBAppendableArray * $list_name$;\n");
+    printer->Print(variables_, "$array_class$ * $list_name$;\n");
     if (descriptor_->options().packed()) {
       printer->Print(variables_,
         "int32_t $name$MemoizedSerializedSize;\n");
@@ -448,12 +664,12 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
 
 
   void RepeatedPrimitiveFieldGenerator::GeneratePropertyHeader(io::Printer* printer) const {
-    printer->Print(variables_, "@property (readonly, retain) PBArray * $name$;\n");
+    printer->Print(variables_, "@property (nonatomic, readonly, retain) PBArray * $name$;\n");
   }
 
 
   void RepeatedPrimitiveFieldGenerator::GenerateExtensionSource(io::Printer* printer) const {
-    printer->Print(variables_, "@property (retain) PBAppendableArray * $list_name$;\n");
+    printer->Print(variables_, "@property (nonatomic, retain) $array_class$ * $list_name$;\n");
   }
 
 
@@ -464,11 +680,12 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
 
 
   void RepeatedPrimitiveFieldGenerator::GenerateDeallocSource(io::Printer* printer) const {
-    printer->Print(variables_, "self.$list_name$ = nil;\n");
+    printer->Print(variables_, "[$list_name$ release];\n");
   }
 
 
-  void RepeatedPrimitiveFieldGenerator::GenerateInitializationSource(io::Printer* printer) const {;
+  void RepeatedPrimitiveFieldGenerator::GenerateResetSource(io::Printer* printer) const {
+    printer->Print(variables_, "$list_name$ = PBAppendableArrayReuse($list_name$);\n");
   }
 
 
@@ -483,6 +700,7 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
       "- ($storage_type$)$name$AtIndex:(NSUInteger)index;\n"
       "- ($classname$_Builder *)add$capitalized_name$:($storage_type$)value;\n"
       "- ($classname$_Builder *)set$capitalized_name$Array:(NSArray *)array;\n"
+      "- ($classname$_Builder *)set$capitalized_name$:(PBArray *)array;\n"
       "- ($classname$_Builder *)set$capitalized_name$Values:(const $storage_type$ *)values count:(NSUInteger)count;\n"
       "- ($classname$_Builder *)clear$capitalized_name$;\n");
   }
@@ -508,40 +726,74 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
   }
 
 
+  void RepeatedPrimitiveFieldGenerator::GenerateMutableMembersHeader(io::Printer* printer) const {
+    printer->Print(variables_,
+      "- (void)add$capitalized_name$:($storage_type$)value;\n"
+      "- (void)set$capitalized_name$:(PBArray *)array;\n"
+      "- (void)clear$capitalized_name$;\n");
+  }
+
+
   void RepeatedPrimitiveFieldGenerator::GenerateMembersSource(io::Printer* printer) const {
     printer->Print(variables_,
       "- (PBArray *)$name$ {\n"
       "  return $list_name$;\n"
       "}\n"
       "- ($storage_type$)$name$AtIndex:(NSUInteger)index {\n"
-      "  return [$list_name$ $array_value_type_name$AtIndex:index];\n"
+      "  return $array_class$ValueAtIndex($list_name$, index);\n"
       "}\n");
   }
 
+  void RepeatedPrimitiveFieldGenerator::GenerateBuilderFieldHeader(io::Printer* printer) const {
+  }
+
+
+  void RepeatedPrimitiveFieldGenerator::GenerateBuilderFreezeSource(io::Printer* printer) const {
+  }
+
+
+  void RepeatedPrimitiveFieldGenerator::GenerateBuilderDropSource(io::Printer* printer) const {
+  }
+
+
+  void RepeatedPrimitiveFieldGenerator::GenerateBuilderResetSource(io::Printer* printer) const {
+  }
+
+
   void RepeatedPrimitiveFieldGenerator::GenerateBuilderMembersSource(io::Printer* printer) const {
     printer->Print(variables_,
       "- (PBAppendableArray *)$name$ {\n"
-      "  return result.$list_name$;\n"
+      "$detach$"
+      "  return result->$list_name$;\n"
       "}\n"
       "- ($storage_type$)$name$AtIndex:(NSUInteger)index {\n"
       "  return [result $name$AtIndex:index];\n"
       "}\n"
       "- ($classname$_Builder *)add$capitalized_name$:($storage_type$)value {\n"
-      "  if (result.$list_name$ == nil) {\n"
-      "    result.$list_name$ = [PBAppendableArray arrayWithValueType:$array_value_type$];\n"
+      "$detach$"
+      "  if (result->$list_name$ == nil) {\n"
+      "    result.$list_name$ = [$array_class$ array];\n"
       "  }\n"
-      "  [result.$list_name$ add$array_value_type_name_cap$:value];\n"
+      "  $array_class$AddValue(result->$list_name$, value);\n"
       "  return self;\n"
       "}\n"
       "- ($classname$_Builder *)set$capitalized_name$Array:(NSArray *)array {\n"
-      "  result.$list_name$ = [PBAppendableArray arrayWithArray:array valueType:$array_value_type$];\n"
+      "$detach$"
+      "  result.$list_name$ = [$array_class$ arrayWithArray:array valueType:$array_value_type$];\n"
+      "  return self;\n"
+      "}\n"
+      "- ($classname$_Builder *)set$capitalized_name$:(PBArray *)array {\n"
+      "$detach$"
+      "  result.$list_name$ = array ? [$array_class$ arrayWithStorageOfArray:array] : nil;\n"
       "  return self;\n"
       "}\n"
       "- ($classname$_Builder *)set$capitalized_name$Values:(const $storage_type$ *)values count:(NSUInteger)count {\n"
-      "  result.$list_name$ = [PBAppendableArray arrayWithValues:values count:count valueType:$array_value_type$];\n"
+      "$detach$"
+      "  result.$list_name$ = [$array_class$ arrayWithValues:values count:count valueType:$array_value_type$];\n"
       "  return self;\n"
       "}\n"
       "- ($classname$_Builder *)clear$capitalized_name$ {\n"
+      "$detach$"
       "  result.$list_name$ = nil;\n"
       "  return self;\n"
       "}\n");
@@ -549,17 +801,19 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
 
   void RepeatedPrimitiveFieldGenerator::GenerateMergingCodeSource(io::Printer* printer) const {
     printer->Print(variables_,
-      "if (other.$list_name$.count > 0) {\n"
-      "  if (result.$list_name$ == nil) {\n"
-      "    result.$list_name$ = [[other.$list_name$ copyWithZone:[other.$list_name$ zone]] autorelease];\n"
+      "if (other->$list_name$.count > 0) {\n"
+      "  if (result->$list_name$ == nil) {\n"
+      "    result.$list_name$ = [[other->$list_name$ copyWithZone:[other->$list_name$ zone]] autorelease];\n"
       "  } else {\n"
-      "    [result.$list_name$ appendArray:other.$list_name$];\n"
+      "    [result->$list_name$ appendArray:other->$list_name$];\n"
       "  }\n"
       "}\n");
   }
 
 
   void RepeatedPrimitiveFieldGenerator::GenerateBuildingCodeSource(io::Printer* printer) const {
+    printer->Print(variables_,
+      "[result->$list_name$ shrinkToFit];\n");
   }
 
 
@@ -568,31 +822,62 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
       printer->Print(variables_,
         "int32_t length = [input readRawVarint32];\n"
         "int32_t limit = [input pushLimit:length];\n"
-        "if (result.$list_name$ == nil) {\n"
-        "  result.$list_name$ = [PBAppendableArray arrayWithValueType:$array_value_type$];\n"
+        "if (result->$list_name$ == nil) {\n"
+        "  result.$list_name$ = [$array_class$ array];\n"
         "}\n"
+        "$array_class$ *values = result->$list_name$;\n");
+      // Size the array from the part of the payload that is already
+      // buffered: it gives the exact element count for fixed-width types and
+      // an upper bound (one byte per varint) otherwise, and unlike the length
+      // prefix it cannot be inflated by malformed input.  Any excess is
+      // released by shrinkToFit when the message is built.
+      if (FixedSize(descriptor_->type()) == -1) {
+        printer->Print(variables_,
+          "[values reserveCapacity:values.count + input.bytesBufferedUntilLimit inArena:input.arena];\n");
+      } else {
+        printer->Print(variables_,
+          "[values reserveCapacity:values.count + input.bytesBufferedUntilLimit / $fixed_size$ inArena:input.arena];\n");
+      }
+      printer->Print(variables_,
         "while (input.bytesUntilLimit > 0) {\n"
-        "  [result.$list_name$ add$array_value_type_name_cap$:[input read$capitalized_type$]];\n"
+        "  $array_class$AddValue(values, [input read$capitalized_type$]);\n"
         "}\n"
         "[input popLimit:limit];\n");
+    } else if (ReturnsPrimitiveType(descriptor_)) {
+      // Consume the whole run of identically tagged values that is already
+      // buffered in one go, sizing the array for it up front.
+      printer->Print(variables_,
+        "if (result->$list_name$ == nil) {\n"
+        "  result.$list_name$ = [$array_class$ array];\n"
+        "}\n"
+        "$array_class$ *values = result->$list_name$;\n"
+        "const int32_t count = [input countBufferedRepeatedField:$tag$];\n"
+        "[values reserveCapacity:values.count + count inArena:input.arena];\n"
+        "$array_class$AddValue(values, [input read$capitalized_type$]);\n"
+        "for (int32_t i = 1; i < count; ++i) {\n"
+        "  [input readTag];\n"
+        "  $array_class$AddValue(values, [input read$capitalized_type$]);\n"
+        "}\n");
     } else {
       printer->Print(variables_,
-        "[self add$capitalized_name$:[input read$capitalized_type$]];\n");
+        "$storage_type$ value = [input new$capitalized_type$];\n"
+        "[self add$capitalized_name$:value];\n"
+        "[value release];\n");
     }
   }
 
 
   void RepeatedPrimitiveFieldGenerator::GenerateSerializationCodeSource(io::Printer* printer) const {
     printer->Print(variables_,
-      "const NSUInteger $list_name$Count = self.$list_name$.count;\n"
+      "const NSUInteger $list_name$Count = $list_name$.count;\n"
       "if ($list_name$Count > 0) {\n"
-      "  const $storage_type$ *values = (const $storage_type$ *)self.$list_name$.data;\n");
+      "  const $storage_type$ *values = (const $storage_type$ *)$list_name$.data;\n");
     printer->Indent();
 
     if (descriptor_->options().packed()) {
       printer->Print(variables_,
         "[output writeRawVarint32:$tag$];\n"
-        "[output writeRawVarint32:$name$MemoizedSerializedSize];\n"
+        "[output writeRawVarint32:PBGeneratedMessageGetMemoizedSize(&$name$MemoizedSerializedSize)];\n"
         "for (NSUInteger i = 0; i < $list_name$Count; ++i) {\n"
         "  [output write$capitalized_type$NoTag:values[i]];\n"
         "}\n");
@@ -614,11 +899,11 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
 
     printer->Print(variables_,
       "int32_t dataSize = 0;\n"
-      "const NSUInteger count = self.$list_name$.count;\n");
+      "const NSUInteger count = $list_name$.count;\n");
 
     if (FixedSize(descriptor_->type()) == -1) {
       printer->Print(variables_,
-        "const $storage_type$ *values = (const $storage_type$ *)self.$list_name$.data;\n"
+        "const $storage_type$ *values = (const $storage_type$ *)$list_name$.data;\n"
         "for (NSUInteger i = 0; i < count; ++i) {\n"
         "  dataSize += compute$capitalized_type$SizeNoTag(values[i]);\n"
         "}\n");
@@ -635,7 +920,7 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
         "  size_ += $tag_size$;\n"
         "  size_ += computeInt32SizeNoTag(dataSize);\n"
         "}\n"
-        "$name$MemoizedSerializedSize = dataSize;\n");
+        "PBGeneratedMessageSetMemoizedSize(&$name$MemoizedSerializedSize, dataSize);\n");
     } else {
       printer->Print(variables_,
         "size_ += $tag_size$ * count;\n");
@@ -649,12 +934,12 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
   void RepeatedPrimitiveFieldGenerator::GenerateDescriptionCodeSource(io::Printer* printer) const {
     if (ReturnsPrimitiveType(descriptor_)) {
       printer->Print(variables_,
-        "for (NSNumber* value in self.$list_name$) {\n"
-        "  [output appendFormat:@\"%@%@: %@\\n\", indent, @\"$name$\", value];\n"
-        "}\n");
+        "[$list_name$ enumerate$array_value_type_name_cap$sUsingBlock:^($storage_type$ value, NSUInteger idx, BOOL *stop) {\n"
+        "  [output appendFormat:@\"%@%@: $array_value_format$\\n\", indent, @\"$name$\", value];\n"
+        "}];\n");
     } else {
       printer->Print(variables_,
-        "for ($storage_type$ element in self.$list_name$) {\n"
+        "for ($storage_type$ element in $list_name$) {\n"
         "  [output appendFormat:@\"%@%@: %@\\n\", indent, @\"$name$\", element];\n"
         "}\n");
     }
@@ -663,22 +948,47 @@ namespace google { namespace protobuf { namespace compiler { namespace objective
 
   void RepeatedPrimitiveFieldGenerator::GenerateIsEqualCodeSource(io::Printer* printer) const {
     printer->Print(variables_,
-      "[self.$list_name$ isEqualToArray:otherMessage.$list_name$] &&");
+      "($list_name$.count == 0 ? otherMessage->$list_name$.count == 0 : [$list_name$ isEqualToArray:otherMessage->$list_name$]) &&");
   }
 
 
   void RepeatedPrimitiveFieldGenerator::GenerateHashCodeSource(io::Printer* printer) const {
-    if (ReturnsPrimitiveType(descriptor_)) {
-      printer->Print(variables_,
-        "for (NSNumber* value in self.$list_name$) {\n"
-        "  hashCode = hashCode * 31 + [value intValue];\n"
-        "}\n");
-    } else {
-      printer->Print(variables_,
-        "for ($storage_type$ element in self.$list_name$) {\n"
-        "  hashCode = hashCode * 31 + [element hash];\n"
-        "}\n");
-    }
+    printer->Print(variables_,
+      "hashCode = PBGeneratedMessageHashMix(hashCode, [$list_name$ hash64]);\n");
+  }
+
+
+  void RepeatedPrimitiveFieldGenerator::GenerateMutableMembersSource(io::Printer* printer) const {
+    printer->Print(variables_,
+      "- (void)add$capitalized_name$:($storage_type$)value {\n"
+      "  if ($frozen_word$ & $frozen_mask$) {\n"
+      "    PBGeneratedMessageThrowFrozen(self);\n"
+      "  }\n"
+      "  if ($list_name$ == nil) {\n"
+      "    self.$list_name$ = [$array_class$ array];\n"
+      "  }\n"
+      "  $array_class$AddValue($list_name$, value);\n"
+      "}\n"
+      "- (void)set$capitalized_name$:(PBArray *)array {\n"
+      "  if ($frozen_word$ & $frozen_mask$) {\n"
+      "    PBGeneratedMessageThrowFrozen(self);\n"
+      "  }\n"
+      "  self.$list_name$ = array ? [$array_class$ arrayWithStorageOfArray:array] : nil;\n"
+      "}\n"
+      "- (void)clear$capitalized_name$ {\n"
+      "  if ($frozen_word$ & $frozen_mask$) {\n"
+      "    PBGeneratedMessageThrowFrozen(self);\n"
+      "  }\n"
+      "  self.$list_name$ = nil;\n"
+      "}\n");
+  }
+
+
+  void RepeatedPrimitiveFieldGenerator::GenerateFreezeSource(io::Printer* printer) const {
+  }
+
+
+  void RepeatedPrimitiveFieldGenerator::GenerateMutableCopySource(io::Printer* printer) const {
   }
 }  // namespace objectivec
 }  // namespace compiler
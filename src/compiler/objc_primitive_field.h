@@ -35,6 +35,7 @@ class PrimitiveFieldGenerator : public FieldGenerator {
 
   void GenerateHasFieldHeader(io::Printer* printer) const;
   void GenerateFieldHeader(io::Printer* printer) const;
+  void GenerateBuilderFieldHeader(io::Printer* printer) const;
   void GenerateHasPropertyHeader(io::Printer* printer) const;
   void GeneratePropertyHeader(io::Printer* printer) const;
   void GenerateMembersHeader(io::Printer* printer) const;
@@ -44,13 +45,17 @@ class PrimitiveFieldGenerator : public FieldGenerator {
   void GenerateParsingCodeHeader(io::Printer* printer) const;
   void GenerateSerializationCodeHeader(io::Printer* printer) const;
   void GenerateSerializedSizeCodeHeader(io::Printer* printer) const;
+  void GenerateMutableMembersHeader(io::Printer* printer) const;
 
   void GenerateExtensionSource(io::Printer* printer) const;
   void GenerateSynthesizeSource(io::Printer* printer) const;
   void GenerateDeallocSource(io::Printer* printer) const;
-  void GenerateInitializationSource(io::Printer* printer) const;
+  void GenerateResetSource(io::Printer* printer) const;
   void GenerateMembersSource(io::Printer* printer) const;
   void GenerateBuilderMembersSource(io::Printer* printer) const;
+  void GenerateBuilderFreezeSource(io::Printer* printer) const;
+  void GenerateBuilderDropSource(io::Printer* printer) const;
+  void GenerateBuilderResetSource(io::Printer* printer) const;
   void GenerateMergingCodeSource(io::Printer* printer) const;
   void GenerateBuildingCodeSource(io::Printer* printer) const;
   void GenerateParsingCodeSource(io::Printer* printer) const;
@@ -59,6 +64,9 @@ class PrimitiveFieldGenerator : public FieldGenerator {
   void GenerateDescriptionCodeSource(io::Printer* printer) const;
   void GenerateIsEqualCodeSource(io::Printer* printer) const;
   void GenerateHashCodeSource(io::Printer* printer) const;
+  void GenerateMutableMembersSource(io::Printer* printer) const;
+  void GenerateFreezeSource(io::Printer* printer) const;
+  void GenerateMutableCopySource(io::Printer* printer) const;
 
  private:
   const FieldDescriptor* descriptor_;
@@ -74,6 +82,7 @@ class RepeatedPrimitiveFieldGenerator : public FieldGenerator {
 
   void GenerateHasFieldHeader(io::Printer* printer) const;
   void GenerateFieldHeader(io::Printer* printer) const;
+  void GenerateBuilderFieldHeader(io::Printer* printer) const;
   void GenerateHasPropertyHeader(io::Printer* printer) const;
   void GeneratePropertyHeader(io::Printer* printer) const;
   void GenerateMembersHeader(io::Printer* printer) const;
@@ -83,13 +92,17 @@ class RepeatedPrimitiveFieldGenerator : public FieldGenerator {
   void GenerateParsingCodeHeader(io::Printer* printer) const;
   void GenerateSerializationCodeHeader(io::Printer* printer) const;
   void GenerateSerializedSizeCodeHeader(io::Printer* printer) const;
+  void GenerateMutableMembersHeader(io::Printer* printer) const;
 
   void GenerateExtensionSource(io::Printer* printer) const;
   void GenerateSynthesizeSource(io::Printer* printer) const;
   void GenerateDeallocSource(io::Printer* printer) const;
-  void GenerateInitializationSource(io::Printer* printer) const;
+  void GenerateResetSource(io::Printer* printer) const;
   void GenerateMembersSource(io::Printer* printer) const;
   void GenerateBuilderMembersSource(io::Printer* printer) const;
+  void GenerateBuilderFreezeSource(io::Printer* printer) const;
+  void GenerateBuilderDropSource(io::Printer* printer) const;
+  void GenerateBuilderResetSource(io::Printer* printer) const;
   void GenerateMergingCodeSource(io::Printer* printer) const;
   void GenerateBuildingCodeSource(io::Printer* printer) const;
   void GenerateParsingCodeSource(io::Printer* printer) const;
@@ -98,6 +111,9 @@ class RepeatedPrimitiveFieldGenerator : public FieldGenerator {
   void GenerateDescriptionCodeSource(io::Printer* printer) const;
   void GenerateIsEqualCodeSource(io::Printer* printer) const;
   void GenerateHashCodeSource(io::Printer* printer) const;
+  void GenerateMutableMembersSource(io::Printer* printer) const;
+  void GenerateFreezeSource(io::Printer* printer) const;
+  void GenerateMutableCopySource(io::Printer* printer) const;
 
  private:
   const FieldDescriptor* descriptor_;
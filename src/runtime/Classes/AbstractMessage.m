@@ -79,9 +79,13 @@
 }
 
 
+/**
+ * Messages generated for LITE_RUNTIME have no text format, and only name
+ * their class and address.
+ */
 - (void) writeDescriptionTo:(NSMutableString*) output
                  withIndent:(NSString*) indent {
-  @throw [NSException exceptionWithName:@"ImproperSubclassing" reason:@"" userInfo:nil];
+  [output appendFormat:@"%@<%@: %p>\n", indent, NSStringFromClass([self class]), self];
 }
 
 
@@ -58,35 +58,51 @@
 
 
 - (id<PBMessage_Builder>) mergeFromData:(NSData*) data {
-  PBCodedInputStream* input = [PBCodedInputStream streamWithData:data];
-  [self mergeFromCodedInputStream:input];
-  [input checkLastTagWas:0];
+  PBCodedInputStream* input = [[PBCodedInputStream alloc] initWithData:data];
+  @try {
+    [self mergeFromCodedInputStream:input];
+    [input checkLastTagWas:0];
+  } @finally {
+    [input release];
+  }
   return self;
 }
 
 
 - (id<PBMessage_Builder>) mergeFromData:(NSData*) data
                       extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  PBCodedInputStream* input = [PBCodedInputStream streamWithData:data];
-  [self mergeFromCodedInputStream:input extensionRegistry:extensionRegistry];
-  [input checkLastTagWas:0];
+  PBCodedInputStream* input = [[PBCodedInputStream alloc] initWithData:data];
+  @try {
+    [self mergeFromCodedInputStream:input extensionRegistry:extensionRegistry];
+    [input checkLastTagWas:0];
+  } @finally {
+    [input release];
+  }
   return self;
 }
 
 
 - (id<PBMessage_Builder>) mergeFromInputStream:(NSInputStream*) input {
-  PBCodedInputStream* codedInput = [PBCodedInputStream streamWithInputStream:input];
-  [self mergeFromCodedInputStream:codedInput];
-  [codedInput checkLastTagWas:0];
+  PBCodedInputStream* codedInput = [[PBCodedInputStream alloc] initWithInputStream:input];
+  @try {
+    [self mergeFromCodedInputStream:codedInput];
+    [codedInput checkLastTagWas:0];
+  } @finally {
+    [codedInput release];
+  }
   return self;
 }
 
 
 - (id<PBMessage_Builder>) mergeFromInputStream:(NSInputStream*) input
                              extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  PBCodedInputStream* codedInput = [PBCodedInputStream streamWithInputStream:input];
-  [self mergeFromCodedInputStream:codedInput extensionRegistry:extensionRegistry];
-  [codedInput checkLastTagWas:0];
+  PBCodedInputStream* codedInput = [[PBCodedInputStream alloc] initWithInputStream:input];
+  @try {
+    [self mergeFromCodedInputStream:codedInput extensionRegistry:extensionRegistry];
+    [codedInput checkLastTagWas:0];
+  } @finally {
+    [codedInput release];
+  }
   return self;
 }
 
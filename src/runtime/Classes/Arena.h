@@ -0,0 +1,73 @@
+// Protocol Buffers for Objective C
+//
+// Copyright 2010 Booyah Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <Foundation/Foundation.h>
+
+struct PBArenaBlocks;
+
+extern const NSUInteger PBArenaDefaultBlockSize;
+
+/**
+ * A bump allocator that hands out memory carved from large blocks, all of
+ * which are freed together.  Set one on a {@link PBCodedInputStream} before
+ * parsing and the repeated field storage, strings and bytes of the whole
+ * message tree come from the arena instead of one {@code malloc} (and later
+ * one {@code free}) each.
+ *
+ * The blocks are reference counted separately from the arena object: every
+ * string, data or array that points into them keeps them alive, so releasing
+ * the arena while parsed messages are still in use is safe.  An arena must
+ * only be allocated from by one thread at a time.
+ */
+@interface PBArena : NSObject {
+@private
+  struct PBArenaBlocks* blocks;
+  CFAllocatorRef allocator;
+  void (^deallocator)(void* bytes, NSUInteger length);
+}
+
++ (PBArena*) arena;
++ (PBArena*) arenaWithBlockSize:(NSUInteger) blockSize;
+
+- (id) initWithBlockSize:(NSUInteger) blockSize;
+
+/**
+ * Returns {@code size} bytes, aligned for any scalar type.  The memory lives
+ * as long as the arena's blocks do.
+ */
+- (void*) allocate:(size_t) size;
+
+/**
+ * A deallocator for {@code -[PBArray initWithBytesNoCopy:...]} that keeps the
+ * arena's blocks alive until it is called.  Each call returns a block the
+ * caller owns (+1) and that must be called exactly once.
+ */
+- (void (^)(void* bytes, NSUInteger length)) newDeallocator;
+
+/** Copies UTF-8 bytes into the arena and wraps them in a string. */
+- (NSString*) stringWithUTF8Bytes:(const void*) bytes length:(NSUInteger) length;
+
+/** Copies bytes into the arena and wraps them in a data object. */
+- (NSData*) dataWithBytes:(const void*) bytes length:(NSUInteger) length;
+
+/** As above, but the caller owns the result. */
+- (NSString*) newStringWithUTF8Bytes:(const void*) bytes length:(NSUInteger) length;
+- (NSData*) newDataWithBytes:(const void*) bytes length:(NSUInteger) length;
+
+/** The total size of the blocks allocated so far. */
+- (NSUInteger) size;
+
+@end
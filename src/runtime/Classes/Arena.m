@@ -0,0 +1,192 @@
+// Protocol Buffers for Objective C
+//
+// Copyright 2010 Booyah Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import "Arena.h"
+
+const NSUInteger PBArenaDefaultBlockSize = 64 * 1024;
+
+/** Allocations are rounded up to this, which also suits the block headers. */
+static const size_t ARENA_ALIGNMENT = 16;
+
+typedef struct PBArenaBlock {
+  struct PBArenaBlock* next;
+} PBArenaBlock;
+
+typedef struct PBArenaBlocks {
+  PBArenaBlock* head;
+  uint8_t* cursor;
+  uint8_t* limit;
+  size_t blockSize;
+  size_t size;
+} PBArenaBlocks;
+
+
+static uint8_t* PBArenaBlocksAdd(PBArenaBlocks* blocks, size_t size) {
+  PBArenaBlock* block = malloc(ARENA_ALIGNMENT + size);
+  if (block == NULL) {
+    @throw [NSException exceptionWithName:NSMallocException reason:@"arena block allocation failed" userInfo:nil];
+  }
+  block->next = blocks->head;
+  blocks->head = block;
+  blocks->size += size;
+  return ((uint8_t*)block) + ARENA_ALIGNMENT;
+}
+
+
+static void* PBArenaBlocksAllocate(PBArenaBlocks* blocks, size_t size) {
+  size = (size + ARENA_ALIGNMENT - 1) & ~(ARENA_ALIGNMENT - 1);
+  if (size > (size_t)(blocks->limit - blocks->cursor)) {
+    if (size > blocks->blockSize / 4) {
+      // Large requests get a block of their own rather than abandoning
+      // whatever is left of the current one.
+      return PBArenaBlocksAdd(blocks, size);
+    }
+    blocks->cursor = PBArenaBlocksAdd(blocks, blocks->blockSize);
+    blocks->limit = blocks->cursor + blocks->blockSize;
+  }
+
+  void* result = blocks->cursor;
+  blocks->cursor += size;
+  return result;
+}
+
+
+#pragma mark CFAllocator Callbacks
+
+static void* PBArenaAllocatorAllocate(CFIndex size, CFOptionFlags hint, void* info) {
+  return PBArenaBlocksAllocate((PBArenaBlocks*)info, size);
+}
+
+
+static void PBArenaAllocatorDeallocate(void* ptr, void* info) {
+  // Arena memory is only ever freed all at once.
+}
+
+
+/** Called when the last reference to the allocator goes away. */
+static void PBArenaAllocatorRelease(const void* info) {
+  PBArenaBlocks* blocks = (PBArenaBlocks*)info;
+  PBArenaBlock* block = blocks->head;
+  while (block != NULL) {
+    PBArenaBlock* next = block->next;
+    free(block);
+    block = next;
+  }
+  free(blocks);
+}
+
+
+@implementation PBArena
+
+- (void) dealloc {
+  [deallocator release];
+  CFRelease(allocator);
+
+  [super dealloc];
+}
+
+
+- (id) initWithBlockSize:(NSUInteger) blockSize {
+  if ((self = [super init])) {
+    blocks = calloc(1, sizeof(PBArenaBlocks));
+    if (blocks == NULL) {
+      [self release];
+      @throw [NSException exceptionWithName:NSMallocException reason:@"arena allocation failed" userInfo:nil];
+    }
+    blocks->blockSize = MAX(blockSize, ARENA_ALIGNMENT);
+
+    // The allocator owns the blocks, and everything that points into them
+    // holds a reference to it.
+    CFAllocatorContext context = {
+      0, blocks, NULL, PBArenaAllocatorRelease, NULL,
+      PBArenaAllocatorAllocate, NULL, PBArenaAllocatorDeallocate, NULL
+    };
+    allocator = CFAllocatorCreate(kCFAllocatorDefault, &context);
+
+    CFAllocatorRef blocksAllocator = allocator;
+    deallocator = [^(void* bytes, NSUInteger length) {
+      CFRelease(blocksAllocator);
+    } copy];
+  }
+
+  return self;
+}
+
+
+- (id) init {
+  return [self initWithBlockSize:PBArenaDefaultBlockSize];
+}
+
+
++ (PBArena*) arenaWithBlockSize:(NSUInteger) blockSize {
+  return [[[PBArena alloc] initWithBlockSize:blockSize] autorelease];
+}
+
+
++ (PBArena*) arena {
+  return [[[PBArena alloc] init] autorelease];
+}
+
+
+- (void*) allocate:(size_t) size {
+  return PBArenaBlocksAllocate(blocks, size);
+}
+
+
+- (void (^)(void* bytes, NSUInteger length)) newDeallocator {
+  CFRetain(allocator);
+  return [deallocator copy];
+}
+
+
+- (NSString*) newStringWithUTF8Bytes:(const void*) bytes length:(NSUInteger) length {
+  if (length == 0) {
+    return @"";
+  }
+
+  void* copy = PBArenaBlocksAllocate(blocks, length);
+  memcpy(copy, bytes, length);
+  return (NSString*)CFStringCreateWithBytesNoCopy(kCFAllocatorDefault, copy, length,
+                                                  kCFStringEncodingUTF8, false, allocator);
+}
+
+
+- (NSData*) newDataWithBytes:(const void*) bytes length:(NSUInteger) length {
+  if (length == 0) {
+    return [[NSData alloc] init];
+  }
+
+  void* copy = PBArenaBlocksAllocate(blocks, length);
+  memcpy(copy, bytes, length);
+  return (NSData*)CFDataCreateWithBytesNoCopy(kCFAllocatorDefault, copy, length, allocator);
+}
+
+
+- (NSString*) stringWithUTF8Bytes:(const void*) bytes length:(NSUInteger) length {
+  return [[self newStringWithUTF8Bytes:bytes length:length] autorelease];
+}
+
+
+- (NSData*) dataWithBytes:(const void*) bytes length:(NSUInteger) length {
+  return [[self newDataWithBytes:bytes length:length] autorelease];
+}
+
+
+- (NSUInteger) size {
+  return blocks->size;
+}
+
+@end
@@ -15,6 +15,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+@class PBArena;
 @class PBExtensionRegistry;
 @class PBUnknownFieldSet_Builder;
 @protocol PBMessage_Builder;
@@ -56,11 +57,23 @@
 
   /** See setSizeLimit() */
   int32_t sizeLimit;
+
+  PBArena* arena;
 }
 
+/**
+ * When set, strings, bytes and repeated field storage read from this stream
+ * are allocated from the arena.  Nested messages are read from the same
+ * stream, so this covers the whole message tree.
+ */
+@property (retain) PBArena* arena;
+
 + (PBCodedInputStream*) streamWithData:(NSData*) data;
 + (PBCodedInputStream*) streamWithInputStream:(NSInputStream*) input;
 
+- (id) initWithData:(NSData*) data;
+- (id) initWithInputStream:(NSInputStream*) input;
+
 /**
  * Attempt to read a field tag, returning zero if we have reached EOF.
  * Protocol message parsers use this to read tags, since a protocol message
@@ -117,6 +130,24 @@
 - (BOOL) skipField:(int32_t) tag;
 
 
+/**
+ * Counts the values of a non-packed repeated field that sit back to back in
+ * the already-buffered input: the one about to be read (its {@code tag} has
+ * just been consumed by {@link #readTag()}), plus each following value that
+ * is immediately preceded by the same tag.  Never reads from the underlying
+ * stream, so this is a lower bound suitable for pre-sizing storage.  Always
+ * returns at least 1.
+ */
+- (int32_t) countBufferedRepeatedField:(int32_t) tag;
+
+/**
+ * Returns the number of bytes before the current limit that are already in
+ * the buffer.  Unlike {@link #bytesUntilLimit()} this does not take a length
+ * prefix on trust, so it is safe for pre-sizing storage.
+ */
+- (int32_t) bytesBufferedUntilLimit;
+
+
 /**
  * Reads and discards {@code size} bytes.
  *
@@ -145,6 +176,14 @@
 - (NSString*) readString;
 - (NSData*) readData;
 
+/**
+ * Read a {@code string} or {@code bytes} field value that the caller owns
+ * (+1).  Generated parsers use these so that the values they store are never
+ * put on the autorelease pool.
+ */
+- (NSString*) newString;
+- (NSData*) newData;
+
 - (void) readGroup:(int32_t) fieldNumber builder:(id<PBMessage_Builder>) builder extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 
 /**
@@ -17,6 +17,7 @@
 
 #import "CodedInputStream.h"
 
+#import "Arena.h"
 #import "Message_Builder.h"
 #import "Utilities.h"
 #import "WireFormat.h"
@@ -36,11 +37,13 @@ const int32_t BUFFER_SIZE = 4096;
 
 @synthesize buffer;
 @synthesize input;
+@synthesize arena;
 
 - (void) dealloc {
   [input close];
   self.buffer = nil;
   self.input = nil;
+  self.arena = nil;
 
   [super dealloc];
 }
@@ -55,7 +58,9 @@ const int32_t BUFFER_SIZE = 4096;
 
 - (id) initWithData:(NSData*) data {
   if ((self = [super init])) {
-    self.buffer = [NSMutableData dataWithData:data];
+    NSMutableData* copy = [data mutableCopy];
+    self.buffer = copy;
+    [copy release];
     bufferSize = buffer.length;
     self.input = nil;
     [self commonInit];
@@ -155,6 +160,62 @@ const int32_t BUFFER_SIZE = 4096;
 }
 
 
+- (int32_t) countBufferedRepeatedField:(int32_t) tag {
+  uint8_t tagBytes[5];
+  int32_t tagSize = 0;
+  for (uint32_t value = (uint32_t)tag; ; value >>= 7) {
+    if (value < 0x80) {
+      tagBytes[tagSize++] = (uint8_t)value;
+      break;
+    }
+    tagBytes[tagSize++] = (uint8_t)((value & 0x7F) | 0x80);
+  }
+
+  const uint8_t* bytes = (const uint8_t*)buffer.bytes;
+  const int32_t wireType = PBWireFormatGetTagWireType(tag);
+  int32_t pos = bufferPos;
+  int32_t count = 0;
+
+  while (YES) {
+    switch (wireType) {
+      case PBWireFormatVarint:
+        while (pos < bufferSize && (bytes[pos] & 0x80) != 0) {
+          pos++;
+        }
+        pos++;
+        break;
+      case PBWireFormatFixed32:
+        pos += 4;
+        break;
+      case PBWireFormatFixed64:
+        pos += 8;
+        break;
+      default:
+        return MAX(count, 1);
+    }
+
+    if (pos > bufferSize) {
+      break;
+    }
+    count++;
+
+    if (pos + tagSize > bufferSize || memcmp(bytes + pos, tagBytes, tagSize) != 0) {
+      break;
+    }
+    pos += tagSize;
+  }
+
+  return MAX(count, 1);
+}
+
+
+- (int32_t) bytesBufferedUntilLimit {
+  // recomputeBufferSizeAfterLimit keeps bufferSize from reaching past the
+  // current limit.
+  return bufferSize - bufferPos;
+}
+
+
 /**
  * Reads and discards an entire message.  This will read either until EOF
  * or until an endgroup tag, whichever comes first.
@@ -219,20 +280,30 @@ const int32_t BUFFER_SIZE = 4096;
 
 /** Read a {@code string} field value from the stream. */
 - (NSString*) readString {
+  return [[self newString] autorelease];
+}
+
+
+- (NSString*) newString {
   int32_t size = [self readRawVarint32];
   if (size <= (bufferSize - bufferPos) && size > 0) {
     // Fast path:  We already have the bytes in a contiguous buffer, so
     //   just copy directly from it.
     //  new String(buffer, bufferPos, size, "UTF-8");
-    NSString* result = [[[NSString alloc] initWithBytes:(((uint8_t*) buffer.bytes) + bufferPos)
-                                                 length:size
-                                               encoding:NSUTF8StringEncoding] autorelease];
+    NSString* result;
+    if (arena != nil) {
+      result = [arena newStringWithUTF8Bytes:(((uint8_t*) buffer.bytes) + bufferPos) length:size];
+    } else {
+      result = [[NSString alloc] initWithBytes:(((uint8_t*) buffer.bytes) + bufferPos)
+                                        length:size
+                                      encoding:NSUTF8StringEncoding];
+    }
     bufferPos += size;
     return result;
   } else {
     // Slow path:  Build a byte array first then copy it.
     NSData* data = [self readRawData:size];
-    return [[[NSString alloc] initWithData:data encoding:NSUTF8StringEncoding] autorelease];
+    return [[NSString alloc] initWithData:data encoding:NSUTF8StringEncoding];
   }
 }
 
@@ -285,16 +356,26 @@ const int32_t BUFFER_SIZE = 4096;
 
 /** Read a {@code bytes} field value from the stream. */
 - (NSData*) readData {
+  return [[self newData] autorelease];
+}
+
+
+- (NSData*) newData {
   int32_t size = [self readRawVarint32];
   if (size < bufferSize - bufferPos && size > 0) {
     // Fast path:  We already have the bytes in a contiguous buffer, so
     //   just copy directly from it.
-    NSData* result = [NSData dataWithBytes:(((uint8_t*) buffer.bytes) + bufferPos) length:size];
+    NSData* result;
+    if (arena != nil) {
+      result = [arena newDataWithBytes:(((uint8_t*) buffer.bytes) + bufferPos) length:size];
+    } else {
+      result = [[NSData alloc] initWithBytes:(((uint8_t*) buffer.bytes) + bufferPos) length:size];
+    }
     bufferPos += size;
     return result;
   } else {
     // Slow path:  Build a byte array first then copy it.
-    return [self readRawData:size];
+    return [[self readRawData:size] retain];
   }
 }
 
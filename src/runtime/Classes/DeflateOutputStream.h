@@ -0,0 +1,70 @@
+// Protocol Buffers for Objective C
+//
+// Copyright 2010 Booyah Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <Foundation/Foundation.h>
+
+struct z_stream_s;
+
+extern const int32_t PBDeflateDefaultCompressionLevel;
+extern const int32_t PBDeflateDefaultWindowBits;
+
+/**
+ * An NSOutputStream adapter that deflates everything written to it before
+ * passing it on to an underlying stream.  Hand it to
+ * {@code +[PBCodedOutputStream streamWithOutputStream:]} and each
+ * {@code flush} of the coded stream's ring buffer is compressed as one
+ * chunk; the uncompressed message is never materialized in full.
+ *
+ * The deflate stream is only terminated by {@code finish} (or
+ * {@code close}, which calls it), so callers must flush the coded stream
+ * first and then finish this one.  {@code windowBits} follows zlib's
+ * conventions: 8..15 for a zlib wrapper, -8..-15 for raw deflate, and
+ * 24..31 for a gzip wrapper.
+ */
+@interface PBDeflateOutputStream : NSOutputStream {
+@private
+  NSOutputStream* output;
+  struct z_stream_s* stream;
+  NSMutableData* chunk;
+  BOOL finished;
+}
+
+@property (retain) NSOutputStream* output;
+
++ (PBDeflateOutputStream*) streamWithOutputStream:(NSOutputStream*) output;
++ (PBDeflateOutputStream*) streamWithOutputStream:(NSOutputStream*) output
+                                 compressionLevel:(int32_t) level
+                                       windowBits:(int32_t) windowBits;
+
+- (id) initWithOutputStream:(NSOutputStream*) output
+           compressionLevel:(int32_t) level
+                 windowBits:(int32_t) windowBits;
+
+/**
+ * Emits all pending compressed data on a byte boundary (Z_SYNC_FLUSH) so
+ * that the peer can decode everything written so far.  Costs a few bytes
+ * of ratio per call.
+ */
+- (void) flushCompressed;
+
+/** Writes the deflate trailer.  No more data may be written afterwards. */
+- (void) finish;
+
+/** Total uncompressed and compressed byte counts seen so far. */
+- (int64_t) totalIn;
+- (int64_t) totalOut;
+
+@end
@@ -0,0 +1,185 @@
+// Protocol Buffers for Objective C
+//
+// Copyright 2010 Booyah Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import "DeflateOutputStream.h"
+
+#import <zlib.h>
+
+const int32_t PBDeflateDefaultCompressionLevel = Z_DEFAULT_COMPRESSION;
+const int32_t PBDeflateDefaultWindowBits = MAX_WBITS;
+
+static const int32_t DEFLATE_CHUNK_SIZE = 4 * 1024;
+
+
+@implementation PBDeflateOutputStream
+
+@synthesize output;
+
+- (void) dealloc {
+  if (stream != NULL) {
+    deflateEnd(stream);
+    free(stream);
+  }
+  [chunk release];
+  self.output = nil;
+
+  [super dealloc];
+}
+
+
+- (id) initWithOutputStream:(NSOutputStream*) output_
+           compressionLevel:(int32_t) level
+                 windowBits:(int32_t) windowBits {
+  if ((self = [super init])) {
+    self.output = output_;
+    chunk = [[NSMutableData alloc] initWithLength:DEFLATE_CHUNK_SIZE];
+    stream = calloc(1, sizeof(z_stream));
+    if (stream == NULL ||
+        deflateInit2(stream, level, Z_DEFLATED, windowBits, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+      free(stream);
+      stream = NULL;
+      [self release];
+      @throw [NSException exceptionWithName:@"IllegalArgument" reason:@"Invalid deflate parameters" userInfo:nil];
+    }
+  }
+
+  return self;
+}
+
+
++ (PBDeflateOutputStream*) streamWithOutputStream:(NSOutputStream*) output
+                                 compressionLevel:(int32_t) level
+                                       windowBits:(int32_t) windowBits {
+  return [[[PBDeflateOutputStream alloc] initWithOutputStream:output
+                                             compressionLevel:level
+                                                   windowBits:windowBits] autorelease];
+}
+
+
++ (PBDeflateOutputStream*) streamWithOutputStream:(NSOutputStream*) output {
+  return [PBDeflateOutputStream streamWithOutputStream:output
+                                      compressionLevel:PBDeflateDefaultCompressionLevel
+                                            windowBits:PBDeflateDefaultWindowBits];
+}
+
+
+/**
+ * Runs deflate with the given flush mode until zlib has consumed all of
+ * its input and has nothing more to emit, writing each filled chunk to the
+ * underlying stream.  Returns NO if the underlying stream stopped
+ * accepting data.
+ */
+- (BOOL) deflateWithFlush:(int) flush {
+  uint8_t* out = chunk.mutableBytes;
+  do {
+    stream->next_out = out;
+    stream->avail_out = DEFLATE_CHUNK_SIZE;
+
+    int status = deflate(stream, flush);
+    if (status == Z_STREAM_ERROR) {
+      @throw [NSException exceptionWithName:@"IllegalState" reason:@"deflate failed" userInfo:nil];
+    }
+
+    NSInteger pending = DEFLATE_CHUNK_SIZE - stream->avail_out;
+    const uint8_t* p = out;
+    while (pending > 0) {
+      NSInteger written = [output write:p maxLength:pending];
+      if (written <= 0) {
+        return NO;
+      }
+      p += written;
+      pending -= written;
+    }
+  } while (stream->avail_out == 0);
+
+  return YES;
+}
+
+
+- (void) open {
+  [output open];
+}
+
+
+- (void) close {
+  [self finish];
+  [output close];
+}
+
+
+- (NSInteger) write:(const uint8_t*) buffer maxLength:(NSUInteger) len {
+  if (finished) {
+    return -1;
+  }
+
+  stream->next_in = (Bytef*)buffer;
+  stream->avail_in = (uInt)len;
+  if (![self deflateWithFlush:Z_NO_FLUSH]) {
+    return -1;
+  }
+
+  return len;
+}
+
+
+- (BOOL) hasSpaceAvailable {
+  return !finished && output.hasSpaceAvailable;
+}
+
+
+- (NSStreamStatus) streamStatus {
+  return output.streamStatus;
+}
+
+
+- (NSError*) streamError {
+  return output.streamError;
+}
+
+
+- (void) flushCompressed {
+  if (finished) {
+    return;
+  }
+
+  stream->next_in = NULL;
+  stream->avail_in = 0;
+  [self deflateWithFlush:Z_SYNC_FLUSH];
+}
+
+
+- (void) finish {
+  if (finished) {
+    return;
+  }
+
+  stream->next_in = NULL;
+  stream->avail_in = 0;
+  [self deflateWithFlush:Z_FINISH];
+  finished = YES;
+}
+
+
+- (int64_t) totalIn {
+  return stream->total_in;
+}
+
+
+- (int64_t) totalOut {
+  return stream->total_out;
+}
+
+@end
@@ -1,7 +1,5 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 
-#import "ProtocolBuffers.h"
-
 @class PBDescriptorProto;
 @class PBDescriptorProto_Builder;
 @class PBDescriptorProto_ExtensionRange;
@@ -34,10 +32,26 @@
 @class PBServiceDescriptorProto_Builder;
 @class PBServiceOptions;
 @class PBServiceOptions_Builder;
+@class PBSourceCodeInfo;
+@class PBSourceCodeInfo_Builder;
+@class PBSourceCodeInfo_Location;
+@class PBSourceCodeInfo_Location_Builder;
 @class PBUninterpretedOption;
 @class PBUninterpretedOption_Builder;
 @class PBUninterpretedOption_NamePart;
 @class PBUninterpretedOption_NamePart_Builder;
+#ifndef __has_feature
+  #define __has_feature(x) 0 // Compatibility with non-clang compilers.
+#endif // __has_feature
+
+#ifndef NS_RETURNS_NOT_RETAINED
+  #if __has_feature(attribute_ns_returns_not_retained)
+    #define NS_RETURNS_NOT_RETAINED __attribute__((ns_returns_not_retained))
+  #else
+    #define NS_RETURNS_NOT_RETAINED
+  #endif
+#endif
+
 typedef enum {
   PBFieldDescriptorProto_TypeTypeDouble = 1,
   PBFieldDescriptorProto_TypeTypeFloat = 2,
@@ -78,6 +92,7 @@ typedef enum {
 BOOL PBFileOptions_OptimizeModeIsValidValue(PBFileOptions_OptimizeMode value);
 
 typedef enum {
+  PBFieldOptions_CTypeString = 0,
   PBFieldOptions_CTypeCord = 1,
   PBFieldOptions_CTypeStringPiece = 2,
 } PBFieldOptions_CType;
@@ -92,11 +107,12 @@ BOOL PBFieldOptions_CTypeIsValidValue(PBFieldOptions_CType value);
 @end
 
 @interface PBFileDescriptorSet : PBGeneratedMessage {
-@private
-  NSMutableArray* mutableFileList;
+@package
+  uint32_t hasBits_[1];
+  PBObjectArray * fileArray;
 }
-- (NSArray*) fileList;
-- (PBFileDescriptorProto*) fileAtIndex:(int32_t) index;
+@property (nonatomic, readonly, retain) PBArray * file;
+- (PBFileDescriptorProto*)fileAtIndex:(NSUInteger)index;
 
 + (PBFileDescriptorSet*) defaultInstance;
 - (PBFileDescriptorSet*) defaultInstance;
@@ -106,6 +122,7 @@ BOOL PBFieldOptions_CTypeIsValidValue(PBFieldOptions_CType value);
 - (PBFileDescriptorSet_Builder*) builder;
 + (PBFileDescriptorSet_Builder*) builder;
 + (PBFileDescriptorSet_Builder*) builderWithPrototype:(PBFileDescriptorSet*) prototype;
+- (PBFileDescriptorSet_Builder*) toBuilder;
 
 + (PBFileDescriptorSet*) parseFromData:(NSData*) data;
 + (PBFileDescriptorSet*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
@@ -118,58 +135,68 @@ BOOL PBFieldOptions_CTypeIsValidValue(PBFieldOptions_CType value);
 @interface PBFileDescriptorSet_Builder : PBGeneratedMessage_Builder {
 @private
   PBFileDescriptorSet* result;
+  PBFileDescriptorSet* prototype_;
 }
 
 - (PBFileDescriptorSet*) defaultInstance;
 
 - (PBFileDescriptorSet_Builder*) clear;
 - (PBFileDescriptorSet_Builder*) clone;
+- (PBFileDescriptorSet_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (PBFileDescriptorSet_Builder*) recycle:(PBFileDescriptorSet*) message;
 
 - (PBFileDescriptorSet*) build;
 - (PBFileDescriptorSet*) buildPartial;
+- (PBFileDescriptorSet*) newBuildPartial;
 
 - (PBFileDescriptorSet_Builder*) mergeFrom:(PBFileDescriptorSet*) other;
 - (PBFileDescriptorSet_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
 - (PBFileDescriptorSet_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 
-- (NSArray*) fileList;
-- (PBFileDescriptorProto*) fileAtIndex:(int32_t) index;
-- (PBFileDescriptorSet_Builder*) replaceFileAtIndex:(int32_t) index with:(PBFileDescriptorProto*) value;
-- (PBFileDescriptorSet_Builder*) addFile:(PBFileDescriptorProto*) value;
-- (PBFileDescriptorSet_Builder*) addAllFile:(NSArray*) values;
-- (PBFileDescriptorSet_Builder*) clearFileList;
+- (PBAppendableArray *)file;
+- (PBFileDescriptorProto*)fileAtIndex:(NSUInteger)index;
+- (PBFileDescriptorSet_Builder *)addFile:(PBFileDescriptorProto*)value;
+- (PBFileDescriptorSet_Builder *)setFileArray:(NSArray *)array;
+- (PBFileDescriptorSet_Builder *)setFileValues:(const PBFileDescriptorProto* *)values count:(NSUInteger)count;
+- (PBFileDescriptorSet_Builder *)clearFile;
 @end
 
 @interface PBFileDescriptorProto : PBGeneratedMessage {
-@private
-  BOOL hasName_:1;
-  BOOL hasPackage_:1;
-  BOOL hasOptions_:1;
+@package
+  uint32_t hasBits_[1];
   NSString* name;
   NSString* package;
   PBFileOptions* options;
-  NSMutableArray* mutableDependencyList;
-  NSMutableArray* mutableMessageTypeList;
-  NSMutableArray* mutableEnumTypeList;
-  NSMutableArray* mutableServiceList;
-  NSMutableArray* mutableExtensionList;
+  PBSourceCodeInfo* sourceCodeInfo;
+  PBObjectArray * dependencyArray;
+  PBObjectArray * messageTypeArray;
+  PBObjectArray * enumTypeArray;
+  PBObjectArray * serviceArray;
+  PBObjectArray * extensionArray;
 }
 - (BOOL) hasName;
 - (BOOL) hasPackage;
 - (BOOL) hasOptions;
-@property (readonly, retain) NSString* name;
-@property (readonly, retain) NSString* package;
-@property (readonly, retain) PBFileOptions* options;
-- (NSArray*) dependencyList;
-- (NSString*) dependencyAtIndex:(int32_t) index;
-- (NSArray*) messageTypeList;
-- (PBDescriptorProto*) messageTypeAtIndex:(int32_t) index;
-- (NSArray*) enumTypeList;
-- (PBEnumDescriptorProto*) enumTypeAtIndex:(int32_t) index;
-- (NSArray*) serviceList;
-- (PBServiceDescriptorProto*) serviceAtIndex:(int32_t) index;
-- (NSArray*) extensionList;
-- (PBFieldDescriptorProto*) extensionAtIndex:(int32_t) index;
+- (BOOL) hasSourceCodeInfo;
+@property (nonatomic, readonly, retain) NSString* name;
+@property (nonatomic, readonly, retain) NSString* package;
+@property (nonatomic, readonly, retain) PBArray * dependency;
+@property (nonatomic, readonly, retain) PBArray * messageType;
+@property (nonatomic, readonly, retain) PBArray * enumType;
+@property (nonatomic, readonly, retain) PBArray * service;
+@property (nonatomic, readonly, retain) PBArray * extension;
+@property (nonatomic, readonly, retain) PBFileOptions* options;
+@property (nonatomic, readonly, retain) PBSourceCodeInfo* sourceCodeInfo;
+- (NSString*)dependencyAtIndex:(NSUInteger)index;
+- (PBDescriptorProto*)messageTypeAtIndex:(NSUInteger)index;
+- (PBEnumDescriptorProto*)enumTypeAtIndex:(NSUInteger)index;
+- (PBServiceDescriptorProto*)serviceAtIndex:(NSUInteger)index;
+- (PBFieldDescriptorProto*)extensionAtIndex:(NSUInteger)index;
 
 + (PBFileDescriptorProto*) defaultInstance;
 - (PBFileDescriptorProto*) defaultInstance;
@@ -179,6 +206,7 @@ BOOL PBFieldOptions_CTypeIsValidValue(PBFieldOptions_CType value);
 - (PBFileDescriptorProto_Builder*) builder;
 + (PBFileDescriptorProto_Builder*) builder;
 + (PBFileDescriptorProto_Builder*) builderWithPrototype:(PBFileDescriptorProto*) prototype;
+- (PBFileDescriptorProto_Builder*) toBuilder;
 
 + (PBFileDescriptorProto*) parseFromData:(NSData*) data;
 + (PBFileDescriptorProto*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
@@ -191,15 +219,28 @@ BOOL PBFieldOptions_CTypeIsValidValue(PBFieldOptions_CType value);
 @interface PBFileDescriptorProto_Builder : PBGeneratedMessage_Builder {
 @private
   PBFileDescriptorProto* result;
+  PBFileDescriptorProto* prototype_;
+  PBFileOptions_Builder* optionsBuilder_;
+  PBFileOptions_Builder* optionsSpareBuilder_;
+  PBSourceCodeInfo_Builder* sourceCodeInfoBuilder_;
+  PBSourceCodeInfo_Builder* sourceCodeInfoSpareBuilder_;
 }
 
 - (PBFileDescriptorProto*) defaultInstance;
 
 - (PBFileDescriptorProto_Builder*) clear;
 - (PBFileDescriptorProto_Builder*) clone;
+- (PBFileDescriptorProto_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (PBFileDescriptorProto_Builder*) recycle:(PBFileDescriptorProto*) message;
 
 - (PBFileDescriptorProto*) build;
 - (PBFileDescriptorProto*) buildPartial;
+- (PBFileDescriptorProto*) newBuildPartial;
 
 - (PBFileDescriptorProto_Builder*) mergeFrom:(PBFileDescriptorProto*) other;
 - (PBFileDescriptorProto_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -215,40 +256,41 @@ BOOL PBFieldOptions_CTypeIsValidValue(PBFieldOptions_CType value);
 - (PBFileDescriptorProto_Builder*) setPackage:(NSString*) value;
 - (PBFileDescriptorProto_Builder*) clearPackage;
 
-- (NSArray*) dependencyList;
-- (NSString*) dependencyAtIndex:(int32_t) index;
-- (PBFileDescriptorProto_Builder*) replaceDependencyAtIndex:(int32_t) index with:(NSString*) value;
-- (PBFileDescriptorProto_Builder*) addDependency:(NSString*) value;
-- (PBFileDescriptorProto_Builder*) addAllDependency:(NSArray*) values;
-- (PBFileDescriptorProto_Builder*) clearDependencyList;
-
-- (NSArray*) messageTypeList;
-- (PBDescriptorProto*) messageTypeAtIndex:(int32_t) index;
-- (PBFileDescriptorProto_Builder*) replaceMessageTypeAtIndex:(int32_t) index with:(PBDescriptorProto*) value;
-- (PBFileDescriptorProto_Builder*) addMessageType:(PBDescriptorProto*) value;
-- (PBFileDescriptorProto_Builder*) addAllMessageType:(NSArray*) values;
-- (PBFileDescriptorProto_Builder*) clearMessageTypeList;
-
-- (NSArray*) enumTypeList;
-- (PBEnumDescriptorProto*) enumTypeAtIndex:(int32_t) index;
-- (PBFileDescriptorProto_Builder*) replaceEnumTypeAtIndex:(int32_t) index with:(PBEnumDescriptorProto*) value;
-- (PBFileDescriptorProto_Builder*) addEnumType:(PBEnumDescriptorProto*) value;
-- (PBFileDescriptorProto_Builder*) addAllEnumType:(NSArray*) values;
-- (PBFileDescriptorProto_Builder*) clearEnumTypeList;
-
-- (NSArray*) serviceList;
-- (PBServiceDescriptorProto*) serviceAtIndex:(int32_t) index;
-- (PBFileDescriptorProto_Builder*) replaceServiceAtIndex:(int32_t) index with:(PBServiceDescriptorProto*) value;
-- (PBFileDescriptorProto_Builder*) addService:(PBServiceDescriptorProto*) value;
-- (PBFileDescriptorProto_Builder*) addAllService:(NSArray*) values;
-- (PBFileDescriptorProto_Builder*) clearServiceList;
-
-- (NSArray*) extensionList;
-- (PBFieldDescriptorProto*) extensionAtIndex:(int32_t) index;
-- (PBFileDescriptorProto_Builder*) replaceExtensionAtIndex:(int32_t) index with:(PBFieldDescriptorProto*) value;
-- (PBFileDescriptorProto_Builder*) addExtension:(PBFieldDescriptorProto*) value;
-- (PBFileDescriptorProto_Builder*) addAllExtension:(NSArray*) values;
-- (PBFileDescriptorProto_Builder*) clearExtensionList;
+- (PBAppendableArray *)dependency;
+- (NSString*)dependencyAtIndex:(NSUInteger)index;
+- (PBFileDescriptorProto_Builder *)addDependency:(NSString*)value;
+- (PBFileDescriptorProto_Builder *)setDependencyArray:(NSArray *)array;
+- (PBFileDescriptorProto_Builder *)setDependency:(PBArray *)array;
+- (PBFileDescriptorProto_Builder *)setDependencyValues:(const NSString* *)values count:(NSUInteger)count;
+- (PBFileDescriptorProto_Builder *)clearDependency;
+
+- (PBAppendableArray *)messageType;
+- (PBDescriptorProto*)messageTypeAtIndex:(NSUInteger)index;
+- (PBFileDescriptorProto_Builder *)addMessageType:(PBDescriptorProto*)value;
+- (PBFileDescriptorProto_Builder *)setMessageTypeArray:(NSArray *)array;
+- (PBFileDescriptorProto_Builder *)setMessageTypeValues:(const PBDescriptorProto* *)values count:(NSUInteger)count;
+- (PBFileDescriptorProto_Builder *)clearMessageType;
+
+- (PBAppendableArray *)enumType;
+- (PBEnumDescriptorProto*)enumTypeAtIndex:(NSUInteger)index;
+- (PBFileDescriptorProto_Builder *)addEnumType:(PBEnumDescriptorProto*)value;
+- (PBFileDescriptorProto_Builder *)setEnumTypeArray:(NSArray *)array;
+- (PBFileDescriptorProto_Builder *)setEnumTypeValues:(const PBEnumDescriptorProto* *)values count:(NSUInteger)count;
+- (PBFileDescriptorProto_Builder *)clearEnumType;
+
+- (PBAppendableArray *)service;
+- (PBServiceDescriptorProto*)serviceAtIndex:(NSUInteger)index;
+- (PBFileDescriptorProto_Builder *)addService:(PBServiceDescriptorProto*)value;
+- (PBFileDescriptorProto_Builder *)setServiceArray:(NSArray *)array;
+- (PBFileDescriptorProto_Builder *)setServiceValues:(const PBServiceDescriptorProto* *)values count:(NSUInteger)count;
+- (PBFileDescriptorProto_Builder *)clearService;
+
+- (PBAppendableArray *)extension;
+- (PBFieldDescriptorProto*)extensionAtIndex:(NSUInteger)index;
+- (PBFileDescriptorProto_Builder *)addExtension:(PBFieldDescriptorProto*)value;
+- (PBFileDescriptorProto_Builder *)setExtensionArray:(NSArray *)array;
+- (PBFileDescriptorProto_Builder *)setExtensionValues:(const PBFieldDescriptorProto* *)values count:(NSUInteger)count;
+- (PBFileDescriptorProto_Builder *)clearExtension;
 
 - (BOOL) hasOptions;
 - (PBFileOptions*) options;
@@ -256,34 +298,40 @@ BOOL PBFieldOptions_CTypeIsValidValue(PBFieldOptions_CType value);
 - (PBFileDescriptorProto_Builder*) setOptionsBuilder:(PBFileOptions_Builder*) builderForValue;
 - (PBFileDescriptorProto_Builder*) mergeOptions:(PBFileOptions*) value;
 - (PBFileDescriptorProto_Builder*) clearOptions;
+
+- (BOOL) hasSourceCodeInfo;
+- (PBSourceCodeInfo*) sourceCodeInfo;
+- (PBFileDescriptorProto_Builder*) setSourceCodeInfo:(PBSourceCodeInfo*) value;
+- (PBFileDescriptorProto_Builder*) setSourceCodeInfoBuilder:(PBSourceCodeInfo_Builder*) builderForValue;
+- (PBFileDescriptorProto_Builder*) mergeSourceCodeInfo:(PBSourceCodeInfo*) value;
+- (PBFileDescriptorProto_Builder*) clearSourceCodeInfo;
 @end
 
 @interface PBDescriptorProto : PBGeneratedMessage {
-@private
-  BOOL hasName_:1;
-  BOOL hasOptions_:1;
+@package
+  uint32_t hasBits_[1];
   NSString* name;
   PBMessageOptions* options;
-  NSMutableArray* mutableFieldList;
-  NSMutableArray* mutableExtensionList;
-  NSMutableArray* mutableNestedTypeList;
-  NSMutableArray* mutableEnumTypeList;
-  NSMutableArray* mutableExtensionRangeList;
+  PBObjectArray * fieldArray;
+  PBObjectArray * extensionArray;
+  PBObjectArray * nestedTypeArray;
+  PBObjectArray * enumTypeArray;
+  PBObjectArray * extensionRangeArray;
 }
 - (BOOL) hasName;
 - (BOOL) hasOptions;
-@property (readonly, retain) NSString* name;
-@property (readonly, retain) PBMessageOptions* options;
-- (NSArray*) fieldList;
-- (PBFieldDescriptorProto*) fieldAtIndex:(int32_t) index;
-- (NSArray*) extensionList;
-- (PBFieldDescriptorProto*) extensionAtIndex:(int32_t) index;
-- (NSArray*) nestedTypeList;
-- (PBDescriptorProto*) nestedTypeAtIndex:(int32_t) index;
-- (NSArray*) enumTypeList;
-- (PBEnumDescriptorProto*) enumTypeAtIndex:(int32_t) index;
-- (NSArray*) extensionRangeList;
-- (PBDescriptorProto_ExtensionRange*) extensionRangeAtIndex:(int32_t) index;
+@property (nonatomic, readonly, retain) NSString* name;
+@property (nonatomic, readonly, retain) PBArray * field;
+@property (nonatomic, readonly, retain) PBArray * extension;
+@property (nonatomic, readonly, retain) PBArray * nestedType;
+@property (nonatomic, readonly, retain) PBArray * enumType;
+@property (nonatomic, readonly, retain) PBArray * extensionRange;
+@property (nonatomic, readonly, retain) PBMessageOptions* options;
+- (PBFieldDescriptorProto*)fieldAtIndex:(NSUInteger)index;
+- (PBFieldDescriptorProto*)extensionAtIndex:(NSUInteger)index;
+- (PBDescriptorProto*)nestedTypeAtIndex:(NSUInteger)index;
+- (PBEnumDescriptorProto*)enumTypeAtIndex:(NSUInteger)index;
+- (PBDescriptorProto_ExtensionRange*)extensionRangeAtIndex:(NSUInteger)index;
 
 + (PBDescriptorProto*) defaultInstance;
 - (PBDescriptorProto*) defaultInstance;
@@ -293,6 +341,7 @@ BOOL PBFieldOptions_CTypeIsValidValue(PBFieldOptions_CType value);
 - (PBDescriptorProto_Builder*) builder;
 + (PBDescriptorProto_Builder*) builder;
 + (PBDescriptorProto_Builder*) builderWithPrototype:(PBDescriptorProto*) prototype;
+- (PBDescriptorProto_Builder*) toBuilder;
 
 + (PBDescriptorProto*) parseFromData:(NSData*) data;
 + (PBDescriptorProto*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
@@ -303,16 +352,15 @@ BOOL PBFieldOptions_CTypeIsValidValue(PBFieldOptions_CType value);
 @end
 
 @interface PBDescriptorProto_ExtensionRange : PBGeneratedMessage {
-@private
-  BOOL hasStart_:1;
-  BOOL hasEnd_:1;
+@package
+  uint32_t hasBits_[1];
   int32_t start;
   int32_t end;
 }
 - (BOOL) hasStart;
 - (BOOL) hasEnd;
-@property (readonly) int32_t start;
-@property (readonly) int32_t end;
+@property (nonatomic, readonly) int32_t start;
+@property (nonatomic, readonly) int32_t end;
 
 + (PBDescriptorProto_ExtensionRange*) defaultInstance;
 - (PBDescriptorProto_ExtensionRange*) defaultInstance;
@@ -322,6 +370,7 @@ BOOL PBFieldOptions_CTypeIsValidValue(PBFieldOptions_CType value);
 - (PBDescriptorProto_ExtensionRange_Builder*) builder;
 + (PBDescriptorProto_ExtensionRange_Builder*) builder;
 + (PBDescriptorProto_ExtensionRange_Builder*) builderWithPrototype:(PBDescriptorProto_ExtensionRange*) prototype;
+- (PBDescriptorProto_ExtensionRange_Builder*) toBuilder;
 
 + (PBDescriptorProto_ExtensionRange*) parseFromData:(NSData*) data;
 + (PBDescriptorProto_ExtensionRange*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
@@ -334,15 +383,24 @@ BOOL PBFieldOptions_CTypeIsValidValue(PBFieldOptions_CType value);
 @interface PBDescriptorProto_ExtensionRange_Builder : PBGeneratedMessage_Builder {
 @private
   PBDescriptorProto_ExtensionRange* result;
+  PBDescriptorProto_ExtensionRange* prototype_;
 }
 
 - (PBDescriptorProto_ExtensionRange*) defaultInstance;
 
 - (PBDescriptorProto_ExtensionRange_Builder*) clear;
 - (PBDescriptorProto_ExtensionRange_Builder*) clone;
+- (PBDescriptorProto_ExtensionRange_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (PBDescriptorProto_ExtensionRange_Builder*) recycle:(PBDescriptorProto_ExtensionRange*) message;
 
 - (PBDescriptorProto_ExtensionRange*) build;
 - (PBDescriptorProto_ExtensionRange*) buildPartial;
+- (PBDescriptorProto_ExtensionRange*) newBuildPartial;
 
 - (PBDescriptorProto_ExtensionRange_Builder*) mergeFrom:(PBDescriptorProto_ExtensionRange*) other;
 - (PBDescriptorProto_ExtensionRange_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -362,15 +420,26 @@ BOOL PBFieldOptions_CTypeIsValidValue(PBFieldOptions_CType value);
 @interface PBDescriptorProto_Builder : PBGeneratedMessage_Builder {
 @private
   PBDescriptorProto* result;
+  PBDescriptorProto* prototype_;
+  PBMessageOptions_Builder* optionsBuilder_;
+  PBMessageOptions_Builder* optionsSpareBuilder_;
 }
 
 - (PBDescriptorProto*) defaultInstance;
 
 - (PBDescriptorProto_Builder*) clear;
 - (PBDescriptorProto_Builder*) clone;
+- (PBDescriptorProto_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (PBDescriptorProto_Builder*) recycle:(PBDescriptorProto*) message;
 
 - (PBDescriptorProto*) build;
 - (PBDescriptorProto*) buildPartial;
+- (PBDescriptorProto*) newBuildPartial;
 
 - (PBDescriptorProto_Builder*) mergeFrom:(PBDescriptorProto*) other;
 - (PBDescriptorProto_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -381,40 +450,40 @@ BOOL PBFieldOptions_CTypeIsValidValue(PBFieldOptions_CType value);
 - (PBDescriptorProto_Builder*) setName:(NSString*) value;
 - (PBDescriptorProto_Builder*) clearName;
 
-- (NSArray*) fieldList;
-- (PBFieldDescriptorProto*) fieldAtIndex:(int32_t) index;
-- (PBDescriptorProto_Builder*) replaceFieldAtIndex:(int32_t) index with:(PBFieldDescriptorProto*) value;
-- (PBDescriptorProto_Builder*) addField:(PBFieldDescriptorProto*) value;
-- (PBDescriptorProto_Builder*) addAllField:(NSArray*) values;
-- (PBDescriptorProto_Builder*) clearFieldList;
-
-- (NSArray*) extensionList;
-- (PBFieldDescriptorProto*) extensionAtIndex:(int32_t) index;
-- (PBDescriptorProto_Builder*) replaceExtensionAtIndex:(int32_t) index with:(PBFieldDescriptorProto*) value;
-- (PBDescriptorProto_Builder*) addExtension:(PBFieldDescriptorProto*) value;
-- (PBDescriptorProto_Builder*) addAllExtension:(NSArray*) values;
-- (PBDescriptorProto_Builder*) clearExtensionList;
-
-- (NSArray*) nestedTypeList;
-- (PBDescriptorProto*) nestedTypeAtIndex:(int32_t) index;
-- (PBDescriptorProto_Builder*) replaceNestedTypeAtIndex:(int32_t) index with:(PBDescriptorProto*) value;
-- (PBDescriptorProto_Builder*) addNestedType:(PBDescriptorProto*) value;
-- (PBDescriptorProto_Builder*) addAllNestedType:(NSArray*) values;
-- (PBDescriptorProto_Builder*) clearNestedTypeList;
-
-- (NSArray*) enumTypeList;
-- (PBEnumDescriptorProto*) enumTypeAtIndex:(int32_t) index;
-- (PBDescriptorProto_Builder*) replaceEnumTypeAtIndex:(int32_t) index with:(PBEnumDescriptorProto*) value;
-- (PBDescriptorProto_Builder*) addEnumType:(PBEnumDescriptorProto*) value;
-- (PBDescriptorProto_Builder*) addAllEnumType:(NSArray*) values;
-- (PBDescriptorProto_Builder*) clearEnumTypeList;
-
-- (NSArray*) extensionRangeList;
-- (PBDescriptorProto_ExtensionRange*) extensionRangeAtIndex:(int32_t) index;
-- (PBDescriptorProto_Builder*) replaceExtensionRangeAtIndex:(int32_t) index with:(PBDescriptorProto_ExtensionRange*) value;
-- (PBDescriptorProto_Builder*) addExtensionRange:(PBDescriptorProto_ExtensionRange*) value;
-- (PBDescriptorProto_Builder*) addAllExtensionRange:(NSArray*) values;
-- (PBDescriptorProto_Builder*) clearExtensionRangeList;
+- (PBAppendableArray *)field;
+- (PBFieldDescriptorProto*)fieldAtIndex:(NSUInteger)index;
+- (PBDescriptorProto_Builder *)addField:(PBFieldDescriptorProto*)value;
+- (PBDescriptorProto_Builder *)setFieldArray:(NSArray *)array;
+- (PBDescriptorProto_Builder *)setFieldValues:(const PBFieldDescriptorProto* *)values count:(NSUInteger)count;
+- (PBDescriptorProto_Builder *)clearField;
+
+- (PBAppendableArray *)extension;
+- (PBFieldDescriptorProto*)extensionAtIndex:(NSUInteger)index;
+- (PBDescriptorProto_Builder *)addExtension:(PBFieldDescriptorProto*)value;
+- (PBDescriptorProto_Builder *)setExtensionArray:(NSArray *)array;
+- (PBDescriptorProto_Builder *)setExtensionValues:(const PBFieldDescriptorProto* *)values count:(NSUInteger)count;
+- (PBDescriptorProto_Builder *)clearExtension;
+
+- (PBAppendableArray *)nestedType;
+- (PBDescriptorProto*)nestedTypeAtIndex:(NSUInteger)index;
+- (PBDescriptorProto_Builder *)addNestedType:(PBDescriptorProto*)value;
+- (PBDescriptorProto_Builder *)setNestedTypeArray:(NSArray *)array;
+- (PBDescriptorProto_Builder *)setNestedTypeValues:(const PBDescriptorProto* *)values count:(NSUInteger)count;
+- (PBDescriptorProto_Builder *)clearNestedType;
+
+- (PBAppendableArray *)enumType;
+- (PBEnumDescriptorProto*)enumTypeAtIndex:(NSUInteger)index;
+- (PBDescriptorProto_Builder *)addEnumType:(PBEnumDescriptorProto*)value;
+- (PBDescriptorProto_Builder *)setEnumTypeArray:(NSArray *)array;
+- (PBDescriptorProto_Builder *)setEnumTypeValues:(const PBEnumDescriptorProto* *)values count:(NSUInteger)count;
+- (PBDescriptorProto_Builder *)clearEnumType;
+
+- (PBAppendableArray *)extensionRange;
+- (PBDescriptorProto_ExtensionRange*)extensionRangeAtIndex:(NSUInteger)index;
+- (PBDescriptorProto_Builder *)addExtensionRange:(PBDescriptorProto_ExtensionRange*)value;
+- (PBDescriptorProto_Builder *)setExtensionRangeArray:(NSArray *)array;
+- (PBDescriptorProto_Builder *)setExtensionRangeValues:(const PBDescriptorProto_ExtensionRange* *)values count:(NSUInteger)count;
+- (PBDescriptorProto_Builder *)clearExtensionRange;
 
 - (BOOL) hasOptions;
 - (PBMessageOptions*) options;
@@ -425,15 +494,8 @@ BOOL PBFieldOptions_CTypeIsValidValue(PBFieldOptions_CType value);
 @end
 
 @interface PBFieldDescriptorProto : PBGeneratedMessage {
-@private
-  BOOL hasNumber_:1;
-  BOOL hasName_:1;
-  BOOL hasTypeName_:1;
-  BOOL hasExtendee_:1;
-  BOOL hasDefaultValue_:1;
-  BOOL hasOptions_:1;
-  BOOL hasLabel_:1;
-  BOOL hasType_:1;
+@package
+  uint32_t hasBits_[1];
   int32_t number;
   NSString* name;
   NSString* typeName;
@@ -451,14 +513,14 @@ BOOL PBFieldOptions_CTypeIsValidValue(PBFieldOptions_CType value);
 - (BOOL) hasExtendee;
 - (BOOL) hasDefaultValue;
 - (BOOL) hasOptions;
-@property (readonly, retain) NSString* name;
-@property (readonly) int32_t number;
-@property (readonly) PBFieldDescriptorProto_Label label;
-@property (readonly) PBFieldDescriptorProto_Type type;
-@property (readonly, retain) NSString* typeName;
-@property (readonly, retain) NSString* extendee;
-@property (readonly, retain) NSString* defaultValue;
-@property (readonly, retain) PBFieldOptions* options;
+@property (nonatomic, readonly, retain) NSString* name;
+@property (nonatomic, readonly) int32_t number;
+@property (nonatomic, readonly) PBFieldDescriptorProto_Label label;
+@property (nonatomic, readonly) PBFieldDescriptorProto_Type type;
+@property (nonatomic, readonly, retain) NSString* typeName;
+@property (nonatomic, readonly, retain) NSString* extendee;
+@property (nonatomic, readonly, retain) NSString* defaultValue;
+@property (nonatomic, readonly, retain) PBFieldOptions* options;
 
 + (PBFieldDescriptorProto*) defaultInstance;
 - (PBFieldDescriptorProto*) defaultInstance;
@@ -468,6 +530,7 @@ BOOL PBFieldOptions_CTypeIsValidValue(PBFieldOptions_CType value);
 - (PBFieldDescriptorProto_Builder*) builder;
 + (PBFieldDescriptorProto_Builder*) builder;
 + (PBFieldDescriptorProto_Builder*) builderWithPrototype:(PBFieldDescriptorProto*) prototype;
+- (PBFieldDescriptorProto_Builder*) toBuilder;
 
 + (PBFieldDescriptorProto*) parseFromData:(NSData*) data;
 + (PBFieldDescriptorProto*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
@@ -480,15 +543,26 @@ BOOL PBFieldOptions_CTypeIsValidValue(PBFieldOptions_CType value);
 @interface PBFieldDescriptorProto_Builder : PBGeneratedMessage_Builder {
 @private
   PBFieldDescriptorProto* result;
+  PBFieldDescriptorProto* prototype_;
+  PBFieldOptions_Builder* optionsBuilder_;
+  PBFieldOptions_Builder* optionsSpareBuilder_;
 }
 
 - (PBFieldDescriptorProto*) defaultInstance;
 
 - (PBFieldDescriptorProto_Builder*) clear;
 - (PBFieldDescriptorProto_Builder*) clone;
+- (PBFieldDescriptorProto_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (PBFieldDescriptorProto_Builder*) recycle:(PBFieldDescriptorProto*) message;
 
 - (PBFieldDescriptorProto*) build;
 - (PBFieldDescriptorProto*) buildPartial;
+- (PBFieldDescriptorProto*) newBuildPartial;
 
 - (PBFieldDescriptorProto_Builder*) mergeFrom:(PBFieldDescriptorProto*) other;
 - (PBFieldDescriptorProto_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -538,19 +612,18 @@ BOOL PBFieldOptions_CTypeIsValidValue(PBFieldOptions_CType value);
 @end
 
 @interface PBEnumDescriptorProto : PBGeneratedMessage {
-@private
-  BOOL hasName_:1;
-  BOOL hasOptions_:1;
+@package
+  uint32_t hasBits_[1];
   NSString* name;
   PBEnumOptions* options;
-  NSMutableArray* mutableValueList;
+  PBObjectArray * valueArray;
 }
 - (BOOL) hasName;
 - (BOOL) hasOptions;
-@property (readonly, retain) NSString* name;
-@property (readonly, retain) PBEnumOptions* options;
-- (NSArray*) valueList;
-- (PBEnumValueDescriptorProto*) valueAtIndex:(int32_t) index;
+@property (nonatomic, readonly, retain) NSString* name;
+@property (nonatomic, readonly, retain) PBArray * value;
+@property (nonatomic, readonly, retain) PBEnumOptions* options;
+- (PBEnumValueDescriptorProto*)valueAtIndex:(NSUInteger)index;
 
 + (PBEnumDescriptorProto*) defaultInstance;
 - (PBEnumDescriptorProto*) defaultInstance;
@@ -560,6 +633,7 @@ BOOL PBFieldOptions_CTypeIsValidValue(PBFieldOptions_CType value);
 - (PBEnumDescriptorProto_Builder*) builder;
 + (PBEnumDescriptorProto_Builder*) builder;
 + (PBEnumDescriptorProto_Builder*) builderWithPrototype:(PBEnumDescriptorProto*) prototype;
+- (PBEnumDescriptorProto_Builder*) toBuilder;
 
 + (PBEnumDescriptorProto*) parseFromData:(NSData*) data;
 + (PBEnumDescriptorProto*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
@@ -572,15 +646,26 @@ BOOL PBFieldOptions_CTypeIsValidValue(PBFieldOptions_CType value);
 @interface PBEnumDescriptorProto_Builder : PBGeneratedMessage_Builder {
 @private
   PBEnumDescriptorProto* result;
+  PBEnumDescriptorProto* prototype_;
+  PBEnumOptions_Builder* optionsBuilder_;
+  PBEnumOptions_Builder* optionsSpareBuilder_;
 }
 
 - (PBEnumDescriptorProto*) defaultInstance;
 
 - (PBEnumDescriptorProto_Builder*) clear;
 - (PBEnumDescriptorProto_Builder*) clone;
+- (PBEnumDescriptorProto_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (PBEnumDescriptorProto_Builder*) recycle:(PBEnumDescriptorProto*) message;
 
 - (PBEnumDescriptorProto*) build;
 - (PBEnumDescriptorProto*) buildPartial;
+- (PBEnumDescriptorProto*) newBuildPartial;
 
 - (PBEnumDescriptorProto_Builder*) mergeFrom:(PBEnumDescriptorProto*) other;
 - (PBEnumDescriptorProto_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -591,12 +676,12 @@ BOOL PBFieldOptions_CTypeIsValidValue(PBFieldOptions_CType value);
 - (PBEnumDescriptorProto_Builder*) setName:(NSString*) value;
 - (PBEnumDescriptorProto_Builder*) clearName;
 
-- (NSArray*) valueList;
-- (PBEnumValueDescriptorProto*) valueAtIndex:(int32_t) index;
-- (PBEnumDescriptorProto_Builder*) replaceValueAtIndex:(int32_t) index with:(PBEnumValueDescriptorProto*) value;
-- (PBEnumDescriptorProto_Builder*) addValue:(PBEnumValueDescriptorProto*) value;
-- (PBEnumDescriptorProto_Builder*) addAllValue:(NSArray*) values;
-- (PBEnumDescriptorProto_Builder*) clearValueList;
+- (PBAppendableArray *)value;
+- (PBEnumValueDescriptorProto*)valueAtIndex:(NSUInteger)index;
+- (PBEnumDescriptorProto_Builder *)addValue:(PBEnumValueDescriptorProto*)value;
+- (PBEnumDescriptorProto_Builder *)setValueArray:(NSArray *)array;
+- (PBEnumDescriptorProto_Builder *)setValueValues:(const PBEnumValueDescriptorProto* *)values count:(NSUInteger)count;
+- (PBEnumDescriptorProto_Builder *)clearValue;
 
 - (BOOL) hasOptions;
 - (PBEnumOptions*) options;
@@ -607,10 +692,8 @@ BOOL PBFieldOptions_CTypeIsValidValue(PBFieldOptions_CType value);
 @end
 
 @interface PBEnumValueDescriptorProto : PBGeneratedMessage {
-@private
-  BOOL hasNumber_:1;
-  BOOL hasName_:1;
-  BOOL hasOptions_:1;
+@package
+  uint32_t hasBits_[1];
   int32_t number;
   NSString* name;
   PBEnumValueOptions* options;
@@ -618,9 +701,9 @@ BOOL PBFieldOptions_CTypeIsValidValue(PBFieldOptions_CType value);
 - (BOOL) hasName;
 - (BOOL) hasNumber;
 - (BOOL) hasOptions;
-@property (readonly, retain) NSString* name;
-@property (readonly) int32_t number;
-@property (readonly, retain) PBEnumValueOptions* options;
+@property (nonatomic, readonly, retain) NSString* name;
+@property (nonatomic, readonly) int32_t number;
+@property (nonatomic, readonly, retain) PBEnumValueOptions* options;
 
 + (PBEnumValueDescriptorProto*) defaultInstance;
 - (PBEnumValueDescriptorProto*) defaultInstance;
@@ -630,6 +713,7 @@ BOOL PBFieldOptions_CTypeIsValidValue(PBFieldOptions_CType value);
 - (PBEnumValueDescriptorProto_Builder*) builder;
 + (PBEnumValueDescriptorProto_Builder*) builder;
 + (PBEnumValueDescriptorProto_Builder*) builderWithPrototype:(PBEnumValueDescriptorProto*) prototype;
+- (PBEnumValueDescriptorProto_Builder*) toBuilder;
 
 + (PBEnumValueDescriptorProto*) parseFromData:(NSData*) data;
 + (PBEnumValueDescriptorProto*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
@@ -642,15 +726,26 @@ BOOL PBFieldOptions_CTypeIsValidValue(PBFieldOptions_CType value);
 @interface PBEnumValueDescriptorProto_Builder : PBGeneratedMessage_Builder {
 @private
   PBEnumValueDescriptorProto* result;
+  PBEnumValueDescriptorProto* prototype_;
+  PBEnumValueOptions_Builder* optionsBuilder_;
+  PBEnumValueOptions_Builder* optionsSpareBuilder_;
 }
 
 - (PBEnumValueDescriptorProto*) defaultInstance;
 
 - (PBEnumValueDescriptorProto_Builder*) clear;
 - (PBEnumValueDescriptorProto_Builder*) clone;
+- (PBEnumValueDescriptorProto_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (PBEnumValueDescriptorProto_Builder*) recycle:(PBEnumValueDescriptorProto*) message;
 
 - (PBEnumValueDescriptorProto*) build;
 - (PBEnumValueDescriptorProto*) buildPartial;
+- (PBEnumValueDescriptorProto*) newBuildPartial;
 
 - (PBEnumValueDescriptorProto_Builder*) mergeFrom:(PBEnumValueDescriptorProto*) other;
 - (PBEnumValueDescriptorProto_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -675,19 +770,18 @@ BOOL PBFieldOptions_CTypeIsValidValue(PBFieldOptions_CType value);
 @end
 
 @interface PBServiceDescriptorProto : PBGeneratedMessage {
-@private
-  BOOL hasName_:1;
-  BOOL hasOptions_:1;
+@package
+  uint32_t hasBits_[1];
   NSString* name;
   PBServiceOptions* options;
-  NSMutableArray* mutableMethodList;
+  PBObjectArray * methodArray;
 }
 - (BOOL) hasName;
 - (BOOL) hasOptions;
-@property (readonly, retain) NSString* name;
-@property (readonly, retain) PBServiceOptions* options;
-- (NSArray*) methodList;
-- (PBMethodDescriptorProto*) methodAtIndex:(int32_t) index;
+@property (nonatomic, readonly, retain) NSString* name;
+@property (nonatomic, readonly, retain) PBArray * method;
+@property (nonatomic, readonly, retain) PBServiceOptions* options;
+- (PBMethodDescriptorProto*)methodAtIndex:(NSUInteger)index;
 
 + (PBServiceDescriptorProto*) defaultInstance;
 - (PBServiceDescriptorProto*) defaultInstance;
@@ -697,6 +791,7 @@ BOOL PBFieldOptions_CTypeIsValidValue(PBFieldOptions_CType value);
 - (PBServiceDescriptorProto_Builder*) builder;
 + (PBServiceDescriptorProto_Builder*) builder;
 + (PBServiceDescriptorProto_Builder*) builderWithPrototype:(PBServiceDescriptorProto*) prototype;
+- (PBServiceDescriptorProto_Builder*) toBuilder;
 
 + (PBServiceDescriptorProto*) parseFromData:(NSData*) data;
 + (PBServiceDescriptorProto*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
@@ -709,15 +804,26 @@ BOOL PBFieldOptions_CTypeIsValidValue(PBFieldOptions_CType value);
 @interface PBServiceDescriptorProto_Builder : PBGeneratedMessage_Builder {
 @private
   PBServiceDescriptorProto* result;
+  PBServiceDescriptorProto* prototype_;
+  PBServiceOptions_Builder* optionsBuilder_;
+  PBServiceOptions_Builder* optionsSpareBuilder_;
 }
 
 - (PBServiceDescriptorProto*) defaultInstance;
 
 - (PBServiceDescriptorProto_Builder*) clear;
 - (PBServiceDescriptorProto_Builder*) clone;
+- (PBServiceDescriptorProto_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (PBServiceDescriptorProto_Builder*) recycle:(PBServiceDescriptorProto*) message;
 
 - (PBServiceDescriptorProto*) build;
 - (PBServiceDescriptorProto*) buildPartial;
+- (PBServiceDescriptorProto*) newBuildPartial;
 
 - (PBServiceDescriptorProto_Builder*) mergeFrom:(PBServiceDescriptorProto*) other;
 - (PBServiceDescriptorProto_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -728,12 +834,12 @@ BOOL PBFieldOptions_CTypeIsValidValue(PBFieldOptions_CType value);
 - (PBServiceDescriptorProto_Builder*) setName:(NSString*) value;
 - (PBServiceDescriptorProto_Builder*) clearName;
 
-- (NSArray*) methodList;
-- (PBMethodDescriptorProto*) methodAtIndex:(int32_t) index;
-- (PBServiceDescriptorProto_Builder*) replaceMethodAtIndex:(int32_t) index with:(PBMethodDescriptorProto*) value;
-- (PBServiceDescriptorProto_Builder*) addMethod:(PBMethodDescriptorProto*) value;
-- (PBServiceDescriptorProto_Builder*) addAllMethod:(NSArray*) values;
-- (PBServiceDescriptorProto_Builder*) clearMethodList;
+- (PBAppendableArray *)method;
+- (PBMethodDescriptorProto*)methodAtIndex:(NSUInteger)index;
+- (PBServiceDescriptorProto_Builder *)addMethod:(PBMethodDescriptorProto*)value;
+- (PBServiceDescriptorProto_Builder *)setMethodArray:(NSArray *)array;
+- (PBServiceDescriptorProto_Builder *)setMethodValues:(const PBMethodDescriptorProto* *)values count:(NSUInteger)count;
+- (PBServiceDescriptorProto_Builder *)clearMethod;
 
 - (BOOL) hasOptions;
 - (PBServiceOptions*) options;
@@ -744,11 +850,8 @@ BOOL PBFieldOptions_CTypeIsValidValue(PBFieldOptions_CType value);
 @end
 
 @interface PBMethodDescriptorProto : PBGeneratedMessage {
-@private
-  BOOL hasName_:1;
-  BOOL hasInputType_:1;
-  BOOL hasOutputType_:1;
-  BOOL hasOptions_:1;
+@package
+  uint32_t hasBits_[1];
   NSString* name;
   NSString* inputType;
   NSString* outputType;
@@ -758,10 +861,10 @@ BOOL PBFieldOptions_CTypeIsValidValue(PBFieldOptions_CType value);
 - (BOOL) hasInputType;
 - (BOOL) hasOutputType;
 - (BOOL) hasOptions;
-@property (readonly, retain) NSString* name;
-@property (readonly, retain) NSString* inputType;
-@property (readonly, retain) NSString* outputType;
-@property (readonly, retain) PBMethodOptions* options;
+@property (nonatomic, readonly, retain) NSString* name;
+@property (nonatomic, readonly, retain) NSString* inputType;
+@property (nonatomic, readonly, retain) NSString* outputType;
+@property (nonatomic, readonly, retain) PBMethodOptions* options;
 
 + (PBMethodDescriptorProto*) defaultInstance;
 - (PBMethodDescriptorProto*) defaultInstance;
@@ -771,6 +874,7 @@ BOOL PBFieldOptions_CTypeIsValidValue(PBFieldOptions_CType value);
 - (PBMethodDescriptorProto_Builder*) builder;
 + (PBMethodDescriptorProto_Builder*) builder;
 + (PBMethodDescriptorProto_Builder*) builderWithPrototype:(PBMethodDescriptorProto*) prototype;
+- (PBMethodDescriptorProto_Builder*) toBuilder;
 
 + (PBMethodDescriptorProto*) parseFromData:(NSData*) data;
 + (PBMethodDescriptorProto*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
@@ -783,15 +887,26 @@ BOOL PBFieldOptions_CTypeIsValidValue(PBFieldOptions_CType value);
 @interface PBMethodDescriptorProto_Builder : PBGeneratedMessage_Builder {
 @private
   PBMethodDescriptorProto* result;
+  PBMethodDescriptorProto* prototype_;
+  PBMethodOptions_Builder* optionsBuilder_;
+  PBMethodOptions_Builder* optionsSpareBuilder_;
 }
 
 - (PBMethodDescriptorProto*) defaultInstance;
 
 - (PBMethodDescriptorProto_Builder*) clear;
 - (PBMethodDescriptorProto_Builder*) clone;
+- (PBMethodDescriptorProto_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (PBMethodDescriptorProto_Builder*) recycle:(PBMethodDescriptorProto*) message;
 
 - (PBMethodDescriptorProto*) build;
 - (PBMethodDescriptorProto*) buildPartial;
+- (PBMethodDescriptorProto*) newBuildPartial;
 
 - (PBMethodDescriptorProto_Builder*) mergeFrom:(PBMethodDescriptorProto*) other;
 - (PBMethodDescriptorProto_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -821,27 +936,36 @@ BOOL PBFieldOptions_CTypeIsValidValue(PBFieldOptions_CType value);
 @end
 
 @interface PBFileOptions : PBExtendableMessage {
-@private
-  BOOL hasJavaMultipleFiles_:1;
-  BOOL hasJavaPackage_:1;
-  BOOL hasJavaOuterClassname_:1;
-  BOOL hasOptimizeFor_:1;
+@package
+  uint32_t hasBits_[1];
   BOOL javaMultipleFiles_:1;
+  BOOL javaGenerateEqualsAndHash_:1;
+  BOOL ccGenericServices_:1;
+  BOOL javaGenericServices_:1;
+  BOOL pyGenericServices_:1;
   NSString* javaPackage;
   NSString* javaOuterClassname;
   PBFileOptions_OptimizeMode optimizeFor;
-  NSMutableArray* mutableUninterpretedOptionList;
+  PBObjectArray * uninterpretedOptionArray;
 }
 - (BOOL) hasJavaPackage;
 - (BOOL) hasJavaOuterClassname;
 - (BOOL) hasJavaMultipleFiles;
+- (BOOL) hasJavaGenerateEqualsAndHash;
 - (BOOL) hasOptimizeFor;
-@property (readonly, retain) NSString* javaPackage;
-@property (readonly, retain) NSString* javaOuterClassname;
+- (BOOL) hasCcGenericServices;
+- (BOOL) hasJavaGenericServices;
+- (BOOL) hasPyGenericServices;
+@property (nonatomic, readonly, retain) NSString* javaPackage;
+@property (nonatomic, readonly, retain) NSString* javaOuterClassname;
 - (BOOL) javaMultipleFiles;
-@property (readonly) PBFileOptions_OptimizeMode optimizeFor;
-- (NSArray*) uninterpretedOptionList;
-- (PBUninterpretedOption*) uninterpretedOptionAtIndex:(int32_t) index;
+- (BOOL) javaGenerateEqualsAndHash;
+@property (nonatomic, readonly) PBFileOptions_OptimizeMode optimizeFor;
+- (BOOL) ccGenericServices;
+- (BOOL) javaGenericServices;
+- (BOOL) pyGenericServices;
+@property (nonatomic, readonly, retain) PBArray * uninterpretedOption;
+- (PBUninterpretedOption*)uninterpretedOptionAtIndex:(NSUInteger)index;
 
 + (PBFileOptions*) defaultInstance;
 - (PBFileOptions*) defaultInstance;
@@ -851,6 +975,7 @@ BOOL PBFieldOptions_CTypeIsValidValue(PBFieldOptions_CType value);
 - (PBFileOptions_Builder*) builder;
 + (PBFileOptions_Builder*) builder;
 + (PBFileOptions_Builder*) builderWithPrototype:(PBFileOptions*) prototype;
+- (PBFileOptions_Builder*) toBuilder;
 
 + (PBFileOptions*) parseFromData:(NSData*) data;
 + (PBFileOptions*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
@@ -863,15 +988,24 @@ BOOL PBFieldOptions_CTypeIsValidValue(PBFieldOptions_CType value);
 @interface PBFileOptions_Builder : PBExtendableMessage_Builder {
 @private
   PBFileOptions* result;
+  PBFileOptions* prototype_;
 }
 
 - (PBFileOptions*) defaultInstance;
 
 - (PBFileOptions_Builder*) clear;
 - (PBFileOptions_Builder*) clone;
+- (PBFileOptions_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (PBFileOptions_Builder*) recycle:(PBFileOptions*) message;
 
 - (PBFileOptions*) build;
 - (PBFileOptions*) buildPartial;
+- (PBFileOptions*) newBuildPartial;
 
 - (PBFileOptions_Builder*) mergeFrom:(PBFileOptions*) other;
 - (PBFileOptions_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -892,33 +1026,52 @@ BOOL PBFieldOptions_CTypeIsValidValue(PBFieldOptions_CType value);
 - (PBFileOptions_Builder*) setJavaMultipleFiles:(BOOL) value;
 - (PBFileOptions_Builder*) clearJavaMultipleFiles;
 
+- (BOOL) hasJavaGenerateEqualsAndHash;
+- (BOOL) javaGenerateEqualsAndHash;
+- (PBFileOptions_Builder*) setJavaGenerateEqualsAndHash:(BOOL) value;
+- (PBFileOptions_Builder*) clearJavaGenerateEqualsAndHash;
+
 - (BOOL) hasOptimizeFor;
 - (PBFileOptions_OptimizeMode) optimizeFor;
 - (PBFileOptions_Builder*) setOptimizeFor:(PBFileOptions_OptimizeMode) value;
 - (PBFileOptions_Builder*) clearOptimizeFor;
 
-- (NSArray*) uninterpretedOptionList;
-- (PBUninterpretedOption*) uninterpretedOptionAtIndex:(int32_t) index;
-- (PBFileOptions_Builder*) replaceUninterpretedOptionAtIndex:(int32_t) index with:(PBUninterpretedOption*) value;
-- (PBFileOptions_Builder*) addUninterpretedOption:(PBUninterpretedOption*) value;
-- (PBFileOptions_Builder*) addAllUninterpretedOption:(NSArray*) values;
-- (PBFileOptions_Builder*) clearUninterpretedOptionList;
+- (BOOL) hasCcGenericServices;
+- (BOOL) ccGenericServices;
+- (PBFileOptions_Builder*) setCcGenericServices:(BOOL) value;
+- (PBFileOptions_Builder*) clearCcGenericServices;
+
+- (BOOL) hasJavaGenericServices;
+- (BOOL) javaGenericServices;
+- (PBFileOptions_Builder*) setJavaGenericServices:(BOOL) value;
+- (PBFileOptions_Builder*) clearJavaGenericServices;
+
+- (BOOL) hasPyGenericServices;
+- (BOOL) pyGenericServices;
+- (PBFileOptions_Builder*) setPyGenericServices:(BOOL) value;
+- (PBFileOptions_Builder*) clearPyGenericServices;
+
+- (PBAppendableArray *)uninterpretedOption;
+- (PBUninterpretedOption*)uninterpretedOptionAtIndex:(NSUInteger)index;
+- (PBFileOptions_Builder *)addUninterpretedOption:(PBUninterpretedOption*)value;
+- (PBFileOptions_Builder *)setUninterpretedOptionArray:(NSArray *)array;
+- (PBFileOptions_Builder *)setUninterpretedOptionValues:(const PBUninterpretedOption* *)values count:(NSUInteger)count;
+- (PBFileOptions_Builder *)clearUninterpretedOption;
 @end
 
 @interface PBMessageOptions : PBExtendableMessage {
-@private
-  BOOL hasMessageSetWireFormat_:1;
-  BOOL hasNoStandardDescriptorAccessor_:1;
+@package
+  uint32_t hasBits_[1];
   BOOL messageSetWireFormat_:1;
   BOOL noStandardDescriptorAccessor_:1;
-  NSMutableArray* mutableUninterpretedOptionList;
+  PBObjectArray * uninterpretedOptionArray;
 }
 - (BOOL) hasMessageSetWireFormat;
 - (BOOL) hasNoStandardDescriptorAccessor;
 - (BOOL) messageSetWireFormat;
 - (BOOL) noStandardDescriptorAccessor;
-- (NSArray*) uninterpretedOptionList;
-- (PBUninterpretedOption*) uninterpretedOptionAtIndex:(int32_t) index;
+@property (nonatomic, readonly, retain) PBArray * uninterpretedOption;
+- (PBUninterpretedOption*)uninterpretedOptionAtIndex:(NSUInteger)index;
 
 + (PBMessageOptions*) defaultInstance;
 - (PBMessageOptions*) defaultInstance;
@@ -928,6 +1081,7 @@ BOOL PBFieldOptions_CTypeIsValidValue(PBFieldOptions_CType value);
 - (PBMessageOptions_Builder*) builder;
 + (PBMessageOptions_Builder*) builder;
 + (PBMessageOptions_Builder*) builderWithPrototype:(PBMessageOptions*) prototype;
+- (PBMessageOptions_Builder*) toBuilder;
 
 + (PBMessageOptions*) parseFromData:(NSData*) data;
 + (PBMessageOptions*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
@@ -940,15 +1094,24 @@ BOOL PBFieldOptions_CTypeIsValidValue(PBFieldOptions_CType value);
 @interface PBMessageOptions_Builder : PBExtendableMessage_Builder {
 @private
   PBMessageOptions* result;
+  PBMessageOptions* prototype_;
 }
 
 - (PBMessageOptions*) defaultInstance;
 
 - (PBMessageOptions_Builder*) clear;
 - (PBMessageOptions_Builder*) clone;
+- (PBMessageOptions_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (PBMessageOptions_Builder*) recycle:(PBMessageOptions*) message;
 
 - (PBMessageOptions*) build;
 - (PBMessageOptions*) buildPartial;
+- (PBMessageOptions*) newBuildPartial;
 
 - (PBMessageOptions_Builder*) mergeFrom:(PBMessageOptions*) other;
 - (PBMessageOptions_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -964,36 +1127,33 @@ BOOL PBFieldOptions_CTypeIsValidValue(PBFieldOptions_CType value);
 - (PBMessageOptions_Builder*) setNoStandardDescriptorAccessor:(BOOL) value;
 - (PBMessageOptions_Builder*) clearNoStandardDescriptorAccessor;
 
-- (NSArray*) uninterpretedOptionList;
-- (PBUninterpretedOption*) uninterpretedOptionAtIndex:(int32_t) index;
-- (PBMessageOptions_Builder*) replaceUninterpretedOptionAtIndex:(int32_t) index with:(PBUninterpretedOption*) value;
-- (PBMessageOptions_Builder*) addUninterpretedOption:(PBUninterpretedOption*) value;
-- (PBMessageOptions_Builder*) addAllUninterpretedOption:(NSArray*) values;
-- (PBMessageOptions_Builder*) clearUninterpretedOptionList;
+- (PBAppendableArray *)uninterpretedOption;
+- (PBUninterpretedOption*)uninterpretedOptionAtIndex:(NSUInteger)index;
+- (PBMessageOptions_Builder *)addUninterpretedOption:(PBUninterpretedOption*)value;
+- (PBMessageOptions_Builder *)setUninterpretedOptionArray:(NSArray *)array;
+- (PBMessageOptions_Builder *)setUninterpretedOptionValues:(const PBUninterpretedOption* *)values count:(NSUInteger)count;
+- (PBMessageOptions_Builder *)clearUninterpretedOption;
 @end
 
 @interface PBFieldOptions : PBExtendableMessage {
-@private
-  BOOL hasPacked_:1;
-  BOOL hasDeprecated_:1;
-  BOOL hasExperimentalMapKey_:1;
-  BOOL hasCtype_:1;
+@package
+  uint32_t hasBits_[1];
   BOOL packed_:1;
   BOOL deprecated_:1;
   NSString* experimentalMapKey;
   PBFieldOptions_CType ctype;
-  NSMutableArray* mutableUninterpretedOptionList;
+  PBObjectArray * uninterpretedOptionArray;
 }
 - (BOOL) hasCtype;
 - (BOOL) hasPacked;
 - (BOOL) hasDeprecated;
 - (BOOL) hasExperimentalMapKey;
-@property (readonly) PBFieldOptions_CType ctype;
+@property (nonatomic, readonly) PBFieldOptions_CType ctype;
 - (BOOL) packed;
 - (BOOL) deprecated;
-@property (readonly, retain) NSString* experimentalMapKey;
-- (NSArray*) uninterpretedOptionList;
-- (PBUninterpretedOption*) uninterpretedOptionAtIndex:(int32_t) index;
+@property (nonatomic, readonly, retain) NSString* experimentalMapKey;
+@property (nonatomic, readonly, retain) PBArray * uninterpretedOption;
+- (PBUninterpretedOption*)uninterpretedOptionAtIndex:(NSUInteger)index;
 
 + (PBFieldOptions*) defaultInstance;
 - (PBFieldOptions*) defaultInstance;
@@ -1003,6 +1163,7 @@ BOOL PBFieldOptions_CTypeIsValidValue(PBFieldOptions_CType value);
 - (PBFieldOptions_Builder*) builder;
 + (PBFieldOptions_Builder*) builder;
 + (PBFieldOptions_Builder*) builderWithPrototype:(PBFieldOptions*) prototype;
+- (PBFieldOptions_Builder*) toBuilder;
 
 + (PBFieldOptions*) parseFromData:(NSData*) data;
 + (PBFieldOptions*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
@@ -1015,15 +1176,24 @@ BOOL PBFieldOptions_CTypeIsValidValue(PBFieldOptions_CType value);
 @interface PBFieldOptions_Builder : PBExtendableMessage_Builder {
 @private
   PBFieldOptions* result;
+  PBFieldOptions* prototype_;
 }
 
 - (PBFieldOptions*) defaultInstance;
 
 - (PBFieldOptions_Builder*) clear;
 - (PBFieldOptions_Builder*) clone;
+- (PBFieldOptions_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (PBFieldOptions_Builder*) recycle:(PBFieldOptions*) message;
 
 - (PBFieldOptions*) build;
 - (PBFieldOptions*) buildPartial;
+- (PBFieldOptions*) newBuildPartial;
 
 - (PBFieldOptions_Builder*) mergeFrom:(PBFieldOptions*) other;
 - (PBFieldOptions_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -1049,20 +1219,21 @@ BOOL PBFieldOptions_CTypeIsValidValue(PBFieldOptions_CType value);
 - (PBFieldOptions_Builder*) setExperimentalMapKey:(NSString*) value;
 - (PBFieldOptions_Builder*) clearExperimentalMapKey;
 
-- (NSArray*) uninterpretedOptionList;
-- (PBUninterpretedOption*) uninterpretedOptionAtIndex:(int32_t) index;
-- (PBFieldOptions_Builder*) replaceUninterpretedOptionAtIndex:(int32_t) index with:(PBUninterpretedOption*) value;
-- (PBFieldOptions_Builder*) addUninterpretedOption:(PBUninterpretedOption*) value;
-- (PBFieldOptions_Builder*) addAllUninterpretedOption:(NSArray*) values;
-- (PBFieldOptions_Builder*) clearUninterpretedOptionList;
+- (PBAppendableArray *)uninterpretedOption;
+- (PBUninterpretedOption*)uninterpretedOptionAtIndex:(NSUInteger)index;
+- (PBFieldOptions_Builder *)addUninterpretedOption:(PBUninterpretedOption*)value;
+- (PBFieldOptions_Builder *)setUninterpretedOptionArray:(NSArray *)array;
+- (PBFieldOptions_Builder *)setUninterpretedOptionValues:(const PBUninterpretedOption* *)values count:(NSUInteger)count;
+- (PBFieldOptions_Builder *)clearUninterpretedOption;
 @end
 
 @interface PBEnumOptions : PBExtendableMessage {
-@private
-  NSMutableArray* mutableUninterpretedOptionList;
+@package
+  uint32_t hasBits_[1];
+  PBObjectArray * uninterpretedOptionArray;
 }
-- (NSArray*) uninterpretedOptionList;
-- (PBUninterpretedOption*) uninterpretedOptionAtIndex:(int32_t) index;
+@property (nonatomic, readonly, retain) PBArray * uninterpretedOption;
+- (PBUninterpretedOption*)uninterpretedOptionAtIndex:(NSUInteger)index;
 
 + (PBEnumOptions*) defaultInstance;
 - (PBEnumOptions*) defaultInstance;
@@ -1072,6 +1243,7 @@ BOOL PBFieldOptions_CTypeIsValidValue(PBFieldOptions_CType value);
 - (PBEnumOptions_Builder*) builder;
 + (PBEnumOptions_Builder*) builder;
 + (PBEnumOptions_Builder*) builderWithPrototype:(PBEnumOptions*) prototype;
+- (PBEnumOptions_Builder*) toBuilder;
 
 + (PBEnumOptions*) parseFromData:(NSData*) data;
 + (PBEnumOptions*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
@@ -1084,34 +1256,44 @@ BOOL PBFieldOptions_CTypeIsValidValue(PBFieldOptions_CType value);
 @interface PBEnumOptions_Builder : PBExtendableMessage_Builder {
 @private
   PBEnumOptions* result;
+  PBEnumOptions* prototype_;
 }
 
 - (PBEnumOptions*) defaultInstance;
 
 - (PBEnumOptions_Builder*) clear;
 - (PBEnumOptions_Builder*) clone;
+- (PBEnumOptions_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (PBEnumOptions_Builder*) recycle:(PBEnumOptions*) message;
 
 - (PBEnumOptions*) build;
 - (PBEnumOptions*) buildPartial;
+- (PBEnumOptions*) newBuildPartial;
 
 - (PBEnumOptions_Builder*) mergeFrom:(PBEnumOptions*) other;
 - (PBEnumOptions_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
 - (PBEnumOptions_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 
-- (NSArray*) uninterpretedOptionList;
-- (PBUninterpretedOption*) uninterpretedOptionAtIndex:(int32_t) index;
-- (PBEnumOptions_Builder*) replaceUninterpretedOptionAtIndex:(int32_t) index with:(PBUninterpretedOption*) value;
-- (PBEnumOptions_Builder*) addUninterpretedOption:(PBUninterpretedOption*) value;
-- (PBEnumOptions_Builder*) addAllUninterpretedOption:(NSArray*) values;
-- (PBEnumOptions_Builder*) clearUninterpretedOptionList;
+- (PBAppendableArray *)uninterpretedOption;
+- (PBUninterpretedOption*)uninterpretedOptionAtIndex:(NSUInteger)index;
+- (PBEnumOptions_Builder *)addUninterpretedOption:(PBUninterpretedOption*)value;
+- (PBEnumOptions_Builder *)setUninterpretedOptionArray:(NSArray *)array;
+- (PBEnumOptions_Builder *)setUninterpretedOptionValues:(const PBUninterpretedOption* *)values count:(NSUInteger)count;
+- (PBEnumOptions_Builder *)clearUninterpretedOption;
 @end
 
 @interface PBEnumValueOptions : PBExtendableMessage {
-@private
-  NSMutableArray* mutableUninterpretedOptionList;
+@package
+  uint32_t hasBits_[1];
+  PBObjectArray * uninterpretedOptionArray;
 }
-- (NSArray*) uninterpretedOptionList;
-- (PBUninterpretedOption*) uninterpretedOptionAtIndex:(int32_t) index;
+@property (nonatomic, readonly, retain) PBArray * uninterpretedOption;
+- (PBUninterpretedOption*)uninterpretedOptionAtIndex:(NSUInteger)index;
 
 + (PBEnumValueOptions*) defaultInstance;
 - (PBEnumValueOptions*) defaultInstance;
@@ -1121,6 +1303,7 @@ BOOL PBFieldOptions_CTypeIsValidValue(PBFieldOptions_CType value);
 - (PBEnumValueOptions_Builder*) builder;
 + (PBEnumValueOptions_Builder*) builder;
 + (PBEnumValueOptions_Builder*) builderWithPrototype:(PBEnumValueOptions*) prototype;
+- (PBEnumValueOptions_Builder*) toBuilder;
 
 + (PBEnumValueOptions*) parseFromData:(NSData*) data;
 + (PBEnumValueOptions*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
@@ -1133,34 +1316,44 @@ BOOL PBFieldOptions_CTypeIsValidValue(PBFieldOptions_CType value);
 @interface PBEnumValueOptions_Builder : PBExtendableMessage_Builder {
 @private
   PBEnumValueOptions* result;
+  PBEnumValueOptions* prototype_;
 }
 
 - (PBEnumValueOptions*) defaultInstance;
 
 - (PBEnumValueOptions_Builder*) clear;
 - (PBEnumValueOptions_Builder*) clone;
+- (PBEnumValueOptions_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (PBEnumValueOptions_Builder*) recycle:(PBEnumValueOptions*) message;
 
 - (PBEnumValueOptions*) build;
 - (PBEnumValueOptions*) buildPartial;
+- (PBEnumValueOptions*) newBuildPartial;
 
 - (PBEnumValueOptions_Builder*) mergeFrom:(PBEnumValueOptions*) other;
 - (PBEnumValueOptions_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
 - (PBEnumValueOptions_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 
-- (NSArray*) uninterpretedOptionList;
-- (PBUninterpretedOption*) uninterpretedOptionAtIndex:(int32_t) index;
-- (PBEnumValueOptions_Builder*) replaceUninterpretedOptionAtIndex:(int32_t) index with:(PBUninterpretedOption*) value;
-- (PBEnumValueOptions_Builder*) addUninterpretedOption:(PBUninterpretedOption*) value;
-- (PBEnumValueOptions_Builder*) addAllUninterpretedOption:(NSArray*) values;
-- (PBEnumValueOptions_Builder*) clearUninterpretedOptionList;
+- (PBAppendableArray *)uninterpretedOption;
+- (PBUninterpretedOption*)uninterpretedOptionAtIndex:(NSUInteger)index;
+- (PBEnumValueOptions_Builder *)addUninterpretedOption:(PBUninterpretedOption*)value;
+- (PBEnumValueOptions_Builder *)setUninterpretedOptionArray:(NSArray *)array;
+- (PBEnumValueOptions_Builder *)setUninterpretedOptionValues:(const PBUninterpretedOption* *)values count:(NSUInteger)count;
+- (PBEnumValueOptions_Builder *)clearUninterpretedOption;
 @end
 
 @interface PBServiceOptions : PBExtendableMessage {
-@private
-  NSMutableArray* mutableUninterpretedOptionList;
+@package
+  uint32_t hasBits_[1];
+  PBObjectArray * uninterpretedOptionArray;
 }
-- (NSArray*) uninterpretedOptionList;
-- (PBUninterpretedOption*) uninterpretedOptionAtIndex:(int32_t) index;
+@property (nonatomic, readonly, retain) PBArray * uninterpretedOption;
+- (PBUninterpretedOption*)uninterpretedOptionAtIndex:(NSUInteger)index;
 
 + (PBServiceOptions*) defaultInstance;
 - (PBServiceOptions*) defaultInstance;
@@ -1170,6 +1363,7 @@ BOOL PBFieldOptions_CTypeIsValidValue(PBFieldOptions_CType value);
 - (PBServiceOptions_Builder*) builder;
 + (PBServiceOptions_Builder*) builder;
 + (PBServiceOptions_Builder*) builderWithPrototype:(PBServiceOptions*) prototype;
+- (PBServiceOptions_Builder*) toBuilder;
 
 + (PBServiceOptions*) parseFromData:(NSData*) data;
 + (PBServiceOptions*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
@@ -1182,34 +1376,44 @@ BOOL PBFieldOptions_CTypeIsValidValue(PBFieldOptions_CType value);
 @interface PBServiceOptions_Builder : PBExtendableMessage_Builder {
 @private
   PBServiceOptions* result;
+  PBServiceOptions* prototype_;
 }
 
 - (PBServiceOptions*) defaultInstance;
 
 - (PBServiceOptions_Builder*) clear;
 - (PBServiceOptions_Builder*) clone;
+- (PBServiceOptions_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (PBServiceOptions_Builder*) recycle:(PBServiceOptions*) message;
 
 - (PBServiceOptions*) build;
 - (PBServiceOptions*) buildPartial;
+- (PBServiceOptions*) newBuildPartial;
 
 - (PBServiceOptions_Builder*) mergeFrom:(PBServiceOptions*) other;
 - (PBServiceOptions_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
 - (PBServiceOptions_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 
-- (NSArray*) uninterpretedOptionList;
-- (PBUninterpretedOption*) uninterpretedOptionAtIndex:(int32_t) index;
-- (PBServiceOptions_Builder*) replaceUninterpretedOptionAtIndex:(int32_t) index with:(PBUninterpretedOption*) value;
-- (PBServiceOptions_Builder*) addUninterpretedOption:(PBUninterpretedOption*) value;
-- (PBServiceOptions_Builder*) addAllUninterpretedOption:(NSArray*) values;
-- (PBServiceOptions_Builder*) clearUninterpretedOptionList;
+- (PBAppendableArray *)uninterpretedOption;
+- (PBUninterpretedOption*)uninterpretedOptionAtIndex:(NSUInteger)index;
+- (PBServiceOptions_Builder *)addUninterpretedOption:(PBUninterpretedOption*)value;
+- (PBServiceOptions_Builder *)setUninterpretedOptionArray:(NSArray *)array;
+- (PBServiceOptions_Builder *)setUninterpretedOptionValues:(const PBUninterpretedOption* *)values count:(NSUInteger)count;
+- (PBServiceOptions_Builder *)clearUninterpretedOption;
 @end
 
 @interface PBMethodOptions : PBExtendableMessage {
-@private
-  NSMutableArray* mutableUninterpretedOptionList;
+@package
+  uint32_t hasBits_[1];
+  PBObjectArray * uninterpretedOptionArray;
 }
-- (NSArray*) uninterpretedOptionList;
-- (PBUninterpretedOption*) uninterpretedOptionAtIndex:(int32_t) index;
+@property (nonatomic, readonly, retain) PBArray * uninterpretedOption;
+- (PBUninterpretedOption*)uninterpretedOptionAtIndex:(NSUInteger)index;
 
 + (PBMethodOptions*) defaultInstance;
 - (PBMethodOptions*) defaultInstance;
@@ -1219,6 +1423,7 @@ BOOL PBFieldOptions_CTypeIsValidValue(PBFieldOptions_CType value);
 - (PBMethodOptions_Builder*) builder;
 + (PBMethodOptions_Builder*) builder;
 + (PBMethodOptions_Builder*) builderWithPrototype:(PBMethodOptions*) prototype;
+- (PBMethodOptions_Builder*) toBuilder;
 
 + (PBMethodOptions*) parseFromData:(NSData*) data;
 + (PBMethodOptions*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
@@ -1231,54 +1436,62 @@ BOOL PBFieldOptions_CTypeIsValidValue(PBFieldOptions_CType value);
 @interface PBMethodOptions_Builder : PBExtendableMessage_Builder {
 @private
   PBMethodOptions* result;
+  PBMethodOptions* prototype_;
 }
 
 - (PBMethodOptions*) defaultInstance;
 
 - (PBMethodOptions_Builder*) clear;
 - (PBMethodOptions_Builder*) clone;
+- (PBMethodOptions_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (PBMethodOptions_Builder*) recycle:(PBMethodOptions*) message;
 
 - (PBMethodOptions*) build;
 - (PBMethodOptions*) buildPartial;
+- (PBMethodOptions*) newBuildPartial;
 
 - (PBMethodOptions_Builder*) mergeFrom:(PBMethodOptions*) other;
 - (PBMethodOptions_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
 - (PBMethodOptions_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 
-- (NSArray*) uninterpretedOptionList;
-- (PBUninterpretedOption*) uninterpretedOptionAtIndex:(int32_t) index;
-- (PBMethodOptions_Builder*) replaceUninterpretedOptionAtIndex:(int32_t) index with:(PBUninterpretedOption*) value;
-- (PBMethodOptions_Builder*) addUninterpretedOption:(PBUninterpretedOption*) value;
-- (PBMethodOptions_Builder*) addAllUninterpretedOption:(NSArray*) values;
-- (PBMethodOptions_Builder*) clearUninterpretedOptionList;
+- (PBAppendableArray *)uninterpretedOption;
+- (PBUninterpretedOption*)uninterpretedOptionAtIndex:(NSUInteger)index;
+- (PBMethodOptions_Builder *)addUninterpretedOption:(PBUninterpretedOption*)value;
+- (PBMethodOptions_Builder *)setUninterpretedOptionArray:(NSArray *)array;
+- (PBMethodOptions_Builder *)setUninterpretedOptionValues:(const PBUninterpretedOption* *)values count:(NSUInteger)count;
+- (PBMethodOptions_Builder *)clearUninterpretedOption;
 @end
 
 @interface PBUninterpretedOption : PBGeneratedMessage {
-@private
-  BOOL hasDoubleValue_:1;
-  BOOL hasNegativeIntValue_:1;
-  BOOL hasPositiveIntValue_:1;
-  BOOL hasIdentifierValue_:1;
-  BOOL hasStringValue_:1;
+@package
+  uint32_t hasBits_[1];
   Float64 doubleValue;
   int64_t negativeIntValue;
-  int64_t positiveIntValue;
+  uint64_t positiveIntValue;
   NSString* identifierValue;
+  NSString* aggregateValue;
   NSData* stringValue;
-  NSMutableArray* mutableNameList;
+  PBObjectArray * nameArray;
 }
 - (BOOL) hasIdentifierValue;
 - (BOOL) hasPositiveIntValue;
 - (BOOL) hasNegativeIntValue;
 - (BOOL) hasDoubleValue;
 - (BOOL) hasStringValue;
-@property (readonly, retain) NSString* identifierValue;
-@property (readonly) int64_t positiveIntValue;
-@property (readonly) int64_t negativeIntValue;
-@property (readonly) Float64 doubleValue;
-@property (readonly, retain) NSData* stringValue;
-- (NSArray*) nameList;
-- (PBUninterpretedOption_NamePart*) nameAtIndex:(int32_t) index;
+- (BOOL) hasAggregateValue;
+@property (nonatomic, readonly, retain) PBArray * name;
+@property (nonatomic, readonly, retain) NSString* identifierValue;
+@property (nonatomic, readonly) uint64_t positiveIntValue;
+@property (nonatomic, readonly) int64_t negativeIntValue;
+@property (nonatomic, readonly) Float64 doubleValue;
+@property (nonatomic, readonly, retain) NSData* stringValue;
+@property (nonatomic, readonly, retain) NSString* aggregateValue;
+- (PBUninterpretedOption_NamePart*)nameAtIndex:(NSUInteger)index;
 
 + (PBUninterpretedOption*) defaultInstance;
 - (PBUninterpretedOption*) defaultInstance;
@@ -1288,6 +1501,7 @@ BOOL PBFieldOptions_CTypeIsValidValue(PBFieldOptions_CType value);
 - (PBUninterpretedOption_Builder*) builder;
 + (PBUninterpretedOption_Builder*) builder;
 + (PBUninterpretedOption_Builder*) builderWithPrototype:(PBUninterpretedOption*) prototype;
+- (PBUninterpretedOption_Builder*) toBuilder;
 
 + (PBUninterpretedOption*) parseFromData:(NSData*) data;
 + (PBUninterpretedOption*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
@@ -1298,15 +1512,14 @@ BOOL PBFieldOptions_CTypeIsValidValue(PBFieldOptions_CType value);
 @end
 
 @interface PBUninterpretedOption_NamePart : PBGeneratedMessage {
-@private
-  BOOL hasIsExtension_:1;
-  BOOL hasNamePart_:1;
+@package
+  uint32_t hasBits_[1];
   BOOL isExtension_:1;
   NSString* namePart;
 }
 - (BOOL) hasNamePart;
 - (BOOL) hasIsExtension;
-@property (readonly, retain) NSString* namePart;
+@property (nonatomic, readonly, retain) NSString* namePart;
 - (BOOL) isExtension;
 
 + (PBUninterpretedOption_NamePart*) defaultInstance;
@@ -1317,6 +1530,7 @@ BOOL PBFieldOptions_CTypeIsValidValue(PBFieldOptions_CType value);
 - (PBUninterpretedOption_NamePart_Builder*) builder;
 + (PBUninterpretedOption_NamePart_Builder*) builder;
 + (PBUninterpretedOption_NamePart_Builder*) builderWithPrototype:(PBUninterpretedOption_NamePart*) prototype;
+- (PBUninterpretedOption_NamePart_Builder*) toBuilder;
 
 + (PBUninterpretedOption_NamePart*) parseFromData:(NSData*) data;
 + (PBUninterpretedOption_NamePart*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
@@ -1329,15 +1543,24 @@ BOOL PBFieldOptions_CTypeIsValidValue(PBFieldOptions_CType value);
 @interface PBUninterpretedOption_NamePart_Builder : PBGeneratedMessage_Builder {
 @private
   PBUninterpretedOption_NamePart* result;
+  PBUninterpretedOption_NamePart* prototype_;
 }
 
 - (PBUninterpretedOption_NamePart*) defaultInstance;
 
 - (PBUninterpretedOption_NamePart_Builder*) clear;
 - (PBUninterpretedOption_NamePart_Builder*) clone;
+- (PBUninterpretedOption_NamePart_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (PBUninterpretedOption_NamePart_Builder*) recycle:(PBUninterpretedOption_NamePart*) message;
 
 - (PBUninterpretedOption_NamePart*) build;
 - (PBUninterpretedOption_NamePart*) buildPartial;
+- (PBUninterpretedOption_NamePart*) newBuildPartial;
 
 - (PBUninterpretedOption_NamePart_Builder*) mergeFrom:(PBUninterpretedOption_NamePart*) other;
 - (PBUninterpretedOption_NamePart_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -1357,26 +1580,35 @@ BOOL PBFieldOptions_CTypeIsValidValue(PBFieldOptions_CType value);
 @interface PBUninterpretedOption_Builder : PBGeneratedMessage_Builder {
 @private
   PBUninterpretedOption* result;
+  PBUninterpretedOption* prototype_;
 }
 
 - (PBUninterpretedOption*) defaultInstance;
 
 - (PBUninterpretedOption_Builder*) clear;
 - (PBUninterpretedOption_Builder*) clone;
+- (PBUninterpretedOption_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (PBUninterpretedOption_Builder*) recycle:(PBUninterpretedOption*) message;
 
 - (PBUninterpretedOption*) build;
 - (PBUninterpretedOption*) buildPartial;
+- (PBUninterpretedOption*) newBuildPartial;
 
 - (PBUninterpretedOption_Builder*) mergeFrom:(PBUninterpretedOption*) other;
 - (PBUninterpretedOption_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
 - (PBUninterpretedOption_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 
-- (NSArray*) nameList;
-- (PBUninterpretedOption_NamePart*) nameAtIndex:(int32_t) index;
-- (PBUninterpretedOption_Builder*) replaceNameAtIndex:(int32_t) index with:(PBUninterpretedOption_NamePart*) value;
-- (PBUninterpretedOption_Builder*) addName:(PBUninterpretedOption_NamePart*) value;
-- (PBUninterpretedOption_Builder*) addAllName:(NSArray*) values;
-- (PBUninterpretedOption_Builder*) clearNameList;
+- (PBAppendableArray *)name;
+- (PBUninterpretedOption_NamePart*)nameAtIndex:(NSUInteger)index;
+- (PBUninterpretedOption_Builder *)addName:(PBUninterpretedOption_NamePart*)value;
+- (PBUninterpretedOption_Builder *)setNameArray:(NSArray *)array;
+- (PBUninterpretedOption_Builder *)setNameValues:(const PBUninterpretedOption_NamePart* *)values count:(NSUInteger)count;
+- (PBUninterpretedOption_Builder *)clearName;
 
 - (BOOL) hasIdentifierValue;
 - (NSString*) identifierValue;
@@ -1384,8 +1616,8 @@ BOOL PBFieldOptions_CTypeIsValidValue(PBFieldOptions_CType value);
 - (PBUninterpretedOption_Builder*) clearIdentifierValue;
 
 - (BOOL) hasPositiveIntValue;
-- (int64_t) positiveIntValue;
-- (PBUninterpretedOption_Builder*) setPositiveIntValue:(int64_t) value;
+- (uint64_t) positiveIntValue;
+- (PBUninterpretedOption_Builder*) setPositiveIntValue:(uint64_t) value;
 - (PBUninterpretedOption_Builder*) clearPositiveIntValue;
 
 - (BOOL) hasNegativeIntValue;
@@ -1402,5 +1634,144 @@ BOOL PBFieldOptions_CTypeIsValidValue(PBFieldOptions_CType value);
 - (NSData*) stringValue;
 - (PBUninterpretedOption_Builder*) setStringValue:(NSData*) value;
 - (PBUninterpretedOption_Builder*) clearStringValue;
+
+- (BOOL) hasAggregateValue;
+- (NSString*) aggregateValue;
+- (PBUninterpretedOption_Builder*) setAggregateValue:(NSString*) value;
+- (PBUninterpretedOption_Builder*) clearAggregateValue;
+@end
+
+@interface PBSourceCodeInfo : PBGeneratedMessage {
+@package
+  uint32_t hasBits_[1];
+  PBObjectArray * locationArray;
+}
+@property (nonatomic, readonly, retain) PBArray * location;
+- (PBSourceCodeInfo_Location*)locationAtIndex:(NSUInteger)index;
+
++ (PBSourceCodeInfo*) defaultInstance;
+- (PBSourceCodeInfo*) defaultInstance;
+
+- (BOOL) isInitialized;
+- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output;
+- (PBSourceCodeInfo_Builder*) builder;
++ (PBSourceCodeInfo_Builder*) builder;
++ (PBSourceCodeInfo_Builder*) builderWithPrototype:(PBSourceCodeInfo*) prototype;
+- (PBSourceCodeInfo_Builder*) toBuilder;
+
++ (PBSourceCodeInfo*) parseFromData:(NSData*) data;
++ (PBSourceCodeInfo*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
++ (PBSourceCodeInfo*) parseFromInputStream:(NSInputStream*) input;
++ (PBSourceCodeInfo*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
++ (PBSourceCodeInfo*) parseFromCodedInputStream:(PBCodedInputStream*) input;
++ (PBSourceCodeInfo*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
+@end
+
+@interface PBSourceCodeInfo_Location : PBGeneratedMessage {
+@package
+  uint32_t hasBits_[1];
+  PBInt32Array * pathArray;
+  int32_t pathMemoizedSerializedSize;
+  PBInt32Array * spanArray;
+  int32_t spanMemoizedSerializedSize;
+}
+@property (nonatomic, readonly, retain) PBArray * path;
+@property (nonatomic, readonly, retain) PBArray * span;
+- (int32_t)pathAtIndex:(NSUInteger)index;
+- (int32_t)spanAtIndex:(NSUInteger)index;
+
++ (PBSourceCodeInfo_Location*) defaultInstance;
+- (PBSourceCodeInfo_Location*) defaultInstance;
+
+- (BOOL) isInitialized;
+- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output;
+- (PBSourceCodeInfo_Location_Builder*) builder;
++ (PBSourceCodeInfo_Location_Builder*) builder;
++ (PBSourceCodeInfo_Location_Builder*) builderWithPrototype:(PBSourceCodeInfo_Location*) prototype;
+- (PBSourceCodeInfo_Location_Builder*) toBuilder;
+
++ (PBSourceCodeInfo_Location*) parseFromData:(NSData*) data;
++ (PBSourceCodeInfo_Location*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
++ (PBSourceCodeInfo_Location*) parseFromInputStream:(NSInputStream*) input;
++ (PBSourceCodeInfo_Location*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
++ (PBSourceCodeInfo_Location*) parseFromCodedInputStream:(PBCodedInputStream*) input;
++ (PBSourceCodeInfo_Location*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
+@end
+
+@interface PBSourceCodeInfo_Location_Builder : PBGeneratedMessage_Builder {
+@private
+  PBSourceCodeInfo_Location* result;
+  PBSourceCodeInfo_Location* prototype_;
+}
+
+- (PBSourceCodeInfo_Location*) defaultInstance;
+
+- (PBSourceCodeInfo_Location_Builder*) clear;
+- (PBSourceCodeInfo_Location_Builder*) clone;
+- (PBSourceCodeInfo_Location_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (PBSourceCodeInfo_Location_Builder*) recycle:(PBSourceCodeInfo_Location*) message;
+
+- (PBSourceCodeInfo_Location*) build;
+- (PBSourceCodeInfo_Location*) buildPartial;
+- (PBSourceCodeInfo_Location*) newBuildPartial;
+
+- (PBSourceCodeInfo_Location_Builder*) mergeFrom:(PBSourceCodeInfo_Location*) other;
+- (PBSourceCodeInfo_Location_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
+- (PBSourceCodeInfo_Location_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
+
+- (PBAppendableArray *)path;
+- (int32_t)pathAtIndex:(NSUInteger)index;
+- (PBSourceCodeInfo_Location_Builder *)addPath:(int32_t)value;
+- (PBSourceCodeInfo_Location_Builder *)setPathArray:(NSArray *)array;
+- (PBSourceCodeInfo_Location_Builder *)setPath:(PBArray *)array;
+- (PBSourceCodeInfo_Location_Builder *)setPathValues:(const int32_t *)values count:(NSUInteger)count;
+- (PBSourceCodeInfo_Location_Builder *)clearPath;
+
+- (PBAppendableArray *)span;
+- (int32_t)spanAtIndex:(NSUInteger)index;
+- (PBSourceCodeInfo_Location_Builder *)addSpan:(int32_t)value;
+- (PBSourceCodeInfo_Location_Builder *)setSpanArray:(NSArray *)array;
+- (PBSourceCodeInfo_Location_Builder *)setSpan:(PBArray *)array;
+- (PBSourceCodeInfo_Location_Builder *)setSpanValues:(const int32_t *)values count:(NSUInteger)count;
+- (PBSourceCodeInfo_Location_Builder *)clearSpan;
+@end
+
+@interface PBSourceCodeInfo_Builder : PBGeneratedMessage_Builder {
+@private
+  PBSourceCodeInfo* result;
+  PBSourceCodeInfo* prototype_;
+}
+
+- (PBSourceCodeInfo*) defaultInstance;
+
+- (PBSourceCodeInfo_Builder*) clear;
+- (PBSourceCodeInfo_Builder*) clone;
+- (PBSourceCodeInfo_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (PBSourceCodeInfo_Builder*) recycle:(PBSourceCodeInfo*) message;
+
+- (PBSourceCodeInfo*) build;
+- (PBSourceCodeInfo*) buildPartial;
+- (PBSourceCodeInfo*) newBuildPartial;
+
+- (PBSourceCodeInfo_Builder*) mergeFrom:(PBSourceCodeInfo*) other;
+- (PBSourceCodeInfo_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
+- (PBSourceCodeInfo_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
+
+- (PBAppendableArray *)location;
+- (PBSourceCodeInfo_Location*)locationAtIndex:(NSUInteger)index;
+- (PBSourceCodeInfo_Builder *)addLocation:(PBSourceCodeInfo_Location*)value;
+- (PBSourceCodeInfo_Builder *)setLocationArray:(NSArray *)array;
+- (PBSourceCodeInfo_Builder *)setLocationValues:(const PBSourceCodeInfo_Location* *)values count:(NSUInteger)count;
+- (PBSourceCodeInfo_Builder *)clearLocation;
 @end
 
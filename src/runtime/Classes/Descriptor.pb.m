@@ -5,14 +5,17 @@
 @implementation PBDescriptorRoot
 static PBExtensionRegistry* extensionRegistry = nil;
 + (PBExtensionRegistry*) extensionRegistry {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    PBMutableExtensionRegistry* registry = [PBMutableExtensionRegistry registry];
+    [PBDescriptorRoot registerAllExtensions:registry];
+    extensionRegistry = [registry retain];
+  });
   return extensionRegistry;
 }
 
 + (void) initialize {
   if (self == [PBDescriptorRoot class]) {
-    PBMutableExtensionRegistry* registry = [PBMutableExtensionRegistry registry];
-    [self registerAllExtensions:registry];
-    extensionRegistry = [registry retain];
   }
 }
 + (void) registerAllExtensions:(PBMutableExtensionRegistry*) registry {
@@ -20,42 +23,54 @@ static PBExtensionRegistry* extensionRegistry = nil;
 @end
 
 @interface PBFileDescriptorSet ()
-@property (retain) NSMutableArray* mutableFileList;
+@property (nonatomic, retain) PBObjectArray * fileArray;
+- (void) setInitialized;
+@end
+
+@interface PBFileDescriptorSet_Builder()
+@property (nonatomic, retain) PBFileDescriptorSet* result;
+- (id) initWithPrototype:(PBFileDescriptorSet*) prototype;
+- (void) detachFromPrototype;
 @end
 
 @implementation PBFileDescriptorSet
 
-@synthesize mutableFileList;
+@synthesize fileArray;
+@dynamic file;
 - (void) dealloc {
-  self.mutableFileList = nil;
+  [fileArray release];
   [super dealloc];
 }
-- (id) init {
-  if ((self = [super init])) {
-  }
-  return self;
+- (void) clearForReuse {
+  [super clearForReuse];
+  memset(hasBits_, 0, sizeof(hasBits_));
+  fileArray = PBAppendableArrayReuse(fileArray);
 }
 static PBFileDescriptorSet* defaultPBFileDescriptorSetInstance = nil;
-+ (void) initialize {
-  if (self == [PBFileDescriptorSet class]) {
-    defaultPBFileDescriptorSetInstance = [[PBFileDescriptorSet alloc] init];
-  }
-}
 + (PBFileDescriptorSet*) defaultInstance {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultPBFileDescriptorSetInstance = [[PBFileDescriptorSet alloc] init];
+  });
   return defaultPBFileDescriptorSetInstance;
 }
 - (PBFileDescriptorSet*) defaultInstance {
-  return defaultPBFileDescriptorSetInstance;
+  return [PBFileDescriptorSet defaultInstance];
 }
-- (NSArray*) fileList {
-  return mutableFileList;
+- (PBArray *)file {
+  return fileArray;
 }
-- (PBFileDescriptorProto*) fileAtIndex:(int32_t) index {
-  id value = [mutableFileList objectAtIndex:index];
-  return value;
+- (PBFileDescriptorProto*)fileAtIndex:(NSUInteger)index {
+  return PBObjectArrayValueAtIndex(fileArray, index);
+}
+- (void) setInitialized {
+  hasBits_[0] |= 0x1u;
 }
 - (BOOL) isInitialized {
-  for (PBFileDescriptorProto* element in self.fileList) {
+  if ((hasBits_[0] & 0x1u) != 0) {
+    return YES;
+  }
+  for (PBFileDescriptorProto* element in fileArray) {
     if (!element.isInitialized) {
       return NO;
     }
@@ -63,24 +78,24 @@ static PBFileDescriptorSet* defaultPBFileDescriptorSetInstance = nil;
   return YES;
 }
 - (void) writeToCodedOutputStream:(PBCodedOutputStream*) output {
-  for (PBFileDescriptorProto* element in self.fileList) {
+  for (PBFileDescriptorProto *element in fileArray) {
     [output writeMessage:1 value:element];
   }
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = PBGeneratedMessageGetMemoizedSize(&memoizedSerializedSize);
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
-  for (PBFileDescriptorProto* element in self.fileList) {
-    size += computeMessageSize(1, element);
+  size_ = 0;
+  for (PBFileDescriptorProto *element in fileArray) {
+    size_ += computeMessageSize(1, element);
   }
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
+  size_ += self.unknownFields.serializedSize;
+  PBGeneratedMessageSetMemoizedSize(&memoizedSerializedSize, size_);
+  return size_;
 }
 + (PBFileDescriptorSet*) parseFromData:(NSData*) data {
   return (PBFileDescriptorSet*)[[[PBFileDescriptorSet builder] mergeFromData:data] build];
@@ -104,60 +119,166 @@ static PBFileDescriptorSet* defaultPBFileDescriptorSetInstance = nil;
   return [[[PBFileDescriptorSet_Builder alloc] init] autorelease];
 }
 + (PBFileDescriptorSet_Builder*) builderWithPrototype:(PBFileDescriptorSet*) prototype {
-  return [[PBFileDescriptorSet builder] mergeFrom:prototype];
+  return [[[PBFileDescriptorSet_Builder alloc] initWithPrototype:prototype] autorelease];
 }
 - (PBFileDescriptorSet_Builder*) builder {
   return [PBFileDescriptorSet builder];
 }
-@end
+- (PBFileDescriptorSet_Builder*) toBuilder {
+  return [PBFileDescriptorSet builderWithPrototype:self];
+}
+- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
+  for (PBFileDescriptorProto* element in fileArray) {
+    [output appendFormat:@"%@%@ {\n", indent, @"file"];
+    [element writeDescriptionTo:output
+                     withIndent:[NSString stringWithFormat:@"%@  ", indent]];
+    [output appendFormat:@"%@}\n", indent];
+  }
+  [self.unknownFields writeDescriptionTo:output withIndent:indent];
+}
+- (BOOL) isEqual:(id)other {
+  if (other == self) {
+    return YES;
+  }
+  if (![other isKindOfClass:[PBFileDescriptorSet class]]) {
+    return NO;
+  }
+  PBFileDescriptorSet *otherMessage = other;
+  return
+      (fileArray.count == 0 ? otherMessage->fileArray.count == 0 : [fileArray isEqualToArray:otherMessage->fileArray]) &&
+      (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
+}
+- (NSUInteger) hash {
+  NSUInteger hash_ = PBGeneratedMessageGetMemoizedHash(&memoizedHash);
+  if (hash_ != 0) {
+    return hash_;
+  }
 
-@interface PBFileDescriptorSet_Builder()
-@property (retain) PBFileDescriptorSet* result;
+  uint64_t hashCode = 7;
+  for (PBFileDescriptorProto* element in fileArray) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [element hash]);
+  }
+  hashCode = PBGeneratedMessageHashMix(hashCode, [self.unknownFields hash]);
+  hash_ = PBGeneratedMessageHashFinish(hashCode);
+  PBGeneratedMessageSetMemoizedHash(&memoizedHash, hash_);
+  return hash_;
+}
 @end
 
 @implementation PBFileDescriptorSet_Builder
 @synthesize result;
 - (void) dealloc {
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
   self.result = nil;
+  [prototype_ release];
   [super dealloc];
 }
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[[PBFileDescriptorSet alloc] init] autorelease];
+    result = [PBFileDescriptorSet recycledInstance];
+  }
+  return self;
+}
+- (id) initWithPrototype:(PBFileDescriptorSet*) prototype {
+  if ((self = [super init])) {
+    self.result = prototype;
+    prototype_ = [prototype retain];
   }
   return self;
 }
+- (void) detachFromPrototype {
+  PBFileDescriptorSet* prototype = prototype_;
+  prototype_ = nil;
+  self.result = [[[PBFileDescriptorSet alloc] init] autorelease];
+  [self mergeFrom:prototype];
+  [prototype release];
+}
+- (PBGeneratedMessage*) internalGetMutableResult {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return [self internalGetResult];
+}
 - (PBGeneratedMessage*) internalGetResult {
   return result;
 }
 - (PBFileDescriptorSet_Builder*) clear {
-  self.result = [[[PBFileDescriptorSet alloc] init] autorelease];
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = [[PBFileDescriptorSet recycledInstance] autorelease];
   return self;
 }
 - (PBFileDescriptorSet_Builder*) clone {
-  return [PBFileDescriptorSet builderWithPrototype:result];
+  if (prototype_ != nil) {
+    return [[[PBFileDescriptorSet_Builder alloc] initWithPrototype:prototype_] autorelease];
+  }
+  return [[PBFileDescriptorSet builder] mergeFrom:result];
+}
+- (PBFileDescriptorSet_Builder*) reset {
+  if (result == nil || prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    self.result = [[PBFileDescriptorSet recycledInstance] autorelease];
+  } else {
+    [result clearForReuse];
+  }
+  return self;
+}
+- (PBFileDescriptorSet_Builder*) recycle:(PBFileDescriptorSet*) message {
+  if (message == [PBFileDescriptorSet defaultInstance]) {
+    @throw [NSException exceptionWithName:@"IllegalArgument" reason:@"Cannot recycle the default instance" userInfo:nil];
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = message;
+  return [self reset];
 }
 - (PBFileDescriptorSet*) defaultInstance {
   return [PBFileDescriptorSet defaultInstance];
 }
 - (PBFileDescriptorSet*) build {
   [self checkInitialized];
-  return [self buildPartial];
+  BOOL shared = prototype_ != nil;
+  PBFileDescriptorSet* returnMe = [self buildPartial];
+  if (!shared) {
+    [returnMe setInitialized];
+  }
+  return returnMe;
 }
 - (PBFileDescriptorSet*) buildPartial {
-  PBFileDescriptorSet* returnMe = [[result retain] autorelease];
-  self.result = nil;
+  return [[self newBuildPartial] autorelease];
+}
+- (PBFileDescriptorSet*) newBuildPartial {
+  if (prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    PBFileDescriptorSet* returnMe = result;
+    result = nil;
+    return returnMe;
+  }
+  [result->fileArray shrinkToFit];
+  PBFileDescriptorSet* returnMe = result;
+  result = nil;
   return returnMe;
 }
 - (PBFileDescriptorSet_Builder*) mergeFrom:(PBFileDescriptorSet*) other {
   if (other == [PBFileDescriptorSet defaultInstance]) {
     return self;
   }
-  if (other.mutableFileList.count > 0) {
-    if (result.mutableFileList == nil) {
-      result.mutableFileList = [NSMutableArray array];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (other->fileArray.count > 0) {
+    if (result->fileArray == nil) {
+      result.fileArray = [[other->fileArray copyWithZone:[other->fileArray zone]] autorelease];
+    } else {
+      [result->fileArray appendArray:other->fileArray];
     }
-    [result.mutableFileList addObjectsFromArray:other.mutableFileList];
   }
   [self mergeUnknownFields:other.unknownFields];
   return self;
@@ -166,259 +287,360 @@ static PBFileDescriptorSet* defaultPBFileDescriptorSetInstance = nil;
   return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
 }
 - (PBFileDescriptorSet_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  PBUnknownFieldSet_Builder* unknownFields = nil;
   while (YES) {
     int32_t tag = [input readTag];
     switch (tag) {
       case 0:
-        [self setUnknownFields:[unknownFields build]];
+        if (unknownFields != nil) {
+          [self setUnknownFields:[unknownFields build]];
+        }
         return self;
       default: {
-        if (![self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag]) {
-          [self setUnknownFields:[unknownFields build]];
+        if (PBWireFormatGetTagWireType(tag) == PBWireFormatEndGroup) {
+          if (unknownFields != nil) {
+            [self setUnknownFields:[unknownFields build]];
+          }
           return self;
         }
+        if (unknownFields == nil) {
+          unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+        }
+        [self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag];
         break;
       }
       case 10: {
-        PBFileDescriptorProto_Builder* subBuilder = [PBFileDescriptorProto builder];
-        [input readMessage:subBuilder extensionRegistry:extensionRegistry];
-        [self addFile:[subBuilder buildPartial]];
+        PBFileDescriptorProto_Builder* subBuilder = [[PBFileDescriptorProto_Builder alloc] init];
+        @try {
+          [input readMessage:subBuilder extensionRegistry:extensionRegistry];
+          PBFileDescriptorProto* value = [subBuilder newBuildPartial];
+          [self addFile:value];
+          [value release];
+        } @finally {
+          [subBuilder release];
+        }
         break;
       }
     }
   }
 }
-- (NSArray*) fileList {
-  if (result.mutableFileList == nil) { return [NSArray array]; }
-  return result.mutableFileList;
+- (PBAppendableArray *)file {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return result->fileArray;
 }
-- (PBFileDescriptorProto*) fileAtIndex:(int32_t) index {
+- (PBFileDescriptorProto*)fileAtIndex:(NSUInteger)index {
   return [result fileAtIndex:index];
 }
-- (PBFileDescriptorSet_Builder*) replaceFileAtIndex:(int32_t) index with:(PBFileDescriptorProto*) value {
-  [result.mutableFileList replaceObjectAtIndex:index withObject:value];
+- (PBFileDescriptorSet_Builder *)addFile:(PBFileDescriptorProto*)value {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (result->fileArray == nil) {
+    result.fileArray = [PBObjectArray array];
+  }
+  PBObjectArrayAddValue(result->fileArray, value);
   return self;
 }
-- (PBFileDescriptorSet_Builder*) addAllFile:(NSArray*) values {
-  if (result.mutableFileList == nil) {
-    result.mutableFileList = [NSMutableArray array];
+- (PBFileDescriptorSet_Builder *)setFileArray:(NSArray *)array {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  [result.mutableFileList addObjectsFromArray:values];
+  result.fileArray = [PBObjectArray arrayWithArray:array valueType:PBArrayValueTypeObject];
   return self;
 }
-- (PBFileDescriptorSet_Builder*) clearFileList {
-  result.mutableFileList = nil;
+- (PBFileDescriptorSet_Builder *)setFileValues:(const PBFileDescriptorProto* *)values count:(NSUInteger)count {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.fileArray = [PBObjectArray arrayWithValues:values count:count valueType:PBArrayValueTypeObject];
   return self;
 }
-- (PBFileDescriptorSet_Builder*) addFile:(PBFileDescriptorProto*) value {
-  if (result.mutableFileList == nil) {
-    result.mutableFileList = [NSMutableArray array];
+- (PBFileDescriptorSet_Builder *)clearFile {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  [result.mutableFileList addObject:value];
+  result.fileArray = nil;
   return self;
 }
 @end
 
 @interface PBFileDescriptorProto ()
-@property (retain) NSString* name;
-@property (retain) NSString* package;
-@property (retain) NSMutableArray* mutableDependencyList;
-@property (retain) NSMutableArray* mutableMessageTypeList;
-@property (retain) NSMutableArray* mutableEnumTypeList;
-@property (retain) NSMutableArray* mutableServiceList;
-@property (retain) NSMutableArray* mutableExtensionList;
-@property (retain) PBFileOptions* options;
+@property (nonatomic, retain) NSString* name;
+@property (nonatomic, retain) NSString* package;
+@property (nonatomic, retain) PBObjectArray * dependencyArray;
+@property (nonatomic, retain) PBObjectArray * messageTypeArray;
+@property (nonatomic, retain) PBObjectArray * enumTypeArray;
+@property (nonatomic, retain) PBObjectArray * serviceArray;
+@property (nonatomic, retain) PBObjectArray * extensionArray;
+@property (nonatomic, retain) PBFileOptions* options;
+@property (nonatomic, retain) PBSourceCodeInfo* sourceCodeInfo;
+- (void) setInitialized;
+@end
+
+@interface PBFileDescriptorProto_Builder()
+@property (nonatomic, retain) PBFileDescriptorProto* result;
+- (id) initWithPrototype:(PBFileDescriptorProto*) prototype;
+- (void) detachFromPrototype;
+- (void) freezeSubBuilders;
+- (void) dropSubBuilders;
+- (void) resetSubBuilders;
 @end
 
 @implementation PBFileDescriptorProto
 
 - (BOOL) hasName {
-  return !!hasName_;
+  return (hasBits_[0] & 0x1u) != 0;
 }
-- (void) setHasName:(BOOL) value {
-  hasName_ = !!value;
+- (void) setHasName:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x1u;
+  } else {
+    hasBits_[0] &= ~0x1u;
+  }
 }
 @synthesize name;
+- (NSString*) name {
+  return (hasBits_[0] & 0x1u) ? name : @"";
+}
 - (BOOL) hasPackage {
-  return !!hasPackage_;
+  return (hasBits_[0] & 0x2u) != 0;
 }
-- (void) setHasPackage:(BOOL) value {
-  hasPackage_ = !!value;
+- (void) setHasPackage:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x2u;
+  } else {
+    hasBits_[0] &= ~0x2u;
+  }
 }
 @synthesize package;
-@synthesize mutableDependencyList;
-@synthesize mutableMessageTypeList;
-@synthesize mutableEnumTypeList;
-@synthesize mutableServiceList;
-@synthesize mutableExtensionList;
+- (NSString*) package {
+  return (hasBits_[0] & 0x2u) ? package : @"";
+}
+@synthesize dependencyArray;
+@dynamic dependency;
+@synthesize messageTypeArray;
+@dynamic messageType;
+@synthesize enumTypeArray;
+@dynamic enumType;
+@synthesize serviceArray;
+@dynamic service;
+@synthesize extensionArray;
+@dynamic extension;
 - (BOOL) hasOptions {
-  return !!hasOptions_;
+  return (hasBits_[0] & 0x4u) != 0;
 }
-- (void) setHasOptions:(BOOL) value {
-  hasOptions_ = !!value;
+- (void) setHasOptions:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x4u;
+  } else {
+    hasBits_[0] &= ~0x4u;
+  }
 }
 @synthesize options;
+- (PBFileOptions*) options {
+  return options != nil ? options : [PBFileOptions defaultInstance];
+}
+- (BOOL) hasSourceCodeInfo {
+  return (hasBits_[0] & 0x8u) != 0;
+}
+- (void) setHasSourceCodeInfo:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x8u;
+  } else {
+    hasBits_[0] &= ~0x8u;
+  }
+}
+@synthesize sourceCodeInfo;
+- (PBSourceCodeInfo*) sourceCodeInfo {
+  return sourceCodeInfo != nil ? sourceCodeInfo : [PBSourceCodeInfo defaultInstance];
+}
 - (void) dealloc {
-  self.name = nil;
-  self.package = nil;
-  self.mutableDependencyList = nil;
-  self.mutableMessageTypeList = nil;
-  self.mutableEnumTypeList = nil;
-  self.mutableServiceList = nil;
-  self.mutableExtensionList = nil;
-  self.options = nil;
+  [name release];
+  [package release];
+  [dependencyArray release];
+  [messageTypeArray release];
+  [enumTypeArray release];
+  [serviceArray release];
+  [extensionArray release];
+  [options release];
+  [sourceCodeInfo release];
   [super dealloc];
 }
-- (id) init {
-  if ((self = [super init])) {
-    self.name = @"";
-    self.package = @"";
-    self.options = [PBFileOptions defaultInstance];
-  }
-  return self;
+- (void) clearForReuse {
+  [super clearForReuse];
+  memset(hasBits_, 0, sizeof(hasBits_));
+  [name release];
+  name = nil;
+  [package release];
+  package = nil;
+  dependencyArray = PBAppendableArrayReuse(dependencyArray);
+  messageTypeArray = PBAppendableArrayReuse(messageTypeArray);
+  enumTypeArray = PBAppendableArrayReuse(enumTypeArray);
+  serviceArray = PBAppendableArrayReuse(serviceArray);
+  extensionArray = PBAppendableArrayReuse(extensionArray);
+  [options release];
+  options = nil;
+  [sourceCodeInfo release];
+  sourceCodeInfo = nil;
 }
 static PBFileDescriptorProto* defaultPBFileDescriptorProtoInstance = nil;
-+ (void) initialize {
-  if (self == [PBFileDescriptorProto class]) {
-    defaultPBFileDescriptorProtoInstance = [[PBFileDescriptorProto alloc] init];
-  }
-}
 + (PBFileDescriptorProto*) defaultInstance {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultPBFileDescriptorProtoInstance = [[PBFileDescriptorProto alloc] init];
+  });
   return defaultPBFileDescriptorProtoInstance;
 }
 - (PBFileDescriptorProto*) defaultInstance {
-  return defaultPBFileDescriptorProtoInstance;
+  return [PBFileDescriptorProto defaultInstance];
+}
+- (PBArray *)dependency {
+  return dependencyArray;
 }
-- (NSArray*) dependencyList {
-  return mutableDependencyList;
+- (NSString*)dependencyAtIndex:(NSUInteger)index {
+  return PBObjectArrayValueAtIndex(dependencyArray, index);
 }
-- (NSString*) dependencyAtIndex:(int32_t) index {
-  id value = [mutableDependencyList objectAtIndex:index];
-  return value;
+- (PBArray *)messageType {
+  return messageTypeArray;
 }
-- (NSArray*) messageTypeList {
-  return mutableMessageTypeList;
+- (PBDescriptorProto*)messageTypeAtIndex:(NSUInteger)index {
+  return PBObjectArrayValueAtIndex(messageTypeArray, index);
 }
-- (PBDescriptorProto*) messageTypeAtIndex:(int32_t) index {
-  id value = [mutableMessageTypeList objectAtIndex:index];
-  return value;
+- (PBArray *)enumType {
+  return enumTypeArray;
 }
-- (NSArray*) enumTypeList {
-  return mutableEnumTypeList;
+- (PBEnumDescriptorProto*)enumTypeAtIndex:(NSUInteger)index {
+  return PBObjectArrayValueAtIndex(enumTypeArray, index);
 }
-- (PBEnumDescriptorProto*) enumTypeAtIndex:(int32_t) index {
-  id value = [mutableEnumTypeList objectAtIndex:index];
-  return value;
+- (PBArray *)service {
+  return serviceArray;
 }
-- (NSArray*) serviceList {
-  return mutableServiceList;
+- (PBServiceDescriptorProto*)serviceAtIndex:(NSUInteger)index {
+  return PBObjectArrayValueAtIndex(serviceArray, index);
 }
-- (PBServiceDescriptorProto*) serviceAtIndex:(int32_t) index {
-  id value = [mutableServiceList objectAtIndex:index];
-  return value;
+- (PBArray *)extension {
+  return extensionArray;
 }
-- (NSArray*) extensionList {
-  return mutableExtensionList;
+- (PBFieldDescriptorProto*)extensionAtIndex:(NSUInteger)index {
+  return PBObjectArrayValueAtIndex(extensionArray, index);
 }
-- (PBFieldDescriptorProto*) extensionAtIndex:(int32_t) index {
-  id value = [mutableExtensionList objectAtIndex:index];
-  return value;
+- (void) setInitialized {
+  hasBits_[0] |= 0x10u;
 }
 - (BOOL) isInitialized {
-  for (PBDescriptorProto* element in self.messageTypeList) {
+  if ((hasBits_[0] & 0x10u) != 0) {
+    return YES;
+  }
+  for (PBDescriptorProto* element in messageTypeArray) {
     if (!element.isInitialized) {
       return NO;
     }
   }
-  for (PBEnumDescriptorProto* element in self.enumTypeList) {
+  for (PBEnumDescriptorProto* element in enumTypeArray) {
     if (!element.isInitialized) {
       return NO;
     }
   }
-  for (PBServiceDescriptorProto* element in self.serviceList) {
+  for (PBServiceDescriptorProto* element in serviceArray) {
     if (!element.isInitialized) {
       return NO;
     }
   }
-  for (PBFieldDescriptorProto* element in self.extensionList) {
+  for (PBFieldDescriptorProto* element in extensionArray) {
     if (!element.isInitialized) {
       return NO;
     }
   }
-  if (self.hasOptions) {
-    if (!self.options.isInitialized) {
+  if ((hasBits_[0] & 0x4u) != 0) {
+    if (!options.isInitialized) {
       return NO;
     }
   }
   return YES;
 }
 - (void) writeToCodedOutputStream:(PBCodedOutputStream*) output {
-  if (self.hasName) {
-    [output writeString:1 value:self.name];
+  if (hasBits_[0] & 0x1u) {
+    [output writeString:1 value:name];
   }
-  if (self.hasPackage) {
-    [output writeString:2 value:self.package];
+  if (hasBits_[0] & 0x2u) {
+    [output writeString:2 value:package];
   }
-  for (NSString* element in self.mutableDependencyList) {
-    [output writeString:3 value:element];
+  const NSUInteger dependencyArrayCount = dependencyArray.count;
+  if (dependencyArrayCount > 0) {
+    const NSString* *values = (const NSString* *)dependencyArray.data;
+    for (NSUInteger i = 0; i < dependencyArrayCount; ++i) {
+      [output writeString:3 value:values[i]];
+    }
   }
-  for (PBDescriptorProto* element in self.messageTypeList) {
+  for (PBDescriptorProto *element in messageTypeArray) {
     [output writeMessage:4 value:element];
   }
-  for (PBEnumDescriptorProto* element in self.enumTypeList) {
+  for (PBEnumDescriptorProto *element in enumTypeArray) {
     [output writeMessage:5 value:element];
   }
-  for (PBServiceDescriptorProto* element in self.serviceList) {
+  for (PBServiceDescriptorProto *element in serviceArray) {
     [output writeMessage:6 value:element];
   }
-  for (PBFieldDescriptorProto* element in self.extensionList) {
+  for (PBFieldDescriptorProto *element in extensionArray) {
     [output writeMessage:7 value:element];
   }
-  if (self.hasOptions) {
-    [output writeMessage:8 value:self.options];
+  if (hasBits_[0] & 0x4u) {
+    [output writeMessage:8 value:options];
+  }
+  if (hasBits_[0] & 0x8u) {
+    [output writeMessage:9 value:sourceCodeInfo];
   }
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = PBGeneratedMessageGetMemoizedSize(&memoizedSerializedSize);
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
-  if (self.hasName) {
-    size += computeStringSize(1, self.name);
+  size_ = 0;
+  if (hasBits_[0] & 0x1u) {
+    size_ += computeStringSize(1, name);
   }
-  if (self.hasPackage) {
-    size += computeStringSize(2, self.package);
+  if (hasBits_[0] & 0x2u) {
+    size_ += computeStringSize(2, package);
   }
   {
     int32_t dataSize = 0;
-    for (NSString* element in self.mutableDependencyList) {
-      dataSize += computeStringSizeNoTag(element);
+    const NSUInteger count = dependencyArray.count;
+    const NSString* *values = (const NSString* *)dependencyArray.data;
+    for (NSUInteger i = 0; i < count; ++i) {
+      dataSize += computeStringSizeNoTag(values[i]);
     }
-    size += dataSize;
-    size += 1 * self.mutableDependencyList.count;
+    size_ += dataSize;
+    size_ += 1 * count;
+  }
+  for (PBDescriptorProto *element in messageTypeArray) {
+    size_ += computeMessageSize(4, element);
   }
-  for (PBDescriptorProto* element in self.messageTypeList) {
-    size += computeMessageSize(4, element);
+  for (PBEnumDescriptorProto *element in enumTypeArray) {
+    size_ += computeMessageSize(5, element);
   }
-  for (PBEnumDescriptorProto* element in self.enumTypeList) {
-    size += computeMessageSize(5, element);
+  for (PBServiceDescriptorProto *element in serviceArray) {
+    size_ += computeMessageSize(6, element);
   }
-  for (PBServiceDescriptorProto* element in self.serviceList) {
-    size += computeMessageSize(6, element);
+  for (PBFieldDescriptorProto *element in extensionArray) {
+    size_ += computeMessageSize(7, element);
   }
-  for (PBFieldDescriptorProto* element in self.extensionList) {
-    size += computeMessageSize(7, element);
+  if (hasBits_[0] & 0x4u) {
+    size_ += computeMessageSize(8, options);
   }
-  if (self.hasOptions) {
-    size += computeMessageSize(8, self.options);
+  if (hasBits_[0] & 0x8u) {
+    size_ += computeMessageSize(9, sourceCodeInfo);
   }
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
+  size_ += self.unknownFields.serializedSize;
+  PBGeneratedMessageSetMemoizedSize(&memoizedSerializedSize, size_);
+  return size_;
 }
 + (PBFileDescriptorProto*) parseFromData:(NSData*) data {
   return (PBFileDescriptorProto*)[[[PBFileDescriptorProto builder] mergeFromData:data] build];
@@ -442,93 +664,329 @@ static PBFileDescriptorProto* defaultPBFileDescriptorProtoInstance = nil;
   return [[[PBFileDescriptorProto_Builder alloc] init] autorelease];
 }
 + (PBFileDescriptorProto_Builder*) builderWithPrototype:(PBFileDescriptorProto*) prototype {
-  return [[PBFileDescriptorProto builder] mergeFrom:prototype];
+  return [[[PBFileDescriptorProto_Builder alloc] initWithPrototype:prototype] autorelease];
 }
 - (PBFileDescriptorProto_Builder*) builder {
   return [PBFileDescriptorProto builder];
 }
-@end
+- (PBFileDescriptorProto_Builder*) toBuilder {
+  return [PBFileDescriptorProto builderWithPrototype:self];
+}
+- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
+  if (hasBits_[0] & 0x1u) {
+    [output appendFormat:@"%@%@: %@\n", indent, @"name", name];
+  }
+  if (hasBits_[0] & 0x2u) {
+    [output appendFormat:@"%@%@: %@\n", indent, @"package", package];
+  }
+  for (NSString* element in dependencyArray) {
+    [output appendFormat:@"%@%@: %@\n", indent, @"dependency", element];
+  }
+  for (PBDescriptorProto* element in messageTypeArray) {
+    [output appendFormat:@"%@%@ {\n", indent, @"messageType"];
+    [element writeDescriptionTo:output
+                     withIndent:[NSString stringWithFormat:@"%@  ", indent]];
+    [output appendFormat:@"%@}\n", indent];
+  }
+  for (PBEnumDescriptorProto* element in enumTypeArray) {
+    [output appendFormat:@"%@%@ {\n", indent, @"enumType"];
+    [element writeDescriptionTo:output
+                     withIndent:[NSString stringWithFormat:@"%@  ", indent]];
+    [output appendFormat:@"%@}\n", indent];
+  }
+  for (PBServiceDescriptorProto* element in serviceArray) {
+    [output appendFormat:@"%@%@ {\n", indent, @"service"];
+    [element writeDescriptionTo:output
+                     withIndent:[NSString stringWithFormat:@"%@  ", indent]];
+    [output appendFormat:@"%@}\n", indent];
+  }
+  for (PBFieldDescriptorProto* element in extensionArray) {
+    [output appendFormat:@"%@%@ {\n", indent, @"extension"];
+    [element writeDescriptionTo:output
+                     withIndent:[NSString stringWithFormat:@"%@  ", indent]];
+    [output appendFormat:@"%@}\n", indent];
+  }
+  if (hasBits_[0] & 0x4u) {
+    [output appendFormat:@"%@%@ {\n", indent, @"options"];
+    [options writeDescriptionTo:output
+                         withIndent:[NSString stringWithFormat:@"%@  ", indent]];
+    [output appendFormat:@"%@}\n", indent];
+  }
+  if (hasBits_[0] & 0x8u) {
+    [output appendFormat:@"%@%@ {\n", indent, @"sourceCodeInfo"];
+    [sourceCodeInfo writeDescriptionTo:output
+                         withIndent:[NSString stringWithFormat:@"%@  ", indent]];
+    [output appendFormat:@"%@}\n", indent];
+  }
+  [self.unknownFields writeDescriptionTo:output withIndent:indent];
+}
+- (BOOL) isEqual:(id)other {
+  if (other == self) {
+    return YES;
+  }
+  if (![other isKindOfClass:[PBFileDescriptorProto class]]) {
+    return NO;
+  }
+  PBFileDescriptorProto *otherMessage = other;
+  return
+      (hasBits_[0] & 0x1u) == (otherMessage->hasBits_[0] & 0x1u) &&
+      (!(hasBits_[0] & 0x1u) || [name isEqual:otherMessage->name]) &&
+      (hasBits_[0] & 0x2u) == (otherMessage->hasBits_[0] & 0x2u) &&
+      (!(hasBits_[0] & 0x2u) || [package isEqual:otherMessage->package]) &&
+      (dependencyArray.count == 0 ? otherMessage->dependencyArray.count == 0 : [dependencyArray isEqualToArray:otherMessage->dependencyArray]) &&
+      (messageTypeArray.count == 0 ? otherMessage->messageTypeArray.count == 0 : [messageTypeArray isEqualToArray:otherMessage->messageTypeArray]) &&
+      (enumTypeArray.count == 0 ? otherMessage->enumTypeArray.count == 0 : [enumTypeArray isEqualToArray:otherMessage->enumTypeArray]) &&
+      (serviceArray.count == 0 ? otherMessage->serviceArray.count == 0 : [serviceArray isEqualToArray:otherMessage->serviceArray]) &&
+      (extensionArray.count == 0 ? otherMessage->extensionArray.count == 0 : [extensionArray isEqualToArray:otherMessage->extensionArray]) &&
+      (hasBits_[0] & 0x4u) == (otherMessage->hasBits_[0] & 0x4u) &&
+      (!(hasBits_[0] & 0x4u) || [options isEqual:otherMessage->options]) &&
+      (hasBits_[0] & 0x8u) == (otherMessage->hasBits_[0] & 0x8u) &&
+      (!(hasBits_[0] & 0x8u) || [sourceCodeInfo isEqual:otherMessage->sourceCodeInfo]) &&
+      (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
+}
+- (NSUInteger) hash {
+  NSUInteger hash_ = PBGeneratedMessageGetMemoizedHash(&memoizedHash);
+  if (hash_ != 0) {
+    return hash_;
+  }
 
-@interface PBFileDescriptorProto_Builder()
-@property (retain) PBFileDescriptorProto* result;
+  uint64_t hashCode = 7;
+  if (hasBits_[0] & 0x1u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [name hash]);
+  }
+  if (hasBits_[0] & 0x2u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [package hash]);
+  }
+  hashCode = PBGeneratedMessageHashMix(hashCode, [dependencyArray hash64]);
+  for (PBDescriptorProto* element in messageTypeArray) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [element hash]);
+  }
+  for (PBEnumDescriptorProto* element in enumTypeArray) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [element hash]);
+  }
+  for (PBServiceDescriptorProto* element in serviceArray) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [element hash]);
+  }
+  for (PBFieldDescriptorProto* element in extensionArray) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [element hash]);
+  }
+  if (hasBits_[0] & 0x4u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [options hash]);
+  }
+  if (hasBits_[0] & 0x8u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [sourceCodeInfo hash]);
+  }
+  hashCode = PBGeneratedMessageHashMix(hashCode, [self.unknownFields hash]);
+  hash_ = PBGeneratedMessageHashFinish(hashCode);
+  PBGeneratedMessageSetMemoizedHash(&memoizedHash, hash_);
+  return hash_;
+}
 @end
 
 @implementation PBFileDescriptorProto_Builder
 @synthesize result;
 - (void) dealloc {
+  [self dropSubBuilders];
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
   self.result = nil;
+  [prototype_ release];
   [super dealloc];
 }
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[[PBFileDescriptorProto alloc] init] autorelease];
+    result = [PBFileDescriptorProto recycledInstance];
+  }
+  return self;
+}
+- (id) initWithPrototype:(PBFileDescriptorProto*) prototype {
+  if ((self = [super init])) {
+    self.result = prototype;
+    prototype_ = [prototype retain];
   }
   return self;
 }
+- (void) detachFromPrototype {
+  PBFileDescriptorProto* prototype = prototype_;
+  prototype_ = nil;
+  self.result = [[[PBFileDescriptorProto alloc] init] autorelease];
+  [self mergeFrom:prototype];
+  [prototype release];
+}
+- (PBGeneratedMessage*) internalGetMutableResult {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return [self internalGetResult];
+}
+- (void) freezeSubBuilders {
+  if (optionsBuilder_ != nil) {
+    PBFileOptions* value = [optionsBuilder_ newBuildPartial];
+    result.options = value;
+    [value release];
+    [optionsBuilder_ release];
+    optionsBuilder_ = nil;
+  }
+  if (sourceCodeInfoBuilder_ != nil) {
+    PBSourceCodeInfo* value = [sourceCodeInfoBuilder_ newBuildPartial];
+    result.sourceCodeInfo = value;
+    [value release];
+    [sourceCodeInfoBuilder_ release];
+    sourceCodeInfoBuilder_ = nil;
+  }
+}
+- (void) dropSubBuilders {
+  [optionsBuilder_ release];
+  optionsBuilder_ = nil;
+  [optionsSpareBuilder_ release];
+  optionsSpareBuilder_ = nil;
+  [sourceCodeInfoBuilder_ release];
+  sourceCodeInfoBuilder_ = nil;
+  [sourceCodeInfoSpareBuilder_ release];
+  sourceCodeInfoSpareBuilder_ = nil;
+}
+- (void) resetSubBuilders {
+  if (optionsBuilder_ != nil) {
+    [optionsBuilder_ reset];
+    [optionsSpareBuilder_ release];
+    optionsSpareBuilder_ = optionsBuilder_;
+    optionsBuilder_ = nil;
+  }
+  if (sourceCodeInfoBuilder_ != nil) {
+    [sourceCodeInfoBuilder_ reset];
+    [sourceCodeInfoSpareBuilder_ release];
+    sourceCodeInfoSpareBuilder_ = sourceCodeInfoBuilder_;
+    sourceCodeInfoBuilder_ = nil;
+  }
+}
 - (PBGeneratedMessage*) internalGetResult {
+  [self freezeSubBuilders];
   return result;
 }
 - (PBFileDescriptorProto_Builder*) clear {
-  self.result = [[[PBFileDescriptorProto alloc] init] autorelease];
+  [self dropSubBuilders];
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = [[PBFileDescriptorProto recycledInstance] autorelease];
   return self;
 }
 - (PBFileDescriptorProto_Builder*) clone {
-  return [PBFileDescriptorProto builderWithPrototype:result];
+  if (prototype_ != nil) {
+    return [[[PBFileDescriptorProto_Builder alloc] initWithPrototype:prototype_] autorelease];
+  }
+  [self freezeSubBuilders];
+  return [[PBFileDescriptorProto builder] mergeFrom:result];
+}
+- (PBFileDescriptorProto_Builder*) reset {
+  [self resetSubBuilders];
+  if (result == nil || prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    self.result = [[PBFileDescriptorProto recycledInstance] autorelease];
+  } else {
+    [result clearForReuse];
+  }
+  return self;
+}
+- (PBFileDescriptorProto_Builder*) recycle:(PBFileDescriptorProto*) message {
+  if (message == [PBFileDescriptorProto defaultInstance]) {
+    @throw [NSException exceptionWithName:@"IllegalArgument" reason:@"Cannot recycle the default instance" userInfo:nil];
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = message;
+  return [self reset];
 }
 - (PBFileDescriptorProto*) defaultInstance {
   return [PBFileDescriptorProto defaultInstance];
 }
 - (PBFileDescriptorProto*) build {
   [self checkInitialized];
-  return [self buildPartial];
+  BOOL shared = prototype_ != nil;
+  PBFileDescriptorProto* returnMe = [self buildPartial];
+  if (!shared) {
+    [returnMe setInitialized];
+  }
+  return returnMe;
 }
 - (PBFileDescriptorProto*) buildPartial {
-  PBFileDescriptorProto* returnMe = [[result retain] autorelease];
-  self.result = nil;
+  return [[self newBuildPartial] autorelease];
+}
+- (PBFileDescriptorProto*) newBuildPartial {
+  if (prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    PBFileDescriptorProto* returnMe = result;
+    result = nil;
+    return returnMe;
+  }
+  [self freezeSubBuilders];
+  [result->dependencyArray shrinkToFit];
+  [result->messageTypeArray shrinkToFit];
+  [result->enumTypeArray shrinkToFit];
+  [result->serviceArray shrinkToFit];
+  [result->extensionArray shrinkToFit];
+  PBFileDescriptorProto* returnMe = result;
+  result = nil;
   return returnMe;
 }
 - (PBFileDescriptorProto_Builder*) mergeFrom:(PBFileDescriptorProto*) other {
   if (other == [PBFileDescriptorProto defaultInstance]) {
     return self;
   }
-  if (other.hasName) {
-    [self setName:other.name];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (other->hasBits_[0] & 0x1u) {
+    [self setName:other->name];
   }
-  if (other.hasPackage) {
-    [self setPackage:other.package];
+  if (other->hasBits_[0] & 0x2u) {
+    [self setPackage:other->package];
   }
-  if (other.mutableDependencyList.count > 0) {
-    if (result.mutableDependencyList == nil) {
-      result.mutableDependencyList = [NSMutableArray array];
+  if (other->dependencyArray.count > 0) {
+    if (result->dependencyArray == nil) {
+      result.dependencyArray = [[other->dependencyArray copyWithZone:[other->dependencyArray zone]] autorelease];
+    } else {
+      [result->dependencyArray appendArray:other->dependencyArray];
     }
-    [result.mutableDependencyList addObjectsFromArray:other.mutableDependencyList];
   }
-  if (other.mutableMessageTypeList.count > 0) {
-    if (result.mutableMessageTypeList == nil) {
-      result.mutableMessageTypeList = [NSMutableArray array];
+  if (other->messageTypeArray.count > 0) {
+    if (result->messageTypeArray == nil) {
+      result.messageTypeArray = [[other->messageTypeArray copyWithZone:[other->messageTypeArray zone]] autorelease];
+    } else {
+      [result->messageTypeArray appendArray:other->messageTypeArray];
     }
-    [result.mutableMessageTypeList addObjectsFromArray:other.mutableMessageTypeList];
   }
-  if (other.mutableEnumTypeList.count > 0) {
-    if (result.mutableEnumTypeList == nil) {
-      result.mutableEnumTypeList = [NSMutableArray array];
+  if (other->enumTypeArray.count > 0) {
+    if (result->enumTypeArray == nil) {
+      result.enumTypeArray = [[other->enumTypeArray copyWithZone:[other->enumTypeArray zone]] autorelease];
+    } else {
+      [result->enumTypeArray appendArray:other->enumTypeArray];
     }
-    [result.mutableEnumTypeList addObjectsFromArray:other.mutableEnumTypeList];
   }
-  if (other.mutableServiceList.count > 0) {
-    if (result.mutableServiceList == nil) {
-      result.mutableServiceList = [NSMutableArray array];
+  if (other->serviceArray.count > 0) {
+    if (result->serviceArray == nil) {
+      result.serviceArray = [[other->serviceArray copyWithZone:[other->serviceArray zone]] autorelease];
+    } else {
+      [result->serviceArray appendArray:other->serviceArray];
     }
-    [result.mutableServiceList addObjectsFromArray:other.mutableServiceList];
   }
-  if (other.mutableExtensionList.count > 0) {
-    if (result.mutableExtensionList == nil) {
-      result.mutableExtensionList = [NSMutableArray array];
+  if (other->extensionArray.count > 0) {
+    if (result->extensionArray == nil) {
+      result.extensionArray = [[other->extensionArray copyWithZone:[other->extensionArray zone]] autorelease];
+    } else {
+      [result->extensionArray appendArray:other->extensionArray];
     }
-    [result.mutableExtensionList addObjectsFromArray:other.mutableExtensionList];
   }
-  if (other.hasOptions) {
-    [self mergeOptions:other.options];
+  if (other->hasBits_[0] & 0x4u) {
+    [self mergeOptions:other->options];
+  }
+  if (other->hasBits_[0] & 0x8u) {
+    [self mergeSourceCodeInfo:other->sourceCodeInfo];
   }
   [self mergeUnknownFields:other.unknownFields];
   return self;
@@ -537,255 +995,391 @@ static PBFileDescriptorProto* defaultPBFileDescriptorProtoInstance = nil;
   return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
 }
 - (PBFileDescriptorProto_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  PBUnknownFieldSet_Builder* unknownFields = nil;
   while (YES) {
     int32_t tag = [input readTag];
     switch (tag) {
       case 0:
-        [self setUnknownFields:[unknownFields build]];
+        if (unknownFields != nil) {
+          [self setUnknownFields:[unknownFields build]];
+        }
         return self;
       default: {
-        if (![self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag]) {
-          [self setUnknownFields:[unknownFields build]];
+        if (PBWireFormatGetTagWireType(tag) == PBWireFormatEndGroup) {
+          if (unknownFields != nil) {
+            [self setUnknownFields:[unknownFields build]];
+          }
           return self;
         }
+        if (unknownFields == nil) {
+          unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+        }
+        [self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag];
         break;
       }
       case 10: {
-        [self setName:[input readString]];
+        NSString* value = [input newString];
+        [self setName:value];
+        [value release];
         break;
       }
       case 18: {
-        [self setPackage:[input readString]];
+        NSString* value = [input newString];
+        [self setPackage:value];
+        [value release];
         break;
       }
       case 26: {
-        [self addDependency:[input readString]];
+        NSString* value = [input newString];
+        [self addDependency:value];
+        [value release];
         break;
       }
       case 34: {
-        PBDescriptorProto_Builder* subBuilder = [PBDescriptorProto builder];
-        [input readMessage:subBuilder extensionRegistry:extensionRegistry];
-        [self addMessageType:[subBuilder buildPartial]];
+        PBDescriptorProto_Builder* subBuilder = [[PBDescriptorProto_Builder alloc] init];
+        @try {
+          [input readMessage:subBuilder extensionRegistry:extensionRegistry];
+          PBDescriptorProto* value = [subBuilder newBuildPartial];
+          [self addMessageType:value];
+          [value release];
+        } @finally {
+          [subBuilder release];
+        }
         break;
       }
       case 42: {
-        PBEnumDescriptorProto_Builder* subBuilder = [PBEnumDescriptorProto builder];
-        [input readMessage:subBuilder extensionRegistry:extensionRegistry];
-        [self addEnumType:[subBuilder buildPartial]];
+        PBEnumDescriptorProto_Builder* subBuilder = [[PBEnumDescriptorProto_Builder alloc] init];
+        @try {
+          [input readMessage:subBuilder extensionRegistry:extensionRegistry];
+          PBEnumDescriptorProto* value = [subBuilder newBuildPartial];
+          [self addEnumType:value];
+          [value release];
+        } @finally {
+          [subBuilder release];
+        }
         break;
       }
       case 50: {
-        PBServiceDescriptorProto_Builder* subBuilder = [PBServiceDescriptorProto builder];
-        [input readMessage:subBuilder extensionRegistry:extensionRegistry];
-        [self addService:[subBuilder buildPartial]];
+        PBServiceDescriptorProto_Builder* subBuilder = [[PBServiceDescriptorProto_Builder alloc] init];
+        @try {
+          [input readMessage:subBuilder extensionRegistry:extensionRegistry];
+          PBServiceDescriptorProto* value = [subBuilder newBuildPartial];
+          [self addService:value];
+          [value release];
+        } @finally {
+          [subBuilder release];
+        }
         break;
       }
       case 58: {
-        PBFieldDescriptorProto_Builder* subBuilder = [PBFieldDescriptorProto builder];
-        [input readMessage:subBuilder extensionRegistry:extensionRegistry];
-        [self addExtension:[subBuilder buildPartial]];
+        PBFieldDescriptorProto_Builder* subBuilder = [[PBFieldDescriptorProto_Builder alloc] init];
+        @try {
+          [input readMessage:subBuilder extensionRegistry:extensionRegistry];
+          PBFieldDescriptorProto* value = [subBuilder newBuildPartial];
+          [self addExtension:value];
+          [value release];
+        } @finally {
+          [subBuilder release];
+        }
         break;
       }
       case 66: {
-        PBFileOptions_Builder* subBuilder = [PBFileOptions builder];
-        if (self.hasOptions) {
-          [subBuilder mergeFrom:self.options];
+        if (optionsBuilder_ == nil) {
+          optionsBuilder_ = optionsSpareBuilder_ != nil ? optionsSpareBuilder_ : [[PBFileOptions_Builder alloc] init];
+          optionsSpareBuilder_ = nil;
+          if (result->hasBits_[0] & 0x4u) {
+            [optionsBuilder_ mergeFrom:result->options];
+          }
+          result->hasBits_[0] |= 0x4u;
+        }
+        [input readMessage:optionsBuilder_ extensionRegistry:extensionRegistry];
+        break;
+      }
+      case 74: {
+        if (sourceCodeInfoBuilder_ == nil) {
+          sourceCodeInfoBuilder_ = sourceCodeInfoSpareBuilder_ != nil ? sourceCodeInfoSpareBuilder_ : [[PBSourceCodeInfo_Builder alloc] init];
+          sourceCodeInfoSpareBuilder_ = nil;
+          if (result->hasBits_[0] & 0x8u) {
+            [sourceCodeInfoBuilder_ mergeFrom:result->sourceCodeInfo];
+          }
+          result->hasBits_[0] |= 0x8u;
         }
-        [input readMessage:subBuilder extensionRegistry:extensionRegistry];
-        [self setOptions:[subBuilder buildPartial]];
+        [input readMessage:sourceCodeInfoBuilder_ extensionRegistry:extensionRegistry];
         break;
       }
     }
   }
 }
 - (BOOL) hasName {
-  return result.hasName;
+  return (result->hasBits_[0] & 0x1u) != 0;
 }
 - (NSString*) name {
-  return result.name;
+  return [result name];
 }
 - (PBFileDescriptorProto_Builder*) setName:(NSString*) value {
-  result.hasName = YES;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x1u;
   result.name = value;
   return self;
 }
 - (PBFileDescriptorProto_Builder*) clearName {
-  result.hasName = NO;
-  result.name = @"";
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x1u;
+  [result->name release];
+  result->name = nil;
   return self;
 }
 - (BOOL) hasPackage {
-  return result.hasPackage;
+  return (result->hasBits_[0] & 0x2u) != 0;
 }
 - (NSString*) package {
-  return result.package;
+  return [result package];
 }
 - (PBFileDescriptorProto_Builder*) setPackage:(NSString*) value {
-  result.hasPackage = YES;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x2u;
   result.package = value;
   return self;
 }
 - (PBFileDescriptorProto_Builder*) clearPackage {
-  result.hasPackage = NO;
-  result.package = @"";
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x2u;
+  [result->package release];
+  result->package = nil;
   return self;
 }
-- (NSArray*) dependencyList {
-  if (result.mutableDependencyList == nil) {
-    return [NSArray array];
+- (PBAppendableArray *)dependency {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  return result.mutableDependencyList;
+  return result->dependencyArray;
 }
-- (NSString*) dependencyAtIndex:(int32_t) index {
+- (NSString*)dependencyAtIndex:(NSUInteger)index {
   return [result dependencyAtIndex:index];
 }
-- (PBFileDescriptorProto_Builder*) replaceDependencyAtIndex:(int32_t) index with:(NSString*) value {
-  [result.mutableDependencyList replaceObjectAtIndex:index withObject:value];
+- (PBFileDescriptorProto_Builder *)addDependency:(NSString*)value {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (result->dependencyArray == nil) {
+    result.dependencyArray = [PBObjectArray array];
+  }
+  PBObjectArrayAddValue(result->dependencyArray, value);
+  return self;
+}
+- (PBFileDescriptorProto_Builder *)setDependencyArray:(NSArray *)array {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.dependencyArray = [PBObjectArray arrayWithArray:array valueType:PBArrayValueTypeObject];
   return self;
 }
-- (PBFileDescriptorProto_Builder*) addDependency:(NSString*) value {
-  if (result.mutableDependencyList == nil) {
-    result.mutableDependencyList = [NSMutableArray array];
+- (PBFileDescriptorProto_Builder *)setDependency:(PBArray *)array {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  [result.mutableDependencyList addObject:value];
+  result.dependencyArray = array ? [PBObjectArray arrayWithStorageOfArray:array] : nil;
   return self;
 }
-- (PBFileDescriptorProto_Builder*) addAllDependency:(NSArray*) values {
-  if (result.mutableDependencyList == nil) {
-    result.mutableDependencyList = [NSMutableArray array];
+- (PBFileDescriptorProto_Builder *)setDependencyValues:(const NSString* *)values count:(NSUInteger)count {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  [result.mutableDependencyList addObjectsFromArray:values];
+  result.dependencyArray = [PBObjectArray arrayWithValues:values count:count valueType:PBArrayValueTypeObject];
   return self;
 }
-- (PBFileDescriptorProto_Builder*) clearDependencyList {
-  result.mutableDependencyList = nil;
+- (PBFileDescriptorProto_Builder *)clearDependency {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.dependencyArray = nil;
   return self;
 }
-- (NSArray*) messageTypeList {
-  if (result.mutableMessageTypeList == nil) { return [NSArray array]; }
-  return result.mutableMessageTypeList;
+- (PBAppendableArray *)messageType {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return result->messageTypeArray;
 }
-- (PBDescriptorProto*) messageTypeAtIndex:(int32_t) index {
+- (PBDescriptorProto*)messageTypeAtIndex:(NSUInteger)index {
   return [result messageTypeAtIndex:index];
 }
-- (PBFileDescriptorProto_Builder*) replaceMessageTypeAtIndex:(int32_t) index with:(PBDescriptorProto*) value {
-  [result.mutableMessageTypeList replaceObjectAtIndex:index withObject:value];
+- (PBFileDescriptorProto_Builder *)addMessageType:(PBDescriptorProto*)value {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (result->messageTypeArray == nil) {
+    result.messageTypeArray = [PBObjectArray array];
+  }
+  PBObjectArrayAddValue(result->messageTypeArray, value);
   return self;
 }
-- (PBFileDescriptorProto_Builder*) addAllMessageType:(NSArray*) values {
-  if (result.mutableMessageTypeList == nil) {
-    result.mutableMessageTypeList = [NSMutableArray array];
+- (PBFileDescriptorProto_Builder *)setMessageTypeArray:(NSArray *)array {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  [result.mutableMessageTypeList addObjectsFromArray:values];
+  result.messageTypeArray = [PBObjectArray arrayWithArray:array valueType:PBArrayValueTypeObject];
   return self;
 }
-- (PBFileDescriptorProto_Builder*) clearMessageTypeList {
-  result.mutableMessageTypeList = nil;
+- (PBFileDescriptorProto_Builder *)setMessageTypeValues:(const PBDescriptorProto* *)values count:(NSUInteger)count {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.messageTypeArray = [PBObjectArray arrayWithValues:values count:count valueType:PBArrayValueTypeObject];
   return self;
 }
-- (PBFileDescriptorProto_Builder*) addMessageType:(PBDescriptorProto*) value {
-  if (result.mutableMessageTypeList == nil) {
-    result.mutableMessageTypeList = [NSMutableArray array];
+- (PBFileDescriptorProto_Builder *)clearMessageType {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  [result.mutableMessageTypeList addObject:value];
+  result.messageTypeArray = nil;
   return self;
 }
-- (NSArray*) enumTypeList {
-  if (result.mutableEnumTypeList == nil) { return [NSArray array]; }
-  return result.mutableEnumTypeList;
+- (PBAppendableArray *)enumType {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return result->enumTypeArray;
 }
-- (PBEnumDescriptorProto*) enumTypeAtIndex:(int32_t) index {
+- (PBEnumDescriptorProto*)enumTypeAtIndex:(NSUInteger)index {
   return [result enumTypeAtIndex:index];
 }
-- (PBFileDescriptorProto_Builder*) replaceEnumTypeAtIndex:(int32_t) index with:(PBEnumDescriptorProto*) value {
-  [result.mutableEnumTypeList replaceObjectAtIndex:index withObject:value];
+- (PBFileDescriptorProto_Builder *)addEnumType:(PBEnumDescriptorProto*)value {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (result->enumTypeArray == nil) {
+    result.enumTypeArray = [PBObjectArray array];
+  }
+  PBObjectArrayAddValue(result->enumTypeArray, value);
   return self;
 }
-- (PBFileDescriptorProto_Builder*) addAllEnumType:(NSArray*) values {
-  if (result.mutableEnumTypeList == nil) {
-    result.mutableEnumTypeList = [NSMutableArray array];
+- (PBFileDescriptorProto_Builder *)setEnumTypeArray:(NSArray *)array {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  [result.mutableEnumTypeList addObjectsFromArray:values];
+  result.enumTypeArray = [PBObjectArray arrayWithArray:array valueType:PBArrayValueTypeObject];
   return self;
 }
-- (PBFileDescriptorProto_Builder*) clearEnumTypeList {
-  result.mutableEnumTypeList = nil;
+- (PBFileDescriptorProto_Builder *)setEnumTypeValues:(const PBEnumDescriptorProto* *)values count:(NSUInteger)count {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.enumTypeArray = [PBObjectArray arrayWithValues:values count:count valueType:PBArrayValueTypeObject];
   return self;
 }
-- (PBFileDescriptorProto_Builder*) addEnumType:(PBEnumDescriptorProto*) value {
-  if (result.mutableEnumTypeList == nil) {
-    result.mutableEnumTypeList = [NSMutableArray array];
+- (PBFileDescriptorProto_Builder *)clearEnumType {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  [result.mutableEnumTypeList addObject:value];
+  result.enumTypeArray = nil;
   return self;
 }
-- (NSArray*) serviceList {
-  if (result.mutableServiceList == nil) { return [NSArray array]; }
-  return result.mutableServiceList;
+- (PBAppendableArray *)service {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return result->serviceArray;
 }
-- (PBServiceDescriptorProto*) serviceAtIndex:(int32_t) index {
+- (PBServiceDescriptorProto*)serviceAtIndex:(NSUInteger)index {
   return [result serviceAtIndex:index];
 }
-- (PBFileDescriptorProto_Builder*) replaceServiceAtIndex:(int32_t) index with:(PBServiceDescriptorProto*) value {
-  [result.mutableServiceList replaceObjectAtIndex:index withObject:value];
+- (PBFileDescriptorProto_Builder *)addService:(PBServiceDescriptorProto*)value {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (result->serviceArray == nil) {
+    result.serviceArray = [PBObjectArray array];
+  }
+  PBObjectArrayAddValue(result->serviceArray, value);
   return self;
 }
-- (PBFileDescriptorProto_Builder*) addAllService:(NSArray*) values {
-  if (result.mutableServiceList == nil) {
-    result.mutableServiceList = [NSMutableArray array];
+- (PBFileDescriptorProto_Builder *)setServiceArray:(NSArray *)array {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  [result.mutableServiceList addObjectsFromArray:values];
+  result.serviceArray = [PBObjectArray arrayWithArray:array valueType:PBArrayValueTypeObject];
   return self;
 }
-- (PBFileDescriptorProto_Builder*) clearServiceList {
-  result.mutableServiceList = nil;
+- (PBFileDescriptorProto_Builder *)setServiceValues:(const PBServiceDescriptorProto* *)values count:(NSUInteger)count {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.serviceArray = [PBObjectArray arrayWithValues:values count:count valueType:PBArrayValueTypeObject];
   return self;
 }
-- (PBFileDescriptorProto_Builder*) addService:(PBServiceDescriptorProto*) value {
-  if (result.mutableServiceList == nil) {
-    result.mutableServiceList = [NSMutableArray array];
+- (PBFileDescriptorProto_Builder *)clearService {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  [result.mutableServiceList addObject:value];
+  result.serviceArray = nil;
   return self;
 }
-- (NSArray*) extensionList {
-  if (result.mutableExtensionList == nil) { return [NSArray array]; }
-  return result.mutableExtensionList;
+- (PBAppendableArray *)extension {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return result->extensionArray;
 }
-- (PBFieldDescriptorProto*) extensionAtIndex:(int32_t) index {
+- (PBFieldDescriptorProto*)extensionAtIndex:(NSUInteger)index {
   return [result extensionAtIndex:index];
 }
-- (PBFileDescriptorProto_Builder*) replaceExtensionAtIndex:(int32_t) index with:(PBFieldDescriptorProto*) value {
-  [result.mutableExtensionList replaceObjectAtIndex:index withObject:value];
+- (PBFileDescriptorProto_Builder *)addExtension:(PBFieldDescriptorProto*)value {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (result->extensionArray == nil) {
+    result.extensionArray = [PBObjectArray array];
+  }
+  PBObjectArrayAddValue(result->extensionArray, value);
   return self;
 }
-- (PBFileDescriptorProto_Builder*) addAllExtension:(NSArray*) values {
-  if (result.mutableExtensionList == nil) {
-    result.mutableExtensionList = [NSMutableArray array];
+- (PBFileDescriptorProto_Builder *)setExtensionArray:(NSArray *)array {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  [result.mutableExtensionList addObjectsFromArray:values];
+  result.extensionArray = [PBObjectArray arrayWithArray:array valueType:PBArrayValueTypeObject];
   return self;
 }
-- (PBFileDescriptorProto_Builder*) clearExtensionList {
-  result.mutableExtensionList = nil;
+- (PBFileDescriptorProto_Builder *)setExtensionValues:(const PBFieldDescriptorProto* *)values count:(NSUInteger)count {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.extensionArray = [PBObjectArray arrayWithValues:values count:count valueType:PBArrayValueTypeObject];
   return self;
 }
-- (PBFileDescriptorProto_Builder*) addExtension:(PBFieldDescriptorProto*) value {
-  if (result.mutableExtensionList == nil) {
-    result.mutableExtensionList = [NSMutableArray array];
+- (PBFileDescriptorProto_Builder *)clearExtension {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  [result.mutableExtensionList addObject:value];
+  result.extensionArray = nil;
   return self;
 }
 - (BOOL) hasOptions {
-  return result.hasOptions;
+  return (result->hasBits_[0] & 0x4u) != 0;
 }
 - (PBFileOptions*) options {
+  [self freezeSubBuilders];
   return result.options;
 }
 - (PBFileDescriptorProto_Builder*) setOptions:(PBFileOptions*) value {
-  result.hasOptions = YES;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  [optionsBuilder_ release];
+  optionsBuilder_ = nil;
+  result->hasBits_[0] |= 0x4u;
   result.options = value;
   return self;
 }
@@ -793,201 +1387,298 @@ static PBFileDescriptorProto* defaultPBFileDescriptorProtoInstance = nil;
   return [self setOptions:[builderForValue build]];
 }
 - (PBFileDescriptorProto_Builder*) mergeOptions:(PBFileOptions*) value {
-  if (result.hasOptions &&
-      result.options != [PBFileOptions defaultInstance]) {
-    result.options =
-      [[[PBFileOptions builderWithPrototype:result.options] mergeFrom:value] buildPartial];
-  } else {
-    result.options = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (optionsBuilder_ == nil) {
+    if (!(result->hasBits_[0] & 0x4u) ||
+        result->options == [PBFileOptions defaultInstance]) {
+      result->hasBits_[0] |= 0x4u;
+      result.options = value;
+      return self;
+    }
+    optionsBuilder_ = optionsSpareBuilder_ != nil ? optionsSpareBuilder_ : [[PBFileOptions_Builder alloc] init];
+    optionsSpareBuilder_ = nil;
+    [optionsBuilder_ mergeFrom:result->options];
   }
-  result.hasOptions = YES;
+  [optionsBuilder_ mergeFrom:value];
   return self;
 }
 - (PBFileDescriptorProto_Builder*) clearOptions {
-  result.hasOptions = NO;
-  result.options = [PBFileOptions defaultInstance];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  [optionsBuilder_ release];
+  optionsBuilder_ = nil;
+  result->hasBits_[0] &= ~0x4u;
+  [result->options release];
+  result->options = nil;
+  return self;
+}
+- (BOOL) hasSourceCodeInfo {
+  return (result->hasBits_[0] & 0x8u) != 0;
+}
+- (PBSourceCodeInfo*) sourceCodeInfo {
+  [self freezeSubBuilders];
+  return result.sourceCodeInfo;
+}
+- (PBFileDescriptorProto_Builder*) setSourceCodeInfo:(PBSourceCodeInfo*) value {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  [sourceCodeInfoBuilder_ release];
+  sourceCodeInfoBuilder_ = nil;
+  result->hasBits_[0] |= 0x8u;
+  result.sourceCodeInfo = value;
+  return self;
+}
+- (PBFileDescriptorProto_Builder*) setSourceCodeInfoBuilder:(PBSourceCodeInfo_Builder*) builderForValue {
+  return [self setSourceCodeInfo:[builderForValue build]];
+}
+- (PBFileDescriptorProto_Builder*) mergeSourceCodeInfo:(PBSourceCodeInfo*) value {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (sourceCodeInfoBuilder_ == nil) {
+    if (!(result->hasBits_[0] & 0x8u) ||
+        result->sourceCodeInfo == [PBSourceCodeInfo defaultInstance]) {
+      result->hasBits_[0] |= 0x8u;
+      result.sourceCodeInfo = value;
+      return self;
+    }
+    sourceCodeInfoBuilder_ = sourceCodeInfoSpareBuilder_ != nil ? sourceCodeInfoSpareBuilder_ : [[PBSourceCodeInfo_Builder alloc] init];
+    sourceCodeInfoSpareBuilder_ = nil;
+    [sourceCodeInfoBuilder_ mergeFrom:result->sourceCodeInfo];
+  }
+  [sourceCodeInfoBuilder_ mergeFrom:value];
+  return self;
+}
+- (PBFileDescriptorProto_Builder*) clearSourceCodeInfo {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  [sourceCodeInfoBuilder_ release];
+  sourceCodeInfoBuilder_ = nil;
+  result->hasBits_[0] &= ~0x8u;
+  [result->sourceCodeInfo release];
+  result->sourceCodeInfo = nil;
   return self;
 }
 @end
 
 @interface PBDescriptorProto ()
-@property (retain) NSString* name;
-@property (retain) NSMutableArray* mutableFieldList;
-@property (retain) NSMutableArray* mutableExtensionList;
-@property (retain) NSMutableArray* mutableNestedTypeList;
-@property (retain) NSMutableArray* mutableEnumTypeList;
-@property (retain) NSMutableArray* mutableExtensionRangeList;
-@property (retain) PBMessageOptions* options;
+@property (nonatomic, retain) NSString* name;
+@property (nonatomic, retain) PBObjectArray * fieldArray;
+@property (nonatomic, retain) PBObjectArray * extensionArray;
+@property (nonatomic, retain) PBObjectArray * nestedTypeArray;
+@property (nonatomic, retain) PBObjectArray * enumTypeArray;
+@property (nonatomic, retain) PBObjectArray * extensionRangeArray;
+@property (nonatomic, retain) PBMessageOptions* options;
+- (void) setInitialized;
+@end
+
+@interface PBDescriptorProto_Builder()
+@property (nonatomic, retain) PBDescriptorProto* result;
+- (id) initWithPrototype:(PBDescriptorProto*) prototype;
+- (void) detachFromPrototype;
+- (void) freezeSubBuilders;
+- (void) dropSubBuilders;
+- (void) resetSubBuilders;
 @end
 
 @implementation PBDescriptorProto
 
 - (BOOL) hasName {
-  return !!hasName_;
+  return (hasBits_[0] & 0x1u) != 0;
 }
-- (void) setHasName:(BOOL) value {
-  hasName_ = !!value;
+- (void) setHasName:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x1u;
+  } else {
+    hasBits_[0] &= ~0x1u;
+  }
 }
 @synthesize name;
-@synthesize mutableFieldList;
-@synthesize mutableExtensionList;
-@synthesize mutableNestedTypeList;
-@synthesize mutableEnumTypeList;
-@synthesize mutableExtensionRangeList;
+- (NSString*) name {
+  return (hasBits_[0] & 0x1u) ? name : @"";
+}
+@synthesize fieldArray;
+@dynamic field;
+@synthesize extensionArray;
+@dynamic extension;
+@synthesize nestedTypeArray;
+@dynamic nestedType;
+@synthesize enumTypeArray;
+@dynamic enumType;
+@synthesize extensionRangeArray;
+@dynamic extensionRange;
 - (BOOL) hasOptions {
-  return !!hasOptions_;
+  return (hasBits_[0] & 0x2u) != 0;
 }
-- (void) setHasOptions:(BOOL) value {
-  hasOptions_ = !!value;
+- (void) setHasOptions:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x2u;
+  } else {
+    hasBits_[0] &= ~0x2u;
+  }
 }
 @synthesize options;
+- (PBMessageOptions*) options {
+  return options != nil ? options : [PBMessageOptions defaultInstance];
+}
 - (void) dealloc {
-  self.name = nil;
-  self.mutableFieldList = nil;
-  self.mutableExtensionList = nil;
-  self.mutableNestedTypeList = nil;
-  self.mutableEnumTypeList = nil;
-  self.mutableExtensionRangeList = nil;
-  self.options = nil;
+  [name release];
+  [fieldArray release];
+  [extensionArray release];
+  [nestedTypeArray release];
+  [enumTypeArray release];
+  [extensionRangeArray release];
+  [options release];
   [super dealloc];
 }
-- (id) init {
-  if ((self = [super init])) {
-    self.name = @"";
-    self.options = [PBMessageOptions defaultInstance];
-  }
-  return self;
+- (void) clearForReuse {
+  [super clearForReuse];
+  memset(hasBits_, 0, sizeof(hasBits_));
+  [name release];
+  name = nil;
+  fieldArray = PBAppendableArrayReuse(fieldArray);
+  extensionArray = PBAppendableArrayReuse(extensionArray);
+  nestedTypeArray = PBAppendableArrayReuse(nestedTypeArray);
+  enumTypeArray = PBAppendableArrayReuse(enumTypeArray);
+  extensionRangeArray = PBAppendableArrayReuse(extensionRangeArray);
+  [options release];
+  options = nil;
 }
 static PBDescriptorProto* defaultPBDescriptorProtoInstance = nil;
-+ (void) initialize {
-  if (self == [PBDescriptorProto class]) {
-    defaultPBDescriptorProtoInstance = [[PBDescriptorProto alloc] init];
-  }
-}
 + (PBDescriptorProto*) defaultInstance {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultPBDescriptorProtoInstance = [[PBDescriptorProto alloc] init];
+  });
   return defaultPBDescriptorProtoInstance;
 }
 - (PBDescriptorProto*) defaultInstance {
-  return defaultPBDescriptorProtoInstance;
+  return [PBDescriptorProto defaultInstance];
 }
-- (NSArray*) fieldList {
-  return mutableFieldList;
+- (PBArray *)field {
+  return fieldArray;
 }
-- (PBFieldDescriptorProto*) fieldAtIndex:(int32_t) index {
-  id value = [mutableFieldList objectAtIndex:index];
-  return value;
+- (PBFieldDescriptorProto*)fieldAtIndex:(NSUInteger)index {
+  return PBObjectArrayValueAtIndex(fieldArray, index);
 }
-- (NSArray*) extensionList {
-  return mutableExtensionList;
+- (PBArray *)extension {
+  return extensionArray;
 }
-- (PBFieldDescriptorProto*) extensionAtIndex:(int32_t) index {
-  id value = [mutableExtensionList objectAtIndex:index];
-  return value;
+- (PBFieldDescriptorProto*)extensionAtIndex:(NSUInteger)index {
+  return PBObjectArrayValueAtIndex(extensionArray, index);
 }
-- (NSArray*) nestedTypeList {
-  return mutableNestedTypeList;
+- (PBArray *)nestedType {
+  return nestedTypeArray;
 }
-- (PBDescriptorProto*) nestedTypeAtIndex:(int32_t) index {
-  id value = [mutableNestedTypeList objectAtIndex:index];
-  return value;
+- (PBDescriptorProto*)nestedTypeAtIndex:(NSUInteger)index {
+  return PBObjectArrayValueAtIndex(nestedTypeArray, index);
 }
-- (NSArray*) enumTypeList {
-  return mutableEnumTypeList;
+- (PBArray *)enumType {
+  return enumTypeArray;
 }
-- (PBEnumDescriptorProto*) enumTypeAtIndex:(int32_t) index {
-  id value = [mutableEnumTypeList objectAtIndex:index];
-  return value;
+- (PBEnumDescriptorProto*)enumTypeAtIndex:(NSUInteger)index {
+  return PBObjectArrayValueAtIndex(enumTypeArray, index);
 }
-- (NSArray*) extensionRangeList {
-  return mutableExtensionRangeList;
+- (PBArray *)extensionRange {
+  return extensionRangeArray;
 }
-- (PBDescriptorProto_ExtensionRange*) extensionRangeAtIndex:(int32_t) index {
-  id value = [mutableExtensionRangeList objectAtIndex:index];
-  return value;
+- (PBDescriptorProto_ExtensionRange*)extensionRangeAtIndex:(NSUInteger)index {
+  return PBObjectArrayValueAtIndex(extensionRangeArray, index);
+}
+- (void) setInitialized {
+  hasBits_[0] |= 0x4u;
 }
 - (BOOL) isInitialized {
-  for (PBFieldDescriptorProto* element in self.fieldList) {
+  if ((hasBits_[0] & 0x4u) != 0) {
+    return YES;
+  }
+  for (PBFieldDescriptorProto* element in fieldArray) {
     if (!element.isInitialized) {
       return NO;
     }
   }
-  for (PBFieldDescriptorProto* element in self.extensionList) {
+  for (PBFieldDescriptorProto* element in extensionArray) {
     if (!element.isInitialized) {
       return NO;
     }
   }
-  for (PBDescriptorProto* element in self.nestedTypeList) {
+  for (PBDescriptorProto* element in nestedTypeArray) {
     if (!element.isInitialized) {
       return NO;
     }
   }
-  for (PBEnumDescriptorProto* element in self.enumTypeList) {
+  for (PBEnumDescriptorProto* element in enumTypeArray) {
     if (!element.isInitialized) {
       return NO;
     }
   }
-  if (self.hasOptions) {
-    if (!self.options.isInitialized) {
+  if ((hasBits_[0] & 0x2u) != 0) {
+    if (!options.isInitialized) {
       return NO;
     }
   }
   return YES;
 }
 - (void) writeToCodedOutputStream:(PBCodedOutputStream*) output {
-  if (self.hasName) {
-    [output writeString:1 value:self.name];
+  if (hasBits_[0] & 0x1u) {
+    [output writeString:1 value:name];
   }
-  for (PBFieldDescriptorProto* element in self.fieldList) {
+  for (PBFieldDescriptorProto *element in fieldArray) {
     [output writeMessage:2 value:element];
   }
-  for (PBDescriptorProto* element in self.nestedTypeList) {
+  for (PBDescriptorProto *element in nestedTypeArray) {
     [output writeMessage:3 value:element];
   }
-  for (PBEnumDescriptorProto* element in self.enumTypeList) {
+  for (PBEnumDescriptorProto *element in enumTypeArray) {
     [output writeMessage:4 value:element];
   }
-  for (PBDescriptorProto_ExtensionRange* element in self.extensionRangeList) {
+  for (PBDescriptorProto_ExtensionRange *element in extensionRangeArray) {
     [output writeMessage:5 value:element];
   }
-  for (PBFieldDescriptorProto* element in self.extensionList) {
+  for (PBFieldDescriptorProto *element in extensionArray) {
     [output writeMessage:6 value:element];
   }
-  if (self.hasOptions) {
-    [output writeMessage:7 value:self.options];
+  if (hasBits_[0] & 0x2u) {
+    [output writeMessage:7 value:options];
   }
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = PBGeneratedMessageGetMemoizedSize(&memoizedSerializedSize);
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
-  if (self.hasName) {
-    size += computeStringSize(1, self.name);
+  size_ = 0;
+  if (hasBits_[0] & 0x1u) {
+    size_ += computeStringSize(1, name);
   }
-  for (PBFieldDescriptorProto* element in self.fieldList) {
-    size += computeMessageSize(2, element);
+  for (PBFieldDescriptorProto *element in fieldArray) {
+    size_ += computeMessageSize(2, element);
   }
-  for (PBDescriptorProto* element in self.nestedTypeList) {
-    size += computeMessageSize(3, element);
+  for (PBDescriptorProto *element in nestedTypeArray) {
+    size_ += computeMessageSize(3, element);
   }
-  for (PBEnumDescriptorProto* element in self.enumTypeList) {
-    size += computeMessageSize(4, element);
+  for (PBEnumDescriptorProto *element in enumTypeArray) {
+    size_ += computeMessageSize(4, element);
   }
-  for (PBDescriptorProto_ExtensionRange* element in self.extensionRangeList) {
-    size += computeMessageSize(5, element);
+  for (PBDescriptorProto_ExtensionRange *element in extensionRangeArray) {
+    size_ += computeMessageSize(5, element);
   }
-  for (PBFieldDescriptorProto* element in self.extensionList) {
-    size += computeMessageSize(6, element);
+  for (PBFieldDescriptorProto *element in extensionArray) {
+    size_ += computeMessageSize(6, element);
   }
-  if (self.hasOptions) {
-    size += computeMessageSize(7, self.options);
+  if (hasBits_[0] & 0x2u) {
+    size_ += computeMessageSize(7, options);
   }
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
+  size_ += self.unknownFields.serializedSize;
+  PBGeneratedMessageSetMemoizedSize(&memoizedSerializedSize, size_);
+  return size_;
 }
 + (PBDescriptorProto*) parseFromData:(NSData*) data {
   return (PBDescriptorProto*)[[[PBDescriptorProto builder] mergeFromData:data] build];
@@ -1011,84 +1702,194 @@ static PBDescriptorProto* defaultPBDescriptorProtoInstance = nil;
   return [[[PBDescriptorProto_Builder alloc] init] autorelease];
 }
 + (PBDescriptorProto_Builder*) builderWithPrototype:(PBDescriptorProto*) prototype {
-  return [[PBDescriptorProto builder] mergeFrom:prototype];
+  return [[[PBDescriptorProto_Builder alloc] initWithPrototype:prototype] autorelease];
 }
 - (PBDescriptorProto_Builder*) builder {
   return [PBDescriptorProto builder];
 }
+- (PBDescriptorProto_Builder*) toBuilder {
+  return [PBDescriptorProto builderWithPrototype:self];
+}
+- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
+  if (hasBits_[0] & 0x1u) {
+    [output appendFormat:@"%@%@: %@\n", indent, @"name", name];
+  }
+  for (PBFieldDescriptorProto* element in fieldArray) {
+    [output appendFormat:@"%@%@ {\n", indent, @"field"];
+    [element writeDescriptionTo:output
+                     withIndent:[NSString stringWithFormat:@"%@  ", indent]];
+    [output appendFormat:@"%@}\n", indent];
+  }
+  for (PBDescriptorProto* element in nestedTypeArray) {
+    [output appendFormat:@"%@%@ {\n", indent, @"nestedType"];
+    [element writeDescriptionTo:output
+                     withIndent:[NSString stringWithFormat:@"%@  ", indent]];
+    [output appendFormat:@"%@}\n", indent];
+  }
+  for (PBEnumDescriptorProto* element in enumTypeArray) {
+    [output appendFormat:@"%@%@ {\n", indent, @"enumType"];
+    [element writeDescriptionTo:output
+                     withIndent:[NSString stringWithFormat:@"%@  ", indent]];
+    [output appendFormat:@"%@}\n", indent];
+  }
+  for (PBDescriptorProto_ExtensionRange* element in extensionRangeArray) {
+    [output appendFormat:@"%@%@ {\n", indent, @"extensionRange"];
+    [element writeDescriptionTo:output
+                     withIndent:[NSString stringWithFormat:@"%@  ", indent]];
+    [output appendFormat:@"%@}\n", indent];
+  }
+  for (PBFieldDescriptorProto* element in extensionArray) {
+    [output appendFormat:@"%@%@ {\n", indent, @"extension"];
+    [element writeDescriptionTo:output
+                     withIndent:[NSString stringWithFormat:@"%@  ", indent]];
+    [output appendFormat:@"%@}\n", indent];
+  }
+  if (hasBits_[0] & 0x2u) {
+    [output appendFormat:@"%@%@ {\n", indent, @"options"];
+    [options writeDescriptionTo:output
+                         withIndent:[NSString stringWithFormat:@"%@  ", indent]];
+    [output appendFormat:@"%@}\n", indent];
+  }
+  [self.unknownFields writeDescriptionTo:output withIndent:indent];
+}
+- (BOOL) isEqual:(id)other {
+  if (other == self) {
+    return YES;
+  }
+  if (![other isKindOfClass:[PBDescriptorProto class]]) {
+    return NO;
+  }
+  PBDescriptorProto *otherMessage = other;
+  return
+      (hasBits_[0] & 0x1u) == (otherMessage->hasBits_[0] & 0x1u) &&
+      (!(hasBits_[0] & 0x1u) || [name isEqual:otherMessage->name]) &&
+      (fieldArray.count == 0 ? otherMessage->fieldArray.count == 0 : [fieldArray isEqualToArray:otherMessage->fieldArray]) &&
+      (nestedTypeArray.count == 0 ? otherMessage->nestedTypeArray.count == 0 : [nestedTypeArray isEqualToArray:otherMessage->nestedTypeArray]) &&
+      (enumTypeArray.count == 0 ? otherMessage->enumTypeArray.count == 0 : [enumTypeArray isEqualToArray:otherMessage->enumTypeArray]) &&
+      (extensionRangeArray.count == 0 ? otherMessage->extensionRangeArray.count == 0 : [extensionRangeArray isEqualToArray:otherMessage->extensionRangeArray]) &&
+      (extensionArray.count == 0 ? otherMessage->extensionArray.count == 0 : [extensionArray isEqualToArray:otherMessage->extensionArray]) &&
+      (hasBits_[0] & 0x2u) == (otherMessage->hasBits_[0] & 0x2u) &&
+      (!(hasBits_[0] & 0x2u) || [options isEqual:otherMessage->options]) &&
+      (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
+}
+- (NSUInteger) hash {
+  NSUInteger hash_ = PBGeneratedMessageGetMemoizedHash(&memoizedHash);
+  if (hash_ != 0) {
+    return hash_;
+  }
+
+  uint64_t hashCode = 7;
+  if (hasBits_[0] & 0x1u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [name hash]);
+  }
+  for (PBFieldDescriptorProto* element in fieldArray) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [element hash]);
+  }
+  for (PBDescriptorProto* element in nestedTypeArray) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [element hash]);
+  }
+  for (PBEnumDescriptorProto* element in enumTypeArray) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [element hash]);
+  }
+  for (PBDescriptorProto_ExtensionRange* element in extensionRangeArray) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [element hash]);
+  }
+  for (PBFieldDescriptorProto* element in extensionArray) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [element hash]);
+  }
+  if (hasBits_[0] & 0x2u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [options hash]);
+  }
+  hashCode = PBGeneratedMessageHashMix(hashCode, [self.unknownFields hash]);
+  hash_ = PBGeneratedMessageHashFinish(hashCode);
+  PBGeneratedMessageSetMemoizedHash(&memoizedHash, hash_);
+  return hash_;
+}
 @end
 
 @interface PBDescriptorProto_ExtensionRange ()
-@property int32_t start;
-@property int32_t end;
+@property (nonatomic) int32_t start;
+@property (nonatomic) int32_t end;
+@end
+
+@interface PBDescriptorProto_ExtensionRange_Builder()
+@property (nonatomic, retain) PBDescriptorProto_ExtensionRange* result;
+- (id) initWithPrototype:(PBDescriptorProto_ExtensionRange*) prototype;
+- (void) detachFromPrototype;
 @end
 
 @implementation PBDescriptorProto_ExtensionRange
 
 - (BOOL) hasStart {
-  return !!hasStart_;
+  return (hasBits_[0] & 0x1u) != 0;
 }
-- (void) setHasStart:(BOOL) value {
-  hasStart_ = !!value;
+- (void) setHasStart:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x1u;
+  } else {
+    hasBits_[0] &= ~0x1u;
+  }
 }
 @synthesize start;
 - (BOOL) hasEnd {
-  return !!hasEnd_;
+  return (hasBits_[0] & 0x2u) != 0;
 }
-- (void) setHasEnd:(BOOL) value {
-  hasEnd_ = !!value;
+- (void) setHasEnd:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x2u;
+  } else {
+    hasBits_[0] &= ~0x2u;
+  }
 }
 @synthesize end;
 - (void) dealloc {
   [super dealloc];
 }
-- (id) init {
-  if ((self = [super init])) {
-    self.start = 0;
-    self.end = 0;
-  }
-  return self;
+- (void) clearForReuse {
+  [super clearForReuse];
+  memset(hasBits_, 0, sizeof(hasBits_));
+  start = 0;
+  end = 0;
 }
 static PBDescriptorProto_ExtensionRange* defaultPBDescriptorProto_ExtensionRangeInstance = nil;
-+ (void) initialize {
-  if (self == [PBDescriptorProto_ExtensionRange class]) {
-    defaultPBDescriptorProto_ExtensionRangeInstance = [[PBDescriptorProto_ExtensionRange alloc] init];
-  }
-}
 + (PBDescriptorProto_ExtensionRange*) defaultInstance {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultPBDescriptorProto_ExtensionRangeInstance = [[PBDescriptorProto_ExtensionRange alloc] init];
+  });
   return defaultPBDescriptorProto_ExtensionRangeInstance;
 }
 - (PBDescriptorProto_ExtensionRange*) defaultInstance {
-  return defaultPBDescriptorProto_ExtensionRangeInstance;
+  return [PBDescriptorProto_ExtensionRange defaultInstance];
 }
 - (BOOL) isInitialized {
   return YES;
 }
 - (void) writeToCodedOutputStream:(PBCodedOutputStream*) output {
-  if (self.hasStart) {
-    [output writeInt32:1 value:self.start];
+  if (hasBits_[0] & 0x1u) {
+    [output writeInt32:1 value:start];
   }
-  if (self.hasEnd) {
-    [output writeInt32:2 value:self.end];
+  if (hasBits_[0] & 0x2u) {
+    [output writeInt32:2 value:end];
   }
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = PBGeneratedMessageGetMemoizedSize(&memoizedSerializedSize);
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
-  if (self.hasStart) {
-    size += computeInt32Size(1, self.start);
+  size_ = 0;
+  if (hasBits_[0] & 0x1u) {
+    size_ += computeInt32Size(1, start);
   }
-  if (self.hasEnd) {
-    size += computeInt32Size(2, self.end);
+  if (hasBits_[0] & 0x2u) {
+    size_ += computeInt32Size(2, end);
   }
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
+  size_ += self.unknownFields.serializedSize;
+  PBGeneratedMessageSetMemoizedSize(&memoizedSerializedSize, size_);
+  return size_;
 }
 + (PBDescriptorProto_ExtensionRange*) parseFromData:(NSData*) data {
   return (PBDescriptorProto_ExtensionRange*)[[[PBDescriptorProto_ExtensionRange builder] mergeFromData:data] build];
@@ -1112,38 +1913,130 @@ static PBDescriptorProto_ExtensionRange* defaultPBDescriptorProto_ExtensionRange
   return [[[PBDescriptorProto_ExtensionRange_Builder alloc] init] autorelease];
 }
 + (PBDescriptorProto_ExtensionRange_Builder*) builderWithPrototype:(PBDescriptorProto_ExtensionRange*) prototype {
-  return [[PBDescriptorProto_ExtensionRange builder] mergeFrom:prototype];
+  return [[[PBDescriptorProto_ExtensionRange_Builder alloc] initWithPrototype:prototype] autorelease];
 }
 - (PBDescriptorProto_ExtensionRange_Builder*) builder {
   return [PBDescriptorProto_ExtensionRange builder];
 }
-@end
-
-@interface PBDescriptorProto_ExtensionRange_Builder()
-@property (retain) PBDescriptorProto_ExtensionRange* result;
-@end
-
-@implementation PBDescriptorProto_ExtensionRange_Builder
+- (PBDescriptorProto_ExtensionRange_Builder*) toBuilder {
+  return [PBDescriptorProto_ExtensionRange builderWithPrototype:self];
+}
+- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
+  if (hasBits_[0] & 0x1u) {
+    [output appendFormat:@"%@%@: %@\n", indent, @"start", [NSNumber numberWithInt:start]];
+  }
+  if (hasBits_[0] & 0x2u) {
+    [output appendFormat:@"%@%@: %@\n", indent, @"end", [NSNumber numberWithInt:end]];
+  }
+  [self.unknownFields writeDescriptionTo:output withIndent:indent];
+}
+- (BOOL) isEqual:(id)other {
+  if (other == self) {
+    return YES;
+  }
+  if (![other isKindOfClass:[PBDescriptorProto_ExtensionRange class]]) {
+    return NO;
+  }
+  PBDescriptorProto_ExtensionRange *otherMessage = other;
+  return
+      (hasBits_[0] & 0x1u) == (otherMessage->hasBits_[0] & 0x1u) &&
+      (!(hasBits_[0] & 0x1u) || start == otherMessage->start) &&
+      (hasBits_[0] & 0x2u) == (otherMessage->hasBits_[0] & 0x2u) &&
+      (!(hasBits_[0] & 0x2u) || end == otherMessage->end) &&
+      (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
+}
+- (NSUInteger) hash {
+  NSUInteger hash_ = PBGeneratedMessageGetMemoizedHash(&memoizedHash);
+  if (hash_ != 0) {
+    return hash_;
+  }
+
+  uint64_t hashCode = 7;
+  if (hasBits_[0] & 0x1u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, (uint64_t)start);
+  }
+  if (hasBits_[0] & 0x2u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, (uint64_t)end);
+  }
+  hashCode = PBGeneratedMessageHashMix(hashCode, [self.unknownFields hash]);
+  hash_ = PBGeneratedMessageHashFinish(hashCode);
+  PBGeneratedMessageSetMemoizedHash(&memoizedHash, hash_);
+  return hash_;
+}
+@end
+
+@implementation PBDescriptorProto_ExtensionRange_Builder
 @synthesize result;
 - (void) dealloc {
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
   self.result = nil;
+  [prototype_ release];
   [super dealloc];
 }
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[[PBDescriptorProto_ExtensionRange alloc] init] autorelease];
+    result = [PBDescriptorProto_ExtensionRange recycledInstance];
+  }
+  return self;
+}
+- (id) initWithPrototype:(PBDescriptorProto_ExtensionRange*) prototype {
+  if ((self = [super init])) {
+    self.result = prototype;
+    prototype_ = [prototype retain];
   }
   return self;
 }
+- (void) detachFromPrototype {
+  PBDescriptorProto_ExtensionRange* prototype = prototype_;
+  prototype_ = nil;
+  self.result = [[[PBDescriptorProto_ExtensionRange alloc] init] autorelease];
+  [self mergeFrom:prototype];
+  [prototype release];
+}
+- (PBGeneratedMessage*) internalGetMutableResult {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return [self internalGetResult];
+}
 - (PBGeneratedMessage*) internalGetResult {
   return result;
 }
 - (PBDescriptorProto_ExtensionRange_Builder*) clear {
-  self.result = [[[PBDescriptorProto_ExtensionRange alloc] init] autorelease];
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = [[PBDescriptorProto_ExtensionRange recycledInstance] autorelease];
   return self;
 }
 - (PBDescriptorProto_ExtensionRange_Builder*) clone {
-  return [PBDescriptorProto_ExtensionRange builderWithPrototype:result];
+  if (prototype_ != nil) {
+    return [[[PBDescriptorProto_ExtensionRange_Builder alloc] initWithPrototype:prototype_] autorelease];
+  }
+  return [[PBDescriptorProto_ExtensionRange builder] mergeFrom:result];
+}
+- (PBDescriptorProto_ExtensionRange_Builder*) reset {
+  if (result == nil || prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    self.result = [[PBDescriptorProto_ExtensionRange recycledInstance] autorelease];
+  } else {
+    [result clearForReuse];
+  }
+  return self;
+}
+- (PBDescriptorProto_ExtensionRange_Builder*) recycle:(PBDescriptorProto_ExtensionRange*) message {
+  if (message == [PBDescriptorProto_ExtensionRange defaultInstance]) {
+    @throw [NSException exceptionWithName:@"IllegalArgument" reason:@"Cannot recycle the default instance" userInfo:nil];
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = message;
+  return [self reset];
 }
 - (PBDescriptorProto_ExtensionRange*) defaultInstance {
   return [PBDescriptorProto_ExtensionRange defaultInstance];
@@ -1153,19 +2046,32 @@ static PBDescriptorProto_ExtensionRange* defaultPBDescriptorProto_ExtensionRange
   return [self buildPartial];
 }
 - (PBDescriptorProto_ExtensionRange*) buildPartial {
-  PBDescriptorProto_ExtensionRange* returnMe = [[result retain] autorelease];
-  self.result = nil;
+  return [[self newBuildPartial] autorelease];
+}
+- (PBDescriptorProto_ExtensionRange*) newBuildPartial {
+  if (prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    PBDescriptorProto_ExtensionRange* returnMe = result;
+    result = nil;
+    return returnMe;
+  }
+  PBDescriptorProto_ExtensionRange* returnMe = result;
+  result = nil;
   return returnMe;
 }
 - (PBDescriptorProto_ExtensionRange_Builder*) mergeFrom:(PBDescriptorProto_ExtensionRange*) other {
   if (other == [PBDescriptorProto_ExtensionRange defaultInstance]) {
     return self;
   }
-  if (other.hasStart) {
-    [self setStart:other.start];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (other->hasBits_[0] & 0x1u) {
+    [self setStart:other->start];
   }
-  if (other.hasEnd) {
-    [self setEnd:other.end];
+  if (other->hasBits_[0] & 0x2u) {
+    [self setEnd:other->end];
   }
   [self mergeUnknownFields:other.unknownFields];
   return self;
@@ -1174,18 +2080,29 @@ static PBDescriptorProto_ExtensionRange* defaultPBDescriptorProto_ExtensionRange
   return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
 }
 - (PBDescriptorProto_ExtensionRange_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  PBUnknownFieldSet_Builder* unknownFields = nil;
   while (YES) {
     int32_t tag = [input readTag];
     switch (tag) {
       case 0:
-        [self setUnknownFields:[unknownFields build]];
+        if (unknownFields != nil) {
+          [self setUnknownFields:[unknownFields build]];
+        }
         return self;
       default: {
-        if (![self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag]) {
-          [self setUnknownFields:[unknownFields build]];
+        if (PBWireFormatGetTagWireType(tag) == PBWireFormatEndGroup) {
+          if (unknownFields != nil) {
+            [self setUnknownFields:[unknownFields build]];
+          }
           return self;
         }
+        if (unknownFields == nil) {
+          unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+        }
+        [self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag];
         break;
       }
       case 8: {
@@ -1200,116 +2117,232 @@ static PBDescriptorProto_ExtensionRange* defaultPBDescriptorProto_ExtensionRange
   }
 }
 - (BOOL) hasStart {
-  return result.hasStart;
+  return (result->hasBits_[0] & 0x1u) != 0;
 }
 - (int32_t) start {
-  return result.start;
+  return result->start;
 }
 - (PBDescriptorProto_ExtensionRange_Builder*) setStart:(int32_t) value {
-  result.hasStart = YES;
-  result.start = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x1u;
+  result->start = value;
   return self;
 }
 - (PBDescriptorProto_ExtensionRange_Builder*) clearStart {
-  result.hasStart = NO;
-  result.start = 0;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x1u;
+  result->start = 0;
   return self;
 }
 - (BOOL) hasEnd {
-  return result.hasEnd;
+  return (result->hasBits_[0] & 0x2u) != 0;
 }
 - (int32_t) end {
-  return result.end;
+  return result->end;
 }
 - (PBDescriptorProto_ExtensionRange_Builder*) setEnd:(int32_t) value {
-  result.hasEnd = YES;
-  result.end = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x2u;
+  result->end = value;
   return self;
 }
 - (PBDescriptorProto_ExtensionRange_Builder*) clearEnd {
-  result.hasEnd = NO;
-  result.end = 0;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x2u;
+  result->end = 0;
   return self;
 }
 @end
 
-@interface PBDescriptorProto_Builder()
-@property (retain) PBDescriptorProto* result;
-@end
-
 @implementation PBDescriptorProto_Builder
 @synthesize result;
 - (void) dealloc {
+  [self dropSubBuilders];
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
   self.result = nil;
+  [prototype_ release];
   [super dealloc];
 }
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[[PBDescriptorProto alloc] init] autorelease];
+    result = [PBDescriptorProto recycledInstance];
+  }
+  return self;
+}
+- (id) initWithPrototype:(PBDescriptorProto*) prototype {
+  if ((self = [super init])) {
+    self.result = prototype;
+    prototype_ = [prototype retain];
   }
   return self;
 }
+- (void) detachFromPrototype {
+  PBDescriptorProto* prototype = prototype_;
+  prototype_ = nil;
+  self.result = [[[PBDescriptorProto alloc] init] autorelease];
+  [self mergeFrom:prototype];
+  [prototype release];
+}
+- (PBGeneratedMessage*) internalGetMutableResult {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return [self internalGetResult];
+}
+- (void) freezeSubBuilders {
+  if (optionsBuilder_ != nil) {
+    PBMessageOptions* value = [optionsBuilder_ newBuildPartial];
+    result.options = value;
+    [value release];
+    [optionsBuilder_ release];
+    optionsBuilder_ = nil;
+  }
+}
+- (void) dropSubBuilders {
+  [optionsBuilder_ release];
+  optionsBuilder_ = nil;
+  [optionsSpareBuilder_ release];
+  optionsSpareBuilder_ = nil;
+}
+- (void) resetSubBuilders {
+  if (optionsBuilder_ != nil) {
+    [optionsBuilder_ reset];
+    [optionsSpareBuilder_ release];
+    optionsSpareBuilder_ = optionsBuilder_;
+    optionsBuilder_ = nil;
+  }
+}
 - (PBGeneratedMessage*) internalGetResult {
+  [self freezeSubBuilders];
   return result;
 }
 - (PBDescriptorProto_Builder*) clear {
-  self.result = [[[PBDescriptorProto alloc] init] autorelease];
+  [self dropSubBuilders];
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = [[PBDescriptorProto recycledInstance] autorelease];
   return self;
 }
 - (PBDescriptorProto_Builder*) clone {
-  return [PBDescriptorProto builderWithPrototype:result];
+  if (prototype_ != nil) {
+    return [[[PBDescriptorProto_Builder alloc] initWithPrototype:prototype_] autorelease];
+  }
+  [self freezeSubBuilders];
+  return [[PBDescriptorProto builder] mergeFrom:result];
+}
+- (PBDescriptorProto_Builder*) reset {
+  [self resetSubBuilders];
+  if (result == nil || prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    self.result = [[PBDescriptorProto recycledInstance] autorelease];
+  } else {
+    [result clearForReuse];
+  }
+  return self;
+}
+- (PBDescriptorProto_Builder*) recycle:(PBDescriptorProto*) message {
+  if (message == [PBDescriptorProto defaultInstance]) {
+    @throw [NSException exceptionWithName:@"IllegalArgument" reason:@"Cannot recycle the default instance" userInfo:nil];
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = message;
+  return [self reset];
 }
 - (PBDescriptorProto*) defaultInstance {
   return [PBDescriptorProto defaultInstance];
 }
 - (PBDescriptorProto*) build {
   [self checkInitialized];
-  return [self buildPartial];
+  BOOL shared = prototype_ != nil;
+  PBDescriptorProto* returnMe = [self buildPartial];
+  if (!shared) {
+    [returnMe setInitialized];
+  }
+  return returnMe;
 }
 - (PBDescriptorProto*) buildPartial {
-  PBDescriptorProto* returnMe = [[result retain] autorelease];
-  self.result = nil;
+  return [[self newBuildPartial] autorelease];
+}
+- (PBDescriptorProto*) newBuildPartial {
+  if (prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    PBDescriptorProto* returnMe = result;
+    result = nil;
+    return returnMe;
+  }
+  [self freezeSubBuilders];
+  [result->fieldArray shrinkToFit];
+  [result->extensionArray shrinkToFit];
+  [result->nestedTypeArray shrinkToFit];
+  [result->enumTypeArray shrinkToFit];
+  [result->extensionRangeArray shrinkToFit];
+  PBDescriptorProto* returnMe = result;
+  result = nil;
   return returnMe;
 }
 - (PBDescriptorProto_Builder*) mergeFrom:(PBDescriptorProto*) other {
   if (other == [PBDescriptorProto defaultInstance]) {
     return self;
   }
-  if (other.hasName) {
-    [self setName:other.name];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  if (other.mutableFieldList.count > 0) {
-    if (result.mutableFieldList == nil) {
-      result.mutableFieldList = [NSMutableArray array];
+  if (other->hasBits_[0] & 0x1u) {
+    [self setName:other->name];
+  }
+  if (other->fieldArray.count > 0) {
+    if (result->fieldArray == nil) {
+      result.fieldArray = [[other->fieldArray copyWithZone:[other->fieldArray zone]] autorelease];
+    } else {
+      [result->fieldArray appendArray:other->fieldArray];
     }
-    [result.mutableFieldList addObjectsFromArray:other.mutableFieldList];
   }
-  if (other.mutableExtensionList.count > 0) {
-    if (result.mutableExtensionList == nil) {
-      result.mutableExtensionList = [NSMutableArray array];
+  if (other->extensionArray.count > 0) {
+    if (result->extensionArray == nil) {
+      result.extensionArray = [[other->extensionArray copyWithZone:[other->extensionArray zone]] autorelease];
+    } else {
+      [result->extensionArray appendArray:other->extensionArray];
     }
-    [result.mutableExtensionList addObjectsFromArray:other.mutableExtensionList];
   }
-  if (other.mutableNestedTypeList.count > 0) {
-    if (result.mutableNestedTypeList == nil) {
-      result.mutableNestedTypeList = [NSMutableArray array];
+  if (other->nestedTypeArray.count > 0) {
+    if (result->nestedTypeArray == nil) {
+      result.nestedTypeArray = [[other->nestedTypeArray copyWithZone:[other->nestedTypeArray zone]] autorelease];
+    } else {
+      [result->nestedTypeArray appendArray:other->nestedTypeArray];
     }
-    [result.mutableNestedTypeList addObjectsFromArray:other.mutableNestedTypeList];
   }
-  if (other.mutableEnumTypeList.count > 0) {
-    if (result.mutableEnumTypeList == nil) {
-      result.mutableEnumTypeList = [NSMutableArray array];
+  if (other->enumTypeArray.count > 0) {
+    if (result->enumTypeArray == nil) {
+      result.enumTypeArray = [[other->enumTypeArray copyWithZone:[other->enumTypeArray zone]] autorelease];
+    } else {
+      [result->enumTypeArray appendArray:other->enumTypeArray];
     }
-    [result.mutableEnumTypeList addObjectsFromArray:other.mutableEnumTypeList];
   }
-  if (other.mutableExtensionRangeList.count > 0) {
-    if (result.mutableExtensionRangeList == nil) {
-      result.mutableExtensionRangeList = [NSMutableArray array];
+  if (other->extensionRangeArray.count > 0) {
+    if (result->extensionRangeArray == nil) {
+      result.extensionRangeArray = [[other->extensionRangeArray copyWithZone:[other->extensionRangeArray zone]] autorelease];
+    } else {
+      [result->extensionRangeArray appendArray:other->extensionRangeArray];
     }
-    [result.mutableExtensionRangeList addObjectsFromArray:other.mutableExtensionRangeList];
   }
-  if (other.hasOptions) {
-    [self mergeOptions:other.options];
+  if (other->hasBits_[0] & 0x2u) {
+    [self mergeOptions:other->options];
   }
   [self mergeUnknownFields:other.unknownFields];
   return self;
@@ -1318,235 +2351,349 @@ static PBDescriptorProto_ExtensionRange* defaultPBDescriptorProto_ExtensionRange
   return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
 }
 - (PBDescriptorProto_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  PBUnknownFieldSet_Builder* unknownFields = nil;
   while (YES) {
     int32_t tag = [input readTag];
     switch (tag) {
       case 0:
-        [self setUnknownFields:[unknownFields build]];
+        if (unknownFields != nil) {
+          [self setUnknownFields:[unknownFields build]];
+        }
         return self;
       default: {
-        if (![self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag]) {
-          [self setUnknownFields:[unknownFields build]];
+        if (PBWireFormatGetTagWireType(tag) == PBWireFormatEndGroup) {
+          if (unknownFields != nil) {
+            [self setUnknownFields:[unknownFields build]];
+          }
           return self;
         }
+        if (unknownFields == nil) {
+          unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+        }
+        [self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag];
         break;
       }
       case 10: {
-        [self setName:[input readString]];
+        NSString* value = [input newString];
+        [self setName:value];
+        [value release];
         break;
       }
       case 18: {
-        PBFieldDescriptorProto_Builder* subBuilder = [PBFieldDescriptorProto builder];
-        [input readMessage:subBuilder extensionRegistry:extensionRegistry];
-        [self addField:[subBuilder buildPartial]];
+        PBFieldDescriptorProto_Builder* subBuilder = [[PBFieldDescriptorProto_Builder alloc] init];
+        @try {
+          [input readMessage:subBuilder extensionRegistry:extensionRegistry];
+          PBFieldDescriptorProto* value = [subBuilder newBuildPartial];
+          [self addField:value];
+          [value release];
+        } @finally {
+          [subBuilder release];
+        }
         break;
       }
       case 26: {
-        PBDescriptorProto_Builder* subBuilder = [PBDescriptorProto builder];
-        [input readMessage:subBuilder extensionRegistry:extensionRegistry];
-        [self addNestedType:[subBuilder buildPartial]];
+        PBDescriptorProto_Builder* subBuilder = [[PBDescriptorProto_Builder alloc] init];
+        @try {
+          [input readMessage:subBuilder extensionRegistry:extensionRegistry];
+          PBDescriptorProto* value = [subBuilder newBuildPartial];
+          [self addNestedType:value];
+          [value release];
+        } @finally {
+          [subBuilder release];
+        }
         break;
       }
       case 34: {
-        PBEnumDescriptorProto_Builder* subBuilder = [PBEnumDescriptorProto builder];
-        [input readMessage:subBuilder extensionRegistry:extensionRegistry];
-        [self addEnumType:[subBuilder buildPartial]];
+        PBEnumDescriptorProto_Builder* subBuilder = [[PBEnumDescriptorProto_Builder alloc] init];
+        @try {
+          [input readMessage:subBuilder extensionRegistry:extensionRegistry];
+          PBEnumDescriptorProto* value = [subBuilder newBuildPartial];
+          [self addEnumType:value];
+          [value release];
+        } @finally {
+          [subBuilder release];
+        }
         break;
       }
       case 42: {
-        PBDescriptorProto_ExtensionRange_Builder* subBuilder = [PBDescriptorProto_ExtensionRange builder];
-        [input readMessage:subBuilder extensionRegistry:extensionRegistry];
-        [self addExtensionRange:[subBuilder buildPartial]];
+        PBDescriptorProto_ExtensionRange_Builder* subBuilder = [[PBDescriptorProto_ExtensionRange_Builder alloc] init];
+        @try {
+          [input readMessage:subBuilder extensionRegistry:extensionRegistry];
+          PBDescriptorProto_ExtensionRange* value = [subBuilder newBuildPartial];
+          [self addExtensionRange:value];
+          [value release];
+        } @finally {
+          [subBuilder release];
+        }
         break;
       }
       case 50: {
-        PBFieldDescriptorProto_Builder* subBuilder = [PBFieldDescriptorProto builder];
-        [input readMessage:subBuilder extensionRegistry:extensionRegistry];
-        [self addExtension:[subBuilder buildPartial]];
+        PBFieldDescriptorProto_Builder* subBuilder = [[PBFieldDescriptorProto_Builder alloc] init];
+        @try {
+          [input readMessage:subBuilder extensionRegistry:extensionRegistry];
+          PBFieldDescriptorProto* value = [subBuilder newBuildPartial];
+          [self addExtension:value];
+          [value release];
+        } @finally {
+          [subBuilder release];
+        }
         break;
       }
       case 58: {
-        PBMessageOptions_Builder* subBuilder = [PBMessageOptions builder];
-        if (self.hasOptions) {
-          [subBuilder mergeFrom:self.options];
+        if (optionsBuilder_ == nil) {
+          optionsBuilder_ = optionsSpareBuilder_ != nil ? optionsSpareBuilder_ : [[PBMessageOptions_Builder alloc] init];
+          optionsSpareBuilder_ = nil;
+          if (result->hasBits_[0] & 0x2u) {
+            [optionsBuilder_ mergeFrom:result->options];
+          }
+          result->hasBits_[0] |= 0x2u;
         }
-        [input readMessage:subBuilder extensionRegistry:extensionRegistry];
-        [self setOptions:[subBuilder buildPartial]];
+        [input readMessage:optionsBuilder_ extensionRegistry:extensionRegistry];
         break;
       }
     }
   }
 }
 - (BOOL) hasName {
-  return result.hasName;
+  return (result->hasBits_[0] & 0x1u) != 0;
 }
 - (NSString*) name {
-  return result.name;
+  return [result name];
 }
 - (PBDescriptorProto_Builder*) setName:(NSString*) value {
-  result.hasName = YES;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x1u;
   result.name = value;
   return self;
 }
 - (PBDescriptorProto_Builder*) clearName {
-  result.hasName = NO;
-  result.name = @"";
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x1u;
+  [result->name release];
+  result->name = nil;
   return self;
 }
-- (NSArray*) fieldList {
-  if (result.mutableFieldList == nil) { return [NSArray array]; }
-  return result.mutableFieldList;
+- (PBAppendableArray *)field {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return result->fieldArray;
 }
-- (PBFieldDescriptorProto*) fieldAtIndex:(int32_t) index {
+- (PBFieldDescriptorProto*)fieldAtIndex:(NSUInteger)index {
   return [result fieldAtIndex:index];
 }
-- (PBDescriptorProto_Builder*) replaceFieldAtIndex:(int32_t) index with:(PBFieldDescriptorProto*) value {
-  [result.mutableFieldList replaceObjectAtIndex:index withObject:value];
+- (PBDescriptorProto_Builder *)addField:(PBFieldDescriptorProto*)value {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (result->fieldArray == nil) {
+    result.fieldArray = [PBObjectArray array];
+  }
+  PBObjectArrayAddValue(result->fieldArray, value);
   return self;
 }
-- (PBDescriptorProto_Builder*) addAllField:(NSArray*) values {
-  if (result.mutableFieldList == nil) {
-    result.mutableFieldList = [NSMutableArray array];
+- (PBDescriptorProto_Builder *)setFieldArray:(NSArray *)array {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  [result.mutableFieldList addObjectsFromArray:values];
+  result.fieldArray = [PBObjectArray arrayWithArray:array valueType:PBArrayValueTypeObject];
   return self;
 }
-- (PBDescriptorProto_Builder*) clearFieldList {
-  result.mutableFieldList = nil;
+- (PBDescriptorProto_Builder *)setFieldValues:(const PBFieldDescriptorProto* *)values count:(NSUInteger)count {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.fieldArray = [PBObjectArray arrayWithValues:values count:count valueType:PBArrayValueTypeObject];
   return self;
 }
-- (PBDescriptorProto_Builder*) addField:(PBFieldDescriptorProto*) value {
-  if (result.mutableFieldList == nil) {
-    result.mutableFieldList = [NSMutableArray array];
+- (PBDescriptorProto_Builder *)clearField {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  [result.mutableFieldList addObject:value];
+  result.fieldArray = nil;
   return self;
 }
-- (NSArray*) extensionList {
-  if (result.mutableExtensionList == nil) { return [NSArray array]; }
-  return result.mutableExtensionList;
+- (PBAppendableArray *)extension {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return result->extensionArray;
 }
-- (PBFieldDescriptorProto*) extensionAtIndex:(int32_t) index {
+- (PBFieldDescriptorProto*)extensionAtIndex:(NSUInteger)index {
   return [result extensionAtIndex:index];
 }
-- (PBDescriptorProto_Builder*) replaceExtensionAtIndex:(int32_t) index with:(PBFieldDescriptorProto*) value {
-  [result.mutableExtensionList replaceObjectAtIndex:index withObject:value];
+- (PBDescriptorProto_Builder *)addExtension:(PBFieldDescriptorProto*)value {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (result->extensionArray == nil) {
+    result.extensionArray = [PBObjectArray array];
+  }
+  PBObjectArrayAddValue(result->extensionArray, value);
   return self;
 }
-- (PBDescriptorProto_Builder*) addAllExtension:(NSArray*) values {
-  if (result.mutableExtensionList == nil) {
-    result.mutableExtensionList = [NSMutableArray array];
+- (PBDescriptorProto_Builder *)setExtensionArray:(NSArray *)array {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  [result.mutableExtensionList addObjectsFromArray:values];
+  result.extensionArray = [PBObjectArray arrayWithArray:array valueType:PBArrayValueTypeObject];
   return self;
 }
-- (PBDescriptorProto_Builder*) clearExtensionList {
-  result.mutableExtensionList = nil;
+- (PBDescriptorProto_Builder *)setExtensionValues:(const PBFieldDescriptorProto* *)values count:(NSUInteger)count {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.extensionArray = [PBObjectArray arrayWithValues:values count:count valueType:PBArrayValueTypeObject];
   return self;
 }
-- (PBDescriptorProto_Builder*) addExtension:(PBFieldDescriptorProto*) value {
-  if (result.mutableExtensionList == nil) {
-    result.mutableExtensionList = [NSMutableArray array];
+- (PBDescriptorProto_Builder *)clearExtension {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  [result.mutableExtensionList addObject:value];
+  result.extensionArray = nil;
   return self;
 }
-- (NSArray*) nestedTypeList {
-  if (result.mutableNestedTypeList == nil) { return [NSArray array]; }
-  return result.mutableNestedTypeList;
+- (PBAppendableArray *)nestedType {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return result->nestedTypeArray;
 }
-- (PBDescriptorProto*) nestedTypeAtIndex:(int32_t) index {
+- (PBDescriptorProto*)nestedTypeAtIndex:(NSUInteger)index {
   return [result nestedTypeAtIndex:index];
 }
-- (PBDescriptorProto_Builder*) replaceNestedTypeAtIndex:(int32_t) index with:(PBDescriptorProto*) value {
-  [result.mutableNestedTypeList replaceObjectAtIndex:index withObject:value];
+- (PBDescriptorProto_Builder *)addNestedType:(PBDescriptorProto*)value {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (result->nestedTypeArray == nil) {
+    result.nestedTypeArray = [PBObjectArray array];
+  }
+  PBObjectArrayAddValue(result->nestedTypeArray, value);
   return self;
 }
-- (PBDescriptorProto_Builder*) addAllNestedType:(NSArray*) values {
-  if (result.mutableNestedTypeList == nil) {
-    result.mutableNestedTypeList = [NSMutableArray array];
+- (PBDescriptorProto_Builder *)setNestedTypeArray:(NSArray *)array {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  [result.mutableNestedTypeList addObjectsFromArray:values];
+  result.nestedTypeArray = [PBObjectArray arrayWithArray:array valueType:PBArrayValueTypeObject];
   return self;
 }
-- (PBDescriptorProto_Builder*) clearNestedTypeList {
-  result.mutableNestedTypeList = nil;
+- (PBDescriptorProto_Builder *)setNestedTypeValues:(const PBDescriptorProto* *)values count:(NSUInteger)count {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.nestedTypeArray = [PBObjectArray arrayWithValues:values count:count valueType:PBArrayValueTypeObject];
   return self;
 }
-- (PBDescriptorProto_Builder*) addNestedType:(PBDescriptorProto*) value {
-  if (result.mutableNestedTypeList == nil) {
-    result.mutableNestedTypeList = [NSMutableArray array];
+- (PBDescriptorProto_Builder *)clearNestedType {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  [result.mutableNestedTypeList addObject:value];
+  result.nestedTypeArray = nil;
   return self;
 }
-- (NSArray*) enumTypeList {
-  if (result.mutableEnumTypeList == nil) { return [NSArray array]; }
-  return result.mutableEnumTypeList;
+- (PBAppendableArray *)enumType {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return result->enumTypeArray;
 }
-- (PBEnumDescriptorProto*) enumTypeAtIndex:(int32_t) index {
+- (PBEnumDescriptorProto*)enumTypeAtIndex:(NSUInteger)index {
   return [result enumTypeAtIndex:index];
 }
-- (PBDescriptorProto_Builder*) replaceEnumTypeAtIndex:(int32_t) index with:(PBEnumDescriptorProto*) value {
-  [result.mutableEnumTypeList replaceObjectAtIndex:index withObject:value];
+- (PBDescriptorProto_Builder *)addEnumType:(PBEnumDescriptorProto*)value {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (result->enumTypeArray == nil) {
+    result.enumTypeArray = [PBObjectArray array];
+  }
+  PBObjectArrayAddValue(result->enumTypeArray, value);
   return self;
 }
-- (PBDescriptorProto_Builder*) addAllEnumType:(NSArray*) values {
-  if (result.mutableEnumTypeList == nil) {
-    result.mutableEnumTypeList = [NSMutableArray array];
+- (PBDescriptorProto_Builder *)setEnumTypeArray:(NSArray *)array {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  [result.mutableEnumTypeList addObjectsFromArray:values];
+  result.enumTypeArray = [PBObjectArray arrayWithArray:array valueType:PBArrayValueTypeObject];
   return self;
 }
-- (PBDescriptorProto_Builder*) clearEnumTypeList {
-  result.mutableEnumTypeList = nil;
+- (PBDescriptorProto_Builder *)setEnumTypeValues:(const PBEnumDescriptorProto* *)values count:(NSUInteger)count {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.enumTypeArray = [PBObjectArray arrayWithValues:values count:count valueType:PBArrayValueTypeObject];
   return self;
 }
-- (PBDescriptorProto_Builder*) addEnumType:(PBEnumDescriptorProto*) value {
-  if (result.mutableEnumTypeList == nil) {
-    result.mutableEnumTypeList = [NSMutableArray array];
+- (PBDescriptorProto_Builder *)clearEnumType {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  [result.mutableEnumTypeList addObject:value];
+  result.enumTypeArray = nil;
   return self;
 }
-- (NSArray*) extensionRangeList {
-  if (result.mutableExtensionRangeList == nil) { return [NSArray array]; }
-  return result.mutableExtensionRangeList;
+- (PBAppendableArray *)extensionRange {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return result->extensionRangeArray;
 }
-- (PBDescriptorProto_ExtensionRange*) extensionRangeAtIndex:(int32_t) index {
+- (PBDescriptorProto_ExtensionRange*)extensionRangeAtIndex:(NSUInteger)index {
   return [result extensionRangeAtIndex:index];
 }
-- (PBDescriptorProto_Builder*) replaceExtensionRangeAtIndex:(int32_t) index with:(PBDescriptorProto_ExtensionRange*) value {
-  [result.mutableExtensionRangeList replaceObjectAtIndex:index withObject:value];
+- (PBDescriptorProto_Builder *)addExtensionRange:(PBDescriptorProto_ExtensionRange*)value {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (result->extensionRangeArray == nil) {
+    result.extensionRangeArray = [PBObjectArray array];
+  }
+  PBObjectArrayAddValue(result->extensionRangeArray, value);
   return self;
 }
-- (PBDescriptorProto_Builder*) addAllExtensionRange:(NSArray*) values {
-  if (result.mutableExtensionRangeList == nil) {
-    result.mutableExtensionRangeList = [NSMutableArray array];
+- (PBDescriptorProto_Builder *)setExtensionRangeArray:(NSArray *)array {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  [result.mutableExtensionRangeList addObjectsFromArray:values];
+  result.extensionRangeArray = [PBObjectArray arrayWithArray:array valueType:PBArrayValueTypeObject];
   return self;
 }
-- (PBDescriptorProto_Builder*) clearExtensionRangeList {
-  result.mutableExtensionRangeList = nil;
+- (PBDescriptorProto_Builder *)setExtensionRangeValues:(const PBDescriptorProto_ExtensionRange* *)values count:(NSUInteger)count {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.extensionRangeArray = [PBObjectArray arrayWithValues:values count:count valueType:PBArrayValueTypeObject];
   return self;
 }
-- (PBDescriptorProto_Builder*) addExtensionRange:(PBDescriptorProto_ExtensionRange*) value {
-  if (result.mutableExtensionRangeList == nil) {
-    result.mutableExtensionRangeList = [NSMutableArray array];
+- (PBDescriptorProto_Builder *)clearExtensionRange {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  [result.mutableExtensionRangeList addObject:value];
+  result.extensionRangeArray = nil;
   return self;
 }
 - (BOOL) hasOptions {
-  return result.hasOptions;
+  return (result->hasBits_[0] & 0x2u) != 0;
 }
 - (PBMessageOptions*) options {
+  [self freezeSubBuilders];
   return result.options;
 }
 - (PBDescriptorProto_Builder*) setOptions:(PBMessageOptions*) value {
-  result.hasOptions = YES;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  [optionsBuilder_ release];
+  optionsBuilder_ = nil;
+  result->hasBits_[0] |= 0x2u;
   result.options = value;
   return self;
 }
@@ -1554,194 +2701,279 @@ static PBDescriptorProto_ExtensionRange* defaultPBDescriptorProto_ExtensionRange
   return [self setOptions:[builderForValue build]];
 }
 - (PBDescriptorProto_Builder*) mergeOptions:(PBMessageOptions*) value {
-  if (result.hasOptions &&
-      result.options != [PBMessageOptions defaultInstance]) {
-    result.options =
-      [[[PBMessageOptions builderWithPrototype:result.options] mergeFrom:value] buildPartial];
-  } else {
-    result.options = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (optionsBuilder_ == nil) {
+    if (!(result->hasBits_[0] & 0x2u) ||
+        result->options == [PBMessageOptions defaultInstance]) {
+      result->hasBits_[0] |= 0x2u;
+      result.options = value;
+      return self;
+    }
+    optionsBuilder_ = optionsSpareBuilder_ != nil ? optionsSpareBuilder_ : [[PBMessageOptions_Builder alloc] init];
+    optionsSpareBuilder_ = nil;
+    [optionsBuilder_ mergeFrom:result->options];
   }
-  result.hasOptions = YES;
+  [optionsBuilder_ mergeFrom:value];
   return self;
 }
 - (PBDescriptorProto_Builder*) clearOptions {
-  result.hasOptions = NO;
-  result.options = [PBMessageOptions defaultInstance];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  [optionsBuilder_ release];
+  optionsBuilder_ = nil;
+  result->hasBits_[0] &= ~0x2u;
+  [result->options release];
+  result->options = nil;
   return self;
 }
 @end
 
 @interface PBFieldDescriptorProto ()
-@property (retain) NSString* name;
-@property int32_t number;
-@property PBFieldDescriptorProto_Label label;
-@property PBFieldDescriptorProto_Type type;
-@property (retain) NSString* typeName;
-@property (retain) NSString* extendee;
-@property (retain) NSString* defaultValue;
-@property (retain) PBFieldOptions* options;
+@property (nonatomic, retain) NSString* name;
+@property (nonatomic) int32_t number;
+@property (nonatomic) PBFieldDescriptorProto_Label label;
+@property (nonatomic) PBFieldDescriptorProto_Type type;
+@property (nonatomic, retain) NSString* typeName;
+@property (nonatomic, retain) NSString* extendee;
+@property (nonatomic, retain) NSString* defaultValue;
+@property (nonatomic, retain) PBFieldOptions* options;
+- (void) setInitialized;
+@end
+
+@interface PBFieldDescriptorProto_Builder()
+@property (nonatomic, retain) PBFieldDescriptorProto* result;
+- (id) initWithPrototype:(PBFieldDescriptorProto*) prototype;
+- (void) detachFromPrototype;
+- (void) freezeSubBuilders;
+- (void) dropSubBuilders;
+- (void) resetSubBuilders;
 @end
 
 @implementation PBFieldDescriptorProto
 
 - (BOOL) hasName {
-  return !!hasName_;
+  return (hasBits_[0] & 0x1u) != 0;
 }
-- (void) setHasName:(BOOL) value {
-  hasName_ = !!value;
+- (void) setHasName:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x1u;
+  } else {
+    hasBits_[0] &= ~0x1u;
+  }
 }
 @synthesize name;
+- (NSString*) name {
+  return (hasBits_[0] & 0x1u) ? name : @"";
+}
 - (BOOL) hasNumber {
-  return !!hasNumber_;
+  return (hasBits_[0] & 0x2u) != 0;
 }
-- (void) setHasNumber:(BOOL) value {
-  hasNumber_ = !!value;
+- (void) setHasNumber:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x2u;
+  } else {
+    hasBits_[0] &= ~0x2u;
+  }
 }
 @synthesize number;
 - (BOOL) hasLabel {
-  return !!hasLabel_;
+  return (hasBits_[0] & 0x4u) != 0;
 }
-- (void) setHasLabel:(BOOL) value {
-  hasLabel_ = !!value;
+- (void) setHasLabel:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x4u;
+  } else {
+    hasBits_[0] &= ~0x4u;
+  }
 }
 @synthesize label;
+- (PBFieldDescriptorProto_Label) label {
+  return (hasBits_[0] & 0x4u) ? label : PBFieldDescriptorProto_LabelLabelOptional;
+}
 - (BOOL) hasType {
-  return !!hasType_;
+  return (hasBits_[0] & 0x8u) != 0;
 }
-- (void) setHasType:(BOOL) value {
-  hasType_ = !!value;
+- (void) setHasType:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x8u;
+  } else {
+    hasBits_[0] &= ~0x8u;
+  }
 }
 @synthesize type;
+- (PBFieldDescriptorProto_Type) type {
+  return (hasBits_[0] & 0x8u) ? type : PBFieldDescriptorProto_TypeTypeDouble;
+}
 - (BOOL) hasTypeName {
-  return !!hasTypeName_;
+  return (hasBits_[0] & 0x10u) != 0;
 }
-- (void) setHasTypeName:(BOOL) value {
-  hasTypeName_ = !!value;
+- (void) setHasTypeName:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x10u;
+  } else {
+    hasBits_[0] &= ~0x10u;
+  }
 }
 @synthesize typeName;
+- (NSString*) typeName {
+  return (hasBits_[0] & 0x10u) ? typeName : @"";
+}
 - (BOOL) hasExtendee {
-  return !!hasExtendee_;
+  return (hasBits_[0] & 0x20u) != 0;
 }
-- (void) setHasExtendee:(BOOL) value {
-  hasExtendee_ = !!value;
+- (void) setHasExtendee:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x20u;
+  } else {
+    hasBits_[0] &= ~0x20u;
+  }
 }
 @synthesize extendee;
+- (NSString*) extendee {
+  return (hasBits_[0] & 0x20u) ? extendee : @"";
+}
 - (BOOL) hasDefaultValue {
-  return !!hasDefaultValue_;
+  return (hasBits_[0] & 0x40u) != 0;
 }
-- (void) setHasDefaultValue:(BOOL) value {
-  hasDefaultValue_ = !!value;
+- (void) setHasDefaultValue:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x40u;
+  } else {
+    hasBits_[0] &= ~0x40u;
+  }
 }
 @synthesize defaultValue;
+- (NSString*) defaultValue {
+  return (hasBits_[0] & 0x40u) ? defaultValue : @"";
+}
 - (BOOL) hasOptions {
-  return !!hasOptions_;
+  return (hasBits_[0] & 0x80u) != 0;
 }
-- (void) setHasOptions:(BOOL) value {
-  hasOptions_ = !!value;
+- (void) setHasOptions:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x80u;
+  } else {
+    hasBits_[0] &= ~0x80u;
+  }
 }
 @synthesize options;
+- (PBFieldOptions*) options {
+  return options != nil ? options : [PBFieldOptions defaultInstance];
+}
 - (void) dealloc {
-  self.name = nil;
-  self.typeName = nil;
-  self.extendee = nil;
-  self.defaultValue = nil;
-  self.options = nil;
+  [name release];
+  [typeName release];
+  [extendee release];
+  [defaultValue release];
+  [options release];
   [super dealloc];
 }
-- (id) init {
-  if ((self = [super init])) {
-    self.name = @"";
-    self.number = 0;
-    self.label = PBFieldDescriptorProto_LabelLabelOptional;
-    self.type = PBFieldDescriptorProto_TypeTypeDouble;
-    self.typeName = @"";
-    self.extendee = @"";
-    self.defaultValue = @"";
-    self.options = [PBFieldOptions defaultInstance];
-  }
-  return self;
+- (void) clearForReuse {
+  [super clearForReuse];
+  memset(hasBits_, 0, sizeof(hasBits_));
+  [name release];
+  name = nil;
+  number = 0;
+  label = 0;
+  type = 0;
+  [typeName release];
+  typeName = nil;
+  [extendee release];
+  extendee = nil;
+  [defaultValue release];
+  defaultValue = nil;
+  [options release];
+  options = nil;
 }
 static PBFieldDescriptorProto* defaultPBFieldDescriptorProtoInstance = nil;
-+ (void) initialize {
-  if (self == [PBFieldDescriptorProto class]) {
-    defaultPBFieldDescriptorProtoInstance = [[PBFieldDescriptorProto alloc] init];
-  }
-}
 + (PBFieldDescriptorProto*) defaultInstance {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultPBFieldDescriptorProtoInstance = [[PBFieldDescriptorProto alloc] init];
+  });
   return defaultPBFieldDescriptorProtoInstance;
 }
 - (PBFieldDescriptorProto*) defaultInstance {
-  return defaultPBFieldDescriptorProtoInstance;
+  return [PBFieldDescriptorProto defaultInstance];
+}
+- (void) setInitialized {
+  hasBits_[0] |= 0x100u;
 }
 - (BOOL) isInitialized {
-  if (self.hasOptions) {
-    if (!self.options.isInitialized) {
+  if ((hasBits_[0] & 0x100u) != 0) {
+    return YES;
+  }
+  if ((hasBits_[0] & 0x80u) != 0) {
+    if (!options.isInitialized) {
       return NO;
     }
   }
   return YES;
 }
 - (void) writeToCodedOutputStream:(PBCodedOutputStream*) output {
-  if (self.hasName) {
-    [output writeString:1 value:self.name];
+  if (hasBits_[0] & 0x1u) {
+    [output writeString:1 value:name];
   }
-  if (self.hasExtendee) {
-    [output writeString:2 value:self.extendee];
+  if (hasBits_[0] & 0x20u) {
+    [output writeString:2 value:extendee];
   }
-  if (self.hasNumber) {
-    [output writeInt32:3 value:self.number];
+  if (hasBits_[0] & 0x2u) {
+    [output writeInt32:3 value:number];
   }
-  if (self.hasLabel) {
-    [output writeEnum:4 value:self.label];
+  if (hasBits_[0] & 0x4u) {
+    [output writeEnum:4 value:label];
   }
-  if (self.hasType) {
-    [output writeEnum:5 value:self.type];
+  if (hasBits_[0] & 0x8u) {
+    [output writeEnum:5 value:type];
   }
-  if (self.hasTypeName) {
-    [output writeString:6 value:self.typeName];
+  if (hasBits_[0] & 0x10u) {
+    [output writeString:6 value:typeName];
   }
-  if (self.hasDefaultValue) {
-    [output writeString:7 value:self.defaultValue];
+  if (hasBits_[0] & 0x40u) {
+    [output writeString:7 value:defaultValue];
   }
-  if (self.hasOptions) {
-    [output writeMessage:8 value:self.options];
+  if (hasBits_[0] & 0x80u) {
+    [output writeMessage:8 value:options];
   }
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = PBGeneratedMessageGetMemoizedSize(&memoizedSerializedSize);
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
-  if (self.hasName) {
-    size += computeStringSize(1, self.name);
+  size_ = 0;
+  if (hasBits_[0] & 0x1u) {
+    size_ += computeStringSize(1, name);
   }
-  if (self.hasExtendee) {
-    size += computeStringSize(2, self.extendee);
+  if (hasBits_[0] & 0x20u) {
+    size_ += computeStringSize(2, extendee);
   }
-  if (self.hasNumber) {
-    size += computeInt32Size(3, self.number);
+  if (hasBits_[0] & 0x2u) {
+    size_ += computeInt32Size(3, number);
   }
-  if (self.hasLabel) {
-    size += computeEnumSize(4, self.label);
+  if (hasBits_[0] & 0x4u) {
+    size_ += computeEnumSize(4, label);
   }
-  if (self.hasType) {
-    size += computeEnumSize(5, self.type);
+  if (hasBits_[0] & 0x8u) {
+    size_ += computeEnumSize(5, type);
   }
-  if (self.hasTypeName) {
-    size += computeStringSize(6, self.typeName);
+  if (hasBits_[0] & 0x10u) {
+    size_ += computeStringSize(6, typeName);
   }
-  if (self.hasDefaultValue) {
-    size += computeStringSize(7, self.defaultValue);
+  if (hasBits_[0] & 0x40u) {
+    size_ += computeStringSize(7, defaultValue);
   }
-  if (self.hasOptions) {
-    size += computeMessageSize(8, self.options);
+  if (hasBits_[0] & 0x80u) {
+    size_ += computeMessageSize(8, options);
   }
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
+  size_ += self.unknownFields.serializedSize;
+  PBGeneratedMessageSetMemoizedSize(&memoizedSerializedSize, size_);
+  return size_;
 }
 + (PBFieldDescriptorProto*) parseFromData:(NSData*) data {
   return (PBFieldDescriptorProto*)[[[PBFieldDescriptorProto builder] mergeFromData:data] build];
@@ -1765,11 +2997,107 @@ static PBFieldDescriptorProto* defaultPBFieldDescriptorProtoInstance = nil;
   return [[[PBFieldDescriptorProto_Builder alloc] init] autorelease];
 }
 + (PBFieldDescriptorProto_Builder*) builderWithPrototype:(PBFieldDescriptorProto*) prototype {
-  return [[PBFieldDescriptorProto builder] mergeFrom:prototype];
+  return [[[PBFieldDescriptorProto_Builder alloc] initWithPrototype:prototype] autorelease];
 }
 - (PBFieldDescriptorProto_Builder*) builder {
   return [PBFieldDescriptorProto builder];
 }
+- (PBFieldDescriptorProto_Builder*) toBuilder {
+  return [PBFieldDescriptorProto builderWithPrototype:self];
+}
+- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
+  if (hasBits_[0] & 0x1u) {
+    [output appendFormat:@"%@%@: %@\n", indent, @"name", name];
+  }
+  if (hasBits_[0] & 0x20u) {
+    [output appendFormat:@"%@%@: %@\n", indent, @"extendee", extendee];
+  }
+  if (hasBits_[0] & 0x2u) {
+    [output appendFormat:@"%@%@: %@\n", indent, @"number", [NSNumber numberWithInt:number]];
+  }
+  if (hasBits_[0] & 0x4u) {
+    [output appendFormat:@"%@%@: %d\n", indent, @"label", label];
+  }
+  if (hasBits_[0] & 0x8u) {
+    [output appendFormat:@"%@%@: %d\n", indent, @"type", type];
+  }
+  if (hasBits_[0] & 0x10u) {
+    [output appendFormat:@"%@%@: %@\n", indent, @"typeName", typeName];
+  }
+  if (hasBits_[0] & 0x40u) {
+    [output appendFormat:@"%@%@: %@\n", indent, @"defaultValue", defaultValue];
+  }
+  if (hasBits_[0] & 0x80u) {
+    [output appendFormat:@"%@%@ {\n", indent, @"options"];
+    [options writeDescriptionTo:output
+                         withIndent:[NSString stringWithFormat:@"%@  ", indent]];
+    [output appendFormat:@"%@}\n", indent];
+  }
+  [self.unknownFields writeDescriptionTo:output withIndent:indent];
+}
+- (BOOL) isEqual:(id)other {
+  if (other == self) {
+    return YES;
+  }
+  if (![other isKindOfClass:[PBFieldDescriptorProto class]]) {
+    return NO;
+  }
+  PBFieldDescriptorProto *otherMessage = other;
+  return
+      (hasBits_[0] & 0x1u) == (otherMessage->hasBits_[0] & 0x1u) &&
+      (!(hasBits_[0] & 0x1u) || [name isEqual:otherMessage->name]) &&
+      (hasBits_[0] & 0x20u) == (otherMessage->hasBits_[0] & 0x20u) &&
+      (!(hasBits_[0] & 0x20u) || [extendee isEqual:otherMessage->extendee]) &&
+      (hasBits_[0] & 0x2u) == (otherMessage->hasBits_[0] & 0x2u) &&
+      (!(hasBits_[0] & 0x2u) || number == otherMessage->number) &&
+      (hasBits_[0] & 0x4u) == (otherMessage->hasBits_[0] & 0x4u) &&
+      (!(hasBits_[0] & 0x4u) || label == otherMessage->label) &&
+      (hasBits_[0] & 0x8u) == (otherMessage->hasBits_[0] & 0x8u) &&
+      (!(hasBits_[0] & 0x8u) || type == otherMessage->type) &&
+      (hasBits_[0] & 0x10u) == (otherMessage->hasBits_[0] & 0x10u) &&
+      (!(hasBits_[0] & 0x10u) || [typeName isEqual:otherMessage->typeName]) &&
+      (hasBits_[0] & 0x40u) == (otherMessage->hasBits_[0] & 0x40u) &&
+      (!(hasBits_[0] & 0x40u) || [defaultValue isEqual:otherMessage->defaultValue]) &&
+      (hasBits_[0] & 0x80u) == (otherMessage->hasBits_[0] & 0x80u) &&
+      (!(hasBits_[0] & 0x80u) || [options isEqual:otherMessage->options]) &&
+      (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
+}
+- (NSUInteger) hash {
+  NSUInteger hash_ = PBGeneratedMessageGetMemoizedHash(&memoizedHash);
+  if (hash_ != 0) {
+    return hash_;
+  }
+
+  uint64_t hashCode = 7;
+  if (hasBits_[0] & 0x1u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [name hash]);
+  }
+  if (hasBits_[0] & 0x20u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [extendee hash]);
+  }
+  if (hasBits_[0] & 0x2u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, (uint64_t)number);
+  }
+  if (hasBits_[0] & 0x4u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, (uint64_t)label);
+  }
+  if (hasBits_[0] & 0x8u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, (uint64_t)type);
+  }
+  if (hasBits_[0] & 0x10u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [typeName hash]);
+  }
+  if (hasBits_[0] & 0x40u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [defaultValue hash]);
+  }
+  if (hasBits_[0] & 0x80u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [options hash]);
+  }
+  hashCode = PBGeneratedMessageHashMix(hashCode, [self.unknownFields hash]);
+  hash_ = PBGeneratedMessageHashFinish(hashCode);
+  PBGeneratedMessageSetMemoizedHash(&memoizedHash, hash_);
+  return hash_;
+}
 @end
 
 BOOL PBFieldDescriptorProto_TypeIsValidValue(PBFieldDescriptorProto_Type value) {
@@ -1807,71 +3135,165 @@ BOOL PBFieldDescriptorProto_LabelIsValidValue(PBFieldDescriptorProto_Label value
       return NO;
   }
 }
-@interface PBFieldDescriptorProto_Builder()
-@property (retain) PBFieldDescriptorProto* result;
-@end
-
 @implementation PBFieldDescriptorProto_Builder
 @synthesize result;
 - (void) dealloc {
+  [self dropSubBuilders];
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
   self.result = nil;
+  [prototype_ release];
   [super dealloc];
 }
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[[PBFieldDescriptorProto alloc] init] autorelease];
+    result = [PBFieldDescriptorProto recycledInstance];
+  }
+  return self;
+}
+- (id) initWithPrototype:(PBFieldDescriptorProto*) prototype {
+  if ((self = [super init])) {
+    self.result = prototype;
+    prototype_ = [prototype retain];
   }
   return self;
 }
+- (void) detachFromPrototype {
+  PBFieldDescriptorProto* prototype = prototype_;
+  prototype_ = nil;
+  self.result = [[[PBFieldDescriptorProto alloc] init] autorelease];
+  [self mergeFrom:prototype];
+  [prototype release];
+}
+- (PBGeneratedMessage*) internalGetMutableResult {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return [self internalGetResult];
+}
+- (void) freezeSubBuilders {
+  if (optionsBuilder_ != nil) {
+    PBFieldOptions* value = [optionsBuilder_ newBuildPartial];
+    result.options = value;
+    [value release];
+    [optionsBuilder_ release];
+    optionsBuilder_ = nil;
+  }
+}
+- (void) dropSubBuilders {
+  [optionsBuilder_ release];
+  optionsBuilder_ = nil;
+  [optionsSpareBuilder_ release];
+  optionsSpareBuilder_ = nil;
+}
+- (void) resetSubBuilders {
+  if (optionsBuilder_ != nil) {
+    [optionsBuilder_ reset];
+    [optionsSpareBuilder_ release];
+    optionsSpareBuilder_ = optionsBuilder_;
+    optionsBuilder_ = nil;
+  }
+}
 - (PBGeneratedMessage*) internalGetResult {
+  [self freezeSubBuilders];
   return result;
 }
 - (PBFieldDescriptorProto_Builder*) clear {
-  self.result = [[[PBFieldDescriptorProto alloc] init] autorelease];
+  [self dropSubBuilders];
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = [[PBFieldDescriptorProto recycledInstance] autorelease];
   return self;
 }
 - (PBFieldDescriptorProto_Builder*) clone {
-  return [PBFieldDescriptorProto builderWithPrototype:result];
+  if (prototype_ != nil) {
+    return [[[PBFieldDescriptorProto_Builder alloc] initWithPrototype:prototype_] autorelease];
+  }
+  [self freezeSubBuilders];
+  return [[PBFieldDescriptorProto builder] mergeFrom:result];
+}
+- (PBFieldDescriptorProto_Builder*) reset {
+  [self resetSubBuilders];
+  if (result == nil || prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    self.result = [[PBFieldDescriptorProto recycledInstance] autorelease];
+  } else {
+    [result clearForReuse];
+  }
+  return self;
+}
+- (PBFieldDescriptorProto_Builder*) recycle:(PBFieldDescriptorProto*) message {
+  if (message == [PBFieldDescriptorProto defaultInstance]) {
+    @throw [NSException exceptionWithName:@"IllegalArgument" reason:@"Cannot recycle the default instance" userInfo:nil];
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = message;
+  return [self reset];
 }
 - (PBFieldDescriptorProto*) defaultInstance {
   return [PBFieldDescriptorProto defaultInstance];
 }
 - (PBFieldDescriptorProto*) build {
   [self checkInitialized];
-  return [self buildPartial];
+  BOOL shared = prototype_ != nil;
+  PBFieldDescriptorProto* returnMe = [self buildPartial];
+  if (!shared) {
+    [returnMe setInitialized];
+  }
+  return returnMe;
 }
 - (PBFieldDescriptorProto*) buildPartial {
-  PBFieldDescriptorProto* returnMe = [[result retain] autorelease];
-  self.result = nil;
+  return [[self newBuildPartial] autorelease];
+}
+- (PBFieldDescriptorProto*) newBuildPartial {
+  if (prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    PBFieldDescriptorProto* returnMe = result;
+    result = nil;
+    return returnMe;
+  }
+  [self freezeSubBuilders];
+  PBFieldDescriptorProto* returnMe = result;
+  result = nil;
   return returnMe;
 }
 - (PBFieldDescriptorProto_Builder*) mergeFrom:(PBFieldDescriptorProto*) other {
   if (other == [PBFieldDescriptorProto defaultInstance]) {
     return self;
   }
-  if (other.hasName) {
-    [self setName:other.name];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (other->hasBits_[0] & 0x1u) {
+    [self setName:other->name];
   }
-  if (other.hasNumber) {
-    [self setNumber:other.number];
+  if (other->hasBits_[0] & 0x2u) {
+    [self setNumber:other->number];
   }
-  if (other.hasLabel) {
-    [self setLabel:other.label];
+  if (other->hasBits_[0] & 0x4u) {
+    [self setLabel:other->label];
   }
-  if (other.hasType) {
-    [self setType:other.type];
+  if (other->hasBits_[0] & 0x8u) {
+    [self setType:other->type];
   }
-  if (other.hasTypeName) {
-    [self setTypeName:other.typeName];
+  if (other->hasBits_[0] & 0x10u) {
+    [self setTypeName:other->typeName];
   }
-  if (other.hasExtendee) {
-    [self setExtendee:other.extendee];
+  if (other->hasBits_[0] & 0x20u) {
+    [self setExtendee:other->extendee];
   }
-  if (other.hasDefaultValue) {
-    [self setDefaultValue:other.defaultValue];
+  if (other->hasBits_[0] & 0x40u) {
+    [self setDefaultValue:other->defaultValue];
   }
-  if (other.hasOptions) {
-    [self mergeOptions:other.options];
+  if (other->hasBits_[0] & 0x80u) {
+    [self mergeOptions:other->options];
   }
   [self mergeUnknownFields:other.unknownFields];
   return self;
@@ -1880,26 +3302,41 @@ BOOL PBFieldDescriptorProto_LabelIsValidValue(PBFieldDescriptorProto_Label value
   return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
 }
 - (PBFieldDescriptorProto_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  PBUnknownFieldSet_Builder* unknownFields = nil;
   while (YES) {
     int32_t tag = [input readTag];
     switch (tag) {
       case 0:
-        [self setUnknownFields:[unknownFields build]];
+        if (unknownFields != nil) {
+          [self setUnknownFields:[unknownFields build]];
+        }
         return self;
       default: {
-        if (![self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag]) {
-          [self setUnknownFields:[unknownFields build]];
+        if (PBWireFormatGetTagWireType(tag) == PBWireFormatEndGroup) {
+          if (unknownFields != nil) {
+            [self setUnknownFields:[unknownFields build]];
+          }
           return self;
         }
+        if (unknownFields == nil) {
+          unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+        }
+        [self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag];
         break;
       }
       case 10: {
-        [self setName:[input readString]];
+        NSString* value = [input newString];
+        [self setName:value];
+        [value release];
         break;
       }
       case 18: {
-        [self setExtendee:[input readString]];
+        NSString* value = [input newString];
+        [self setExtendee:value];
+        [value release];
         break;
       }
       case 24: {
@@ -1911,6 +3348,9 @@ BOOL PBFieldDescriptorProto_LabelIsValidValue(PBFieldDescriptorProto_Label value
         if (PBFieldDescriptorProto_LabelIsValidValue(value)) {
           [self setLabel:value];
         } else {
+          if (unknownFields == nil) {
+            unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+          }
           [unknownFields mergeVarintField:4 value:value];
         }
         break;
@@ -1920,150 +3360,212 @@ BOOL PBFieldDescriptorProto_LabelIsValidValue(PBFieldDescriptorProto_Label value
         if (PBFieldDescriptorProto_TypeIsValidValue(value)) {
           [self setType:value];
         } else {
+          if (unknownFields == nil) {
+            unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+          }
           [unknownFields mergeVarintField:5 value:value];
         }
         break;
       }
       case 50: {
-        [self setTypeName:[input readString]];
+        NSString* value = [input newString];
+        [self setTypeName:value];
+        [value release];
         break;
       }
       case 58: {
-        [self setDefaultValue:[input readString]];
+        NSString* value = [input newString];
+        [self setDefaultValue:value];
+        [value release];
         break;
       }
       case 66: {
-        PBFieldOptions_Builder* subBuilder = [PBFieldOptions builder];
-        if (self.hasOptions) {
-          [subBuilder mergeFrom:self.options];
+        if (optionsBuilder_ == nil) {
+          optionsBuilder_ = optionsSpareBuilder_ != nil ? optionsSpareBuilder_ : [[PBFieldOptions_Builder alloc] init];
+          optionsSpareBuilder_ = nil;
+          if (result->hasBits_[0] & 0x80u) {
+            [optionsBuilder_ mergeFrom:result->options];
+          }
+          result->hasBits_[0] |= 0x80u;
         }
-        [input readMessage:subBuilder extensionRegistry:extensionRegistry];
-        [self setOptions:[subBuilder buildPartial]];
+        [input readMessage:optionsBuilder_ extensionRegistry:extensionRegistry];
         break;
       }
     }
   }
 }
 - (BOOL) hasName {
-  return result.hasName;
+  return (result->hasBits_[0] & 0x1u) != 0;
 }
 - (NSString*) name {
-  return result.name;
+  return [result name];
 }
 - (PBFieldDescriptorProto_Builder*) setName:(NSString*) value {
-  result.hasName = YES;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x1u;
   result.name = value;
   return self;
 }
 - (PBFieldDescriptorProto_Builder*) clearName {
-  result.hasName = NO;
-  result.name = @"";
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x1u;
+  [result->name release];
+  result->name = nil;
   return self;
 }
 - (BOOL) hasNumber {
-  return result.hasNumber;
+  return (result->hasBits_[0] & 0x2u) != 0;
 }
 - (int32_t) number {
-  return result.number;
+  return result->number;
 }
 - (PBFieldDescriptorProto_Builder*) setNumber:(int32_t) value {
-  result.hasNumber = YES;
-  result.number = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x2u;
+  result->number = value;
   return self;
 }
 - (PBFieldDescriptorProto_Builder*) clearNumber {
-  result.hasNumber = NO;
-  result.number = 0;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x2u;
+  result->number = 0;
   return self;
 }
 - (BOOL) hasLabel {
-  return result.hasLabel;
+  return (result->hasBits_[0] & 0x4u) != 0;
 }
 - (PBFieldDescriptorProto_Label) label {
-  return result.label;
+  return (result->hasBits_[0] & 0x4u) ? result->label : PBFieldDescriptorProto_LabelLabelOptional;
 }
 - (PBFieldDescriptorProto_Builder*) setLabel:(PBFieldDescriptorProto_Label) value {
-  result.hasLabel = YES;
-  result.label = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x4u;
+  result->label = value;
   return self;
 }
 - (PBFieldDescriptorProto_Builder*) clearLabel {
-  result.hasLabel = NO;
-  result.label = PBFieldDescriptorProto_LabelLabelOptional;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x4u;
+  result->label = 0;
   return self;
 }
 - (BOOL) hasType {
-  return result.hasType;
+  return (result->hasBits_[0] & 0x8u) != 0;
 }
 - (PBFieldDescriptorProto_Type) type {
-  return result.type;
+  return (result->hasBits_[0] & 0x8u) ? result->type : PBFieldDescriptorProto_TypeTypeDouble;
 }
 - (PBFieldDescriptorProto_Builder*) setType:(PBFieldDescriptorProto_Type) value {
-  result.hasType = YES;
-  result.type = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x8u;
+  result->type = value;
   return self;
 }
 - (PBFieldDescriptorProto_Builder*) clearType {
-  result.hasType = NO;
-  result.type = PBFieldDescriptorProto_TypeTypeDouble;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x8u;
+  result->type = 0;
   return self;
 }
 - (BOOL) hasTypeName {
-  return result.hasTypeName;
+  return (result->hasBits_[0] & 0x10u) != 0;
 }
 - (NSString*) typeName {
-  return result.typeName;
+  return [result typeName];
 }
 - (PBFieldDescriptorProto_Builder*) setTypeName:(NSString*) value {
-  result.hasTypeName = YES;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x10u;
   result.typeName = value;
   return self;
 }
 - (PBFieldDescriptorProto_Builder*) clearTypeName {
-  result.hasTypeName = NO;
-  result.typeName = @"";
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x10u;
+  [result->typeName release];
+  result->typeName = nil;
   return self;
 }
 - (BOOL) hasExtendee {
-  return result.hasExtendee;
+  return (result->hasBits_[0] & 0x20u) != 0;
 }
 - (NSString*) extendee {
-  return result.extendee;
+  return [result extendee];
 }
 - (PBFieldDescriptorProto_Builder*) setExtendee:(NSString*) value {
-  result.hasExtendee = YES;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x20u;
   result.extendee = value;
   return self;
 }
 - (PBFieldDescriptorProto_Builder*) clearExtendee {
-  result.hasExtendee = NO;
-  result.extendee = @"";
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x20u;
+  [result->extendee release];
+  result->extendee = nil;
   return self;
 }
 - (BOOL) hasDefaultValue {
-  return result.hasDefaultValue;
+  return (result->hasBits_[0] & 0x40u) != 0;
 }
 - (NSString*) defaultValue {
-  return result.defaultValue;
+  return [result defaultValue];
 }
 - (PBFieldDescriptorProto_Builder*) setDefaultValue:(NSString*) value {
-  result.hasDefaultValue = YES;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x40u;
   result.defaultValue = value;
   return self;
 }
 - (PBFieldDescriptorProto_Builder*) clearDefaultValue {
-  result.hasDefaultValue = NO;
-  result.defaultValue = @"";
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x40u;
+  [result->defaultValue release];
+  result->defaultValue = nil;
   return self;
 }
 - (BOOL) hasOptions {
-  return result.hasOptions;
+  return (result->hasBits_[0] & 0x80u) != 0;
 }
 - (PBFieldOptions*) options {
+  [self freezeSubBuilders];
   return result.options;
 }
 - (PBFieldDescriptorProto_Builder*) setOptions:(PBFieldOptions*) value {
-  result.hasOptions = YES;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  [optionsBuilder_ release];
+  optionsBuilder_ = nil;
+  result->hasBits_[0] |= 0x80u;
   result.options = value;
   return self;
 }
@@ -2071,122 +3573,166 @@ BOOL PBFieldDescriptorProto_LabelIsValidValue(PBFieldDescriptorProto_Label value
   return [self setOptions:[builderForValue build]];
 }
 - (PBFieldDescriptorProto_Builder*) mergeOptions:(PBFieldOptions*) value {
-  if (result.hasOptions &&
-      result.options != [PBFieldOptions defaultInstance]) {
-    result.options =
-      [[[PBFieldOptions builderWithPrototype:result.options] mergeFrom:value] buildPartial];
-  } else {
-    result.options = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (optionsBuilder_ == nil) {
+    if (!(result->hasBits_[0] & 0x80u) ||
+        result->options == [PBFieldOptions defaultInstance]) {
+      result->hasBits_[0] |= 0x80u;
+      result.options = value;
+      return self;
+    }
+    optionsBuilder_ = optionsSpareBuilder_ != nil ? optionsSpareBuilder_ : [[PBFieldOptions_Builder alloc] init];
+    optionsSpareBuilder_ = nil;
+    [optionsBuilder_ mergeFrom:result->options];
   }
-  result.hasOptions = YES;
+  [optionsBuilder_ mergeFrom:value];
   return self;
 }
 - (PBFieldDescriptorProto_Builder*) clearOptions {
-  result.hasOptions = NO;
-  result.options = [PBFieldOptions defaultInstance];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  [optionsBuilder_ release];
+  optionsBuilder_ = nil;
+  result->hasBits_[0] &= ~0x80u;
+  [result->options release];
+  result->options = nil;
   return self;
 }
 @end
 
 @interface PBEnumDescriptorProto ()
-@property (retain) NSString* name;
-@property (retain) NSMutableArray* mutableValueList;
-@property (retain) PBEnumOptions* options;
+@property (nonatomic, retain) NSString* name;
+@property (nonatomic, retain) PBObjectArray * valueArray;
+@property (nonatomic, retain) PBEnumOptions* options;
+- (void) setInitialized;
+@end
+
+@interface PBEnumDescriptorProto_Builder()
+@property (nonatomic, retain) PBEnumDescriptorProto* result;
+- (id) initWithPrototype:(PBEnumDescriptorProto*) prototype;
+- (void) detachFromPrototype;
+- (void) freezeSubBuilders;
+- (void) dropSubBuilders;
+- (void) resetSubBuilders;
 @end
 
 @implementation PBEnumDescriptorProto
 
 - (BOOL) hasName {
-  return !!hasName_;
+  return (hasBits_[0] & 0x1u) != 0;
 }
-- (void) setHasName:(BOOL) value {
-  hasName_ = !!value;
+- (void) setHasName:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x1u;
+  } else {
+    hasBits_[0] &= ~0x1u;
+  }
 }
 @synthesize name;
-@synthesize mutableValueList;
+- (NSString*) name {
+  return (hasBits_[0] & 0x1u) ? name : @"";
+}
+@synthesize valueArray;
+@dynamic value;
 - (BOOL) hasOptions {
-  return !!hasOptions_;
+  return (hasBits_[0] & 0x2u) != 0;
 }
-- (void) setHasOptions:(BOOL) value {
-  hasOptions_ = !!value;
+- (void) setHasOptions:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x2u;
+  } else {
+    hasBits_[0] &= ~0x2u;
+  }
 }
 @synthesize options;
+- (PBEnumOptions*) options {
+  return options != nil ? options : [PBEnumOptions defaultInstance];
+}
 - (void) dealloc {
-  self.name = nil;
-  self.mutableValueList = nil;
-  self.options = nil;
+  [name release];
+  [valueArray release];
+  [options release];
   [super dealloc];
 }
-- (id) init {
-  if ((self = [super init])) {
-    self.name = @"";
-    self.options = [PBEnumOptions defaultInstance];
-  }
-  return self;
+- (void) clearForReuse {
+  [super clearForReuse];
+  memset(hasBits_, 0, sizeof(hasBits_));
+  [name release];
+  name = nil;
+  valueArray = PBAppendableArrayReuse(valueArray);
+  [options release];
+  options = nil;
 }
 static PBEnumDescriptorProto* defaultPBEnumDescriptorProtoInstance = nil;
-+ (void) initialize {
-  if (self == [PBEnumDescriptorProto class]) {
-    defaultPBEnumDescriptorProtoInstance = [[PBEnumDescriptorProto alloc] init];
-  }
-}
 + (PBEnumDescriptorProto*) defaultInstance {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultPBEnumDescriptorProtoInstance = [[PBEnumDescriptorProto alloc] init];
+  });
   return defaultPBEnumDescriptorProtoInstance;
 }
 - (PBEnumDescriptorProto*) defaultInstance {
-  return defaultPBEnumDescriptorProtoInstance;
+  return [PBEnumDescriptorProto defaultInstance];
 }
-- (NSArray*) valueList {
-  return mutableValueList;
+- (PBArray *)value {
+  return valueArray;
 }
-- (PBEnumValueDescriptorProto*) valueAtIndex:(int32_t) index {
-  id value = [mutableValueList objectAtIndex:index];
-  return value;
+- (PBEnumValueDescriptorProto*)valueAtIndex:(NSUInteger)index {
+  return PBObjectArrayValueAtIndex(valueArray, index);
+}
+- (void) setInitialized {
+  hasBits_[0] |= 0x4u;
 }
 - (BOOL) isInitialized {
-  for (PBEnumValueDescriptorProto* element in self.valueList) {
+  if ((hasBits_[0] & 0x4u) != 0) {
+    return YES;
+  }
+  for (PBEnumValueDescriptorProto* element in valueArray) {
     if (!element.isInitialized) {
       return NO;
     }
   }
-  if (self.hasOptions) {
-    if (!self.options.isInitialized) {
+  if ((hasBits_[0] & 0x2u) != 0) {
+    if (!options.isInitialized) {
       return NO;
     }
   }
   return YES;
 }
 - (void) writeToCodedOutputStream:(PBCodedOutputStream*) output {
-  if (self.hasName) {
-    [output writeString:1 value:self.name];
+  if (hasBits_[0] & 0x1u) {
+    [output writeString:1 value:name];
   }
-  for (PBEnumValueDescriptorProto* element in self.valueList) {
+  for (PBEnumValueDescriptorProto *element in valueArray) {
     [output writeMessage:2 value:element];
   }
-  if (self.hasOptions) {
-    [output writeMessage:3 value:self.options];
+  if (hasBits_[0] & 0x2u) {
+    [output writeMessage:3 value:options];
   }
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = PBGeneratedMessageGetMemoizedSize(&memoizedSerializedSize);
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
-  if (self.hasName) {
-    size += computeStringSize(1, self.name);
+  size_ = 0;
+  if (hasBits_[0] & 0x1u) {
+    size_ += computeStringSize(1, name);
   }
-  for (PBEnumValueDescriptorProto* element in self.valueList) {
-    size += computeMessageSize(2, element);
+  for (PBEnumValueDescriptorProto *element in valueArray) {
+    size_ += computeMessageSize(2, element);
   }
-  if (self.hasOptions) {
-    size += computeMessageSize(3, self.options);
+  if (hasBits_[0] & 0x2u) {
+    size_ += computeMessageSize(3, options);
   }
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
+  size_ += self.unknownFields.serializedSize;
+  PBGeneratedMessageSetMemoizedSize(&memoizedSerializedSize, size_);
+  return size_;
 }
 + (PBEnumDescriptorProto*) parseFromData:(NSData*) data {
   return (PBEnumDescriptorProto*)[[[PBEnumDescriptorProto builder] mergeFromData:data] build];
@@ -2210,66 +3756,220 @@ static PBEnumDescriptorProto* defaultPBEnumDescriptorProtoInstance = nil;
   return [[[PBEnumDescriptorProto_Builder alloc] init] autorelease];
 }
 + (PBEnumDescriptorProto_Builder*) builderWithPrototype:(PBEnumDescriptorProto*) prototype {
-  return [[PBEnumDescriptorProto builder] mergeFrom:prototype];
+  return [[[PBEnumDescriptorProto_Builder alloc] initWithPrototype:prototype] autorelease];
 }
 - (PBEnumDescriptorProto_Builder*) builder {
   return [PBEnumDescriptorProto builder];
 }
-@end
+- (PBEnumDescriptorProto_Builder*) toBuilder {
+  return [PBEnumDescriptorProto builderWithPrototype:self];
+}
+- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
+  if (hasBits_[0] & 0x1u) {
+    [output appendFormat:@"%@%@: %@\n", indent, @"name", name];
+  }
+  for (PBEnumValueDescriptorProto* element in valueArray) {
+    [output appendFormat:@"%@%@ {\n", indent, @"value"];
+    [element writeDescriptionTo:output
+                     withIndent:[NSString stringWithFormat:@"%@  ", indent]];
+    [output appendFormat:@"%@}\n", indent];
+  }
+  if (hasBits_[0] & 0x2u) {
+    [output appendFormat:@"%@%@ {\n", indent, @"options"];
+    [options writeDescriptionTo:output
+                         withIndent:[NSString stringWithFormat:@"%@  ", indent]];
+    [output appendFormat:@"%@}\n", indent];
+  }
+  [self.unknownFields writeDescriptionTo:output withIndent:indent];
+}
+- (BOOL) isEqual:(id)other {
+  if (other == self) {
+    return YES;
+  }
+  if (![other isKindOfClass:[PBEnumDescriptorProto class]]) {
+    return NO;
+  }
+  PBEnumDescriptorProto *otherMessage = other;
+  return
+      (hasBits_[0] & 0x1u) == (otherMessage->hasBits_[0] & 0x1u) &&
+      (!(hasBits_[0] & 0x1u) || [name isEqual:otherMessage->name]) &&
+      (valueArray.count == 0 ? otherMessage->valueArray.count == 0 : [valueArray isEqualToArray:otherMessage->valueArray]) &&
+      (hasBits_[0] & 0x2u) == (otherMessage->hasBits_[0] & 0x2u) &&
+      (!(hasBits_[0] & 0x2u) || [options isEqual:otherMessage->options]) &&
+      (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
+}
+- (NSUInteger) hash {
+  NSUInteger hash_ = PBGeneratedMessageGetMemoizedHash(&memoizedHash);
+  if (hash_ != 0) {
+    return hash_;
+  }
 
-@interface PBEnumDescriptorProto_Builder()
-@property (retain) PBEnumDescriptorProto* result;
+  uint64_t hashCode = 7;
+  if (hasBits_[0] & 0x1u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [name hash]);
+  }
+  for (PBEnumValueDescriptorProto* element in valueArray) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [element hash]);
+  }
+  if (hasBits_[0] & 0x2u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [options hash]);
+  }
+  hashCode = PBGeneratedMessageHashMix(hashCode, [self.unknownFields hash]);
+  hash_ = PBGeneratedMessageHashFinish(hashCode);
+  PBGeneratedMessageSetMemoizedHash(&memoizedHash, hash_);
+  return hash_;
+}
 @end
 
 @implementation PBEnumDescriptorProto_Builder
 @synthesize result;
 - (void) dealloc {
+  [self dropSubBuilders];
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
   self.result = nil;
+  [prototype_ release];
   [super dealloc];
 }
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[[PBEnumDescriptorProto alloc] init] autorelease];
+    result = [PBEnumDescriptorProto recycledInstance];
+  }
+  return self;
+}
+- (id) initWithPrototype:(PBEnumDescriptorProto*) prototype {
+  if ((self = [super init])) {
+    self.result = prototype;
+    prototype_ = [prototype retain];
   }
   return self;
 }
+- (void) detachFromPrototype {
+  PBEnumDescriptorProto* prototype = prototype_;
+  prototype_ = nil;
+  self.result = [[[PBEnumDescriptorProto alloc] init] autorelease];
+  [self mergeFrom:prototype];
+  [prototype release];
+}
+- (PBGeneratedMessage*) internalGetMutableResult {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return [self internalGetResult];
+}
+- (void) freezeSubBuilders {
+  if (optionsBuilder_ != nil) {
+    PBEnumOptions* value = [optionsBuilder_ newBuildPartial];
+    result.options = value;
+    [value release];
+    [optionsBuilder_ release];
+    optionsBuilder_ = nil;
+  }
+}
+- (void) dropSubBuilders {
+  [optionsBuilder_ release];
+  optionsBuilder_ = nil;
+  [optionsSpareBuilder_ release];
+  optionsSpareBuilder_ = nil;
+}
+- (void) resetSubBuilders {
+  if (optionsBuilder_ != nil) {
+    [optionsBuilder_ reset];
+    [optionsSpareBuilder_ release];
+    optionsSpareBuilder_ = optionsBuilder_;
+    optionsBuilder_ = nil;
+  }
+}
 - (PBGeneratedMessage*) internalGetResult {
+  [self freezeSubBuilders];
   return result;
 }
 - (PBEnumDescriptorProto_Builder*) clear {
-  self.result = [[[PBEnumDescriptorProto alloc] init] autorelease];
+  [self dropSubBuilders];
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = [[PBEnumDescriptorProto recycledInstance] autorelease];
   return self;
 }
 - (PBEnumDescriptorProto_Builder*) clone {
-  return [PBEnumDescriptorProto builderWithPrototype:result];
+  if (prototype_ != nil) {
+    return [[[PBEnumDescriptorProto_Builder alloc] initWithPrototype:prototype_] autorelease];
+  }
+  [self freezeSubBuilders];
+  return [[PBEnumDescriptorProto builder] mergeFrom:result];
+}
+- (PBEnumDescriptorProto_Builder*) reset {
+  [self resetSubBuilders];
+  if (result == nil || prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    self.result = [[PBEnumDescriptorProto recycledInstance] autorelease];
+  } else {
+    [result clearForReuse];
+  }
+  return self;
+}
+- (PBEnumDescriptorProto_Builder*) recycle:(PBEnumDescriptorProto*) message {
+  if (message == [PBEnumDescriptorProto defaultInstance]) {
+    @throw [NSException exceptionWithName:@"IllegalArgument" reason:@"Cannot recycle the default instance" userInfo:nil];
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = message;
+  return [self reset];
 }
 - (PBEnumDescriptorProto*) defaultInstance {
   return [PBEnumDescriptorProto defaultInstance];
 }
 - (PBEnumDescriptorProto*) build {
   [self checkInitialized];
-  return [self buildPartial];
+  BOOL shared = prototype_ != nil;
+  PBEnumDescriptorProto* returnMe = [self buildPartial];
+  if (!shared) {
+    [returnMe setInitialized];
+  }
+  return returnMe;
 }
 - (PBEnumDescriptorProto*) buildPartial {
-  PBEnumDescriptorProto* returnMe = [[result retain] autorelease];
-  self.result = nil;
+  return [[self newBuildPartial] autorelease];
+}
+- (PBEnumDescriptorProto*) newBuildPartial {
+  if (prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    PBEnumDescriptorProto* returnMe = result;
+    result = nil;
+    return returnMe;
+  }
+  [self freezeSubBuilders];
+  [result->valueArray shrinkToFit];
+  PBEnumDescriptorProto* returnMe = result;
+  result = nil;
   return returnMe;
 }
 - (PBEnumDescriptorProto_Builder*) mergeFrom:(PBEnumDescriptorProto*) other {
   if (other == [PBEnumDescriptorProto defaultInstance]) {
     return self;
   }
-  if (other.hasName) {
-    [self setName:other.name];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  if (other.mutableValueList.count > 0) {
-    if (result.mutableValueList == nil) {
-      result.mutableValueList = [NSMutableArray array];
+  if (other->hasBits_[0] & 0x1u) {
+    [self setName:other->name];
+  }
+  if (other->valueArray.count > 0) {
+    if (result->valueArray == nil) {
+      result.valueArray = [[other->valueArray copyWithZone:[other->valueArray zone]] autorelease];
+    } else {
+      [result->valueArray appendArray:other->valueArray];
     }
-    [result.mutableValueList addObjectsFromArray:other.mutableValueList];
   }
-  if (other.hasOptions) {
-    [self mergeOptions:other.options];
+  if (other->hasBits_[0] & 0x2u) {
+    [self mergeOptions:other->options];
   }
   [self mergeUnknownFields:other.unknownFields];
   return self;
@@ -2278,95 +3978,141 @@ static PBEnumDescriptorProto* defaultPBEnumDescriptorProtoInstance = nil;
   return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
 }
 - (PBEnumDescriptorProto_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  PBUnknownFieldSet_Builder* unknownFields = nil;
   while (YES) {
     int32_t tag = [input readTag];
     switch (tag) {
       case 0:
-        [self setUnknownFields:[unknownFields build]];
+        if (unknownFields != nil) {
+          [self setUnknownFields:[unknownFields build]];
+        }
         return self;
       default: {
-        if (![self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag]) {
-          [self setUnknownFields:[unknownFields build]];
+        if (PBWireFormatGetTagWireType(tag) == PBWireFormatEndGroup) {
+          if (unknownFields != nil) {
+            [self setUnknownFields:[unknownFields build]];
+          }
           return self;
         }
+        if (unknownFields == nil) {
+          unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+        }
+        [self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag];
         break;
       }
       case 10: {
-        [self setName:[input readString]];
+        NSString* value = [input newString];
+        [self setName:value];
+        [value release];
         break;
       }
       case 18: {
-        PBEnumValueDescriptorProto_Builder* subBuilder = [PBEnumValueDescriptorProto builder];
-        [input readMessage:subBuilder extensionRegistry:extensionRegistry];
-        [self addValue:[subBuilder buildPartial]];
+        PBEnumValueDescriptorProto_Builder* subBuilder = [[PBEnumValueDescriptorProto_Builder alloc] init];
+        @try {
+          [input readMessage:subBuilder extensionRegistry:extensionRegistry];
+          PBEnumValueDescriptorProto* value = [subBuilder newBuildPartial];
+          [self addValue:value];
+          [value release];
+        } @finally {
+          [subBuilder release];
+        }
         break;
       }
       case 26: {
-        PBEnumOptions_Builder* subBuilder = [PBEnumOptions builder];
-        if (self.hasOptions) {
-          [subBuilder mergeFrom:self.options];
+        if (optionsBuilder_ == nil) {
+          optionsBuilder_ = optionsSpareBuilder_ != nil ? optionsSpareBuilder_ : [[PBEnumOptions_Builder alloc] init];
+          optionsSpareBuilder_ = nil;
+          if (result->hasBits_[0] & 0x2u) {
+            [optionsBuilder_ mergeFrom:result->options];
+          }
+          result->hasBits_[0] |= 0x2u;
         }
-        [input readMessage:subBuilder extensionRegistry:extensionRegistry];
-        [self setOptions:[subBuilder buildPartial]];
+        [input readMessage:optionsBuilder_ extensionRegistry:extensionRegistry];
         break;
       }
     }
   }
 }
 - (BOOL) hasName {
-  return result.hasName;
+  return (result->hasBits_[0] & 0x1u) != 0;
 }
 - (NSString*) name {
-  return result.name;
+  return [result name];
 }
 - (PBEnumDescriptorProto_Builder*) setName:(NSString*) value {
-  result.hasName = YES;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x1u;
   result.name = value;
   return self;
 }
 - (PBEnumDescriptorProto_Builder*) clearName {
-  result.hasName = NO;
-  result.name = @"";
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x1u;
+  [result->name release];
+  result->name = nil;
   return self;
 }
-- (NSArray*) valueList {
-  if (result.mutableValueList == nil) { return [NSArray array]; }
-  return result.mutableValueList;
+- (PBAppendableArray *)value {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return result->valueArray;
 }
-- (PBEnumValueDescriptorProto*) valueAtIndex:(int32_t) index {
+- (PBEnumValueDescriptorProto*)valueAtIndex:(NSUInteger)index {
   return [result valueAtIndex:index];
 }
-- (PBEnumDescriptorProto_Builder*) replaceValueAtIndex:(int32_t) index with:(PBEnumValueDescriptorProto*) value {
-  [result.mutableValueList replaceObjectAtIndex:index withObject:value];
+- (PBEnumDescriptorProto_Builder *)addValue:(PBEnumValueDescriptorProto*)value {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (result->valueArray == nil) {
+    result.valueArray = [PBObjectArray array];
+  }
+  PBObjectArrayAddValue(result->valueArray, value);
   return self;
 }
-- (PBEnumDescriptorProto_Builder*) addAllValue:(NSArray*) values {
-  if (result.mutableValueList == nil) {
-    result.mutableValueList = [NSMutableArray array];
+- (PBEnumDescriptorProto_Builder *)setValueArray:(NSArray *)array {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  [result.mutableValueList addObjectsFromArray:values];
+  result.valueArray = [PBObjectArray arrayWithArray:array valueType:PBArrayValueTypeObject];
   return self;
 }
-- (PBEnumDescriptorProto_Builder*) clearValueList {
-  result.mutableValueList = nil;
+- (PBEnumDescriptorProto_Builder *)setValueValues:(const PBEnumValueDescriptorProto* *)values count:(NSUInteger)count {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.valueArray = [PBObjectArray arrayWithValues:values count:count valueType:PBArrayValueTypeObject];
   return self;
 }
-- (PBEnumDescriptorProto_Builder*) addValue:(PBEnumValueDescriptorProto*) value {
-  if (result.mutableValueList == nil) {
-    result.mutableValueList = [NSMutableArray array];
+- (PBEnumDescriptorProto_Builder *)clearValue {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  [result.mutableValueList addObject:value];
+  result.valueArray = nil;
   return self;
 }
 - (BOOL) hasOptions {
-  return result.hasOptions;
+  return (result->hasBits_[0] & 0x2u) != 0;
 }
 - (PBEnumOptions*) options {
+  [self freezeSubBuilders];
   return result.options;
 }
 - (PBEnumDescriptorProto_Builder*) setOptions:(PBEnumOptions*) value {
-  result.hasOptions = YES;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  [optionsBuilder_ release];
+  optionsBuilder_ = nil;
+  result->hasBits_[0] |= 0x2u;
   result.options = value;
   return self;
 }
@@ -2374,116 +4120,163 @@ static PBEnumDescriptorProto* defaultPBEnumDescriptorProtoInstance = nil;
   return [self setOptions:[builderForValue build]];
 }
 - (PBEnumDescriptorProto_Builder*) mergeOptions:(PBEnumOptions*) value {
-  if (result.hasOptions &&
-      result.options != [PBEnumOptions defaultInstance]) {
-    result.options =
-      [[[PBEnumOptions builderWithPrototype:result.options] mergeFrom:value] buildPartial];
-  } else {
-    result.options = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (optionsBuilder_ == nil) {
+    if (!(result->hasBits_[0] & 0x2u) ||
+        result->options == [PBEnumOptions defaultInstance]) {
+      result->hasBits_[0] |= 0x2u;
+      result.options = value;
+      return self;
+    }
+    optionsBuilder_ = optionsSpareBuilder_ != nil ? optionsSpareBuilder_ : [[PBEnumOptions_Builder alloc] init];
+    optionsSpareBuilder_ = nil;
+    [optionsBuilder_ mergeFrom:result->options];
   }
-  result.hasOptions = YES;
+  [optionsBuilder_ mergeFrom:value];
   return self;
 }
 - (PBEnumDescriptorProto_Builder*) clearOptions {
-  result.hasOptions = NO;
-  result.options = [PBEnumOptions defaultInstance];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  [optionsBuilder_ release];
+  optionsBuilder_ = nil;
+  result->hasBits_[0] &= ~0x2u;
+  [result->options release];
+  result->options = nil;
   return self;
 }
 @end
 
 @interface PBEnumValueDescriptorProto ()
-@property (retain) NSString* name;
-@property int32_t number;
-@property (retain) PBEnumValueOptions* options;
+@property (nonatomic, retain) NSString* name;
+@property (nonatomic) int32_t number;
+@property (nonatomic, retain) PBEnumValueOptions* options;
+- (void) setInitialized;
+@end
+
+@interface PBEnumValueDescriptorProto_Builder()
+@property (nonatomic, retain) PBEnumValueDescriptorProto* result;
+- (id) initWithPrototype:(PBEnumValueDescriptorProto*) prototype;
+- (void) detachFromPrototype;
+- (void) freezeSubBuilders;
+- (void) dropSubBuilders;
+- (void) resetSubBuilders;
 @end
 
 @implementation PBEnumValueDescriptorProto
 
 - (BOOL) hasName {
-  return !!hasName_;
+  return (hasBits_[0] & 0x1u) != 0;
 }
-- (void) setHasName:(BOOL) value {
-  hasName_ = !!value;
+- (void) setHasName:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x1u;
+  } else {
+    hasBits_[0] &= ~0x1u;
+  }
 }
 @synthesize name;
+- (NSString*) name {
+  return (hasBits_[0] & 0x1u) ? name : @"";
+}
 - (BOOL) hasNumber {
-  return !!hasNumber_;
+  return (hasBits_[0] & 0x2u) != 0;
 }
-- (void) setHasNumber:(BOOL) value {
-  hasNumber_ = !!value;
+- (void) setHasNumber:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x2u;
+  } else {
+    hasBits_[0] &= ~0x2u;
+  }
 }
 @synthesize number;
 - (BOOL) hasOptions {
-  return !!hasOptions_;
+  return (hasBits_[0] & 0x4u) != 0;
 }
-- (void) setHasOptions:(BOOL) value {
-  hasOptions_ = !!value;
+- (void) setHasOptions:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x4u;
+  } else {
+    hasBits_[0] &= ~0x4u;
+  }
 }
 @synthesize options;
+- (PBEnumValueOptions*) options {
+  return options != nil ? options : [PBEnumValueOptions defaultInstance];
+}
 - (void) dealloc {
-  self.name = nil;
-  self.options = nil;
+  [name release];
+  [options release];
   [super dealloc];
 }
-- (id) init {
-  if ((self = [super init])) {
-    self.name = @"";
-    self.number = 0;
-    self.options = [PBEnumValueOptions defaultInstance];
-  }
-  return self;
+- (void) clearForReuse {
+  [super clearForReuse];
+  memset(hasBits_, 0, sizeof(hasBits_));
+  [name release];
+  name = nil;
+  number = 0;
+  [options release];
+  options = nil;
 }
 static PBEnumValueDescriptorProto* defaultPBEnumValueDescriptorProtoInstance = nil;
-+ (void) initialize {
-  if (self == [PBEnumValueDescriptorProto class]) {
-    defaultPBEnumValueDescriptorProtoInstance = [[PBEnumValueDescriptorProto alloc] init];
-  }
-}
 + (PBEnumValueDescriptorProto*) defaultInstance {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultPBEnumValueDescriptorProtoInstance = [[PBEnumValueDescriptorProto alloc] init];
+  });
   return defaultPBEnumValueDescriptorProtoInstance;
 }
 - (PBEnumValueDescriptorProto*) defaultInstance {
-  return defaultPBEnumValueDescriptorProtoInstance;
+  return [PBEnumValueDescriptorProto defaultInstance];
+}
+- (void) setInitialized {
+  hasBits_[0] |= 0x8u;
 }
 - (BOOL) isInitialized {
-  if (self.hasOptions) {
-    if (!self.options.isInitialized) {
+  if ((hasBits_[0] & 0x8u) != 0) {
+    return YES;
+  }
+  if ((hasBits_[0] & 0x4u) != 0) {
+    if (!options.isInitialized) {
       return NO;
     }
   }
   return YES;
 }
 - (void) writeToCodedOutputStream:(PBCodedOutputStream*) output {
-  if (self.hasName) {
-    [output writeString:1 value:self.name];
+  if (hasBits_[0] & 0x1u) {
+    [output writeString:1 value:name];
   }
-  if (self.hasNumber) {
-    [output writeInt32:2 value:self.number];
+  if (hasBits_[0] & 0x2u) {
+    [output writeInt32:2 value:number];
   }
-  if (self.hasOptions) {
-    [output writeMessage:3 value:self.options];
+  if (hasBits_[0] & 0x4u) {
+    [output writeMessage:3 value:options];
   }
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = PBGeneratedMessageGetMemoizedSize(&memoizedSerializedSize);
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
-  if (self.hasName) {
-    size += computeStringSize(1, self.name);
+  size_ = 0;
+  if (hasBits_[0] & 0x1u) {
+    size_ += computeStringSize(1, name);
   }
-  if (self.hasNumber) {
-    size += computeInt32Size(2, self.number);
+  if (hasBits_[0] & 0x2u) {
+    size_ += computeInt32Size(2, number);
   }
-  if (self.hasOptions) {
-    size += computeMessageSize(3, self.options);
+  if (hasBits_[0] & 0x4u) {
+    size_ += computeMessageSize(3, options);
   }
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
+  size_ += self.unknownFields.serializedSize;
+  PBGeneratedMessageSetMemoizedSize(&memoizedSerializedSize, size_);
+  return size_;
 }
 + (PBEnumValueDescriptorProto*) parseFromData:(NSData*) data {
   return (PBEnumValueDescriptorProto*)[[[PBEnumValueDescriptorProto builder] mergeFromData:data] build];
@@ -2507,63 +4300,213 @@ static PBEnumValueDescriptorProto* defaultPBEnumValueDescriptorProtoInstance = n
   return [[[PBEnumValueDescriptorProto_Builder alloc] init] autorelease];
 }
 + (PBEnumValueDescriptorProto_Builder*) builderWithPrototype:(PBEnumValueDescriptorProto*) prototype {
-  return [[PBEnumValueDescriptorProto builder] mergeFrom:prototype];
+  return [[[PBEnumValueDescriptorProto_Builder alloc] initWithPrototype:prototype] autorelease];
 }
 - (PBEnumValueDescriptorProto_Builder*) builder {
   return [PBEnumValueDescriptorProto builder];
 }
-@end
+- (PBEnumValueDescriptorProto_Builder*) toBuilder {
+  return [PBEnumValueDescriptorProto builderWithPrototype:self];
+}
+- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
+  if (hasBits_[0] & 0x1u) {
+    [output appendFormat:@"%@%@: %@\n", indent, @"name", name];
+  }
+  if (hasBits_[0] & 0x2u) {
+    [output appendFormat:@"%@%@: %@\n", indent, @"number", [NSNumber numberWithInt:number]];
+  }
+  if (hasBits_[0] & 0x4u) {
+    [output appendFormat:@"%@%@ {\n", indent, @"options"];
+    [options writeDescriptionTo:output
+                         withIndent:[NSString stringWithFormat:@"%@  ", indent]];
+    [output appendFormat:@"%@}\n", indent];
+  }
+  [self.unknownFields writeDescriptionTo:output withIndent:indent];
+}
+- (BOOL) isEqual:(id)other {
+  if (other == self) {
+    return YES;
+  }
+  if (![other isKindOfClass:[PBEnumValueDescriptorProto class]]) {
+    return NO;
+  }
+  PBEnumValueDescriptorProto *otherMessage = other;
+  return
+      (hasBits_[0] & 0x1u) == (otherMessage->hasBits_[0] & 0x1u) &&
+      (!(hasBits_[0] & 0x1u) || [name isEqual:otherMessage->name]) &&
+      (hasBits_[0] & 0x2u) == (otherMessage->hasBits_[0] & 0x2u) &&
+      (!(hasBits_[0] & 0x2u) || number == otherMessage->number) &&
+      (hasBits_[0] & 0x4u) == (otherMessage->hasBits_[0] & 0x4u) &&
+      (!(hasBits_[0] & 0x4u) || [options isEqual:otherMessage->options]) &&
+      (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
+}
+- (NSUInteger) hash {
+  NSUInteger hash_ = PBGeneratedMessageGetMemoizedHash(&memoizedHash);
+  if (hash_ != 0) {
+    return hash_;
+  }
 
-@interface PBEnumValueDescriptorProto_Builder()
-@property (retain) PBEnumValueDescriptorProto* result;
+  uint64_t hashCode = 7;
+  if (hasBits_[0] & 0x1u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [name hash]);
+  }
+  if (hasBits_[0] & 0x2u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, (uint64_t)number);
+  }
+  if (hasBits_[0] & 0x4u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [options hash]);
+  }
+  hashCode = PBGeneratedMessageHashMix(hashCode, [self.unknownFields hash]);
+  hash_ = PBGeneratedMessageHashFinish(hashCode);
+  PBGeneratedMessageSetMemoizedHash(&memoizedHash, hash_);
+  return hash_;
+}
 @end
 
 @implementation PBEnumValueDescriptorProto_Builder
 @synthesize result;
 - (void) dealloc {
+  [self dropSubBuilders];
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
   self.result = nil;
+  [prototype_ release];
   [super dealloc];
 }
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[[PBEnumValueDescriptorProto alloc] init] autorelease];
+    result = [PBEnumValueDescriptorProto recycledInstance];
+  }
+  return self;
+}
+- (id) initWithPrototype:(PBEnumValueDescriptorProto*) prototype {
+  if ((self = [super init])) {
+    self.result = prototype;
+    prototype_ = [prototype retain];
   }
   return self;
 }
+- (void) detachFromPrototype {
+  PBEnumValueDescriptorProto* prototype = prototype_;
+  prototype_ = nil;
+  self.result = [[[PBEnumValueDescriptorProto alloc] init] autorelease];
+  [self mergeFrom:prototype];
+  [prototype release];
+}
+- (PBGeneratedMessage*) internalGetMutableResult {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return [self internalGetResult];
+}
+- (void) freezeSubBuilders {
+  if (optionsBuilder_ != nil) {
+    PBEnumValueOptions* value = [optionsBuilder_ newBuildPartial];
+    result.options = value;
+    [value release];
+    [optionsBuilder_ release];
+    optionsBuilder_ = nil;
+  }
+}
+- (void) dropSubBuilders {
+  [optionsBuilder_ release];
+  optionsBuilder_ = nil;
+  [optionsSpareBuilder_ release];
+  optionsSpareBuilder_ = nil;
+}
+- (void) resetSubBuilders {
+  if (optionsBuilder_ != nil) {
+    [optionsBuilder_ reset];
+    [optionsSpareBuilder_ release];
+    optionsSpareBuilder_ = optionsBuilder_;
+    optionsBuilder_ = nil;
+  }
+}
 - (PBGeneratedMessage*) internalGetResult {
+  [self freezeSubBuilders];
   return result;
 }
 - (PBEnumValueDescriptorProto_Builder*) clear {
-  self.result = [[[PBEnumValueDescriptorProto alloc] init] autorelease];
+  [self dropSubBuilders];
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = [[PBEnumValueDescriptorProto recycledInstance] autorelease];
   return self;
 }
 - (PBEnumValueDescriptorProto_Builder*) clone {
-  return [PBEnumValueDescriptorProto builderWithPrototype:result];
+  if (prototype_ != nil) {
+    return [[[PBEnumValueDescriptorProto_Builder alloc] initWithPrototype:prototype_] autorelease];
+  }
+  [self freezeSubBuilders];
+  return [[PBEnumValueDescriptorProto builder] mergeFrom:result];
+}
+- (PBEnumValueDescriptorProto_Builder*) reset {
+  [self resetSubBuilders];
+  if (result == nil || prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    self.result = [[PBEnumValueDescriptorProto recycledInstance] autorelease];
+  } else {
+    [result clearForReuse];
+  }
+  return self;
+}
+- (PBEnumValueDescriptorProto_Builder*) recycle:(PBEnumValueDescriptorProto*) message {
+  if (message == [PBEnumValueDescriptorProto defaultInstance]) {
+    @throw [NSException exceptionWithName:@"IllegalArgument" reason:@"Cannot recycle the default instance" userInfo:nil];
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = message;
+  return [self reset];
 }
 - (PBEnumValueDescriptorProto*) defaultInstance {
   return [PBEnumValueDescriptorProto defaultInstance];
 }
 - (PBEnumValueDescriptorProto*) build {
   [self checkInitialized];
-  return [self buildPartial];
+  BOOL shared = prototype_ != nil;
+  PBEnumValueDescriptorProto* returnMe = [self buildPartial];
+  if (!shared) {
+    [returnMe setInitialized];
+  }
+  return returnMe;
 }
 - (PBEnumValueDescriptorProto*) buildPartial {
-  PBEnumValueDescriptorProto* returnMe = [[result retain] autorelease];
-  self.result = nil;
+  return [[self newBuildPartial] autorelease];
+}
+- (PBEnumValueDescriptorProto*) newBuildPartial {
+  if (prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    PBEnumValueDescriptorProto* returnMe = result;
+    result = nil;
+    return returnMe;
+  }
+  [self freezeSubBuilders];
+  PBEnumValueDescriptorProto* returnMe = result;
+  result = nil;
   return returnMe;
 }
 - (PBEnumValueDescriptorProto_Builder*) mergeFrom:(PBEnumValueDescriptorProto*) other {
   if (other == [PBEnumValueDescriptorProto defaultInstance]) {
     return self;
   }
-  if (other.hasName) {
-    [self setName:other.name];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (other->hasBits_[0] & 0x1u) {
+    [self setName:other->name];
   }
-  if (other.hasNumber) {
-    [self setNumber:other.number];
+  if (other->hasBits_[0] & 0x2u) {
+    [self setNumber:other->number];
   }
-  if (other.hasOptions) {
-    [self mergeOptions:other.options];
+  if (other->hasBits_[0] & 0x4u) {
+    [self mergeOptions:other->options];
   }
   [self mergeUnknownFields:other.unknownFields];
   return self;
@@ -2572,22 +4515,35 @@ static PBEnumValueDescriptorProto* defaultPBEnumValueDescriptorProtoInstance = n
   return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
 }
 - (PBEnumValueDescriptorProto_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  PBUnknownFieldSet_Builder* unknownFields = nil;
   while (YES) {
     int32_t tag = [input readTag];
     switch (tag) {
       case 0:
-        [self setUnknownFields:[unknownFields build]];
+        if (unknownFields != nil) {
+          [self setUnknownFields:[unknownFields build]];
+        }
         return self;
       default: {
-        if (![self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag]) {
-          [self setUnknownFields:[unknownFields build]];
+        if (PBWireFormatGetTagWireType(tag) == PBWireFormatEndGroup) {
+          if (unknownFields != nil) {
+            [self setUnknownFields:[unknownFields build]];
+          }
           return self;
         }
+        if (unknownFields == nil) {
+          unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+        }
+        [self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag];
         break;
       }
       case 10: {
-        [self setName:[input readString]];
+        NSString* value = [input newString];
+        [self setName:value];
+        [value release];
         break;
       }
       case 16: {
@@ -2595,57 +4551,79 @@ static PBEnumValueDescriptorProto* defaultPBEnumValueDescriptorProtoInstance = n
         break;
       }
       case 26: {
-        PBEnumValueOptions_Builder* subBuilder = [PBEnumValueOptions builder];
-        if (self.hasOptions) {
-          [subBuilder mergeFrom:self.options];
+        if (optionsBuilder_ == nil) {
+          optionsBuilder_ = optionsSpareBuilder_ != nil ? optionsSpareBuilder_ : [[PBEnumValueOptions_Builder alloc] init];
+          optionsSpareBuilder_ = nil;
+          if (result->hasBits_[0] & 0x4u) {
+            [optionsBuilder_ mergeFrom:result->options];
+          }
+          result->hasBits_[0] |= 0x4u;
         }
-        [input readMessage:subBuilder extensionRegistry:extensionRegistry];
-        [self setOptions:[subBuilder buildPartial]];
+        [input readMessage:optionsBuilder_ extensionRegistry:extensionRegistry];
         break;
       }
     }
   }
 }
 - (BOOL) hasName {
-  return result.hasName;
+  return (result->hasBits_[0] & 0x1u) != 0;
 }
 - (NSString*) name {
-  return result.name;
+  return [result name];
 }
 - (PBEnumValueDescriptorProto_Builder*) setName:(NSString*) value {
-  result.hasName = YES;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x1u;
   result.name = value;
   return self;
 }
 - (PBEnumValueDescriptorProto_Builder*) clearName {
-  result.hasName = NO;
-  result.name = @"";
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x1u;
+  [result->name release];
+  result->name = nil;
   return self;
 }
 - (BOOL) hasNumber {
-  return result.hasNumber;
+  return (result->hasBits_[0] & 0x2u) != 0;
 }
 - (int32_t) number {
-  return result.number;
+  return result->number;
 }
 - (PBEnumValueDescriptorProto_Builder*) setNumber:(int32_t) value {
-  result.hasNumber = YES;
-  result.number = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x2u;
+  result->number = value;
   return self;
 }
 - (PBEnumValueDescriptorProto_Builder*) clearNumber {
-  result.hasNumber = NO;
-  result.number = 0;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x2u;
+  result->number = 0;
   return self;
 }
 - (BOOL) hasOptions {
-  return result.hasOptions;
+  return (result->hasBits_[0] & 0x4u) != 0;
 }
 - (PBEnumValueOptions*) options {
+  [self freezeSubBuilders];
   return result.options;
 }
 - (PBEnumValueDescriptorProto_Builder*) setOptions:(PBEnumValueOptions*) value {
-  result.hasOptions = YES;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  [optionsBuilder_ release];
+  optionsBuilder_ = nil;
+  result->hasBits_[0] |= 0x4u;
   result.options = value;
   return self;
 }
@@ -2653,122 +4631,166 @@ static PBEnumValueDescriptorProto* defaultPBEnumValueDescriptorProtoInstance = n
   return [self setOptions:[builderForValue build]];
 }
 - (PBEnumValueDescriptorProto_Builder*) mergeOptions:(PBEnumValueOptions*) value {
-  if (result.hasOptions &&
-      result.options != [PBEnumValueOptions defaultInstance]) {
-    result.options =
-      [[[PBEnumValueOptions builderWithPrototype:result.options] mergeFrom:value] buildPartial];
-  } else {
-    result.options = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (optionsBuilder_ == nil) {
+    if (!(result->hasBits_[0] & 0x4u) ||
+        result->options == [PBEnumValueOptions defaultInstance]) {
+      result->hasBits_[0] |= 0x4u;
+      result.options = value;
+      return self;
+    }
+    optionsBuilder_ = optionsSpareBuilder_ != nil ? optionsSpareBuilder_ : [[PBEnumValueOptions_Builder alloc] init];
+    optionsSpareBuilder_ = nil;
+    [optionsBuilder_ mergeFrom:result->options];
   }
-  result.hasOptions = YES;
+  [optionsBuilder_ mergeFrom:value];
   return self;
 }
 - (PBEnumValueDescriptorProto_Builder*) clearOptions {
-  result.hasOptions = NO;
-  result.options = [PBEnumValueOptions defaultInstance];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  [optionsBuilder_ release];
+  optionsBuilder_ = nil;
+  result->hasBits_[0] &= ~0x4u;
+  [result->options release];
+  result->options = nil;
   return self;
 }
 @end
 
 @interface PBServiceDescriptorProto ()
-@property (retain) NSString* name;
-@property (retain) NSMutableArray* mutableMethodList;
-@property (retain) PBServiceOptions* options;
+@property (nonatomic, retain) NSString* name;
+@property (nonatomic, retain) PBObjectArray * methodArray;
+@property (nonatomic, retain) PBServiceOptions* options;
+- (void) setInitialized;
+@end
+
+@interface PBServiceDescriptorProto_Builder()
+@property (nonatomic, retain) PBServiceDescriptorProto* result;
+- (id) initWithPrototype:(PBServiceDescriptorProto*) prototype;
+- (void) detachFromPrototype;
+- (void) freezeSubBuilders;
+- (void) dropSubBuilders;
+- (void) resetSubBuilders;
 @end
 
 @implementation PBServiceDescriptorProto
 
 - (BOOL) hasName {
-  return !!hasName_;
+  return (hasBits_[0] & 0x1u) != 0;
 }
-- (void) setHasName:(BOOL) value {
-  hasName_ = !!value;
+- (void) setHasName:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x1u;
+  } else {
+    hasBits_[0] &= ~0x1u;
+  }
 }
 @synthesize name;
-@synthesize mutableMethodList;
+- (NSString*) name {
+  return (hasBits_[0] & 0x1u) ? name : @"";
+}
+@synthesize methodArray;
+@dynamic method;
 - (BOOL) hasOptions {
-  return !!hasOptions_;
+  return (hasBits_[0] & 0x2u) != 0;
 }
-- (void) setHasOptions:(BOOL) value {
-  hasOptions_ = !!value;
+- (void) setHasOptions:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x2u;
+  } else {
+    hasBits_[0] &= ~0x2u;
+  }
 }
 @synthesize options;
+- (PBServiceOptions*) options {
+  return options != nil ? options : [PBServiceOptions defaultInstance];
+}
 - (void) dealloc {
-  self.name = nil;
-  self.mutableMethodList = nil;
-  self.options = nil;
+  [name release];
+  [methodArray release];
+  [options release];
   [super dealloc];
 }
-- (id) init {
-  if ((self = [super init])) {
-    self.name = @"";
-    self.options = [PBServiceOptions defaultInstance];
-  }
-  return self;
+- (void) clearForReuse {
+  [super clearForReuse];
+  memset(hasBits_, 0, sizeof(hasBits_));
+  [name release];
+  name = nil;
+  methodArray = PBAppendableArrayReuse(methodArray);
+  [options release];
+  options = nil;
 }
 static PBServiceDescriptorProto* defaultPBServiceDescriptorProtoInstance = nil;
-+ (void) initialize {
-  if (self == [PBServiceDescriptorProto class]) {
-    defaultPBServiceDescriptorProtoInstance = [[PBServiceDescriptorProto alloc] init];
-  }
-}
 + (PBServiceDescriptorProto*) defaultInstance {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultPBServiceDescriptorProtoInstance = [[PBServiceDescriptorProto alloc] init];
+  });
   return defaultPBServiceDescriptorProtoInstance;
 }
 - (PBServiceDescriptorProto*) defaultInstance {
-  return defaultPBServiceDescriptorProtoInstance;
+  return [PBServiceDescriptorProto defaultInstance];
 }
-- (NSArray*) methodList {
-  return mutableMethodList;
+- (PBArray *)method {
+  return methodArray;
 }
-- (PBMethodDescriptorProto*) methodAtIndex:(int32_t) index {
-  id value = [mutableMethodList objectAtIndex:index];
-  return value;
+- (PBMethodDescriptorProto*)methodAtIndex:(NSUInteger)index {
+  return PBObjectArrayValueAtIndex(methodArray, index);
+}
+- (void) setInitialized {
+  hasBits_[0] |= 0x4u;
 }
 - (BOOL) isInitialized {
-  for (PBMethodDescriptorProto* element in self.methodList) {
+  if ((hasBits_[0] & 0x4u) != 0) {
+    return YES;
+  }
+  for (PBMethodDescriptorProto* element in methodArray) {
     if (!element.isInitialized) {
       return NO;
     }
   }
-  if (self.hasOptions) {
-    if (!self.options.isInitialized) {
+  if ((hasBits_[0] & 0x2u) != 0) {
+    if (!options.isInitialized) {
       return NO;
     }
   }
   return YES;
 }
 - (void) writeToCodedOutputStream:(PBCodedOutputStream*) output {
-  if (self.hasName) {
-    [output writeString:1 value:self.name];
+  if (hasBits_[0] & 0x1u) {
+    [output writeString:1 value:name];
   }
-  for (PBMethodDescriptorProto* element in self.methodList) {
+  for (PBMethodDescriptorProto *element in methodArray) {
     [output writeMessage:2 value:element];
   }
-  if (self.hasOptions) {
-    [output writeMessage:3 value:self.options];
+  if (hasBits_[0] & 0x2u) {
+    [output writeMessage:3 value:options];
   }
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = PBGeneratedMessageGetMemoizedSize(&memoizedSerializedSize);
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
-  if (self.hasName) {
-    size += computeStringSize(1, self.name);
+  size_ = 0;
+  if (hasBits_[0] & 0x1u) {
+    size_ += computeStringSize(1, name);
   }
-  for (PBMethodDescriptorProto* element in self.methodList) {
-    size += computeMessageSize(2, element);
+  for (PBMethodDescriptorProto *element in methodArray) {
+    size_ += computeMessageSize(2, element);
   }
-  if (self.hasOptions) {
-    size += computeMessageSize(3, self.options);
+  if (hasBits_[0] & 0x2u) {
+    size_ += computeMessageSize(3, options);
   }
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
+  size_ += self.unknownFields.serializedSize;
+  PBGeneratedMessageSetMemoizedSize(&memoizedSerializedSize, size_);
+  return size_;
 }
 + (PBServiceDescriptorProto*) parseFromData:(NSData*) data {
   return (PBServiceDescriptorProto*)[[[PBServiceDescriptorProto builder] mergeFromData:data] build];
@@ -2792,66 +4814,220 @@ static PBServiceDescriptorProto* defaultPBServiceDescriptorProtoInstance = nil;
   return [[[PBServiceDescriptorProto_Builder alloc] init] autorelease];
 }
 + (PBServiceDescriptorProto_Builder*) builderWithPrototype:(PBServiceDescriptorProto*) prototype {
-  return [[PBServiceDescriptorProto builder] mergeFrom:prototype];
+  return [[[PBServiceDescriptorProto_Builder alloc] initWithPrototype:prototype] autorelease];
 }
 - (PBServiceDescriptorProto_Builder*) builder {
   return [PBServiceDescriptorProto builder];
 }
-@end
+- (PBServiceDescriptorProto_Builder*) toBuilder {
+  return [PBServiceDescriptorProto builderWithPrototype:self];
+}
+- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
+  if (hasBits_[0] & 0x1u) {
+    [output appendFormat:@"%@%@: %@\n", indent, @"name", name];
+  }
+  for (PBMethodDescriptorProto* element in methodArray) {
+    [output appendFormat:@"%@%@ {\n", indent, @"method"];
+    [element writeDescriptionTo:output
+                     withIndent:[NSString stringWithFormat:@"%@  ", indent]];
+    [output appendFormat:@"%@}\n", indent];
+  }
+  if (hasBits_[0] & 0x2u) {
+    [output appendFormat:@"%@%@ {\n", indent, @"options"];
+    [options writeDescriptionTo:output
+                         withIndent:[NSString stringWithFormat:@"%@  ", indent]];
+    [output appendFormat:@"%@}\n", indent];
+  }
+  [self.unknownFields writeDescriptionTo:output withIndent:indent];
+}
+- (BOOL) isEqual:(id)other {
+  if (other == self) {
+    return YES;
+  }
+  if (![other isKindOfClass:[PBServiceDescriptorProto class]]) {
+    return NO;
+  }
+  PBServiceDescriptorProto *otherMessage = other;
+  return
+      (hasBits_[0] & 0x1u) == (otherMessage->hasBits_[0] & 0x1u) &&
+      (!(hasBits_[0] & 0x1u) || [name isEqual:otherMessage->name]) &&
+      (methodArray.count == 0 ? otherMessage->methodArray.count == 0 : [methodArray isEqualToArray:otherMessage->methodArray]) &&
+      (hasBits_[0] & 0x2u) == (otherMessage->hasBits_[0] & 0x2u) &&
+      (!(hasBits_[0] & 0x2u) || [options isEqual:otherMessage->options]) &&
+      (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
+}
+- (NSUInteger) hash {
+  NSUInteger hash_ = PBGeneratedMessageGetMemoizedHash(&memoizedHash);
+  if (hash_ != 0) {
+    return hash_;
+  }
 
-@interface PBServiceDescriptorProto_Builder()
-@property (retain) PBServiceDescriptorProto* result;
+  uint64_t hashCode = 7;
+  if (hasBits_[0] & 0x1u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [name hash]);
+  }
+  for (PBMethodDescriptorProto* element in methodArray) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [element hash]);
+  }
+  if (hasBits_[0] & 0x2u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [options hash]);
+  }
+  hashCode = PBGeneratedMessageHashMix(hashCode, [self.unknownFields hash]);
+  hash_ = PBGeneratedMessageHashFinish(hashCode);
+  PBGeneratedMessageSetMemoizedHash(&memoizedHash, hash_);
+  return hash_;
+}
 @end
 
 @implementation PBServiceDescriptorProto_Builder
 @synthesize result;
 - (void) dealloc {
+  [self dropSubBuilders];
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
   self.result = nil;
+  [prototype_ release];
   [super dealloc];
 }
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[[PBServiceDescriptorProto alloc] init] autorelease];
+    result = [PBServiceDescriptorProto recycledInstance];
+  }
+  return self;
+}
+- (id) initWithPrototype:(PBServiceDescriptorProto*) prototype {
+  if ((self = [super init])) {
+    self.result = prototype;
+    prototype_ = [prototype retain];
   }
   return self;
 }
+- (void) detachFromPrototype {
+  PBServiceDescriptorProto* prototype = prototype_;
+  prototype_ = nil;
+  self.result = [[[PBServiceDescriptorProto alloc] init] autorelease];
+  [self mergeFrom:prototype];
+  [prototype release];
+}
+- (PBGeneratedMessage*) internalGetMutableResult {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return [self internalGetResult];
+}
+- (void) freezeSubBuilders {
+  if (optionsBuilder_ != nil) {
+    PBServiceOptions* value = [optionsBuilder_ newBuildPartial];
+    result.options = value;
+    [value release];
+    [optionsBuilder_ release];
+    optionsBuilder_ = nil;
+  }
+}
+- (void) dropSubBuilders {
+  [optionsBuilder_ release];
+  optionsBuilder_ = nil;
+  [optionsSpareBuilder_ release];
+  optionsSpareBuilder_ = nil;
+}
+- (void) resetSubBuilders {
+  if (optionsBuilder_ != nil) {
+    [optionsBuilder_ reset];
+    [optionsSpareBuilder_ release];
+    optionsSpareBuilder_ = optionsBuilder_;
+    optionsBuilder_ = nil;
+  }
+}
 - (PBGeneratedMessage*) internalGetResult {
+  [self freezeSubBuilders];
   return result;
 }
 - (PBServiceDescriptorProto_Builder*) clear {
-  self.result = [[[PBServiceDescriptorProto alloc] init] autorelease];
+  [self dropSubBuilders];
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = [[PBServiceDescriptorProto recycledInstance] autorelease];
   return self;
 }
 - (PBServiceDescriptorProto_Builder*) clone {
-  return [PBServiceDescriptorProto builderWithPrototype:result];
+  if (prototype_ != nil) {
+    return [[[PBServiceDescriptorProto_Builder alloc] initWithPrototype:prototype_] autorelease];
+  }
+  [self freezeSubBuilders];
+  return [[PBServiceDescriptorProto builder] mergeFrom:result];
+}
+- (PBServiceDescriptorProto_Builder*) reset {
+  [self resetSubBuilders];
+  if (result == nil || prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    self.result = [[PBServiceDescriptorProto recycledInstance] autorelease];
+  } else {
+    [result clearForReuse];
+  }
+  return self;
+}
+- (PBServiceDescriptorProto_Builder*) recycle:(PBServiceDescriptorProto*) message {
+  if (message == [PBServiceDescriptorProto defaultInstance]) {
+    @throw [NSException exceptionWithName:@"IllegalArgument" reason:@"Cannot recycle the default instance" userInfo:nil];
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = message;
+  return [self reset];
 }
 - (PBServiceDescriptorProto*) defaultInstance {
   return [PBServiceDescriptorProto defaultInstance];
 }
 - (PBServiceDescriptorProto*) build {
   [self checkInitialized];
-  return [self buildPartial];
+  BOOL shared = prototype_ != nil;
+  PBServiceDescriptorProto* returnMe = [self buildPartial];
+  if (!shared) {
+    [returnMe setInitialized];
+  }
+  return returnMe;
 }
 - (PBServiceDescriptorProto*) buildPartial {
-  PBServiceDescriptorProto* returnMe = [[result retain] autorelease];
-  self.result = nil;
+  return [[self newBuildPartial] autorelease];
+}
+- (PBServiceDescriptorProto*) newBuildPartial {
+  if (prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    PBServiceDescriptorProto* returnMe = result;
+    result = nil;
+    return returnMe;
+  }
+  [self freezeSubBuilders];
+  [result->methodArray shrinkToFit];
+  PBServiceDescriptorProto* returnMe = result;
+  result = nil;
   return returnMe;
 }
 - (PBServiceDescriptorProto_Builder*) mergeFrom:(PBServiceDescriptorProto*) other {
   if (other == [PBServiceDescriptorProto defaultInstance]) {
     return self;
   }
-  if (other.hasName) {
-    [self setName:other.name];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  if (other.mutableMethodList.count > 0) {
-    if (result.mutableMethodList == nil) {
-      result.mutableMethodList = [NSMutableArray array];
+  if (other->hasBits_[0] & 0x1u) {
+    [self setName:other->name];
+  }
+  if (other->methodArray.count > 0) {
+    if (result->methodArray == nil) {
+      result.methodArray = [[other->methodArray copyWithZone:[other->methodArray zone]] autorelease];
+    } else {
+      [result->methodArray appendArray:other->methodArray];
     }
-    [result.mutableMethodList addObjectsFromArray:other.mutableMethodList];
   }
-  if (other.hasOptions) {
-    [self mergeOptions:other.options];
+  if (other->hasBits_[0] & 0x2u) {
+    [self mergeOptions:other->options];
   }
   [self mergeUnknownFields:other.unknownFields];
   return self;
@@ -2860,95 +5036,141 @@ static PBServiceDescriptorProto* defaultPBServiceDescriptorProtoInstance = nil;
   return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
 }
 - (PBServiceDescriptorProto_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  PBUnknownFieldSet_Builder* unknownFields = nil;
   while (YES) {
     int32_t tag = [input readTag];
     switch (tag) {
       case 0:
-        [self setUnknownFields:[unknownFields build]];
+        if (unknownFields != nil) {
+          [self setUnknownFields:[unknownFields build]];
+        }
         return self;
       default: {
-        if (![self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag]) {
-          [self setUnknownFields:[unknownFields build]];
+        if (PBWireFormatGetTagWireType(tag) == PBWireFormatEndGroup) {
+          if (unknownFields != nil) {
+            [self setUnknownFields:[unknownFields build]];
+          }
           return self;
         }
+        if (unknownFields == nil) {
+          unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+        }
+        [self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag];
         break;
       }
       case 10: {
-        [self setName:[input readString]];
+        NSString* value = [input newString];
+        [self setName:value];
+        [value release];
         break;
       }
       case 18: {
-        PBMethodDescriptorProto_Builder* subBuilder = [PBMethodDescriptorProto builder];
-        [input readMessage:subBuilder extensionRegistry:extensionRegistry];
-        [self addMethod:[subBuilder buildPartial]];
+        PBMethodDescriptorProto_Builder* subBuilder = [[PBMethodDescriptorProto_Builder alloc] init];
+        @try {
+          [input readMessage:subBuilder extensionRegistry:extensionRegistry];
+          PBMethodDescriptorProto* value = [subBuilder newBuildPartial];
+          [self addMethod:value];
+          [value release];
+        } @finally {
+          [subBuilder release];
+        }
         break;
       }
       case 26: {
-        PBServiceOptions_Builder* subBuilder = [PBServiceOptions builder];
-        if (self.hasOptions) {
-          [subBuilder mergeFrom:self.options];
+        if (optionsBuilder_ == nil) {
+          optionsBuilder_ = optionsSpareBuilder_ != nil ? optionsSpareBuilder_ : [[PBServiceOptions_Builder alloc] init];
+          optionsSpareBuilder_ = nil;
+          if (result->hasBits_[0] & 0x2u) {
+            [optionsBuilder_ mergeFrom:result->options];
+          }
+          result->hasBits_[0] |= 0x2u;
         }
-        [input readMessage:subBuilder extensionRegistry:extensionRegistry];
-        [self setOptions:[subBuilder buildPartial]];
+        [input readMessage:optionsBuilder_ extensionRegistry:extensionRegistry];
         break;
       }
     }
   }
 }
 - (BOOL) hasName {
-  return result.hasName;
+  return (result->hasBits_[0] & 0x1u) != 0;
 }
 - (NSString*) name {
-  return result.name;
+  return [result name];
 }
 - (PBServiceDescriptorProto_Builder*) setName:(NSString*) value {
-  result.hasName = YES;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x1u;
   result.name = value;
   return self;
 }
 - (PBServiceDescriptorProto_Builder*) clearName {
-  result.hasName = NO;
-  result.name = @"";
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x1u;
+  [result->name release];
+  result->name = nil;
   return self;
 }
-- (NSArray*) methodList {
-  if (result.mutableMethodList == nil) { return [NSArray array]; }
-  return result.mutableMethodList;
+- (PBAppendableArray *)method {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return result->methodArray;
 }
-- (PBMethodDescriptorProto*) methodAtIndex:(int32_t) index {
+- (PBMethodDescriptorProto*)methodAtIndex:(NSUInteger)index {
   return [result methodAtIndex:index];
 }
-- (PBServiceDescriptorProto_Builder*) replaceMethodAtIndex:(int32_t) index with:(PBMethodDescriptorProto*) value {
-  [result.mutableMethodList replaceObjectAtIndex:index withObject:value];
+- (PBServiceDescriptorProto_Builder *)addMethod:(PBMethodDescriptorProto*)value {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (result->methodArray == nil) {
+    result.methodArray = [PBObjectArray array];
+  }
+  PBObjectArrayAddValue(result->methodArray, value);
   return self;
 }
-- (PBServiceDescriptorProto_Builder*) addAllMethod:(NSArray*) values {
-  if (result.mutableMethodList == nil) {
-    result.mutableMethodList = [NSMutableArray array];
+- (PBServiceDescriptorProto_Builder *)setMethodArray:(NSArray *)array {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  [result.mutableMethodList addObjectsFromArray:values];
+  result.methodArray = [PBObjectArray arrayWithArray:array valueType:PBArrayValueTypeObject];
   return self;
 }
-- (PBServiceDescriptorProto_Builder*) clearMethodList {
-  result.mutableMethodList = nil;
+- (PBServiceDescriptorProto_Builder *)setMethodValues:(const PBMethodDescriptorProto* *)values count:(NSUInteger)count {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.methodArray = [PBObjectArray arrayWithValues:values count:count valueType:PBArrayValueTypeObject];
   return self;
 }
-- (PBServiceDescriptorProto_Builder*) addMethod:(PBMethodDescriptorProto*) value {
-  if (result.mutableMethodList == nil) {
-    result.mutableMethodList = [NSMutableArray array];
+- (PBServiceDescriptorProto_Builder *)clearMethod {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  [result.mutableMethodList addObject:value];
+  result.methodArray = nil;
   return self;
 }
 - (BOOL) hasOptions {
-  return result.hasOptions;
+  return (result->hasBits_[0] & 0x2u) != 0;
 }
 - (PBServiceOptions*) options {
+  [self freezeSubBuilders];
   return result.options;
 }
 - (PBServiceDescriptorProto_Builder*) setOptions:(PBServiceOptions*) value {
-  result.hasOptions = YES;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  [optionsBuilder_ release];
+  optionsBuilder_ = nil;
+  result->hasBits_[0] |= 0x2u;
   result.options = value;
   return self;
 }
@@ -2956,133 +5178,192 @@ static PBServiceDescriptorProto* defaultPBServiceDescriptorProtoInstance = nil;
   return [self setOptions:[builderForValue build]];
 }
 - (PBServiceDescriptorProto_Builder*) mergeOptions:(PBServiceOptions*) value {
-  if (result.hasOptions &&
-      result.options != [PBServiceOptions defaultInstance]) {
-    result.options =
-      [[[PBServiceOptions builderWithPrototype:result.options] mergeFrom:value] buildPartial];
-  } else {
-    result.options = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (optionsBuilder_ == nil) {
+    if (!(result->hasBits_[0] & 0x2u) ||
+        result->options == [PBServiceOptions defaultInstance]) {
+      result->hasBits_[0] |= 0x2u;
+      result.options = value;
+      return self;
+    }
+    optionsBuilder_ = optionsSpareBuilder_ != nil ? optionsSpareBuilder_ : [[PBServiceOptions_Builder alloc] init];
+    optionsSpareBuilder_ = nil;
+    [optionsBuilder_ mergeFrom:result->options];
   }
-  result.hasOptions = YES;
+  [optionsBuilder_ mergeFrom:value];
   return self;
 }
 - (PBServiceDescriptorProto_Builder*) clearOptions {
-  result.hasOptions = NO;
-  result.options = [PBServiceOptions defaultInstance];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  [optionsBuilder_ release];
+  optionsBuilder_ = nil;
+  result->hasBits_[0] &= ~0x2u;
+  [result->options release];
+  result->options = nil;
   return self;
 }
 @end
 
 @interface PBMethodDescriptorProto ()
-@property (retain) NSString* name;
-@property (retain) NSString* inputType;
-@property (retain) NSString* outputType;
-@property (retain) PBMethodOptions* options;
+@property (nonatomic, retain) NSString* name;
+@property (nonatomic, retain) NSString* inputType;
+@property (nonatomic, retain) NSString* outputType;
+@property (nonatomic, retain) PBMethodOptions* options;
+- (void) setInitialized;
+@end
+
+@interface PBMethodDescriptorProto_Builder()
+@property (nonatomic, retain) PBMethodDescriptorProto* result;
+- (id) initWithPrototype:(PBMethodDescriptorProto*) prototype;
+- (void) detachFromPrototype;
+- (void) freezeSubBuilders;
+- (void) dropSubBuilders;
+- (void) resetSubBuilders;
 @end
 
 @implementation PBMethodDescriptorProto
 
 - (BOOL) hasName {
-  return !!hasName_;
+  return (hasBits_[0] & 0x1u) != 0;
 }
-- (void) setHasName:(BOOL) value {
-  hasName_ = !!value;
+- (void) setHasName:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x1u;
+  } else {
+    hasBits_[0] &= ~0x1u;
+  }
 }
 @synthesize name;
+- (NSString*) name {
+  return (hasBits_[0] & 0x1u) ? name : @"";
+}
 - (BOOL) hasInputType {
-  return !!hasInputType_;
+  return (hasBits_[0] & 0x2u) != 0;
 }
-- (void) setHasInputType:(BOOL) value {
-  hasInputType_ = !!value;
+- (void) setHasInputType:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x2u;
+  } else {
+    hasBits_[0] &= ~0x2u;
+  }
 }
 @synthesize inputType;
+- (NSString*) inputType {
+  return (hasBits_[0] & 0x2u) ? inputType : @"";
+}
 - (BOOL) hasOutputType {
-  return !!hasOutputType_;
+  return (hasBits_[0] & 0x4u) != 0;
 }
-- (void) setHasOutputType:(BOOL) value {
-  hasOutputType_ = !!value;
+- (void) setHasOutputType:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x4u;
+  } else {
+    hasBits_[0] &= ~0x4u;
+  }
 }
 @synthesize outputType;
+- (NSString*) outputType {
+  return (hasBits_[0] & 0x4u) ? outputType : @"";
+}
 - (BOOL) hasOptions {
-  return !!hasOptions_;
+  return (hasBits_[0] & 0x8u) != 0;
 }
-- (void) setHasOptions:(BOOL) value {
-  hasOptions_ = !!value;
+- (void) setHasOptions:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x8u;
+  } else {
+    hasBits_[0] &= ~0x8u;
+  }
 }
 @synthesize options;
+- (PBMethodOptions*) options {
+  return options != nil ? options : [PBMethodOptions defaultInstance];
+}
 - (void) dealloc {
-  self.name = nil;
-  self.inputType = nil;
-  self.outputType = nil;
-  self.options = nil;
+  [name release];
+  [inputType release];
+  [outputType release];
+  [options release];
   [super dealloc];
 }
-- (id) init {
-  if ((self = [super init])) {
-    self.name = @"";
-    self.inputType = @"";
-    self.outputType = @"";
-    self.options = [PBMethodOptions defaultInstance];
-  }
-  return self;
+- (void) clearForReuse {
+  [super clearForReuse];
+  memset(hasBits_, 0, sizeof(hasBits_));
+  [name release];
+  name = nil;
+  [inputType release];
+  inputType = nil;
+  [outputType release];
+  outputType = nil;
+  [options release];
+  options = nil;
 }
 static PBMethodDescriptorProto* defaultPBMethodDescriptorProtoInstance = nil;
-+ (void) initialize {
-  if (self == [PBMethodDescriptorProto class]) {
++ (PBMethodDescriptorProto*) defaultInstance {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
     defaultPBMethodDescriptorProtoInstance = [[PBMethodDescriptorProto alloc] init];
-  }
-}
-+ (PBMethodDescriptorProto*) defaultInstance {
+  });
   return defaultPBMethodDescriptorProtoInstance;
 }
 - (PBMethodDescriptorProto*) defaultInstance {
-  return defaultPBMethodDescriptorProtoInstance;
+  return [PBMethodDescriptorProto defaultInstance];
+}
+- (void) setInitialized {
+  hasBits_[0] |= 0x10u;
 }
 - (BOOL) isInitialized {
-  if (self.hasOptions) {
-    if (!self.options.isInitialized) {
+  if ((hasBits_[0] & 0x10u) != 0) {
+    return YES;
+  }
+  if ((hasBits_[0] & 0x8u) != 0) {
+    if (!options.isInitialized) {
       return NO;
     }
   }
   return YES;
 }
 - (void) writeToCodedOutputStream:(PBCodedOutputStream*) output {
-  if (self.hasName) {
-    [output writeString:1 value:self.name];
+  if (hasBits_[0] & 0x1u) {
+    [output writeString:1 value:name];
   }
-  if (self.hasInputType) {
-    [output writeString:2 value:self.inputType];
+  if (hasBits_[0] & 0x2u) {
+    [output writeString:2 value:inputType];
   }
-  if (self.hasOutputType) {
-    [output writeString:3 value:self.outputType];
+  if (hasBits_[0] & 0x4u) {
+    [output writeString:3 value:outputType];
   }
-  if (self.hasOptions) {
-    [output writeMessage:4 value:self.options];
+  if (hasBits_[0] & 0x8u) {
+    [output writeMessage:4 value:options];
   }
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = PBGeneratedMessageGetMemoizedSize(&memoizedSerializedSize);
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
-  if (self.hasName) {
-    size += computeStringSize(1, self.name);
+  size_ = 0;
+  if (hasBits_[0] & 0x1u) {
+    size_ += computeStringSize(1, name);
   }
-  if (self.hasInputType) {
-    size += computeStringSize(2, self.inputType);
+  if (hasBits_[0] & 0x2u) {
+    size_ += computeStringSize(2, inputType);
   }
-  if (self.hasOutputType) {
-    size += computeStringSize(3, self.outputType);
+  if (hasBits_[0] & 0x4u) {
+    size_ += computeStringSize(3, outputType);
   }
-  if (self.hasOptions) {
-    size += computeMessageSize(4, self.options);
+  if (hasBits_[0] & 0x8u) {
+    size_ += computeMessageSize(4, options);
   }
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
+  size_ += self.unknownFields.serializedSize;
+  PBGeneratedMessageSetMemoizedSize(&memoizedSerializedSize, size_);
+  return size_;
 }
 + (PBMethodDescriptorProto*) parseFromData:(NSData*) data {
   return (PBMethodDescriptorProto*)[[[PBMethodDescriptorProto builder] mergeFromData:data] build];
@@ -3106,66 +5387,224 @@ static PBMethodDescriptorProto* defaultPBMethodDescriptorProtoInstance = nil;
   return [[[PBMethodDescriptorProto_Builder alloc] init] autorelease];
 }
 + (PBMethodDescriptorProto_Builder*) builderWithPrototype:(PBMethodDescriptorProto*) prototype {
-  return [[PBMethodDescriptorProto builder] mergeFrom:prototype];
+  return [[[PBMethodDescriptorProto_Builder alloc] initWithPrototype:prototype] autorelease];
 }
 - (PBMethodDescriptorProto_Builder*) builder {
   return [PBMethodDescriptorProto builder];
 }
-@end
+- (PBMethodDescriptorProto_Builder*) toBuilder {
+  return [PBMethodDescriptorProto builderWithPrototype:self];
+}
+- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
+  if (hasBits_[0] & 0x1u) {
+    [output appendFormat:@"%@%@: %@\n", indent, @"name", name];
+  }
+  if (hasBits_[0] & 0x2u) {
+    [output appendFormat:@"%@%@: %@\n", indent, @"inputType", inputType];
+  }
+  if (hasBits_[0] & 0x4u) {
+    [output appendFormat:@"%@%@: %@\n", indent, @"outputType", outputType];
+  }
+  if (hasBits_[0] & 0x8u) {
+    [output appendFormat:@"%@%@ {\n", indent, @"options"];
+    [options writeDescriptionTo:output
+                         withIndent:[NSString stringWithFormat:@"%@  ", indent]];
+    [output appendFormat:@"%@}\n", indent];
+  }
+  [self.unknownFields writeDescriptionTo:output withIndent:indent];
+}
+- (BOOL) isEqual:(id)other {
+  if (other == self) {
+    return YES;
+  }
+  if (![other isKindOfClass:[PBMethodDescriptorProto class]]) {
+    return NO;
+  }
+  PBMethodDescriptorProto *otherMessage = other;
+  return
+      (hasBits_[0] & 0x1u) == (otherMessage->hasBits_[0] & 0x1u) &&
+      (!(hasBits_[0] & 0x1u) || [name isEqual:otherMessage->name]) &&
+      (hasBits_[0] & 0x2u) == (otherMessage->hasBits_[0] & 0x2u) &&
+      (!(hasBits_[0] & 0x2u) || [inputType isEqual:otherMessage->inputType]) &&
+      (hasBits_[0] & 0x4u) == (otherMessage->hasBits_[0] & 0x4u) &&
+      (!(hasBits_[0] & 0x4u) || [outputType isEqual:otherMessage->outputType]) &&
+      (hasBits_[0] & 0x8u) == (otherMessage->hasBits_[0] & 0x8u) &&
+      (!(hasBits_[0] & 0x8u) || [options isEqual:otherMessage->options]) &&
+      (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
+}
+- (NSUInteger) hash {
+  NSUInteger hash_ = PBGeneratedMessageGetMemoizedHash(&memoizedHash);
+  if (hash_ != 0) {
+    return hash_;
+  }
 
-@interface PBMethodDescriptorProto_Builder()
-@property (retain) PBMethodDescriptorProto* result;
+  uint64_t hashCode = 7;
+  if (hasBits_[0] & 0x1u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [name hash]);
+  }
+  if (hasBits_[0] & 0x2u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [inputType hash]);
+  }
+  if (hasBits_[0] & 0x4u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [outputType hash]);
+  }
+  if (hasBits_[0] & 0x8u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [options hash]);
+  }
+  hashCode = PBGeneratedMessageHashMix(hashCode, [self.unknownFields hash]);
+  hash_ = PBGeneratedMessageHashFinish(hashCode);
+  PBGeneratedMessageSetMemoizedHash(&memoizedHash, hash_);
+  return hash_;
+}
 @end
 
 @implementation PBMethodDescriptorProto_Builder
 @synthesize result;
 - (void) dealloc {
+  [self dropSubBuilders];
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
   self.result = nil;
+  [prototype_ release];
   [super dealloc];
 }
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[[PBMethodDescriptorProto alloc] init] autorelease];
+    result = [PBMethodDescriptorProto recycledInstance];
   }
   return self;
 }
+- (id) initWithPrototype:(PBMethodDescriptorProto*) prototype {
+  if ((self = [super init])) {
+    self.result = prototype;
+    prototype_ = [prototype retain];
+  }
+  return self;
+}
+- (void) detachFromPrototype {
+  PBMethodDescriptorProto* prototype = prototype_;
+  prototype_ = nil;
+  self.result = [[[PBMethodDescriptorProto alloc] init] autorelease];
+  [self mergeFrom:prototype];
+  [prototype release];
+}
+- (PBGeneratedMessage*) internalGetMutableResult {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return [self internalGetResult];
+}
+- (void) freezeSubBuilders {
+  if (optionsBuilder_ != nil) {
+    PBMethodOptions* value = [optionsBuilder_ newBuildPartial];
+    result.options = value;
+    [value release];
+    [optionsBuilder_ release];
+    optionsBuilder_ = nil;
+  }
+}
+- (void) dropSubBuilders {
+  [optionsBuilder_ release];
+  optionsBuilder_ = nil;
+  [optionsSpareBuilder_ release];
+  optionsSpareBuilder_ = nil;
+}
+- (void) resetSubBuilders {
+  if (optionsBuilder_ != nil) {
+    [optionsBuilder_ reset];
+    [optionsSpareBuilder_ release];
+    optionsSpareBuilder_ = optionsBuilder_;
+    optionsBuilder_ = nil;
+  }
+}
 - (PBGeneratedMessage*) internalGetResult {
+  [self freezeSubBuilders];
   return result;
 }
 - (PBMethodDescriptorProto_Builder*) clear {
-  self.result = [[[PBMethodDescriptorProto alloc] init] autorelease];
+  [self dropSubBuilders];
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = [[PBMethodDescriptorProto recycledInstance] autorelease];
   return self;
 }
 - (PBMethodDescriptorProto_Builder*) clone {
-  return [PBMethodDescriptorProto builderWithPrototype:result];
+  if (prototype_ != nil) {
+    return [[[PBMethodDescriptorProto_Builder alloc] initWithPrototype:prototype_] autorelease];
+  }
+  [self freezeSubBuilders];
+  return [[PBMethodDescriptorProto builder] mergeFrom:result];
+}
+- (PBMethodDescriptorProto_Builder*) reset {
+  [self resetSubBuilders];
+  if (result == nil || prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    self.result = [[PBMethodDescriptorProto recycledInstance] autorelease];
+  } else {
+    [result clearForReuse];
+  }
+  return self;
+}
+- (PBMethodDescriptorProto_Builder*) recycle:(PBMethodDescriptorProto*) message {
+  if (message == [PBMethodDescriptorProto defaultInstance]) {
+    @throw [NSException exceptionWithName:@"IllegalArgument" reason:@"Cannot recycle the default instance" userInfo:nil];
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = message;
+  return [self reset];
 }
 - (PBMethodDescriptorProto*) defaultInstance {
   return [PBMethodDescriptorProto defaultInstance];
 }
 - (PBMethodDescriptorProto*) build {
   [self checkInitialized];
-  return [self buildPartial];
+  BOOL shared = prototype_ != nil;
+  PBMethodDescriptorProto* returnMe = [self buildPartial];
+  if (!shared) {
+    [returnMe setInitialized];
+  }
+  return returnMe;
 }
 - (PBMethodDescriptorProto*) buildPartial {
-  PBMethodDescriptorProto* returnMe = [[result retain] autorelease];
-  self.result = nil;
+  return [[self newBuildPartial] autorelease];
+}
+- (PBMethodDescriptorProto*) newBuildPartial {
+  if (prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    PBMethodDescriptorProto* returnMe = result;
+    result = nil;
+    return returnMe;
+  }
+  [self freezeSubBuilders];
+  PBMethodDescriptorProto* returnMe = result;
+  result = nil;
   return returnMe;
 }
 - (PBMethodDescriptorProto_Builder*) mergeFrom:(PBMethodDescriptorProto*) other {
   if (other == [PBMethodDescriptorProto defaultInstance]) {
     return self;
   }
-  if (other.hasName) {
-    [self setName:other.name];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (other->hasBits_[0] & 0x1u) {
+    [self setName:other->name];
   }
-  if (other.hasInputType) {
-    [self setInputType:other.inputType];
+  if (other->hasBits_[0] & 0x2u) {
+    [self setInputType:other->inputType];
   }
-  if (other.hasOutputType) {
-    [self setOutputType:other.outputType];
+  if (other->hasBits_[0] & 0x4u) {
+    [self setOutputType:other->outputType];
   }
-  if (other.hasOptions) {
-    [self mergeOptions:other.options];
+  if (other->hasBits_[0] & 0x8u) {
+    [self mergeOptions:other->options];
   }
   [self mergeUnknownFields:other.unknownFields];
   return self;
@@ -3174,100 +5613,147 @@ static PBMethodDescriptorProto* defaultPBMethodDescriptorProtoInstance = nil;
   return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
 }
 - (PBMethodDescriptorProto_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  PBUnknownFieldSet_Builder* unknownFields = nil;
   while (YES) {
     int32_t tag = [input readTag];
     switch (tag) {
       case 0:
-        [self setUnknownFields:[unknownFields build]];
+        if (unknownFields != nil) {
+          [self setUnknownFields:[unknownFields build]];
+        }
         return self;
       default: {
-        if (![self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag]) {
-          [self setUnknownFields:[unknownFields build]];
+        if (PBWireFormatGetTagWireType(tag) == PBWireFormatEndGroup) {
+          if (unknownFields != nil) {
+            [self setUnknownFields:[unknownFields build]];
+          }
           return self;
         }
+        if (unknownFields == nil) {
+          unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+        }
+        [self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag];
         break;
       }
       case 10: {
-        [self setName:[input readString]];
+        NSString* value = [input newString];
+        [self setName:value];
+        [value release];
         break;
       }
       case 18: {
-        [self setInputType:[input readString]];
+        NSString* value = [input newString];
+        [self setInputType:value];
+        [value release];
         break;
       }
       case 26: {
-        [self setOutputType:[input readString]];
+        NSString* value = [input newString];
+        [self setOutputType:value];
+        [value release];
         break;
       }
       case 34: {
-        PBMethodOptions_Builder* subBuilder = [PBMethodOptions builder];
-        if (self.hasOptions) {
-          [subBuilder mergeFrom:self.options];
+        if (optionsBuilder_ == nil) {
+          optionsBuilder_ = optionsSpareBuilder_ != nil ? optionsSpareBuilder_ : [[PBMethodOptions_Builder alloc] init];
+          optionsSpareBuilder_ = nil;
+          if (result->hasBits_[0] & 0x8u) {
+            [optionsBuilder_ mergeFrom:result->options];
+          }
+          result->hasBits_[0] |= 0x8u;
         }
-        [input readMessage:subBuilder extensionRegistry:extensionRegistry];
-        [self setOptions:[subBuilder buildPartial]];
+        [input readMessage:optionsBuilder_ extensionRegistry:extensionRegistry];
         break;
       }
     }
   }
 }
 - (BOOL) hasName {
-  return result.hasName;
+  return (result->hasBits_[0] & 0x1u) != 0;
 }
 - (NSString*) name {
-  return result.name;
+  return [result name];
 }
 - (PBMethodDescriptorProto_Builder*) setName:(NSString*) value {
-  result.hasName = YES;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x1u;
   result.name = value;
   return self;
 }
 - (PBMethodDescriptorProto_Builder*) clearName {
-  result.hasName = NO;
-  result.name = @"";
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x1u;
+  [result->name release];
+  result->name = nil;
   return self;
 }
 - (BOOL) hasInputType {
-  return result.hasInputType;
+  return (result->hasBits_[0] & 0x2u) != 0;
 }
 - (NSString*) inputType {
-  return result.inputType;
+  return [result inputType];
 }
 - (PBMethodDescriptorProto_Builder*) setInputType:(NSString*) value {
-  result.hasInputType = YES;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x2u;
   result.inputType = value;
   return self;
 }
 - (PBMethodDescriptorProto_Builder*) clearInputType {
-  result.hasInputType = NO;
-  result.inputType = @"";
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x2u;
+  [result->inputType release];
+  result->inputType = nil;
   return self;
 }
 - (BOOL) hasOutputType {
-  return result.hasOutputType;
+  return (result->hasBits_[0] & 0x4u) != 0;
 }
 - (NSString*) outputType {
-  return result.outputType;
+  return [result outputType];
 }
 - (PBMethodDescriptorProto_Builder*) setOutputType:(NSString*) value {
-  result.hasOutputType = YES;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x4u;
   result.outputType = value;
   return self;
 }
 - (PBMethodDescriptorProto_Builder*) clearOutputType {
-  result.hasOutputType = NO;
-  result.outputType = @"";
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x4u;
+  [result->outputType release];
+  result->outputType = nil;
   return self;
 }
 - (BOOL) hasOptions {
-  return result.hasOptions;
+  return (result->hasBits_[0] & 0x8u) != 0;
 }
 - (PBMethodOptions*) options {
+  [self freezeSubBuilders];
   return result.options;
 }
 - (PBMethodDescriptorProto_Builder*) setOptions:(PBMethodOptions*) value {
-  result.hasOptions = YES;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  [optionsBuilder_ release];
+  optionsBuilder_ = nil;
+  result->hasBits_[0] |= 0x8u;
   result.options = value;
   return self;
 }
@@ -3275,103 +5761,227 @@ static PBMethodDescriptorProto* defaultPBMethodDescriptorProtoInstance = nil;
   return [self setOptions:[builderForValue build]];
 }
 - (PBMethodDescriptorProto_Builder*) mergeOptions:(PBMethodOptions*) value {
-  if (result.hasOptions &&
-      result.options != [PBMethodOptions defaultInstance]) {
-    result.options =
-      [[[PBMethodOptions builderWithPrototype:result.options] mergeFrom:value] buildPartial];
-  } else {
-    result.options = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (optionsBuilder_ == nil) {
+    if (!(result->hasBits_[0] & 0x8u) ||
+        result->options == [PBMethodOptions defaultInstance]) {
+      result->hasBits_[0] |= 0x8u;
+      result.options = value;
+      return self;
+    }
+    optionsBuilder_ = optionsSpareBuilder_ != nil ? optionsSpareBuilder_ : [[PBMethodOptions_Builder alloc] init];
+    optionsSpareBuilder_ = nil;
+    [optionsBuilder_ mergeFrom:result->options];
   }
-  result.hasOptions = YES;
+  [optionsBuilder_ mergeFrom:value];
   return self;
 }
 - (PBMethodDescriptorProto_Builder*) clearOptions {
-  result.hasOptions = NO;
-  result.options = [PBMethodOptions defaultInstance];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  [optionsBuilder_ release];
+  optionsBuilder_ = nil;
+  result->hasBits_[0] &= ~0x8u;
+  [result->options release];
+  result->options = nil;
   return self;
 }
 @end
 
 @interface PBFileOptions ()
-@property (retain) NSString* javaPackage;
-@property (retain) NSString* javaOuterClassname;
-@property BOOL javaMultipleFiles;
-@property PBFileOptions_OptimizeMode optimizeFor;
-@property (retain) NSMutableArray* mutableUninterpretedOptionList;
+@property (nonatomic, retain) NSString* javaPackage;
+@property (nonatomic, retain) NSString* javaOuterClassname;
+@property (nonatomic) BOOL javaMultipleFiles;
+@property (nonatomic) BOOL javaGenerateEqualsAndHash;
+@property (nonatomic) PBFileOptions_OptimizeMode optimizeFor;
+@property (nonatomic) BOOL ccGenericServices;
+@property (nonatomic) BOOL javaGenericServices;
+@property (nonatomic) BOOL pyGenericServices;
+@property (nonatomic, retain) PBObjectArray * uninterpretedOptionArray;
+- (void) setInitialized;
+@end
+
+@interface PBFileOptions_Builder()
+@property (nonatomic, retain) PBFileOptions* result;
+- (id) initWithPrototype:(PBFileOptions*) prototype;
+- (void) detachFromPrototype;
 @end
 
 @implementation PBFileOptions
 
 - (BOOL) hasJavaPackage {
-  return !!hasJavaPackage_;
+  return (hasBits_[0] & 0x1u) != 0;
 }
-- (void) setHasJavaPackage:(BOOL) value {
-  hasJavaPackage_ = !!value;
+- (void) setHasJavaPackage:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x1u;
+  } else {
+    hasBits_[0] &= ~0x1u;
+  }
 }
 @synthesize javaPackage;
+- (NSString*) javaPackage {
+  return (hasBits_[0] & 0x1u) ? javaPackage : @"";
+}
 - (BOOL) hasJavaOuterClassname {
-  return !!hasJavaOuterClassname_;
+  return (hasBits_[0] & 0x2u) != 0;
 }
-- (void) setHasJavaOuterClassname:(BOOL) value {
-  hasJavaOuterClassname_ = !!value;
+- (void) setHasJavaOuterClassname:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x2u;
+  } else {
+    hasBits_[0] &= ~0x2u;
+  }
 }
 @synthesize javaOuterClassname;
+- (NSString*) javaOuterClassname {
+  return (hasBits_[0] & 0x2u) ? javaOuterClassname : @"";
+}
 - (BOOL) hasJavaMultipleFiles {
-  return !!hasJavaMultipleFiles_;
+  return (hasBits_[0] & 0x4u) != 0;
 }
-- (void) setHasJavaMultipleFiles:(BOOL) value {
-  hasJavaMultipleFiles_ = !!value;
+- (void) setHasJavaMultipleFiles:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x4u;
+  } else {
+    hasBits_[0] &= ~0x4u;
+  }
 }
 - (BOOL) javaMultipleFiles {
   return !!javaMultipleFiles_;
 }
-- (void) setJavaMultipleFiles:(BOOL) value {
-  javaMultipleFiles_ = !!value;
+- (void) setJavaMultipleFiles:(BOOL) value_ {
+  javaMultipleFiles_ = !!value_;
+}
+- (BOOL) hasJavaGenerateEqualsAndHash {
+  return (hasBits_[0] & 0x8u) != 0;
+}
+- (void) setHasJavaGenerateEqualsAndHash:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x8u;
+  } else {
+    hasBits_[0] &= ~0x8u;
+  }
+}
+- (BOOL) javaGenerateEqualsAndHash {
+  return !!javaGenerateEqualsAndHash_;
+}
+- (void) setJavaGenerateEqualsAndHash:(BOOL) value_ {
+  javaGenerateEqualsAndHash_ = !!value_;
 }
 - (BOOL) hasOptimizeFor {
-  return !!hasOptimizeFor_;
+  return (hasBits_[0] & 0x10u) != 0;
 }
-- (void) setHasOptimizeFor:(BOOL) value {
-  hasOptimizeFor_ = !!value;
+- (void) setHasOptimizeFor:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x10u;
+  } else {
+    hasBits_[0] &= ~0x10u;
+  }
 }
 @synthesize optimizeFor;
-@synthesize mutableUninterpretedOptionList;
-- (void) dealloc {
-  self.javaPackage = nil;
-  self.javaOuterClassname = nil;
-  self.mutableUninterpretedOptionList = nil;
-  [super dealloc];
+- (PBFileOptions_OptimizeMode) optimizeFor {
+  return (hasBits_[0] & 0x10u) ? optimizeFor : PBFileOptions_OptimizeModeSpeed;
 }
-- (id) init {
-  if ((self = [super init])) {
-    self.javaPackage = @"";
-    self.javaOuterClassname = @"";
-    self.javaMultipleFiles = NO;
-    self.optimizeFor = PBFileOptions_OptimizeModeSpeed;
+- (BOOL) hasCcGenericServices {
+  return (hasBits_[0] & 0x20u) != 0;
+}
+- (void) setHasCcGenericServices:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x20u;
+  } else {
+    hasBits_[0] &= ~0x20u;
   }
-  return self;
 }
-static PBFileOptions* defaultPBFileOptionsInstance = nil;
-+ (void) initialize {
-  if (self == [PBFileOptions class]) {
-    defaultPBFileOptionsInstance = [[PBFileOptions alloc] init];
+- (BOOL) ccGenericServices {
+  return !!ccGenericServices_;
+}
+- (void) setCcGenericServices:(BOOL) value_ {
+  ccGenericServices_ = !!value_;
+}
+- (BOOL) hasJavaGenericServices {
+  return (hasBits_[0] & 0x40u) != 0;
+}
+- (void) setHasJavaGenericServices:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x40u;
+  } else {
+    hasBits_[0] &= ~0x40u;
+  }
+}
+- (BOOL) javaGenericServices {
+  return !!javaGenericServices_;
+}
+- (void) setJavaGenericServices:(BOOL) value_ {
+  javaGenericServices_ = !!value_;
+}
+- (BOOL) hasPyGenericServices {
+  return (hasBits_[0] & 0x80u) != 0;
+}
+- (void) setHasPyGenericServices:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x80u;
+  } else {
+    hasBits_[0] &= ~0x80u;
   }
 }
+- (BOOL) pyGenericServices {
+  return !!pyGenericServices_;
+}
+- (void) setPyGenericServices:(BOOL) value_ {
+  pyGenericServices_ = !!value_;
+}
+@synthesize uninterpretedOptionArray;
+@dynamic uninterpretedOption;
+- (void) dealloc {
+  [javaPackage release];
+  [javaOuterClassname release];
+  [uninterpretedOptionArray release];
+  [super dealloc];
+}
+- (void) clearForReuse {
+  [super clearForReuse];
+  memset(hasBits_, 0, sizeof(hasBits_));
+  [javaPackage release];
+  javaPackage = nil;
+  [javaOuterClassname release];
+  javaOuterClassname = nil;
+  javaMultipleFiles_ = 0;
+  javaGenerateEqualsAndHash_ = 0;
+  optimizeFor = 0;
+  ccGenericServices_ = 0;
+  javaGenericServices_ = 0;
+  pyGenericServices_ = 0;
+  uninterpretedOptionArray = PBAppendableArrayReuse(uninterpretedOptionArray);
+}
+static PBFileOptions* defaultPBFileOptionsInstance = nil;
 + (PBFileOptions*) defaultInstance {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultPBFileOptionsInstance = [[PBFileOptions alloc] init];
+  });
   return defaultPBFileOptionsInstance;
 }
 - (PBFileOptions*) defaultInstance {
-  return defaultPBFileOptionsInstance;
+  return [PBFileOptions defaultInstance];
 }
-- (NSArray*) uninterpretedOptionList {
-  return mutableUninterpretedOptionList;
+- (PBArray *)uninterpretedOption {
+  return uninterpretedOptionArray;
 }
-- (PBUninterpretedOption*) uninterpretedOptionAtIndex:(int32_t) index {
-  id value = [mutableUninterpretedOptionList objectAtIndex:index];
-  return value;
+- (PBUninterpretedOption*)uninterpretedOptionAtIndex:(NSUInteger)index {
+  return PBObjectArrayValueAtIndex(uninterpretedOptionArray, index);
+}
+- (void) setInitialized {
+  hasBits_[0] |= 0x100u;
 }
 - (BOOL) isInitialized {
-  for (PBUninterpretedOption* element in self.uninterpretedOptionList) {
+  if ((hasBits_[0] & 0x100u) != 0) {
+    return YES;
+  }
+  for (PBUninterpretedOption* element in uninterpretedOptionArray) {
     if (!element.isInitialized) {
       return NO;
     }
@@ -3382,19 +5992,31 @@ static PBFileOptions* defaultPBFileOptionsInstance = nil;
   return YES;
 }
 - (void) writeToCodedOutputStream:(PBCodedOutputStream*) output {
-  if (self.hasJavaPackage) {
-    [output writeString:1 value:self.javaPackage];
+  if (hasBits_[0] & 0x1u) {
+    [output writeString:1 value:javaPackage];
   }
-  if (self.hasJavaOuterClassname) {
-    [output writeString:8 value:self.javaOuterClassname];
+  if (hasBits_[0] & 0x2u) {
+    [output writeString:8 value:javaOuterClassname];
   }
-  if (self.hasOptimizeFor) {
-    [output writeEnum:9 value:self.optimizeFor];
+  if (hasBits_[0] & 0x10u) {
+    [output writeEnum:9 value:optimizeFor];
   }
-  if (self.hasJavaMultipleFiles) {
-    [output writeBool:10 value:self.javaMultipleFiles];
+  if (hasBits_[0] & 0x4u) {
+    [output writeBool:10 value:!!javaMultipleFiles_];
   }
-  for (PBUninterpretedOption* element in self.uninterpretedOptionList) {
+  if (hasBits_[0] & 0x20u) {
+    [output writeBool:16 value:!!ccGenericServices_];
+  }
+  if (hasBits_[0] & 0x40u) {
+    [output writeBool:17 value:!!javaGenericServices_];
+  }
+  if (hasBits_[0] & 0x80u) {
+    [output writeBool:18 value:!!pyGenericServices_];
+  }
+  if (hasBits_[0] & 0x8u) {
+    [output writeBool:20 value:!!javaGenerateEqualsAndHash_];
+  }
+  for (PBUninterpretedOption *element in uninterpretedOptionArray) {
     [output writeMessage:999 value:element];
   }
   [self writeExtensionsToCodedOutputStream:output
@@ -3403,31 +6025,43 @@ static PBFileOptions* defaultPBFileOptionsInstance = nil;
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = PBGeneratedMessageGetMemoizedSize(&memoizedSerializedSize);
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
-  if (self.hasJavaPackage) {
-    size += computeStringSize(1, self.javaPackage);
+  size_ = 0;
+  if (hasBits_[0] & 0x1u) {
+    size_ += computeStringSize(1, javaPackage);
+  }
+  if (hasBits_[0] & 0x2u) {
+    size_ += computeStringSize(8, javaOuterClassname);
+  }
+  if (hasBits_[0] & 0x10u) {
+    size_ += computeEnumSize(9, optimizeFor);
+  }
+  if (hasBits_[0] & 0x4u) {
+    size_ += computeBoolSize(10, !!javaMultipleFiles_);
+  }
+  if (hasBits_[0] & 0x20u) {
+    size_ += computeBoolSize(16, !!ccGenericServices_);
   }
-  if (self.hasJavaOuterClassname) {
-    size += computeStringSize(8, self.javaOuterClassname);
+  if (hasBits_[0] & 0x40u) {
+    size_ += computeBoolSize(17, !!javaGenericServices_);
   }
-  if (self.hasOptimizeFor) {
-    size += computeEnumSize(9, self.optimizeFor);
+  if (hasBits_[0] & 0x80u) {
+    size_ += computeBoolSize(18, !!pyGenericServices_);
   }
-  if (self.hasJavaMultipleFiles) {
-    size += computeBoolSize(10, self.javaMultipleFiles);
+  if (hasBits_[0] & 0x8u) {
+    size_ += computeBoolSize(20, !!javaGenerateEqualsAndHash_);
   }
-  for (PBUninterpretedOption* element in self.uninterpretedOptionList) {
-    size += computeMessageSize(999, element);
+  for (PBUninterpretedOption *element in uninterpretedOptionArray) {
+    size_ += computeMessageSize(999, element);
   }
-  size += [self extensionsSerializedSize];
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
+  size_ += [self extensionsSerializedSize];
+  size_ += self.unknownFields.serializedSize;
+  PBGeneratedMessageSetMemoizedSize(&memoizedSerializedSize, size_);
+  return size_;
 }
 + (PBFileOptions*) parseFromData:(NSData*) data {
   return (PBFileOptions*)[[[PBFileOptions builder] mergeFromData:data] build];
@@ -3451,11 +6085,121 @@ static PBFileOptions* defaultPBFileOptionsInstance = nil;
   return [[[PBFileOptions_Builder alloc] init] autorelease];
 }
 + (PBFileOptions_Builder*) builderWithPrototype:(PBFileOptions*) prototype {
-  return [[PBFileOptions builder] mergeFrom:prototype];
+  return [[[PBFileOptions_Builder alloc] initWithPrototype:prototype] autorelease];
 }
 - (PBFileOptions_Builder*) builder {
   return [PBFileOptions builder];
 }
+- (PBFileOptions_Builder*) toBuilder {
+  return [PBFileOptions builderWithPrototype:self];
+}
+- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
+  if (hasBits_[0] & 0x1u) {
+    [output appendFormat:@"%@%@: %@\n", indent, @"javaPackage", javaPackage];
+  }
+  if (hasBits_[0] & 0x2u) {
+    [output appendFormat:@"%@%@: %@\n", indent, @"javaOuterClassname", javaOuterClassname];
+  }
+  if (hasBits_[0] & 0x10u) {
+    [output appendFormat:@"%@%@: %d\n", indent, @"optimizeFor", optimizeFor];
+  }
+  if (hasBits_[0] & 0x4u) {
+    [output appendFormat:@"%@%@: %@\n", indent, @"javaMultipleFiles", [NSNumber numberWithBool:!!javaMultipleFiles_]];
+  }
+  if (hasBits_[0] & 0x20u) {
+    [output appendFormat:@"%@%@: %@\n", indent, @"ccGenericServices", [NSNumber numberWithBool:!!ccGenericServices_]];
+  }
+  if (hasBits_[0] & 0x40u) {
+    [output appendFormat:@"%@%@: %@\n", indent, @"javaGenericServices", [NSNumber numberWithBool:!!javaGenericServices_]];
+  }
+  if (hasBits_[0] & 0x80u) {
+    [output appendFormat:@"%@%@: %@\n", indent, @"pyGenericServices", [NSNumber numberWithBool:!!pyGenericServices_]];
+  }
+  if (hasBits_[0] & 0x8u) {
+    [output appendFormat:@"%@%@: %@\n", indent, @"javaGenerateEqualsAndHash", [NSNumber numberWithBool:!!javaGenerateEqualsAndHash_]];
+  }
+  for (PBUninterpretedOption* element in uninterpretedOptionArray) {
+    [output appendFormat:@"%@%@ {\n", indent, @"uninterpretedOption"];
+    [element writeDescriptionTo:output
+                     withIndent:[NSString stringWithFormat:@"%@  ", indent]];
+    [output appendFormat:@"%@}\n", indent];
+  }
+  [self writeExtensionDescriptionToMutableString:(NSMutableString*)output
+                                            from:1000
+                                              to:536870912
+                                      withIndent:indent];
+  [self.unknownFields writeDescriptionTo:output withIndent:indent];
+}
+- (BOOL) isEqual:(id)other {
+  if (other == self) {
+    return YES;
+  }
+  if (![other isKindOfClass:[PBFileOptions class]]) {
+    return NO;
+  }
+  PBFileOptions *otherMessage = other;
+  return
+      (hasBits_[0] & 0x1u) == (otherMessage->hasBits_[0] & 0x1u) &&
+      (!(hasBits_[0] & 0x1u) || [javaPackage isEqual:otherMessage->javaPackage]) &&
+      (hasBits_[0] & 0x2u) == (otherMessage->hasBits_[0] & 0x2u) &&
+      (!(hasBits_[0] & 0x2u) || [javaOuterClassname isEqual:otherMessage->javaOuterClassname]) &&
+      (hasBits_[0] & 0x10u) == (otherMessage->hasBits_[0] & 0x10u) &&
+      (!(hasBits_[0] & 0x10u) || optimizeFor == otherMessage->optimizeFor) &&
+      (hasBits_[0] & 0x4u) == (otherMessage->hasBits_[0] & 0x4u) &&
+      (!(hasBits_[0] & 0x4u) || !!javaMultipleFiles_ == !!otherMessage->javaMultipleFiles_) &&
+      (hasBits_[0] & 0x20u) == (otherMessage->hasBits_[0] & 0x20u) &&
+      (!(hasBits_[0] & 0x20u) || !!ccGenericServices_ == !!otherMessage->ccGenericServices_) &&
+      (hasBits_[0] & 0x40u) == (otherMessage->hasBits_[0] & 0x40u) &&
+      (!(hasBits_[0] & 0x40u) || !!javaGenericServices_ == !!otherMessage->javaGenericServices_) &&
+      (hasBits_[0] & 0x80u) == (otherMessage->hasBits_[0] & 0x80u) &&
+      (!(hasBits_[0] & 0x80u) || !!pyGenericServices_ == !!otherMessage->pyGenericServices_) &&
+      (hasBits_[0] & 0x8u) == (otherMessage->hasBits_[0] & 0x8u) &&
+      (!(hasBits_[0] & 0x8u) || !!javaGenerateEqualsAndHash_ == !!otherMessage->javaGenerateEqualsAndHash_) &&
+      (uninterpretedOptionArray.count == 0 ? otherMessage->uninterpretedOptionArray.count == 0 : [uninterpretedOptionArray isEqualToArray:otherMessage->uninterpretedOptionArray]) &&
+      [self isEqualExtensionsInOther:otherMessage from:1000 to:536870912] &&
+
+      (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
+}
+- (NSUInteger) hash {
+  NSUInteger hash_ = PBGeneratedMessageGetMemoizedHash(&memoizedHash);
+  if (hash_ != 0) {
+    return hash_;
+  }
+
+  uint64_t hashCode = 7;
+  if (hasBits_[0] & 0x1u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [javaPackage hash]);
+  }
+  if (hasBits_[0] & 0x2u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [javaOuterClassname hash]);
+  }
+  if (hasBits_[0] & 0x10u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, (uint64_t)optimizeFor);
+  }
+  if (hasBits_[0] & 0x4u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, (uint64_t)!!javaMultipleFiles_);
+  }
+  if (hasBits_[0] & 0x20u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, (uint64_t)!!ccGenericServices_);
+  }
+  if (hasBits_[0] & 0x40u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, (uint64_t)!!javaGenericServices_);
+  }
+  if (hasBits_[0] & 0x80u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, (uint64_t)!!pyGenericServices_);
+  }
+  if (hasBits_[0] & 0x8u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, (uint64_t)!!javaGenerateEqualsAndHash_);
+  }
+  for (PBUninterpretedOption* element in uninterpretedOptionArray) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [element hash]);
+  }
+  hashCode = PBGeneratedMessageHashMix(hashCode, [self hashExtensionsFrom:1000 to:536870912]);
+  hashCode = PBGeneratedMessageHashMix(hashCode, [self.unknownFields hash]);
+  hash_ = PBGeneratedMessageHashFinish(hashCode);
+  PBGeneratedMessageSetMemoizedHash(&memoizedHash, hash_);
+  return hash_;
+}
 @end
 
 BOOL PBFileOptions_OptimizeModeIsValidValue(PBFileOptions_OptimizeMode value) {
@@ -3468,65 +6212,144 @@ BOOL PBFileOptions_OptimizeModeIsValidValue(PBFileOptions_OptimizeMode value) {
       return NO;
   }
 }
-@interface PBFileOptions_Builder()
-@property (retain) PBFileOptions* result;
-@end
-
 @implementation PBFileOptions_Builder
 @synthesize result;
 - (void) dealloc {
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
   self.result = nil;
+  [prototype_ release];
   [super dealloc];
 }
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[[PBFileOptions alloc] init] autorelease];
+    result = [PBFileOptions recycledInstance];
   }
   return self;
 }
+- (id) initWithPrototype:(PBFileOptions*) prototype {
+  if ((self = [super init])) {
+    self.result = prototype;
+    prototype_ = [prototype retain];
+  }
+  return self;
+}
+- (void) detachFromPrototype {
+  PBFileOptions* prototype = prototype_;
+  prototype_ = nil;
+  self.result = [[[PBFileOptions alloc] init] autorelease];
+  [self mergeFrom:prototype];
+  [prototype release];
+}
+- (PBExtendableMessage*) internalGetMutableResult {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return [self internalGetResult];
+}
 - (PBExtendableMessage*) internalGetResult {
   return result;
 }
 - (PBFileOptions_Builder*) clear {
-  self.result = [[[PBFileOptions alloc] init] autorelease];
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = [[PBFileOptions recycledInstance] autorelease];
   return self;
 }
 - (PBFileOptions_Builder*) clone {
-  return [PBFileOptions builderWithPrototype:result];
+  if (prototype_ != nil) {
+    return [[[PBFileOptions_Builder alloc] initWithPrototype:prototype_] autorelease];
+  }
+  return [[PBFileOptions builder] mergeFrom:result];
+}
+- (PBFileOptions_Builder*) reset {
+  if (result == nil || prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    self.result = [[PBFileOptions recycledInstance] autorelease];
+  } else {
+    [result clearForReuse];
+  }
+  return self;
+}
+- (PBFileOptions_Builder*) recycle:(PBFileOptions*) message {
+  if (message == [PBFileOptions defaultInstance]) {
+    @throw [NSException exceptionWithName:@"IllegalArgument" reason:@"Cannot recycle the default instance" userInfo:nil];
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = message;
+  return [self reset];
 }
 - (PBFileOptions*) defaultInstance {
   return [PBFileOptions defaultInstance];
 }
 - (PBFileOptions*) build {
   [self checkInitialized];
-  return [self buildPartial];
+  BOOL shared = prototype_ != nil;
+  PBFileOptions* returnMe = [self buildPartial];
+  if (!shared) {
+    [returnMe setInitialized];
+  }
+  return returnMe;
 }
 - (PBFileOptions*) buildPartial {
-  PBFileOptions* returnMe = [[result retain] autorelease];
-  self.result = nil;
+  return [[self newBuildPartial] autorelease];
+}
+- (PBFileOptions*) newBuildPartial {
+  if (prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    PBFileOptions* returnMe = result;
+    result = nil;
+    return returnMe;
+  }
+  [result->uninterpretedOptionArray shrinkToFit];
+  PBFileOptions* returnMe = result;
+  result = nil;
   return returnMe;
 }
 - (PBFileOptions_Builder*) mergeFrom:(PBFileOptions*) other {
   if (other == [PBFileOptions defaultInstance]) {
     return self;
   }
-  if (other.hasJavaPackage) {
-    [self setJavaPackage:other.javaPackage];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (other->hasBits_[0] & 0x1u) {
+    [self setJavaPackage:other->javaPackage];
+  }
+  if (other->hasBits_[0] & 0x2u) {
+    [self setJavaOuterClassname:other->javaOuterClassname];
+  }
+  if (other->hasBits_[0] & 0x4u) {
+    [self setJavaMultipleFiles:other->javaMultipleFiles_];
   }
-  if (other.hasJavaOuterClassname) {
-    [self setJavaOuterClassname:other.javaOuterClassname];
+  if (other->hasBits_[0] & 0x8u) {
+    [self setJavaGenerateEqualsAndHash:other->javaGenerateEqualsAndHash_];
   }
-  if (other.hasJavaMultipleFiles) {
-    [self setJavaMultipleFiles:other.javaMultipleFiles];
+  if (other->hasBits_[0] & 0x10u) {
+    [self setOptimizeFor:other->optimizeFor];
   }
-  if (other.hasOptimizeFor) {
-    [self setOptimizeFor:other.optimizeFor];
+  if (other->hasBits_[0] & 0x20u) {
+    [self setCcGenericServices:other->ccGenericServices_];
   }
-  if (other.mutableUninterpretedOptionList.count > 0) {
-    if (result.mutableUninterpretedOptionList == nil) {
-      result.mutableUninterpretedOptionList = [NSMutableArray array];
+  if (other->hasBits_[0] & 0x40u) {
+    [self setJavaGenericServices:other->javaGenericServices_];
+  }
+  if (other->hasBits_[0] & 0x80u) {
+    [self setPyGenericServices:other->pyGenericServices_];
+  }
+  if (other->uninterpretedOptionArray.count > 0) {
+    if (result->uninterpretedOptionArray == nil) {
+      result.uninterpretedOptionArray = [[other->uninterpretedOptionArray copyWithZone:[other->uninterpretedOptionArray zone]] autorelease];
+    } else {
+      [result->uninterpretedOptionArray appendArray:other->uninterpretedOptionArray];
     }
-    [result.mutableUninterpretedOptionList addObjectsFromArray:other.mutableUninterpretedOptionList];
   }
   [self mergeExtensionFields:other];
   [self mergeUnknownFields:other.unknownFields];
@@ -3536,26 +6359,41 @@ BOOL PBFileOptions_OptimizeModeIsValidValue(PBFileOptions_OptimizeMode value) {
   return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
 }
 - (PBFileOptions_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  PBUnknownFieldSet_Builder* unknownFields = nil;
   while (YES) {
     int32_t tag = [input readTag];
     switch (tag) {
       case 0:
-        [self setUnknownFields:[unknownFields build]];
+        if (unknownFields != nil) {
+          [self setUnknownFields:[unknownFields build]];
+        }
         return self;
       default: {
-        if (![self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag]) {
-          [self setUnknownFields:[unknownFields build]];
+        if (PBWireFormatGetTagWireType(tag) == PBWireFormatEndGroup) {
+          if (unknownFields != nil) {
+            [self setUnknownFields:[unknownFields build]];
+          }
           return self;
         }
+        if (unknownFields == nil) {
+          unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+        }
+        [self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag];
         break;
       }
       case 10: {
-        [self setJavaPackage:[input readString]];
+        NSString* value = [input newString];
+        [self setJavaPackage:value];
+        [value release];
         break;
       }
       case 66: {
-        [self setJavaOuterClassname:[input readString]];
+        NSString* value = [input newString];
+        [self setJavaOuterClassname:value];
+        [value release];
         break;
       }
       case 72: {
@@ -3563,6 +6401,9 @@ BOOL PBFileOptions_OptimizeModeIsValidValue(PBFileOptions_OptimizeMode value) {
         if (PBFileOptions_OptimizeModeIsValidValue(value)) {
           [self setOptimizeFor:value];
         } else {
+          if (unknownFields == nil) {
+            unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+          }
           [unknownFields mergeVarintField:9 value:value];
         }
         break;
@@ -3571,175 +6412,342 @@ BOOL PBFileOptions_OptimizeModeIsValidValue(PBFileOptions_OptimizeMode value) {
         [self setJavaMultipleFiles:[input readBool]];
         break;
       }
+      case 128: {
+        [self setCcGenericServices:[input readBool]];
+        break;
+      }
+      case 136: {
+        [self setJavaGenericServices:[input readBool]];
+        break;
+      }
+      case 144: {
+        [self setPyGenericServices:[input readBool]];
+        break;
+      }
+      case 160: {
+        [self setJavaGenerateEqualsAndHash:[input readBool]];
+        break;
+      }
       case 7994: {
-        PBUninterpretedOption_Builder* subBuilder = [PBUninterpretedOption builder];
-        [input readMessage:subBuilder extensionRegistry:extensionRegistry];
-        [self addUninterpretedOption:[subBuilder buildPartial]];
+        PBUninterpretedOption_Builder* subBuilder = [[PBUninterpretedOption_Builder alloc] init];
+        @try {
+          [input readMessage:subBuilder extensionRegistry:extensionRegistry];
+          PBUninterpretedOption* value = [subBuilder newBuildPartial];
+          [self addUninterpretedOption:value];
+          [value release];
+        } @finally {
+          [subBuilder release];
+        }
         break;
       }
     }
   }
 }
 - (BOOL) hasJavaPackage {
-  return result.hasJavaPackage;
+  return (result->hasBits_[0] & 0x1u) != 0;
 }
 - (NSString*) javaPackage {
-  return result.javaPackage;
+  return [result javaPackage];
 }
 - (PBFileOptions_Builder*) setJavaPackage:(NSString*) value {
-  result.hasJavaPackage = YES;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x1u;
   result.javaPackage = value;
   return self;
 }
 - (PBFileOptions_Builder*) clearJavaPackage {
-  result.hasJavaPackage = NO;
-  result.javaPackage = @"";
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x1u;
+  [result->javaPackage release];
+  result->javaPackage = nil;
   return self;
 }
 - (BOOL) hasJavaOuterClassname {
-  return result.hasJavaOuterClassname;
+  return (result->hasBits_[0] & 0x2u) != 0;
 }
 - (NSString*) javaOuterClassname {
-  return result.javaOuterClassname;
+  return [result javaOuterClassname];
 }
 - (PBFileOptions_Builder*) setJavaOuterClassname:(NSString*) value {
-  result.hasJavaOuterClassname = YES;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x2u;
   result.javaOuterClassname = value;
   return self;
 }
 - (PBFileOptions_Builder*) clearJavaOuterClassname {
-  result.hasJavaOuterClassname = NO;
-  result.javaOuterClassname = @"";
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x2u;
+  [result->javaOuterClassname release];
+  result->javaOuterClassname = nil;
   return self;
 }
 - (BOOL) hasJavaMultipleFiles {
-  return result.hasJavaMultipleFiles;
+  return (result->hasBits_[0] & 0x4u) != 0;
 }
 - (BOOL) javaMultipleFiles {
-  return result.javaMultipleFiles;
+  return (result->hasBits_[0] & 0x4u) ? !!result->javaMultipleFiles_ : NO;
 }
 - (PBFileOptions_Builder*) setJavaMultipleFiles:(BOOL) value {
-  result.hasJavaMultipleFiles = YES;
-  result.javaMultipleFiles = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x4u;
+  result->javaMultipleFiles_ = !!value;
   return self;
 }
 - (PBFileOptions_Builder*) clearJavaMultipleFiles {
-  result.hasJavaMultipleFiles = NO;
-  result.javaMultipleFiles = NO;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x4u;
+  result->javaMultipleFiles_ = 0;
+  return self;
+}
+- (BOOL) hasJavaGenerateEqualsAndHash {
+  return (result->hasBits_[0] & 0x8u) != 0;
+}
+- (BOOL) javaGenerateEqualsAndHash {
+  return (result->hasBits_[0] & 0x8u) ? !!result->javaGenerateEqualsAndHash_ : NO;
+}
+- (PBFileOptions_Builder*) setJavaGenerateEqualsAndHash:(BOOL) value {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x8u;
+  result->javaGenerateEqualsAndHash_ = !!value;
+  return self;
+}
+- (PBFileOptions_Builder*) clearJavaGenerateEqualsAndHash {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x8u;
+  result->javaGenerateEqualsAndHash_ = 0;
   return self;
 }
 - (BOOL) hasOptimizeFor {
-  return result.hasOptimizeFor;
+  return (result->hasBits_[0] & 0x10u) != 0;
 }
 - (PBFileOptions_OptimizeMode) optimizeFor {
-  return result.optimizeFor;
+  return (result->hasBits_[0] & 0x10u) ? result->optimizeFor : PBFileOptions_OptimizeModeSpeed;
 }
 - (PBFileOptions_Builder*) setOptimizeFor:(PBFileOptions_OptimizeMode) value {
-  result.hasOptimizeFor = YES;
-  result.optimizeFor = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x10u;
+  result->optimizeFor = value;
   return self;
 }
 - (PBFileOptions_Builder*) clearOptimizeFor {
-  result.hasOptimizeFor = NO;
-  result.optimizeFor = PBFileOptions_OptimizeModeSpeed;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x10u;
+  result->optimizeFor = 0;
+  return self;
+}
+- (BOOL) hasCcGenericServices {
+  return (result->hasBits_[0] & 0x20u) != 0;
+}
+- (BOOL) ccGenericServices {
+  return (result->hasBits_[0] & 0x20u) ? !!result->ccGenericServices_ : NO;
+}
+- (PBFileOptions_Builder*) setCcGenericServices:(BOOL) value {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x20u;
+  result->ccGenericServices_ = !!value;
+  return self;
+}
+- (PBFileOptions_Builder*) clearCcGenericServices {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x20u;
+  result->ccGenericServices_ = 0;
   return self;
 }
-- (NSArray*) uninterpretedOptionList {
-  if (result.mutableUninterpretedOptionList == nil) { return [NSArray array]; }
-  return result.mutableUninterpretedOptionList;
+- (BOOL) hasJavaGenericServices {
+  return (result->hasBits_[0] & 0x40u) != 0;
 }
-- (PBUninterpretedOption*) uninterpretedOptionAtIndex:(int32_t) index {
+- (BOOL) javaGenericServices {
+  return (result->hasBits_[0] & 0x40u) ? !!result->javaGenericServices_ : NO;
+}
+- (PBFileOptions_Builder*) setJavaGenericServices:(BOOL) value {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x40u;
+  result->javaGenericServices_ = !!value;
+  return self;
+}
+- (PBFileOptions_Builder*) clearJavaGenericServices {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x40u;
+  result->javaGenericServices_ = 0;
+  return self;
+}
+- (BOOL) hasPyGenericServices {
+  return (result->hasBits_[0] & 0x80u) != 0;
+}
+- (BOOL) pyGenericServices {
+  return (result->hasBits_[0] & 0x80u) ? !!result->pyGenericServices_ : NO;
+}
+- (PBFileOptions_Builder*) setPyGenericServices:(BOOL) value {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x80u;
+  result->pyGenericServices_ = !!value;
+  return self;
+}
+- (PBFileOptions_Builder*) clearPyGenericServices {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x80u;
+  result->pyGenericServices_ = 0;
+  return self;
+}
+- (PBAppendableArray *)uninterpretedOption {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return result->uninterpretedOptionArray;
+}
+- (PBUninterpretedOption*)uninterpretedOptionAtIndex:(NSUInteger)index {
   return [result uninterpretedOptionAtIndex:index];
 }
-- (PBFileOptions_Builder*) replaceUninterpretedOptionAtIndex:(int32_t) index with:(PBUninterpretedOption*) value {
-  [result.mutableUninterpretedOptionList replaceObjectAtIndex:index withObject:value];
+- (PBFileOptions_Builder *)addUninterpretedOption:(PBUninterpretedOption*)value {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (result->uninterpretedOptionArray == nil) {
+    result.uninterpretedOptionArray = [PBObjectArray array];
+  }
+  PBObjectArrayAddValue(result->uninterpretedOptionArray, value);
   return self;
 }
-- (PBFileOptions_Builder*) addAllUninterpretedOption:(NSArray*) values {
-  if (result.mutableUninterpretedOptionList == nil) {
-    result.mutableUninterpretedOptionList = [NSMutableArray array];
+- (PBFileOptions_Builder *)setUninterpretedOptionArray:(NSArray *)array {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  [result.mutableUninterpretedOptionList addObjectsFromArray:values];
+  result.uninterpretedOptionArray = [PBObjectArray arrayWithArray:array valueType:PBArrayValueTypeObject];
   return self;
 }
-- (PBFileOptions_Builder*) clearUninterpretedOptionList {
-  result.mutableUninterpretedOptionList = nil;
+- (PBFileOptions_Builder *)setUninterpretedOptionValues:(const PBUninterpretedOption* *)values count:(NSUInteger)count {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.uninterpretedOptionArray = [PBObjectArray arrayWithValues:values count:count valueType:PBArrayValueTypeObject];
   return self;
 }
-- (PBFileOptions_Builder*) addUninterpretedOption:(PBUninterpretedOption*) value {
-  if (result.mutableUninterpretedOptionList == nil) {
-    result.mutableUninterpretedOptionList = [NSMutableArray array];
+- (PBFileOptions_Builder *)clearUninterpretedOption {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  [result.mutableUninterpretedOptionList addObject:value];
+  result.uninterpretedOptionArray = nil;
   return self;
 }
 @end
 
 @interface PBMessageOptions ()
-@property BOOL messageSetWireFormat;
-@property BOOL noStandardDescriptorAccessor;
-@property (retain) NSMutableArray* mutableUninterpretedOptionList;
+@property (nonatomic) BOOL messageSetWireFormat;
+@property (nonatomic) BOOL noStandardDescriptorAccessor;
+@property (nonatomic, retain) PBObjectArray * uninterpretedOptionArray;
+- (void) setInitialized;
+@end
+
+@interface PBMessageOptions_Builder()
+@property (nonatomic, retain) PBMessageOptions* result;
+- (id) initWithPrototype:(PBMessageOptions*) prototype;
+- (void) detachFromPrototype;
 @end
 
 @implementation PBMessageOptions
 
 - (BOOL) hasMessageSetWireFormat {
-  return !!hasMessageSetWireFormat_;
+  return (hasBits_[0] & 0x1u) != 0;
 }
-- (void) setHasMessageSetWireFormat:(BOOL) value {
-  hasMessageSetWireFormat_ = !!value;
+- (void) setHasMessageSetWireFormat:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x1u;
+  } else {
+    hasBits_[0] &= ~0x1u;
+  }
 }
 - (BOOL) messageSetWireFormat {
   return !!messageSetWireFormat_;
 }
-- (void) setMessageSetWireFormat:(BOOL) value {
-  messageSetWireFormat_ = !!value;
+- (void) setMessageSetWireFormat:(BOOL) value_ {
+  messageSetWireFormat_ = !!value_;
 }
 - (BOOL) hasNoStandardDescriptorAccessor {
-  return !!hasNoStandardDescriptorAccessor_;
+  return (hasBits_[0] & 0x2u) != 0;
 }
-- (void) setHasNoStandardDescriptorAccessor:(BOOL) value {
-  hasNoStandardDescriptorAccessor_ = !!value;
+- (void) setHasNoStandardDescriptorAccessor:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x2u;
+  } else {
+    hasBits_[0] &= ~0x2u;
+  }
 }
 - (BOOL) noStandardDescriptorAccessor {
   return !!noStandardDescriptorAccessor_;
 }
-- (void) setNoStandardDescriptorAccessor:(BOOL) value {
-  noStandardDescriptorAccessor_ = !!value;
+- (void) setNoStandardDescriptorAccessor:(BOOL) value_ {
+  noStandardDescriptorAccessor_ = !!value_;
 }
-@synthesize mutableUninterpretedOptionList;
+@synthesize uninterpretedOptionArray;
+@dynamic uninterpretedOption;
 - (void) dealloc {
-  self.mutableUninterpretedOptionList = nil;
+  [uninterpretedOptionArray release];
   [super dealloc];
 }
-- (id) init {
-  if ((self = [super init])) {
-    self.messageSetWireFormat = NO;
-    self.noStandardDescriptorAccessor = NO;
-  }
-  return self;
+- (void) clearForReuse {
+  [super clearForReuse];
+  memset(hasBits_, 0, sizeof(hasBits_));
+  messageSetWireFormat_ = 0;
+  noStandardDescriptorAccessor_ = 0;
+  uninterpretedOptionArray = PBAppendableArrayReuse(uninterpretedOptionArray);
 }
 static PBMessageOptions* defaultPBMessageOptionsInstance = nil;
-+ (void) initialize {
-  if (self == [PBMessageOptions class]) {
-    defaultPBMessageOptionsInstance = [[PBMessageOptions alloc] init];
-  }
-}
 + (PBMessageOptions*) defaultInstance {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultPBMessageOptionsInstance = [[PBMessageOptions alloc] init];
+  });
   return defaultPBMessageOptionsInstance;
 }
 - (PBMessageOptions*) defaultInstance {
-  return defaultPBMessageOptionsInstance;
+  return [PBMessageOptions defaultInstance];
 }
-- (NSArray*) uninterpretedOptionList {
-  return mutableUninterpretedOptionList;
+- (PBArray *)uninterpretedOption {
+  return uninterpretedOptionArray;
 }
-- (PBUninterpretedOption*) uninterpretedOptionAtIndex:(int32_t) index {
-  id value = [mutableUninterpretedOptionList objectAtIndex:index];
-  return value;
+- (PBUninterpretedOption*)uninterpretedOptionAtIndex:(NSUInteger)index {
+  return PBObjectArrayValueAtIndex(uninterpretedOptionArray, index);
+}
+- (void) setInitialized {
+  hasBits_[0] |= 0x4u;
 }
 - (BOOL) isInitialized {
-  for (PBUninterpretedOption* element in self.uninterpretedOptionList) {
+  if ((hasBits_[0] & 0x4u) != 0) {
+    return YES;
+  }
+  for (PBUninterpretedOption* element in uninterpretedOptionArray) {
     if (!element.isInitialized) {
       return NO;
     }
@@ -3750,13 +6758,13 @@ static PBMessageOptions* defaultPBMessageOptionsInstance = nil;
   return YES;
 }
 - (void) writeToCodedOutputStream:(PBCodedOutputStream*) output {
-  if (self.hasMessageSetWireFormat) {
-    [output writeBool:1 value:self.messageSetWireFormat];
+  if (hasBits_[0] & 0x1u) {
+    [output writeBool:1 value:!!messageSetWireFormat_];
   }
-  if (self.hasNoStandardDescriptorAccessor) {
-    [output writeBool:2 value:self.noStandardDescriptorAccessor];
+  if (hasBits_[0] & 0x2u) {
+    [output writeBool:2 value:!!noStandardDescriptorAccessor_];
   }
-  for (PBUninterpretedOption* element in self.uninterpretedOptionList) {
+  for (PBUninterpretedOption *element in uninterpretedOptionArray) {
     [output writeMessage:999 value:element];
   }
   [self writeExtensionsToCodedOutputStream:output
@@ -3765,25 +6773,25 @@ static PBMessageOptions* defaultPBMessageOptionsInstance = nil;
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = PBGeneratedMessageGetMemoizedSize(&memoizedSerializedSize);
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
-  if (self.hasMessageSetWireFormat) {
-    size += computeBoolSize(1, self.messageSetWireFormat);
+  size_ = 0;
+  if (hasBits_[0] & 0x1u) {
+    size_ += computeBoolSize(1, !!messageSetWireFormat_);
   }
-  if (self.hasNoStandardDescriptorAccessor) {
-    size += computeBoolSize(2, self.noStandardDescriptorAccessor);
+  if (hasBits_[0] & 0x2u) {
+    size_ += computeBoolSize(2, !!noStandardDescriptorAccessor_);
   }
-  for (PBUninterpretedOption* element in self.uninterpretedOptionList) {
-    size += computeMessageSize(999, element);
+  for (PBUninterpretedOption *element in uninterpretedOptionArray) {
+    size_ += computeMessageSize(999, element);
   }
-  size += [self extensionsSerializedSize];
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
+  size_ += [self extensionsSerializedSize];
+  size_ += self.unknownFields.serializedSize;
+  PBGeneratedMessageSetMemoizedSize(&memoizedSerializedSize, size_);
+  return size_;
 }
 + (PBMessageOptions*) parseFromData:(NSData*) data {
   return (PBMessageOptions*)[[[PBMessageOptions builder] mergeFromData:data] build];
@@ -3807,66 +6815,195 @@ static PBMessageOptions* defaultPBMessageOptionsInstance = nil;
   return [[[PBMessageOptions_Builder alloc] init] autorelease];
 }
 + (PBMessageOptions_Builder*) builderWithPrototype:(PBMessageOptions*) prototype {
-  return [[PBMessageOptions builder] mergeFrom:prototype];
+  return [[[PBMessageOptions_Builder alloc] initWithPrototype:prototype] autorelease];
 }
 - (PBMessageOptions_Builder*) builder {
   return [PBMessageOptions builder];
 }
-@end
+- (PBMessageOptions_Builder*) toBuilder {
+  return [PBMessageOptions builderWithPrototype:self];
+}
+- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
+  if (hasBits_[0] & 0x1u) {
+    [output appendFormat:@"%@%@: %@\n", indent, @"messageSetWireFormat", [NSNumber numberWithBool:!!messageSetWireFormat_]];
+  }
+  if (hasBits_[0] & 0x2u) {
+    [output appendFormat:@"%@%@: %@\n", indent, @"noStandardDescriptorAccessor", [NSNumber numberWithBool:!!noStandardDescriptorAccessor_]];
+  }
+  for (PBUninterpretedOption* element in uninterpretedOptionArray) {
+    [output appendFormat:@"%@%@ {\n", indent, @"uninterpretedOption"];
+    [element writeDescriptionTo:output
+                     withIndent:[NSString stringWithFormat:@"%@  ", indent]];
+    [output appendFormat:@"%@}\n", indent];
+  }
+  [self writeExtensionDescriptionToMutableString:(NSMutableString*)output
+                                            from:1000
+                                              to:536870912
+                                      withIndent:indent];
+  [self.unknownFields writeDescriptionTo:output withIndent:indent];
+}
+- (BOOL) isEqual:(id)other {
+  if (other == self) {
+    return YES;
+  }
+  if (![other isKindOfClass:[PBMessageOptions class]]) {
+    return NO;
+  }
+  PBMessageOptions *otherMessage = other;
+  return
+      (hasBits_[0] & 0x1u) == (otherMessage->hasBits_[0] & 0x1u) &&
+      (!(hasBits_[0] & 0x1u) || !!messageSetWireFormat_ == !!otherMessage->messageSetWireFormat_) &&
+      (hasBits_[0] & 0x2u) == (otherMessage->hasBits_[0] & 0x2u) &&
+      (!(hasBits_[0] & 0x2u) || !!noStandardDescriptorAccessor_ == !!otherMessage->noStandardDescriptorAccessor_) &&
+      (uninterpretedOptionArray.count == 0 ? otherMessage->uninterpretedOptionArray.count == 0 : [uninterpretedOptionArray isEqualToArray:otherMessage->uninterpretedOptionArray]) &&
+      [self isEqualExtensionsInOther:otherMessage from:1000 to:536870912] &&
 
-@interface PBMessageOptions_Builder()
-@property (retain) PBMessageOptions* result;
+      (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
+}
+- (NSUInteger) hash {
+  NSUInteger hash_ = PBGeneratedMessageGetMemoizedHash(&memoizedHash);
+  if (hash_ != 0) {
+    return hash_;
+  }
+
+  uint64_t hashCode = 7;
+  if (hasBits_[0] & 0x1u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, (uint64_t)!!messageSetWireFormat_);
+  }
+  if (hasBits_[0] & 0x2u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, (uint64_t)!!noStandardDescriptorAccessor_);
+  }
+  for (PBUninterpretedOption* element in uninterpretedOptionArray) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [element hash]);
+  }
+  hashCode = PBGeneratedMessageHashMix(hashCode, [self hashExtensionsFrom:1000 to:536870912]);
+  hashCode = PBGeneratedMessageHashMix(hashCode, [self.unknownFields hash]);
+  hash_ = PBGeneratedMessageHashFinish(hashCode);
+  PBGeneratedMessageSetMemoizedHash(&memoizedHash, hash_);
+  return hash_;
+}
 @end
 
 @implementation PBMessageOptions_Builder
 @synthesize result;
 - (void) dealloc {
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
   self.result = nil;
+  [prototype_ release];
   [super dealloc];
 }
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[[PBMessageOptions alloc] init] autorelease];
+    result = [PBMessageOptions recycledInstance];
+  }
+  return self;
+}
+- (id) initWithPrototype:(PBMessageOptions*) prototype {
+  if ((self = [super init])) {
+    self.result = prototype;
+    prototype_ = [prototype retain];
   }
   return self;
 }
+- (void) detachFromPrototype {
+  PBMessageOptions* prototype = prototype_;
+  prototype_ = nil;
+  self.result = [[[PBMessageOptions alloc] init] autorelease];
+  [self mergeFrom:prototype];
+  [prototype release];
+}
+- (PBExtendableMessage*) internalGetMutableResult {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return [self internalGetResult];
+}
 - (PBExtendableMessage*) internalGetResult {
   return result;
 }
 - (PBMessageOptions_Builder*) clear {
-  self.result = [[[PBMessageOptions alloc] init] autorelease];
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = [[PBMessageOptions recycledInstance] autorelease];
   return self;
 }
 - (PBMessageOptions_Builder*) clone {
-  return [PBMessageOptions builderWithPrototype:result];
+  if (prototype_ != nil) {
+    return [[[PBMessageOptions_Builder alloc] initWithPrototype:prototype_] autorelease];
+  }
+  return [[PBMessageOptions builder] mergeFrom:result];
+}
+- (PBMessageOptions_Builder*) reset {
+  if (result == nil || prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    self.result = [[PBMessageOptions recycledInstance] autorelease];
+  } else {
+    [result clearForReuse];
+  }
+  return self;
+}
+- (PBMessageOptions_Builder*) recycle:(PBMessageOptions*) message {
+  if (message == [PBMessageOptions defaultInstance]) {
+    @throw [NSException exceptionWithName:@"IllegalArgument" reason:@"Cannot recycle the default instance" userInfo:nil];
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = message;
+  return [self reset];
 }
 - (PBMessageOptions*) defaultInstance {
   return [PBMessageOptions defaultInstance];
 }
 - (PBMessageOptions*) build {
   [self checkInitialized];
-  return [self buildPartial];
+  BOOL shared = prototype_ != nil;
+  PBMessageOptions* returnMe = [self buildPartial];
+  if (!shared) {
+    [returnMe setInitialized];
+  }
+  return returnMe;
 }
 - (PBMessageOptions*) buildPartial {
-  PBMessageOptions* returnMe = [[result retain] autorelease];
-  self.result = nil;
+  return [[self newBuildPartial] autorelease];
+}
+- (PBMessageOptions*) newBuildPartial {
+  if (prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    PBMessageOptions* returnMe = result;
+    result = nil;
+    return returnMe;
+  }
+  [result->uninterpretedOptionArray shrinkToFit];
+  PBMessageOptions* returnMe = result;
+  result = nil;
   return returnMe;
 }
 - (PBMessageOptions_Builder*) mergeFrom:(PBMessageOptions*) other {
   if (other == [PBMessageOptions defaultInstance]) {
     return self;
   }
-  if (other.hasMessageSetWireFormat) {
-    [self setMessageSetWireFormat:other.messageSetWireFormat];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (other->hasBits_[0] & 0x1u) {
+    [self setMessageSetWireFormat:other->messageSetWireFormat_];
   }
-  if (other.hasNoStandardDescriptorAccessor) {
-    [self setNoStandardDescriptorAccessor:other.noStandardDescriptorAccessor];
+  if (other->hasBits_[0] & 0x2u) {
+    [self setNoStandardDescriptorAccessor:other->noStandardDescriptorAccessor_];
   }
-  if (other.mutableUninterpretedOptionList.count > 0) {
-    if (result.mutableUninterpretedOptionList == nil) {
-      result.mutableUninterpretedOptionList = [NSMutableArray array];
+  if (other->uninterpretedOptionArray.count > 0) {
+    if (result->uninterpretedOptionArray == nil) {
+      result.uninterpretedOptionArray = [[other->uninterpretedOptionArray copyWithZone:[other->uninterpretedOptionArray zone]] autorelease];
+    } else {
+      [result->uninterpretedOptionArray appendArray:other->uninterpretedOptionArray];
     }
-    [result.mutableUninterpretedOptionList addObjectsFromArray:other.mutableUninterpretedOptionList];
   }
   [self mergeExtensionFields:other];
   [self mergeUnknownFields:other.unknownFields];
@@ -3876,18 +7013,29 @@ static PBMessageOptions* defaultPBMessageOptionsInstance = nil;
   return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
 }
 - (PBMessageOptions_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  PBUnknownFieldSet_Builder* unknownFields = nil;
   while (YES) {
     int32_t tag = [input readTag];
     switch (tag) {
       case 0:
-        [self setUnknownFields:[unknownFields build]];
+        if (unknownFields != nil) {
+          [self setUnknownFields:[unknownFields build]];
+        }
         return self;
       default: {
-        if (![self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag]) {
-          [self setUnknownFields:[unknownFields build]];
+        if (PBWireFormatGetTagWireType(tag) == PBWireFormatEndGroup) {
+          if (unknownFields != nil) {
+            [self setUnknownFields:[unknownFields build]];
+          }
           return self;
         }
+        if (unknownFields == nil) {
+          unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+        }
+        [self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag];
         break;
       }
       case 8: {
@@ -3899,161 +7047,222 @@ static PBMessageOptions* defaultPBMessageOptionsInstance = nil;
         break;
       }
       case 7994: {
-        PBUninterpretedOption_Builder* subBuilder = [PBUninterpretedOption builder];
-        [input readMessage:subBuilder extensionRegistry:extensionRegistry];
-        [self addUninterpretedOption:[subBuilder buildPartial]];
+        PBUninterpretedOption_Builder* subBuilder = [[PBUninterpretedOption_Builder alloc] init];
+        @try {
+          [input readMessage:subBuilder extensionRegistry:extensionRegistry];
+          PBUninterpretedOption* value = [subBuilder newBuildPartial];
+          [self addUninterpretedOption:value];
+          [value release];
+        } @finally {
+          [subBuilder release];
+        }
         break;
       }
     }
   }
 }
 - (BOOL) hasMessageSetWireFormat {
-  return result.hasMessageSetWireFormat;
+  return (result->hasBits_[0] & 0x1u) != 0;
 }
 - (BOOL) messageSetWireFormat {
-  return result.messageSetWireFormat;
+  return (result->hasBits_[0] & 0x1u) ? !!result->messageSetWireFormat_ : NO;
 }
 - (PBMessageOptions_Builder*) setMessageSetWireFormat:(BOOL) value {
-  result.hasMessageSetWireFormat = YES;
-  result.messageSetWireFormat = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x1u;
+  result->messageSetWireFormat_ = !!value;
   return self;
 }
 - (PBMessageOptions_Builder*) clearMessageSetWireFormat {
-  result.hasMessageSetWireFormat = NO;
-  result.messageSetWireFormat = NO;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x1u;
+  result->messageSetWireFormat_ = 0;
   return self;
 }
 - (BOOL) hasNoStandardDescriptorAccessor {
-  return result.hasNoStandardDescriptorAccessor;
+  return (result->hasBits_[0] & 0x2u) != 0;
 }
 - (BOOL) noStandardDescriptorAccessor {
-  return result.noStandardDescriptorAccessor;
+  return (result->hasBits_[0] & 0x2u) ? !!result->noStandardDescriptorAccessor_ : NO;
 }
 - (PBMessageOptions_Builder*) setNoStandardDescriptorAccessor:(BOOL) value {
-  result.hasNoStandardDescriptorAccessor = YES;
-  result.noStandardDescriptorAccessor = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x2u;
+  result->noStandardDescriptorAccessor_ = !!value;
   return self;
 }
 - (PBMessageOptions_Builder*) clearNoStandardDescriptorAccessor {
-  result.hasNoStandardDescriptorAccessor = NO;
-  result.noStandardDescriptorAccessor = NO;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x2u;
+  result->noStandardDescriptorAccessor_ = 0;
   return self;
 }
-- (NSArray*) uninterpretedOptionList {
-  if (result.mutableUninterpretedOptionList == nil) { return [NSArray array]; }
-  return result.mutableUninterpretedOptionList;
+- (PBAppendableArray *)uninterpretedOption {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return result->uninterpretedOptionArray;
 }
-- (PBUninterpretedOption*) uninterpretedOptionAtIndex:(int32_t) index {
+- (PBUninterpretedOption*)uninterpretedOptionAtIndex:(NSUInteger)index {
   return [result uninterpretedOptionAtIndex:index];
 }
-- (PBMessageOptions_Builder*) replaceUninterpretedOptionAtIndex:(int32_t) index with:(PBUninterpretedOption*) value {
-  [result.mutableUninterpretedOptionList replaceObjectAtIndex:index withObject:value];
+- (PBMessageOptions_Builder *)addUninterpretedOption:(PBUninterpretedOption*)value {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (result->uninterpretedOptionArray == nil) {
+    result.uninterpretedOptionArray = [PBObjectArray array];
+  }
+  PBObjectArrayAddValue(result->uninterpretedOptionArray, value);
   return self;
 }
-- (PBMessageOptions_Builder*) addAllUninterpretedOption:(NSArray*) values {
-  if (result.mutableUninterpretedOptionList == nil) {
-    result.mutableUninterpretedOptionList = [NSMutableArray array];
+- (PBMessageOptions_Builder *)setUninterpretedOptionArray:(NSArray *)array {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  [result.mutableUninterpretedOptionList addObjectsFromArray:values];
+  result.uninterpretedOptionArray = [PBObjectArray arrayWithArray:array valueType:PBArrayValueTypeObject];
   return self;
 }
-- (PBMessageOptions_Builder*) clearUninterpretedOptionList {
-  result.mutableUninterpretedOptionList = nil;
+- (PBMessageOptions_Builder *)setUninterpretedOptionValues:(const PBUninterpretedOption* *)values count:(NSUInteger)count {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.uninterpretedOptionArray = [PBObjectArray arrayWithValues:values count:count valueType:PBArrayValueTypeObject];
   return self;
 }
-- (PBMessageOptions_Builder*) addUninterpretedOption:(PBUninterpretedOption*) value {
-  if (result.mutableUninterpretedOptionList == nil) {
-    result.mutableUninterpretedOptionList = [NSMutableArray array];
+- (PBMessageOptions_Builder *)clearUninterpretedOption {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  [result.mutableUninterpretedOptionList addObject:value];
+  result.uninterpretedOptionArray = nil;
   return self;
 }
 @end
 
 @interface PBFieldOptions ()
-@property PBFieldOptions_CType ctype;
-@property BOOL packed;
-@property BOOL deprecated;
-@property (retain) NSString* experimentalMapKey;
-@property (retain) NSMutableArray* mutableUninterpretedOptionList;
+@property (nonatomic) PBFieldOptions_CType ctype;
+@property (nonatomic) BOOL packed;
+@property (nonatomic) BOOL deprecated;
+@property (nonatomic, retain) NSString* experimentalMapKey;
+@property (nonatomic, retain) PBObjectArray * uninterpretedOptionArray;
+- (void) setInitialized;
+@end
+
+@interface PBFieldOptions_Builder()
+@property (nonatomic, retain) PBFieldOptions* result;
+- (id) initWithPrototype:(PBFieldOptions*) prototype;
+- (void) detachFromPrototype;
 @end
 
 @implementation PBFieldOptions
 
 - (BOOL) hasCtype {
-  return !!hasCtype_;
+  return (hasBits_[0] & 0x1u) != 0;
 }
-- (void) setHasCtype:(BOOL) value {
-  hasCtype_ = !!value;
+- (void) setHasCtype:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x1u;
+  } else {
+    hasBits_[0] &= ~0x1u;
+  }
 }
 @synthesize ctype;
 - (BOOL) hasPacked {
-  return !!hasPacked_;
+  return (hasBits_[0] & 0x2u) != 0;
 }
-- (void) setHasPacked:(BOOL) value {
-  hasPacked_ = !!value;
+- (void) setHasPacked:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x2u;
+  } else {
+    hasBits_[0] &= ~0x2u;
+  }
 }
 - (BOOL) packed {
   return !!packed_;
 }
-- (void) setPacked:(BOOL) value {
-  packed_ = !!value;
+- (void) setPacked:(BOOL) value_ {
+  packed_ = !!value_;
 }
 - (BOOL) hasDeprecated {
-  return !!hasDeprecated_;
+  return (hasBits_[0] & 0x4u) != 0;
 }
-- (void) setHasDeprecated:(BOOL) value {
-  hasDeprecated_ = !!value;
+- (void) setHasDeprecated:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x4u;
+  } else {
+    hasBits_[0] &= ~0x4u;
+  }
 }
 - (BOOL) deprecated {
   return !!deprecated_;
 }
-- (void) setDeprecated:(BOOL) value {
-  deprecated_ = !!value;
+- (void) setDeprecated:(BOOL) value_ {
+  deprecated_ = !!value_;
 }
 - (BOOL) hasExperimentalMapKey {
-  return !!hasExperimentalMapKey_;
+  return (hasBits_[0] & 0x8u) != 0;
 }
-- (void) setHasExperimentalMapKey:(BOOL) value {
-  hasExperimentalMapKey_ = !!value;
+- (void) setHasExperimentalMapKey:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x8u;
+  } else {
+    hasBits_[0] &= ~0x8u;
+  }
 }
 @synthesize experimentalMapKey;
-@synthesize mutableUninterpretedOptionList;
+- (NSString*) experimentalMapKey {
+  return (hasBits_[0] & 0x8u) ? experimentalMapKey : @"";
+}
+@synthesize uninterpretedOptionArray;
+@dynamic uninterpretedOption;
 - (void) dealloc {
-  self.experimentalMapKey = nil;
-  self.mutableUninterpretedOptionList = nil;
+  [experimentalMapKey release];
+  [uninterpretedOptionArray release];
   [super dealloc];
 }
-- (id) init {
-  if ((self = [super init])) {
-    self.ctype = PBFieldOptions_CTypeCord;
-    self.packed = NO;
-    self.deprecated = NO;
-    self.experimentalMapKey = @"";
-  }
-  return self;
+- (void) clearForReuse {
+  [super clearForReuse];
+  memset(hasBits_, 0, sizeof(hasBits_));
+  ctype = 0;
+  packed_ = 0;
+  deprecated_ = 0;
+  [experimentalMapKey release];
+  experimentalMapKey = nil;
+  uninterpretedOptionArray = PBAppendableArrayReuse(uninterpretedOptionArray);
 }
 static PBFieldOptions* defaultPBFieldOptionsInstance = nil;
-+ (void) initialize {
-  if (self == [PBFieldOptions class]) {
-    defaultPBFieldOptionsInstance = [[PBFieldOptions alloc] init];
-  }
-}
 + (PBFieldOptions*) defaultInstance {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultPBFieldOptionsInstance = [[PBFieldOptions alloc] init];
+  });
   return defaultPBFieldOptionsInstance;
 }
 - (PBFieldOptions*) defaultInstance {
-  return defaultPBFieldOptionsInstance;
+  return [PBFieldOptions defaultInstance];
 }
-- (NSArray*) uninterpretedOptionList {
-  return mutableUninterpretedOptionList;
+- (PBArray *)uninterpretedOption {
+  return uninterpretedOptionArray;
 }
-- (PBUninterpretedOption*) uninterpretedOptionAtIndex:(int32_t) index {
-  id value = [mutableUninterpretedOptionList objectAtIndex:index];
-  return value;
+- (PBUninterpretedOption*)uninterpretedOptionAtIndex:(NSUInteger)index {
+  return PBObjectArrayValueAtIndex(uninterpretedOptionArray, index);
+}
+- (void) setInitialized {
+  hasBits_[0] |= 0x10u;
 }
 - (BOOL) isInitialized {
-  for (PBUninterpretedOption* element in self.uninterpretedOptionList) {
+  if ((hasBits_[0] & 0x10u) != 0) {
+    return YES;
+  }
+  for (PBUninterpretedOption* element in uninterpretedOptionArray) {
     if (!element.isInitialized) {
       return NO;
     }
@@ -4064,19 +7273,19 @@ static PBFieldOptions* defaultPBFieldOptionsInstance = nil;
   return YES;
 }
 - (void) writeToCodedOutputStream:(PBCodedOutputStream*) output {
-  if (self.hasCtype) {
-    [output writeEnum:1 value:self.ctype];
+  if (hasBits_[0] & 0x1u) {
+    [output writeEnum:1 value:ctype];
   }
-  if (self.hasPacked) {
-    [output writeBool:2 value:self.packed];
+  if (hasBits_[0] & 0x2u) {
+    [output writeBool:2 value:!!packed_];
   }
-  if (self.hasDeprecated) {
-    [output writeBool:3 value:self.deprecated];
+  if (hasBits_[0] & 0x4u) {
+    [output writeBool:3 value:!!deprecated_];
   }
-  if (self.hasExperimentalMapKey) {
-    [output writeString:9 value:self.experimentalMapKey];
+  if (hasBits_[0] & 0x8u) {
+    [output writeString:9 value:experimentalMapKey];
   }
-  for (PBUninterpretedOption* element in self.uninterpretedOptionList) {
+  for (PBUninterpretedOption *element in uninterpretedOptionArray) {
     [output writeMessage:999 value:element];
   }
   [self writeExtensionsToCodedOutputStream:output
@@ -4085,31 +7294,31 @@ static PBFieldOptions* defaultPBFieldOptionsInstance = nil;
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = PBGeneratedMessageGetMemoizedSize(&memoizedSerializedSize);
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
-  if (self.hasCtype) {
-    size += computeEnumSize(1, self.ctype);
+  size_ = 0;
+  if (hasBits_[0] & 0x1u) {
+    size_ += computeEnumSize(1, ctype);
   }
-  if (self.hasPacked) {
-    size += computeBoolSize(2, self.packed);
+  if (hasBits_[0] & 0x2u) {
+    size_ += computeBoolSize(2, !!packed_);
   }
-  if (self.hasDeprecated) {
-    size += computeBoolSize(3, self.deprecated);
+  if (hasBits_[0] & 0x4u) {
+    size_ += computeBoolSize(3, !!deprecated_);
   }
-  if (self.hasExperimentalMapKey) {
-    size += computeStringSize(9, self.experimentalMapKey);
+  if (hasBits_[0] & 0x8u) {
+    size_ += computeStringSize(9, experimentalMapKey);
   }
-  for (PBUninterpretedOption* element in self.uninterpretedOptionList) {
-    size += computeMessageSize(999, element);
+  for (PBUninterpretedOption *element in uninterpretedOptionArray) {
+    size_ += computeMessageSize(999, element);
   }
-  size += [self extensionsSerializedSize];
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
+  size_ += [self extensionsSerializedSize];
+  size_ += self.unknownFields.serializedSize;
+  PBGeneratedMessageSetMemoizedSize(&memoizedSerializedSize, size_);
+  return size_;
 }
 + (PBFieldOptions*) parseFromData:(NSData*) data {
   return (PBFieldOptions*)[[[PBFieldOptions builder] mergeFromData:data] build];
@@ -4133,15 +7342,94 @@ static PBFieldOptions* defaultPBFieldOptionsInstance = nil;
   return [[[PBFieldOptions_Builder alloc] init] autorelease];
 }
 + (PBFieldOptions_Builder*) builderWithPrototype:(PBFieldOptions*) prototype {
-  return [[PBFieldOptions builder] mergeFrom:prototype];
+  return [[[PBFieldOptions_Builder alloc] initWithPrototype:prototype] autorelease];
 }
 - (PBFieldOptions_Builder*) builder {
   return [PBFieldOptions builder];
 }
+- (PBFieldOptions_Builder*) toBuilder {
+  return [PBFieldOptions builderWithPrototype:self];
+}
+- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
+  if (hasBits_[0] & 0x1u) {
+    [output appendFormat:@"%@%@: %d\n", indent, @"ctype", ctype];
+  }
+  if (hasBits_[0] & 0x2u) {
+    [output appendFormat:@"%@%@: %@\n", indent, @"packed", [NSNumber numberWithBool:!!packed_]];
+  }
+  if (hasBits_[0] & 0x4u) {
+    [output appendFormat:@"%@%@: %@\n", indent, @"deprecated", [NSNumber numberWithBool:!!deprecated_]];
+  }
+  if (hasBits_[0] & 0x8u) {
+    [output appendFormat:@"%@%@: %@\n", indent, @"experimentalMapKey", experimentalMapKey];
+  }
+  for (PBUninterpretedOption* element in uninterpretedOptionArray) {
+    [output appendFormat:@"%@%@ {\n", indent, @"uninterpretedOption"];
+    [element writeDescriptionTo:output
+                     withIndent:[NSString stringWithFormat:@"%@  ", indent]];
+    [output appendFormat:@"%@}\n", indent];
+  }
+  [self writeExtensionDescriptionToMutableString:(NSMutableString*)output
+                                            from:1000
+                                              to:536870912
+                                      withIndent:indent];
+  [self.unknownFields writeDescriptionTo:output withIndent:indent];
+}
+- (BOOL) isEqual:(id)other {
+  if (other == self) {
+    return YES;
+  }
+  if (![other isKindOfClass:[PBFieldOptions class]]) {
+    return NO;
+  }
+  PBFieldOptions *otherMessage = other;
+  return
+      (hasBits_[0] & 0x1u) == (otherMessage->hasBits_[0] & 0x1u) &&
+      (!(hasBits_[0] & 0x1u) || ctype == otherMessage->ctype) &&
+      (hasBits_[0] & 0x2u) == (otherMessage->hasBits_[0] & 0x2u) &&
+      (!(hasBits_[0] & 0x2u) || !!packed_ == !!otherMessage->packed_) &&
+      (hasBits_[0] & 0x4u) == (otherMessage->hasBits_[0] & 0x4u) &&
+      (!(hasBits_[0] & 0x4u) || !!deprecated_ == !!otherMessage->deprecated_) &&
+      (hasBits_[0] & 0x8u) == (otherMessage->hasBits_[0] & 0x8u) &&
+      (!(hasBits_[0] & 0x8u) || [experimentalMapKey isEqual:otherMessage->experimentalMapKey]) &&
+      (uninterpretedOptionArray.count == 0 ? otherMessage->uninterpretedOptionArray.count == 0 : [uninterpretedOptionArray isEqualToArray:otherMessage->uninterpretedOptionArray]) &&
+      [self isEqualExtensionsInOther:otherMessage from:1000 to:536870912] &&
+
+      (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
+}
+- (NSUInteger) hash {
+  NSUInteger hash_ = PBGeneratedMessageGetMemoizedHash(&memoizedHash);
+  if (hash_ != 0) {
+    return hash_;
+  }
+
+  uint64_t hashCode = 7;
+  if (hasBits_[0] & 0x1u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, (uint64_t)ctype);
+  }
+  if (hasBits_[0] & 0x2u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, (uint64_t)!!packed_);
+  }
+  if (hasBits_[0] & 0x4u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, (uint64_t)!!deprecated_);
+  }
+  if (hasBits_[0] & 0x8u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [experimentalMapKey hash]);
+  }
+  for (PBUninterpretedOption* element in uninterpretedOptionArray) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [element hash]);
+  }
+  hashCode = PBGeneratedMessageHashMix(hashCode, [self hashExtensionsFrom:1000 to:536870912]);
+  hashCode = PBGeneratedMessageHashMix(hashCode, [self.unknownFields hash]);
+  hash_ = PBGeneratedMessageHashFinish(hashCode);
+  PBGeneratedMessageSetMemoizedHash(&memoizedHash, hash_);
+  return hash_;
+}
 @end
 
 BOOL PBFieldOptions_CTypeIsValidValue(PBFieldOptions_CType value) {
   switch (value) {
+    case PBFieldOptions_CTypeString:
     case PBFieldOptions_CTypeCord:
     case PBFieldOptions_CTypeStringPiece:
       return YES;
@@ -4149,65 +7437,132 @@ BOOL PBFieldOptions_CTypeIsValidValue(PBFieldOptions_CType value) {
       return NO;
   }
 }
-@interface PBFieldOptions_Builder()
-@property (retain) PBFieldOptions* result;
-@end
-
 @implementation PBFieldOptions_Builder
 @synthesize result;
 - (void) dealloc {
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
   self.result = nil;
+  [prototype_ release];
   [super dealloc];
 }
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[[PBFieldOptions alloc] init] autorelease];
+    result = [PBFieldOptions recycledInstance];
   }
   return self;
 }
+- (id) initWithPrototype:(PBFieldOptions*) prototype {
+  if ((self = [super init])) {
+    self.result = prototype;
+    prototype_ = [prototype retain];
+  }
+  return self;
+}
+- (void) detachFromPrototype {
+  PBFieldOptions* prototype = prototype_;
+  prototype_ = nil;
+  self.result = [[[PBFieldOptions alloc] init] autorelease];
+  [self mergeFrom:prototype];
+  [prototype release];
+}
+- (PBExtendableMessage*) internalGetMutableResult {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return [self internalGetResult];
+}
 - (PBExtendableMessage*) internalGetResult {
   return result;
 }
 - (PBFieldOptions_Builder*) clear {
-  self.result = [[[PBFieldOptions alloc] init] autorelease];
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = [[PBFieldOptions recycledInstance] autorelease];
   return self;
 }
 - (PBFieldOptions_Builder*) clone {
-  return [PBFieldOptions builderWithPrototype:result];
+  if (prototype_ != nil) {
+    return [[[PBFieldOptions_Builder alloc] initWithPrototype:prototype_] autorelease];
+  }
+  return [[PBFieldOptions builder] mergeFrom:result];
+}
+- (PBFieldOptions_Builder*) reset {
+  if (result == nil || prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    self.result = [[PBFieldOptions recycledInstance] autorelease];
+  } else {
+    [result clearForReuse];
+  }
+  return self;
+}
+- (PBFieldOptions_Builder*) recycle:(PBFieldOptions*) message {
+  if (message == [PBFieldOptions defaultInstance]) {
+    @throw [NSException exceptionWithName:@"IllegalArgument" reason:@"Cannot recycle the default instance" userInfo:nil];
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = message;
+  return [self reset];
 }
 - (PBFieldOptions*) defaultInstance {
   return [PBFieldOptions defaultInstance];
 }
 - (PBFieldOptions*) build {
   [self checkInitialized];
-  return [self buildPartial];
+  BOOL shared = prototype_ != nil;
+  PBFieldOptions* returnMe = [self buildPartial];
+  if (!shared) {
+    [returnMe setInitialized];
+  }
+  return returnMe;
 }
 - (PBFieldOptions*) buildPartial {
-  PBFieldOptions* returnMe = [[result retain] autorelease];
-  self.result = nil;
+  return [[self newBuildPartial] autorelease];
+}
+- (PBFieldOptions*) newBuildPartial {
+  if (prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    PBFieldOptions* returnMe = result;
+    result = nil;
+    return returnMe;
+  }
+  [result->uninterpretedOptionArray shrinkToFit];
+  PBFieldOptions* returnMe = result;
+  result = nil;
   return returnMe;
 }
 - (PBFieldOptions_Builder*) mergeFrom:(PBFieldOptions*) other {
   if (other == [PBFieldOptions defaultInstance]) {
     return self;
   }
-  if (other.hasCtype) {
-    [self setCtype:other.ctype];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (other->hasBits_[0] & 0x1u) {
+    [self setCtype:other->ctype];
   }
-  if (other.hasPacked) {
-    [self setPacked:other.packed];
+  if (other->hasBits_[0] & 0x2u) {
+    [self setPacked:other->packed_];
   }
-  if (other.hasDeprecated) {
-    [self setDeprecated:other.deprecated];
+  if (other->hasBits_[0] & 0x4u) {
+    [self setDeprecated:other->deprecated_];
   }
-  if (other.hasExperimentalMapKey) {
-    [self setExperimentalMapKey:other.experimentalMapKey];
+  if (other->hasBits_[0] & 0x8u) {
+    [self setExperimentalMapKey:other->experimentalMapKey];
   }
-  if (other.mutableUninterpretedOptionList.count > 0) {
-    if (result.mutableUninterpretedOptionList == nil) {
-      result.mutableUninterpretedOptionList = [NSMutableArray array];
+  if (other->uninterpretedOptionArray.count > 0) {
+    if (result->uninterpretedOptionArray == nil) {
+      result.uninterpretedOptionArray = [[other->uninterpretedOptionArray copyWithZone:[other->uninterpretedOptionArray zone]] autorelease];
+    } else {
+      [result->uninterpretedOptionArray appendArray:other->uninterpretedOptionArray];
     }
-    [result.mutableUninterpretedOptionList addObjectsFromArray:other.mutableUninterpretedOptionList];
   }
   [self mergeExtensionFields:other];
   [self mergeUnknownFields:other.unknownFields];
@@ -4217,18 +7572,29 @@ BOOL PBFieldOptions_CTypeIsValidValue(PBFieldOptions_CType value) {
   return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
 }
 - (PBFieldOptions_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  PBUnknownFieldSet_Builder* unknownFields = nil;
   while (YES) {
     int32_t tag = [input readTag];
     switch (tag) {
       case 0:
-        [self setUnknownFields:[unknownFields build]];
+        if (unknownFields != nil) {
+          [self setUnknownFields:[unknownFields build]];
+        }
         return self;
       default: {
-        if (![self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag]) {
-          [self setUnknownFields:[unknownFields build]];
+        if (PBWireFormatGetTagWireType(tag) == PBWireFormatEndGroup) {
+          if (unknownFields != nil) {
+            [self setUnknownFields:[unknownFields build]];
+          }
           return self;
         }
+        if (unknownFields == nil) {
+          unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+        }
+        [self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag];
         break;
       }
       case 8: {
@@ -4236,6 +7602,9 @@ BOOL PBFieldOptions_CTypeIsValidValue(PBFieldOptions_CType value) {
         if (PBFieldOptions_CTypeIsValidValue(value)) {
           [self setCtype:value];
         } else {
+          if (unknownFields == nil) {
+            unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+          }
           [unknownFields mergeVarintField:1 value:value];
         }
         break;
@@ -4249,150 +7618,206 @@ BOOL PBFieldOptions_CTypeIsValidValue(PBFieldOptions_CType value) {
         break;
       }
       case 74: {
-        [self setExperimentalMapKey:[input readString]];
+        NSString* value = [input newString];
+        [self setExperimentalMapKey:value];
+        [value release];
         break;
       }
       case 7994: {
-        PBUninterpretedOption_Builder* subBuilder = [PBUninterpretedOption builder];
-        [input readMessage:subBuilder extensionRegistry:extensionRegistry];
-        [self addUninterpretedOption:[subBuilder buildPartial]];
+        PBUninterpretedOption_Builder* subBuilder = [[PBUninterpretedOption_Builder alloc] init];
+        @try {
+          [input readMessage:subBuilder extensionRegistry:extensionRegistry];
+          PBUninterpretedOption* value = [subBuilder newBuildPartial];
+          [self addUninterpretedOption:value];
+          [value release];
+        } @finally {
+          [subBuilder release];
+        }
         break;
       }
     }
   }
 }
 - (BOOL) hasCtype {
-  return result.hasCtype;
+  return (result->hasBits_[0] & 0x1u) != 0;
 }
 - (PBFieldOptions_CType) ctype {
-  return result.ctype;
+  return (result->hasBits_[0] & 0x1u) ? result->ctype : PBFieldOptions_CTypeString;
 }
 - (PBFieldOptions_Builder*) setCtype:(PBFieldOptions_CType) value {
-  result.hasCtype = YES;
-  result.ctype = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x1u;
+  result->ctype = value;
   return self;
 }
 - (PBFieldOptions_Builder*) clearCtype {
-  result.hasCtype = NO;
-  result.ctype = PBFieldOptions_CTypeCord;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x1u;
+  result->ctype = 0;
   return self;
 }
 - (BOOL) hasPacked {
-  return result.hasPacked;
+  return (result->hasBits_[0] & 0x2u) != 0;
 }
 - (BOOL) packed {
-  return result.packed;
+  return !!result->packed_;
 }
 - (PBFieldOptions_Builder*) setPacked:(BOOL) value {
-  result.hasPacked = YES;
-  result.packed = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x2u;
+  result->packed_ = !!value;
   return self;
 }
 - (PBFieldOptions_Builder*) clearPacked {
-  result.hasPacked = NO;
-  result.packed = NO;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x2u;
+  result->packed_ = 0;
   return self;
 }
 - (BOOL) hasDeprecated {
-  return result.hasDeprecated;
+  return (result->hasBits_[0] & 0x4u) != 0;
 }
 - (BOOL) deprecated {
-  return result.deprecated;
+  return (result->hasBits_[0] & 0x4u) ? !!result->deprecated_ : NO;
 }
 - (PBFieldOptions_Builder*) setDeprecated:(BOOL) value {
-  result.hasDeprecated = YES;
-  result.deprecated = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x4u;
+  result->deprecated_ = !!value;
   return self;
 }
 - (PBFieldOptions_Builder*) clearDeprecated {
-  result.hasDeprecated = NO;
-  result.deprecated = NO;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x4u;
+  result->deprecated_ = 0;
   return self;
 }
 - (BOOL) hasExperimentalMapKey {
-  return result.hasExperimentalMapKey;
+  return (result->hasBits_[0] & 0x8u) != 0;
 }
 - (NSString*) experimentalMapKey {
-  return result.experimentalMapKey;
+  return [result experimentalMapKey];
 }
 - (PBFieldOptions_Builder*) setExperimentalMapKey:(NSString*) value {
-  result.hasExperimentalMapKey = YES;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x8u;
   result.experimentalMapKey = value;
   return self;
 }
 - (PBFieldOptions_Builder*) clearExperimentalMapKey {
-  result.hasExperimentalMapKey = NO;
-  result.experimentalMapKey = @"";
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x8u;
+  [result->experimentalMapKey release];
+  result->experimentalMapKey = nil;
   return self;
 }
-- (NSArray*) uninterpretedOptionList {
-  if (result.mutableUninterpretedOptionList == nil) { return [NSArray array]; }
-  return result.mutableUninterpretedOptionList;
+- (PBAppendableArray *)uninterpretedOption {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return result->uninterpretedOptionArray;
 }
-- (PBUninterpretedOption*) uninterpretedOptionAtIndex:(int32_t) index {
+- (PBUninterpretedOption*)uninterpretedOptionAtIndex:(NSUInteger)index {
   return [result uninterpretedOptionAtIndex:index];
 }
-- (PBFieldOptions_Builder*) replaceUninterpretedOptionAtIndex:(int32_t) index with:(PBUninterpretedOption*) value {
-  [result.mutableUninterpretedOptionList replaceObjectAtIndex:index withObject:value];
+- (PBFieldOptions_Builder *)addUninterpretedOption:(PBUninterpretedOption*)value {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (result->uninterpretedOptionArray == nil) {
+    result.uninterpretedOptionArray = [PBObjectArray array];
+  }
+  PBObjectArrayAddValue(result->uninterpretedOptionArray, value);
   return self;
 }
-- (PBFieldOptions_Builder*) addAllUninterpretedOption:(NSArray*) values {
-  if (result.mutableUninterpretedOptionList == nil) {
-    result.mutableUninterpretedOptionList = [NSMutableArray array];
+- (PBFieldOptions_Builder *)setUninterpretedOptionArray:(NSArray *)array {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  [result.mutableUninterpretedOptionList addObjectsFromArray:values];
+  result.uninterpretedOptionArray = [PBObjectArray arrayWithArray:array valueType:PBArrayValueTypeObject];
   return self;
 }
-- (PBFieldOptions_Builder*) clearUninterpretedOptionList {
-  result.mutableUninterpretedOptionList = nil;
+- (PBFieldOptions_Builder *)setUninterpretedOptionValues:(const PBUninterpretedOption* *)values count:(NSUInteger)count {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.uninterpretedOptionArray = [PBObjectArray arrayWithValues:values count:count valueType:PBArrayValueTypeObject];
   return self;
 }
-- (PBFieldOptions_Builder*) addUninterpretedOption:(PBUninterpretedOption*) value {
-  if (result.mutableUninterpretedOptionList == nil) {
-    result.mutableUninterpretedOptionList = [NSMutableArray array];
+- (PBFieldOptions_Builder *)clearUninterpretedOption {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  [result.mutableUninterpretedOptionList addObject:value];
+  result.uninterpretedOptionArray = nil;
   return self;
 }
 @end
 
 @interface PBEnumOptions ()
-@property (retain) NSMutableArray* mutableUninterpretedOptionList;
+@property (nonatomic, retain) PBObjectArray * uninterpretedOptionArray;
+- (void) setInitialized;
+@end
+
+@interface PBEnumOptions_Builder()
+@property (nonatomic, retain) PBEnumOptions* result;
+- (id) initWithPrototype:(PBEnumOptions*) prototype;
+- (void) detachFromPrototype;
 @end
 
 @implementation PBEnumOptions
 
-@synthesize mutableUninterpretedOptionList;
+@synthesize uninterpretedOptionArray;
+@dynamic uninterpretedOption;
 - (void) dealloc {
-  self.mutableUninterpretedOptionList = nil;
+  [uninterpretedOptionArray release];
   [super dealloc];
 }
-- (id) init {
-  if ((self = [super init])) {
-  }
-  return self;
+- (void) clearForReuse {
+  [super clearForReuse];
+  memset(hasBits_, 0, sizeof(hasBits_));
+  uninterpretedOptionArray = PBAppendableArrayReuse(uninterpretedOptionArray);
 }
 static PBEnumOptions* defaultPBEnumOptionsInstance = nil;
-+ (void) initialize {
-  if (self == [PBEnumOptions class]) {
-    defaultPBEnumOptionsInstance = [[PBEnumOptions alloc] init];
-  }
-}
 + (PBEnumOptions*) defaultInstance {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultPBEnumOptionsInstance = [[PBEnumOptions alloc] init];
+  });
   return defaultPBEnumOptionsInstance;
 }
 - (PBEnumOptions*) defaultInstance {
-  return defaultPBEnumOptionsInstance;
+  return [PBEnumOptions defaultInstance];
 }
-- (NSArray*) uninterpretedOptionList {
-  return mutableUninterpretedOptionList;
+- (PBArray *)uninterpretedOption {
+  return uninterpretedOptionArray;
 }
-- (PBUninterpretedOption*) uninterpretedOptionAtIndex:(int32_t) index {
-  id value = [mutableUninterpretedOptionList objectAtIndex:index];
-  return value;
+- (PBUninterpretedOption*)uninterpretedOptionAtIndex:(NSUInteger)index {
+  return PBObjectArrayValueAtIndex(uninterpretedOptionArray, index);
+}
+- (void) setInitialized {
+  hasBits_[0] |= 0x1u;
 }
 - (BOOL) isInitialized {
-  for (PBUninterpretedOption* element in self.uninterpretedOptionList) {
+  if ((hasBits_[0] & 0x1u) != 0) {
+    return YES;
+  }
+  for (PBUninterpretedOption* element in uninterpretedOptionArray) {
     if (!element.isInitialized) {
       return NO;
     }
@@ -4403,7 +7828,7 @@ static PBEnumOptions* defaultPBEnumOptionsInstance = nil;
   return YES;
 }
 - (void) writeToCodedOutputStream:(PBCodedOutputStream*) output {
-  for (PBUninterpretedOption* element in self.uninterpretedOptionList) {
+  for (PBUninterpretedOption *element in uninterpretedOptionArray) {
     [output writeMessage:999 value:element];
   }
   [self writeExtensionsToCodedOutputStream:output
@@ -4412,19 +7837,19 @@ static PBEnumOptions* defaultPBEnumOptionsInstance = nil;
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = PBGeneratedMessageGetMemoizedSize(&memoizedSerializedSize);
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
-  for (PBUninterpretedOption* element in self.uninterpretedOptionList) {
-    size += computeMessageSize(999, element);
+  size_ = 0;
+  for (PBUninterpretedOption *element in uninterpretedOptionArray) {
+    size_ += computeMessageSize(999, element);
   }
-  size += [self extensionsSerializedSize];
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
+  size_ += [self extensionsSerializedSize];
+  size_ += self.unknownFields.serializedSize;
+  PBGeneratedMessageSetMemoizedSize(&memoizedSerializedSize, size_);
+  return size_;
 }
 + (PBEnumOptions*) parseFromData:(NSData*) data {
   return (PBEnumOptions*)[[[PBEnumOptions builder] mergeFromData:data] build];
@@ -4448,60 +7873,173 @@ static PBEnumOptions* defaultPBEnumOptionsInstance = nil;
   return [[[PBEnumOptions_Builder alloc] init] autorelease];
 }
 + (PBEnumOptions_Builder*) builderWithPrototype:(PBEnumOptions*) prototype {
-  return [[PBEnumOptions builder] mergeFrom:prototype];
+  return [[[PBEnumOptions_Builder alloc] initWithPrototype:prototype] autorelease];
 }
 - (PBEnumOptions_Builder*) builder {
   return [PBEnumOptions builder];
 }
-@end
+- (PBEnumOptions_Builder*) toBuilder {
+  return [PBEnumOptions builderWithPrototype:self];
+}
+- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
+  for (PBUninterpretedOption* element in uninterpretedOptionArray) {
+    [output appendFormat:@"%@%@ {\n", indent, @"uninterpretedOption"];
+    [element writeDescriptionTo:output
+                     withIndent:[NSString stringWithFormat:@"%@  ", indent]];
+    [output appendFormat:@"%@}\n", indent];
+  }
+  [self writeExtensionDescriptionToMutableString:(NSMutableString*)output
+                                            from:1000
+                                              to:536870912
+                                      withIndent:indent];
+  [self.unknownFields writeDescriptionTo:output withIndent:indent];
+}
+- (BOOL) isEqual:(id)other {
+  if (other == self) {
+    return YES;
+  }
+  if (![other isKindOfClass:[PBEnumOptions class]]) {
+    return NO;
+  }
+  PBEnumOptions *otherMessage = other;
+  return
+      (uninterpretedOptionArray.count == 0 ? otherMessage->uninterpretedOptionArray.count == 0 : [uninterpretedOptionArray isEqualToArray:otherMessage->uninterpretedOptionArray]) &&
+      [self isEqualExtensionsInOther:otherMessage from:1000 to:536870912] &&
 
-@interface PBEnumOptions_Builder()
-@property (retain) PBEnumOptions* result;
+      (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
+}
+- (NSUInteger) hash {
+  NSUInteger hash_ = PBGeneratedMessageGetMemoizedHash(&memoizedHash);
+  if (hash_ != 0) {
+    return hash_;
+  }
+
+  uint64_t hashCode = 7;
+  for (PBUninterpretedOption* element in uninterpretedOptionArray) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [element hash]);
+  }
+  hashCode = PBGeneratedMessageHashMix(hashCode, [self hashExtensionsFrom:1000 to:536870912]);
+  hashCode = PBGeneratedMessageHashMix(hashCode, [self.unknownFields hash]);
+  hash_ = PBGeneratedMessageHashFinish(hashCode);
+  PBGeneratedMessageSetMemoizedHash(&memoizedHash, hash_);
+  return hash_;
+}
 @end
 
 @implementation PBEnumOptions_Builder
 @synthesize result;
 - (void) dealloc {
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
   self.result = nil;
+  [prototype_ release];
   [super dealloc];
 }
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[[PBEnumOptions alloc] init] autorelease];
+    result = [PBEnumOptions recycledInstance];
+  }
+  return self;
+}
+- (id) initWithPrototype:(PBEnumOptions*) prototype {
+  if ((self = [super init])) {
+    self.result = prototype;
+    prototype_ = [prototype retain];
   }
   return self;
 }
+- (void) detachFromPrototype {
+  PBEnumOptions* prototype = prototype_;
+  prototype_ = nil;
+  self.result = [[[PBEnumOptions alloc] init] autorelease];
+  [self mergeFrom:prototype];
+  [prototype release];
+}
+- (PBExtendableMessage*) internalGetMutableResult {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return [self internalGetResult];
+}
 - (PBExtendableMessage*) internalGetResult {
   return result;
 }
 - (PBEnumOptions_Builder*) clear {
-  self.result = [[[PBEnumOptions alloc] init] autorelease];
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = [[PBEnumOptions recycledInstance] autorelease];
   return self;
 }
 - (PBEnumOptions_Builder*) clone {
-  return [PBEnumOptions builderWithPrototype:result];
+  if (prototype_ != nil) {
+    return [[[PBEnumOptions_Builder alloc] initWithPrototype:prototype_] autorelease];
+  }
+  return [[PBEnumOptions builder] mergeFrom:result];
+}
+- (PBEnumOptions_Builder*) reset {
+  if (result == nil || prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    self.result = [[PBEnumOptions recycledInstance] autorelease];
+  } else {
+    [result clearForReuse];
+  }
+  return self;
+}
+- (PBEnumOptions_Builder*) recycle:(PBEnumOptions*) message {
+  if (message == [PBEnumOptions defaultInstance]) {
+    @throw [NSException exceptionWithName:@"IllegalArgument" reason:@"Cannot recycle the default instance" userInfo:nil];
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = message;
+  return [self reset];
 }
 - (PBEnumOptions*) defaultInstance {
   return [PBEnumOptions defaultInstance];
 }
 - (PBEnumOptions*) build {
   [self checkInitialized];
-  return [self buildPartial];
+  BOOL shared = prototype_ != nil;
+  PBEnumOptions* returnMe = [self buildPartial];
+  if (!shared) {
+    [returnMe setInitialized];
+  }
+  return returnMe;
 }
 - (PBEnumOptions*) buildPartial {
-  PBEnumOptions* returnMe = [[result retain] autorelease];
-  self.result = nil;
+  return [[self newBuildPartial] autorelease];
+}
+- (PBEnumOptions*) newBuildPartial {
+  if (prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    PBEnumOptions* returnMe = result;
+    result = nil;
+    return returnMe;
+  }
+  [result->uninterpretedOptionArray shrinkToFit];
+  PBEnumOptions* returnMe = result;
+  result = nil;
   return returnMe;
 }
 - (PBEnumOptions_Builder*) mergeFrom:(PBEnumOptions*) other {
   if (other == [PBEnumOptions defaultInstance]) {
     return self;
   }
-  if (other.mutableUninterpretedOptionList.count > 0) {
-    if (result.mutableUninterpretedOptionList == nil) {
-      result.mutableUninterpretedOptionList = [NSMutableArray array];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (other->uninterpretedOptionArray.count > 0) {
+    if (result->uninterpretedOptionArray == nil) {
+      result.uninterpretedOptionArray = [[other->uninterpretedOptionArray copyWithZone:[other->uninterpretedOptionArray zone]] autorelease];
+    } else {
+      [result->uninterpretedOptionArray appendArray:other->uninterpretedOptionArray];
     }
-    [result.mutableUninterpretedOptionList addObjectsFromArray:other.mutableUninterpretedOptionList];
   }
   [self mergeExtensionFields:other];
   [self mergeUnknownFields:other.unknownFields];
@@ -4511,97 +8049,137 @@ static PBEnumOptions* defaultPBEnumOptionsInstance = nil;
   return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
 }
 - (PBEnumOptions_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  PBUnknownFieldSet_Builder* unknownFields = nil;
   while (YES) {
     int32_t tag = [input readTag];
     switch (tag) {
       case 0:
-        [self setUnknownFields:[unknownFields build]];
+        if (unknownFields != nil) {
+          [self setUnknownFields:[unknownFields build]];
+        }
         return self;
       default: {
-        if (![self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag]) {
-          [self setUnknownFields:[unknownFields build]];
+        if (PBWireFormatGetTagWireType(tag) == PBWireFormatEndGroup) {
+          if (unknownFields != nil) {
+            [self setUnknownFields:[unknownFields build]];
+          }
           return self;
         }
+        if (unknownFields == nil) {
+          unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+        }
+        [self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag];
         break;
       }
       case 7994: {
-        PBUninterpretedOption_Builder* subBuilder = [PBUninterpretedOption builder];
-        [input readMessage:subBuilder extensionRegistry:extensionRegistry];
-        [self addUninterpretedOption:[subBuilder buildPartial]];
+        PBUninterpretedOption_Builder* subBuilder = [[PBUninterpretedOption_Builder alloc] init];
+        @try {
+          [input readMessage:subBuilder extensionRegistry:extensionRegistry];
+          PBUninterpretedOption* value = [subBuilder newBuildPartial];
+          [self addUninterpretedOption:value];
+          [value release];
+        } @finally {
+          [subBuilder release];
+        }
         break;
       }
     }
   }
 }
-- (NSArray*) uninterpretedOptionList {
-  if (result.mutableUninterpretedOptionList == nil) { return [NSArray array]; }
-  return result.mutableUninterpretedOptionList;
+- (PBAppendableArray *)uninterpretedOption {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return result->uninterpretedOptionArray;
 }
-- (PBUninterpretedOption*) uninterpretedOptionAtIndex:(int32_t) index {
+- (PBUninterpretedOption*)uninterpretedOptionAtIndex:(NSUInteger)index {
   return [result uninterpretedOptionAtIndex:index];
 }
-- (PBEnumOptions_Builder*) replaceUninterpretedOptionAtIndex:(int32_t) index with:(PBUninterpretedOption*) value {
-  [result.mutableUninterpretedOptionList replaceObjectAtIndex:index withObject:value];
+- (PBEnumOptions_Builder *)addUninterpretedOption:(PBUninterpretedOption*)value {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (result->uninterpretedOptionArray == nil) {
+    result.uninterpretedOptionArray = [PBObjectArray array];
+  }
+  PBObjectArrayAddValue(result->uninterpretedOptionArray, value);
   return self;
 }
-- (PBEnumOptions_Builder*) addAllUninterpretedOption:(NSArray*) values {
-  if (result.mutableUninterpretedOptionList == nil) {
-    result.mutableUninterpretedOptionList = [NSMutableArray array];
+- (PBEnumOptions_Builder *)setUninterpretedOptionArray:(NSArray *)array {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  [result.mutableUninterpretedOptionList addObjectsFromArray:values];
+  result.uninterpretedOptionArray = [PBObjectArray arrayWithArray:array valueType:PBArrayValueTypeObject];
   return self;
 }
-- (PBEnumOptions_Builder*) clearUninterpretedOptionList {
-  result.mutableUninterpretedOptionList = nil;
+- (PBEnumOptions_Builder *)setUninterpretedOptionValues:(const PBUninterpretedOption* *)values count:(NSUInteger)count {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.uninterpretedOptionArray = [PBObjectArray arrayWithValues:values count:count valueType:PBArrayValueTypeObject];
   return self;
 }
-- (PBEnumOptions_Builder*) addUninterpretedOption:(PBUninterpretedOption*) value {
-  if (result.mutableUninterpretedOptionList == nil) {
-    result.mutableUninterpretedOptionList = [NSMutableArray array];
+- (PBEnumOptions_Builder *)clearUninterpretedOption {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  [result.mutableUninterpretedOptionList addObject:value];
+  result.uninterpretedOptionArray = nil;
   return self;
 }
 @end
 
 @interface PBEnumValueOptions ()
-@property (retain) NSMutableArray* mutableUninterpretedOptionList;
+@property (nonatomic, retain) PBObjectArray * uninterpretedOptionArray;
+- (void) setInitialized;
+@end
+
+@interface PBEnumValueOptions_Builder()
+@property (nonatomic, retain) PBEnumValueOptions* result;
+- (id) initWithPrototype:(PBEnumValueOptions*) prototype;
+- (void) detachFromPrototype;
 @end
 
 @implementation PBEnumValueOptions
 
-@synthesize mutableUninterpretedOptionList;
+@synthesize uninterpretedOptionArray;
+@dynamic uninterpretedOption;
 - (void) dealloc {
-  self.mutableUninterpretedOptionList = nil;
+  [uninterpretedOptionArray release];
   [super dealloc];
 }
-- (id) init {
-  if ((self = [super init])) {
-  }
-  return self;
+- (void) clearForReuse {
+  [super clearForReuse];
+  memset(hasBits_, 0, sizeof(hasBits_));
+  uninterpretedOptionArray = PBAppendableArrayReuse(uninterpretedOptionArray);
 }
 static PBEnumValueOptions* defaultPBEnumValueOptionsInstance = nil;
-+ (void) initialize {
-  if (self == [PBEnumValueOptions class]) {
-    defaultPBEnumValueOptionsInstance = [[PBEnumValueOptions alloc] init];
-  }
-}
 + (PBEnumValueOptions*) defaultInstance {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultPBEnumValueOptionsInstance = [[PBEnumValueOptions alloc] init];
+  });
   return defaultPBEnumValueOptionsInstance;
 }
 - (PBEnumValueOptions*) defaultInstance {
-  return defaultPBEnumValueOptionsInstance;
+  return [PBEnumValueOptions defaultInstance];
 }
-- (NSArray*) uninterpretedOptionList {
-  return mutableUninterpretedOptionList;
+- (PBArray *)uninterpretedOption {
+  return uninterpretedOptionArray;
 }
-- (PBUninterpretedOption*) uninterpretedOptionAtIndex:(int32_t) index {
-  id value = [mutableUninterpretedOptionList objectAtIndex:index];
-  return value;
+- (PBUninterpretedOption*)uninterpretedOptionAtIndex:(NSUInteger)index {
+  return PBObjectArrayValueAtIndex(uninterpretedOptionArray, index);
+}
+- (void) setInitialized {
+  hasBits_[0] |= 0x1u;
 }
 - (BOOL) isInitialized {
-  for (PBUninterpretedOption* element in self.uninterpretedOptionList) {
+  if ((hasBits_[0] & 0x1u) != 0) {
+    return YES;
+  }
+  for (PBUninterpretedOption* element in uninterpretedOptionArray) {
     if (!element.isInitialized) {
       return NO;
     }
@@ -4612,7 +8190,7 @@ static PBEnumValueOptions* defaultPBEnumValueOptionsInstance = nil;
   return YES;
 }
 - (void) writeToCodedOutputStream:(PBCodedOutputStream*) output {
-  for (PBUninterpretedOption* element in self.uninterpretedOptionList) {
+  for (PBUninterpretedOption *element in uninterpretedOptionArray) {
     [output writeMessage:999 value:element];
   }
   [self writeExtensionsToCodedOutputStream:output
@@ -4621,19 +8199,19 @@ static PBEnumValueOptions* defaultPBEnumValueOptionsInstance = nil;
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = PBGeneratedMessageGetMemoizedSize(&memoizedSerializedSize);
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
-  for (PBUninterpretedOption* element in self.uninterpretedOptionList) {
-    size += computeMessageSize(999, element);
+  size_ = 0;
+  for (PBUninterpretedOption *element in uninterpretedOptionArray) {
+    size_ += computeMessageSize(999, element);
   }
-  size += [self extensionsSerializedSize];
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
+  size_ += [self extensionsSerializedSize];
+  size_ += self.unknownFields.serializedSize;
+  PBGeneratedMessageSetMemoizedSize(&memoizedSerializedSize, size_);
+  return size_;
 }
 + (PBEnumValueOptions*) parseFromData:(NSData*) data {
   return (PBEnumValueOptions*)[[[PBEnumValueOptions builder] mergeFromData:data] build];
@@ -4657,60 +8235,173 @@ static PBEnumValueOptions* defaultPBEnumValueOptionsInstance = nil;
   return [[[PBEnumValueOptions_Builder alloc] init] autorelease];
 }
 + (PBEnumValueOptions_Builder*) builderWithPrototype:(PBEnumValueOptions*) prototype {
-  return [[PBEnumValueOptions builder] mergeFrom:prototype];
+  return [[[PBEnumValueOptions_Builder alloc] initWithPrototype:prototype] autorelease];
 }
 - (PBEnumValueOptions_Builder*) builder {
   return [PBEnumValueOptions builder];
 }
-@end
+- (PBEnumValueOptions_Builder*) toBuilder {
+  return [PBEnumValueOptions builderWithPrototype:self];
+}
+- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
+  for (PBUninterpretedOption* element in uninterpretedOptionArray) {
+    [output appendFormat:@"%@%@ {\n", indent, @"uninterpretedOption"];
+    [element writeDescriptionTo:output
+                     withIndent:[NSString stringWithFormat:@"%@  ", indent]];
+    [output appendFormat:@"%@}\n", indent];
+  }
+  [self writeExtensionDescriptionToMutableString:(NSMutableString*)output
+                                            from:1000
+                                              to:536870912
+                                      withIndent:indent];
+  [self.unknownFields writeDescriptionTo:output withIndent:indent];
+}
+- (BOOL) isEqual:(id)other {
+  if (other == self) {
+    return YES;
+  }
+  if (![other isKindOfClass:[PBEnumValueOptions class]]) {
+    return NO;
+  }
+  PBEnumValueOptions *otherMessage = other;
+  return
+      (uninterpretedOptionArray.count == 0 ? otherMessage->uninterpretedOptionArray.count == 0 : [uninterpretedOptionArray isEqualToArray:otherMessage->uninterpretedOptionArray]) &&
+      [self isEqualExtensionsInOther:otherMessage from:1000 to:536870912] &&
 
-@interface PBEnumValueOptions_Builder()
-@property (retain) PBEnumValueOptions* result;
+      (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
+}
+- (NSUInteger) hash {
+  NSUInteger hash_ = PBGeneratedMessageGetMemoizedHash(&memoizedHash);
+  if (hash_ != 0) {
+    return hash_;
+  }
+
+  uint64_t hashCode = 7;
+  for (PBUninterpretedOption* element in uninterpretedOptionArray) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [element hash]);
+  }
+  hashCode = PBGeneratedMessageHashMix(hashCode, [self hashExtensionsFrom:1000 to:536870912]);
+  hashCode = PBGeneratedMessageHashMix(hashCode, [self.unknownFields hash]);
+  hash_ = PBGeneratedMessageHashFinish(hashCode);
+  PBGeneratedMessageSetMemoizedHash(&memoizedHash, hash_);
+  return hash_;
+}
 @end
 
 @implementation PBEnumValueOptions_Builder
 @synthesize result;
 - (void) dealloc {
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
   self.result = nil;
+  [prototype_ release];
   [super dealloc];
 }
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[[PBEnumValueOptions alloc] init] autorelease];
+    result = [PBEnumValueOptions recycledInstance];
+  }
+  return self;
+}
+- (id) initWithPrototype:(PBEnumValueOptions*) prototype {
+  if ((self = [super init])) {
+    self.result = prototype;
+    prototype_ = [prototype retain];
   }
   return self;
 }
+- (void) detachFromPrototype {
+  PBEnumValueOptions* prototype = prototype_;
+  prototype_ = nil;
+  self.result = [[[PBEnumValueOptions alloc] init] autorelease];
+  [self mergeFrom:prototype];
+  [prototype release];
+}
+- (PBExtendableMessage*) internalGetMutableResult {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return [self internalGetResult];
+}
 - (PBExtendableMessage*) internalGetResult {
   return result;
 }
 - (PBEnumValueOptions_Builder*) clear {
-  self.result = [[[PBEnumValueOptions alloc] init] autorelease];
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = [[PBEnumValueOptions recycledInstance] autorelease];
   return self;
 }
 - (PBEnumValueOptions_Builder*) clone {
-  return [PBEnumValueOptions builderWithPrototype:result];
+  if (prototype_ != nil) {
+    return [[[PBEnumValueOptions_Builder alloc] initWithPrototype:prototype_] autorelease];
+  }
+  return [[PBEnumValueOptions builder] mergeFrom:result];
 }
-- (PBEnumValueOptions*) defaultInstance {
+- (PBEnumValueOptions_Builder*) reset {
+  if (result == nil || prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    self.result = [[PBEnumValueOptions recycledInstance] autorelease];
+  } else {
+    [result clearForReuse];
+  }
+  return self;
+}
+- (PBEnumValueOptions_Builder*) recycle:(PBEnumValueOptions*) message {
+  if (message == [PBEnumValueOptions defaultInstance]) {
+    @throw [NSException exceptionWithName:@"IllegalArgument" reason:@"Cannot recycle the default instance" userInfo:nil];
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = message;
+  return [self reset];
+}
+- (PBEnumValueOptions*) defaultInstance {
   return [PBEnumValueOptions defaultInstance];
 }
 - (PBEnumValueOptions*) build {
   [self checkInitialized];
-  return [self buildPartial];
+  BOOL shared = prototype_ != nil;
+  PBEnumValueOptions* returnMe = [self buildPartial];
+  if (!shared) {
+    [returnMe setInitialized];
+  }
+  return returnMe;
 }
 - (PBEnumValueOptions*) buildPartial {
-  PBEnumValueOptions* returnMe = [[result retain] autorelease];
-  self.result = nil;
+  return [[self newBuildPartial] autorelease];
+}
+- (PBEnumValueOptions*) newBuildPartial {
+  if (prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    PBEnumValueOptions* returnMe = result;
+    result = nil;
+    return returnMe;
+  }
+  [result->uninterpretedOptionArray shrinkToFit];
+  PBEnumValueOptions* returnMe = result;
+  result = nil;
   return returnMe;
 }
 - (PBEnumValueOptions_Builder*) mergeFrom:(PBEnumValueOptions*) other {
   if (other == [PBEnumValueOptions defaultInstance]) {
     return self;
   }
-  if (other.mutableUninterpretedOptionList.count > 0) {
-    if (result.mutableUninterpretedOptionList == nil) {
-      result.mutableUninterpretedOptionList = [NSMutableArray array];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (other->uninterpretedOptionArray.count > 0) {
+    if (result->uninterpretedOptionArray == nil) {
+      result.uninterpretedOptionArray = [[other->uninterpretedOptionArray copyWithZone:[other->uninterpretedOptionArray zone]] autorelease];
+    } else {
+      [result->uninterpretedOptionArray appendArray:other->uninterpretedOptionArray];
     }
-    [result.mutableUninterpretedOptionList addObjectsFromArray:other.mutableUninterpretedOptionList];
   }
   [self mergeExtensionFields:other];
   [self mergeUnknownFields:other.unknownFields];
@@ -4720,97 +8411,137 @@ static PBEnumValueOptions* defaultPBEnumValueOptionsInstance = nil;
   return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
 }
 - (PBEnumValueOptions_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  PBUnknownFieldSet_Builder* unknownFields = nil;
   while (YES) {
     int32_t tag = [input readTag];
     switch (tag) {
       case 0:
-        [self setUnknownFields:[unknownFields build]];
+        if (unknownFields != nil) {
+          [self setUnknownFields:[unknownFields build]];
+        }
         return self;
       default: {
-        if (![self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag]) {
-          [self setUnknownFields:[unknownFields build]];
+        if (PBWireFormatGetTagWireType(tag) == PBWireFormatEndGroup) {
+          if (unknownFields != nil) {
+            [self setUnknownFields:[unknownFields build]];
+          }
           return self;
         }
+        if (unknownFields == nil) {
+          unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+        }
+        [self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag];
         break;
       }
       case 7994: {
-        PBUninterpretedOption_Builder* subBuilder = [PBUninterpretedOption builder];
-        [input readMessage:subBuilder extensionRegistry:extensionRegistry];
-        [self addUninterpretedOption:[subBuilder buildPartial]];
+        PBUninterpretedOption_Builder* subBuilder = [[PBUninterpretedOption_Builder alloc] init];
+        @try {
+          [input readMessage:subBuilder extensionRegistry:extensionRegistry];
+          PBUninterpretedOption* value = [subBuilder newBuildPartial];
+          [self addUninterpretedOption:value];
+          [value release];
+        } @finally {
+          [subBuilder release];
+        }
         break;
       }
     }
   }
 }
-- (NSArray*) uninterpretedOptionList {
-  if (result.mutableUninterpretedOptionList == nil) { return [NSArray array]; }
-  return result.mutableUninterpretedOptionList;
+- (PBAppendableArray *)uninterpretedOption {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return result->uninterpretedOptionArray;
 }
-- (PBUninterpretedOption*) uninterpretedOptionAtIndex:(int32_t) index {
+- (PBUninterpretedOption*)uninterpretedOptionAtIndex:(NSUInteger)index {
   return [result uninterpretedOptionAtIndex:index];
 }
-- (PBEnumValueOptions_Builder*) replaceUninterpretedOptionAtIndex:(int32_t) index with:(PBUninterpretedOption*) value {
-  [result.mutableUninterpretedOptionList replaceObjectAtIndex:index withObject:value];
+- (PBEnumValueOptions_Builder *)addUninterpretedOption:(PBUninterpretedOption*)value {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (result->uninterpretedOptionArray == nil) {
+    result.uninterpretedOptionArray = [PBObjectArray array];
+  }
+  PBObjectArrayAddValue(result->uninterpretedOptionArray, value);
   return self;
 }
-- (PBEnumValueOptions_Builder*) addAllUninterpretedOption:(NSArray*) values {
-  if (result.mutableUninterpretedOptionList == nil) {
-    result.mutableUninterpretedOptionList = [NSMutableArray array];
+- (PBEnumValueOptions_Builder *)setUninterpretedOptionArray:(NSArray *)array {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  [result.mutableUninterpretedOptionList addObjectsFromArray:values];
+  result.uninterpretedOptionArray = [PBObjectArray arrayWithArray:array valueType:PBArrayValueTypeObject];
   return self;
 }
-- (PBEnumValueOptions_Builder*) clearUninterpretedOptionList {
-  result.mutableUninterpretedOptionList = nil;
+- (PBEnumValueOptions_Builder *)setUninterpretedOptionValues:(const PBUninterpretedOption* *)values count:(NSUInteger)count {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.uninterpretedOptionArray = [PBObjectArray arrayWithValues:values count:count valueType:PBArrayValueTypeObject];
   return self;
 }
-- (PBEnumValueOptions_Builder*) addUninterpretedOption:(PBUninterpretedOption*) value {
-  if (result.mutableUninterpretedOptionList == nil) {
-    result.mutableUninterpretedOptionList = [NSMutableArray array];
+- (PBEnumValueOptions_Builder *)clearUninterpretedOption {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  [result.mutableUninterpretedOptionList addObject:value];
+  result.uninterpretedOptionArray = nil;
   return self;
 }
 @end
 
 @interface PBServiceOptions ()
-@property (retain) NSMutableArray* mutableUninterpretedOptionList;
+@property (nonatomic, retain) PBObjectArray * uninterpretedOptionArray;
+- (void) setInitialized;
+@end
+
+@interface PBServiceOptions_Builder()
+@property (nonatomic, retain) PBServiceOptions* result;
+- (id) initWithPrototype:(PBServiceOptions*) prototype;
+- (void) detachFromPrototype;
 @end
 
 @implementation PBServiceOptions
 
-@synthesize mutableUninterpretedOptionList;
+@synthesize uninterpretedOptionArray;
+@dynamic uninterpretedOption;
 - (void) dealloc {
-  self.mutableUninterpretedOptionList = nil;
+  [uninterpretedOptionArray release];
   [super dealloc];
 }
-- (id) init {
-  if ((self = [super init])) {
-  }
-  return self;
+- (void) clearForReuse {
+  [super clearForReuse];
+  memset(hasBits_, 0, sizeof(hasBits_));
+  uninterpretedOptionArray = PBAppendableArrayReuse(uninterpretedOptionArray);
 }
 static PBServiceOptions* defaultPBServiceOptionsInstance = nil;
-+ (void) initialize {
-  if (self == [PBServiceOptions class]) {
-    defaultPBServiceOptionsInstance = [[PBServiceOptions alloc] init];
-  }
-}
 + (PBServiceOptions*) defaultInstance {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultPBServiceOptionsInstance = [[PBServiceOptions alloc] init];
+  });
   return defaultPBServiceOptionsInstance;
 }
 - (PBServiceOptions*) defaultInstance {
-  return defaultPBServiceOptionsInstance;
+  return [PBServiceOptions defaultInstance];
 }
-- (NSArray*) uninterpretedOptionList {
-  return mutableUninterpretedOptionList;
+- (PBArray *)uninterpretedOption {
+  return uninterpretedOptionArray;
 }
-- (PBUninterpretedOption*) uninterpretedOptionAtIndex:(int32_t) index {
-  id value = [mutableUninterpretedOptionList objectAtIndex:index];
-  return value;
+- (PBUninterpretedOption*)uninterpretedOptionAtIndex:(NSUInteger)index {
+  return PBObjectArrayValueAtIndex(uninterpretedOptionArray, index);
+}
+- (void) setInitialized {
+  hasBits_[0] |= 0x1u;
 }
 - (BOOL) isInitialized {
-  for (PBUninterpretedOption* element in self.uninterpretedOptionList) {
+  if ((hasBits_[0] & 0x1u) != 0) {
+    return YES;
+  }
+  for (PBUninterpretedOption* element in uninterpretedOptionArray) {
     if (!element.isInitialized) {
       return NO;
     }
@@ -4821,7 +8552,7 @@ static PBServiceOptions* defaultPBServiceOptionsInstance = nil;
   return YES;
 }
 - (void) writeToCodedOutputStream:(PBCodedOutputStream*) output {
-  for (PBUninterpretedOption* element in self.uninterpretedOptionList) {
+  for (PBUninterpretedOption *element in uninterpretedOptionArray) {
     [output writeMessage:999 value:element];
   }
   [self writeExtensionsToCodedOutputStream:output
@@ -4830,19 +8561,19 @@ static PBServiceOptions* defaultPBServiceOptionsInstance = nil;
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = PBGeneratedMessageGetMemoizedSize(&memoizedSerializedSize);
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
-  for (PBUninterpretedOption* element in self.uninterpretedOptionList) {
-    size += computeMessageSize(999, element);
+  size_ = 0;
+  for (PBUninterpretedOption *element in uninterpretedOptionArray) {
+    size_ += computeMessageSize(999, element);
   }
-  size += [self extensionsSerializedSize];
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
+  size_ += [self extensionsSerializedSize];
+  size_ += self.unknownFields.serializedSize;
+  PBGeneratedMessageSetMemoizedSize(&memoizedSerializedSize, size_);
+  return size_;
 }
 + (PBServiceOptions*) parseFromData:(NSData*) data {
   return (PBServiceOptions*)[[[PBServiceOptions builder] mergeFromData:data] build];
@@ -4866,60 +8597,173 @@ static PBServiceOptions* defaultPBServiceOptionsInstance = nil;
   return [[[PBServiceOptions_Builder alloc] init] autorelease];
 }
 + (PBServiceOptions_Builder*) builderWithPrototype:(PBServiceOptions*) prototype {
-  return [[PBServiceOptions builder] mergeFrom:prototype];
+  return [[[PBServiceOptions_Builder alloc] initWithPrototype:prototype] autorelease];
 }
 - (PBServiceOptions_Builder*) builder {
   return [PBServiceOptions builder];
 }
-@end
+- (PBServiceOptions_Builder*) toBuilder {
+  return [PBServiceOptions builderWithPrototype:self];
+}
+- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
+  for (PBUninterpretedOption* element in uninterpretedOptionArray) {
+    [output appendFormat:@"%@%@ {\n", indent, @"uninterpretedOption"];
+    [element writeDescriptionTo:output
+                     withIndent:[NSString stringWithFormat:@"%@  ", indent]];
+    [output appendFormat:@"%@}\n", indent];
+  }
+  [self writeExtensionDescriptionToMutableString:(NSMutableString*)output
+                                            from:1000
+                                              to:536870912
+                                      withIndent:indent];
+  [self.unknownFields writeDescriptionTo:output withIndent:indent];
+}
+- (BOOL) isEqual:(id)other {
+  if (other == self) {
+    return YES;
+  }
+  if (![other isKindOfClass:[PBServiceOptions class]]) {
+    return NO;
+  }
+  PBServiceOptions *otherMessage = other;
+  return
+      (uninterpretedOptionArray.count == 0 ? otherMessage->uninterpretedOptionArray.count == 0 : [uninterpretedOptionArray isEqualToArray:otherMessage->uninterpretedOptionArray]) &&
+      [self isEqualExtensionsInOther:otherMessage from:1000 to:536870912] &&
 
-@interface PBServiceOptions_Builder()
-@property (retain) PBServiceOptions* result;
+      (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
+}
+- (NSUInteger) hash {
+  NSUInteger hash_ = PBGeneratedMessageGetMemoizedHash(&memoizedHash);
+  if (hash_ != 0) {
+    return hash_;
+  }
+
+  uint64_t hashCode = 7;
+  for (PBUninterpretedOption* element in uninterpretedOptionArray) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [element hash]);
+  }
+  hashCode = PBGeneratedMessageHashMix(hashCode, [self hashExtensionsFrom:1000 to:536870912]);
+  hashCode = PBGeneratedMessageHashMix(hashCode, [self.unknownFields hash]);
+  hash_ = PBGeneratedMessageHashFinish(hashCode);
+  PBGeneratedMessageSetMemoizedHash(&memoizedHash, hash_);
+  return hash_;
+}
 @end
 
 @implementation PBServiceOptions_Builder
 @synthesize result;
 - (void) dealloc {
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
   self.result = nil;
+  [prototype_ release];
   [super dealloc];
 }
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[[PBServiceOptions alloc] init] autorelease];
+    result = [PBServiceOptions recycledInstance];
+  }
+  return self;
+}
+- (id) initWithPrototype:(PBServiceOptions*) prototype {
+  if ((self = [super init])) {
+    self.result = prototype;
+    prototype_ = [prototype retain];
   }
   return self;
 }
+- (void) detachFromPrototype {
+  PBServiceOptions* prototype = prototype_;
+  prototype_ = nil;
+  self.result = [[[PBServiceOptions alloc] init] autorelease];
+  [self mergeFrom:prototype];
+  [prototype release];
+}
+- (PBExtendableMessage*) internalGetMutableResult {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return [self internalGetResult];
+}
 - (PBExtendableMessage*) internalGetResult {
   return result;
 }
 - (PBServiceOptions_Builder*) clear {
-  self.result = [[[PBServiceOptions alloc] init] autorelease];
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = [[PBServiceOptions recycledInstance] autorelease];
   return self;
 }
 - (PBServiceOptions_Builder*) clone {
-  return [PBServiceOptions builderWithPrototype:result];
+  if (prototype_ != nil) {
+    return [[[PBServiceOptions_Builder alloc] initWithPrototype:prototype_] autorelease];
+  }
+  return [[PBServiceOptions builder] mergeFrom:result];
+}
+- (PBServiceOptions_Builder*) reset {
+  if (result == nil || prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    self.result = [[PBServiceOptions recycledInstance] autorelease];
+  } else {
+    [result clearForReuse];
+  }
+  return self;
+}
+- (PBServiceOptions_Builder*) recycle:(PBServiceOptions*) message {
+  if (message == [PBServiceOptions defaultInstance]) {
+    @throw [NSException exceptionWithName:@"IllegalArgument" reason:@"Cannot recycle the default instance" userInfo:nil];
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = message;
+  return [self reset];
 }
 - (PBServiceOptions*) defaultInstance {
   return [PBServiceOptions defaultInstance];
 }
 - (PBServiceOptions*) build {
   [self checkInitialized];
-  return [self buildPartial];
+  BOOL shared = prototype_ != nil;
+  PBServiceOptions* returnMe = [self buildPartial];
+  if (!shared) {
+    [returnMe setInitialized];
+  }
+  return returnMe;
 }
 - (PBServiceOptions*) buildPartial {
-  PBServiceOptions* returnMe = [[result retain] autorelease];
-  self.result = nil;
+  return [[self newBuildPartial] autorelease];
+}
+- (PBServiceOptions*) newBuildPartial {
+  if (prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    PBServiceOptions* returnMe = result;
+    result = nil;
+    return returnMe;
+  }
+  [result->uninterpretedOptionArray shrinkToFit];
+  PBServiceOptions* returnMe = result;
+  result = nil;
   return returnMe;
 }
 - (PBServiceOptions_Builder*) mergeFrom:(PBServiceOptions*) other {
   if (other == [PBServiceOptions defaultInstance]) {
     return self;
   }
-  if (other.mutableUninterpretedOptionList.count > 0) {
-    if (result.mutableUninterpretedOptionList == nil) {
-      result.mutableUninterpretedOptionList = [NSMutableArray array];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (other->uninterpretedOptionArray.count > 0) {
+    if (result->uninterpretedOptionArray == nil) {
+      result.uninterpretedOptionArray = [[other->uninterpretedOptionArray copyWithZone:[other->uninterpretedOptionArray zone]] autorelease];
+    } else {
+      [result->uninterpretedOptionArray appendArray:other->uninterpretedOptionArray];
     }
-    [result.mutableUninterpretedOptionList addObjectsFromArray:other.mutableUninterpretedOptionList];
   }
   [self mergeExtensionFields:other];
   [self mergeUnknownFields:other.unknownFields];
@@ -4929,97 +8773,137 @@ static PBServiceOptions* defaultPBServiceOptionsInstance = nil;
   return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
 }
 - (PBServiceOptions_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  PBUnknownFieldSet_Builder* unknownFields = nil;
   while (YES) {
     int32_t tag = [input readTag];
     switch (tag) {
       case 0:
-        [self setUnknownFields:[unknownFields build]];
+        if (unknownFields != nil) {
+          [self setUnknownFields:[unknownFields build]];
+        }
         return self;
       default: {
-        if (![self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag]) {
-          [self setUnknownFields:[unknownFields build]];
+        if (PBWireFormatGetTagWireType(tag) == PBWireFormatEndGroup) {
+          if (unknownFields != nil) {
+            [self setUnknownFields:[unknownFields build]];
+          }
           return self;
         }
+        if (unknownFields == nil) {
+          unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+        }
+        [self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag];
         break;
       }
       case 7994: {
-        PBUninterpretedOption_Builder* subBuilder = [PBUninterpretedOption builder];
-        [input readMessage:subBuilder extensionRegistry:extensionRegistry];
-        [self addUninterpretedOption:[subBuilder buildPartial]];
+        PBUninterpretedOption_Builder* subBuilder = [[PBUninterpretedOption_Builder alloc] init];
+        @try {
+          [input readMessage:subBuilder extensionRegistry:extensionRegistry];
+          PBUninterpretedOption* value = [subBuilder newBuildPartial];
+          [self addUninterpretedOption:value];
+          [value release];
+        } @finally {
+          [subBuilder release];
+        }
         break;
       }
     }
   }
 }
-- (NSArray*) uninterpretedOptionList {
-  if (result.mutableUninterpretedOptionList == nil) { return [NSArray array]; }
-  return result.mutableUninterpretedOptionList;
+- (PBAppendableArray *)uninterpretedOption {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return result->uninterpretedOptionArray;
 }
-- (PBUninterpretedOption*) uninterpretedOptionAtIndex:(int32_t) index {
+- (PBUninterpretedOption*)uninterpretedOptionAtIndex:(NSUInteger)index {
   return [result uninterpretedOptionAtIndex:index];
 }
-- (PBServiceOptions_Builder*) replaceUninterpretedOptionAtIndex:(int32_t) index with:(PBUninterpretedOption*) value {
-  [result.mutableUninterpretedOptionList replaceObjectAtIndex:index withObject:value];
+- (PBServiceOptions_Builder *)addUninterpretedOption:(PBUninterpretedOption*)value {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (result->uninterpretedOptionArray == nil) {
+    result.uninterpretedOptionArray = [PBObjectArray array];
+  }
+  PBObjectArrayAddValue(result->uninterpretedOptionArray, value);
   return self;
 }
-- (PBServiceOptions_Builder*) addAllUninterpretedOption:(NSArray*) values {
-  if (result.mutableUninterpretedOptionList == nil) {
-    result.mutableUninterpretedOptionList = [NSMutableArray array];
+- (PBServiceOptions_Builder *)setUninterpretedOptionArray:(NSArray *)array {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  [result.mutableUninterpretedOptionList addObjectsFromArray:values];
+  result.uninterpretedOptionArray = [PBObjectArray arrayWithArray:array valueType:PBArrayValueTypeObject];
   return self;
 }
-- (PBServiceOptions_Builder*) clearUninterpretedOptionList {
-  result.mutableUninterpretedOptionList = nil;
+- (PBServiceOptions_Builder *)setUninterpretedOptionValues:(const PBUninterpretedOption* *)values count:(NSUInteger)count {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.uninterpretedOptionArray = [PBObjectArray arrayWithValues:values count:count valueType:PBArrayValueTypeObject];
   return self;
 }
-- (PBServiceOptions_Builder*) addUninterpretedOption:(PBUninterpretedOption*) value {
-  if (result.mutableUninterpretedOptionList == nil) {
-    result.mutableUninterpretedOptionList = [NSMutableArray array];
+- (PBServiceOptions_Builder *)clearUninterpretedOption {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  [result.mutableUninterpretedOptionList addObject:value];
+  result.uninterpretedOptionArray = nil;
   return self;
 }
 @end
 
 @interface PBMethodOptions ()
-@property (retain) NSMutableArray* mutableUninterpretedOptionList;
+@property (nonatomic, retain) PBObjectArray * uninterpretedOptionArray;
+- (void) setInitialized;
+@end
+
+@interface PBMethodOptions_Builder()
+@property (nonatomic, retain) PBMethodOptions* result;
+- (id) initWithPrototype:(PBMethodOptions*) prototype;
+- (void) detachFromPrototype;
 @end
 
 @implementation PBMethodOptions
 
-@synthesize mutableUninterpretedOptionList;
+@synthesize uninterpretedOptionArray;
+@dynamic uninterpretedOption;
 - (void) dealloc {
-  self.mutableUninterpretedOptionList = nil;
+  [uninterpretedOptionArray release];
   [super dealloc];
 }
-- (id) init {
-  if ((self = [super init])) {
-  }
-  return self;
+- (void) clearForReuse {
+  [super clearForReuse];
+  memset(hasBits_, 0, sizeof(hasBits_));
+  uninterpretedOptionArray = PBAppendableArrayReuse(uninterpretedOptionArray);
 }
 static PBMethodOptions* defaultPBMethodOptionsInstance = nil;
-+ (void) initialize {
-  if (self == [PBMethodOptions class]) {
-    defaultPBMethodOptionsInstance = [[PBMethodOptions alloc] init];
-  }
-}
 + (PBMethodOptions*) defaultInstance {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultPBMethodOptionsInstance = [[PBMethodOptions alloc] init];
+  });
   return defaultPBMethodOptionsInstance;
 }
 - (PBMethodOptions*) defaultInstance {
-  return defaultPBMethodOptionsInstance;
+  return [PBMethodOptions defaultInstance];
 }
-- (NSArray*) uninterpretedOptionList {
-  return mutableUninterpretedOptionList;
+- (PBArray *)uninterpretedOption {
+  return uninterpretedOptionArray;
 }
-- (PBUninterpretedOption*) uninterpretedOptionAtIndex:(int32_t) index {
-  id value = [mutableUninterpretedOptionList objectAtIndex:index];
-  return value;
+- (PBUninterpretedOption*)uninterpretedOptionAtIndex:(NSUInteger)index {
+  return PBObjectArrayValueAtIndex(uninterpretedOptionArray, index);
+}
+- (void) setInitialized {
+  hasBits_[0] |= 0x1u;
 }
 - (BOOL) isInitialized {
-  for (PBUninterpretedOption* element in self.uninterpretedOptionList) {
+  if ((hasBits_[0] & 0x1u) != 0) {
+    return YES;
+  }
+  for (PBUninterpretedOption* element in uninterpretedOptionArray) {
     if (!element.isInitialized) {
       return NO;
     }
@@ -5030,7 +8914,7 @@ static PBMethodOptions* defaultPBMethodOptionsInstance = nil;
   return YES;
 }
 - (void) writeToCodedOutputStream:(PBCodedOutputStream*) output {
-  for (PBUninterpretedOption* element in self.uninterpretedOptionList) {
+  for (PBUninterpretedOption *element in uninterpretedOptionArray) {
     [output writeMessage:999 value:element];
   }
   [self writeExtensionsToCodedOutputStream:output
@@ -5039,19 +8923,19 @@ static PBMethodOptions* defaultPBMethodOptionsInstance = nil;
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = PBGeneratedMessageGetMemoizedSize(&memoizedSerializedSize);
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
-  for (PBUninterpretedOption* element in self.uninterpretedOptionList) {
-    size += computeMessageSize(999, element);
+  size_ = 0;
+  for (PBUninterpretedOption *element in uninterpretedOptionArray) {
+    size_ += computeMessageSize(999, element);
   }
-  size += [self extensionsSerializedSize];
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
+  size_ += [self extensionsSerializedSize];
+  size_ += self.unknownFields.serializedSize;
+  PBGeneratedMessageSetMemoizedSize(&memoizedSerializedSize, size_);
+  return size_;
 }
 + (PBMethodOptions*) parseFromData:(NSData*) data {
   return (PBMethodOptions*)[[[PBMethodOptions builder] mergeFromData:data] build];
@@ -5075,60 +8959,173 @@ static PBMethodOptions* defaultPBMethodOptionsInstance = nil;
   return [[[PBMethodOptions_Builder alloc] init] autorelease];
 }
 + (PBMethodOptions_Builder*) builderWithPrototype:(PBMethodOptions*) prototype {
-  return [[PBMethodOptions builder] mergeFrom:prototype];
+  return [[[PBMethodOptions_Builder alloc] initWithPrototype:prototype] autorelease];
 }
 - (PBMethodOptions_Builder*) builder {
   return [PBMethodOptions builder];
 }
-@end
+- (PBMethodOptions_Builder*) toBuilder {
+  return [PBMethodOptions builderWithPrototype:self];
+}
+- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
+  for (PBUninterpretedOption* element in uninterpretedOptionArray) {
+    [output appendFormat:@"%@%@ {\n", indent, @"uninterpretedOption"];
+    [element writeDescriptionTo:output
+                     withIndent:[NSString stringWithFormat:@"%@  ", indent]];
+    [output appendFormat:@"%@}\n", indent];
+  }
+  [self writeExtensionDescriptionToMutableString:(NSMutableString*)output
+                                            from:1000
+                                              to:536870912
+                                      withIndent:indent];
+  [self.unknownFields writeDescriptionTo:output withIndent:indent];
+}
+- (BOOL) isEqual:(id)other {
+  if (other == self) {
+    return YES;
+  }
+  if (![other isKindOfClass:[PBMethodOptions class]]) {
+    return NO;
+  }
+  PBMethodOptions *otherMessage = other;
+  return
+      (uninterpretedOptionArray.count == 0 ? otherMessage->uninterpretedOptionArray.count == 0 : [uninterpretedOptionArray isEqualToArray:otherMessage->uninterpretedOptionArray]) &&
+      [self isEqualExtensionsInOther:otherMessage from:1000 to:536870912] &&
 
-@interface PBMethodOptions_Builder()
-@property (retain) PBMethodOptions* result;
+      (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
+}
+- (NSUInteger) hash {
+  NSUInteger hash_ = PBGeneratedMessageGetMemoizedHash(&memoizedHash);
+  if (hash_ != 0) {
+    return hash_;
+  }
+
+  uint64_t hashCode = 7;
+  for (PBUninterpretedOption* element in uninterpretedOptionArray) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [element hash]);
+  }
+  hashCode = PBGeneratedMessageHashMix(hashCode, [self hashExtensionsFrom:1000 to:536870912]);
+  hashCode = PBGeneratedMessageHashMix(hashCode, [self.unknownFields hash]);
+  hash_ = PBGeneratedMessageHashFinish(hashCode);
+  PBGeneratedMessageSetMemoizedHash(&memoizedHash, hash_);
+  return hash_;
+}
 @end
 
 @implementation PBMethodOptions_Builder
 @synthesize result;
 - (void) dealloc {
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
   self.result = nil;
+  [prototype_ release];
   [super dealloc];
 }
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[[PBMethodOptions alloc] init] autorelease];
+    result = [PBMethodOptions recycledInstance];
+  }
+  return self;
+}
+- (id) initWithPrototype:(PBMethodOptions*) prototype {
+  if ((self = [super init])) {
+    self.result = prototype;
+    prototype_ = [prototype retain];
   }
   return self;
 }
+- (void) detachFromPrototype {
+  PBMethodOptions* prototype = prototype_;
+  prototype_ = nil;
+  self.result = [[[PBMethodOptions alloc] init] autorelease];
+  [self mergeFrom:prototype];
+  [prototype release];
+}
+- (PBExtendableMessage*) internalGetMutableResult {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return [self internalGetResult];
+}
 - (PBExtendableMessage*) internalGetResult {
   return result;
 }
 - (PBMethodOptions_Builder*) clear {
-  self.result = [[[PBMethodOptions alloc] init] autorelease];
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = [[PBMethodOptions recycledInstance] autorelease];
   return self;
 }
 - (PBMethodOptions_Builder*) clone {
-  return [PBMethodOptions builderWithPrototype:result];
+  if (prototype_ != nil) {
+    return [[[PBMethodOptions_Builder alloc] initWithPrototype:prototype_] autorelease];
+  }
+  return [[PBMethodOptions builder] mergeFrom:result];
+}
+- (PBMethodOptions_Builder*) reset {
+  if (result == nil || prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    self.result = [[PBMethodOptions recycledInstance] autorelease];
+  } else {
+    [result clearForReuse];
+  }
+  return self;
+}
+- (PBMethodOptions_Builder*) recycle:(PBMethodOptions*) message {
+  if (message == [PBMethodOptions defaultInstance]) {
+    @throw [NSException exceptionWithName:@"IllegalArgument" reason:@"Cannot recycle the default instance" userInfo:nil];
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = message;
+  return [self reset];
 }
 - (PBMethodOptions*) defaultInstance {
   return [PBMethodOptions defaultInstance];
 }
 - (PBMethodOptions*) build {
   [self checkInitialized];
-  return [self buildPartial];
+  BOOL shared = prototype_ != nil;
+  PBMethodOptions* returnMe = [self buildPartial];
+  if (!shared) {
+    [returnMe setInitialized];
+  }
+  return returnMe;
 }
 - (PBMethodOptions*) buildPartial {
-  PBMethodOptions* returnMe = [[result retain] autorelease];
-  self.result = nil;
+  return [[self newBuildPartial] autorelease];
+}
+- (PBMethodOptions*) newBuildPartial {
+  if (prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    PBMethodOptions* returnMe = result;
+    result = nil;
+    return returnMe;
+  }
+  [result->uninterpretedOptionArray shrinkToFit];
+  PBMethodOptions* returnMe = result;
+  result = nil;
   return returnMe;
 }
 - (PBMethodOptions_Builder*) mergeFrom:(PBMethodOptions*) other {
   if (other == [PBMethodOptions defaultInstance]) {
     return self;
   }
-  if (other.mutableUninterpretedOptionList.count > 0) {
-    if (result.mutableUninterpretedOptionList == nil) {
-      result.mutableUninterpretedOptionList = [NSMutableArray array];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (other->uninterpretedOptionArray.count > 0) {
+    if (result->uninterpretedOptionArray == nil) {
+      result.uninterpretedOptionArray = [[other->uninterpretedOptionArray copyWithZone:[other->uninterpretedOptionArray zone]] autorelease];
+    } else {
+      [result->uninterpretedOptionArray appendArray:other->uninterpretedOptionArray];
     }
-    [result.mutableUninterpretedOptionList addObjectsFromArray:other.mutableUninterpretedOptionList];
   }
   [self mergeExtensionFields:other];
   [self mergeUnknownFields:other.unknownFields];
@@ -5138,144 +9135,238 @@ static PBMethodOptions* defaultPBMethodOptionsInstance = nil;
   return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
 }
 - (PBMethodOptions_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  PBUnknownFieldSet_Builder* unknownFields = nil;
   while (YES) {
     int32_t tag = [input readTag];
     switch (tag) {
       case 0:
-        [self setUnknownFields:[unknownFields build]];
+        if (unknownFields != nil) {
+          [self setUnknownFields:[unknownFields build]];
+        }
         return self;
       default: {
-        if (![self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag]) {
-          [self setUnknownFields:[unknownFields build]];
+        if (PBWireFormatGetTagWireType(tag) == PBWireFormatEndGroup) {
+          if (unknownFields != nil) {
+            [self setUnknownFields:[unknownFields build]];
+          }
           return self;
         }
+        if (unknownFields == nil) {
+          unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+        }
+        [self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag];
         break;
       }
       case 7994: {
-        PBUninterpretedOption_Builder* subBuilder = [PBUninterpretedOption builder];
-        [input readMessage:subBuilder extensionRegistry:extensionRegistry];
-        [self addUninterpretedOption:[subBuilder buildPartial]];
+        PBUninterpretedOption_Builder* subBuilder = [[PBUninterpretedOption_Builder alloc] init];
+        @try {
+          [input readMessage:subBuilder extensionRegistry:extensionRegistry];
+          PBUninterpretedOption* value = [subBuilder newBuildPartial];
+          [self addUninterpretedOption:value];
+          [value release];
+        } @finally {
+          [subBuilder release];
+        }
         break;
       }
     }
   }
 }
-- (NSArray*) uninterpretedOptionList {
-  if (result.mutableUninterpretedOptionList == nil) { return [NSArray array]; }
-  return result.mutableUninterpretedOptionList;
+- (PBAppendableArray *)uninterpretedOption {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return result->uninterpretedOptionArray;
 }
-- (PBUninterpretedOption*) uninterpretedOptionAtIndex:(int32_t) index {
+- (PBUninterpretedOption*)uninterpretedOptionAtIndex:(NSUInteger)index {
   return [result uninterpretedOptionAtIndex:index];
 }
-- (PBMethodOptions_Builder*) replaceUninterpretedOptionAtIndex:(int32_t) index with:(PBUninterpretedOption*) value {
-  [result.mutableUninterpretedOptionList replaceObjectAtIndex:index withObject:value];
+- (PBMethodOptions_Builder *)addUninterpretedOption:(PBUninterpretedOption*)value {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (result->uninterpretedOptionArray == nil) {
+    result.uninterpretedOptionArray = [PBObjectArray array];
+  }
+  PBObjectArrayAddValue(result->uninterpretedOptionArray, value);
   return self;
 }
-- (PBMethodOptions_Builder*) addAllUninterpretedOption:(NSArray*) values {
-  if (result.mutableUninterpretedOptionList == nil) {
-    result.mutableUninterpretedOptionList = [NSMutableArray array];
+- (PBMethodOptions_Builder *)setUninterpretedOptionArray:(NSArray *)array {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  [result.mutableUninterpretedOptionList addObjectsFromArray:values];
+  result.uninterpretedOptionArray = [PBObjectArray arrayWithArray:array valueType:PBArrayValueTypeObject];
   return self;
 }
-- (PBMethodOptions_Builder*) clearUninterpretedOptionList {
-  result.mutableUninterpretedOptionList = nil;
+- (PBMethodOptions_Builder *)setUninterpretedOptionValues:(const PBUninterpretedOption* *)values count:(NSUInteger)count {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.uninterpretedOptionArray = [PBObjectArray arrayWithValues:values count:count valueType:PBArrayValueTypeObject];
   return self;
 }
-- (PBMethodOptions_Builder*) addUninterpretedOption:(PBUninterpretedOption*) value {
-  if (result.mutableUninterpretedOptionList == nil) {
-    result.mutableUninterpretedOptionList = [NSMutableArray array];
+- (PBMethodOptions_Builder *)clearUninterpretedOption {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  [result.mutableUninterpretedOptionList addObject:value];
+  result.uninterpretedOptionArray = nil;
   return self;
 }
 @end
 
 @interface PBUninterpretedOption ()
-@property (retain) NSMutableArray* mutableNameList;
-@property (retain) NSString* identifierValue;
-@property int64_t positiveIntValue;
-@property int64_t negativeIntValue;
-@property Float64 doubleValue;
-@property (retain) NSData* stringValue;
+@property (nonatomic, retain) PBObjectArray * nameArray;
+@property (nonatomic, retain) NSString* identifierValue;
+@property (nonatomic) uint64_t positiveIntValue;
+@property (nonatomic) int64_t negativeIntValue;
+@property (nonatomic) Float64 doubleValue;
+@property (nonatomic, retain) NSData* stringValue;
+@property (nonatomic, retain) NSString* aggregateValue;
+- (void) setInitialized;
+@end
+
+@interface PBUninterpretedOption_Builder()
+@property (nonatomic, retain) PBUninterpretedOption* result;
+- (id) initWithPrototype:(PBUninterpretedOption*) prototype;
+- (void) detachFromPrototype;
 @end
 
 @implementation PBUninterpretedOption
 
-@synthesize mutableNameList;
+@synthesize nameArray;
+@dynamic name;
 - (BOOL) hasIdentifierValue {
-  return !!hasIdentifierValue_;
+  return (hasBits_[0] & 0x1u) != 0;
 }
-- (void) setHasIdentifierValue:(BOOL) value {
-  hasIdentifierValue_ = !!value;
+- (void) setHasIdentifierValue:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x1u;
+  } else {
+    hasBits_[0] &= ~0x1u;
+  }
 }
 @synthesize identifierValue;
+- (NSString*) identifierValue {
+  return (hasBits_[0] & 0x1u) ? identifierValue : @"";
+}
 - (BOOL) hasPositiveIntValue {
-  return !!hasPositiveIntValue_;
+  return (hasBits_[0] & 0x2u) != 0;
 }
-- (void) setHasPositiveIntValue:(BOOL) value {
-  hasPositiveIntValue_ = !!value;
+- (void) setHasPositiveIntValue:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x2u;
+  } else {
+    hasBits_[0] &= ~0x2u;
+  }
 }
 @synthesize positiveIntValue;
 - (BOOL) hasNegativeIntValue {
-  return !!hasNegativeIntValue_;
+  return (hasBits_[0] & 0x4u) != 0;
 }
-- (void) setHasNegativeIntValue:(BOOL) value {
-  hasNegativeIntValue_ = !!value;
+- (void) setHasNegativeIntValue:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x4u;
+  } else {
+    hasBits_[0] &= ~0x4u;
+  }
 }
 @synthesize negativeIntValue;
 - (BOOL) hasDoubleValue {
-  return !!hasDoubleValue_;
+  return (hasBits_[0] & 0x8u) != 0;
 }
-- (void) setHasDoubleValue:(BOOL) value {
-  hasDoubleValue_ = !!value;
+- (void) setHasDoubleValue:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x8u;
+  } else {
+    hasBits_[0] &= ~0x8u;
+  }
 }
 @synthesize doubleValue;
 - (BOOL) hasStringValue {
-  return !!hasStringValue_;
+  return (hasBits_[0] & 0x10u) != 0;
 }
-- (void) setHasStringValue:(BOOL) value {
-  hasStringValue_ = !!value;
+- (void) setHasStringValue:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x10u;
+  } else {
+    hasBits_[0] &= ~0x10u;
+  }
 }
 @synthesize stringValue;
+- (NSData*) stringValue {
+  if (hasBits_[0] & 0x10u) {
+    return stringValue;
+  }
+  static NSData* defaultValue = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultValue = [[NSData data] retain];
+  });
+  return defaultValue;
+}
+- (BOOL) hasAggregateValue {
+  return (hasBits_[0] & 0x20u) != 0;
+}
+- (void) setHasAggregateValue:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x20u;
+  } else {
+    hasBits_[0] &= ~0x20u;
+  }
+}
+@synthesize aggregateValue;
+- (NSString*) aggregateValue {
+  return (hasBits_[0] & 0x20u) ? aggregateValue : @"";
+}
 - (void) dealloc {
-  self.mutableNameList = nil;
-  self.identifierValue = nil;
-  self.stringValue = nil;
+  [nameArray release];
+  [identifierValue release];
+  [stringValue release];
+  [aggregateValue release];
   [super dealloc];
 }
-- (id) init {
-  if ((self = [super init])) {
-    self.identifierValue = @"";
-    self.positiveIntValue = 0L;
-    self.negativeIntValue = 0L;
-    self.doubleValue = 0;
-    self.stringValue = [NSData data];
-  }
-  return self;
+- (void) clearForReuse {
+  [super clearForReuse];
+  memset(hasBits_, 0, sizeof(hasBits_));
+  nameArray = PBAppendableArrayReuse(nameArray);
+  [identifierValue release];
+  identifierValue = nil;
+  positiveIntValue = 0;
+  negativeIntValue = 0;
+  doubleValue = 0;
+  [stringValue release];
+  stringValue = nil;
+  [aggregateValue release];
+  aggregateValue = nil;
 }
 static PBUninterpretedOption* defaultPBUninterpretedOptionInstance = nil;
-+ (void) initialize {
-  if (self == [PBUninterpretedOption class]) {
-    defaultPBUninterpretedOptionInstance = [[PBUninterpretedOption alloc] init];
-  }
-}
 + (PBUninterpretedOption*) defaultInstance {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultPBUninterpretedOptionInstance = [[PBUninterpretedOption alloc] init];
+  });
   return defaultPBUninterpretedOptionInstance;
 }
 - (PBUninterpretedOption*) defaultInstance {
-  return defaultPBUninterpretedOptionInstance;
+  return [PBUninterpretedOption defaultInstance];
+}
+- (PBArray *)name {
+  return nameArray;
 }
-- (NSArray*) nameList {
-  return mutableNameList;
+- (PBUninterpretedOption_NamePart*)nameAtIndex:(NSUInteger)index {
+  return PBObjectArrayValueAtIndex(nameArray, index);
 }
-- (PBUninterpretedOption_NamePart*) nameAtIndex:(int32_t) index {
-  id value = [mutableNameList objectAtIndex:index];
-  return value;
+- (void) setInitialized {
+  hasBits_[0] |= 0x40u;
 }
 - (BOOL) isInitialized {
-  for (PBUninterpretedOption_NamePart* element in self.nameList) {
+  if ((hasBits_[0] & 0x40u) != 0) {
+    return YES;
+  }
+  for (PBUninterpretedOption_NamePart* element in nameArray) {
     if (!element.isInitialized) {
       return NO;
     }
@@ -5283,54 +9374,60 @@ static PBUninterpretedOption* defaultPBUninterpretedOptionInstance = nil;
   return YES;
 }
 - (void) writeToCodedOutputStream:(PBCodedOutputStream*) output {
-  for (PBUninterpretedOption_NamePart* element in self.nameList) {
+  for (PBUninterpretedOption_NamePart *element in nameArray) {
     [output writeMessage:2 value:element];
   }
-  if (self.hasIdentifierValue) {
-    [output writeString:3 value:self.identifierValue];
+  if (hasBits_[0] & 0x1u) {
+    [output writeString:3 value:identifierValue];
+  }
+  if (hasBits_[0] & 0x2u) {
+    [output writeUInt64:4 value:positiveIntValue];
   }
-  if (self.hasPositiveIntValue) {
-    [output writeUInt64:4 value:self.positiveIntValue];
+  if (hasBits_[0] & 0x4u) {
+    [output writeInt64:5 value:negativeIntValue];
   }
-  if (self.hasNegativeIntValue) {
-    [output writeInt64:5 value:self.negativeIntValue];
+  if (hasBits_[0] & 0x8u) {
+    [output writeDouble:6 value:doubleValue];
   }
-  if (self.hasDoubleValue) {
-    [output writeDouble:6 value:self.doubleValue];
+  if (hasBits_[0] & 0x10u) {
+    [output writeData:7 value:stringValue];
   }
-  if (self.hasStringValue) {
-    [output writeData:7 value:self.stringValue];
+  if (hasBits_[0] & 0x20u) {
+    [output writeString:8 value:aggregateValue];
   }
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = PBGeneratedMessageGetMemoizedSize(&memoizedSerializedSize);
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
-  for (PBUninterpretedOption_NamePart* element in self.nameList) {
-    size += computeMessageSize(2, element);
+  size_ = 0;
+  for (PBUninterpretedOption_NamePart *element in nameArray) {
+    size_ += computeMessageSize(2, element);
   }
-  if (self.hasIdentifierValue) {
-    size += computeStringSize(3, self.identifierValue);
+  if (hasBits_[0] & 0x1u) {
+    size_ += computeStringSize(3, identifierValue);
   }
-  if (self.hasPositiveIntValue) {
-    size += computeUInt64Size(4, self.positiveIntValue);
+  if (hasBits_[0] & 0x2u) {
+    size_ += computeUInt64Size(4, positiveIntValue);
   }
-  if (self.hasNegativeIntValue) {
-    size += computeInt64Size(5, self.negativeIntValue);
+  if (hasBits_[0] & 0x4u) {
+    size_ += computeInt64Size(5, negativeIntValue);
   }
-  if (self.hasDoubleValue) {
-    size += computeDoubleSize(6, self.doubleValue);
+  if (hasBits_[0] & 0x8u) {
+    size_ += computeDoubleSize(6, doubleValue);
   }
-  if (self.hasStringValue) {
-    size += computeDataSize(7, self.stringValue);
+  if (hasBits_[0] & 0x10u) {
+    size_ += computeDataSize(7, stringValue);
   }
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
+  if (hasBits_[0] & 0x20u) {
+    size_ += computeStringSize(8, aggregateValue);
+  }
+  size_ += self.unknownFields.serializedSize;
+  PBGeneratedMessageSetMemoizedSize(&memoizedSerializedSize, size_);
+  return size_;
 }
 + (PBUninterpretedOption*) parseFromData:(NSData*) data {
   return (PBUninterpretedOption*)[[[PBUninterpretedOption builder] mergeFromData:data] build];
@@ -5354,96 +9451,203 @@ static PBUninterpretedOption* defaultPBUninterpretedOptionInstance = nil;
   return [[[PBUninterpretedOption_Builder alloc] init] autorelease];
 }
 + (PBUninterpretedOption_Builder*) builderWithPrototype:(PBUninterpretedOption*) prototype {
-  return [[PBUninterpretedOption builder] mergeFrom:prototype];
+  return [[[PBUninterpretedOption_Builder alloc] initWithPrototype:prototype] autorelease];
 }
 - (PBUninterpretedOption_Builder*) builder {
   return [PBUninterpretedOption builder];
 }
+- (PBUninterpretedOption_Builder*) toBuilder {
+  return [PBUninterpretedOption builderWithPrototype:self];
+}
+- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
+  for (PBUninterpretedOption_NamePart* element in nameArray) {
+    [output appendFormat:@"%@%@ {\n", indent, @"name"];
+    [element writeDescriptionTo:output
+                     withIndent:[NSString stringWithFormat:@"%@  ", indent]];
+    [output appendFormat:@"%@}\n", indent];
+  }
+  if (hasBits_[0] & 0x1u) {
+    [output appendFormat:@"%@%@: %@\n", indent, @"identifierValue", identifierValue];
+  }
+  if (hasBits_[0] & 0x2u) {
+    [output appendFormat:@"%@%@: %@\n", indent, @"positiveIntValue", [NSNumber numberWithLongLong:positiveIntValue]];
+  }
+  if (hasBits_[0] & 0x4u) {
+    [output appendFormat:@"%@%@: %@\n", indent, @"negativeIntValue", [NSNumber numberWithLongLong:negativeIntValue]];
+  }
+  if (hasBits_[0] & 0x8u) {
+    [output appendFormat:@"%@%@: %@\n", indent, @"doubleValue", [NSNumber numberWithDouble:doubleValue]];
+  }
+  if (hasBits_[0] & 0x10u) {
+    [output appendFormat:@"%@%@: %@\n", indent, @"stringValue", stringValue];
+  }
+  if (hasBits_[0] & 0x20u) {
+    [output appendFormat:@"%@%@: %@\n", indent, @"aggregateValue", aggregateValue];
+  }
+  [self.unknownFields writeDescriptionTo:output withIndent:indent];
+}
+- (BOOL) isEqual:(id)other {
+  if (other == self) {
+    return YES;
+  }
+  if (![other isKindOfClass:[PBUninterpretedOption class]]) {
+    return NO;
+  }
+  PBUninterpretedOption *otherMessage = other;
+  return
+      (nameArray.count == 0 ? otherMessage->nameArray.count == 0 : [nameArray isEqualToArray:otherMessage->nameArray]) &&
+      (hasBits_[0] & 0x1u) == (otherMessage->hasBits_[0] & 0x1u) &&
+      (!(hasBits_[0] & 0x1u) || [identifierValue isEqual:otherMessage->identifierValue]) &&
+      (hasBits_[0] & 0x2u) == (otherMessage->hasBits_[0] & 0x2u) &&
+      (!(hasBits_[0] & 0x2u) || positiveIntValue == otherMessage->positiveIntValue) &&
+      (hasBits_[0] & 0x4u) == (otherMessage->hasBits_[0] & 0x4u) &&
+      (!(hasBits_[0] & 0x4u) || negativeIntValue == otherMessage->negativeIntValue) &&
+      (hasBits_[0] & 0x8u) == (otherMessage->hasBits_[0] & 0x8u) &&
+      (!(hasBits_[0] & 0x8u) || doubleValue == otherMessage->doubleValue) &&
+      (hasBits_[0] & 0x10u) == (otherMessage->hasBits_[0] & 0x10u) &&
+      (!(hasBits_[0] & 0x10u) || [stringValue isEqual:otherMessage->stringValue]) &&
+      (hasBits_[0] & 0x20u) == (otherMessage->hasBits_[0] & 0x20u) &&
+      (!(hasBits_[0] & 0x20u) || [aggregateValue isEqual:otherMessage->aggregateValue]) &&
+      (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
+}
+- (NSUInteger) hash {
+  NSUInteger hash_ = PBGeneratedMessageGetMemoizedHash(&memoizedHash);
+  if (hash_ != 0) {
+    return hash_;
+  }
+
+  uint64_t hashCode = 7;
+  for (PBUninterpretedOption_NamePart* element in nameArray) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [element hash]);
+  }
+  if (hasBits_[0] & 0x1u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [identifierValue hash]);
+  }
+  if (hasBits_[0] & 0x2u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, (uint64_t)positiveIntValue);
+  }
+  if (hasBits_[0] & 0x4u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, (uint64_t)negativeIntValue);
+  }
+  if (hasBits_[0] & 0x8u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, PBGeneratedMessageHashDouble(doubleValue));
+  }
+  if (hasBits_[0] & 0x10u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [stringValue hash]);
+  }
+  if (hasBits_[0] & 0x20u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [aggregateValue hash]);
+  }
+  hashCode = PBGeneratedMessageHashMix(hashCode, [self.unknownFields hash]);
+  hash_ = PBGeneratedMessageHashFinish(hashCode);
+  PBGeneratedMessageSetMemoizedHash(&memoizedHash, hash_);
+  return hash_;
+}
 @end
 
 @interface PBUninterpretedOption_NamePart ()
-@property (retain) NSString* namePart;
-@property BOOL isExtension;
+@property (nonatomic, retain) NSString* namePart;
+@property (nonatomic) BOOL isExtension;
+- (void) setInitialized;
+@end
+
+@interface PBUninterpretedOption_NamePart_Builder()
+@property (nonatomic, retain) PBUninterpretedOption_NamePart* result;
+- (id) initWithPrototype:(PBUninterpretedOption_NamePart*) prototype;
+- (void) detachFromPrototype;
 @end
 
 @implementation PBUninterpretedOption_NamePart
 
 - (BOOL) hasNamePart {
-  return !!hasNamePart_;
+  return (hasBits_[0] & 0x1u) != 0;
 }
-- (void) setHasNamePart:(BOOL) value {
-  hasNamePart_ = !!value;
+- (void) setHasNamePart:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x1u;
+  } else {
+    hasBits_[0] &= ~0x1u;
+  }
 }
 @synthesize namePart;
+- (NSString*) namePart {
+  return (hasBits_[0] & 0x1u) ? namePart : @"";
+}
 - (BOOL) hasIsExtension {
-  return !!hasIsExtension_;
+  return (hasBits_[0] & 0x2u) != 0;
 }
-- (void) setHasIsExtension:(BOOL) value {
-  hasIsExtension_ = !!value;
+- (void) setHasIsExtension:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x2u;
+  } else {
+    hasBits_[0] &= ~0x2u;
+  }
 }
 - (BOOL) isExtension {
   return !!isExtension_;
 }
-- (void) setIsExtension:(BOOL) value {
-  isExtension_ = !!value;
+- (void) setIsExtension:(BOOL) value_ {
+  isExtension_ = !!value_;
 }
 - (void) dealloc {
-  self.namePart = nil;
+  [namePart release];
   [super dealloc];
 }
-- (id) init {
-  if ((self = [super init])) {
-    self.namePart = @"";
-    self.isExtension = NO;
-  }
-  return self;
+- (void) clearForReuse {
+  [super clearForReuse];
+  memset(hasBits_, 0, sizeof(hasBits_));
+  [namePart release];
+  namePart = nil;
+  isExtension_ = 0;
 }
 static PBUninterpretedOption_NamePart* defaultPBUninterpretedOption_NamePartInstance = nil;
-+ (void) initialize {
-  if (self == [PBUninterpretedOption_NamePart class]) {
-    defaultPBUninterpretedOption_NamePartInstance = [[PBUninterpretedOption_NamePart alloc] init];
-  }
-}
 + (PBUninterpretedOption_NamePart*) defaultInstance {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultPBUninterpretedOption_NamePartInstance = [[PBUninterpretedOption_NamePart alloc] init];
+  });
   return defaultPBUninterpretedOption_NamePartInstance;
 }
 - (PBUninterpretedOption_NamePart*) defaultInstance {
-  return defaultPBUninterpretedOption_NamePartInstance;
+  return [PBUninterpretedOption_NamePart defaultInstance];
+}
+- (void) setInitialized {
+  hasBits_[0] |= 0x4u;
 }
 - (BOOL) isInitialized {
-  if (!self.hasNamePart) {
-    return NO;
+  if ((hasBits_[0] & 0x4u) != 0) {
+    return YES;
   }
-  if (!self.hasIsExtension) {
+  if ((hasBits_[0] & 0x3u) != 0x3u) {
     return NO;
   }
   return YES;
 }
 - (void) writeToCodedOutputStream:(PBCodedOutputStream*) output {
-  if (self.hasNamePart) {
-    [output writeString:1 value:self.namePart];
+  if (hasBits_[0] & 0x1u) {
+    [output writeString:1 value:namePart];
   }
-  if (self.hasIsExtension) {
-    [output writeBool:2 value:self.isExtension];
+  if (hasBits_[0] & 0x2u) {
+    [output writeBool:2 value:!!isExtension_];
   }
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = PBGeneratedMessageGetMemoizedSize(&memoizedSerializedSize);
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
-  if (self.hasNamePart) {
-    size += computeStringSize(1, self.namePart);
+  size_ = 0;
+  if (hasBits_[0] & 0x1u) {
+    size_ += computeStringSize(1, namePart);
   }
-  if (self.hasIsExtension) {
-    size += computeBoolSize(2, self.isExtension);
+  if (hasBits_[0] & 0x2u) {
+    size_ += computeBoolSize(2, !!isExtension_);
   }
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
+  size_ += self.unknownFields.serializedSize;
+  PBGeneratedMessageSetMemoizedSize(&memoizedSerializedSize, size_);
+  return size_;
 }
 + (PBUninterpretedOption_NamePart*) parseFromData:(NSData*) data {
   return (PBUninterpretedOption_NamePart*)[[[PBUninterpretedOption_NamePart builder] mergeFromData:data] build];
@@ -5467,60 +9671,170 @@ static PBUninterpretedOption_NamePart* defaultPBUninterpretedOption_NamePartInst
   return [[[PBUninterpretedOption_NamePart_Builder alloc] init] autorelease];
 }
 + (PBUninterpretedOption_NamePart_Builder*) builderWithPrototype:(PBUninterpretedOption_NamePart*) prototype {
-  return [[PBUninterpretedOption_NamePart builder] mergeFrom:prototype];
+  return [[[PBUninterpretedOption_NamePart_Builder alloc] initWithPrototype:prototype] autorelease];
 }
 - (PBUninterpretedOption_NamePart_Builder*) builder {
   return [PBUninterpretedOption_NamePart builder];
 }
-@end
+- (PBUninterpretedOption_NamePart_Builder*) toBuilder {
+  return [PBUninterpretedOption_NamePart builderWithPrototype:self];
+}
+- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
+  if (hasBits_[0] & 0x1u) {
+    [output appendFormat:@"%@%@: %@\n", indent, @"namePart", namePart];
+  }
+  if (hasBits_[0] & 0x2u) {
+    [output appendFormat:@"%@%@: %@\n", indent, @"isExtension", [NSNumber numberWithBool:!!isExtension_]];
+  }
+  [self.unknownFields writeDescriptionTo:output withIndent:indent];
+}
+- (BOOL) isEqual:(id)other {
+  if (other == self) {
+    return YES;
+  }
+  if (![other isKindOfClass:[PBUninterpretedOption_NamePart class]]) {
+    return NO;
+  }
+  PBUninterpretedOption_NamePart *otherMessage = other;
+  return
+      (hasBits_[0] & 0x1u) == (otherMessage->hasBits_[0] & 0x1u) &&
+      (!(hasBits_[0] & 0x1u) || [namePart isEqual:otherMessage->namePart]) &&
+      (hasBits_[0] & 0x2u) == (otherMessage->hasBits_[0] & 0x2u) &&
+      (!(hasBits_[0] & 0x2u) || !!isExtension_ == !!otherMessage->isExtension_) &&
+      (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
+}
+- (NSUInteger) hash {
+  NSUInteger hash_ = PBGeneratedMessageGetMemoizedHash(&memoizedHash);
+  if (hash_ != 0) {
+    return hash_;
+  }
 
-@interface PBUninterpretedOption_NamePart_Builder()
-@property (retain) PBUninterpretedOption_NamePart* result;
+  uint64_t hashCode = 7;
+  if (hasBits_[0] & 0x1u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [namePart hash]);
+  }
+  if (hasBits_[0] & 0x2u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, (uint64_t)!!isExtension_);
+  }
+  hashCode = PBGeneratedMessageHashMix(hashCode, [self.unknownFields hash]);
+  hash_ = PBGeneratedMessageHashFinish(hashCode);
+  PBGeneratedMessageSetMemoizedHash(&memoizedHash, hash_);
+  return hash_;
+}
 @end
 
 @implementation PBUninterpretedOption_NamePart_Builder
 @synthesize result;
 - (void) dealloc {
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
   self.result = nil;
+  [prototype_ release];
   [super dealloc];
 }
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[[PBUninterpretedOption_NamePart alloc] init] autorelease];
+    result = [PBUninterpretedOption_NamePart recycledInstance];
   }
   return self;
 }
+- (id) initWithPrototype:(PBUninterpretedOption_NamePart*) prototype {
+  if ((self = [super init])) {
+    self.result = prototype;
+    prototype_ = [prototype retain];
+  }
+  return self;
+}
+- (void) detachFromPrototype {
+  PBUninterpretedOption_NamePart* prototype = prototype_;
+  prototype_ = nil;
+  self.result = [[[PBUninterpretedOption_NamePart alloc] init] autorelease];
+  [self mergeFrom:prototype];
+  [prototype release];
+}
+- (PBGeneratedMessage*) internalGetMutableResult {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return [self internalGetResult];
+}
 - (PBGeneratedMessage*) internalGetResult {
   return result;
 }
 - (PBUninterpretedOption_NamePart_Builder*) clear {
-  self.result = [[[PBUninterpretedOption_NamePart alloc] init] autorelease];
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = [[PBUninterpretedOption_NamePart recycledInstance] autorelease];
   return self;
 }
 - (PBUninterpretedOption_NamePart_Builder*) clone {
-  return [PBUninterpretedOption_NamePart builderWithPrototype:result];
+  if (prototype_ != nil) {
+    return [[[PBUninterpretedOption_NamePart_Builder alloc] initWithPrototype:prototype_] autorelease];
+  }
+  return [[PBUninterpretedOption_NamePart builder] mergeFrom:result];
 }
-- (PBUninterpretedOption_NamePart*) defaultInstance {
-  return [PBUninterpretedOption_NamePart defaultInstance];
+- (PBUninterpretedOption_NamePart_Builder*) reset {
+  if (result == nil || prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    self.result = [[PBUninterpretedOption_NamePart recycledInstance] autorelease];
+  } else {
+    [result clearForReuse];
+  }
+  return self;
+}
+- (PBUninterpretedOption_NamePart_Builder*) recycle:(PBUninterpretedOption_NamePart*) message {
+  if (message == [PBUninterpretedOption_NamePart defaultInstance]) {
+    @throw [NSException exceptionWithName:@"IllegalArgument" reason:@"Cannot recycle the default instance" userInfo:nil];
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = message;
+  return [self reset];
+}
+- (PBUninterpretedOption_NamePart*) defaultInstance {
+  return [PBUninterpretedOption_NamePart defaultInstance];
 }
 - (PBUninterpretedOption_NamePart*) build {
   [self checkInitialized];
-  return [self buildPartial];
+  BOOL shared = prototype_ != nil;
+  PBUninterpretedOption_NamePart* returnMe = [self buildPartial];
+  if (!shared) {
+    [returnMe setInitialized];
+  }
+  return returnMe;
 }
 - (PBUninterpretedOption_NamePart*) buildPartial {
-  PBUninterpretedOption_NamePart* returnMe = [[result retain] autorelease];
-  self.result = nil;
+  return [[self newBuildPartial] autorelease];
+}
+- (PBUninterpretedOption_NamePart*) newBuildPartial {
+  if (prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    PBUninterpretedOption_NamePart* returnMe = result;
+    result = nil;
+    return returnMe;
+  }
+  PBUninterpretedOption_NamePart* returnMe = result;
+  result = nil;
   return returnMe;
 }
 - (PBUninterpretedOption_NamePart_Builder*) mergeFrom:(PBUninterpretedOption_NamePart*) other {
   if (other == [PBUninterpretedOption_NamePart defaultInstance]) {
     return self;
   }
-  if (other.hasNamePart) {
-    [self setNamePart:other.namePart];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (other->hasBits_[0] & 0x1u) {
+    [self setNamePart:other->namePart];
   }
-  if (other.hasIsExtension) {
-    [self setIsExtension:other.isExtension];
+  if (other->hasBits_[0] & 0x2u) {
+    [self setIsExtension:other->isExtension_];
   }
   [self mergeUnknownFields:other.unknownFields];
   return self;
@@ -5529,22 +9843,35 @@ static PBUninterpretedOption_NamePart* defaultPBUninterpretedOption_NamePartInst
   return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
 }
 - (PBUninterpretedOption_NamePart_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  PBUnknownFieldSet_Builder* unknownFields = nil;
   while (YES) {
     int32_t tag = [input readTag];
     switch (tag) {
       case 0:
-        [self setUnknownFields:[unknownFields build]];
+        if (unknownFields != nil) {
+          [self setUnknownFields:[unknownFields build]];
+        }
         return self;
       default: {
-        if (![self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag]) {
-          [self setUnknownFields:[unknownFields build]];
+        if (PBWireFormatGetTagWireType(tag) == PBWireFormatEndGroup) {
+          if (unknownFields != nil) {
+            [self setUnknownFields:[unknownFields build]];
+          }
           return self;
         }
+        if (unknownFields == nil) {
+          unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+        }
+        [self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag];
         break;
       }
       case 10: {
-        [self setNamePart:[input readString]];
+        NSString* value = [input newString];
+        [self setNamePart:value];
+        [value release];
         break;
       }
       case 16: {
@@ -5555,101 +9882,184 @@ static PBUninterpretedOption_NamePart* defaultPBUninterpretedOption_NamePartInst
   }
 }
 - (BOOL) hasNamePart {
-  return result.hasNamePart;
+  return (result->hasBits_[0] & 0x1u) != 0;
 }
 - (NSString*) namePart {
-  return result.namePart;
+  return [result namePart];
 }
 - (PBUninterpretedOption_NamePart_Builder*) setNamePart:(NSString*) value {
-  result.hasNamePart = YES;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x1u;
   result.namePart = value;
   return self;
 }
 - (PBUninterpretedOption_NamePart_Builder*) clearNamePart {
-  result.hasNamePart = NO;
-  result.namePart = @"";
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x1u;
+  [result->namePart release];
+  result->namePart = nil;
   return self;
 }
 - (BOOL) hasIsExtension {
-  return result.hasIsExtension;
+  return (result->hasBits_[0] & 0x2u) != 0;
 }
 - (BOOL) isExtension {
-  return result.isExtension;
+  return !!result->isExtension_;
 }
 - (PBUninterpretedOption_NamePart_Builder*) setIsExtension:(BOOL) value {
-  result.hasIsExtension = YES;
-  result.isExtension = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x2u;
+  result->isExtension_ = !!value;
   return self;
 }
 - (PBUninterpretedOption_NamePart_Builder*) clearIsExtension {
-  result.hasIsExtension = NO;
-  result.isExtension = NO;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x2u;
+  result->isExtension_ = 0;
   return self;
 }
 @end
 
-@interface PBUninterpretedOption_Builder()
-@property (retain) PBUninterpretedOption* result;
-@end
-
 @implementation PBUninterpretedOption_Builder
 @synthesize result;
 - (void) dealloc {
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
   self.result = nil;
+  [prototype_ release];
   [super dealloc];
 }
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[[PBUninterpretedOption alloc] init] autorelease];
+    result = [PBUninterpretedOption recycledInstance];
   }
   return self;
 }
+- (id) initWithPrototype:(PBUninterpretedOption*) prototype {
+  if ((self = [super init])) {
+    self.result = prototype;
+    prototype_ = [prototype retain];
+  }
+  return self;
+}
+- (void) detachFromPrototype {
+  PBUninterpretedOption* prototype = prototype_;
+  prototype_ = nil;
+  self.result = [[[PBUninterpretedOption alloc] init] autorelease];
+  [self mergeFrom:prototype];
+  [prototype release];
+}
+- (PBGeneratedMessage*) internalGetMutableResult {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return [self internalGetResult];
+}
 - (PBGeneratedMessage*) internalGetResult {
   return result;
 }
 - (PBUninterpretedOption_Builder*) clear {
-  self.result = [[[PBUninterpretedOption alloc] init] autorelease];
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = [[PBUninterpretedOption recycledInstance] autorelease];
   return self;
 }
 - (PBUninterpretedOption_Builder*) clone {
-  return [PBUninterpretedOption builderWithPrototype:result];
+  if (prototype_ != nil) {
+    return [[[PBUninterpretedOption_Builder alloc] initWithPrototype:prototype_] autorelease];
+  }
+  return [[PBUninterpretedOption builder] mergeFrom:result];
+}
+- (PBUninterpretedOption_Builder*) reset {
+  if (result == nil || prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    self.result = [[PBUninterpretedOption recycledInstance] autorelease];
+  } else {
+    [result clearForReuse];
+  }
+  return self;
+}
+- (PBUninterpretedOption_Builder*) recycle:(PBUninterpretedOption*) message {
+  if (message == [PBUninterpretedOption defaultInstance]) {
+    @throw [NSException exceptionWithName:@"IllegalArgument" reason:@"Cannot recycle the default instance" userInfo:nil];
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = message;
+  return [self reset];
 }
 - (PBUninterpretedOption*) defaultInstance {
   return [PBUninterpretedOption defaultInstance];
 }
 - (PBUninterpretedOption*) build {
   [self checkInitialized];
-  return [self buildPartial];
+  BOOL shared = prototype_ != nil;
+  PBUninterpretedOption* returnMe = [self buildPartial];
+  if (!shared) {
+    [returnMe setInitialized];
+  }
+  return returnMe;
 }
 - (PBUninterpretedOption*) buildPartial {
-  PBUninterpretedOption* returnMe = [[result retain] autorelease];
-  self.result = nil;
+  return [[self newBuildPartial] autorelease];
+}
+- (PBUninterpretedOption*) newBuildPartial {
+  if (prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    PBUninterpretedOption* returnMe = result;
+    result = nil;
+    return returnMe;
+  }
+  [result->nameArray shrinkToFit];
+  PBUninterpretedOption* returnMe = result;
+  result = nil;
   return returnMe;
 }
 - (PBUninterpretedOption_Builder*) mergeFrom:(PBUninterpretedOption*) other {
   if (other == [PBUninterpretedOption defaultInstance]) {
     return self;
   }
-  if (other.mutableNameList.count > 0) {
-    if (result.mutableNameList == nil) {
-      result.mutableNameList = [NSMutableArray array];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (other->nameArray.count > 0) {
+    if (result->nameArray == nil) {
+      result.nameArray = [[other->nameArray copyWithZone:[other->nameArray zone]] autorelease];
+    } else {
+      [result->nameArray appendArray:other->nameArray];
     }
-    [result.mutableNameList addObjectsFromArray:other.mutableNameList];
   }
-  if (other.hasIdentifierValue) {
-    [self setIdentifierValue:other.identifierValue];
+  if (other->hasBits_[0] & 0x1u) {
+    [self setIdentifierValue:other->identifierValue];
+  }
+  if (other->hasBits_[0] & 0x2u) {
+    [self setPositiveIntValue:other->positiveIntValue];
   }
-  if (other.hasPositiveIntValue) {
-    [self setPositiveIntValue:other.positiveIntValue];
+  if (other->hasBits_[0] & 0x4u) {
+    [self setNegativeIntValue:other->negativeIntValue];
   }
-  if (other.hasNegativeIntValue) {
-    [self setNegativeIntValue:other.negativeIntValue];
+  if (other->hasBits_[0] & 0x8u) {
+    [self setDoubleValue:other->doubleValue];
   }
-  if (other.hasDoubleValue) {
-    [self setDoubleValue:other.doubleValue];
+  if (other->hasBits_[0] & 0x10u) {
+    [self setStringValue:other->stringValue];
   }
-  if (other.hasStringValue) {
-    [self setStringValue:other.stringValue];
+  if (other->hasBits_[0] & 0x20u) {
+    [self setAggregateValue:other->aggregateValue];
   }
   [self mergeUnknownFields:other.unknownFields];
   return self;
@@ -5658,28 +10068,47 @@ static PBUninterpretedOption_NamePart* defaultPBUninterpretedOption_NamePartInst
   return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
 }
 - (PBUninterpretedOption_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  PBUnknownFieldSet_Builder* unknownFields = nil;
   while (YES) {
     int32_t tag = [input readTag];
     switch (tag) {
       case 0:
-        [self setUnknownFields:[unknownFields build]];
+        if (unknownFields != nil) {
+          [self setUnknownFields:[unknownFields build]];
+        }
         return self;
       default: {
-        if (![self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag]) {
-          [self setUnknownFields:[unknownFields build]];
+        if (PBWireFormatGetTagWireType(tag) == PBWireFormatEndGroup) {
+          if (unknownFields != nil) {
+            [self setUnknownFields:[unknownFields build]];
+          }
           return self;
         }
+        if (unknownFields == nil) {
+          unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+        }
+        [self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag];
         break;
       }
       case 18: {
-        PBUninterpretedOption_NamePart_Builder* subBuilder = [PBUninterpretedOption_NamePart builder];
-        [input readMessage:subBuilder extensionRegistry:extensionRegistry];
-        [self addName:[subBuilder buildPartial]];
+        PBUninterpretedOption_NamePart_Builder* subBuilder = [[PBUninterpretedOption_NamePart_Builder alloc] init];
+        @try {
+          [input readMessage:subBuilder extensionRegistry:extensionRegistry];
+          PBUninterpretedOption_NamePart* value = [subBuilder newBuildPartial];
+          [self addName:value];
+          [value release];
+        } @finally {
+          [subBuilder release];
+        }
         break;
       }
       case 26: {
-        [self setIdentifierValue:[input readString]];
+        NSString* value = [input newString];
+        [self setIdentifierValue:value];
+        [value release];
         break;
       }
       case 32: {
@@ -5695,119 +10124,983 @@ static PBUninterpretedOption_NamePart* defaultPBUninterpretedOption_NamePartInst
         break;
       }
       case 58: {
-        [self setStringValue:[input readData]];
+        NSData* value = [input newData];
+        [self setStringValue:value];
+        [value release];
+        break;
+      }
+      case 66: {
+        NSString* value = [input newString];
+        [self setAggregateValue:value];
+        [value release];
         break;
       }
     }
   }
 }
-- (NSArray*) nameList {
-  if (result.mutableNameList == nil) { return [NSArray array]; }
-  return result.mutableNameList;
+- (PBAppendableArray *)name {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return result->nameArray;
 }
-- (PBUninterpretedOption_NamePart*) nameAtIndex:(int32_t) index {
+- (PBUninterpretedOption_NamePart*)nameAtIndex:(NSUInteger)index {
   return [result nameAtIndex:index];
 }
-- (PBUninterpretedOption_Builder*) replaceNameAtIndex:(int32_t) index with:(PBUninterpretedOption_NamePart*) value {
-  [result.mutableNameList replaceObjectAtIndex:index withObject:value];
+- (PBUninterpretedOption_Builder *)addName:(PBUninterpretedOption_NamePart*)value {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (result->nameArray == nil) {
+    result.nameArray = [PBObjectArray array];
+  }
+  PBObjectArrayAddValue(result->nameArray, value);
   return self;
 }
-- (PBUninterpretedOption_Builder*) addAllName:(NSArray*) values {
-  if (result.mutableNameList == nil) {
-    result.mutableNameList = [NSMutableArray array];
+- (PBUninterpretedOption_Builder *)setNameArray:(NSArray *)array {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  [result.mutableNameList addObjectsFromArray:values];
+  result.nameArray = [PBObjectArray arrayWithArray:array valueType:PBArrayValueTypeObject];
   return self;
 }
-- (PBUninterpretedOption_Builder*) clearNameList {
-  result.mutableNameList = nil;
+- (PBUninterpretedOption_Builder *)setNameValues:(const PBUninterpretedOption_NamePart* *)values count:(NSUInteger)count {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.nameArray = [PBObjectArray arrayWithValues:values count:count valueType:PBArrayValueTypeObject];
   return self;
 }
-- (PBUninterpretedOption_Builder*) addName:(PBUninterpretedOption_NamePart*) value {
-  if (result.mutableNameList == nil) {
-    result.mutableNameList = [NSMutableArray array];
+- (PBUninterpretedOption_Builder *)clearName {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  [result.mutableNameList addObject:value];
+  result.nameArray = nil;
   return self;
 }
 - (BOOL) hasIdentifierValue {
-  return result.hasIdentifierValue;
+  return (result->hasBits_[0] & 0x1u) != 0;
 }
 - (NSString*) identifierValue {
-  return result.identifierValue;
+  return [result identifierValue];
 }
 - (PBUninterpretedOption_Builder*) setIdentifierValue:(NSString*) value {
-  result.hasIdentifierValue = YES;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x1u;
   result.identifierValue = value;
   return self;
 }
 - (PBUninterpretedOption_Builder*) clearIdentifierValue {
-  result.hasIdentifierValue = NO;
-  result.identifierValue = @"";
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x1u;
+  [result->identifierValue release];
+  result->identifierValue = nil;
   return self;
 }
 - (BOOL) hasPositiveIntValue {
-  return result.hasPositiveIntValue;
+  return (result->hasBits_[0] & 0x2u) != 0;
 }
-- (int64_t) positiveIntValue {
-  return result.positiveIntValue;
+- (uint64_t) positiveIntValue {
+  return result->positiveIntValue;
 }
-- (PBUninterpretedOption_Builder*) setPositiveIntValue:(int64_t) value {
-  result.hasPositiveIntValue = YES;
-  result.positiveIntValue = value;
+- (PBUninterpretedOption_Builder*) setPositiveIntValue:(uint64_t) value {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x2u;
+  result->positiveIntValue = value;
   return self;
 }
 - (PBUninterpretedOption_Builder*) clearPositiveIntValue {
-  result.hasPositiveIntValue = NO;
-  result.positiveIntValue = 0L;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x2u;
+  result->positiveIntValue = 0;
   return self;
 }
 - (BOOL) hasNegativeIntValue {
-  return result.hasNegativeIntValue;
+  return (result->hasBits_[0] & 0x4u) != 0;
 }
 - (int64_t) negativeIntValue {
-  return result.negativeIntValue;
+  return result->negativeIntValue;
 }
 - (PBUninterpretedOption_Builder*) setNegativeIntValue:(int64_t) value {
-  result.hasNegativeIntValue = YES;
-  result.negativeIntValue = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x4u;
+  result->negativeIntValue = value;
   return self;
 }
 - (PBUninterpretedOption_Builder*) clearNegativeIntValue {
-  result.hasNegativeIntValue = NO;
-  result.negativeIntValue = 0L;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x4u;
+  result->negativeIntValue = 0;
   return self;
 }
 - (BOOL) hasDoubleValue {
-  return result.hasDoubleValue;
+  return (result->hasBits_[0] & 0x8u) != 0;
 }
 - (Float64) doubleValue {
-  return result.doubleValue;
+  return result->doubleValue;
 }
 - (PBUninterpretedOption_Builder*) setDoubleValue:(Float64) value {
-  result.hasDoubleValue = YES;
-  result.doubleValue = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x8u;
+  result->doubleValue = value;
   return self;
 }
 - (PBUninterpretedOption_Builder*) clearDoubleValue {
-  result.hasDoubleValue = NO;
-  result.doubleValue = 0;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x8u;
+  result->doubleValue = 0;
   return self;
 }
 - (BOOL) hasStringValue {
-  return result.hasStringValue;
+  return (result->hasBits_[0] & 0x10u) != 0;
 }
 - (NSData*) stringValue {
-  return result.stringValue;
+  return [result stringValue];
 }
 - (PBUninterpretedOption_Builder*) setStringValue:(NSData*) value {
-  result.hasStringValue = YES;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x10u;
   result.stringValue = value;
   return self;
 }
 - (PBUninterpretedOption_Builder*) clearStringValue {
-  result.hasStringValue = NO;
-  result.stringValue = [NSData data];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x10u;
+  [result->stringValue release];
+  result->stringValue = nil;
+  return self;
+}
+- (BOOL) hasAggregateValue {
+  return (result->hasBits_[0] & 0x20u) != 0;
+}
+- (NSString*) aggregateValue {
+  return [result aggregateValue];
+}
+- (PBUninterpretedOption_Builder*) setAggregateValue:(NSString*) value {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x20u;
+  result.aggregateValue = value;
+  return self;
+}
+- (PBUninterpretedOption_Builder*) clearAggregateValue {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x20u;
+  [result->aggregateValue release];
+  result->aggregateValue = nil;
+  return self;
+}
+@end
+
+@interface PBSourceCodeInfo ()
+@property (nonatomic, retain) PBObjectArray * locationArray;
+@end
+
+@interface PBSourceCodeInfo_Builder()
+@property (nonatomic, retain) PBSourceCodeInfo* result;
+- (id) initWithPrototype:(PBSourceCodeInfo*) prototype;
+- (void) detachFromPrototype;
+@end
+
+@implementation PBSourceCodeInfo
+
+@synthesize locationArray;
+@dynamic location;
+- (void) dealloc {
+  [locationArray release];
+  [super dealloc];
+}
+- (void) clearForReuse {
+  [super clearForReuse];
+  memset(hasBits_, 0, sizeof(hasBits_));
+  locationArray = PBAppendableArrayReuse(locationArray);
+}
+static PBSourceCodeInfo* defaultPBSourceCodeInfoInstance = nil;
++ (PBSourceCodeInfo*) defaultInstance {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultPBSourceCodeInfoInstance = [[PBSourceCodeInfo alloc] init];
+  });
+  return defaultPBSourceCodeInfoInstance;
+}
+- (PBSourceCodeInfo*) defaultInstance {
+  return [PBSourceCodeInfo defaultInstance];
+}
+- (PBArray *)location {
+  return locationArray;
+}
+- (PBSourceCodeInfo_Location*)locationAtIndex:(NSUInteger)index {
+  return PBObjectArrayValueAtIndex(locationArray, index);
+}
+- (BOOL) isInitialized {
+  return YES;
+}
+- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output {
+  for (PBSourceCodeInfo_Location *element in locationArray) {
+    [output writeMessage:1 value:element];
+  }
+  [self.unknownFields writeToCodedOutputStream:output];
+}
+- (int32_t) serializedSize {
+  int32_t size_ = PBGeneratedMessageGetMemoizedSize(&memoizedSerializedSize);
+  if (size_ != -1) {
+    return size_;
+  }
+
+  size_ = 0;
+  for (PBSourceCodeInfo_Location *element in locationArray) {
+    size_ += computeMessageSize(1, element);
+  }
+  size_ += self.unknownFields.serializedSize;
+  PBGeneratedMessageSetMemoizedSize(&memoizedSerializedSize, size_);
+  return size_;
+}
++ (PBSourceCodeInfo*) parseFromData:(NSData*) data {
+  return (PBSourceCodeInfo*)[[[PBSourceCodeInfo builder] mergeFromData:data] build];
+}
++ (PBSourceCodeInfo*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
+  return (PBSourceCodeInfo*)[[[PBSourceCodeInfo builder] mergeFromData:data extensionRegistry:extensionRegistry] build];
+}
++ (PBSourceCodeInfo*) parseFromInputStream:(NSInputStream*) input {
+  return (PBSourceCodeInfo*)[[[PBSourceCodeInfo builder] mergeFromInputStream:input] build];
+}
++ (PBSourceCodeInfo*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
+  return (PBSourceCodeInfo*)[[[PBSourceCodeInfo builder] mergeFromInputStream:input extensionRegistry:extensionRegistry] build];
+}
++ (PBSourceCodeInfo*) parseFromCodedInputStream:(PBCodedInputStream*) input {
+  return (PBSourceCodeInfo*)[[[PBSourceCodeInfo builder] mergeFromCodedInputStream:input] build];
+}
++ (PBSourceCodeInfo*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
+  return (PBSourceCodeInfo*)[[[PBSourceCodeInfo builder] mergeFromCodedInputStream:input extensionRegistry:extensionRegistry] build];
+}
++ (PBSourceCodeInfo_Builder*) builder {
+  return [[[PBSourceCodeInfo_Builder alloc] init] autorelease];
+}
++ (PBSourceCodeInfo_Builder*) builderWithPrototype:(PBSourceCodeInfo*) prototype {
+  return [[[PBSourceCodeInfo_Builder alloc] initWithPrototype:prototype] autorelease];
+}
+- (PBSourceCodeInfo_Builder*) builder {
+  return [PBSourceCodeInfo builder];
+}
+- (PBSourceCodeInfo_Builder*) toBuilder {
+  return [PBSourceCodeInfo builderWithPrototype:self];
+}
+- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
+  for (PBSourceCodeInfo_Location* element in locationArray) {
+    [output appendFormat:@"%@%@ {\n", indent, @"location"];
+    [element writeDescriptionTo:output
+                     withIndent:[NSString stringWithFormat:@"%@  ", indent]];
+    [output appendFormat:@"%@}\n", indent];
+  }
+  [self.unknownFields writeDescriptionTo:output withIndent:indent];
+}
+- (BOOL) isEqual:(id)other {
+  if (other == self) {
+    return YES;
+  }
+  if (![other isKindOfClass:[PBSourceCodeInfo class]]) {
+    return NO;
+  }
+  PBSourceCodeInfo *otherMessage = other;
+  return
+      (locationArray.count == 0 ? otherMessage->locationArray.count == 0 : [locationArray isEqualToArray:otherMessage->locationArray]) &&
+      (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
+}
+- (NSUInteger) hash {
+  NSUInteger hash_ = PBGeneratedMessageGetMemoizedHash(&memoizedHash);
+  if (hash_ != 0) {
+    return hash_;
+  }
+
+  uint64_t hashCode = 7;
+  for (PBSourceCodeInfo_Location* element in locationArray) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [element hash]);
+  }
+  hashCode = PBGeneratedMessageHashMix(hashCode, [self.unknownFields hash]);
+  hash_ = PBGeneratedMessageHashFinish(hashCode);
+  PBGeneratedMessageSetMemoizedHash(&memoizedHash, hash_);
+  return hash_;
+}
+@end
+
+@interface PBSourceCodeInfo_Location ()
+@property (nonatomic, retain) PBInt32Array * pathArray;
+@property (nonatomic, retain) PBInt32Array * spanArray;
+@end
+
+@interface PBSourceCodeInfo_Location_Builder()
+@property (nonatomic, retain) PBSourceCodeInfo_Location* result;
+- (id) initWithPrototype:(PBSourceCodeInfo_Location*) prototype;
+- (void) detachFromPrototype;
+@end
+
+@implementation PBSourceCodeInfo_Location
+
+@synthesize pathArray;
+@dynamic path;
+@synthesize spanArray;
+@dynamic span;
+- (void) dealloc {
+  [pathArray release];
+  [spanArray release];
+  [super dealloc];
+}
+- (void) clearForReuse {
+  [super clearForReuse];
+  memset(hasBits_, 0, sizeof(hasBits_));
+  pathArray = PBAppendableArrayReuse(pathArray);
+  spanArray = PBAppendableArrayReuse(spanArray);
+}
+static PBSourceCodeInfo_Location* defaultPBSourceCodeInfo_LocationInstance = nil;
++ (PBSourceCodeInfo_Location*) defaultInstance {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultPBSourceCodeInfo_LocationInstance = [[PBSourceCodeInfo_Location alloc] init];
+  });
+  return defaultPBSourceCodeInfo_LocationInstance;
+}
+- (PBSourceCodeInfo_Location*) defaultInstance {
+  return [PBSourceCodeInfo_Location defaultInstance];
+}
+- (PBArray *)path {
+  return pathArray;
+}
+- (int32_t)pathAtIndex:(NSUInteger)index {
+  return PBInt32ArrayValueAtIndex(pathArray, index);
+}
+- (PBArray *)span {
+  return spanArray;
+}
+- (int32_t)spanAtIndex:(NSUInteger)index {
+  return PBInt32ArrayValueAtIndex(spanArray, index);
+}
+- (BOOL) isInitialized {
+  return YES;
+}
+- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output {
+  [self serializedSize];
+  const NSUInteger pathArrayCount = pathArray.count;
+  if (pathArrayCount > 0) {
+    const int32_t *values = (const int32_t *)pathArray.data;
+    [output writeRawVarint32:10];
+    [output writeRawVarint32:PBGeneratedMessageGetMemoizedSize(&pathMemoizedSerializedSize)];
+    for (NSUInteger i = 0; i < pathArrayCount; ++i) {
+      [output writeInt32NoTag:values[i]];
+    }
+  }
+  const NSUInteger spanArrayCount = spanArray.count;
+  if (spanArrayCount > 0) {
+    const int32_t *values = (const int32_t *)spanArray.data;
+    [output writeRawVarint32:18];
+    [output writeRawVarint32:PBGeneratedMessageGetMemoizedSize(&spanMemoizedSerializedSize)];
+    for (NSUInteger i = 0; i < spanArrayCount; ++i) {
+      [output writeInt32NoTag:values[i]];
+    }
+  }
+  [self.unknownFields writeToCodedOutputStream:output];
+}
+- (int32_t) serializedSize {
+  int32_t size_ = PBGeneratedMessageGetMemoizedSize(&memoizedSerializedSize);
+  if (size_ != -1) {
+    return size_;
+  }
+
+  size_ = 0;
+  {
+    int32_t dataSize = 0;
+    const NSUInteger count = pathArray.count;
+    const int32_t *values = (const int32_t *)pathArray.data;
+    for (NSUInteger i = 0; i < count; ++i) {
+      dataSize += computeInt32SizeNoTag(values[i]);
+    }
+    size_ += dataSize;
+    if (count > 0) {
+      size_ += 1;
+      size_ += computeInt32SizeNoTag(dataSize);
+    }
+    PBGeneratedMessageSetMemoizedSize(&pathMemoizedSerializedSize, dataSize);
+  }
+  {
+    int32_t dataSize = 0;
+    const NSUInteger count = spanArray.count;
+    const int32_t *values = (const int32_t *)spanArray.data;
+    for (NSUInteger i = 0; i < count; ++i) {
+      dataSize += computeInt32SizeNoTag(values[i]);
+    }
+    size_ += dataSize;
+    if (count > 0) {
+      size_ += 1;
+      size_ += computeInt32SizeNoTag(dataSize);
+    }
+    PBGeneratedMessageSetMemoizedSize(&spanMemoizedSerializedSize, dataSize);
+  }
+  size_ += self.unknownFields.serializedSize;
+  PBGeneratedMessageSetMemoizedSize(&memoizedSerializedSize, size_);
+  return size_;
+}
++ (PBSourceCodeInfo_Location*) parseFromData:(NSData*) data {
+  return (PBSourceCodeInfo_Location*)[[[PBSourceCodeInfo_Location builder] mergeFromData:data] build];
+}
++ (PBSourceCodeInfo_Location*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
+  return (PBSourceCodeInfo_Location*)[[[PBSourceCodeInfo_Location builder] mergeFromData:data extensionRegistry:extensionRegistry] build];
+}
++ (PBSourceCodeInfo_Location*) parseFromInputStream:(NSInputStream*) input {
+  return (PBSourceCodeInfo_Location*)[[[PBSourceCodeInfo_Location builder] mergeFromInputStream:input] build];
+}
++ (PBSourceCodeInfo_Location*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
+  return (PBSourceCodeInfo_Location*)[[[PBSourceCodeInfo_Location builder] mergeFromInputStream:input extensionRegistry:extensionRegistry] build];
+}
++ (PBSourceCodeInfo_Location*) parseFromCodedInputStream:(PBCodedInputStream*) input {
+  return (PBSourceCodeInfo_Location*)[[[PBSourceCodeInfo_Location builder] mergeFromCodedInputStream:input] build];
+}
++ (PBSourceCodeInfo_Location*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
+  return (PBSourceCodeInfo_Location*)[[[PBSourceCodeInfo_Location builder] mergeFromCodedInputStream:input extensionRegistry:extensionRegistry] build];
+}
++ (PBSourceCodeInfo_Location_Builder*) builder {
+  return [[[PBSourceCodeInfo_Location_Builder alloc] init] autorelease];
+}
++ (PBSourceCodeInfo_Location_Builder*) builderWithPrototype:(PBSourceCodeInfo_Location*) prototype {
+  return [[[PBSourceCodeInfo_Location_Builder alloc] initWithPrototype:prototype] autorelease];
+}
+- (PBSourceCodeInfo_Location_Builder*) builder {
+  return [PBSourceCodeInfo_Location builder];
+}
+- (PBSourceCodeInfo_Location_Builder*) toBuilder {
+  return [PBSourceCodeInfo_Location builderWithPrototype:self];
+}
+- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
+  [pathArray enumerateInt32sUsingBlock:^(int32_t value, NSUInteger idx, BOOL *stop) {
+    [output appendFormat:@"%@%@: %d\n", indent, @"path", value];
+  }];
+  [spanArray enumerateInt32sUsingBlock:^(int32_t value, NSUInteger idx, BOOL *stop) {
+    [output appendFormat:@"%@%@: %d\n", indent, @"span", value];
+  }];
+  [self.unknownFields writeDescriptionTo:output withIndent:indent];
+}
+- (BOOL) isEqual:(id)other {
+  if (other == self) {
+    return YES;
+  }
+  if (![other isKindOfClass:[PBSourceCodeInfo_Location class]]) {
+    return NO;
+  }
+  PBSourceCodeInfo_Location *otherMessage = other;
+  return
+      (pathArray.count == 0 ? otherMessage->pathArray.count == 0 : [pathArray isEqualToArray:otherMessage->pathArray]) &&
+      (spanArray.count == 0 ? otherMessage->spanArray.count == 0 : [spanArray isEqualToArray:otherMessage->spanArray]) &&
+      (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
+}
+- (NSUInteger) hash {
+  NSUInteger hash_ = PBGeneratedMessageGetMemoizedHash(&memoizedHash);
+  if (hash_ != 0) {
+    return hash_;
+  }
+
+  uint64_t hashCode = 7;
+  hashCode = PBGeneratedMessageHashMix(hashCode, [pathArray hash64]);
+  hashCode = PBGeneratedMessageHashMix(hashCode, [spanArray hash64]);
+  hashCode = PBGeneratedMessageHashMix(hashCode, [self.unknownFields hash]);
+  hash_ = PBGeneratedMessageHashFinish(hashCode);
+  PBGeneratedMessageSetMemoizedHash(&memoizedHash, hash_);
+  return hash_;
+}
+@end
+
+@implementation PBSourceCodeInfo_Location_Builder
+@synthesize result;
+- (void) dealloc {
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
+  self.result = nil;
+  [prototype_ release];
+  [super dealloc];
+}
+- (id) init {
+  if ((self = [super init])) {
+    result = [PBSourceCodeInfo_Location recycledInstance];
+  }
+  return self;
+}
+- (id) initWithPrototype:(PBSourceCodeInfo_Location*) prototype {
+  if ((self = [super init])) {
+    self.result = prototype;
+    prototype_ = [prototype retain];
+  }
+  return self;
+}
+- (void) detachFromPrototype {
+  PBSourceCodeInfo_Location* prototype = prototype_;
+  prototype_ = nil;
+  self.result = [[[PBSourceCodeInfo_Location alloc] init] autorelease];
+  [self mergeFrom:prototype];
+  [prototype release];
+}
+- (PBGeneratedMessage*) internalGetMutableResult {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return [self internalGetResult];
+}
+- (PBGeneratedMessage*) internalGetResult {
+  return result;
+}
+- (PBSourceCodeInfo_Location_Builder*) clear {
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = [[PBSourceCodeInfo_Location recycledInstance] autorelease];
+  return self;
+}
+- (PBSourceCodeInfo_Location_Builder*) clone {
+  if (prototype_ != nil) {
+    return [[[PBSourceCodeInfo_Location_Builder alloc] initWithPrototype:prototype_] autorelease];
+  }
+  return [[PBSourceCodeInfo_Location builder] mergeFrom:result];
+}
+- (PBSourceCodeInfo_Location_Builder*) reset {
+  if (result == nil || prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    self.result = [[PBSourceCodeInfo_Location recycledInstance] autorelease];
+  } else {
+    [result clearForReuse];
+  }
+  return self;
+}
+- (PBSourceCodeInfo_Location_Builder*) recycle:(PBSourceCodeInfo_Location*) message {
+  if (message == [PBSourceCodeInfo_Location defaultInstance]) {
+    @throw [NSException exceptionWithName:@"IllegalArgument" reason:@"Cannot recycle the default instance" userInfo:nil];
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = message;
+  return [self reset];
+}
+- (PBSourceCodeInfo_Location*) defaultInstance {
+  return [PBSourceCodeInfo_Location defaultInstance];
+}
+- (PBSourceCodeInfo_Location*) build {
+  [self checkInitialized];
+  return [self buildPartial];
+}
+- (PBSourceCodeInfo_Location*) buildPartial {
+  return [[self newBuildPartial] autorelease];
+}
+- (PBSourceCodeInfo_Location*) newBuildPartial {
+  if (prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    PBSourceCodeInfo_Location* returnMe = result;
+    result = nil;
+    return returnMe;
+  }
+  [result->pathArray shrinkToFit];
+  [result->spanArray shrinkToFit];
+  PBSourceCodeInfo_Location* returnMe = result;
+  result = nil;
+  return returnMe;
+}
+- (PBSourceCodeInfo_Location_Builder*) mergeFrom:(PBSourceCodeInfo_Location*) other {
+  if (other == [PBSourceCodeInfo_Location defaultInstance]) {
+    return self;
+  }
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (other->pathArray.count > 0) {
+    if (result->pathArray == nil) {
+      result.pathArray = [[other->pathArray copyWithZone:[other->pathArray zone]] autorelease];
+    } else {
+      [result->pathArray appendArray:other->pathArray];
+    }
+  }
+  if (other->spanArray.count > 0) {
+    if (result->spanArray == nil) {
+      result.spanArray = [[other->spanArray copyWithZone:[other->spanArray zone]] autorelease];
+    } else {
+      [result->spanArray appendArray:other->spanArray];
+    }
+  }
+  [self mergeUnknownFields:other.unknownFields];
+  return self;
+}
+- (PBSourceCodeInfo_Location_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input {
+  return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
+}
+- (PBSourceCodeInfo_Location_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  PBUnknownFieldSet_Builder* unknownFields = nil;
+  while (YES) {
+    int32_t tag = [input readTag];
+    switch (tag) {
+      case 0:
+        if (unknownFields != nil) {
+          [self setUnknownFields:[unknownFields build]];
+        }
+        return self;
+      default: {
+        if (PBWireFormatGetTagWireType(tag) == PBWireFormatEndGroup) {
+          if (unknownFields != nil) {
+            [self setUnknownFields:[unknownFields build]];
+          }
+          return self;
+        }
+        if (unknownFields == nil) {
+          unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+        }
+        [self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag];
+        break;
+      }
+      case 10: {
+        int32_t length = [input readRawVarint32];
+        int32_t limit = [input pushLimit:length];
+        if (result->pathArray == nil) {
+          result.pathArray = [PBInt32Array array];
+        }
+        PBInt32Array *values = result->pathArray;
+        [values reserveCapacity:values.count + input.bytesBufferedUntilLimit inArena:input.arena];
+        while (input.bytesUntilLimit > 0) {
+          PBInt32ArrayAddValue(values, [input readInt32]);
+        }
+        [input popLimit:limit];
+        break;
+      }
+      case 18: {
+        int32_t length = [input readRawVarint32];
+        int32_t limit = [input pushLimit:length];
+        if (result->spanArray == nil) {
+          result.spanArray = [PBInt32Array array];
+        }
+        PBInt32Array *values = result->spanArray;
+        [values reserveCapacity:values.count + input.bytesBufferedUntilLimit inArena:input.arena];
+        while (input.bytesUntilLimit > 0) {
+          PBInt32ArrayAddValue(values, [input readInt32]);
+        }
+        [input popLimit:limit];
+        break;
+      }
+    }
+  }
+}
+- (PBAppendableArray *)path {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return result->pathArray;
+}
+- (int32_t)pathAtIndex:(NSUInteger)index {
+  return [result pathAtIndex:index];
+}
+- (PBSourceCodeInfo_Location_Builder *)addPath:(int32_t)value {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (result->pathArray == nil) {
+    result.pathArray = [PBInt32Array array];
+  }
+  PBInt32ArrayAddValue(result->pathArray, value);
+  return self;
+}
+- (PBSourceCodeInfo_Location_Builder *)setPathArray:(NSArray *)array {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.pathArray = [PBInt32Array arrayWithArray:array valueType:PBArrayValueTypeInt32];
+  return self;
+}
+- (PBSourceCodeInfo_Location_Builder *)setPath:(PBArray *)array {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.pathArray = array ? [PBInt32Array arrayWithStorageOfArray:array] : nil;
+  return self;
+}
+- (PBSourceCodeInfo_Location_Builder *)setPathValues:(const int32_t *)values count:(NSUInteger)count {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.pathArray = [PBInt32Array arrayWithValues:values count:count valueType:PBArrayValueTypeInt32];
+  return self;
+}
+- (PBSourceCodeInfo_Location_Builder *)clearPath {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.pathArray = nil;
+  return self;
+}
+- (PBAppendableArray *)span {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return result->spanArray;
+}
+- (int32_t)spanAtIndex:(NSUInteger)index {
+  return [result spanAtIndex:index];
+}
+- (PBSourceCodeInfo_Location_Builder *)addSpan:(int32_t)value {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (result->spanArray == nil) {
+    result.spanArray = [PBInt32Array array];
+  }
+  PBInt32ArrayAddValue(result->spanArray, value);
+  return self;
+}
+- (PBSourceCodeInfo_Location_Builder *)setSpanArray:(NSArray *)array {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.spanArray = [PBInt32Array arrayWithArray:array valueType:PBArrayValueTypeInt32];
+  return self;
+}
+- (PBSourceCodeInfo_Location_Builder *)setSpan:(PBArray *)array {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.spanArray = array ? [PBInt32Array arrayWithStorageOfArray:array] : nil;
+  return self;
+}
+- (PBSourceCodeInfo_Location_Builder *)setSpanValues:(const int32_t *)values count:(NSUInteger)count {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.spanArray = [PBInt32Array arrayWithValues:values count:count valueType:PBArrayValueTypeInt32];
+  return self;
+}
+- (PBSourceCodeInfo_Location_Builder *)clearSpan {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.spanArray = nil;
+  return self;
+}
+@end
+
+@implementation PBSourceCodeInfo_Builder
+@synthesize result;
+- (void) dealloc {
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
+  self.result = nil;
+  [prototype_ release];
+  [super dealloc];
+}
+- (id) init {
+  if ((self = [super init])) {
+    result = [PBSourceCodeInfo recycledInstance];
+  }
+  return self;
+}
+- (id) initWithPrototype:(PBSourceCodeInfo*) prototype {
+  if ((self = [super init])) {
+    self.result = prototype;
+    prototype_ = [prototype retain];
+  }
+  return self;
+}
+- (void) detachFromPrototype {
+  PBSourceCodeInfo* prototype = prototype_;
+  prototype_ = nil;
+  self.result = [[[PBSourceCodeInfo alloc] init] autorelease];
+  [self mergeFrom:prototype];
+  [prototype release];
+}
+- (PBGeneratedMessage*) internalGetMutableResult {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return [self internalGetResult];
+}
+- (PBGeneratedMessage*) internalGetResult {
+  return result;
+}
+- (PBSourceCodeInfo_Builder*) clear {
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = [[PBSourceCodeInfo recycledInstance] autorelease];
+  return self;
+}
+- (PBSourceCodeInfo_Builder*) clone {
+  if (prototype_ != nil) {
+    return [[[PBSourceCodeInfo_Builder alloc] initWithPrototype:prototype_] autorelease];
+  }
+  return [[PBSourceCodeInfo builder] mergeFrom:result];
+}
+- (PBSourceCodeInfo_Builder*) reset {
+  if (result == nil || prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    self.result = [[PBSourceCodeInfo recycledInstance] autorelease];
+  } else {
+    [result clearForReuse];
+  }
+  return self;
+}
+- (PBSourceCodeInfo_Builder*) recycle:(PBSourceCodeInfo*) message {
+  if (message == [PBSourceCodeInfo defaultInstance]) {
+    @throw [NSException exceptionWithName:@"IllegalArgument" reason:@"Cannot recycle the default instance" userInfo:nil];
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = message;
+  return [self reset];
+}
+- (PBSourceCodeInfo*) defaultInstance {
+  return [PBSourceCodeInfo defaultInstance];
+}
+- (PBSourceCodeInfo*) build {
+  [self checkInitialized];
+  return [self buildPartial];
+}
+- (PBSourceCodeInfo*) buildPartial {
+  return [[self newBuildPartial] autorelease];
+}
+- (PBSourceCodeInfo*) newBuildPartial {
+  if (prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    PBSourceCodeInfo* returnMe = result;
+    result = nil;
+    return returnMe;
+  }
+  [result->locationArray shrinkToFit];
+  PBSourceCodeInfo* returnMe = result;
+  result = nil;
+  return returnMe;
+}
+- (PBSourceCodeInfo_Builder*) mergeFrom:(PBSourceCodeInfo*) other {
+  if (other == [PBSourceCodeInfo defaultInstance]) {
+    return self;
+  }
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (other->locationArray.count > 0) {
+    if (result->locationArray == nil) {
+      result.locationArray = [[other->locationArray copyWithZone:[other->locationArray zone]] autorelease];
+    } else {
+      [result->locationArray appendArray:other->locationArray];
+    }
+  }
+  [self mergeUnknownFields:other.unknownFields];
+  return self;
+}
+- (PBSourceCodeInfo_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input {
+  return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
+}
+- (PBSourceCodeInfo_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  PBUnknownFieldSet_Builder* unknownFields = nil;
+  while (YES) {
+    int32_t tag = [input readTag];
+    switch (tag) {
+      case 0:
+        if (unknownFields != nil) {
+          [self setUnknownFields:[unknownFields build]];
+        }
+        return self;
+      default: {
+        if (PBWireFormatGetTagWireType(tag) == PBWireFormatEndGroup) {
+          if (unknownFields != nil) {
+            [self setUnknownFields:[unknownFields build]];
+          }
+          return self;
+        }
+        if (unknownFields == nil) {
+          unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+        }
+        [self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag];
+        break;
+      }
+      case 10: {
+        PBSourceCodeInfo_Location_Builder* subBuilder = [[PBSourceCodeInfo_Location_Builder alloc] init];
+        @try {
+          [input readMessage:subBuilder extensionRegistry:extensionRegistry];
+          PBSourceCodeInfo_Location* value = [subBuilder newBuildPartial];
+          [self addLocation:value];
+          [value release];
+        } @finally {
+          [subBuilder release];
+        }
+        break;
+      }
+    }
+  }
+}
+- (PBAppendableArray *)location {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return result->locationArray;
+}
+- (PBSourceCodeInfo_Location*)locationAtIndex:(NSUInteger)index {
+  return [result locationAtIndex:index];
+}
+- (PBSourceCodeInfo_Builder *)addLocation:(PBSourceCodeInfo_Location*)value {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (result->locationArray == nil) {
+    result.locationArray = [PBObjectArray array];
+  }
+  PBObjectArrayAddValue(result->locationArray, value);
+  return self;
+}
+- (PBSourceCodeInfo_Builder *)setLocationArray:(NSArray *)array {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.locationArray = [PBObjectArray arrayWithArray:array valueType:PBArrayValueTypeObject];
+  return self;
+}
+- (PBSourceCodeInfo_Builder *)setLocationValues:(const PBSourceCodeInfo_Location* *)values count:(NSUInteger)count {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.locationArray = [PBObjectArray arrayWithValues:values count:count valueType:PBArrayValueTypeObject];
+  return self;
+}
+- (PBSourceCodeInfo_Builder *)clearLocation {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.locationArray = nil;
   return self;
 }
 @end
@@ -31,6 +31,26 @@
 }
 
 
+- (void) clearForReuse {
+  [super clearForReuse];
+  [extensionMap removeAllObjects];
+}
+
+
+/** Extension values are frozen along with the message. */
+- (void) freeze {
+  [super freeze];
+  for (id value in extensionMap.objectEnumerator) {
+    NSArray* values = [value isKindOfClass:[NSArray class]] ? value : [NSArray arrayWithObject:value];
+    for (id element in values) {
+      if ([element isKindOfClass:[PBGeneratedMessage class]]) {
+        [element freeze];
+      }
+    }
+  }
+}
+
+
 - (BOOL) isInitialized:(id) object {
   if ([object isKindOfClass:[NSArray class]]) {
     for (id child in object) {
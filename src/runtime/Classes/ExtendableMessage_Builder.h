@@ -73,6 +73,7 @@
 - (PBExtendableMessage_Builder*) clearExtension:(id<PBExtensionField>) extension;
 
 /* @protected */
+- (PBExtendableMessage*) internalGetMutableResult;
 - (void) mergeExtensionFields:(PBExtendableMessage*) other;
 
 @end
@@ -28,6 +28,11 @@
 }
 
 
+- (PBExtendableMessage*) internalGetMutableResult {
+  return [self internalGetResult];
+}
+
+
 /**
  * Called by subclasses to parse an unknown field or an extension.
  * @return {@code YES} unless the tag is an end-group tag.
@@ -70,7 +75,7 @@
 
 - (PBExtendableMessage_Builder*) setExtension:(id<PBExtensionField>) extension
                                         value:(id) value {
-  PBExtendableMessage* message = [self internalGetResult];
+  PBExtendableMessage* message = [self internalGetMutableResult];
   [message ensureExtensionIsRegistered:extension];
 
   if ([extension isRepeated]) {
@@ -87,7 +92,7 @@
 
 - (PBExtendableMessage_Builder*) addExtension:(id<PBExtensionField>) extension
                                         value:(id) value {
-  PBExtendableMessage* message = [self internalGetResult];
+  PBExtendableMessage* message = [self internalGetMutableResult];
   [message ensureExtensionIsRegistered:extension];
 
   if (![extension isRepeated]) {
@@ -112,7 +117,7 @@
 - (PBExtendableMessage_Builder*) setExtension:(id<PBExtensionField>) extension
                                         index:(int32_t) index
                                         value:(id) value {
-  PBExtendableMessage* message = [self internalGetResult];
+  PBExtendableMessage* message = [self internalGetMutableResult];
   [message ensureExtensionIsRegistered:extension];
 
   if (![extension isRepeated]) {
@@ -133,7 +138,7 @@
 
 
 - (PBExtendableMessage_Builder*) clearExtension:(id<PBExtensionField>) extension {
-  PBExtendableMessage* message = [self internalGetResult];
+  PBExtendableMessage* message = [self internalGetMutableResult];
   [message ensureExtensionIsRegistered:extension];
   [message.extensionMap removeObjectForKey:[NSNumber numberWithInt:[extension fieldNumber]]];
 
@@ -142,7 +147,7 @@
 
 
 - (void) mergeExtensionFields:(PBExtendableMessage*) other {
-  PBExtendableMessage* thisMessage = [self internalGetResult];
+  PBExtendableMessage* thisMessage = [self internalGetMutableResult];
   if ([thisMessage class] != [other class]) {
     @throw [NSException exceptionWithName:@"IllegalArgument" reason:@"Cannot merge extensions from a different type" userInfo:nil];
   }
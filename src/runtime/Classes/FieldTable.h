@@ -0,0 +1,97 @@
+// Protocol Buffers for Objective C
+//
+// Copyright 2010 Booyah Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import "ConcreteExtensionField.h"
+
+@class PBCodedInputStream;
+@class PBCodedOutputStream;
+@class PBExtensionRegistry;
+@class PBGeneratedMessage;
+@class PBGeneratedMessage_Builder;
+
+enum {
+  PBFieldTableRepeated = 1 << 0,
+  PBFieldTablePacked = 1 << 1
+};
+
+/**
+ * One field of a message generated with {@code optimize_for = CODE_SIZE}.
+ * The generator fills in everything up to {@code isValidEnumValue}, and
+ * {@link PBFieldTableResolve} the rest.
+ */
+typedef struct PBFieldTableEntry {
+  int32_t number;
+  PBExtensionType type;
+  uint32_t flags;
+
+  /** The field's bit in the message's hasBits_, or -1 if it is repeated. */
+  int32_t hasBit;
+
+  /**
+   * The ivar holding the value, or the PBAppendableArray of values.
+   * Singular bools are a whole BOOL in these messages, not a bit field.
+   */
+  const char* ivarName;
+
+  /** The builder class of message and group fields. */
+  const char* builderClassName;
+
+  /** The generated IsValidValue function of enum fields. */
+  BOOL (*isValidEnumValue)(int32_t value);
+
+  ptrdiff_t offset;
+  Class builderClass;
+} PBFieldTableEntry;
+
+typedef struct PBFieldTable {
+  /** Sorted by field number. */
+  PBFieldTableEntry* entries;
+  uint32_t entryCount;
+
+  /** Start (inclusive) and end (exclusive) pairs, sorted. */
+  const int32_t* extensionRanges;
+  uint32_t extensionRangeCount;
+
+  ptrdiff_t hasBitsOffset;
+} PBFieldTable;
+
+/**
+ * Looks up the ivars and classes the table names.  Called once, from the
+ * message class's +initialize.
+ */
+void PBFieldTableResolve(PBFieldTable* table, Class messageClass);
+
+/**
+ * Generic versions of the methods that messages optimized for speed
+ * generate field by field.  The unknown fields, and the extensions apart
+ * from writing them in order, are left to the caller.  The hash is the
+ * unfinished state for {@code PBGeneratedMessageHashMix}.
+ */
+void PBFieldTableWriteTo(const PBFieldTable* table, PBGeneratedMessage* message, PBCodedOutputStream* output);
+int32_t PBFieldTableSerializedSize(const PBFieldTable* table, PBGeneratedMessage* message);
+BOOL PBFieldTableIsEqual(const PBFieldTable* table, PBGeneratedMessage* message, PBGeneratedMessage* other);
+uint64_t PBFieldTableHash(const PBFieldTable* table, PBGeneratedMessage* message);
+
+/**
+ * Parses fields into {@code result}, the message {@code builder} is
+ * building, up to the end of the input or of the enclosing group.  Unknown
+ * fields go to the builder.
+ */
+void PBFieldTableMergeFromCodedInputStream(const PBFieldTable* table,
+                                           PBGeneratedMessage_Builder* builder,
+                                           PBGeneratedMessage* result,
+                                           PBCodedInputStream* input,
+                                           PBExtensionRegistry* extensionRegistry);
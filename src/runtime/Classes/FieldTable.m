@@ -0,0 +1,597 @@
+// Protocol Buffers for Objective C
+//
+// Copyright 2010 Booyah Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import "FieldTable.h"
+
+#import <objc/runtime.h>
+
+#import "CodedInputStream.h"
+#import "CodedOutputStream.h"
+#import "ExtendableMessage.h"
+#import "GeneratedMessage.h"
+#import "GeneratedMessage_Builder.h"
+#import "Message_Builder.h"
+#import "PBArray.h"
+#import "UnknownFieldSet.h"
+#import "UnknownFieldSet_Builder.h"
+#import "Utilities.h"
+#import "WireFormat.h"
+
+/** The methods every generated builder has, whatever its message class. */
+@protocol PBFieldTableBuilder <PBMessage_Builder>
+- (id) mergeFrom:(id) other;
+- (id) newBuildPartial;
+@end
+
+typedef struct PBFieldTableParse {
+  uint8_t* base;
+  uint32_t* hasBits;
+  PBCodedInputStream* input;
+  PBExtensionRegistry* extensionRegistry;
+  PBGeneratedMessage_Builder* builder;
+  PBUnknownFieldSet_Builder* unknownFields;
+} PBFieldTableParse;
+
+
+static BOOL PBFieldTableIsObject(PBExtensionType type) {
+  switch (type) {
+    case PBExtensionTypeBytes:
+    case PBExtensionTypeString:
+    case PBExtensionTypeMessage:
+    case PBExtensionTypeGroup:
+      return YES;
+    default:
+      return NO;
+  }
+}
+
+
+/** The size of a value in an ivar, or in the storage of a PBArray. */
+static size_t PBFieldTableValueWidth(PBExtensionType type) {
+  switch (type) {
+    case PBExtensionTypeBool:
+      return sizeof(BOOL);
+    case PBExtensionTypeFixed64:
+    case PBExtensionTypeSFixed64:
+    case PBExtensionTypeDouble:
+    case PBExtensionTypeInt64:
+    case PBExtensionTypeSInt64:
+    case PBExtensionTypeUInt64:
+      return sizeof(int64_t);
+    case PBExtensionTypeBytes:
+    case PBExtensionTypeString:
+    case PBExtensionTypeMessage:
+    case PBExtensionTypeGroup:
+      return sizeof(id);
+    default:
+      return sizeof(int32_t);
+  }
+}
+
+
+static PBArrayValueType PBFieldTableArrayValueType(PBExtensionType type) {
+  switch (type) {
+    case PBExtensionTypeBool:     return PBArrayValueTypeBool;
+    case PBExtensionTypeFixed32:  return PBArrayValueTypeUInt32;
+    case PBExtensionTypeSFixed32: return PBArrayValueTypeInt32;
+    case PBExtensionTypeFloat:    return PBArrayValueTypeFloat;
+    case PBExtensionTypeFixed64:  return PBArrayValueTypeUInt64;
+    case PBExtensionTypeSFixed64: return PBArrayValueTypeInt64;
+    case PBExtensionTypeDouble:   return PBArrayValueTypeDouble;
+    case PBExtensionTypeInt32:    return PBArrayValueTypeInt32;
+    case PBExtensionTypeInt64:    return PBArrayValueTypeInt64;
+    case PBExtensionTypeSInt32:   return PBArrayValueTypeInt32;
+    case PBExtensionTypeSInt64:   return PBArrayValueTypeInt64;
+    case PBExtensionTypeUInt32:   return PBArrayValueTypeUInt32;
+    case PBExtensionTypeUInt64:   return PBArrayValueTypeUInt64;
+    case PBExtensionTypeEnum:     return PBArrayValueTypeInt32;
+    default:                      return PBArrayValueTypeObject;
+  }
+}
+
+
+static Class PBFieldTableArrayClass(PBArrayValueType valueType) {
+  switch (valueType) {
+    case PBArrayValueTypeBool:   return [PBBoolArray class];
+    case PBArrayValueTypeInt32:  return [PBInt32Array class];
+    case PBArrayValueTypeUInt32: return [PBUInt32Array class];
+    case PBArrayValueTypeInt64:  return [PBInt64Array class];
+    case PBArrayValueTypeUInt64: return [PBUInt64Array class];
+    case PBArrayValueTypeFloat:  return [PBFloatArray class];
+    case PBArrayValueTypeDouble: return [PBDoubleArray class];
+    default:                     return [PBObjectArray class];
+  }
+}
+
+
+static int32_t PBFieldTableWireType(const PBFieldTableEntry* entry) {
+  if (entry->flags & PBFieldTablePacked) {
+    return PBWireFormatLengthDelimited;
+  }
+
+  switch (entry->type) {
+    case PBExtensionTypeFixed32:
+    case PBExtensionTypeSFixed32:
+    case PBExtensionTypeFloat:
+      return PBWireFormatFixed32;
+    case PBExtensionTypeFixed64:
+    case PBExtensionTypeSFixed64:
+    case PBExtensionTypeDouble:
+      return PBWireFormatFixed64;
+    case PBExtensionTypeBytes:
+    case PBExtensionTypeString:
+    case PBExtensionTypeMessage:
+      return PBWireFormatLengthDelimited;
+    case PBExtensionTypeGroup:
+      return PBWireFormatStartGroup;
+    default:
+      return PBWireFormatVarint;
+  }
+}
+
+
+static BOOL PBFieldTableHasBit(const uint32_t* hasBits, int32_t index) {
+  return (hasBits[index / 32] & (1u << (index % 32))) != 0;
+}
+
+
+static void PBFieldTableSetHasBit(uint32_t* hasBits, int32_t index) {
+  hasBits[index / 32] |= 1u << (index % 32);
+}
+
+
+#pragma mark Resolving
+
+void PBFieldTableResolve(PBFieldTable* table, Class messageClass) {
+  table->hasBitsOffset = ivar_getOffset(class_getInstanceVariable(messageClass, "hasBits_"));
+
+  for (uint32_t i = 0; i < table->entryCount; ++i) {
+    PBFieldTableEntry* entry = &table->entries[i];
+    Ivar ivar = class_getInstanceVariable(messageClass, entry->ivarName);
+    if (ivar == NULL) {
+      @throw [NSException exceptionWithName:@"InternalError"
+                                     reason:[NSString stringWithFormat:@"%s has no ivar %s",
+                                             class_getName(messageClass), entry->ivarName]
+                                   userInfo:nil];
+    }
+    entry->offset = ivar_getOffset(ivar);
+    if (entry->builderClassName != NULL) {
+      entry->builderClass = objc_getClass(entry->builderClassName);
+    }
+  }
+}
+
+
+#pragma mark Writing
+
+static void PBFieldTableWriteScalarNoTag(PBExtensionType type, const void* value, PBCodedOutputStream* output) {
+  switch (type) {
+    case PBExtensionTypeBool:     [output writeBoolNoTag:*(const BOOL*)value]; break;
+    case PBExtensionTypeFixed32:  [output writeFixed32NoTag:*(const int32_t*)value]; break;
+    case PBExtensionTypeSFixed32: [output writeSFixed32NoTag:*(const int32_t*)value]; break;
+    case PBExtensionTypeFloat:    [output writeFloatNoTag:*(const Float32*)value]; break;
+    case PBExtensionTypeFixed64:  [output writeFixed64NoTag:*(const int64_t*)value]; break;
+    case PBExtensionTypeSFixed64: [output writeSFixed64NoTag:*(const int64_t*)value]; break;
+    case PBExtensionTypeDouble:   [output writeDoubleNoTag:*(const Float64*)value]; break;
+    case PBExtensionTypeInt32:    [output writeInt32NoTag:*(const int32_t*)value]; break;
+    case PBExtensionTypeInt64:    [output writeInt64NoTag:*(const int64_t*)value]; break;
+    case PBExtensionTypeSInt32:   [output writeSInt32NoTag:*(const int32_t*)value]; break;
+    case PBExtensionTypeSInt64:   [output writeSInt64NoTag:*(const int64_t*)value]; break;
+    case PBExtensionTypeUInt32:   [output writeUInt32NoTag:*(const int32_t*)value]; break;
+    case PBExtensionTypeUInt64:   [output writeUInt64NoTag:*(const int64_t*)value]; break;
+    case PBExtensionTypeEnum:     [output writeEnumNoTag:*(const int32_t*)value]; break;
+    default:
+      @throw [NSException exceptionWithName:@"InternalError" reason:@"" userInfo:nil];
+  }
+}
+
+
+static void PBFieldTableWriteValue(const PBFieldTableEntry* entry, const void* value, PBCodedOutputStream* output) {
+  switch (entry->type) {
+    case PBExtensionTypeBytes:   [output writeData:entry->number value:*(NSData* const*)value]; break;
+    case PBExtensionTypeString:  [output writeString:entry->number value:*(NSString* const*)value]; break;
+    case PBExtensionTypeMessage: [output writeMessage:entry->number value:*(id const*)value]; break;
+    case PBExtensionTypeGroup:   [output writeGroup:entry->number value:*(id const*)value]; break;
+    default:
+      [output writeTag:entry->number format:PBFieldTableWireType(entry)];
+      PBFieldTableWriteScalarNoTag(entry->type, value, output);
+      break;
+  }
+}
+
+
+static int32_t PBFieldTableComputeScalarSizeNoTag(PBExtensionType type, const void* value) {
+  switch (type) {
+    case PBExtensionTypeBool:     return computeBoolSizeNoTag(*(const BOOL*)value);
+    case PBExtensionTypeFixed32:  return computeFixed32SizeNoTag(*(const int32_t*)value);
+    case PBExtensionTypeSFixed32: return computeSFixed32SizeNoTag(*(const int32_t*)value);
+    case PBExtensionTypeFloat:    return computeFloatSizeNoTag(*(const Float32*)value);
+    case PBExtensionTypeFixed64:  return computeFixed64SizeNoTag(*(const int64_t*)value);
+    case PBExtensionTypeSFixed64: return computeSFixed64SizeNoTag(*(const int64_t*)value);
+    case PBExtensionTypeDouble:   return computeDoubleSizeNoTag(*(const Float64*)value);
+    case PBExtensionTypeInt32:    return computeInt32SizeNoTag(*(const int32_t*)value);
+    case PBExtensionTypeInt64:    return computeInt64SizeNoTag(*(const int64_t*)value);
+    case PBExtensionTypeSInt32:   return computeSInt32SizeNoTag(*(const int32_t*)value);
+    case PBExtensionTypeSInt64:   return computeSInt64SizeNoTag(*(const int64_t*)value);
+    case PBExtensionTypeUInt32:   return computeUInt32SizeNoTag(*(const int32_t*)value);
+    case PBExtensionTypeUInt64:   return computeUInt64SizeNoTag(*(const int64_t*)value);
+    case PBExtensionTypeEnum:     return computeEnumSizeNoTag(*(const int32_t*)value);
+    default:
+      @throw [NSException exceptionWithName:@"InternalError" reason:@"" userInfo:nil];
+  }
+}
+
+
+static int32_t PBFieldTableComputeValueSize(const PBFieldTableEntry* entry, const void* value) {
+  switch (entry->type) {
+    case PBExtensionTypeBytes:   return computeDataSize(entry->number, *(NSData* const*)value);
+    case PBExtensionTypeString:  return computeStringSize(entry->number, *(NSString* const*)value);
+    case PBExtensionTypeMessage: return computeMessageSize(entry->number, *(id const*)value);
+    case PBExtensionTypeGroup:   return computeGroupSize(entry->number, *(id const*)value);
+    default:
+      return computeTagSize(entry->number) + PBFieldTableComputeScalarSizeNoTag(entry->type, value);
+  }
+}
+
+
+static int32_t PBFieldTableComputePackedDataSize(PBExtensionType type, const uint8_t* values, NSUInteger count) {
+  const size_t width = PBFieldTableValueWidth(type);
+  int32_t size = 0;
+  for (NSUInteger i = 0; i < count; ++i) {
+    size += PBFieldTableComputeScalarSizeNoTag(type, values + i * width);
+  }
+  return size;
+}
+
+
+static void PBFieldTableWriteRepeated(const PBFieldTableEntry* entry, PBArray* array, PBCodedOutputStream* output) {
+  const NSUInteger count = array.count;
+  if (count == 0) {
+    return;
+  }
+
+  const uint8_t* values = array.data;
+  const size_t width = PBFieldTableValueWidth(entry->type);
+  if (entry->flags & PBFieldTablePacked) {
+    [output writeTag:entry->number format:PBWireFormatLengthDelimited];
+    [output writeRawVarint32:PBFieldTableComputePackedDataSize(entry->type, values, count)];
+    for (NSUInteger i = 0; i < count; ++i) {
+      PBFieldTableWriteScalarNoTag(entry->type, values + i * width, output);
+    }
+  } else {
+    for (NSUInteger i = 0; i < count; ++i) {
+      PBFieldTableWriteValue(entry, values + i * width, output);
+    }
+  }
+}
+
+
+void PBFieldTableWriteTo(const PBFieldTable* table, PBGeneratedMessage* message, PBCodedOutputStream* output) {
+  const uint8_t* base = (const uint8_t*)message;
+  const uint32_t* hasBits = (const uint32_t*)(base + table->hasBitsOffset);
+
+  // Extension ranges are written in field number order along with the fields.
+  uint32_t range = 0;
+  for (uint32_t i = 0; i < table->entryCount; ++i) {
+    const PBFieldTableEntry* entry = &table->entries[i];
+    for (; range < table->extensionRangeCount &&
+           table->extensionRanges[2 * range] < entry->number; ++range) {
+      [(PBExtendableMessage*)message writeExtensionsToCodedOutputStream:output
+                                                                   from:table->extensionRanges[2 * range]
+                                                                     to:table->extensionRanges[2 * range + 1]];
+    }
+
+    if (entry->flags & PBFieldTableRepeated) {
+      PBFieldTableWriteRepeated(entry, *(PBArray* const*)(base + entry->offset), output);
+    } else if (PBFieldTableHasBit(hasBits, entry->hasBit)) {
+      PBFieldTableWriteValue(entry, base + entry->offset, output);
+    }
+  }
+  for (; range < table->extensionRangeCount; ++range) {
+    [(PBExtendableMessage*)message writeExtensionsToCodedOutputStream:output
+                                                                 from:table->extensionRanges[2 * range]
+                                                                   to:table->extensionRanges[2 * range + 1]];
+  }
+}
+
+
+int32_t PBFieldTableSerializedSize(const PBFieldTable* table, PBGeneratedMessage* message) {
+  const uint8_t* base = (const uint8_t*)message;
+  const uint32_t* hasBits = (const uint32_t*)(base + table->hasBitsOffset);
+
+  int32_t size = 0;
+  for (uint32_t i = 0; i < table->entryCount; ++i) {
+    const PBFieldTableEntry* entry = &table->entries[i];
+    if (entry->flags & PBFieldTableRepeated) {
+      PBArray* array = *(PBArray* const*)(base + entry->offset);
+      const NSUInteger count = array.count;
+      if (count == 0) {
+        continue;
+      }
+
+      const uint8_t* values = array.data;
+      if (entry->flags & PBFieldTablePacked) {
+        const int32_t dataSize = PBFieldTableComputePackedDataSize(entry->type, values, count);
+        size += computeTagSize(entry->number) + computeRawVarint32Size(dataSize) + dataSize;
+      } else {
+        const size_t width = PBFieldTableValueWidth(entry->type);
+        for (NSUInteger j = 0; j < count; ++j) {
+          size += PBFieldTableComputeValueSize(entry, values + j * width);
+        }
+      }
+    } else if (PBFieldTableHasBit(hasBits, entry->hasBit)) {
+      size += PBFieldTableComputeValueSize(entry, base + entry->offset);
+    }
+  }
+
+  return size;
+}
+
+
+#pragma mark Comparing
+
+static BOOL PBFieldTableValuesEqual(PBExtensionType type, const void* value, const void* other) {
+  switch (type) {
+    case PBExtensionTypeFloat:
+      return *(const Float32*)value == *(const Float32*)other;
+    case PBExtensionTypeDouble:
+      return *(const Float64*)value == *(const Float64*)other;
+    default:
+      if (PBFieldTableIsObject(type)) {
+        return [*(id const*)value isEqual:*(id const*)other];
+      }
+      return memcmp(value, other, PBFieldTableValueWidth(type)) == 0;
+  }
+}
+
+
+BOOL PBFieldTableIsEqual(const PBFieldTable* table, PBGeneratedMessage* message, PBGeneratedMessage* other) {
+  const uint8_t* base = (const uint8_t*)message;
+  const uint8_t* otherBase = (const uint8_t*)other;
+  const uint32_t* hasBits = (const uint32_t*)(base + table->hasBitsOffset);
+  const uint32_t* otherHasBits = (const uint32_t*)(otherBase + table->hasBitsOffset);
+
+  for (uint32_t i = 0; i < table->entryCount; ++i) {
+    const PBFieldTableEntry* entry = &table->entries[i];
+    if (entry->flags & PBFieldTableRepeated) {
+      PBArray* array = *(PBArray* const*)(base + entry->offset);
+      PBArray* otherArray = *(PBArray* const*)(otherBase + entry->offset);
+      if (array.count == 0 ? otherArray.count != 0 : ![array isEqualToArray:otherArray]) {
+        return NO;
+      }
+    } else {
+      const BOOL has = PBFieldTableHasBit(hasBits, entry->hasBit);
+      if (has != PBFieldTableHasBit(otherHasBits, entry->hasBit)) {
+        return NO;
+      }
+      if (has && !PBFieldTableValuesEqual(entry->type, base + entry->offset, otherBase + entry->offset)) {
+        return NO;
+      }
+    }
+  }
+
+  return YES;
+}
+
+
+static uint64_t PBFieldTableValueHash(PBExtensionType type, const void* value) {
+  switch (type) {
+    case PBExtensionTypeFloat:
+      return PBGeneratedMessageHashFloat(*(const Float32*)value);
+    case PBExtensionTypeDouble:
+      return PBGeneratedMessageHashDouble(*(const Float64*)value);
+    default:
+      if (PBFieldTableIsObject(type)) {
+        return [*(id const*)value hash];
+      }
+      if (PBFieldTableValueWidth(type) == sizeof(int64_t)) {
+        return *(const uint64_t*)value;
+      }
+      if (type == PBExtensionTypeBool) {
+        return *(const BOOL*)value;
+      }
+      return *(const uint32_t*)value;
+  }
+}
+
+
+uint64_t PBFieldTableHash(const PBFieldTable* table, PBGeneratedMessage* message) {
+  const uint8_t* base = (const uint8_t*)message;
+  const uint32_t* hasBits = (const uint32_t*)(base + table->hasBitsOffset);
+
+  uint64_t hashCode = 7;
+  for (uint32_t i = 0; i < table->entryCount; ++i) {
+    const PBFieldTableEntry* entry = &table->entries[i];
+    if (entry->flags & PBFieldTableRepeated) {
+      hashCode = PBGeneratedMessageHashMix(hashCode, [*(PBArray* const*)(base + entry->offset) hash64]);
+    } else if (PBFieldTableHasBit(hasBits, entry->hasBit)) {
+      hashCode = PBGeneratedMessageHashMix(hashCode, PBFieldTableValueHash(entry->type, base + entry->offset));
+    }
+  }
+
+  return hashCode;
+}
+
+
+#pragma mark Parsing
+
+static const PBFieldTableEntry* PBFieldTableFind(const PBFieldTable* table, int32_t number) {
+  uint32_t low = 0;
+  uint32_t high = table->entryCount;
+  while (low < high) {
+    const uint32_t middle = low + (high - low) / 2;
+    const int32_t middleNumber = table->entries[middle].number;
+    if (middleNumber == number) {
+      return &table->entries[middle];
+    } else if (middleNumber < number) {
+      low = middle + 1;
+    } else {
+      high = middle;
+    }
+  }
+  return NULL;
+}
+
+
+static PBAppendableArray* PBFieldTableArray(const PBFieldTableEntry* entry, PBFieldTableParse* parse) {
+  PBAppendableArray** slot = (PBAppendableArray**)(parse->base + entry->offset);
+  if (*slot == nil) {
+    const PBArrayValueType valueType = PBFieldTableArrayValueType(entry->type);
+    *slot = [[PBFieldTableArrayClass(valueType) alloc] initWithValueType:valueType];
+  }
+  return *slot;
+}
+
+
+static void PBFieldTableStoreScalar(const PBFieldTableEntry* entry, PBFieldTableParse* parse, const void* value) {
+  if (entry->flags & PBFieldTableRepeated) {
+    [PBFieldTableArray(entry, parse) appendValues:value count:1];
+  } else {
+    memcpy(parse->base + entry->offset, value, PBFieldTableValueWidth(entry->type));
+    PBFieldTableSetHasBit(parse->hasBits, entry->hasBit);
+  }
+}
+
+
+static void PBFieldTableStoreObject(const PBFieldTableEntry* entry, PBFieldTableParse* parse, id value) {
+  if (entry->flags & PBFieldTableRepeated) {
+    [PBFieldTableArray(entry, parse) addObject:value];
+  } else {
+    id* slot = (id*)(parse->base + entry->offset);
+    if (*slot != value) {
+      [*slot release];
+      *slot = [value retain];
+    }
+    PBFieldTableSetHasBit(parse->hasBits, entry->hasBit);
+  }
+}
+
+
+static void PBFieldTableReadMessage(const PBFieldTableEntry* entry, PBFieldTableParse* parse) {
+  id<PBFieldTableBuilder> subBuilder = [[entry->builderClass alloc] init];
+  @try {
+    // A singular message that is already set has the new one merged into it.
+    if (!(entry->flags & PBFieldTableRepeated) &&
+        PBFieldTableHasBit(parse->hasBits, entry->hasBit)) {
+      [subBuilder mergeFrom:*(id*)(parse->base + entry->offset)];
+    }
+    if (entry->type == PBExtensionTypeGroup) {
+      [parse->input readGroup:entry->number builder:subBuilder extensionRegistry:parse->extensionRegistry];
+    } else {
+      [parse->input readMessage:subBuilder extensionRegistry:parse->extensionRegistry];
+    }
+    id value = [subBuilder newBuildPartial];
+    PBFieldTableStoreObject(entry, parse, value);
+    [value release];
+  } @finally {
+    [subBuilder release];
+  }
+}
+
+
+static void PBFieldTableReadValue(const PBFieldTableEntry* entry, PBFieldTableParse* parse) {
+  PBCodedInputStream* input = parse->input;
+  union {
+    BOOL b;
+    int32_t i32;
+    int64_t i64;
+    Float32 f;
+    Float64 d;
+  } value;
+
+  switch (entry->type) {
+    case PBExtensionTypeBytes:
+    case PBExtensionTypeString: {
+      id object = entry->type == PBExtensionTypeString ? [input newString] : [input newData];
+      PBFieldTableStoreObject(entry, parse, object);
+      [object release];
+      return;
+    }
+    case PBExtensionTypeMessage:
+    case PBExtensionTypeGroup:
+      PBFieldTableReadMessage(entry, parse);
+      return;
+    case PBExtensionTypeEnum:
+      value.i32 = [input readEnum];
+      if (!entry->isValidEnumValue(value.i32)) {
+        if (parse->unknownFields == nil) {
+          parse->unknownFields = [PBUnknownFieldSet builderWithUnknownFields:[parse->builder unknownFields]];
+        }
+        [parse->unknownFields mergeVarintField:entry->number value:value.i32];
+        return;
+      }
+      break;
+    case PBExtensionTypeBool:     value.b = [input readBool]; break;
+    case PBExtensionTypeFixed32:  value.i32 = [input readFixed32]; break;
+    case PBExtensionTypeSFixed32: value.i32 = [input readSFixed32]; break;
+    case PBExtensionTypeFloat:    value.f = [input readFloat]; break;
+    case PBExtensionTypeFixed64:  value.i64 = [input readFixed64]; break;
+    case PBExtensionTypeSFixed64: value.i64 = [input readSFixed64]; break;
+    case PBExtensionTypeDouble:   value.d = [input readDouble]; break;
+    case PBExtensionTypeInt32:    value.i32 = [input readInt32]; break;
+    case PBExtensionTypeInt64:    value.i64 = [input readInt64]; break;
+    case PBExtensionTypeSInt32:   value.i32 = [input readSInt32]; break;
+    case PBExtensionTypeSInt64:   value.i64 = [input readSInt64]; break;
+    case PBExtensionTypeUInt32:   value.i32 = [input readUInt32]; break;
+    case PBExtensionTypeUInt64:   value.i64 = [input readUInt64]; break;
+  }
+
+  PBFieldTableStoreScalar(entry, parse, &value);
+}
+
+
+void PBFieldTableMergeFromCodedInputStream(const PBFieldTable* table,
+                                           PBGeneratedMessage_Builder* builder,
+                                           PBGeneratedMessage* result,
+                                           PBCodedInputStream* input,
+                                           PBExtensionRegistry* extensionRegistry) {
+  PBFieldTableParse parse = {
+    (uint8_t*)result,
+    (uint32_t*)((uint8_t*)result + table->hasBitsOffset),
+    input,
+    extensionRegistry,
+    builder,
+    nil
+  };
+
+  while (YES) {
+    const int32_t tag = [input readTag];
+    if (tag == 0 || PBWireFormatGetTagWireType(tag) == PBWireFormatEndGroup) {
+      break;
+    }
+
+    const PBFieldTableEntry* entry = PBFieldTableFind(table, PBWireFormatGetTagFieldNumber(tag));
+    if (entry == NULL || PBWireFormatGetTagWireType(tag) != PBFieldTableWireType(entry)) {
+      if (parse.unknownFields == nil) {
+        parse.unknownFields = [PBUnknownFieldSet builderWithUnknownFields:[builder unknownFields]];
+      }
+      [builder parseUnknownField:input unknownFields:parse.unknownFields extensionRegistry:extensionRegistry tag:tag];
+    } else if (entry->flags & PBFieldTablePacked) {
+      const int32_t length = [input readRawVarint32];
+      const int32_t limit = [input pushLimit:length];
+      while (input.bytesUntilLimit > 0) {
+        PBFieldTableReadValue(entry, &parse);
+      }
+      [input popLimit:limit];
+    } else {
+      PBFieldTableReadValue(entry, &parse);
+    }
+  }
+
+  if (parse.unknownFields != nil) {
+    [builder setUnknownFields:[parse.unknownFields build]];
+  }
+}
@@ -17,12 +17,88 @@
 
 #import "AbstractMessage.h"
 
+/**
+ * Stores {@code value}, which the caller owns, into {@code *slot} if the
+ * slot is still nil, and releases it otherwise.  Used by generated getters
+ * of lazily parsed fields, which several threads may call at once on a
+ * built message.
+ */
+void PBGeneratedMessageSetLazyValue(id* slot, id value);
+
+/**
+ * Read and write the serialized sizes a built message memoizes: its own,
+ * and the payload size of each packed field.  Several threads serializing
+ * the same message may race to store a size, but they all store the same
+ * value, so atomic accesses are all it takes.  The message's own size is
+ * stored last, and a thread that reads it also sees the packed sizes
+ * stored before it.
+ */
+static inline int32_t PBGeneratedMessageGetMemoizedSize(const int32_t* size) {
+  return __atomic_load_n(size, __ATOMIC_ACQUIRE);
+}
+static inline void PBGeneratedMessageSetMemoizedSize(int32_t* size, int32_t value) {
+  __atomic_store_n(size, value, __ATOMIC_RELEASE);
+}
+
+/**
+ * Generated -hash methods mix each field into a 64-bit state with
+ * {@code PBGeneratedMessageHashMix}, unboxed, and finish it once.  Floats
+ * and doubles go through their own functions so that 0 and -0, which are
+ * equal, hash alike.
+ */
+static inline uint64_t PBGeneratedMessageHashMix(uint64_t hash, uint64_t value) {
+  value *= 0xC2B2AE3D27D4EB4FULL;
+  value = (value << 31) | (value >> 33);
+  hash ^= value * 0x9E3779B185EBCA87ULL;
+  return ((hash << 27) | (hash >> 37)) * 0x9E3779B185EBCA87ULL + 0x85EBCA77C2B2AE63ULL;
+}
+static inline uint64_t PBGeneratedMessageHashFloat(Float32 value) {
+  uint32_t bits = 0;
+  if (value != 0) {
+    memcpy(&bits, &value, sizeof(bits));
+  }
+  return bits;
+}
+static inline uint64_t PBGeneratedMessageHashDouble(Float64 value) {
+  uint64_t bits = 0;
+  if (value != 0) {
+    memcpy(&bits, &value, sizeof(bits));
+  }
+  return bits;
+}
+static inline NSUInteger PBGeneratedMessageHashFinish(uint64_t hash) {
+  hash ^= hash >> 33;
+  hash *= 0xC2B2AE3D27D4EB4FULL;
+  hash ^= hash >> 29;
+  hash *= 0x165667B19E3779F9ULL;
+  hash ^= hash >> 32;
+  return (NSUInteger)hash;
+}
+
+/**
+ * The memoized hash of a built message, or 0 if it has not been computed
+ * (or happens to be 0).  Like the sizes, it may be computed by several
+ * threads at once.
+ */
+static inline NSUInteger PBGeneratedMessageGetMemoizedHash(const NSUInteger* hash) {
+  return __atomic_load_n(hash, __ATOMIC_RELAXED);
+}
+static inline void PBGeneratedMessageSetMemoizedHash(NSUInteger* hash, NSUInteger value) {
+  __atomic_store_n(hash, value, __ATOMIC_RELAXED);
+}
+
 /**
  * All generated protocol message classes extend this class.  This class
  * implements most of the Message and Builder interfaces using Java reflection.
  * Users can ignore this class and pretend that generated messages implement
  * the Message interface directly.
  *
+ * A built message is immutable and may be read, and serialized, from any
+ * number of threads at once.  Its generated properties are nonatomic, and
+ * generated code reads and writes the fields directly, so a builder (and
+ * the message it is filling in) must only be used from one thread at a
+ * time.
+ *
  * @author Cyrus Najmabadi
  */
 @interface PBGeneratedMessage : PBAbstractMessage {
@@ -31,6 +107,70 @@
 
 @protected
   int32_t memoizedSerializedSize;
+  NSUInteger memoizedHash;
 }
 
+/**
+ * Returns the message to its freshly initialized state, keeping the storage
+ * of its repeated fields unless something else still holds them: an array
+ * handed out by a builder keeps its values, and the message gets a new one
+ * (see PBAppendableArrayReuse).  Only for a message nothing else refers to any
+ * more: one a builder is recycling (see the generated {@code -reset} and
+ * {@code -recycle:} builder methods), or one going back to its pool.  The
+ * messages it holds are released, not cleared, since others may share them.
+ * Subclasses clear their own fields and call super.
+ */
+/* @protected */
+- (void) clearForReuse;
+
+/**
+ * Messages generated with the {@code mutable_messages} Objective C file
+ * option can be changed in place until they are frozen.  Freezing one
+ * freezes the messages it holds too, after which it may be shared between
+ * threads like any built message.  Every other message is always frozen, and
+ * freezing it does nothing.
+ */
+- (void) freeze;
+- (BOOL) isFrozen;
+
+/**
+ * Opt-in reuse of message instances, for code that parses or builds the same
+ * message types over and over.  Each thread keeps a pool of up to
+ * {@code limit} cleared instances of the receiving class.  The limit starts
+ * at 0, which leaves pooling off.  Generated builders fill the pools with the
+ * results they made but never handed out, when they are cleared or
+ * deallocated, and {@code -recycle} with messages that were handed out.
+ */
++ (void) setRecycledInstanceLimit:(NSUInteger) limit;
+
+/**
+ * A cleared instance from the current thread's pool, or a new one if the pool
+ * is empty.  The caller owns it.  Generated builders take their results from
+ * here.
+ */
++ (id) recycledInstance NS_RETURNS_RETAINED;
+
+/**
+ * Gives up the caller's reference, like {@code -release}, first clearing the
+ * message and putting it in the current thread's pool for its class if there
+ * is room.  The caller must own the only reference that is still in use:
+ * nothing else may read the message afterwards, including an enclosing
+ * message or a builder made from it with toBuilder.  References that will
+ * only be released, such as a pending autorelease, are fine.  This can't be
+ * checked, so breaking the contract clears the message under its readers.
+ * The messages it holds are released, not recycled.
+ */
+- (void) recycle;
+
 @end
+
+/**
+ * Clears message and puts it in the current thread's pool for its class, if
+ * there is room.  The pool takes a reference of its own.  Only for messages
+ * the caller owns alone, such as generated builders' unbuilt results; does
+ * nothing for nil.
+ */
+void PBGeneratedMessageRecycle(PBGeneratedMessage* message);
+
+/** Thrown by the mutators of a frozen message. */
+void PBGeneratedMessageThrowFrozen(PBGeneratedMessage* message) __attribute__((noreturn));
@@ -17,13 +17,114 @@
 
 #import "GeneratedMessage.h"
 
+#import <libkern/OSAtomic.h>
+#import <pthread.h>
+
 #import "UnknownFieldSet.h"
 
+void PBGeneratedMessageSetLazyValue(id* slot, id value) {
+  if (!OSAtomicCompareAndSwapPtrBarrier(nil, value, (void* volatile*)slot)) {
+    // Another thread parsed the same bytes first.
+    [value release];
+  }
+}
+
 @interface PBGeneratedMessage ()
-@property (retain) PBUnknownFieldSet* unknownFields;
+@property (nonatomic, retain) PBUnknownFieldSet* unknownFields;
 @end
 
 
+#pragma mark Recycling
+
+/** One thread's pool of cleared instances of one message class. */
+typedef struct PBRecycledInstances {
+  PBGeneratedMessage** instances;
+  NSUInteger count;
+  NSUInteger limit;
+  int32_t generation;
+} PBRecycledInstances;
+
+/** Maps classes to their limits, under recycledInstanceLimitsLock. */
+static CFMutableDictionaryRef recycledInstanceLimits = NULL;
+static pthread_mutex_t recycledInstanceLimitsLock = PTHREAD_MUTEX_INITIALIZER;
+
+/** Bumped on every change to the limits, so that threads reload theirs. */
+static volatile int32_t recycledInstanceLimitsGeneration = 0;
+
+/** Nothing is pooled, or looked up, until some limit has been set. */
+static volatile BOOL recyclingEnabled = NO;
+
+/** Each thread's pools, keyed by class. */
+static pthread_key_t recycledInstancesKey;
+
+
+static void PBRecycledInstancesFree(const void* key, const void* value, void* context) {
+  PBRecycledInstances* pool = (PBRecycledInstances*)value;
+  for (NSUInteger i = 0; i < pool->count; i++) {
+    [pool->instances[i] release];
+  }
+  free(pool->instances);
+  free(pool);
+}
+
+
+/** Called when a thread that recycled messages exits. */
+static void PBRecycledInstancesFreeAll(void* value) {
+  CFMutableDictionaryRef pools = (CFMutableDictionaryRef)value;
+  CFDictionaryApplyFunction(pools, PBRecycledInstancesFree, NULL);
+  CFRelease(pools);
+}
+
+
+static PBRecycledInstances* PBRecycledInstancesForClass(Class messageClass) {
+  CFMutableDictionaryRef pools = pthread_getspecific(recycledInstancesKey);
+  if (pools == NULL) {
+    pools = CFDictionaryCreateMutable(kCFAllocatorDefault, 0, NULL, NULL);
+    pthread_setspecific(recycledInstancesKey, pools);
+  }
+
+  PBRecycledInstances* pool = (PBRecycledInstances*)CFDictionaryGetValue(pools, messageClass);
+  if (pool == NULL) {
+    pool = calloc(1, sizeof(PBRecycledInstances));
+    if (pool == NULL) {
+      @throw [NSException exceptionWithName:NSMallocException reason:@"recycled instance pool allocation failed" userInfo:nil];
+    }
+    pool->generation = -1;
+    CFDictionarySetValue(pools, messageClass, pool);
+  }
+
+  if (pool->generation != recycledInstanceLimitsGeneration) {
+    pthread_mutex_lock(&recycledInstanceLimitsLock);
+    NSUInteger limit = (NSUInteger)CFDictionaryGetValue(recycledInstanceLimits, messageClass);
+    pool->generation = recycledInstanceLimitsGeneration;
+    pthread_mutex_unlock(&recycledInstanceLimitsLock);
+
+    while (pool->count > limit) {
+      [pool->instances[--pool->count] release];
+    }
+    PBGeneratedMessage** instances = realloc(pool->instances, limit * sizeof(PBGeneratedMessage*));
+    if (instances == NULL && limit > 0) {
+      @throw [NSException exceptionWithName:NSMallocException reason:@"recycled instance pool allocation failed" userInfo:nil];
+    }
+    pool->instances = instances;
+    pool->limit = limit;
+  }
+  return pool;
+}
+
+
+void PBGeneratedMessageRecycle(PBGeneratedMessage* message) {
+  if (!recyclingEnabled || message == nil || message == [message defaultInstance]) {
+    return;
+  }
+  PBRecycledInstances* pool = PBRecycledInstancesForClass([message class]);
+  if (pool->count < pool->limit) {
+    [message clearForReuse];
+    pool->instances[pool->count++] = [message retain];
+  }
+}
+
+
 @implementation PBGeneratedMessage
 
 @synthesize unknownFields;
@@ -36,11 +137,72 @@
 
 - (id) init {
   if ((self = [super init])) {
-    self.unknownFields = [PBUnknownFieldSet defaultInstance];
     memoizedSerializedSize = -1;
   }
 
   return self;
 }
 
+
+/**
+ * Nil until a builder stores some unknown fields, which those generated for
+ * LITE_RUNTIME never do.
+ */
+- (PBUnknownFieldSet*) unknownFields {
+  return unknownFields != nil ? unknownFields : [PBUnknownFieldSet defaultInstance];
+}
+
+
+- (void) clearForReuse {
+  self.unknownFields = nil;
+  memoizedSerializedSize = -1;
+  memoizedHash = 0;
+}
+
+
+- (void) freeze {
+}
+
+
+- (BOOL) isFrozen {
+  return YES;
+}
+
+
++ (void) setRecycledInstanceLimit:(NSUInteger) limit {
+  pthread_mutex_lock(&recycledInstanceLimitsLock);
+  if (recycledInstanceLimits == NULL) {
+    pthread_key_create(&recycledInstancesKey, PBRecycledInstancesFreeAll);
+    recycledInstanceLimits = CFDictionaryCreateMutable(kCFAllocatorDefault, 0, NULL, NULL);
+  }
+  CFDictionarySetValue(recycledInstanceLimits, self, (const void*)limit);
+  OSAtomicIncrement32Barrier(&recycledInstanceLimitsGeneration);
+  recyclingEnabled = YES;
+  pthread_mutex_unlock(&recycledInstanceLimitsLock);
+}
+
+
++ (id) recycledInstance {
+  if (recyclingEnabled) {
+    PBRecycledInstances* pool = PBRecycledInstancesForClass(self);
+    if (pool->count > 0) {
+      return pool->instances[--pool->count];
+    }
+  }
+  return [[self alloc] init];
+}
+
+
+- (void) recycle {
+  PBGeneratedMessageRecycle(self);
+  [self release];
+}
+
 @end
+
+
+void PBGeneratedMessageThrowFrozen(PBGeneratedMessage* message) {
+  @throw [NSException exceptionWithName:@"IllegalState"
+                                 reason:[NSString stringWithFormat:@"%@ is frozen", [message class]]
+                               userInfo:nil];
+}
@@ -17,12 +17,19 @@
 
 #import "AbstractMessage_Builder.h"
 
+@class PBGeneratedMessage;
 @class PBUnknownFieldSet_Builder;
 
 @interface PBGeneratedMessage_Builder : PBAbstractMessage_Builder {
 }
 
 /* @protected */
+/**
+ * The result, for changing it.  Builders that share their result with the
+ * message they were made from make a copy of their own first.
+ */
+- (PBGeneratedMessage*) internalGetMutableResult;
+
 - (BOOL) parseUnknownField:(PBCodedInputStream*) input
              unknownFields:(PBUnknownFieldSet_Builder*) unknownFields
          extensionRegistry:(PBExtensionRegistry*) extensionRegistry
@@ -40,6 +40,11 @@
 }
 
 
+- (PBGeneratedMessage*) internalGetMutableResult {
+  return self.internalGetResult;
+}
+
+
 - (void) checkInitialized {
   PBGeneratedMessage* result = self.internalGetResult;
   if (result != nil && !result.isInitialized) {
@@ -54,13 +59,13 @@
 
 
 - (id<PBMessage_Builder>) setUnknownFields:(PBUnknownFieldSet*) unknownFields {
-  self.internalGetResult.unknownFields = unknownFields;
+  self.internalGetMutableResult.unknownFields = unknownFields;
   return self;
 }
 
 
 - (id<PBMessage_Builder>) mergeUnknownFields:(PBUnknownFieldSet*) unknownFields {
-  PBGeneratedMessage* result = self.internalGetResult;
+  PBGeneratedMessage* result = self.internalGetMutableResult;
   result.unknownFields =
   [[[PBUnknownFieldSet builderWithUnknownFields:result.unknownFields]
     mergeUnknownFields:unknownFields] build];
@@ -74,13 +79,17 @@
 
 
 /**
- * Called by subclasses to parse an unknown field.
+ * Called by subclasses to parse an unknown field.  Builders generated for
+ * LITE_RUNTIME pass a nil {@code unknownFields}, and the field is skipped.
  * @return {@code YES} unless the tag is an end-group tag.
  */
 - (BOOL) parseUnknownField:(PBCodedInputStream*) input
              unknownFields:(PBUnknownFieldSet_Builder*) unknownFields
          extensionRegistry:(PBExtensionRegistry*) extensionRegistry
                        tag:(int32_t) tag {
+  if (unknownFields == nil) {
+    return [input skipField:tag];
+  }
   return [unknownFields mergeFieldFrom:tag input:input];
 }
 
@@ -0,0 +1,47 @@
+// Protocol Buffers for Objective C
+//
+// Copyright 2010 Booyah Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <Foundation/Foundation.h>
+
+struct z_stream_s;
+
+/**
+ * An NSInputStream adapter that inflates data read from an underlying
+ * stream.  Hand it to {@code +[PBCodedInputStream streamWithInputStream:]}
+ * and every {@code refillBuffer:} decompresses straight into the coded
+ * stream's buffer, one compressed chunk at a time.
+ *
+ * {@code windowBits} must match the writer's (see
+ * {@link PBDeflateOutputStream}); pass 47 (32 + 15) to accept either a zlib
+ * or a gzip wrapper.
+ */
+@interface PBInflateInputStream : NSInputStream {
+@private
+  NSInputStream* input;
+  struct z_stream_s* stream;
+  NSMutableData* chunk;
+  BOOL finished;
+}
+
+@property (retain) NSInputStream* input;
+
++ (PBInflateInputStream*) streamWithInputStream:(NSInputStream*) input;
++ (PBInflateInputStream*) streamWithInputStream:(NSInputStream*) input
+                                     windowBits:(int32_t) windowBits;
+
+- (id) initWithInputStream:(NSInputStream*) input windowBits:(int32_t) windowBits;
+
+@end
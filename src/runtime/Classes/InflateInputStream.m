@@ -0,0 +1,140 @@
+// Protocol Buffers for Objective C
+//
+// Copyright 2010 Booyah Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import "InflateInputStream.h"
+
+#import <zlib.h>
+
+#import "DeflateOutputStream.h"
+
+static const int32_t INFLATE_CHUNK_SIZE = 4 * 1024;
+
+
+@implementation PBInflateInputStream
+
+@synthesize input;
+
+- (void) dealloc {
+  if (stream != NULL) {
+    inflateEnd(stream);
+    free(stream);
+  }
+  [chunk release];
+  self.input = nil;
+
+  [super dealloc];
+}
+
+
+- (id) initWithInputStream:(NSInputStream*) input_ windowBits:(int32_t) windowBits {
+  if ((self = [super init])) {
+    self.input = input_;
+    chunk = [[NSMutableData alloc] initWithLength:INFLATE_CHUNK_SIZE];
+    stream = calloc(1, sizeof(z_stream));
+    if (stream == NULL || inflateInit2(stream, windowBits) != Z_OK) {
+      free(stream);
+      stream = NULL;
+      [self release];
+      @throw [NSException exceptionWithName:@"IllegalArgument" reason:@"Invalid inflate parameters" userInfo:nil];
+    }
+  }
+
+  return self;
+}
+
+
++ (PBInflateInputStream*) streamWithInputStream:(NSInputStream*) input
+                                     windowBits:(int32_t) windowBits {
+  return [[[PBInflateInputStream alloc] initWithInputStream:input windowBits:windowBits] autorelease];
+}
+
+
++ (PBInflateInputStream*) streamWithInputStream:(NSInputStream*) input {
+  return [PBInflateInputStream streamWithInputStream:input windowBits:PBDeflateDefaultWindowBits];
+}
+
+
+- (void) open {
+  [input open];
+}
+
+
+- (void) close {
+  [input close];
+}
+
+
+/**
+ * Fills {@code buffer} with as much inflated data as one pass over the
+ * available compressed input produces.  Only returns 0 at the end of the
+ * deflate stream (or of the underlying input), since
+ * {@code -[PBCodedInputStream refillBuffer:]} treats 0 as EOF.
+ */
+- (NSInteger) read:(uint8_t*) buffer maxLength:(NSUInteger) len {
+  if (finished || len == 0) {
+    return 0;
+  }
+
+  stream->next_out = buffer;
+  stream->avail_out = (uInt)len;
+
+  while (stream->avail_out == len) {
+    if (stream->avail_in == 0) {
+      NSInteger n = [input read:chunk.mutableBytes maxLength:INFLATE_CHUNK_SIZE];
+      if (n < 0) {
+        return -1;
+      }
+      if (n == 0) {
+        @throw [NSException exceptionWithName:@"InvalidProtocolBuffer" reason:@"truncatedCompressedStream" userInfo:nil];
+      }
+      stream->next_in = chunk.mutableBytes;
+      stream->avail_in = (uInt)n;
+    }
+
+    int status = inflate(stream, Z_NO_FLUSH);
+    if (status == Z_STREAM_END) {
+      finished = YES;
+      break;
+    }
+    if (status != Z_OK && status != Z_BUF_ERROR) {
+      @throw [NSException exceptionWithName:@"InvalidProtocolBuffer" reason:@"malformedCompressedStream" userInfo:nil];
+    }
+  }
+
+  return len - stream->avail_out;
+}
+
+
+- (BOOL) getBuffer:(uint8_t**) buffer length:(NSUInteger*) len {
+  return NO;
+}
+
+
+- (BOOL) hasBytesAvailable {
+  return !finished;
+}
+
+
+- (NSStreamStatus) streamStatus {
+  return finished ? NSStreamStatusAtEnd : input.streamStatus;
+}
+
+
+- (NSError*) streamError {
+  return input.streamError;
+}
+
+@end
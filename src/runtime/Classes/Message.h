@@ -42,7 +42,8 @@
 
 /**
  * Get the number of bytes required to encode this message.  The result
- * is only computed on the first call and memoized after that.
+ * is only computed on the first call and memoized after that, which is
+ * safe to do from several threads at once.
  */
 - (int32_t) serializedSize;
 
@@ -18,10 +18,14 @@
 
 #import <Foundation/Foundation.h>
 
+@class PBArena;
+
 extern NSString * const PBArrayTypeMismatchException;
 extern NSString * const PBArrayNumberExpectedException;
 extern NSString * const PBArrayAllocationFailureException;
 
+extern void PBArrayRaiseRangeException(NSUInteger index, NSUInteger count);
+
 typedef enum _PBArrayValueType
 {
 	PBArrayValueTypeObject,
@@ -37,13 +41,20 @@ typedef enum _PBArrayValueType
 // PBArray is an immutable array class that's optimized for storing primitive
 // values.  All values stored in an PBArray instance must have the same type
 // (PBArrayValueType).  Object values (PBArrayValueTypeObject) are retained.
+//
+// Copies share their storage with the original.  The storage is only
+// duplicated when a PBAppendableArray that shares it is mutated.
 @interface PBArray : NSObject <NSCopying, NSFastEnumeration>
 {
 @protected
 	PBArrayValueType	_valueType;
+	void				(^_deallocator)(void *bytes, NSUInteger length);
+@public
+	// Public only so that the typed inline accessors below can reach them.
 	NSUInteger			_capacity;
 	NSUInteger			_count;
 	void *				_data;
+	volatile int32_t *	_shareCount;
 }
 
 - (NSUInteger)count;
@@ -55,14 +66,39 @@ typedef enum _PBArrayValueType
 - (uint64_t)uint64AtIndex:(NSUInteger)index;
 - (Float32)floatAtIndex:(NSUInteger)index;
 - (Float64)doubleAtIndex:(NSUInteger)index;
+
+// Arrays are equal if they have the same value type and equal values.
+// Floating point values compare with C semantics (NaN != NaN), and objects
+// with isEqual:.  A nil array is equal to an empty one.
 - (BOOL)isEqualToArray:(PBArray *)array;
 
+// A 64-bit hash of the array's values, consistent with isEqualToArray:.
+- (uint64_t)hash64;
+
 @property (nonatomic,assign,readonly) PBArrayValueType valueType;
 @property (nonatomic,assign,readonly) const void * data;
 @property (nonatomic,assign,readonly,getter=count) NSUInteger count;
 
 @end
 
+// Block-based iteration over the raw values of a PBArray.  Each typed
+// enumerator asserts the array's value type and passes values unboxed;
+// enumerateRangesUsingBlock: hands out pointers into the array's storage, one
+// contiguous chunk at a time, which callers must not retain past the block.
+@interface PBArray (PBArrayEnumeration)
+
+- (void)enumerateObjectsUsingBlock:(void (^)(id obj, NSUInteger idx, BOOL *stop))block;
+- (void)enumerateBoolsUsingBlock:(void (^)(BOOL value, NSUInteger idx, BOOL *stop))block;
+- (void)enumerateInt32sUsingBlock:(void (^)(int32_t value, NSUInteger idx, BOOL *stop))block;
+- (void)enumerateUint32sUsingBlock:(void (^)(uint32_t value, NSUInteger idx, BOOL *stop))block;
+- (void)enumerateInt64sUsingBlock:(void (^)(int64_t value, NSUInteger idx, BOOL *stop))block;
+- (void)enumerateUint64sUsingBlock:(void (^)(uint64_t value, NSUInteger idx, BOOL *stop))block;
+- (void)enumerateFloatsUsingBlock:(void (^)(Float32 value, NSUInteger idx, BOOL *stop))block;
+- (void)enumerateDoublesUsingBlock:(void (^)(Float64 value, NSUInteger idx, BOOL *stop))block;
+- (void)enumerateRangesUsingBlock:(void (^)(const void *values, NSRange range, BOOL *stop))block;
+
+@end
+
 @interface PBArray (PBArrayExtended)
 
 - (id)arrayByAppendingArray:(PBArray *)array;
@@ -74,15 +110,43 @@ typedef enum _PBArrayValueType
 + (id)arrayWithValueType:(PBArrayValueType)valueType;
 + (id)arrayWithValues:(const void *)values count:(NSUInteger)count valueType:(PBArrayValueType)valueType;
 + (id)arrayWithArray:(NSArray *)array valueType:(PBArrayValueType)valueType;
++ (id)arrayWithBytesNoCopy:(void *)bytes count:(NSUInteger)count valueType:(PBArrayValueType)valueType
+			   deallocator:(void (^)(void *bytes, NSUInteger length))deallocator;
++ (id)arrayWithData:(NSData *)data valueType:(PBArrayValueType)valueType;
++ (id)arrayWithStorageOfArray:(PBArray *)array;
 - (id)initWithValueType:(PBArrayValueType)valueType;
 - (id)initWithValues:(const void *)values count:(NSUInteger)count valueType:(PBArrayValueType)valueType;
 - (id)initWithArray:(NSArray *)array valueType:(PBArrayValueType)valueType;
 
+// Wraps count values of memory owned by the caller, such as an mmapped region
+// or a numeric library's buffer, without copying them.  The deallocator is
+// called once the last array sharing the memory lets go of it; pass nil if
+// the memory outlives every array that uses it.  Appending to the array first
+// moves its values into storage of its own.  Object values aren't supported.
+- (id)initWithBytesNoCopy:(void *)bytes count:(NSUInteger)count valueType:(PBArrayValueType)valueType
+			  deallocator:(void (^)(void *bytes, NSUInteger length))deallocator;
+
+// Wraps the bytes of data (retaining it) in the same way.
+- (id)initWithData:(NSData *)data valueType:(PBArrayValueType)valueType;
+
+// Shares the storage of another array, in the same way as copy does, but
+// returns an instance of the receiving class.  This lets a plain PBArray,
+// such as a no-copy one, be adopted by one of the typed arrays below.
+- (id)initWithStorageOfArray:(PBArray *)array;
+
 @end
 
 // PBAppendableArray extends PBArray with the ability to append new values to
-// the end of the array.
+// the end of the array.  The first few values are stored inline in the array
+// object itself (as many as fit in PBAppendableArrayInlineSize bytes for the
+// array's value type); storage only moves to the heap once that is exceeded.
+#define PBAppendableArrayInlineSize 32
+
 @interface PBAppendableArray : PBArray
+{
+@private
+	uint64_t			_inlineData[PBAppendableArrayInlineSize / sizeof(uint64_t)];
+}
 
 - (void)addObject:(id)value;
 - (void)addBool:(BOOL)value;
@@ -96,4 +160,105 @@ typedef enum _PBArrayValueType
 - (void)appendArray:(PBArray *)array;
 - (void)appendValues:(const void *)values count:(NSUInteger)count;
 
+// Grows the array's storage to hold at least capacity values without any
+// further reallocation.  Never shrinks it.
+- (void)reserveCapacity:(NSUInteger)capacity;
+
+// As above, but an empty array of scalar values takes its storage from the
+// arena, if one is given.  Arena storage can't grow, so an append beyond the
+// reserved capacity moves the values back to the heap.
+- (void)reserveCapacity:(NSUInteger)capacity inArena:(PBArena *)arena;
+
+// Releases any storage beyond the array's current count.
+- (void)shrinkToFit;
+
+// Empties the array.  Storage the array owns outright keeps its capacity for
+// the values added next; shared, no-copy and arena storage is let go of.
+- (void)removeAllValues;
+
 @end
+
+// Empties an array for its owner without touching anyone else's view of it.
+// Takes over the caller's reference to array and returns, at +1, an empty
+// array of the same class to use in its place.  If nothing else held array,
+// the new array keeps its storage and capacity; otherwise array keeps its
+// values and the new array starts out small.  Returns nil for nil.
+extern id PBAppendableArrayReuse(PBAppendableArray *array);
+
+// Typed arrays fix their value type at compile time.  Their valueAtIndex: and
+// addValue: methods skip the value type checks, and the inline functions
+// declared with each class reduce to a bounds check and a load, or to a
+// capacity check and a store.  They are created with +array or any of the
+// PBArray creation methods given the matching value type.
+@interface PBBoolArray : PBAppendableArray
++ (id)array;
+- (BOOL)valueAtIndex:(NSUInteger)index;
+- (void)addValue:(BOOL)value;
+@end
+
+@interface PBInt32Array : PBAppendableArray
++ (id)array;
+- (int32_t)valueAtIndex:(NSUInteger)index;
+- (void)addValue:(int32_t)value;
+@end
+
+@interface PBUInt32Array : PBAppendableArray
++ (id)array;
+- (uint32_t)valueAtIndex:(NSUInteger)index;
+- (void)addValue:(uint32_t)value;
+@end
+
+@interface PBInt64Array : PBAppendableArray
++ (id)array;
+- (int64_t)valueAtIndex:(NSUInteger)index;
+- (void)addValue:(int64_t)value;
+@end
+
+@interface PBUInt64Array : PBAppendableArray
++ (id)array;
+- (uint64_t)valueAtIndex:(NSUInteger)index;
+- (void)addValue:(uint64_t)value;
+@end
+
+@interface PBFloatArray : PBAppendableArray
++ (id)array;
+- (Float32)valueAtIndex:(NSUInteger)index;
+- (void)addValue:(Float32)value;
+@end
+
+@interface PBDoubleArray : PBAppendableArray
++ (id)array;
+- (Float64)valueAtIndex:(NSUInteger)index;
+- (void)addValue:(Float64)value;
+@end
+
+@interface PBObjectArray : PBAppendableArray
++ (id)array;
+- (id)valueAtIndex:(NSUInteger)index;
+- (void)addValue:(id)value;
+@end
+
+// A nil array behaves as an empty one: reading from it raises NSRangeException.
+#define PBArrayDefineInlineAccessors(name, type, retainValue) \
+	static inline type name##ValueAtIndex(name *array, NSUInteger index) \
+	{ \
+		const NSUInteger count = array ? array->_count : 0; \
+		if (__builtin_expect(index >= count, 0)) PBArrayRaiseRangeException(index, count); \
+		return ((type *)array->_data)[index]; \
+	} \
+	static inline void name##AddValue(name *array, type value) \
+	{ \
+		if (__builtin_expect(array->_count < array->_capacity && array->_shareCount == NULL, 1)) \
+			((type *)array->_data)[array->_count++] = retainValue; \
+		else \
+			[array addValue:value]; \
+	}
+
+PBArrayDefineInlineAccessors(PBBoolArray, BOOL, value)
+PBArrayDefineInlineAccessors(PBInt32Array, int32_t, value)
+PBArrayDefineInlineAccessors(PBUInt32Array, uint32_t, value)
+PBArrayDefineInlineAccessors(PBInt64Array, int64_t, value)
+PBArrayDefineInlineAccessors(PBUInt64Array, uint64_t, value)
+PBArrayDefineInlineAccessors(PBFloatArray, Float32, value)
+PBArrayDefineInlineAccessors(PBDoubleArray, Float64, value)
+PBArrayDefineInlineAccessors(PBObjectArray, id, [value retain])
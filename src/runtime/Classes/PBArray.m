@@ -18,10 +18,19 @@
 
 #import "PBArray.h"
 
+#import "Arena.h"
+
+#import <libkern/OSAtomic.h>
+
 NSString * const PBArrayTypeMismatchException = @"PBArrayTypeMismatchException";
 NSString * const PBArrayNumberExpectedException = @"PBArrayNumberExpectedException";
 NSString * const PBArrayAllocationFailureException = @"PBArrayAllocationFailureException";
 
+void PBArrayRaiseRangeException(NSUInteger index, NSUInteger count)
+{
+	[NSException raise:NSRangeException format:@"index (%lu) beyond bounds (%lu)", (unsigned long)index, (unsigned long)count];
+}
+
 #pragma mark NSNumber Setters
 
 typedef void (*PBArrayValueSetter)(NSNumber *number, void *value);
@@ -99,19 +108,228 @@ static PBArrayValueTypeInfo PBValueTypes[] =
 
 #define PBArrayValueRangeAssert(index) \
 	if (__builtin_expect(index >= _count, 0)) \
-		[NSException raise:NSRangeException format: @"index (%u) beyond bounds (%u)", index, _count];
+		[NSException raise:NSRangeException format: @"index (%lu) beyond bounds (%lu)", (unsigned long)index, (unsigned long)_count];
 
 #define PBArrayNumberAssert(value) \
 	if (__builtin_expect(![value isKindOfClass:[NSNumber class]], 0)) \
 		[NSException raise:PBArrayNumberExpectedException format:@"NSNumber expected (got '%@')", [value class]];
 
+#define PBArrayEnumerateValues(type, block) \
+	BOOL stop = NO; \
+	for (NSUInteger i = 0; i < _count && !stop; ++i) block(((type *)_data)[i], i, &stop);
+
 #define PBArrayAllocationAssert(p, size) \
 	if (__builtin_expect(p == NULL, 0)) \
 		[NSException raise:PBArrayAllocationFailureException format:@"failed to allocate %lu bytes", size];
 
+#define PBArrayCapacityAssert(capacity, elementSize) \
+	if (__builtin_expect((capacity) > SIZE_MAX / (elementSize), 0)) \
+		[NSException raise:PBArrayAllocationFailureException \
+					format:@"capacity (%lu) overflows the storage size", (unsigned long)(capacity)];
+
+#pragma mark Shared Storage
+
+// Registers one more owner of the storage guarded by *shareCount, creating the
+// count (starting at one owner) the first time the storage is shared.
+static void PBArrayRetainShare(volatile int32_t **shareCount)
+{
+	if (*shareCount == NULL)
+	{
+		int32_t *count = malloc(sizeof(int32_t));
+		PBArrayAllocationAssert(count, sizeof(int32_t));
+		*count = 1;
+		if (!OSAtomicCompareAndSwapPtrBarrier(NULL, count, (void * volatile *)shareCount))
+		{
+			free(count);
+		}
+	}
+	OSAtomicIncrement32Barrier(*shareCount);
+}
+
+// Drops one owner of shared storage.  Returns YES if the caller was the last
+// owner, in which case the storage (and its object references) now belong to
+// it exclusively.
+static BOOL PBArrayReleaseShare(volatile int32_t **shareCount)
+{
+	if (*shareCount == NULL)
+	{
+		return YES;
+	}
+
+	BOOL last = (OSAtomicDecrement32Barrier(*shareCount) == 0);
+	if (last)
+	{
+		free((void *)*shareCount);
+	}
+	*shareCount = NULL;
+	return last;
+}
+
+#pragma mark Equality and Hashing
+
+// The comparison loops below check a fixed-size block of elements at a time
+// and fold the results together without branching, which the compiler turns
+// into vector compares.  Floating point values are compared with ==, so NaN
+// is never equal to anything and 0.0 equals -0.0.
+#define PBArrayCompareBlockSize 8
+
+#define PBArrayDefineEqualFunction(name, type) \
+	static BOOL name(const type *a, const type *b, NSUInteger count) \
+	{ \
+		NSUInteger i = 0; \
+		for (; i + PBArrayCompareBlockSize <= count; i += PBArrayCompareBlockSize) \
+		{ \
+			int equal = 1; \
+			for (NSUInteger j = 0; j < PBArrayCompareBlockSize; ++j) equal &= (a[i + j] == b[i + j]); \
+			if (!equal) return NO; \
+		} \
+		for (; i < count; ++i) if (!(a[i] == b[i])) return NO; \
+		return YES; \
+	}
+
+PBArrayDefineEqualFunction(PBArrayEqualFloats, Float32)
+PBArrayDefineEqualFunction(PBArrayEqualDoubles, Float64)
+
+static BOOL PBArrayEqualObjects(const id *a, const id *b, NSUInteger count)
+{
+	for (NSUInteger i = 0; i < count; ++i)
+	{
+		if (a[i] != b[i] && ![a[i] isEqual:b[i]]) return NO;
+	}
+	return YES;
+}
+
+// A 64-bit hash in the style of xxHash64: four independent lanes consume
+// 32-byte stripes, so the main loop vectorizes (or at least pipelines).
+#define PBArrayHashPrime1 0x9E3779B185EBCA87ULL
+#define PBArrayHashPrime2 0xC2B2AE3D27D4EB4FULL
+#define PBArrayHashPrime3 0x165667B19E3779F9ULL
+#define PBArrayHashPrime4 0x85EBCA77C2B2AE63ULL
+#define PBArrayHashPrime5 0x27D4EB2F165667C5ULL
+
+#define PBArrayHashRotate(x, r) (((x) << (r)) | ((x) >> (64 - (r))))
+
+static inline uint64_t PBArrayHashRound(uint64_t acc, uint64_t input)
+{
+	acc += input * PBArrayHashPrime2;
+	acc = PBArrayHashRotate(acc, 31);
+	return acc * PBArrayHashPrime1;
+}
+
+static inline uint64_t PBArrayHashMergeRound(uint64_t acc, uint64_t lane)
+{
+	acc ^= PBArrayHashRound(0, lane);
+	return acc * PBArrayHashPrime1 + PBArrayHashPrime4;
+}
+
+static inline uint64_t PBArrayHashAvalanche(uint64_t h)
+{
+	h ^= h >> 33;
+	h *= PBArrayHashPrime2;
+	h ^= h >> 29;
+	h *= PBArrayHashPrime3;
+	h ^= h >> 32;
+	return h;
+}
+
+static inline uint64_t PBArrayHashRead64(const uint8_t *p)
+{
+	uint64_t value;
+	memcpy(&value, p, sizeof(value));
+	return value;
+}
+
+static uint64_t PBArrayHashBytes(const void *data, size_t length, uint64_t seed)
+{
+	const uint8_t *p = (const uint8_t *)data;
+	const uint8_t *end = p + length;
+	uint64_t h;
+
+	if (length >= 32)
+	{
+		uint64_t v1 = seed + PBArrayHashPrime1 + PBArrayHashPrime2;
+		uint64_t v2 = seed + PBArrayHashPrime2;
+		uint64_t v3 = seed;
+		uint64_t v4 = seed - PBArrayHashPrime1;
+
+		for (; p + 32 <= end; p += 32)
+		{
+			v1 = PBArrayHashRound(v1, PBArrayHashRead64(p));
+			v2 = PBArrayHashRound(v2, PBArrayHashRead64(p + 8));
+			v3 = PBArrayHashRound(v3, PBArrayHashRead64(p + 16));
+			v4 = PBArrayHashRound(v4, PBArrayHashRead64(p + 24));
+		}
+
+		h = PBArrayHashRotate(v1, 1) + PBArrayHashRotate(v2, 7) + PBArrayHashRotate(v3, 12) + PBArrayHashRotate(v4, 18);
+		h = PBArrayHashMergeRound(h, v1);
+		h = PBArrayHashMergeRound(h, v2);
+		h = PBArrayHashMergeRound(h, v3);
+		h = PBArrayHashMergeRound(h, v4);
+	}
+	else
+	{
+		h = seed + PBArrayHashPrime5;
+	}
+
+	h += (uint64_t)length;
+
+	for (; p + 8 <= end; p += 8)
+	{
+		h ^= PBArrayHashRound(0, PBArrayHashRead64(p));
+		h = PBArrayHashRotate(h, 27) * PBArrayHashPrime1 + PBArrayHashPrime4;
+	}
+	for (; p < end; ++p)
+	{
+		h ^= (*p) * PBArrayHashPrime5;
+		h = PBArrayHashRotate(h, 11) * PBArrayHashPrime1;
+	}
+
+	return PBArrayHashAvalanche(h);
+}
+
+// Floating point values are hashed in blocks after mapping -0.0 to 0.0, so
+// that values that compare equal also hash equally.
+#define PBArrayHashBlockSize 64
+
+#define PBArrayDefineFloatHashFunction(name, type) \
+	static uint64_t name(const type *values, NSUInteger count, uint64_t seed) \
+	{ \
+		type block[PBArrayHashBlockSize]; \
+		uint64_t h = seed; \
+		for (NSUInteger i = 0; i < count; i += PBArrayHashBlockSize) \
+		{ \
+			const NSUInteger n = MIN(count - i, (NSUInteger)PBArrayHashBlockSize); \
+			for (NSUInteger j = 0; j < n; ++j) block[j] = values[i + j] == 0 ? 0 : values[i + j]; \
+			h = PBArrayHashBytes(block, n * sizeof(type), h); \
+		} \
+		return h; \
+	}
+
+PBArrayDefineFloatHashFunction(PBArrayHashFloats, Float32)
+PBArrayDefineFloatHashFunction(PBArrayHashDoubles, Float64)
+
+static uint64_t PBArrayHashObjects(const id *values, NSUInteger count, uint64_t seed)
+{
+	uint64_t h = seed + PBArrayHashPrime5 + (uint64_t)count;
+	for (NSUInteger i = 0; i < count; ++i)
+	{
+		h ^= PBArrayHashRound(0, (uint64_t)[values[i] hash]);
+		h = PBArrayHashRotate(h, 27) * PBArrayHashPrime1 + PBArrayHashPrime4;
+	}
+	return PBArrayHashAvalanche(h);
+}
+
+// Runs an array's no-copy deallocator over its values.
+#define PBArrayDeallocateBytes(data, count) \
+	_deallocator(data, count * PBArrayValueTypeSize(_valueType))
+
 #pragma mark -
 #pragma mark PBArray
 
+@interface PBArray ()
+- (BOOL)hasShareableStorage;
+@end
+
 @implementation PBArray
 
 @synthesize valueType = _valueType;
@@ -141,27 +359,33 @@ static PBArrayValueTypeInfo PBValueTypes[] =
 
 - (id)copyWithZone:(NSZone *)zone
 {
-	PBArray *copy = [[[self class] allocWithZone:zone] initWithCount:_count valueType:_valueType];
-	if (copy)
-	{
-		memcpy(copy->_data, _data, _count * PBArrayValueTypeSize(_valueType));
-		PBArrayForEachObject(_data, _count, retain);
-	}
-
-	return copy;
+	return [[[self class] allocWithZone:zone] initWithStorageOfArray:self];
 }
 
 - (void)dealloc
 {
-	if (_data)
+	if ((_data || _deallocator) && PBArrayReleaseShare(&_shareCount))
 	{
-		PBArrayForEachObject(_data, _count, release);
-		free(_data);
+		if (_deallocator)
+		{
+			PBArrayDeallocateBytes(_data, _count);
+		}
+		else
+		{
+			PBArrayForEachObject(_data, _count, release);
+			free(_data);
+		}
 	}
+	[_deallocator release];
 
 	[super dealloc];
 }
 
+- (BOOL)hasShareableStorage
+{
+	return YES;
+}
+
 - (NSString *)description
 {
 	return [NSString stringWithFormat:@"<%@ %p>{valueType = %d, count = %d, capacity = %d, data = %p}",
@@ -259,13 +483,26 @@ static PBArrayValueTypeInfo PBValueTypes[] =
 	{
 		return YES;
 	}
-	else if (array->_count != _count)
+	else if (array == nil)
+	{
+		return _count == 0;
+	}
+	else if (array->_count != _count || array->_valueType != _valueType)
 	{
 		return NO;
 	}
-	else
+
+	switch (_valueType)
 	{
-		return memcmp(array->_data, _data, _count * PBArrayValueTypeSize(_valueType)) == 0;
+		case PBArrayValueTypeObject:
+			return PBArrayEqualObjects((const id *)_data, (const id *)array->_data, _count);
+		case PBArrayValueTypeFloat:
+			return PBArrayEqualFloats((const Float32 *)_data, (const Float32 *)array->_data, _count);
+		case PBArrayValueTypeDouble:
+			return PBArrayEqualDoubles((const Float64 *)_data, (const Float64 *)array->_data, _count);
+		default:
+			return array->_data == _data ||
+				memcmp(array->_data, _data, _count * PBArrayValueTypeSize(_valueType)) == 0;
 	}
 }
 
@@ -279,6 +516,97 @@ static PBArrayValueTypeInfo PBValueTypes[] =
 	return equal;
 }
 
+- (uint64_t)hash64
+{
+	// Empty arrays hash like a nil array would.
+	if (_count == 0)
+	{
+		return 0;
+	}
+
+	const uint64_t seed = PBArrayHashPrime5 * (uint64_t)_valueType;
+
+	switch (_valueType)
+	{
+		case PBArrayValueTypeObject:
+			return PBArrayHashObjects((const id *)_data, _count, seed);
+		case PBArrayValueTypeFloat:
+			return PBArrayHashFloats((const Float32 *)_data, _count, seed);
+		case PBArrayValueTypeDouble:
+			return PBArrayHashDoubles((const Float64 *)_data, _count, seed);
+		default:
+			return PBArrayHashBytes(_data, _count * PBArrayValueTypeSize(_valueType), seed);
+	}
+}
+
+- (NSUInteger)hash
+{
+	return (NSUInteger)[self hash64];
+}
+
+@end
+
+@implementation PBArray (PBArrayEnumeration)
+
+- (void)enumerateObjectsUsingBlock:(void (^)(id obj, NSUInteger idx, BOOL *stop))block
+{
+	PBArrayValueTypeAssert(PBArrayValueTypeObject);
+	PBArrayEnumerateValues(id, block);
+}
+
+- (void)enumerateBoolsUsingBlock:(void (^)(BOOL value, NSUInteger idx, BOOL *stop))block
+{
+	PBArrayValueTypeAssert(PBArrayValueTypeBool);
+	PBArrayEnumerateValues(BOOL, block);
+}
+
+- (void)enumerateInt32sUsingBlock:(void (^)(int32_t value, NSUInteger idx, BOOL *stop))block
+{
+	PBArrayValueTypeAssert(PBArrayValueTypeInt32);
+	PBArrayEnumerateValues(int32_t, block);
+}
+
+- (void)enumerateUint32sUsingBlock:(void (^)(uint32_t value, NSUInteger idx, BOOL *stop))block
+{
+	PBArrayValueTypeAssert(PBArrayValueTypeUInt32);
+	PBArrayEnumerateValues(uint32_t, block);
+}
+
+- (void)enumerateInt64sUsingBlock:(void (^)(int64_t value, NSUInteger idx, BOOL *stop))block
+{
+	PBArrayValueTypeAssert(PBArrayValueTypeInt64);
+	PBArrayEnumerateValues(int64_t, block);
+}
+
+- (void)enumerateUint64sUsingBlock:(void (^)(uint64_t value, NSUInteger idx, BOOL *stop))block
+{
+	PBArrayValueTypeAssert(PBArrayValueTypeUInt64);
+	PBArrayEnumerateValues(uint64_t, block);
+}
+
+- (void)enumerateFloatsUsingBlock:(void (^)(Float32 value, NSUInteger idx, BOOL *stop))block
+{
+	PBArrayValueTypeAssert(PBArrayValueTypeFloat);
+	PBArrayEnumerateValues(Float32, block);
+}
+
+- (void)enumerateDoublesUsingBlock:(void (^)(Float64 value, NSUInteger idx, BOOL *stop))block
+{
+	PBArrayValueTypeAssert(PBArrayValueTypeDouble);
+	PBArrayEnumerateValues(Float64, block);
+}
+
+- (void)enumerateRangesUsingBlock:(void (^)(const void *values, NSRange range, BOOL *stop))block
+{
+	// Our storage is a single contiguous buffer, so there is only ever one
+	// range to hand out.  Callers must still be prepared for several.
+	if (_count > 0)
+	{
+		BOOL stop = NO;
+		block(_data, NSMakeRange(0, _count), &stop);
+	}
+}
+
 @end
 
 @implementation PBArray (PBArrayExtended)
@@ -321,6 +649,22 @@ static PBArrayValueTypeInfo PBValueTypes[] =
 	return [[[self alloc] initWithArray:array valueType:valueType] autorelease];
 }
 
++ (id)arrayWithBytesNoCopy:(void *)bytes count:(NSUInteger)count valueType:(PBArrayValueType)valueType
+			   deallocator:(void (^)(void *bytes, NSUInteger length))deallocator
+{
+	return [[[self alloc] initWithBytesNoCopy:bytes count:count valueType:valueType deallocator:deallocator] autorelease];
+}
+
++ (id)arrayWithData:(NSData *)data valueType:(PBArrayValueType)valueType
+{
+	return [[[self alloc] initWithData:data valueType:valueType] autorelease];
+}
+
++ (id)arrayWithStorageOfArray:(PBArray *)array
+{
+	return [[[self alloc] initWithStorageOfArray:array] autorelease];
+}
+
 - (id)initWithValueType:(PBArrayValueType)valueType
 {
 	return [self initWithCount:0 valueType:valueType];
@@ -337,6 +681,79 @@ static PBArrayValueTypeInfo PBValueTypes[] =
 	return self;
 }
 
+- (id)initWithBytesNoCopy:(void *)bytes count:(NSUInteger)count valueType:(PBArrayValueType)valueType
+			  deallocator:(void (^)(void *bytes, NSUInteger length))deallocator
+{
+	if (valueType == PBArrayValueTypeObject)
+	{
+		[self release];
+		[NSException raise:PBArrayTypeMismatchException
+					format:@"no-copy arrays can't hold object values"];
+	}
+
+	if ((self = [self initWithCount:0 valueType:valueType]))
+	{
+		// The capacity is exactly the count, so the first append always goes
+		// through ensureAdditionalCapacity: and moves the values out.
+		_data = bytes;
+		_count = count;
+		_capacity = count;
+		_deallocator = deallocator ? [deallocator copy] : [^(void *unused, NSUInteger length) {} copy];
+	}
+
+	return self;
+}
+
+- (id)initWithData:(NSData *)data valueType:(PBArrayValueType)valueType
+{
+	// Reject object arrays here rather than in initWithBytesNoCopy:, which
+	// would raise after data had been retained for the deallocator.
+	if (valueType == PBArrayValueTypeObject)
+	{
+		[self release];
+		[NSException raise:PBArrayTypeMismatchException
+					format:@"no-copy arrays can't hold object values"];
+	}
+
+	const size_t elementSize = PBArrayValueTypeSize(valueType);
+	if (data.length % elementSize != 0)
+	{
+		[self release];
+		[NSException raise:NSInvalidArgumentException
+					format:@"data length (%lu) is not a multiple of the value size (%lu)",
+						   (unsigned long)data.length, (unsigned long)elementSize];
+	}
+
+	[data retain];
+	return [self initWithBytesNoCopy:(void *)data.bytes
+							   count:data.length / elementSize
+						   valueType:valueType
+						 deallocator:^(void *bytes, NSUInteger length) { [data release]; }];
+}
+
+- (id)initWithStorageOfArray:(PBArray *)array
+{
+	// Values that live inside the other array object can't be shared.
+	if (![array hasShareableStorage])
+	{
+		return [self initWithValues:array->_data count:array->_count valueType:array->_valueType];
+	}
+
+	if ((self = [self initWithCount:0 valueType:array->_valueType]) && array->_count)
+	{
+		// The shared storage holds a single reference to each object value,
+		// which is released by whichever owner lets go of it last.
+		PBArrayRetainShare(&array->_shareCount);
+		_data = array->_data;
+		_count = array->_count;
+		_capacity = array->_count;
+		_shareCount = array->_shareCount;
+		_deallocator = [array->_deallocator copy];
+	}
+
+	return self;
+}
+
 - (id)initWithArray:(NSArray *)array valueType:(PBArrayValueType)valueType
 {
 	if ((self = [self initWithCount:[array count] valueType:valueType]))
@@ -369,39 +786,258 @@ static PBArrayValueTypeInfo PBValueTypes[] =
 
 @end
 
+@interface PBAppendableArray ()
+- (void)ensureAdditionalCapacity:(NSUInteger)additionalSlots;
+@end
+
 #pragma mark -
 #pragma mark PBAppendableArray
 
 @implementation PBAppendableArray
 
+- (id)initWithCount:(NSUInteger)count valueType:(PBArrayValueType)valueType
+{
+	const NSUInteger inlineSlots = sizeof(_inlineData) / PBArrayValueTypeSize(valueType);
+	if (count > inlineSlots)
+	{
+		return [super initWithCount:count valueType:valueType];
+	}
+
+	if ((self = [super initWithCount:0 valueType:valueType]))
+	{
+		_count = count;
+		_capacity = inlineSlots;
+		_data = _inlineData;
+	}
+
+	return self;
+}
+
+- (BOOL)hasShareableStorage
+{
+	// Inline values live inside this object, so they can't be shared.
+	return _data != _inlineData;
+}
+
+- (void)dealloc
+{
+	// Release any inline objects here and hide the inline buffer from
+	// PBArray, which would otherwise try to free() it.
+	if (_data == _inlineData)
+	{
+		PBArrayForEachObject(_data, _count, release);
+		_data = NULL;
+	}
+
+	[super dealloc];
+}
+
+- (void)setCapacity:(NSUInteger)capacity
+{
+	const NSUInteger inlineSlots = sizeof(_inlineData) / PBArrayValueTypeSize(_valueType);
+	const size_t elementSize = PBArrayValueTypeSize(_valueType);
+
+	if (capacity <= inlineSlots)
+	{
+		// Move any heap values back into the inline buffer.
+		if (_data != _inlineData)
+		{
+			if (_data)
+			{
+				memcpy(_inlineData, _data, _count * elementSize);
+				free(_data);
+			}
+			_data = _inlineData;
+		}
+		_capacity = inlineSlots;
+	}
+	else
+	{
+		PBArrayCapacityAssert(capacity, elementSize);
+		const size_t size = capacity * elementSize;
+		if (_data == _inlineData)
+		{
+			// Spill the inline values over to the heap.
+			void *data = malloc(size);
+			PBArrayAllocationAssert(data, size);
+			memcpy(data, _inlineData, _count * elementSize);
+			_data = data;
+		}
+		else
+		{
+			_data = reallocf(_data, size);
+			PBArrayAllocationAssert(_data, size);
+		}
+		_capacity = capacity;
+	}
+}
+
+// Must be called before any mutation.  If our storage is still shared with
+// other arrays, or isn't ours at all (no-copy storage), take a private copy of
+// it with room for at least capacity values.
+- (void)detachSharedStorageWithCapacity:(NSUInteger)capacity
+{
+	// Storage we don't share can still be written in place, as long as it
+	// doesn't have to grow.
+	if (_shareCount == NULL && (_deallocator == nil || capacity <= _capacity))
+	{
+		return;
+	}
+
+	// Check before giving up our share, so that a failure leaves us intact.
+	PBArrayCapacityAssert(capacity, PBArrayValueTypeSize(_valueType));
+
+	const BOOL last = PBArrayReleaseShare(&_shareCount);
+	if (last && _deallocator == nil)
+	{
+		return;
+	}
+
+	const void *shared = _data;
+	const NSUInteger inlineSlots = sizeof(_inlineData) / PBArrayValueTypeSize(_valueType);
+	const size_t elementSize = PBArrayValueTypeSize(_valueType);
+
+	capacity = MAX(capacity, _count);
+	if (capacity <= inlineSlots)
+	{
+		_data = _inlineData;
+		_capacity = inlineSlots;
+	}
+	else
+	{
+		const size_t size = capacity * elementSize;
+		_data = malloc(size);
+		PBArrayAllocationAssert(_data, size);
+		_capacity = capacity;
+	}
+
+	memcpy(_data, shared, _count * elementSize);
+	PBArrayForEachObject(_data, _count, retain);
+
+	if (_deallocator)
+	{
+		if (last)
+		{
+			PBArrayDeallocateBytes((void *)shared, _count);
+		}
+		[_deallocator release];
+		_deallocator = nil;
+	}
+}
+
 - (void)ensureAdditionalCapacity:(NSUInteger)additionalSlots
 {
 	const NSUInteger requiredSlots = _count + additionalSlots;
+	[self detachSharedStorageWithCapacity:requiredSlots];
 
 	if (requiredSlots > _capacity)
 	{
 		// If we haven't allocated any capacity yet, simply reserve
 		// enough capacity to cover the required number of slots.
-		if (_capacity == 0)
+		NSUInteger capacity = _capacity;
+		if (capacity == 0)
 		{
-			_capacity = requiredSlots;
+			capacity = requiredSlots;
 		}
 		else
 		{
 			// Otherwise, continue to double our capacity until we
 			// can accomodate the required number of slots.
-			while (_capacity < requiredSlots)
+			while (capacity < requiredSlots)
 			{
-				_capacity *= 2;
+				capacity *= 2;
 			}
 		}
 
-		const size_t size = _capacity * PBArrayValueTypeSize(_valueType);
-		_data = reallocf(_data, size);
-		PBArrayAllocationAssert(_data, size);
+		[self setCapacity:capacity];
+	}
+}
+
+- (void)reserveCapacity:(NSUInteger)capacity
+{
+	[self detachSharedStorageWithCapacity:capacity];
+	if (capacity > _capacity)
+	{
+		[self setCapacity:capacity];
 	}
 }
 
+- (void)reserveCapacity:(NSUInteger)capacity inArena:(PBArena *)arena
+{
+	if (arena == nil || _count > 0 || capacity <= _capacity || _valueType == PBArrayValueTypeObject ||
+		_shareCount != NULL || _deallocator != nil)
+	{
+		[self reserveCapacity:capacity];
+		return;
+	}
+
+	const size_t elementSize = PBArrayValueTypeSize(_valueType);
+	PBArrayCapacityAssert(capacity, elementSize);
+
+	if (_data != _inlineData)
+	{
+		free(_data);
+	}
+	_data = [arena allocate:capacity * elementSize];
+	_capacity = capacity;
+	_deallocator = [arena newDeallocator];
+}
+
+- (void)shrinkToFit
+{
+	// Shared storage is already exactly as large as its owners need, and
+	// storage that isn't ours (no-copy or arena) can't be resized.
+	if (_capacity > _count && _data != _inlineData && _shareCount == NULL && _deallocator == nil)
+	{
+		[self setCapacity:_count];
+	}
+}
+
+- (void)removeAllValues
+{
+	const BOOL owned = PBArrayReleaseShare(&_shareCount);
+	if (owned && _deallocator == nil)
+	{
+		PBArrayForEachObject(_data, _count, release);
+	}
+	else
+	{
+		if (owned)
+		{
+			PBArrayDeallocateBytes(_data, _count);
+		}
+		[_deallocator release];
+		_deallocator = nil;
+		_data = _inlineData;
+		_capacity = sizeof(_inlineData) / PBArrayValueTypeSize(_valueType);
+	}
+	_count = 0;
+}
+
+id PBAppendableArrayReuse(PBAppendableArray *array)
+{
+	if (array == nil)
+	{
+		return nil;
+	}
+
+	PBAppendableArray *reused = [[[array class] alloc] initWithCount:0 valueType:array->_valueType];
+	if (array->_data != NULL && [array hasShareableStorage] && array->_deallocator == nil)
+	{
+		// Share the storage, capacity and all, before letting go of array.  If
+		// that was the last reference to it, removeAllValues finds the
+		// storage ours alone and keeps it; if not, it lets go of it.
+		PBArrayRetainShare(&array->_shareCount);
+		reused->_data = array->_data;
+		reused->_count = array->_count;
+		reused->_capacity = array->_capacity;
+		reused->_shareCount = array->_shareCount;
+	}
+	[array release];
+	[reused removeAllValues];
+	return reused;
+}
+
 - (void)addObject:(id)value
 {
 	PBArrayValueTypeAssert(PBArrayValueTypeObject);
@@ -490,3 +1126,47 @@ static PBArrayValueTypeInfo PBValueTypes[] =
 }
 
 @end
+
+#pragma mark -
+#pragma mark Typed Arrays
+
+#define PBArrayDefineTypedArray(name, type, arrayValueType, retainValue) \
+	@implementation name \
+	+ (id)array \
+	{ \
+		return [[[self alloc] init] autorelease]; \
+	} \
+	- (id)init \
+	{ \
+		return [self initWithCount:0 valueType:arrayValueType]; \
+	} \
+	- (id)initWithCount:(NSUInteger)count valueType:(PBArrayValueType)type_ \
+	{ \
+		if (__builtin_expect(type_ != arrayValueType, 0)) \
+		{ \
+			[self release]; \
+			[NSException raise:PBArrayTypeMismatchException \
+						format:@"array value type mismatch (expected '%s')", #arrayValueType]; \
+		} \
+		return [super initWithCount:count valueType:type_]; \
+	} \
+	- (type)valueAtIndex:(NSUInteger)index \
+	{ \
+		PBArrayValueRangeAssert(index); \
+		return ((type *)_data)[index]; \
+	} \
+	- (void)addValue:(type)value \
+	{ \
+		[self ensureAdditionalCapacity:1]; \
+		((type *)_data)[_count++] = retainValue; \
+	} \
+	@end
+
+PBArrayDefineTypedArray(PBBoolArray, BOOL, PBArrayValueTypeBool, value)
+PBArrayDefineTypedArray(PBInt32Array, int32_t, PBArrayValueTypeInt32, value)
+PBArrayDefineTypedArray(PBUInt32Array, uint32_t, PBArrayValueTypeUInt32, value)
+PBArrayDefineTypedArray(PBInt64Array, int64_t, PBArrayValueTypeInt64, value)
+PBArrayDefineTypedArray(PBUInt64Array, uint64_t, PBArrayValueTypeUInt64, value)
+PBArrayDefineTypedArray(PBFloatArray, Float32, PBArrayValueTypeFloat, value)
+PBArrayDefineTypedArray(PBDoubleArray, Float64, PBArrayValueTypeDouble, value)
+PBArrayDefineTypedArray(PBObjectArray, id, PBArrayValueTypeObject, [value retain])
@@ -19,16 +19,20 @@
 
 #import "AbstractMessage.h"
 #import "AbstractMessage_Builder.h"
+#import "Arena.h"
 #import "CodedInputStream.h"
 #import "CodedOutputStream.h"
 #import "ConcreteExtensionField.h"
+#import "DeflateOutputStream.h"
 #import "ExtendableMessage.h"
 #import "ExtendableMessage_Builder.h"
 #import "ExtensionField.h"
 #import "ExtensionRegistry.h"
 #import "Field.h"
+#import "FieldTable.h"
 #import "GeneratedMessage.h"
 #import "GeneratedMessage_Builder.h"
+#import "InflateInputStream.h"
 #import "Message.h"
 #import "Message_Builder.h"
 #import "MutableExtensionRegistry.h"
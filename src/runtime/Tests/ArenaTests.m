@@ -0,0 +1,104 @@
+// Protocol Buffers for Objective C
+//
+// Copyright 2010 Booyah Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import "ArenaTests.h"
+
+#import "TestUtilities.h"
+#import "Unittest.pb.h"
+
+@implementation ArenaTests
+
+- (void) testAllocate {
+  PBArena* arena = [[PBArena alloc] initWithBlockSize:1024];
+  STAssertEquals([arena size], (NSUInteger)0, @"");
+
+  uint8_t* a = [arena allocate:3];
+  uint8_t* b = [arena allocate:8];
+  STAssertTrue(((uintptr_t)a % 16) == 0, @"");
+  STAssertTrue(((uintptr_t)b % 16) == 0, @"");
+  STAssertEquals(b - a, (ptrdiff_t)16, @"");
+  STAssertEquals([arena size], (NSUInteger)1024, @"");
+
+  // Large allocations get a block of their own.
+  [arena allocate:4096];
+  STAssertEquals((uint8_t*)[arena allocate:1], b + 16, @"");
+  STAssertEquals([arena size], (NSUInteger)(1024 + 4096), @"");
+
+  [arena release];
+}
+
+
+- (void) testStringsOutliveArena {
+  PBArena* arena = [[PBArena alloc] init];
+  const char* utf8 = "caf\xc3\xa9";
+  NSString* string = [[arena stringWithUTF8Bytes:utf8 length:strlen(utf8)] retain];
+  NSData* data = [[arena dataWithBytes:"abc" length:3] retain];
+  [arena release];
+
+  STAssertEqualObjects(string, [NSString stringWithUTF8String:utf8], @"");
+  STAssertEqualObjects(data, [NSData dataWithBytes:"abc" length:3], @"");
+  [string release];
+  [data release];
+}
+
+
+- (void) testArrayStorage {
+  PBArena* arena = [[PBArena alloc] init];
+  PBAppendableArray* array = [[PBAppendableArray alloc] initWithValueType:PBArrayValueTypeInt32];
+  [array reserveCapacity:100 inArena:arena];
+  [arena release];
+
+  for (int32_t i = 0; i < 100; i++) {
+    [array addInt32:i];
+  }
+  [array shrinkToFit];
+  STAssertEquals(array.count, (NSUInteger)100, @"");
+
+  // Growing past the reserved capacity moves the values to the heap.
+  [array addInt32:100];
+  for (int32_t i = 0; i <= 100; i++) {
+    STAssertEquals([array int32AtIndex:i], i, @"");
+  }
+  [array release];
+}
+
+
+- (void) testArrayStorageOverflow {
+  PBArena* arena = [[PBArena alloc] init];
+  PBAppendableArray* array = [[PBAppendableArray alloc] initWithValueType:PBArrayValueTypeDouble];
+  STAssertThrowsSpecificNamed([array reserveCapacity:NSUIntegerMax / 4 inArena:arena],
+                              NSException, PBArrayAllocationFailureException, @"");
+  STAssertEquals(array.count, (NSUInteger)0, @"");
+  [array release];
+  [arena release];
+}
+
+
+- (void) testParseWithArena {
+  PBArena* arena = [PBArena arena];
+  PBCodedInputStream* input = [PBCodedInputStream streamWithData:[[TestUtilities allSet] data]];
+  input.arena = arena;
+
+  TestAllTypes* message = [[[TestAllTypes builder] mergeFromCodedInputStream:input] build];
+  [TestUtilities assertAllFieldsSet:message];
+  STAssertTrue([arena size] > 0, @"");
+
+  input = [PBCodedInputStream streamWithData:[[TestUtilities packedSet] data]];
+  input.arena = arena;
+  [TestUtilities assertPackedFieldsSet:[[[TestPackedTypes builder] mergeFromCodedInputStream:input] build]];
+}
+
+@end
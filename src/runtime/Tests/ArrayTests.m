@@ -104,6 +104,66 @@
 	[array release];
 }
 
+- (void)testPrimitiveBlockEnumeration
+{
+	const int64_t kValues[3] = { 1, -2, 3 };
+	PBArray *array = [[PBArray alloc] initWithValues:kValues count:3 valueType:PBArrayValueTypeInt64];
+
+	__block NSUInteger count = 0;
+	[array enumerateInt64sUsingBlock:^(int64_t value, NSUInteger idx, BOOL *stop) {
+		STAssertEquals(idx, count, nil);
+		STAssertEquals(value, kValues[count++], nil);
+	}];
+	STAssertEquals(count, (NSUInteger)3, nil);
+
+	STAssertThrowsSpecificNamed([array enumerateInt32sUsingBlock:^(int32_t value, NSUInteger idx, BOOL *stop) {}],
+								NSException, PBArrayTypeMismatchException, nil);
+
+	[array release];
+}
+
+- (void)testBlockEnumerationStop
+{
+	const Float64 kValues[3] = { 1.5, 2.5, 3.5 };
+	PBArray *array = [[PBArray alloc] initWithValues:kValues count:3 valueType:PBArrayValueTypeDouble];
+
+	__block NSUInteger count = 0;
+	[array enumerateDoublesUsingBlock:^(Float64 value, NSUInteger idx, BOOL *stop) {
+		count++;
+		*stop = (idx == 1);
+	}];
+	STAssertEquals(count, (NSUInteger)2, nil);
+
+	[array release];
+}
+
+- (void)testRangeEnumeration
+{
+	const uint32_t kValues[4] = { 1, 2, 3, 4 };
+	PBArray *array = [[PBArray alloc] initWithValues:kValues count:4 valueType:PBArrayValueTypeUInt32];
+
+	__block uint32_t sum = 0;
+	__block NSUInteger count = 0;
+	[array enumerateRangesUsingBlock:^(const void *values, NSRange range, BOOL *stop) {
+		STAssertEquals(range.location, count, nil);
+		for (NSUInteger i = 0; i < range.length; ++i)
+		{
+			sum += ((const uint32_t *)values)[i];
+		}
+		count += range.length;
+	}];
+	STAssertEquals(count, (NSUInteger)4, nil);
+	STAssertEquals(sum, (uint32_t)10, nil);
+
+	PBArray *empty = [[PBArray alloc] initWithValueType:PBArrayValueTypeUInt32];
+	[empty enumerateRangesUsingBlock:^(const void *values, NSRange range, BOOL *stop) {
+		STFail(nil);
+	}];
+
+	[empty release];
+	[array release];
+}
+
 - (void)testArrayAppendingArray
 {
 	const int32_t kValues[3] = { 1, 2, 3 };
@@ -191,6 +251,135 @@
 	[array release];
 }
 
+- (void)testInlineStorageSpill
+{
+	PBAppendableArray *array = [[PBAppendableArray alloc] initWithValueType:PBArrayValueTypeInt64];
+	const NSUInteger kCount = PBAppendableArrayInlineSize / sizeof(int64_t) * 4 + 1;
+	for (NSUInteger i = 0; i < kCount; ++i)
+	{
+		[array addInt64:(int64_t)i];
+	}
+	STAssertEquals(array.count, kCount, nil);
+	for (NSUInteger i = 0; i < kCount; ++i)
+	{
+		STAssertEquals([array int64AtIndex:i], (int64_t)i, nil);
+	}
+
+	PBArray *copy = [array copy];
+	STAssertEqualObjects(copy, array, nil);
+	[copy release];
+	[array release];
+}
+
+- (void)testInlineStorageObjects
+{
+	PBAppendableArray *array = [[PBAppendableArray alloc] initWithValueType:PBArrayValueTypeObject];
+	NSObject *value = [[NSObject alloc] init];
+	[array addObject:value];
+	STAssertEquals([value retainCount], (NSUInteger)2, nil);
+
+	PBAppendableArray *copy = [array copy];
+	STAssertEquals([copy objectAtIndex:0], value, nil);
+	STAssertEquals([value retainCount], (NSUInteger)3, nil);
+
+	[copy release];
+	[array release];
+	STAssertEquals([value retainCount], (NSUInteger)1, nil);
+	[value release];
+}
+
+- (void)testReserveCapacity
+{
+	PBAppendableArray *array = [[PBAppendableArray alloc] initWithValueType:PBArrayValueTypeInt32];
+	[array addInt32:7];
+	[array reserveCapacity:100];
+	const void *data = array.data;
+	for (int32_t i = 1; i < 100; ++i)
+	{
+		[array addInt32:i];
+	}
+	STAssertEquals(array.data, data, nil);
+	STAssertEquals(array.count, (NSUInteger)100, nil);
+	STAssertEquals([array int32AtIndex:0], 7, nil);
+	STAssertEquals([array int32AtIndex:99], 99, nil);
+	[array release];
+}
+
+- (void)testReserveCapacityOverflow
+{
+	PBAppendableArray *array = [[PBAppendableArray alloc] initWithValueType:PBArrayValueTypeInt64];
+	[array addInt64:7];
+	STAssertThrowsSpecificNamed([array reserveCapacity:NSUIntegerMax / 2], NSException, PBArrayAllocationFailureException, nil);
+	STAssertEquals(array.count, (NSUInteger)1, nil);
+	STAssertEquals([array int64AtIndex:0], 7LL, nil);
+	[array release];
+}
+
+- (void)testShrinkToFit
+{
+	PBAppendableArray *array = [[PBAppendableArray alloc] initWithValueType:PBArrayValueTypeDouble];
+	[array reserveCapacity:1000];
+	[array addDouble:1.5];
+	[array addDouble:2.5];
+	[array shrinkToFit];
+	STAssertEquals(array.count, (NSUInteger)2, nil);
+	STAssertEquals([array doubleAtIndex:0], 1.5, nil);
+	STAssertEquals([array doubleAtIndex:1], 2.5, nil);
+
+	[array addDouble:3.5];
+	STAssertEquals([array doubleAtIndex:2], 3.5, nil);
+	[array release];
+}
+
+- (void)testCopySharesStorage
+{
+	const int32_t kValues[16] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 };
+	PBArray *original = [[PBArray alloc] initWithValues:kValues count:16 valueType:PBArrayValueTypeInt32];
+	PBAppendableArray *copy = [[PBAppendableArray alloc] initWithValueType:PBArrayValueTypeInt32];
+	[copy appendArray:original];
+	PBAppendableArray *shared = [copy copy];
+	STAssertEquals(shared.data, copy.data, nil);
+
+	// Mutating one of the sharers gives it a private copy of the values.
+	[shared addInt32:16];
+	STAssertTrue(shared.data != copy.data, nil);
+	STAssertEquals(copy.count, (NSUInteger)16, nil);
+	STAssertEquals(shared.count, (NSUInteger)17, nil);
+	STAssertEquals([shared int32AtIndex:15], 15, nil);
+	STAssertEquals([shared int32AtIndex:16], 16, nil);
+
+	// Once it is the only owner left, the other one mutates in place.
+	[shared release];
+	const void *data = copy.data;
+	[copy reserveCapacity:16];
+	STAssertEquals(copy.data, data, nil);
+
+	[copy release];
+	[original release];
+}
+
+- (void)testCopySharesObjects
+{
+	PBAppendableArray *array = [[PBAppendableArray alloc] initWithValueType:PBArrayValueTypeObject];
+	NSObject *value = [[NSObject alloc] init];
+	for (NSUInteger i = 0; i < PBAppendableArrayInlineSize / sizeof(id) + 1; ++i)
+	{
+		[array addObject:value];
+	}
+	const NSUInteger retainCount = [value retainCount];
+
+	PBAppendableArray *copy = [array copy];
+	STAssertEquals([value retainCount], retainCount, nil);
+	[array release];
+	STAssertEquals([value retainCount], retainCount, nil);
+
+	[copy addObject:value];
+	STAssertEquals([value retainCount], retainCount + 1, nil);
+	[copy release];
+	STAssertEquals([value retainCount], (NSUInteger)1, nil);
+	[value release];
+}
+
 - (void)testAppendArray
 {
 	const int32_t kValues[3] = { 1, 2, 3 };
@@ -246,4 +435,258 @@
 	[array4 release];
 }
 
+- (void)testEqualFloatSemantics
+{
+	const Float64 kValues1[10] = { 0.0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+	const Float64 kValues2[10] = { -0.0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+	PBArray *array1 = [[PBArray alloc] initWithValues:kValues1 count:10 valueType:PBArrayValueTypeDouble];
+	PBArray *array2 = [[PBArray alloc] initWithValues:kValues2 count:10 valueType:PBArrayValueTypeDouble];
+	STAssertEqualObjects(array1, array2, nil);
+	STAssertEquals([array1 hash64], [array2 hash64], nil);
+
+	const Float32 kNaN[1] = { NAN };
+	PBArray *nan1 = [[PBArray alloc] initWithValues:kNaN count:1 valueType:PBArrayValueTypeFloat];
+	PBArray *nan2 = [[PBArray alloc] initWithValues:kNaN count:1 valueType:PBArrayValueTypeFloat];
+	STAssertFalse([nan1 isEqualToArray:nan2], nil);
+
+	[array1 release];
+	[array2 release];
+	[nan1 release];
+	[nan2 release];
+}
+
+- (void)testEqualObjects
+{
+	const id kValues1[1] = { [NSString stringWithFormat:@"Test"] };
+	const id kValues2[1] = { [NSString stringWithFormat:@"Test"] };
+	PBArray *array1 = [[PBArray alloc] initWithValues:kValues1 count:1 valueType:PBArrayValueTypeObject];
+	PBArray *array2 = [[PBArray alloc] initWithValues:kValues2 count:1 valueType:PBArrayValueTypeObject];
+	STAssertEqualObjects(array1, array2, nil);
+	STAssertEquals([array1 hash], [array2 hash], nil);
+	[array1 release];
+	[array2 release];
+}
+
+- (void)testHash
+{
+	int32_t values[100];
+	for (int32_t i = 0; i < 100; ++i)
+	{
+		values[i] = i;
+	}
+	PBArray *array1 = [[PBArray alloc] initWithValues:values count:100 valueType:PBArrayValueTypeInt32];
+	PBArray *array2 = [[PBArray alloc] initWithValues:values count:100 valueType:PBArrayValueTypeInt32];
+	values[99] = 0;
+	PBArray *array3 = [[PBArray alloc] initWithValues:values count:100 valueType:PBArrayValueTypeInt32];
+	PBArray *empty = [[PBArray alloc] initWithValueType:PBArrayValueTypeInt32];
+
+	STAssertEquals([array1 hash64], [array2 hash64], nil);
+	STAssertTrue([array1 hash64] != [array3 hash64], nil);
+	STAssertEquals([empty hash64], (uint64_t)0, nil);
+	STAssertTrue([empty isEqualToArray:nil], nil);
+
+	[array1 release];
+	[array2 release];
+	[array3 release];
+	[empty release];
+}
+
+#pragma mark PBTypedArrays
+
+- (void)testTypedArrayAppend
+{
+	PBInt32Array *array = [[PBInt32Array alloc] init];
+	STAssertEquals(array.valueType, PBArrayValueTypeInt32, nil);
+
+	for (int32_t i = 0; i < 100; ++i)
+	{
+		if (i % 2)
+		{
+			[array addValue:i];
+		}
+		else
+		{
+			PBInt32ArrayAddValue(array, i);
+		}
+	}
+
+	STAssertEquals(array.count, (NSUInteger)100, nil);
+	for (int32_t i = 0; i < 100; ++i)
+	{
+		STAssertEquals([array valueAtIndex:i], i, nil);
+		STAssertEquals(PBInt32ArrayValueAtIndex(array, i), i, nil);
+	}
+
+	[array release];
+}
+
+- (void)testTypedArrayRangeException
+{
+	PBDoubleArray *array = [PBDoubleArray array];
+	PBDoubleArrayAddValue(array, 1.0);
+	STAssertThrowsSpecificNamed(PBDoubleArrayValueAtIndex(array, 1), NSException, NSRangeException, nil);
+	STAssertThrowsSpecificNamed(PBDoubleArrayValueAtIndex(nil, 0), NSException, NSRangeException, nil);
+}
+
+- (void)testTypedArrayTypeMismatch
+{
+	PBInt64Array *array = [PBInt64Array alloc];
+	STAssertThrowsSpecificNamed([array initWithCount:0 valueType:PBArrayValueTypeBool], NSException, PBArrayTypeMismatchException, nil);
+}
+
+- (void)testTypedArrayCopyOnWrite
+{
+	PBUInt32Array *array = [PBUInt32Array array];
+	PBUInt32ArrayAddValue(array, 1);
+	PBArray *copy = [array copy];
+
+	PBUInt32ArrayAddValue(array, 2);
+	STAssertEquals(array.count, (NSUInteger)2, nil);
+	STAssertEquals(copy.count, (NSUInteger)1, nil);
+	STAssertEquals([copy uint32AtIndex:0], (uint32_t)1, nil);
+
+	[copy release];
+}
+
+- (void)testObjectArrayRetainsValues
+{
+	NSObject *object = [[NSObject alloc] init];
+	PBObjectArray *array = [[PBObjectArray alloc] init];
+
+	PBObjectArrayAddValue(array, object);
+	[array addValue:object];
+	STAssertEquals([object retainCount], (NSUInteger)3, nil);
+	STAssertEquals(PBObjectArrayValueAtIndex(array, 1), (id)object, nil);
+
+	[array release];
+	STAssertEquals([object retainCount], (NSUInteger)1, nil);
+	[object release];
+}
+
+#pragma mark No-Copy Arrays
+
+- (void)testNoCopyArray
+{
+	Float32 values[4] = { 1.0f, 2.0f, 3.0f, 4.0f };
+	void *expectedBytes = values;
+	__block NSUInteger deallocated = 0;
+
+	PBArray *array = [[PBArray alloc] initWithBytesNoCopy:values count:4 valueType:PBArrayValueTypeFloat
+											  deallocator:^(void *bytes, NSUInteger length) {
+												  STAssertEquals(bytes, expectedBytes, nil);
+												  STAssertEquals(length, (NSUInteger)(4 * sizeof(Float32)), nil);
+												  ++deallocated;
+											  }];
+	STAssertEquals(array.data, (const void *)values, nil);
+	STAssertEquals([array floatAtIndex:3], 4.0f, nil);
+
+	PBArray *copy = [array copy];
+	STAssertEquals(copy.data, (const void *)values, nil);
+
+	[array release];
+	STAssertEquals(deallocated, (NSUInteger)0, nil);
+	[copy release];
+	STAssertEquals(deallocated, (NSUInteger)1, nil);
+}
+
+- (void)testNoCopyArrayCopyOnWrite
+{
+	int32_t values[3] = { 1, 2, 3 };
+	__block NSUInteger deallocated = 0;
+
+	PBAppendableArray *array = [[PBAppendableArray alloc] initWithBytesNoCopy:values count:3 valueType:PBArrayValueTypeInt32
+																  deallocator:^(void *bytes, NSUInteger length) { ++deallocated; }];
+	[array addInt32:4];
+
+	STAssertTrue(array.data != (const void *)values, nil);
+	STAssertEquals(array.count, (NSUInteger)4, nil);
+	STAssertEquals([array int32AtIndex:2], 3, nil);
+	STAssertEquals(values[2], 3, nil);
+	STAssertEquals(deallocated, (NSUInteger)1, nil);
+
+	[array release];
+	STAssertEquals(deallocated, (NSUInteger)1, nil);
+}
+
+- (void)testNoCopyArrayRejectsObjects
+{
+	id values[1] = { @"Test" };
+	STAssertThrowsSpecificNamed([PBArray arrayWithBytesNoCopy:values count:1 valueType:PBArrayValueTypeObject deallocator:nil],
+								NSException, PBArrayTypeMismatchException, nil);
+
+	NSData *data = [[NSData alloc] initWithBytes:values length:sizeof(values)];
+	STAssertThrowsSpecificNamed([[PBArray alloc] initWithData:data valueType:PBArrayValueTypeObject],
+								NSException, PBArrayTypeMismatchException, nil);
+	STAssertEquals([data retainCount], (NSUInteger)1, nil);
+	[data release];
+}
+
+- (void)testArrayWithData
+{
+	const Float64 values[2] = { 0.5, 1.5 };
+	NSData *data = [[NSData alloc] initWithBytes:values length:sizeof(values)];
+
+	PBArray *array = [[PBArray alloc] initWithData:data valueType:PBArrayValueTypeDouble];
+	STAssertEquals(array.count, (NSUInteger)2, nil);
+	STAssertEquals(array.data, data.bytes, nil);
+	STAssertEquals([array doubleAtIndex:1], 1.5, nil);
+	STAssertEquals([data retainCount], (NSUInteger)2, nil);
+
+	[array release];
+	STAssertEquals([data retainCount], (NSUInteger)1, nil);
+	[data release];
+
+	data = [NSData dataWithBytes:values length:3];
+	STAssertThrowsSpecificNamed([PBArray arrayWithData:data valueType:PBArrayValueTypeDouble],
+								NSException, NSInvalidArgumentException, nil);
+}
+
+- (void)testArrayWithStorageOfArray
+{
+	Float32 values[2] = { 1.0f, 2.0f };
+	PBArray *array = [PBArray arrayWithBytesNoCopy:values count:2 valueType:PBArrayValueTypeFloat deallocator:nil];
+
+	PBFloatArray *typed = [PBFloatArray arrayWithStorageOfArray:array];
+	STAssertEquals(typed.data, (const void *)values, nil);
+	STAssertEquals(PBFloatArrayValueAtIndex(typed, 1), 2.0f, nil);
+
+	PBFloatArrayAddValue(typed, 3.0f);
+	STAssertTrue(typed.data != (const void *)values, nil);
+	STAssertEquals(array.count, (NSUInteger)2, nil);
+
+	STAssertThrowsSpecificNamed([PBInt32Array arrayWithStorageOfArray:array], NSException, PBArrayTypeMismatchException, nil);
+}
+
+- (void)testRemoveAllValues
+{
+	PBAppendableArray *array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeInt64];
+	[array reserveCapacity:64];
+	for (int64_t i = 0; i < 64; ++i)
+	{
+		[array addInt64:i];
+	}
+	const void *data = array.data;
+
+	[array removeAllValues];
+	STAssertEquals(array.count, (NSUInteger)0, nil);
+	[array addInt64:7];
+	STAssertEquals(array.data, data, nil);
+	STAssertEquals([array int64AtIndex:0], (int64_t)7, nil);
+
+	// Shared storage is left to the copy.
+	PBArray *copy = [[array copy] autorelease];
+	[array removeAllValues];
+	STAssertEquals(copy.count, (NSUInteger)1, nil);
+	STAssertEquals([copy int64AtIndex:0], (int64_t)7, nil);
+	STAssertEquals(array.count, (NSUInteger)0, nil);
+
+	NSObject *object = [[NSObject alloc] init];
+	PBAppendableArray *objects = [PBAppendableArray arrayWithValueType:PBArrayValueTypeObject];
+	[objects addObject:object];
+	STAssertEquals([object retainCount], (NSUInteger)2, nil);
+	[objects removeAllValues];
+	STAssertEquals([object retainCount], (NSUInteger)1, nil);
+	[object release];
+}
+
 @end
\ No newline at end of file
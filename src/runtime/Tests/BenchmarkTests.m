@@ -0,0 +1,122 @@
+// Protocol Buffers for Objective C
+//
+// Copyright 2010 Booyah Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import "BenchmarkTests.h"
+
+#import "TestUtilities.h"
+#import "Unittest.pb.h"
+#import "UnittestOptimizeFor.pb.h"
+
+static double PBBenchmarkMilliseconds(clock_t start, clock_t end) {
+  return (end - start) * 1000.0 / CLOCKS_PER_SEC;
+}
+
+@implementation BenchmarkTests
+
++ (id) defaultTestSuite {
+  if (getenv("PB_BENCHMARKS") == NULL) {
+    return [SenTestSuite testSuiteWithName:NSStringFromClass(self)];
+  }
+  return [super defaultTestSuite];
+}
+
+
+/**
+ * Compression ratio against the CPU time spent deflating and inflating a
+ * stream of golden messages at each level, for picking a level to suit a
+ * link's speed.
+ */
+- (void) testCompressionLevels {
+  const int32_t count = 200;
+  TestAllTypes* message = [TestUtilities allSet];
+  int64_t rawSize = (int64_t)count * (message.serializedSize + computeRawVarint32Size(message.serializedSize));
+
+  for (int32_t level = 0; level <= 9; level++) {
+    clock_t start = clock();
+    NSOutputStream* rawOutput = [NSOutputStream outputStreamToMemory];
+    PBDeflateOutputStream* deflater =
+      [PBDeflateOutputStream streamWithOutputStream:rawOutput compressionLevel:level windowBits:PBDeflateDefaultWindowBits];
+    [deflater open];
+    PBCodedOutputStream* output = [PBCodedOutputStream streamWithOutputStream:deflater];
+    for (int32_t i = 0; i < count; i++) {
+      [output writeMessageNoTag:message];
+    }
+    [output flush];
+    [deflater finish];
+    NSData* compressed = [rawOutput propertyForKey:NSStreamDataWrittenToMemoryStreamKey];
+    clock_t deflated = clock();
+
+    PBInflateInputStream* inflater =
+      [PBInflateInputStream streamWithInputStream:[NSInputStream inputStreamWithData:compressed]];
+    [inflater open];
+    PBCodedInputStream* input = [PBCodedInputStream streamWithInputStream:inflater];
+    for (int32_t i = 0; i < count; i++) {
+      [input readMessage:[TestAllTypes builder] extensionRegistry:[PBExtensionRegistry emptyRegistry]];
+    }
+    clock_t inflated = clock();
+
+    NSLog(@"deflate level %d: %lld -> %lu bytes (ratio %.3f), deflate %.2fms, inflate %.2fms",
+          level, rawSize, (unsigned long)compressed.length, (double)compressed.length / rawSize,
+          PBBenchmarkMilliseconds(start, deflated), PBBenchmarkMilliseconds(deflated, inflated));
+  }
+}
+
+
+/**
+ * The field table engine (TestOptimizedForSize) against generated code
+ * (TestAllTypes), parsing and serializing the same bytes: the two share
+ * fields 1 and 19.
+ */
+- (void) testFieldTableAgainstGeneratedCode {
+  const int32_t count = 100000;
+  TestOptimizedForSize* table =
+    [[[[TestOptimizedForSize builder] setI:12] setMsg:[[[ForeignMessage builder] setC:34] build]] build];
+  NSData* data = table.data;
+  TestAllTypes* generated = [TestAllTypes parseFromData:data];
+
+  clock_t start = clock();
+  for (int32_t i = 0; i < count; i++) {
+    NSAutoreleasePool* pool = [[NSAutoreleasePool alloc] init];
+    [TestOptimizedForSize parseFromData:data];
+    [pool release];
+  }
+  clock_t tableParsed = clock();
+  for (int32_t i = 0; i < count; i++) {
+    NSAutoreleasePool* pool = [[NSAutoreleasePool alloc] init];
+    [TestAllTypes parseFromData:data];
+    [pool release];
+  }
+  clock_t generatedParsed = clock();
+  for (int32_t i = 0; i < count; i++) {
+    NSAutoreleasePool* pool = [[NSAutoreleasePool alloc] init];
+    [table data];
+    [pool release];
+  }
+  clock_t tableWritten = clock();
+  for (int32_t i = 0; i < count; i++) {
+    NSAutoreleasePool* pool = [[NSAutoreleasePool alloc] init];
+    [generated data];
+    [pool release];
+  }
+  clock_t generatedWritten = clock();
+
+  NSLog(@"%d messages: parse field table %.2fms, generated %.2fms; serialize field table %.2fms, generated %.2fms",
+        count, PBBenchmarkMilliseconds(start, tableParsed), PBBenchmarkMilliseconds(tableParsed, generatedParsed),
+        PBBenchmarkMilliseconds(generatedParsed, tableWritten),
+        PBBenchmarkMilliseconds(tableWritten, generatedWritten));
+}
+
+@end
@@ -283,6 +283,43 @@
 }
 
 
+- (void) testCountBufferedRepeatedField {
+  // Three varints for field 1, one with a multi-byte encoding, then field 2.
+  NSData* data = bytes(0x08, 0x01, 0x08, 0x96, 0x01, 0x08, 0x03, 0x10, 0x01);
+  PBCodedInputStream* input = [PBCodedInputStream streamWithData:data];
+  STAssertTrue(0x08 == [input readTag], @"");
+  STAssertTrue(3 == [input countBufferedRepeatedField:0x08], @"");
+  STAssertTrue(1 == [input readInt32], @"");
+
+  // Fixed-width values truncated by the end of the buffer.
+  data = bytes(0x0D, 0x01, 0x00, 0x00, 0x00, 0x0D, 0x02, 0x00);
+  input = [PBCodedInputStream streamWithData:data];
+  STAssertTrue(0x0D == [input readTag], @"");
+  STAssertTrue(1 == [input countBufferedRepeatedField:0x0D], @"");
+}
+
+
+- (void) testNewStringAndData {
+  // "hi" as a string, then two bytes.
+  NSData* data = bytes(0x02, 0x68, 0x69, 0x02, 0x01, 0x02);
+  PBCodedInputStream* input = [[PBCodedInputStream alloc] initWithData:data];
+
+  NSAutoreleasePool* pool = [[NSAutoreleasePool alloc] init];
+  NSString* string = [input newString];
+  NSData* value = [input newData];
+  [pool drain];
+
+  // Both survive the pool, so neither was autoreleased.
+  STAssertEqualObjects(@"hi", string, @"");
+  STAssertTrue(value.length == 2 && ((uint8_t*)value.bytes)[1] == 0x02, @"");
+  STAssertTrue(input.isAtEnd, @"");
+
+  [string release];
+  [value release];
+  [input release];
+}
+
+
 - (void) testReadMaliciouslyLargeBlob {
   NSOutputStream* rawOutput = [NSOutputStream outputStreamToMemory];
   [rawOutput open];
@@ -0,0 +1,142 @@
+// Protocol Buffers for Objective C
+//
+// Copyright 2010 Booyah Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import "CompressionTests.h"
+
+#import <zlib.h>
+
+#import "SmallBlockInputStream.h"
+#import "TestUtilities.h"
+#import "Unittest.pb.h"
+
+@implementation CompressionTests
+
+- (NSData*) deflateMessage:(TestAllTypes*) message
+                     count:(int32_t) count
+                     level:(int32_t) level
+                windowBits:(int32_t) windowBits {
+  NSOutputStream* rawOutput = [NSOutputStream outputStreamToMemory];
+  PBDeflateOutputStream* deflater =
+    [PBDeflateOutputStream streamWithOutputStream:rawOutput compressionLevel:level windowBits:windowBits];
+  [deflater open];
+
+  PBCodedOutputStream* output = [PBCodedOutputStream streamWithOutputStream:deflater];
+  for (int32_t i = 0; i < count; i++) {
+    [output writeMessageNoTag:message];
+  }
+  [output flush];
+  [deflater finish];
+
+  return [rawOutput propertyForKey:NSStreamDataWrittenToMemoryStreamKey];
+}
+
+
+- (void) testRoundTripGoldenMessage {
+  TestAllTypes* message = [TestUtilities allSet];
+  NSData* compressed = [self deflateMessage:message
+                                      count:1
+                                      level:PBDeflateDefaultCompressionLevel
+                                 windowBits:PBDeflateDefaultWindowBits];
+  STAssertTrue(compressed.length < message.data.length, @"");
+
+  PBInflateInputStream* inflater =
+    [PBInflateInputStream streamWithInputStream:[NSInputStream inputStreamWithData:compressed]];
+  [inflater open];
+  PBCodedInputStream* input = [PBCodedInputStream streamWithInputStream:inflater];
+  TestAllTypes_Builder* builder = [TestAllTypes builder];
+  [input readMessage:builder extensionRegistry:[PBExtensionRegistry emptyRegistry]];
+  [TestUtilities assertAllFieldsSet:[builder build]];
+  STAssertTrue([input isAtEnd], @"");
+}
+
+
+/**
+ * Feeds the compressed bytes through in tiny blocks so that every inflate
+ * call runs out of input at least once.
+ */
+- (void) testRoundTripSmallBlocks {
+  TestAllTypes* message = [TestUtilities allSet];
+  NSData* compressed = [self deflateMessage:message count:8 level:9 windowBits:-MAX_WBITS];
+
+  for (int32_t blockSize = 1; blockSize < 16; blockSize *= 2) {
+    NSInputStream* rawInput =
+      [SmallBlockInputStream streamWithData:[NSMutableData dataWithData:compressed] blockSize:blockSize];
+    PBInflateInputStream* inflater =
+      [PBInflateInputStream streamWithInputStream:rawInput windowBits:-MAX_WBITS];
+    [inflater open];
+    PBCodedInputStream* input = [PBCodedInputStream streamWithInputStream:inflater];
+    for (int32_t i = 0; i < 8; i++) {
+      TestAllTypes_Builder* builder = [TestAllTypes builder];
+      [input readMessage:builder extensionRegistry:[PBExtensionRegistry emptyRegistry]];
+      STAssertEqualObjects(message.data, [builder build].data, @"");
+    }
+    STAssertTrue([input isAtEnd], @"");
+  }
+}
+
+
+- (void) testTruncatedStreamThrows {
+  NSData* compressed = [self deflateMessage:[TestUtilities allSet]
+                                      count:1
+                                      level:PBDeflateDefaultCompressionLevel
+                                 windowBits:PBDeflateDefaultWindowBits];
+  NSData* truncated = [compressed subdataWithRange:NSMakeRange(0, compressed.length / 2)];
+
+  PBInflateInputStream* inflater =
+    [PBInflateInputStream streamWithInputStream:[NSInputStream inputStreamWithData:truncated]];
+  [inflater open];
+  PBCodedInputStream* input = [PBCodedInputStream streamWithInputStream:inflater];
+  STAssertThrows([input readMessage:[TestAllTypes builder]
+                  extensionRegistry:[PBExtensionRegistry emptyRegistry]], @"");
+}
+
+
+/**
+ * Every compression level must round-trip, and the levels that actually
+ * compress must beat the raw stream.
+ */
+- (void) testCompressionLevels {
+  const int32_t count = 200;
+  TestAllTypes* message = [TestUtilities allSet];
+  int64_t rawSize = (int64_t)count * (message.serializedSize + computeRawVarint32Size(message.serializedSize));
+  NSUInteger fastestSize = 0;
+
+  for (int32_t level = 0; level <= 9; level++) {
+    NSData* compressed = [self deflateMessage:message count:count level:level windowBits:PBDeflateDefaultWindowBits];
+    if (level == 1) {
+      fastestSize = compressed.length;
+    }
+    if (level > 0) {
+      STAssertTrue((int64_t)compressed.length < rawSize, @"");
+    }
+    if (level == 9) {
+      STAssertTrue(compressed.length <= fastestSize, @"");
+    }
+
+    PBInflateInputStream* inflater =
+      [PBInflateInputStream streamWithInputStream:[NSInputStream inputStreamWithData:compressed]];
+    [inflater open];
+    PBCodedInputStream* input = [PBCodedInputStream streamWithInputStream:inflater];
+    for (int32_t i = 0; i < count; i++) {
+      TestAllTypes_Builder* builder = [TestAllTypes builder];
+      [input readMessage:builder extensionRegistry:[PBExtensionRegistry emptyRegistry]];
+      STAssertEqualObjects(message.data, [builder build].data, @"");
+    }
+    STAssertTrue([input isAtEnd], @"");
+  }
+}
+
+@end
@@ -17,8 +17,14 @@
 
 #import "GeneratedMessageTests.h"
 
+#import <libkern/OSAtomic.h>
+
 #import "TestUtilities.h"
 #import "Unittest.pb.h"
+#import "UnittestLazy.pb.h"
+#import "UnittestLite.pb.h"
+#import "UnittestMutable.pb.h"
+#import "UnittestOptimizeFor.pb.h"
 
 @implementation GeneratedMessageTests
 
@@ -30,6 +36,18 @@
 }
 
 
+- (void) testUnsetMessageFieldsReturnDefaultInstance {
+  TestAllTypes* message = [TestAllTypes defaultInstance];
+  STAssertFalse(message.hasOptionalNestedMessage, @"");
+  STAssertTrue(message.optionalNestedMessage == [TestAllTypes_NestedMessage defaultInstance], @"");
+
+  TestAllTypes_Builder* builder = [TestUtilities allSet].toBuilder;
+  [builder clearOptionalNestedMessage];
+  STAssertTrue(builder.optionalNestedMessage == [TestAllTypes_NestedMessage defaultInstance], @"");
+  STAssertTrue([builder build].optionalNestedMessage == [TestAllTypes_NestedMessage defaultInstance], @"");
+}
+
+
 - (void) testAccessors {
   TestAllTypes_Builder* builder = [TestAllTypes builder];
   [TestUtilities setAllFields:builder];
@@ -104,4 +122,462 @@
   [TestUtilities assertExtensionsClear:[[TestAllExtensions builder] build]];
 }
 
+
+- (void) testLazyFieldRoundTrip {
+  TestLazyMessage* message = [[[[[TestLazyMessage builder]
+                                 setAllTypes:[TestUtilities allSet]]
+                                setAllExtensions:[TestUtilities allExtensionsSet]]
+                               setInt32Value:7] build];
+
+  TestLazyMessage* parsed = [TestLazyMessage parseFromData:message.data
+                                         extensionRegistry:[TestUtilities extensionRegistry]];
+  STAssertEqualObjects(parsed.data, message.data, @"");
+  STAssertEquals(parsed.int32Value, 7, @"");
+  [TestUtilities assertAllFieldsSet:parsed.allTypes];
+  [TestUtilities assertAllExtensionsSet:parsed.allExtensions];
+  STAssertEqualObjects(parsed, message, @"");
+}
+
+
+- (void) testLazyFieldMergesUnparsedBytes {
+  TestAllTypes* first = [[[TestAllTypes builder] setOptionalInt32:1] build];
+  TestAllTypes* second = [[[TestAllTypes builder] setOptionalString:@"2"] build];
+  NSMutableData* data = [NSMutableData dataWithData:[[[TestLazyMessage builder] setAllTypes:first] build].data];
+  [data appendData:[[[TestLazyMessage builder] setAllTypes:second] build].data];
+
+  TestLazyMessage* parsed = [TestLazyMessage parseFromData:data];
+  STAssertEqualObjects(parsed.data, data, @"");
+  STAssertEquals(parsed.allTypes.optionalInt32, 1, @"");
+  STAssertEqualObjects(parsed.allTypes.optionalString, @"2", @"");
+
+  // Bytes parsed with another registry can't be appended, so the merge
+  // goes through the parsed values instead.
+  TestLazyMessage_Builder* builder = [TestLazyMessage builder];
+  [builder mergeFromData:data extensionRegistry:[TestUtilities extensionRegistry]];
+  [builder mergeFromData:[[[TestLazyMessage builder] setAllTypes:first] build].data];
+  TestLazyMessage* merged = [builder build];
+  STAssertEquals(merged.allTypes.optionalInt32, 1, @"");
+  STAssertEqualObjects(merged.allTypes.optionalString, @"2", @"");
+  STAssertEquals(merged.allTypes.repeatedInt32.count, (NSUInteger)0, @"");
+}
+
+
+- (void) testLazyFieldRequiredFieldsAreChecked {
+  TestLazyMessage* partial = [[[TestLazyMessage builder]
+                               setRequired:[[TestRequired builder] buildPartial]] buildPartial];
+  STAssertThrows([TestLazyMessage parseFromData:partial.data], @"");
+
+  TestRequired* required = [[[[[TestRequired builder] setA:1] setB:2] setC:3] build];
+  TestLazyMessage* complete = [[[TestLazyMessage builder] setRequired:required] build];
+  STAssertEquals([TestLazyMessage parseFromData:complete.data].required.c, 3, @"");
+}
+
+
+- (void) testFieldTableRoundTrip {
+  TestOptimizedForSize* message =
+    [[[[TestOptimizedForSize builder] setI:12] setMsg:[[[ForeignMessage builder] setC:34] build]] build];
+  NSData* data = message.data;
+
+  // Fields 1 and 19 have the same types in both messages, so the table and
+  // the generated code have to agree on the bytes.
+  TestAllTypes* generated =
+    [[[[TestAllTypes builder] setOptionalInt32:12] setOptionalForeignMessage:[[[ForeignMessage builder] setC:34] build]] build];
+  STAssertEqualObjects(generated.data, data, @"");
+  STAssertTrue(message.serializedSize == generated.serializedSize, @"");
+
+  TestOptimizedForSize* parsed = [TestOptimizedForSize parseFromData:data];
+  STAssertTrue(parsed.hasI, @"");
+  STAssertTrue(12 == parsed.i, @"");
+  STAssertTrue(34 == parsed.msg.c, @"");
+  STAssertFalse([[TestOptimizedForSize parseFromData:[NSData data]] hasMsg], @"");
+  STAssertEqualObjects(parsed, message, @"");
+  STAssertTrue(parsed.hash == message.hash, @"");
+  STAssertFalse([parsed isEqual:[[[TestOptimizedForSize builder] setI:12] build]], @"");
+
+  // Parsing into a builder that already has the sub-message merges into it.
+  TestOptimizedForSize* merged =
+    [[[[TestOptimizedForSize builder] setMsg:[[[ForeignMessage builder] setC:56] build]]
+      mergeFromData:[[[[TestOptimizedForSize builder] setI:7] build] data]] build];
+  STAssertTrue(7 == merged.i, @"");
+  STAssertTrue(56 == merged.msg.c, @"");
+}
+
+
+- (void) testLiteSkipsUnknownFields {
+  // Only field 1 of TestAllTypes is known to ForeignMessageLite, and the
+  // rest, groups included, must be skipped rather than kept.
+  NSData* data = [[TestUtilities allSet] data];
+  ForeignMessageLite* message = [ForeignMessageLite parseFromData:data];
+  STAssertTrue(101 == message.c, @"");
+  STAssertTrue(0 == message.unknownFields.serializedSize, @"");
+  STAssertEqualObjects(message.data, [[[[ForeignMessageLite builder] setC:101] build] data], @"");
+  STAssertTrue(message.description.length > 0, @"");
+}
+
+
+- (void) testUnknownEnumValuesRoundTrip {
+  // 10 isn't a NestedEnum value, so it is kept with the unknown fields.
+  PBUnknownFieldSet* unknown = [[[[PBUnknownFieldSet builder]
+      addField:[[PBMutableField field] addVarint:10] forNumber:21]
+      addField:[[PBMutableField field] addVarint:10] forNumber:51] build];
+  NSData* data = [[[[[TestAllTypes builder]
+      addRepeatedNestedEnum:TestAllTypes_NestedEnumBar]
+      setUnknownFields:unknown] build] data];
+
+  TestAllTypes* message = [TestAllTypes parseFromData:data];
+  STAssertFalse(message.hasOptionalNestedEnum, @"");
+  STAssertTrue(1 == message.repeatedNestedEnum.count, @"");
+  STAssertTrue(10 == [[message.unknownFields getField:21].varintArray int64AtIndex:0], @"");
+  STAssertTrue(10 == [[message.unknownFields getField:51].varintArray int64AtIndex:0], @"");
+  STAssertEqualObjects(data, message.data, @"");
+
+  // Without any unknown fields no set is made for the message.
+  message = [TestAllTypes parseFromData:[[TestUtilities allSet] data]];
+  STAssertTrue([PBUnknownFieldSet defaultInstance] == message.unknownFields, @"");
+}
+
+
+- (void) testSubMessageMergesAcrossOccurrences {
+  // A singular message field that appears twice on the wire is merged:
+  // fields set by either occurrence are kept, and repeated ones append.
+  NSMutableData* data = [NSMutableData data];
+  [data appendData:[[[[TestRecursiveMessage builder]
+      setA:[[[TestRecursiveMessage builder] setI:1] build]] build] data]];
+  [data appendData:[[[[TestRecursiveMessage builder]
+      setA:[[[TestRecursiveMessage builder]
+          setA:[[[TestRecursiveMessage builder] setI:2] build]] build]] build] data]];
+  TestRecursiveMessage* recursive = [TestRecursiveMessage parseFromData:data];
+  STAssertTrue(1 == recursive.a.i, @"");
+  STAssertTrue(2 == recursive.a.a.i, @"");
+
+  // A reset builder parses into its set-aside sub-builders the same way.
+  TestRecursiveMessage_Builder* builder = [[TestRecursiveMessage builder] mergeFromData:data];
+  [builder reset];
+  STAssertFalse(builder.hasA, @"");
+  STAssertEqualObjects(recursive, [[builder mergeFromData:data] build], @"");
+
+  [data setLength:0];
+  [data appendData:[[[[TestNestedMessageHasBits builder]
+      setOptionalNestedMessage:[[[[TestNestedMessageHasBits_NestedMessage builder]
+          addNestedmessageRepeatedInt32:1]
+          addNestedmessageRepeatedInt32:2] build]] build] data]];
+  [data appendData:[[[[TestNestedMessageHasBits builder]
+      setOptionalNestedMessage:[[[TestNestedMessageHasBits_NestedMessage builder]
+          addNestedmessageRepeatedInt32:3] build]] build] data]];
+  TestNestedMessageHasBits* nested = [TestNestedMessageHasBits parseFromData:data];
+  STAssertTrue(3 == nested.optionalNestedMessage.nestedmessageRepeatedInt32.count, @"");
+  for (int32_t i = 0; i < 3; i++) {
+    STAssertTrue(i + 1 == [nested.optionalNestedMessage nestedmessageRepeatedInt32AtIndex:i], @"");
+  }
+}
+
+
+- (void) testConcurrentSerialization {
+  // A fresh message, so that the threads race to memoize its sizes.
+  TestPackedTypes* message = [TestUtilities packedSet];
+  NSData* expected = [[TestUtilities packedSet] data];
+
+  __block int32_t mismatches = 0;
+  dispatch_apply(64, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^(size_t i) {
+    NSAutoreleasePool* pool = [[NSAutoreleasePool alloc] init];
+    if (![message.data isEqualToData:expected]) {
+      OSAtomicIncrement32(&mismatches);
+    }
+    [pool release];
+  });
+  STAssertTrue(0 == mismatches, @"");
+}
+
+
+- (void) testHash {
+  TestAllTypes* message = [TestUtilities allSet];
+  STAssertTrue(message.hash == [[TestUtilities allSet] hash], @"");
+  STAssertTrue(message.hash == message.hash, @"");
+  STAssertTrue(message.hash != [[[[TestUtilities allSet] toBuilder] setOptionalInt32:102] build].hash, @"");
+
+  // Equal messages hash alike.
+  TestAllTypes* zero = [[[TestAllTypes builder] setOptionalDouble:0.0] build];
+  TestAllTypes* negativeZero = [[[TestAllTypes builder] setOptionalDouble:-0.0] build];
+  STAssertEqualObjects(zero, negativeZero, @"");
+  STAssertTrue(zero.hash == negativeZero.hash, @"");
+}
+
+- (void) testUnsetFieldsReturnDefaults {
+  TestAllTypes* message = [TestAllTypes defaultInstance];
+  STAssertTrue(41 == message.defaultInt32, @"");
+  STAssertEqualObjects(@"hello", message.defaultString, @"");
+  STAssertEqualObjects([@"world" dataUsingEncoding:NSUTF8StringEncoding], message.defaultBytes, @"");
+  STAssertTrue(message.defaultBool, @"");
+  STAssertTrue(TestAllTypes_NestedEnumBar == message.defaultNestedEnum, @"");
+  STAssertEqualObjects(@"", message.optionalString, @"");
+
+  TestAllTypes_Builder* builder = [[TestUtilities allSet] toBuilder];
+  [[[builder clearDefaultInt32] clearDefaultString] clearDefaultNestedEnum];
+  STAssertTrue(41 == builder.defaultInt32, @"");
+  STAssertEqualObjects(@"hello", builder.defaultString, @"");
+  STAssertTrue(TestAllTypes_NestedEnumBar == builder.defaultNestedEnum, @"");
+
+  message = [builder build];
+  STAssertFalse(message.hasDefaultInt32, @"");
+  STAssertTrue(41 == message.defaultInt32, @"");
+  STAssertEqualObjects(@"hello", message.defaultString, @"");
+}
+
+
+/**
+ * TestAllTypes has more than 32 singular fields, so its has bits take two
+ * words: default_fixed64 is the last bit of the first and default_sfixed32
+ * the first bit of the second.
+ */
+- (void) testHasBitsAcrossWords {
+  TestAllTypes* last = [[[TestAllTypes builder] setDefaultFixed64:1] build];
+  STAssertTrue(last.hasDefaultFixed64, @"");
+  STAssertFalse(last.hasDefaultFixed32, @"");
+  STAssertFalse(last.hasDefaultSfixed32, @"");
+
+  TestAllTypes* first = [[[TestAllTypes builder] setDefaultSfixed32:2] build];
+  STAssertTrue(first.hasDefaultSfixed32, @"");
+  STAssertFalse(first.hasDefaultFixed64, @"");
+  STAssertFalse(first.hasDefaultSfixed64, @"");
+
+  TestAllTypes* both = [[[[TestAllTypes builder] setDefaultFixed64:1] setDefaultSfixed32:2] build];
+  TestAllTypes* parsed = [TestAllTypes parseFromData:both.data];
+  STAssertTrue(parsed.hasDefaultFixed64, @"");
+  STAssertTrue(parsed.hasDefaultSfixed32, @"");
+  STAssertEqualObjects(parsed, both, @"");
+
+  TestAllTypes* cleared = [[[parsed toBuilder] clearDefaultFixed64] build];
+  STAssertFalse(cleared.hasDefaultFixed64, @"");
+  STAssertTrue(cleared.hasDefaultSfixed32, @"");
+  STAssertTrue(2 == cleared.defaultSfixed32, @"");
+}
+
+
+/**
+ * TestRequired's required fields are a and b in the first has bits word and
+ * c in the second, followed by the bit that remembers a successful check.
+ */
+- (void) testRequiredFieldsAcrossWords {
+  TestRequired_Builder* builder = [[[TestRequired builder] setA:1] setB:2];
+  STAssertFalse(builder.isInitialized, @"");
+  STAssertFalse([builder buildPartial].isInitialized, @"");
+  [builder setC:3];
+  STAssertTrue(builder.isInitialized, @"");
+
+  TestRequired* built = [[[[[TestRequired builder] setA:1] setB:2] setC:3] build];
+  STAssertTrue(built.isInitialized, @"");
+
+  // Neither a builder made from the checked message nor one reusing it
+  // may keep the remembered check once a required field is gone.
+  TestRequired_Builder* changed = [[built toBuilder] clearC];
+  STAssertFalse(changed.isInitialized, @"");
+  STAssertThrows([changed build], @"");
+  STAssertTrue(built.isInitialized, @"");
+
+  TestRequired_Builder* reused = [TestRequired builder];
+  [reused recycle:built];
+  [[reused setA:1] setB:2];
+  STAssertFalse(reused.isInitialized, @"");
+  STAssertThrows([reused build], @"");
+}
+
+
+- (void) testToBuilderCopiesOnWrite {
+  TestAllTypes* message = [TestUtilities allSet];
+  STAssertTrue(message == [[message toBuilder] build], @"");
+
+  TestAllTypes_Builder* builder = [message toBuilder];
+  [[builder setOptionalInt32:102] addRepeatedInt32:7];
+  TestAllTypes* changed = [builder build];
+  STAssertTrue(102 == changed.optionalInt32, @"");
+  STAssertTrue(3 == changed.repeatedInt32.count, @"");
+  STAssertEqualObjects(message.optionalString, changed.optionalString, @"");
+  [TestUtilities assertAllFieldsSet:message];
+}
+
+
+- (void) testRecycledInstances {
+  [TestAllTypes setRecycledInstanceLimit:1];
+  @try {
+    TestAllTypes_Builder* builder = [[TestAllTypes_Builder alloc] init];
+    [TestUtilities setAllFields:builder];
+    TestAllTypes* message = [builder newBuildPartial];
+    TestAllTypes_NestedMessage* nested = [message.optionalNestedMessage retain];
+    [builder recycle:message];
+    [message release];
+    [TestUtilities setAllFields:builder];
+    [builder release];
+
+    // The builder's unbuilt result goes back to the pool, but the messages
+    // it held are only released.
+    TestAllTypes* recycled = [TestAllTypes recycledInstance];
+    STAssertTrue(message == recycled, @"");
+    STAssertFalse(recycled.hasOptionalInt32, @"");
+    STAssertTrue(0 == recycled.repeatedInt32.count, @"");
+    STAssertTrue(118 == nested.bb, @"");
+    [recycled release];
+    [nested release];
+
+    // Built results belong to the caller, so they are never pooled.
+    builder = [[TestAllTypes_Builder alloc] init];
+    [TestUtilities setAllFields:builder];
+    message = [builder build];
+    [builder release];
+    recycled = [TestAllTypes recycledInstance];
+    STAssertTrue(message != recycled, @"");
+    [TestUtilities assertAllFieldsSet:message];
+    [recycled release];
+  } @finally {
+    [TestAllTypes setRecycledInstanceLimit:0];
+  }
+}
+
+
+- (void) testRecycleParseLoop {
+  NSData* data = [[TestUtilities allSet] data];
+  [TestAllTypes setRecycledInstanceLimit:1];
+  @try {
+    TestAllTypes* previous = nil;
+    for (int32_t i = 0; i < 3; i++) {
+      TestAllTypes* message = [[TestAllTypes parseFromData:data] retain];
+      if (previous != nil) {
+        STAssertTrue(message == previous, @"");
+      }
+      [TestUtilities assertAllFieldsSet:message];
+      previous = message;
+      [message recycle];
+    }
+
+    // An array handed out by a builder keeps its values when the builder's
+    // result is cleared for the pool.
+    TestAllTypes_Builder* builder = [TestAllTypes builder];
+    [TestUtilities setAllFields:builder];
+    PBArray* ints = [[builder repeatedInt32] retain];
+    [builder clear];
+    STAssertTrue(0 == [builder repeatedInt32].count, @"");
+    STAssertTrue(2 == ints.count, @"");
+    STAssertTrue(201 == [ints int32AtIndex:0], @"");
+    STAssertTrue(301 == [ints int32AtIndex:1], @"");
+    [ints release];
+  } @finally {
+    [TestAllTypes setRecycledInstanceLimit:0];
+  }
+}
+
+
+- (void) testResetKeepsStorage {
+  TestAllTypes_Builder* source = [[TestUtilities allSet] toBuilder];
+  for (int32_t i = 0; i < 100; i++) {
+    [source addRepeatedInt32:i];
+  }
+  NSData* data = [[source build] data];
+  TestAllTypes* fresh = [TestAllTypes parseFromData:data];
+
+  // Parsing leaves the nested messages in sub-builders, which reset keeps.
+  TestAllTypes_Builder* builder = [[TestAllTypes builder] mergeFromData:data];
+  void* storage = [builder repeatedInt32]->_data;
+  NSUInteger capacity = [builder repeatedInt32]->_capacity;
+  PBArray* strings = [[builder repeatedString] retain];
+  [builder reset];
+  STAssertFalse(builder.hasOptionalInt32, @"");
+  STAssertFalse(builder.hasOptionalNestedMessage, @"");
+  STAssertTrue(0 == [builder repeatedInt32].count, @"");
+  STAssertTrue(storage == [builder repeatedInt32]->_data, @"");
+  STAssertTrue(capacity == [builder repeatedInt32]->_capacity, @"");
+
+  // An array handed out before the reset keeps its values.
+  STAssertTrue(2 == strings.count, @"");
+  STAssertEqualObjects(@"215", [strings objectAtIndex:0], @"");
+  [strings release];
+
+  [builder mergeFromData:data];
+  STAssertEqualObjects(fresh, [builder build], @"");
+
+  // recycle: takes over a message's storage in the same way.
+  TestAllTypes* message = [[[TestAllTypes builder] mergeFromData:data] newBuildPartial];
+  storage = message.repeatedInt32->_data;
+  builder = [[TestAllTypes_Builder alloc] init];
+  [builder recycle:message];
+  [message release];
+  STAssertFalse(builder.hasOptionalInt32, @"");
+  STAssertTrue(0 == [builder repeatedInt32].count, @"");
+  STAssertTrue(storage == [builder repeatedInt32]->_data, @"");
+  [builder mergeFromData:data];
+  STAssertEqualObjects(fresh, [builder build], @"");
+  [builder release];
+}
+
+
+- (void) testMutableMessageThrowsOnceFrozen {
+  TestMutableMessage* message = [[[TestMutableMessage builder] setInt32Value:1] build];
+  STAssertFalse(message.isFrozen, @"");
+  [message setInt32Value:2];
+  [message addNumbers:3];
+  [message.mutableChild setValue:4];
+  STAssertEquals(message.int32Value, 2, @"");
+  STAssertEquals(message.child.value, 4, @"");
+
+  [message freeze];
+  STAssertTrue(message.isFrozen, @"");
+  STAssertTrue(message.child.isFrozen, @"");
+  STAssertThrowsSpecificNamed([message setInt32Value:5], NSException, @"IllegalState", @"");
+  STAssertThrowsSpecificNamed([message addNumbers:5], NSException, @"IllegalState", @"");
+  STAssertThrowsSpecificNamed([message mutableChild], NSException, @"IllegalState", @"");
+  STAssertThrowsSpecificNamed([message.child setValue:5], NSException, @"IllegalState", @"");
+  STAssertEquals(message.int32Value, 2, @"");
+  STAssertEquals(message.numbers.count, (NSUInteger)1, @"");
+  STAssertEquals(message.child.value, 4, @"");
+}
+
+
+- (void) testMutableCopyCopiesUnfrozenChildren {
+  TestMutableMessage* message = [[TestMutableMessage builder] build];
+  [message.mutableChild setValue:1];
+  [message addChildren:[[[TestMutableChild builder] setValue:2] build]];
+
+  TestMutableMessage* copy = [[message mutableCopy] autorelease];
+  STAssertFalse(copy.isFrozen, @"");
+  STAssertTrue(copy.child != message.child, @"");
+  [copy.mutableChild setValue:3];
+  [[copy childrenAtIndex:0] setValue:4];
+  STAssertEquals(copy.child.value, 3, @"");
+  STAssertEquals([copy childrenAtIndex:0].value, 4, @"");
+  STAssertEquals(message.child.value, 1, @"");
+  STAssertEquals([message childrenAtIndex:0].value, 2, @"");
+
+  // Frozen children are shared until they are changed.
+  TestMutableChild* frozen = [[[TestMutableChild builder] setValue:5] build];
+  [frozen freeze];
+  [message setChild:frozen];
+  copy = [[message mutableCopy] autorelease];
+  STAssertTrue(copy.child == frozen, @"");
+  [copy.mutableChild setValue:6];
+  STAssertEquals(copy.child.value, 6, @"");
+  STAssertEquals(frozen.value, 5, @"");
+}
+
+
+- (void) testMutableMessageMemoizesOnlyOnceFrozen {
+  TestMutableMessage* message = [[TestMutableMessage builder] build];
+  int32_t size = message.serializedSize;
+  NSUInteger hash = message.hash;
+
+  [message setInt32Value:150];
+  STAssertTrue(message.serializedSize > size, @"");
+  STAssertFalse(message.hash == hash, @"");
+  size = message.serializedSize;
+  hash = message.hash;
+
+  [message.mutableChild setValue:1];
+  STAssertTrue(message.serializedSize > size, @"");
+  STAssertFalse(message.hash == hash, @"");
+  STAssertEquals(message.serializedSize, (int32_t)message.data.length, @"");
+
+  [message freeze];
+  TestMutableMessage* parsed = [TestMutableMessage parseFromData:message.data];
+  STAssertEquals(message.serializedSize, (int32_t)message.data.length, @"");
+  STAssertEqualObjects(parsed, message, @"");
+  STAssertEquals(parsed.hash, message.hash, @"");
+}
+
 @end
@@ -0,0 +1,471 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+
+#import "ObjectivecDescriptor.pb.h"
+
+@implementation ObjectivecDescriptorRoot
+static id<PBExtensionField> ObjectivecDescriptorRoot_objectivecFileOptions = nil;
+static PBExtensionRegistry* extensionRegistry = nil;
++ (PBExtensionRegistry*) extensionRegistry {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    PBMutableExtensionRegistry* registry = [PBMutableExtensionRegistry registry];
+    [ObjectivecDescriptorRoot registerAllExtensions:registry];
+    [PBDescriptorRoot registerAllExtensions:registry];
+    extensionRegistry = [registry retain];
+  });
+  return extensionRegistry;
+}
+
++ (void) initialize {
+  if (self == [ObjectivecDescriptorRoot class]) {
+    ObjectivecDescriptorRoot_objectivecFileOptions =
+      [[PBConcreteExtensionField extensionWithType:PBExtensionTypeMessage
+                                     extendedClass:[PBFileOptions class]
+                                       fieldNumber:1002
+                                      defaultValue:[ObjectiveCFileOptions defaultInstance]
+                               messageOrGroupClass:[ObjectiveCFileOptions class]
+                                        isRepeated:NO
+                                          isPacked:NO
+                            isMessageSetWireFormat:NO] retain];
+  }
+}
++ (void) registerAllExtensions:(PBMutableExtensionRegistry*) registry {
+  [registry addExtension:ObjectivecDescriptorRoot_objectivecFileOptions];
+}
++ (id<PBExtensionField>) objectivecFileOptions {
+  return ObjectivecDescriptorRoot_objectivecFileOptions;
+}
+@end
+
+@interface ObjectiveCFileOptions ()
+@property (nonatomic, retain) NSString* package;
+@property (nonatomic, retain) NSString* classPrefix;
+@property (nonatomic) BOOL mutableMessages;
+@end
+
+@interface ObjectiveCFileOptions_Builder()
+@property (nonatomic, retain) ObjectiveCFileOptions* result;
+- (id) initWithPrototype:(ObjectiveCFileOptions*) prototype;
+- (void) detachFromPrototype;
+@end
+
+@implementation ObjectiveCFileOptions
+
+- (BOOL) hasPackage {
+  return (hasBits_[0] & 0x1u) != 0;
+}
+- (void) setHasPackage:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x1u;
+  } else {
+    hasBits_[0] &= ~0x1u;
+  }
+}
+@synthesize package;
+- (NSString*) package {
+  return (hasBits_[0] & 0x1u) ? package : @"";
+}
+- (BOOL) hasClassPrefix {
+  return (hasBits_[0] & 0x2u) != 0;
+}
+- (void) setHasClassPrefix:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x2u;
+  } else {
+    hasBits_[0] &= ~0x2u;
+  }
+}
+@synthesize classPrefix;
+- (NSString*) classPrefix {
+  return (hasBits_[0] & 0x2u) ? classPrefix : @"";
+}
+- (BOOL) hasMutableMessages {
+  return (hasBits_[0] & 0x4u) != 0;
+}
+- (void) setHasMutableMessages:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x4u;
+  } else {
+    hasBits_[0] &= ~0x4u;
+  }
+}
+- (BOOL) mutableMessages {
+  return !!mutableMessages_;
+}
+- (void) setMutableMessages:(BOOL) value_ {
+  mutableMessages_ = !!value_;
+}
+- (void) dealloc {
+  [package release];
+  [classPrefix release];
+  [super dealloc];
+}
+- (void) clearForReuse {
+  [super clearForReuse];
+  memset(hasBits_, 0, sizeof(hasBits_));
+  [package release];
+  package = nil;
+  [classPrefix release];
+  classPrefix = nil;
+  mutableMessages_ = 0;
+}
+static ObjectiveCFileOptions* defaultObjectiveCFileOptionsInstance = nil;
++ (ObjectiveCFileOptions*) defaultInstance {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultObjectiveCFileOptionsInstance = [[ObjectiveCFileOptions alloc] init];
+  });
+  return defaultObjectiveCFileOptionsInstance;
+}
+- (ObjectiveCFileOptions*) defaultInstance {
+  return [ObjectiveCFileOptions defaultInstance];
+}
+- (BOOL) isInitialized {
+  return YES;
+}
+- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output {
+  if (hasBits_[0] & 0x1u) {
+    [output writeString:1 value:package];
+  }
+  if (hasBits_[0] & 0x2u) {
+    [output writeString:2 value:classPrefix];
+  }
+  if (hasBits_[0] & 0x4u) {
+    [output writeBool:3 value:!!mutableMessages_];
+  }
+  [self.unknownFields writeToCodedOutputStream:output];
+}
+- (int32_t) serializedSize {
+  int32_t size_ = PBGeneratedMessageGetMemoizedSize(&memoizedSerializedSize);
+  if (size_ != -1) {
+    return size_;
+  }
+
+  size_ = 0;
+  if (hasBits_[0] & 0x1u) {
+    size_ += computeStringSize(1, package);
+  }
+  if (hasBits_[0] & 0x2u) {
+    size_ += computeStringSize(2, classPrefix);
+  }
+  if (hasBits_[0] & 0x4u) {
+    size_ += computeBoolSize(3, !!mutableMessages_);
+  }
+  size_ += self.unknownFields.serializedSize;
+  PBGeneratedMessageSetMemoizedSize(&memoizedSerializedSize, size_);
+  return size_;
+}
++ (ObjectiveCFileOptions*) parseFromData:(NSData*) data {
+  return (ObjectiveCFileOptions*)[[[ObjectiveCFileOptions builder] mergeFromData:data] build];
+}
++ (ObjectiveCFileOptions*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
+  return (ObjectiveCFileOptions*)[[[ObjectiveCFileOptions builder] mergeFromData:data extensionRegistry:extensionRegistry] build];
+}
++ (ObjectiveCFileOptions*) parseFromInputStream:(NSInputStream*) input {
+  return (ObjectiveCFileOptions*)[[[ObjectiveCFileOptions builder] mergeFromInputStream:input] build];
+}
++ (ObjectiveCFileOptions*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
+  return (ObjectiveCFileOptions*)[[[ObjectiveCFileOptions builder] mergeFromInputStream:input extensionRegistry:extensionRegistry] build];
+}
++ (ObjectiveCFileOptions*) parseFromCodedInputStream:(PBCodedInputStream*) input {
+  return (ObjectiveCFileOptions*)[[[ObjectiveCFileOptions builder] mergeFromCodedInputStream:input] build];
+}
++ (ObjectiveCFileOptions*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
+  return (ObjectiveCFileOptions*)[[[ObjectiveCFileOptions builder] mergeFromCodedInputStream:input extensionRegistry:extensionRegistry] build];
+}
++ (ObjectiveCFileOptions_Builder*) builder {
+  return [[[ObjectiveCFileOptions_Builder alloc] init] autorelease];
+}
++ (ObjectiveCFileOptions_Builder*) builderWithPrototype:(ObjectiveCFileOptions*) prototype {
+  return [[[ObjectiveCFileOptions_Builder alloc] initWithPrototype:prototype] autorelease];
+}
+- (ObjectiveCFileOptions_Builder*) builder {
+  return [ObjectiveCFileOptions builder];
+}
+- (ObjectiveCFileOptions_Builder*) toBuilder {
+  return [ObjectiveCFileOptions builderWithPrototype:self];
+}
+- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
+  if (hasBits_[0] & 0x1u) {
+    [output appendFormat:@"%@%@: %@\n", indent, @"package", package];
+  }
+  if (hasBits_[0] & 0x2u) {
+    [output appendFormat:@"%@%@: %@\n", indent, @"classPrefix", classPrefix];
+  }
+  if (hasBits_[0] & 0x4u) {
+    [output appendFormat:@"%@%@: %@\n", indent, @"mutableMessages", [NSNumber numberWithBool:!!mutableMessages_]];
+  }
+  [self.unknownFields writeDescriptionTo:output withIndent:indent];
+}
+- (BOOL) isEqual:(id)other {
+  if (other == self) {
+    return YES;
+  }
+  if (![other isKindOfClass:[ObjectiveCFileOptions class]]) {
+    return NO;
+  }
+  ObjectiveCFileOptions *otherMessage = other;
+  return
+      (hasBits_[0] & 0x1u) == (otherMessage->hasBits_[0] & 0x1u) &&
+      (!(hasBits_[0] & 0x1u) || [package isEqual:otherMessage->package]) &&
+      (hasBits_[0] & 0x2u) == (otherMessage->hasBits_[0] & 0x2u) &&
+      (!(hasBits_[0] & 0x2u) || [classPrefix isEqual:otherMessage->classPrefix]) &&
+      (hasBits_[0] & 0x4u) == (otherMessage->hasBits_[0] & 0x4u) &&
+      (!(hasBits_[0] & 0x4u) || !!mutableMessages_ == !!otherMessage->mutableMessages_) &&
+      (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
+}
+- (NSUInteger) hash {
+  NSUInteger hash_ = PBGeneratedMessageGetMemoizedHash(&memoizedHash);
+  if (hash_ != 0) {
+    return hash_;
+  }
+
+  uint64_t hashCode = 7;
+  if (hasBits_[0] & 0x1u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [package hash]);
+  }
+  if (hasBits_[0] & 0x2u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [classPrefix hash]);
+  }
+  if (hasBits_[0] & 0x4u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, (uint64_t)!!mutableMessages_);
+  }
+  hashCode = PBGeneratedMessageHashMix(hashCode, [self.unknownFields hash]);
+  hash_ = PBGeneratedMessageHashFinish(hashCode);
+  PBGeneratedMessageSetMemoizedHash(&memoizedHash, hash_);
+  return hash_;
+}
+@end
+
+@implementation ObjectiveCFileOptions_Builder
+@synthesize result;
+- (void) dealloc {
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
+  self.result = nil;
+  [prototype_ release];
+  [super dealloc];
+}
+- (id) init {
+  if ((self = [super init])) {
+    result = [ObjectiveCFileOptions recycledInstance];
+  }
+  return self;
+}
+- (id) initWithPrototype:(ObjectiveCFileOptions*) prototype {
+  if ((self = [super init])) {
+    self.result = prototype;
+    prototype_ = [prototype retain];
+  }
+  return self;
+}
+- (void) detachFromPrototype {
+  ObjectiveCFileOptions* prototype = prototype_;
+  prototype_ = nil;
+  self.result = [[[ObjectiveCFileOptions alloc] init] autorelease];
+  [self mergeFrom:prototype];
+  [prototype release];
+}
+- (PBGeneratedMessage*) internalGetMutableResult {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return [self internalGetResult];
+}
+- (PBGeneratedMessage*) internalGetResult {
+  return result;
+}
+- (ObjectiveCFileOptions_Builder*) clear {
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = [[ObjectiveCFileOptions recycledInstance] autorelease];
+  return self;
+}
+- (ObjectiveCFileOptions_Builder*) clone {
+  if (prototype_ != nil) {
+    return [[[ObjectiveCFileOptions_Builder alloc] initWithPrototype:prototype_] autorelease];
+  }
+  return [[ObjectiveCFileOptions builder] mergeFrom:result];
+}
+- (ObjectiveCFileOptions_Builder*) reset {
+  if (result == nil || prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    self.result = [[ObjectiveCFileOptions recycledInstance] autorelease];
+  } else {
+    [result clearForReuse];
+  }
+  return self;
+}
+- (ObjectiveCFileOptions_Builder*) recycle:(ObjectiveCFileOptions*) message {
+  if (message == [ObjectiveCFileOptions defaultInstance]) {
+    @throw [NSException exceptionWithName:@"IllegalArgument" reason:@"Cannot recycle the default instance" userInfo:nil];
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = message;
+  return [self reset];
+}
+- (ObjectiveCFileOptions*) defaultInstance {
+  return [ObjectiveCFileOptions defaultInstance];
+}
+- (ObjectiveCFileOptions*) build {
+  [self checkInitialized];
+  return [self buildPartial];
+}
+- (ObjectiveCFileOptions*) buildPartial {
+  return [[self newBuildPartial] autorelease];
+}
+- (ObjectiveCFileOptions*) newBuildPartial {
+  if (prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    ObjectiveCFileOptions* returnMe = result;
+    result = nil;
+    return returnMe;
+  }
+  ObjectiveCFileOptions* returnMe = result;
+  result = nil;
+  return returnMe;
+}
+- (ObjectiveCFileOptions_Builder*) mergeFrom:(ObjectiveCFileOptions*) other {
+  if (other == [ObjectiveCFileOptions defaultInstance]) {
+    return self;
+  }
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (other->hasBits_[0] & 0x1u) {
+    [self setPackage:other->package];
+  }
+  if (other->hasBits_[0] & 0x2u) {
+    [self setClassPrefix:other->classPrefix];
+  }
+  if (other->hasBits_[0] & 0x4u) {
+    [self setMutableMessages:other->mutableMessages_];
+  }
+  [self mergeUnknownFields:other.unknownFields];
+  return self;
+}
+- (ObjectiveCFileOptions_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input {
+  return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
+}
+- (ObjectiveCFileOptions_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  PBUnknownFieldSet_Builder* unknownFields = nil;
+  while (YES) {
+    int32_t tag = [input readTag];
+    switch (tag) {
+      case 0:
+        if (unknownFields != nil) {
+          [self setUnknownFields:[unknownFields build]];
+        }
+        return self;
+      default: {
+        if (PBWireFormatGetTagWireType(tag) == PBWireFormatEndGroup) {
+          if (unknownFields != nil) {
+            [self setUnknownFields:[unknownFields build]];
+          }
+          return self;
+        }
+        if (unknownFields == nil) {
+          unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+        }
+        [self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag];
+        break;
+      }
+      case 10: {
+        NSString* value = [input newString];
+        [self setPackage:value];
+        [value release];
+        break;
+      }
+      case 18: {
+        NSString* value = [input newString];
+        [self setClassPrefix:value];
+        [value release];
+        break;
+      }
+      case 24: {
+        [self setMutableMessages:[input readBool]];
+        break;
+      }
+    }
+  }
+}
+- (BOOL) hasPackage {
+  return (result->hasBits_[0] & 0x1u) != 0;
+}
+- (NSString*) package {
+  return [result package];
+}
+- (ObjectiveCFileOptions_Builder*) setPackage:(NSString*) value {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x1u;
+  result.package = value;
+  return self;
+}
+- (ObjectiveCFileOptions_Builder*) clearPackage {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x1u;
+  [result->package release];
+  result->package = nil;
+  return self;
+}
+- (BOOL) hasClassPrefix {
+  return (result->hasBits_[0] & 0x2u) != 0;
+}
+- (NSString*) classPrefix {
+  return [result classPrefix];
+}
+- (ObjectiveCFileOptions_Builder*) setClassPrefix:(NSString*) value {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x2u;
+  result.classPrefix = value;
+  return self;
+}
+- (ObjectiveCFileOptions_Builder*) clearClassPrefix {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x2u;
+  [result->classPrefix release];
+  result->classPrefix = nil;
+  return self;
+}
+- (BOOL) hasMutableMessages {
+  return (result->hasBits_[0] & 0x4u) != 0;
+}
+- (BOOL) mutableMessages {
+  return !!result->mutableMessages_;
+}
+- (ObjectiveCFileOptions_Builder*) setMutableMessages:(BOOL) value {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x4u;
+  result->mutableMessages_ = !!value;
+  return self;
+}
+- (ObjectiveCFileOptions_Builder*) clearMutableMessages {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x4u;
+  result->mutableMessages_ = 0;
+  return self;
+}
+@end
+
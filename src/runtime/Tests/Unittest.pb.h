@@ -236,51 +236,8 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 @end
 
 @interface TestAllTypes : PBGeneratedMessage {
-@private
-  BOOL hasOptionalBool_:1;
-  BOOL hasDefaultBool_:1;
-  BOOL hasOptionalDouble_:1;
-  BOOL hasDefaultDouble_:1;
-  BOOL hasDefaultFloat_:1;
-  BOOL hasOptionalFloat_:1;
-  BOOL hasOptionalInt64_:1;
-  BOOL hasDefaultInt64_:1;
-  BOOL hasOptionalUint64_:1;
-  BOOL hasDefaultUint64_:1;
-  BOOL hasDefaultInt32_:1;
-  BOOL hasOptionalInt32_:1;
-  BOOL hasOptionalFixed64_:1;
-  BOOL hasDefaultFixed64_:1;
-  BOOL hasOptionalFixed32_:1;
-  BOOL hasDefaultFixed32_:1;
-  BOOL hasDefaultString_:1;
-  BOOL hasDefaultStringPiece_:1;
-  BOOL hasDefaultCord_:1;
-  BOOL hasOptionalCord_:1;
-  BOOL hasOptionalStringPiece_:1;
-  BOOL hasOptionalString_:1;
-  BOOL hasOptionalGroup_:1;
-  BOOL hasOptionalNestedMessage_:1;
-  BOOL hasOptionalForeignMessage_:1;
-  BOOL hasOptionalImportMessage_:1;
-  BOOL hasDefaultBytes_:1;
-  BOOL hasOptionalBytes_:1;
-  BOOL hasOptionalUint32_:1;
-  BOOL hasDefaultUint32_:1;
-  BOOL hasDefaultImportEnum_:1;
-  BOOL hasDefaultForeignEnum_:1;
-  BOOL hasDefaultNestedEnum_:1;
-  BOOL hasOptionalImportEnum_:1;
-  BOOL hasOptionalForeignEnum_:1;
-  BOOL hasOptionalNestedEnum_:1;
-  BOOL hasDefaultSfixed32_:1;
-  BOOL hasOptionalSfixed32_:1;
-  BOOL hasDefaultSfixed64_:1;
-  BOOL hasOptionalSfixed64_:1;
-  BOOL hasDefaultSint32_:1;
-  BOOL hasOptionalSint32_:1;
-  BOOL hasOptionalSint64_:1;
-  BOOL hasDefaultSint64_:1;
+@package
+  uint32_t hasBits_[2];
   BOOL optionalBool_:1;
   BOOL defaultBool_:1;
   Float64 optionalDouble;
@@ -291,8 +248,8 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
   int64_t defaultInt64;
   uint64_t optionalUint64;
   uint64_t defaultUint64;
-  int32_t defaultInt32;
   int32_t optionalInt32;
+  int32_t defaultInt32;
   uint64_t optionalFixed64;
   uint64_t defaultFixed64;
   uint32_t optionalFixed32;
@@ -311,44 +268,44 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
   NSData* optionalBytes;
   uint32_t optionalUint32;
   uint32_t defaultUint32;
+  ForeignEnum optionalForeignEnum;
   ImportEnum defaultImportEnum;
   ForeignEnum defaultForeignEnum;
   TestAllTypes_NestedEnum defaultNestedEnum;
   ImportEnum optionalImportEnum;
-  ForeignEnum optionalForeignEnum;
   TestAllTypes_NestedEnum optionalNestedEnum;
-  int32_t defaultSfixed32;
   int32_t optionalSfixed32;
-  int64_t defaultSfixed64;
+  int32_t defaultSfixed32;
   int64_t optionalSfixed64;
-  int32_t defaultSint32;
+  int64_t defaultSfixed64;
   int32_t optionalSint32;
+  int32_t defaultSint32;
   int64_t optionalSint64;
   int64_t defaultSint64;
-  PBAppendableArray * repeatedBoolArray;
-  PBAppendableArray * repeatedDoubleArray;
-  PBAppendableArray * repeatedFloatArray;
-  PBAppendableArray * repeatedInt64Array;
-  PBAppendableArray * repeatedUint64Array;
-  PBAppendableArray * repeatedInt32Array;
-  PBAppendableArray * repeatedFixed64Array;
-  PBAppendableArray * repeatedFixed32Array;
-  PBAppendableArray * repeatedStringArray;
-  PBAppendableArray * repeatedCordArray;
-  PBAppendableArray * repeatedStringPieceArray;
-  PBAppendableArray * repeatedGroupArray;
-  PBAppendableArray * repeatedImportMessageArray;
-  PBAppendableArray * repeatedForeignMessageArray;
-  PBAppendableArray * repeatedNestedMessageArray;
-  PBAppendableArray * repeatedBytesArray;
-  PBAppendableArray * repeatedUint32Array;
-  PBAppendableArray * repeatedImportEnumArray;
-  PBAppendableArray * repeatedForeignEnumArray;
-  PBAppendableArray * repeatedNestedEnumArray;
-  PBAppendableArray * repeatedSfixed32Array;
-  PBAppendableArray * repeatedSfixed64Array;
-  PBAppendableArray * repeatedSint32Array;
-  PBAppendableArray * repeatedSint64Array;
+  PBBoolArray * repeatedBoolArray;
+  PBDoubleArray * repeatedDoubleArray;
+  PBFloatArray * repeatedFloatArray;
+  PBInt64Array * repeatedInt64Array;
+  PBUInt64Array * repeatedUint64Array;
+  PBInt32Array * repeatedInt32Array;
+  PBUInt64Array * repeatedFixed64Array;
+  PBUInt32Array * repeatedFixed32Array;
+  PBObjectArray * repeatedCordArray;
+  PBObjectArray * repeatedStringArray;
+  PBObjectArray * repeatedStringPieceArray;
+  PBObjectArray * repeatedGroupArray;
+  PBObjectArray * repeatedImportMessageArray;
+  PBObjectArray * repeatedForeignMessageArray;
+  PBObjectArray * repeatedNestedMessageArray;
+  PBObjectArray * repeatedBytesArray;
+  PBUInt32Array * repeatedUint32Array;
+  PBInt32Array * repeatedNestedEnumArray;
+  PBInt32Array * repeatedForeignEnumArray;
+  PBInt32Array * repeatedImportEnumArray;
+  PBInt32Array * repeatedSfixed32Array;
+  PBInt64Array * repeatedSfixed64Array;
+  PBInt32Array * repeatedSint32Array;
+  PBInt64Array * repeatedSint64Array;
 }
 - (BOOL) hasOptionalInt32;
 - (BOOL) hasOptionalInt64;
@@ -394,74 +351,74 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 - (BOOL) hasDefaultImportEnum;
 - (BOOL) hasDefaultStringPiece;
 - (BOOL) hasDefaultCord;
-@property (readonly) int32_t optionalInt32;
-@property (readonly) int64_t optionalInt64;
-@property (readonly) uint32_t optionalUint32;
-@property (readonly) uint64_t optionalUint64;
-@property (readonly) int32_t optionalSint32;
-@property (readonly) int64_t optionalSint64;
-@property (readonly) uint32_t optionalFixed32;
-@property (readonly) uint64_t optionalFixed64;
-@property (readonly) int32_t optionalSfixed32;
-@property (readonly) int64_t optionalSfixed64;
-@property (readonly) Float32 optionalFloat;
-@property (readonly) Float64 optionalDouble;
+@property (nonatomic, readonly) int32_t optionalInt32;
+@property (nonatomic, readonly) int64_t optionalInt64;
+@property (nonatomic, readonly) uint32_t optionalUint32;
+@property (nonatomic, readonly) uint64_t optionalUint64;
+@property (nonatomic, readonly) int32_t optionalSint32;
+@property (nonatomic, readonly) int64_t optionalSint64;
+@property (nonatomic, readonly) uint32_t optionalFixed32;
+@property (nonatomic, readonly) uint64_t optionalFixed64;
+@property (nonatomic, readonly) int32_t optionalSfixed32;
+@property (nonatomic, readonly) int64_t optionalSfixed64;
+@property (nonatomic, readonly) Float32 optionalFloat;
+@property (nonatomic, readonly) Float64 optionalDouble;
 - (BOOL) optionalBool;
-@property (readonly, retain) NSString* optionalString;
-@property (readonly, retain) NSData* optionalBytes;
-@property (readonly, retain) TestAllTypes_OptionalGroup* optionalGroup;
-@property (readonly, retain) TestAllTypes_NestedMessage* optionalNestedMessage;
-@property (readonly, retain) ForeignMessage* optionalForeignMessage;
-@property (readonly, retain) ImportMessage* optionalImportMessage;
-@property (readonly) TestAllTypes_NestedEnum optionalNestedEnum;
-@property (readonly) ForeignEnum optionalForeignEnum;
-@property (readonly) ImportEnum optionalImportEnum;
-@property (readonly, retain) NSString* optionalStringPiece;
-@property (readonly, retain) NSString* optionalCord;
-@property (readonly, retain) PBArray * repeatedInt32;
-@property (readonly, retain) PBArray * repeatedInt64;
-@property (readonly, retain) PBArray * repeatedUint32;
-@property (readonly, retain) PBArray * repeatedUint64;
-@property (readonly, retain) PBArray * repeatedSint32;
-@property (readonly, retain) PBArray * repeatedSint64;
-@property (readonly, retain) PBArray * repeatedFixed32;
-@property (readonly, retain) PBArray * repeatedFixed64;
-@property (readonly, retain) PBArray * repeatedSfixed32;
-@property (readonly, retain) PBArray * repeatedSfixed64;
-@property (readonly, retain) PBArray * repeatedFloat;
-@property (readonly, retain) PBArray * repeatedDouble;
-@property (readonly, retain) PBArray * repeatedBool;
-@property (readonly, retain) PBArray * repeatedString;
-@property (readonly, retain) PBArray * repeatedBytes;
-@property (readonly, retain) PBArray * repeatedGroup;
-@property (readonly, retain) PBArray * repeatedNestedMessage;
-@property (readonly, retain) PBArray * repeatedForeignMessage;
-@property (readonly, retain) PBArray * repeatedImportMessage;
-@property (readonly, retain) PBArray * repeatedNestedEnum;
-@property (readonly, retain) PBArray * repeatedForeignEnum;
-@property (readonly, retain) PBArray * repeatedImportEnum;
-@property (readonly, retain) PBArray * repeatedStringPiece;
-@property (readonly, retain) PBArray * repeatedCord;
-@property (readonly) int32_t defaultInt32;
-@property (readonly) int64_t defaultInt64;
-@property (readonly) uint32_t defaultUint32;
-@property (readonly) uint64_t defaultUint64;
-@property (readonly) int32_t defaultSint32;
-@property (readonly) int64_t defaultSint64;
-@property (readonly) uint32_t defaultFixed32;
-@property (readonly) uint64_t defaultFixed64;
-@property (readonly) int32_t defaultSfixed32;
-@property (readonly) int64_t defaultSfixed64;
-@property (readonly) Float32 defaultFloat;
-@property (readonly) Float64 defaultDouble;
+@property (nonatomic, readonly, retain) NSString* optionalString;
+@property (nonatomic, readonly, retain) NSData* optionalBytes;
+@property (nonatomic, readonly, retain) TestAllTypes_OptionalGroup* optionalGroup;
+@property (nonatomic, readonly, retain) TestAllTypes_NestedMessage* optionalNestedMessage;
+@property (nonatomic, readonly, retain) ForeignMessage* optionalForeignMessage;
+@property (nonatomic, readonly, retain) ImportMessage* optionalImportMessage;
+@property (nonatomic, readonly) TestAllTypes_NestedEnum optionalNestedEnum;
+@property (nonatomic, readonly) ForeignEnum optionalForeignEnum;
+@property (nonatomic, readonly) ImportEnum optionalImportEnum;
+@property (nonatomic, readonly, retain) NSString* optionalStringPiece;
+@property (nonatomic, readonly, retain) NSString* optionalCord;
+@property (nonatomic, readonly, retain) PBArray * repeatedInt32;
+@property (nonatomic, readonly, retain) PBArray * repeatedInt64;
+@property (nonatomic, readonly, retain) PBArray * repeatedUint32;
+@property (nonatomic, readonly, retain) PBArray * repeatedUint64;
+@property (nonatomic, readonly, retain) PBArray * repeatedSint32;
+@property (nonatomic, readonly, retain) PBArray * repeatedSint64;
+@property (nonatomic, readonly, retain) PBArray * repeatedFixed32;
+@property (nonatomic, readonly, retain) PBArray * repeatedFixed64;
+@property (nonatomic, readonly, retain) PBArray * repeatedSfixed32;
+@property (nonatomic, readonly, retain) PBArray * repeatedSfixed64;
+@property (nonatomic, readonly, retain) PBArray * repeatedFloat;
+@property (nonatomic, readonly, retain) PBArray * repeatedDouble;
+@property (nonatomic, readonly, retain) PBArray * repeatedBool;
+@property (nonatomic, readonly, retain) PBArray * repeatedString;
+@property (nonatomic, readonly, retain) PBArray * repeatedBytes;
+@property (nonatomic, readonly, retain) PBArray * repeatedGroup;
+@property (nonatomic, readonly, retain) PBArray * repeatedNestedMessage;
+@property (nonatomic, readonly, retain) PBArray * repeatedForeignMessage;
+@property (nonatomic, readonly, retain) PBArray * repeatedImportMessage;
+@property (nonatomic, readonly, retain) PBArray * repeatedNestedEnum;
+@property (nonatomic, readonly, retain) PBArray * repeatedForeignEnum;
+@property (nonatomic, readonly, retain) PBArray * repeatedImportEnum;
+@property (nonatomic, readonly, retain) PBArray * repeatedStringPiece;
+@property (nonatomic, readonly, retain) PBArray * repeatedCord;
+@property (nonatomic, readonly) int32_t defaultInt32;
+@property (nonatomic, readonly) int64_t defaultInt64;
+@property (nonatomic, readonly) uint32_t defaultUint32;
+@property (nonatomic, readonly) uint64_t defaultUint64;
+@property (nonatomic, readonly) int32_t defaultSint32;
+@property (nonatomic, readonly) int64_t defaultSint64;
+@property (nonatomic, readonly) uint32_t defaultFixed32;
+@property (nonatomic, readonly) uint64_t defaultFixed64;
+@property (nonatomic, readonly) int32_t defaultSfixed32;
+@property (nonatomic, readonly) int64_t defaultSfixed64;
+@property (nonatomic, readonly) Float32 defaultFloat;
+@property (nonatomic, readonly) Float64 defaultDouble;
 - (BOOL) defaultBool;
-@property (readonly, retain) NSString* defaultString;
-@property (readonly, retain) NSData* defaultBytes;
-@property (readonly) TestAllTypes_NestedEnum defaultNestedEnum;
-@property (readonly) ForeignEnum defaultForeignEnum;
-@property (readonly) ImportEnum defaultImportEnum;
-@property (readonly, retain) NSString* defaultStringPiece;
-@property (readonly, retain) NSString* defaultCord;
+@property (nonatomic, readonly, retain) NSString* defaultString;
+@property (nonatomic, readonly, retain) NSData* defaultBytes;
+@property (nonatomic, readonly) TestAllTypes_NestedEnum defaultNestedEnum;
+@property (nonatomic, readonly) ForeignEnum defaultForeignEnum;
+@property (nonatomic, readonly) ImportEnum defaultImportEnum;
+@property (nonatomic, readonly, retain) NSString* defaultStringPiece;
+@property (nonatomic, readonly, retain) NSString* defaultCord;
 - (int32_t)repeatedInt32AtIndex:(NSUInteger)index;
 - (int64_t)repeatedInt64AtIndex:(NSUInteger)index;
 - (uint32_t)repeatedUint32AtIndex:(NSUInteger)index;
@@ -506,12 +463,12 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 @end
 
 @interface TestAllTypes_NestedMessage : PBGeneratedMessage {
-@private
-  BOOL hasBb_:1;
+@package
+  uint32_t hasBits_[1];
   int32_t bb;
 }
 - (BOOL) hasBb;
-@property (readonly) int32_t bb;
+@property (nonatomic, readonly) int32_t bb;
 
 + (TestAllTypes_NestedMessage*) defaultInstance;
 - (TestAllTypes_NestedMessage*) defaultInstance;
@@ -534,15 +491,24 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 @interface TestAllTypes_NestedMessage_Builder : PBGeneratedMessage_Builder {
 @private
   TestAllTypes_NestedMessage* result;
+  TestAllTypes_NestedMessage* prototype_;
 }
 
 - (TestAllTypes_NestedMessage*) defaultInstance;
 
 - (TestAllTypes_NestedMessage_Builder*) clear;
 - (TestAllTypes_NestedMessage_Builder*) clone;
+- (TestAllTypes_NestedMessage_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (TestAllTypes_NestedMessage_Builder*) recycle:(TestAllTypes_NestedMessage*) message;
 
 - (TestAllTypes_NestedMessage*) build;
 - (TestAllTypes_NestedMessage*) buildPartial;
+- (TestAllTypes_NestedMessage*) newBuildPartial;
 
 - (TestAllTypes_NestedMessage_Builder*) mergeFrom:(TestAllTypes_NestedMessage*) other;
 - (TestAllTypes_NestedMessage_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -555,12 +521,12 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 @end
 
 @interface TestAllTypes_OptionalGroup : PBGeneratedMessage {
-@private
-  BOOL hasA_:1;
+@package
+  uint32_t hasBits_[1];
   int32_t a;
 }
 - (BOOL) hasA;
-@property (readonly) int32_t a;
+@property (nonatomic, readonly) int32_t a;
 
 + (TestAllTypes_OptionalGroup*) defaultInstance;
 - (TestAllTypes_OptionalGroup*) defaultInstance;
@@ -583,15 +549,24 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 @interface TestAllTypes_OptionalGroup_Builder : PBGeneratedMessage_Builder {
 @private
   TestAllTypes_OptionalGroup* result;
+  TestAllTypes_OptionalGroup* prototype_;
 }
 
 - (TestAllTypes_OptionalGroup*) defaultInstance;
 
 - (TestAllTypes_OptionalGroup_Builder*) clear;
 - (TestAllTypes_OptionalGroup_Builder*) clone;
+- (TestAllTypes_OptionalGroup_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (TestAllTypes_OptionalGroup_Builder*) recycle:(TestAllTypes_OptionalGroup*) message;
 
 - (TestAllTypes_OptionalGroup*) build;
 - (TestAllTypes_OptionalGroup*) buildPartial;
+- (TestAllTypes_OptionalGroup*) newBuildPartial;
 
 - (TestAllTypes_OptionalGroup_Builder*) mergeFrom:(TestAllTypes_OptionalGroup*) other;
 - (TestAllTypes_OptionalGroup_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -604,12 +579,12 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 @end
 
 @interface TestAllTypes_RepeatedGroup : PBGeneratedMessage {
-@private
-  BOOL hasA_:1;
+@package
+  uint32_t hasBits_[1];
   int32_t a;
 }
 - (BOOL) hasA;
-@property (readonly) int32_t a;
+@property (nonatomic, readonly) int32_t a;
 
 + (TestAllTypes_RepeatedGroup*) defaultInstance;
 - (TestAllTypes_RepeatedGroup*) defaultInstance;
@@ -632,15 +607,24 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 @interface TestAllTypes_RepeatedGroup_Builder : PBGeneratedMessage_Builder {
 @private
   TestAllTypes_RepeatedGroup* result;
+  TestAllTypes_RepeatedGroup* prototype_;
 }
 
 - (TestAllTypes_RepeatedGroup*) defaultInstance;
 
 - (TestAllTypes_RepeatedGroup_Builder*) clear;
 - (TestAllTypes_RepeatedGroup_Builder*) clone;
+- (TestAllTypes_RepeatedGroup_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (TestAllTypes_RepeatedGroup_Builder*) recycle:(TestAllTypes_RepeatedGroup*) message;
 
 - (TestAllTypes_RepeatedGroup*) build;
 - (TestAllTypes_RepeatedGroup*) buildPartial;
+- (TestAllTypes_RepeatedGroup*) newBuildPartial;
 
 - (TestAllTypes_RepeatedGroup_Builder*) mergeFrom:(TestAllTypes_RepeatedGroup*) other;
 - (TestAllTypes_RepeatedGroup_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -655,15 +639,32 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 @interface TestAllTypes_Builder : PBGeneratedMessage_Builder {
 @private
   TestAllTypes* result;
+  TestAllTypes* prototype_;
+  TestAllTypes_OptionalGroup_Builder* optionalGroupBuilder_;
+  TestAllTypes_OptionalGroup_Builder* optionalGroupSpareBuilder_;
+  TestAllTypes_NestedMessage_Builder* optionalNestedMessageBuilder_;
+  TestAllTypes_NestedMessage_Builder* optionalNestedMessageSpareBuilder_;
+  ForeignMessage_Builder* optionalForeignMessageBuilder_;
+  ForeignMessage_Builder* optionalForeignMessageSpareBuilder_;
+  ImportMessage_Builder* optionalImportMessageBuilder_;
+  ImportMessage_Builder* optionalImportMessageSpareBuilder_;
 }
 
 - (TestAllTypes*) defaultInstance;
 
 - (TestAllTypes_Builder*) clear;
 - (TestAllTypes_Builder*) clone;
+- (TestAllTypes_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (TestAllTypes_Builder*) recycle:(TestAllTypes*) message;
 
 - (TestAllTypes*) build;
 - (TestAllTypes*) buildPartial;
+- (TestAllTypes*) newBuildPartial;
 
 - (TestAllTypes_Builder*) mergeFrom:(TestAllTypes*) other;
 - (TestAllTypes_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -801,6 +802,7 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 - (int32_t)repeatedInt32AtIndex:(NSUInteger)index;
 - (TestAllTypes_Builder *)addRepeatedInt32:(int32_t)value;
 - (TestAllTypes_Builder *)setRepeatedInt32Array:(NSArray *)array;
+- (TestAllTypes_Builder *)setRepeatedInt32:(PBArray *)array;
 - (TestAllTypes_Builder *)setRepeatedInt32Values:(const int32_t *)values count:(NSUInteger)count;
 - (TestAllTypes_Builder *)clearRepeatedInt32;
 
@@ -808,6 +810,7 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 - (int64_t)repeatedInt64AtIndex:(NSUInteger)index;
 - (TestAllTypes_Builder *)addRepeatedInt64:(int64_t)value;
 - (TestAllTypes_Builder *)setRepeatedInt64Array:(NSArray *)array;
+- (TestAllTypes_Builder *)setRepeatedInt64:(PBArray *)array;
 - (TestAllTypes_Builder *)setRepeatedInt64Values:(const int64_t *)values count:(NSUInteger)count;
 - (TestAllTypes_Builder *)clearRepeatedInt64;
 
@@ -815,6 +818,7 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 - (uint32_t)repeatedUint32AtIndex:(NSUInteger)index;
 - (TestAllTypes_Builder *)addRepeatedUint32:(uint32_t)value;
 - (TestAllTypes_Builder *)setRepeatedUint32Array:(NSArray *)array;
+- (TestAllTypes_Builder *)setRepeatedUint32:(PBArray *)array;
 - (TestAllTypes_Builder *)setRepeatedUint32Values:(const uint32_t *)values count:(NSUInteger)count;
 - (TestAllTypes_Builder *)clearRepeatedUint32;
 
@@ -822,6 +826,7 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 - (uint64_t)repeatedUint64AtIndex:(NSUInteger)index;
 - (TestAllTypes_Builder *)addRepeatedUint64:(uint64_t)value;
 - (TestAllTypes_Builder *)setRepeatedUint64Array:(NSArray *)array;
+- (TestAllTypes_Builder *)setRepeatedUint64:(PBArray *)array;
 - (TestAllTypes_Builder *)setRepeatedUint64Values:(const uint64_t *)values count:(NSUInteger)count;
 - (TestAllTypes_Builder *)clearRepeatedUint64;
 
@@ -829,6 +834,7 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 - (int32_t)repeatedSint32AtIndex:(NSUInteger)index;
 - (TestAllTypes_Builder *)addRepeatedSint32:(int32_t)value;
 - (TestAllTypes_Builder *)setRepeatedSint32Array:(NSArray *)array;
+- (TestAllTypes_Builder *)setRepeatedSint32:(PBArray *)array;
 - (TestAllTypes_Builder *)setRepeatedSint32Values:(const int32_t *)values count:(NSUInteger)count;
 - (TestAllTypes_Builder *)clearRepeatedSint32;
 
@@ -836,6 +842,7 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 - (int64_t)repeatedSint64AtIndex:(NSUInteger)index;
 - (TestAllTypes_Builder *)addRepeatedSint64:(int64_t)value;
 - (TestAllTypes_Builder *)setRepeatedSint64Array:(NSArray *)array;
+- (TestAllTypes_Builder *)setRepeatedSint64:(PBArray *)array;
 - (TestAllTypes_Builder *)setRepeatedSint64Values:(const int64_t *)values count:(NSUInteger)count;
 - (TestAllTypes_Builder *)clearRepeatedSint64;
 
@@ -843,6 +850,7 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 - (uint32_t)repeatedFixed32AtIndex:(NSUInteger)index;
 - (TestAllTypes_Builder *)addRepeatedFixed32:(uint32_t)value;
 - (TestAllTypes_Builder *)setRepeatedFixed32Array:(NSArray *)array;
+- (TestAllTypes_Builder *)setRepeatedFixed32:(PBArray *)array;
 - (TestAllTypes_Builder *)setRepeatedFixed32Values:(const uint32_t *)values count:(NSUInteger)count;
 - (TestAllTypes_Builder *)clearRepeatedFixed32;
 
@@ -850,6 +858,7 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 - (uint64_t)repeatedFixed64AtIndex:(NSUInteger)index;
 - (TestAllTypes_Builder *)addRepeatedFixed64:(uint64_t)value;
 - (TestAllTypes_Builder *)setRepeatedFixed64Array:(NSArray *)array;
+- (TestAllTypes_Builder *)setRepeatedFixed64:(PBArray *)array;
 - (TestAllTypes_Builder *)setRepeatedFixed64Values:(const uint64_t *)values count:(NSUInteger)count;
 - (TestAllTypes_Builder *)clearRepeatedFixed64;
 
@@ -857,6 +866,7 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 - (int32_t)repeatedSfixed32AtIndex:(NSUInteger)index;
 - (TestAllTypes_Builder *)addRepeatedSfixed32:(int32_t)value;
 - (TestAllTypes_Builder *)setRepeatedSfixed32Array:(NSArray *)array;
+- (TestAllTypes_Builder *)setRepeatedSfixed32:(PBArray *)array;
 - (TestAllTypes_Builder *)setRepeatedSfixed32Values:(const int32_t *)values count:(NSUInteger)count;
 - (TestAllTypes_Builder *)clearRepeatedSfixed32;
 
@@ -864,6 +874,7 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 - (int64_t)repeatedSfixed64AtIndex:(NSUInteger)index;
 - (TestAllTypes_Builder *)addRepeatedSfixed64:(int64_t)value;
 - (TestAllTypes_Builder *)setRepeatedSfixed64Array:(NSArray *)array;
+- (TestAllTypes_Builder *)setRepeatedSfixed64:(PBArray *)array;
 - (TestAllTypes_Builder *)setRepeatedSfixed64Values:(const int64_t *)values count:(NSUInteger)count;
 - (TestAllTypes_Builder *)clearRepeatedSfixed64;
 
@@ -871,6 +882,7 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 - (Float32)repeatedFloatAtIndex:(NSUInteger)index;
 - (TestAllTypes_Builder *)addRepeatedFloat:(Float32)value;
 - (TestAllTypes_Builder *)setRepeatedFloatArray:(NSArray *)array;
+- (TestAllTypes_Builder *)setRepeatedFloat:(PBArray *)array;
 - (TestAllTypes_Builder *)setRepeatedFloatValues:(const Float32 *)values count:(NSUInteger)count;
 - (TestAllTypes_Builder *)clearRepeatedFloat;
 
@@ -878,6 +890,7 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 - (Float64)repeatedDoubleAtIndex:(NSUInteger)index;
 - (TestAllTypes_Builder *)addRepeatedDouble:(Float64)value;
 - (TestAllTypes_Builder *)setRepeatedDoubleArray:(NSArray *)array;
+- (TestAllTypes_Builder *)setRepeatedDouble:(PBArray *)array;
 - (TestAllTypes_Builder *)setRepeatedDoubleValues:(const Float64 *)values count:(NSUInteger)count;
 - (TestAllTypes_Builder *)clearRepeatedDouble;
 
@@ -885,6 +898,7 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 - (BOOL)repeatedBoolAtIndex:(NSUInteger)index;
 - (TestAllTypes_Builder *)addRepeatedBool:(BOOL)value;
 - (TestAllTypes_Builder *)setRepeatedBoolArray:(NSArray *)array;
+- (TestAllTypes_Builder *)setRepeatedBool:(PBArray *)array;
 - (TestAllTypes_Builder *)setRepeatedBoolValues:(const BOOL *)values count:(NSUInteger)count;
 - (TestAllTypes_Builder *)clearRepeatedBool;
 
@@ -892,6 +906,7 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 - (NSString*)repeatedStringAtIndex:(NSUInteger)index;
 - (TestAllTypes_Builder *)addRepeatedString:(NSString*)value;
 - (TestAllTypes_Builder *)setRepeatedStringArray:(NSArray *)array;
+- (TestAllTypes_Builder *)setRepeatedString:(PBArray *)array;
 - (TestAllTypes_Builder *)setRepeatedStringValues:(const NSString* *)values count:(NSUInteger)count;
 - (TestAllTypes_Builder *)clearRepeatedString;
 
@@ -899,6 +914,7 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 - (NSData*)repeatedBytesAtIndex:(NSUInteger)index;
 - (TestAllTypes_Builder *)addRepeatedBytes:(NSData*)value;
 - (TestAllTypes_Builder *)setRepeatedBytesArray:(NSArray *)array;
+- (TestAllTypes_Builder *)setRepeatedBytes:(PBArray *)array;
 - (TestAllTypes_Builder *)setRepeatedBytesValues:(const NSData* *)values count:(NSUInteger)count;
 - (TestAllTypes_Builder *)clearRepeatedBytes;
 
@@ -934,6 +950,7 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 - (TestAllTypes_NestedEnum)repeatedNestedEnumAtIndex:(NSUInteger)index;
 - (TestAllTypes_Builder *)addRepeatedNestedEnum:(TestAllTypes_NestedEnum)value;
 - (TestAllTypes_Builder *)setRepeatedNestedEnumArray:(NSArray *)array;
+- (TestAllTypes_Builder *)setRepeatedNestedEnum:(PBArray *)array;
 - (TestAllTypes_Builder *)setRepeatedNestedEnumValues:(const TestAllTypes_NestedEnum *)values count:(NSUInteger)count;
 - (TestAllTypes_Builder *)clearRepeatedNestedEnum;
 
@@ -941,6 +958,7 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 - (ForeignEnum)repeatedForeignEnumAtIndex:(NSUInteger)index;
 - (TestAllTypes_Builder *)addRepeatedForeignEnum:(ForeignEnum)value;
 - (TestAllTypes_Builder *)setRepeatedForeignEnumArray:(NSArray *)array;
+- (TestAllTypes_Builder *)setRepeatedForeignEnum:(PBArray *)array;
 - (TestAllTypes_Builder *)setRepeatedForeignEnumValues:(const ForeignEnum *)values count:(NSUInteger)count;
 - (TestAllTypes_Builder *)clearRepeatedForeignEnum;
 
@@ -948,6 +966,7 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 - (ImportEnum)repeatedImportEnumAtIndex:(NSUInteger)index;
 - (TestAllTypes_Builder *)addRepeatedImportEnum:(ImportEnum)value;
 - (TestAllTypes_Builder *)setRepeatedImportEnumArray:(NSArray *)array;
+- (TestAllTypes_Builder *)setRepeatedImportEnum:(PBArray *)array;
 - (TestAllTypes_Builder *)setRepeatedImportEnumValues:(const ImportEnum *)values count:(NSUInteger)count;
 - (TestAllTypes_Builder *)clearRepeatedImportEnum;
 
@@ -955,6 +974,7 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 - (NSString*)repeatedStringPieceAtIndex:(NSUInteger)index;
 - (TestAllTypes_Builder *)addRepeatedStringPiece:(NSString*)value;
 - (TestAllTypes_Builder *)setRepeatedStringPieceArray:(NSArray *)array;
+- (TestAllTypes_Builder *)setRepeatedStringPiece:(PBArray *)array;
 - (TestAllTypes_Builder *)setRepeatedStringPieceValues:(const NSString* *)values count:(NSUInteger)count;
 - (TestAllTypes_Builder *)clearRepeatedStringPiece;
 
@@ -962,6 +982,7 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 - (NSString*)repeatedCordAtIndex:(NSUInteger)index;
 - (TestAllTypes_Builder *)addRepeatedCord:(NSString*)value;
 - (TestAllTypes_Builder *)setRepeatedCordArray:(NSArray *)array;
+- (TestAllTypes_Builder *)setRepeatedCord:(PBArray *)array;
 - (TestAllTypes_Builder *)setRepeatedCordValues:(const NSString* *)values count:(NSUInteger)count;
 - (TestAllTypes_Builder *)clearRepeatedCord;
 
@@ -1067,12 +1088,12 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 @end
 
 @interface TestDeprecatedFields : PBGeneratedMessage {
-@private
-  BOOL hasDeprecatedInt32_:1;
+@package
+  uint32_t hasBits_[1];
   int32_t deprecatedInt32;
 }
 - (BOOL) hasDeprecatedInt32;
-@property (readonly) int32_t deprecatedInt32;
+@property (nonatomic, readonly) int32_t deprecatedInt32;
 
 + (TestDeprecatedFields*) defaultInstance;
 - (TestDeprecatedFields*) defaultInstance;
@@ -1095,15 +1116,24 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 @interface TestDeprecatedFields_Builder : PBGeneratedMessage_Builder {
 @private
   TestDeprecatedFields* result;
+  TestDeprecatedFields* prototype_;
 }
 
 - (TestDeprecatedFields*) defaultInstance;
 
 - (TestDeprecatedFields_Builder*) clear;
 - (TestDeprecatedFields_Builder*) clone;
+- (TestDeprecatedFields_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (TestDeprecatedFields_Builder*) recycle:(TestDeprecatedFields*) message;
 
 - (TestDeprecatedFields*) build;
 - (TestDeprecatedFields*) buildPartial;
+- (TestDeprecatedFields*) newBuildPartial;
 
 - (TestDeprecatedFields_Builder*) mergeFrom:(TestDeprecatedFields*) other;
 - (TestDeprecatedFields_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -1116,12 +1146,12 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 @end
 
 @interface ForeignMessage : PBGeneratedMessage {
-@private
-  BOOL hasC_:1;
+@package
+  uint32_t hasBits_[1];
   int32_t c;
 }
 - (BOOL) hasC;
-@property (readonly) int32_t c;
+@property (nonatomic, readonly) int32_t c;
 
 + (ForeignMessage*) defaultInstance;
 - (ForeignMessage*) defaultInstance;
@@ -1144,15 +1174,24 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 @interface ForeignMessage_Builder : PBGeneratedMessage_Builder {
 @private
   ForeignMessage* result;
+  ForeignMessage* prototype_;
 }
 
 - (ForeignMessage*) defaultInstance;
 
 - (ForeignMessage_Builder*) clear;
 - (ForeignMessage_Builder*) clone;
+- (ForeignMessage_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (ForeignMessage_Builder*) recycle:(ForeignMessage*) message;
 
 - (ForeignMessage*) build;
 - (ForeignMessage*) buildPartial;
+- (ForeignMessage*) newBuildPartial;
 
 - (ForeignMessage_Builder*) mergeFrom:(ForeignMessage*) other;
 - (ForeignMessage_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -1165,7 +1204,8 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 @end
 
 @interface TestAllExtensions : PBExtendableMessage {
-@private
+@package
+  uint32_t hasBits_[1];
 }
 
 + (TestAllExtensions*) defaultInstance;
@@ -1189,15 +1229,24 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 @interface TestAllExtensions_Builder : PBExtendableMessage_Builder {
 @private
   TestAllExtensions* result;
+  TestAllExtensions* prototype_;
 }
 
 - (TestAllExtensions*) defaultInstance;
 
 - (TestAllExtensions_Builder*) clear;
 - (TestAllExtensions_Builder*) clone;
+- (TestAllExtensions_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (TestAllExtensions_Builder*) recycle:(TestAllExtensions*) message;
 
 - (TestAllExtensions*) build;
 - (TestAllExtensions*) buildPartial;
+- (TestAllExtensions*) newBuildPartial;
 
 - (TestAllExtensions_Builder*) mergeFrom:(TestAllExtensions*) other;
 - (TestAllExtensions_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -1205,12 +1254,12 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 @end
 
 @interface OptionalGroup_extension : PBGeneratedMessage {
-@private
-  BOOL hasA_:1;
+@package
+  uint32_t hasBits_[1];
   int32_t a;
 }
 - (BOOL) hasA;
-@property (readonly) int32_t a;
+@property (nonatomic, readonly) int32_t a;
 
 + (OptionalGroup_extension*) defaultInstance;
 - (OptionalGroup_extension*) defaultInstance;
@@ -1233,15 +1282,24 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 @interface OptionalGroup_extension_Builder : PBGeneratedMessage_Builder {
 @private
   OptionalGroup_extension* result;
+  OptionalGroup_extension* prototype_;
 }
 
 - (OptionalGroup_extension*) defaultInstance;
 
 - (OptionalGroup_extension_Builder*) clear;
 - (OptionalGroup_extension_Builder*) clone;
+- (OptionalGroup_extension_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (OptionalGroup_extension_Builder*) recycle:(OptionalGroup_extension*) message;
 
 - (OptionalGroup_extension*) build;
 - (OptionalGroup_extension*) buildPartial;
+- (OptionalGroup_extension*) newBuildPartial;
 
 - (OptionalGroup_extension_Builder*) mergeFrom:(OptionalGroup_extension*) other;
 - (OptionalGroup_extension_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -1254,12 +1312,12 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 @end
 
 @interface RepeatedGroup_extension : PBGeneratedMessage {
-@private
-  BOOL hasA_:1;
+@package
+  uint32_t hasBits_[1];
   int32_t a;
 }
 - (BOOL) hasA;
-@property (readonly) int32_t a;
+@property (nonatomic, readonly) int32_t a;
 
 + (RepeatedGroup_extension*) defaultInstance;
 - (RepeatedGroup_extension*) defaultInstance;
@@ -1282,15 +1340,24 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 @interface RepeatedGroup_extension_Builder : PBGeneratedMessage_Builder {
 @private
   RepeatedGroup_extension* result;
+  RepeatedGroup_extension* prototype_;
 }
 
 - (RepeatedGroup_extension*) defaultInstance;
 
 - (RepeatedGroup_extension_Builder*) clear;
 - (RepeatedGroup_extension_Builder*) clone;
+- (RepeatedGroup_extension_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (RepeatedGroup_extension_Builder*) recycle:(RepeatedGroup_extension*) message;
 
 - (RepeatedGroup_extension*) build;
 - (RepeatedGroup_extension*) buildPartial;
+- (RepeatedGroup_extension*) newBuildPartial;
 
 - (RepeatedGroup_extension_Builder*) mergeFrom:(RepeatedGroup_extension*) other;
 - (RepeatedGroup_extension_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -1303,7 +1370,8 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 @end
 
 @interface TestNestedExtension : PBGeneratedMessage {
-@private
+@package
+  uint32_t hasBits_[1];
 }
 
 + (TestNestedExtension*) defaultInstance;
@@ -1328,15 +1396,24 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 @interface TestNestedExtension_Builder : PBGeneratedMessage_Builder {
 @private
   TestNestedExtension* result;
+  TestNestedExtension* prototype_;
 }
 
 - (TestNestedExtension*) defaultInstance;
 
 - (TestNestedExtension_Builder*) clear;
 - (TestNestedExtension_Builder*) clone;
+- (TestNestedExtension_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (TestNestedExtension_Builder*) recycle:(TestNestedExtension*) message;
 
 - (TestNestedExtension*) build;
 - (TestNestedExtension*) buildPartial;
+- (TestNestedExtension*) newBuildPartial;
 
 - (TestNestedExtension_Builder*) mergeFrom:(TestNestedExtension*) other;
 - (TestNestedExtension_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -1344,73 +1421,41 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 @end
 
 @interface TestRequired : PBGeneratedMessage {
-@private
-  BOOL hasC_:1;
-  BOOL hasDummy32_:1;
-  BOOL hasDummy31_:1;
-  BOOL hasDummy30_:1;
-  BOOL hasDummy29_:1;
-  BOOL hasDummy28_:1;
-  BOOL hasDummy27_:1;
-  BOOL hasDummy26_:1;
-  BOOL hasDummy25_:1;
-  BOOL hasDummy24_:1;
-  BOOL hasDummy23_:1;
-  BOOL hasDummy22_:1;
-  BOOL hasDummy21_:1;
-  BOOL hasDummy20_:1;
-  BOOL hasDummy19_:1;
-  BOOL hasDummy18_:1;
-  BOOL hasA_:1;
-  BOOL hasDummy2_:1;
-  BOOL hasB_:1;
-  BOOL hasDummy4_:1;
-  BOOL hasDummy5_:1;
-  BOOL hasDummy6_:1;
-  BOOL hasDummy7_:1;
-  BOOL hasDummy8_:1;
-  BOOL hasDummy9_:1;
-  BOOL hasDummy10_:1;
-  BOOL hasDummy11_:1;
-  BOOL hasDummy12_:1;
-  BOOL hasDummy13_:1;
-  BOOL hasDummy14_:1;
-  BOOL hasDummy15_:1;
-  BOOL hasDummy16_:1;
-  BOOL hasDummy17_:1;
-  int32_t c;
-  int32_t dummy32;
-  int32_t dummy31;
-  int32_t dummy30;
-  int32_t dummy29;
-  int32_t dummy28;
-  int32_t dummy27;
+@package
+  uint32_t hasBits_[2];
   int32_t dummy26;
-  int32_t dummy25;
-  int32_t dummy24;
-  int32_t dummy23;
-  int32_t dummy22;
-  int32_t dummy21;
-  int32_t dummy20;
-  int32_t dummy19;
   int32_t dummy18;
+  int32_t dummy19;
+  int32_t dummy20;
+  int32_t dummy21;
+  int32_t dummy22;
+  int32_t dummy23;
+  int32_t dummy24;
+  int32_t dummy25;
+  int32_t dummy17;
+  int32_t dummy27;
+  int32_t dummy28;
+  int32_t dummy29;
+  int32_t dummy30;
+  int32_t dummy31;
+  int32_t dummy32;
+  int32_t c;
   int32_t a;
-  int32_t dummy2;
-  int32_t b;
-  int32_t dummy4;
-  int32_t dummy5;
-  int32_t dummy6;
-  int32_t dummy7;
-  int32_t dummy8;
-  int32_t dummy9;
-  int32_t dummy10;
-  int32_t dummy11;
-  int32_t dummy12;
-  int32_t dummy13;
-  int32_t dummy14;
-  int32_t dummy15;
   int32_t dummy16;
-  int32_t dummy17;
+  int32_t dummy15;
+  int32_t dummy14;
+  int32_t dummy13;
+  int32_t dummy12;
+  int32_t dummy11;
+  int32_t dummy10;
+  int32_t dummy9;
+  int32_t dummy8;
+  int32_t dummy7;
+  int32_t dummy6;
+  int32_t dummy5;
+  int32_t dummy4;
+  int32_t b;
+  int32_t dummy2;
 }
 - (BOOL) hasA;
 - (BOOL) hasDummy2;
@@ -1445,39 +1490,39 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 - (BOOL) hasDummy31;
 - (BOOL) hasDummy32;
 - (BOOL) hasC;
-@property (readonly) int32_t a;
-@property (readonly) int32_t dummy2;
-@property (readonly) int32_t b;
-@property (readonly) int32_t dummy4;
-@property (readonly) int32_t dummy5;
-@property (readonly) int32_t dummy6;
-@property (readonly) int32_t dummy7;
-@property (readonly) int32_t dummy8;
-@property (readonly) int32_t dummy9;
-@property (readonly) int32_t dummy10;
-@property (readonly) int32_t dummy11;
-@property (readonly) int32_t dummy12;
-@property (readonly) int32_t dummy13;
-@property (readonly) int32_t dummy14;
-@property (readonly) int32_t dummy15;
-@property (readonly) int32_t dummy16;
-@property (readonly) int32_t dummy17;
-@property (readonly) int32_t dummy18;
-@property (readonly) int32_t dummy19;
-@property (readonly) int32_t dummy20;
-@property (readonly) int32_t dummy21;
-@property (readonly) int32_t dummy22;
-@property (readonly) int32_t dummy23;
-@property (readonly) int32_t dummy24;
-@property (readonly) int32_t dummy25;
-@property (readonly) int32_t dummy26;
-@property (readonly) int32_t dummy27;
-@property (readonly) int32_t dummy28;
-@property (readonly) int32_t dummy29;
-@property (readonly) int32_t dummy30;
-@property (readonly) int32_t dummy31;
-@property (readonly) int32_t dummy32;
-@property (readonly) int32_t c;
+@property (nonatomic, readonly) int32_t a;
+@property (nonatomic, readonly) int32_t dummy2;
+@property (nonatomic, readonly) int32_t b;
+@property (nonatomic, readonly) int32_t dummy4;
+@property (nonatomic, readonly) int32_t dummy5;
+@property (nonatomic, readonly) int32_t dummy6;
+@property (nonatomic, readonly) int32_t dummy7;
+@property (nonatomic, readonly) int32_t dummy8;
+@property (nonatomic, readonly) int32_t dummy9;
+@property (nonatomic, readonly) int32_t dummy10;
+@property (nonatomic, readonly) int32_t dummy11;
+@property (nonatomic, readonly) int32_t dummy12;
+@property (nonatomic, readonly) int32_t dummy13;
+@property (nonatomic, readonly) int32_t dummy14;
+@property (nonatomic, readonly) int32_t dummy15;
+@property (nonatomic, readonly) int32_t dummy16;
+@property (nonatomic, readonly) int32_t dummy17;
+@property (nonatomic, readonly) int32_t dummy18;
+@property (nonatomic, readonly) int32_t dummy19;
+@property (nonatomic, readonly) int32_t dummy20;
+@property (nonatomic, readonly) int32_t dummy21;
+@property (nonatomic, readonly) int32_t dummy22;
+@property (nonatomic, readonly) int32_t dummy23;
+@property (nonatomic, readonly) int32_t dummy24;
+@property (nonatomic, readonly) int32_t dummy25;
+@property (nonatomic, readonly) int32_t dummy26;
+@property (nonatomic, readonly) int32_t dummy27;
+@property (nonatomic, readonly) int32_t dummy28;
+@property (nonatomic, readonly) int32_t dummy29;
+@property (nonatomic, readonly) int32_t dummy30;
+@property (nonatomic, readonly) int32_t dummy31;
+@property (nonatomic, readonly) int32_t dummy32;
+@property (nonatomic, readonly) int32_t c;
 
 + (TestRequired*) defaultInstance;
 - (TestRequired*) defaultInstance;
@@ -1502,15 +1547,24 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 @interface TestRequired_Builder : PBGeneratedMessage_Builder {
 @private
   TestRequired* result;
+  TestRequired* prototype_;
 }
 
 - (TestRequired*) defaultInstance;
 
 - (TestRequired_Builder*) clear;
 - (TestRequired_Builder*) clone;
+- (TestRequired_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (TestRequired_Builder*) recycle:(TestRequired*) message;
 
 - (TestRequired*) build;
 - (TestRequired*) buildPartial;
+- (TestRequired*) newBuildPartial;
 
 - (TestRequired_Builder*) mergeFrom:(TestRequired*) other;
 - (TestRequired_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -1683,18 +1737,17 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 @end
 
 @interface TestRequiredForeign : PBGeneratedMessage {
-@private
-  BOOL hasDummy_:1;
-  BOOL hasOptionalMessage_:1;
+@package
+  uint32_t hasBits_[1];
   int32_t dummy;
   TestRequired* optionalMessage;
-  PBAppendableArray * repeatedMessageArray;
+  PBObjectArray * repeatedMessageArray;
 }
 - (BOOL) hasOptionalMessage;
 - (BOOL) hasDummy;
-@property (readonly, retain) TestRequired* optionalMessage;
-@property (readonly, retain) PBArray * repeatedMessage;
-@property (readonly) int32_t dummy;
+@property (nonatomic, readonly, retain) TestRequired* optionalMessage;
+@property (nonatomic, readonly, retain) PBArray * repeatedMessage;
+@property (nonatomic, readonly) int32_t dummy;
 - (TestRequired*)repeatedMessageAtIndex:(NSUInteger)index;
 
 + (TestRequiredForeign*) defaultInstance;
@@ -1718,15 +1771,26 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 @interface TestRequiredForeign_Builder : PBGeneratedMessage_Builder {
 @private
   TestRequiredForeign* result;
+  TestRequiredForeign* prototype_;
+  TestRequired_Builder* optionalMessageBuilder_;
+  TestRequired_Builder* optionalMessageSpareBuilder_;
 }
 
 - (TestRequiredForeign*) defaultInstance;
 
 - (TestRequiredForeign_Builder*) clear;
 - (TestRequiredForeign_Builder*) clone;
+- (TestRequiredForeign_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (TestRequiredForeign_Builder*) recycle:(TestRequiredForeign*) message;
 
 - (TestRequiredForeign*) build;
 - (TestRequiredForeign*) buildPartial;
+- (TestRequiredForeign*) newBuildPartial;
 
 - (TestRequiredForeign_Builder*) mergeFrom:(TestRequiredForeign*) other;
 - (TestRequiredForeign_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -1753,12 +1817,12 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 @end
 
 @interface TestForeignNested : PBGeneratedMessage {
-@private
-  BOOL hasForeignNested_:1;
+@package
+  uint32_t hasBits_[1];
   TestAllTypes_NestedMessage* foreignNested;
 }
 - (BOOL) hasForeignNested;
-@property (readonly, retain) TestAllTypes_NestedMessage* foreignNested;
+@property (nonatomic, readonly, retain) TestAllTypes_NestedMessage* foreignNested;
 
 + (TestForeignNested*) defaultInstance;
 - (TestForeignNested*) defaultInstance;
@@ -1781,15 +1845,26 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 @interface TestForeignNested_Builder : PBGeneratedMessage_Builder {
 @private
   TestForeignNested* result;
+  TestForeignNested* prototype_;
+  TestAllTypes_NestedMessage_Builder* foreignNestedBuilder_;
+  TestAllTypes_NestedMessage_Builder* foreignNestedSpareBuilder_;
 }
 
 - (TestForeignNested*) defaultInstance;
 
 - (TestForeignNested_Builder*) clear;
 - (TestForeignNested_Builder*) clone;
+- (TestForeignNested_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (TestForeignNested_Builder*) recycle:(TestForeignNested*) message;
 
 - (TestForeignNested*) build;
 - (TestForeignNested*) buildPartial;
+- (TestForeignNested*) newBuildPartial;
 
 - (TestForeignNested_Builder*) mergeFrom:(TestForeignNested*) other;
 - (TestForeignNested_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -1804,7 +1879,8 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 @end
 
 @interface TestEmptyMessage : PBGeneratedMessage {
-@private
+@package
+  uint32_t hasBits_[1];
 }
 
 + (TestEmptyMessage*) defaultInstance;
@@ -1828,15 +1904,24 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 @interface TestEmptyMessage_Builder : PBGeneratedMessage_Builder {
 @private
   TestEmptyMessage* result;
+  TestEmptyMessage* prototype_;
 }
 
 - (TestEmptyMessage*) defaultInstance;
 
 - (TestEmptyMessage_Builder*) clear;
 - (TestEmptyMessage_Builder*) clone;
+- (TestEmptyMessage_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (TestEmptyMessage_Builder*) recycle:(TestEmptyMessage*) message;
 
 - (TestEmptyMessage*) build;
 - (TestEmptyMessage*) buildPartial;
+- (TestEmptyMessage*) newBuildPartial;
 
 - (TestEmptyMessage_Builder*) mergeFrom:(TestEmptyMessage*) other;
 - (TestEmptyMessage_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -1844,7 +1929,8 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 @end
 
 @interface TestEmptyMessageWithExtensions : PBExtendableMessage {
-@private
+@package
+  uint32_t hasBits_[1];
 }
 
 + (TestEmptyMessageWithExtensions*) defaultInstance;
@@ -1868,15 +1954,24 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 @interface TestEmptyMessageWithExtensions_Builder : PBExtendableMessage_Builder {
 @private
   TestEmptyMessageWithExtensions* result;
+  TestEmptyMessageWithExtensions* prototype_;
 }
 
 - (TestEmptyMessageWithExtensions*) defaultInstance;
 
 - (TestEmptyMessageWithExtensions_Builder*) clear;
 - (TestEmptyMessageWithExtensions_Builder*) clone;
+- (TestEmptyMessageWithExtensions_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (TestEmptyMessageWithExtensions_Builder*) recycle:(TestEmptyMessageWithExtensions*) message;
 
 - (TestEmptyMessageWithExtensions*) build;
 - (TestEmptyMessageWithExtensions*) buildPartial;
+- (TestEmptyMessageWithExtensions*) newBuildPartial;
 
 - (TestEmptyMessageWithExtensions_Builder*) mergeFrom:(TestEmptyMessageWithExtensions*) other;
 - (TestEmptyMessageWithExtensions_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -1884,7 +1979,8 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 @end
 
 @interface TestMultipleExtensionRanges : PBExtendableMessage {
-@private
+@package
+  uint32_t hasBits_[1];
 }
 
 + (TestMultipleExtensionRanges*) defaultInstance;
@@ -1908,15 +2004,24 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 @interface TestMultipleExtensionRanges_Builder : PBExtendableMessage_Builder {
 @private
   TestMultipleExtensionRanges* result;
+  TestMultipleExtensionRanges* prototype_;
 }
 
 - (TestMultipleExtensionRanges*) defaultInstance;
 
 - (TestMultipleExtensionRanges_Builder*) clear;
 - (TestMultipleExtensionRanges_Builder*) clone;
+- (TestMultipleExtensionRanges_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (TestMultipleExtensionRanges_Builder*) recycle:(TestMultipleExtensionRanges*) message;
 
 - (TestMultipleExtensionRanges*) build;
 - (TestMultipleExtensionRanges*) buildPartial;
+- (TestMultipleExtensionRanges*) newBuildPartial;
 
 - (TestMultipleExtensionRanges_Builder*) mergeFrom:(TestMultipleExtensionRanges*) other;
 - (TestMultipleExtensionRanges_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -1924,16 +2029,15 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 @end
 
 @interface TestReallyLargeTagNumber : PBGeneratedMessage {
-@private
-  BOOL hasA_:1;
-  BOOL hasBb_:1;
+@package
+  uint32_t hasBits_[1];
   int32_t a;
   int32_t bb;
 }
 - (BOOL) hasA;
 - (BOOL) hasBb;
-@property (readonly) int32_t a;
-@property (readonly) int32_t bb;
+@property (nonatomic, readonly) int32_t a;
+@property (nonatomic, readonly) int32_t bb;
 
 + (TestReallyLargeTagNumber*) defaultInstance;
 - (TestReallyLargeTagNumber*) defaultInstance;
@@ -1956,15 +2060,24 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 @interface TestReallyLargeTagNumber_Builder : PBGeneratedMessage_Builder {
 @private
   TestReallyLargeTagNumber* result;
+  TestReallyLargeTagNumber* prototype_;
 }
 
 - (TestReallyLargeTagNumber*) defaultInstance;
 
 - (TestReallyLargeTagNumber_Builder*) clear;
 - (TestReallyLargeTagNumber_Builder*) clone;
+- (TestReallyLargeTagNumber_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (TestReallyLargeTagNumber_Builder*) recycle:(TestReallyLargeTagNumber*) message;
 
 - (TestReallyLargeTagNumber*) build;
 - (TestReallyLargeTagNumber*) buildPartial;
+- (TestReallyLargeTagNumber*) newBuildPartial;
 
 - (TestReallyLargeTagNumber_Builder*) mergeFrom:(TestReallyLargeTagNumber*) other;
 - (TestReallyLargeTagNumber_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -1982,16 +2095,15 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 @end
 
 @interface TestRecursiveMessage : PBGeneratedMessage {
-@private
-  BOOL hasI_:1;
-  BOOL hasA_:1;
+@package
+  uint32_t hasBits_[1];
   int32_t i;
   TestRecursiveMessage* a;
 }
 - (BOOL) hasA;
 - (BOOL) hasI;
-@property (readonly, retain) TestRecursiveMessage* a;
-@property (readonly) int32_t i;
+@property (nonatomic, readonly, retain) TestRecursiveMessage* a;
+@property (nonatomic, readonly) int32_t i;
 
 + (TestRecursiveMessage*) defaultInstance;
 - (TestRecursiveMessage*) defaultInstance;
@@ -2014,15 +2126,26 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 @interface TestRecursiveMessage_Builder : PBGeneratedMessage_Builder {
 @private
   TestRecursiveMessage* result;
+  TestRecursiveMessage* prototype_;
+  TestRecursiveMessage_Builder* aBuilder_;
+  TestRecursiveMessage_Builder* aSpareBuilder_;
 }
 
 - (TestRecursiveMessage*) defaultInstance;
 
 - (TestRecursiveMessage_Builder*) clear;
 - (TestRecursiveMessage_Builder*) clone;
+- (TestRecursiveMessage_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (TestRecursiveMessage_Builder*) recycle:(TestRecursiveMessage*) message;
 
 - (TestRecursiveMessage*) build;
 - (TestRecursiveMessage*) buildPartial;
+- (TestRecursiveMessage*) newBuildPartial;
 
 - (TestRecursiveMessage_Builder*) mergeFrom:(TestRecursiveMessage*) other;
 - (TestRecursiveMessage_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -2042,12 +2165,12 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 @end
 
 @interface TestMutualRecursionA : PBGeneratedMessage {
-@private
-  BOOL hasBb_:1;
+@package
+  uint32_t hasBits_[1];
   TestMutualRecursionB* bb;
 }
 - (BOOL) hasBb;
-@property (readonly, retain) TestMutualRecursionB* bb;
+@property (nonatomic, readonly, retain) TestMutualRecursionB* bb;
 
 + (TestMutualRecursionA*) defaultInstance;
 - (TestMutualRecursionA*) defaultInstance;
@@ -2070,15 +2193,26 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 @interface TestMutualRecursionA_Builder : PBGeneratedMessage_Builder {
 @private
   TestMutualRecursionA* result;
+  TestMutualRecursionA* prototype_;
+  TestMutualRecursionB_Builder* bbBuilder_;
+  TestMutualRecursionB_Builder* bbSpareBuilder_;
 }
 
 - (TestMutualRecursionA*) defaultInstance;
 
 - (TestMutualRecursionA_Builder*) clear;
 - (TestMutualRecursionA_Builder*) clone;
+- (TestMutualRecursionA_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (TestMutualRecursionA_Builder*) recycle:(TestMutualRecursionA*) message;
 
 - (TestMutualRecursionA*) build;
 - (TestMutualRecursionA*) buildPartial;
+- (TestMutualRecursionA*) newBuildPartial;
 
 - (TestMutualRecursionA_Builder*) mergeFrom:(TestMutualRecursionA*) other;
 - (TestMutualRecursionA_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -2093,16 +2227,15 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 @end
 
 @interface TestMutualRecursionB : PBGeneratedMessage {
-@private
-  BOOL hasOptionalInt32_:1;
-  BOOL hasA_:1;
+@package
+  uint32_t hasBits_[1];
   int32_t optionalInt32;
   TestMutualRecursionA* a;
 }
 - (BOOL) hasA;
 - (BOOL) hasOptionalInt32;
-@property (readonly, retain) TestMutualRecursionA* a;
-@property (readonly) int32_t optionalInt32;
+@property (nonatomic, readonly, retain) TestMutualRecursionA* a;
+@property (nonatomic, readonly) int32_t optionalInt32;
 
 + (TestMutualRecursionB*) defaultInstance;
 - (TestMutualRecursionB*) defaultInstance;
@@ -2125,15 +2258,26 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 @interface TestMutualRecursionB_Builder : PBGeneratedMessage_Builder {
 @private
   TestMutualRecursionB* result;
+  TestMutualRecursionB* prototype_;
+  TestMutualRecursionA_Builder* aBuilder_;
+  TestMutualRecursionA_Builder* aSpareBuilder_;
 }
 
 - (TestMutualRecursionB*) defaultInstance;
 
 - (TestMutualRecursionB_Builder*) clear;
 - (TestMutualRecursionB_Builder*) clone;
+- (TestMutualRecursionB_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (TestMutualRecursionB_Builder*) recycle:(TestMutualRecursionB*) message;
 
 - (TestMutualRecursionB*) build;
 - (TestMutualRecursionB*) buildPartial;
+- (TestMutualRecursionB*) newBuildPartial;
 
 - (TestMutualRecursionB_Builder*) mergeFrom:(TestMutualRecursionB*) other;
 - (TestMutualRecursionB_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -2153,10 +2297,8 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 @end
 
 @interface TestDupFieldNumber : PBGeneratedMessage {
-@private
-  BOOL hasA_:1;
-  BOOL hasFoo_:1;
-  BOOL hasBar_:1;
+@package
+  uint32_t hasBits_[1];
   int32_t a;
   TestDupFieldNumber_Foo* foo;
   TestDupFieldNumber_Bar* bar;
@@ -2164,9 +2306,9 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 - (BOOL) hasA;
 - (BOOL) hasFoo;
 - (BOOL) hasBar;
-@property (readonly) int32_t a;
-@property (readonly, retain) TestDupFieldNumber_Foo* foo;
-@property (readonly, retain) TestDupFieldNumber_Bar* bar;
+@property (nonatomic, readonly) int32_t a;
+@property (nonatomic, readonly, retain) TestDupFieldNumber_Foo* foo;
+@property (nonatomic, readonly, retain) TestDupFieldNumber_Bar* bar;
 
 + (TestDupFieldNumber*) defaultInstance;
 - (TestDupFieldNumber*) defaultInstance;
@@ -2187,12 +2329,12 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 @end
 
 @interface TestDupFieldNumber_Foo : PBGeneratedMessage {
-@private
-  BOOL hasA_:1;
+@package
+  uint32_t hasBits_[1];
   int32_t a;
 }
 - (BOOL) hasA;
-@property (readonly) int32_t a;
+@property (nonatomic, readonly) int32_t a;
 
 + (TestDupFieldNumber_Foo*) defaultInstance;
 - (TestDupFieldNumber_Foo*) defaultInstance;
@@ -2215,15 +2357,24 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 @interface TestDupFieldNumber_Foo_Builder : PBGeneratedMessage_Builder {
 @private
   TestDupFieldNumber_Foo* result;
+  TestDupFieldNumber_Foo* prototype_;
 }
 
 - (TestDupFieldNumber_Foo*) defaultInstance;
 
 - (TestDupFieldNumber_Foo_Builder*) clear;
 - (TestDupFieldNumber_Foo_Builder*) clone;
+- (TestDupFieldNumber_Foo_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (TestDupFieldNumber_Foo_Builder*) recycle:(TestDupFieldNumber_Foo*) message;
 
 - (TestDupFieldNumber_Foo*) build;
 - (TestDupFieldNumber_Foo*) buildPartial;
+- (TestDupFieldNumber_Foo*) newBuildPartial;
 
 - (TestDupFieldNumber_Foo_Builder*) mergeFrom:(TestDupFieldNumber_Foo*) other;
 - (TestDupFieldNumber_Foo_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -2236,12 +2387,12 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 @end
 
 @interface TestDupFieldNumber_Bar : PBGeneratedMessage {
-@private
-  BOOL hasA_:1;
+@package
+  uint32_t hasBits_[1];
   int32_t a;
 }
 - (BOOL) hasA;
-@property (readonly) int32_t a;
+@property (nonatomic, readonly) int32_t a;
 
 + (TestDupFieldNumber_Bar*) defaultInstance;
 - (TestDupFieldNumber_Bar*) defaultInstance;
@@ -2264,15 +2415,24 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 @interface TestDupFieldNumber_Bar_Builder : PBGeneratedMessage_Builder {
 @private
   TestDupFieldNumber_Bar* result;
+  TestDupFieldNumber_Bar* prototype_;
 }
 
 - (TestDupFieldNumber_Bar*) defaultInstance;
 
 - (TestDupFieldNumber_Bar_Builder*) clear;
 - (TestDupFieldNumber_Bar_Builder*) clone;
+- (TestDupFieldNumber_Bar_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (TestDupFieldNumber_Bar_Builder*) recycle:(TestDupFieldNumber_Bar*) message;
 
 - (TestDupFieldNumber_Bar*) build;
 - (TestDupFieldNumber_Bar*) buildPartial;
+- (TestDupFieldNumber_Bar*) newBuildPartial;
 
 - (TestDupFieldNumber_Bar_Builder*) mergeFrom:(TestDupFieldNumber_Bar*) other;
 - (TestDupFieldNumber_Bar_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -2287,15 +2447,28 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 @interface TestDupFieldNumber_Builder : PBGeneratedMessage_Builder {
 @private
   TestDupFieldNumber* result;
+  TestDupFieldNumber* prototype_;
+  TestDupFieldNumber_Foo_Builder* fooBuilder_;
+  TestDupFieldNumber_Foo_Builder* fooSpareBuilder_;
+  TestDupFieldNumber_Bar_Builder* barBuilder_;
+  TestDupFieldNumber_Bar_Builder* barSpareBuilder_;
 }
 
 - (TestDupFieldNumber*) defaultInstance;
 
 - (TestDupFieldNumber_Builder*) clear;
 - (TestDupFieldNumber_Builder*) clone;
+- (TestDupFieldNumber_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (TestDupFieldNumber_Builder*) recycle:(TestDupFieldNumber*) message;
 
 - (TestDupFieldNumber*) build;
 - (TestDupFieldNumber*) buildPartial;
+- (TestDupFieldNumber*) newBuildPartial;
 
 - (TestDupFieldNumber_Builder*) mergeFrom:(TestDupFieldNumber*) other;
 - (TestDupFieldNumber_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -2322,12 +2495,12 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 @end
 
 @interface TestNestedMessageHasBits : PBGeneratedMessage {
-@private
-  BOOL hasOptionalNestedMessage_:1;
+@package
+  uint32_t hasBits_[1];
   TestNestedMessageHasBits_NestedMessage* optionalNestedMessage;
 }
 - (BOOL) hasOptionalNestedMessage;
-@property (readonly, retain) TestNestedMessageHasBits_NestedMessage* optionalNestedMessage;
+@property (nonatomic, readonly, retain) TestNestedMessageHasBits_NestedMessage* optionalNestedMessage;
 
 + (TestNestedMessageHasBits*) defaultInstance;
 - (TestNestedMessageHasBits*) defaultInstance;
@@ -2348,12 +2521,13 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 @end
 
 @interface TestNestedMessageHasBits_NestedMessage : PBGeneratedMessage {
-@private
-  PBAppendableArray * nestedmessageRepeatedInt32Array;
-  PBAppendableArray * nestedmessageRepeatedForeignmessageArray;
+@package
+  uint32_t hasBits_[1];
+  PBInt32Array * nestedmessageRepeatedInt32Array;
+  PBObjectArray * nestedmessageRepeatedForeignmessageArray;
 }
-@property (readonly, retain) PBArray * nestedmessageRepeatedInt32;
-@property (readonly, retain) PBArray * nestedmessageRepeatedForeignmessage;
+@property (nonatomic, readonly, retain) PBArray * nestedmessageRepeatedInt32;
+@property (nonatomic, readonly, retain) PBArray * nestedmessageRepeatedForeignmessage;
 - (int32_t)nestedmessageRepeatedInt32AtIndex:(NSUInteger)index;
 - (ForeignMessage*)nestedmessageRepeatedForeignmessageAtIndex:(NSUInteger)index;
 
@@ -2378,15 +2552,24 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 @interface TestNestedMessageHasBits_NestedMessage_Builder : PBGeneratedMessage_Builder {
 @private
   TestNestedMessageHasBits_NestedMessage* result;
+  TestNestedMessageHasBits_NestedMessage* prototype_;
 }
 
 - (TestNestedMessageHasBits_NestedMessage*) defaultInstance;
 
 - (TestNestedMessageHasBits_NestedMessage_Builder*) clear;
 - (TestNestedMessageHasBits_NestedMessage_Builder*) clone;
+- (TestNestedMessageHasBits_NestedMessage_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (TestNestedMessageHasBits_NestedMessage_Builder*) recycle:(TestNestedMessageHasBits_NestedMessage*) message;
 
 - (TestNestedMessageHasBits_NestedMessage*) build;
 - (TestNestedMessageHasBits_NestedMessage*) buildPartial;
+- (TestNestedMessageHasBits_NestedMessage*) newBuildPartial;
 
 - (TestNestedMessageHasBits_NestedMessage_Builder*) mergeFrom:(TestNestedMessageHasBits_NestedMessage*) other;
 - (TestNestedMessageHasBits_NestedMessage_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -2396,6 +2579,7 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 - (int32_t)nestedmessageRepeatedInt32AtIndex:(NSUInteger)index;
 - (TestNestedMessageHasBits_NestedMessage_Builder *)addNestedmessageRepeatedInt32:(int32_t)value;
 - (TestNestedMessageHasBits_NestedMessage_Builder *)setNestedmessageRepeatedInt32Array:(NSArray *)array;
+- (TestNestedMessageHasBits_NestedMessage_Builder *)setNestedmessageRepeatedInt32:(PBArray *)array;
 - (TestNestedMessageHasBits_NestedMessage_Builder *)setNestedmessageRepeatedInt32Values:(const int32_t *)values count:(NSUInteger)count;
 - (TestNestedMessageHasBits_NestedMessage_Builder *)clearNestedmessageRepeatedInt32;
 
@@ -2410,15 +2594,26 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 @interface TestNestedMessageHasBits_Builder : PBGeneratedMessage_Builder {
 @private
   TestNestedMessageHasBits* result;
+  TestNestedMessageHasBits* prototype_;
+  TestNestedMessageHasBits_NestedMessage_Builder* optionalNestedMessageBuilder_;
+  TestNestedMessageHasBits_NestedMessage_Builder* optionalNestedMessageSpareBuilder_;
 }
 
 - (TestNestedMessageHasBits*) defaultInstance;
 
 - (TestNestedMessageHasBits_Builder*) clear;
 - (TestNestedMessageHasBits_Builder*) clone;
+- (TestNestedMessageHasBits_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (TestNestedMessageHasBits_Builder*) recycle:(TestNestedMessageHasBits*) message;
 
 - (TestNestedMessageHasBits*) build;
 - (TestNestedMessageHasBits*) buildPartial;
+- (TestNestedMessageHasBits*) newBuildPartial;
 
 - (TestNestedMessageHasBits_Builder*) mergeFrom:(TestNestedMessageHasBits*) other;
 - (TestNestedMessageHasBits_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -2433,25 +2628,20 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 @end
 
 @interface TestCamelCaseFieldNames : PBGeneratedMessage {
-@private
-  BOOL hasPrimitiveField_:1;
-  BOOL hasStringField_:1;
-  BOOL hasStringPieceField_:1;
-  BOOL hasCordField_:1;
-  BOOL hasMessageField_:1;
-  BOOL hasEnumField_:1;
+@package
+  uint32_t hasBits_[1];
   int32_t primitiveField;
   NSString* stringField;
   NSString* stringPieceField;
   NSString* cordField;
   ForeignMessage* messageField;
   ForeignEnum enumField;
-  PBAppendableArray * repeatedPrimitiveFieldArray;
-  PBAppendableArray * repeatedStringFieldArray;
-  PBAppendableArray * repeatedStringPieceFieldArray;
-  PBAppendableArray * repeatedCordFieldArray;
-  PBAppendableArray * repeatedMessageFieldArray;
-  PBAppendableArray * repeatedEnumFieldArray;
+  PBInt32Array * repeatedPrimitiveFieldArray;
+  PBObjectArray * repeatedStringFieldArray;
+  PBObjectArray * repeatedStringPieceFieldArray;
+  PBObjectArray * repeatedCordFieldArray;
+  PBObjectArray * repeatedMessageFieldArray;
+  PBInt32Array * repeatedEnumFieldArray;
 }
 - (BOOL) hasPrimitiveField;
 - (BOOL) hasStringField;
@@ -2459,18 +2649,18 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 - (BOOL) hasMessageField;
 - (BOOL) hasStringPieceField;
 - (BOOL) hasCordField;
-@property (readonly) int32_t primitiveField;
-@property (readonly, retain) NSString* stringField;
-@property (readonly) ForeignEnum enumField;
-@property (readonly, retain) ForeignMessage* messageField;
-@property (readonly, retain) NSString* stringPieceField;
-@property (readonly, retain) NSString* cordField;
-@property (readonly, retain) PBArray * repeatedPrimitiveField;
-@property (readonly, retain) PBArray * repeatedStringField;
-@property (readonly, retain) PBArray * repeatedEnumField;
-@property (readonly, retain) PBArray * repeatedMessageField;
-@property (readonly, retain) PBArray * repeatedStringPieceField;
-@property (readonly, retain) PBArray * repeatedCordField;
+@property (nonatomic, readonly) int32_t primitiveField;
+@property (nonatomic, readonly, retain) NSString* stringField;
+@property (nonatomic, readonly) ForeignEnum enumField;
+@property (nonatomic, readonly, retain) ForeignMessage* messageField;
+@property (nonatomic, readonly, retain) NSString* stringPieceField;
+@property (nonatomic, readonly, retain) NSString* cordField;
+@property (nonatomic, readonly, retain) PBArray * repeatedPrimitiveField;
+@property (nonatomic, readonly, retain) PBArray * repeatedStringField;
+@property (nonatomic, readonly, retain) PBArray * repeatedEnumField;
+@property (nonatomic, readonly, retain) PBArray * repeatedMessageField;
+@property (nonatomic, readonly, retain) PBArray * repeatedStringPieceField;
+@property (nonatomic, readonly, retain) PBArray * repeatedCordField;
 - (int32_t)repeatedPrimitiveFieldAtIndex:(NSUInteger)index;
 - (NSString*)repeatedStringFieldAtIndex:(NSUInteger)index;
 - (ForeignEnum)repeatedEnumFieldAtIndex:(NSUInteger)index;
@@ -2499,15 +2689,26 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 @interface TestCamelCaseFieldNames_Builder : PBGeneratedMessage_Builder {
 @private
   TestCamelCaseFieldNames* result;
+  TestCamelCaseFieldNames* prototype_;
+  ForeignMessage_Builder* messageFieldBuilder_;
+  ForeignMessage_Builder* messageFieldSpareBuilder_;
 }
 
 - (TestCamelCaseFieldNames*) defaultInstance;
 
 - (TestCamelCaseFieldNames_Builder*) clear;
 - (TestCamelCaseFieldNames_Builder*) clone;
+- (TestCamelCaseFieldNames_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (TestCamelCaseFieldNames_Builder*) recycle:(TestCamelCaseFieldNames*) message;
 
 - (TestCamelCaseFieldNames*) build;
 - (TestCamelCaseFieldNames*) buildPartial;
+- (TestCamelCaseFieldNames*) newBuildPartial;
 
 - (TestCamelCaseFieldNames_Builder*) mergeFrom:(TestCamelCaseFieldNames*) other;
 - (TestCamelCaseFieldNames_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -2549,6 +2750,7 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 - (int32_t)repeatedPrimitiveFieldAtIndex:(NSUInteger)index;
 - (TestCamelCaseFieldNames_Builder *)addRepeatedPrimitiveField:(int32_t)value;
 - (TestCamelCaseFieldNames_Builder *)setRepeatedPrimitiveFieldArray:(NSArray *)array;
+- (TestCamelCaseFieldNames_Builder *)setRepeatedPrimitiveField:(PBArray *)array;
 - (TestCamelCaseFieldNames_Builder *)setRepeatedPrimitiveFieldValues:(const int32_t *)values count:(NSUInteger)count;
 - (TestCamelCaseFieldNames_Builder *)clearRepeatedPrimitiveField;
 
@@ -2556,6 +2758,7 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 - (NSString*)repeatedStringFieldAtIndex:(NSUInteger)index;
 - (TestCamelCaseFieldNames_Builder *)addRepeatedStringField:(NSString*)value;
 - (TestCamelCaseFieldNames_Builder *)setRepeatedStringFieldArray:(NSArray *)array;
+- (TestCamelCaseFieldNames_Builder *)setRepeatedStringField:(PBArray *)array;
 - (TestCamelCaseFieldNames_Builder *)setRepeatedStringFieldValues:(const NSString* *)values count:(NSUInteger)count;
 - (TestCamelCaseFieldNames_Builder *)clearRepeatedStringField;
 
@@ -2563,6 +2766,7 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 - (ForeignEnum)repeatedEnumFieldAtIndex:(NSUInteger)index;
 - (TestCamelCaseFieldNames_Builder *)addRepeatedEnumField:(ForeignEnum)value;
 - (TestCamelCaseFieldNames_Builder *)setRepeatedEnumFieldArray:(NSArray *)array;
+- (TestCamelCaseFieldNames_Builder *)setRepeatedEnumField:(PBArray *)array;
 - (TestCamelCaseFieldNames_Builder *)setRepeatedEnumFieldValues:(const ForeignEnum *)values count:(NSUInteger)count;
 - (TestCamelCaseFieldNames_Builder *)clearRepeatedEnumField;
 
@@ -2577,6 +2781,7 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 - (NSString*)repeatedStringPieceFieldAtIndex:(NSUInteger)index;
 - (TestCamelCaseFieldNames_Builder *)addRepeatedStringPieceField:(NSString*)value;
 - (TestCamelCaseFieldNames_Builder *)setRepeatedStringPieceFieldArray:(NSArray *)array;
+- (TestCamelCaseFieldNames_Builder *)setRepeatedStringPieceField:(PBArray *)array;
 - (TestCamelCaseFieldNames_Builder *)setRepeatedStringPieceFieldValues:(const NSString* *)values count:(NSUInteger)count;
 - (TestCamelCaseFieldNames_Builder *)clearRepeatedStringPieceField;
 
@@ -2584,15 +2789,14 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 - (NSString*)repeatedCordFieldAtIndex:(NSUInteger)index;
 - (TestCamelCaseFieldNames_Builder *)addRepeatedCordField:(NSString*)value;
 - (TestCamelCaseFieldNames_Builder *)setRepeatedCordFieldArray:(NSArray *)array;
+- (TestCamelCaseFieldNames_Builder *)setRepeatedCordField:(PBArray *)array;
 - (TestCamelCaseFieldNames_Builder *)setRepeatedCordFieldValues:(const NSString* *)values count:(NSUInteger)count;
 - (TestCamelCaseFieldNames_Builder *)clearRepeatedCordField;
 @end
 
 @interface TestFieldOrderings : PBExtendableMessage {
-@private
-  BOOL hasMyFloat_:1;
-  BOOL hasMyInt_:1;
-  BOOL hasMyString_:1;
+@package
+  uint32_t hasBits_[1];
   Float32 myFloat;
   int64_t myInt;
   NSString* myString;
@@ -2600,9 +2804,9 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 - (BOOL) hasMyString;
 - (BOOL) hasMyInt;
 - (BOOL) hasMyFloat;
-@property (readonly, retain) NSString* myString;
-@property (readonly) int64_t myInt;
-@property (readonly) Float32 myFloat;
+@property (nonatomic, readonly, retain) NSString* myString;
+@property (nonatomic, readonly) int64_t myInt;
+@property (nonatomic, readonly) Float32 myFloat;
 
 + (TestFieldOrderings*) defaultInstance;
 - (TestFieldOrderings*) defaultInstance;
@@ -2625,15 +2829,24 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 @interface TestFieldOrderings_Builder : PBExtendableMessage_Builder {
 @private
   TestFieldOrderings* result;
+  TestFieldOrderings* prototype_;
 }
 
 - (TestFieldOrderings*) defaultInstance;
 
 - (TestFieldOrderings_Builder*) clear;
 - (TestFieldOrderings_Builder*) clone;
+- (TestFieldOrderings_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (TestFieldOrderings_Builder*) recycle:(TestFieldOrderings*) message;
 
 - (TestFieldOrderings*) build;
 - (TestFieldOrderings*) buildPartial;
+- (TestFieldOrderings*) newBuildPartial;
 
 - (TestFieldOrderings_Builder*) mergeFrom:(TestFieldOrderings*) other;
 - (TestFieldOrderings_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -2656,36 +2869,17 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 @end
 
 @interface TestExtremeDefaultValues : PBGeneratedMessage {
-@private
-  BOOL hasNanDouble_:1;
-  BOOL hasNegInfDouble_:1;
-  BOOL hasInfDouble_:1;
-  BOOL hasInfFloat_:1;
-  BOOL hasSmallNegativeFloat_:1;
-  BOOL hasLargeFloat_:1;
-  BOOL hasNegativeFloat_:1;
-  BOOL hasNegativeOneFloat_:1;
-  BOOL hasSmallFloat_:1;
-  BOOL hasOneFloat_:1;
-  BOOL hasZeroFloat_:1;
-  BOOL hasNegInfFloat_:1;
-  BOOL hasNanFloat_:1;
-  BOOL hasSmallInt64_:1;
-  BOOL hasLargeUint64_:1;
-  BOOL hasSmallInt32_:1;
-  BOOL hasCppTrigraph_:1;
-  BOOL hasUtf8String_:1;
-  BOOL hasEscapedBytes_:1;
-  BOOL hasLargeUint32_:1;
+@package
+  uint32_t hasBits_[1];
   Float64 nanDouble;
   Float64 negInfDouble;
   Float64 infDouble;
+  Float32 smallFloat;
   Float32 infFloat;
   Float32 smallNegativeFloat;
   Float32 largeFloat;
   Float32 negativeFloat;
   Float32 negativeOneFloat;
-  Float32 smallFloat;
   Float32 oneFloat;
   Float32 zeroFloat;
   Float32 negInfFloat;
@@ -2718,26 +2912,26 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 - (BOOL) hasNegInfFloat;
 - (BOOL) hasNanFloat;
 - (BOOL) hasCppTrigraph;
-@property (readonly, retain) NSData* escapedBytes;
-@property (readonly) uint32_t largeUint32;
-@property (readonly) uint64_t largeUint64;
-@property (readonly) int32_t smallInt32;
-@property (readonly) int64_t smallInt64;
-@property (readonly, retain) NSString* utf8String;
-@property (readonly) Float32 zeroFloat;
-@property (readonly) Float32 oneFloat;
-@property (readonly) Float32 smallFloat;
-@property (readonly) Float32 negativeOneFloat;
-@property (readonly) Float32 negativeFloat;
-@property (readonly) Float32 largeFloat;
-@property (readonly) Float32 smallNegativeFloat;
-@property (readonly) Float64 infDouble;
-@property (readonly) Float64 negInfDouble;
-@property (readonly) Float64 nanDouble;
-@property (readonly) Float32 infFloat;
-@property (readonly) Float32 negInfFloat;
-@property (readonly) Float32 nanFloat;
-@property (readonly, retain) NSString* cppTrigraph;
+@property (nonatomic, readonly, retain) NSData* escapedBytes;
+@property (nonatomic, readonly) uint32_t largeUint32;
+@property (nonatomic, readonly) uint64_t largeUint64;
+@property (nonatomic, readonly) int32_t smallInt32;
+@property (nonatomic, readonly) int64_t smallInt64;
+@property (nonatomic, readonly, retain) NSString* utf8String;
+@property (nonatomic, readonly) Float32 zeroFloat;
+@property (nonatomic, readonly) Float32 oneFloat;
+@property (nonatomic, readonly) Float32 smallFloat;
+@property (nonatomic, readonly) Float32 negativeOneFloat;
+@property (nonatomic, readonly) Float32 negativeFloat;
+@property (nonatomic, readonly) Float32 largeFloat;
+@property (nonatomic, readonly) Float32 smallNegativeFloat;
+@property (nonatomic, readonly) Float64 infDouble;
+@property (nonatomic, readonly) Float64 negInfDouble;
+@property (nonatomic, readonly) Float64 nanDouble;
+@property (nonatomic, readonly) Float32 infFloat;
+@property (nonatomic, readonly) Float32 negInfFloat;
+@property (nonatomic, readonly) Float32 nanFloat;
+@property (nonatomic, readonly, retain) NSString* cppTrigraph;
 
 + (TestExtremeDefaultValues*) defaultInstance;
 - (TestExtremeDefaultValues*) defaultInstance;
@@ -2760,15 +2954,24 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 @interface TestExtremeDefaultValues_Builder : PBGeneratedMessage_Builder {
 @private
   TestExtremeDefaultValues* result;
+  TestExtremeDefaultValues* prototype_;
 }
 
 - (TestExtremeDefaultValues*) defaultInstance;
 
 - (TestExtremeDefaultValues_Builder*) clear;
 - (TestExtremeDefaultValues_Builder*) clone;
+- (TestExtremeDefaultValues_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (TestExtremeDefaultValues_Builder*) recycle:(TestExtremeDefaultValues*) message;
 
 - (TestExtremeDefaultValues*) build;
 - (TestExtremeDefaultValues*) buildPartial;
+- (TestExtremeDefaultValues*) newBuildPartial;
 
 - (TestExtremeDefaultValues_Builder*) mergeFrom:(TestExtremeDefaultValues*) other;
 - (TestExtremeDefaultValues_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -2876,12 +3079,12 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 @end
 
 @interface SparseEnumMessage : PBGeneratedMessage {
-@private
-  BOOL hasSparseEnum_:1;
+@package
+  uint32_t hasBits_[1];
   TestSparseEnum sparseEnum;
 }
 - (BOOL) hasSparseEnum;
-@property (readonly) TestSparseEnum sparseEnum;
+@property (nonatomic, readonly) TestSparseEnum sparseEnum;
 
 + (SparseEnumMessage*) defaultInstance;
 - (SparseEnumMessage*) defaultInstance;
@@ -2904,15 +3107,24 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 @interface SparseEnumMessage_Builder : PBGeneratedMessage_Builder {
 @private
   SparseEnumMessage* result;
+  SparseEnumMessage* prototype_;
 }
 
 - (SparseEnumMessage*) defaultInstance;
 
 - (SparseEnumMessage_Builder*) clear;
 - (SparseEnumMessage_Builder*) clone;
+- (SparseEnumMessage_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (SparseEnumMessage_Builder*) recycle:(SparseEnumMessage*) message;
 
 - (SparseEnumMessage*) build;
 - (SparseEnumMessage*) buildPartial;
+- (SparseEnumMessage*) newBuildPartial;
 
 - (SparseEnumMessage_Builder*) mergeFrom:(SparseEnumMessage*) other;
 - (SparseEnumMessage_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -2925,12 +3137,12 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 @end
 
 @interface OneString : PBGeneratedMessage {
-@private
-  BOOL hasData_:1;
+@package
+  uint32_t hasBits_[1];
   NSString* data;
 }
 - (BOOL) hasData;
-@property (readonly, retain) NSString* data;
+@property (nonatomic, readonly, retain) NSString* data;
 
 + (OneString*) defaultInstance;
 - (OneString*) defaultInstance;
@@ -2953,15 +3165,24 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 @interface OneString_Builder : PBGeneratedMessage_Builder {
 @private
   OneString* result;
+  OneString* prototype_;
 }
 
 - (OneString*) defaultInstance;
 
 - (OneString_Builder*) clear;
 - (OneString_Builder*) clone;
+- (OneString_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (OneString_Builder*) recycle:(OneString*) message;
 
 - (OneString*) build;
 - (OneString*) buildPartial;
+- (OneString*) newBuildPartial;
 
 - (OneString_Builder*) mergeFrom:(OneString*) other;
 - (OneString_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -2974,12 +3195,12 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 @end
 
 @interface OneBytes : PBGeneratedMessage {
-@private
-  BOOL hasData_:1;
+@package
+  uint32_t hasBits_[1];
   NSData* data;
 }
 - (BOOL) hasData;
-@property (readonly, retain) NSData* data;
+@property (nonatomic, readonly, retain) NSData* data;
 
 + (OneBytes*) defaultInstance;
 - (OneBytes*) defaultInstance;
@@ -3002,15 +3223,24 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 @interface OneBytes_Builder : PBGeneratedMessage_Builder {
 @private
   OneBytes* result;
+  OneBytes* prototype_;
 }
 
 - (OneBytes*) defaultInstance;
 
 - (OneBytes_Builder*) clear;
 - (OneBytes_Builder*) clone;
+- (OneBytes_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (OneBytes_Builder*) recycle:(OneBytes*) message;
 
 - (OneBytes*) build;
 - (OneBytes*) buildPartial;
+- (OneBytes*) newBuildPartial;
 
 - (OneBytes_Builder*) mergeFrom:(OneBytes*) other;
 - (OneBytes_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -3023,50 +3253,51 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 @end
 
 @interface TestPackedTypes : PBGeneratedMessage {
-@private
-  PBAppendableArray * packedBoolArray;
+@package
+  uint32_t hasBits_[1];
+  PBBoolArray * packedBoolArray;
   int32_t packedBoolMemoizedSerializedSize;
-  PBAppendableArray * packedDoubleArray;
+  PBDoubleArray * packedDoubleArray;
   int32_t packedDoubleMemoizedSerializedSize;
-  PBAppendableArray * packedFloatArray;
+  PBFloatArray * packedFloatArray;
   int32_t packedFloatMemoizedSerializedSize;
-  PBAppendableArray * packedInt64Array;
+  PBInt64Array * packedInt64Array;
   int32_t packedInt64MemoizedSerializedSize;
-  PBAppendableArray * packedUint64Array;
+  PBUInt64Array * packedUint64Array;
   int32_t packedUint64MemoizedSerializedSize;
-  PBAppendableArray * packedInt32Array;
+  PBInt32Array * packedInt32Array;
   int32_t packedInt32MemoizedSerializedSize;
-  PBAppendableArray * packedFixed64Array;
+  PBUInt64Array * packedFixed64Array;
   int32_t packedFixed64MemoizedSerializedSize;
-  PBAppendableArray * packedFixed32Array;
+  PBUInt32Array * packedFixed32Array;
   int32_t packedFixed32MemoizedSerializedSize;
-  PBAppendableArray * packedUint32Array;
+  PBUInt32Array * packedUint32Array;
   int32_t packedUint32MemoizedSerializedSize;
-  PBAppendableArray * packedEnumArray;
+  PBInt32Array * packedEnumArray;
   int32_t packedEnumMemoizedSerializedSize;
-  PBAppendableArray * packedSfixed32Array;
+  PBInt32Array * packedSfixed32Array;
   int32_t packedSfixed32MemoizedSerializedSize;
-  PBAppendableArray * packedSfixed64Array;
+  PBInt64Array * packedSfixed64Array;
   int32_t packedSfixed64MemoizedSerializedSize;
-  PBAppendableArray * packedSint32Array;
+  PBInt32Array * packedSint32Array;
   int32_t packedSint32MemoizedSerializedSize;
-  PBAppendableArray * packedSint64Array;
+  PBInt64Array * packedSint64Array;
   int32_t packedSint64MemoizedSerializedSize;
 }
-@property (readonly, retain) PBArray * packedInt32;
-@property (readonly, retain) PBArray * packedInt64;
-@property (readonly, retain) PBArray * packedUint32;
-@property (readonly, retain) PBArray * packedUint64;
-@property (readonly, retain) PBArray * packedSint32;
-@property (readonly, retain) PBArray * packedSint64;
-@property (readonly, retain) PBArray * packedFixed32;
-@property (readonly, retain) PBArray * packedFixed64;
-@property (readonly, retain) PBArray * packedSfixed32;
-@property (readonly, retain) PBArray * packedSfixed64;
-@property (readonly, retain) PBArray * packedFloat;
-@property (readonly, retain) PBArray * packedDouble;
-@property (readonly, retain) PBArray * packedBool;
-@property (readonly, retain) PBArray * packedEnum;
+@property (nonatomic, readonly, retain) PBArray * packedInt32;
+@property (nonatomic, readonly, retain) PBArray * packedInt64;
+@property (nonatomic, readonly, retain) PBArray * packedUint32;
+@property (nonatomic, readonly, retain) PBArray * packedUint64;
+@property (nonatomic, readonly, retain) PBArray * packedSint32;
+@property (nonatomic, readonly, retain) PBArray * packedSint64;
+@property (nonatomic, readonly, retain) PBArray * packedFixed32;
+@property (nonatomic, readonly, retain) PBArray * packedFixed64;
+@property (nonatomic, readonly, retain) PBArray * packedSfixed32;
+@property (nonatomic, readonly, retain) PBArray * packedSfixed64;
+@property (nonatomic, readonly, retain) PBArray * packedFloat;
+@property (nonatomic, readonly, retain) PBArray * packedDouble;
+@property (nonatomic, readonly, retain) PBArray * packedBool;
+@property (nonatomic, readonly, retain) PBArray * packedEnum;
 - (int32_t)packedInt32AtIndex:(NSUInteger)index;
 - (int64_t)packedInt64AtIndex:(NSUInteger)index;
 - (uint32_t)packedUint32AtIndex:(NSUInteger)index;
@@ -3103,15 +3334,24 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 @interface TestPackedTypes_Builder : PBGeneratedMessage_Builder {
 @private
   TestPackedTypes* result;
+  TestPackedTypes* prototype_;
 }
 
 - (TestPackedTypes*) defaultInstance;
 
 - (TestPackedTypes_Builder*) clear;
 - (TestPackedTypes_Builder*) clone;
+- (TestPackedTypes_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (TestPackedTypes_Builder*) recycle:(TestPackedTypes*) message;
 
 - (TestPackedTypes*) build;
 - (TestPackedTypes*) buildPartial;
+- (TestPackedTypes*) newBuildPartial;
 
 - (TestPackedTypes_Builder*) mergeFrom:(TestPackedTypes*) other;
 - (TestPackedTypes_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -3121,6 +3361,7 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 - (int32_t)packedInt32AtIndex:(NSUInteger)index;
 - (TestPackedTypes_Builder *)addPackedInt32:(int32_t)value;
 - (TestPackedTypes_Builder *)setPackedInt32Array:(NSArray *)array;
+- (TestPackedTypes_Builder *)setPackedInt32:(PBArray *)array;
 - (TestPackedTypes_Builder *)setPackedInt32Values:(const int32_t *)values count:(NSUInteger)count;
 - (TestPackedTypes_Builder *)clearPackedInt32;
 
@@ -3128,6 +3369,7 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 - (int64_t)packedInt64AtIndex:(NSUInteger)index;
 - (TestPackedTypes_Builder *)addPackedInt64:(int64_t)value;
 - (TestPackedTypes_Builder *)setPackedInt64Array:(NSArray *)array;
+- (TestPackedTypes_Builder *)setPackedInt64:(PBArray *)array;
 - (TestPackedTypes_Builder *)setPackedInt64Values:(const int64_t *)values count:(NSUInteger)count;
 - (TestPackedTypes_Builder *)clearPackedInt64;
 
@@ -3135,6 +3377,7 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 - (uint32_t)packedUint32AtIndex:(NSUInteger)index;
 - (TestPackedTypes_Builder *)addPackedUint32:(uint32_t)value;
 - (TestPackedTypes_Builder *)setPackedUint32Array:(NSArray *)array;
+- (TestPackedTypes_Builder *)setPackedUint32:(PBArray *)array;
 - (TestPackedTypes_Builder *)setPackedUint32Values:(const uint32_t *)values count:(NSUInteger)count;
 - (TestPackedTypes_Builder *)clearPackedUint32;
 
@@ -3142,6 +3385,7 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 - (uint64_t)packedUint64AtIndex:(NSUInteger)index;
 - (TestPackedTypes_Builder *)addPackedUint64:(uint64_t)value;
 - (TestPackedTypes_Builder *)setPackedUint64Array:(NSArray *)array;
+- (TestPackedTypes_Builder *)setPackedUint64:(PBArray *)array;
 - (TestPackedTypes_Builder *)setPackedUint64Values:(const uint64_t *)values count:(NSUInteger)count;
 - (TestPackedTypes_Builder *)clearPackedUint64;
 
@@ -3149,6 +3393,7 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 - (int32_t)packedSint32AtIndex:(NSUInteger)index;
 - (TestPackedTypes_Builder *)addPackedSint32:(int32_t)value;
 - (TestPackedTypes_Builder *)setPackedSint32Array:(NSArray *)array;
+- (TestPackedTypes_Builder *)setPackedSint32:(PBArray *)array;
 - (TestPackedTypes_Builder *)setPackedSint32Values:(const int32_t *)values count:(NSUInteger)count;
 - (TestPackedTypes_Builder *)clearPackedSint32;
 
@@ -3156,6 +3401,7 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 - (int64_t)packedSint64AtIndex:(NSUInteger)index;
 - (TestPackedTypes_Builder *)addPackedSint64:(int64_t)value;
 - (TestPackedTypes_Builder *)setPackedSint64Array:(NSArray *)array;
+- (TestPackedTypes_Builder *)setPackedSint64:(PBArray *)array;
 - (TestPackedTypes_Builder *)setPackedSint64Values:(const int64_t *)values count:(NSUInteger)count;
 - (TestPackedTypes_Builder *)clearPackedSint64;
 
@@ -3163,6 +3409,7 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 - (uint32_t)packedFixed32AtIndex:(NSUInteger)index;
 - (TestPackedTypes_Builder *)addPackedFixed32:(uint32_t)value;
 - (TestPackedTypes_Builder *)setPackedFixed32Array:(NSArray *)array;
+- (TestPackedTypes_Builder *)setPackedFixed32:(PBArray *)array;
 - (TestPackedTypes_Builder *)setPackedFixed32Values:(const uint32_t *)values count:(NSUInteger)count;
 - (TestPackedTypes_Builder *)clearPackedFixed32;
 
@@ -3170,6 +3417,7 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 - (uint64_t)packedFixed64AtIndex:(NSUInteger)index;
 - (TestPackedTypes_Builder *)addPackedFixed64:(uint64_t)value;
 - (TestPackedTypes_Builder *)setPackedFixed64Array:(NSArray *)array;
+- (TestPackedTypes_Builder *)setPackedFixed64:(PBArray *)array;
 - (TestPackedTypes_Builder *)setPackedFixed64Values:(const uint64_t *)values count:(NSUInteger)count;
 - (TestPackedTypes_Builder *)clearPackedFixed64;
 
@@ -3177,6 +3425,7 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 - (int32_t)packedSfixed32AtIndex:(NSUInteger)index;
 - (TestPackedTypes_Builder *)addPackedSfixed32:(int32_t)value;
 - (TestPackedTypes_Builder *)setPackedSfixed32Array:(NSArray *)array;
+- (TestPackedTypes_Builder *)setPackedSfixed32:(PBArray *)array;
 - (TestPackedTypes_Builder *)setPackedSfixed32Values:(const int32_t *)values count:(NSUInteger)count;
 - (TestPackedTypes_Builder *)clearPackedSfixed32;
 
@@ -3184,6 +3433,7 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 - (int64_t)packedSfixed64AtIndex:(NSUInteger)index;
 - (TestPackedTypes_Builder *)addPackedSfixed64:(int64_t)value;
 - (TestPackedTypes_Builder *)setPackedSfixed64Array:(NSArray *)array;
+- (TestPackedTypes_Builder *)setPackedSfixed64:(PBArray *)array;
 - (TestPackedTypes_Builder *)setPackedSfixed64Values:(const int64_t *)values count:(NSUInteger)count;
 - (TestPackedTypes_Builder *)clearPackedSfixed64;
 
@@ -3191,6 +3441,7 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 - (Float32)packedFloatAtIndex:(NSUInteger)index;
 - (TestPackedTypes_Builder *)addPackedFloat:(Float32)value;
 - (TestPackedTypes_Builder *)setPackedFloatArray:(NSArray *)array;
+- (TestPackedTypes_Builder *)setPackedFloat:(PBArray *)array;
 - (TestPackedTypes_Builder *)setPackedFloatValues:(const Float32 *)values count:(NSUInteger)count;
 - (TestPackedTypes_Builder *)clearPackedFloat;
 
@@ -3198,6 +3449,7 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 - (Float64)packedDoubleAtIndex:(NSUInteger)index;
 - (TestPackedTypes_Builder *)addPackedDouble:(Float64)value;
 - (TestPackedTypes_Builder *)setPackedDoubleArray:(NSArray *)array;
+- (TestPackedTypes_Builder *)setPackedDouble:(PBArray *)array;
 - (TestPackedTypes_Builder *)setPackedDoubleValues:(const Float64 *)values count:(NSUInteger)count;
 - (TestPackedTypes_Builder *)clearPackedDouble;
 
@@ -3205,6 +3457,7 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 - (BOOL)packedBoolAtIndex:(NSUInteger)index;
 - (TestPackedTypes_Builder *)addPackedBool:(BOOL)value;
 - (TestPackedTypes_Builder *)setPackedBoolArray:(NSArray *)array;
+- (TestPackedTypes_Builder *)setPackedBool:(PBArray *)array;
 - (TestPackedTypes_Builder *)setPackedBoolValues:(const BOOL *)values count:(NSUInteger)count;
 - (TestPackedTypes_Builder *)clearPackedBool;
 
@@ -3212,41 +3465,43 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 - (ForeignEnum)packedEnumAtIndex:(NSUInteger)index;
 - (TestPackedTypes_Builder *)addPackedEnum:(ForeignEnum)value;
 - (TestPackedTypes_Builder *)setPackedEnumArray:(NSArray *)array;
+- (TestPackedTypes_Builder *)setPackedEnum:(PBArray *)array;
 - (TestPackedTypes_Builder *)setPackedEnumValues:(const ForeignEnum *)values count:(NSUInteger)count;
 - (TestPackedTypes_Builder *)clearPackedEnum;
 @end
 
 @interface TestUnpackedTypes : PBGeneratedMessage {
-@private
-  PBAppendableArray * unpackedBoolArray;
-  PBAppendableArray * unpackedDoubleArray;
-  PBAppendableArray * unpackedFloatArray;
-  PBAppendableArray * unpackedInt64Array;
-  PBAppendableArray * unpackedUint64Array;
-  PBAppendableArray * unpackedInt32Array;
-  PBAppendableArray * unpackedFixed64Array;
-  PBAppendableArray * unpackedFixed32Array;
-  PBAppendableArray * unpackedUint32Array;
-  PBAppendableArray * unpackedEnumArray;
-  PBAppendableArray * unpackedSfixed32Array;
-  PBAppendableArray * unpackedSfixed64Array;
-  PBAppendableArray * unpackedSint32Array;
-  PBAppendableArray * unpackedSint64Array;
-}
-@property (readonly, retain) PBArray * unpackedInt32;
-@property (readonly, retain) PBArray * unpackedInt64;
-@property (readonly, retain) PBArray * unpackedUint32;
-@property (readonly, retain) PBArray * unpackedUint64;
-@property (readonly, retain) PBArray * unpackedSint32;
-@property (readonly, retain) PBArray * unpackedSint64;
-@property (readonly, retain) PBArray * unpackedFixed32;
-@property (readonly, retain) PBArray * unpackedFixed64;
-@property (readonly, retain) PBArray * unpackedSfixed32;
-@property (readonly, retain) PBArray * unpackedSfixed64;
-@property (readonly, retain) PBArray * unpackedFloat;
-@property (readonly, retain) PBArray * unpackedDouble;
-@property (readonly, retain) PBArray * unpackedBool;
-@property (readonly, retain) PBArray * unpackedEnum;
+@package
+  uint32_t hasBits_[1];
+  PBBoolArray * unpackedBoolArray;
+  PBDoubleArray * unpackedDoubleArray;
+  PBFloatArray * unpackedFloatArray;
+  PBInt64Array * unpackedInt64Array;
+  PBUInt64Array * unpackedUint64Array;
+  PBInt32Array * unpackedInt32Array;
+  PBUInt64Array * unpackedFixed64Array;
+  PBUInt32Array * unpackedFixed32Array;
+  PBUInt32Array * unpackedUint32Array;
+  PBInt32Array * unpackedEnumArray;
+  PBInt32Array * unpackedSfixed32Array;
+  PBInt64Array * unpackedSfixed64Array;
+  PBInt32Array * unpackedSint32Array;
+  PBInt64Array * unpackedSint64Array;
+}
+@property (nonatomic, readonly, retain) PBArray * unpackedInt32;
+@property (nonatomic, readonly, retain) PBArray * unpackedInt64;
+@property (nonatomic, readonly, retain) PBArray * unpackedUint32;
+@property (nonatomic, readonly, retain) PBArray * unpackedUint64;
+@property (nonatomic, readonly, retain) PBArray * unpackedSint32;
+@property (nonatomic, readonly, retain) PBArray * unpackedSint64;
+@property (nonatomic, readonly, retain) PBArray * unpackedFixed32;
+@property (nonatomic, readonly, retain) PBArray * unpackedFixed64;
+@property (nonatomic, readonly, retain) PBArray * unpackedSfixed32;
+@property (nonatomic, readonly, retain) PBArray * unpackedSfixed64;
+@property (nonatomic, readonly, retain) PBArray * unpackedFloat;
+@property (nonatomic, readonly, retain) PBArray * unpackedDouble;
+@property (nonatomic, readonly, retain) PBArray * unpackedBool;
+@property (nonatomic, readonly, retain) PBArray * unpackedEnum;
 - (int32_t)unpackedInt32AtIndex:(NSUInteger)index;
 - (int64_t)unpackedInt64AtIndex:(NSUInteger)index;
 - (uint32_t)unpackedUint32AtIndex:(NSUInteger)index;
@@ -3283,15 +3538,24 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 @interface TestUnpackedTypes_Builder : PBGeneratedMessage_Builder {
 @private
   TestUnpackedTypes* result;
+  TestUnpackedTypes* prototype_;
 }
 
 - (TestUnpackedTypes*) defaultInstance;
 
 - (TestUnpackedTypes_Builder*) clear;
 - (TestUnpackedTypes_Builder*) clone;
+- (TestUnpackedTypes_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (TestUnpackedTypes_Builder*) recycle:(TestUnpackedTypes*) message;
 
 - (TestUnpackedTypes*) build;
 - (TestUnpackedTypes*) buildPartial;
+- (TestUnpackedTypes*) newBuildPartial;
 
 - (TestUnpackedTypes_Builder*) mergeFrom:(TestUnpackedTypes*) other;
 - (TestUnpackedTypes_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -3301,6 +3565,7 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 - (int32_t)unpackedInt32AtIndex:(NSUInteger)index;
 - (TestUnpackedTypes_Builder *)addUnpackedInt32:(int32_t)value;
 - (TestUnpackedTypes_Builder *)setUnpackedInt32Array:(NSArray *)array;
+- (TestUnpackedTypes_Builder *)setUnpackedInt32:(PBArray *)array;
 - (TestUnpackedTypes_Builder *)setUnpackedInt32Values:(const int32_t *)values count:(NSUInteger)count;
 - (TestUnpackedTypes_Builder *)clearUnpackedInt32;
 
@@ -3308,6 +3573,7 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 - (int64_t)unpackedInt64AtIndex:(NSUInteger)index;
 - (TestUnpackedTypes_Builder *)addUnpackedInt64:(int64_t)value;
 - (TestUnpackedTypes_Builder *)setUnpackedInt64Array:(NSArray *)array;
+- (TestUnpackedTypes_Builder *)setUnpackedInt64:(PBArray *)array;
 - (TestUnpackedTypes_Builder *)setUnpackedInt64Values:(const int64_t *)values count:(NSUInteger)count;
 - (TestUnpackedTypes_Builder *)clearUnpackedInt64;
 
@@ -3315,6 +3581,7 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 - (uint32_t)unpackedUint32AtIndex:(NSUInteger)index;
 - (TestUnpackedTypes_Builder *)addUnpackedUint32:(uint32_t)value;
 - (TestUnpackedTypes_Builder *)setUnpackedUint32Array:(NSArray *)array;
+- (TestUnpackedTypes_Builder *)setUnpackedUint32:(PBArray *)array;
 - (TestUnpackedTypes_Builder *)setUnpackedUint32Values:(const uint32_t *)values count:(NSUInteger)count;
 - (TestUnpackedTypes_Builder *)clearUnpackedUint32;
 
@@ -3322,6 +3589,7 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 - (uint64_t)unpackedUint64AtIndex:(NSUInteger)index;
 - (TestUnpackedTypes_Builder *)addUnpackedUint64:(uint64_t)value;
 - (TestUnpackedTypes_Builder *)setUnpackedUint64Array:(NSArray *)array;
+- (TestUnpackedTypes_Builder *)setUnpackedUint64:(PBArray *)array;
 - (TestUnpackedTypes_Builder *)setUnpackedUint64Values:(const uint64_t *)values count:(NSUInteger)count;
 - (TestUnpackedTypes_Builder *)clearUnpackedUint64;
 
@@ -3329,6 +3597,7 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 - (int32_t)unpackedSint32AtIndex:(NSUInteger)index;
 - (TestUnpackedTypes_Builder *)addUnpackedSint32:(int32_t)value;
 - (TestUnpackedTypes_Builder *)setUnpackedSint32Array:(NSArray *)array;
+- (TestUnpackedTypes_Builder *)setUnpackedSint32:(PBArray *)array;
 - (TestUnpackedTypes_Builder *)setUnpackedSint32Values:(const int32_t *)values count:(NSUInteger)count;
 - (TestUnpackedTypes_Builder *)clearUnpackedSint32;
 
@@ -3336,6 +3605,7 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 - (int64_t)unpackedSint64AtIndex:(NSUInteger)index;
 - (TestUnpackedTypes_Builder *)addUnpackedSint64:(int64_t)value;
 - (TestUnpackedTypes_Builder *)setUnpackedSint64Array:(NSArray *)array;
+- (TestUnpackedTypes_Builder *)setUnpackedSint64:(PBArray *)array;
 - (TestUnpackedTypes_Builder *)setUnpackedSint64Values:(const int64_t *)values count:(NSUInteger)count;
 - (TestUnpackedTypes_Builder *)clearUnpackedSint64;
 
@@ -3343,6 +3613,7 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 - (uint32_t)unpackedFixed32AtIndex:(NSUInteger)index;
 - (TestUnpackedTypes_Builder *)addUnpackedFixed32:(uint32_t)value;
 - (TestUnpackedTypes_Builder *)setUnpackedFixed32Array:(NSArray *)array;
+- (TestUnpackedTypes_Builder *)setUnpackedFixed32:(PBArray *)array;
 - (TestUnpackedTypes_Builder *)setUnpackedFixed32Values:(const uint32_t *)values count:(NSUInteger)count;
 - (TestUnpackedTypes_Builder *)clearUnpackedFixed32;
 
@@ -3350,6 +3621,7 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 - (uint64_t)unpackedFixed64AtIndex:(NSUInteger)index;
 - (TestUnpackedTypes_Builder *)addUnpackedFixed64:(uint64_t)value;
 - (TestUnpackedTypes_Builder *)setUnpackedFixed64Array:(NSArray *)array;
+- (TestUnpackedTypes_Builder *)setUnpackedFixed64:(PBArray *)array;
 - (TestUnpackedTypes_Builder *)setUnpackedFixed64Values:(const uint64_t *)values count:(NSUInteger)count;
 - (TestUnpackedTypes_Builder *)clearUnpackedFixed64;
 
@@ -3357,6 +3629,7 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 - (int32_t)unpackedSfixed32AtIndex:(NSUInteger)index;
 - (TestUnpackedTypes_Builder *)addUnpackedSfixed32:(int32_t)value;
 - (TestUnpackedTypes_Builder *)setUnpackedSfixed32Array:(NSArray *)array;
+- (TestUnpackedTypes_Builder *)setUnpackedSfixed32:(PBArray *)array;
 - (TestUnpackedTypes_Builder *)setUnpackedSfixed32Values:(const int32_t *)values count:(NSUInteger)count;
 - (TestUnpackedTypes_Builder *)clearUnpackedSfixed32;
 
@@ -3364,6 +3637,7 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 - (int64_t)unpackedSfixed64AtIndex:(NSUInteger)index;
 - (TestUnpackedTypes_Builder *)addUnpackedSfixed64:(int64_t)value;
 - (TestUnpackedTypes_Builder *)setUnpackedSfixed64Array:(NSArray *)array;
+- (TestUnpackedTypes_Builder *)setUnpackedSfixed64:(PBArray *)array;
 - (TestUnpackedTypes_Builder *)setUnpackedSfixed64Values:(const int64_t *)values count:(NSUInteger)count;
 - (TestUnpackedTypes_Builder *)clearUnpackedSfixed64;
 
@@ -3371,6 +3645,7 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 - (Float32)unpackedFloatAtIndex:(NSUInteger)index;
 - (TestUnpackedTypes_Builder *)addUnpackedFloat:(Float32)value;
 - (TestUnpackedTypes_Builder *)setUnpackedFloatArray:(NSArray *)array;
+- (TestUnpackedTypes_Builder *)setUnpackedFloat:(PBArray *)array;
 - (TestUnpackedTypes_Builder *)setUnpackedFloatValues:(const Float32 *)values count:(NSUInteger)count;
 - (TestUnpackedTypes_Builder *)clearUnpackedFloat;
 
@@ -3378,6 +3653,7 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 - (Float64)unpackedDoubleAtIndex:(NSUInteger)index;
 - (TestUnpackedTypes_Builder *)addUnpackedDouble:(Float64)value;
 - (TestUnpackedTypes_Builder *)setUnpackedDoubleArray:(NSArray *)array;
+- (TestUnpackedTypes_Builder *)setUnpackedDouble:(PBArray *)array;
 - (TestUnpackedTypes_Builder *)setUnpackedDoubleValues:(const Float64 *)values count:(NSUInteger)count;
 - (TestUnpackedTypes_Builder *)clearUnpackedDouble;
 
@@ -3385,6 +3661,7 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 - (BOOL)unpackedBoolAtIndex:(NSUInteger)index;
 - (TestUnpackedTypes_Builder *)addUnpackedBool:(BOOL)value;
 - (TestUnpackedTypes_Builder *)setUnpackedBoolArray:(NSArray *)array;
+- (TestUnpackedTypes_Builder *)setUnpackedBool:(PBArray *)array;
 - (TestUnpackedTypes_Builder *)setUnpackedBoolValues:(const BOOL *)values count:(NSUInteger)count;
 - (TestUnpackedTypes_Builder *)clearUnpackedBool;
 
@@ -3392,12 +3669,14 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 - (ForeignEnum)unpackedEnumAtIndex:(NSUInteger)index;
 - (TestUnpackedTypes_Builder *)addUnpackedEnum:(ForeignEnum)value;
 - (TestUnpackedTypes_Builder *)setUnpackedEnumArray:(NSArray *)array;
+- (TestUnpackedTypes_Builder *)setUnpackedEnum:(PBArray *)array;
 - (TestUnpackedTypes_Builder *)setUnpackedEnumValues:(const ForeignEnum *)values count:(NSUInteger)count;
 - (TestUnpackedTypes_Builder *)clearUnpackedEnum;
 @end
 
 @interface TestPackedExtensions : PBExtendableMessage {
-@private
+@package
+  uint32_t hasBits_[1];
 }
 
 + (TestPackedExtensions*) defaultInstance;
@@ -3421,15 +3700,24 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 @interface TestPackedExtensions_Builder : PBExtendableMessage_Builder {
 @private
   TestPackedExtensions* result;
+  TestPackedExtensions* prototype_;
 }
 
 - (TestPackedExtensions*) defaultInstance;
 
 - (TestPackedExtensions_Builder*) clear;
 - (TestPackedExtensions_Builder*) clone;
+- (TestPackedExtensions_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (TestPackedExtensions_Builder*) recycle:(TestPackedExtensions*) message;
 
 - (TestPackedExtensions*) build;
 - (TestPackedExtensions*) buildPartial;
+- (TestPackedExtensions*) newBuildPartial;
 
 - (TestPackedExtensions_Builder*) mergeFrom:(TestPackedExtensions*) other;
 - (TestPackedExtensions_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -3437,19 +3725,15 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 @end
 
 @interface TestDynamicExtensions : PBGeneratedMessage {
-@private
-  BOOL hasScalarExtension_:1;
-  BOOL hasMessageExtension_:1;
-  BOOL hasDynamicMessageExtension_:1;
-  BOOL hasEnumExtension_:1;
-  BOOL hasDynamicEnumExtension_:1;
+@package
+  uint32_t hasBits_[1];
   uint32_t scalarExtension;
   ForeignMessage* messageExtension;
   TestDynamicExtensions_DynamicMessageType* dynamicMessageExtension;
   ForeignEnum enumExtension;
   TestDynamicExtensions_DynamicEnumType dynamicEnumExtension;
-  PBAppendableArray * repeatedExtensionArray;
-  PBAppendableArray * packedExtensionArray;
+  PBObjectArray * repeatedExtensionArray;
+  PBInt32Array * packedExtensionArray;
   int32_t packedExtensionMemoizedSerializedSize;
 }
 - (BOOL) hasScalarExtension;
@@ -3457,13 +3741,13 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 - (BOOL) hasDynamicEnumExtension;
 - (BOOL) hasMessageExtension;
 - (BOOL) hasDynamicMessageExtension;
-@property (readonly) uint32_t scalarExtension;
-@property (readonly) ForeignEnum enumExtension;
-@property (readonly) TestDynamicExtensions_DynamicEnumType dynamicEnumExtension;
-@property (readonly, retain) ForeignMessage* messageExtension;
-@property (readonly, retain) TestDynamicExtensions_DynamicMessageType* dynamicMessageExtension;
-@property (readonly, retain) PBArray * repeatedExtension;
-@property (readonly, retain) PBArray * packedExtension;
+@property (nonatomic, readonly) uint32_t scalarExtension;
+@property (nonatomic, readonly) ForeignEnum enumExtension;
+@property (nonatomic, readonly) TestDynamicExtensions_DynamicEnumType dynamicEnumExtension;
+@property (nonatomic, readonly, retain) ForeignMessage* messageExtension;
+@property (nonatomic, readonly, retain) TestDynamicExtensions_DynamicMessageType* dynamicMessageExtension;
+@property (nonatomic, readonly, retain) PBArray * repeatedExtension;
+@property (nonatomic, readonly, retain) PBArray * packedExtension;
 - (NSString*)repeatedExtensionAtIndex:(NSUInteger)index;
 - (int32_t)packedExtensionAtIndex:(NSUInteger)index;
 
@@ -3486,12 +3770,12 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 @end
 
 @interface TestDynamicExtensions_DynamicMessageType : PBGeneratedMessage {
-@private
-  BOOL hasDynamicField_:1;
+@package
+  uint32_t hasBits_[1];
   int32_t dynamicField;
 }
 - (BOOL) hasDynamicField;
-@property (readonly) int32_t dynamicField;
+@property (nonatomic, readonly) int32_t dynamicField;
 
 + (TestDynamicExtensions_DynamicMessageType*) defaultInstance;
 - (TestDynamicExtensions_DynamicMessageType*) defaultInstance;
@@ -3514,15 +3798,24 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 @interface TestDynamicExtensions_DynamicMessageType_Builder : PBGeneratedMessage_Builder {
 @private
   TestDynamicExtensions_DynamicMessageType* result;
+  TestDynamicExtensions_DynamicMessageType* prototype_;
 }
 
 - (TestDynamicExtensions_DynamicMessageType*) defaultInstance;
 
 - (TestDynamicExtensions_DynamicMessageType_Builder*) clear;
 - (TestDynamicExtensions_DynamicMessageType_Builder*) clone;
+- (TestDynamicExtensions_DynamicMessageType_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (TestDynamicExtensions_DynamicMessageType_Builder*) recycle:(TestDynamicExtensions_DynamicMessageType*) message;
 
 - (TestDynamicExtensions_DynamicMessageType*) build;
 - (TestDynamicExtensions_DynamicMessageType*) buildPartial;
+- (TestDynamicExtensions_DynamicMessageType*) newBuildPartial;
 
 - (TestDynamicExtensions_DynamicMessageType_Builder*) mergeFrom:(TestDynamicExtensions_DynamicMessageType*) other;
 - (TestDynamicExtensions_DynamicMessageType_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -3537,15 +3830,28 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 @interface TestDynamicExtensions_Builder : PBGeneratedMessage_Builder {
 @private
   TestDynamicExtensions* result;
+  TestDynamicExtensions* prototype_;
+  ForeignMessage_Builder* messageExtensionBuilder_;
+  ForeignMessage_Builder* messageExtensionSpareBuilder_;
+  TestDynamicExtensions_DynamicMessageType_Builder* dynamicMessageExtensionBuilder_;
+  TestDynamicExtensions_DynamicMessageType_Builder* dynamicMessageExtensionSpareBuilder_;
 }
 
 - (TestDynamicExtensions*) defaultInstance;
 
 - (TestDynamicExtensions_Builder*) clear;
 - (TestDynamicExtensions_Builder*) clone;
+- (TestDynamicExtensions_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (TestDynamicExtensions_Builder*) recycle:(TestDynamicExtensions*) message;
 
 - (TestDynamicExtensions*) build;
 - (TestDynamicExtensions*) buildPartial;
+- (TestDynamicExtensions*) newBuildPartial;
 
 - (TestDynamicExtensions_Builder*) mergeFrom:(TestDynamicExtensions*) other;
 - (TestDynamicExtensions_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -3584,6 +3890,7 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 - (NSString*)repeatedExtensionAtIndex:(NSUInteger)index;
 - (TestDynamicExtensions_Builder *)addRepeatedExtension:(NSString*)value;
 - (TestDynamicExtensions_Builder *)setRepeatedExtensionArray:(NSArray *)array;
+- (TestDynamicExtensions_Builder *)setRepeatedExtension:(PBArray *)array;
 - (TestDynamicExtensions_Builder *)setRepeatedExtensionValues:(const NSString* *)values count:(NSUInteger)count;
 - (TestDynamicExtensions_Builder *)clearRepeatedExtension;
 
@@ -3591,25 +3898,27 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 - (int32_t)packedExtensionAtIndex:(NSUInteger)index;
 - (TestDynamicExtensions_Builder *)addPackedExtension:(int32_t)value;
 - (TestDynamicExtensions_Builder *)setPackedExtensionArray:(NSArray *)array;
+- (TestDynamicExtensions_Builder *)setPackedExtension:(PBArray *)array;
 - (TestDynamicExtensions_Builder *)setPackedExtensionValues:(const int32_t *)values count:(NSUInteger)count;
 - (TestDynamicExtensions_Builder *)clearPackedExtension;
 @end
 
 @interface TestRepeatedScalarDifferentTagSizes : PBGeneratedMessage {
-@private
-  PBAppendableArray * repeatedFloatArray;
-  PBAppendableArray * repeatedInt64Array;
-  PBAppendableArray * repeatedUint64Array;
-  PBAppendableArray * repeatedInt32Array;
-  PBAppendableArray * repeatedFixed64Array;
-  PBAppendableArray * repeatedFixed32Array;
-}
-@property (readonly, retain) PBArray * repeatedFixed32;
-@property (readonly, retain) PBArray * repeatedInt32;
-@property (readonly, retain) PBArray * repeatedFixed64;
-@property (readonly, retain) PBArray * repeatedInt64;
-@property (readonly, retain) PBArray * repeatedFloat;
-@property (readonly, retain) PBArray * repeatedUint64;
+@package
+  uint32_t hasBits_[1];
+  PBFloatArray * repeatedFloatArray;
+  PBInt64Array * repeatedInt64Array;
+  PBUInt64Array * repeatedUint64Array;
+  PBInt32Array * repeatedInt32Array;
+  PBUInt64Array * repeatedFixed64Array;
+  PBUInt32Array * repeatedFixed32Array;
+}
+@property (nonatomic, readonly, retain) PBArray * repeatedFixed32;
+@property (nonatomic, readonly, retain) PBArray * repeatedInt32;
+@property (nonatomic, readonly, retain) PBArray * repeatedFixed64;
+@property (nonatomic, readonly, retain) PBArray * repeatedInt64;
+@property (nonatomic, readonly, retain) PBArray * repeatedFloat;
+@property (nonatomic, readonly, retain) PBArray * repeatedUint64;
 - (uint32_t)repeatedFixed32AtIndex:(NSUInteger)index;
 - (int32_t)repeatedInt32AtIndex:(NSUInteger)index;
 - (uint64_t)repeatedFixed64AtIndex:(NSUInteger)index;
@@ -3638,15 +3947,24 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 @interface TestRepeatedScalarDifferentTagSizes_Builder : PBGeneratedMessage_Builder {
 @private
   TestRepeatedScalarDifferentTagSizes* result;
+  TestRepeatedScalarDifferentTagSizes* prototype_;
 }
 
 - (TestRepeatedScalarDifferentTagSizes*) defaultInstance;
 
 - (TestRepeatedScalarDifferentTagSizes_Builder*) clear;
 - (TestRepeatedScalarDifferentTagSizes_Builder*) clone;
+- (TestRepeatedScalarDifferentTagSizes_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (TestRepeatedScalarDifferentTagSizes_Builder*) recycle:(TestRepeatedScalarDifferentTagSizes*) message;
 
 - (TestRepeatedScalarDifferentTagSizes*) build;
 - (TestRepeatedScalarDifferentTagSizes*) buildPartial;
+- (TestRepeatedScalarDifferentTagSizes*) newBuildPartial;
 
 - (TestRepeatedScalarDifferentTagSizes_Builder*) mergeFrom:(TestRepeatedScalarDifferentTagSizes*) other;
 - (TestRepeatedScalarDifferentTagSizes_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -3656,6 +3974,7 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 - (uint32_t)repeatedFixed32AtIndex:(NSUInteger)index;
 - (TestRepeatedScalarDifferentTagSizes_Builder *)addRepeatedFixed32:(uint32_t)value;
 - (TestRepeatedScalarDifferentTagSizes_Builder *)setRepeatedFixed32Array:(NSArray *)array;
+- (TestRepeatedScalarDifferentTagSizes_Builder *)setRepeatedFixed32:(PBArray *)array;
 - (TestRepeatedScalarDifferentTagSizes_Builder *)setRepeatedFixed32Values:(const uint32_t *)values count:(NSUInteger)count;
 - (TestRepeatedScalarDifferentTagSizes_Builder *)clearRepeatedFixed32;
 
@@ -3663,6 +3982,7 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 - (int32_t)repeatedInt32AtIndex:(NSUInteger)index;
 - (TestRepeatedScalarDifferentTagSizes_Builder *)addRepeatedInt32:(int32_t)value;
 - (TestRepeatedScalarDifferentTagSizes_Builder *)setRepeatedInt32Array:(NSArray *)array;
+- (TestRepeatedScalarDifferentTagSizes_Builder *)setRepeatedInt32:(PBArray *)array;
 - (TestRepeatedScalarDifferentTagSizes_Builder *)setRepeatedInt32Values:(const int32_t *)values count:(NSUInteger)count;
 - (TestRepeatedScalarDifferentTagSizes_Builder *)clearRepeatedInt32;
 
@@ -3670,6 +3990,7 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 - (uint64_t)repeatedFixed64AtIndex:(NSUInteger)index;
 - (TestRepeatedScalarDifferentTagSizes_Builder *)addRepeatedFixed64:(uint64_t)value;
 - (TestRepeatedScalarDifferentTagSizes_Builder *)setRepeatedFixed64Array:(NSArray *)array;
+- (TestRepeatedScalarDifferentTagSizes_Builder *)setRepeatedFixed64:(PBArray *)array;
 - (TestRepeatedScalarDifferentTagSizes_Builder *)setRepeatedFixed64Values:(const uint64_t *)values count:(NSUInteger)count;
 - (TestRepeatedScalarDifferentTagSizes_Builder *)clearRepeatedFixed64;
 
@@ -3677,6 +3998,7 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 - (int64_t)repeatedInt64AtIndex:(NSUInteger)index;
 - (TestRepeatedScalarDifferentTagSizes_Builder *)addRepeatedInt64:(int64_t)value;
 - (TestRepeatedScalarDifferentTagSizes_Builder *)setRepeatedInt64Array:(NSArray *)array;
+- (TestRepeatedScalarDifferentTagSizes_Builder *)setRepeatedInt64:(PBArray *)array;
 - (TestRepeatedScalarDifferentTagSizes_Builder *)setRepeatedInt64Values:(const int64_t *)values count:(NSUInteger)count;
 - (TestRepeatedScalarDifferentTagSizes_Builder *)clearRepeatedInt64;
 
@@ -3684,6 +4006,7 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 - (Float32)repeatedFloatAtIndex:(NSUInteger)index;
 - (TestRepeatedScalarDifferentTagSizes_Builder *)addRepeatedFloat:(Float32)value;
 - (TestRepeatedScalarDifferentTagSizes_Builder *)setRepeatedFloatArray:(NSArray *)array;
+- (TestRepeatedScalarDifferentTagSizes_Builder *)setRepeatedFloat:(PBArray *)array;
 - (TestRepeatedScalarDifferentTagSizes_Builder *)setRepeatedFloatValues:(const Float32 *)values count:(NSUInteger)count;
 - (TestRepeatedScalarDifferentTagSizes_Builder *)clearRepeatedFloat;
 
@@ -3691,12 +4014,14 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 - (uint64_t)repeatedUint64AtIndex:(NSUInteger)index;
 - (TestRepeatedScalarDifferentTagSizes_Builder *)addRepeatedUint64:(uint64_t)value;
 - (TestRepeatedScalarDifferentTagSizes_Builder *)setRepeatedUint64Array:(NSArray *)array;
+- (TestRepeatedScalarDifferentTagSizes_Builder *)setRepeatedUint64:(PBArray *)array;
 - (TestRepeatedScalarDifferentTagSizes_Builder *)setRepeatedUint64Values:(const uint64_t *)values count:(NSUInteger)count;
 - (TestRepeatedScalarDifferentTagSizes_Builder *)clearRepeatedUint64;
 @end
 
 @interface FooRequest : PBGeneratedMessage {
-@private
+@package
+  uint32_t hasBits_[1];
 }
 
 + (FooRequest*) defaultInstance;
@@ -3720,15 +4045,24 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 @interface FooRequest_Builder : PBGeneratedMessage_Builder {
 @private
   FooRequest* result;
+  FooRequest* prototype_;
 }
 
 - (FooRequest*) defaultInstance;
 
 - (FooRequest_Builder*) clear;
 - (FooRequest_Builder*) clone;
+- (FooRequest_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (FooRequest_Builder*) recycle:(FooRequest*) message;
 
 - (FooRequest*) build;
 - (FooRequest*) buildPartial;
+- (FooRequest*) newBuildPartial;
 
 - (FooRequest_Builder*) mergeFrom:(FooRequest*) other;
 - (FooRequest_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -3736,7 +4070,8 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 @end
 
 @interface FooResponse : PBGeneratedMessage {
-@private
+@package
+  uint32_t hasBits_[1];
 }
 
 + (FooResponse*) defaultInstance;
@@ -3760,15 +4095,24 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 @interface FooResponse_Builder : PBGeneratedMessage_Builder {
 @private
   FooResponse* result;
+  FooResponse* prototype_;
 }
 
 - (FooResponse*) defaultInstance;
 
 - (FooResponse_Builder*) clear;
 - (FooResponse_Builder*) clone;
+- (FooResponse_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (FooResponse_Builder*) recycle:(FooResponse*) message;
 
 - (FooResponse*) build;
 - (FooResponse*) buildPartial;
+- (FooResponse*) newBuildPartial;
 
 - (FooResponse_Builder*) mergeFrom:(FooResponse*) other;
 - (FooResponse_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -3776,7 +4120,8 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 @end
 
 @interface BarRequest : PBGeneratedMessage {
-@private
+@package
+  uint32_t hasBits_[1];
 }
 
 + (BarRequest*) defaultInstance;
@@ -3800,15 +4145,24 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 @interface BarRequest_Builder : PBGeneratedMessage_Builder {
 @private
   BarRequest* result;
+  BarRequest* prototype_;
 }
 
 - (BarRequest*) defaultInstance;
 
 - (BarRequest_Builder*) clear;
 - (BarRequest_Builder*) clone;
+- (BarRequest_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (BarRequest_Builder*) recycle:(BarRequest*) message;
 
 - (BarRequest*) build;
 - (BarRequest*) buildPartial;
+- (BarRequest*) newBuildPartial;
 
 - (BarRequest_Builder*) mergeFrom:(BarRequest*) other;
 - (BarRequest_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -3816,7 +4170,8 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 @end
 
 @interface BarResponse : PBGeneratedMessage {
-@private
+@package
+  uint32_t hasBits_[1];
 }
 
 + (BarResponse*) defaultInstance;
@@ -3840,15 +4195,24 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 @interface BarResponse_Builder : PBGeneratedMessage_Builder {
 @private
   BarResponse* result;
+  BarResponse* prototype_;
 }
 
 - (BarResponse*) defaultInstance;
 
 - (BarResponse_Builder*) clear;
 - (BarResponse_Builder*) clone;
+- (BarResponse_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (BarResponse_Builder*) recycle:(BarResponse*) message;
 
 - (BarResponse*) build;
 - (BarResponse*) buildPartial;
+- (BarResponse*) newBuildPartial;
 
 - (BarResponse_Builder*) mergeFrom:(BarResponse*) other;
 - (BarResponse_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -173,12 +173,12 @@ BOOL DummyMessageContainingEnum_TestEnumTypeIsValidValue(DummyMessageContainingE
 @end
 
 @interface TestMessageWithCustomOptions : PBGeneratedMessage {
-@private
-  BOOL hasField1_:1;
+@package
+  uint32_t hasBits_[1];
   NSString* field1;
 }
 - (BOOL) hasField1;
-@property (readonly, retain) NSString* field1;
+@property (nonatomic, readonly, retain) NSString* field1;
 
 + (TestMessageWithCustomOptions*) defaultInstance;
 - (TestMessageWithCustomOptions*) defaultInstance;
@@ -201,15 +201,24 @@ BOOL DummyMessageContainingEnum_TestEnumTypeIsValidValue(DummyMessageContainingE
 @interface TestMessageWithCustomOptions_Builder : PBGeneratedMessage_Builder {
 @private
   TestMessageWithCustomOptions* result;
+  TestMessageWithCustomOptions* prototype_;
 }
 
 - (TestMessageWithCustomOptions*) defaultInstance;
 
 - (TestMessageWithCustomOptions_Builder*) clear;
 - (TestMessageWithCustomOptions_Builder*) clone;
+- (TestMessageWithCustomOptions_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (TestMessageWithCustomOptions_Builder*) recycle:(TestMessageWithCustomOptions*) message;
 
 - (TestMessageWithCustomOptions*) build;
 - (TestMessageWithCustomOptions*) buildPartial;
+- (TestMessageWithCustomOptions*) newBuildPartial;
 
 - (TestMessageWithCustomOptions_Builder*) mergeFrom:(TestMessageWithCustomOptions*) other;
 - (TestMessageWithCustomOptions_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -222,7 +231,8 @@ BOOL DummyMessageContainingEnum_TestEnumTypeIsValidValue(DummyMessageContainingE
 @end
 
 @interface CustomOptionFooRequest : PBGeneratedMessage {
-@private
+@package
+  uint32_t hasBits_[1];
 }
 
 + (CustomOptionFooRequest*) defaultInstance;
@@ -246,15 +256,24 @@ BOOL DummyMessageContainingEnum_TestEnumTypeIsValidValue(DummyMessageContainingE
 @interface CustomOptionFooRequest_Builder : PBGeneratedMessage_Builder {
 @private
   CustomOptionFooRequest* result;
+  CustomOptionFooRequest* prototype_;
 }
 
 - (CustomOptionFooRequest*) defaultInstance;
 
 - (CustomOptionFooRequest_Builder*) clear;
 - (CustomOptionFooRequest_Builder*) clone;
+- (CustomOptionFooRequest_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (CustomOptionFooRequest_Builder*) recycle:(CustomOptionFooRequest*) message;
 
 - (CustomOptionFooRequest*) build;
 - (CustomOptionFooRequest*) buildPartial;
+- (CustomOptionFooRequest*) newBuildPartial;
 
 - (CustomOptionFooRequest_Builder*) mergeFrom:(CustomOptionFooRequest*) other;
 - (CustomOptionFooRequest_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -262,7 +281,8 @@ BOOL DummyMessageContainingEnum_TestEnumTypeIsValidValue(DummyMessageContainingE
 @end
 
 @interface CustomOptionFooResponse : PBGeneratedMessage {
-@private
+@package
+  uint32_t hasBits_[1];
 }
 
 + (CustomOptionFooResponse*) defaultInstance;
@@ -286,15 +306,24 @@ BOOL DummyMessageContainingEnum_TestEnumTypeIsValidValue(DummyMessageContainingE
 @interface CustomOptionFooResponse_Builder : PBGeneratedMessage_Builder {
 @private
   CustomOptionFooResponse* result;
+  CustomOptionFooResponse* prototype_;
 }
 
 - (CustomOptionFooResponse*) defaultInstance;
 
 - (CustomOptionFooResponse_Builder*) clear;
 - (CustomOptionFooResponse_Builder*) clone;
+- (CustomOptionFooResponse_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (CustomOptionFooResponse_Builder*) recycle:(CustomOptionFooResponse*) message;
 
 - (CustomOptionFooResponse*) build;
 - (CustomOptionFooResponse*) buildPartial;
+- (CustomOptionFooResponse*) newBuildPartial;
 
 - (CustomOptionFooResponse_Builder*) mergeFrom:(CustomOptionFooResponse*) other;
 - (CustomOptionFooResponse_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -302,7 +331,8 @@ BOOL DummyMessageContainingEnum_TestEnumTypeIsValidValue(DummyMessageContainingE
 @end
 
 @interface DummyMessageContainingEnum : PBGeneratedMessage {
-@private
+@package
+  uint32_t hasBits_[1];
 }
 
 + (DummyMessageContainingEnum*) defaultInstance;
@@ -326,15 +356,24 @@ BOOL DummyMessageContainingEnum_TestEnumTypeIsValidValue(DummyMessageContainingE
 @interface DummyMessageContainingEnum_Builder : PBGeneratedMessage_Builder {
 @private
   DummyMessageContainingEnum* result;
+  DummyMessageContainingEnum* prototype_;
 }
 
 - (DummyMessageContainingEnum*) defaultInstance;
 
 - (DummyMessageContainingEnum_Builder*) clear;
 - (DummyMessageContainingEnum_Builder*) clone;
+- (DummyMessageContainingEnum_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (DummyMessageContainingEnum_Builder*) recycle:(DummyMessageContainingEnum*) message;
 
 - (DummyMessageContainingEnum*) build;
 - (DummyMessageContainingEnum*) buildPartial;
+- (DummyMessageContainingEnum*) newBuildPartial;
 
 - (DummyMessageContainingEnum_Builder*) mergeFrom:(DummyMessageContainingEnum*) other;
 - (DummyMessageContainingEnum_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -342,7 +381,8 @@ BOOL DummyMessageContainingEnum_TestEnumTypeIsValidValue(DummyMessageContainingE
 @end
 
 @interface DummyMessageInvalidAsOptionType : PBGeneratedMessage {
-@private
+@package
+  uint32_t hasBits_[1];
 }
 
 + (DummyMessageInvalidAsOptionType*) defaultInstance;
@@ -366,15 +406,24 @@ BOOL DummyMessageContainingEnum_TestEnumTypeIsValidValue(DummyMessageContainingE
 @interface DummyMessageInvalidAsOptionType_Builder : PBGeneratedMessage_Builder {
 @private
   DummyMessageInvalidAsOptionType* result;
+  DummyMessageInvalidAsOptionType* prototype_;
 }
 
 - (DummyMessageInvalidAsOptionType*) defaultInstance;
 
 - (DummyMessageInvalidAsOptionType_Builder*) clear;
 - (DummyMessageInvalidAsOptionType_Builder*) clone;
+- (DummyMessageInvalidAsOptionType_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (DummyMessageInvalidAsOptionType_Builder*) recycle:(DummyMessageInvalidAsOptionType*) message;
 
 - (DummyMessageInvalidAsOptionType*) build;
 - (DummyMessageInvalidAsOptionType*) buildPartial;
+- (DummyMessageInvalidAsOptionType*) newBuildPartial;
 
 - (DummyMessageInvalidAsOptionType_Builder*) mergeFrom:(DummyMessageInvalidAsOptionType*) other;
 - (DummyMessageInvalidAsOptionType_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -382,7 +431,8 @@ BOOL DummyMessageContainingEnum_TestEnumTypeIsValidValue(DummyMessageContainingE
 @end
 
 @interface CustomOptionMinIntegerValues : PBGeneratedMessage {
-@private
+@package
+  uint32_t hasBits_[1];
 }
 
 + (CustomOptionMinIntegerValues*) defaultInstance;
@@ -406,15 +456,24 @@ BOOL DummyMessageContainingEnum_TestEnumTypeIsValidValue(DummyMessageContainingE
 @interface CustomOptionMinIntegerValues_Builder : PBGeneratedMessage_Builder {
 @private
   CustomOptionMinIntegerValues* result;
+  CustomOptionMinIntegerValues* prototype_;
 }
 
 - (CustomOptionMinIntegerValues*) defaultInstance;
 
 - (CustomOptionMinIntegerValues_Builder*) clear;
 - (CustomOptionMinIntegerValues_Builder*) clone;
+- (CustomOptionMinIntegerValues_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (CustomOptionMinIntegerValues_Builder*) recycle:(CustomOptionMinIntegerValues*) message;
 
 - (CustomOptionMinIntegerValues*) build;
 - (CustomOptionMinIntegerValues*) buildPartial;
+- (CustomOptionMinIntegerValues*) newBuildPartial;
 
 - (CustomOptionMinIntegerValues_Builder*) mergeFrom:(CustomOptionMinIntegerValues*) other;
 - (CustomOptionMinIntegerValues_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -422,7 +481,8 @@ BOOL DummyMessageContainingEnum_TestEnumTypeIsValidValue(DummyMessageContainingE
 @end
 
 @interface CustomOptionMaxIntegerValues : PBGeneratedMessage {
-@private
+@package
+  uint32_t hasBits_[1];
 }
 
 + (CustomOptionMaxIntegerValues*) defaultInstance;
@@ -446,15 +506,24 @@ BOOL DummyMessageContainingEnum_TestEnumTypeIsValidValue(DummyMessageContainingE
 @interface CustomOptionMaxIntegerValues_Builder : PBGeneratedMessage_Builder {
 @private
   CustomOptionMaxIntegerValues* result;
+  CustomOptionMaxIntegerValues* prototype_;
 }
 
 - (CustomOptionMaxIntegerValues*) defaultInstance;
 
 - (CustomOptionMaxIntegerValues_Builder*) clear;
 - (CustomOptionMaxIntegerValues_Builder*) clone;
+- (CustomOptionMaxIntegerValues_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (CustomOptionMaxIntegerValues_Builder*) recycle:(CustomOptionMaxIntegerValues*) message;
 
 - (CustomOptionMaxIntegerValues*) build;
 - (CustomOptionMaxIntegerValues*) buildPartial;
+- (CustomOptionMaxIntegerValues*) newBuildPartial;
 
 - (CustomOptionMaxIntegerValues_Builder*) mergeFrom:(CustomOptionMaxIntegerValues*) other;
 - (CustomOptionMaxIntegerValues_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -462,7 +531,8 @@ BOOL DummyMessageContainingEnum_TestEnumTypeIsValidValue(DummyMessageContainingE
 @end
 
 @interface CustomOptionOtherValues : PBGeneratedMessage {
-@private
+@package
+  uint32_t hasBits_[1];
 }
 
 + (CustomOptionOtherValues*) defaultInstance;
@@ -486,15 +556,24 @@ BOOL DummyMessageContainingEnum_TestEnumTypeIsValidValue(DummyMessageContainingE
 @interface CustomOptionOtherValues_Builder : PBGeneratedMessage_Builder {
 @private
   CustomOptionOtherValues* result;
+  CustomOptionOtherValues* prototype_;
 }
 
 - (CustomOptionOtherValues*) defaultInstance;
 
 - (CustomOptionOtherValues_Builder*) clear;
 - (CustomOptionOtherValues_Builder*) clone;
+- (CustomOptionOtherValues_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (CustomOptionOtherValues_Builder*) recycle:(CustomOptionOtherValues*) message;
 
 - (CustomOptionOtherValues*) build;
 - (CustomOptionOtherValues*) buildPartial;
+- (CustomOptionOtherValues*) newBuildPartial;
 
 - (CustomOptionOtherValues_Builder*) mergeFrom:(CustomOptionOtherValues*) other;
 - (CustomOptionOtherValues_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -502,7 +581,8 @@ BOOL DummyMessageContainingEnum_TestEnumTypeIsValidValue(DummyMessageContainingE
 @end
 
 @interface SettingRealsFromPositiveInts : PBGeneratedMessage {
-@private
+@package
+  uint32_t hasBits_[1];
 }
 
 + (SettingRealsFromPositiveInts*) defaultInstance;
@@ -526,15 +606,24 @@ BOOL DummyMessageContainingEnum_TestEnumTypeIsValidValue(DummyMessageContainingE
 @interface SettingRealsFromPositiveInts_Builder : PBGeneratedMessage_Builder {
 @private
   SettingRealsFromPositiveInts* result;
+  SettingRealsFromPositiveInts* prototype_;
 }
 
 - (SettingRealsFromPositiveInts*) defaultInstance;
 
 - (SettingRealsFromPositiveInts_Builder*) clear;
 - (SettingRealsFromPositiveInts_Builder*) clone;
+- (SettingRealsFromPositiveInts_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (SettingRealsFromPositiveInts_Builder*) recycle:(SettingRealsFromPositiveInts*) message;
 
 - (SettingRealsFromPositiveInts*) build;
 - (SettingRealsFromPositiveInts*) buildPartial;
+- (SettingRealsFromPositiveInts*) newBuildPartial;
 
 - (SettingRealsFromPositiveInts_Builder*) mergeFrom:(SettingRealsFromPositiveInts*) other;
 - (SettingRealsFromPositiveInts_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -542,7 +631,8 @@ BOOL DummyMessageContainingEnum_TestEnumTypeIsValidValue(DummyMessageContainingE
 @end
 
 @interface SettingRealsFromNegativeInts : PBGeneratedMessage {
-@private
+@package
+  uint32_t hasBits_[1];
 }
 
 + (SettingRealsFromNegativeInts*) defaultInstance;
@@ -566,15 +656,24 @@ BOOL DummyMessageContainingEnum_TestEnumTypeIsValidValue(DummyMessageContainingE
 @interface SettingRealsFromNegativeInts_Builder : PBGeneratedMessage_Builder {
 @private
   SettingRealsFromNegativeInts* result;
+  SettingRealsFromNegativeInts* prototype_;
 }
 
 - (SettingRealsFromNegativeInts*) defaultInstance;
 
 - (SettingRealsFromNegativeInts_Builder*) clear;
 - (SettingRealsFromNegativeInts_Builder*) clone;
+- (SettingRealsFromNegativeInts_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (SettingRealsFromNegativeInts_Builder*) recycle:(SettingRealsFromNegativeInts*) message;
 
 - (SettingRealsFromNegativeInts*) build;
 - (SettingRealsFromNegativeInts*) buildPartial;
+- (SettingRealsFromNegativeInts*) newBuildPartial;
 
 - (SettingRealsFromNegativeInts_Builder*) mergeFrom:(SettingRealsFromNegativeInts*) other;
 - (SettingRealsFromNegativeInts_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -582,10 +681,8 @@ BOOL DummyMessageContainingEnum_TestEnumTypeIsValidValue(DummyMessageContainingE
 @end
 
 @interface ComplexOptionType1 : PBExtendableMessage {
-@private
-  BOOL hasFoo_:1;
-  BOOL hasFoo2_:1;
-  BOOL hasFoo3_:1;
+@package
+  uint32_t hasBits_[1];
   int32_t foo;
   int32_t foo2;
   int32_t foo3;
@@ -593,9 +690,9 @@ BOOL DummyMessageContainingEnum_TestEnumTypeIsValidValue(DummyMessageContainingE
 - (BOOL) hasFoo;
 - (BOOL) hasFoo2;
 - (BOOL) hasFoo3;
-@property (readonly) int32_t foo;
-@property (readonly) int32_t foo2;
-@property (readonly) int32_t foo3;
+@property (nonatomic, readonly) int32_t foo;
+@property (nonatomic, readonly) int32_t foo2;
+@property (nonatomic, readonly) int32_t foo3;
 
 + (ComplexOptionType1*) defaultInstance;
 - (ComplexOptionType1*) defaultInstance;
@@ -618,15 +715,24 @@ BOOL DummyMessageContainingEnum_TestEnumTypeIsValidValue(DummyMessageContainingE
 @interface ComplexOptionType1_Builder : PBExtendableMessage_Builder {
 @private
   ComplexOptionType1* result;
+  ComplexOptionType1* prototype_;
 }
 
 - (ComplexOptionType1*) defaultInstance;
 
 - (ComplexOptionType1_Builder*) clear;
 - (ComplexOptionType1_Builder*) clone;
+- (ComplexOptionType1_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (ComplexOptionType1_Builder*) recycle:(ComplexOptionType1*) message;
 
 - (ComplexOptionType1*) build;
 - (ComplexOptionType1*) buildPartial;
+- (ComplexOptionType1*) newBuildPartial;
 
 - (ComplexOptionType1_Builder*) mergeFrom:(ComplexOptionType1*) other;
 - (ComplexOptionType1_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -649,10 +755,8 @@ BOOL DummyMessageContainingEnum_TestEnumTypeIsValidValue(DummyMessageContainingE
 @end
 
 @interface ComplexOptionType2 : PBExtendableMessage {
-@private
-  BOOL hasBaz_:1;
-  BOOL hasBar_:1;
-  BOOL hasFred_:1;
+@package
+  uint32_t hasBits_[1];
   int32_t baz;
   ComplexOptionType1* bar;
   ComplexOptionType2_ComplexOptionType4* fred;
@@ -660,9 +764,9 @@ BOOL DummyMessageContainingEnum_TestEnumTypeIsValidValue(DummyMessageContainingE
 - (BOOL) hasBar;
 - (BOOL) hasBaz;
 - (BOOL) hasFred;
-@property (readonly, retain) ComplexOptionType1* bar;
-@property (readonly) int32_t baz;
-@property (readonly, retain) ComplexOptionType2_ComplexOptionType4* fred;
+@property (nonatomic, readonly, retain) ComplexOptionType1* bar;
+@property (nonatomic, readonly) int32_t baz;
+@property (nonatomic, readonly, retain) ComplexOptionType2_ComplexOptionType4* fred;
 
 + (ComplexOptionType2*) defaultInstance;
 - (ComplexOptionType2*) defaultInstance;
@@ -683,12 +787,12 @@ BOOL DummyMessageContainingEnum_TestEnumTypeIsValidValue(DummyMessageContainingE
 @end
 
 @interface ComplexOptionType2_ComplexOptionType4 : PBGeneratedMessage {
-@private
-  BOOL hasWaldo_:1;
+@package
+  uint32_t hasBits_[1];
   int32_t waldo;
 }
 - (BOOL) hasWaldo;
-@property (readonly) int32_t waldo;
+@property (nonatomic, readonly) int32_t waldo;
 
 + (ComplexOptionType2_ComplexOptionType4*) defaultInstance;
 - (ComplexOptionType2_ComplexOptionType4*) defaultInstance;
@@ -712,15 +816,24 @@ BOOL DummyMessageContainingEnum_TestEnumTypeIsValidValue(DummyMessageContainingE
 @interface ComplexOptionType2_ComplexOptionType4_Builder : PBGeneratedMessage_Builder {
 @private
   ComplexOptionType2_ComplexOptionType4* result;
+  ComplexOptionType2_ComplexOptionType4* prototype_;
 }
 
 - (ComplexOptionType2_ComplexOptionType4*) defaultInstance;
 
 - (ComplexOptionType2_ComplexOptionType4_Builder*) clear;
 - (ComplexOptionType2_ComplexOptionType4_Builder*) clone;
+- (ComplexOptionType2_ComplexOptionType4_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (ComplexOptionType2_ComplexOptionType4_Builder*) recycle:(ComplexOptionType2_ComplexOptionType4*) message;
 
 - (ComplexOptionType2_ComplexOptionType4*) build;
 - (ComplexOptionType2_ComplexOptionType4*) buildPartial;
+- (ComplexOptionType2_ComplexOptionType4*) newBuildPartial;
 
 - (ComplexOptionType2_ComplexOptionType4_Builder*) mergeFrom:(ComplexOptionType2_ComplexOptionType4*) other;
 - (ComplexOptionType2_ComplexOptionType4_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -735,15 +848,28 @@ BOOL DummyMessageContainingEnum_TestEnumTypeIsValidValue(DummyMessageContainingE
 @interface ComplexOptionType2_Builder : PBExtendableMessage_Builder {
 @private
   ComplexOptionType2* result;
+  ComplexOptionType2* prototype_;
+  ComplexOptionType1_Builder* barBuilder_;
+  ComplexOptionType1_Builder* barSpareBuilder_;
+  ComplexOptionType2_ComplexOptionType4_Builder* fredBuilder_;
+  ComplexOptionType2_ComplexOptionType4_Builder* fredSpareBuilder_;
 }
 
 - (ComplexOptionType2*) defaultInstance;
 
 - (ComplexOptionType2_Builder*) clear;
 - (ComplexOptionType2_Builder*) clone;
+- (ComplexOptionType2_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (ComplexOptionType2_Builder*) recycle:(ComplexOptionType2*) message;
 
 - (ComplexOptionType2*) build;
 - (ComplexOptionType2*) buildPartial;
+- (ComplexOptionType2*) newBuildPartial;
 
 - (ComplexOptionType2_Builder*) mergeFrom:(ComplexOptionType2*) other;
 - (ComplexOptionType2_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -770,16 +896,15 @@ BOOL DummyMessageContainingEnum_TestEnumTypeIsValidValue(DummyMessageContainingE
 @end
 
 @interface ComplexOptionType3 : PBGeneratedMessage {
-@private
-  BOOL hasQux_:1;
-  BOOL hasComplexOptionType5_:1;
+@package
+  uint32_t hasBits_[1];
   int32_t qux;
   ComplexOptionType3_ComplexOptionType5* complexOptionType5;
 }
 - (BOOL) hasQux;
 - (BOOL) hasComplexOptionType5;
-@property (readonly) int32_t qux;
-@property (readonly, retain) ComplexOptionType3_ComplexOptionType5* complexOptionType5;
+@property (nonatomic, readonly) int32_t qux;
+@property (nonatomic, readonly, retain) ComplexOptionType3_ComplexOptionType5* complexOptionType5;
 
 + (ComplexOptionType3*) defaultInstance;
 - (ComplexOptionType3*) defaultInstance;
@@ -800,12 +925,12 @@ BOOL DummyMessageContainingEnum_TestEnumTypeIsValidValue(DummyMessageContainingE
 @end
 
 @interface ComplexOptionType3_ComplexOptionType5 : PBGeneratedMessage {
-@private
-  BOOL hasPlugh_:1;
+@package
+  uint32_t hasBits_[1];
   int32_t plugh;
 }
 - (BOOL) hasPlugh;
-@property (readonly) int32_t plugh;
+@property (nonatomic, readonly) int32_t plugh;
 
 + (ComplexOptionType3_ComplexOptionType5*) defaultInstance;
 - (ComplexOptionType3_ComplexOptionType5*) defaultInstance;
@@ -828,15 +953,24 @@ BOOL DummyMessageContainingEnum_TestEnumTypeIsValidValue(DummyMessageContainingE
 @interface ComplexOptionType3_ComplexOptionType5_Builder : PBGeneratedMessage_Builder {
 @private
   ComplexOptionType3_ComplexOptionType5* result;
+  ComplexOptionType3_ComplexOptionType5* prototype_;
 }
 
 - (ComplexOptionType3_ComplexOptionType5*) defaultInstance;
 
 - (ComplexOptionType3_ComplexOptionType5_Builder*) clear;
 - (ComplexOptionType3_ComplexOptionType5_Builder*) clone;
+- (ComplexOptionType3_ComplexOptionType5_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (ComplexOptionType3_ComplexOptionType5_Builder*) recycle:(ComplexOptionType3_ComplexOptionType5*) message;
 
 - (ComplexOptionType3_ComplexOptionType5*) build;
 - (ComplexOptionType3_ComplexOptionType5*) buildPartial;
+- (ComplexOptionType3_ComplexOptionType5*) newBuildPartial;
 
 - (ComplexOptionType3_ComplexOptionType5_Builder*) mergeFrom:(ComplexOptionType3_ComplexOptionType5*) other;
 - (ComplexOptionType3_ComplexOptionType5_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -851,15 +985,26 @@ BOOL DummyMessageContainingEnum_TestEnumTypeIsValidValue(DummyMessageContainingE
 @interface ComplexOptionType3_Builder : PBGeneratedMessage_Builder {
 @private
   ComplexOptionType3* result;
+  ComplexOptionType3* prototype_;
+  ComplexOptionType3_ComplexOptionType5_Builder* complexOptionType5Builder_;
+  ComplexOptionType3_ComplexOptionType5_Builder* complexOptionType5SpareBuilder_;
 }
 
 - (ComplexOptionType3*) defaultInstance;
 
 - (ComplexOptionType3_Builder*) clear;
 - (ComplexOptionType3_Builder*) clone;
+- (ComplexOptionType3_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (ComplexOptionType3_Builder*) recycle:(ComplexOptionType3*) message;
 
 - (ComplexOptionType3*) build;
 - (ComplexOptionType3*) buildPartial;
+- (ComplexOptionType3*) newBuildPartial;
 
 - (ComplexOptionType3_Builder*) mergeFrom:(ComplexOptionType3*) other;
 - (ComplexOptionType3_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -879,12 +1024,12 @@ BOOL DummyMessageContainingEnum_TestEnumTypeIsValidValue(DummyMessageContainingE
 @end
 
 @interface ComplexOpt6 : PBGeneratedMessage {
-@private
-  BOOL hasXyzzy_:1;
+@package
+  uint32_t hasBits_[1];
   int32_t xyzzy;
 }
 - (BOOL) hasXyzzy;
-@property (readonly) int32_t xyzzy;
+@property (nonatomic, readonly) int32_t xyzzy;
 
 + (ComplexOpt6*) defaultInstance;
 - (ComplexOpt6*) defaultInstance;
@@ -907,15 +1052,24 @@ BOOL DummyMessageContainingEnum_TestEnumTypeIsValidValue(DummyMessageContainingE
 @interface ComplexOpt6_Builder : PBGeneratedMessage_Builder {
 @private
   ComplexOpt6* result;
+  ComplexOpt6* prototype_;
 }
 
 - (ComplexOpt6*) defaultInstance;
 
 - (ComplexOpt6_Builder*) clear;
 - (ComplexOpt6_Builder*) clone;
+- (ComplexOpt6_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (ComplexOpt6_Builder*) recycle:(ComplexOpt6*) message;
 
 - (ComplexOpt6*) build;
 - (ComplexOpt6*) buildPartial;
+- (ComplexOpt6*) newBuildPartial;
 
 - (ComplexOpt6_Builder*) mergeFrom:(ComplexOpt6*) other;
 - (ComplexOpt6_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -928,7 +1082,8 @@ BOOL DummyMessageContainingEnum_TestEnumTypeIsValidValue(DummyMessageContainingE
 @end
 
 @interface VariousComplexOptions : PBGeneratedMessage {
-@private
+@package
+  uint32_t hasBits_[1];
 }
 
 + (VariousComplexOptions*) defaultInstance;
@@ -952,15 +1107,24 @@ BOOL DummyMessageContainingEnum_TestEnumTypeIsValidValue(DummyMessageContainingE
 @interface VariousComplexOptions_Builder : PBGeneratedMessage_Builder {
 @private
   VariousComplexOptions* result;
+  VariousComplexOptions* prototype_;
 }
 
 - (VariousComplexOptions*) defaultInstance;
 
 - (VariousComplexOptions_Builder*) clear;
 - (VariousComplexOptions_Builder*) clone;
+- (VariousComplexOptions_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (VariousComplexOptions_Builder*) recycle:(VariousComplexOptions*) message;
 
 - (VariousComplexOptions*) build;
 - (VariousComplexOptions*) buildPartial;
+- (VariousComplexOptions*) newBuildPartial;
 
 - (VariousComplexOptions_Builder*) mergeFrom:(VariousComplexOptions*) other;
 - (VariousComplexOptions_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -968,7 +1132,8 @@ BOOL DummyMessageContainingEnum_TestEnumTypeIsValidValue(DummyMessageContainingE
 @end
 
 @interface AggregateMessageSet : PBExtendableMessage {
-@private
+@package
+  uint32_t hasBits_[1];
 }
 
 + (AggregateMessageSet*) defaultInstance;
@@ -992,15 +1157,24 @@ BOOL DummyMessageContainingEnum_TestEnumTypeIsValidValue(DummyMessageContainingE
 @interface AggregateMessageSet_Builder : PBExtendableMessage_Builder {
 @private
   AggregateMessageSet* result;
+  AggregateMessageSet* prototype_;
 }
 
 - (AggregateMessageSet*) defaultInstance;
 
 - (AggregateMessageSet_Builder*) clear;
 - (AggregateMessageSet_Builder*) clone;
+- (AggregateMessageSet_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (AggregateMessageSet_Builder*) recycle:(AggregateMessageSet*) message;
 
 - (AggregateMessageSet*) build;
 - (AggregateMessageSet*) buildPartial;
+- (AggregateMessageSet*) newBuildPartial;
 
 - (AggregateMessageSet_Builder*) mergeFrom:(AggregateMessageSet*) other;
 - (AggregateMessageSet_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -1008,12 +1182,12 @@ BOOL DummyMessageContainingEnum_TestEnumTypeIsValidValue(DummyMessageContainingE
 @end
 
 @interface AggregateMessageSetElement : PBGeneratedMessage {
-@private
-  BOOL hasS_:1;
+@package
+  uint32_t hasBits_[1];
   NSString* s;
 }
 - (BOOL) hasS;
-@property (readonly, retain) NSString* s;
+@property (nonatomic, readonly, retain) NSString* s;
 
 + (AggregateMessageSetElement*) defaultInstance;
 - (AggregateMessageSetElement*) defaultInstance;
@@ -1037,15 +1211,24 @@ BOOL DummyMessageContainingEnum_TestEnumTypeIsValidValue(DummyMessageContainingE
 @interface AggregateMessageSetElement_Builder : PBGeneratedMessage_Builder {
 @private
   AggregateMessageSetElement* result;
+  AggregateMessageSetElement* prototype_;
 }
 
 - (AggregateMessageSetElement*) defaultInstance;
 
 - (AggregateMessageSetElement_Builder*) clear;
 - (AggregateMessageSetElement_Builder*) clone;
+- (AggregateMessageSetElement_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (AggregateMessageSetElement_Builder*) recycle:(AggregateMessageSetElement*) message;
 
 - (AggregateMessageSetElement*) build;
 - (AggregateMessageSetElement*) buildPartial;
+- (AggregateMessageSetElement*) newBuildPartial;
 
 - (AggregateMessageSetElement_Builder*) mergeFrom:(AggregateMessageSetElement*) other;
 - (AggregateMessageSetElement_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -1058,12 +1241,8 @@ BOOL DummyMessageContainingEnum_TestEnumTypeIsValidValue(DummyMessageContainingE
 @end
 
 @interface Aggregate : PBGeneratedMessage {
-@private
-  BOOL hasI_:1;
-  BOOL hasS_:1;
-  BOOL hasSub_:1;
-  BOOL hasFile_:1;
-  BOOL hasMset_:1;
+@package
+  uint32_t hasBits_[1];
   int32_t i;
   NSString* s;
   Aggregate* sub;
@@ -1075,11 +1254,11 @@ BOOL DummyMessageContainingEnum_TestEnumTypeIsValidValue(DummyMessageContainingE
 - (BOOL) hasSub;
 - (BOOL) hasFile;
 - (BOOL) hasMset;
-@property (readonly) int32_t i;
-@property (readonly, retain) NSString* s;
-@property (readonly, retain) Aggregate* sub;
-@property (readonly, retain) PBFileOptions* file;
-@property (readonly, retain) AggregateMessageSet* mset;
+@property (nonatomic, readonly) int32_t i;
+@property (nonatomic, readonly, retain) NSString* s;
+@property (nonatomic, readonly, retain) Aggregate* sub;
+@property (nonatomic, readonly, retain) PBFileOptions* file;
+@property (nonatomic, readonly, retain) AggregateMessageSet* mset;
 
 + (Aggregate*) defaultInstance;
 - (Aggregate*) defaultInstance;
@@ -1103,15 +1282,30 @@ BOOL DummyMessageContainingEnum_TestEnumTypeIsValidValue(DummyMessageContainingE
 @interface Aggregate_Builder : PBGeneratedMessage_Builder {
 @private
   Aggregate* result;
+  Aggregate* prototype_;
+  Aggregate_Builder* subBuilder_;
+  Aggregate_Builder* subSpareBuilder_;
+  PBFileOptions_Builder* fileBuilder_;
+  PBFileOptions_Builder* fileSpareBuilder_;
+  AggregateMessageSet_Builder* msetBuilder_;
+  AggregateMessageSet_Builder* msetSpareBuilder_;
 }
 
 - (Aggregate*) defaultInstance;
 
 - (Aggregate_Builder*) clear;
 - (Aggregate_Builder*) clone;
+- (Aggregate_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (Aggregate_Builder*) recycle:(Aggregate*) message;
 
 - (Aggregate*) build;
 - (Aggregate*) buildPartial;
+- (Aggregate*) newBuildPartial;
 
 - (Aggregate_Builder*) mergeFrom:(Aggregate*) other;
 - (Aggregate_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -1150,12 +1344,12 @@ BOOL DummyMessageContainingEnum_TestEnumTypeIsValidValue(DummyMessageContainingE
 @end
 
 @interface AggregateMessage : PBGeneratedMessage {
-@private
-  BOOL hasFieldname_:1;
+@package
+  uint32_t hasBits_[1];
   int32_t fieldname;
 }
 - (BOOL) hasFieldname;
-@property (readonly) int32_t fieldname;
+@property (nonatomic, readonly) int32_t fieldname;
 
 + (AggregateMessage*) defaultInstance;
 - (AggregateMessage*) defaultInstance;
@@ -1178,15 +1372,24 @@ BOOL DummyMessageContainingEnum_TestEnumTypeIsValidValue(DummyMessageContainingE
 @interface AggregateMessage_Builder : PBGeneratedMessage_Builder {
 @private
   AggregateMessage* result;
+  AggregateMessage* prototype_;
 }
 
 - (AggregateMessage*) defaultInstance;
 
 - (AggregateMessage_Builder*) clear;
 - (AggregateMessage_Builder*) clone;
+- (AggregateMessage_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (AggregateMessage_Builder*) recycle:(AggregateMessage*) message;
 
 - (AggregateMessage*) build;
 - (AggregateMessage*) buildPartial;
+- (AggregateMessage*) newBuildPartial;
 
 - (AggregateMessage_Builder*) mergeFrom:(AggregateMessage*) other;
 - (AggregateMessage_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -48,6 +48,13 @@ static id<PBExtensionField> AggregateMessageSetElement_messageSetExtension = nil
 static id<PBExtensionField> Aggregate_nested = nil;
 static PBExtensionRegistry* extensionRegistry = nil;
 + (PBExtensionRegistry*) extensionRegistry {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    PBMutableExtensionRegistry* registry = [PBMutableExtensionRegistry registry];
+    [UnittestCustomOptionsRoot registerAllExtensions:registry];
+    [PBDescriptorRoot registerAllExtensions:registry];
+    extensionRegistry = [registry retain];
+  });
   return extensionRegistry;
 }
 
@@ -440,10 +447,6 @@ static PBExtensionRegistry* extensionRegistry = nil;
                                         isRepeated:NO
                                           isPacked:NO
                             isMessageSetWireFormat:NO] retain];
-    PBMutableExtensionRegistry* registry = [PBMutableExtensionRegistry registry];
-    [self registerAllExtensions:registry];
-    [PBDescriptorRoot registerAllExtensions:registry];
-    extensionRegistry = [registry retain];
   }
 }
 + (void) registerAllExtensions:(PBMutableExtensionRegistry*) registry {
@@ -631,62 +634,74 @@ BOOL AggregateEnumIsValidValue(AggregateEnum value) {
   }
 }
 @interface TestMessageWithCustomOptions ()
-@property (retain) NSString* field1;
+@property (nonatomic, retain) NSString* field1;
+@end
+
+@interface TestMessageWithCustomOptions_Builder()
+@property (nonatomic, retain) TestMessageWithCustomOptions* result;
+- (id) initWithPrototype:(TestMessageWithCustomOptions*) prototype;
+- (void) detachFromPrototype;
 @end
 
 @implementation TestMessageWithCustomOptions
 
 - (BOOL) hasField1 {
-  return !!hasField1_;
+  return (hasBits_[0] & 0x1u) != 0;
 }
-- (void) setHasField1:(BOOL) value {
-  hasField1_ = !!value;
+- (void) setHasField1:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x1u;
+  } else {
+    hasBits_[0] &= ~0x1u;
+  }
 }
 @synthesize field1;
+- (NSString*) field1 {
+  return (hasBits_[0] & 0x1u) ? field1 : @"";
+}
 - (void) dealloc {
-  self.field1 = nil;
+  [field1 release];
   [super dealloc];
 }
-- (id) init {
-  if ((self = [super init])) {
-    self.field1 = @"";
-  }
-  return self;
+- (void) clearForReuse {
+  [super clearForReuse];
+  memset(hasBits_, 0, sizeof(hasBits_));
+  [field1 release];
+  field1 = nil;
 }
 static TestMessageWithCustomOptions* defaultTestMessageWithCustomOptionsInstance = nil;
-+ (void) initialize {
-  if (self == [TestMessageWithCustomOptions class]) {
-    defaultTestMessageWithCustomOptionsInstance = [[TestMessageWithCustomOptions alloc] init];
-  }
-}
 + (TestMessageWithCustomOptions*) defaultInstance {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultTestMessageWithCustomOptionsInstance = [[TestMessageWithCustomOptions alloc] init];
+  });
   return defaultTestMessageWithCustomOptionsInstance;
 }
 - (TestMessageWithCustomOptions*) defaultInstance {
-  return defaultTestMessageWithCustomOptionsInstance;
+  return [TestMessageWithCustomOptions defaultInstance];
 }
 - (BOOL) isInitialized {
   return YES;
 }
 - (void) writeToCodedOutputStream:(PBCodedOutputStream*) output {
-  if (self.hasField1) {
-    [output writeString:1 value:self.field1];
+  if (hasBits_[0] & 0x1u) {
+    [output writeString:1 value:field1];
   }
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = PBGeneratedMessageGetMemoizedSize(&memoizedSerializedSize);
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
-  if (self.hasField1) {
-    size += computeStringSize(1, self.field1);
+  size_ = 0;
+  if (hasBits_[0] & 0x1u) {
+    size_ += computeStringSize(1, field1);
   }
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
+  size_ += self.unknownFields.serializedSize;
+  PBGeneratedMessageSetMemoizedSize(&memoizedSerializedSize, size_);
+  return size_;
 }
 + (TestMessageWithCustomOptions*) parseFromData:(NSData*) data {
   return (TestMessageWithCustomOptions*)[[[TestMessageWithCustomOptions builder] mergeFromData:data] build];
@@ -710,7 +725,7 @@ static TestMessageWithCustomOptions* defaultTestMessageWithCustomOptionsInstance
   return [[[TestMessageWithCustomOptions_Builder alloc] init] autorelease];
 }
 + (TestMessageWithCustomOptions_Builder*) builderWithPrototype:(TestMessageWithCustomOptions*) prototype {
-  return [[TestMessageWithCustomOptions builder] mergeFrom:prototype];
+  return [[[TestMessageWithCustomOptions_Builder alloc] initWithPrototype:prototype] autorelease];
 }
 - (TestMessageWithCustomOptions_Builder*) builder {
   return [TestMessageWithCustomOptions builder];
@@ -719,8 +734,8 @@ static TestMessageWithCustomOptions* defaultTestMessageWithCustomOptionsInstance
   return [TestMessageWithCustomOptions builderWithPrototype:self];
 }
 - (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
-  if (self.hasField1) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"field1", self.field1];
+  if (hasBits_[0] & 0x1u) {
+    [output appendFormat:@"%@%@: %@\n", indent, @"field1", field1];
   }
   [self.unknownFields writeDescriptionTo:output withIndent:indent];
 }
@@ -733,18 +748,24 @@ static TestMessageWithCustomOptions* defaultTestMessageWithCustomOptionsInstance
   }
   TestMessageWithCustomOptions *otherMessage = other;
   return
-      self.hasField1 == otherMessage.hasField1 &&
-      (!self.hasField1 || [self.field1 isEqual:otherMessage.field1]) &&
-      
+      (hasBits_[0] & 0x1u) == (otherMessage->hasBits_[0] & 0x1u) &&
+      (!(hasBits_[0] & 0x1u) || [field1 isEqual:otherMessage->field1]) &&
       (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
 }
 - (NSUInteger) hash {
-  NSUInteger hashCode = 7;
-  if (self.hasField1) {
-    hashCode = hashCode * 31 + [self.field1 hash];
+  NSUInteger hash_ = PBGeneratedMessageGetMemoizedHash(&memoizedHash);
+  if (hash_ != 0) {
+    return hash_;
   }
-  hashCode = hashCode * 31 + [self.unknownFields hash];
-  return hashCode;
+
+  uint64_t hashCode = 7;
+  if (hasBits_[0] & 0x1u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [field1 hash]);
+  }
+  hashCode = PBGeneratedMessageHashMix(hashCode, [self.unknownFields hash]);
+  hash_ = PBGeneratedMessageHashFinish(hashCode);
+  PBGeneratedMessageSetMemoizedHash(&memoizedHash, hash_);
+  return hash_;
 }
 @end
 
@@ -757,31 +778,78 @@ BOOL TestMessageWithCustomOptions_AnEnumIsValidValue(TestMessageWithCustomOption
       return NO;
   }
 }
-@interface TestMessageWithCustomOptions_Builder()
-@property (retain) TestMessageWithCustomOptions* result;
-@end
-
 @implementation TestMessageWithCustomOptions_Builder
 @synthesize result;
 - (void) dealloc {
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
   self.result = nil;
+  [prototype_ release];
   [super dealloc];
 }
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[[TestMessageWithCustomOptions alloc] init] autorelease];
+    result = [TestMessageWithCustomOptions recycledInstance];
+  }
+  return self;
+}
+- (id) initWithPrototype:(TestMessageWithCustomOptions*) prototype {
+  if ((self = [super init])) {
+    self.result = prototype;
+    prototype_ = [prototype retain];
   }
   return self;
 }
+- (void) detachFromPrototype {
+  TestMessageWithCustomOptions* prototype = prototype_;
+  prototype_ = nil;
+  self.result = [[[TestMessageWithCustomOptions alloc] init] autorelease];
+  [self mergeFrom:prototype];
+  [prototype release];
+}
+- (PBGeneratedMessage*) internalGetMutableResult {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return [self internalGetResult];
+}
 - (PBGeneratedMessage*) internalGetResult {
   return result;
 }
 - (TestMessageWithCustomOptions_Builder*) clear {
-  self.result = [[[TestMessageWithCustomOptions alloc] init] autorelease];
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = [[TestMessageWithCustomOptions recycledInstance] autorelease];
   return self;
 }
 - (TestMessageWithCustomOptions_Builder*) clone {
-  return [TestMessageWithCustomOptions builderWithPrototype:result];
+  if (prototype_ != nil) {
+    return [[[TestMessageWithCustomOptions_Builder alloc] initWithPrototype:prototype_] autorelease];
+  }
+  return [[TestMessageWithCustomOptions builder] mergeFrom:result];
+}
+- (TestMessageWithCustomOptions_Builder*) reset {
+  if (result == nil || prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    self.result = [[TestMessageWithCustomOptions recycledInstance] autorelease];
+  } else {
+    [result clearForReuse];
+  }
+  return self;
+}
+- (TestMessageWithCustomOptions_Builder*) recycle:(TestMessageWithCustomOptions*) message {
+  if (message == [TestMessageWithCustomOptions defaultInstance]) {
+    @throw [NSException exceptionWithName:@"IllegalArgument" reason:@"Cannot recycle the default instance" userInfo:nil];
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = message;
+  return [self reset];
 }
 - (TestMessageWithCustomOptions*) defaultInstance {
   return [TestMessageWithCustomOptions defaultInstance];
@@ -791,16 +859,29 @@ BOOL TestMessageWithCustomOptions_AnEnumIsValidValue(TestMessageWithCustomOption
   return [self buildPartial];
 }
 - (TestMessageWithCustomOptions*) buildPartial {
-  TestMessageWithCustomOptions* returnMe = [[result retain] autorelease];
-  self.result = nil;
+  return [[self newBuildPartial] autorelease];
+}
+- (TestMessageWithCustomOptions*) newBuildPartial {
+  if (prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    TestMessageWithCustomOptions* returnMe = result;
+    result = nil;
+    return returnMe;
+  }
+  TestMessageWithCustomOptions* returnMe = result;
+  result = nil;
   return returnMe;
 }
 - (TestMessageWithCustomOptions_Builder*) mergeFrom:(TestMessageWithCustomOptions*) other {
   if (other == [TestMessageWithCustomOptions defaultInstance]) {
     return self;
   }
-  if (other.hasField1) {
-    [self setField1:other.field1];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (other->hasBits_[0] & 0x1u) {
+    [self setField1:other->field1];
   }
   [self mergeUnknownFields:other.unknownFields];
   return self;
@@ -809,41 +890,61 @@ BOOL TestMessageWithCustomOptions_AnEnumIsValidValue(TestMessageWithCustomOption
   return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
 }
 - (TestMessageWithCustomOptions_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  PBUnknownFieldSet_Builder* unknownFields = nil;
   while (YES) {
     int32_t tag = [input readTag];
     switch (tag) {
       case 0:
-        [self setUnknownFields:[unknownFields build]];
+        if (unknownFields != nil) {
+          [self setUnknownFields:[unknownFields build]];
+        }
         return self;
       default: {
-        if (![self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag]) {
-          [self setUnknownFields:[unknownFields build]];
+        if (PBWireFormatGetTagWireType(tag) == PBWireFormatEndGroup) {
+          if (unknownFields != nil) {
+            [self setUnknownFields:[unknownFields build]];
+          }
           return self;
         }
+        if (unknownFields == nil) {
+          unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+        }
+        [self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag];
         break;
       }
       case 10: {
-        [self setField1:[input readString]];
+        NSString* value = [input newString];
+        [self setField1:value];
+        [value release];
         break;
       }
     }
   }
 }
 - (BOOL) hasField1 {
-  return result.hasField1;
+  return (result->hasBits_[0] & 0x1u) != 0;
 }
 - (NSString*) field1 {
-  return result.field1;
+  return [result field1];
 }
 - (TestMessageWithCustomOptions_Builder*) setField1:(NSString*) value {
-  result.hasField1 = YES;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x1u;
   result.field1 = value;
   return self;
 }
 - (TestMessageWithCustomOptions_Builder*) clearField1 {
-  result.hasField1 = NO;
-  result.field1 = @"";
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x1u;
+  [result->field1 release];
+  result->field1 = nil;
   return self;
 }
 @end
@@ -851,27 +952,31 @@ BOOL TestMessageWithCustomOptions_AnEnumIsValidValue(TestMessageWithCustomOption
 @interface CustomOptionFooRequest ()
 @end
 
+@interface CustomOptionFooRequest_Builder()
+@property (nonatomic, retain) CustomOptionFooRequest* result;
+- (id) initWithPrototype:(CustomOptionFooRequest*) prototype;
+- (void) detachFromPrototype;
+@end
+
 @implementation CustomOptionFooRequest
 
 - (void) dealloc {
   [super dealloc];
 }
-- (id) init {
-  if ((self = [super init])) {
-  }
-  return self;
+- (void) clearForReuse {
+  [super clearForReuse];
+  memset(hasBits_, 0, sizeof(hasBits_));
 }
 static CustomOptionFooRequest* defaultCustomOptionFooRequestInstance = nil;
-+ (void) initialize {
-  if (self == [CustomOptionFooRequest class]) {
-    defaultCustomOptionFooRequestInstance = [[CustomOptionFooRequest alloc] init];
-  }
-}
 + (CustomOptionFooRequest*) defaultInstance {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultCustomOptionFooRequestInstance = [[CustomOptionFooRequest alloc] init];
+  });
   return defaultCustomOptionFooRequestInstance;
 }
 - (CustomOptionFooRequest*) defaultInstance {
-  return defaultCustomOptionFooRequestInstance;
+  return [CustomOptionFooRequest defaultInstance];
 }
 - (BOOL) isInitialized {
   return YES;
@@ -880,15 +985,15 @@ static CustomOptionFooRequest* defaultCustomOptionFooRequestInstance = nil;
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = PBGeneratedMessageGetMemoizedSize(&memoizedSerializedSize);
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
+  size_ = 0;
+  size_ += self.unknownFields.serializedSize;
+  PBGeneratedMessageSetMemoizedSize(&memoizedSerializedSize, size_);
+  return size_;
 }
 + (CustomOptionFooRequest*) parseFromData:(NSData*) data {
   return (CustomOptionFooRequest*)[[[CustomOptionFooRequest builder] mergeFromData:data] build];
@@ -912,7 +1017,7 @@ static CustomOptionFooRequest* defaultCustomOptionFooRequestInstance = nil;
   return [[[CustomOptionFooRequest_Builder alloc] init] autorelease];
 }
 + (CustomOptionFooRequest_Builder*) builderWithPrototype:(CustomOptionFooRequest*) prototype {
-  return [[CustomOptionFooRequest builder] mergeFrom:prototype];
+  return [[[CustomOptionFooRequest_Builder alloc] initWithPrototype:prototype] autorelease];
 }
 - (CustomOptionFooRequest_Builder*) builder {
   return [CustomOptionFooRequest builder];
@@ -935,37 +1040,91 @@ static CustomOptionFooRequest* defaultCustomOptionFooRequestInstance = nil;
       (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
 }
 - (NSUInteger) hash {
-  NSUInteger hashCode = 7;
-  hashCode = hashCode * 31 + [self.unknownFields hash];
-  return hashCode;
-}
-@end
+  NSUInteger hash_ = PBGeneratedMessageGetMemoizedHash(&memoizedHash);
+  if (hash_ != 0) {
+    return hash_;
+  }
 
-@interface CustomOptionFooRequest_Builder()
-@property (retain) CustomOptionFooRequest* result;
+  uint64_t hashCode = 7;
+  hashCode = PBGeneratedMessageHashMix(hashCode, [self.unknownFields hash]);
+  hash_ = PBGeneratedMessageHashFinish(hashCode);
+  PBGeneratedMessageSetMemoizedHash(&memoizedHash, hash_);
+  return hash_;
+}
 @end
 
 @implementation CustomOptionFooRequest_Builder
 @synthesize result;
 - (void) dealloc {
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
   self.result = nil;
+  [prototype_ release];
   [super dealloc];
 }
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[[CustomOptionFooRequest alloc] init] autorelease];
+    result = [CustomOptionFooRequest recycledInstance];
+  }
+  return self;
+}
+- (id) initWithPrototype:(CustomOptionFooRequest*) prototype {
+  if ((self = [super init])) {
+    self.result = prototype;
+    prototype_ = [prototype retain];
   }
   return self;
 }
+- (void) detachFromPrototype {
+  CustomOptionFooRequest* prototype = prototype_;
+  prototype_ = nil;
+  self.result = [[[CustomOptionFooRequest alloc] init] autorelease];
+  [self mergeFrom:prototype];
+  [prototype release];
+}
+- (PBGeneratedMessage*) internalGetMutableResult {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return [self internalGetResult];
+}
 - (PBGeneratedMessage*) internalGetResult {
   return result;
 }
 - (CustomOptionFooRequest_Builder*) clear {
-  self.result = [[[CustomOptionFooRequest alloc] init] autorelease];
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = [[CustomOptionFooRequest recycledInstance] autorelease];
   return self;
 }
 - (CustomOptionFooRequest_Builder*) clone {
-  return [CustomOptionFooRequest builderWithPrototype:result];
+  if (prototype_ != nil) {
+    return [[[CustomOptionFooRequest_Builder alloc] initWithPrototype:prototype_] autorelease];
+  }
+  return [[CustomOptionFooRequest builder] mergeFrom:result];
+}
+- (CustomOptionFooRequest_Builder*) reset {
+  if (result == nil || prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    self.result = [[CustomOptionFooRequest recycledInstance] autorelease];
+  } else {
+    [result clearForReuse];
+  }
+  return self;
+}
+- (CustomOptionFooRequest_Builder*) recycle:(CustomOptionFooRequest*) message {
+  if (message == [CustomOptionFooRequest defaultInstance]) {
+    @throw [NSException exceptionWithName:@"IllegalArgument" reason:@"Cannot recycle the default instance" userInfo:nil];
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = message;
+  return [self reset];
 }
 - (CustomOptionFooRequest*) defaultInstance {
   return [CustomOptionFooRequest defaultInstance];
@@ -975,14 +1134,27 @@ static CustomOptionFooRequest* defaultCustomOptionFooRequestInstance = nil;
   return [self buildPartial];
 }
 - (CustomOptionFooRequest*) buildPartial {
-  CustomOptionFooRequest* returnMe = [[result retain] autorelease];
-  self.result = nil;
+  return [[self newBuildPartial] autorelease];
+}
+- (CustomOptionFooRequest*) newBuildPartial {
+  if (prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    CustomOptionFooRequest* returnMe = result;
+    result = nil;
+    return returnMe;
+  }
+  CustomOptionFooRequest* returnMe = result;
+  result = nil;
   return returnMe;
 }
 - (CustomOptionFooRequest_Builder*) mergeFrom:(CustomOptionFooRequest*) other {
   if (other == [CustomOptionFooRequest defaultInstance]) {
     return self;
   }
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
   [self mergeUnknownFields:other.unknownFields];
   return self;
 }
@@ -990,18 +1162,29 @@ static CustomOptionFooRequest* defaultCustomOptionFooRequestInstance = nil;
   return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
 }
 - (CustomOptionFooRequest_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  PBUnknownFieldSet_Builder* unknownFields = nil;
   while (YES) {
     int32_t tag = [input readTag];
     switch (tag) {
       case 0:
-        [self setUnknownFields:[unknownFields build]];
+        if (unknownFields != nil) {
+          [self setUnknownFields:[unknownFields build]];
+        }
         return self;
       default: {
-        if (![self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag]) {
-          [self setUnknownFields:[unknownFields build]];
+        if (PBWireFormatGetTagWireType(tag) == PBWireFormatEndGroup) {
+          if (unknownFields != nil) {
+            [self setUnknownFields:[unknownFields build]];
+          }
           return self;
         }
+        if (unknownFields == nil) {
+          unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+        }
+        [self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag];
         break;
       }
     }
@@ -1012,27 +1195,31 @@ static CustomOptionFooRequest* defaultCustomOptionFooRequestInstance = nil;
 @interface CustomOptionFooResponse ()
 @end
 
+@interface CustomOptionFooResponse_Builder()
+@property (nonatomic, retain) CustomOptionFooResponse* result;
+- (id) initWithPrototype:(CustomOptionFooResponse*) prototype;
+- (void) detachFromPrototype;
+@end
+
 @implementation CustomOptionFooResponse
 
 - (void) dealloc {
   [super dealloc];
 }
-- (id) init {
-  if ((self = [super init])) {
-  }
-  return self;
+- (void) clearForReuse {
+  [super clearForReuse];
+  memset(hasBits_, 0, sizeof(hasBits_));
 }
 static CustomOptionFooResponse* defaultCustomOptionFooResponseInstance = nil;
-+ (void) initialize {
-  if (self == [CustomOptionFooResponse class]) {
-    defaultCustomOptionFooResponseInstance = [[CustomOptionFooResponse alloc] init];
-  }
-}
 + (CustomOptionFooResponse*) defaultInstance {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultCustomOptionFooResponseInstance = [[CustomOptionFooResponse alloc] init];
+  });
   return defaultCustomOptionFooResponseInstance;
 }
 - (CustomOptionFooResponse*) defaultInstance {
-  return defaultCustomOptionFooResponseInstance;
+  return [CustomOptionFooResponse defaultInstance];
 }
 - (BOOL) isInitialized {
   return YES;
@@ -1041,15 +1228,15 @@ static CustomOptionFooResponse* defaultCustomOptionFooResponseInstance = nil;
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = PBGeneratedMessageGetMemoizedSize(&memoizedSerializedSize);
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
+  size_ = 0;
+  size_ += self.unknownFields.serializedSize;
+  PBGeneratedMessageSetMemoizedSize(&memoizedSerializedSize, size_);
+  return size_;
 }
 + (CustomOptionFooResponse*) parseFromData:(NSData*) data {
   return (CustomOptionFooResponse*)[[[CustomOptionFooResponse builder] mergeFromData:data] build];
@@ -1073,7 +1260,7 @@ static CustomOptionFooResponse* defaultCustomOptionFooResponseInstance = nil;
   return [[[CustomOptionFooResponse_Builder alloc] init] autorelease];
 }
 + (CustomOptionFooResponse_Builder*) builderWithPrototype:(CustomOptionFooResponse*) prototype {
-  return [[CustomOptionFooResponse builder] mergeFrom:prototype];
+  return [[[CustomOptionFooResponse_Builder alloc] initWithPrototype:prototype] autorelease];
 }
 - (CustomOptionFooResponse_Builder*) builder {
   return [CustomOptionFooResponse builder];
@@ -1096,37 +1283,91 @@ static CustomOptionFooResponse* defaultCustomOptionFooResponseInstance = nil;
       (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
 }
 - (NSUInteger) hash {
-  NSUInteger hashCode = 7;
-  hashCode = hashCode * 31 + [self.unknownFields hash];
-  return hashCode;
-}
-@end
+  NSUInteger hash_ = PBGeneratedMessageGetMemoizedHash(&memoizedHash);
+  if (hash_ != 0) {
+    return hash_;
+  }
 
-@interface CustomOptionFooResponse_Builder()
-@property (retain) CustomOptionFooResponse* result;
+  uint64_t hashCode = 7;
+  hashCode = PBGeneratedMessageHashMix(hashCode, [self.unknownFields hash]);
+  hash_ = PBGeneratedMessageHashFinish(hashCode);
+  PBGeneratedMessageSetMemoizedHash(&memoizedHash, hash_);
+  return hash_;
+}
 @end
 
 @implementation CustomOptionFooResponse_Builder
 @synthesize result;
 - (void) dealloc {
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
   self.result = nil;
+  [prototype_ release];
   [super dealloc];
 }
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[[CustomOptionFooResponse alloc] init] autorelease];
+    result = [CustomOptionFooResponse recycledInstance];
   }
   return self;
 }
+- (id) initWithPrototype:(CustomOptionFooResponse*) prototype {
+  if ((self = [super init])) {
+    self.result = prototype;
+    prototype_ = [prototype retain];
+  }
+  return self;
+}
+- (void) detachFromPrototype {
+  CustomOptionFooResponse* prototype = prototype_;
+  prototype_ = nil;
+  self.result = [[[CustomOptionFooResponse alloc] init] autorelease];
+  [self mergeFrom:prototype];
+  [prototype release];
+}
+- (PBGeneratedMessage*) internalGetMutableResult {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return [self internalGetResult];
+}
 - (PBGeneratedMessage*) internalGetResult {
   return result;
 }
 - (CustomOptionFooResponse_Builder*) clear {
-  self.result = [[[CustomOptionFooResponse alloc] init] autorelease];
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = [[CustomOptionFooResponse recycledInstance] autorelease];
   return self;
 }
 - (CustomOptionFooResponse_Builder*) clone {
-  return [CustomOptionFooResponse builderWithPrototype:result];
+  if (prototype_ != nil) {
+    return [[[CustomOptionFooResponse_Builder alloc] initWithPrototype:prototype_] autorelease];
+  }
+  return [[CustomOptionFooResponse builder] mergeFrom:result];
+}
+- (CustomOptionFooResponse_Builder*) reset {
+  if (result == nil || prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    self.result = [[CustomOptionFooResponse recycledInstance] autorelease];
+  } else {
+    [result clearForReuse];
+  }
+  return self;
+}
+- (CustomOptionFooResponse_Builder*) recycle:(CustomOptionFooResponse*) message {
+  if (message == [CustomOptionFooResponse defaultInstance]) {
+    @throw [NSException exceptionWithName:@"IllegalArgument" reason:@"Cannot recycle the default instance" userInfo:nil];
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = message;
+  return [self reset];
 }
 - (CustomOptionFooResponse*) defaultInstance {
   return [CustomOptionFooResponse defaultInstance];
@@ -1136,14 +1377,27 @@ static CustomOptionFooResponse* defaultCustomOptionFooResponseInstance = nil;
   return [self buildPartial];
 }
 - (CustomOptionFooResponse*) buildPartial {
-  CustomOptionFooResponse* returnMe = [[result retain] autorelease];
-  self.result = nil;
+  return [[self newBuildPartial] autorelease];
+}
+- (CustomOptionFooResponse*) newBuildPartial {
+  if (prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    CustomOptionFooResponse* returnMe = result;
+    result = nil;
+    return returnMe;
+  }
+  CustomOptionFooResponse* returnMe = result;
+  result = nil;
   return returnMe;
 }
 - (CustomOptionFooResponse_Builder*) mergeFrom:(CustomOptionFooResponse*) other {
   if (other == [CustomOptionFooResponse defaultInstance]) {
     return self;
   }
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
   [self mergeUnknownFields:other.unknownFields];
   return self;
 }
@@ -1151,18 +1405,29 @@ static CustomOptionFooResponse* defaultCustomOptionFooResponseInstance = nil;
   return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
 }
 - (CustomOptionFooResponse_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  PBUnknownFieldSet_Builder* unknownFields = nil;
   while (YES) {
     int32_t tag = [input readTag];
     switch (tag) {
       case 0:
-        [self setUnknownFields:[unknownFields build]];
+        if (unknownFields != nil) {
+          [self setUnknownFields:[unknownFields build]];
+        }
         return self;
       default: {
-        if (![self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag]) {
-          [self setUnknownFields:[unknownFields build]];
+        if (PBWireFormatGetTagWireType(tag) == PBWireFormatEndGroup) {
+          if (unknownFields != nil) {
+            [self setUnknownFields:[unknownFields build]];
+          }
           return self;
         }
+        if (unknownFields == nil) {
+          unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+        }
+        [self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag];
         break;
       }
     }
@@ -1173,27 +1438,31 @@ static CustomOptionFooResponse* defaultCustomOptionFooResponseInstance = nil;
 @interface DummyMessageContainingEnum ()
 @end
 
+@interface DummyMessageContainingEnum_Builder()
+@property (nonatomic, retain) DummyMessageContainingEnum* result;
+- (id) initWithPrototype:(DummyMessageContainingEnum*) prototype;
+- (void) detachFromPrototype;
+@end
+
 @implementation DummyMessageContainingEnum
 
 - (void) dealloc {
   [super dealloc];
 }
-- (id) init {
-  if ((self = [super init])) {
-  }
-  return self;
+- (void) clearForReuse {
+  [super clearForReuse];
+  memset(hasBits_, 0, sizeof(hasBits_));
 }
 static DummyMessageContainingEnum* defaultDummyMessageContainingEnumInstance = nil;
-+ (void) initialize {
-  if (self == [DummyMessageContainingEnum class]) {
-    defaultDummyMessageContainingEnumInstance = [[DummyMessageContainingEnum alloc] init];
-  }
-}
 + (DummyMessageContainingEnum*) defaultInstance {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultDummyMessageContainingEnumInstance = [[DummyMessageContainingEnum alloc] init];
+  });
   return defaultDummyMessageContainingEnumInstance;
 }
 - (DummyMessageContainingEnum*) defaultInstance {
-  return defaultDummyMessageContainingEnumInstance;
+  return [DummyMessageContainingEnum defaultInstance];
 }
 - (BOOL) isInitialized {
   return YES;
@@ -1202,15 +1471,15 @@ static DummyMessageContainingEnum* defaultDummyMessageContainingEnumInstance = n
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = PBGeneratedMessageGetMemoizedSize(&memoizedSerializedSize);
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
+  size_ = 0;
+  size_ += self.unknownFields.serializedSize;
+  PBGeneratedMessageSetMemoizedSize(&memoizedSerializedSize, size_);
+  return size_;
 }
 + (DummyMessageContainingEnum*) parseFromData:(NSData*) data {
   return (DummyMessageContainingEnum*)[[[DummyMessageContainingEnum builder] mergeFromData:data] build];
@@ -1234,7 +1503,7 @@ static DummyMessageContainingEnum* defaultDummyMessageContainingEnumInstance = n
   return [[[DummyMessageContainingEnum_Builder alloc] init] autorelease];
 }
 + (DummyMessageContainingEnum_Builder*) builderWithPrototype:(DummyMessageContainingEnum*) prototype {
-  return [[DummyMessageContainingEnum builder] mergeFrom:prototype];
+  return [[[DummyMessageContainingEnum_Builder alloc] initWithPrototype:prototype] autorelease];
 }
 - (DummyMessageContainingEnum_Builder*) builder {
   return [DummyMessageContainingEnum builder];
@@ -1257,9 +1526,16 @@ static DummyMessageContainingEnum* defaultDummyMessageContainingEnumInstance = n
       (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
 }
 - (NSUInteger) hash {
-  NSUInteger hashCode = 7;
-  hashCode = hashCode * 31 + [self.unknownFields hash];
-  return hashCode;
+  NSUInteger hash_ = PBGeneratedMessageGetMemoizedHash(&memoizedHash);
+  if (hash_ != 0) {
+    return hash_;
+  }
+
+  uint64_t hashCode = 7;
+  hashCode = PBGeneratedMessageHashMix(hashCode, [self.unknownFields hash]);
+  hash_ = PBGeneratedMessageHashFinish(hashCode);
+  PBGeneratedMessageSetMemoizedHash(&memoizedHash, hash_);
+  return hash_;
 }
 @end
 
@@ -1272,31 +1548,78 @@ BOOL DummyMessageContainingEnum_TestEnumTypeIsValidValue(DummyMessageContainingE
       return NO;
   }
 }
-@interface DummyMessageContainingEnum_Builder()
-@property (retain) DummyMessageContainingEnum* result;
-@end
-
 @implementation DummyMessageContainingEnum_Builder
 @synthesize result;
 - (void) dealloc {
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
   self.result = nil;
+  [prototype_ release];
   [super dealloc];
 }
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[[DummyMessageContainingEnum alloc] init] autorelease];
+    result = [DummyMessageContainingEnum recycledInstance];
+  }
+  return self;
+}
+- (id) initWithPrototype:(DummyMessageContainingEnum*) prototype {
+  if ((self = [super init])) {
+    self.result = prototype;
+    prototype_ = [prototype retain];
   }
   return self;
 }
+- (void) detachFromPrototype {
+  DummyMessageContainingEnum* prototype = prototype_;
+  prototype_ = nil;
+  self.result = [[[DummyMessageContainingEnum alloc] init] autorelease];
+  [self mergeFrom:prototype];
+  [prototype release];
+}
+- (PBGeneratedMessage*) internalGetMutableResult {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return [self internalGetResult];
+}
 - (PBGeneratedMessage*) internalGetResult {
   return result;
 }
 - (DummyMessageContainingEnum_Builder*) clear {
-  self.result = [[[DummyMessageContainingEnum alloc] init] autorelease];
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = [[DummyMessageContainingEnum recycledInstance] autorelease];
   return self;
 }
 - (DummyMessageContainingEnum_Builder*) clone {
-  return [DummyMessageContainingEnum builderWithPrototype:result];
+  if (prototype_ != nil) {
+    return [[[DummyMessageContainingEnum_Builder alloc] initWithPrototype:prototype_] autorelease];
+  }
+  return [[DummyMessageContainingEnum builder] mergeFrom:result];
+}
+- (DummyMessageContainingEnum_Builder*) reset {
+  if (result == nil || prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    self.result = [[DummyMessageContainingEnum recycledInstance] autorelease];
+  } else {
+    [result clearForReuse];
+  }
+  return self;
+}
+- (DummyMessageContainingEnum_Builder*) recycle:(DummyMessageContainingEnum*) message {
+  if (message == [DummyMessageContainingEnum defaultInstance]) {
+    @throw [NSException exceptionWithName:@"IllegalArgument" reason:@"Cannot recycle the default instance" userInfo:nil];
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = message;
+  return [self reset];
 }
 - (DummyMessageContainingEnum*) defaultInstance {
   return [DummyMessageContainingEnum defaultInstance];
@@ -1306,14 +1629,27 @@ BOOL DummyMessageContainingEnum_TestEnumTypeIsValidValue(DummyMessageContainingE
   return [self buildPartial];
 }
 - (DummyMessageContainingEnum*) buildPartial {
-  DummyMessageContainingEnum* returnMe = [[result retain] autorelease];
-  self.result = nil;
+  return [[self newBuildPartial] autorelease];
+}
+- (DummyMessageContainingEnum*) newBuildPartial {
+  if (prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    DummyMessageContainingEnum* returnMe = result;
+    result = nil;
+    return returnMe;
+  }
+  DummyMessageContainingEnum* returnMe = result;
+  result = nil;
   return returnMe;
 }
 - (DummyMessageContainingEnum_Builder*) mergeFrom:(DummyMessageContainingEnum*) other {
   if (other == [DummyMessageContainingEnum defaultInstance]) {
     return self;
   }
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
   [self mergeUnknownFields:other.unknownFields];
   return self;
 }
@@ -1321,18 +1657,29 @@ BOOL DummyMessageContainingEnum_TestEnumTypeIsValidValue(DummyMessageContainingE
   return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
 }
 - (DummyMessageContainingEnum_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  PBUnknownFieldSet_Builder* unknownFields = nil;
   while (YES) {
     int32_t tag = [input readTag];
     switch (tag) {
       case 0:
-        [self setUnknownFields:[unknownFields build]];
+        if (unknownFields != nil) {
+          [self setUnknownFields:[unknownFields build]];
+        }
         return self;
       default: {
-        if (![self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag]) {
-          [self setUnknownFields:[unknownFields build]];
+        if (PBWireFormatGetTagWireType(tag) == PBWireFormatEndGroup) {
+          if (unknownFields != nil) {
+            [self setUnknownFields:[unknownFields build]];
+          }
           return self;
         }
+        if (unknownFields == nil) {
+          unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+        }
+        [self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag];
         break;
       }
     }
@@ -1343,27 +1690,31 @@ BOOL DummyMessageContainingEnum_TestEnumTypeIsValidValue(DummyMessageContainingE
 @interface DummyMessageInvalidAsOptionType ()
 @end
 
+@interface DummyMessageInvalidAsOptionType_Builder()
+@property (nonatomic, retain) DummyMessageInvalidAsOptionType* result;
+- (id) initWithPrototype:(DummyMessageInvalidAsOptionType*) prototype;
+- (void) detachFromPrototype;
+@end
+
 @implementation DummyMessageInvalidAsOptionType
 
 - (void) dealloc {
   [super dealloc];
 }
-- (id) init {
-  if ((self = [super init])) {
-  }
-  return self;
+- (void) clearForReuse {
+  [super clearForReuse];
+  memset(hasBits_, 0, sizeof(hasBits_));
 }
 static DummyMessageInvalidAsOptionType* defaultDummyMessageInvalidAsOptionTypeInstance = nil;
-+ (void) initialize {
-  if (self == [DummyMessageInvalidAsOptionType class]) {
-    defaultDummyMessageInvalidAsOptionTypeInstance = [[DummyMessageInvalidAsOptionType alloc] init];
-  }
-}
 + (DummyMessageInvalidAsOptionType*) defaultInstance {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultDummyMessageInvalidAsOptionTypeInstance = [[DummyMessageInvalidAsOptionType alloc] init];
+  });
   return defaultDummyMessageInvalidAsOptionTypeInstance;
 }
 - (DummyMessageInvalidAsOptionType*) defaultInstance {
-  return defaultDummyMessageInvalidAsOptionTypeInstance;
+  return [DummyMessageInvalidAsOptionType defaultInstance];
 }
 - (BOOL) isInitialized {
   return YES;
@@ -1372,15 +1723,15 @@ static DummyMessageInvalidAsOptionType* defaultDummyMessageInvalidAsOptionTypeIn
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = PBGeneratedMessageGetMemoizedSize(&memoizedSerializedSize);
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
+  size_ = 0;
+  size_ += self.unknownFields.serializedSize;
+  PBGeneratedMessageSetMemoizedSize(&memoizedSerializedSize, size_);
+  return size_;
 }
 + (DummyMessageInvalidAsOptionType*) parseFromData:(NSData*) data {
   return (DummyMessageInvalidAsOptionType*)[[[DummyMessageInvalidAsOptionType builder] mergeFromData:data] build];
@@ -1404,7 +1755,7 @@ static DummyMessageInvalidAsOptionType* defaultDummyMessageInvalidAsOptionTypeIn
   return [[[DummyMessageInvalidAsOptionType_Builder alloc] init] autorelease];
 }
 + (DummyMessageInvalidAsOptionType_Builder*) builderWithPrototype:(DummyMessageInvalidAsOptionType*) prototype {
-  return [[DummyMessageInvalidAsOptionType builder] mergeFrom:prototype];
+  return [[[DummyMessageInvalidAsOptionType_Builder alloc] initWithPrototype:prototype] autorelease];
 }
 - (DummyMessageInvalidAsOptionType_Builder*) builder {
   return [DummyMessageInvalidAsOptionType builder];
@@ -1427,37 +1778,91 @@ static DummyMessageInvalidAsOptionType* defaultDummyMessageInvalidAsOptionTypeIn
       (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
 }
 - (NSUInteger) hash {
-  NSUInteger hashCode = 7;
-  hashCode = hashCode * 31 + [self.unknownFields hash];
-  return hashCode;
-}
-@end
+  NSUInteger hash_ = PBGeneratedMessageGetMemoizedHash(&memoizedHash);
+  if (hash_ != 0) {
+    return hash_;
+  }
 
-@interface DummyMessageInvalidAsOptionType_Builder()
-@property (retain) DummyMessageInvalidAsOptionType* result;
+  uint64_t hashCode = 7;
+  hashCode = PBGeneratedMessageHashMix(hashCode, [self.unknownFields hash]);
+  hash_ = PBGeneratedMessageHashFinish(hashCode);
+  PBGeneratedMessageSetMemoizedHash(&memoizedHash, hash_);
+  return hash_;
+}
 @end
 
 @implementation DummyMessageInvalidAsOptionType_Builder
 @synthesize result;
 - (void) dealloc {
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
   self.result = nil;
+  [prototype_ release];
   [super dealloc];
 }
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[[DummyMessageInvalidAsOptionType alloc] init] autorelease];
+    result = [DummyMessageInvalidAsOptionType recycledInstance];
   }
   return self;
 }
+- (id) initWithPrototype:(DummyMessageInvalidAsOptionType*) prototype {
+  if ((self = [super init])) {
+    self.result = prototype;
+    prototype_ = [prototype retain];
+  }
+  return self;
+}
+- (void) detachFromPrototype {
+  DummyMessageInvalidAsOptionType* prototype = prototype_;
+  prototype_ = nil;
+  self.result = [[[DummyMessageInvalidAsOptionType alloc] init] autorelease];
+  [self mergeFrom:prototype];
+  [prototype release];
+}
+- (PBGeneratedMessage*) internalGetMutableResult {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return [self internalGetResult];
+}
 - (PBGeneratedMessage*) internalGetResult {
   return result;
 }
 - (DummyMessageInvalidAsOptionType_Builder*) clear {
-  self.result = [[[DummyMessageInvalidAsOptionType alloc] init] autorelease];
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = [[DummyMessageInvalidAsOptionType recycledInstance] autorelease];
   return self;
 }
 - (DummyMessageInvalidAsOptionType_Builder*) clone {
-  return [DummyMessageInvalidAsOptionType builderWithPrototype:result];
+  if (prototype_ != nil) {
+    return [[[DummyMessageInvalidAsOptionType_Builder alloc] initWithPrototype:prototype_] autorelease];
+  }
+  return [[DummyMessageInvalidAsOptionType builder] mergeFrom:result];
+}
+- (DummyMessageInvalidAsOptionType_Builder*) reset {
+  if (result == nil || prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    self.result = [[DummyMessageInvalidAsOptionType recycledInstance] autorelease];
+  } else {
+    [result clearForReuse];
+  }
+  return self;
+}
+- (DummyMessageInvalidAsOptionType_Builder*) recycle:(DummyMessageInvalidAsOptionType*) message {
+  if (message == [DummyMessageInvalidAsOptionType defaultInstance]) {
+    @throw [NSException exceptionWithName:@"IllegalArgument" reason:@"Cannot recycle the default instance" userInfo:nil];
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = message;
+  return [self reset];
 }
 - (DummyMessageInvalidAsOptionType*) defaultInstance {
   return [DummyMessageInvalidAsOptionType defaultInstance];
@@ -1467,14 +1872,27 @@ static DummyMessageInvalidAsOptionType* defaultDummyMessageInvalidAsOptionTypeIn
   return [self buildPartial];
 }
 - (DummyMessageInvalidAsOptionType*) buildPartial {
-  DummyMessageInvalidAsOptionType* returnMe = [[result retain] autorelease];
-  self.result = nil;
+  return [[self newBuildPartial] autorelease];
+}
+- (DummyMessageInvalidAsOptionType*) newBuildPartial {
+  if (prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    DummyMessageInvalidAsOptionType* returnMe = result;
+    result = nil;
+    return returnMe;
+  }
+  DummyMessageInvalidAsOptionType* returnMe = result;
+  result = nil;
   return returnMe;
 }
 - (DummyMessageInvalidAsOptionType_Builder*) mergeFrom:(DummyMessageInvalidAsOptionType*) other {
   if (other == [DummyMessageInvalidAsOptionType defaultInstance]) {
     return self;
   }
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
   [self mergeUnknownFields:other.unknownFields];
   return self;
 }
@@ -1482,18 +1900,29 @@ static DummyMessageInvalidAsOptionType* defaultDummyMessageInvalidAsOptionTypeIn
   return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
 }
 - (DummyMessageInvalidAsOptionType_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  PBUnknownFieldSet_Builder* unknownFields = nil;
   while (YES) {
     int32_t tag = [input readTag];
     switch (tag) {
       case 0:
-        [self setUnknownFields:[unknownFields build]];
+        if (unknownFields != nil) {
+          [self setUnknownFields:[unknownFields build]];
+        }
         return self;
       default: {
-        if (![self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag]) {
-          [self setUnknownFields:[unknownFields build]];
+        if (PBWireFormatGetTagWireType(tag) == PBWireFormatEndGroup) {
+          if (unknownFields != nil) {
+            [self setUnknownFields:[unknownFields build]];
+          }
           return self;
         }
+        if (unknownFields == nil) {
+          unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+        }
+        [self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag];
         break;
       }
     }
@@ -1504,27 +1933,31 @@ static DummyMessageInvalidAsOptionType* defaultDummyMessageInvalidAsOptionTypeIn
 @interface CustomOptionMinIntegerValues ()
 @end
 
+@interface CustomOptionMinIntegerValues_Builder()
+@property (nonatomic, retain) CustomOptionMinIntegerValues* result;
+- (id) initWithPrototype:(CustomOptionMinIntegerValues*) prototype;
+- (void) detachFromPrototype;
+@end
+
 @implementation CustomOptionMinIntegerValues
 
 - (void) dealloc {
   [super dealloc];
 }
-- (id) init {
-  if ((self = [super init])) {
-  }
-  return self;
+- (void) clearForReuse {
+  [super clearForReuse];
+  memset(hasBits_, 0, sizeof(hasBits_));
 }
 static CustomOptionMinIntegerValues* defaultCustomOptionMinIntegerValuesInstance = nil;
-+ (void) initialize {
-  if (self == [CustomOptionMinIntegerValues class]) {
-    defaultCustomOptionMinIntegerValuesInstance = [[CustomOptionMinIntegerValues alloc] init];
-  }
-}
 + (CustomOptionMinIntegerValues*) defaultInstance {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultCustomOptionMinIntegerValuesInstance = [[CustomOptionMinIntegerValues alloc] init];
+  });
   return defaultCustomOptionMinIntegerValuesInstance;
 }
 - (CustomOptionMinIntegerValues*) defaultInstance {
-  return defaultCustomOptionMinIntegerValuesInstance;
+  return [CustomOptionMinIntegerValues defaultInstance];
 }
 - (BOOL) isInitialized {
   return YES;
@@ -1533,15 +1966,15 @@ static CustomOptionMinIntegerValues* defaultCustomOptionMinIntegerValuesInstance
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = PBGeneratedMessageGetMemoizedSize(&memoizedSerializedSize);
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
+  size_ = 0;
+  size_ += self.unknownFields.serializedSize;
+  PBGeneratedMessageSetMemoizedSize(&memoizedSerializedSize, size_);
+  return size_;
 }
 + (CustomOptionMinIntegerValues*) parseFromData:(NSData*) data {
   return (CustomOptionMinIntegerValues*)[[[CustomOptionMinIntegerValues builder] mergeFromData:data] build];
@@ -1565,7 +1998,7 @@ static CustomOptionMinIntegerValues* defaultCustomOptionMinIntegerValuesInstance
   return [[[CustomOptionMinIntegerValues_Builder alloc] init] autorelease];
 }
 + (CustomOptionMinIntegerValues_Builder*) builderWithPrototype:(CustomOptionMinIntegerValues*) prototype {
-  return [[CustomOptionMinIntegerValues builder] mergeFrom:prototype];
+  return [[[CustomOptionMinIntegerValues_Builder alloc] initWithPrototype:prototype] autorelease];
 }
 - (CustomOptionMinIntegerValues_Builder*) builder {
   return [CustomOptionMinIntegerValues builder];
@@ -1588,37 +2021,91 @@ static CustomOptionMinIntegerValues* defaultCustomOptionMinIntegerValuesInstance
       (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
 }
 - (NSUInteger) hash {
-  NSUInteger hashCode = 7;
-  hashCode = hashCode * 31 + [self.unknownFields hash];
-  return hashCode;
-}
-@end
+  NSUInteger hash_ = PBGeneratedMessageGetMemoizedHash(&memoizedHash);
+  if (hash_ != 0) {
+    return hash_;
+  }
 
-@interface CustomOptionMinIntegerValues_Builder()
-@property (retain) CustomOptionMinIntegerValues* result;
+  uint64_t hashCode = 7;
+  hashCode = PBGeneratedMessageHashMix(hashCode, [self.unknownFields hash]);
+  hash_ = PBGeneratedMessageHashFinish(hashCode);
+  PBGeneratedMessageSetMemoizedHash(&memoizedHash, hash_);
+  return hash_;
+}
 @end
 
 @implementation CustomOptionMinIntegerValues_Builder
 @synthesize result;
 - (void) dealloc {
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
   self.result = nil;
+  [prototype_ release];
   [super dealloc];
 }
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[[CustomOptionMinIntegerValues alloc] init] autorelease];
+    result = [CustomOptionMinIntegerValues recycledInstance];
   }
   return self;
 }
-- (PBGeneratedMessage*) internalGetResult {
-  return result;
-}
-- (CustomOptionMinIntegerValues_Builder*) clear {
+- (id) initWithPrototype:(CustomOptionMinIntegerValues*) prototype {
+  if ((self = [super init])) {
+    self.result = prototype;
+    prototype_ = [prototype retain];
+  }
+  return self;
+}
+- (void) detachFromPrototype {
+  CustomOptionMinIntegerValues* prototype = prototype_;
+  prototype_ = nil;
   self.result = [[[CustomOptionMinIntegerValues alloc] init] autorelease];
+  [self mergeFrom:prototype];
+  [prototype release];
+}
+- (PBGeneratedMessage*) internalGetMutableResult {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return [self internalGetResult];
+}
+- (PBGeneratedMessage*) internalGetResult {
+  return result;
+}
+- (CustomOptionMinIntegerValues_Builder*) clear {
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = [[CustomOptionMinIntegerValues recycledInstance] autorelease];
   return self;
 }
 - (CustomOptionMinIntegerValues_Builder*) clone {
-  return [CustomOptionMinIntegerValues builderWithPrototype:result];
+  if (prototype_ != nil) {
+    return [[[CustomOptionMinIntegerValues_Builder alloc] initWithPrototype:prototype_] autorelease];
+  }
+  return [[CustomOptionMinIntegerValues builder] mergeFrom:result];
+}
+- (CustomOptionMinIntegerValues_Builder*) reset {
+  if (result == nil || prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    self.result = [[CustomOptionMinIntegerValues recycledInstance] autorelease];
+  } else {
+    [result clearForReuse];
+  }
+  return self;
+}
+- (CustomOptionMinIntegerValues_Builder*) recycle:(CustomOptionMinIntegerValues*) message {
+  if (message == [CustomOptionMinIntegerValues defaultInstance]) {
+    @throw [NSException exceptionWithName:@"IllegalArgument" reason:@"Cannot recycle the default instance" userInfo:nil];
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = message;
+  return [self reset];
 }
 - (CustomOptionMinIntegerValues*) defaultInstance {
   return [CustomOptionMinIntegerValues defaultInstance];
@@ -1628,14 +2115,27 @@ static CustomOptionMinIntegerValues* defaultCustomOptionMinIntegerValuesInstance
   return [self buildPartial];
 }
 - (CustomOptionMinIntegerValues*) buildPartial {
-  CustomOptionMinIntegerValues* returnMe = [[result retain] autorelease];
-  self.result = nil;
+  return [[self newBuildPartial] autorelease];
+}
+- (CustomOptionMinIntegerValues*) newBuildPartial {
+  if (prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    CustomOptionMinIntegerValues* returnMe = result;
+    result = nil;
+    return returnMe;
+  }
+  CustomOptionMinIntegerValues* returnMe = result;
+  result = nil;
   return returnMe;
 }
 - (CustomOptionMinIntegerValues_Builder*) mergeFrom:(CustomOptionMinIntegerValues*) other {
   if (other == [CustomOptionMinIntegerValues defaultInstance]) {
     return self;
   }
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
   [self mergeUnknownFields:other.unknownFields];
   return self;
 }
@@ -1643,18 +2143,29 @@ static CustomOptionMinIntegerValues* defaultCustomOptionMinIntegerValuesInstance
   return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
 }
 - (CustomOptionMinIntegerValues_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  PBUnknownFieldSet_Builder* unknownFields = nil;
   while (YES) {
     int32_t tag = [input readTag];
     switch (tag) {
       case 0:
-        [self setUnknownFields:[unknownFields build]];
+        if (unknownFields != nil) {
+          [self setUnknownFields:[unknownFields build]];
+        }
         return self;
       default: {
-        if (![self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag]) {
-          [self setUnknownFields:[unknownFields build]];
+        if (PBWireFormatGetTagWireType(tag) == PBWireFormatEndGroup) {
+          if (unknownFields != nil) {
+            [self setUnknownFields:[unknownFields build]];
+          }
           return self;
         }
+        if (unknownFields == nil) {
+          unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+        }
+        [self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag];
         break;
       }
     }
@@ -1665,27 +2176,31 @@ static CustomOptionMinIntegerValues* defaultCustomOptionMinIntegerValuesInstance
 @interface CustomOptionMaxIntegerValues ()
 @end
 
+@interface CustomOptionMaxIntegerValues_Builder()
+@property (nonatomic, retain) CustomOptionMaxIntegerValues* result;
+- (id) initWithPrototype:(CustomOptionMaxIntegerValues*) prototype;
+- (void) detachFromPrototype;
+@end
+
 @implementation CustomOptionMaxIntegerValues
 
 - (void) dealloc {
   [super dealloc];
 }
-- (id) init {
-  if ((self = [super init])) {
-  }
-  return self;
+- (void) clearForReuse {
+  [super clearForReuse];
+  memset(hasBits_, 0, sizeof(hasBits_));
 }
 static CustomOptionMaxIntegerValues* defaultCustomOptionMaxIntegerValuesInstance = nil;
-+ (void) initialize {
-  if (self == [CustomOptionMaxIntegerValues class]) {
-    defaultCustomOptionMaxIntegerValuesInstance = [[CustomOptionMaxIntegerValues alloc] init];
-  }
-}
 + (CustomOptionMaxIntegerValues*) defaultInstance {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultCustomOptionMaxIntegerValuesInstance = [[CustomOptionMaxIntegerValues alloc] init];
+  });
   return defaultCustomOptionMaxIntegerValuesInstance;
 }
 - (CustomOptionMaxIntegerValues*) defaultInstance {
-  return defaultCustomOptionMaxIntegerValuesInstance;
+  return [CustomOptionMaxIntegerValues defaultInstance];
 }
 - (BOOL) isInitialized {
   return YES;
@@ -1694,15 +2209,15 @@ static CustomOptionMaxIntegerValues* defaultCustomOptionMaxIntegerValuesInstance
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = PBGeneratedMessageGetMemoizedSize(&memoizedSerializedSize);
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
+  size_ = 0;
+  size_ += self.unknownFields.serializedSize;
+  PBGeneratedMessageSetMemoizedSize(&memoizedSerializedSize, size_);
+  return size_;
 }
 + (CustomOptionMaxIntegerValues*) parseFromData:(NSData*) data {
   return (CustomOptionMaxIntegerValues*)[[[CustomOptionMaxIntegerValues builder] mergeFromData:data] build];
@@ -1726,7 +2241,7 @@ static CustomOptionMaxIntegerValues* defaultCustomOptionMaxIntegerValuesInstance
   return [[[CustomOptionMaxIntegerValues_Builder alloc] init] autorelease];
 }
 + (CustomOptionMaxIntegerValues_Builder*) builderWithPrototype:(CustomOptionMaxIntegerValues*) prototype {
-  return [[CustomOptionMaxIntegerValues builder] mergeFrom:prototype];
+  return [[[CustomOptionMaxIntegerValues_Builder alloc] initWithPrototype:prototype] autorelease];
 }
 - (CustomOptionMaxIntegerValues_Builder*) builder {
   return [CustomOptionMaxIntegerValues builder];
@@ -1749,37 +2264,91 @@ static CustomOptionMaxIntegerValues* defaultCustomOptionMaxIntegerValuesInstance
       (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
 }
 - (NSUInteger) hash {
-  NSUInteger hashCode = 7;
-  hashCode = hashCode * 31 + [self.unknownFields hash];
-  return hashCode;
-}
-@end
+  NSUInteger hash_ = PBGeneratedMessageGetMemoizedHash(&memoizedHash);
+  if (hash_ != 0) {
+    return hash_;
+  }
 
-@interface CustomOptionMaxIntegerValues_Builder()
-@property (retain) CustomOptionMaxIntegerValues* result;
+  uint64_t hashCode = 7;
+  hashCode = PBGeneratedMessageHashMix(hashCode, [self.unknownFields hash]);
+  hash_ = PBGeneratedMessageHashFinish(hashCode);
+  PBGeneratedMessageSetMemoizedHash(&memoizedHash, hash_);
+  return hash_;
+}
 @end
 
 @implementation CustomOptionMaxIntegerValues_Builder
 @synthesize result;
 - (void) dealloc {
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
   self.result = nil;
+  [prototype_ release];
   [super dealloc];
 }
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[[CustomOptionMaxIntegerValues alloc] init] autorelease];
+    result = [CustomOptionMaxIntegerValues recycledInstance];
   }
   return self;
 }
+- (id) initWithPrototype:(CustomOptionMaxIntegerValues*) prototype {
+  if ((self = [super init])) {
+    self.result = prototype;
+    prototype_ = [prototype retain];
+  }
+  return self;
+}
+- (void) detachFromPrototype {
+  CustomOptionMaxIntegerValues* prototype = prototype_;
+  prototype_ = nil;
+  self.result = [[[CustomOptionMaxIntegerValues alloc] init] autorelease];
+  [self mergeFrom:prototype];
+  [prototype release];
+}
+- (PBGeneratedMessage*) internalGetMutableResult {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return [self internalGetResult];
+}
 - (PBGeneratedMessage*) internalGetResult {
   return result;
 }
 - (CustomOptionMaxIntegerValues_Builder*) clear {
-  self.result = [[[CustomOptionMaxIntegerValues alloc] init] autorelease];
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = [[CustomOptionMaxIntegerValues recycledInstance] autorelease];
   return self;
 }
 - (CustomOptionMaxIntegerValues_Builder*) clone {
-  return [CustomOptionMaxIntegerValues builderWithPrototype:result];
+  if (prototype_ != nil) {
+    return [[[CustomOptionMaxIntegerValues_Builder alloc] initWithPrototype:prototype_] autorelease];
+  }
+  return [[CustomOptionMaxIntegerValues builder] mergeFrom:result];
+}
+- (CustomOptionMaxIntegerValues_Builder*) reset {
+  if (result == nil || prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    self.result = [[CustomOptionMaxIntegerValues recycledInstance] autorelease];
+  } else {
+    [result clearForReuse];
+  }
+  return self;
+}
+- (CustomOptionMaxIntegerValues_Builder*) recycle:(CustomOptionMaxIntegerValues*) message {
+  if (message == [CustomOptionMaxIntegerValues defaultInstance]) {
+    @throw [NSException exceptionWithName:@"IllegalArgument" reason:@"Cannot recycle the default instance" userInfo:nil];
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = message;
+  return [self reset];
 }
 - (CustomOptionMaxIntegerValues*) defaultInstance {
   return [CustomOptionMaxIntegerValues defaultInstance];
@@ -1789,14 +2358,27 @@ static CustomOptionMaxIntegerValues* defaultCustomOptionMaxIntegerValuesInstance
   return [self buildPartial];
 }
 - (CustomOptionMaxIntegerValues*) buildPartial {
-  CustomOptionMaxIntegerValues* returnMe = [[result retain] autorelease];
-  self.result = nil;
+  return [[self newBuildPartial] autorelease];
+}
+- (CustomOptionMaxIntegerValues*) newBuildPartial {
+  if (prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    CustomOptionMaxIntegerValues* returnMe = result;
+    result = nil;
+    return returnMe;
+  }
+  CustomOptionMaxIntegerValues* returnMe = result;
+  result = nil;
   return returnMe;
 }
 - (CustomOptionMaxIntegerValues_Builder*) mergeFrom:(CustomOptionMaxIntegerValues*) other {
   if (other == [CustomOptionMaxIntegerValues defaultInstance]) {
     return self;
   }
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
   [self mergeUnknownFields:other.unknownFields];
   return self;
 }
@@ -1804,18 +2386,29 @@ static CustomOptionMaxIntegerValues* defaultCustomOptionMaxIntegerValuesInstance
   return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
 }
 - (CustomOptionMaxIntegerValues_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  PBUnknownFieldSet_Builder* unknownFields = nil;
   while (YES) {
     int32_t tag = [input readTag];
     switch (tag) {
       case 0:
-        [self setUnknownFields:[unknownFields build]];
+        if (unknownFields != nil) {
+          [self setUnknownFields:[unknownFields build]];
+        }
         return self;
       default: {
-        if (![self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag]) {
-          [self setUnknownFields:[unknownFields build]];
+        if (PBWireFormatGetTagWireType(tag) == PBWireFormatEndGroup) {
+          if (unknownFields != nil) {
+            [self setUnknownFields:[unknownFields build]];
+          }
           return self;
         }
+        if (unknownFields == nil) {
+          unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+        }
+        [self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag];
         break;
       }
     }
@@ -1826,27 +2419,31 @@ static CustomOptionMaxIntegerValues* defaultCustomOptionMaxIntegerValuesInstance
 @interface CustomOptionOtherValues ()
 @end
 
+@interface CustomOptionOtherValues_Builder()
+@property (nonatomic, retain) CustomOptionOtherValues* result;
+- (id) initWithPrototype:(CustomOptionOtherValues*) prototype;
+- (void) detachFromPrototype;
+@end
+
 @implementation CustomOptionOtherValues
 
 - (void) dealloc {
   [super dealloc];
 }
-- (id) init {
-  if ((self = [super init])) {
-  }
-  return self;
+- (void) clearForReuse {
+  [super clearForReuse];
+  memset(hasBits_, 0, sizeof(hasBits_));
 }
 static CustomOptionOtherValues* defaultCustomOptionOtherValuesInstance = nil;
-+ (void) initialize {
-  if (self == [CustomOptionOtherValues class]) {
-    defaultCustomOptionOtherValuesInstance = [[CustomOptionOtherValues alloc] init];
-  }
-}
 + (CustomOptionOtherValues*) defaultInstance {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultCustomOptionOtherValuesInstance = [[CustomOptionOtherValues alloc] init];
+  });
   return defaultCustomOptionOtherValuesInstance;
 }
 - (CustomOptionOtherValues*) defaultInstance {
-  return defaultCustomOptionOtherValuesInstance;
+  return [CustomOptionOtherValues defaultInstance];
 }
 - (BOOL) isInitialized {
   return YES;
@@ -1855,15 +2452,15 @@ static CustomOptionOtherValues* defaultCustomOptionOtherValuesInstance = nil;
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = PBGeneratedMessageGetMemoizedSize(&memoizedSerializedSize);
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
+  size_ = 0;
+  size_ += self.unknownFields.serializedSize;
+  PBGeneratedMessageSetMemoizedSize(&memoizedSerializedSize, size_);
+  return size_;
 }
 + (CustomOptionOtherValues*) parseFromData:(NSData*) data {
   return (CustomOptionOtherValues*)[[[CustomOptionOtherValues builder] mergeFromData:data] build];
@@ -1887,7 +2484,7 @@ static CustomOptionOtherValues* defaultCustomOptionOtherValuesInstance = nil;
   return [[[CustomOptionOtherValues_Builder alloc] init] autorelease];
 }
 + (CustomOptionOtherValues_Builder*) builderWithPrototype:(CustomOptionOtherValues*) prototype {
-  return [[CustomOptionOtherValues builder] mergeFrom:prototype];
+  return [[[CustomOptionOtherValues_Builder alloc] initWithPrototype:prototype] autorelease];
 }
 - (CustomOptionOtherValues_Builder*) builder {
   return [CustomOptionOtherValues builder];
@@ -1910,37 +2507,91 @@ static CustomOptionOtherValues* defaultCustomOptionOtherValuesInstance = nil;
       (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
 }
 - (NSUInteger) hash {
-  NSUInteger hashCode = 7;
-  hashCode = hashCode * 31 + [self.unknownFields hash];
-  return hashCode;
-}
-@end
+  NSUInteger hash_ = PBGeneratedMessageGetMemoizedHash(&memoizedHash);
+  if (hash_ != 0) {
+    return hash_;
+  }
 
-@interface CustomOptionOtherValues_Builder()
-@property (retain) CustomOptionOtherValues* result;
+  uint64_t hashCode = 7;
+  hashCode = PBGeneratedMessageHashMix(hashCode, [self.unknownFields hash]);
+  hash_ = PBGeneratedMessageHashFinish(hashCode);
+  PBGeneratedMessageSetMemoizedHash(&memoizedHash, hash_);
+  return hash_;
+}
 @end
 
 @implementation CustomOptionOtherValues_Builder
 @synthesize result;
 - (void) dealloc {
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
   self.result = nil;
+  [prototype_ release];
   [super dealloc];
 }
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[[CustomOptionOtherValues alloc] init] autorelease];
+    result = [CustomOptionOtherValues recycledInstance];
   }
   return self;
 }
+- (id) initWithPrototype:(CustomOptionOtherValues*) prototype {
+  if ((self = [super init])) {
+    self.result = prototype;
+    prototype_ = [prototype retain];
+  }
+  return self;
+}
+- (void) detachFromPrototype {
+  CustomOptionOtherValues* prototype = prototype_;
+  prototype_ = nil;
+  self.result = [[[CustomOptionOtherValues alloc] init] autorelease];
+  [self mergeFrom:prototype];
+  [prototype release];
+}
+- (PBGeneratedMessage*) internalGetMutableResult {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return [self internalGetResult];
+}
 - (PBGeneratedMessage*) internalGetResult {
   return result;
 }
 - (CustomOptionOtherValues_Builder*) clear {
-  self.result = [[[CustomOptionOtherValues alloc] init] autorelease];
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = [[CustomOptionOtherValues recycledInstance] autorelease];
   return self;
 }
 - (CustomOptionOtherValues_Builder*) clone {
-  return [CustomOptionOtherValues builderWithPrototype:result];
+  if (prototype_ != nil) {
+    return [[[CustomOptionOtherValues_Builder alloc] initWithPrototype:prototype_] autorelease];
+  }
+  return [[CustomOptionOtherValues builder] mergeFrom:result];
+}
+- (CustomOptionOtherValues_Builder*) reset {
+  if (result == nil || prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    self.result = [[CustomOptionOtherValues recycledInstance] autorelease];
+  } else {
+    [result clearForReuse];
+  }
+  return self;
+}
+- (CustomOptionOtherValues_Builder*) recycle:(CustomOptionOtherValues*) message {
+  if (message == [CustomOptionOtherValues defaultInstance]) {
+    @throw [NSException exceptionWithName:@"IllegalArgument" reason:@"Cannot recycle the default instance" userInfo:nil];
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = message;
+  return [self reset];
 }
 - (CustomOptionOtherValues*) defaultInstance {
   return [CustomOptionOtherValues defaultInstance];
@@ -1950,14 +2601,27 @@ static CustomOptionOtherValues* defaultCustomOptionOtherValuesInstance = nil;
   return [self buildPartial];
 }
 - (CustomOptionOtherValues*) buildPartial {
-  CustomOptionOtherValues* returnMe = [[result retain] autorelease];
-  self.result = nil;
+  return [[self newBuildPartial] autorelease];
+}
+- (CustomOptionOtherValues*) newBuildPartial {
+  if (prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    CustomOptionOtherValues* returnMe = result;
+    result = nil;
+    return returnMe;
+  }
+  CustomOptionOtherValues* returnMe = result;
+  result = nil;
   return returnMe;
 }
 - (CustomOptionOtherValues_Builder*) mergeFrom:(CustomOptionOtherValues*) other {
   if (other == [CustomOptionOtherValues defaultInstance]) {
     return self;
   }
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
   [self mergeUnknownFields:other.unknownFields];
   return self;
 }
@@ -1965,18 +2629,29 @@ static CustomOptionOtherValues* defaultCustomOptionOtherValuesInstance = nil;
   return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
 }
 - (CustomOptionOtherValues_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  PBUnknownFieldSet_Builder* unknownFields = nil;
   while (YES) {
     int32_t tag = [input readTag];
     switch (tag) {
       case 0:
-        [self setUnknownFields:[unknownFields build]];
+        if (unknownFields != nil) {
+          [self setUnknownFields:[unknownFields build]];
+        }
         return self;
       default: {
-        if (![self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag]) {
-          [self setUnknownFields:[unknownFields build]];
+        if (PBWireFormatGetTagWireType(tag) == PBWireFormatEndGroup) {
+          if (unknownFields != nil) {
+            [self setUnknownFields:[unknownFields build]];
+          }
           return self;
         }
+        if (unknownFields == nil) {
+          unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+        }
+        [self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag];
         break;
       }
     }
@@ -1987,27 +2662,31 @@ static CustomOptionOtherValues* defaultCustomOptionOtherValuesInstance = nil;
 @interface SettingRealsFromPositiveInts ()
 @end
 
+@interface SettingRealsFromPositiveInts_Builder()
+@property (nonatomic, retain) SettingRealsFromPositiveInts* result;
+- (id) initWithPrototype:(SettingRealsFromPositiveInts*) prototype;
+- (void) detachFromPrototype;
+@end
+
 @implementation SettingRealsFromPositiveInts
 
 - (void) dealloc {
   [super dealloc];
 }
-- (id) init {
-  if ((self = [super init])) {
-  }
-  return self;
+- (void) clearForReuse {
+  [super clearForReuse];
+  memset(hasBits_, 0, sizeof(hasBits_));
 }
 static SettingRealsFromPositiveInts* defaultSettingRealsFromPositiveIntsInstance = nil;
-+ (void) initialize {
-  if (self == [SettingRealsFromPositiveInts class]) {
-    defaultSettingRealsFromPositiveIntsInstance = [[SettingRealsFromPositiveInts alloc] init];
-  }
-}
 + (SettingRealsFromPositiveInts*) defaultInstance {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultSettingRealsFromPositiveIntsInstance = [[SettingRealsFromPositiveInts alloc] init];
+  });
   return defaultSettingRealsFromPositiveIntsInstance;
 }
 - (SettingRealsFromPositiveInts*) defaultInstance {
-  return defaultSettingRealsFromPositiveIntsInstance;
+  return [SettingRealsFromPositiveInts defaultInstance];
 }
 - (BOOL) isInitialized {
   return YES;
@@ -2016,15 +2695,15 @@ static SettingRealsFromPositiveInts* defaultSettingRealsFromPositiveIntsInstance
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = PBGeneratedMessageGetMemoizedSize(&memoizedSerializedSize);
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
+  size_ = 0;
+  size_ += self.unknownFields.serializedSize;
+  PBGeneratedMessageSetMemoizedSize(&memoizedSerializedSize, size_);
+  return size_;
 }
 + (SettingRealsFromPositiveInts*) parseFromData:(NSData*) data {
   return (SettingRealsFromPositiveInts*)[[[SettingRealsFromPositiveInts builder] mergeFromData:data] build];
@@ -2048,7 +2727,7 @@ static SettingRealsFromPositiveInts* defaultSettingRealsFromPositiveIntsInstance
   return [[[SettingRealsFromPositiveInts_Builder alloc] init] autorelease];
 }
 + (SettingRealsFromPositiveInts_Builder*) builderWithPrototype:(SettingRealsFromPositiveInts*) prototype {
-  return [[SettingRealsFromPositiveInts builder] mergeFrom:prototype];
+  return [[[SettingRealsFromPositiveInts_Builder alloc] initWithPrototype:prototype] autorelease];
 }
 - (SettingRealsFromPositiveInts_Builder*) builder {
   return [SettingRealsFromPositiveInts builder];
@@ -2071,37 +2750,91 @@ static SettingRealsFromPositiveInts* defaultSettingRealsFromPositiveIntsInstance
       (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
 }
 - (NSUInteger) hash {
-  NSUInteger hashCode = 7;
-  hashCode = hashCode * 31 + [self.unknownFields hash];
-  return hashCode;
-}
-@end
+  NSUInteger hash_ = PBGeneratedMessageGetMemoizedHash(&memoizedHash);
+  if (hash_ != 0) {
+    return hash_;
+  }
 
-@interface SettingRealsFromPositiveInts_Builder()
-@property (retain) SettingRealsFromPositiveInts* result;
+  uint64_t hashCode = 7;
+  hashCode = PBGeneratedMessageHashMix(hashCode, [self.unknownFields hash]);
+  hash_ = PBGeneratedMessageHashFinish(hashCode);
+  PBGeneratedMessageSetMemoizedHash(&memoizedHash, hash_);
+  return hash_;
+}
 @end
 
 @implementation SettingRealsFromPositiveInts_Builder
 @synthesize result;
 - (void) dealloc {
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
   self.result = nil;
+  [prototype_ release];
   [super dealloc];
 }
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[[SettingRealsFromPositiveInts alloc] init] autorelease];
+    result = [SettingRealsFromPositiveInts recycledInstance];
+  }
+  return self;
+}
+- (id) initWithPrototype:(SettingRealsFromPositiveInts*) prototype {
+  if ((self = [super init])) {
+    self.result = prototype;
+    prototype_ = [prototype retain];
   }
   return self;
 }
+- (void) detachFromPrototype {
+  SettingRealsFromPositiveInts* prototype = prototype_;
+  prototype_ = nil;
+  self.result = [[[SettingRealsFromPositiveInts alloc] init] autorelease];
+  [self mergeFrom:prototype];
+  [prototype release];
+}
+- (PBGeneratedMessage*) internalGetMutableResult {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return [self internalGetResult];
+}
 - (PBGeneratedMessage*) internalGetResult {
   return result;
 }
 - (SettingRealsFromPositiveInts_Builder*) clear {
-  self.result = [[[SettingRealsFromPositiveInts alloc] init] autorelease];
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = [[SettingRealsFromPositiveInts recycledInstance] autorelease];
   return self;
 }
 - (SettingRealsFromPositiveInts_Builder*) clone {
-  return [SettingRealsFromPositiveInts builderWithPrototype:result];
+  if (prototype_ != nil) {
+    return [[[SettingRealsFromPositiveInts_Builder alloc] initWithPrototype:prototype_] autorelease];
+  }
+  return [[SettingRealsFromPositiveInts builder] mergeFrom:result];
+}
+- (SettingRealsFromPositiveInts_Builder*) reset {
+  if (result == nil || prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    self.result = [[SettingRealsFromPositiveInts recycledInstance] autorelease];
+  } else {
+    [result clearForReuse];
+  }
+  return self;
+}
+- (SettingRealsFromPositiveInts_Builder*) recycle:(SettingRealsFromPositiveInts*) message {
+  if (message == [SettingRealsFromPositiveInts defaultInstance]) {
+    @throw [NSException exceptionWithName:@"IllegalArgument" reason:@"Cannot recycle the default instance" userInfo:nil];
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = message;
+  return [self reset];
 }
 - (SettingRealsFromPositiveInts*) defaultInstance {
   return [SettingRealsFromPositiveInts defaultInstance];
@@ -2111,14 +2844,27 @@ static SettingRealsFromPositiveInts* defaultSettingRealsFromPositiveIntsInstance
   return [self buildPartial];
 }
 - (SettingRealsFromPositiveInts*) buildPartial {
-  SettingRealsFromPositiveInts* returnMe = [[result retain] autorelease];
-  self.result = nil;
+  return [[self newBuildPartial] autorelease];
+}
+- (SettingRealsFromPositiveInts*) newBuildPartial {
+  if (prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    SettingRealsFromPositiveInts* returnMe = result;
+    result = nil;
+    return returnMe;
+  }
+  SettingRealsFromPositiveInts* returnMe = result;
+  result = nil;
   return returnMe;
 }
 - (SettingRealsFromPositiveInts_Builder*) mergeFrom:(SettingRealsFromPositiveInts*) other {
   if (other == [SettingRealsFromPositiveInts defaultInstance]) {
     return self;
   }
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
   [self mergeUnknownFields:other.unknownFields];
   return self;
 }
@@ -2126,18 +2872,29 @@ static SettingRealsFromPositiveInts* defaultSettingRealsFromPositiveIntsInstance
   return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
 }
 - (SettingRealsFromPositiveInts_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  PBUnknownFieldSet_Builder* unknownFields = nil;
   while (YES) {
     int32_t tag = [input readTag];
     switch (tag) {
       case 0:
-        [self setUnknownFields:[unknownFields build]];
+        if (unknownFields != nil) {
+          [self setUnknownFields:[unknownFields build]];
+        }
         return self;
       default: {
-        if (![self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag]) {
-          [self setUnknownFields:[unknownFields build]];
+        if (PBWireFormatGetTagWireType(tag) == PBWireFormatEndGroup) {
+          if (unknownFields != nil) {
+            [self setUnknownFields:[unknownFields build]];
+          }
           return self;
         }
+        if (unknownFields == nil) {
+          unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+        }
+        [self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag];
         break;
       }
     }
@@ -2148,27 +2905,31 @@ static SettingRealsFromPositiveInts* defaultSettingRealsFromPositiveIntsInstance
 @interface SettingRealsFromNegativeInts ()
 @end
 
+@interface SettingRealsFromNegativeInts_Builder()
+@property (nonatomic, retain) SettingRealsFromNegativeInts* result;
+- (id) initWithPrototype:(SettingRealsFromNegativeInts*) prototype;
+- (void) detachFromPrototype;
+@end
+
 @implementation SettingRealsFromNegativeInts
 
 - (void) dealloc {
   [super dealloc];
 }
-- (id) init {
-  if ((self = [super init])) {
-  }
-  return self;
+- (void) clearForReuse {
+  [super clearForReuse];
+  memset(hasBits_, 0, sizeof(hasBits_));
 }
 static SettingRealsFromNegativeInts* defaultSettingRealsFromNegativeIntsInstance = nil;
-+ (void) initialize {
-  if (self == [SettingRealsFromNegativeInts class]) {
-    defaultSettingRealsFromNegativeIntsInstance = [[SettingRealsFromNegativeInts alloc] init];
-  }
-}
 + (SettingRealsFromNegativeInts*) defaultInstance {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultSettingRealsFromNegativeIntsInstance = [[SettingRealsFromNegativeInts alloc] init];
+  });
   return defaultSettingRealsFromNegativeIntsInstance;
 }
 - (SettingRealsFromNegativeInts*) defaultInstance {
-  return defaultSettingRealsFromNegativeIntsInstance;
+  return [SettingRealsFromNegativeInts defaultInstance];
 }
 - (BOOL) isInitialized {
   return YES;
@@ -2177,15 +2938,15 @@ static SettingRealsFromNegativeInts* defaultSettingRealsFromNegativeIntsInstance
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = PBGeneratedMessageGetMemoizedSize(&memoizedSerializedSize);
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
+  size_ = 0;
+  size_ += self.unknownFields.serializedSize;
+  PBGeneratedMessageSetMemoizedSize(&memoizedSerializedSize, size_);
+  return size_;
 }
 + (SettingRealsFromNegativeInts*) parseFromData:(NSData*) data {
   return (SettingRealsFromNegativeInts*)[[[SettingRealsFromNegativeInts builder] mergeFromData:data] build];
@@ -2209,7 +2970,7 @@ static SettingRealsFromNegativeInts* defaultSettingRealsFromNegativeIntsInstance
   return [[[SettingRealsFromNegativeInts_Builder alloc] init] autorelease];
 }
 + (SettingRealsFromNegativeInts_Builder*) builderWithPrototype:(SettingRealsFromNegativeInts*) prototype {
-  return [[SettingRealsFromNegativeInts builder] mergeFrom:prototype];
+  return [[[SettingRealsFromNegativeInts_Builder alloc] initWithPrototype:prototype] autorelease];
 }
 - (SettingRealsFromNegativeInts_Builder*) builder {
   return [SettingRealsFromNegativeInts builder];
@@ -2232,37 +2993,91 @@ static SettingRealsFromNegativeInts* defaultSettingRealsFromNegativeIntsInstance
       (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
 }
 - (NSUInteger) hash {
-  NSUInteger hashCode = 7;
-  hashCode = hashCode * 31 + [self.unknownFields hash];
-  return hashCode;
-}
-@end
+  NSUInteger hash_ = PBGeneratedMessageGetMemoizedHash(&memoizedHash);
+  if (hash_ != 0) {
+    return hash_;
+  }
 
-@interface SettingRealsFromNegativeInts_Builder()
-@property (retain) SettingRealsFromNegativeInts* result;
+  uint64_t hashCode = 7;
+  hashCode = PBGeneratedMessageHashMix(hashCode, [self.unknownFields hash]);
+  hash_ = PBGeneratedMessageHashFinish(hashCode);
+  PBGeneratedMessageSetMemoizedHash(&memoizedHash, hash_);
+  return hash_;
+}
 @end
 
 @implementation SettingRealsFromNegativeInts_Builder
 @synthesize result;
 - (void) dealloc {
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
   self.result = nil;
+  [prototype_ release];
   [super dealloc];
 }
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[[SettingRealsFromNegativeInts alloc] init] autorelease];
+    result = [SettingRealsFromNegativeInts recycledInstance];
+  }
+  return self;
+}
+- (id) initWithPrototype:(SettingRealsFromNegativeInts*) prototype {
+  if ((self = [super init])) {
+    self.result = prototype;
+    prototype_ = [prototype retain];
   }
   return self;
 }
+- (void) detachFromPrototype {
+  SettingRealsFromNegativeInts* prototype = prototype_;
+  prototype_ = nil;
+  self.result = [[[SettingRealsFromNegativeInts alloc] init] autorelease];
+  [self mergeFrom:prototype];
+  [prototype release];
+}
+- (PBGeneratedMessage*) internalGetMutableResult {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return [self internalGetResult];
+}
 - (PBGeneratedMessage*) internalGetResult {
   return result;
 }
 - (SettingRealsFromNegativeInts_Builder*) clear {
-  self.result = [[[SettingRealsFromNegativeInts alloc] init] autorelease];
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = [[SettingRealsFromNegativeInts recycledInstance] autorelease];
   return self;
 }
 - (SettingRealsFromNegativeInts_Builder*) clone {
-  return [SettingRealsFromNegativeInts builderWithPrototype:result];
+  if (prototype_ != nil) {
+    return [[[SettingRealsFromNegativeInts_Builder alloc] initWithPrototype:prototype_] autorelease];
+  }
+  return [[SettingRealsFromNegativeInts builder] mergeFrom:result];
+}
+- (SettingRealsFromNegativeInts_Builder*) reset {
+  if (result == nil || prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    self.result = [[SettingRealsFromNegativeInts recycledInstance] autorelease];
+  } else {
+    [result clearForReuse];
+  }
+  return self;
+}
+- (SettingRealsFromNegativeInts_Builder*) recycle:(SettingRealsFromNegativeInts*) message {
+  if (message == [SettingRealsFromNegativeInts defaultInstance]) {
+    @throw [NSException exceptionWithName:@"IllegalArgument" reason:@"Cannot recycle the default instance" userInfo:nil];
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = message;
+  return [self reset];
 }
 - (SettingRealsFromNegativeInts*) defaultInstance {
   return [SettingRealsFromNegativeInts defaultInstance];
@@ -2272,14 +3087,27 @@ static SettingRealsFromNegativeInts* defaultSettingRealsFromNegativeIntsInstance
   return [self buildPartial];
 }
 - (SettingRealsFromNegativeInts*) buildPartial {
-  SettingRealsFromNegativeInts* returnMe = [[result retain] autorelease];
-  self.result = nil;
+  return [[self newBuildPartial] autorelease];
+}
+- (SettingRealsFromNegativeInts*) newBuildPartial {
+  if (prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    SettingRealsFromNegativeInts* returnMe = result;
+    result = nil;
+    return returnMe;
+  }
+  SettingRealsFromNegativeInts* returnMe = result;
+  result = nil;
   return returnMe;
 }
 - (SettingRealsFromNegativeInts_Builder*) mergeFrom:(SettingRealsFromNegativeInts*) other {
   if (other == [SettingRealsFromNegativeInts defaultInstance]) {
     return self;
   }
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
   [self mergeUnknownFields:other.unknownFields];
   return self;
 }
@@ -2287,18 +3115,29 @@ static SettingRealsFromNegativeInts* defaultSettingRealsFromNegativeIntsInstance
   return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
 }
 - (SettingRealsFromNegativeInts_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  PBUnknownFieldSet_Builder* unknownFields = nil;
   while (YES) {
     int32_t tag = [input readTag];
     switch (tag) {
       case 0:
-        [self setUnknownFields:[unknownFields build]];
+        if (unknownFields != nil) {
+          [self setUnknownFields:[unknownFields build]];
+        }
         return self;
       default: {
-        if (![self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag]) {
-          [self setUnknownFields:[unknownFields build]];
+        if (PBWireFormatGetTagWireType(tag) == PBWireFormatEndGroup) {
+          if (unknownFields != nil) {
+            [self setUnknownFields:[unknownFields build]];
+          }
           return self;
         }
+        if (unknownFields == nil) {
+          unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+        }
+        [self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag];
         break;
       }
     }
@@ -2307,72 +3146,95 @@ static SettingRealsFromNegativeInts* defaultSettingRealsFromNegativeIntsInstance
 @end
 
 @interface ComplexOptionType1 ()
-@property int32_t foo;
-@property int32_t foo2;
-@property int32_t foo3;
+@property (nonatomic) int32_t foo;
+@property (nonatomic) int32_t foo2;
+@property (nonatomic) int32_t foo3;
+- (void) setInitialized;
+@end
+
+@interface ComplexOptionType1_Builder()
+@property (nonatomic, retain) ComplexOptionType1* result;
+- (id) initWithPrototype:(ComplexOptionType1*) prototype;
+- (void) detachFromPrototype;
 @end
 
 @implementation ComplexOptionType1
 
 - (BOOL) hasFoo {
-  return !!hasFoo_;
+  return (hasBits_[0] & 0x1u) != 0;
 }
-- (void) setHasFoo:(BOOL) value {
-  hasFoo_ = !!value;
+- (void) setHasFoo:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x1u;
+  } else {
+    hasBits_[0] &= ~0x1u;
+  }
 }
 @synthesize foo;
 - (BOOL) hasFoo2 {
-  return !!hasFoo2_;
+  return (hasBits_[0] & 0x2u) != 0;
 }
-- (void) setHasFoo2:(BOOL) value {
-  hasFoo2_ = !!value;
+- (void) setHasFoo2:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x2u;
+  } else {
+    hasBits_[0] &= ~0x2u;
+  }
 }
 @synthesize foo2;
 - (BOOL) hasFoo3 {
-  return !!hasFoo3_;
+  return (hasBits_[0] & 0x4u) != 0;
 }
-- (void) setHasFoo3:(BOOL) value {
-  hasFoo3_ = !!value;
+- (void) setHasFoo3:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x4u;
+  } else {
+    hasBits_[0] &= ~0x4u;
+  }
 }
 @synthesize foo3;
 - (void) dealloc {
   [super dealloc];
 }
-- (id) init {
-  if ((self = [super init])) {
-    self.foo = 0;
-    self.foo2 = 0;
-    self.foo3 = 0;
-  }
-  return self;
+- (void) clearForReuse {
+  [super clearForReuse];
+  memset(hasBits_, 0, sizeof(hasBits_));
+  foo = 0;
+  foo2 = 0;
+  foo3 = 0;
 }
 static ComplexOptionType1* defaultComplexOptionType1Instance = nil;
-+ (void) initialize {
-  if (self == [ComplexOptionType1 class]) {
-    defaultComplexOptionType1Instance = [[ComplexOptionType1 alloc] init];
-  }
-}
 + (ComplexOptionType1*) defaultInstance {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultComplexOptionType1Instance = [[ComplexOptionType1 alloc] init];
+  });
   return defaultComplexOptionType1Instance;
 }
 - (ComplexOptionType1*) defaultInstance {
-  return defaultComplexOptionType1Instance;
+  return [ComplexOptionType1 defaultInstance];
+}
+- (void) setInitialized {
+  hasBits_[0] |= 0x8u;
 }
 - (BOOL) isInitialized {
+  if ((hasBits_[0] & 0x8u) != 0) {
+    return YES;
+  }
   if (!self.extensionsAreInitialized) {
     return NO;
   }
   return YES;
 }
 - (void) writeToCodedOutputStream:(PBCodedOutputStream*) output {
-  if (self.hasFoo) {
-    [output writeInt32:1 value:self.foo];
+  if (hasBits_[0] & 0x1u) {
+    [output writeInt32:1 value:foo];
   }
-  if (self.hasFoo2) {
-    [output writeInt32:2 value:self.foo2];
+  if (hasBits_[0] & 0x2u) {
+    [output writeInt32:2 value:foo2];
   }
-  if (self.hasFoo3) {
-    [output writeInt32:3 value:self.foo3];
+  if (hasBits_[0] & 0x4u) {
+    [output writeInt32:3 value:foo3];
   }
   [self writeExtensionsToCodedOutputStream:output
                                       from:100
@@ -2380,25 +3242,25 @@ static ComplexOptionType1* defaultComplexOptionType1Instance = nil;
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = PBGeneratedMessageGetMemoizedSize(&memoizedSerializedSize);
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
-  if (self.hasFoo) {
-    size += computeInt32Size(1, self.foo);
+  size_ = 0;
+  if (hasBits_[0] & 0x1u) {
+    size_ += computeInt32Size(1, foo);
   }
-  if (self.hasFoo2) {
-    size += computeInt32Size(2, self.foo2);
+  if (hasBits_[0] & 0x2u) {
+    size_ += computeInt32Size(2, foo2);
   }
-  if (self.hasFoo3) {
-    size += computeInt32Size(3, self.foo3);
+  if (hasBits_[0] & 0x4u) {
+    size_ += computeInt32Size(3, foo3);
   }
-  size += [self extensionsSerializedSize];
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
+  size_ += [self extensionsSerializedSize];
+  size_ += self.unknownFields.serializedSize;
+  PBGeneratedMessageSetMemoizedSize(&memoizedSerializedSize, size_);
+  return size_;
 }
 + (ComplexOptionType1*) parseFromData:(NSData*) data {
   return (ComplexOptionType1*)[[[ComplexOptionType1 builder] mergeFromData:data] build];
@@ -2422,7 +3284,7 @@ static ComplexOptionType1* defaultComplexOptionType1Instance = nil;
   return [[[ComplexOptionType1_Builder alloc] init] autorelease];
 }
 + (ComplexOptionType1_Builder*) builderWithPrototype:(ComplexOptionType1*) prototype {
-  return [[ComplexOptionType1 builder] mergeFrom:prototype];
+  return [[[ComplexOptionType1_Builder alloc] initWithPrototype:prototype] autorelease];
 }
 - (ComplexOptionType1_Builder*) builder {
   return [ComplexOptionType1 builder];
@@ -2431,14 +3293,14 @@ static ComplexOptionType1* defaultComplexOptionType1Instance = nil;
   return [ComplexOptionType1 builderWithPrototype:self];
 }
 - (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
-  if (self.hasFoo) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"foo", [NSNumber numberWithInt:self.foo]];
+  if (hasBits_[0] & 0x1u) {
+    [output appendFormat:@"%@%@: %@\n", indent, @"foo", [NSNumber numberWithInt:foo]];
   }
-  if (self.hasFoo2) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"foo2", [NSNumber numberWithInt:self.foo2]];
+  if (hasBits_[0] & 0x2u) {
+    [output appendFormat:@"%@%@: %@\n", indent, @"foo2", [NSNumber numberWithInt:foo2]];
   }
-  if (self.hasFoo3) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"foo3", [NSNumber numberWithInt:self.foo3]];
+  if (hasBits_[0] & 0x4u) {
+    [output appendFormat:@"%@%@: %@\n", indent, @"foo3", [NSNumber numberWithInt:foo3]];
   }
   [self writeExtensionDescriptionToMutableString:(NSMutableString*)output
                                             from:100
@@ -2455,86 +3317,155 @@ static ComplexOptionType1* defaultComplexOptionType1Instance = nil;
   }
   ComplexOptionType1 *otherMessage = other;
   return
-      self.hasFoo == otherMessage.hasFoo &&
-      (!self.hasFoo || self.foo == otherMessage.foo) &&
-      
-      self.hasFoo2 == otherMessage.hasFoo2 &&
-      (!self.hasFoo2 || self.foo2 == otherMessage.foo2) &&
-      
-      self.hasFoo3 == otherMessage.hasFoo3 &&
-      (!self.hasFoo3 || self.foo3 == otherMessage.foo3) &&
-      
+      (hasBits_[0] & 0x1u) == (otherMessage->hasBits_[0] & 0x1u) &&
+      (!(hasBits_[0] & 0x1u) || foo == otherMessage->foo) &&
+      (hasBits_[0] & 0x2u) == (otherMessage->hasBits_[0] & 0x2u) &&
+      (!(hasBits_[0] & 0x2u) || foo2 == otherMessage->foo2) &&
+      (hasBits_[0] & 0x4u) == (otherMessage->hasBits_[0] & 0x4u) &&
+      (!(hasBits_[0] & 0x4u) || foo3 == otherMessage->foo3) &&
       [self isEqualExtensionsInOther:otherMessage from:100 to:536870912] &&
-      
+
       (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
 }
 - (NSUInteger) hash {
-  NSUInteger hashCode = 7;
-  if (self.hasFoo) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithInt:self.foo] hash];
+  NSUInteger hash_ = PBGeneratedMessageGetMemoizedHash(&memoizedHash);
+  if (hash_ != 0) {
+    return hash_;
   }
-  if (self.hasFoo2) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithInt:self.foo2] hash];
+
+  uint64_t hashCode = 7;
+  if (hasBits_[0] & 0x1u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, (uint64_t)foo);
   }
-  if (self.hasFoo3) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithInt:self.foo3] hash];
+  if (hasBits_[0] & 0x2u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, (uint64_t)foo2);
   }
-  hashCode = hashCode * 31 + [self hashExtensionsFrom:100 to:536870912];
-  hashCode = hashCode * 31 + [self.unknownFields hash];
-  return hashCode;
+  if (hasBits_[0] & 0x4u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, (uint64_t)foo3);
+  }
+  hashCode = PBGeneratedMessageHashMix(hashCode, [self hashExtensionsFrom:100 to:536870912]);
+  hashCode = PBGeneratedMessageHashMix(hashCode, [self.unknownFields hash]);
+  hash_ = PBGeneratedMessageHashFinish(hashCode);
+  PBGeneratedMessageSetMemoizedHash(&memoizedHash, hash_);
+  return hash_;
 }
 @end
 
-@interface ComplexOptionType1_Builder()
-@property (retain) ComplexOptionType1* result;
-@end
-
 @implementation ComplexOptionType1_Builder
 @synthesize result;
 - (void) dealloc {
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
   self.result = nil;
+  [prototype_ release];
   [super dealloc];
 }
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[[ComplexOptionType1 alloc] init] autorelease];
+    result = [ComplexOptionType1 recycledInstance];
+  }
+  return self;
+}
+- (id) initWithPrototype:(ComplexOptionType1*) prototype {
+  if ((self = [super init])) {
+    self.result = prototype;
+    prototype_ = [prototype retain];
   }
   return self;
 }
+- (void) detachFromPrototype {
+  ComplexOptionType1* prototype = prototype_;
+  prototype_ = nil;
+  self.result = [[[ComplexOptionType1 alloc] init] autorelease];
+  [self mergeFrom:prototype];
+  [prototype release];
+}
+- (PBExtendableMessage*) internalGetMutableResult {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return [self internalGetResult];
+}
 - (PBExtendableMessage*) internalGetResult {
   return result;
 }
 - (ComplexOptionType1_Builder*) clear {
-  self.result = [[[ComplexOptionType1 alloc] init] autorelease];
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = [[ComplexOptionType1 recycledInstance] autorelease];
   return self;
 }
 - (ComplexOptionType1_Builder*) clone {
-  return [ComplexOptionType1 builderWithPrototype:result];
+  if (prototype_ != nil) {
+    return [[[ComplexOptionType1_Builder alloc] initWithPrototype:prototype_] autorelease];
+  }
+  return [[ComplexOptionType1 builder] mergeFrom:result];
+}
+- (ComplexOptionType1_Builder*) reset {
+  if (result == nil || prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    self.result = [[ComplexOptionType1 recycledInstance] autorelease];
+  } else {
+    [result clearForReuse];
+  }
+  return self;
+}
+- (ComplexOptionType1_Builder*) recycle:(ComplexOptionType1*) message {
+  if (message == [ComplexOptionType1 defaultInstance]) {
+    @throw [NSException exceptionWithName:@"IllegalArgument" reason:@"Cannot recycle the default instance" userInfo:nil];
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = message;
+  return [self reset];
 }
 - (ComplexOptionType1*) defaultInstance {
   return [ComplexOptionType1 defaultInstance];
 }
 - (ComplexOptionType1*) build {
   [self checkInitialized];
-  return [self buildPartial];
+  BOOL shared = prototype_ != nil;
+  ComplexOptionType1* returnMe = [self buildPartial];
+  if (!shared) {
+    [returnMe setInitialized];
+  }
+  return returnMe;
 }
 - (ComplexOptionType1*) buildPartial {
-  ComplexOptionType1* returnMe = [[result retain] autorelease];
-  self.result = nil;
+  return [[self newBuildPartial] autorelease];
+}
+- (ComplexOptionType1*) newBuildPartial {
+  if (prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    ComplexOptionType1* returnMe = result;
+    result = nil;
+    return returnMe;
+  }
+  ComplexOptionType1* returnMe = result;
+  result = nil;
   return returnMe;
 }
 - (ComplexOptionType1_Builder*) mergeFrom:(ComplexOptionType1*) other {
   if (other == [ComplexOptionType1 defaultInstance]) {
     return self;
   }
-  if (other.hasFoo) {
-    [self setFoo:other.foo];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  if (other.hasFoo2) {
-    [self setFoo2:other.foo2];
+  if (other->hasBits_[0] & 0x1u) {
+    [self setFoo:other->foo];
   }
-  if (other.hasFoo3) {
-    [self setFoo3:other.foo3];
+  if (other->hasBits_[0] & 0x2u) {
+    [self setFoo2:other->foo2];
+  }
+  if (other->hasBits_[0] & 0x4u) {
+    [self setFoo3:other->foo3];
   }
   [self mergeExtensionFields:other];
   [self mergeUnknownFields:other.unknownFields];
@@ -2544,18 +3475,29 @@ static ComplexOptionType1* defaultComplexOptionType1Instance = nil;
   return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
 }
 - (ComplexOptionType1_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  PBUnknownFieldSet_Builder* unknownFields = nil;
   while (YES) {
     int32_t tag = [input readTag];
     switch (tag) {
       case 0:
-        [self setUnknownFields:[unknownFields build]];
+        if (unknownFields != nil) {
+          [self setUnknownFields:[unknownFields build]];
+        }
         return self;
       default: {
-        if (![self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag]) {
-          [self setUnknownFields:[unknownFields build]];
+        if (PBWireFormatGetTagWireType(tag) == PBWireFormatEndGroup) {
+          if (unknownFields != nil) {
+            [self setUnknownFields:[unknownFields build]];
+          }
           return self;
         }
+        if (unknownFields == nil) {
+          unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+        }
+        [self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag];
         break;
       }
       case 8: {
@@ -2574,112 +3516,164 @@ static ComplexOptionType1* defaultComplexOptionType1Instance = nil;
   }
 }
 - (BOOL) hasFoo {
-  return result.hasFoo;
+  return (result->hasBits_[0] & 0x1u) != 0;
 }
 - (int32_t) foo {
-  return result.foo;
+  return result->foo;
 }
 - (ComplexOptionType1_Builder*) setFoo:(int32_t) value {
-  result.hasFoo = YES;
-  result.foo = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x1u;
+  result->foo = value;
   return self;
 }
 - (ComplexOptionType1_Builder*) clearFoo {
-  result.hasFoo = NO;
-  result.foo = 0;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x1u;
+  result->foo = 0;
   return self;
 }
 - (BOOL) hasFoo2 {
-  return result.hasFoo2;
+  return (result->hasBits_[0] & 0x2u) != 0;
 }
 - (int32_t) foo2 {
-  return result.foo2;
+  return result->foo2;
 }
 - (ComplexOptionType1_Builder*) setFoo2:(int32_t) value {
-  result.hasFoo2 = YES;
-  result.foo2 = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x2u;
+  result->foo2 = value;
   return self;
 }
 - (ComplexOptionType1_Builder*) clearFoo2 {
-  result.hasFoo2 = NO;
-  result.foo2 = 0;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x2u;
+  result->foo2 = 0;
   return self;
 }
 - (BOOL) hasFoo3 {
-  return result.hasFoo3;
+  return (result->hasBits_[0] & 0x4u) != 0;
 }
 - (int32_t) foo3 {
-  return result.foo3;
+  return result->foo3;
 }
 - (ComplexOptionType1_Builder*) setFoo3:(int32_t) value {
-  result.hasFoo3 = YES;
-  result.foo3 = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x4u;
+  result->foo3 = value;
   return self;
 }
 - (ComplexOptionType1_Builder*) clearFoo3 {
-  result.hasFoo3 = NO;
-  result.foo3 = 0;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x4u;
+  result->foo3 = 0;
   return self;
 }
 @end
 
 @interface ComplexOptionType2 ()
-@property (retain) ComplexOptionType1* bar;
-@property int32_t baz;
-@property (retain) ComplexOptionType2_ComplexOptionType4* fred;
+@property (nonatomic, retain) ComplexOptionType1* bar;
+@property (nonatomic) int32_t baz;
+@property (nonatomic, retain) ComplexOptionType2_ComplexOptionType4* fred;
+- (void) setInitialized;
+@end
+
+@interface ComplexOptionType2_Builder()
+@property (nonatomic, retain) ComplexOptionType2* result;
+- (id) initWithPrototype:(ComplexOptionType2*) prototype;
+- (void) detachFromPrototype;
+- (void) freezeSubBuilders;
+- (void) dropSubBuilders;
+- (void) resetSubBuilders;
 @end
 
 @implementation ComplexOptionType2
 
 - (BOOL) hasBar {
-  return !!hasBar_;
+  return (hasBits_[0] & 0x1u) != 0;
 }
-- (void) setHasBar:(BOOL) value {
-  hasBar_ = !!value;
+- (void) setHasBar:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x1u;
+  } else {
+    hasBits_[0] &= ~0x1u;
+  }
 }
 @synthesize bar;
+- (ComplexOptionType1*) bar {
+  return bar != nil ? bar : [ComplexOptionType1 defaultInstance];
+}
 - (BOOL) hasBaz {
-  return !!hasBaz_;
+  return (hasBits_[0] & 0x2u) != 0;
 }
-- (void) setHasBaz:(BOOL) value {
-  hasBaz_ = !!value;
+- (void) setHasBaz:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x2u;
+  } else {
+    hasBits_[0] &= ~0x2u;
+  }
 }
 @synthesize baz;
 - (BOOL) hasFred {
-  return !!hasFred_;
+  return (hasBits_[0] & 0x4u) != 0;
 }
-- (void) setHasFred:(BOOL) value {
-  hasFred_ = !!value;
+- (void) setHasFred:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x4u;
+  } else {
+    hasBits_[0] &= ~0x4u;
+  }
 }
 @synthesize fred;
+- (ComplexOptionType2_ComplexOptionType4*) fred {
+  return fred != nil ? fred : [ComplexOptionType2_ComplexOptionType4 defaultInstance];
+}
 - (void) dealloc {
-  self.bar = nil;
-  self.fred = nil;
+  [bar release];
+  [fred release];
   [super dealloc];
 }
-- (id) init {
-  if ((self = [super init])) {
-    self.bar = [ComplexOptionType1 defaultInstance];
-    self.baz = 0;
-    self.fred = [ComplexOptionType2_ComplexOptionType4 defaultInstance];
-  }
-  return self;
+- (void) clearForReuse {
+  [super clearForReuse];
+  memset(hasBits_, 0, sizeof(hasBits_));
+  [bar release];
+  bar = nil;
+  baz = 0;
+  [fred release];
+  fred = nil;
 }
 static ComplexOptionType2* defaultComplexOptionType2Instance = nil;
-+ (void) initialize {
-  if (self == [ComplexOptionType2 class]) {
-    defaultComplexOptionType2Instance = [[ComplexOptionType2 alloc] init];
-  }
-}
 + (ComplexOptionType2*) defaultInstance {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultComplexOptionType2Instance = [[ComplexOptionType2 alloc] init];
+  });
   return defaultComplexOptionType2Instance;
 }
 - (ComplexOptionType2*) defaultInstance {
-  return defaultComplexOptionType2Instance;
+  return [ComplexOptionType2 defaultInstance];
+}
+- (void) setInitialized {
+  hasBits_[0] |= 0x8u;
 }
 - (BOOL) isInitialized {
-  if (self.hasBar) {
-    if (!self.bar.isInitialized) {
+  if ((hasBits_[0] & 0x8u) != 0) {
+    return YES;
+  }
+  if ((hasBits_[0] & 0x1u) != 0) {
+    if (!bar.isInitialized) {
       return NO;
     }
   }
@@ -2689,14 +3683,14 @@ static ComplexOptionType2* defaultComplexOptionType2Instance = nil;
   return YES;
 }
 - (void) writeToCodedOutputStream:(PBCodedOutputStream*) output {
-  if (self.hasBar) {
-    [output writeMessage:1 value:self.bar];
+  if (hasBits_[0] & 0x1u) {
+    [output writeMessage:1 value:bar];
   }
-  if (self.hasBaz) {
-    [output writeInt32:2 value:self.baz];
+  if (hasBits_[0] & 0x2u) {
+    [output writeInt32:2 value:baz];
   }
-  if (self.hasFred) {
-    [output writeMessage:3 value:self.fred];
+  if (hasBits_[0] & 0x4u) {
+    [output writeMessage:3 value:fred];
   }
   [self writeExtensionsToCodedOutputStream:output
                                       from:100
@@ -2704,25 +3698,25 @@ static ComplexOptionType2* defaultComplexOptionType2Instance = nil;
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = PBGeneratedMessageGetMemoizedSize(&memoizedSerializedSize);
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
-  if (self.hasBar) {
-    size += computeMessageSize(1, self.bar);
+  size_ = 0;
+  if (hasBits_[0] & 0x1u) {
+    size_ += computeMessageSize(1, bar);
   }
-  if (self.hasBaz) {
-    size += computeInt32Size(2, self.baz);
+  if (hasBits_[0] & 0x2u) {
+    size_ += computeInt32Size(2, baz);
   }
-  if (self.hasFred) {
-    size += computeMessageSize(3, self.fred);
+  if (hasBits_[0] & 0x4u) {
+    size_ += computeMessageSize(3, fred);
   }
-  size += [self extensionsSerializedSize];
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
+  size_ += [self extensionsSerializedSize];
+  size_ += self.unknownFields.serializedSize;
+  PBGeneratedMessageSetMemoizedSize(&memoizedSerializedSize, size_);
+  return size_;
 }
 + (ComplexOptionType2*) parseFromData:(NSData*) data {
   return (ComplexOptionType2*)[[[ComplexOptionType2 builder] mergeFromData:data] build];
@@ -2746,7 +3740,7 @@ static ComplexOptionType2* defaultComplexOptionType2Instance = nil;
   return [[[ComplexOptionType2_Builder alloc] init] autorelease];
 }
 + (ComplexOptionType2_Builder*) builderWithPrototype:(ComplexOptionType2*) prototype {
-  return [[ComplexOptionType2 builder] mergeFrom:prototype];
+  return [[[ComplexOptionType2_Builder alloc] initWithPrototype:prototype] autorelease];
 }
 - (ComplexOptionType2_Builder*) builder {
   return [ComplexOptionType2 builder];
@@ -2755,18 +3749,18 @@ static ComplexOptionType2* defaultComplexOptionType2Instance = nil;
   return [ComplexOptionType2 builderWithPrototype:self];
 }
 - (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
-  if (self.hasBar) {
+  if (hasBits_[0] & 0x1u) {
     [output appendFormat:@"%@%@ {\n", indent, @"bar"];
-    [self.bar writeDescriptionTo:output
+    [bar writeDescriptionTo:output
                          withIndent:[NSString stringWithFormat:@"%@  ", indent]];
     [output appendFormat:@"%@}\n", indent];
   }
-  if (self.hasBaz) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"baz", [NSNumber numberWithInt:self.baz]];
+  if (hasBits_[0] & 0x2u) {
+    [output appendFormat:@"%@%@: %@\n", indent, @"baz", [NSNumber numberWithInt:baz]];
   }
-  if (self.hasFred) {
+  if (hasBits_[0] & 0x4u) {
     [output appendFormat:@"%@%@ {\n", indent, @"fred"];
-    [self.fred writeDescriptionTo:output
+    [fred writeDescriptionTo:output
                          withIndent:[NSString stringWithFormat:@"%@  ", indent]];
     [output appendFormat:@"%@}\n", indent];
   }
@@ -2785,95 +3779,107 @@ static ComplexOptionType2* defaultComplexOptionType2Instance = nil;
   }
   ComplexOptionType2 *otherMessage = other;
   return
-      self.hasBar == otherMessage.hasBar &&
-      (!self.hasBar || [self.bar isEqual:otherMessage.bar]) &&
-      
-      self.hasBaz == otherMessage.hasBaz &&
-      (!self.hasBaz || self.baz == otherMessage.baz) &&
-      
-      self.hasFred == otherMessage.hasFred &&
-      (!self.hasFred || [self.fred isEqual:otherMessage.fred]) &&
-      
+      (hasBits_[0] & 0x1u) == (otherMessage->hasBits_[0] & 0x1u) &&
+      (!(hasBits_[0] & 0x1u) || [bar isEqual:otherMessage->bar]) &&
+      (hasBits_[0] & 0x2u) == (otherMessage->hasBits_[0] & 0x2u) &&
+      (!(hasBits_[0] & 0x2u) || baz == otherMessage->baz) &&
+      (hasBits_[0] & 0x4u) == (otherMessage->hasBits_[0] & 0x4u) &&
+      (!(hasBits_[0] & 0x4u) || [fred isEqual:otherMessage->fred]) &&
       [self isEqualExtensionsInOther:otherMessage from:100 to:536870912] &&
-      
+
       (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
 }
 - (NSUInteger) hash {
-  NSUInteger hashCode = 7;
-  if (self.hasBar) {
-    hashCode = hashCode * 31 + [self.bar hash];
+  NSUInteger hash_ = PBGeneratedMessageGetMemoizedHash(&memoizedHash);
+  if (hash_ != 0) {
+    return hash_;
+  }
+
+  uint64_t hashCode = 7;
+  if (hasBits_[0] & 0x1u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [bar hash]);
   }
-  if (self.hasBaz) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithInt:self.baz] hash];
+  if (hasBits_[0] & 0x2u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, (uint64_t)baz);
   }
-  if (self.hasFred) {
-    hashCode = hashCode * 31 + [self.fred hash];
+  if (hasBits_[0] & 0x4u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [fred hash]);
   }
-  hashCode = hashCode * 31 + [self hashExtensionsFrom:100 to:536870912];
-  hashCode = hashCode * 31 + [self.unknownFields hash];
-  return hashCode;
+  hashCode = PBGeneratedMessageHashMix(hashCode, [self hashExtensionsFrom:100 to:536870912]);
+  hashCode = PBGeneratedMessageHashMix(hashCode, [self.unknownFields hash]);
+  hash_ = PBGeneratedMessageHashFinish(hashCode);
+  PBGeneratedMessageSetMemoizedHash(&memoizedHash, hash_);
+  return hash_;
 }
 @end
 
 @interface ComplexOptionType2_ComplexOptionType4 ()
-@property int32_t waldo;
+@property (nonatomic) int32_t waldo;
+@end
+
+@interface ComplexOptionType2_ComplexOptionType4_Builder()
+@property (nonatomic, retain) ComplexOptionType2_ComplexOptionType4* result;
+- (id) initWithPrototype:(ComplexOptionType2_ComplexOptionType4*) prototype;
+- (void) detachFromPrototype;
 @end
 
 @implementation ComplexOptionType2_ComplexOptionType4
 
 - (BOOL) hasWaldo {
-  return !!hasWaldo_;
+  return (hasBits_[0] & 0x1u) != 0;
 }
-- (void) setHasWaldo:(BOOL) value {
-  hasWaldo_ = !!value;
+- (void) setHasWaldo:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x1u;
+  } else {
+    hasBits_[0] &= ~0x1u;
+  }
 }
 @synthesize waldo;
 - (void) dealloc {
   [super dealloc];
 }
-- (id) init {
-  if ((self = [super init])) {
-    self.waldo = 0;
-  }
-  return self;
+- (void) clearForReuse {
+  [super clearForReuse];
+  memset(hasBits_, 0, sizeof(hasBits_));
+  waldo = 0;
 }
 + (id<PBExtensionField>) complexOpt4 {
   return ComplexOptionType2_ComplexOptionType4_complexOpt4;
 }
 static ComplexOptionType2_ComplexOptionType4* defaultComplexOptionType2_ComplexOptionType4Instance = nil;
-+ (void) initialize {
-  if (self == [ComplexOptionType2_ComplexOptionType4 class]) {
-    defaultComplexOptionType2_ComplexOptionType4Instance = [[ComplexOptionType2_ComplexOptionType4 alloc] init];
-  }
-}
 + (ComplexOptionType2_ComplexOptionType4*) defaultInstance {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultComplexOptionType2_ComplexOptionType4Instance = [[ComplexOptionType2_ComplexOptionType4 alloc] init];
+  });
   return defaultComplexOptionType2_ComplexOptionType4Instance;
 }
 - (ComplexOptionType2_ComplexOptionType4*) defaultInstance {
-  return defaultComplexOptionType2_ComplexOptionType4Instance;
+  return [ComplexOptionType2_ComplexOptionType4 defaultInstance];
 }
 - (BOOL) isInitialized {
   return YES;
 }
 - (void) writeToCodedOutputStream:(PBCodedOutputStream*) output {
-  if (self.hasWaldo) {
-    [output writeInt32:1 value:self.waldo];
+  if (hasBits_[0] & 0x1u) {
+    [output writeInt32:1 value:waldo];
   }
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = PBGeneratedMessageGetMemoizedSize(&memoizedSerializedSize);
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
-  if (self.hasWaldo) {
-    size += computeInt32Size(1, self.waldo);
+  size_ = 0;
+  if (hasBits_[0] & 0x1u) {
+    size_ += computeInt32Size(1, waldo);
   }
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
+  size_ += self.unknownFields.serializedSize;
+  PBGeneratedMessageSetMemoizedSize(&memoizedSerializedSize, size_);
+  return size_;
 }
 + (ComplexOptionType2_ComplexOptionType4*) parseFromData:(NSData*) data {
   return (ComplexOptionType2_ComplexOptionType4*)[[[ComplexOptionType2_ComplexOptionType4 builder] mergeFromData:data] build];
@@ -2897,7 +3903,7 @@ static ComplexOptionType2_ComplexOptionType4* defaultComplexOptionType2_ComplexO
   return [[[ComplexOptionType2_ComplexOptionType4_Builder alloc] init] autorelease];
 }
 + (ComplexOptionType2_ComplexOptionType4_Builder*) builderWithPrototype:(ComplexOptionType2_ComplexOptionType4*) prototype {
-  return [[ComplexOptionType2_ComplexOptionType4 builder] mergeFrom:prototype];
+  return [[[ComplexOptionType2_ComplexOptionType4_Builder alloc] initWithPrototype:prototype] autorelease];
 }
 - (ComplexOptionType2_ComplexOptionType4_Builder*) builder {
   return [ComplexOptionType2_ComplexOptionType4 builder];
@@ -2906,8 +3912,8 @@ static ComplexOptionType2_ComplexOptionType4* defaultComplexOptionType2_ComplexO
   return [ComplexOptionType2_ComplexOptionType4 builderWithPrototype:self];
 }
 - (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
-  if (self.hasWaldo) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"waldo", [NSNumber numberWithInt:self.waldo]];
+  if (hasBits_[0] & 0x1u) {
+    [output appendFormat:@"%@%@: %@\n", indent, @"waldo", [NSNumber numberWithInt:waldo]];
   }
   [self.unknownFields writeDescriptionTo:output withIndent:indent];
 }
@@ -2920,46 +3926,99 @@ static ComplexOptionType2_ComplexOptionType4* defaultComplexOptionType2_ComplexO
   }
   ComplexOptionType2_ComplexOptionType4 *otherMessage = other;
   return
-      self.hasWaldo == otherMessage.hasWaldo &&
-      (!self.hasWaldo || self.waldo == otherMessage.waldo) &&
-      
+      (hasBits_[0] & 0x1u) == (otherMessage->hasBits_[0] & 0x1u) &&
+      (!(hasBits_[0] & 0x1u) || waldo == otherMessage->waldo) &&
       (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
 }
 - (NSUInteger) hash {
-  NSUInteger hashCode = 7;
-  if (self.hasWaldo) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithInt:self.waldo] hash];
+  NSUInteger hash_ = PBGeneratedMessageGetMemoizedHash(&memoizedHash);
+  if (hash_ != 0) {
+    return hash_;
   }
-  hashCode = hashCode * 31 + [self.unknownFields hash];
-  return hashCode;
-}
-@end
 
-@interface ComplexOptionType2_ComplexOptionType4_Builder()
-@property (retain) ComplexOptionType2_ComplexOptionType4* result;
+  uint64_t hashCode = 7;
+  if (hasBits_[0] & 0x1u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, (uint64_t)waldo);
+  }
+  hashCode = PBGeneratedMessageHashMix(hashCode, [self.unknownFields hash]);
+  hash_ = PBGeneratedMessageHashFinish(hashCode);
+  PBGeneratedMessageSetMemoizedHash(&memoizedHash, hash_);
+  return hash_;
+}
 @end
 
 @implementation ComplexOptionType2_ComplexOptionType4_Builder
 @synthesize result;
 - (void) dealloc {
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
   self.result = nil;
+  [prototype_ release];
   [super dealloc];
 }
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[[ComplexOptionType2_ComplexOptionType4 alloc] init] autorelease];
+    result = [ComplexOptionType2_ComplexOptionType4 recycledInstance];
+  }
+  return self;
+}
+- (id) initWithPrototype:(ComplexOptionType2_ComplexOptionType4*) prototype {
+  if ((self = [super init])) {
+    self.result = prototype;
+    prototype_ = [prototype retain];
   }
   return self;
 }
+- (void) detachFromPrototype {
+  ComplexOptionType2_ComplexOptionType4* prototype = prototype_;
+  prototype_ = nil;
+  self.result = [[[ComplexOptionType2_ComplexOptionType4 alloc] init] autorelease];
+  [self mergeFrom:prototype];
+  [prototype release];
+}
+- (PBGeneratedMessage*) internalGetMutableResult {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return [self internalGetResult];
+}
 - (PBGeneratedMessage*) internalGetResult {
   return result;
 }
 - (ComplexOptionType2_ComplexOptionType4_Builder*) clear {
-  self.result = [[[ComplexOptionType2_ComplexOptionType4 alloc] init] autorelease];
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = [[ComplexOptionType2_ComplexOptionType4 recycledInstance] autorelease];
   return self;
 }
 - (ComplexOptionType2_ComplexOptionType4_Builder*) clone {
-  return [ComplexOptionType2_ComplexOptionType4 builderWithPrototype:result];
+  if (prototype_ != nil) {
+    return [[[ComplexOptionType2_ComplexOptionType4_Builder alloc] initWithPrototype:prototype_] autorelease];
+  }
+  return [[ComplexOptionType2_ComplexOptionType4 builder] mergeFrom:result];
+}
+- (ComplexOptionType2_ComplexOptionType4_Builder*) reset {
+  if (result == nil || prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    self.result = [[ComplexOptionType2_ComplexOptionType4 recycledInstance] autorelease];
+  } else {
+    [result clearForReuse];
+  }
+  return self;
+}
+- (ComplexOptionType2_ComplexOptionType4_Builder*) recycle:(ComplexOptionType2_ComplexOptionType4*) message {
+  if (message == [ComplexOptionType2_ComplexOptionType4 defaultInstance]) {
+    @throw [NSException exceptionWithName:@"IllegalArgument" reason:@"Cannot recycle the default instance" userInfo:nil];
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = message;
+  return [self reset];
 }
 - (ComplexOptionType2_ComplexOptionType4*) defaultInstance {
   return [ComplexOptionType2_ComplexOptionType4 defaultInstance];
@@ -2969,16 +4028,29 @@ static ComplexOptionType2_ComplexOptionType4* defaultComplexOptionType2_ComplexO
   return [self buildPartial];
 }
 - (ComplexOptionType2_ComplexOptionType4*) buildPartial {
-  ComplexOptionType2_ComplexOptionType4* returnMe = [[result retain] autorelease];
-  self.result = nil;
+  return [[self newBuildPartial] autorelease];
+}
+- (ComplexOptionType2_ComplexOptionType4*) newBuildPartial {
+  if (prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    ComplexOptionType2_ComplexOptionType4* returnMe = result;
+    result = nil;
+    return returnMe;
+  }
+  ComplexOptionType2_ComplexOptionType4* returnMe = result;
+  result = nil;
   return returnMe;
 }
 - (ComplexOptionType2_ComplexOptionType4_Builder*) mergeFrom:(ComplexOptionType2_ComplexOptionType4*) other {
   if (other == [ComplexOptionType2_ComplexOptionType4 defaultInstance]) {
     return self;
   }
-  if (other.hasWaldo) {
-    [self setWaldo:other.waldo];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (other->hasBits_[0] & 0x1u) {
+    [self setWaldo:other->waldo];
   }
   [self mergeUnknownFields:other.unknownFields];
   return self;
@@ -2987,18 +4059,29 @@ static ComplexOptionType2_ComplexOptionType4* defaultComplexOptionType2_ComplexO
   return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
 }
 - (ComplexOptionType2_ComplexOptionType4_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  PBUnknownFieldSet_Builder* unknownFields = nil;
   while (YES) {
     int32_t tag = [input readTag];
     switch (tag) {
       case 0:
-        [self setUnknownFields:[unknownFields build]];
+        if (unknownFields != nil) {
+          [self setUnknownFields:[unknownFields build]];
+        }
         return self;
       default: {
-        if (![self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag]) {
-          [self setUnknownFields:[unknownFields build]];
+        if (PBWireFormatGetTagWireType(tag) == PBWireFormatEndGroup) {
+          if (unknownFields != nil) {
+            [self setUnknownFields:[unknownFields build]];
+          }
           return self;
         }
+        if (unknownFields == nil) {
+          unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+        }
+        [self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag];
         break;
       }
       case 8: {
@@ -3009,73 +4092,190 @@ static ComplexOptionType2_ComplexOptionType4* defaultComplexOptionType2_ComplexO
   }
 }
 - (BOOL) hasWaldo {
-  return result.hasWaldo;
+  return (result->hasBits_[0] & 0x1u) != 0;
 }
 - (int32_t) waldo {
-  return result.waldo;
+  return result->waldo;
 }
 - (ComplexOptionType2_ComplexOptionType4_Builder*) setWaldo:(int32_t) value {
-  result.hasWaldo = YES;
-  result.waldo = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x1u;
+  result->waldo = value;
   return self;
 }
 - (ComplexOptionType2_ComplexOptionType4_Builder*) clearWaldo {
-  result.hasWaldo = NO;
-  result.waldo = 0;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x1u;
+  result->waldo = 0;
   return self;
 }
 @end
 
-@interface ComplexOptionType2_Builder()
-@property (retain) ComplexOptionType2* result;
-@end
-
 @implementation ComplexOptionType2_Builder
 @synthesize result;
 - (void) dealloc {
+  [self dropSubBuilders];
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
   self.result = nil;
+  [prototype_ release];
   [super dealloc];
 }
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[[ComplexOptionType2 alloc] init] autorelease];
+    result = [ComplexOptionType2 recycledInstance];
+  }
+  return self;
+}
+- (id) initWithPrototype:(ComplexOptionType2*) prototype {
+  if ((self = [super init])) {
+    self.result = prototype;
+    prototype_ = [prototype retain];
   }
   return self;
 }
+- (void) detachFromPrototype {
+  ComplexOptionType2* prototype = prototype_;
+  prototype_ = nil;
+  self.result = [[[ComplexOptionType2 alloc] init] autorelease];
+  [self mergeFrom:prototype];
+  [prototype release];
+}
+- (PBExtendableMessage*) internalGetMutableResult {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return [self internalGetResult];
+}
+- (void) freezeSubBuilders {
+  if (barBuilder_ != nil) {
+    ComplexOptionType1* value = [barBuilder_ newBuildPartial];
+    result.bar = value;
+    [value release];
+    [barBuilder_ release];
+    barBuilder_ = nil;
+  }
+  if (fredBuilder_ != nil) {
+    ComplexOptionType2_ComplexOptionType4* value = [fredBuilder_ newBuildPartial];
+    result.fred = value;
+    [value release];
+    [fredBuilder_ release];
+    fredBuilder_ = nil;
+  }
+}
+- (void) dropSubBuilders {
+  [barBuilder_ release];
+  barBuilder_ = nil;
+  [barSpareBuilder_ release];
+  barSpareBuilder_ = nil;
+  [fredBuilder_ release];
+  fredBuilder_ = nil;
+  [fredSpareBuilder_ release];
+  fredSpareBuilder_ = nil;
+}
+- (void) resetSubBuilders {
+  if (barBuilder_ != nil) {
+    [barBuilder_ reset];
+    [barSpareBuilder_ release];
+    barSpareBuilder_ = barBuilder_;
+    barBuilder_ = nil;
+  }
+  if (fredBuilder_ != nil) {
+    [fredBuilder_ reset];
+    [fredSpareBuilder_ release];
+    fredSpareBuilder_ = fredBuilder_;
+    fredBuilder_ = nil;
+  }
+}
 - (PBExtendableMessage*) internalGetResult {
+  [self freezeSubBuilders];
   return result;
 }
 - (ComplexOptionType2_Builder*) clear {
-  self.result = [[[ComplexOptionType2 alloc] init] autorelease];
+  [self dropSubBuilders];
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = [[ComplexOptionType2 recycledInstance] autorelease];
   return self;
 }
 - (ComplexOptionType2_Builder*) clone {
-  return [ComplexOptionType2 builderWithPrototype:result];
+  if (prototype_ != nil) {
+    return [[[ComplexOptionType2_Builder alloc] initWithPrototype:prototype_] autorelease];
+  }
+  [self freezeSubBuilders];
+  return [[ComplexOptionType2 builder] mergeFrom:result];
+}
+- (ComplexOptionType2_Builder*) reset {
+  [self resetSubBuilders];
+  if (result == nil || prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    self.result = [[ComplexOptionType2 recycledInstance] autorelease];
+  } else {
+    [result clearForReuse];
+  }
+  return self;
+}
+- (ComplexOptionType2_Builder*) recycle:(ComplexOptionType2*) message {
+  if (message == [ComplexOptionType2 defaultInstance]) {
+    @throw [NSException exceptionWithName:@"IllegalArgument" reason:@"Cannot recycle the default instance" userInfo:nil];
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = message;
+  return [self reset];
 }
 - (ComplexOptionType2*) defaultInstance {
   return [ComplexOptionType2 defaultInstance];
 }
 - (ComplexOptionType2*) build {
   [self checkInitialized];
-  return [self buildPartial];
+  BOOL shared = prototype_ != nil;
+  ComplexOptionType2* returnMe = [self buildPartial];
+  if (!shared) {
+    [returnMe setInitialized];
+  }
+  return returnMe;
 }
 - (ComplexOptionType2*) buildPartial {
-  ComplexOptionType2* returnMe = [[result retain] autorelease];
-  self.result = nil;
+  return [[self newBuildPartial] autorelease];
+}
+- (ComplexOptionType2*) newBuildPartial {
+  if (prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    ComplexOptionType2* returnMe = result;
+    result = nil;
+    return returnMe;
+  }
+  [self freezeSubBuilders];
+  ComplexOptionType2* returnMe = result;
+  result = nil;
   return returnMe;
 }
 - (ComplexOptionType2_Builder*) mergeFrom:(ComplexOptionType2*) other {
   if (other == [ComplexOptionType2 defaultInstance]) {
     return self;
   }
-  if (other.hasBar) {
-    [self mergeBar:other.bar];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  if (other.hasBaz) {
-    [self setBaz:other.baz];
+  if (other->hasBits_[0] & 0x1u) {
+    [self mergeBar:other->bar];
   }
-  if (other.hasFred) {
-    [self mergeFred:other.fred];
+  if (other->hasBits_[0] & 0x2u) {
+    [self setBaz:other->baz];
+  }
+  if (other->hasBits_[0] & 0x4u) {
+    [self mergeFred:other->fred];
   }
   [self mergeExtensionFields:other];
   [self mergeUnknownFields:other.unknownFields];
@@ -3085,27 +4285,41 @@ static ComplexOptionType2_ComplexOptionType4* defaultComplexOptionType2_ComplexO
   return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
 }
 - (ComplexOptionType2_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  PBUnknownFieldSet_Builder* unknownFields = nil;
   while (YES) {
     int32_t tag = [input readTag];
     switch (tag) {
       case 0:
-        [self setUnknownFields:[unknownFields build]];
+        if (unknownFields != nil) {
+          [self setUnknownFields:[unknownFields build]];
+        }
         return self;
       default: {
-        if (![self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag]) {
-          [self setUnknownFields:[unknownFields build]];
+        if (PBWireFormatGetTagWireType(tag) == PBWireFormatEndGroup) {
+          if (unknownFields != nil) {
+            [self setUnknownFields:[unknownFields build]];
+          }
           return self;
         }
+        if (unknownFields == nil) {
+          unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+        }
+        [self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag];
         break;
       }
       case 10: {
-        ComplexOptionType1_Builder* subBuilder = [ComplexOptionType1 builder];
-        if (self.hasBar) {
-          [subBuilder mergeFrom:self.bar];
+        if (barBuilder_ == nil) {
+          barBuilder_ = barSpareBuilder_ != nil ? barSpareBuilder_ : [[ComplexOptionType1_Builder alloc] init];
+          barSpareBuilder_ = nil;
+          if (result->hasBits_[0] & 0x1u) {
+            [barBuilder_ mergeFrom:result->bar];
+          }
+          result->hasBits_[0] |= 0x1u;
         }
-        [input readMessage:subBuilder extensionRegistry:extensionRegistry];
-        [self setBar:[subBuilder buildPartial]];
+        [input readMessage:barBuilder_ extensionRegistry:extensionRegistry];
         break;
       }
       case 16: {
@@ -3113,25 +4327,34 @@ static ComplexOptionType2_ComplexOptionType4* defaultComplexOptionType2_ComplexO
         break;
       }
       case 26: {
-        ComplexOptionType2_ComplexOptionType4_Builder* subBuilder = [ComplexOptionType2_ComplexOptionType4 builder];
-        if (self.hasFred) {
-          [subBuilder mergeFrom:self.fred];
+        if (fredBuilder_ == nil) {
+          fredBuilder_ = fredSpareBuilder_ != nil ? fredSpareBuilder_ : [[ComplexOptionType2_ComplexOptionType4_Builder alloc] init];
+          fredSpareBuilder_ = nil;
+          if (result->hasBits_[0] & 0x4u) {
+            [fredBuilder_ mergeFrom:result->fred];
+          }
+          result->hasBits_[0] |= 0x4u;
         }
-        [input readMessage:subBuilder extensionRegistry:extensionRegistry];
-        [self setFred:[subBuilder buildPartial]];
+        [input readMessage:fredBuilder_ extensionRegistry:extensionRegistry];
         break;
       }
     }
   }
 }
 - (BOOL) hasBar {
-  return result.hasBar;
+  return (result->hasBits_[0] & 0x1u) != 0;
 }
 - (ComplexOptionType1*) bar {
+  [self freezeSubBuilders];
   return result.bar;
 }
 - (ComplexOptionType2_Builder*) setBar:(ComplexOptionType1*) value {
-  result.hasBar = YES;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  [barBuilder_ release];
+  barBuilder_ = nil;
+  result->hasBits_[0] |= 0x1u;
   result.bar = value;
   return self;
 }
@@ -3139,45 +4362,70 @@ static ComplexOptionType2_ComplexOptionType4* defaultComplexOptionType2_ComplexO
   return [self setBar:[builderForValue build]];
 }
 - (ComplexOptionType2_Builder*) mergeBar:(ComplexOptionType1*) value {
-  if (result.hasBar &&
-      result.bar != [ComplexOptionType1 defaultInstance]) {
-    result.bar =
-      [[[ComplexOptionType1 builderWithPrototype:result.bar] mergeFrom:value] buildPartial];
-  } else {
-    result.bar = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (barBuilder_ == nil) {
+    if (!(result->hasBits_[0] & 0x1u) ||
+        result->bar == [ComplexOptionType1 defaultInstance]) {
+      result->hasBits_[0] |= 0x1u;
+      result.bar = value;
+      return self;
+    }
+    barBuilder_ = barSpareBuilder_ != nil ? barSpareBuilder_ : [[ComplexOptionType1_Builder alloc] init];
+    barSpareBuilder_ = nil;
+    [barBuilder_ mergeFrom:result->bar];
   }
-  result.hasBar = YES;
+  [barBuilder_ mergeFrom:value];
   return self;
 }
 - (ComplexOptionType2_Builder*) clearBar {
-  result.hasBar = NO;
-  result.bar = [ComplexOptionType1 defaultInstance];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  [barBuilder_ release];
+  barBuilder_ = nil;
+  result->hasBits_[0] &= ~0x1u;
+  [result->bar release];
+  result->bar = nil;
   return self;
 }
 - (BOOL) hasBaz {
-  return result.hasBaz;
+  return (result->hasBits_[0] & 0x2u) != 0;
 }
 - (int32_t) baz {
-  return result.baz;
+  return result->baz;
 }
 - (ComplexOptionType2_Builder*) setBaz:(int32_t) value {
-  result.hasBaz = YES;
-  result.baz = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x2u;
+  result->baz = value;
   return self;
 }
 - (ComplexOptionType2_Builder*) clearBaz {
-  result.hasBaz = NO;
-  result.baz = 0;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x2u;
+  result->baz = 0;
   return self;
 }
 - (BOOL) hasFred {
-  return result.hasFred;
+  return (result->hasBits_[0] & 0x4u) != 0;
 }
 - (ComplexOptionType2_ComplexOptionType4*) fred {
+  [self freezeSubBuilders];
   return result.fred;
 }
 - (ComplexOptionType2_Builder*) setFred:(ComplexOptionType2_ComplexOptionType4*) value {
-  result.hasFred = YES;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  [fredBuilder_ release];
+  fredBuilder_ = nil;
+  result->hasBits_[0] |= 0x4u;
   result.fred = value;
   return self;
 }
@@ -3185,95 +4433,127 @@ static ComplexOptionType2_ComplexOptionType4* defaultComplexOptionType2_ComplexO
   return [self setFred:[builderForValue build]];
 }
 - (ComplexOptionType2_Builder*) mergeFred:(ComplexOptionType2_ComplexOptionType4*) value {
-  if (result.hasFred &&
-      result.fred != [ComplexOptionType2_ComplexOptionType4 defaultInstance]) {
-    result.fred =
-      [[[ComplexOptionType2_ComplexOptionType4 builderWithPrototype:result.fred] mergeFrom:value] buildPartial];
-  } else {
-    result.fred = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (fredBuilder_ == nil) {
+    if (!(result->hasBits_[0] & 0x4u) ||
+        result->fred == [ComplexOptionType2_ComplexOptionType4 defaultInstance]) {
+      result->hasBits_[0] |= 0x4u;
+      result.fred = value;
+      return self;
+    }
+    fredBuilder_ = fredSpareBuilder_ != nil ? fredSpareBuilder_ : [[ComplexOptionType2_ComplexOptionType4_Builder alloc] init];
+    fredSpareBuilder_ = nil;
+    [fredBuilder_ mergeFrom:result->fred];
   }
-  result.hasFred = YES;
+  [fredBuilder_ mergeFrom:value];
   return self;
 }
 - (ComplexOptionType2_Builder*) clearFred {
-  result.hasFred = NO;
-  result.fred = [ComplexOptionType2_ComplexOptionType4 defaultInstance];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  [fredBuilder_ release];
+  fredBuilder_ = nil;
+  result->hasBits_[0] &= ~0x4u;
+  [result->fred release];
+  result->fred = nil;
   return self;
 }
 @end
 
 @interface ComplexOptionType3 ()
-@property int32_t qux;
-@property (retain) ComplexOptionType3_ComplexOptionType5* complexOptionType5;
+@property (nonatomic) int32_t qux;
+@property (nonatomic, retain) ComplexOptionType3_ComplexOptionType5* complexOptionType5;
+@end
+
+@interface ComplexOptionType3_Builder()
+@property (nonatomic, retain) ComplexOptionType3* result;
+- (id) initWithPrototype:(ComplexOptionType3*) prototype;
+- (void) detachFromPrototype;
+- (void) freezeSubBuilders;
+- (void) dropSubBuilders;
+- (void) resetSubBuilders;
 @end
 
 @implementation ComplexOptionType3
 
 - (BOOL) hasQux {
-  return !!hasQux_;
+  return (hasBits_[0] & 0x1u) != 0;
 }
-- (void) setHasQux:(BOOL) value {
-  hasQux_ = !!value;
+- (void) setHasQux:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x1u;
+  } else {
+    hasBits_[0] &= ~0x1u;
+  }
 }
 @synthesize qux;
 - (BOOL) hasComplexOptionType5 {
-  return !!hasComplexOptionType5_;
+  return (hasBits_[0] & 0x2u) != 0;
 }
-- (void) setHasComplexOptionType5:(BOOL) value {
-  hasComplexOptionType5_ = !!value;
+- (void) setHasComplexOptionType5:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x2u;
+  } else {
+    hasBits_[0] &= ~0x2u;
+  }
 }
 @synthesize complexOptionType5;
+- (ComplexOptionType3_ComplexOptionType5*) complexOptionType5 {
+  return complexOptionType5 != nil ? complexOptionType5 : [ComplexOptionType3_ComplexOptionType5 defaultInstance];
+}
 - (void) dealloc {
-  self.complexOptionType5 = nil;
+  [complexOptionType5 release];
   [super dealloc];
 }
-- (id) init {
-  if ((self = [super init])) {
-    self.qux = 0;
-    self.complexOptionType5 = [ComplexOptionType3_ComplexOptionType5 defaultInstance];
-  }
-  return self;
+- (void) clearForReuse {
+  [super clearForReuse];
+  memset(hasBits_, 0, sizeof(hasBits_));
+  qux = 0;
+  [complexOptionType5 release];
+  complexOptionType5 = nil;
 }
 static ComplexOptionType3* defaultComplexOptionType3Instance = nil;
-+ (void) initialize {
-  if (self == [ComplexOptionType3 class]) {
-    defaultComplexOptionType3Instance = [[ComplexOptionType3 alloc] init];
-  }
-}
 + (ComplexOptionType3*) defaultInstance {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultComplexOptionType3Instance = [[ComplexOptionType3 alloc] init];
+  });
   return defaultComplexOptionType3Instance;
 }
 - (ComplexOptionType3*) defaultInstance {
-  return defaultComplexOptionType3Instance;
+  return [ComplexOptionType3 defaultInstance];
 }
 - (BOOL) isInitialized {
   return YES;
 }
 - (void) writeToCodedOutputStream:(PBCodedOutputStream*) output {
-  if (self.hasQux) {
-    [output writeInt32:1 value:self.qux];
+  if (hasBits_[0] & 0x1u) {
+    [output writeInt32:1 value:qux];
   }
-  if (self.hasComplexOptionType5) {
-    [output writeGroup:2 value:self.complexOptionType5];
+  if (hasBits_[0] & 0x2u) {
+    [output writeGroup:2 value:complexOptionType5];
   }
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = PBGeneratedMessageGetMemoizedSize(&memoizedSerializedSize);
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
-  if (self.hasQux) {
-    size += computeInt32Size(1, self.qux);
+  size_ = 0;
+  if (hasBits_[0] & 0x1u) {
+    size_ += computeInt32Size(1, qux);
   }
-  if (self.hasComplexOptionType5) {
-    size += computeGroupSize(2, self.complexOptionType5);
+  if (hasBits_[0] & 0x2u) {
+    size_ += computeGroupSize(2, complexOptionType5);
   }
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
+  size_ += self.unknownFields.serializedSize;
+  PBGeneratedMessageSetMemoizedSize(&memoizedSerializedSize, size_);
+  return size_;
 }
 + (ComplexOptionType3*) parseFromData:(NSData*) data {
   return (ComplexOptionType3*)[[[ComplexOptionType3 builder] mergeFromData:data] build];
@@ -3297,7 +4577,7 @@ static ComplexOptionType3* defaultComplexOptionType3Instance = nil;
   return [[[ComplexOptionType3_Builder alloc] init] autorelease];
 }
 + (ComplexOptionType3_Builder*) builderWithPrototype:(ComplexOptionType3*) prototype {
-  return [[ComplexOptionType3 builder] mergeFrom:prototype];
+  return [[[ComplexOptionType3_Builder alloc] initWithPrototype:prototype] autorelease];
 }
 - (ComplexOptionType3_Builder*) builder {
   return [ComplexOptionType3 builder];
@@ -3306,12 +4586,12 @@ static ComplexOptionType3* defaultComplexOptionType3Instance = nil;
   return [ComplexOptionType3 builderWithPrototype:self];
 }
 - (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
-  if (self.hasQux) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"qux", [NSNumber numberWithInt:self.qux]];
+  if (hasBits_[0] & 0x1u) {
+    [output appendFormat:@"%@%@: %@\n", indent, @"qux", [NSNumber numberWithInt:qux]];
   }
-  if (self.hasComplexOptionType5) {
+  if (hasBits_[0] & 0x2u) {
     [output appendFormat:@"%@%@ {\n", indent, @"complexOptionType5"];
-    [self.complexOptionType5 writeDescriptionTo:output
+    [complexOptionType5 writeDescriptionTo:output
                          withIndent:[NSString stringWithFormat:@"%@  ", indent]];
     [output appendFormat:@"%@}\n", indent];
   }
@@ -3326,83 +4606,96 @@ static ComplexOptionType3* defaultComplexOptionType3Instance = nil;
   }
   ComplexOptionType3 *otherMessage = other;
   return
-      self.hasQux == otherMessage.hasQux &&
-      (!self.hasQux || self.qux == otherMessage.qux) &&
-      
-      self.hasComplexOptionType5 == otherMessage.hasComplexOptionType5 &&
-      (!self.hasComplexOptionType5 || [self.complexOptionType5 isEqual:otherMessage.complexOptionType5]) &&
-      
+      (hasBits_[0] & 0x1u) == (otherMessage->hasBits_[0] & 0x1u) &&
+      (!(hasBits_[0] & 0x1u) || qux == otherMessage->qux) &&
+      (hasBits_[0] & 0x2u) == (otherMessage->hasBits_[0] & 0x2u) &&
+      (!(hasBits_[0] & 0x2u) || [complexOptionType5 isEqual:otherMessage->complexOptionType5]) &&
       (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
 }
 - (NSUInteger) hash {
-  NSUInteger hashCode = 7;
-  if (self.hasQux) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithInt:self.qux] hash];
+  NSUInteger hash_ = PBGeneratedMessageGetMemoizedHash(&memoizedHash);
+  if (hash_ != 0) {
+    return hash_;
   }
-  if (self.hasComplexOptionType5) {
-    hashCode = hashCode * 31 + [self.complexOptionType5 hash];
+
+  uint64_t hashCode = 7;
+  if (hasBits_[0] & 0x1u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, (uint64_t)qux);
+  }
+  if (hasBits_[0] & 0x2u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [complexOptionType5 hash]);
   }
-  hashCode = hashCode * 31 + [self.unknownFields hash];
-  return hashCode;
+  hashCode = PBGeneratedMessageHashMix(hashCode, [self.unknownFields hash]);
+  hash_ = PBGeneratedMessageHashFinish(hashCode);
+  PBGeneratedMessageSetMemoizedHash(&memoizedHash, hash_);
+  return hash_;
 }
 @end
 
 @interface ComplexOptionType3_ComplexOptionType5 ()
-@property int32_t plugh;
+@property (nonatomic) int32_t plugh;
+@end
+
+@interface ComplexOptionType3_ComplexOptionType5_Builder()
+@property (nonatomic, retain) ComplexOptionType3_ComplexOptionType5* result;
+- (id) initWithPrototype:(ComplexOptionType3_ComplexOptionType5*) prototype;
+- (void) detachFromPrototype;
 @end
 
 @implementation ComplexOptionType3_ComplexOptionType5
 
 - (BOOL) hasPlugh {
-  return !!hasPlugh_;
+  return (hasBits_[0] & 0x1u) != 0;
 }
-- (void) setHasPlugh:(BOOL) value {
-  hasPlugh_ = !!value;
+- (void) setHasPlugh:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x1u;
+  } else {
+    hasBits_[0] &= ~0x1u;
+  }
 }
 @synthesize plugh;
 - (void) dealloc {
   [super dealloc];
 }
-- (id) init {
-  if ((self = [super init])) {
-    self.plugh = 0;
-  }
-  return self;
+- (void) clearForReuse {
+  [super clearForReuse];
+  memset(hasBits_, 0, sizeof(hasBits_));
+  plugh = 0;
 }
 static ComplexOptionType3_ComplexOptionType5* defaultComplexOptionType3_ComplexOptionType5Instance = nil;
-+ (void) initialize {
-  if (self == [ComplexOptionType3_ComplexOptionType5 class]) {
-    defaultComplexOptionType3_ComplexOptionType5Instance = [[ComplexOptionType3_ComplexOptionType5 alloc] init];
-  }
-}
 + (ComplexOptionType3_ComplexOptionType5*) defaultInstance {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultComplexOptionType3_ComplexOptionType5Instance = [[ComplexOptionType3_ComplexOptionType5 alloc] init];
+  });
   return defaultComplexOptionType3_ComplexOptionType5Instance;
 }
 - (ComplexOptionType3_ComplexOptionType5*) defaultInstance {
-  return defaultComplexOptionType3_ComplexOptionType5Instance;
+  return [ComplexOptionType3_ComplexOptionType5 defaultInstance];
 }
 - (BOOL) isInitialized {
   return YES;
 }
 - (void) writeToCodedOutputStream:(PBCodedOutputStream*) output {
-  if (self.hasPlugh) {
-    [output writeInt32:3 value:self.plugh];
+  if (hasBits_[0] & 0x1u) {
+    [output writeInt32:3 value:plugh];
   }
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = PBGeneratedMessageGetMemoizedSize(&memoizedSerializedSize);
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
-  if (self.hasPlugh) {
-    size += computeInt32Size(3, self.plugh);
+  size_ = 0;
+  if (hasBits_[0] & 0x1u) {
+    size_ += computeInt32Size(3, plugh);
   }
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
+  size_ += self.unknownFields.serializedSize;
+  PBGeneratedMessageSetMemoizedSize(&memoizedSerializedSize, size_);
+  return size_;
 }
 + (ComplexOptionType3_ComplexOptionType5*) parseFromData:(NSData*) data {
   return (ComplexOptionType3_ComplexOptionType5*)[[[ComplexOptionType3_ComplexOptionType5 builder] mergeFromData:data] build];
@@ -3426,7 +4719,7 @@ static ComplexOptionType3_ComplexOptionType5* defaultComplexOptionType3_ComplexO
   return [[[ComplexOptionType3_ComplexOptionType5_Builder alloc] init] autorelease];
 }
 + (ComplexOptionType3_ComplexOptionType5_Builder*) builderWithPrototype:(ComplexOptionType3_ComplexOptionType5*) prototype {
-  return [[ComplexOptionType3_ComplexOptionType5 builder] mergeFrom:prototype];
+  return [[[ComplexOptionType3_ComplexOptionType5_Builder alloc] initWithPrototype:prototype] autorelease];
 }
 - (ComplexOptionType3_ComplexOptionType5_Builder*) builder {
   return [ComplexOptionType3_ComplexOptionType5 builder];
@@ -3435,8 +4728,8 @@ static ComplexOptionType3_ComplexOptionType5* defaultComplexOptionType3_ComplexO
   return [ComplexOptionType3_ComplexOptionType5 builderWithPrototype:self];
 }
 - (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
-  if (self.hasPlugh) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"plugh", [NSNumber numberWithInt:self.plugh]];
+  if (hasBits_[0] & 0x1u) {
+    [output appendFormat:@"%@%@: %@\n", indent, @"plugh", [NSNumber numberWithInt:plugh]];
   }
   [self.unknownFields writeDescriptionTo:output withIndent:indent];
 }
@@ -3449,46 +4742,99 @@ static ComplexOptionType3_ComplexOptionType5* defaultComplexOptionType3_ComplexO
   }
   ComplexOptionType3_ComplexOptionType5 *otherMessage = other;
   return
-      self.hasPlugh == otherMessage.hasPlugh &&
-      (!self.hasPlugh || self.plugh == otherMessage.plugh) &&
-      
+      (hasBits_[0] & 0x1u) == (otherMessage->hasBits_[0] & 0x1u) &&
+      (!(hasBits_[0] & 0x1u) || plugh == otherMessage->plugh) &&
       (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
 }
 - (NSUInteger) hash {
-  NSUInteger hashCode = 7;
-  if (self.hasPlugh) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithInt:self.plugh] hash];
+  NSUInteger hash_ = PBGeneratedMessageGetMemoizedHash(&memoizedHash);
+  if (hash_ != 0) {
+    return hash_;
   }
-  hashCode = hashCode * 31 + [self.unknownFields hash];
-  return hashCode;
-}
-@end
 
-@interface ComplexOptionType3_ComplexOptionType5_Builder()
-@property (retain) ComplexOptionType3_ComplexOptionType5* result;
+  uint64_t hashCode = 7;
+  if (hasBits_[0] & 0x1u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, (uint64_t)plugh);
+  }
+  hashCode = PBGeneratedMessageHashMix(hashCode, [self.unknownFields hash]);
+  hash_ = PBGeneratedMessageHashFinish(hashCode);
+  PBGeneratedMessageSetMemoizedHash(&memoizedHash, hash_);
+  return hash_;
+}
 @end
 
 @implementation ComplexOptionType3_ComplexOptionType5_Builder
 @synthesize result;
 - (void) dealloc {
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
   self.result = nil;
+  [prototype_ release];
   [super dealloc];
 }
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[[ComplexOptionType3_ComplexOptionType5 alloc] init] autorelease];
+    result = [ComplexOptionType3_ComplexOptionType5 recycledInstance];
+  }
+  return self;
+}
+- (id) initWithPrototype:(ComplexOptionType3_ComplexOptionType5*) prototype {
+  if ((self = [super init])) {
+    self.result = prototype;
+    prototype_ = [prototype retain];
   }
   return self;
 }
+- (void) detachFromPrototype {
+  ComplexOptionType3_ComplexOptionType5* prototype = prototype_;
+  prototype_ = nil;
+  self.result = [[[ComplexOptionType3_ComplexOptionType5 alloc] init] autorelease];
+  [self mergeFrom:prototype];
+  [prototype release];
+}
+- (PBGeneratedMessage*) internalGetMutableResult {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return [self internalGetResult];
+}
 - (PBGeneratedMessage*) internalGetResult {
   return result;
 }
 - (ComplexOptionType3_ComplexOptionType5_Builder*) clear {
-  self.result = [[[ComplexOptionType3_ComplexOptionType5 alloc] init] autorelease];
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = [[ComplexOptionType3_ComplexOptionType5 recycledInstance] autorelease];
   return self;
 }
 - (ComplexOptionType3_ComplexOptionType5_Builder*) clone {
-  return [ComplexOptionType3_ComplexOptionType5 builderWithPrototype:result];
+  if (prototype_ != nil) {
+    return [[[ComplexOptionType3_ComplexOptionType5_Builder alloc] initWithPrototype:prototype_] autorelease];
+  }
+  return [[ComplexOptionType3_ComplexOptionType5 builder] mergeFrom:result];
+}
+- (ComplexOptionType3_ComplexOptionType5_Builder*) reset {
+  if (result == nil || prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    self.result = [[ComplexOptionType3_ComplexOptionType5 recycledInstance] autorelease];
+  } else {
+    [result clearForReuse];
+  }
+  return self;
+}
+- (ComplexOptionType3_ComplexOptionType5_Builder*) recycle:(ComplexOptionType3_ComplexOptionType5*) message {
+  if (message == [ComplexOptionType3_ComplexOptionType5 defaultInstance]) {
+    @throw [NSException exceptionWithName:@"IllegalArgument" reason:@"Cannot recycle the default instance" userInfo:nil];
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = message;
+  return [self reset];
 }
 - (ComplexOptionType3_ComplexOptionType5*) defaultInstance {
   return [ComplexOptionType3_ComplexOptionType5 defaultInstance];
@@ -3498,16 +4844,29 @@ static ComplexOptionType3_ComplexOptionType5* defaultComplexOptionType3_ComplexO
   return [self buildPartial];
 }
 - (ComplexOptionType3_ComplexOptionType5*) buildPartial {
-  ComplexOptionType3_ComplexOptionType5* returnMe = [[result retain] autorelease];
-  self.result = nil;
+  return [[self newBuildPartial] autorelease];
+}
+- (ComplexOptionType3_ComplexOptionType5*) newBuildPartial {
+  if (prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    ComplexOptionType3_ComplexOptionType5* returnMe = result;
+    result = nil;
+    return returnMe;
+  }
+  ComplexOptionType3_ComplexOptionType5* returnMe = result;
+  result = nil;
   return returnMe;
 }
 - (ComplexOptionType3_ComplexOptionType5_Builder*) mergeFrom:(ComplexOptionType3_ComplexOptionType5*) other {
   if (other == [ComplexOptionType3_ComplexOptionType5 defaultInstance]) {
     return self;
   }
-  if (other.hasPlugh) {
-    [self setPlugh:other.plugh];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (other->hasBits_[0] & 0x1u) {
+    [self setPlugh:other->plugh];
   }
   [self mergeUnknownFields:other.unknownFields];
   return self;
@@ -3516,18 +4875,29 @@ static ComplexOptionType3_ComplexOptionType5* defaultComplexOptionType3_ComplexO
   return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
 }
 - (ComplexOptionType3_ComplexOptionType5_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  PBUnknownFieldSet_Builder* unknownFields = nil;
   while (YES) {
     int32_t tag = [input readTag];
     switch (tag) {
       case 0:
-        [self setUnknownFields:[unknownFields build]];
+        if (unknownFields != nil) {
+          [self setUnknownFields:[unknownFields build]];
+        }
         return self;
       default: {
-        if (![self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag]) {
-          [self setUnknownFields:[unknownFields build]];
+        if (PBWireFormatGetTagWireType(tag) == PBWireFormatEndGroup) {
+          if (unknownFields != nil) {
+            [self setUnknownFields:[unknownFields build]];
+          }
           return self;
         }
+        if (unknownFields == nil) {
+          unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+        }
+        [self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag];
         break;
       }
       case 24: {
@@ -3538,48 +4908,129 @@ static ComplexOptionType3_ComplexOptionType5* defaultComplexOptionType3_ComplexO
   }
 }
 - (BOOL) hasPlugh {
-  return result.hasPlugh;
+  return (result->hasBits_[0] & 0x1u) != 0;
 }
 - (int32_t) plugh {
-  return result.plugh;
+  return result->plugh;
 }
 - (ComplexOptionType3_ComplexOptionType5_Builder*) setPlugh:(int32_t) value {
-  result.hasPlugh = YES;
-  result.plugh = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x1u;
+  result->plugh = value;
   return self;
 }
 - (ComplexOptionType3_ComplexOptionType5_Builder*) clearPlugh {
-  result.hasPlugh = NO;
-  result.plugh = 0;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x1u;
+  result->plugh = 0;
   return self;
 }
 @end
 
-@interface ComplexOptionType3_Builder()
-@property (retain) ComplexOptionType3* result;
-@end
-
 @implementation ComplexOptionType3_Builder
 @synthesize result;
 - (void) dealloc {
+  [self dropSubBuilders];
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
   self.result = nil;
+  [prototype_ release];
   [super dealloc];
 }
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[[ComplexOptionType3 alloc] init] autorelease];
+    result = [ComplexOptionType3 recycledInstance];
+  }
+  return self;
+}
+- (id) initWithPrototype:(ComplexOptionType3*) prototype {
+  if ((self = [super init])) {
+    self.result = prototype;
+    prototype_ = [prototype retain];
   }
   return self;
 }
+- (void) detachFromPrototype {
+  ComplexOptionType3* prototype = prototype_;
+  prototype_ = nil;
+  self.result = [[[ComplexOptionType3 alloc] init] autorelease];
+  [self mergeFrom:prototype];
+  [prototype release];
+}
+- (PBGeneratedMessage*) internalGetMutableResult {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return [self internalGetResult];
+}
+- (void) freezeSubBuilders {
+  if (complexOptionType5Builder_ != nil) {
+    ComplexOptionType3_ComplexOptionType5* value = [complexOptionType5Builder_ newBuildPartial];
+    result.complexOptionType5 = value;
+    [value release];
+    [complexOptionType5Builder_ release];
+    complexOptionType5Builder_ = nil;
+  }
+}
+- (void) dropSubBuilders {
+  [complexOptionType5Builder_ release];
+  complexOptionType5Builder_ = nil;
+  [complexOptionType5SpareBuilder_ release];
+  complexOptionType5SpareBuilder_ = nil;
+}
+- (void) resetSubBuilders {
+  if (complexOptionType5Builder_ != nil) {
+    [complexOptionType5Builder_ reset];
+    [complexOptionType5SpareBuilder_ release];
+    complexOptionType5SpareBuilder_ = complexOptionType5Builder_;
+    complexOptionType5Builder_ = nil;
+  }
+}
 - (PBGeneratedMessage*) internalGetResult {
+  [self freezeSubBuilders];
   return result;
 }
 - (ComplexOptionType3_Builder*) clear {
-  self.result = [[[ComplexOptionType3 alloc] init] autorelease];
+  [self dropSubBuilders];
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = [[ComplexOptionType3 recycledInstance] autorelease];
   return self;
 }
 - (ComplexOptionType3_Builder*) clone {
-  return [ComplexOptionType3 builderWithPrototype:result];
+  if (prototype_ != nil) {
+    return [[[ComplexOptionType3_Builder alloc] initWithPrototype:prototype_] autorelease];
+  }
+  [self freezeSubBuilders];
+  return [[ComplexOptionType3 builder] mergeFrom:result];
+}
+- (ComplexOptionType3_Builder*) reset {
+  [self resetSubBuilders];
+  if (result == nil || prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    self.result = [[ComplexOptionType3 recycledInstance] autorelease];
+  } else {
+    [result clearForReuse];
+  }
+  return self;
+}
+- (ComplexOptionType3_Builder*) recycle:(ComplexOptionType3*) message {
+  if (message == [ComplexOptionType3 defaultInstance]) {
+    @throw [NSException exceptionWithName:@"IllegalArgument" reason:@"Cannot recycle the default instance" userInfo:nil];
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = message;
+  return [self reset];
 }
 - (ComplexOptionType3*) defaultInstance {
   return [ComplexOptionType3 defaultInstance];
@@ -3589,19 +5040,33 @@ static ComplexOptionType3_ComplexOptionType5* defaultComplexOptionType3_ComplexO
   return [self buildPartial];
 }
 - (ComplexOptionType3*) buildPartial {
-  ComplexOptionType3* returnMe = [[result retain] autorelease];
-  self.result = nil;
+  return [[self newBuildPartial] autorelease];
+}
+- (ComplexOptionType3*) newBuildPartial {
+  if (prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    ComplexOptionType3* returnMe = result;
+    result = nil;
+    return returnMe;
+  }
+  [self freezeSubBuilders];
+  ComplexOptionType3* returnMe = result;
+  result = nil;
   return returnMe;
 }
 - (ComplexOptionType3_Builder*) mergeFrom:(ComplexOptionType3*) other {
   if (other == [ComplexOptionType3 defaultInstance]) {
     return self;
   }
-  if (other.hasQux) {
-    [self setQux:other.qux];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  if (other.hasComplexOptionType5) {
-    [self mergeComplexOptionType5:other.complexOptionType5];
+  if (other->hasBits_[0] & 0x1u) {
+    [self setQux:other->qux];
+  }
+  if (other->hasBits_[0] & 0x2u) {
+    [self mergeComplexOptionType5:other->complexOptionType5];
   }
   [self mergeUnknownFields:other.unknownFields];
   return self;
@@ -3610,18 +5075,29 @@ static ComplexOptionType3_ComplexOptionType5* defaultComplexOptionType3_ComplexO
   return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
 }
 - (ComplexOptionType3_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  PBUnknownFieldSet_Builder* unknownFields = nil;
   while (YES) {
     int32_t tag = [input readTag];
     switch (tag) {
       case 0:
-        [self setUnknownFields:[unknownFields build]];
+        if (unknownFields != nil) {
+          [self setUnknownFields:[unknownFields build]];
+        }
         return self;
       default: {
-        if (![self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag]) {
-          [self setUnknownFields:[unknownFields build]];
+        if (PBWireFormatGetTagWireType(tag) == PBWireFormatEndGroup) {
+          if (unknownFields != nil) {
+            [self setUnknownFields:[unknownFields build]];
+          }
           return self;
         }
+        if (unknownFields == nil) {
+          unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+        }
+        [self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag];
         break;
       }
       case 8: {
@@ -3629,41 +5105,56 @@ static ComplexOptionType3_ComplexOptionType5* defaultComplexOptionType3_ComplexO
         break;
       }
       case 19: {
-        ComplexOptionType3_ComplexOptionType5_Builder* subBuilder = [ComplexOptionType3_ComplexOptionType5 builder];
-        if (self.hasComplexOptionType5) {
-          [subBuilder mergeFrom:self.complexOptionType5];
+        if (complexOptionType5Builder_ == nil) {
+          complexOptionType5Builder_ = complexOptionType5SpareBuilder_ != nil ? complexOptionType5SpareBuilder_ : [[ComplexOptionType3_ComplexOptionType5_Builder alloc] init];
+          complexOptionType5SpareBuilder_ = nil;
+          if (result->hasBits_[0] & 0x2u) {
+            [complexOptionType5Builder_ mergeFrom:result->complexOptionType5];
+          }
+          result->hasBits_[0] |= 0x2u;
         }
-        [input readGroup:2 builder:subBuilder extensionRegistry:extensionRegistry];
-        [self setComplexOptionType5:[subBuilder buildPartial]];
+        [input readGroup:2 builder:complexOptionType5Builder_ extensionRegistry:extensionRegistry];
         break;
       }
     }
   }
 }
 - (BOOL) hasQux {
-  return result.hasQux;
+  return (result->hasBits_[0] & 0x1u) != 0;
 }
 - (int32_t) qux {
-  return result.qux;
+  return result->qux;
 }
 - (ComplexOptionType3_Builder*) setQux:(int32_t) value {
-  result.hasQux = YES;
-  result.qux = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x1u;
+  result->qux = value;
   return self;
 }
 - (ComplexOptionType3_Builder*) clearQux {
-  result.hasQux = NO;
-  result.qux = 0;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x1u;
+  result->qux = 0;
   return self;
 }
 - (BOOL) hasComplexOptionType5 {
-  return result.hasComplexOptionType5;
+  return (result->hasBits_[0] & 0x2u) != 0;
 }
 - (ComplexOptionType3_ComplexOptionType5*) complexOptionType5 {
+  [self freezeSubBuilders];
   return result.complexOptionType5;
 }
 - (ComplexOptionType3_Builder*) setComplexOptionType5:(ComplexOptionType3_ComplexOptionType5*) value {
-  result.hasComplexOptionType5 = YES;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  [complexOptionType5Builder_ release];
+  complexOptionType5Builder_ = nil;
+  result->hasBits_[0] |= 0x2u;
   result.complexOptionType5 = value;
   return self;
 }
@@ -3671,79 +5162,100 @@ static ComplexOptionType3_ComplexOptionType5* defaultComplexOptionType3_ComplexO
   return [self setComplexOptionType5:[builderForValue build]];
 }
 - (ComplexOptionType3_Builder*) mergeComplexOptionType5:(ComplexOptionType3_ComplexOptionType5*) value {
-  if (result.hasComplexOptionType5 &&
-      result.complexOptionType5 != [ComplexOptionType3_ComplexOptionType5 defaultInstance]) {
-    result.complexOptionType5 =
-      [[[ComplexOptionType3_ComplexOptionType5 builderWithPrototype:result.complexOptionType5] mergeFrom:value] buildPartial];
-  } else {
-    result.complexOptionType5 = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (complexOptionType5Builder_ == nil) {
+    if (!(result->hasBits_[0] & 0x2u) ||
+        result->complexOptionType5 == [ComplexOptionType3_ComplexOptionType5 defaultInstance]) {
+      result->hasBits_[0] |= 0x2u;
+      result.complexOptionType5 = value;
+      return self;
+    }
+    complexOptionType5Builder_ = complexOptionType5SpareBuilder_ != nil ? complexOptionType5SpareBuilder_ : [[ComplexOptionType3_ComplexOptionType5_Builder alloc] init];
+    complexOptionType5SpareBuilder_ = nil;
+    [complexOptionType5Builder_ mergeFrom:result->complexOptionType5];
   }
-  result.hasComplexOptionType5 = YES;
+  [complexOptionType5Builder_ mergeFrom:value];
   return self;
 }
 - (ComplexOptionType3_Builder*) clearComplexOptionType5 {
-  result.hasComplexOptionType5 = NO;
-  result.complexOptionType5 = [ComplexOptionType3_ComplexOptionType5 defaultInstance];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  [complexOptionType5Builder_ release];
+  complexOptionType5Builder_ = nil;
+  result->hasBits_[0] &= ~0x2u;
+  [result->complexOptionType5 release];
+  result->complexOptionType5 = nil;
   return self;
 }
 @end
 
 @interface ComplexOpt6 ()
-@property int32_t xyzzy;
+@property (nonatomic) int32_t xyzzy;
+@end
+
+@interface ComplexOpt6_Builder()
+@property (nonatomic, retain) ComplexOpt6* result;
+- (id) initWithPrototype:(ComplexOpt6*) prototype;
+- (void) detachFromPrototype;
 @end
 
 @implementation ComplexOpt6
 
 - (BOOL) hasXyzzy {
-  return !!hasXyzzy_;
+  return (hasBits_[0] & 0x1u) != 0;
 }
-- (void) setHasXyzzy:(BOOL) value {
-  hasXyzzy_ = !!value;
+- (void) setHasXyzzy:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x1u;
+  } else {
+    hasBits_[0] &= ~0x1u;
+  }
 }
 @synthesize xyzzy;
 - (void) dealloc {
   [super dealloc];
 }
-- (id) init {
-  if ((self = [super init])) {
-    self.xyzzy = 0;
-  }
-  return self;
+- (void) clearForReuse {
+  [super clearForReuse];
+  memset(hasBits_, 0, sizeof(hasBits_));
+  xyzzy = 0;
 }
 static ComplexOpt6* defaultComplexOpt6Instance = nil;
-+ (void) initialize {
-  if (self == [ComplexOpt6 class]) {
-    defaultComplexOpt6Instance = [[ComplexOpt6 alloc] init];
-  }
-}
 + (ComplexOpt6*) defaultInstance {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultComplexOpt6Instance = [[ComplexOpt6 alloc] init];
+  });
   return defaultComplexOpt6Instance;
 }
 - (ComplexOpt6*) defaultInstance {
-  return defaultComplexOpt6Instance;
+  return [ComplexOpt6 defaultInstance];
 }
 - (BOOL) isInitialized {
   return YES;
 }
 - (void) writeToCodedOutputStream:(PBCodedOutputStream*) output {
-  if (self.hasXyzzy) {
-    [output writeInt32:7593951 value:self.xyzzy];
+  if (hasBits_[0] & 0x1u) {
+    [output writeInt32:7593951 value:xyzzy];
   }
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = PBGeneratedMessageGetMemoizedSize(&memoizedSerializedSize);
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
-  if (self.hasXyzzy) {
-    size += computeInt32Size(7593951, self.xyzzy);
+  size_ = 0;
+  if (hasBits_[0] & 0x1u) {
+    size_ += computeInt32Size(7593951, xyzzy);
   }
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
+  size_ += self.unknownFields.serializedSize;
+  PBGeneratedMessageSetMemoizedSize(&memoizedSerializedSize, size_);
+  return size_;
 }
 + (ComplexOpt6*) parseFromData:(NSData*) data {
   return (ComplexOpt6*)[[[ComplexOpt6 builder] mergeFromData:data] build];
@@ -3767,7 +5279,7 @@ static ComplexOpt6* defaultComplexOpt6Instance = nil;
   return [[[ComplexOpt6_Builder alloc] init] autorelease];
 }
 + (ComplexOpt6_Builder*) builderWithPrototype:(ComplexOpt6*) prototype {
-  return [[ComplexOpt6 builder] mergeFrom:prototype];
+  return [[[ComplexOpt6_Builder alloc] initWithPrototype:prototype] autorelease];
 }
 - (ComplexOpt6_Builder*) builder {
   return [ComplexOpt6 builder];
@@ -3776,8 +5288,8 @@ static ComplexOpt6* defaultComplexOpt6Instance = nil;
   return [ComplexOpt6 builderWithPrototype:self];
 }
 - (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
-  if (self.hasXyzzy) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"xyzzy", [NSNumber numberWithInt:self.xyzzy]];
+  if (hasBits_[0] & 0x1u) {
+    [output appendFormat:@"%@%@: %@\n", indent, @"xyzzy", [NSNumber numberWithInt:xyzzy]];
   }
   [self.unknownFields writeDescriptionTo:output withIndent:indent];
 }
@@ -3790,46 +5302,99 @@ static ComplexOpt6* defaultComplexOpt6Instance = nil;
   }
   ComplexOpt6 *otherMessage = other;
   return
-      self.hasXyzzy == otherMessage.hasXyzzy &&
-      (!self.hasXyzzy || self.xyzzy == otherMessage.xyzzy) &&
-      
+      (hasBits_[0] & 0x1u) == (otherMessage->hasBits_[0] & 0x1u) &&
+      (!(hasBits_[0] & 0x1u) || xyzzy == otherMessage->xyzzy) &&
       (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
 }
 - (NSUInteger) hash {
-  NSUInteger hashCode = 7;
-  if (self.hasXyzzy) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithInt:self.xyzzy] hash];
+  NSUInteger hash_ = PBGeneratedMessageGetMemoizedHash(&memoizedHash);
+  if (hash_ != 0) {
+    return hash_;
   }
-  hashCode = hashCode * 31 + [self.unknownFields hash];
-  return hashCode;
-}
-@end
 
-@interface ComplexOpt6_Builder()
-@property (retain) ComplexOpt6* result;
+  uint64_t hashCode = 7;
+  if (hasBits_[0] & 0x1u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, (uint64_t)xyzzy);
+  }
+  hashCode = PBGeneratedMessageHashMix(hashCode, [self.unknownFields hash]);
+  hash_ = PBGeneratedMessageHashFinish(hashCode);
+  PBGeneratedMessageSetMemoizedHash(&memoizedHash, hash_);
+  return hash_;
+}
 @end
 
 @implementation ComplexOpt6_Builder
 @synthesize result;
 - (void) dealloc {
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
   self.result = nil;
+  [prototype_ release];
   [super dealloc];
 }
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[[ComplexOpt6 alloc] init] autorelease];
+    result = [ComplexOpt6 recycledInstance];
+  }
+  return self;
+}
+- (id) initWithPrototype:(ComplexOpt6*) prototype {
+  if ((self = [super init])) {
+    self.result = prototype;
+    prototype_ = [prototype retain];
   }
   return self;
 }
+- (void) detachFromPrototype {
+  ComplexOpt6* prototype = prototype_;
+  prototype_ = nil;
+  self.result = [[[ComplexOpt6 alloc] init] autorelease];
+  [self mergeFrom:prototype];
+  [prototype release];
+}
+- (PBGeneratedMessage*) internalGetMutableResult {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return [self internalGetResult];
+}
 - (PBGeneratedMessage*) internalGetResult {
   return result;
 }
 - (ComplexOpt6_Builder*) clear {
-  self.result = [[[ComplexOpt6 alloc] init] autorelease];
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = [[ComplexOpt6 recycledInstance] autorelease];
   return self;
 }
 - (ComplexOpt6_Builder*) clone {
-  return [ComplexOpt6 builderWithPrototype:result];
+  if (prototype_ != nil) {
+    return [[[ComplexOpt6_Builder alloc] initWithPrototype:prototype_] autorelease];
+  }
+  return [[ComplexOpt6 builder] mergeFrom:result];
+}
+- (ComplexOpt6_Builder*) reset {
+  if (result == nil || prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    self.result = [[ComplexOpt6 recycledInstance] autorelease];
+  } else {
+    [result clearForReuse];
+  }
+  return self;
+}
+- (ComplexOpt6_Builder*) recycle:(ComplexOpt6*) message {
+  if (message == [ComplexOpt6 defaultInstance]) {
+    @throw [NSException exceptionWithName:@"IllegalArgument" reason:@"Cannot recycle the default instance" userInfo:nil];
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = message;
+  return [self reset];
 }
 - (ComplexOpt6*) defaultInstance {
   return [ComplexOpt6 defaultInstance];
@@ -3839,16 +5404,29 @@ static ComplexOpt6* defaultComplexOpt6Instance = nil;
   return [self buildPartial];
 }
 - (ComplexOpt6*) buildPartial {
-  ComplexOpt6* returnMe = [[result retain] autorelease];
-  self.result = nil;
+  return [[self newBuildPartial] autorelease];
+}
+- (ComplexOpt6*) newBuildPartial {
+  if (prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    ComplexOpt6* returnMe = result;
+    result = nil;
+    return returnMe;
+  }
+  ComplexOpt6* returnMe = result;
+  result = nil;
   return returnMe;
 }
 - (ComplexOpt6_Builder*) mergeFrom:(ComplexOpt6*) other {
   if (other == [ComplexOpt6 defaultInstance]) {
     return self;
   }
-  if (other.hasXyzzy) {
-    [self setXyzzy:other.xyzzy];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (other->hasBits_[0] & 0x1u) {
+    [self setXyzzy:other->xyzzy];
   }
   [self mergeUnknownFields:other.unknownFields];
   return self;
@@ -3857,18 +5435,29 @@ static ComplexOpt6* defaultComplexOpt6Instance = nil;
   return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
 }
 - (ComplexOpt6_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  PBUnknownFieldSet_Builder* unknownFields = nil;
   while (YES) {
     int32_t tag = [input readTag];
     switch (tag) {
       case 0:
-        [self setUnknownFields:[unknownFields build]];
+        if (unknownFields != nil) {
+          [self setUnknownFields:[unknownFields build]];
+        }
         return self;
       default: {
-        if (![self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag]) {
-          [self setUnknownFields:[unknownFields build]];
+        if (PBWireFormatGetTagWireType(tag) == PBWireFormatEndGroup) {
+          if (unknownFields != nil) {
+            [self setUnknownFields:[unknownFields build]];
+          }
           return self;
         }
+        if (unknownFields == nil) {
+          unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+        }
+        [self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag];
         break;
       }
       case 60751608: {
@@ -3879,19 +5468,25 @@ static ComplexOpt6* defaultComplexOpt6Instance = nil;
   }
 }
 - (BOOL) hasXyzzy {
-  return result.hasXyzzy;
+  return (result->hasBits_[0] & 0x1u) != 0;
 }
 - (int32_t) xyzzy {
-  return result.xyzzy;
+  return result->xyzzy;
 }
 - (ComplexOpt6_Builder*) setXyzzy:(int32_t) value {
-  result.hasXyzzy = YES;
-  result.xyzzy = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x1u;
+  result->xyzzy = value;
   return self;
 }
 - (ComplexOpt6_Builder*) clearXyzzy {
-  result.hasXyzzy = NO;
-  result.xyzzy = 0;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x1u;
+  result->xyzzy = 0;
   return self;
 }
 @end
@@ -3899,27 +5494,31 @@ static ComplexOpt6* defaultComplexOpt6Instance = nil;
 @interface VariousComplexOptions ()
 @end
 
+@interface VariousComplexOptions_Builder()
+@property (nonatomic, retain) VariousComplexOptions* result;
+- (id) initWithPrototype:(VariousComplexOptions*) prototype;
+- (void) detachFromPrototype;
+@end
+
 @implementation VariousComplexOptions
 
 - (void) dealloc {
   [super dealloc];
 }
-- (id) init {
-  if ((self = [super init])) {
-  }
-  return self;
+- (void) clearForReuse {
+  [super clearForReuse];
+  memset(hasBits_, 0, sizeof(hasBits_));
 }
 static VariousComplexOptions* defaultVariousComplexOptionsInstance = nil;
-+ (void) initialize {
-  if (self == [VariousComplexOptions class]) {
-    defaultVariousComplexOptionsInstance = [[VariousComplexOptions alloc] init];
-  }
-}
 + (VariousComplexOptions*) defaultInstance {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultVariousComplexOptionsInstance = [[VariousComplexOptions alloc] init];
+  });
   return defaultVariousComplexOptionsInstance;
 }
 - (VariousComplexOptions*) defaultInstance {
-  return defaultVariousComplexOptionsInstance;
+  return [VariousComplexOptions defaultInstance];
 }
 - (BOOL) isInitialized {
   return YES;
@@ -3928,15 +5527,15 @@ static VariousComplexOptions* defaultVariousComplexOptionsInstance = nil;
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = PBGeneratedMessageGetMemoizedSize(&memoizedSerializedSize);
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
+  size_ = 0;
+  size_ += self.unknownFields.serializedSize;
+  PBGeneratedMessageSetMemoizedSize(&memoizedSerializedSize, size_);
+  return size_;
 }
 + (VariousComplexOptions*) parseFromData:(NSData*) data {
   return (VariousComplexOptions*)[[[VariousComplexOptions builder] mergeFromData:data] build];
@@ -3960,7 +5559,7 @@ static VariousComplexOptions* defaultVariousComplexOptionsInstance = nil;
   return [[[VariousComplexOptions_Builder alloc] init] autorelease];
 }
 + (VariousComplexOptions_Builder*) builderWithPrototype:(VariousComplexOptions*) prototype {
-  return [[VariousComplexOptions builder] mergeFrom:prototype];
+  return [[[VariousComplexOptions_Builder alloc] initWithPrototype:prototype] autorelease];
 }
 - (VariousComplexOptions_Builder*) builder {
   return [VariousComplexOptions builder];
@@ -3983,37 +5582,91 @@ static VariousComplexOptions* defaultVariousComplexOptionsInstance = nil;
       (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
 }
 - (NSUInteger) hash {
-  NSUInteger hashCode = 7;
-  hashCode = hashCode * 31 + [self.unknownFields hash];
-  return hashCode;
-}
-@end
+  NSUInteger hash_ = PBGeneratedMessageGetMemoizedHash(&memoizedHash);
+  if (hash_ != 0) {
+    return hash_;
+  }
 
-@interface VariousComplexOptions_Builder()
-@property (retain) VariousComplexOptions* result;
+  uint64_t hashCode = 7;
+  hashCode = PBGeneratedMessageHashMix(hashCode, [self.unknownFields hash]);
+  hash_ = PBGeneratedMessageHashFinish(hashCode);
+  PBGeneratedMessageSetMemoizedHash(&memoizedHash, hash_);
+  return hash_;
+}
 @end
 
 @implementation VariousComplexOptions_Builder
 @synthesize result;
 - (void) dealloc {
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
   self.result = nil;
+  [prototype_ release];
   [super dealloc];
 }
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[[VariousComplexOptions alloc] init] autorelease];
+    result = [VariousComplexOptions recycledInstance];
+  }
+  return self;
+}
+- (id) initWithPrototype:(VariousComplexOptions*) prototype {
+  if ((self = [super init])) {
+    self.result = prototype;
+    prototype_ = [prototype retain];
   }
   return self;
 }
+- (void) detachFromPrototype {
+  VariousComplexOptions* prototype = prototype_;
+  prototype_ = nil;
+  self.result = [[[VariousComplexOptions alloc] init] autorelease];
+  [self mergeFrom:prototype];
+  [prototype release];
+}
+- (PBGeneratedMessage*) internalGetMutableResult {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return [self internalGetResult];
+}
 - (PBGeneratedMessage*) internalGetResult {
   return result;
 }
-- (VariousComplexOptions_Builder*) clear {
-  self.result = [[[VariousComplexOptions alloc] init] autorelease];
+- (VariousComplexOptions_Builder*) clear {
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = [[VariousComplexOptions recycledInstance] autorelease];
+  return self;
+}
+- (VariousComplexOptions_Builder*) clone {
+  if (prototype_ != nil) {
+    return [[[VariousComplexOptions_Builder alloc] initWithPrototype:prototype_] autorelease];
+  }
+  return [[VariousComplexOptions builder] mergeFrom:result];
+}
+- (VariousComplexOptions_Builder*) reset {
+  if (result == nil || prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    self.result = [[VariousComplexOptions recycledInstance] autorelease];
+  } else {
+    [result clearForReuse];
+  }
   return self;
 }
-- (VariousComplexOptions_Builder*) clone {
-  return [VariousComplexOptions builderWithPrototype:result];
+- (VariousComplexOptions_Builder*) recycle:(VariousComplexOptions*) message {
+  if (message == [VariousComplexOptions defaultInstance]) {
+    @throw [NSException exceptionWithName:@"IllegalArgument" reason:@"Cannot recycle the default instance" userInfo:nil];
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = message;
+  return [self reset];
 }
 - (VariousComplexOptions*) defaultInstance {
   return [VariousComplexOptions defaultInstance];
@@ -4023,14 +5676,27 @@ static VariousComplexOptions* defaultVariousComplexOptionsInstance = nil;
   return [self buildPartial];
 }
 - (VariousComplexOptions*) buildPartial {
-  VariousComplexOptions* returnMe = [[result retain] autorelease];
-  self.result = nil;
+  return [[self newBuildPartial] autorelease];
+}
+- (VariousComplexOptions*) newBuildPartial {
+  if (prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    VariousComplexOptions* returnMe = result;
+    result = nil;
+    return returnMe;
+  }
+  VariousComplexOptions* returnMe = result;
+  result = nil;
   return returnMe;
 }
 - (VariousComplexOptions_Builder*) mergeFrom:(VariousComplexOptions*) other {
   if (other == [VariousComplexOptions defaultInstance]) {
     return self;
   }
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
   [self mergeUnknownFields:other.unknownFields];
   return self;
 }
@@ -4038,18 +5704,29 @@ static VariousComplexOptions* defaultVariousComplexOptionsInstance = nil;
   return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
 }
 - (VariousComplexOptions_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  PBUnknownFieldSet_Builder* unknownFields = nil;
   while (YES) {
     int32_t tag = [input readTag];
     switch (tag) {
       case 0:
-        [self setUnknownFields:[unknownFields build]];
+        if (unknownFields != nil) {
+          [self setUnknownFields:[unknownFields build]];
+        }
         return self;
       default: {
-        if (![self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag]) {
-          [self setUnknownFields:[unknownFields build]];
+        if (PBWireFormatGetTagWireType(tag) == PBWireFormatEndGroup) {
+          if (unknownFields != nil) {
+            [self setUnknownFields:[unknownFields build]];
+          }
           return self;
         }
+        if (unknownFields == nil) {
+          unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+        }
+        [self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag];
         break;
       }
     }
@@ -4058,6 +5735,13 @@ static VariousComplexOptions* defaultVariousComplexOptionsInstance = nil;
 @end
 
 @interface AggregateMessageSet ()
+- (void) setInitialized;
+@end
+
+@interface AggregateMessageSet_Builder()
+@property (nonatomic, retain) AggregateMessageSet* result;
+- (id) initWithPrototype:(AggregateMessageSet*) prototype;
+- (void) detachFromPrototype;
 @end
 
 @implementation AggregateMessageSet
@@ -4065,24 +5749,28 @@ static VariousComplexOptions* defaultVariousComplexOptionsInstance = nil;
 - (void) dealloc {
   [super dealloc];
 }
-- (id) init {
-  if ((self = [super init])) {
-  }
-  return self;
+- (void) clearForReuse {
+  [super clearForReuse];
+  memset(hasBits_, 0, sizeof(hasBits_));
 }
 static AggregateMessageSet* defaultAggregateMessageSetInstance = nil;
-+ (void) initialize {
-  if (self == [AggregateMessageSet class]) {
-    defaultAggregateMessageSetInstance = [[AggregateMessageSet alloc] init];
-  }
-}
 + (AggregateMessageSet*) defaultInstance {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultAggregateMessageSetInstance = [[AggregateMessageSet alloc] init];
+  });
   return defaultAggregateMessageSetInstance;
 }
 - (AggregateMessageSet*) defaultInstance {
-  return defaultAggregateMessageSetInstance;
+  return [AggregateMessageSet defaultInstance];
+}
+- (void) setInitialized {
+  hasBits_[0] |= 0x1u;
 }
 - (BOOL) isInitialized {
+  if ((hasBits_[0] & 0x1u) != 0) {
+    return YES;
+  }
   if (!self.extensionsAreInitialized) {
     return NO;
   }
@@ -4091,20 +5779,20 @@ static AggregateMessageSet* defaultAggregateMessageSetInstance = nil;
 - (void) writeToCodedOutputStream:(PBCodedOutputStream*) output {
   [self writeExtensionsToCodedOutputStream:output
                                       from:4
-                                        to:536870912];
+                                        to:2147483647];
   [self.unknownFields writeAsMessageSetTo:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = PBGeneratedMessageGetMemoizedSize(&memoizedSerializedSize);
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
-  size += [self extensionsSerializedSize];
-  size += self.unknownFields.serializedSizeAsMessageSet;
-  memoizedSerializedSize = size;
-  return size;
+  size_ = 0;
+  size_ += [self extensionsSerializedSize];
+  size_ += self.unknownFields.serializedSizeAsMessageSet;
+  PBGeneratedMessageSetMemoizedSize(&memoizedSerializedSize, size_);
+  return size_;
 }
 + (AggregateMessageSet*) parseFromData:(NSData*) data {
   return (AggregateMessageSet*)[[[AggregateMessageSet builder] mergeFromData:data] build];
@@ -4128,7 +5816,7 @@ static AggregateMessageSet* defaultAggregateMessageSetInstance = nil;
   return [[[AggregateMessageSet_Builder alloc] init] autorelease];
 }
 + (AggregateMessageSet_Builder*) builderWithPrototype:(AggregateMessageSet*) prototype {
-  return [[AggregateMessageSet builder] mergeFrom:prototype];
+  return [[[AggregateMessageSet_Builder alloc] initWithPrototype:prototype] autorelease];
 }
 - (AggregateMessageSet_Builder*) builder {
   return [AggregateMessageSet builder];
@@ -4139,7 +5827,7 @@ static AggregateMessageSet* defaultAggregateMessageSetInstance = nil;
 - (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
   [self writeExtensionDescriptionToMutableString:(NSMutableString*)output
                                             from:4
-                                              to:536870912
+                                              to:2147483647
                                       withIndent:indent];
   [self.unknownFields writeDescriptionTo:output withIndent:indent];
 }
@@ -4152,60 +5840,132 @@ static AggregateMessageSet* defaultAggregateMessageSetInstance = nil;
   }
   AggregateMessageSet *otherMessage = other;
   return
-      [self isEqualExtensionsInOther:otherMessage from:4 to:536870912] &&
-      
+      [self isEqualExtensionsInOther:otherMessage from:4 to:2147483647] &&
+
       (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
 }
 - (NSUInteger) hash {
-  NSUInteger hashCode = 7;
-  hashCode = hashCode * 31 + [self hashExtensionsFrom:4 to:536870912];
-  hashCode = hashCode * 31 + [self.unknownFields hash];
-  return hashCode;
-}
-@end
+  NSUInteger hash_ = PBGeneratedMessageGetMemoizedHash(&memoizedHash);
+  if (hash_ != 0) {
+    return hash_;
+  }
 
-@interface AggregateMessageSet_Builder()
-@property (retain) AggregateMessageSet* result;
+  uint64_t hashCode = 7;
+  hashCode = PBGeneratedMessageHashMix(hashCode, [self hashExtensionsFrom:4 to:2147483647]);
+  hashCode = PBGeneratedMessageHashMix(hashCode, [self.unknownFields hash]);
+  hash_ = PBGeneratedMessageHashFinish(hashCode);
+  PBGeneratedMessageSetMemoizedHash(&memoizedHash, hash_);
+  return hash_;
+}
 @end
 
 @implementation AggregateMessageSet_Builder
 @synthesize result;
 - (void) dealloc {
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
   self.result = nil;
+  [prototype_ release];
   [super dealloc];
 }
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[[AggregateMessageSet alloc] init] autorelease];
+    result = [AggregateMessageSet recycledInstance];
+  }
+  return self;
+}
+- (id) initWithPrototype:(AggregateMessageSet*) prototype {
+  if ((self = [super init])) {
+    self.result = prototype;
+    prototype_ = [prototype retain];
   }
   return self;
 }
+- (void) detachFromPrototype {
+  AggregateMessageSet* prototype = prototype_;
+  prototype_ = nil;
+  self.result = [[[AggregateMessageSet alloc] init] autorelease];
+  [self mergeFrom:prototype];
+  [prototype release];
+}
+- (PBExtendableMessage*) internalGetMutableResult {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return [self internalGetResult];
+}
 - (PBExtendableMessage*) internalGetResult {
   return result;
 }
 - (AggregateMessageSet_Builder*) clear {
-  self.result = [[[AggregateMessageSet alloc] init] autorelease];
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = [[AggregateMessageSet recycledInstance] autorelease];
   return self;
 }
 - (AggregateMessageSet_Builder*) clone {
-  return [AggregateMessageSet builderWithPrototype:result];
+  if (prototype_ != nil) {
+    return [[[AggregateMessageSet_Builder alloc] initWithPrototype:prototype_] autorelease];
+  }
+  return [[AggregateMessageSet builder] mergeFrom:result];
+}
+- (AggregateMessageSet_Builder*) reset {
+  if (result == nil || prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    self.result = [[AggregateMessageSet recycledInstance] autorelease];
+  } else {
+    [result clearForReuse];
+  }
+  return self;
+}
+- (AggregateMessageSet_Builder*) recycle:(AggregateMessageSet*) message {
+  if (message == [AggregateMessageSet defaultInstance]) {
+    @throw [NSException exceptionWithName:@"IllegalArgument" reason:@"Cannot recycle the default instance" userInfo:nil];
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = message;
+  return [self reset];
 }
 - (AggregateMessageSet*) defaultInstance {
   return [AggregateMessageSet defaultInstance];
 }
 - (AggregateMessageSet*) build {
   [self checkInitialized];
-  return [self buildPartial];
+  BOOL shared = prototype_ != nil;
+  AggregateMessageSet* returnMe = [self buildPartial];
+  if (!shared) {
+    [returnMe setInitialized];
+  }
+  return returnMe;
 }
 - (AggregateMessageSet*) buildPartial {
-  AggregateMessageSet* returnMe = [[result retain] autorelease];
-  self.result = nil;
+  return [[self newBuildPartial] autorelease];
+}
+- (AggregateMessageSet*) newBuildPartial {
+  if (prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    AggregateMessageSet* returnMe = result;
+    result = nil;
+    return returnMe;
+  }
+  AggregateMessageSet* returnMe = result;
+  result = nil;
   return returnMe;
 }
 - (AggregateMessageSet_Builder*) mergeFrom:(AggregateMessageSet*) other {
   if (other == [AggregateMessageSet defaultInstance]) {
     return self;
   }
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
   [self mergeExtensionFields:other];
   [self mergeUnknownFields:other.unknownFields];
   return self;
@@ -4214,18 +5974,29 @@ static AggregateMessageSet* defaultAggregateMessageSetInstance = nil;
   return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
 }
 - (AggregateMessageSet_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  PBUnknownFieldSet_Builder* unknownFields = nil;
   while (YES) {
     int32_t tag = [input readTag];
     switch (tag) {
       case 0:
-        [self setUnknownFields:[unknownFields build]];
+        if (unknownFields != nil) {
+          [self setUnknownFields:[unknownFields build]];
+        }
         return self;
       default: {
-        if (![self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag]) {
-          [self setUnknownFields:[unknownFields build]];
+        if (PBWireFormatGetTagWireType(tag) == PBWireFormatEndGroup) {
+          if (unknownFields != nil) {
+            [self setUnknownFields:[unknownFields build]];
+          }
           return self;
         }
+        if (unknownFields == nil) {
+          unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+        }
+        [self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag];
         break;
       }
     }
@@ -4234,65 +6005,77 @@ static AggregateMessageSet* defaultAggregateMessageSetInstance = nil;
 @end
 
 @interface AggregateMessageSetElement ()
-@property (retain) NSString* s;
+@property (nonatomic, retain) NSString* s;
+@end
+
+@interface AggregateMessageSetElement_Builder()
+@property (nonatomic, retain) AggregateMessageSetElement* result;
+- (id) initWithPrototype:(AggregateMessageSetElement*) prototype;
+- (void) detachFromPrototype;
 @end
 
 @implementation AggregateMessageSetElement
 
 - (BOOL) hasS {
-  return !!hasS_;
+  return (hasBits_[0] & 0x1u) != 0;
 }
-- (void) setHasS:(BOOL) value {
-  hasS_ = !!value;
+- (void) setHasS:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x1u;
+  } else {
+    hasBits_[0] &= ~0x1u;
+  }
 }
 @synthesize s;
+- (NSString*) s {
+  return (hasBits_[0] & 0x1u) ? s : @"";
+}
 - (void) dealloc {
-  self.s = nil;
+  [s release];
   [super dealloc];
 }
-- (id) init {
-  if ((self = [super init])) {
-    self.s = @"";
-  }
-  return self;
+- (void) clearForReuse {
+  [super clearForReuse];
+  memset(hasBits_, 0, sizeof(hasBits_));
+  [s release];
+  s = nil;
 }
 + (id<PBExtensionField>) messageSetExtension {
   return AggregateMessageSetElement_messageSetExtension;
 }
 static AggregateMessageSetElement* defaultAggregateMessageSetElementInstance = nil;
-+ (void) initialize {
-  if (self == [AggregateMessageSetElement class]) {
-    defaultAggregateMessageSetElementInstance = [[AggregateMessageSetElement alloc] init];
-  }
-}
 + (AggregateMessageSetElement*) defaultInstance {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultAggregateMessageSetElementInstance = [[AggregateMessageSetElement alloc] init];
+  });
   return defaultAggregateMessageSetElementInstance;
 }
 - (AggregateMessageSetElement*) defaultInstance {
-  return defaultAggregateMessageSetElementInstance;
+  return [AggregateMessageSetElement defaultInstance];
 }
 - (BOOL) isInitialized {
   return YES;
 }
 - (void) writeToCodedOutputStream:(PBCodedOutputStream*) output {
-  if (self.hasS) {
-    [output writeString:1 value:self.s];
+  if (hasBits_[0] & 0x1u) {
+    [output writeString:1 value:s];
   }
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = PBGeneratedMessageGetMemoizedSize(&memoizedSerializedSize);
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
-  if (self.hasS) {
-    size += computeStringSize(1, self.s);
+  size_ = 0;
+  if (hasBits_[0] & 0x1u) {
+    size_ += computeStringSize(1, s);
   }
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
+  size_ += self.unknownFields.serializedSize;
+  PBGeneratedMessageSetMemoizedSize(&memoizedSerializedSize, size_);
+  return size_;
 }
 + (AggregateMessageSetElement*) parseFromData:(NSData*) data {
   return (AggregateMessageSetElement*)[[[AggregateMessageSetElement builder] mergeFromData:data] build];
@@ -4316,7 +6099,7 @@ static AggregateMessageSetElement* defaultAggregateMessageSetElementInstance = n
   return [[[AggregateMessageSetElement_Builder alloc] init] autorelease];
 }
 + (AggregateMessageSetElement_Builder*) builderWithPrototype:(AggregateMessageSetElement*) prototype {
-  return [[AggregateMessageSetElement builder] mergeFrom:prototype];
+  return [[[AggregateMessageSetElement_Builder alloc] initWithPrototype:prototype] autorelease];
 }
 - (AggregateMessageSetElement_Builder*) builder {
   return [AggregateMessageSetElement builder];
@@ -4325,8 +6108,8 @@ static AggregateMessageSetElement* defaultAggregateMessageSetElementInstance = n
   return [AggregateMessageSetElement builderWithPrototype:self];
 }
 - (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
-  if (self.hasS) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"s", self.s];
+  if (hasBits_[0] & 0x1u) {
+    [output appendFormat:@"%@%@: %@\n", indent, @"s", s];
   }
   [self.unknownFields writeDescriptionTo:output withIndent:indent];
 }
@@ -4339,46 +6122,99 @@ static AggregateMessageSetElement* defaultAggregateMessageSetElementInstance = n
   }
   AggregateMessageSetElement *otherMessage = other;
   return
-      self.hasS == otherMessage.hasS &&
-      (!self.hasS || [self.s isEqual:otherMessage.s]) &&
-      
+      (hasBits_[0] & 0x1u) == (otherMessage->hasBits_[0] & 0x1u) &&
+      (!(hasBits_[0] & 0x1u) || [s isEqual:otherMessage->s]) &&
       (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
 }
 - (NSUInteger) hash {
-  NSUInteger hashCode = 7;
-  if (self.hasS) {
-    hashCode = hashCode * 31 + [self.s hash];
+  NSUInteger hash_ = PBGeneratedMessageGetMemoizedHash(&memoizedHash);
+  if (hash_ != 0) {
+    return hash_;
   }
-  hashCode = hashCode * 31 + [self.unknownFields hash];
-  return hashCode;
-}
-@end
 
-@interface AggregateMessageSetElement_Builder()
-@property (retain) AggregateMessageSetElement* result;
+  uint64_t hashCode = 7;
+  if (hasBits_[0] & 0x1u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [s hash]);
+  }
+  hashCode = PBGeneratedMessageHashMix(hashCode, [self.unknownFields hash]);
+  hash_ = PBGeneratedMessageHashFinish(hashCode);
+  PBGeneratedMessageSetMemoizedHash(&memoizedHash, hash_);
+  return hash_;
+}
 @end
 
 @implementation AggregateMessageSetElement_Builder
 @synthesize result;
 - (void) dealloc {
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
   self.result = nil;
+  [prototype_ release];
   [super dealloc];
 }
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[[AggregateMessageSetElement alloc] init] autorelease];
+    result = [AggregateMessageSetElement recycledInstance];
+  }
+  return self;
+}
+- (id) initWithPrototype:(AggregateMessageSetElement*) prototype {
+  if ((self = [super init])) {
+    self.result = prototype;
+    prototype_ = [prototype retain];
   }
   return self;
 }
+- (void) detachFromPrototype {
+  AggregateMessageSetElement* prototype = prototype_;
+  prototype_ = nil;
+  self.result = [[[AggregateMessageSetElement alloc] init] autorelease];
+  [self mergeFrom:prototype];
+  [prototype release];
+}
+- (PBGeneratedMessage*) internalGetMutableResult {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return [self internalGetResult];
+}
 - (PBGeneratedMessage*) internalGetResult {
   return result;
 }
 - (AggregateMessageSetElement_Builder*) clear {
-  self.result = [[[AggregateMessageSetElement alloc] init] autorelease];
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = [[AggregateMessageSetElement recycledInstance] autorelease];
   return self;
 }
 - (AggregateMessageSetElement_Builder*) clone {
-  return [AggregateMessageSetElement builderWithPrototype:result];
+  if (prototype_ != nil) {
+    return [[[AggregateMessageSetElement_Builder alloc] initWithPrototype:prototype_] autorelease];
+  }
+  return [[AggregateMessageSetElement builder] mergeFrom:result];
+}
+- (AggregateMessageSetElement_Builder*) reset {
+  if (result == nil || prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    self.result = [[AggregateMessageSetElement recycledInstance] autorelease];
+  } else {
+    [result clearForReuse];
+  }
+  return self;
+}
+- (AggregateMessageSetElement_Builder*) recycle:(AggregateMessageSetElement*) message {
+  if (message == [AggregateMessageSetElement defaultInstance]) {
+    @throw [NSException exceptionWithName:@"IllegalArgument" reason:@"Cannot recycle the default instance" userInfo:nil];
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = message;
+  return [self reset];
 }
 - (AggregateMessageSetElement*) defaultInstance {
   return [AggregateMessageSetElement defaultInstance];
@@ -4388,16 +6224,29 @@ static AggregateMessageSetElement* defaultAggregateMessageSetElementInstance = n
   return [self buildPartial];
 }
 - (AggregateMessageSetElement*) buildPartial {
-  AggregateMessageSetElement* returnMe = [[result retain] autorelease];
-  self.result = nil;
+  return [[self newBuildPartial] autorelease];
+}
+- (AggregateMessageSetElement*) newBuildPartial {
+  if (prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    AggregateMessageSetElement* returnMe = result;
+    result = nil;
+    return returnMe;
+  }
+  AggregateMessageSetElement* returnMe = result;
+  result = nil;
   return returnMe;
 }
 - (AggregateMessageSetElement_Builder*) mergeFrom:(AggregateMessageSetElement*) other {
   if (other == [AggregateMessageSetElement defaultInstance]) {
     return self;
   }
-  if (other.hasS) {
-    [self setS:other.s];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (other->hasBits_[0] & 0x1u) {
+    [self setS:other->s];
   }
   [self mergeUnknownFields:other.unknownFields];
   return self;
@@ -4406,183 +6255,253 @@ static AggregateMessageSetElement* defaultAggregateMessageSetElementInstance = n
   return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
 }
 - (AggregateMessageSetElement_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  PBUnknownFieldSet_Builder* unknownFields = nil;
   while (YES) {
     int32_t tag = [input readTag];
     switch (tag) {
       case 0:
-        [self setUnknownFields:[unknownFields build]];
+        if (unknownFields != nil) {
+          [self setUnknownFields:[unknownFields build]];
+        }
         return self;
       default: {
-        if (![self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag]) {
-          [self setUnknownFields:[unknownFields build]];
+        if (PBWireFormatGetTagWireType(tag) == PBWireFormatEndGroup) {
+          if (unknownFields != nil) {
+            [self setUnknownFields:[unknownFields build]];
+          }
           return self;
         }
+        if (unknownFields == nil) {
+          unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+        }
+        [self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag];
         break;
       }
       case 10: {
-        [self setS:[input readString]];
+        NSString* value = [input newString];
+        [self setS:value];
+        [value release];
         break;
       }
     }
   }
 }
 - (BOOL) hasS {
-  return result.hasS;
+  return (result->hasBits_[0] & 0x1u) != 0;
 }
 - (NSString*) s {
-  return result.s;
+  return [result s];
 }
 - (AggregateMessageSetElement_Builder*) setS:(NSString*) value {
-  result.hasS = YES;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x1u;
   result.s = value;
   return self;
 }
 - (AggregateMessageSetElement_Builder*) clearS {
-  result.hasS = NO;
-  result.s = @"";
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x1u;
+  [result->s release];
+  result->s = nil;
   return self;
 }
 @end
 
 @interface Aggregate ()
-@property int32_t i;
-@property (retain) NSString* s;
-@property (retain) Aggregate* sub;
-@property (retain) PBFileOptions* file;
-@property (retain) AggregateMessageSet* mset;
+@property (nonatomic) int32_t i;
+@property (nonatomic, retain) NSString* s;
+@property (nonatomic, retain) Aggregate* sub;
+@property (nonatomic, retain) PBFileOptions* file;
+@property (nonatomic, retain) AggregateMessageSet* mset;
+- (void) setInitialized;
+@end
+
+@interface Aggregate_Builder()
+@property (nonatomic, retain) Aggregate* result;
+- (id) initWithPrototype:(Aggregate*) prototype;
+- (void) detachFromPrototype;
+- (void) freezeSubBuilders;
+- (void) dropSubBuilders;
+- (void) resetSubBuilders;
 @end
 
 @implementation Aggregate
 
 - (BOOL) hasI {
-  return !!hasI_;
+  return (hasBits_[0] & 0x1u) != 0;
 }
-- (void) setHasI:(BOOL) value {
-  hasI_ = !!value;
+- (void) setHasI:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x1u;
+  } else {
+    hasBits_[0] &= ~0x1u;
+  }
 }
 @synthesize i;
 - (BOOL) hasS {
-  return !!hasS_;
+  return (hasBits_[0] & 0x2u) != 0;
 }
-- (void) setHasS:(BOOL) value {
-  hasS_ = !!value;
+- (void) setHasS:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x2u;
+  } else {
+    hasBits_[0] &= ~0x2u;
+  }
 }
 @synthesize s;
+- (NSString*) s {
+  return (hasBits_[0] & 0x2u) ? s : @"";
+}
 - (BOOL) hasSub {
-  return !!hasSub_;
+  return (hasBits_[0] & 0x4u) != 0;
 }
-- (void) setHasSub:(BOOL) value {
-  hasSub_ = !!value;
+- (void) setHasSub:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x4u;
+  } else {
+    hasBits_[0] &= ~0x4u;
+  }
 }
 @synthesize sub;
+- (Aggregate*) sub {
+  return sub != nil ? sub : [Aggregate defaultInstance];
+}
 - (BOOL) hasFile {
-  return !!hasFile_;
+  return (hasBits_[0] & 0x8u) != 0;
 }
-- (void) setHasFile:(BOOL) value {
-  hasFile_ = !!value;
+- (void) setHasFile:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x8u;
+  } else {
+    hasBits_[0] &= ~0x8u;
+  }
 }
 @synthesize file;
+- (PBFileOptions*) file {
+  return file != nil ? file : [PBFileOptions defaultInstance];
+}
 - (BOOL) hasMset {
-  return !!hasMset_;
+  return (hasBits_[0] & 0x10u) != 0;
 }
-- (void) setHasMset:(BOOL) value {
-  hasMset_ = !!value;
+- (void) setHasMset:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x10u;
+  } else {
+    hasBits_[0] &= ~0x10u;
+  }
 }
 @synthesize mset;
+- (AggregateMessageSet*) mset {
+  return mset != nil ? mset : [AggregateMessageSet defaultInstance];
+}
 - (void) dealloc {
-  self.s = nil;
-  self.sub = nil;
-  self.file = nil;
-  self.mset = nil;
+  [s release];
+  [sub release];
+  [file release];
+  [mset release];
   [super dealloc];
 }
-- (id) init {
-  if ((self = [super init])) {
-    self.i = 0;
-    self.s = @"";
-    self.sub = [Aggregate defaultInstance];
-    self.file = [PBFileOptions defaultInstance];
-    self.mset = [AggregateMessageSet defaultInstance];
-  }
-  return self;
+- (void) clearForReuse {
+  [super clearForReuse];
+  memset(hasBits_, 0, sizeof(hasBits_));
+  i = 0;
+  [s release];
+  s = nil;
+  [sub release];
+  sub = nil;
+  [file release];
+  file = nil;
+  [mset release];
+  mset = nil;
 }
 + (id<PBExtensionField>) nested {
   return Aggregate_nested;
 }
 static Aggregate* defaultAggregateInstance = nil;
-+ (void) initialize {
-  if (self == [Aggregate class]) {
-    defaultAggregateInstance = [[Aggregate alloc] init];
-  }
-}
 + (Aggregate*) defaultInstance {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultAggregateInstance = [[Aggregate alloc] init];
+  });
   return defaultAggregateInstance;
 }
 - (Aggregate*) defaultInstance {
-  return defaultAggregateInstance;
+  return [Aggregate defaultInstance];
+}
+- (void) setInitialized {
+  hasBits_[0] |= 0x20u;
 }
 - (BOOL) isInitialized {
-  if (self.hasSub) {
-    if (!self.sub.isInitialized) {
+  if ((hasBits_[0] & 0x20u) != 0) {
+    return YES;
+  }
+  if ((hasBits_[0] & 0x4u) != 0) {
+    if (!sub.isInitialized) {
       return NO;
     }
   }
-  if (self.hasFile) {
-    if (!self.file.isInitialized) {
+  if ((hasBits_[0] & 0x8u) != 0) {
+    if (!file.isInitialized) {
       return NO;
     }
   }
-  if (self.hasMset) {
-    if (!self.mset.isInitialized) {
+  if ((hasBits_[0] & 0x10u) != 0) {
+    if (!mset.isInitialized) {
       return NO;
     }
   }
   return YES;
 }
 - (void) writeToCodedOutputStream:(PBCodedOutputStream*) output {
-  if (self.hasI) {
-    [output writeInt32:1 value:self.i];
+  if (hasBits_[0] & 0x1u) {
+    [output writeInt32:1 value:i];
   }
-  if (self.hasS) {
-    [output writeString:2 value:self.s];
+  if (hasBits_[0] & 0x2u) {
+    [output writeString:2 value:s];
   }
-  if (self.hasSub) {
-    [output writeMessage:3 value:self.sub];
+  if (hasBits_[0] & 0x4u) {
+    [output writeMessage:3 value:sub];
   }
-  if (self.hasFile) {
-    [output writeMessage:4 value:self.file];
+  if (hasBits_[0] & 0x8u) {
+    [output writeMessage:4 value:file];
   }
-  if (self.hasMset) {
-    [output writeMessage:5 value:self.mset];
+  if (hasBits_[0] & 0x10u) {
+    [output writeMessage:5 value:mset];
   }
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = PBGeneratedMessageGetMemoizedSize(&memoizedSerializedSize);
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
-  if (self.hasI) {
-    size += computeInt32Size(1, self.i);
+  size_ = 0;
+  if (hasBits_[0] & 0x1u) {
+    size_ += computeInt32Size(1, i);
   }
-  if (self.hasS) {
-    size += computeStringSize(2, self.s);
+  if (hasBits_[0] & 0x2u) {
+    size_ += computeStringSize(2, s);
   }
-  if (self.hasSub) {
-    size += computeMessageSize(3, self.sub);
+  if (hasBits_[0] & 0x4u) {
+    size_ += computeMessageSize(3, sub);
   }
-  if (self.hasFile) {
-    size += computeMessageSize(4, self.file);
+  if (hasBits_[0] & 0x8u) {
+    size_ += computeMessageSize(4, file);
   }
-  if (self.hasMset) {
-    size += computeMessageSize(5, self.mset);
+  if (hasBits_[0] & 0x10u) {
+    size_ += computeMessageSize(5, mset);
   }
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
+  size_ += self.unknownFields.serializedSize;
+  PBGeneratedMessageSetMemoizedSize(&memoizedSerializedSize, size_);
+  return size_;
 }
 + (Aggregate*) parseFromData:(NSData*) data {
   return (Aggregate*)[[[Aggregate builder] mergeFromData:data] build];
@@ -4606,7 +6525,7 @@ static Aggregate* defaultAggregateInstance = nil;
   return [[[Aggregate_Builder alloc] init] autorelease];
 }
 + (Aggregate_Builder*) builderWithPrototype:(Aggregate*) prototype {
-  return [[Aggregate builder] mergeFrom:prototype];
+  return [[[Aggregate_Builder alloc] initWithPrototype:prototype] autorelease];
 }
 - (Aggregate_Builder*) builder {
   return [Aggregate builder];
@@ -4615,27 +6534,27 @@ static Aggregate* defaultAggregateInstance = nil;
   return [Aggregate builderWithPrototype:self];
 }
 - (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
-  if (self.hasI) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"i", [NSNumber numberWithInt:self.i]];
+  if (hasBits_[0] & 0x1u) {
+    [output appendFormat:@"%@%@: %@\n", indent, @"i", [NSNumber numberWithInt:i]];
   }
-  if (self.hasS) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"s", self.s];
+  if (hasBits_[0] & 0x2u) {
+    [output appendFormat:@"%@%@: %@\n", indent, @"s", s];
   }
-  if (self.hasSub) {
+  if (hasBits_[0] & 0x4u) {
     [output appendFormat:@"%@%@ {\n", indent, @"sub"];
-    [self.sub writeDescriptionTo:output
+    [sub writeDescriptionTo:output
                          withIndent:[NSString stringWithFormat:@"%@  ", indent]];
     [output appendFormat:@"%@}\n", indent];
   }
-  if (self.hasFile) {
+  if (hasBits_[0] & 0x8u) {
     [output appendFormat:@"%@%@ {\n", indent, @"file"];
-    [self.file writeDescriptionTo:output
+    [file writeDescriptionTo:output
                          withIndent:[NSString stringWithFormat:@"%@  ", indent]];
     [output appendFormat:@"%@}\n", indent];
   }
-  if (self.hasMset) {
+  if (hasBits_[0] & 0x10u) {
     [output appendFormat:@"%@%@ {\n", indent, @"mset"];
-    [self.mset writeDescriptionTo:output
+    [mset writeDescriptionTo:output
                          withIndent:[NSString stringWithFormat:@"%@  ", indent]];
     [output appendFormat:@"%@}\n", indent];
   }
@@ -4650,101 +6569,231 @@ static Aggregate* defaultAggregateInstance = nil;
   }
   Aggregate *otherMessage = other;
   return
-      self.hasI == otherMessage.hasI &&
-      (!self.hasI || self.i == otherMessage.i) &&
-      
-      self.hasS == otherMessage.hasS &&
-      (!self.hasS || [self.s isEqual:otherMessage.s]) &&
-      
-      self.hasSub == otherMessage.hasSub &&
-      (!self.hasSub || [self.sub isEqual:otherMessage.sub]) &&
-      
-      self.hasFile == otherMessage.hasFile &&
-      (!self.hasFile || [self.file isEqual:otherMessage.file]) &&
-      
-      self.hasMset == otherMessage.hasMset &&
-      (!self.hasMset || [self.mset isEqual:otherMessage.mset]) &&
-      
+      (hasBits_[0] & 0x1u) == (otherMessage->hasBits_[0] & 0x1u) &&
+      (!(hasBits_[0] & 0x1u) || i == otherMessage->i) &&
+      (hasBits_[0] & 0x2u) == (otherMessage->hasBits_[0] & 0x2u) &&
+      (!(hasBits_[0] & 0x2u) || [s isEqual:otherMessage->s]) &&
+      (hasBits_[0] & 0x4u) == (otherMessage->hasBits_[0] & 0x4u) &&
+      (!(hasBits_[0] & 0x4u) || [sub isEqual:otherMessage->sub]) &&
+      (hasBits_[0] & 0x8u) == (otherMessage->hasBits_[0] & 0x8u) &&
+      (!(hasBits_[0] & 0x8u) || [file isEqual:otherMessage->file]) &&
+      (hasBits_[0] & 0x10u) == (otherMessage->hasBits_[0] & 0x10u) &&
+      (!(hasBits_[0] & 0x10u) || [mset isEqual:otherMessage->mset]) &&
       (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
 }
 - (NSUInteger) hash {
-  NSUInteger hashCode = 7;
-  if (self.hasI) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithInt:self.i] hash];
+  NSUInteger hash_ = PBGeneratedMessageGetMemoizedHash(&memoizedHash);
+  if (hash_ != 0) {
+    return hash_;
+  }
+
+  uint64_t hashCode = 7;
+  if (hasBits_[0] & 0x1u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, (uint64_t)i);
   }
-  if (self.hasS) {
-    hashCode = hashCode * 31 + [self.s hash];
+  if (hasBits_[0] & 0x2u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [s hash]);
   }
-  if (self.hasSub) {
-    hashCode = hashCode * 31 + [self.sub hash];
+  if (hasBits_[0] & 0x4u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [sub hash]);
   }
-  if (self.hasFile) {
-    hashCode = hashCode * 31 + [self.file hash];
+  if (hasBits_[0] & 0x8u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [file hash]);
   }
-  if (self.hasMset) {
-    hashCode = hashCode * 31 + [self.mset hash];
+  if (hasBits_[0] & 0x10u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [mset hash]);
   }
-  hashCode = hashCode * 31 + [self.unknownFields hash];
-  return hashCode;
+  hashCode = PBGeneratedMessageHashMix(hashCode, [self.unknownFields hash]);
+  hash_ = PBGeneratedMessageHashFinish(hashCode);
+  PBGeneratedMessageSetMemoizedHash(&memoizedHash, hash_);
+  return hash_;
 }
 @end
 
-@interface Aggregate_Builder()
-@property (retain) Aggregate* result;
-@end
-
 @implementation Aggregate_Builder
 @synthesize result;
 - (void) dealloc {
+  [self dropSubBuilders];
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
   self.result = nil;
+  [prototype_ release];
   [super dealloc];
 }
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[[Aggregate alloc] init] autorelease];
+    result = [Aggregate recycledInstance];
+  }
+  return self;
+}
+- (id) initWithPrototype:(Aggregate*) prototype {
+  if ((self = [super init])) {
+    self.result = prototype;
+    prototype_ = [prototype retain];
   }
   return self;
 }
+- (void) detachFromPrototype {
+  Aggregate* prototype = prototype_;
+  prototype_ = nil;
+  self.result = [[[Aggregate alloc] init] autorelease];
+  [self mergeFrom:prototype];
+  [prototype release];
+}
+- (PBGeneratedMessage*) internalGetMutableResult {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return [self internalGetResult];
+}
+- (void) freezeSubBuilders {
+  if (subBuilder_ != nil) {
+    Aggregate* value = [subBuilder_ newBuildPartial];
+    result.sub = value;
+    [value release];
+    [subBuilder_ release];
+    subBuilder_ = nil;
+  }
+  if (fileBuilder_ != nil) {
+    PBFileOptions* value = [fileBuilder_ newBuildPartial];
+    result.file = value;
+    [value release];
+    [fileBuilder_ release];
+    fileBuilder_ = nil;
+  }
+  if (msetBuilder_ != nil) {
+    AggregateMessageSet* value = [msetBuilder_ newBuildPartial];
+    result.mset = value;
+    [value release];
+    [msetBuilder_ release];
+    msetBuilder_ = nil;
+  }
+}
+- (void) dropSubBuilders {
+  [subBuilder_ release];
+  subBuilder_ = nil;
+  [subSpareBuilder_ release];
+  subSpareBuilder_ = nil;
+  [fileBuilder_ release];
+  fileBuilder_ = nil;
+  [fileSpareBuilder_ release];
+  fileSpareBuilder_ = nil;
+  [msetBuilder_ release];
+  msetBuilder_ = nil;
+  [msetSpareBuilder_ release];
+  msetSpareBuilder_ = nil;
+}
+- (void) resetSubBuilders {
+  if (subBuilder_ != nil) {
+    [subBuilder_ reset];
+    [subSpareBuilder_ release];
+    subSpareBuilder_ = subBuilder_;
+    subBuilder_ = nil;
+  }
+  if (fileBuilder_ != nil) {
+    [fileBuilder_ reset];
+    [fileSpareBuilder_ release];
+    fileSpareBuilder_ = fileBuilder_;
+    fileBuilder_ = nil;
+  }
+  if (msetBuilder_ != nil) {
+    [msetBuilder_ reset];
+    [msetSpareBuilder_ release];
+    msetSpareBuilder_ = msetBuilder_;
+    msetBuilder_ = nil;
+  }
+}
 - (PBGeneratedMessage*) internalGetResult {
+  [self freezeSubBuilders];
   return result;
 }
 - (Aggregate_Builder*) clear {
-  self.result = [[[Aggregate alloc] init] autorelease];
+  [self dropSubBuilders];
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = [[Aggregate recycledInstance] autorelease];
   return self;
 }
 - (Aggregate_Builder*) clone {
-  return [Aggregate builderWithPrototype:result];
+  if (prototype_ != nil) {
+    return [[[Aggregate_Builder alloc] initWithPrototype:prototype_] autorelease];
+  }
+  [self freezeSubBuilders];
+  return [[Aggregate builder] mergeFrom:result];
+}
+- (Aggregate_Builder*) reset {
+  [self resetSubBuilders];
+  if (result == nil || prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    self.result = [[Aggregate recycledInstance] autorelease];
+  } else {
+    [result clearForReuse];
+  }
+  return self;
+}
+- (Aggregate_Builder*) recycle:(Aggregate*) message {
+  if (message == [Aggregate defaultInstance]) {
+    @throw [NSException exceptionWithName:@"IllegalArgument" reason:@"Cannot recycle the default instance" userInfo:nil];
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = message;
+  return [self reset];
 }
 - (Aggregate*) defaultInstance {
   return [Aggregate defaultInstance];
 }
 - (Aggregate*) build {
   [self checkInitialized];
-  return [self buildPartial];
+  BOOL shared = prototype_ != nil;
+  Aggregate* returnMe = [self buildPartial];
+  if (!shared) {
+    [returnMe setInitialized];
+  }
+  return returnMe;
 }
 - (Aggregate*) buildPartial {
-  Aggregate* returnMe = [[result retain] autorelease];
-  self.result = nil;
+  return [[self newBuildPartial] autorelease];
+}
+- (Aggregate*) newBuildPartial {
+  if (prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    Aggregate* returnMe = result;
+    result = nil;
+    return returnMe;
+  }
+  [self freezeSubBuilders];
+  Aggregate* returnMe = result;
+  result = nil;
   return returnMe;
 }
 - (Aggregate_Builder*) mergeFrom:(Aggregate*) other {
   if (other == [Aggregate defaultInstance]) {
     return self;
   }
-  if (other.hasI) {
-    [self setI:other.i];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (other->hasBits_[0] & 0x1u) {
+    [self setI:other->i];
   }
-  if (other.hasS) {
-    [self setS:other.s];
+  if (other->hasBits_[0] & 0x2u) {
+    [self setS:other->s];
   }
-  if (other.hasSub) {
-    [self mergeSub:other.sub];
+  if (other->hasBits_[0] & 0x4u) {
+    [self mergeSub:other->sub];
   }
-  if (other.hasFile) {
-    [self mergeFile:other.file];
+  if (other->hasBits_[0] & 0x8u) {
+    [self mergeFile:other->file];
   }
-  if (other.hasMset) {
-    [self mergeMset:other.mset];
+  if (other->hasBits_[0] & 0x10u) {
+    [self mergeMset:other->mset];
   }
   [self mergeUnknownFields:other.unknownFields];
   return self;
@@ -4753,18 +6802,29 @@ static Aggregate* defaultAggregateInstance = nil;
   return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
 }
 - (Aggregate_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  PBUnknownFieldSet_Builder* unknownFields = nil;
   while (YES) {
     int32_t tag = [input readTag];
     switch (tag) {
       case 0:
-        [self setUnknownFields:[unknownFields build]];
+        if (unknownFields != nil) {
+          [self setUnknownFields:[unknownFields build]];
+        }
         return self;
       default: {
-        if (![self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag]) {
-          [self setUnknownFields:[unknownFields build]];
+        if (PBWireFormatGetTagWireType(tag) == PBWireFormatEndGroup) {
+          if (unknownFields != nil) {
+            [self setUnknownFields:[unknownFields build]];
+          }
           return self;
         }
+        if (unknownFields == nil) {
+          unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+        }
+        [self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag];
         break;
       }
       case 8: {
@@ -4772,79 +6832,109 @@ static Aggregate* defaultAggregateInstance = nil;
         break;
       }
       case 18: {
-        [self setS:[input readString]];
+        NSString* value = [input newString];
+        [self setS:value];
+        [value release];
         break;
       }
       case 26: {
-        Aggregate_Builder* subBuilder = [Aggregate builder];
-        if (self.hasSub) {
-          [subBuilder mergeFrom:self.sub];
+        if (subBuilder_ == nil) {
+          subBuilder_ = subSpareBuilder_ != nil ? subSpareBuilder_ : [[Aggregate_Builder alloc] init];
+          subSpareBuilder_ = nil;
+          if (result->hasBits_[0] & 0x4u) {
+            [subBuilder_ mergeFrom:result->sub];
+          }
+          result->hasBits_[0] |= 0x4u;
         }
-        [input readMessage:subBuilder extensionRegistry:extensionRegistry];
-        [self setSub:[subBuilder buildPartial]];
+        [input readMessage:subBuilder_ extensionRegistry:extensionRegistry];
         break;
       }
       case 34: {
-        PBFileOptions_Builder* subBuilder = [PBFileOptions builder];
-        if (self.hasFile) {
-          [subBuilder mergeFrom:self.file];
+        if (fileBuilder_ == nil) {
+          fileBuilder_ = fileSpareBuilder_ != nil ? fileSpareBuilder_ : [[PBFileOptions_Builder alloc] init];
+          fileSpareBuilder_ = nil;
+          if (result->hasBits_[0] & 0x8u) {
+            [fileBuilder_ mergeFrom:result->file];
+          }
+          result->hasBits_[0] |= 0x8u;
         }
-        [input readMessage:subBuilder extensionRegistry:extensionRegistry];
-        [self setFile:[subBuilder buildPartial]];
+        [input readMessage:fileBuilder_ extensionRegistry:extensionRegistry];
         break;
       }
       case 42: {
-        AggregateMessageSet_Builder* subBuilder = [AggregateMessageSet builder];
-        if (self.hasMset) {
-          [subBuilder mergeFrom:self.mset];
+        if (msetBuilder_ == nil) {
+          msetBuilder_ = msetSpareBuilder_ != nil ? msetSpareBuilder_ : [[AggregateMessageSet_Builder alloc] init];
+          msetSpareBuilder_ = nil;
+          if (result->hasBits_[0] & 0x10u) {
+            [msetBuilder_ mergeFrom:result->mset];
+          }
+          result->hasBits_[0] |= 0x10u;
         }
-        [input readMessage:subBuilder extensionRegistry:extensionRegistry];
-        [self setMset:[subBuilder buildPartial]];
+        [input readMessage:msetBuilder_ extensionRegistry:extensionRegistry];
         break;
       }
     }
   }
 }
 - (BOOL) hasI {
-  return result.hasI;
+  return (result->hasBits_[0] & 0x1u) != 0;
 }
 - (int32_t) i {
-  return result.i;
+  return result->i;
 }
 - (Aggregate_Builder*) setI:(int32_t) value {
-  result.hasI = YES;
-  result.i = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x1u;
+  result->i = value;
   return self;
 }
 - (Aggregate_Builder*) clearI {
-  result.hasI = NO;
-  result.i = 0;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x1u;
+  result->i = 0;
   return self;
 }
 - (BOOL) hasS {
-  return result.hasS;
+  return (result->hasBits_[0] & 0x2u) != 0;
 }
 - (NSString*) s {
-  return result.s;
+  return [result s];
 }
 - (Aggregate_Builder*) setS:(NSString*) value {
-  result.hasS = YES;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x2u;
   result.s = value;
   return self;
 }
 - (Aggregate_Builder*) clearS {
-  result.hasS = NO;
-  result.s = @"";
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x2u;
+  [result->s release];
+  result->s = nil;
   return self;
 }
 - (BOOL) hasSub {
-  return result.hasSub;
+  return (result->hasBits_[0] & 0x4u) != 0;
 }
 - (Aggregate*) sub {
+  [self freezeSubBuilders];
   return result.sub;
 }
 - (Aggregate_Builder*) setSub:(Aggregate*) value {
-  result.hasSub = YES;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  [subBuilder_ release];
+  subBuilder_ = nil;
+  result->hasBits_[0] |= 0x4u;
   result.sub = value;
   return self;
 }
@@ -4852,29 +6942,48 @@ static Aggregate* defaultAggregateInstance = nil;
   return [self setSub:[builderForValue build]];
 }
 - (Aggregate_Builder*) mergeSub:(Aggregate*) value {
-  if (result.hasSub &&
-      result.sub != [Aggregate defaultInstance]) {
-    result.sub =
-      [[[Aggregate builderWithPrototype:result.sub] mergeFrom:value] buildPartial];
-  } else {
-    result.sub = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (subBuilder_ == nil) {
+    if (!(result->hasBits_[0] & 0x4u) ||
+        result->sub == [Aggregate defaultInstance]) {
+      result->hasBits_[0] |= 0x4u;
+      result.sub = value;
+      return self;
+    }
+    subBuilder_ = subSpareBuilder_ != nil ? subSpareBuilder_ : [[Aggregate_Builder alloc] init];
+    subSpareBuilder_ = nil;
+    [subBuilder_ mergeFrom:result->sub];
   }
-  result.hasSub = YES;
+  [subBuilder_ mergeFrom:value];
   return self;
 }
 - (Aggregate_Builder*) clearSub {
-  result.hasSub = NO;
-  result.sub = [Aggregate defaultInstance];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  [subBuilder_ release];
+  subBuilder_ = nil;
+  result->hasBits_[0] &= ~0x4u;
+  [result->sub release];
+  result->sub = nil;
   return self;
 }
 - (BOOL) hasFile {
-  return result.hasFile;
+  return (result->hasBits_[0] & 0x8u) != 0;
 }
 - (PBFileOptions*) file {
+  [self freezeSubBuilders];
   return result.file;
 }
 - (Aggregate_Builder*) setFile:(PBFileOptions*) value {
-  result.hasFile = YES;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  [fileBuilder_ release];
+  fileBuilder_ = nil;
+  result->hasBits_[0] |= 0x8u;
   result.file = value;
   return self;
 }
@@ -4882,29 +6991,48 @@ static Aggregate* defaultAggregateInstance = nil;
   return [self setFile:[builderForValue build]];
 }
 - (Aggregate_Builder*) mergeFile:(PBFileOptions*) value {
-  if (result.hasFile &&
-      result.file != [PBFileOptions defaultInstance]) {
-    result.file =
-      [[[PBFileOptions builderWithPrototype:result.file] mergeFrom:value] buildPartial];
-  } else {
-    result.file = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (fileBuilder_ == nil) {
+    if (!(result->hasBits_[0] & 0x8u) ||
+        result->file == [PBFileOptions defaultInstance]) {
+      result->hasBits_[0] |= 0x8u;
+      result.file = value;
+      return self;
+    }
+    fileBuilder_ = fileSpareBuilder_ != nil ? fileSpareBuilder_ : [[PBFileOptions_Builder alloc] init];
+    fileSpareBuilder_ = nil;
+    [fileBuilder_ mergeFrom:result->file];
   }
-  result.hasFile = YES;
+  [fileBuilder_ mergeFrom:value];
   return self;
 }
 - (Aggregate_Builder*) clearFile {
-  result.hasFile = NO;
-  result.file = [PBFileOptions defaultInstance];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  [fileBuilder_ release];
+  fileBuilder_ = nil;
+  result->hasBits_[0] &= ~0x8u;
+  [result->file release];
+  result->file = nil;
   return self;
 }
 - (BOOL) hasMset {
-  return result.hasMset;
+  return (result->hasBits_[0] & 0x10u) != 0;
 }
 - (AggregateMessageSet*) mset {
+  [self freezeSubBuilders];
   return result.mset;
 }
 - (Aggregate_Builder*) setMset:(AggregateMessageSet*) value {
-  result.hasMset = YES;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  [msetBuilder_ release];
+  msetBuilder_ = nil;
+  result->hasBits_[0] |= 0x10u;
   result.mset = value;
   return self;
 }
@@ -4912,79 +7040,100 @@ static Aggregate* defaultAggregateInstance = nil;
   return [self setMset:[builderForValue build]];
 }
 - (Aggregate_Builder*) mergeMset:(AggregateMessageSet*) value {
-  if (result.hasMset &&
-      result.mset != [AggregateMessageSet defaultInstance]) {
-    result.mset =
-      [[[AggregateMessageSet builderWithPrototype:result.mset] mergeFrom:value] buildPartial];
-  } else {
-    result.mset = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (msetBuilder_ == nil) {
+    if (!(result->hasBits_[0] & 0x10u) ||
+        result->mset == [AggregateMessageSet defaultInstance]) {
+      result->hasBits_[0] |= 0x10u;
+      result.mset = value;
+      return self;
+    }
+    msetBuilder_ = msetSpareBuilder_ != nil ? msetSpareBuilder_ : [[AggregateMessageSet_Builder alloc] init];
+    msetSpareBuilder_ = nil;
+    [msetBuilder_ mergeFrom:result->mset];
   }
-  result.hasMset = YES;
+  [msetBuilder_ mergeFrom:value];
   return self;
 }
 - (Aggregate_Builder*) clearMset {
-  result.hasMset = NO;
-  result.mset = [AggregateMessageSet defaultInstance];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  [msetBuilder_ release];
+  msetBuilder_ = nil;
+  result->hasBits_[0] &= ~0x10u;
+  [result->mset release];
+  result->mset = nil;
   return self;
 }
 @end
 
 @interface AggregateMessage ()
-@property int32_t fieldname;
+@property (nonatomic) int32_t fieldname;
+@end
+
+@interface AggregateMessage_Builder()
+@property (nonatomic, retain) AggregateMessage* result;
+- (id) initWithPrototype:(AggregateMessage*) prototype;
+- (void) detachFromPrototype;
 @end
 
 @implementation AggregateMessage
 
 - (BOOL) hasFieldname {
-  return !!hasFieldname_;
+  return (hasBits_[0] & 0x1u) != 0;
 }
-- (void) setHasFieldname:(BOOL) value {
-  hasFieldname_ = !!value;
+- (void) setHasFieldname:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x1u;
+  } else {
+    hasBits_[0] &= ~0x1u;
+  }
 }
 @synthesize fieldname;
 - (void) dealloc {
   [super dealloc];
 }
-- (id) init {
-  if ((self = [super init])) {
-    self.fieldname = 0;
-  }
-  return self;
+- (void) clearForReuse {
+  [super clearForReuse];
+  memset(hasBits_, 0, sizeof(hasBits_));
+  fieldname = 0;
 }
 static AggregateMessage* defaultAggregateMessageInstance = nil;
-+ (void) initialize {
-  if (self == [AggregateMessage class]) {
-    defaultAggregateMessageInstance = [[AggregateMessage alloc] init];
-  }
-}
 + (AggregateMessage*) defaultInstance {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultAggregateMessageInstance = [[AggregateMessage alloc] init];
+  });
   return defaultAggregateMessageInstance;
 }
 - (AggregateMessage*) defaultInstance {
-  return defaultAggregateMessageInstance;
+  return [AggregateMessage defaultInstance];
 }
 - (BOOL) isInitialized {
   return YES;
 }
 - (void) writeToCodedOutputStream:(PBCodedOutputStream*) output {
-  if (self.hasFieldname) {
-    [output writeInt32:1 value:self.fieldname];
+  if (hasBits_[0] & 0x1u) {
+    [output writeInt32:1 value:fieldname];
   }
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = PBGeneratedMessageGetMemoizedSize(&memoizedSerializedSize);
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
-  if (self.hasFieldname) {
-    size += computeInt32Size(1, self.fieldname);
+  size_ = 0;
+  if (hasBits_[0] & 0x1u) {
+    size_ += computeInt32Size(1, fieldname);
   }
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
+  size_ += self.unknownFields.serializedSize;
+  PBGeneratedMessageSetMemoizedSize(&memoizedSerializedSize, size_);
+  return size_;
 }
 + (AggregateMessage*) parseFromData:(NSData*) data {
   return (AggregateMessage*)[[[AggregateMessage builder] mergeFromData:data] build];
@@ -5008,7 +7157,7 @@ static AggregateMessage* defaultAggregateMessageInstance = nil;
   return [[[AggregateMessage_Builder alloc] init] autorelease];
 }
 + (AggregateMessage_Builder*) builderWithPrototype:(AggregateMessage*) prototype {
-  return [[AggregateMessage builder] mergeFrom:prototype];
+  return [[[AggregateMessage_Builder alloc] initWithPrototype:prototype] autorelease];
 }
 - (AggregateMessage_Builder*) builder {
   return [AggregateMessage builder];
@@ -5017,8 +7166,8 @@ static AggregateMessage* defaultAggregateMessageInstance = nil;
   return [AggregateMessage builderWithPrototype:self];
 }
 - (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
-  if (self.hasFieldname) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"fieldname", [NSNumber numberWithInt:self.fieldname]];
+  if (hasBits_[0] & 0x1u) {
+    [output appendFormat:@"%@%@: %@\n", indent, @"fieldname", [NSNumber numberWithInt:fieldname]];
   }
   [self.unknownFields writeDescriptionTo:output withIndent:indent];
 }
@@ -5031,46 +7180,99 @@ static AggregateMessage* defaultAggregateMessageInstance = nil;
   }
   AggregateMessage *otherMessage = other;
   return
-      self.hasFieldname == otherMessage.hasFieldname &&
-      (!self.hasFieldname || self.fieldname == otherMessage.fieldname) &&
-      
+      (hasBits_[0] & 0x1u) == (otherMessage->hasBits_[0] & 0x1u) &&
+      (!(hasBits_[0] & 0x1u) || fieldname == otherMessage->fieldname) &&
       (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
 }
 - (NSUInteger) hash {
-  NSUInteger hashCode = 7;
-  if (self.hasFieldname) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithInt:self.fieldname] hash];
+  NSUInteger hash_ = PBGeneratedMessageGetMemoizedHash(&memoizedHash);
+  if (hash_ != 0) {
+    return hash_;
   }
-  hashCode = hashCode * 31 + [self.unknownFields hash];
-  return hashCode;
-}
-@end
 
-@interface AggregateMessage_Builder()
-@property (retain) AggregateMessage* result;
+  uint64_t hashCode = 7;
+  if (hasBits_[0] & 0x1u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, (uint64_t)fieldname);
+  }
+  hashCode = PBGeneratedMessageHashMix(hashCode, [self.unknownFields hash]);
+  hash_ = PBGeneratedMessageHashFinish(hashCode);
+  PBGeneratedMessageSetMemoizedHash(&memoizedHash, hash_);
+  return hash_;
+}
 @end
 
 @implementation AggregateMessage_Builder
 @synthesize result;
 - (void) dealloc {
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
   self.result = nil;
+  [prototype_ release];
   [super dealloc];
 }
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[[AggregateMessage alloc] init] autorelease];
+    result = [AggregateMessage recycledInstance];
+  }
+  return self;
+}
+- (id) initWithPrototype:(AggregateMessage*) prototype {
+  if ((self = [super init])) {
+    self.result = prototype;
+    prototype_ = [prototype retain];
   }
   return self;
 }
+- (void) detachFromPrototype {
+  AggregateMessage* prototype = prototype_;
+  prototype_ = nil;
+  self.result = [[[AggregateMessage alloc] init] autorelease];
+  [self mergeFrom:prototype];
+  [prototype release];
+}
+- (PBGeneratedMessage*) internalGetMutableResult {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return [self internalGetResult];
+}
 - (PBGeneratedMessage*) internalGetResult {
   return result;
 }
 - (AggregateMessage_Builder*) clear {
-  self.result = [[[AggregateMessage alloc] init] autorelease];
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = [[AggregateMessage recycledInstance] autorelease];
   return self;
 }
 - (AggregateMessage_Builder*) clone {
-  return [AggregateMessage builderWithPrototype:result];
+  if (prototype_ != nil) {
+    return [[[AggregateMessage_Builder alloc] initWithPrototype:prototype_] autorelease];
+  }
+  return [[AggregateMessage builder] mergeFrom:result];
+}
+- (AggregateMessage_Builder*) reset {
+  if (result == nil || prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    self.result = [[AggregateMessage recycledInstance] autorelease];
+  } else {
+    [result clearForReuse];
+  }
+  return self;
+}
+- (AggregateMessage_Builder*) recycle:(AggregateMessage*) message {
+  if (message == [AggregateMessage defaultInstance]) {
+    @throw [NSException exceptionWithName:@"IllegalArgument" reason:@"Cannot recycle the default instance" userInfo:nil];
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = message;
+  return [self reset];
 }
 - (AggregateMessage*) defaultInstance {
   return [AggregateMessage defaultInstance];
@@ -5080,16 +7282,29 @@ static AggregateMessage* defaultAggregateMessageInstance = nil;
   return [self buildPartial];
 }
 - (AggregateMessage*) buildPartial {
-  AggregateMessage* returnMe = [[result retain] autorelease];
-  self.result = nil;
+  return [[self newBuildPartial] autorelease];
+}
+- (AggregateMessage*) newBuildPartial {
+  if (prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    AggregateMessage* returnMe = result;
+    result = nil;
+    return returnMe;
+  }
+  AggregateMessage* returnMe = result;
+  result = nil;
   return returnMe;
 }
 - (AggregateMessage_Builder*) mergeFrom:(AggregateMessage*) other {
   if (other == [AggregateMessage defaultInstance]) {
     return self;
   }
-  if (other.hasFieldname) {
-    [self setFieldname:other.fieldname];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (other->hasBits_[0] & 0x1u) {
+    [self setFieldname:other->fieldname];
   }
   [self mergeUnknownFields:other.unknownFields];
   return self;
@@ -5098,18 +7313,29 @@ static AggregateMessage* defaultAggregateMessageInstance = nil;
   return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
 }
 - (AggregateMessage_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  PBUnknownFieldSet_Builder* unknownFields = nil;
   while (YES) {
     int32_t tag = [input readTag];
     switch (tag) {
       case 0:
-        [self setUnknownFields:[unknownFields build]];
+        if (unknownFields != nil) {
+          [self setUnknownFields:[unknownFields build]];
+        }
         return self;
       default: {
-        if (![self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag]) {
-          [self setUnknownFields:[unknownFields build]];
+        if (PBWireFormatGetTagWireType(tag) == PBWireFormatEndGroup) {
+          if (unknownFields != nil) {
+            [self setUnknownFields:[unknownFields build]];
+          }
           return self;
         }
+        if (unknownFields == nil) {
+          unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+        }
+        [self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag];
         break;
       }
       case 8: {
@@ -5120,19 +7346,25 @@ static AggregateMessage* defaultAggregateMessageInstance = nil;
   }
 }
 - (BOOL) hasFieldname {
-  return result.hasFieldname;
+  return (result->hasBits_[0] & 0x1u) != 0;
 }
 - (int32_t) fieldname {
-  return result.fieldname;
+  return result->fieldname;
 }
 - (AggregateMessage_Builder*) setFieldname:(int32_t) value {
-  result.hasFieldname = YES;
-  result.fieldname = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x1u;
+  result->fieldname = value;
   return self;
 }
 - (AggregateMessage_Builder*) clearFieldname {
-  result.hasFieldname = NO;
-  result.fieldname = 0;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x1u;
+  result->fieldname = 0;
   return self;
 }
 @end
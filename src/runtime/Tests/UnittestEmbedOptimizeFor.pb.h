@@ -116,14 +116,14 @@
 @end
 
 @interface TestEmbedOptimizedForSize : PBGeneratedMessage {
-@private
-  BOOL hasOptionalMessage_:1;
+@package
+  uint32_t hasBits_[1];
   TestOptimizedForSize* optionalMessage;
-  PBAppendableArray * repeatedMessageArray;
+  PBObjectArray * repeatedMessageArray;
 }
 - (BOOL) hasOptionalMessage;
-@property (readonly, retain) TestOptimizedForSize* optionalMessage;
-@property (readonly, retain) PBArray * repeatedMessage;
+@property (nonatomic, readonly, retain) TestOptimizedForSize* optionalMessage;
+@property (nonatomic, readonly, retain) PBArray * repeatedMessage;
 - (TestOptimizedForSize*)repeatedMessageAtIndex:(NSUInteger)index;
 
 + (TestEmbedOptimizedForSize*) defaultInstance;
@@ -147,15 +147,26 @@
 @interface TestEmbedOptimizedForSize_Builder : PBGeneratedMessage_Builder {
 @private
   TestEmbedOptimizedForSize* result;
+  TestEmbedOptimizedForSize* prototype_;
+  TestOptimizedForSize_Builder* optionalMessageBuilder_;
+  TestOptimizedForSize_Builder* optionalMessageSpareBuilder_;
 }
 
 - (TestEmbedOptimizedForSize*) defaultInstance;
 
 - (TestEmbedOptimizedForSize_Builder*) clear;
 - (TestEmbedOptimizedForSize_Builder*) clone;
+- (TestEmbedOptimizedForSize_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (TestEmbedOptimizedForSize_Builder*) recycle:(TestEmbedOptimizedForSize*) message;
 
 - (TestEmbedOptimizedForSize*) build;
 - (TestEmbedOptimizedForSize*) buildPartial;
+- (TestEmbedOptimizedForSize*) newBuildPartial;
 
 - (TestEmbedOptimizedForSize_Builder*) mergeFrom:(TestEmbedOptimizedForSize*) other;
 - (TestEmbedOptimizedForSize_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -5,15 +5,18 @@
 @implementation UnittestEmbedOptimizeForRoot
 static PBExtensionRegistry* extensionRegistry = nil;
 + (PBExtensionRegistry*) extensionRegistry {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    PBMutableExtensionRegistry* registry = [PBMutableExtensionRegistry registry];
+    [UnittestEmbedOptimizeForRoot registerAllExtensions:registry];
+    [UnittestOptimizeForRoot registerAllExtensions:registry];
+    extensionRegistry = [registry retain];
+  });
   return extensionRegistry;
 }
 
 + (void) initialize {
   if (self == [UnittestEmbedOptimizeForRoot class]) {
-    PBMutableExtensionRegistry* registry = [PBMutableExtensionRegistry registry];
-    [self registerAllExtensions:registry];
-    [UnittestOptimizeForRoot registerAllExtensions:registry];
-    extensionRegistry = [registry retain];
   }
 }
 + (void) registerAllExtensions:(PBMutableExtensionRegistry*) registry {
@@ -21,57 +24,80 @@ static PBExtensionRegistry* extensionRegistry = nil;
 @end
 
 @interface TestEmbedOptimizedForSize ()
-@property (retain) TestOptimizedForSize* optionalMessage;
-@property (retain) PBAppendableArray * repeatedMessageArray;
+@property (nonatomic, retain) TestOptimizedForSize* optionalMessage;
+@property (nonatomic, retain) PBObjectArray * repeatedMessageArray;
+- (void) setInitialized;
+@end
+
+@interface TestEmbedOptimizedForSize_Builder()
+@property (nonatomic, retain) TestEmbedOptimizedForSize* result;
+- (id) initWithPrototype:(TestEmbedOptimizedForSize*) prototype;
+- (void) detachFromPrototype;
+- (void) freezeSubBuilders;
+- (void) dropSubBuilders;
+- (void) resetSubBuilders;
 @end
 
 @implementation TestEmbedOptimizedForSize
 
 - (BOOL) hasOptionalMessage {
-  return !!hasOptionalMessage_;
+  return (hasBits_[0] & 0x1u) != 0;
 }
-- (void) setHasOptionalMessage:(BOOL) value {
-  hasOptionalMessage_ = !!value;
+- (void) setHasOptionalMessage:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x1u;
+  } else {
+    hasBits_[0] &= ~0x1u;
+  }
 }
 @synthesize optionalMessage;
+- (TestOptimizedForSize*) optionalMessage {
+  return optionalMessage != nil ? optionalMessage : [TestOptimizedForSize defaultInstance];
+}
 @synthesize repeatedMessageArray;
 @dynamic repeatedMessage;
 - (void) dealloc {
-  self.optionalMessage = nil;
-  self.repeatedMessageArray = nil;
+  [optionalMessage release];
+  [repeatedMessageArray release];
   [super dealloc];
 }
-- (id) init {
-  if ((self = [super init])) {
-    self.optionalMessage = [TestOptimizedForSize defaultInstance];
-  }
-  return self;
+- (void) clearForReuse {
+  [super clearForReuse];
+  memset(hasBits_, 0, sizeof(hasBits_));
+  [optionalMessage release];
+  optionalMessage = nil;
+  repeatedMessageArray = PBAppendableArrayReuse(repeatedMessageArray);
 }
 static TestEmbedOptimizedForSize* defaultTestEmbedOptimizedForSizeInstance = nil;
-+ (void) initialize {
-  if (self == [TestEmbedOptimizedForSize class]) {
-    defaultTestEmbedOptimizedForSizeInstance = [[TestEmbedOptimizedForSize alloc] init];
-  }
-}
 + (TestEmbedOptimizedForSize*) defaultInstance {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultTestEmbedOptimizedForSizeInstance = [[TestEmbedOptimizedForSize alloc] init];
+  });
   return defaultTestEmbedOptimizedForSizeInstance;
 }
 - (TestEmbedOptimizedForSize*) defaultInstance {
-  return defaultTestEmbedOptimizedForSizeInstance;
+  return [TestEmbedOptimizedForSize defaultInstance];
 }
 - (PBArray *)repeatedMessage {
   return repeatedMessageArray;
 }
 - (TestOptimizedForSize*)repeatedMessageAtIndex:(NSUInteger)index {
-  return [repeatedMessageArray objectAtIndex:index];
+  return PBObjectArrayValueAtIndex(repeatedMessageArray, index);
+}
+- (void) setInitialized {
+  hasBits_[0] |= 0x2u;
 }
 - (BOOL) isInitialized {
-  if (self.hasOptionalMessage) {
-    if (!self.optionalMessage.isInitialized) {
+  if ((hasBits_[0] & 0x2u) != 0) {
+    return YES;
+  }
+  if ((hasBits_[0] & 0x1u) != 0) {
+    if (!optionalMessage.isInitialized) {
       return NO;
     }
   }
-  for (TestOptimizedForSize* element in self.repeatedMessage) {
+  for (TestOptimizedForSize* element in repeatedMessageArray) {
     if (!element.isInitialized) {
       return NO;
     }
@@ -79,30 +105,30 @@ static TestEmbedOptimizedForSize* defaultTestEmbedOptimizedForSizeInstance = nil
   return YES;
 }
 - (void) writeToCodedOutputStream:(PBCodedOutputStream*) output {
-  if (self.hasOptionalMessage) {
-    [output writeMessage:1 value:self.optionalMessage];
+  if (hasBits_[0] & 0x1u) {
+    [output writeMessage:1 value:optionalMessage];
   }
-  for (TestOptimizedForSize *element in self.repeatedMessageArray) {
+  for (TestOptimizedForSize *element in repeatedMessageArray) {
     [output writeMessage:2 value:element];
   }
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = PBGeneratedMessageGetMemoizedSize(&memoizedSerializedSize);
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
-  if (self.hasOptionalMessage) {
-    size += computeMessageSize(1, self.optionalMessage);
+  size_ = 0;
+  if (hasBits_[0] & 0x1u) {
+    size_ += computeMessageSize(1, optionalMessage);
   }
-  for (TestOptimizedForSize *element in self.repeatedMessageArray) {
-    size += computeMessageSize(2, element);
+  for (TestOptimizedForSize *element in repeatedMessageArray) {
+    size_ += computeMessageSize(2, element);
   }
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
+  size_ += self.unknownFields.serializedSize;
+  PBGeneratedMessageSetMemoizedSize(&memoizedSerializedSize, size_);
+  return size_;
 }
 + (TestEmbedOptimizedForSize*) parseFromData:(NSData*) data {
   return (TestEmbedOptimizedForSize*)[[[TestEmbedOptimizedForSize builder] mergeFromData:data] build];
@@ -126,7 +152,7 @@ static TestEmbedOptimizedForSize* defaultTestEmbedOptimizedForSizeInstance = nil
   return [[[TestEmbedOptimizedForSize_Builder alloc] init] autorelease];
 }
 + (TestEmbedOptimizedForSize_Builder*) builderWithPrototype:(TestEmbedOptimizedForSize*) prototype {
-  return [[TestEmbedOptimizedForSize builder] mergeFrom:prototype];
+  return [[[TestEmbedOptimizedForSize_Builder alloc] initWithPrototype:prototype] autorelease];
 }
 - (TestEmbedOptimizedForSize_Builder*) builder {
   return [TestEmbedOptimizedForSize builder];
@@ -135,13 +161,13 @@ static TestEmbedOptimizedForSize* defaultTestEmbedOptimizedForSizeInstance = nil
   return [TestEmbedOptimizedForSize builderWithPrototype:self];
 }
 - (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
-  if (self.hasOptionalMessage) {
+  if (hasBits_[0] & 0x1u) {
     [output appendFormat:@"%@%@ {\n", indent, @"optionalMessage"];
-    [self.optionalMessage writeDescriptionTo:output
+    [optionalMessage writeDescriptionTo:output
                          withIndent:[NSString stringWithFormat:@"%@  ", indent]];
     [output appendFormat:@"%@}\n", indent];
   }
-  for (TestOptimizedForSize* element in self.repeatedMessageArray) {
+  for (TestOptimizedForSize* element in repeatedMessageArray) {
     [output appendFormat:@"%@%@ {\n", indent, @"repeatedMessage"];
     [element writeDescriptionTo:output
                      withIndent:[NSString stringWithFormat:@"%@  ", indent]];
@@ -158,76 +184,176 @@ static TestEmbedOptimizedForSize* defaultTestEmbedOptimizedForSizeInstance = nil
   }
   TestEmbedOptimizedForSize *otherMessage = other;
   return
-      self.hasOptionalMessage == otherMessage.hasOptionalMessage &&
-      (!self.hasOptionalMessage || [self.optionalMessage isEqual:otherMessage.optionalMessage]) &&
-      
-      [self.repeatedMessageArray isEqualToArray:otherMessage.repeatedMessageArray] &&
-      
+      (hasBits_[0] & 0x1u) == (otherMessage->hasBits_[0] & 0x1u) &&
+      (!(hasBits_[0] & 0x1u) || [optionalMessage isEqual:otherMessage->optionalMessage]) &&
+      (repeatedMessageArray.count == 0 ? otherMessage->repeatedMessageArray.count == 0 : [repeatedMessageArray isEqualToArray:otherMessage->repeatedMessageArray]) &&
       (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
 }
 - (NSUInteger) hash {
-  NSUInteger hashCode = 7;
-  if (self.hasOptionalMessage) {
-    hashCode = hashCode * 31 + [self.optionalMessage hash];
+  NSUInteger hash_ = PBGeneratedMessageGetMemoizedHash(&memoizedHash);
+  if (hash_ != 0) {
+    return hash_;
+  }
+
+  uint64_t hashCode = 7;
+  if (hasBits_[0] & 0x1u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [optionalMessage hash]);
   }
-  for (TestOptimizedForSize* element in self.repeatedMessageArray) {
-    hashCode = hashCode * 31 + [element hash];
+  for (TestOptimizedForSize* element in repeatedMessageArray) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [element hash]);
   }
-  hashCode = hashCode * 31 + [self.unknownFields hash];
-  return hashCode;
+  hashCode = PBGeneratedMessageHashMix(hashCode, [self.unknownFields hash]);
+  hash_ = PBGeneratedMessageHashFinish(hashCode);
+  PBGeneratedMessageSetMemoizedHash(&memoizedHash, hash_);
+  return hash_;
 }
 @end
 
-@interface TestEmbedOptimizedForSize_Builder()
-@property (retain) TestEmbedOptimizedForSize* result;
-@end
-
 @implementation TestEmbedOptimizedForSize_Builder
 @synthesize result;
 - (void) dealloc {
+  [self dropSubBuilders];
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
   self.result = nil;
+  [prototype_ release];
   [super dealloc];
 }
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[[TestEmbedOptimizedForSize alloc] init] autorelease];
+    result = [TestEmbedOptimizedForSize recycledInstance];
   }
   return self;
 }
+- (id) initWithPrototype:(TestEmbedOptimizedForSize*) prototype {
+  if ((self = [super init])) {
+    self.result = prototype;
+    prototype_ = [prototype retain];
+  }
+  return self;
+}
+- (void) detachFromPrototype {
+  TestEmbedOptimizedForSize* prototype = prototype_;
+  prototype_ = nil;
+  self.result = [[[TestEmbedOptimizedForSize alloc] init] autorelease];
+  [self mergeFrom:prototype];
+  [prototype release];
+}
+- (PBGeneratedMessage*) internalGetMutableResult {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return [self internalGetResult];
+}
+- (void) freezeSubBuilders {
+  if (optionalMessageBuilder_ != nil) {
+    TestOptimizedForSize* value = [optionalMessageBuilder_ newBuildPartial];
+    result.optionalMessage = value;
+    [value release];
+    [optionalMessageBuilder_ release];
+    optionalMessageBuilder_ = nil;
+  }
+}
+- (void) dropSubBuilders {
+  [optionalMessageBuilder_ release];
+  optionalMessageBuilder_ = nil;
+  [optionalMessageSpareBuilder_ release];
+  optionalMessageSpareBuilder_ = nil;
+}
+- (void) resetSubBuilders {
+  if (optionalMessageBuilder_ != nil) {
+    [optionalMessageBuilder_ reset];
+    [optionalMessageSpareBuilder_ release];
+    optionalMessageSpareBuilder_ = optionalMessageBuilder_;
+    optionalMessageBuilder_ = nil;
+  }
+}
 - (PBGeneratedMessage*) internalGetResult {
+  [self freezeSubBuilders];
   return result;
 }
 - (TestEmbedOptimizedForSize_Builder*) clear {
-  self.result = [[[TestEmbedOptimizedForSize alloc] init] autorelease];
+  [self dropSubBuilders];
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = [[TestEmbedOptimizedForSize recycledInstance] autorelease];
   return self;
 }
 - (TestEmbedOptimizedForSize_Builder*) clone {
-  return [TestEmbedOptimizedForSize builderWithPrototype:result];
+  if (prototype_ != nil) {
+    return [[[TestEmbedOptimizedForSize_Builder alloc] initWithPrototype:prototype_] autorelease];
+  }
+  [self freezeSubBuilders];
+  return [[TestEmbedOptimizedForSize builder] mergeFrom:result];
+}
+- (TestEmbedOptimizedForSize_Builder*) reset {
+  [self resetSubBuilders];
+  if (result == nil || prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    self.result = [[TestEmbedOptimizedForSize recycledInstance] autorelease];
+  } else {
+    [result clearForReuse];
+  }
+  return self;
+}
+- (TestEmbedOptimizedForSize_Builder*) recycle:(TestEmbedOptimizedForSize*) message {
+  if (message == [TestEmbedOptimizedForSize defaultInstance]) {
+    @throw [NSException exceptionWithName:@"IllegalArgument" reason:@"Cannot recycle the default instance" userInfo:nil];
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = message;
+  return [self reset];
 }
 - (TestEmbedOptimizedForSize*) defaultInstance {
   return [TestEmbedOptimizedForSize defaultInstance];
 }
 - (TestEmbedOptimizedForSize*) build {
   [self checkInitialized];
-  return [self buildPartial];
+  BOOL shared = prototype_ != nil;
+  TestEmbedOptimizedForSize* returnMe = [self buildPartial];
+  if (!shared) {
+    [returnMe setInitialized];
+  }
+  return returnMe;
 }
 - (TestEmbedOptimizedForSize*) buildPartial {
-  TestEmbedOptimizedForSize* returnMe = [[result retain] autorelease];
-  self.result = nil;
+  return [[self newBuildPartial] autorelease];
+}
+- (TestEmbedOptimizedForSize*) newBuildPartial {
+  if (prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    TestEmbedOptimizedForSize* returnMe = result;
+    result = nil;
+    return returnMe;
+  }
+  [self freezeSubBuilders];
+  [result->repeatedMessageArray shrinkToFit];
+  TestEmbedOptimizedForSize* returnMe = result;
+  result = nil;
   return returnMe;
 }
 - (TestEmbedOptimizedForSize_Builder*) mergeFrom:(TestEmbedOptimizedForSize*) other {
   if (other == [TestEmbedOptimizedForSize defaultInstance]) {
     return self;
   }
-  if (other.hasOptionalMessage) {
-    [self mergeOptionalMessage:other.optionalMessage];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (other->hasBits_[0] & 0x1u) {
+    [self mergeOptionalMessage:other->optionalMessage];
   }
-  if (other.repeatedMessageArray.count > 0) {
-    if (result.repeatedMessageArray == nil) {
-      result.repeatedMessageArray = [[other.repeatedMessageArray copyWithZone:[other.repeatedMessageArray zone]] autorelease];
+  if (other->repeatedMessageArray.count > 0) {
+    if (result->repeatedMessageArray == nil) {
+      result.repeatedMessageArray = [[other->repeatedMessageArray copyWithZone:[other->repeatedMessageArray zone]] autorelease];
     } else {
-      [result.repeatedMessageArray appendArray:other.repeatedMessageArray];
+      [result->repeatedMessageArray appendArray:other->repeatedMessageArray];
     }
   }
   [self mergeUnknownFields:other.unknownFields];
@@ -237,46 +363,72 @@ static TestEmbedOptimizedForSize* defaultTestEmbedOptimizedForSizeInstance = nil
   return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
 }
 - (TestEmbedOptimizedForSize_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  PBUnknownFieldSet_Builder* unknownFields = nil;
   while (YES) {
     int32_t tag = [input readTag];
     switch (tag) {
       case 0:
-        [self setUnknownFields:[unknownFields build]];
+        if (unknownFields != nil) {
+          [self setUnknownFields:[unknownFields build]];
+        }
         return self;
       default: {
-        if (![self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag]) {
-          [self setUnknownFields:[unknownFields build]];
+        if (PBWireFormatGetTagWireType(tag) == PBWireFormatEndGroup) {
+          if (unknownFields != nil) {
+            [self setUnknownFields:[unknownFields build]];
+          }
           return self;
         }
+        if (unknownFields == nil) {
+          unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+        }
+        [self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag];
         break;
       }
       case 10: {
-        TestOptimizedForSize_Builder* subBuilder = [TestOptimizedForSize builder];
-        if (self.hasOptionalMessage) {
-          [subBuilder mergeFrom:self.optionalMessage];
+        if (optionalMessageBuilder_ == nil) {
+          optionalMessageBuilder_ = optionalMessageSpareBuilder_ != nil ? optionalMessageSpareBuilder_ : [[TestOptimizedForSize_Builder alloc] init];
+          optionalMessageSpareBuilder_ = nil;
+          if (result->hasBits_[0] & 0x1u) {
+            [optionalMessageBuilder_ mergeFrom:result->optionalMessage];
+          }
+          result->hasBits_[0] |= 0x1u;
         }
-        [input readMessage:subBuilder extensionRegistry:extensionRegistry];
-        [self setOptionalMessage:[subBuilder buildPartial]];
+        [input readMessage:optionalMessageBuilder_ extensionRegistry:extensionRegistry];
         break;
       }
       case 18: {
-        TestOptimizedForSize_Builder* subBuilder = [TestOptimizedForSize builder];
-        [input readMessage:subBuilder extensionRegistry:extensionRegistry];
-        [self addRepeatedMessage:[subBuilder buildPartial]];
+        TestOptimizedForSize_Builder* subBuilder = [[TestOptimizedForSize_Builder alloc] init];
+        @try {
+          [input readMessage:subBuilder extensionRegistry:extensionRegistry];
+          TestOptimizedForSize* value = [subBuilder newBuildPartial];
+          [self addRepeatedMessage:value];
+          [value release];
+        } @finally {
+          [subBuilder release];
+        }
         break;
       }
     }
   }
 }
 - (BOOL) hasOptionalMessage {
-  return result.hasOptionalMessage;
+  return (result->hasBits_[0] & 0x1u) != 0;
 }
 - (TestOptimizedForSize*) optionalMessage {
+  [self freezeSubBuilders];
   return result.optionalMessage;
 }
 - (TestEmbedOptimizedForSize_Builder*) setOptionalMessage:(TestOptimizedForSize*) value {
-  result.hasOptionalMessage = YES;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  [optionalMessageBuilder_ release];
+  optionalMessageBuilder_ = nil;
+  result->hasBits_[0] |= 0x1u;
   result.optionalMessage = value;
   return self;
 }
@@ -284,43 +436,71 @@ static TestEmbedOptimizedForSize* defaultTestEmbedOptimizedForSizeInstance = nil
   return [self setOptionalMessage:[builderForValue build]];
 }
 - (TestEmbedOptimizedForSize_Builder*) mergeOptionalMessage:(TestOptimizedForSize*) value {
-  if (result.hasOptionalMessage &&
-      result.optionalMessage != [TestOptimizedForSize defaultInstance]) {
-    result.optionalMessage =
-      [[[TestOptimizedForSize builderWithPrototype:result.optionalMessage] mergeFrom:value] buildPartial];
-  } else {
-    result.optionalMessage = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (optionalMessageBuilder_ == nil) {
+    if (!(result->hasBits_[0] & 0x1u) ||
+        result->optionalMessage == [TestOptimizedForSize defaultInstance]) {
+      result->hasBits_[0] |= 0x1u;
+      result.optionalMessage = value;
+      return self;
+    }
+    optionalMessageBuilder_ = optionalMessageSpareBuilder_ != nil ? optionalMessageSpareBuilder_ : [[TestOptimizedForSize_Builder alloc] init];
+    optionalMessageSpareBuilder_ = nil;
+    [optionalMessageBuilder_ mergeFrom:result->optionalMessage];
   }
-  result.hasOptionalMessage = YES;
+  [optionalMessageBuilder_ mergeFrom:value];
   return self;
 }
 - (TestEmbedOptimizedForSize_Builder*) clearOptionalMessage {
-  result.hasOptionalMessage = NO;
-  result.optionalMessage = [TestOptimizedForSize defaultInstance];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  [optionalMessageBuilder_ release];
+  optionalMessageBuilder_ = nil;
+  result->hasBits_[0] &= ~0x1u;
+  [result->optionalMessage release];
+  result->optionalMessage = nil;
   return self;
 }
 - (PBAppendableArray *)repeatedMessage {
-  return result.repeatedMessageArray;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return result->repeatedMessageArray;
 }
 - (TestOptimizedForSize*)repeatedMessageAtIndex:(NSUInteger)index {
   return [result repeatedMessageAtIndex:index];
 }
 - (TestEmbedOptimizedForSize_Builder *)addRepeatedMessage:(TestOptimizedForSize*)value {
-  if (result.repeatedMessageArray == nil) {
-    result.repeatedMessageArray = [PBAppendableArray arrayWithValueType:PBArrayValueTypeObject];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  [result.repeatedMessageArray addObject:value];
+  if (result->repeatedMessageArray == nil) {
+    result.repeatedMessageArray = [PBObjectArray array];
+  }
+  PBObjectArrayAddValue(result->repeatedMessageArray, value);
   return self;
 }
 - (TestEmbedOptimizedForSize_Builder *)setRepeatedMessageArray:(NSArray *)array {
-  result.repeatedMessageArray = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeObject];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.repeatedMessageArray = [PBObjectArray arrayWithArray:array valueType:PBArrayValueTypeObject];
   return self;
 }
 - (TestEmbedOptimizedForSize_Builder *)setRepeatedMessageValues:(const TestOptimizedForSize* *)values count:(NSUInteger)count {
-  result.repeatedMessageArray = [PBAppendableArray arrayWithValues:values count:count valueType:PBArrayValueTypeObject];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.repeatedMessageArray = [PBObjectArray arrayWithValues:values count:count valueType:PBArrayValueTypeObject];
   return self;
 }
 - (TestEmbedOptimizedForSize_Builder *)clearRepeatedMessage {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
   result.repeatedMessageArray = nil;
   return self;
 }
@@ -5,14 +5,17 @@
 @implementation UnittestEmptyRoot
 static PBExtensionRegistry* extensionRegistry = nil;
 + (PBExtensionRegistry*) extensionRegistry {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    PBMutableExtensionRegistry* registry = [PBMutableExtensionRegistry registry];
+    [UnittestEmptyRoot registerAllExtensions:registry];
+    extensionRegistry = [registry retain];
+  });
   return extensionRegistry;
 }
 
 + (void) initialize {
   if (self == [UnittestEmptyRoot class]) {
-    PBMutableExtensionRegistry* registry = [PBMutableExtensionRegistry registry];
-    [self registerAllExtensions:registry];
-    extensionRegistry = [registry retain];
   }
 }
 + (void) registerAllExtensions:(PBMutableExtensionRegistry*) registry {
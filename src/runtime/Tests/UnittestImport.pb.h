@@ -32,12 +32,12 @@ BOOL ImportEnumIsValidValue(ImportEnum value);
 @end
 
 @interface ImportMessage : PBGeneratedMessage {
-@private
-  BOOL hasD_:1;
+@package
+  uint32_t hasBits_[1];
   int32_t d;
 }
 - (BOOL) hasD;
-@property (readonly) int32_t d;
+@property (nonatomic, readonly) int32_t d;
 
 + (ImportMessage*) defaultInstance;
 - (ImportMessage*) defaultInstance;
@@ -60,15 +60,24 @@ BOOL ImportEnumIsValidValue(ImportEnum value);
 @interface ImportMessage_Builder : PBGeneratedMessage_Builder {
 @private
   ImportMessage* result;
+  ImportMessage* prototype_;
 }
 
 - (ImportMessage*) defaultInstance;
 
 - (ImportMessage_Builder*) clear;
 - (ImportMessage_Builder*) clone;
+- (ImportMessage_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (ImportMessage_Builder*) recycle:(ImportMessage*) message;
 
 - (ImportMessage*) build;
 - (ImportMessage*) buildPartial;
+- (ImportMessage*) newBuildPartial;
 
 - (ImportMessage_Builder*) mergeFrom:(ImportMessage*) other;
 - (ImportMessage_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -5,14 +5,17 @@
 @implementation UnittestImportRoot
 static PBExtensionRegistry* extensionRegistry = nil;
 + (PBExtensionRegistry*) extensionRegistry {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    PBMutableExtensionRegistry* registry = [PBMutableExtensionRegistry registry];
+    [UnittestImportRoot registerAllExtensions:registry];
+    extensionRegistry = [registry retain];
+  });
   return extensionRegistry;
 }
 
 + (void) initialize {
   if (self == [UnittestImportRoot class]) {
-    PBMutableExtensionRegistry* registry = [PBMutableExtensionRegistry registry];
-    [self registerAllExtensions:registry];
-    extensionRegistry = [registry retain];
   }
 }
 + (void) registerAllExtensions:(PBMutableExtensionRegistry*) registry {
@@ -30,61 +33,69 @@ BOOL ImportEnumIsValidValue(ImportEnum value) {
   }
 }
 @interface ImportMessage ()
-@property int32_t d;
+@property (nonatomic) int32_t d;
+@end
+
+@interface ImportMessage_Builder()
+@property (nonatomic, retain) ImportMessage* result;
+- (id) initWithPrototype:(ImportMessage*) prototype;
+- (void) detachFromPrototype;
 @end
 
 @implementation ImportMessage
 
 - (BOOL) hasD {
-  return !!hasD_;
+  return (hasBits_[0] & 0x1u) != 0;
 }
-- (void) setHasD:(BOOL) value {
-  hasD_ = !!value;
+- (void) setHasD:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x1u;
+  } else {
+    hasBits_[0] &= ~0x1u;
+  }
 }
 @synthesize d;
 - (void) dealloc {
   [super dealloc];
 }
-- (id) init {
-  if ((self = [super init])) {
-    self.d = 0;
-  }
-  return self;
+- (void) clearForReuse {
+  [super clearForReuse];
+  memset(hasBits_, 0, sizeof(hasBits_));
+  d = 0;
 }
 static ImportMessage* defaultImportMessageInstance = nil;
-+ (void) initialize {
-  if (self == [ImportMessage class]) {
-    defaultImportMessageInstance = [[ImportMessage alloc] init];
-  }
-}
 + (ImportMessage*) defaultInstance {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultImportMessageInstance = [[ImportMessage alloc] init];
+  });
   return defaultImportMessageInstance;
 }
 - (ImportMessage*) defaultInstance {
-  return defaultImportMessageInstance;
+  return [ImportMessage defaultInstance];
 }
 - (BOOL) isInitialized {
   return YES;
 }
 - (void) writeToCodedOutputStream:(PBCodedOutputStream*) output {
-  if (self.hasD) {
-    [output writeInt32:1 value:self.d];
+  if (hasBits_[0] & 0x1u) {
+    [output writeInt32:1 value:d];
   }
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = PBGeneratedMessageGetMemoizedSize(&memoizedSerializedSize);
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
-  if (self.hasD) {
-    size += computeInt32Size(1, self.d);
+  size_ = 0;
+  if (hasBits_[0] & 0x1u) {
+    size_ += computeInt32Size(1, d);
   }
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
+  size_ += self.unknownFields.serializedSize;
+  PBGeneratedMessageSetMemoizedSize(&memoizedSerializedSize, size_);
+  return size_;
 }
 + (ImportMessage*) parseFromData:(NSData*) data {
   return (ImportMessage*)[[[ImportMessage builder] mergeFromData:data] build];
@@ -108,7 +119,7 @@ static ImportMessage* defaultImportMessageInstance = nil;
   return [[[ImportMessage_Builder alloc] init] autorelease];
 }
 + (ImportMessage_Builder*) builderWithPrototype:(ImportMessage*) prototype {
-  return [[ImportMessage builder] mergeFrom:prototype];
+  return [[[ImportMessage_Builder alloc] initWithPrototype:prototype] autorelease];
 }
 - (ImportMessage_Builder*) builder {
   return [ImportMessage builder];
@@ -117,8 +128,8 @@ static ImportMessage* defaultImportMessageInstance = nil;
   return [ImportMessage builderWithPrototype:self];
 }
 - (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
-  if (self.hasD) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"d", [NSNumber numberWithInt:self.d]];
+  if (hasBits_[0] & 0x1u) {
+    [output appendFormat:@"%@%@: %@\n", indent, @"d", [NSNumber numberWithInt:d]];
   }
   [self.unknownFields writeDescriptionTo:output withIndent:indent];
 }
@@ -131,46 +142,99 @@ static ImportMessage* defaultImportMessageInstance = nil;
   }
   ImportMessage *otherMessage = other;
   return
-      self.hasD == otherMessage.hasD &&
-      (!self.hasD || self.d == otherMessage.d) &&
-      
+      (hasBits_[0] & 0x1u) == (otherMessage->hasBits_[0] & 0x1u) &&
+      (!(hasBits_[0] & 0x1u) || d == otherMessage->d) &&
       (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
 }
 - (NSUInteger) hash {
-  NSUInteger hashCode = 7;
-  if (self.hasD) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithInt:self.d] hash];
+  NSUInteger hash_ = PBGeneratedMessageGetMemoizedHash(&memoizedHash);
+  if (hash_ != 0) {
+    return hash_;
   }
-  hashCode = hashCode * 31 + [self.unknownFields hash];
-  return hashCode;
-}
-@end
 
-@interface ImportMessage_Builder()
-@property (retain) ImportMessage* result;
+  uint64_t hashCode = 7;
+  if (hasBits_[0] & 0x1u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, (uint64_t)d);
+  }
+  hashCode = PBGeneratedMessageHashMix(hashCode, [self.unknownFields hash]);
+  hash_ = PBGeneratedMessageHashFinish(hashCode);
+  PBGeneratedMessageSetMemoizedHash(&memoizedHash, hash_);
+  return hash_;
+}
 @end
 
 @implementation ImportMessage_Builder
 @synthesize result;
 - (void) dealloc {
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
   self.result = nil;
+  [prototype_ release];
   [super dealloc];
 }
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[[ImportMessage alloc] init] autorelease];
+    result = [ImportMessage recycledInstance];
   }
   return self;
 }
+- (id) initWithPrototype:(ImportMessage*) prototype {
+  if ((self = [super init])) {
+    self.result = prototype;
+    prototype_ = [prototype retain];
+  }
+  return self;
+}
+- (void) detachFromPrototype {
+  ImportMessage* prototype = prototype_;
+  prototype_ = nil;
+  self.result = [[[ImportMessage alloc] init] autorelease];
+  [self mergeFrom:prototype];
+  [prototype release];
+}
+- (PBGeneratedMessage*) internalGetMutableResult {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return [self internalGetResult];
+}
 - (PBGeneratedMessage*) internalGetResult {
   return result;
 }
 - (ImportMessage_Builder*) clear {
-  self.result = [[[ImportMessage alloc] init] autorelease];
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = [[ImportMessage recycledInstance] autorelease];
   return self;
 }
 - (ImportMessage_Builder*) clone {
-  return [ImportMessage builderWithPrototype:result];
+  if (prototype_ != nil) {
+    return [[[ImportMessage_Builder alloc] initWithPrototype:prototype_] autorelease];
+  }
+  return [[ImportMessage builder] mergeFrom:result];
+}
+- (ImportMessage_Builder*) reset {
+  if (result == nil || prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    self.result = [[ImportMessage recycledInstance] autorelease];
+  } else {
+    [result clearForReuse];
+  }
+  return self;
+}
+- (ImportMessage_Builder*) recycle:(ImportMessage*) message {
+  if (message == [ImportMessage defaultInstance]) {
+    @throw [NSException exceptionWithName:@"IllegalArgument" reason:@"Cannot recycle the default instance" userInfo:nil];
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = message;
+  return [self reset];
 }
 - (ImportMessage*) defaultInstance {
   return [ImportMessage defaultInstance];
@@ -180,16 +244,29 @@ static ImportMessage* defaultImportMessageInstance = nil;
   return [self buildPartial];
 }
 - (ImportMessage*) buildPartial {
-  ImportMessage* returnMe = [[result retain] autorelease];
-  self.result = nil;
+  return [[self newBuildPartial] autorelease];
+}
+- (ImportMessage*) newBuildPartial {
+  if (prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    ImportMessage* returnMe = result;
+    result = nil;
+    return returnMe;
+  }
+  ImportMessage* returnMe = result;
+  result = nil;
   return returnMe;
 }
 - (ImportMessage_Builder*) mergeFrom:(ImportMessage*) other {
   if (other == [ImportMessage defaultInstance]) {
     return self;
   }
-  if (other.hasD) {
-    [self setD:other.d];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (other->hasBits_[0] & 0x1u) {
+    [self setD:other->d];
   }
   [self mergeUnknownFields:other.unknownFields];
   return self;
@@ -198,18 +275,29 @@ static ImportMessage* defaultImportMessageInstance = nil;
   return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
 }
 - (ImportMessage_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  PBUnknownFieldSet_Builder* unknownFields = nil;
   while (YES) {
     int32_t tag = [input readTag];
     switch (tag) {
       case 0:
-        [self setUnknownFields:[unknownFields build]];
+        if (unknownFields != nil) {
+          [self setUnknownFields:[unknownFields build]];
+        }
         return self;
       default: {
-        if (![self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag]) {
-          [self setUnknownFields:[unknownFields build]];
+        if (PBWireFormatGetTagWireType(tag) == PBWireFormatEndGroup) {
+          if (unknownFields != nil) {
+            [self setUnknownFields:[unknownFields build]];
+          }
           return self;
         }
+        if (unknownFields == nil) {
+          unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+        }
+        [self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag];
         break;
       }
       case 8: {
@@ -220,19 +308,25 @@ static ImportMessage* defaultImportMessageInstance = nil;
   }
 }
 - (BOOL) hasD {
-  return result.hasD;
+  return (result->hasBits_[0] & 0x1u) != 0;
 }
 - (int32_t) d {
-  return result.d;
+  return result->d;
 }
 - (ImportMessage_Builder*) setD:(int32_t) value {
-  result.hasD = YES;
-  result.d = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x1u;
+  result->d = value;
   return self;
 }
 - (ImportMessage_Builder*) clearD {
-  result.hasD = NO;
-  result.d = 0;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x1u;
+  result->d = 0;
   return self;
 }
 @end
@@ -32,12 +32,12 @@ BOOL ImportEnumLiteIsValidValue(ImportEnumLite value);
 @end
 
 @interface ImportMessageLite : PBGeneratedMessage {
-@private
-  BOOL hasD_:1;
+@package
+  uint32_t hasBits_[1];
   int32_t d;
 }
 - (BOOL) hasD;
-@property (readonly) int32_t d;
+@property (nonatomic, readonly) int32_t d;
 
 + (ImportMessageLite*) defaultInstance;
 - (ImportMessageLite*) defaultInstance;
@@ -60,15 +60,24 @@ BOOL ImportEnumLiteIsValidValue(ImportEnumLite value);
 @interface ImportMessageLite_Builder : PBGeneratedMessage_Builder {
 @private
   ImportMessageLite* result;
+  ImportMessageLite* prototype_;
 }
 
 - (ImportMessageLite*) defaultInstance;
 
 - (ImportMessageLite_Builder*) clear;
 - (ImportMessageLite_Builder*) clone;
+- (ImportMessageLite_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (ImportMessageLite_Builder*) recycle:(ImportMessageLite*) message;
 
 - (ImportMessageLite*) build;
 - (ImportMessageLite*) buildPartial;
+- (ImportMessageLite*) newBuildPartial;
 
 - (ImportMessageLite_Builder*) mergeFrom:(ImportMessageLite*) other;
 - (ImportMessageLite_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
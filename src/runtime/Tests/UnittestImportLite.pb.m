@@ -5,14 +5,17 @@
 @implementation UnittestImportLiteRoot
 static PBExtensionRegistry* extensionRegistry = nil;
 + (PBExtensionRegistry*) extensionRegistry {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    PBMutableExtensionRegistry* registry = [PBMutableExtensionRegistry registry];
+    [UnittestImportLiteRoot registerAllExtensions:registry];
+    extensionRegistry = [registry retain];
+  });
   return extensionRegistry;
 }
 
 + (void) initialize {
   if (self == [UnittestImportLiteRoot class]) {
-    PBMutableExtensionRegistry* registry = [PBMutableExtensionRegistry registry];
-    [self registerAllExtensions:registry];
-    extensionRegistry = [registry retain];
   }
 }
 + (void) registerAllExtensions:(PBMutableExtensionRegistry*) registry {
@@ -30,61 +33,67 @@ BOOL ImportEnumLiteIsValidValue(ImportEnumLite value) {
   }
 }
 @interface ImportMessageLite ()
-@property int32_t d;
+@property (nonatomic) int32_t d;
+@end
+
+@interface ImportMessageLite_Builder()
+@property (nonatomic, retain) ImportMessageLite* result;
+- (id) initWithPrototype:(ImportMessageLite*) prototype;
+- (void) detachFromPrototype;
 @end
 
 @implementation ImportMessageLite
 
 - (BOOL) hasD {
-  return !!hasD_;
+  return (hasBits_[0] & 0x1u) != 0;
 }
-- (void) setHasD:(BOOL) value {
-  hasD_ = !!value;
+- (void) setHasD:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x1u;
+  } else {
+    hasBits_[0] &= ~0x1u;
+  }
 }
 @synthesize d;
 - (void) dealloc {
   [super dealloc];
 }
-- (id) init {
-  if ((self = [super init])) {
-    self.d = 0;
-  }
-  return self;
+- (void) clearForReuse {
+  [super clearForReuse];
+  memset(hasBits_, 0, sizeof(hasBits_));
+  d = 0;
 }
 static ImportMessageLite* defaultImportMessageLiteInstance = nil;
-+ (void) initialize {
-  if (self == [ImportMessageLite class]) {
-    defaultImportMessageLiteInstance = [[ImportMessageLite alloc] init];
-  }
-}
 + (ImportMessageLite*) defaultInstance {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultImportMessageLiteInstance = [[ImportMessageLite alloc] init];
+  });
   return defaultImportMessageLiteInstance;
 }
 - (ImportMessageLite*) defaultInstance {
-  return defaultImportMessageLiteInstance;
+  return [ImportMessageLite defaultInstance];
 }
 - (BOOL) isInitialized {
   return YES;
 }
 - (void) writeToCodedOutputStream:(PBCodedOutputStream*) output {
-  if (self.hasD) {
-    [output writeInt32:1 value:self.d];
+  if (hasBits_[0] & 0x1u) {
+    [output writeInt32:1 value:d];
   }
-  [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = PBGeneratedMessageGetMemoizedSize(&memoizedSerializedSize);
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
-  if (self.hasD) {
-    size += computeInt32Size(1, self.d);
+  size_ = 0;
+  if (hasBits_[0] & 0x1u) {
+    size_ += computeInt32Size(1, d);
   }
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
+  PBGeneratedMessageSetMemoizedSize(&memoizedSerializedSize, size_);
+  return size_;
 }
 + (ImportMessageLite*) parseFromData:(NSData*) data {
   return (ImportMessageLite*)[[[ImportMessageLite builder] mergeFromData:data] build];
@@ -108,7 +117,7 @@ static ImportMessageLite* defaultImportMessageLiteInstance = nil;
   return [[[ImportMessageLite_Builder alloc] init] autorelease];
 }
 + (ImportMessageLite_Builder*) builderWithPrototype:(ImportMessageLite*) prototype {
-  return [[ImportMessageLite builder] mergeFrom:prototype];
+  return [[[ImportMessageLite_Builder alloc] initWithPrototype:prototype] autorelease];
 }
 - (ImportMessageLite_Builder*) builder {
   return [ImportMessageLite builder];
@@ -116,12 +125,6 @@ static ImportMessageLite* defaultImportMessageLiteInstance = nil;
 - (ImportMessageLite_Builder*) toBuilder {
   return [ImportMessageLite builderWithPrototype:self];
 }
-- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
-  if (self.hasD) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"d", [NSNumber numberWithInt:self.d]];
-  }
-  [self.unknownFields writeDescriptionTo:output withIndent:indent];
-}
 - (BOOL) isEqual:(id)other {
   if (other == self) {
     return YES;
@@ -131,46 +134,98 @@ static ImportMessageLite* defaultImportMessageLiteInstance = nil;
   }
   ImportMessageLite *otherMessage = other;
   return
-      self.hasD == otherMessage.hasD &&
-      (!self.hasD || self.d == otherMessage.d) &&
-      
-      (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
+      (hasBits_[0] & 0x1u) == (otherMessage->hasBits_[0] & 0x1u) &&
+      (!(hasBits_[0] & 0x1u) || d == otherMessage->d) &&
+      YES;
 }
 - (NSUInteger) hash {
-  NSUInteger hashCode = 7;
-  if (self.hasD) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithInt:self.d] hash];
+  NSUInteger hash_ = PBGeneratedMessageGetMemoizedHash(&memoizedHash);
+  if (hash_ != 0) {
+    return hash_;
   }
-  hashCode = hashCode * 31 + [self.unknownFields hash];
-  return hashCode;
-}
-@end
 
-@interface ImportMessageLite_Builder()
-@property (retain) ImportMessageLite* result;
+  uint64_t hashCode = 7;
+  if (hasBits_[0] & 0x1u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, (uint64_t)d);
+  }
+  hash_ = PBGeneratedMessageHashFinish(hashCode);
+  PBGeneratedMessageSetMemoizedHash(&memoizedHash, hash_);
+  return hash_;
+}
 @end
 
 @implementation ImportMessageLite_Builder
 @synthesize result;
 - (void) dealloc {
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
   self.result = nil;
+  [prototype_ release];
   [super dealloc];
 }
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[[ImportMessageLite alloc] init] autorelease];
+    result = [ImportMessageLite recycledInstance];
+  }
+  return self;
+}
+- (id) initWithPrototype:(ImportMessageLite*) prototype {
+  if ((self = [super init])) {
+    self.result = prototype;
+    prototype_ = [prototype retain];
   }
   return self;
 }
+- (void) detachFromPrototype {
+  ImportMessageLite* prototype = prototype_;
+  prototype_ = nil;
+  self.result = [[[ImportMessageLite alloc] init] autorelease];
+  [self mergeFrom:prototype];
+  [prototype release];
+}
+- (PBGeneratedMessage*) internalGetMutableResult {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return [self internalGetResult];
+}
 - (PBGeneratedMessage*) internalGetResult {
   return result;
 }
 - (ImportMessageLite_Builder*) clear {
-  self.result = [[[ImportMessageLite alloc] init] autorelease];
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = [[ImportMessageLite recycledInstance] autorelease];
   return self;
 }
 - (ImportMessageLite_Builder*) clone {
-  return [ImportMessageLite builderWithPrototype:result];
+  if (prototype_ != nil) {
+    return [[[ImportMessageLite_Builder alloc] initWithPrototype:prototype_] autorelease];
+  }
+  return [[ImportMessageLite builder] mergeFrom:result];
+}
+- (ImportMessageLite_Builder*) reset {
+  if (result == nil || prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    self.result = [[ImportMessageLite recycledInstance] autorelease];
+  } else {
+    [result clearForReuse];
+  }
+  return self;
+}
+- (ImportMessageLite_Builder*) recycle:(ImportMessageLite*) message {
+  if (message == [ImportMessageLite defaultInstance]) {
+    @throw [NSException exceptionWithName:@"IllegalArgument" reason:@"Cannot recycle the default instance" userInfo:nil];
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = message;
+  return [self reset];
 }
 - (ImportMessageLite*) defaultInstance {
   return [ImportMessageLite defaultInstance];
@@ -180,36 +235,49 @@ static ImportMessageLite* defaultImportMessageLiteInstance = nil;
   return [self buildPartial];
 }
 - (ImportMessageLite*) buildPartial {
-  ImportMessageLite* returnMe = [[result retain] autorelease];
-  self.result = nil;
+  return [[self newBuildPartial] autorelease];
+}
+- (ImportMessageLite*) newBuildPartial {
+  if (prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    ImportMessageLite* returnMe = result;
+    result = nil;
+    return returnMe;
+  }
+  ImportMessageLite* returnMe = result;
+  result = nil;
   return returnMe;
 }
 - (ImportMessageLite_Builder*) mergeFrom:(ImportMessageLite*) other {
   if (other == [ImportMessageLite defaultInstance]) {
     return self;
   }
-  if (other.hasD) {
-    [self setD:other.d];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (other->hasBits_[0] & 0x1u) {
+    [self setD:other->d];
   }
-  [self mergeUnknownFields:other.unknownFields];
   return self;
 }
 - (ImportMessageLite_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input {
   return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
 }
 - (ImportMessageLite_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
   while (YES) {
     int32_t tag = [input readTag];
     switch (tag) {
       case 0:
-        [self setUnknownFields:[unknownFields build]];
         return self;
       default: {
-        if (![self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag]) {
-          [self setUnknownFields:[unknownFields build]];
+        if (PBWireFormatGetTagWireType(tag) == PBWireFormatEndGroup) {
           return self;
         }
+        [input skipField:tag];
         break;
       }
       case 8: {
@@ -220,19 +288,25 @@ static ImportMessageLite* defaultImportMessageLiteInstance = nil;
   }
 }
 - (BOOL) hasD {
-  return result.hasD;
+  return (result->hasBits_[0] & 0x1u) != 0;
 }
 - (int32_t) d {
-  return result.d;
+  return result->d;
 }
 - (ImportMessageLite_Builder*) setD:(int32_t) value {
-  result.hasD = YES;
-  result.d = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x1u;
+  result->d = value;
   return self;
 }
 - (ImportMessageLite_Builder*) clearD {
-  result.hasD = NO;
-  result.d = 0;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x1u;
+  result->d = 0;
   return self;
 }
 @end
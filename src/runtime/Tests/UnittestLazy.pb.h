@@ -0,0 +1,217 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+
+#import <ProtocolBuffers/ProtocolBuffers.h>
+
+#import "Unittest.pb.h"
+
+@class BarRequest;
+@class BarRequest_Builder;
+@class BarResponse;
+@class BarResponse_Builder;
+@class FooRequest;
+@class FooRequest_Builder;
+@class FooResponse;
+@class FooResponse_Builder;
+@class ForeignMessage;
+@class ForeignMessage_Builder;
+@class ImportMessage;
+@class ImportMessage_Builder;
+@class OneBytes;
+@class OneBytes_Builder;
+@class OneString;
+@class OneString_Builder;
+@class OptionalGroup_extension;
+@class OptionalGroup_extension_Builder;
+@class RepeatedGroup_extension;
+@class RepeatedGroup_extension_Builder;
+@class SparseEnumMessage;
+@class SparseEnumMessage_Builder;
+@class TestAllExtensions;
+@class TestAllExtensions_Builder;
+@class TestAllTypes;
+@class TestAllTypes_Builder;
+@class TestAllTypes_NestedMessage;
+@class TestAllTypes_NestedMessage_Builder;
+@class TestAllTypes_OptionalGroup;
+@class TestAllTypes_OptionalGroup_Builder;
+@class TestAllTypes_RepeatedGroup;
+@class TestAllTypes_RepeatedGroup_Builder;
+@class TestCamelCaseFieldNames;
+@class TestCamelCaseFieldNames_Builder;
+@class TestDeprecatedFields;
+@class TestDeprecatedFields_Builder;
+@class TestDupFieldNumber;
+@class TestDupFieldNumber_Bar;
+@class TestDupFieldNumber_Bar_Builder;
+@class TestDupFieldNumber_Builder;
+@class TestDupFieldNumber_Foo;
+@class TestDupFieldNumber_Foo_Builder;
+@class TestDynamicExtensions;
+@class TestDynamicExtensions_Builder;
+@class TestDynamicExtensions_DynamicMessageType;
+@class TestDynamicExtensions_DynamicMessageType_Builder;
+@class TestEmptyMessage;
+@class TestEmptyMessageWithExtensions;
+@class TestEmptyMessageWithExtensions_Builder;
+@class TestEmptyMessage_Builder;
+@class TestExtremeDefaultValues;
+@class TestExtremeDefaultValues_Builder;
+@class TestFieldOrderings;
+@class TestFieldOrderings_Builder;
+@class TestForeignNested;
+@class TestForeignNested_Builder;
+@class TestLazyMessage;
+@class TestLazyMessage_Builder;
+@class TestMultipleExtensionRanges;
+@class TestMultipleExtensionRanges_Builder;
+@class TestMutualRecursionA;
+@class TestMutualRecursionA_Builder;
+@class TestMutualRecursionB;
+@class TestMutualRecursionB_Builder;
+@class TestNestedExtension;
+@class TestNestedExtension_Builder;
+@class TestNestedMessageHasBits;
+@class TestNestedMessageHasBits_Builder;
+@class TestNestedMessageHasBits_NestedMessage;
+@class TestNestedMessageHasBits_NestedMessage_Builder;
+@class TestPackedExtensions;
+@class TestPackedExtensions_Builder;
+@class TestPackedTypes;
+@class TestPackedTypes_Builder;
+@class TestReallyLargeTagNumber;
+@class TestReallyLargeTagNumber_Builder;
+@class TestRecursiveMessage;
+@class TestRecursiveMessage_Builder;
+@class TestRepeatedScalarDifferentTagSizes;
+@class TestRepeatedScalarDifferentTagSizes_Builder;
+@class TestRequired;
+@class TestRequiredForeign;
+@class TestRequiredForeign_Builder;
+@class TestRequired_Builder;
+@class TestUnpackedTypes;
+@class TestUnpackedTypes_Builder;
+#ifndef __has_feature
+  #define __has_feature(x) 0 // Compatibility with non-clang compilers.
+#endif // __has_feature
+
+#ifndef NS_RETURNS_NOT_RETAINED
+  #if __has_feature(attribute_ns_returns_not_retained)
+    #define NS_RETURNS_NOT_RETAINED __attribute__((ns_returns_not_retained))
+  #else
+    #define NS_RETURNS_NOT_RETAINED
+  #endif
+#endif
+
+
+@interface UnittestLazyRoot : NSObject {
+}
++ (PBExtensionRegistry*) extensionRegistry;
++ (void) registerAllExtensions:(PBMutableExtensionRegistry*) registry;
+@end
+
+@interface TestLazyMessage : PBGeneratedMessage {
+@package
+  uint32_t hasBits_[1];
+  int32_t int32Value;
+  TestAllTypes* allTypes;
+  NSData* allTypesBytes_;
+  PBExtensionRegistry* allTypesRegistry_;
+  TestAllExtensions* allExtensions;
+  NSData* allExtensionsBytes_;
+  PBExtensionRegistry* allExtensionsRegistry_;
+  TestRequired* required;
+  NSData* requiredBytes_;
+  PBExtensionRegistry* requiredRegistry_;
+}
+- (BOOL) hasAllTypes;
+- (BOOL) hasAllExtensions;
+- (BOOL) hasRequired;
+- (BOOL) hasInt32Value;
+@property (nonatomic, readonly, retain) TestAllTypes* allTypes;
+@property (nonatomic, readonly, retain) TestAllExtensions* allExtensions;
+@property (nonatomic, readonly, retain) TestRequired* required;
+@property (nonatomic, readonly) int32_t int32Value;
+
++ (TestLazyMessage*) defaultInstance;
+- (TestLazyMessage*) defaultInstance;
+
+- (BOOL) isInitialized;
+- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output;
+- (TestLazyMessage_Builder*) builder;
++ (TestLazyMessage_Builder*) builder;
++ (TestLazyMessage_Builder*) builderWithPrototype:(TestLazyMessage*) prototype;
+- (TestLazyMessage_Builder*) toBuilder;
+
++ (TestLazyMessage*) parseFromData:(NSData*) data;
++ (TestLazyMessage*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
++ (TestLazyMessage*) parseFromInputStream:(NSInputStream*) input;
++ (TestLazyMessage*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
++ (TestLazyMessage*) parseFromCodedInputStream:(PBCodedInputStream*) input;
++ (TestLazyMessage*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
+@end
+
+@interface TestLazyMessage_Builder : PBGeneratedMessage_Builder {
+@private
+  TestLazyMessage* result;
+  TestLazyMessage* prototype_;
+  TestAllTypes_Builder* allTypesBuilder_;
+  TestAllTypes_Builder* allTypesSpareBuilder_;
+  TestAllExtensions_Builder* allExtensionsBuilder_;
+  TestAllExtensions_Builder* allExtensionsSpareBuilder_;
+  TestRequired_Builder* requiredBuilder_;
+  TestRequired_Builder* requiredSpareBuilder_;
+}
+
+- (TestLazyMessage*) defaultInstance;
+
+- (TestLazyMessage_Builder*) clear;
+- (TestLazyMessage_Builder*) clone;
+- (TestLazyMessage_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (TestLazyMessage_Builder*) recycle:(TestLazyMessage*) message;
+
+- (TestLazyMessage*) build;
+- (TestLazyMessage*) buildPartial;
+- (TestLazyMessage*) newBuildPartial;
+
+- (TestLazyMessage_Builder*) mergeFrom:(TestLazyMessage*) other;
+- (TestLazyMessage_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
+- (TestLazyMessage_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
+
+- (BOOL) hasAllTypes;
+- (TestAllTypes*) allTypes;
+- (TestLazyMessage_Builder*) setAllTypes:(TestAllTypes*) value;
+- (TestLazyMessage_Builder*) setAllTypesBuilder:(TestAllTypes_Builder*) builderForValue;
+- (TestLazyMessage_Builder*) mergeAllTypes:(TestAllTypes*) value;
+- (TestLazyMessage_Builder*) clearAllTypes;
+- (TestLazyMessage_Builder*) mergeAllTypesData:(NSData*) data
+    extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
+
+- (BOOL) hasAllExtensions;
+- (TestAllExtensions*) allExtensions;
+- (TestLazyMessage_Builder*) setAllExtensions:(TestAllExtensions*) value;
+- (TestLazyMessage_Builder*) setAllExtensionsBuilder:(TestAllExtensions_Builder*) builderForValue;
+- (TestLazyMessage_Builder*) mergeAllExtensions:(TestAllExtensions*) value;
+- (TestLazyMessage_Builder*) clearAllExtensions;
+- (TestLazyMessage_Builder*) mergeAllExtensionsData:(NSData*) data
+    extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
+
+- (BOOL) hasRequired;
+- (TestRequired*) required;
+- (TestLazyMessage_Builder*) setRequired:(TestRequired*) value;
+- (TestLazyMessage_Builder*) setRequiredBuilder:(TestRequired_Builder*) builderForValue;
+- (TestLazyMessage_Builder*) mergeRequired:(TestRequired*) value;
+- (TestLazyMessage_Builder*) clearRequired;
+- (TestLazyMessage_Builder*) mergeRequiredData:(NSData*) data
+    extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
+
+- (BOOL) hasInt32Value;
+- (int32_t) int32Value;
+- (TestLazyMessage_Builder*) setInt32Value:(int32_t) value;
+- (TestLazyMessage_Builder*) clearInt32Value;
+@end
+
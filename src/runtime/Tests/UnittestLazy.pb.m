@@ -0,0 +1,928 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+
+#import "UnittestLazy.pb.h"
+
+@implementation UnittestLazyRoot
+static PBExtensionRegistry* extensionRegistry = nil;
++ (PBExtensionRegistry*) extensionRegistry {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    PBMutableExtensionRegistry* registry = [PBMutableExtensionRegistry registry];
+    [UnittestLazyRoot registerAllExtensions:registry];
+    [UnittestRoot registerAllExtensions:registry];
+    extensionRegistry = [registry retain];
+  });
+  return extensionRegistry;
+}
+
++ (void) initialize {
+  if (self == [UnittestLazyRoot class]) {
+  }
+}
++ (void) registerAllExtensions:(PBMutableExtensionRegistry*) registry {
+}
+@end
+
+@interface TestLazyMessage ()
+@property (nonatomic, retain) TestAllTypes* allTypes;
+@property (nonatomic, retain) TestAllExtensions* allExtensions;
+@property (nonatomic, retain) TestRequired* required;
+@property (nonatomic) int32_t int32Value;
+- (void) setInitialized;
+@end
+
+@interface TestLazyMessage_Builder()
+@property (nonatomic, retain) TestLazyMessage* result;
+- (id) initWithPrototype:(TestLazyMessage*) prototype;
+- (void) detachFromPrototype;
+- (void) freezeSubBuilders;
+- (void) dropSubBuilders;
+- (void) resetSubBuilders;
+@end
+
+@implementation TestLazyMessage
+
+- (BOOL) hasAllTypes {
+  return (hasBits_[0] & 0x1u) != 0;
+}
+- (void) setHasAllTypes:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x1u;
+  } else {
+    hasBits_[0] &= ~0x1u;
+  }
+}
+@synthesize allTypes;
+- (TestAllTypes*) allTypes {
+  if (allTypes == nil) {
+    if (allTypesBytes_ == nil) {
+      return [TestAllTypes defaultInstance];
+    }
+    TestAllTypes_Builder* builder = [[TestAllTypes_Builder alloc] init];
+    @try {
+      [builder mergeFromData:allTypesBytes_ extensionRegistry:allTypesRegistry_];
+      PBGeneratedMessageSetLazyValue((id*)&allTypes, [builder newBuildPartial]);
+    } @finally {
+      [builder release];
+    }
+  }
+  return allTypes;
+}
+- (BOOL) hasAllExtensions {
+  return (hasBits_[0] & 0x2u) != 0;
+}
+- (void) setHasAllExtensions:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x2u;
+  } else {
+    hasBits_[0] &= ~0x2u;
+  }
+}
+@synthesize allExtensions;
+- (TestAllExtensions*) allExtensions {
+  if (allExtensions == nil) {
+    if (allExtensionsBytes_ == nil) {
+      return [TestAllExtensions defaultInstance];
+    }
+    TestAllExtensions_Builder* builder = [[TestAllExtensions_Builder alloc] init];
+    @try {
+      [builder mergeFromData:allExtensionsBytes_ extensionRegistry:allExtensionsRegistry_];
+      PBGeneratedMessageSetLazyValue((id*)&allExtensions, [builder newBuildPartial]);
+    } @finally {
+      [builder release];
+    }
+  }
+  return allExtensions;
+}
+- (BOOL) hasRequired {
+  return (hasBits_[0] & 0x4u) != 0;
+}
+- (void) setHasRequired:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x4u;
+  } else {
+    hasBits_[0] &= ~0x4u;
+  }
+}
+@synthesize required;
+- (TestRequired*) required {
+  if (required == nil) {
+    if (requiredBytes_ == nil) {
+      return [TestRequired defaultInstance];
+    }
+    TestRequired_Builder* builder = [[TestRequired_Builder alloc] init];
+    @try {
+      [builder mergeFromData:requiredBytes_ extensionRegistry:requiredRegistry_];
+      PBGeneratedMessageSetLazyValue((id*)&required, [builder newBuildPartial]);
+    } @finally {
+      [builder release];
+    }
+  }
+  return required;
+}
+- (BOOL) hasInt32Value {
+  return (hasBits_[0] & 0x8u) != 0;
+}
+- (void) setHasInt32Value:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x8u;
+  } else {
+    hasBits_[0] &= ~0x8u;
+  }
+}
+@synthesize int32Value;
+- (void) dealloc {
+  [allTypes release];
+  [allTypesBytes_ release];
+  [allTypesRegistry_ release];
+  [allExtensions release];
+  [allExtensionsBytes_ release];
+  [allExtensionsRegistry_ release];
+  [required release];
+  [requiredBytes_ release];
+  [requiredRegistry_ release];
+  [super dealloc];
+}
+- (void) clearForReuse {
+  [super clearForReuse];
+  memset(hasBits_, 0, sizeof(hasBits_));
+  [allTypesBytes_ release];
+  allTypesBytes_ = nil;
+  [allTypesRegistry_ release];
+  allTypesRegistry_ = nil;
+  [allTypes release];
+  allTypes = nil;
+  [allExtensionsBytes_ release];
+  allExtensionsBytes_ = nil;
+  [allExtensionsRegistry_ release];
+  allExtensionsRegistry_ = nil;
+  [allExtensions release];
+  allExtensions = nil;
+  [requiredBytes_ release];
+  requiredBytes_ = nil;
+  [requiredRegistry_ release];
+  requiredRegistry_ = nil;
+  [required release];
+  required = nil;
+  int32Value = 0;
+}
+static TestLazyMessage* defaultTestLazyMessageInstance = nil;
++ (TestLazyMessage*) defaultInstance {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultTestLazyMessageInstance = [[TestLazyMessage alloc] init];
+  });
+  return defaultTestLazyMessageInstance;
+}
+- (TestLazyMessage*) defaultInstance {
+  return [TestLazyMessage defaultInstance];
+}
+- (void) setInitialized {
+  hasBits_[0] |= 0x10u;
+}
+- (BOOL) isInitialized {
+  if ((hasBits_[0] & 0x10u) != 0) {
+    return YES;
+  }
+  if ((hasBits_[0] & 0x2u) != 0) {
+    if (!self.allExtensions.isInitialized) {
+      return NO;
+    }
+  }
+  if ((hasBits_[0] & 0x4u) != 0) {
+    if (!self.required.isInitialized) {
+      return NO;
+    }
+  }
+  return YES;
+}
+- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output {
+  if (hasBits_[0] & 0x1u) {
+    if (allTypesBytes_ != nil) {
+      [output writeData:1 value:allTypesBytes_];
+    } else {
+      [output writeMessage:1 value:allTypes];
+    }
+  }
+  if (hasBits_[0] & 0x2u) {
+    if (allExtensionsBytes_ != nil) {
+      [output writeData:2 value:allExtensionsBytes_];
+    } else {
+      [output writeMessage:2 value:allExtensions];
+    }
+  }
+  if (hasBits_[0] & 0x4u) {
+    if (requiredBytes_ != nil) {
+      [output writeData:3 value:requiredBytes_];
+    } else {
+      [output writeMessage:3 value:required];
+    }
+  }
+  if (hasBits_[0] & 0x8u) {
+    [output writeInt32:4 value:int32Value];
+  }
+  [self.unknownFields writeToCodedOutputStream:output];
+}
+- (int32_t) serializedSize {
+  int32_t size_ = PBGeneratedMessageGetMemoizedSize(&memoizedSerializedSize);
+  if (size_ != -1) {
+    return size_;
+  }
+
+  size_ = 0;
+  if (hasBits_[0] & 0x1u) {
+    if (allTypesBytes_ != nil) {
+      size_ += computeDataSize(1, allTypesBytes_);
+    } else {
+      size_ += computeMessageSize(1, allTypes);
+    }
+  }
+  if (hasBits_[0] & 0x2u) {
+    if (allExtensionsBytes_ != nil) {
+      size_ += computeDataSize(2, allExtensionsBytes_);
+    } else {
+      size_ += computeMessageSize(2, allExtensions);
+    }
+  }
+  if (hasBits_[0] & 0x4u) {
+    if (requiredBytes_ != nil) {
+      size_ += computeDataSize(3, requiredBytes_);
+    } else {
+      size_ += computeMessageSize(3, required);
+    }
+  }
+  if (hasBits_[0] & 0x8u) {
+    size_ += computeInt32Size(4, int32Value);
+  }
+  size_ += self.unknownFields.serializedSize;
+  PBGeneratedMessageSetMemoizedSize(&memoizedSerializedSize, size_);
+  return size_;
+}
++ (TestLazyMessage*) parseFromData:(NSData*) data {
+  return (TestLazyMessage*)[[[TestLazyMessage builder] mergeFromData:data] build];
+}
++ (TestLazyMessage*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
+  return (TestLazyMessage*)[[[TestLazyMessage builder] mergeFromData:data extensionRegistry:extensionRegistry] build];
+}
++ (TestLazyMessage*) parseFromInputStream:(NSInputStream*) input {
+  return (TestLazyMessage*)[[[TestLazyMessage builder] mergeFromInputStream:input] build];
+}
++ (TestLazyMessage*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
+  return (TestLazyMessage*)[[[TestLazyMessage builder] mergeFromInputStream:input extensionRegistry:extensionRegistry] build];
+}
++ (TestLazyMessage*) parseFromCodedInputStream:(PBCodedInputStream*) input {
+  return (TestLazyMessage*)[[[TestLazyMessage builder] mergeFromCodedInputStream:input] build];
+}
++ (TestLazyMessage*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
+  return (TestLazyMessage*)[[[TestLazyMessage builder] mergeFromCodedInputStream:input extensionRegistry:extensionRegistry] build];
+}
++ (TestLazyMessage_Builder*) builder {
+  return [[[TestLazyMessage_Builder alloc] init] autorelease];
+}
++ (TestLazyMessage_Builder*) builderWithPrototype:(TestLazyMessage*) prototype {
+  return [[[TestLazyMessage_Builder alloc] initWithPrototype:prototype] autorelease];
+}
+- (TestLazyMessage_Builder*) builder {
+  return [TestLazyMessage builder];
+}
+- (TestLazyMessage_Builder*) toBuilder {
+  return [TestLazyMessage builderWithPrototype:self];
+}
+- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
+  if (hasBits_[0] & 0x1u) {
+    [output appendFormat:@"%@%@ {\n", indent, @"allTypes"];
+    [self.allTypes writeDescriptionTo:output
+                         withIndent:[NSString stringWithFormat:@"%@  ", indent]];
+    [output appendFormat:@"%@}\n", indent];
+  }
+  if (hasBits_[0] & 0x2u) {
+    [output appendFormat:@"%@%@ {\n", indent, @"allExtensions"];
+    [self.allExtensions writeDescriptionTo:output
+                         withIndent:[NSString stringWithFormat:@"%@  ", indent]];
+    [output appendFormat:@"%@}\n", indent];
+  }
+  if (hasBits_[0] & 0x4u) {
+    [output appendFormat:@"%@%@ {\n", indent, @"required"];
+    [self.required writeDescriptionTo:output
+                         withIndent:[NSString stringWithFormat:@"%@  ", indent]];
+    [output appendFormat:@"%@}\n", indent];
+  }
+  if (hasBits_[0] & 0x8u) {
+    [output appendFormat:@"%@%@: %@\n", indent, @"int32Value", [NSNumber numberWithInt:int32Value]];
+  }
+  [self.unknownFields writeDescriptionTo:output withIndent:indent];
+}
+- (BOOL) isEqual:(id)other {
+  if (other == self) {
+    return YES;
+  }
+  if (![other isKindOfClass:[TestLazyMessage class]]) {
+    return NO;
+  }
+  TestLazyMessage *otherMessage = other;
+  return
+      (hasBits_[0] & 0x1u) == (otherMessage->hasBits_[0] & 0x1u) &&
+      (!(hasBits_[0] & 0x1u) || [self.allTypes isEqual:otherMessage.allTypes]) &&
+      (hasBits_[0] & 0x2u) == (otherMessage->hasBits_[0] & 0x2u) &&
+      (!(hasBits_[0] & 0x2u) || [self.allExtensions isEqual:otherMessage.allExtensions]) &&
+      (hasBits_[0] & 0x4u) == (otherMessage->hasBits_[0] & 0x4u) &&
+      (!(hasBits_[0] & 0x4u) || [self.required isEqual:otherMessage.required]) &&
+      (hasBits_[0] & 0x8u) == (otherMessage->hasBits_[0] & 0x8u) &&
+      (!(hasBits_[0] & 0x8u) || int32Value == otherMessage->int32Value) &&
+      (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
+}
+- (NSUInteger) hash {
+  NSUInteger hash_ = PBGeneratedMessageGetMemoizedHash(&memoizedHash);
+  if (hash_ != 0) {
+    return hash_;
+  }
+
+  uint64_t hashCode = 7;
+  if (hasBits_[0] & 0x1u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [self.allTypes hash]);
+  }
+  if (hasBits_[0] & 0x2u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [self.allExtensions hash]);
+  }
+  if (hasBits_[0] & 0x4u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [self.required hash]);
+  }
+  if (hasBits_[0] & 0x8u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, (uint64_t)int32Value);
+  }
+  hashCode = PBGeneratedMessageHashMix(hashCode, [self.unknownFields hash]);
+  hash_ = PBGeneratedMessageHashFinish(hashCode);
+  PBGeneratedMessageSetMemoizedHash(&memoizedHash, hash_);
+  return hash_;
+}
+@end
+
+@implementation TestLazyMessage_Builder
+@synthesize result;
+- (void) dealloc {
+  [self dropSubBuilders];
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
+  self.result = nil;
+  [prototype_ release];
+  [super dealloc];
+}
+- (id) init {
+  if ((self = [super init])) {
+    result = [TestLazyMessage recycledInstance];
+  }
+  return self;
+}
+- (id) initWithPrototype:(TestLazyMessage*) prototype {
+  if ((self = [super init])) {
+    self.result = prototype;
+    prototype_ = [prototype retain];
+  }
+  return self;
+}
+- (void) detachFromPrototype {
+  TestLazyMessage* prototype = prototype_;
+  prototype_ = nil;
+  self.result = [[[TestLazyMessage alloc] init] autorelease];
+  [self mergeFrom:prototype];
+  [prototype release];
+}
+- (PBGeneratedMessage*) internalGetMutableResult {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return [self internalGetResult];
+}
+- (void) freezeSubBuilders {
+  if (allTypesBuilder_ != nil) {
+    TestAllTypes* value = [allTypesBuilder_ newBuildPartial];
+    result.allTypes = value;
+    [value release];
+    [allTypesBuilder_ release];
+    allTypesBuilder_ = nil;
+  }
+  if (allExtensionsBuilder_ != nil) {
+    TestAllExtensions* value = [allExtensionsBuilder_ newBuildPartial];
+    result.allExtensions = value;
+    [value release];
+    [allExtensionsBuilder_ release];
+    allExtensionsBuilder_ = nil;
+  }
+  if (requiredBuilder_ != nil) {
+    TestRequired* value = [requiredBuilder_ newBuildPartial];
+    result.required = value;
+    [value release];
+    [requiredBuilder_ release];
+    requiredBuilder_ = nil;
+  }
+}
+- (void) dropSubBuilders {
+  [allTypesBuilder_ release];
+  allTypesBuilder_ = nil;
+  [allTypesSpareBuilder_ release];
+  allTypesSpareBuilder_ = nil;
+  [allExtensionsBuilder_ release];
+  allExtensionsBuilder_ = nil;
+  [allExtensionsSpareBuilder_ release];
+  allExtensionsSpareBuilder_ = nil;
+  [requiredBuilder_ release];
+  requiredBuilder_ = nil;
+  [requiredSpareBuilder_ release];
+  requiredSpareBuilder_ = nil;
+}
+- (void) resetSubBuilders {
+  if (allTypesBuilder_ != nil) {
+    [allTypesBuilder_ reset];
+    [allTypesSpareBuilder_ release];
+    allTypesSpareBuilder_ = allTypesBuilder_;
+    allTypesBuilder_ = nil;
+  }
+  if (allExtensionsBuilder_ != nil) {
+    [allExtensionsBuilder_ reset];
+    [allExtensionsSpareBuilder_ release];
+    allExtensionsSpareBuilder_ = allExtensionsBuilder_;
+    allExtensionsBuilder_ = nil;
+  }
+  if (requiredBuilder_ != nil) {
+    [requiredBuilder_ reset];
+    [requiredSpareBuilder_ release];
+    requiredSpareBuilder_ = requiredBuilder_;
+    requiredBuilder_ = nil;
+  }
+}
+- (PBGeneratedMessage*) internalGetResult {
+  [self freezeSubBuilders];
+  return result;
+}
+- (TestLazyMessage_Builder*) clear {
+  [self dropSubBuilders];
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = [[TestLazyMessage recycledInstance] autorelease];
+  return self;
+}
+- (TestLazyMessage_Builder*) clone {
+  if (prototype_ != nil) {
+    return [[[TestLazyMessage_Builder alloc] initWithPrototype:prototype_] autorelease];
+  }
+  [self freezeSubBuilders];
+  return [[TestLazyMessage builder] mergeFrom:result];
+}
+- (TestLazyMessage_Builder*) reset {
+  [self resetSubBuilders];
+  if (result == nil || prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    self.result = [[TestLazyMessage recycledInstance] autorelease];
+  } else {
+    [result clearForReuse];
+  }
+  return self;
+}
+- (TestLazyMessage_Builder*) recycle:(TestLazyMessage*) message {
+  if (message == [TestLazyMessage defaultInstance]) {
+    @throw [NSException exceptionWithName:@"IllegalArgument" reason:@"Cannot recycle the default instance" userInfo:nil];
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = message;
+  return [self reset];
+}
+- (TestLazyMessage*) defaultInstance {
+  return [TestLazyMessage defaultInstance];
+}
+- (TestLazyMessage*) build {
+  [self checkInitialized];
+  BOOL shared = prototype_ != nil;
+  TestLazyMessage* returnMe = [self buildPartial];
+  if (!shared) {
+    [returnMe setInitialized];
+  }
+  return returnMe;
+}
+- (TestLazyMessage*) buildPartial {
+  return [[self newBuildPartial] autorelease];
+}
+- (TestLazyMessage*) newBuildPartial {
+  if (prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    TestLazyMessage* returnMe = result;
+    result = nil;
+    return returnMe;
+  }
+  [self freezeSubBuilders];
+  TestLazyMessage* returnMe = result;
+  result = nil;
+  return returnMe;
+}
+- (TestLazyMessage_Builder*) mergeFrom:(TestLazyMessage*) other {
+  if (other == [TestLazyMessage defaultInstance]) {
+    return self;
+  }
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (other->hasBits_[0] & 0x1u) {
+    if (other->allTypesBytes_ != nil) {
+      [self mergeAllTypesData:other->allTypesBytes_ extensionRegistry:other->allTypesRegistry_];
+    } else {
+      [self mergeAllTypes:other->allTypes];
+    }
+  }
+  if (other->hasBits_[0] & 0x2u) {
+    if (other->allExtensionsBytes_ != nil) {
+      [self mergeAllExtensionsData:other->allExtensionsBytes_ extensionRegistry:other->allExtensionsRegistry_];
+    } else {
+      [self mergeAllExtensions:other->allExtensions];
+    }
+  }
+  if (other->hasBits_[0] & 0x4u) {
+    if (other->requiredBytes_ != nil) {
+      [self mergeRequiredData:other->requiredBytes_ extensionRegistry:other->requiredRegistry_];
+    } else {
+      [self mergeRequired:other->required];
+    }
+  }
+  if (other->hasBits_[0] & 0x8u) {
+    [self setInt32Value:other->int32Value];
+  }
+  [self mergeUnknownFields:other.unknownFields];
+  return self;
+}
+- (TestLazyMessage_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input {
+  return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
+}
+- (TestLazyMessage_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  PBUnknownFieldSet_Builder* unknownFields = nil;
+  while (YES) {
+    int32_t tag = [input readTag];
+    switch (tag) {
+      case 0:
+        if (unknownFields != nil) {
+          [self setUnknownFields:[unknownFields build]];
+        }
+        return self;
+      default: {
+        if (PBWireFormatGetTagWireType(tag) == PBWireFormatEndGroup) {
+          if (unknownFields != nil) {
+            [self setUnknownFields:[unknownFields build]];
+          }
+          return self;
+        }
+        if (unknownFields == nil) {
+          unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+        }
+        [self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag];
+        break;
+      }
+      case 10: {
+        NSData* data = [input newData];
+        [self mergeAllTypesData:data extensionRegistry:extensionRegistry];
+        [data release];
+        break;
+      }
+      case 18: {
+        NSData* data = [input newData];
+        [self mergeAllExtensionsData:data extensionRegistry:extensionRegistry];
+        [data release];
+        break;
+      }
+      case 26: {
+        NSData* data = [input newData];
+        [self mergeRequiredData:data extensionRegistry:extensionRegistry];
+        [data release];
+        break;
+      }
+      case 32: {
+        [self setInt32Value:[input readInt32]];
+        break;
+      }
+    }
+  }
+}
+- (BOOL) hasAllTypes {
+  return (result->hasBits_[0] & 0x1u) != 0;
+}
+- (TestAllTypes*) allTypes {
+  [self freezeSubBuilders];
+  return result.allTypes;
+}
+- (TestLazyMessage_Builder*) setAllTypes:(TestAllTypes*) value {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  [allTypesBuilder_ release];
+  allTypesBuilder_ = nil;
+  [result->allTypesBytes_ release];
+  result->allTypesBytes_ = nil;
+  [result->allTypesRegistry_ release];
+  result->allTypesRegistry_ = nil;
+  result->hasBits_[0] |= 0x1u;
+  result.allTypes = value;
+  return self;
+}
+- (TestLazyMessage_Builder*) setAllTypesBuilder:(TestAllTypes_Builder*) builderForValue {
+  return [self setAllTypes:[builderForValue build]];
+}
+- (TestLazyMessage_Builder*) mergeAllTypes:(TestAllTypes*) value {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (result->allTypesBytes_ != nil) {
+    [result allTypes];
+    [result->allTypesBytes_ release];
+    result->allTypesBytes_ = nil;
+    [result->allTypesRegistry_ release];
+    result->allTypesRegistry_ = nil;
+  }
+  if (allTypesBuilder_ == nil) {
+    if (!(result->hasBits_[0] & 0x1u) ||
+        result->allTypes == [TestAllTypes defaultInstance]) {
+      result->hasBits_[0] |= 0x1u;
+      result.allTypes = value;
+      return self;
+    }
+    allTypesBuilder_ = allTypesSpareBuilder_ != nil ? allTypesSpareBuilder_ : [[TestAllTypes_Builder alloc] init];
+    allTypesSpareBuilder_ = nil;
+    [allTypesBuilder_ mergeFrom:result->allTypes];
+  }
+  [allTypesBuilder_ mergeFrom:value];
+  return self;
+}
+- (TestLazyMessage_Builder*) clearAllTypes {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  [allTypesBuilder_ release];
+  allTypesBuilder_ = nil;
+  [result->allTypesBytes_ release];
+  result->allTypesBytes_ = nil;
+  [result->allTypesRegistry_ release];
+  result->allTypesRegistry_ = nil;
+  result->hasBits_[0] &= ~0x1u;
+  [result->allTypes release];
+  result->allTypes = nil;
+  return self;
+}
+- (TestLazyMessage_Builder*) mergeAllTypesData:(NSData*) data
+    extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (allTypesBuilder_ == nil &&
+      (!(result->hasBits_[0] & 0x1u) ||
+       (result->allTypesBytes_ != nil && result->allTypesRegistry_ == extensionRegistry))) {
+    if (result->allTypesBytes_ == nil) {
+      result->allTypesBytes_ = [data copy];
+      result->allTypesRegistry_ = [extensionRegistry retain];
+    } else {
+      NSMutableData* merged = [result->allTypesBytes_ mutableCopy];
+      [merged appendData:data];
+      [result->allTypesBytes_ release];
+      result->allTypesBytes_ = merged;
+    }
+    [result->allTypes release];
+    result->allTypes = nil;
+    result->hasBits_[0] |= 0x1u;
+    return self;
+  }
+  if (allTypesBuilder_ == nil) {
+    allTypesBuilder_ = allTypesSpareBuilder_ != nil ? allTypesSpareBuilder_ : [[TestAllTypes_Builder alloc] init];
+    allTypesSpareBuilder_ = nil;
+    [allTypesBuilder_ mergeFrom:result.allTypes];
+    [result->allTypesBytes_ release];
+    result->allTypesBytes_ = nil;
+    [result->allTypesRegistry_ release];
+    result->allTypesRegistry_ = nil;
+  }
+  [allTypesBuilder_ mergeFromData:data extensionRegistry:extensionRegistry];
+  return self;
+}
+- (BOOL) hasAllExtensions {
+  return (result->hasBits_[0] & 0x2u) != 0;
+}
+- (TestAllExtensions*) allExtensions {
+  [self freezeSubBuilders];
+  return result.allExtensions;
+}
+- (TestLazyMessage_Builder*) setAllExtensions:(TestAllExtensions*) value {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  [allExtensionsBuilder_ release];
+  allExtensionsBuilder_ = nil;
+  [result->allExtensionsBytes_ release];
+  result->allExtensionsBytes_ = nil;
+  [result->allExtensionsRegistry_ release];
+  result->allExtensionsRegistry_ = nil;
+  result->hasBits_[0] |= 0x2u;
+  result.allExtensions = value;
+  return self;
+}
+- (TestLazyMessage_Builder*) setAllExtensionsBuilder:(TestAllExtensions_Builder*) builderForValue {
+  return [self setAllExtensions:[builderForValue build]];
+}
+- (TestLazyMessage_Builder*) mergeAllExtensions:(TestAllExtensions*) value {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (result->allExtensionsBytes_ != nil) {
+    [result allExtensions];
+    [result->allExtensionsBytes_ release];
+    result->allExtensionsBytes_ = nil;
+    [result->allExtensionsRegistry_ release];
+    result->allExtensionsRegistry_ = nil;
+  }
+  if (allExtensionsBuilder_ == nil) {
+    if (!(result->hasBits_[0] & 0x2u) ||
+        result->allExtensions == [TestAllExtensions defaultInstance]) {
+      result->hasBits_[0] |= 0x2u;
+      result.allExtensions = value;
+      return self;
+    }
+    allExtensionsBuilder_ = allExtensionsSpareBuilder_ != nil ? allExtensionsSpareBuilder_ : [[TestAllExtensions_Builder alloc] init];
+    allExtensionsSpareBuilder_ = nil;
+    [allExtensionsBuilder_ mergeFrom:result->allExtensions];
+  }
+  [allExtensionsBuilder_ mergeFrom:value];
+  return self;
+}
+- (TestLazyMessage_Builder*) clearAllExtensions {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  [allExtensionsBuilder_ release];
+  allExtensionsBuilder_ = nil;
+  [result->allExtensionsBytes_ release];
+  result->allExtensionsBytes_ = nil;
+  [result->allExtensionsRegistry_ release];
+  result->allExtensionsRegistry_ = nil;
+  result->hasBits_[0] &= ~0x2u;
+  [result->allExtensions release];
+  result->allExtensions = nil;
+  return self;
+}
+- (TestLazyMessage_Builder*) mergeAllExtensionsData:(NSData*) data
+    extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (allExtensionsBuilder_ == nil &&
+      (!(result->hasBits_[0] & 0x2u) ||
+       (result->allExtensionsBytes_ != nil && result->allExtensionsRegistry_ == extensionRegistry))) {
+    if (result->allExtensionsBytes_ == nil) {
+      result->allExtensionsBytes_ = [data copy];
+      result->allExtensionsRegistry_ = [extensionRegistry retain];
+    } else {
+      NSMutableData* merged = [result->allExtensionsBytes_ mutableCopy];
+      [merged appendData:data];
+      [result->allExtensionsBytes_ release];
+      result->allExtensionsBytes_ = merged;
+    }
+    [result->allExtensions release];
+    result->allExtensions = nil;
+    result->hasBits_[0] |= 0x2u;
+    return self;
+  }
+  if (allExtensionsBuilder_ == nil) {
+    allExtensionsBuilder_ = allExtensionsSpareBuilder_ != nil ? allExtensionsSpareBuilder_ : [[TestAllExtensions_Builder alloc] init];
+    allExtensionsSpareBuilder_ = nil;
+    [allExtensionsBuilder_ mergeFrom:result.allExtensions];
+    [result->allExtensionsBytes_ release];
+    result->allExtensionsBytes_ = nil;
+    [result->allExtensionsRegistry_ release];
+    result->allExtensionsRegistry_ = nil;
+  }
+  [allExtensionsBuilder_ mergeFromData:data extensionRegistry:extensionRegistry];
+  return self;
+}
+- (BOOL) hasRequired {
+  return (result->hasBits_[0] & 0x4u) != 0;
+}
+- (TestRequired*) required {
+  [self freezeSubBuilders];
+  return result.required;
+}
+- (TestLazyMessage_Builder*) setRequired:(TestRequired*) value {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  [requiredBuilder_ release];
+  requiredBuilder_ = nil;
+  [result->requiredBytes_ release];
+  result->requiredBytes_ = nil;
+  [result->requiredRegistry_ release];
+  result->requiredRegistry_ = nil;
+  result->hasBits_[0] |= 0x4u;
+  result.required = value;
+  return self;
+}
+- (TestLazyMessage_Builder*) setRequiredBuilder:(TestRequired_Builder*) builderForValue {
+  return [self setRequired:[builderForValue build]];
+}
+- (TestLazyMessage_Builder*) mergeRequired:(TestRequired*) value {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (result->requiredBytes_ != nil) {
+    [result required];
+    [result->requiredBytes_ release];
+    result->requiredBytes_ = nil;
+    [result->requiredRegistry_ release];
+    result->requiredRegistry_ = nil;
+  }
+  if (requiredBuilder_ == nil) {
+    if (!(result->hasBits_[0] & 0x4u) ||
+        result->required == [TestRequired defaultInstance]) {
+      result->hasBits_[0] |= 0x4u;
+      result.required = value;
+      return self;
+    }
+    requiredBuilder_ = requiredSpareBuilder_ != nil ? requiredSpareBuilder_ : [[TestRequired_Builder alloc] init];
+    requiredSpareBuilder_ = nil;
+    [requiredBuilder_ mergeFrom:result->required];
+  }
+  [requiredBuilder_ mergeFrom:value];
+  return self;
+}
+- (TestLazyMessage_Builder*) clearRequired {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  [requiredBuilder_ release];
+  requiredBuilder_ = nil;
+  [result->requiredBytes_ release];
+  result->requiredBytes_ = nil;
+  [result->requiredRegistry_ release];
+  result->requiredRegistry_ = nil;
+  result->hasBits_[0] &= ~0x4u;
+  [result->required release];
+  result->required = nil;
+  return self;
+}
+- (TestLazyMessage_Builder*) mergeRequiredData:(NSData*) data
+    extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (requiredBuilder_ == nil &&
+      (!(result->hasBits_[0] & 0x4u) ||
+       (result->requiredBytes_ != nil && result->requiredRegistry_ == extensionRegistry))) {
+    if (result->requiredBytes_ == nil) {
+      result->requiredBytes_ = [data copy];
+      result->requiredRegistry_ = [extensionRegistry retain];
+    } else {
+      NSMutableData* merged = [result->requiredBytes_ mutableCopy];
+      [merged appendData:data];
+      [result->requiredBytes_ release];
+      result->requiredBytes_ = merged;
+    }
+    [result->required release];
+    result->required = nil;
+    result->hasBits_[0] |= 0x4u;
+    return self;
+  }
+  if (requiredBuilder_ == nil) {
+    requiredBuilder_ = requiredSpareBuilder_ != nil ? requiredSpareBuilder_ : [[TestRequired_Builder alloc] init];
+    requiredSpareBuilder_ = nil;
+    [requiredBuilder_ mergeFrom:result.required];
+    [result->requiredBytes_ release];
+    result->requiredBytes_ = nil;
+    [result->requiredRegistry_ release];
+    result->requiredRegistry_ = nil;
+  }
+  [requiredBuilder_ mergeFromData:data extensionRegistry:extensionRegistry];
+  return self;
+}
+- (BOOL) hasInt32Value {
+  return (result->hasBits_[0] & 0x8u) != 0;
+}
+- (int32_t) int32Value {
+  return result->int32Value;
+}
+- (TestLazyMessage_Builder*) setInt32Value:(int32_t) value {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x8u;
+  result->int32Value = value;
+  return self;
+}
+- (TestLazyMessage_Builder*) clearInt32Value {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x8u;
+  result->int32Value = 0;
+  return self;
+}
+@end
+
@@ -148,51 +148,8 @@ BOOL TestAllTypesLite_NestedEnumIsValidValue(TestAllTypesLite_NestedEnum value);
 @end
 
 @interface TestAllTypesLite : PBGeneratedMessage {
-@private
-  BOOL hasOptionalBool_:1;
-  BOOL hasDefaultBool_:1;
-  BOOL hasOptionalDouble_:1;
-  BOOL hasDefaultDouble_:1;
-  BOOL hasDefaultFloat_:1;
-  BOOL hasOptionalFloat_:1;
-  BOOL hasOptionalInt64_:1;
-  BOOL hasDefaultInt64_:1;
-  BOOL hasOptionalUint64_:1;
-  BOOL hasDefaultUint64_:1;
-  BOOL hasDefaultInt32_:1;
-  BOOL hasOptionalInt32_:1;
-  BOOL hasOptionalFixed64_:1;
-  BOOL hasDefaultFixed64_:1;
-  BOOL hasOptionalFixed32_:1;
-  BOOL hasDefaultFixed32_:1;
-  BOOL hasDefaultString_:1;
-  BOOL hasDefaultStringPiece_:1;
-  BOOL hasDefaultCord_:1;
-  BOOL hasOptionalCord_:1;
-  BOOL hasOptionalStringPiece_:1;
-  BOOL hasOptionalString_:1;
-  BOOL hasOptionalGroup_:1;
-  BOOL hasOptionalNestedMessage_:1;
-  BOOL hasOptionalForeignMessage_:1;
-  BOOL hasOptionalImportMessage_:1;
-  BOOL hasDefaultBytes_:1;
-  BOOL hasOptionalBytes_:1;
-  BOOL hasOptionalUint32_:1;
-  BOOL hasDefaultUint32_:1;
-  BOOL hasDefaultImportEnum_:1;
-  BOOL hasDefaultForeignEnum_:1;
-  BOOL hasDefaultNestedEnum_:1;
-  BOOL hasOptionalImportEnum_:1;
-  BOOL hasOptionalForeignEnum_:1;
-  BOOL hasOptionalNestedEnum_:1;
-  BOOL hasDefaultSfixed32_:1;
-  BOOL hasOptionalSfixed32_:1;
-  BOOL hasDefaultSfixed64_:1;
-  BOOL hasOptionalSfixed64_:1;
-  BOOL hasDefaultSint32_:1;
-  BOOL hasOptionalSint32_:1;
-  BOOL hasOptionalSint64_:1;
-  BOOL hasDefaultSint64_:1;
+@package
+  uint32_t hasBits_[2];
   BOOL optionalBool_:1;
   BOOL defaultBool_:1;
   Float64 optionalDouble;
@@ -203,8 +160,8 @@ BOOL TestAllTypesLite_NestedEnumIsValidValue(TestAllTypesLite_NestedEnum value);
   int64_t defaultInt64;
   uint64_t optionalUint64;
   uint64_t defaultUint64;
-  int32_t defaultInt32;
   int32_t optionalInt32;
+  int32_t defaultInt32;
   uint64_t optionalFixed64;
   uint64_t defaultFixed64;
   uint32_t optionalFixed32;
@@ -223,44 +180,44 @@ BOOL TestAllTypesLite_NestedEnumIsValidValue(TestAllTypesLite_NestedEnum value);
   NSData* optionalBytes;
   uint32_t optionalUint32;
   uint32_t defaultUint32;
+  ForeignEnumLite optionalForeignEnum;
   ImportEnumLite defaultImportEnum;
   ForeignEnumLite defaultForeignEnum;
   TestAllTypesLite_NestedEnum defaultNestedEnum;
   ImportEnumLite optionalImportEnum;
-  ForeignEnumLite optionalForeignEnum;
   TestAllTypesLite_NestedEnum optionalNestedEnum;
-  int32_t defaultSfixed32;
   int32_t optionalSfixed32;
-  int64_t defaultSfixed64;
+  int32_t defaultSfixed32;
   int64_t optionalSfixed64;
-  int32_t defaultSint32;
+  int64_t defaultSfixed64;
   int32_t optionalSint32;
+  int32_t defaultSint32;
   int64_t optionalSint64;
   int64_t defaultSint64;
-  PBAppendableArray * repeatedBoolArray;
-  PBAppendableArray * repeatedDoubleArray;
-  PBAppendableArray * repeatedFloatArray;
-  PBAppendableArray * repeatedInt64Array;
-  PBAppendableArray * repeatedUint64Array;
-  PBAppendableArray * repeatedInt32Array;
-  PBAppendableArray * repeatedFixed64Array;
-  PBAppendableArray * repeatedFixed32Array;
-  PBAppendableArray * repeatedStringArray;
-  PBAppendableArray * repeatedCordArray;
-  PBAppendableArray * repeatedStringPieceArray;
-  PBAppendableArray * repeatedGroupArray;
-  PBAppendableArray * repeatedImportMessageArray;
-  PBAppendableArray * repeatedForeignMessageArray;
-  PBAppendableArray * repeatedNestedMessageArray;
-  PBAppendableArray * repeatedBytesArray;
-  PBAppendableArray * repeatedUint32Array;
-  PBAppendableArray * repeatedImportEnumArray;
-  PBAppendableArray * repeatedForeignEnumArray;
-  PBAppendableArray * repeatedNestedEnumArray;
-  PBAppendableArray * repeatedSfixed32Array;
-  PBAppendableArray * repeatedSfixed64Array;
-  PBAppendableArray * repeatedSint32Array;
-  PBAppendableArray * repeatedSint64Array;
+  PBBoolArray * repeatedBoolArray;
+  PBDoubleArray * repeatedDoubleArray;
+  PBFloatArray * repeatedFloatArray;
+  PBInt64Array * repeatedInt64Array;
+  PBUInt64Array * repeatedUint64Array;
+  PBInt32Array * repeatedInt32Array;
+  PBUInt64Array * repeatedFixed64Array;
+  PBUInt32Array * repeatedFixed32Array;
+  PBObjectArray * repeatedCordArray;
+  PBObjectArray * repeatedStringArray;
+  PBObjectArray * repeatedStringPieceArray;
+  PBObjectArray * repeatedGroupArray;
+  PBObjectArray * repeatedImportMessageArray;
+  PBObjectArray * repeatedForeignMessageArray;
+  PBObjectArray * repeatedNestedMessageArray;
+  PBObjectArray * repeatedBytesArray;
+  PBUInt32Array * repeatedUint32Array;
+  PBInt32Array * repeatedNestedEnumArray;
+  PBInt32Array * repeatedForeignEnumArray;
+  PBInt32Array * repeatedImportEnumArray;
+  PBInt32Array * repeatedSfixed32Array;
+  PBInt64Array * repeatedSfixed64Array;
+  PBInt32Array * repeatedSint32Array;
+  PBInt64Array * repeatedSint64Array;
 }
 - (BOOL) hasOptionalInt32;
 - (BOOL) hasOptionalInt64;
@@ -306,74 +263,74 @@ BOOL TestAllTypesLite_NestedEnumIsValidValue(TestAllTypesLite_NestedEnum value);
 - (BOOL) hasDefaultImportEnum;
 - (BOOL) hasDefaultStringPiece;
 - (BOOL) hasDefaultCord;
-@property (readonly) int32_t optionalInt32;
-@property (readonly) int64_t optionalInt64;
-@property (readonly) uint32_t optionalUint32;
-@property (readonly) uint64_t optionalUint64;
-@property (readonly) int32_t optionalSint32;
-@property (readonly) int64_t optionalSint64;
-@property (readonly) uint32_t optionalFixed32;
-@property (readonly) uint64_t optionalFixed64;
-@property (readonly) int32_t optionalSfixed32;
-@property (readonly) int64_t optionalSfixed64;
-@property (readonly) Float32 optionalFloat;
-@property (readonly) Float64 optionalDouble;
+@property (nonatomic, readonly) int32_t optionalInt32;
+@property (nonatomic, readonly) int64_t optionalInt64;
+@property (nonatomic, readonly) uint32_t optionalUint32;
+@property (nonatomic, readonly) uint64_t optionalUint64;
+@property (nonatomic, readonly) int32_t optionalSint32;
+@property (nonatomic, readonly) int64_t optionalSint64;
+@property (nonatomic, readonly) uint32_t optionalFixed32;
+@property (nonatomic, readonly) uint64_t optionalFixed64;
+@property (nonatomic, readonly) int32_t optionalSfixed32;
+@property (nonatomic, readonly) int64_t optionalSfixed64;
+@property (nonatomic, readonly) Float32 optionalFloat;
+@property (nonatomic, readonly) Float64 optionalDouble;
 - (BOOL) optionalBool;
-@property (readonly, retain) NSString* optionalString;
-@property (readonly, retain) NSData* optionalBytes;
-@property (readonly, retain) TestAllTypesLite_OptionalGroup* optionalGroup;
-@property (readonly, retain) TestAllTypesLite_NestedMessage* optionalNestedMessage;
-@property (readonly, retain) ForeignMessageLite* optionalForeignMessage;
-@property (readonly, retain) ImportMessageLite* optionalImportMessage;
-@property (readonly) TestAllTypesLite_NestedEnum optionalNestedEnum;
-@property (readonly) ForeignEnumLite optionalForeignEnum;
-@property (readonly) ImportEnumLite optionalImportEnum;
-@property (readonly, retain) NSString* optionalStringPiece;
-@property (readonly, retain) NSString* optionalCord;
-@property (readonly, retain) PBArray * repeatedInt32;
-@property (readonly, retain) PBArray * repeatedInt64;
-@property (readonly, retain) PBArray * repeatedUint32;
-@property (readonly, retain) PBArray * repeatedUint64;
-@property (readonly, retain) PBArray * repeatedSint32;
-@property (readonly, retain) PBArray * repeatedSint64;
-@property (readonly, retain) PBArray * repeatedFixed32;
-@property (readonly, retain) PBArray * repeatedFixed64;
-@property (readonly, retain) PBArray * repeatedSfixed32;
-@property (readonly, retain) PBArray * repeatedSfixed64;
-@property (readonly, retain) PBArray * repeatedFloat;
-@property (readonly, retain) PBArray * repeatedDouble;
-@property (readonly, retain) PBArray * repeatedBool;
-@property (readonly, retain) PBArray * repeatedString;
-@property (readonly, retain) PBArray * repeatedBytes;
-@property (readonly, retain) PBArray * repeatedGroup;
-@property (readonly, retain) PBArray * repeatedNestedMessage;
-@property (readonly, retain) PBArray * repeatedForeignMessage;
-@property (readonly, retain) PBArray * repeatedImportMessage;
-@property (readonly, retain) PBArray * repeatedNestedEnum;
-@property (readonly, retain) PBArray * repeatedForeignEnum;
-@property (readonly, retain) PBArray * repeatedImportEnum;
-@property (readonly, retain) PBArray * repeatedStringPiece;
-@property (readonly, retain) PBArray * repeatedCord;
-@property (readonly) int32_t defaultInt32;
-@property (readonly) int64_t defaultInt64;
-@property (readonly) uint32_t defaultUint32;
-@property (readonly) uint64_t defaultUint64;
-@property (readonly) int32_t defaultSint32;
-@property (readonly) int64_t defaultSint64;
-@property (readonly) uint32_t defaultFixed32;
-@property (readonly) uint64_t defaultFixed64;
-@property (readonly) int32_t defaultSfixed32;
-@property (readonly) int64_t defaultSfixed64;
-@property (readonly) Float32 defaultFloat;
-@property (readonly) Float64 defaultDouble;
+@property (nonatomic, readonly, retain) NSString* optionalString;
+@property (nonatomic, readonly, retain) NSData* optionalBytes;
+@property (nonatomic, readonly, retain) TestAllTypesLite_OptionalGroup* optionalGroup;
+@property (nonatomic, readonly, retain) TestAllTypesLite_NestedMessage* optionalNestedMessage;
+@property (nonatomic, readonly, retain) ForeignMessageLite* optionalForeignMessage;
+@property (nonatomic, readonly, retain) ImportMessageLite* optionalImportMessage;
+@property (nonatomic, readonly) TestAllTypesLite_NestedEnum optionalNestedEnum;
+@property (nonatomic, readonly) ForeignEnumLite optionalForeignEnum;
+@property (nonatomic, readonly) ImportEnumLite optionalImportEnum;
+@property (nonatomic, readonly, retain) NSString* optionalStringPiece;
+@property (nonatomic, readonly, retain) NSString* optionalCord;
+@property (nonatomic, readonly, retain) PBArray * repeatedInt32;
+@property (nonatomic, readonly, retain) PBArray * repeatedInt64;
+@property (nonatomic, readonly, retain) PBArray * repeatedUint32;
+@property (nonatomic, readonly, retain) PBArray * repeatedUint64;
+@property (nonatomic, readonly, retain) PBArray * repeatedSint32;
+@property (nonatomic, readonly, retain) PBArray * repeatedSint64;
+@property (nonatomic, readonly, retain) PBArray * repeatedFixed32;
+@property (nonatomic, readonly, retain) PBArray * repeatedFixed64;
+@property (nonatomic, readonly, retain) PBArray * repeatedSfixed32;
+@property (nonatomic, readonly, retain) PBArray * repeatedSfixed64;
+@property (nonatomic, readonly, retain) PBArray * repeatedFloat;
+@property (nonatomic, readonly, retain) PBArray * repeatedDouble;
+@property (nonatomic, readonly, retain) PBArray * repeatedBool;
+@property (nonatomic, readonly, retain) PBArray * repeatedString;
+@property (nonatomic, readonly, retain) PBArray * repeatedBytes;
+@property (nonatomic, readonly, retain) PBArray * repeatedGroup;
+@property (nonatomic, readonly, retain) PBArray * repeatedNestedMessage;
+@property (nonatomic, readonly, retain) PBArray * repeatedForeignMessage;
+@property (nonatomic, readonly, retain) PBArray * repeatedImportMessage;
+@property (nonatomic, readonly, retain) PBArray * repeatedNestedEnum;
+@property (nonatomic, readonly, retain) PBArray * repeatedForeignEnum;
+@property (nonatomic, readonly, retain) PBArray * repeatedImportEnum;
+@property (nonatomic, readonly, retain) PBArray * repeatedStringPiece;
+@property (nonatomic, readonly, retain) PBArray * repeatedCord;
+@property (nonatomic, readonly) int32_t defaultInt32;
+@property (nonatomic, readonly) int64_t defaultInt64;
+@property (nonatomic, readonly) uint32_t defaultUint32;
+@property (nonatomic, readonly) uint64_t defaultUint64;
+@property (nonatomic, readonly) int32_t defaultSint32;
+@property (nonatomic, readonly) int64_t defaultSint64;
+@property (nonatomic, readonly) uint32_t defaultFixed32;
+@property (nonatomic, readonly) uint64_t defaultFixed64;
+@property (nonatomic, readonly) int32_t defaultSfixed32;
+@property (nonatomic, readonly) int64_t defaultSfixed64;
+@property (nonatomic, readonly) Float32 defaultFloat;
+@property (nonatomic, readonly) Float64 defaultDouble;
 - (BOOL) defaultBool;
-@property (readonly, retain) NSString* defaultString;
-@property (readonly, retain) NSData* defaultBytes;
-@property (readonly) TestAllTypesLite_NestedEnum defaultNestedEnum;
-@property (readonly) ForeignEnumLite defaultForeignEnum;
-@property (readonly) ImportEnumLite defaultImportEnum;
-@property (readonly, retain) NSString* defaultStringPiece;
-@property (readonly, retain) NSString* defaultCord;
+@property (nonatomic, readonly, retain) NSString* defaultString;
+@property (nonatomic, readonly, retain) NSData* defaultBytes;
+@property (nonatomic, readonly) TestAllTypesLite_NestedEnum defaultNestedEnum;
+@property (nonatomic, readonly) ForeignEnumLite defaultForeignEnum;
+@property (nonatomic, readonly) ImportEnumLite defaultImportEnum;
+@property (nonatomic, readonly, retain) NSString* defaultStringPiece;
+@property (nonatomic, readonly, retain) NSString* defaultCord;
 - (int32_t)repeatedInt32AtIndex:(NSUInteger)index;
 - (int64_t)repeatedInt64AtIndex:(NSUInteger)index;
 - (uint32_t)repeatedUint32AtIndex:(NSUInteger)index;
@@ -418,12 +375,12 @@ BOOL TestAllTypesLite_NestedEnumIsValidValue(TestAllTypesLite_NestedEnum value);
 @end
 
 @interface TestAllTypesLite_NestedMessage : PBGeneratedMessage {
-@private
-  BOOL hasBb_:1;
+@package
+  uint32_t hasBits_[1];
   int32_t bb;
 }
 - (BOOL) hasBb;
-@property (readonly) int32_t bb;
+@property (nonatomic, readonly) int32_t bb;
 
 + (TestAllTypesLite_NestedMessage*) defaultInstance;
 - (TestAllTypesLite_NestedMessage*) defaultInstance;
@@ -446,15 +403,24 @@ BOOL TestAllTypesLite_NestedEnumIsValidValue(TestAllTypesLite_NestedEnum value);
 @interface TestAllTypesLite_NestedMessage_Builder : PBGeneratedMessage_Builder {
 @private
   TestAllTypesLite_NestedMessage* result;
+  TestAllTypesLite_NestedMessage* prototype_;
 }
 
 - (TestAllTypesLite_NestedMessage*) defaultInstance;
 
 - (TestAllTypesLite_NestedMessage_Builder*) clear;
 - (TestAllTypesLite_NestedMessage_Builder*) clone;
+- (TestAllTypesLite_NestedMessage_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (TestAllTypesLite_NestedMessage_Builder*) recycle:(TestAllTypesLite_NestedMessage*) message;
 
 - (TestAllTypesLite_NestedMessage*) build;
 - (TestAllTypesLite_NestedMessage*) buildPartial;
+- (TestAllTypesLite_NestedMessage*) newBuildPartial;
 
 - (TestAllTypesLite_NestedMessage_Builder*) mergeFrom:(TestAllTypesLite_NestedMessage*) other;
 - (TestAllTypesLite_NestedMessage_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -467,12 +433,12 @@ BOOL TestAllTypesLite_NestedEnumIsValidValue(TestAllTypesLite_NestedEnum value);
 @end
 
 @interface TestAllTypesLite_OptionalGroup : PBGeneratedMessage {
-@private
-  BOOL hasA_:1;
+@package
+  uint32_t hasBits_[1];
   int32_t a;
 }
 - (BOOL) hasA;
-@property (readonly) int32_t a;
+@property (nonatomic, readonly) int32_t a;
 
 + (TestAllTypesLite_OptionalGroup*) defaultInstance;
 - (TestAllTypesLite_OptionalGroup*) defaultInstance;
@@ -495,15 +461,24 @@ BOOL TestAllTypesLite_NestedEnumIsValidValue(TestAllTypesLite_NestedEnum value);
 @interface TestAllTypesLite_OptionalGroup_Builder : PBGeneratedMessage_Builder {
 @private
   TestAllTypesLite_OptionalGroup* result;
+  TestAllTypesLite_OptionalGroup* prototype_;
 }
 
 - (TestAllTypesLite_OptionalGroup*) defaultInstance;
 
 - (TestAllTypesLite_OptionalGroup_Builder*) clear;
 - (TestAllTypesLite_OptionalGroup_Builder*) clone;
+- (TestAllTypesLite_OptionalGroup_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (TestAllTypesLite_OptionalGroup_Builder*) recycle:(TestAllTypesLite_OptionalGroup*) message;
 
 - (TestAllTypesLite_OptionalGroup*) build;
 - (TestAllTypesLite_OptionalGroup*) buildPartial;
+- (TestAllTypesLite_OptionalGroup*) newBuildPartial;
 
 - (TestAllTypesLite_OptionalGroup_Builder*) mergeFrom:(TestAllTypesLite_OptionalGroup*) other;
 - (TestAllTypesLite_OptionalGroup_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -516,12 +491,12 @@ BOOL TestAllTypesLite_NestedEnumIsValidValue(TestAllTypesLite_NestedEnum value);
 @end
 
 @interface TestAllTypesLite_RepeatedGroup : PBGeneratedMessage {
-@private
-  BOOL hasA_:1;
+@package
+  uint32_t hasBits_[1];
   int32_t a;
 }
 - (BOOL) hasA;
-@property (readonly) int32_t a;
+@property (nonatomic, readonly) int32_t a;
 
 + (TestAllTypesLite_RepeatedGroup*) defaultInstance;
 - (TestAllTypesLite_RepeatedGroup*) defaultInstance;
@@ -544,15 +519,24 @@ BOOL TestAllTypesLite_NestedEnumIsValidValue(TestAllTypesLite_NestedEnum value);
 @interface TestAllTypesLite_RepeatedGroup_Builder : PBGeneratedMessage_Builder {
 @private
   TestAllTypesLite_RepeatedGroup* result;
+  TestAllTypesLite_RepeatedGroup* prototype_;
 }
 
 - (TestAllTypesLite_RepeatedGroup*) defaultInstance;
 
 - (TestAllTypesLite_RepeatedGroup_Builder*) clear;
 - (TestAllTypesLite_RepeatedGroup_Builder*) clone;
+- (TestAllTypesLite_RepeatedGroup_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (TestAllTypesLite_RepeatedGroup_Builder*) recycle:(TestAllTypesLite_RepeatedGroup*) message;
 
 - (TestAllTypesLite_RepeatedGroup*) build;
 - (TestAllTypesLite_RepeatedGroup*) buildPartial;
+- (TestAllTypesLite_RepeatedGroup*) newBuildPartial;
 
 - (TestAllTypesLite_RepeatedGroup_Builder*) mergeFrom:(TestAllTypesLite_RepeatedGroup*) other;
 - (TestAllTypesLite_RepeatedGroup_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -567,15 +551,32 @@ BOOL TestAllTypesLite_NestedEnumIsValidValue(TestAllTypesLite_NestedEnum value);
 @interface TestAllTypesLite_Builder : PBGeneratedMessage_Builder {
 @private
   TestAllTypesLite* result;
+  TestAllTypesLite* prototype_;
+  TestAllTypesLite_OptionalGroup_Builder* optionalGroupBuilder_;
+  TestAllTypesLite_OptionalGroup_Builder* optionalGroupSpareBuilder_;
+  TestAllTypesLite_NestedMessage_Builder* optionalNestedMessageBuilder_;
+  TestAllTypesLite_NestedMessage_Builder* optionalNestedMessageSpareBuilder_;
+  ForeignMessageLite_Builder* optionalForeignMessageBuilder_;
+  ForeignMessageLite_Builder* optionalForeignMessageSpareBuilder_;
+  ImportMessageLite_Builder* optionalImportMessageBuilder_;
+  ImportMessageLite_Builder* optionalImportMessageSpareBuilder_;
 }
 
 - (TestAllTypesLite*) defaultInstance;
 
 - (TestAllTypesLite_Builder*) clear;
 - (TestAllTypesLite_Builder*) clone;
+- (TestAllTypesLite_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (TestAllTypesLite_Builder*) recycle:(TestAllTypesLite*) message;
 
 - (TestAllTypesLite*) build;
 - (TestAllTypesLite*) buildPartial;
+- (TestAllTypesLite*) newBuildPartial;
 
 - (TestAllTypesLite_Builder*) mergeFrom:(TestAllTypesLite*) other;
 - (TestAllTypesLite_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -713,6 +714,7 @@ BOOL TestAllTypesLite_NestedEnumIsValidValue(TestAllTypesLite_NestedEnum value);
 - (int32_t)repeatedInt32AtIndex:(NSUInteger)index;
 - (TestAllTypesLite_Builder *)addRepeatedInt32:(int32_t)value;
 - (TestAllTypesLite_Builder *)setRepeatedInt32Array:(NSArray *)array;
+- (TestAllTypesLite_Builder *)setRepeatedInt32:(PBArray *)array;
 - (TestAllTypesLite_Builder *)setRepeatedInt32Values:(const int32_t *)values count:(NSUInteger)count;
 - (TestAllTypesLite_Builder *)clearRepeatedInt32;
 
@@ -720,6 +722,7 @@ BOOL TestAllTypesLite_NestedEnumIsValidValue(TestAllTypesLite_NestedEnum value);
 - (int64_t)repeatedInt64AtIndex:(NSUInteger)index;
 - (TestAllTypesLite_Builder *)addRepeatedInt64:(int64_t)value;
 - (TestAllTypesLite_Builder *)setRepeatedInt64Array:(NSArray *)array;
+- (TestAllTypesLite_Builder *)setRepeatedInt64:(PBArray *)array;
 - (TestAllTypesLite_Builder *)setRepeatedInt64Values:(const int64_t *)values count:(NSUInteger)count;
 - (TestAllTypesLite_Builder *)clearRepeatedInt64;
 
@@ -727,6 +730,7 @@ BOOL TestAllTypesLite_NestedEnumIsValidValue(TestAllTypesLite_NestedEnum value);
 - (uint32_t)repeatedUint32AtIndex:(NSUInteger)index;
 - (TestAllTypesLite_Builder *)addRepeatedUint32:(uint32_t)value;
 - (TestAllTypesLite_Builder *)setRepeatedUint32Array:(NSArray *)array;
+- (TestAllTypesLite_Builder *)setRepeatedUint32:(PBArray *)array;
 - (TestAllTypesLite_Builder *)setRepeatedUint32Values:(const uint32_t *)values count:(NSUInteger)count;
 - (TestAllTypesLite_Builder *)clearRepeatedUint32;
 
@@ -734,6 +738,7 @@ BOOL TestAllTypesLite_NestedEnumIsValidValue(TestAllTypesLite_NestedEnum value);
 - (uint64_t)repeatedUint64AtIndex:(NSUInteger)index;
 - (TestAllTypesLite_Builder *)addRepeatedUint64:(uint64_t)value;
 - (TestAllTypesLite_Builder *)setRepeatedUint64Array:(NSArray *)array;
+- (TestAllTypesLite_Builder *)setRepeatedUint64:(PBArray *)array;
 - (TestAllTypesLite_Builder *)setRepeatedUint64Values:(const uint64_t *)values count:(NSUInteger)count;
 - (TestAllTypesLite_Builder *)clearRepeatedUint64;
 
@@ -741,6 +746,7 @@ BOOL TestAllTypesLite_NestedEnumIsValidValue(TestAllTypesLite_NestedEnum value);
 - (int32_t)repeatedSint32AtIndex:(NSUInteger)index;
 - (TestAllTypesLite_Builder *)addRepeatedSint32:(int32_t)value;
 - (TestAllTypesLite_Builder *)setRepeatedSint32Array:(NSArray *)array;
+- (TestAllTypesLite_Builder *)setRepeatedSint32:(PBArray *)array;
 - (TestAllTypesLite_Builder *)setRepeatedSint32Values:(const int32_t *)values count:(NSUInteger)count;
 - (TestAllTypesLite_Builder *)clearRepeatedSint32;
 
@@ -748,6 +754,7 @@ BOOL TestAllTypesLite_NestedEnumIsValidValue(TestAllTypesLite_NestedEnum value);
 - (int64_t)repeatedSint64AtIndex:(NSUInteger)index;
 - (TestAllTypesLite_Builder *)addRepeatedSint64:(int64_t)value;
 - (TestAllTypesLite_Builder *)setRepeatedSint64Array:(NSArray *)array;
+- (TestAllTypesLite_Builder *)setRepeatedSint64:(PBArray *)array;
 - (TestAllTypesLite_Builder *)setRepeatedSint64Values:(const int64_t *)values count:(NSUInteger)count;
 - (TestAllTypesLite_Builder *)clearRepeatedSint64;
 
@@ -755,6 +762,7 @@ BOOL TestAllTypesLite_NestedEnumIsValidValue(TestAllTypesLite_NestedEnum value);
 - (uint32_t)repeatedFixed32AtIndex:(NSUInteger)index;
 - (TestAllTypesLite_Builder *)addRepeatedFixed32:(uint32_t)value;
 - (TestAllTypesLite_Builder *)setRepeatedFixed32Array:(NSArray *)array;
+- (TestAllTypesLite_Builder *)setRepeatedFixed32:(PBArray *)array;
 - (TestAllTypesLite_Builder *)setRepeatedFixed32Values:(const uint32_t *)values count:(NSUInteger)count;
 - (TestAllTypesLite_Builder *)clearRepeatedFixed32;
 
@@ -762,6 +770,7 @@ BOOL TestAllTypesLite_NestedEnumIsValidValue(TestAllTypesLite_NestedEnum value);
 - (uint64_t)repeatedFixed64AtIndex:(NSUInteger)index;
 - (TestAllTypesLite_Builder *)addRepeatedFixed64:(uint64_t)value;
 - (TestAllTypesLite_Builder *)setRepeatedFixed64Array:(NSArray *)array;
+- (TestAllTypesLite_Builder *)setRepeatedFixed64:(PBArray *)array;
 - (TestAllTypesLite_Builder *)setRepeatedFixed64Values:(const uint64_t *)values count:(NSUInteger)count;
 - (TestAllTypesLite_Builder *)clearRepeatedFixed64;
 
@@ -769,6 +778,7 @@ BOOL TestAllTypesLite_NestedEnumIsValidValue(TestAllTypesLite_NestedEnum value);
 - (int32_t)repeatedSfixed32AtIndex:(NSUInteger)index;
 - (TestAllTypesLite_Builder *)addRepeatedSfixed32:(int32_t)value;
 - (TestAllTypesLite_Builder *)setRepeatedSfixed32Array:(NSArray *)array;
+- (TestAllTypesLite_Builder *)setRepeatedSfixed32:(PBArray *)array;
 - (TestAllTypesLite_Builder *)setRepeatedSfixed32Values:(const int32_t *)values count:(NSUInteger)count;
 - (TestAllTypesLite_Builder *)clearRepeatedSfixed32;
 
@@ -776,6 +786,7 @@ BOOL TestAllTypesLite_NestedEnumIsValidValue(TestAllTypesLite_NestedEnum value);
 - (int64_t)repeatedSfixed64AtIndex:(NSUInteger)index;
 - (TestAllTypesLite_Builder *)addRepeatedSfixed64:(int64_t)value;
 - (TestAllTypesLite_Builder *)setRepeatedSfixed64Array:(NSArray *)array;
+- (TestAllTypesLite_Builder *)setRepeatedSfixed64:(PBArray *)array;
 - (TestAllTypesLite_Builder *)setRepeatedSfixed64Values:(const int64_t *)values count:(NSUInteger)count;
 - (TestAllTypesLite_Builder *)clearRepeatedSfixed64;
 
@@ -783,6 +794,7 @@ BOOL TestAllTypesLite_NestedEnumIsValidValue(TestAllTypesLite_NestedEnum value);
 - (Float32)repeatedFloatAtIndex:(NSUInteger)index;
 - (TestAllTypesLite_Builder *)addRepeatedFloat:(Float32)value;
 - (TestAllTypesLite_Builder *)setRepeatedFloatArray:(NSArray *)array;
+- (TestAllTypesLite_Builder *)setRepeatedFloat:(PBArray *)array;
 - (TestAllTypesLite_Builder *)setRepeatedFloatValues:(const Float32 *)values count:(NSUInteger)count;
 - (TestAllTypesLite_Builder *)clearRepeatedFloat;
 
@@ -790,6 +802,7 @@ BOOL TestAllTypesLite_NestedEnumIsValidValue(TestAllTypesLite_NestedEnum value);
 - (Float64)repeatedDoubleAtIndex:(NSUInteger)index;
 - (TestAllTypesLite_Builder *)addRepeatedDouble:(Float64)value;
 - (TestAllTypesLite_Builder *)setRepeatedDoubleArray:(NSArray *)array;
+- (TestAllTypesLite_Builder *)setRepeatedDouble:(PBArray *)array;
 - (TestAllTypesLite_Builder *)setRepeatedDoubleValues:(const Float64 *)values count:(NSUInteger)count;
 - (TestAllTypesLite_Builder *)clearRepeatedDouble;
 
@@ -797,6 +810,7 @@ BOOL TestAllTypesLite_NestedEnumIsValidValue(TestAllTypesLite_NestedEnum value);
 - (BOOL)repeatedBoolAtIndex:(NSUInteger)index;
 - (TestAllTypesLite_Builder *)addRepeatedBool:(BOOL)value;
 - (TestAllTypesLite_Builder *)setRepeatedBoolArray:(NSArray *)array;
+- (TestAllTypesLite_Builder *)setRepeatedBool:(PBArray *)array;
 - (TestAllTypesLite_Builder *)setRepeatedBoolValues:(const BOOL *)values count:(NSUInteger)count;
 - (TestAllTypesLite_Builder *)clearRepeatedBool;
 
@@ -804,6 +818,7 @@ BOOL TestAllTypesLite_NestedEnumIsValidValue(TestAllTypesLite_NestedEnum value);
 - (NSString*)repeatedStringAtIndex:(NSUInteger)index;
 - (TestAllTypesLite_Builder *)addRepeatedString:(NSString*)value;
 - (TestAllTypesLite_Builder *)setRepeatedStringArray:(NSArray *)array;
+- (TestAllTypesLite_Builder *)setRepeatedString:(PBArray *)array;
 - (TestAllTypesLite_Builder *)setRepeatedStringValues:(const NSString* *)values count:(NSUInteger)count;
 - (TestAllTypesLite_Builder *)clearRepeatedString;
 
@@ -811,6 +826,7 @@ BOOL TestAllTypesLite_NestedEnumIsValidValue(TestAllTypesLite_NestedEnum value);
 - (NSData*)repeatedBytesAtIndex:(NSUInteger)index;
 - (TestAllTypesLite_Builder *)addRepeatedBytes:(NSData*)value;
 - (TestAllTypesLite_Builder *)setRepeatedBytesArray:(NSArray *)array;
+- (TestAllTypesLite_Builder *)setRepeatedBytes:(PBArray *)array;
 - (TestAllTypesLite_Builder *)setRepeatedBytesValues:(const NSData* *)values count:(NSUInteger)count;
 - (TestAllTypesLite_Builder *)clearRepeatedBytes;
 
@@ -846,6 +862,7 @@ BOOL TestAllTypesLite_NestedEnumIsValidValue(TestAllTypesLite_NestedEnum value);
 - (TestAllTypesLite_NestedEnum)repeatedNestedEnumAtIndex:(NSUInteger)index;
 - (TestAllTypesLite_Builder *)addRepeatedNestedEnum:(TestAllTypesLite_NestedEnum)value;
 - (TestAllTypesLite_Builder *)setRepeatedNestedEnumArray:(NSArray *)array;
+- (TestAllTypesLite_Builder *)setRepeatedNestedEnum:(PBArray *)array;
 - (TestAllTypesLite_Builder *)setRepeatedNestedEnumValues:(const TestAllTypesLite_NestedEnum *)values count:(NSUInteger)count;
 - (TestAllTypesLite_Builder *)clearRepeatedNestedEnum;
 
@@ -853,6 +870,7 @@ BOOL TestAllTypesLite_NestedEnumIsValidValue(TestAllTypesLite_NestedEnum value);
 - (ForeignEnumLite)repeatedForeignEnumAtIndex:(NSUInteger)index;
 - (TestAllTypesLite_Builder *)addRepeatedForeignEnum:(ForeignEnumLite)value;
 - (TestAllTypesLite_Builder *)setRepeatedForeignEnumArray:(NSArray *)array;
+- (TestAllTypesLite_Builder *)setRepeatedForeignEnum:(PBArray *)array;
 - (TestAllTypesLite_Builder *)setRepeatedForeignEnumValues:(const ForeignEnumLite *)values count:(NSUInteger)count;
 - (TestAllTypesLite_Builder *)clearRepeatedForeignEnum;
 
@@ -860,6 +878,7 @@ BOOL TestAllTypesLite_NestedEnumIsValidValue(TestAllTypesLite_NestedEnum value);
 - (ImportEnumLite)repeatedImportEnumAtIndex:(NSUInteger)index;
 - (TestAllTypesLite_Builder *)addRepeatedImportEnum:(ImportEnumLite)value;
 - (TestAllTypesLite_Builder *)setRepeatedImportEnumArray:(NSArray *)array;
+- (TestAllTypesLite_Builder *)setRepeatedImportEnum:(PBArray *)array;
 - (TestAllTypesLite_Builder *)setRepeatedImportEnumValues:(const ImportEnumLite *)values count:(NSUInteger)count;
 - (TestAllTypesLite_Builder *)clearRepeatedImportEnum;
 
@@ -867,6 +886,7 @@ BOOL TestAllTypesLite_NestedEnumIsValidValue(TestAllTypesLite_NestedEnum value);
 - (NSString*)repeatedStringPieceAtIndex:(NSUInteger)index;
 - (TestAllTypesLite_Builder *)addRepeatedStringPiece:(NSString*)value;
 - (TestAllTypesLite_Builder *)setRepeatedStringPieceArray:(NSArray *)array;
+- (TestAllTypesLite_Builder *)setRepeatedStringPiece:(PBArray *)array;
 - (TestAllTypesLite_Builder *)setRepeatedStringPieceValues:(const NSString* *)values count:(NSUInteger)count;
 - (TestAllTypesLite_Builder *)clearRepeatedStringPiece;
 
@@ -874,6 +894,7 @@ BOOL TestAllTypesLite_NestedEnumIsValidValue(TestAllTypesLite_NestedEnum value);
 - (NSString*)repeatedCordAtIndex:(NSUInteger)index;
 - (TestAllTypesLite_Builder *)addRepeatedCord:(NSString*)value;
 - (TestAllTypesLite_Builder *)setRepeatedCordArray:(NSArray *)array;
+- (TestAllTypesLite_Builder *)setRepeatedCord:(PBArray *)array;
 - (TestAllTypesLite_Builder *)setRepeatedCordValues:(const NSString* *)values count:(NSUInteger)count;
 - (TestAllTypesLite_Builder *)clearRepeatedCord;
 
@@ -979,12 +1000,12 @@ BOOL TestAllTypesLite_NestedEnumIsValidValue(TestAllTypesLite_NestedEnum value);
 @end
 
 @interface ForeignMessageLite : PBGeneratedMessage {
-@private
-  BOOL hasC_:1;
+@package
+  uint32_t hasBits_[1];
   int32_t c;
 }
 - (BOOL) hasC;
-@property (readonly) int32_t c;
+@property (nonatomic, readonly) int32_t c;
 
 + (ForeignMessageLite*) defaultInstance;
 - (ForeignMessageLite*) defaultInstance;
@@ -1007,15 +1028,24 @@ BOOL TestAllTypesLite_NestedEnumIsValidValue(TestAllTypesLite_NestedEnum value);
 @interface ForeignMessageLite_Builder : PBGeneratedMessage_Builder {
 @private
   ForeignMessageLite* result;
+  ForeignMessageLite* prototype_;
 }
 
 - (ForeignMessageLite*) defaultInstance;
 
 - (ForeignMessageLite_Builder*) clear;
 - (ForeignMessageLite_Builder*) clone;
+- (ForeignMessageLite_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (ForeignMessageLite_Builder*) recycle:(ForeignMessageLite*) message;
 
 - (ForeignMessageLite*) build;
 - (ForeignMessageLite*) buildPartial;
+- (ForeignMessageLite*) newBuildPartial;
 
 - (ForeignMessageLite_Builder*) mergeFrom:(ForeignMessageLite*) other;
 - (ForeignMessageLite_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -1028,50 +1058,51 @@ BOOL TestAllTypesLite_NestedEnumIsValidValue(TestAllTypesLite_NestedEnum value);
 @end
 
 @interface TestPackedTypesLite : PBGeneratedMessage {
-@private
-  PBAppendableArray * packedBoolArray;
+@package
+  uint32_t hasBits_[1];
+  PBBoolArray * packedBoolArray;
   int32_t packedBoolMemoizedSerializedSize;
-  PBAppendableArray * packedDoubleArray;
+  PBDoubleArray * packedDoubleArray;
   int32_t packedDoubleMemoizedSerializedSize;
-  PBAppendableArray * packedFloatArray;
+  PBFloatArray * packedFloatArray;
   int32_t packedFloatMemoizedSerializedSize;
-  PBAppendableArray * packedInt64Array;
+  PBInt64Array * packedInt64Array;
   int32_t packedInt64MemoizedSerializedSize;
-  PBAppendableArray * packedUint64Array;
+  PBUInt64Array * packedUint64Array;
   int32_t packedUint64MemoizedSerializedSize;
-  PBAppendableArray * packedInt32Array;
+  PBInt32Array * packedInt32Array;
   int32_t packedInt32MemoizedSerializedSize;
-  PBAppendableArray * packedFixed64Array;
+  PBUInt64Array * packedFixed64Array;
   int32_t packedFixed64MemoizedSerializedSize;
-  PBAppendableArray * packedFixed32Array;
+  PBUInt32Array * packedFixed32Array;
   int32_t packedFixed32MemoizedSerializedSize;
-  PBAppendableArray * packedUint32Array;
+  PBUInt32Array * packedUint32Array;
   int32_t packedUint32MemoizedSerializedSize;
-  PBAppendableArray * packedEnumArray;
+  PBInt32Array * packedEnumArray;
   int32_t packedEnumMemoizedSerializedSize;
-  PBAppendableArray * packedSfixed32Array;
+  PBInt32Array * packedSfixed32Array;
   int32_t packedSfixed32MemoizedSerializedSize;
-  PBAppendableArray * packedSfixed64Array;
+  PBInt64Array * packedSfixed64Array;
   int32_t packedSfixed64MemoizedSerializedSize;
-  PBAppendableArray * packedSint32Array;
+  PBInt32Array * packedSint32Array;
   int32_t packedSint32MemoizedSerializedSize;
-  PBAppendableArray * packedSint64Array;
+  PBInt64Array * packedSint64Array;
   int32_t packedSint64MemoizedSerializedSize;
 }
-@property (readonly, retain) PBArray * packedInt32;
-@property (readonly, retain) PBArray * packedInt64;
-@property (readonly, retain) PBArray * packedUint32;
-@property (readonly, retain) PBArray * packedUint64;
-@property (readonly, retain) PBArray * packedSint32;
-@property (readonly, retain) PBArray * packedSint64;
-@property (readonly, retain) PBArray * packedFixed32;
-@property (readonly, retain) PBArray * packedFixed64;
-@property (readonly, retain) PBArray * packedSfixed32;
-@property (readonly, retain) PBArray * packedSfixed64;
-@property (readonly, retain) PBArray * packedFloat;
-@property (readonly, retain) PBArray * packedDouble;
-@property (readonly, retain) PBArray * packedBool;
-@property (readonly, retain) PBArray * packedEnum;
+@property (nonatomic, readonly, retain) PBArray * packedInt32;
+@property (nonatomic, readonly, retain) PBArray * packedInt64;
+@property (nonatomic, readonly, retain) PBArray * packedUint32;
+@property (nonatomic, readonly, retain) PBArray * packedUint64;
+@property (nonatomic, readonly, retain) PBArray * packedSint32;
+@property (nonatomic, readonly, retain) PBArray * packedSint64;
+@property (nonatomic, readonly, retain) PBArray * packedFixed32;
+@property (nonatomic, readonly, retain) PBArray * packedFixed64;
+@property (nonatomic, readonly, retain) PBArray * packedSfixed32;
+@property (nonatomic, readonly, retain) PBArray * packedSfixed64;
+@property (nonatomic, readonly, retain) PBArray * packedFloat;
+@property (nonatomic, readonly, retain) PBArray * packedDouble;
+@property (nonatomic, readonly, retain) PBArray * packedBool;
+@property (nonatomic, readonly, retain) PBArray * packedEnum;
 - (int32_t)packedInt32AtIndex:(NSUInteger)index;
 - (int64_t)packedInt64AtIndex:(NSUInteger)index;
 - (uint32_t)packedUint32AtIndex:(NSUInteger)index;
@@ -1108,15 +1139,24 @@ BOOL TestAllTypesLite_NestedEnumIsValidValue(TestAllTypesLite_NestedEnum value);
 @interface TestPackedTypesLite_Builder : PBGeneratedMessage_Builder {
 @private
   TestPackedTypesLite* result;
+  TestPackedTypesLite* prototype_;
 }
 
 - (TestPackedTypesLite*) defaultInstance;
 
 - (TestPackedTypesLite_Builder*) clear;
 - (TestPackedTypesLite_Builder*) clone;
+- (TestPackedTypesLite_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (TestPackedTypesLite_Builder*) recycle:(TestPackedTypesLite*) message;
 
 - (TestPackedTypesLite*) build;
 - (TestPackedTypesLite*) buildPartial;
+- (TestPackedTypesLite*) newBuildPartial;
 
 - (TestPackedTypesLite_Builder*) mergeFrom:(TestPackedTypesLite*) other;
 - (TestPackedTypesLite_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -1126,6 +1166,7 @@ BOOL TestAllTypesLite_NestedEnumIsValidValue(TestAllTypesLite_NestedEnum value);
 - (int32_t)packedInt32AtIndex:(NSUInteger)index;
 - (TestPackedTypesLite_Builder *)addPackedInt32:(int32_t)value;
 - (TestPackedTypesLite_Builder *)setPackedInt32Array:(NSArray *)array;
+- (TestPackedTypesLite_Builder *)setPackedInt32:(PBArray *)array;
 - (TestPackedTypesLite_Builder *)setPackedInt32Values:(const int32_t *)values count:(NSUInteger)count;
 - (TestPackedTypesLite_Builder *)clearPackedInt32;
 
@@ -1133,6 +1174,7 @@ BOOL TestAllTypesLite_NestedEnumIsValidValue(TestAllTypesLite_NestedEnum value);
 - (int64_t)packedInt64AtIndex:(NSUInteger)index;
 - (TestPackedTypesLite_Builder *)addPackedInt64:(int64_t)value;
 - (TestPackedTypesLite_Builder *)setPackedInt64Array:(NSArray *)array;
+- (TestPackedTypesLite_Builder *)setPackedInt64:(PBArray *)array;
 - (TestPackedTypesLite_Builder *)setPackedInt64Values:(const int64_t *)values count:(NSUInteger)count;
 - (TestPackedTypesLite_Builder *)clearPackedInt64;
 
@@ -1140,6 +1182,7 @@ BOOL TestAllTypesLite_NestedEnumIsValidValue(TestAllTypesLite_NestedEnum value);
 - (uint32_t)packedUint32AtIndex:(NSUInteger)index;
 - (TestPackedTypesLite_Builder *)addPackedUint32:(uint32_t)value;
 - (TestPackedTypesLite_Builder *)setPackedUint32Array:(NSArray *)array;
+- (TestPackedTypesLite_Builder *)setPackedUint32:(PBArray *)array;
 - (TestPackedTypesLite_Builder *)setPackedUint32Values:(const uint32_t *)values count:(NSUInteger)count;
 - (TestPackedTypesLite_Builder *)clearPackedUint32;
 
@@ -1147,6 +1190,7 @@ BOOL TestAllTypesLite_NestedEnumIsValidValue(TestAllTypesLite_NestedEnum value);
 - (uint64_t)packedUint64AtIndex:(NSUInteger)index;
 - (TestPackedTypesLite_Builder *)addPackedUint64:(uint64_t)value;
 - (TestPackedTypesLite_Builder *)setPackedUint64Array:(NSArray *)array;
+- (TestPackedTypesLite_Builder *)setPackedUint64:(PBArray *)array;
 - (TestPackedTypesLite_Builder *)setPackedUint64Values:(const uint64_t *)values count:(NSUInteger)count;
 - (TestPackedTypesLite_Builder *)clearPackedUint64;
 
@@ -1154,6 +1198,7 @@ BOOL TestAllTypesLite_NestedEnumIsValidValue(TestAllTypesLite_NestedEnum value);
 - (int32_t)packedSint32AtIndex:(NSUInteger)index;
 - (TestPackedTypesLite_Builder *)addPackedSint32:(int32_t)value;
 - (TestPackedTypesLite_Builder *)setPackedSint32Array:(NSArray *)array;
+- (TestPackedTypesLite_Builder *)setPackedSint32:(PBArray *)array;
 - (TestPackedTypesLite_Builder *)setPackedSint32Values:(const int32_t *)values count:(NSUInteger)count;
 - (TestPackedTypesLite_Builder *)clearPackedSint32;
 
@@ -1161,6 +1206,7 @@ BOOL TestAllTypesLite_NestedEnumIsValidValue(TestAllTypesLite_NestedEnum value);
 - (int64_t)packedSint64AtIndex:(NSUInteger)index;
 - (TestPackedTypesLite_Builder *)addPackedSint64:(int64_t)value;
 - (TestPackedTypesLite_Builder *)setPackedSint64Array:(NSArray *)array;
+- (TestPackedTypesLite_Builder *)setPackedSint64:(PBArray *)array;
 - (TestPackedTypesLite_Builder *)setPackedSint64Values:(const int64_t *)values count:(NSUInteger)count;
 - (TestPackedTypesLite_Builder *)clearPackedSint64;
 
@@ -1168,6 +1214,7 @@ BOOL TestAllTypesLite_NestedEnumIsValidValue(TestAllTypesLite_NestedEnum value);
 - (uint32_t)packedFixed32AtIndex:(NSUInteger)index;
 - (TestPackedTypesLite_Builder *)addPackedFixed32:(uint32_t)value;
 - (TestPackedTypesLite_Builder *)setPackedFixed32Array:(NSArray *)array;
+- (TestPackedTypesLite_Builder *)setPackedFixed32:(PBArray *)array;
 - (TestPackedTypesLite_Builder *)setPackedFixed32Values:(const uint32_t *)values count:(NSUInteger)count;
 - (TestPackedTypesLite_Builder *)clearPackedFixed32;
 
@@ -1175,6 +1222,7 @@ BOOL TestAllTypesLite_NestedEnumIsValidValue(TestAllTypesLite_NestedEnum value);
 - (uint64_t)packedFixed64AtIndex:(NSUInteger)index;
 - (TestPackedTypesLite_Builder *)addPackedFixed64:(uint64_t)value;
 - (TestPackedTypesLite_Builder *)setPackedFixed64Array:(NSArray *)array;
+- (TestPackedTypesLite_Builder *)setPackedFixed64:(PBArray *)array;
 - (TestPackedTypesLite_Builder *)setPackedFixed64Values:(const uint64_t *)values count:(NSUInteger)count;
 - (TestPackedTypesLite_Builder *)clearPackedFixed64;
 
@@ -1182,6 +1230,7 @@ BOOL TestAllTypesLite_NestedEnumIsValidValue(TestAllTypesLite_NestedEnum value);
 - (int32_t)packedSfixed32AtIndex:(NSUInteger)index;
 - (TestPackedTypesLite_Builder *)addPackedSfixed32:(int32_t)value;
 - (TestPackedTypesLite_Builder *)setPackedSfixed32Array:(NSArray *)array;
+- (TestPackedTypesLite_Builder *)setPackedSfixed32:(PBArray *)array;
 - (TestPackedTypesLite_Builder *)setPackedSfixed32Values:(const int32_t *)values count:(NSUInteger)count;
 - (TestPackedTypesLite_Builder *)clearPackedSfixed32;
 
@@ -1189,6 +1238,7 @@ BOOL TestAllTypesLite_NestedEnumIsValidValue(TestAllTypesLite_NestedEnum value);
 - (int64_t)packedSfixed64AtIndex:(NSUInteger)index;
 - (TestPackedTypesLite_Builder *)addPackedSfixed64:(int64_t)value;
 - (TestPackedTypesLite_Builder *)setPackedSfixed64Array:(NSArray *)array;
+- (TestPackedTypesLite_Builder *)setPackedSfixed64:(PBArray *)array;
 - (TestPackedTypesLite_Builder *)setPackedSfixed64Values:(const int64_t *)values count:(NSUInteger)count;
 - (TestPackedTypesLite_Builder *)clearPackedSfixed64;
 
@@ -1196,6 +1246,7 @@ BOOL TestAllTypesLite_NestedEnumIsValidValue(TestAllTypesLite_NestedEnum value);
 - (Float32)packedFloatAtIndex:(NSUInteger)index;
 - (TestPackedTypesLite_Builder *)addPackedFloat:(Float32)value;
 - (TestPackedTypesLite_Builder *)setPackedFloatArray:(NSArray *)array;
+- (TestPackedTypesLite_Builder *)setPackedFloat:(PBArray *)array;
 - (TestPackedTypesLite_Builder *)setPackedFloatValues:(const Float32 *)values count:(NSUInteger)count;
 - (TestPackedTypesLite_Builder *)clearPackedFloat;
 
@@ -1203,6 +1254,7 @@ BOOL TestAllTypesLite_NestedEnumIsValidValue(TestAllTypesLite_NestedEnum value);
 - (Float64)packedDoubleAtIndex:(NSUInteger)index;
 - (TestPackedTypesLite_Builder *)addPackedDouble:(Float64)value;
 - (TestPackedTypesLite_Builder *)setPackedDoubleArray:(NSArray *)array;
+- (TestPackedTypesLite_Builder *)setPackedDouble:(PBArray *)array;
 - (TestPackedTypesLite_Builder *)setPackedDoubleValues:(const Float64 *)values count:(NSUInteger)count;
 - (TestPackedTypesLite_Builder *)clearPackedDouble;
 
@@ -1210,6 +1262,7 @@ BOOL TestAllTypesLite_NestedEnumIsValidValue(TestAllTypesLite_NestedEnum value);
 - (BOOL)packedBoolAtIndex:(NSUInteger)index;
 - (TestPackedTypesLite_Builder *)addPackedBool:(BOOL)value;
 - (TestPackedTypesLite_Builder *)setPackedBoolArray:(NSArray *)array;
+- (TestPackedTypesLite_Builder *)setPackedBool:(PBArray *)array;
 - (TestPackedTypesLite_Builder *)setPackedBoolValues:(const BOOL *)values count:(NSUInteger)count;
 - (TestPackedTypesLite_Builder *)clearPackedBool;
 
@@ -1217,12 +1270,14 @@ BOOL TestAllTypesLite_NestedEnumIsValidValue(TestAllTypesLite_NestedEnum value);
 - (ForeignEnumLite)packedEnumAtIndex:(NSUInteger)index;
 - (TestPackedTypesLite_Builder *)addPackedEnum:(ForeignEnumLite)value;
 - (TestPackedTypesLite_Builder *)setPackedEnumArray:(NSArray *)array;
+- (TestPackedTypesLite_Builder *)setPackedEnum:(PBArray *)array;
 - (TestPackedTypesLite_Builder *)setPackedEnumValues:(const ForeignEnumLite *)values count:(NSUInteger)count;
 - (TestPackedTypesLite_Builder *)clearPackedEnum;
 @end
 
 @interface TestAllExtensionsLite : PBExtendableMessage {
-@private
+@package
+  uint32_t hasBits_[1];
 }
 
 + (TestAllExtensionsLite*) defaultInstance;
@@ -1246,15 +1301,24 @@ BOOL TestAllTypesLite_NestedEnumIsValidValue(TestAllTypesLite_NestedEnum value);
 @interface TestAllExtensionsLite_Builder : PBExtendableMessage_Builder {
 @private
   TestAllExtensionsLite* result;
+  TestAllExtensionsLite* prototype_;
 }
 
 - (TestAllExtensionsLite*) defaultInstance;
 
 - (TestAllExtensionsLite_Builder*) clear;
 - (TestAllExtensionsLite_Builder*) clone;
+- (TestAllExtensionsLite_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (TestAllExtensionsLite_Builder*) recycle:(TestAllExtensionsLite*) message;
 
 - (TestAllExtensionsLite*) build;
 - (TestAllExtensionsLite*) buildPartial;
+- (TestAllExtensionsLite*) newBuildPartial;
 
 - (TestAllExtensionsLite_Builder*) mergeFrom:(TestAllExtensionsLite*) other;
 - (TestAllExtensionsLite_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -1262,12 +1326,12 @@ BOOL TestAllTypesLite_NestedEnumIsValidValue(TestAllTypesLite_NestedEnum value);
 @end
 
 @interface OptionalGroup_extension_lite : PBGeneratedMessage {
-@private
-  BOOL hasA_:1;
+@package
+  uint32_t hasBits_[1];
   int32_t a;
 }
 - (BOOL) hasA;
-@property (readonly) int32_t a;
+@property (nonatomic, readonly) int32_t a;
 
 + (OptionalGroup_extension_lite*) defaultInstance;
 - (OptionalGroup_extension_lite*) defaultInstance;
@@ -1290,15 +1354,24 @@ BOOL TestAllTypesLite_NestedEnumIsValidValue(TestAllTypesLite_NestedEnum value);
 @interface OptionalGroup_extension_lite_Builder : PBGeneratedMessage_Builder {
 @private
   OptionalGroup_extension_lite* result;
+  OptionalGroup_extension_lite* prototype_;
 }
 
 - (OptionalGroup_extension_lite*) defaultInstance;
 
 - (OptionalGroup_extension_lite_Builder*) clear;
 - (OptionalGroup_extension_lite_Builder*) clone;
+- (OptionalGroup_extension_lite_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (OptionalGroup_extension_lite_Builder*) recycle:(OptionalGroup_extension_lite*) message;
 
 - (OptionalGroup_extension_lite*) build;
 - (OptionalGroup_extension_lite*) buildPartial;
+- (OptionalGroup_extension_lite*) newBuildPartial;
 
 - (OptionalGroup_extension_lite_Builder*) mergeFrom:(OptionalGroup_extension_lite*) other;
 - (OptionalGroup_extension_lite_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -1311,12 +1384,12 @@ BOOL TestAllTypesLite_NestedEnumIsValidValue(TestAllTypesLite_NestedEnum value);
 @end
 
 @interface RepeatedGroup_extension_lite : PBGeneratedMessage {
-@private
-  BOOL hasA_:1;
+@package
+  uint32_t hasBits_[1];
   int32_t a;
 }
 - (BOOL) hasA;
-@property (readonly) int32_t a;
+@property (nonatomic, readonly) int32_t a;
 
 + (RepeatedGroup_extension_lite*) defaultInstance;
 - (RepeatedGroup_extension_lite*) defaultInstance;
@@ -1339,15 +1412,24 @@ BOOL TestAllTypesLite_NestedEnumIsValidValue(TestAllTypesLite_NestedEnum value);
 @interface RepeatedGroup_extension_lite_Builder : PBGeneratedMessage_Builder {
 @private
   RepeatedGroup_extension_lite* result;
+  RepeatedGroup_extension_lite* prototype_;
 }
 
 - (RepeatedGroup_extension_lite*) defaultInstance;
 
 - (RepeatedGroup_extension_lite_Builder*) clear;
 - (RepeatedGroup_extension_lite_Builder*) clone;
+- (RepeatedGroup_extension_lite_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (RepeatedGroup_extension_lite_Builder*) recycle:(RepeatedGroup_extension_lite*) message;
 
 - (RepeatedGroup_extension_lite*) build;
 - (RepeatedGroup_extension_lite*) buildPartial;
+- (RepeatedGroup_extension_lite*) newBuildPartial;
 
 - (RepeatedGroup_extension_lite_Builder*) mergeFrom:(RepeatedGroup_extension_lite*) other;
 - (RepeatedGroup_extension_lite_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -1360,7 +1442,8 @@ BOOL TestAllTypesLite_NestedEnumIsValidValue(TestAllTypesLite_NestedEnum value);
 @end
 
 @interface TestPackedExtensionsLite : PBExtendableMessage {
-@private
+@package
+  uint32_t hasBits_[1];
 }
 
 + (TestPackedExtensionsLite*) defaultInstance;
@@ -1384,15 +1467,24 @@ BOOL TestAllTypesLite_NestedEnumIsValidValue(TestAllTypesLite_NestedEnum value);
 @interface TestPackedExtensionsLite_Builder : PBExtendableMessage_Builder {
 @private
   TestPackedExtensionsLite* result;
+  TestPackedExtensionsLite* prototype_;
 }
 
 - (TestPackedExtensionsLite*) defaultInstance;
 
 - (TestPackedExtensionsLite_Builder*) clear;
 - (TestPackedExtensionsLite_Builder*) clone;
+- (TestPackedExtensionsLite_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (TestPackedExtensionsLite_Builder*) recycle:(TestPackedExtensionsLite*) message;
 
 - (TestPackedExtensionsLite*) build;
 - (TestPackedExtensionsLite*) buildPartial;
+- (TestPackedExtensionsLite*) newBuildPartial;
 
 - (TestPackedExtensionsLite_Builder*) mergeFrom:(TestPackedExtensionsLite*) other;
 - (TestPackedExtensionsLite_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -1400,7 +1492,8 @@ BOOL TestAllTypesLite_NestedEnumIsValidValue(TestAllTypesLite_NestedEnum value);
 @end
 
 @interface TestNestedExtensionLite : PBGeneratedMessage {
-@private
+@package
+  uint32_t hasBits_[1];
 }
 
 + (TestNestedExtensionLite*) defaultInstance;
@@ -1425,15 +1518,24 @@ BOOL TestAllTypesLite_NestedEnumIsValidValue(TestAllTypesLite_NestedEnum value);
 @interface TestNestedExtensionLite_Builder : PBGeneratedMessage_Builder {
 @private
   TestNestedExtensionLite* result;
+  TestNestedExtensionLite* prototype_;
 }
 
 - (TestNestedExtensionLite*) defaultInstance;
 
 - (TestNestedExtensionLite_Builder*) clear;
 - (TestNestedExtensionLite_Builder*) clone;
+- (TestNestedExtensionLite_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (TestNestedExtensionLite_Builder*) recycle:(TestNestedExtensionLite*) message;
 
 - (TestNestedExtensionLite*) build;
 - (TestNestedExtensionLite*) buildPartial;
+- (TestNestedExtensionLite*) newBuildPartial;
 
 - (TestNestedExtensionLite_Builder*) mergeFrom:(TestNestedExtensionLite*) other;
 - (TestNestedExtensionLite_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -1441,12 +1543,12 @@ BOOL TestAllTypesLite_NestedEnumIsValidValue(TestAllTypesLite_NestedEnum value);
 @end
 
 @interface TestDeprecatedLite : PBGeneratedMessage {
-@private
-  BOOL hasDeprecatedField_:1;
+@package
+  uint32_t hasBits_[1];
   int32_t deprecatedField;
 }
 - (BOOL) hasDeprecatedField;
-@property (readonly) int32_t deprecatedField;
+@property (nonatomic, readonly) int32_t deprecatedField;
 
 + (TestDeprecatedLite*) defaultInstance;
 - (TestDeprecatedLite*) defaultInstance;
@@ -1469,15 +1571,24 @@ BOOL TestAllTypesLite_NestedEnumIsValidValue(TestAllTypesLite_NestedEnum value);
 @interface TestDeprecatedLite_Builder : PBGeneratedMessage_Builder {
 @private
   TestDeprecatedLite* result;
+  TestDeprecatedLite* prototype_;
 }
 
 - (TestDeprecatedLite*) defaultInstance;
 
 - (TestDeprecatedLite_Builder*) clear;
 - (TestDeprecatedLite_Builder*) clone;
+- (TestDeprecatedLite_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (TestDeprecatedLite_Builder*) recycle:(TestDeprecatedLite*) message;
 
 - (TestDeprecatedLite*) build;
 - (TestDeprecatedLite*) buildPartial;
+- (TestDeprecatedLite*) newBuildPartial;
 
 - (TestDeprecatedLite_Builder*) mergeFrom:(TestDeprecatedLite*) other;
 - (TestDeprecatedLite_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -88,6 +88,13 @@ static id<PBExtensionField> UnittestLiteRoot_packedEnumExtensionLite = nil;
 static id<PBExtensionField> TestNestedExtensionLite_nestedExtension = nil;
 static PBExtensionRegistry* extensionRegistry = nil;
 + (PBExtensionRegistry*) extensionRegistry {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    PBMutableExtensionRegistry* registry = [PBMutableExtensionRegistry registry];
+    [UnittestLiteRoot registerAllExtensions:registry];
+    [UnittestImportLiteRoot registerAllExtensions:registry];
+    extensionRegistry = [registry retain];
+  });
   return extensionRegistry;
 }
 
@@ -840,10 +847,6 @@ static PBExtensionRegistry* extensionRegistry = nil;
                                         isRepeated:NO
                                           isPacked:NO
                             isMessageSetWireFormat:NO] retain];
-    PBMutableExtensionRegistry* registry = [PBMutableExtensionRegistry registry];
-    [self registerAllExtensions:registry];
-    [UnittestImportLiteRoot registerAllExtensions:registry];
-    extensionRegistry = [registry retain];
   }
 }
 + (void) registerAllExtensions:(PBMutableExtensionRegistry*) registry {
@@ -1190,251 +1193,397 @@ BOOL ForeignEnumLiteIsValidValue(ForeignEnumLite value) {
   }
 }
 @interface TestAllTypesLite ()
-@property int32_t optionalInt32;
-@property int64_t optionalInt64;
-@property uint32_t optionalUint32;
-@property uint64_t optionalUint64;
-@property int32_t optionalSint32;
-@property int64_t optionalSint64;
-@property uint32_t optionalFixed32;
-@property uint64_t optionalFixed64;
-@property int32_t optionalSfixed32;
-@property int64_t optionalSfixed64;
-@property Float32 optionalFloat;
-@property Float64 optionalDouble;
-@property BOOL optionalBool;
-@property (retain) NSString* optionalString;
-@property (retain) NSData* optionalBytes;
-@property (retain) TestAllTypesLite_OptionalGroup* optionalGroup;
-@property (retain) TestAllTypesLite_NestedMessage* optionalNestedMessage;
-@property (retain) ForeignMessageLite* optionalForeignMessage;
-@property (retain) ImportMessageLite* optionalImportMessage;
-@property TestAllTypesLite_NestedEnum optionalNestedEnum;
-@property ForeignEnumLite optionalForeignEnum;
-@property ImportEnumLite optionalImportEnum;
-@property (retain) NSString* optionalStringPiece;
-@property (retain) NSString* optionalCord;
-@property (retain) PBAppendableArray * repeatedInt32Array;
-@property (retain) PBAppendableArray * repeatedInt64Array;
-@property (retain) PBAppendableArray * repeatedUint32Array;
-@property (retain) PBAppendableArray * repeatedUint64Array;
-@property (retain) PBAppendableArray * repeatedSint32Array;
-@property (retain) PBAppendableArray * repeatedSint64Array;
-@property (retain) PBAppendableArray * repeatedFixed32Array;
-@property (retain) PBAppendableArray * repeatedFixed64Array;
-@property (retain) PBAppendableArray * repeatedSfixed32Array;
-@property (retain) PBAppendableArray * repeatedSfixed64Array;
-@property (retain) PBAppendableArray * repeatedFloatArray;
-@property (retain) PBAppendableArray * repeatedDoubleArray;
-@property (retain) PBAppendableArray * repeatedBoolArray;
-@property (retain) PBAppendableArray * repeatedStringArray;
-@property (retain) PBAppendableArray * repeatedBytesArray;
-@property (retain) PBAppendableArray * repeatedGroupArray;
-@property (retain) PBAppendableArray * repeatedNestedMessageArray;
-@property (retain) PBAppendableArray * repeatedForeignMessageArray;
-@property (retain) PBAppendableArray * repeatedImportMessageArray;
-@property (retain) PBAppendableArray * repeatedNestedEnumArray;
-@property (retain) PBAppendableArray * repeatedForeignEnumArray;
-@property (retain) PBAppendableArray * repeatedImportEnumArray;
-@property (retain) PBAppendableArray * repeatedStringPieceArray;
-@property (retain) PBAppendableArray * repeatedCordArray;
-@property int32_t defaultInt32;
-@property int64_t defaultInt64;
-@property uint32_t defaultUint32;
-@property uint64_t defaultUint64;
-@property int32_t defaultSint32;
-@property int64_t defaultSint64;
-@property uint32_t defaultFixed32;
-@property uint64_t defaultFixed64;
-@property int32_t defaultSfixed32;
-@property int64_t defaultSfixed64;
-@property Float32 defaultFloat;
-@property Float64 defaultDouble;
-@property BOOL defaultBool;
-@property (retain) NSString* defaultString;
-@property (retain) NSData* defaultBytes;
-@property TestAllTypesLite_NestedEnum defaultNestedEnum;
-@property ForeignEnumLite defaultForeignEnum;
-@property ImportEnumLite defaultImportEnum;
-@property (retain) NSString* defaultStringPiece;
-@property (retain) NSString* defaultCord;
+@property (nonatomic) int32_t optionalInt32;
+@property (nonatomic) int64_t optionalInt64;
+@property (nonatomic) uint32_t optionalUint32;
+@property (nonatomic) uint64_t optionalUint64;
+@property (nonatomic) int32_t optionalSint32;
+@property (nonatomic) int64_t optionalSint64;
+@property (nonatomic) uint32_t optionalFixed32;
+@property (nonatomic) uint64_t optionalFixed64;
+@property (nonatomic) int32_t optionalSfixed32;
+@property (nonatomic) int64_t optionalSfixed64;
+@property (nonatomic) Float32 optionalFloat;
+@property (nonatomic) Float64 optionalDouble;
+@property (nonatomic) BOOL optionalBool;
+@property (nonatomic, retain) NSString* optionalString;
+@property (nonatomic, retain) NSData* optionalBytes;
+@property (nonatomic, retain) TestAllTypesLite_OptionalGroup* optionalGroup;
+@property (nonatomic, retain) TestAllTypesLite_NestedMessage* optionalNestedMessage;
+@property (nonatomic, retain) ForeignMessageLite* optionalForeignMessage;
+@property (nonatomic, retain) ImportMessageLite* optionalImportMessage;
+@property (nonatomic) TestAllTypesLite_NestedEnum optionalNestedEnum;
+@property (nonatomic) ForeignEnumLite optionalForeignEnum;
+@property (nonatomic) ImportEnumLite optionalImportEnum;
+@property (nonatomic, retain) NSString* optionalStringPiece;
+@property (nonatomic, retain) NSString* optionalCord;
+@property (nonatomic, retain) PBInt32Array * repeatedInt32Array;
+@property (nonatomic, retain) PBInt64Array * repeatedInt64Array;
+@property (nonatomic, retain) PBUInt32Array * repeatedUint32Array;
+@property (nonatomic, retain) PBUInt64Array * repeatedUint64Array;
+@property (nonatomic, retain) PBInt32Array * repeatedSint32Array;
+@property (nonatomic, retain) PBInt64Array * repeatedSint64Array;
+@property (nonatomic, retain) PBUInt32Array * repeatedFixed32Array;
+@property (nonatomic, retain) PBUInt64Array * repeatedFixed64Array;
+@property (nonatomic, retain) PBInt32Array * repeatedSfixed32Array;
+@property (nonatomic, retain) PBInt64Array * repeatedSfixed64Array;
+@property (nonatomic, retain) PBFloatArray * repeatedFloatArray;
+@property (nonatomic, retain) PBDoubleArray * repeatedDoubleArray;
+@property (nonatomic, retain) PBBoolArray * repeatedBoolArray;
+@property (nonatomic, retain) PBObjectArray * repeatedStringArray;
+@property (nonatomic, retain) PBObjectArray * repeatedBytesArray;
+@property (nonatomic, retain) PBObjectArray * repeatedGroupArray;
+@property (nonatomic, retain) PBObjectArray * repeatedNestedMessageArray;
+@property (nonatomic, retain) PBObjectArray * repeatedForeignMessageArray;
+@property (nonatomic, retain) PBObjectArray * repeatedImportMessageArray;
+@property (nonatomic, retain) PBInt32Array * repeatedNestedEnumArray;
+@property (nonatomic, retain) PBInt32Array * repeatedForeignEnumArray;
+@property (nonatomic, retain) PBInt32Array * repeatedImportEnumArray;
+@property (nonatomic, retain) PBObjectArray * repeatedStringPieceArray;
+@property (nonatomic, retain) PBObjectArray * repeatedCordArray;
+@property (nonatomic) int32_t defaultInt32;
+@property (nonatomic) int64_t defaultInt64;
+@property (nonatomic) uint32_t defaultUint32;
+@property (nonatomic) uint64_t defaultUint64;
+@property (nonatomic) int32_t defaultSint32;
+@property (nonatomic) int64_t defaultSint64;
+@property (nonatomic) uint32_t defaultFixed32;
+@property (nonatomic) uint64_t defaultFixed64;
+@property (nonatomic) int32_t defaultSfixed32;
+@property (nonatomic) int64_t defaultSfixed64;
+@property (nonatomic) Float32 defaultFloat;
+@property (nonatomic) Float64 defaultDouble;
+@property (nonatomic) BOOL defaultBool;
+@property (nonatomic, retain) NSString* defaultString;
+@property (nonatomic, retain) NSData* defaultBytes;
+@property (nonatomic) TestAllTypesLite_NestedEnum defaultNestedEnum;
+@property (nonatomic) ForeignEnumLite defaultForeignEnum;
+@property (nonatomic) ImportEnumLite defaultImportEnum;
+@property (nonatomic, retain) NSString* defaultStringPiece;
+@property (nonatomic, retain) NSString* defaultCord;
+@end
+
+@interface TestAllTypesLite_Builder()
+@property (nonatomic, retain) TestAllTypesLite* result;
+- (id) initWithPrototype:(TestAllTypesLite*) prototype;
+- (void) detachFromPrototype;
+- (void) freezeSubBuilders;
+- (void) dropSubBuilders;
+- (void) resetSubBuilders;
 @end
 
 @implementation TestAllTypesLite
 
 - (BOOL) hasOptionalInt32 {
-  return !!hasOptionalInt32_;
+  return (hasBits_[0] & 0x1u) != 0;
 }
-- (void) setHasOptionalInt32:(BOOL) value {
-  hasOptionalInt32_ = !!value;
+- (void) setHasOptionalInt32:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x1u;
+  } else {
+    hasBits_[0] &= ~0x1u;
+  }
 }
 @synthesize optionalInt32;
 - (BOOL) hasOptionalInt64 {
-  return !!hasOptionalInt64_;
+  return (hasBits_[0] & 0x2u) != 0;
 }
-- (void) setHasOptionalInt64:(BOOL) value {
-  hasOptionalInt64_ = !!value;
+- (void) setHasOptionalInt64:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x2u;
+  } else {
+    hasBits_[0] &= ~0x2u;
+  }
 }
 @synthesize optionalInt64;
 - (BOOL) hasOptionalUint32 {
-  return !!hasOptionalUint32_;
+  return (hasBits_[0] & 0x4u) != 0;
 }
-- (void) setHasOptionalUint32:(BOOL) value {
-  hasOptionalUint32_ = !!value;
+- (void) setHasOptionalUint32:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x4u;
+  } else {
+    hasBits_[0] &= ~0x4u;
+  }
 }
 @synthesize optionalUint32;
 - (BOOL) hasOptionalUint64 {
-  return !!hasOptionalUint64_;
+  return (hasBits_[0] & 0x8u) != 0;
 }
-- (void) setHasOptionalUint64:(BOOL) value {
-  hasOptionalUint64_ = !!value;
+- (void) setHasOptionalUint64:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x8u;
+  } else {
+    hasBits_[0] &= ~0x8u;
+  }
 }
 @synthesize optionalUint64;
 - (BOOL) hasOptionalSint32 {
-  return !!hasOptionalSint32_;
+  return (hasBits_[0] & 0x10u) != 0;
 }
-- (void) setHasOptionalSint32:(BOOL) value {
-  hasOptionalSint32_ = !!value;
+- (void) setHasOptionalSint32:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x10u;
+  } else {
+    hasBits_[0] &= ~0x10u;
+  }
 }
 @synthesize optionalSint32;
 - (BOOL) hasOptionalSint64 {
-  return !!hasOptionalSint64_;
+  return (hasBits_[0] & 0x20u) != 0;
 }
-- (void) setHasOptionalSint64:(BOOL) value {
-  hasOptionalSint64_ = !!value;
+- (void) setHasOptionalSint64:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x20u;
+  } else {
+    hasBits_[0] &= ~0x20u;
+  }
 }
 @synthesize optionalSint64;
 - (BOOL) hasOptionalFixed32 {
-  return !!hasOptionalFixed32_;
+  return (hasBits_[0] & 0x40u) != 0;
 }
-- (void) setHasOptionalFixed32:(BOOL) value {
-  hasOptionalFixed32_ = !!value;
+- (void) setHasOptionalFixed32:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x40u;
+  } else {
+    hasBits_[0] &= ~0x40u;
+  }
 }
 @synthesize optionalFixed32;
 - (BOOL) hasOptionalFixed64 {
-  return !!hasOptionalFixed64_;
+  return (hasBits_[0] & 0x80u) != 0;
 }
-- (void) setHasOptionalFixed64:(BOOL) value {
-  hasOptionalFixed64_ = !!value;
+- (void) setHasOptionalFixed64:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x80u;
+  } else {
+    hasBits_[0] &= ~0x80u;
+  }
 }
 @synthesize optionalFixed64;
 - (BOOL) hasOptionalSfixed32 {
-  return !!hasOptionalSfixed32_;
+  return (hasBits_[0] & 0x100u) != 0;
 }
-- (void) setHasOptionalSfixed32:(BOOL) value {
-  hasOptionalSfixed32_ = !!value;
+- (void) setHasOptionalSfixed32:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x100u;
+  } else {
+    hasBits_[0] &= ~0x100u;
+  }
 }
 @synthesize optionalSfixed32;
 - (BOOL) hasOptionalSfixed64 {
-  return !!hasOptionalSfixed64_;
+  return (hasBits_[0] & 0x200u) != 0;
 }
-- (void) setHasOptionalSfixed64:(BOOL) value {
-  hasOptionalSfixed64_ = !!value;
+- (void) setHasOptionalSfixed64:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x200u;
+  } else {
+    hasBits_[0] &= ~0x200u;
+  }
 }
 @synthesize optionalSfixed64;
 - (BOOL) hasOptionalFloat {
-  return !!hasOptionalFloat_;
+  return (hasBits_[0] & 0x400u) != 0;
 }
-- (void) setHasOptionalFloat:(BOOL) value {
-  hasOptionalFloat_ = !!value;
+- (void) setHasOptionalFloat:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x400u;
+  } else {
+    hasBits_[0] &= ~0x400u;
+  }
 }
 @synthesize optionalFloat;
 - (BOOL) hasOptionalDouble {
-  return !!hasOptionalDouble_;
+  return (hasBits_[0] & 0x800u) != 0;
 }
-- (void) setHasOptionalDouble:(BOOL) value {
-  hasOptionalDouble_ = !!value;
+- (void) setHasOptionalDouble:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x800u;
+  } else {
+    hasBits_[0] &= ~0x800u;
+  }
 }
 @synthesize optionalDouble;
 - (BOOL) hasOptionalBool {
-  return !!hasOptionalBool_;
+  return (hasBits_[0] & 0x1000u) != 0;
 }
-- (void) setHasOptionalBool:(BOOL) value {
-  hasOptionalBool_ = !!value;
+- (void) setHasOptionalBool:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x1000u;
+  } else {
+    hasBits_[0] &= ~0x1000u;
+  }
 }
 - (BOOL) optionalBool {
   return !!optionalBool_;
 }
-- (void) setOptionalBool:(BOOL) value {
-  optionalBool_ = !!value;
+- (void) setOptionalBool:(BOOL) value_ {
+  optionalBool_ = !!value_;
 }
 - (BOOL) hasOptionalString {
-  return !!hasOptionalString_;
+  return (hasBits_[0] & 0x2000u) != 0;
 }
-- (void) setHasOptionalString:(BOOL) value {
-  hasOptionalString_ = !!value;
+- (void) setHasOptionalString:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x2000u;
+  } else {
+    hasBits_[0] &= ~0x2000u;
+  }
 }
 @synthesize optionalString;
+- (NSString*) optionalString {
+  return (hasBits_[0] & 0x2000u) ? optionalString : @"";
+}
 - (BOOL) hasOptionalBytes {
-  return !!hasOptionalBytes_;
+  return (hasBits_[0] & 0x4000u) != 0;
 }
-- (void) setHasOptionalBytes:(BOOL) value {
-  hasOptionalBytes_ = !!value;
+- (void) setHasOptionalBytes:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x4000u;
+  } else {
+    hasBits_[0] &= ~0x4000u;
+  }
 }
 @synthesize optionalBytes;
+- (NSData*) optionalBytes {
+  if (hasBits_[0] & 0x4000u) {
+    return optionalBytes;
+  }
+  static NSData* defaultValue = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultValue = [[NSData data] retain];
+  });
+  return defaultValue;
+}
 - (BOOL) hasOptionalGroup {
-  return !!hasOptionalGroup_;
+  return (hasBits_[0] & 0x8000u) != 0;
 }
-- (void) setHasOptionalGroup:(BOOL) value {
-  hasOptionalGroup_ = !!value;
+- (void) setHasOptionalGroup:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x8000u;
+  } else {
+    hasBits_[0] &= ~0x8000u;
+  }
 }
 @synthesize optionalGroup;
+- (TestAllTypesLite_OptionalGroup*) optionalGroup {
+  return optionalGroup != nil ? optionalGroup : [TestAllTypesLite_OptionalGroup defaultInstance];
+}
 - (BOOL) hasOptionalNestedMessage {
-  return !!hasOptionalNestedMessage_;
+  return (hasBits_[0] & 0x10000u) != 0;
 }
-- (void) setHasOptionalNestedMessage:(BOOL) value {
-  hasOptionalNestedMessage_ = !!value;
+- (void) setHasOptionalNestedMessage:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x10000u;
+  } else {
+    hasBits_[0] &= ~0x10000u;
+  }
 }
 @synthesize optionalNestedMessage;
+- (TestAllTypesLite_NestedMessage*) optionalNestedMessage {
+  return optionalNestedMessage != nil ? optionalNestedMessage : [TestAllTypesLite_NestedMessage defaultInstance];
+}
 - (BOOL) hasOptionalForeignMessage {
-  return !!hasOptionalForeignMessage_;
+  return (hasBits_[0] & 0x20000u) != 0;
 }
-- (void) setHasOptionalForeignMessage:(BOOL) value {
-  hasOptionalForeignMessage_ = !!value;
+- (void) setHasOptionalForeignMessage:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x20000u;
+  } else {
+    hasBits_[0] &= ~0x20000u;
+  }
 }
 @synthesize optionalForeignMessage;
+- (ForeignMessageLite*) optionalForeignMessage {
+  return optionalForeignMessage != nil ? optionalForeignMessage : [ForeignMessageLite defaultInstance];
+}
 - (BOOL) hasOptionalImportMessage {
-  return !!hasOptionalImportMessage_;
+  return (hasBits_[0] & 0x40000u) != 0;
 }
-- (void) setHasOptionalImportMessage:(BOOL) value {
-  hasOptionalImportMessage_ = !!value;
+- (void) setHasOptionalImportMessage:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x40000u;
+  } else {
+    hasBits_[0] &= ~0x40000u;
+  }
 }
 @synthesize optionalImportMessage;
+- (ImportMessageLite*) optionalImportMessage {
+  return optionalImportMessage != nil ? optionalImportMessage : [ImportMessageLite defaultInstance];
+}
 - (BOOL) hasOptionalNestedEnum {
-  return !!hasOptionalNestedEnum_;
+  return (hasBits_[0] & 0x80000u) != 0;
 }
-- (void) setHasOptionalNestedEnum:(BOOL) value {
-  hasOptionalNestedEnum_ = !!value;
+- (void) setHasOptionalNestedEnum:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x80000u;
+  } else {
+    hasBits_[0] &= ~0x80000u;
+  }
 }
 @synthesize optionalNestedEnum;
+- (TestAllTypesLite_NestedEnum) optionalNestedEnum {
+  return (hasBits_[0] & 0x80000u) ? optionalNestedEnum : TestAllTypesLite_NestedEnumFoo;
+}
 - (BOOL) hasOptionalForeignEnum {
-  return !!hasOptionalForeignEnum_;
+  return (hasBits_[0] & 0x100000u) != 0;
 }
-- (void) setHasOptionalForeignEnum:(BOOL) value {
-  hasOptionalForeignEnum_ = !!value;
+- (void) setHasOptionalForeignEnum:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x100000u;
+  } else {
+    hasBits_[0] &= ~0x100000u;
+  }
 }
 @synthesize optionalForeignEnum;
+- (ForeignEnumLite) optionalForeignEnum {
+  return (hasBits_[0] & 0x100000u) ? optionalForeignEnum : ForeignEnumLiteForeignLiteFoo;
+}
 - (BOOL) hasOptionalImportEnum {
-  return !!hasOptionalImportEnum_;
+  return (hasBits_[0] & 0x200000u) != 0;
 }
-- (void) setHasOptionalImportEnum:(BOOL) value {
-  hasOptionalImportEnum_ = !!value;
+- (void) setHasOptionalImportEnum:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x200000u;
+  } else {
+    hasBits_[0] &= ~0x200000u;
+  }
 }
 @synthesize optionalImportEnum;
+- (ImportEnumLite) optionalImportEnum {
+  return (hasBits_[0] & 0x200000u) ? optionalImportEnum : ImportEnumLiteImportLiteFoo;
+}
 - (BOOL) hasOptionalStringPiece {
-  return !!hasOptionalStringPiece_;
+  return (hasBits_[0] & 0x400000u) != 0;
 }
-- (void) setHasOptionalStringPiece:(BOOL) value {
-  hasOptionalStringPiece_ = !!value;
+- (void) setHasOptionalStringPiece:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x400000u;
+  } else {
+    hasBits_[0] &= ~0x400000u;
+  }
 }
 @synthesize optionalStringPiece;
+- (NSString*) optionalStringPiece {
+  return (hasBits_[0] & 0x400000u) ? optionalStringPiece : @"";
+}
 - (BOOL) hasOptionalCord {
-  return !!hasOptionalCord_;
+  return (hasBits_[0] & 0x800000u) != 0;
 }
-- (void) setHasOptionalCord:(BOOL) value {
-  hasOptionalCord_ = !!value;
+- (void) setHasOptionalCord:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x800000u;
+  } else {
+    hasBits_[0] &= ~0x800000u;
+  }
 }
 @synthesize optionalCord;
+- (NSString*) optionalCord {
+  return (hasBits_[0] & 0x800000u) ? optionalCord : @"";
+}
 @synthesize repeatedInt32Array;
 @dynamic repeatedInt32;
 @synthesize repeatedInt64Array;
@@ -1484,1011 +1633,1188 @@ BOOL ForeignEnumLiteIsValidValue(ForeignEnumLite value) {
 @synthesize repeatedCordArray;
 @dynamic repeatedCord;
 - (BOOL) hasDefaultInt32 {
-  return !!hasDefaultInt32_;
+  return (hasBits_[0] & 0x1000000u) != 0;
 }
-- (void) setHasDefaultInt32:(BOOL) value {
-  hasDefaultInt32_ = !!value;
+- (void) setHasDefaultInt32:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x1000000u;
+  } else {
+    hasBits_[0] &= ~0x1000000u;
+  }
 }
 @synthesize defaultInt32;
+- (int32_t) defaultInt32 {
+  return (hasBits_[0] & 0x1000000u) ? defaultInt32 : 41;
+}
 - (BOOL) hasDefaultInt64 {
-  return !!hasDefaultInt64_;
+  return (hasBits_[0] & 0x2000000u) != 0;
 }
-- (void) setHasDefaultInt64:(BOOL) value {
-  hasDefaultInt64_ = !!value;
+- (void) setHasDefaultInt64:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x2000000u;
+  } else {
+    hasBits_[0] &= ~0x2000000u;
+  }
 }
 @synthesize defaultInt64;
+- (int64_t) defaultInt64 {
+  return (hasBits_[0] & 0x2000000u) ? defaultInt64 : 42L;
+}
 - (BOOL) hasDefaultUint32 {
-  return !!hasDefaultUint32_;
+  return (hasBits_[0] & 0x4000000u) != 0;
 }
-- (void) setHasDefaultUint32:(BOOL) value {
-  hasDefaultUint32_ = !!value;
+- (void) setHasDefaultUint32:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x4000000u;
+  } else {
+    hasBits_[0] &= ~0x4000000u;
+  }
 }
 @synthesize defaultUint32;
+- (uint32_t) defaultUint32 {
+  return (hasBits_[0] & 0x4000000u) ? defaultUint32 : 43;
+}
 - (BOOL) hasDefaultUint64 {
-  return !!hasDefaultUint64_;
+  return (hasBits_[0] & 0x8000000u) != 0;
 }
-- (void) setHasDefaultUint64:(BOOL) value {
-  hasDefaultUint64_ = !!value;
+- (void) setHasDefaultUint64:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x8000000u;
+  } else {
+    hasBits_[0] &= ~0x8000000u;
+  }
 }
 @synthesize defaultUint64;
+- (uint64_t) defaultUint64 {
+  return (hasBits_[0] & 0x8000000u) ? defaultUint64 : 44L;
+}
 - (BOOL) hasDefaultSint32 {
-  return !!hasDefaultSint32_;
+  return (hasBits_[0] & 0x10000000u) != 0;
 }
-- (void) setHasDefaultSint32:(BOOL) value {
-  hasDefaultSint32_ = !!value;
+- (void) setHasDefaultSint32:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x10000000u;
+  } else {
+    hasBits_[0] &= ~0x10000000u;
+  }
 }
 @synthesize defaultSint32;
+- (int32_t) defaultSint32 {
+  return (hasBits_[0] & 0x10000000u) ? defaultSint32 : -45;
+}
 - (BOOL) hasDefaultSint64 {
-  return !!hasDefaultSint64_;
+  return (hasBits_[0] & 0x20000000u) != 0;
 }
-- (void) setHasDefaultSint64:(BOOL) value {
-  hasDefaultSint64_ = !!value;
+- (void) setHasDefaultSint64:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x20000000u;
+  } else {
+    hasBits_[0] &= ~0x20000000u;
+  }
 }
 @synthesize defaultSint64;
+- (int64_t) defaultSint64 {
+  return (hasBits_[0] & 0x20000000u) ? defaultSint64 : 46L;
+}
 - (BOOL) hasDefaultFixed32 {
-  return !!hasDefaultFixed32_;
+  return (hasBits_[0] & 0x40000000u) != 0;
 }
-- (void) setHasDefaultFixed32:(BOOL) value {
-  hasDefaultFixed32_ = !!value;
+- (void) setHasDefaultFixed32:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x40000000u;
+  } else {
+    hasBits_[0] &= ~0x40000000u;
+  }
 }
 @synthesize defaultFixed32;
+- (uint32_t) defaultFixed32 {
+  return (hasBits_[0] & 0x40000000u) ? defaultFixed32 : 47;
+}
 - (BOOL) hasDefaultFixed64 {
-  return !!hasDefaultFixed64_;
+  return (hasBits_[0] & 0x80000000u) != 0;
 }
-- (void) setHasDefaultFixed64:(BOOL) value {
-  hasDefaultFixed64_ = !!value;
+- (void) setHasDefaultFixed64:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x80000000u;
+  } else {
+    hasBits_[0] &= ~0x80000000u;
+  }
 }
 @synthesize defaultFixed64;
+- (uint64_t) defaultFixed64 {
+  return (hasBits_[0] & 0x80000000u) ? defaultFixed64 : 48L;
+}
 - (BOOL) hasDefaultSfixed32 {
-  return !!hasDefaultSfixed32_;
+  return (hasBits_[1] & 0x1u) != 0;
 }
-- (void) setHasDefaultSfixed32:(BOOL) value {
-  hasDefaultSfixed32_ = !!value;
+- (void) setHasDefaultSfixed32:(BOOL) value_ {
+  if (value_) {
+    hasBits_[1] |= 0x1u;
+  } else {
+    hasBits_[1] &= ~0x1u;
+  }
 }
 @synthesize defaultSfixed32;
+- (int32_t) defaultSfixed32 {
+  return (hasBits_[1] & 0x1u) ? defaultSfixed32 : 49;
+}
 - (BOOL) hasDefaultSfixed64 {
-  return !!hasDefaultSfixed64_;
+  return (hasBits_[1] & 0x2u) != 0;
 }
-- (void) setHasDefaultSfixed64:(BOOL) value {
-  hasDefaultSfixed64_ = !!value;
+- (void) setHasDefaultSfixed64:(BOOL) value_ {
+  if (value_) {
+    hasBits_[1] |= 0x2u;
+  } else {
+    hasBits_[1] &= ~0x2u;
+  }
 }
 @synthesize defaultSfixed64;
+- (int64_t) defaultSfixed64 {
+  return (hasBits_[1] & 0x2u) ? defaultSfixed64 : -50L;
+}
 - (BOOL) hasDefaultFloat {
-  return !!hasDefaultFloat_;
+  return (hasBits_[1] & 0x4u) != 0;
 }
-- (void) setHasDefaultFloat:(BOOL) value {
-  hasDefaultFloat_ = !!value;
+- (void) setHasDefaultFloat:(BOOL) value_ {
+  if (value_) {
+    hasBits_[1] |= 0x4u;
+  } else {
+    hasBits_[1] &= ~0x4u;
+  }
 }
 @synthesize defaultFloat;
+- (Float32) defaultFloat {
+  return (hasBits_[1] & 0x4u) ? defaultFloat : 51.5;
+}
 - (BOOL) hasDefaultDouble {
-  return !!hasDefaultDouble_;
+  return (hasBits_[1] & 0x8u) != 0;
 }
-- (void) setHasDefaultDouble:(BOOL) value {
-  hasDefaultDouble_ = !!value;
+- (void) setHasDefaultDouble:(BOOL) value_ {
+  if (value_) {
+    hasBits_[1] |= 0x8u;
+  } else {
+    hasBits_[1] &= ~0x8u;
+  }
 }
 @synthesize defaultDouble;
+- (Float64) defaultDouble {
+  return (hasBits_[1] & 0x8u) ? defaultDouble : 52000;
+}
 - (BOOL) hasDefaultBool {
-  return !!hasDefaultBool_;
+  return (hasBits_[1] & 0x10u) != 0;
 }
-- (void) setHasDefaultBool:(BOOL) value {
-  hasDefaultBool_ = !!value;
+- (void) setHasDefaultBool:(BOOL) value_ {
+  if (value_) {
+    hasBits_[1] |= 0x10u;
+  } else {
+    hasBits_[1] &= ~0x10u;
+  }
 }
 - (BOOL) defaultBool {
-  return !!defaultBool_;
+  return (hasBits_[1] & 0x10u) ? !!defaultBool_ : YES;
 }
-- (void) setDefaultBool:(BOOL) value {
-  defaultBool_ = !!value;
+- (void) setDefaultBool:(BOOL) value_ {
+  defaultBool_ = !!value_;
 }
 - (BOOL) hasDefaultString {
-  return !!hasDefaultString_;
+  return (hasBits_[1] & 0x20u) != 0;
 }
-- (void) setHasDefaultString:(BOOL) value {
-  hasDefaultString_ = !!value;
+- (void) setHasDefaultString:(BOOL) value_ {
+  if (value_) {
+    hasBits_[1] |= 0x20u;
+  } else {
+    hasBits_[1] &= ~0x20u;
+  }
 }
 @synthesize defaultString;
+- (NSString*) defaultString {
+  return (hasBits_[1] & 0x20u) ? defaultString : @"hello";
+}
 - (BOOL) hasDefaultBytes {
-  return !!hasDefaultBytes_;
+  return (hasBits_[1] & 0x40u) != 0;
 }
-- (void) setHasDefaultBytes:(BOOL) value {
-  hasDefaultBytes_ = !!value;
+- (void) setHasDefaultBytes:(BOOL) value_ {
+  if (value_) {
+    hasBits_[1] |= 0x40u;
+  } else {
+    hasBits_[1] &= ~0x40u;
+  }
 }
 @synthesize defaultBytes;
+- (NSData*) defaultBytes {
+  if (hasBits_[1] & 0x40u) {
+    return defaultBytes;
+  }
+  static NSData* defaultValue = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultValue = [[NSData dataWithBytes:"world" length:5] retain];
+  });
+  return defaultValue;
+}
 - (BOOL) hasDefaultNestedEnum {
-  return !!hasDefaultNestedEnum_;
+  return (hasBits_[1] & 0x80u) != 0;
 }
-- (void) setHasDefaultNestedEnum:(BOOL) value {
-  hasDefaultNestedEnum_ = !!value;
+- (void) setHasDefaultNestedEnum:(BOOL) value_ {
+  if (value_) {
+    hasBits_[1] |= 0x80u;
+  } else {
+    hasBits_[1] &= ~0x80u;
+  }
 }
 @synthesize defaultNestedEnum;
+- (TestAllTypesLite_NestedEnum) defaultNestedEnum {
+  return (hasBits_[1] & 0x80u) ? defaultNestedEnum : TestAllTypesLite_NestedEnumBar;
+}
 - (BOOL) hasDefaultForeignEnum {
-  return !!hasDefaultForeignEnum_;
+  return (hasBits_[1] & 0x100u) != 0;
 }
-- (void) setHasDefaultForeignEnum:(BOOL) value {
-  hasDefaultForeignEnum_ = !!value;
+- (void) setHasDefaultForeignEnum:(BOOL) value_ {
+  if (value_) {
+    hasBits_[1] |= 0x100u;
+  } else {
+    hasBits_[1] &= ~0x100u;
+  }
 }
 @synthesize defaultForeignEnum;
+- (ForeignEnumLite) defaultForeignEnum {
+  return (hasBits_[1] & 0x100u) ? defaultForeignEnum : ForeignEnumLiteForeignLiteBar;
+}
 - (BOOL) hasDefaultImportEnum {
-  return !!hasDefaultImportEnum_;
+  return (hasBits_[1] & 0x200u) != 0;
 }
-- (void) setHasDefaultImportEnum:(BOOL) value {
-  hasDefaultImportEnum_ = !!value;
+- (void) setHasDefaultImportEnum:(BOOL) value_ {
+  if (value_) {
+    hasBits_[1] |= 0x200u;
+  } else {
+    hasBits_[1] &= ~0x200u;
+  }
 }
 @synthesize defaultImportEnum;
+- (ImportEnumLite) defaultImportEnum {
+  return (hasBits_[1] & 0x200u) ? defaultImportEnum : ImportEnumLiteImportLiteBar;
+}
 - (BOOL) hasDefaultStringPiece {
-  return !!hasDefaultStringPiece_;
+  return (hasBits_[1] & 0x400u) != 0;
 }
-- (void) setHasDefaultStringPiece:(BOOL) value {
-  hasDefaultStringPiece_ = !!value;
+- (void) setHasDefaultStringPiece:(BOOL) value_ {
+  if (value_) {
+    hasBits_[1] |= 0x400u;
+  } else {
+    hasBits_[1] &= ~0x400u;
+  }
 }
 @synthesize defaultStringPiece;
+- (NSString*) defaultStringPiece {
+  return (hasBits_[1] & 0x400u) ? defaultStringPiece : @"abc";
+}
 - (BOOL) hasDefaultCord {
-  return !!hasDefaultCord_;
+  return (hasBits_[1] & 0x800u) != 0;
 }
-- (void) setHasDefaultCord:(BOOL) value {
-  hasDefaultCord_ = !!value;
+- (void) setHasDefaultCord:(BOOL) value_ {
+  if (value_) {
+    hasBits_[1] |= 0x800u;
+  } else {
+    hasBits_[1] &= ~0x800u;
+  }
 }
 @synthesize defaultCord;
+- (NSString*) defaultCord {
+  return (hasBits_[1] & 0x800u) ? defaultCord : @"123";
+}
 - (void) dealloc {
-  self.optionalString = nil;
-  self.optionalBytes = nil;
-  self.optionalGroup = nil;
-  self.optionalNestedMessage = nil;
-  self.optionalForeignMessage = nil;
-  self.optionalImportMessage = nil;
-  self.optionalStringPiece = nil;
-  self.optionalCord = nil;
-  self.repeatedInt32Array = nil;
-  self.repeatedInt64Array = nil;
-  self.repeatedUint32Array = nil;
-  self.repeatedUint64Array = nil;
-  self.repeatedSint32Array = nil;
-  self.repeatedSint64Array = nil;
-  self.repeatedFixed32Array = nil;
-  self.repeatedFixed64Array = nil;
-  self.repeatedSfixed32Array = nil;
-  self.repeatedSfixed64Array = nil;
-  self.repeatedFloatArray = nil;
-  self.repeatedDoubleArray = nil;
-  self.repeatedBoolArray = nil;
-  self.repeatedStringArray = nil;
-  self.repeatedBytesArray = nil;
-  self.repeatedGroupArray = nil;
-  self.repeatedNestedMessageArray = nil;
-  self.repeatedForeignMessageArray = nil;
-  self.repeatedImportMessageArray = nil;
-  self.repeatedNestedEnumArray = nil;
-  self.repeatedForeignEnumArray = nil;
-  self.repeatedImportEnumArray = nil;
-  self.repeatedStringPieceArray = nil;
-  self.repeatedCordArray = nil;
-  self.defaultString = nil;
-  self.defaultBytes = nil;
-  self.defaultStringPiece = nil;
-  self.defaultCord = nil;
+  [optionalString release];
+  [optionalBytes release];
+  [optionalGroup release];
+  [optionalNestedMessage release];
+  [optionalForeignMessage release];
+  [optionalImportMessage release];
+  [optionalStringPiece release];
+  [optionalCord release];
+  [repeatedInt32Array release];
+  [repeatedInt64Array release];
+  [repeatedUint32Array release];
+  [repeatedUint64Array release];
+  [repeatedSint32Array release];
+  [repeatedSint64Array release];
+  [repeatedFixed32Array release];
+  [repeatedFixed64Array release];
+  [repeatedSfixed32Array release];
+  [repeatedSfixed64Array release];
+  [repeatedFloatArray release];
+  [repeatedDoubleArray release];
+  [repeatedBoolArray release];
+  [repeatedStringArray release];
+  [repeatedBytesArray release];
+  [repeatedGroupArray release];
+  [repeatedNestedMessageArray release];
+  [repeatedForeignMessageArray release];
+  [repeatedImportMessageArray release];
+  [repeatedNestedEnumArray release];
+  [repeatedForeignEnumArray release];
+  [repeatedImportEnumArray release];
+  [repeatedStringPieceArray release];
+  [repeatedCordArray release];
+  [defaultString release];
+  [defaultBytes release];
+  [defaultStringPiece release];
+  [defaultCord release];
   [super dealloc];
 }
-- (id) init {
-  if ((self = [super init])) {
-    self.optionalInt32 = 0;
-    self.optionalInt64 = 0L;
-    self.optionalUint32 = 0;
-    self.optionalUint64 = 0L;
-    self.optionalSint32 = 0;
-    self.optionalSint64 = 0L;
-    self.optionalFixed32 = 0;
-    self.optionalFixed64 = 0L;
-    self.optionalSfixed32 = 0;
-    self.optionalSfixed64 = 0L;
-    self.optionalFloat = 0;
-    self.optionalDouble = 0;
-    self.optionalBool = NO;
-    self.optionalString = @"";
-    self.optionalBytes = [NSData data];
-    self.optionalGroup = [TestAllTypesLite_OptionalGroup defaultInstance];
-    self.optionalNestedMessage = [TestAllTypesLite_NestedMessage defaultInstance];
-    self.optionalForeignMessage = [ForeignMessageLite defaultInstance];
-    self.optionalImportMessage = [ImportMessageLite defaultInstance];
-    self.optionalNestedEnum = TestAllTypesLite_NestedEnumFoo;
-    self.optionalForeignEnum = ForeignEnumLiteForeignLiteFoo;
-    self.optionalImportEnum = ImportEnumLiteImportLiteFoo;
-    self.optionalStringPiece = @"";
-    self.optionalCord = @"";
-    self.defaultInt32 = 41;
-    self.defaultInt64 = 42L;
-    self.defaultUint32 = 43;
-    self.defaultUint64 = 44L;
-    self.defaultSint32 = -45;
-    self.defaultSint64 = 46L;
-    self.defaultFixed32 = 47;
-    self.defaultFixed64 = 48L;
-    self.defaultSfixed32 = 49;
-    self.defaultSfixed64 = -50L;
-    self.defaultFloat = 51.5;
-    self.defaultDouble = 52000;
-    self.defaultBool = YES;
-    self.defaultString = @"hello";
-    self.defaultBytes = [NSData dataWithBytes:"world" length:5];
-    self.defaultNestedEnum = TestAllTypesLite_NestedEnumBar;
-    self.defaultForeignEnum = ForeignEnumLiteForeignLiteBar;
-    self.defaultImportEnum = ImportEnumLiteImportLiteBar;
-    self.defaultStringPiece = @"abc";
-    self.defaultCord = @"123";
-  }
-  return self;
+- (void) clearForReuse {
+  [super clearForReuse];
+  memset(hasBits_, 0, sizeof(hasBits_));
+  optionalInt32 = 0;
+  optionalInt64 = 0;
+  optionalUint32 = 0;
+  optionalUint64 = 0;
+  optionalSint32 = 0;
+  optionalSint64 = 0;
+  optionalFixed32 = 0;
+  optionalFixed64 = 0;
+  optionalSfixed32 = 0;
+  optionalSfixed64 = 0;
+  optionalFloat = 0;
+  optionalDouble = 0;
+  optionalBool_ = 0;
+  [optionalString release];
+  optionalString = nil;
+  [optionalBytes release];
+  optionalBytes = nil;
+  [optionalGroup release];
+  optionalGroup = nil;
+  [optionalNestedMessage release];
+  optionalNestedMessage = nil;
+  [optionalForeignMessage release];
+  optionalForeignMessage = nil;
+  [optionalImportMessage release];
+  optionalImportMessage = nil;
+  optionalNestedEnum = 0;
+  optionalForeignEnum = 0;
+  optionalImportEnum = 0;
+  [optionalStringPiece release];
+  optionalStringPiece = nil;
+  [optionalCord release];
+  optionalCord = nil;
+  repeatedInt32Array = PBAppendableArrayReuse(repeatedInt32Array);
+  repeatedInt64Array = PBAppendableArrayReuse(repeatedInt64Array);
+  repeatedUint32Array = PBAppendableArrayReuse(repeatedUint32Array);
+  repeatedUint64Array = PBAppendableArrayReuse(repeatedUint64Array);
+  repeatedSint32Array = PBAppendableArrayReuse(repeatedSint32Array);
+  repeatedSint64Array = PBAppendableArrayReuse(repeatedSint64Array);
+  repeatedFixed32Array = PBAppendableArrayReuse(repeatedFixed32Array);
+  repeatedFixed64Array = PBAppendableArrayReuse(repeatedFixed64Array);
+  repeatedSfixed32Array = PBAppendableArrayReuse(repeatedSfixed32Array);
+  repeatedSfixed64Array = PBAppendableArrayReuse(repeatedSfixed64Array);
+  repeatedFloatArray = PBAppendableArrayReuse(repeatedFloatArray);
+  repeatedDoubleArray = PBAppendableArrayReuse(repeatedDoubleArray);
+  repeatedBoolArray = PBAppendableArrayReuse(repeatedBoolArray);
+  repeatedStringArray = PBAppendableArrayReuse(repeatedStringArray);
+  repeatedBytesArray = PBAppendableArrayReuse(repeatedBytesArray);
+  repeatedGroupArray = PBAppendableArrayReuse(repeatedGroupArray);
+  repeatedNestedMessageArray = PBAppendableArrayReuse(repeatedNestedMessageArray);
+  repeatedForeignMessageArray = PBAppendableArrayReuse(repeatedForeignMessageArray);
+  repeatedImportMessageArray = PBAppendableArrayReuse(repeatedImportMessageArray);
+  repeatedNestedEnumArray = PBAppendableArrayReuse(repeatedNestedEnumArray);
+  repeatedForeignEnumArray = PBAppendableArrayReuse(repeatedForeignEnumArray);
+  repeatedImportEnumArray = PBAppendableArrayReuse(repeatedImportEnumArray);
+  repeatedStringPieceArray = PBAppendableArrayReuse(repeatedStringPieceArray);
+  repeatedCordArray = PBAppendableArrayReuse(repeatedCordArray);
+  defaultInt32 = 0;
+  defaultInt64 = 0;
+  defaultUint32 = 0;
+  defaultUint64 = 0;
+  defaultSint32 = 0;
+  defaultSint64 = 0;
+  defaultFixed32 = 0;
+  defaultFixed64 = 0;
+  defaultSfixed32 = 0;
+  defaultSfixed64 = 0;
+  defaultFloat = 0;
+  defaultDouble = 0;
+  defaultBool_ = 0;
+  [defaultString release];
+  defaultString = nil;
+  [defaultBytes release];
+  defaultBytes = nil;
+  defaultNestedEnum = 0;
+  defaultForeignEnum = 0;
+  defaultImportEnum = 0;
+  [defaultStringPiece release];
+  defaultStringPiece = nil;
+  [defaultCord release];
+  defaultCord = nil;
 }
 static TestAllTypesLite* defaultTestAllTypesLiteInstance = nil;
-+ (void) initialize {
-  if (self == [TestAllTypesLite class]) {
-    defaultTestAllTypesLiteInstance = [[TestAllTypesLite alloc] init];
-  }
-}
 + (TestAllTypesLite*) defaultInstance {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultTestAllTypesLiteInstance = [[TestAllTypesLite alloc] init];
+  });
   return defaultTestAllTypesLiteInstance;
 }
 - (TestAllTypesLite*) defaultInstance {
-  return defaultTestAllTypesLiteInstance;
+  return [TestAllTypesLite defaultInstance];
 }
 - (PBArray *)repeatedInt32 {
   return repeatedInt32Array;
 }
 - (int32_t)repeatedInt32AtIndex:(NSUInteger)index {
-  return [repeatedInt32Array int32AtIndex:index];
+  return PBInt32ArrayValueAtIndex(repeatedInt32Array, index);
 }
 - (PBArray *)repeatedInt64 {
   return repeatedInt64Array;
 }
 - (int64_t)repeatedInt64AtIndex:(NSUInteger)index {
-  return [repeatedInt64Array int64AtIndex:index];
+  return PBInt64ArrayValueAtIndex(repeatedInt64Array, index);
 }
 - (PBArray *)repeatedUint32 {
   return repeatedUint32Array;
 }
 - (uint32_t)repeatedUint32AtIndex:(NSUInteger)index {
-  return [repeatedUint32Array uint32AtIndex:index];
+  return PBUInt32ArrayValueAtIndex(repeatedUint32Array, index);
 }
 - (PBArray *)repeatedUint64 {
   return repeatedUint64Array;
 }
 - (uint64_t)repeatedUint64AtIndex:(NSUInteger)index {
-  return [repeatedUint64Array uint64AtIndex:index];
+  return PBUInt64ArrayValueAtIndex(repeatedUint64Array, index);
 }
 - (PBArray *)repeatedSint32 {
   return repeatedSint32Array;
 }
 - (int32_t)repeatedSint32AtIndex:(NSUInteger)index {
-  return [repeatedSint32Array int32AtIndex:index];
+  return PBInt32ArrayValueAtIndex(repeatedSint32Array, index);
 }
 - (PBArray *)repeatedSint64 {
   return repeatedSint64Array;
 }
 - (int64_t)repeatedSint64AtIndex:(NSUInteger)index {
-  return [repeatedSint64Array int64AtIndex:index];
+  return PBInt64ArrayValueAtIndex(repeatedSint64Array, index);
 }
 - (PBArray *)repeatedFixed32 {
   return repeatedFixed32Array;
 }
 - (uint32_t)repeatedFixed32AtIndex:(NSUInteger)index {
-  return [repeatedFixed32Array uint32AtIndex:index];
+  return PBUInt32ArrayValueAtIndex(repeatedFixed32Array, index);
 }
 - (PBArray *)repeatedFixed64 {
   return repeatedFixed64Array;
 }
 - (uint64_t)repeatedFixed64AtIndex:(NSUInteger)index {
-  return [repeatedFixed64Array uint64AtIndex:index];
+  return PBUInt64ArrayValueAtIndex(repeatedFixed64Array, index);
 }
 - (PBArray *)repeatedSfixed32 {
   return repeatedSfixed32Array;
 }
 - (int32_t)repeatedSfixed32AtIndex:(NSUInteger)index {
-  return [repeatedSfixed32Array int32AtIndex:index];
+  return PBInt32ArrayValueAtIndex(repeatedSfixed32Array, index);
 }
 - (PBArray *)repeatedSfixed64 {
   return repeatedSfixed64Array;
 }
 - (int64_t)repeatedSfixed64AtIndex:(NSUInteger)index {
-  return [repeatedSfixed64Array int64AtIndex:index];
+  return PBInt64ArrayValueAtIndex(repeatedSfixed64Array, index);
 }
 - (PBArray *)repeatedFloat {
   return repeatedFloatArray;
 }
 - (Float32)repeatedFloatAtIndex:(NSUInteger)index {
-  return [repeatedFloatArray floatAtIndex:index];
+  return PBFloatArrayValueAtIndex(repeatedFloatArray, index);
 }
 - (PBArray *)repeatedDouble {
   return repeatedDoubleArray;
 }
 - (Float64)repeatedDoubleAtIndex:(NSUInteger)index {
-  return [repeatedDoubleArray doubleAtIndex:index];
+  return PBDoubleArrayValueAtIndex(repeatedDoubleArray, index);
 }
 - (PBArray *)repeatedBool {
   return repeatedBoolArray;
 }
 - (BOOL)repeatedBoolAtIndex:(NSUInteger)index {
-  return [repeatedBoolArray boolAtIndex:index];
+  return PBBoolArrayValueAtIndex(repeatedBoolArray, index);
 }
 - (PBArray *)repeatedString {
   return repeatedStringArray;
 }
 - (NSString*)repeatedStringAtIndex:(NSUInteger)index {
-  return [repeatedStringArray objectAtIndex:index];
+  return PBObjectArrayValueAtIndex(repeatedStringArray, index);
 }
 - (PBArray *)repeatedBytes {
   return repeatedBytesArray;
 }
 - (NSData*)repeatedBytesAtIndex:(NSUInteger)index {
-  return [repeatedBytesArray objectAtIndex:index];
+  return PBObjectArrayValueAtIndex(repeatedBytesArray, index);
 }
 - (PBArray *)repeatedGroup {
   return repeatedGroupArray;
 }
 - (TestAllTypesLite_RepeatedGroup*)repeatedGroupAtIndex:(NSUInteger)index {
-  return [repeatedGroupArray objectAtIndex:index];
+  return PBObjectArrayValueAtIndex(repeatedGroupArray, index);
 }
 - (PBArray *)repeatedNestedMessage {
   return repeatedNestedMessageArray;
 }
 - (TestAllTypesLite_NestedMessage*)repeatedNestedMessageAtIndex:(NSUInteger)index {
-  return [repeatedNestedMessageArray objectAtIndex:index];
+  return PBObjectArrayValueAtIndex(repeatedNestedMessageArray, index);
 }
 - (PBArray *)repeatedForeignMessage {
   return repeatedForeignMessageArray;
 }
 - (ForeignMessageLite*)repeatedForeignMessageAtIndex:(NSUInteger)index {
-  return [repeatedForeignMessageArray objectAtIndex:index];
+  return PBObjectArrayValueAtIndex(repeatedForeignMessageArray, index);
 }
 - (PBArray *)repeatedImportMessage {
   return repeatedImportMessageArray;
 }
 - (ImportMessageLite*)repeatedImportMessageAtIndex:(NSUInteger)index {
-  return [repeatedImportMessageArray objectAtIndex:index];
+  return PBObjectArrayValueAtIndex(repeatedImportMessageArray, index);
 }
 - (PBArray *)repeatedNestedEnum {
   return repeatedNestedEnumArray;
 }
 - (TestAllTypesLite_NestedEnum)repeatedNestedEnumAtIndex:(NSUInteger)index {
-  return [repeatedNestedEnumArray int32AtIndex:index];
+  return PBInt32ArrayValueAtIndex(repeatedNestedEnumArray, index);
 }
 - (PBArray *)repeatedForeignEnum {
   return repeatedForeignEnumArray;
 }
 - (ForeignEnumLite)repeatedForeignEnumAtIndex:(NSUInteger)index {
-  return [repeatedForeignEnumArray int32AtIndex:index];
+  return PBInt32ArrayValueAtIndex(repeatedForeignEnumArray, index);
 }
 - (PBArray *)repeatedImportEnum {
   return repeatedImportEnumArray;
 }
 - (ImportEnumLite)repeatedImportEnumAtIndex:(NSUInteger)index {
-  return [repeatedImportEnumArray int32AtIndex:index];
+  return PBInt32ArrayValueAtIndex(repeatedImportEnumArray, index);
 }
 - (PBArray *)repeatedStringPiece {
   return repeatedStringPieceArray;
 }
 - (NSString*)repeatedStringPieceAtIndex:(NSUInteger)index {
-  return [repeatedStringPieceArray objectAtIndex:index];
+  return PBObjectArrayValueAtIndex(repeatedStringPieceArray, index);
 }
 - (PBArray *)repeatedCord {
   return repeatedCordArray;
 }
 - (NSString*)repeatedCordAtIndex:(NSUInteger)index {
-  return [repeatedCordArray objectAtIndex:index];
+  return PBObjectArrayValueAtIndex(repeatedCordArray, index);
 }
 - (BOOL) isInitialized {
   return YES;
 }
 - (void) writeToCodedOutputStream:(PBCodedOutputStream*) output {
-  if (self.hasOptionalInt32) {
-    [output writeInt32:1 value:self.optionalInt32];
+  if (hasBits_[0] & 0x1u) {
+    [output writeInt32:1 value:optionalInt32];
   }
-  if (self.hasOptionalInt64) {
-    [output writeInt64:2 value:self.optionalInt64];
+  if (hasBits_[0] & 0x2u) {
+    [output writeInt64:2 value:optionalInt64];
   }
-  if (self.hasOptionalUint32) {
-    [output writeUInt32:3 value:self.optionalUint32];
+  if (hasBits_[0] & 0x4u) {
+    [output writeUInt32:3 value:optionalUint32];
   }
-  if (self.hasOptionalUint64) {
-    [output writeUInt64:4 value:self.optionalUint64];
+  if (hasBits_[0] & 0x8u) {
+    [output writeUInt64:4 value:optionalUint64];
   }
-  if (self.hasOptionalSint32) {
-    [output writeSInt32:5 value:self.optionalSint32];
+  if (hasBits_[0] & 0x10u) {
+    [output writeSInt32:5 value:optionalSint32];
   }
-  if (self.hasOptionalSint64) {
-    [output writeSInt64:6 value:self.optionalSint64];
+  if (hasBits_[0] & 0x20u) {
+    [output writeSInt64:6 value:optionalSint64];
   }
-  if (self.hasOptionalFixed32) {
-    [output writeFixed32:7 value:self.optionalFixed32];
+  if (hasBits_[0] & 0x40u) {
+    [output writeFixed32:7 value:optionalFixed32];
   }
-  if (self.hasOptionalFixed64) {
-    [output writeFixed64:8 value:self.optionalFixed64];
+  if (hasBits_[0] & 0x80u) {
+    [output writeFixed64:8 value:optionalFixed64];
   }
-  if (self.hasOptionalSfixed32) {
-    [output writeSFixed32:9 value:self.optionalSfixed32];
+  if (hasBits_[0] & 0x100u) {
+    [output writeSFixed32:9 value:optionalSfixed32];
   }
-  if (self.hasOptionalSfixed64) {
-    [output writeSFixed64:10 value:self.optionalSfixed64];
+  if (hasBits_[0] & 0x200u) {
+    [output writeSFixed64:10 value:optionalSfixed64];
   }
-  if (self.hasOptionalFloat) {
-    [output writeFloat:11 value:self.optionalFloat];
+  if (hasBits_[0] & 0x400u) {
+    [output writeFloat:11 value:optionalFloat];
   }
-  if (self.hasOptionalDouble) {
-    [output writeDouble:12 value:self.optionalDouble];
+  if (hasBits_[0] & 0x800u) {
+    [output writeDouble:12 value:optionalDouble];
   }
-  if (self.hasOptionalBool) {
-    [output writeBool:13 value:self.optionalBool];
+  if (hasBits_[0] & 0x1000u) {
+    [output writeBool:13 value:!!optionalBool_];
   }
-  if (self.hasOptionalString) {
-    [output writeString:14 value:self.optionalString];
+  if (hasBits_[0] & 0x2000u) {
+    [output writeString:14 value:optionalString];
   }
-  if (self.hasOptionalBytes) {
-    [output writeData:15 value:self.optionalBytes];
+  if (hasBits_[0] & 0x4000u) {
+    [output writeData:15 value:optionalBytes];
   }
-  if (self.hasOptionalGroup) {
-    [output writeGroup:16 value:self.optionalGroup];
+  if (hasBits_[0] & 0x8000u) {
+    [output writeGroup:16 value:optionalGroup];
   }
-  if (self.hasOptionalNestedMessage) {
-    [output writeMessage:18 value:self.optionalNestedMessage];
+  if (hasBits_[0] & 0x10000u) {
+    [output writeMessage:18 value:optionalNestedMessage];
   }
-  if (self.hasOptionalForeignMessage) {
-    [output writeMessage:19 value:self.optionalForeignMessage];
+  if (hasBits_[0] & 0x20000u) {
+    [output writeMessage:19 value:optionalForeignMessage];
   }
-  if (self.hasOptionalImportMessage) {
-    [output writeMessage:20 value:self.optionalImportMessage];
+  if (hasBits_[0] & 0x40000u) {
+    [output writeMessage:20 value:optionalImportMessage];
   }
-  if (self.hasOptionalNestedEnum) {
-    [output writeEnum:21 value:self.optionalNestedEnum];
+  if (hasBits_[0] & 0x80000u) {
+    [output writeEnum:21 value:optionalNestedEnum];
   }
-  if (self.hasOptionalForeignEnum) {
-    [output writeEnum:22 value:self.optionalForeignEnum];
+  if (hasBits_[0] & 0x100000u) {
+    [output writeEnum:22 value:optionalForeignEnum];
   }
-  if (self.hasOptionalImportEnum) {
-    [output writeEnum:23 value:self.optionalImportEnum];
+  if (hasBits_[0] & 0x200000u) {
+    [output writeEnum:23 value:optionalImportEnum];
   }
-  if (self.hasOptionalStringPiece) {
-    [output writeString:24 value:self.optionalStringPiece];
+  if (hasBits_[0] & 0x400000u) {
+    [output writeString:24 value:optionalStringPiece];
   }
-  if (self.hasOptionalCord) {
-    [output writeString:25 value:self.optionalCord];
+  if (hasBits_[0] & 0x800000u) {
+    [output writeString:25 value:optionalCord];
   }
-  const NSUInteger repeatedInt32ArrayCount = self.repeatedInt32Array.count;
+  const NSUInteger repeatedInt32ArrayCount = repeatedInt32Array.count;
   if (repeatedInt32ArrayCount > 0) {
-    const int32_t *values = (const int32_t *)self.repeatedInt32Array.data;
+    const int32_t *values = (const int32_t *)repeatedInt32Array.data;
     for (NSUInteger i = 0; i < repeatedInt32ArrayCount; ++i) {
       [output writeInt32:31 value:values[i]];
     }
   }
-  const NSUInteger repeatedInt64ArrayCount = self.repeatedInt64Array.count;
+  const NSUInteger repeatedInt64ArrayCount = repeatedInt64Array.count;
   if (repeatedInt64ArrayCount > 0) {
-    const int64_t *values = (const int64_t *)self.repeatedInt64Array.data;
+    const int64_t *values = (const int64_t *)repeatedInt64Array.data;
     for (NSUInteger i = 0; i < repeatedInt64ArrayCount; ++i) {
       [output writeInt64:32 value:values[i]];
     }
   }
-  const NSUInteger repeatedUint32ArrayCount = self.repeatedUint32Array.count;
+  const NSUInteger repeatedUint32ArrayCount = repeatedUint32Array.count;
   if (repeatedUint32ArrayCount > 0) {
-    const uint32_t *values = (const uint32_t *)self.repeatedUint32Array.data;
+    const uint32_t *values = (const uint32_t *)repeatedUint32Array.data;
     for (NSUInteger i = 0; i < repeatedUint32ArrayCount; ++i) {
       [output writeUInt32:33 value:values[i]];
     }
   }
-  const NSUInteger repeatedUint64ArrayCount = self.repeatedUint64Array.count;
+  const NSUInteger repeatedUint64ArrayCount = repeatedUint64Array.count;
   if (repeatedUint64ArrayCount > 0) {
-    const uint64_t *values = (const uint64_t *)self.repeatedUint64Array.data;
+    const uint64_t *values = (const uint64_t *)repeatedUint64Array.data;
     for (NSUInteger i = 0; i < repeatedUint64ArrayCount; ++i) {
       [output writeUInt64:34 value:values[i]];
     }
   }
-  const NSUInteger repeatedSint32ArrayCount = self.repeatedSint32Array.count;
+  const NSUInteger repeatedSint32ArrayCount = repeatedSint32Array.count;
   if (repeatedSint32ArrayCount > 0) {
-    const int32_t *values = (const int32_t *)self.repeatedSint32Array.data;
+    const int32_t *values = (const int32_t *)repeatedSint32Array.data;
     for (NSUInteger i = 0; i < repeatedSint32ArrayCount; ++i) {
       [output writeSInt32:35 value:values[i]];
     }
   }
-  const NSUInteger repeatedSint64ArrayCount = self.repeatedSint64Array.count;
+  const NSUInteger repeatedSint64ArrayCount = repeatedSint64Array.count;
   if (repeatedSint64ArrayCount > 0) {
-    const int64_t *values = (const int64_t *)self.repeatedSint64Array.data;
+    const int64_t *values = (const int64_t *)repeatedSint64Array.data;
     for (NSUInteger i = 0; i < repeatedSint64ArrayCount; ++i) {
       [output writeSInt64:36 value:values[i]];
     }
   }
-  const NSUInteger repeatedFixed32ArrayCount = self.repeatedFixed32Array.count;
+  const NSUInteger repeatedFixed32ArrayCount = repeatedFixed32Array.count;
   if (repeatedFixed32ArrayCount > 0) {
-    const uint32_t *values = (const uint32_t *)self.repeatedFixed32Array.data;
+    const uint32_t *values = (const uint32_t *)repeatedFixed32Array.data;
     for (NSUInteger i = 0; i < repeatedFixed32ArrayCount; ++i) {
       [output writeFixed32:37 value:values[i]];
     }
   }
-  const NSUInteger repeatedFixed64ArrayCount = self.repeatedFixed64Array.count;
+  const NSUInteger repeatedFixed64ArrayCount = repeatedFixed64Array.count;
   if (repeatedFixed64ArrayCount > 0) {
-    const uint64_t *values = (const uint64_t *)self.repeatedFixed64Array.data;
+    const uint64_t *values = (const uint64_t *)repeatedFixed64Array.data;
     for (NSUInteger i = 0; i < repeatedFixed64ArrayCount; ++i) {
       [output writeFixed64:38 value:values[i]];
     }
   }
-  const NSUInteger repeatedSfixed32ArrayCount = self.repeatedSfixed32Array.count;
+  const NSUInteger repeatedSfixed32ArrayCount = repeatedSfixed32Array.count;
   if (repeatedSfixed32ArrayCount > 0) {
-    const int32_t *values = (const int32_t *)self.repeatedSfixed32Array.data;
+    const int32_t *values = (const int32_t *)repeatedSfixed32Array.data;
     for (NSUInteger i = 0; i < repeatedSfixed32ArrayCount; ++i) {
       [output writeSFixed32:39 value:values[i]];
     }
   }
-  const NSUInteger repeatedSfixed64ArrayCount = self.repeatedSfixed64Array.count;
+  const NSUInteger repeatedSfixed64ArrayCount = repeatedSfixed64Array.count;
   if (repeatedSfixed64ArrayCount > 0) {
-    const int64_t *values = (const int64_t *)self.repeatedSfixed64Array.data;
+    const int64_t *values = (const int64_t *)repeatedSfixed64Array.data;
     for (NSUInteger i = 0; i < repeatedSfixed64ArrayCount; ++i) {
       [output writeSFixed64:40 value:values[i]];
     }
   }
-  const NSUInteger repeatedFloatArrayCount = self.repeatedFloatArray.count;
+  const NSUInteger repeatedFloatArrayCount = repeatedFloatArray.count;
   if (repeatedFloatArrayCount > 0) {
-    const Float32 *values = (const Float32 *)self.repeatedFloatArray.data;
+    const Float32 *values = (const Float32 *)repeatedFloatArray.data;
     for (NSUInteger i = 0; i < repeatedFloatArrayCount; ++i) {
       [output writeFloat:41 value:values[i]];
     }
   }
-  const NSUInteger repeatedDoubleArrayCount = self.repeatedDoubleArray.count;
+  const NSUInteger repeatedDoubleArrayCount = repeatedDoubleArray.count;
   if (repeatedDoubleArrayCount > 0) {
-    const Float64 *values = (const Float64 *)self.repeatedDoubleArray.data;
+    const Float64 *values = (const Float64 *)repeatedDoubleArray.data;
     for (NSUInteger i = 0; i < repeatedDoubleArrayCount; ++i) {
       [output writeDouble:42 value:values[i]];
     }
   }
-  const NSUInteger repeatedBoolArrayCount = self.repeatedBoolArray.count;
+  const NSUInteger repeatedBoolArrayCount = repeatedBoolArray.count;
   if (repeatedBoolArrayCount > 0) {
-    const BOOL *values = (const BOOL *)self.repeatedBoolArray.data;
+    const BOOL *values = (const BOOL *)repeatedBoolArray.data;
     for (NSUInteger i = 0; i < repeatedBoolArrayCount; ++i) {
       [output writeBool:43 value:values[i]];
     }
   }
-  const NSUInteger repeatedStringArrayCount = self.repeatedStringArray.count;
+  const NSUInteger repeatedStringArrayCount = repeatedStringArray.count;
   if (repeatedStringArrayCount > 0) {
-    const NSString* *values = (const NSString* *)self.repeatedStringArray.data;
+    const NSString* *values = (const NSString* *)repeatedStringArray.data;
     for (NSUInteger i = 0; i < repeatedStringArrayCount; ++i) {
       [output writeString:44 value:values[i]];
     }
   }
-  const NSUInteger repeatedBytesArrayCount = self.repeatedBytesArray.count;
+  const NSUInteger repeatedBytesArrayCount = repeatedBytesArray.count;
   if (repeatedBytesArrayCount > 0) {
-    const NSData* *values = (const NSData* *)self.repeatedBytesArray.data;
+    const NSData* *values = (const NSData* *)repeatedBytesArray.data;
     for (NSUInteger i = 0; i < repeatedBytesArrayCount; ++i) {
       [output writeData:45 value:values[i]];
     }
   }
-  for (TestAllTypesLite_RepeatedGroup *element in self.repeatedGroupArray) {
+  for (TestAllTypesLite_RepeatedGroup *element in repeatedGroupArray) {
     [output writeGroup:46 value:element];
   }
-  for (TestAllTypesLite_NestedMessage *element in self.repeatedNestedMessageArray) {
+  for (TestAllTypesLite_NestedMessage *element in repeatedNestedMessageArray) {
     [output writeMessage:48 value:element];
   }
-  for (ForeignMessageLite *element in self.repeatedForeignMessageArray) {
+  for (ForeignMessageLite *element in repeatedForeignMessageArray) {
     [output writeMessage:49 value:element];
   }
-  for (ImportMessageLite *element in self.repeatedImportMessageArray) {
+  for (ImportMessageLite *element in repeatedImportMessageArray) {
     [output writeMessage:50 value:element];
   }
-  const NSUInteger repeatedNestedEnumArrayCount = self.repeatedNestedEnumArray.count;
-  const TestAllTypesLite_NestedEnum *repeatedNestedEnumArrayValues = (const TestAllTypesLite_NestedEnum *)self.repeatedNestedEnumArray.data;
+  const NSUInteger repeatedNestedEnumArrayCount = repeatedNestedEnumArray.count;
+  const TestAllTypesLite_NestedEnum *repeatedNestedEnumArrayValues = (const TestAllTypesLite_NestedEnum *)repeatedNestedEnumArray.data;
   for (NSUInteger i = 0; i < repeatedNestedEnumArrayCount; ++i) {
     [output writeEnum:51 value:repeatedNestedEnumArrayValues[i]];
   }
-  const NSUInteger repeatedForeignEnumArrayCount = self.repeatedForeignEnumArray.count;
-  const ForeignEnumLite *repeatedForeignEnumArrayValues = (const ForeignEnumLite *)self.repeatedForeignEnumArray.data;
+  const NSUInteger repeatedForeignEnumArrayCount = repeatedForeignEnumArray.count;
+  const ForeignEnumLite *repeatedForeignEnumArrayValues = (const ForeignEnumLite *)repeatedForeignEnumArray.data;
   for (NSUInteger i = 0; i < repeatedForeignEnumArrayCount; ++i) {
     [output writeEnum:52 value:repeatedForeignEnumArrayValues[i]];
   }
-  const NSUInteger repeatedImportEnumArrayCount = self.repeatedImportEnumArray.count;
-  const ImportEnumLite *repeatedImportEnumArrayValues = (const ImportEnumLite *)self.repeatedImportEnumArray.data;
+  const NSUInteger repeatedImportEnumArrayCount = repeatedImportEnumArray.count;
+  const ImportEnumLite *repeatedImportEnumArrayValues = (const ImportEnumLite *)repeatedImportEnumArray.data;
   for (NSUInteger i = 0; i < repeatedImportEnumArrayCount; ++i) {
     [output writeEnum:53 value:repeatedImportEnumArrayValues[i]];
   }
-  const NSUInteger repeatedStringPieceArrayCount = self.repeatedStringPieceArray.count;
+  const NSUInteger repeatedStringPieceArrayCount = repeatedStringPieceArray.count;
   if (repeatedStringPieceArrayCount > 0) {
-    const NSString* *values = (const NSString* *)self.repeatedStringPieceArray.data;
+    const NSString* *values = (const NSString* *)repeatedStringPieceArray.data;
     for (NSUInteger i = 0; i < repeatedStringPieceArrayCount; ++i) {
       [output writeString:54 value:values[i]];
     }
   }
-  const NSUInteger repeatedCordArrayCount = self.repeatedCordArray.count;
+  const NSUInteger repeatedCordArrayCount = repeatedCordArray.count;
   if (repeatedCordArrayCount > 0) {
-    const NSString* *values = (const NSString* *)self.repeatedCordArray.data;
+    const NSString* *values = (const NSString* *)repeatedCordArray.data;
     for (NSUInteger i = 0; i < repeatedCordArrayCount; ++i) {
       [output writeString:55 value:values[i]];
     }
   }
-  if (self.hasDefaultInt32) {
-    [output writeInt32:61 value:self.defaultInt32];
+  if (hasBits_[0] & 0x1000000u) {
+    [output writeInt32:61 value:defaultInt32];
   }
-  if (self.hasDefaultInt64) {
-    [output writeInt64:62 value:self.defaultInt64];
+  if (hasBits_[0] & 0x2000000u) {
+    [output writeInt64:62 value:defaultInt64];
   }
-  if (self.hasDefaultUint32) {
-    [output writeUInt32:63 value:self.defaultUint32];
+  if (hasBits_[0] & 0x4000000u) {
+    [output writeUInt32:63 value:defaultUint32];
   }
-  if (self.hasDefaultUint64) {
-    [output writeUInt64:64 value:self.defaultUint64];
+  if (hasBits_[0] & 0x8000000u) {
+    [output writeUInt64:64 value:defaultUint64];
   }
-  if (self.hasDefaultSint32) {
-    [output writeSInt32:65 value:self.defaultSint32];
+  if (hasBits_[0] & 0x10000000u) {
+    [output writeSInt32:65 value:defaultSint32];
   }
-  if (self.hasDefaultSint64) {
-    [output writeSInt64:66 value:self.defaultSint64];
+  if (hasBits_[0] & 0x20000000u) {
+    [output writeSInt64:66 value:defaultSint64];
   }
-  if (self.hasDefaultFixed32) {
-    [output writeFixed32:67 value:self.defaultFixed32];
+  if (hasBits_[0] & 0x40000000u) {
+    [output writeFixed32:67 value:defaultFixed32];
   }
-  if (self.hasDefaultFixed64) {
-    [output writeFixed64:68 value:self.defaultFixed64];
+  if (hasBits_[0] & 0x80000000u) {
+    [output writeFixed64:68 value:defaultFixed64];
   }
-  if (self.hasDefaultSfixed32) {
-    [output writeSFixed32:69 value:self.defaultSfixed32];
+  if (hasBits_[1] & 0x1u) {
+    [output writeSFixed32:69 value:defaultSfixed32];
   }
-  if (self.hasDefaultSfixed64) {
-    [output writeSFixed64:70 value:self.defaultSfixed64];
+  if (hasBits_[1] & 0x2u) {
+    [output writeSFixed64:70 value:defaultSfixed64];
   }
-  if (self.hasDefaultFloat) {
-    [output writeFloat:71 value:self.defaultFloat];
+  if (hasBits_[1] & 0x4u) {
+    [output writeFloat:71 value:defaultFloat];
   }
-  if (self.hasDefaultDouble) {
-    [output writeDouble:72 value:self.defaultDouble];
+  if (hasBits_[1] & 0x8u) {
+    [output writeDouble:72 value:defaultDouble];
   }
-  if (self.hasDefaultBool) {
-    [output writeBool:73 value:self.defaultBool];
+  if (hasBits_[1] & 0x10u) {
+    [output writeBool:73 value:!!defaultBool_];
   }
-  if (self.hasDefaultString) {
-    [output writeString:74 value:self.defaultString];
+  if (hasBits_[1] & 0x20u) {
+    [output writeString:74 value:defaultString];
   }
-  if (self.hasDefaultBytes) {
-    [output writeData:75 value:self.defaultBytes];
+  if (hasBits_[1] & 0x40u) {
+    [output writeData:75 value:defaultBytes];
   }
-  if (self.hasDefaultNestedEnum) {
-    [output writeEnum:81 value:self.defaultNestedEnum];
+  if (hasBits_[1] & 0x80u) {
+    [output writeEnum:81 value:defaultNestedEnum];
   }
-  if (self.hasDefaultForeignEnum) {
-    [output writeEnum:82 value:self.defaultForeignEnum];
+  if (hasBits_[1] & 0x100u) {
+    [output writeEnum:82 value:defaultForeignEnum];
   }
-  if (self.hasDefaultImportEnum) {
-    [output writeEnum:83 value:self.defaultImportEnum];
+  if (hasBits_[1] & 0x200u) {
+    [output writeEnum:83 value:defaultImportEnum];
   }
-  if (self.hasDefaultStringPiece) {
-    [output writeString:84 value:self.defaultStringPiece];
+  if (hasBits_[1] & 0x400u) {
+    [output writeString:84 value:defaultStringPiece];
   }
-  if (self.hasDefaultCord) {
-    [output writeString:85 value:self.defaultCord];
+  if (hasBits_[1] & 0x800u) {
+    [output writeString:85 value:defaultCord];
   }
-  [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = PBGeneratedMessageGetMemoizedSize(&memoizedSerializedSize);
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
-  if (self.hasOptionalInt32) {
-    size += computeInt32Size(1, self.optionalInt32);
+  size_ = 0;
+  if (hasBits_[0] & 0x1u) {
+    size_ += computeInt32Size(1, optionalInt32);
   }
-  if (self.hasOptionalInt64) {
-    size += computeInt64Size(2, self.optionalInt64);
+  if (hasBits_[0] & 0x2u) {
+    size_ += computeInt64Size(2, optionalInt64);
   }
-  if (self.hasOptionalUint32) {
-    size += computeUInt32Size(3, self.optionalUint32);
+  if (hasBits_[0] & 0x4u) {
+    size_ += computeUInt32Size(3, optionalUint32);
   }
-  if (self.hasOptionalUint64) {
-    size += computeUInt64Size(4, self.optionalUint64);
+  if (hasBits_[0] & 0x8u) {
+    size_ += computeUInt64Size(4, optionalUint64);
   }
-  if (self.hasOptionalSint32) {
-    size += computeSInt32Size(5, self.optionalSint32);
+  if (hasBits_[0] & 0x10u) {
+    size_ += computeSInt32Size(5, optionalSint32);
   }
-  if (self.hasOptionalSint64) {
-    size += computeSInt64Size(6, self.optionalSint64);
+  if (hasBits_[0] & 0x20u) {
+    size_ += computeSInt64Size(6, optionalSint64);
   }
-  if (self.hasOptionalFixed32) {
-    size += computeFixed32Size(7, self.optionalFixed32);
+  if (hasBits_[0] & 0x40u) {
+    size_ += computeFixed32Size(7, optionalFixed32);
   }
-  if (self.hasOptionalFixed64) {
-    size += computeFixed64Size(8, self.optionalFixed64);
+  if (hasBits_[0] & 0x80u) {
+    size_ += computeFixed64Size(8, optionalFixed64);
   }
-  if (self.hasOptionalSfixed32) {
-    size += computeSFixed32Size(9, self.optionalSfixed32);
+  if (hasBits_[0] & 0x100u) {
+    size_ += computeSFixed32Size(9, optionalSfixed32);
   }
-  if (self.hasOptionalSfixed64) {
-    size += computeSFixed64Size(10, self.optionalSfixed64);
+  if (hasBits_[0] & 0x200u) {
+    size_ += computeSFixed64Size(10, optionalSfixed64);
   }
-  if (self.hasOptionalFloat) {
-    size += computeFloatSize(11, self.optionalFloat);
+  if (hasBits_[0] & 0x400u) {
+    size_ += computeFloatSize(11, optionalFloat);
   }
-  if (self.hasOptionalDouble) {
-    size += computeDoubleSize(12, self.optionalDouble);
+  if (hasBits_[0] & 0x800u) {
+    size_ += computeDoubleSize(12, optionalDouble);
   }
-  if (self.hasOptionalBool) {
-    size += computeBoolSize(13, self.optionalBool);
+  if (hasBits_[0] & 0x1000u) {
+    size_ += computeBoolSize(13, !!optionalBool_);
   }
-  if (self.hasOptionalString) {
-    size += computeStringSize(14, self.optionalString);
+  if (hasBits_[0] & 0x2000u) {
+    size_ += computeStringSize(14, optionalString);
   }
-  if (self.hasOptionalBytes) {
-    size += computeDataSize(15, self.optionalBytes);
+  if (hasBits_[0] & 0x4000u) {
+    size_ += computeDataSize(15, optionalBytes);
   }
-  if (self.hasOptionalGroup) {
-    size += computeGroupSize(16, self.optionalGroup);
+  if (hasBits_[0] & 0x8000u) {
+    size_ += computeGroupSize(16, optionalGroup);
   }
-  if (self.hasOptionalNestedMessage) {
-    size += computeMessageSize(18, self.optionalNestedMessage);
+  if (hasBits_[0] & 0x10000u) {
+    size_ += computeMessageSize(18, optionalNestedMessage);
   }
-  if (self.hasOptionalForeignMessage) {
-    size += computeMessageSize(19, self.optionalForeignMessage);
+  if (hasBits_[0] & 0x20000u) {
+    size_ += computeMessageSize(19, optionalForeignMessage);
   }
-  if (self.hasOptionalImportMessage) {
-    size += computeMessageSize(20, self.optionalImportMessage);
+  if (hasBits_[0] & 0x40000u) {
+    size_ += computeMessageSize(20, optionalImportMessage);
   }
-  if (self.hasOptionalNestedEnum) {
-    size += computeEnumSize(21, self.optionalNestedEnum);
+  if (hasBits_[0] & 0x80000u) {
+    size_ += computeEnumSize(21, optionalNestedEnum);
   }
-  if (self.hasOptionalForeignEnum) {
-    size += computeEnumSize(22, self.optionalForeignEnum);
+  if (hasBits_[0] & 0x100000u) {
+    size_ += computeEnumSize(22, optionalForeignEnum);
   }
-  if (self.hasOptionalImportEnum) {
-    size += computeEnumSize(23, self.optionalImportEnum);
+  if (hasBits_[0] & 0x200000u) {
+    size_ += computeEnumSize(23, optionalImportEnum);
   }
-  if (self.hasOptionalStringPiece) {
-    size += computeStringSize(24, self.optionalStringPiece);
+  if (hasBits_[0] & 0x400000u) {
+    size_ += computeStringSize(24, optionalStringPiece);
   }
-  if (self.hasOptionalCord) {
-    size += computeStringSize(25, self.optionalCord);
+  if (hasBits_[0] & 0x800000u) {
+    size_ += computeStringSize(25, optionalCord);
   }
   {
     int32_t dataSize = 0;
-    const NSUInteger count = self.repeatedInt32Array.count;
-    const int32_t *values = (const int32_t *)self.repeatedInt32Array.data;
+    const NSUInteger count = repeatedInt32Array.count;
+    const int32_t *values = (const int32_t *)repeatedInt32Array.data;
     for (NSUInteger i = 0; i < count; ++i) {
       dataSize += computeInt32SizeNoTag(values[i]);
     }
-    size += dataSize;
-    size += 2 * count;
+    size_ += dataSize;
+    size_ += 2 * count;
   }
   {
     int32_t dataSize = 0;
-    const NSUInteger count = self.repeatedInt64Array.count;
-    const int64_t *values = (const int64_t *)self.repeatedInt64Array.data;
+    const NSUInteger count = repeatedInt64Array.count;
+    const int64_t *values = (const int64_t *)repeatedInt64Array.data;
     for (NSUInteger i = 0; i < count; ++i) {
       dataSize += computeInt64SizeNoTag(values[i]);
     }
-    size += dataSize;
-    size += 2 * count;
+    size_ += dataSize;
+    size_ += 2 * count;
   }
   {
     int32_t dataSize = 0;
-    const NSUInteger count = self.repeatedUint32Array.count;
-    const uint32_t *values = (const uint32_t *)self.repeatedUint32Array.data;
+    const NSUInteger count = repeatedUint32Array.count;
+    const uint32_t *values = (const uint32_t *)repeatedUint32Array.data;
     for (NSUInteger i = 0; i < count; ++i) {
       dataSize += computeUInt32SizeNoTag(values[i]);
     }
-    size += dataSize;
-    size += 2 * count;
+    size_ += dataSize;
+    size_ += 2 * count;
   }
   {
     int32_t dataSize = 0;
-    const NSUInteger count = self.repeatedUint64Array.count;
-    const uint64_t *values = (const uint64_t *)self.repeatedUint64Array.data;
+    const NSUInteger count = repeatedUint64Array.count;
+    const uint64_t *values = (const uint64_t *)repeatedUint64Array.data;
     for (NSUInteger i = 0; i < count; ++i) {
       dataSize += computeUInt64SizeNoTag(values[i]);
     }
-    size += dataSize;
-    size += 2 * count;
+    size_ += dataSize;
+    size_ += 2 * count;
   }
   {
     int32_t dataSize = 0;
-    const NSUInteger count = self.repeatedSint32Array.count;
-    const int32_t *values = (const int32_t *)self.repeatedSint32Array.data;
+    const NSUInteger count = repeatedSint32Array.count;
+    const int32_t *values = (const int32_t *)repeatedSint32Array.data;
     for (NSUInteger i = 0; i < count; ++i) {
       dataSize += computeSInt32SizeNoTag(values[i]);
     }
-    size += dataSize;
-    size += 2 * count;
+    size_ += dataSize;
+    size_ += 2 * count;
   }
   {
     int32_t dataSize = 0;
-    const NSUInteger count = self.repeatedSint64Array.count;
-    const int64_t *values = (const int64_t *)self.repeatedSint64Array.data;
+    const NSUInteger count = repeatedSint64Array.count;
+    const int64_t *values = (const int64_t *)repeatedSint64Array.data;
     for (NSUInteger i = 0; i < count; ++i) {
       dataSize += computeSInt64SizeNoTag(values[i]);
     }
-    size += dataSize;
-    size += 2 * count;
+    size_ += dataSize;
+    size_ += 2 * count;
   }
   {
     int32_t dataSize = 0;
-    const NSUInteger count = self.repeatedFixed32Array.count;
+    const NSUInteger count = repeatedFixed32Array.count;
     dataSize = 4 * count;
-    size += dataSize;
-    size += 2 * count;
+    size_ += dataSize;
+    size_ += 2 * count;
   }
   {
     int32_t dataSize = 0;
-    const NSUInteger count = self.repeatedFixed64Array.count;
+    const NSUInteger count = repeatedFixed64Array.count;
     dataSize = 8 * count;
-    size += dataSize;
-    size += 2 * count;
+    size_ += dataSize;
+    size_ += 2 * count;
   }
   {
     int32_t dataSize = 0;
-    const NSUInteger count = self.repeatedSfixed32Array.count;
+    const NSUInteger count = repeatedSfixed32Array.count;
     dataSize = 4 * count;
-    size += dataSize;
-    size += 2 * count;
+    size_ += dataSize;
+    size_ += 2 * count;
   }
   {
     int32_t dataSize = 0;
-    const NSUInteger count = self.repeatedSfixed64Array.count;
+    const NSUInteger count = repeatedSfixed64Array.count;
     dataSize = 8 * count;
-    size += dataSize;
-    size += 2 * count;
+    size_ += dataSize;
+    size_ += 2 * count;
   }
   {
     int32_t dataSize = 0;
-    const NSUInteger count = self.repeatedFloatArray.count;
+    const NSUInteger count = repeatedFloatArray.count;
     dataSize = 4 * count;
-    size += dataSize;
-    size += 2 * count;
+    size_ += dataSize;
+    size_ += 2 * count;
   }
   {
     int32_t dataSize = 0;
-    const NSUInteger count = self.repeatedDoubleArray.count;
+    const NSUInteger count = repeatedDoubleArray.count;
     dataSize = 8 * count;
-    size += dataSize;
-    size += 2 * count;
+    size_ += dataSize;
+    size_ += 2 * count;
   }
   {
     int32_t dataSize = 0;
-    const NSUInteger count = self.repeatedBoolArray.count;
+    const NSUInteger count = repeatedBoolArray.count;
     dataSize = 1 * count;
-    size += dataSize;
-    size += 2 * count;
+    size_ += dataSize;
+    size_ += 2 * count;
   }
   {
     int32_t dataSize = 0;
-    const NSUInteger count = self.repeatedStringArray.count;
-    const NSString* *values = (const NSString* *)self.repeatedStringArray.data;
+    const NSUInteger count = repeatedStringArray.count;
+    const NSString* *values = (const NSString* *)repeatedStringArray.data;
     for (NSUInteger i = 0; i < count; ++i) {
       dataSize += computeStringSizeNoTag(values[i]);
     }
-    size += dataSize;
-    size += 2 * count;
+    size_ += dataSize;
+    size_ += 2 * count;
   }
   {
     int32_t dataSize = 0;
-    const NSUInteger count = self.repeatedBytesArray.count;
-    const NSData* *values = (const NSData* *)self.repeatedBytesArray.data;
+    const NSUInteger count = repeatedBytesArray.count;
+    const NSData* *values = (const NSData* *)repeatedBytesArray.data;
     for (NSUInteger i = 0; i < count; ++i) {
       dataSize += computeDataSizeNoTag(values[i]);
     }
-    size += dataSize;
-    size += 2 * count;
+    size_ += dataSize;
+    size_ += 2 * count;
   }
-  for (TestAllTypesLite_RepeatedGroup *element in self.repeatedGroupArray) {
-    size += computeGroupSize(46, element);
+  for (TestAllTypesLite_RepeatedGroup *element in repeatedGroupArray) {
+    size_ += computeGroupSize(46, element);
   }
-  for (TestAllTypesLite_NestedMessage *element in self.repeatedNestedMessageArray) {
-    size += computeMessageSize(48, element);
+  for (TestAllTypesLite_NestedMessage *element in repeatedNestedMessageArray) {
+    size_ += computeMessageSize(48, element);
   }
-  for (ForeignMessageLite *element in self.repeatedForeignMessageArray) {
-    size += computeMessageSize(49, element);
+  for (ForeignMessageLite *element in repeatedForeignMessageArray) {
+    size_ += computeMessageSize(49, element);
   }
-  for (ImportMessageLite *element in self.repeatedImportMessageArray) {
-    size += computeMessageSize(50, element);
+  for (ImportMessageLite *element in repeatedImportMessageArray) {
+    size_ += computeMessageSize(50, element);
   }
   {
     int32_t dataSize = 0;
-    const NSUInteger count = self.repeatedNestedEnumArray.count;
-    const TestAllTypesLite_NestedEnum *values = (const TestAllTypesLite_NestedEnum *)self.repeatedNestedEnumArray.data;
+    const NSUInteger count = repeatedNestedEnumArray.count;
+    const TestAllTypesLite_NestedEnum *values = (const TestAllTypesLite_NestedEnum *)repeatedNestedEnumArray.data;
     for (NSUInteger i = 0; i < count; ++i) {
       dataSize += computeEnumSizeNoTag(values[i]);
     }
-    size += dataSize;
-    size += 2 * count;
+    size_ += dataSize;
+    size_ += 2 * count;
   }
   {
     int32_t dataSize = 0;
-    const NSUInteger count = self.repeatedForeignEnumArray.count;
-    const ForeignEnumLite *values = (const ForeignEnumLite *)self.repeatedForeignEnumArray.data;
+    const NSUInteger count = repeatedForeignEnumArray.count;
+    const ForeignEnumLite *values = (const ForeignEnumLite *)repeatedForeignEnumArray.data;
     for (NSUInteger i = 0; i < count; ++i) {
       dataSize += computeEnumSizeNoTag(values[i]);
     }
-    size += dataSize;
-    size += 2 * count;
+    size_ += dataSize;
+    size_ += 2 * count;
   }
   {
     int32_t dataSize = 0;
-    const NSUInteger count = self.repeatedImportEnumArray.count;
-    const ImportEnumLite *values = (const ImportEnumLite *)self.repeatedImportEnumArray.data;
+    const NSUInteger count = repeatedImportEnumArray.count;
+    const ImportEnumLite *values = (const ImportEnumLite *)repeatedImportEnumArray.data;
     for (NSUInteger i = 0; i < count; ++i) {
       dataSize += computeEnumSizeNoTag(values[i]);
     }
-    size += dataSize;
-    size += 2 * count;
+    size_ += dataSize;
+    size_ += 2 * count;
   }
   {
     int32_t dataSize = 0;
-    const NSUInteger count = self.repeatedStringPieceArray.count;
-    const NSString* *values = (const NSString* *)self.repeatedStringPieceArray.data;
+    const NSUInteger count = repeatedStringPieceArray.count;
+    const NSString* *values = (const NSString* *)repeatedStringPieceArray.data;
     for (NSUInteger i = 0; i < count; ++i) {
       dataSize += computeStringSizeNoTag(values[i]);
     }
-    size += dataSize;
-    size += 2 * count;
+    size_ += dataSize;
+    size_ += 2 * count;
   }
   {
     int32_t dataSize = 0;
-    const NSUInteger count = self.repeatedCordArray.count;
-    const NSString* *values = (const NSString* *)self.repeatedCordArray.data;
+    const NSUInteger count = repeatedCordArray.count;
+    const NSString* *values = (const NSString* *)repeatedCordArray.data;
     for (NSUInteger i = 0; i < count; ++i) {
       dataSize += computeStringSizeNoTag(values[i]);
     }
-    size += dataSize;
-    size += 2 * count;
+    size_ += dataSize;
+    size_ += 2 * count;
   }
-  if (self.hasDefaultInt32) {
-    size += computeInt32Size(61, self.defaultInt32);
+  if (hasBits_[0] & 0x1000000u) {
+    size_ += computeInt32Size(61, defaultInt32);
   }
-  if (self.hasDefaultInt64) {
-    size += computeInt64Size(62, self.defaultInt64);
+  if (hasBits_[0] & 0x2000000u) {
+    size_ += computeInt64Size(62, defaultInt64);
   }
-  if (self.hasDefaultUint32) {
-    size += computeUInt32Size(63, self.defaultUint32);
+  if (hasBits_[0] & 0x4000000u) {
+    size_ += computeUInt32Size(63, defaultUint32);
   }
-  if (self.hasDefaultUint64) {
-    size += computeUInt64Size(64, self.defaultUint64);
+  if (hasBits_[0] & 0x8000000u) {
+    size_ += computeUInt64Size(64, defaultUint64);
   }
-  if (self.hasDefaultSint32) {
-    size += computeSInt32Size(65, self.defaultSint32);
+  if (hasBits_[0] & 0x10000000u) {
+    size_ += computeSInt32Size(65, defaultSint32);
   }
-  if (self.hasDefaultSint64) {
-    size += computeSInt64Size(66, self.defaultSint64);
+  if (hasBits_[0] & 0x20000000u) {
+    size_ += computeSInt64Size(66, defaultSint64);
   }
-  if (self.hasDefaultFixed32) {
-    size += computeFixed32Size(67, self.defaultFixed32);
+  if (hasBits_[0] & 0x40000000u) {
+    size_ += computeFixed32Size(67, defaultFixed32);
   }
-  if (self.hasDefaultFixed64) {
-    size += computeFixed64Size(68, self.defaultFixed64);
+  if (hasBits_[0] & 0x80000000u) {
+    size_ += computeFixed64Size(68, defaultFixed64);
   }
-  if (self.hasDefaultSfixed32) {
-    size += computeSFixed32Size(69, self.defaultSfixed32);
+  if (hasBits_[1] & 0x1u) {
+    size_ += computeSFixed32Size(69, defaultSfixed32);
   }
-  if (self.hasDefaultSfixed64) {
-    size += computeSFixed64Size(70, self.defaultSfixed64);
+  if (hasBits_[1] & 0x2u) {
+    size_ += computeSFixed64Size(70, defaultSfixed64);
   }
-  if (self.hasDefaultFloat) {
-    size += computeFloatSize(71, self.defaultFloat);
+  if (hasBits_[1] & 0x4u) {
+    size_ += computeFloatSize(71, defaultFloat);
   }
-  if (self.hasDefaultDouble) {
-    size += computeDoubleSize(72, self.defaultDouble);
+  if (hasBits_[1] & 0x8u) {
+    size_ += computeDoubleSize(72, defaultDouble);
   }
-  if (self.hasDefaultBool) {
-    size += computeBoolSize(73, self.defaultBool);
+  if (hasBits_[1] & 0x10u) {
+    size_ += computeBoolSize(73, !!defaultBool_);
   }
-  if (self.hasDefaultString) {
-    size += computeStringSize(74, self.defaultString);
+  if (hasBits_[1] & 0x20u) {
+    size_ += computeStringSize(74, defaultString);
   }
-  if (self.hasDefaultBytes) {
-    size += computeDataSize(75, self.defaultBytes);
+  if (hasBits_[1] & 0x40u) {
+    size_ += computeDataSize(75, defaultBytes);
   }
-  if (self.hasDefaultNestedEnum) {
-    size += computeEnumSize(81, self.defaultNestedEnum);
+  if (hasBits_[1] & 0x80u) {
+    size_ += computeEnumSize(81, defaultNestedEnum);
   }
-  if (self.hasDefaultForeignEnum) {
-    size += computeEnumSize(82, self.defaultForeignEnum);
+  if (hasBits_[1] & 0x100u) {
+    size_ += computeEnumSize(82, defaultForeignEnum);
   }
-  if (self.hasDefaultImportEnum) {
-    size += computeEnumSize(83, self.defaultImportEnum);
+  if (hasBits_[1] & 0x200u) {
+    size_ += computeEnumSize(83, defaultImportEnum);
   }
-  if (self.hasDefaultStringPiece) {
-    size += computeStringSize(84, self.defaultStringPiece);
+  if (hasBits_[1] & 0x400u) {
+    size_ += computeStringSize(84, defaultStringPiece);
   }
-  if (self.hasDefaultCord) {
-    size += computeStringSize(85, self.defaultCord);
+  if (hasBits_[1] & 0x800u) {
+    size_ += computeStringSize(85, defaultCord);
   }
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
+  PBGeneratedMessageSetMemoizedSize(&memoizedSerializedSize, size_);
+  return size_;
 }
 + (TestAllTypesLite*) parseFromData:(NSData*) data {
   return (TestAllTypesLite*)[[[TestAllTypesLite builder] mergeFromData:data] build];
@@ -2512,7 +2838,7 @@ static TestAllTypesLite* defaultTestAllTypesLiteInstance = nil;
   return [[[TestAllTypesLite_Builder alloc] init] autorelease];
 }
 + (TestAllTypesLite_Builder*) builderWithPrototype:(TestAllTypesLite*) prototype {
-  return [[TestAllTypesLite builder] mergeFrom:prototype];
+  return [[[TestAllTypesLite_Builder alloc] initWithPrototype:prototype] autorelease];
 }
 - (TestAllTypesLite_Builder*) builder {
   return [TestAllTypesLite builder];
@@ -2520,237 +2846,6 @@ static TestAllTypesLite* defaultTestAllTypesLiteInstance = nil;
 - (TestAllTypesLite_Builder*) toBuilder {
   return [TestAllTypesLite builderWithPrototype:self];
 }
-- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
-  if (self.hasOptionalInt32) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"optionalInt32", [NSNumber numberWithInt:self.optionalInt32]];
-  }
-  if (self.hasOptionalInt64) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"optionalInt64", [NSNumber numberWithLongLong:self.optionalInt64]];
-  }
-  if (self.hasOptionalUint32) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"optionalUint32", [NSNumber numberWithInt:self.optionalUint32]];
-  }
-  if (self.hasOptionalUint64) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"optionalUint64", [NSNumber numberWithLongLong:self.optionalUint64]];
-  }
-  if (self.hasOptionalSint32) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"optionalSint32", [NSNumber numberWithInt:self.optionalSint32]];
-  }
-  if (self.hasOptionalSint64) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"optionalSint64", [NSNumber numberWithLongLong:self.optionalSint64]];
-  }
-  if (self.hasOptionalFixed32) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"optionalFixed32", [NSNumber numberWithInt:self.optionalFixed32]];
-  }
-  if (self.hasOptionalFixed64) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"optionalFixed64", [NSNumber numberWithLongLong:self.optionalFixed64]];
-  }
-  if (self.hasOptionalSfixed32) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"optionalSfixed32", [NSNumber numberWithInt:self.optionalSfixed32]];
-  }
-  if (self.hasOptionalSfixed64) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"optionalSfixed64", [NSNumber numberWithLongLong:self.optionalSfixed64]];
-  }
-  if (self.hasOptionalFloat) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"optionalFloat", [NSNumber numberWithFloat:self.optionalFloat]];
-  }
-  if (self.hasOptionalDouble) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"optionalDouble", [NSNumber numberWithDouble:self.optionalDouble]];
-  }
-  if (self.hasOptionalBool) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"optionalBool", [NSNumber numberWithBool:self.optionalBool]];
-  }
-  if (self.hasOptionalString) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"optionalString", self.optionalString];
-  }
-  if (self.hasOptionalBytes) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"optionalBytes", self.optionalBytes];
-  }
-  if (self.hasOptionalGroup) {
-    [output appendFormat:@"%@%@ {\n", indent, @"optionalGroup"];
-    [self.optionalGroup writeDescriptionTo:output
-                         withIndent:[NSString stringWithFormat:@"%@  ", indent]];
-    [output appendFormat:@"%@}\n", indent];
-  }
-  if (self.hasOptionalNestedMessage) {
-    [output appendFormat:@"%@%@ {\n", indent, @"optionalNestedMessage"];
-    [self.optionalNestedMessage writeDescriptionTo:output
-                         withIndent:[NSString stringWithFormat:@"%@  ", indent]];
-    [output appendFormat:@"%@}\n", indent];
-  }
-  if (self.hasOptionalForeignMessage) {
-    [output appendFormat:@"%@%@ {\n", indent, @"optionalForeignMessage"];
-    [self.optionalForeignMessage writeDescriptionTo:output
-                         withIndent:[NSString stringWithFormat:@"%@  ", indent]];
-    [output appendFormat:@"%@}\n", indent];
-  }
-  if (self.hasOptionalImportMessage) {
-    [output appendFormat:@"%@%@ {\n", indent, @"optionalImportMessage"];
-    [self.optionalImportMessage writeDescriptionTo:output
-                         withIndent:[NSString stringWithFormat:@"%@  ", indent]];
-    [output appendFormat:@"%@}\n", indent];
-  }
-  if (self.hasOptionalNestedEnum) {
-    [output appendFormat:@"%@%@: %d\n", indent, @"optionalNestedEnum", self.optionalNestedEnum];
-  }
-  if (self.hasOptionalForeignEnum) {
-    [output appendFormat:@"%@%@: %d\n", indent, @"optionalForeignEnum", self.optionalForeignEnum];
-  }
-  if (self.hasOptionalImportEnum) {
-    [output appendFormat:@"%@%@: %d\n", indent, @"optionalImportEnum", self.optionalImportEnum];
-  }
-  if (self.hasOptionalStringPiece) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"optionalStringPiece", self.optionalStringPiece];
-  }
-  if (self.hasOptionalCord) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"optionalCord", self.optionalCord];
-  }
-  for (NSNumber* value in self.repeatedInt32Array) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"repeatedInt32", value];
-  }
-  for (NSNumber* value in self.repeatedInt64Array) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"repeatedInt64", value];
-  }
-  for (NSNumber* value in self.repeatedUint32Array) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"repeatedUint32", value];
-  }
-  for (NSNumber* value in self.repeatedUint64Array) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"repeatedUint64", value];
-  }
-  for (NSNumber* value in self.repeatedSint32Array) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"repeatedSint32", value];
-  }
-  for (NSNumber* value in self.repeatedSint64Array) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"repeatedSint64", value];
-  }
-  for (NSNumber* value in self.repeatedFixed32Array) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"repeatedFixed32", value];
-  }
-  for (NSNumber* value in self.repeatedFixed64Array) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"repeatedFixed64", value];
-  }
-  for (NSNumber* value in self.repeatedSfixed32Array) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"repeatedSfixed32", value];
-  }
-  for (NSNumber* value in self.repeatedSfixed64Array) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"repeatedSfixed64", value];
-  }
-  for (NSNumber* value in self.repeatedFloatArray) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"repeatedFloat", value];
-  }
-  for (NSNumber* value in self.repeatedDoubleArray) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"repeatedDouble", value];
-  }
-  for (NSNumber* value in self.repeatedBoolArray) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"repeatedBool", value];
-  }
-  for (NSString* element in self.repeatedStringArray) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"repeatedString", element];
-  }
-  for (NSData* element in self.repeatedBytesArray) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"repeatedBytes", element];
-  }
-  for (TestAllTypesLite_RepeatedGroup* element in self.repeatedGroupArray) {
-    [output appendFormat:@"%@%@ {\n", indent, @"repeatedGroup"];
-    [element writeDescriptionTo:output
-                     withIndent:[NSString stringWithFormat:@"%@  ", indent]];
-    [output appendFormat:@"%@}\n", indent];
-  }
-  for (TestAllTypesLite_NestedMessage* element in self.repeatedNestedMessageArray) {
-    [output appendFormat:@"%@%@ {\n", indent, @"repeatedNestedMessage"];
-    [element writeDescriptionTo:output
-                     withIndent:[NSString stringWithFormat:@"%@  ", indent]];
-    [output appendFormat:@"%@}\n", indent];
-  }
-  for (ForeignMessageLite* element in self.repeatedForeignMessageArray) {
-    [output appendFormat:@"%@%@ {\n", indent, @"repeatedForeignMessage"];
-    [element writeDescriptionTo:output
-                     withIndent:[NSString stringWithFormat:@"%@  ", indent]];
-    [output appendFormat:@"%@}\n", indent];
-  }
-  for (ImportMessageLite* element in self.repeatedImportMessageArray) {
-    [output appendFormat:@"%@%@ {\n", indent, @"repeatedImportMessage"];
-    [element writeDescriptionTo:output
-                     withIndent:[NSString stringWithFormat:@"%@  ", indent]];
-    [output appendFormat:@"%@}\n", indent];
-  }
-  for (NSNumber* element in self.repeatedNestedEnumArray) {
-    [output appendFormat:@"%@%@: %d\n", indent, @"repeatedNestedEnum", element.intValue];
-  }
-  for (NSNumber* element in self.repeatedForeignEnumArray) {
-    [output appendFormat:@"%@%@: %d\n", indent, @"repeatedForeignEnum", element.intValue];
-  }
-  for (NSNumber* element in self.repeatedImportEnumArray) {
-    [output appendFormat:@"%@%@: %d\n", indent, @"repeatedImportEnum", element.intValue];
-  }
-  for (NSString* element in self.repeatedStringPieceArray) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"repeatedStringPiece", element];
-  }
-  for (NSString* element in self.repeatedCordArray) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"repeatedCord", element];
-  }
-  if (self.hasDefaultInt32) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"defaultInt32", [NSNumber numberWithInt:self.defaultInt32]];
-  }
-  if (self.hasDefaultInt64) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"defaultInt64", [NSNumber numberWithLongLong:self.defaultInt64]];
-  }
-  if (self.hasDefaultUint32) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"defaultUint32", [NSNumber numberWithInt:self.defaultUint32]];
-  }
-  if (self.hasDefaultUint64) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"defaultUint64", [NSNumber numberWithLongLong:self.defaultUint64]];
-  }
-  if (self.hasDefaultSint32) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"defaultSint32", [NSNumber numberWithInt:self.defaultSint32]];
-  }
-  if (self.hasDefaultSint64) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"defaultSint64", [NSNumber numberWithLongLong:self.defaultSint64]];
-  }
-  if (self.hasDefaultFixed32) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"defaultFixed32", [NSNumber numberWithInt:self.defaultFixed32]];
-  }
-  if (self.hasDefaultFixed64) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"defaultFixed64", [NSNumber numberWithLongLong:self.defaultFixed64]];
-  }
-  if (self.hasDefaultSfixed32) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"defaultSfixed32", [NSNumber numberWithInt:self.defaultSfixed32]];
-  }
-  if (self.hasDefaultSfixed64) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"defaultSfixed64", [NSNumber numberWithLongLong:self.defaultSfixed64]];
-  }
-  if (self.hasDefaultFloat) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"defaultFloat", [NSNumber numberWithFloat:self.defaultFloat]];
-  }
-  if (self.hasDefaultDouble) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"defaultDouble", [NSNumber numberWithDouble:self.defaultDouble]];
-  }
-  if (self.hasDefaultBool) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"defaultBool", [NSNumber numberWithBool:self.defaultBool]];
-  }
-  if (self.hasDefaultString) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"defaultString", self.defaultString];
-  }
-  if (self.hasDefaultBytes) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"defaultBytes", self.defaultBytes];
-  }
-  if (self.hasDefaultNestedEnum) {
-    [output appendFormat:@"%@%@: %d\n", indent, @"defaultNestedEnum", self.defaultNestedEnum];
-  }
-  if (self.hasDefaultForeignEnum) {
-    [output appendFormat:@"%@%@: %d\n", indent, @"defaultForeignEnum", self.defaultForeignEnum];
-  }
-  if (self.hasDefaultImportEnum) {
-    [output appendFormat:@"%@%@: %d\n", indent, @"defaultImportEnum", self.defaultImportEnum];
-  }
-  if (self.hasDefaultStringPiece) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"defaultStringPiece", self.defaultStringPiece];
-  }
-  if (self.hasDefaultCord) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"defaultCord", self.defaultCord];
-  }
-  [self.unknownFields writeDescriptionTo:output withIndent:indent];
-}
 - (BOOL) isEqual:(id)other {
   if (other == self) {
     return YES;
@@ -2760,465 +2855,369 @@ static TestAllTypesLite* defaultTestAllTypesLiteInstance = nil;
   }
   TestAllTypesLite *otherMessage = other;
   return
-      self.hasOptionalInt32 == otherMessage.hasOptionalInt32 &&
-      (!self.hasOptionalInt32 || self.optionalInt32 == otherMessage.optionalInt32) &&
-      
-      self.hasOptionalInt64 == otherMessage.hasOptionalInt64 &&
-      (!self.hasOptionalInt64 || self.optionalInt64 == otherMessage.optionalInt64) &&
-      
-      self.hasOptionalUint32 == otherMessage.hasOptionalUint32 &&
-      (!self.hasOptionalUint32 || self.optionalUint32 == otherMessage.optionalUint32) &&
-      
-      self.hasOptionalUint64 == otherMessage.hasOptionalUint64 &&
-      (!self.hasOptionalUint64 || self.optionalUint64 == otherMessage.optionalUint64) &&
-      
-      self.hasOptionalSint32 == otherMessage.hasOptionalSint32 &&
-      (!self.hasOptionalSint32 || self.optionalSint32 == otherMessage.optionalSint32) &&
-      
-      self.hasOptionalSint64 == otherMessage.hasOptionalSint64 &&
-      (!self.hasOptionalSint64 || self.optionalSint64 == otherMessage.optionalSint64) &&
-      
-      self.hasOptionalFixed32 == otherMessage.hasOptionalFixed32 &&
-      (!self.hasOptionalFixed32 || self.optionalFixed32 == otherMessage.optionalFixed32) &&
-      
-      self.hasOptionalFixed64 == otherMessage.hasOptionalFixed64 &&
-      (!self.hasOptionalFixed64 || self.optionalFixed64 == otherMessage.optionalFixed64) &&
-      
-      self.hasOptionalSfixed32 == otherMessage.hasOptionalSfixed32 &&
-      (!self.hasOptionalSfixed32 || self.optionalSfixed32 == otherMessage.optionalSfixed32) &&
-      
-      self.hasOptionalSfixed64 == otherMessage.hasOptionalSfixed64 &&
-      (!self.hasOptionalSfixed64 || self.optionalSfixed64 == otherMessage.optionalSfixed64) &&
-      
-      self.hasOptionalFloat == otherMessage.hasOptionalFloat &&
-      (!self.hasOptionalFloat || self.optionalFloat == otherMessage.optionalFloat) &&
-      
-      self.hasOptionalDouble == otherMessage.hasOptionalDouble &&
-      (!self.hasOptionalDouble || self.optionalDouble == otherMessage.optionalDouble) &&
-      
-      self.hasOptionalBool == otherMessage.hasOptionalBool &&
-      (!self.hasOptionalBool || self.optionalBool == otherMessage.optionalBool) &&
-      
-      self.hasOptionalString == otherMessage.hasOptionalString &&
-      (!self.hasOptionalString || [self.optionalString isEqual:otherMessage.optionalString]) &&
-      
-      self.hasOptionalBytes == otherMessage.hasOptionalBytes &&
-      (!self.hasOptionalBytes || [self.optionalBytes isEqual:otherMessage.optionalBytes]) &&
-      
-      self.hasOptionalGroup == otherMessage.hasOptionalGroup &&
-      (!self.hasOptionalGroup || [self.optionalGroup isEqual:otherMessage.optionalGroup]) &&
-      
-      self.hasOptionalNestedMessage == otherMessage.hasOptionalNestedMessage &&
-      (!self.hasOptionalNestedMessage || [self.optionalNestedMessage isEqual:otherMessage.optionalNestedMessage]) &&
-      
-      self.hasOptionalForeignMessage == otherMessage.hasOptionalForeignMessage &&
-      (!self.hasOptionalForeignMessage || [self.optionalForeignMessage isEqual:otherMessage.optionalForeignMessage]) &&
-      
-      self.hasOptionalImportMessage == otherMessage.hasOptionalImportMessage &&
-      (!self.hasOptionalImportMessage || [self.optionalImportMessage isEqual:otherMessage.optionalImportMessage]) &&
-      
-      self.hasOptionalNestedEnum == otherMessage.hasOptionalNestedEnum &&
-      (!self.hasOptionalNestedEnum || self.optionalNestedEnum != otherMessage.optionalNestedEnum) &&
-      
-      self.hasOptionalForeignEnum == otherMessage.hasOptionalForeignEnum &&
-      (!self.hasOptionalForeignEnum || self.optionalForeignEnum != otherMessage.optionalForeignEnum) &&
-      
-      self.hasOptionalImportEnum == otherMessage.hasOptionalImportEnum &&
-      (!self.hasOptionalImportEnum || self.optionalImportEnum != otherMessage.optionalImportEnum) &&
-      
-      self.hasOptionalStringPiece == otherMessage.hasOptionalStringPiece &&
-      (!self.hasOptionalStringPiece || [self.optionalStringPiece isEqual:otherMessage.optionalStringPiece]) &&
-      
-      self.hasOptionalCord == otherMessage.hasOptionalCord &&
-      (!self.hasOptionalCord || [self.optionalCord isEqual:otherMessage.optionalCord]) &&
-      
-      [self.repeatedInt32Array isEqualToArray:otherMessage.repeatedInt32Array] &&
-      
-      [self.repeatedInt64Array isEqualToArray:otherMessage.repeatedInt64Array] &&
-      
-      [self.repeatedUint32Array isEqualToArray:otherMessage.repeatedUint32Array] &&
-      
-      [self.repeatedUint64Array isEqualToArray:otherMessage.repeatedUint64Array] &&
-      
-      [self.repeatedSint32Array isEqualToArray:otherMessage.repeatedSint32Array] &&
-      
-      [self.repeatedSint64Array isEqualToArray:otherMessage.repeatedSint64Array] &&
-      
-      [self.repeatedFixed32Array isEqualToArray:otherMessage.repeatedFixed32Array] &&
-      
-      [self.repeatedFixed64Array isEqualToArray:otherMessage.repeatedFixed64Array] &&
-      
-      [self.repeatedSfixed32Array isEqualToArray:otherMessage.repeatedSfixed32Array] &&
-      
-      [self.repeatedSfixed64Array isEqualToArray:otherMessage.repeatedSfixed64Array] &&
-      
-      [self.repeatedFloatArray isEqualToArray:otherMessage.repeatedFloatArray] &&
-      
-      [self.repeatedDoubleArray isEqualToArray:otherMessage.repeatedDoubleArray] &&
-      
-      [self.repeatedBoolArray isEqualToArray:otherMessage.repeatedBoolArray] &&
-      
-      [self.repeatedStringArray isEqualToArray:otherMessage.repeatedStringArray] &&
-      
-      [self.repeatedBytesArray isEqualToArray:otherMessage.repeatedBytesArray] &&
-      
-      [self.repeatedGroupArray isEqualToArray:otherMessage.repeatedGroupArray] &&
-      
-      [self.repeatedNestedMessageArray isEqualToArray:otherMessage.repeatedNestedMessageArray] &&
-      
-      [self.repeatedForeignMessageArray isEqualToArray:otherMessage.repeatedForeignMessageArray] &&
-      
-      [self.repeatedImportMessageArray isEqualToArray:otherMessage.repeatedImportMessageArray] &&
-      
-      [self.repeatedNestedEnumArray isEqualToArray:otherMessage.repeatedNestedEnumArray] &&
-      
-      [self.repeatedForeignEnumArray isEqualToArray:otherMessage.repeatedForeignEnumArray] &&
-      
-      [self.repeatedImportEnumArray isEqualToArray:otherMessage.repeatedImportEnumArray] &&
-      
-      [self.repeatedStringPieceArray isEqualToArray:otherMessage.repeatedStringPieceArray] &&
-      
-      [self.repeatedCordArray isEqualToArray:otherMessage.repeatedCordArray] &&
-      
-      self.hasDefaultInt32 == otherMessage.hasDefaultInt32 &&
-      (!self.hasDefaultInt32 || self.defaultInt32 == otherMessage.defaultInt32) &&
-      
-      self.hasDefaultInt64 == otherMessage.hasDefaultInt64 &&
-      (!self.hasDefaultInt64 || self.defaultInt64 == otherMessage.defaultInt64) &&
-      
-      self.hasDefaultUint32 == otherMessage.hasDefaultUint32 &&
-      (!self.hasDefaultUint32 || self.defaultUint32 == otherMessage.defaultUint32) &&
-      
-      self.hasDefaultUint64 == otherMessage.hasDefaultUint64 &&
-      (!self.hasDefaultUint64 || self.defaultUint64 == otherMessage.defaultUint64) &&
-      
-      self.hasDefaultSint32 == otherMessage.hasDefaultSint32 &&
-      (!self.hasDefaultSint32 || self.defaultSint32 == otherMessage.defaultSint32) &&
-      
-      self.hasDefaultSint64 == otherMessage.hasDefaultSint64 &&
-      (!self.hasDefaultSint64 || self.defaultSint64 == otherMessage.defaultSint64) &&
-      
-      self.hasDefaultFixed32 == otherMessage.hasDefaultFixed32 &&
-      (!self.hasDefaultFixed32 || self.defaultFixed32 == otherMessage.defaultFixed32) &&
-      
-      self.hasDefaultFixed64 == otherMessage.hasDefaultFixed64 &&
-      (!self.hasDefaultFixed64 || self.defaultFixed64 == otherMessage.defaultFixed64) &&
-      
-      self.hasDefaultSfixed32 == otherMessage.hasDefaultSfixed32 &&
-      (!self.hasDefaultSfixed32 || self.defaultSfixed32 == otherMessage.defaultSfixed32) &&
-      
-      self.hasDefaultSfixed64 == otherMessage.hasDefaultSfixed64 &&
-      (!self.hasDefaultSfixed64 || self.defaultSfixed64 == otherMessage.defaultSfixed64) &&
-      
-      self.hasDefaultFloat == otherMessage.hasDefaultFloat &&
-      (!self.hasDefaultFloat || self.defaultFloat == otherMessage.defaultFloat) &&
-      
-      self.hasDefaultDouble == otherMessage.hasDefaultDouble &&
-      (!self.hasDefaultDouble || self.defaultDouble == otherMessage.defaultDouble) &&
-      
-      self.hasDefaultBool == otherMessage.hasDefaultBool &&
-      (!self.hasDefaultBool || self.defaultBool == otherMessage.defaultBool) &&
-      
-      self.hasDefaultString == otherMessage.hasDefaultString &&
-      (!self.hasDefaultString || [self.defaultString isEqual:otherMessage.defaultString]) &&
-      
-      self.hasDefaultBytes == otherMessage.hasDefaultBytes &&
-      (!self.hasDefaultBytes || [self.defaultBytes isEqual:otherMessage.defaultBytes]) &&
-      
-      self.hasDefaultNestedEnum == otherMessage.hasDefaultNestedEnum &&
-      (!self.hasDefaultNestedEnum || self.defaultNestedEnum != otherMessage.defaultNestedEnum) &&
-      
-      self.hasDefaultForeignEnum == otherMessage.hasDefaultForeignEnum &&
-      (!self.hasDefaultForeignEnum || self.defaultForeignEnum != otherMessage.defaultForeignEnum) &&
-      
-      self.hasDefaultImportEnum == otherMessage.hasDefaultImportEnum &&
-      (!self.hasDefaultImportEnum || self.defaultImportEnum != otherMessage.defaultImportEnum) &&
-      
-      self.hasDefaultStringPiece == otherMessage.hasDefaultStringPiece &&
-      (!self.hasDefaultStringPiece || [self.defaultStringPiece isEqual:otherMessage.defaultStringPiece]) &&
-      
-      self.hasDefaultCord == otherMessage.hasDefaultCord &&
-      (!self.hasDefaultCord || [self.defaultCord isEqual:otherMessage.defaultCord]) &&
-      
-      (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
+      (hasBits_[0] & 0x1u) == (otherMessage->hasBits_[0] & 0x1u) &&
+      (!(hasBits_[0] & 0x1u) || optionalInt32 == otherMessage->optionalInt32) &&
+      (hasBits_[0] & 0x2u) == (otherMessage->hasBits_[0] & 0x2u) &&
+      (!(hasBits_[0] & 0x2u) || optionalInt64 == otherMessage->optionalInt64) &&
+      (hasBits_[0] & 0x4u) == (otherMessage->hasBits_[0] & 0x4u) &&
+      (!(hasBits_[0] & 0x4u) || optionalUint32 == otherMessage->optionalUint32) &&
+      (hasBits_[0] & 0x8u) == (otherMessage->hasBits_[0] & 0x8u) &&
+      (!(hasBits_[0] & 0x8u) || optionalUint64 == otherMessage->optionalUint64) &&
+      (hasBits_[0] & 0x10u) == (otherMessage->hasBits_[0] & 0x10u) &&
+      (!(hasBits_[0] & 0x10u) || optionalSint32 == otherMessage->optionalSint32) &&
+      (hasBits_[0] & 0x20u) == (otherMessage->hasBits_[0] & 0x20u) &&
+      (!(hasBits_[0] & 0x20u) || optionalSint64 == otherMessage->optionalSint64) &&
+      (hasBits_[0] & 0x40u) == (otherMessage->hasBits_[0] & 0x40u) &&
+      (!(hasBits_[0] & 0x40u) || optionalFixed32 == otherMessage->optionalFixed32) &&
+      (hasBits_[0] & 0x80u) == (otherMessage->hasBits_[0] & 0x80u) &&
+      (!(hasBits_[0] & 0x80u) || optionalFixed64 == otherMessage->optionalFixed64) &&
+      (hasBits_[0] & 0x100u) == (otherMessage->hasBits_[0] & 0x100u) &&
+      (!(hasBits_[0] & 0x100u) || optionalSfixed32 == otherMessage->optionalSfixed32) &&
+      (hasBits_[0] & 0x200u) == (otherMessage->hasBits_[0] & 0x200u) &&
+      (!(hasBits_[0] & 0x200u) || optionalSfixed64 == otherMessage->optionalSfixed64) &&
+      (hasBits_[0] & 0x400u) == (otherMessage->hasBits_[0] & 0x400u) &&
+      (!(hasBits_[0] & 0x400u) || optionalFloat == otherMessage->optionalFloat) &&
+      (hasBits_[0] & 0x800u) == (otherMessage->hasBits_[0] & 0x800u) &&
+      (!(hasBits_[0] & 0x800u) || optionalDouble == otherMessage->optionalDouble) &&
+      (hasBits_[0] & 0x1000u) == (otherMessage->hasBits_[0] & 0x1000u) &&
+      (!(hasBits_[0] & 0x1000u) || !!optionalBool_ == !!otherMessage->optionalBool_) &&
+      (hasBits_[0] & 0x2000u) == (otherMessage->hasBits_[0] & 0x2000u) &&
+      (!(hasBits_[0] & 0x2000u) || [optionalString isEqual:otherMessage->optionalString]) &&
+      (hasBits_[0] & 0x4000u) == (otherMessage->hasBits_[0] & 0x4000u) &&
+      (!(hasBits_[0] & 0x4000u) || [optionalBytes isEqual:otherMessage->optionalBytes]) &&
+      (hasBits_[0] & 0x8000u) == (otherMessage->hasBits_[0] & 0x8000u) &&
+      (!(hasBits_[0] & 0x8000u) || [optionalGroup isEqual:otherMessage->optionalGroup]) &&
+      (hasBits_[0] & 0x10000u) == (otherMessage->hasBits_[0] & 0x10000u) &&
+      (!(hasBits_[0] & 0x10000u) || [optionalNestedMessage isEqual:otherMessage->optionalNestedMessage]) &&
+      (hasBits_[0] & 0x20000u) == (otherMessage->hasBits_[0] & 0x20000u) &&
+      (!(hasBits_[0] & 0x20000u) || [optionalForeignMessage isEqual:otherMessage->optionalForeignMessage]) &&
+      (hasBits_[0] & 0x40000u) == (otherMessage->hasBits_[0] & 0x40000u) &&
+      (!(hasBits_[0] & 0x40000u) || [optionalImportMessage isEqual:otherMessage->optionalImportMessage]) &&
+      (hasBits_[0] & 0x80000u) == (otherMessage->hasBits_[0] & 0x80000u) &&
+      (!(hasBits_[0] & 0x80000u) || optionalNestedEnum == otherMessage->optionalNestedEnum) &&
+      (hasBits_[0] & 0x100000u) == (otherMessage->hasBits_[0] & 0x100000u) &&
+      (!(hasBits_[0] & 0x100000u) || optionalForeignEnum == otherMessage->optionalForeignEnum) &&
+      (hasBits_[0] & 0x200000u) == (otherMessage->hasBits_[0] & 0x200000u) &&
+      (!(hasBits_[0] & 0x200000u) || optionalImportEnum == otherMessage->optionalImportEnum) &&
+      (hasBits_[0] & 0x400000u) == (otherMessage->hasBits_[0] & 0x400000u) &&
+      (!(hasBits_[0] & 0x400000u) || [optionalStringPiece isEqual:otherMessage->optionalStringPiece]) &&
+      (hasBits_[0] & 0x800000u) == (otherMessage->hasBits_[0] & 0x800000u) &&
+      (!(hasBits_[0] & 0x800000u) || [optionalCord isEqual:otherMessage->optionalCord]) &&
+      (repeatedInt32Array.count == 0 ? otherMessage->repeatedInt32Array.count == 0 : [repeatedInt32Array isEqualToArray:otherMessage->repeatedInt32Array]) &&
+      (repeatedInt64Array.count == 0 ? otherMessage->repeatedInt64Array.count == 0 : [repeatedInt64Array isEqualToArray:otherMessage->repeatedInt64Array]) &&
+      (repeatedUint32Array.count == 0 ? otherMessage->repeatedUint32Array.count == 0 : [repeatedUint32Array isEqualToArray:otherMessage->repeatedUint32Array]) &&
+      (repeatedUint64Array.count == 0 ? otherMessage->repeatedUint64Array.count == 0 : [repeatedUint64Array isEqualToArray:otherMessage->repeatedUint64Array]) &&
+      (repeatedSint32Array.count == 0 ? otherMessage->repeatedSint32Array.count == 0 : [repeatedSint32Array isEqualToArray:otherMessage->repeatedSint32Array]) &&
+      (repeatedSint64Array.count == 0 ? otherMessage->repeatedSint64Array.count == 0 : [repeatedSint64Array isEqualToArray:otherMessage->repeatedSint64Array]) &&
+      (repeatedFixed32Array.count == 0 ? otherMessage->repeatedFixed32Array.count == 0 : [repeatedFixed32Array isEqualToArray:otherMessage->repeatedFixed32Array]) &&
+      (repeatedFixed64Array.count == 0 ? otherMessage->repeatedFixed64Array.count == 0 : [repeatedFixed64Array isEqualToArray:otherMessage->repeatedFixed64Array]) &&
+      (repeatedSfixed32Array.count == 0 ? otherMessage->repeatedSfixed32Array.count == 0 : [repeatedSfixed32Array isEqualToArray:otherMessage->repeatedSfixed32Array]) &&
+      (repeatedSfixed64Array.count == 0 ? otherMessage->repeatedSfixed64Array.count == 0 : [repeatedSfixed64Array isEqualToArray:otherMessage->repeatedSfixed64Array]) &&
+      (repeatedFloatArray.count == 0 ? otherMessage->repeatedFloatArray.count == 0 : [repeatedFloatArray isEqualToArray:otherMessage->repeatedFloatArray]) &&
+      (repeatedDoubleArray.count == 0 ? otherMessage->repeatedDoubleArray.count == 0 : [repeatedDoubleArray isEqualToArray:otherMessage->repeatedDoubleArray]) &&
+      (repeatedBoolArray.count == 0 ? otherMessage->repeatedBoolArray.count == 0 : [repeatedBoolArray isEqualToArray:otherMessage->repeatedBoolArray]) &&
+      (repeatedStringArray.count == 0 ? otherMessage->repeatedStringArray.count == 0 : [repeatedStringArray isEqualToArray:otherMessage->repeatedStringArray]) &&
+      (repeatedBytesArray.count == 0 ? otherMessage->repeatedBytesArray.count == 0 : [repeatedBytesArray isEqualToArray:otherMessage->repeatedBytesArray]) &&
+      (repeatedGroupArray.count == 0 ? otherMessage->repeatedGroupArray.count == 0 : [repeatedGroupArray isEqualToArray:otherMessage->repeatedGroupArray]) &&
+      (repeatedNestedMessageArray.count == 0 ? otherMessage->repeatedNestedMessageArray.count == 0 : [repeatedNestedMessageArray isEqualToArray:otherMessage->repeatedNestedMessageArray]) &&
+      (repeatedForeignMessageArray.count == 0 ? otherMessage->repeatedForeignMessageArray.count == 0 : [repeatedForeignMessageArray isEqualToArray:otherMessage->repeatedForeignMessageArray]) &&
+      (repeatedImportMessageArray.count == 0 ? otherMessage->repeatedImportMessageArray.count == 0 : [repeatedImportMessageArray isEqualToArray:otherMessage->repeatedImportMessageArray]) &&
+      (repeatedNestedEnumArray.count == 0 ? otherMessage->repeatedNestedEnumArray.count == 0 : [repeatedNestedEnumArray isEqualToArray:otherMessage->repeatedNestedEnumArray]) &&
+      (repeatedForeignEnumArray.count == 0 ? otherMessage->repeatedForeignEnumArray.count == 0 : [repeatedForeignEnumArray isEqualToArray:otherMessage->repeatedForeignEnumArray]) &&
+      (repeatedImportEnumArray.count == 0 ? otherMessage->repeatedImportEnumArray.count == 0 : [repeatedImportEnumArray isEqualToArray:otherMessage->repeatedImportEnumArray]) &&
+      (repeatedStringPieceArray.count == 0 ? otherMessage->repeatedStringPieceArray.count == 0 : [repeatedStringPieceArray isEqualToArray:otherMessage->repeatedStringPieceArray]) &&
+      (repeatedCordArray.count == 0 ? otherMessage->repeatedCordArray.count == 0 : [repeatedCordArray isEqualToArray:otherMessage->repeatedCordArray]) &&
+      (hasBits_[0] & 0x1000000u) == (otherMessage->hasBits_[0] & 0x1000000u) &&
+      (!(hasBits_[0] & 0x1000000u) || defaultInt32 == otherMessage->defaultInt32) &&
+      (hasBits_[0] & 0x2000000u) == (otherMessage->hasBits_[0] & 0x2000000u) &&
+      (!(hasBits_[0] & 0x2000000u) || defaultInt64 == otherMessage->defaultInt64) &&
+      (hasBits_[0] & 0x4000000u) == (otherMessage->hasBits_[0] & 0x4000000u) &&
+      (!(hasBits_[0] & 0x4000000u) || defaultUint32 == otherMessage->defaultUint32) &&
+      (hasBits_[0] & 0x8000000u) == (otherMessage->hasBits_[0] & 0x8000000u) &&
+      (!(hasBits_[0] & 0x8000000u) || defaultUint64 == otherMessage->defaultUint64) &&
+      (hasBits_[0] & 0x10000000u) == (otherMessage->hasBits_[0] & 0x10000000u) &&
+      (!(hasBits_[0] & 0x10000000u) || defaultSint32 == otherMessage->defaultSint32) &&
+      (hasBits_[0] & 0x20000000u) == (otherMessage->hasBits_[0] & 0x20000000u) &&
+      (!(hasBits_[0] & 0x20000000u) || defaultSint64 == otherMessage->defaultSint64) &&
+      (hasBits_[0] & 0x40000000u) == (otherMessage->hasBits_[0] & 0x40000000u) &&
+      (!(hasBits_[0] & 0x40000000u) || defaultFixed32 == otherMessage->defaultFixed32) &&
+      (hasBits_[0] & 0x80000000u) == (otherMessage->hasBits_[0] & 0x80000000u) &&
+      (!(hasBits_[0] & 0x80000000u) || defaultFixed64 == otherMessage->defaultFixed64) &&
+      (hasBits_[1] & 0x1u) == (otherMessage->hasBits_[1] & 0x1u) &&
+      (!(hasBits_[1] & 0x1u) || defaultSfixed32 == otherMessage->defaultSfixed32) &&
+      (hasBits_[1] & 0x2u) == (otherMessage->hasBits_[1] & 0x2u) &&
+      (!(hasBits_[1] & 0x2u) || defaultSfixed64 == otherMessage->defaultSfixed64) &&
+      (hasBits_[1] & 0x4u) == (otherMessage->hasBits_[1] & 0x4u) &&
+      (!(hasBits_[1] & 0x4u) || defaultFloat == otherMessage->defaultFloat) &&
+      (hasBits_[1] & 0x8u) == (otherMessage->hasBits_[1] & 0x8u) &&
+      (!(hasBits_[1] & 0x8u) || defaultDouble == otherMessage->defaultDouble) &&
+      (hasBits_[1] & 0x10u) == (otherMessage->hasBits_[1] & 0x10u) &&
+      (!(hasBits_[1] & 0x10u) || !!defaultBool_ == !!otherMessage->defaultBool_) &&
+      (hasBits_[1] & 0x20u) == (otherMessage->hasBits_[1] & 0x20u) &&
+      (!(hasBits_[1] & 0x20u) || [defaultString isEqual:otherMessage->defaultString]) &&
+      (hasBits_[1] & 0x40u) == (otherMessage->hasBits_[1] & 0x40u) &&
+      (!(hasBits_[1] & 0x40u) || [defaultBytes isEqual:otherMessage->defaultBytes]) &&
+      (hasBits_[1] & 0x80u) == (otherMessage->hasBits_[1] & 0x80u) &&
+      (!(hasBits_[1] & 0x80u) || defaultNestedEnum == otherMessage->defaultNestedEnum) &&
+      (hasBits_[1] & 0x100u) == (otherMessage->hasBits_[1] & 0x100u) &&
+      (!(hasBits_[1] & 0x100u) || defaultForeignEnum == otherMessage->defaultForeignEnum) &&
+      (hasBits_[1] & 0x200u) == (otherMessage->hasBits_[1] & 0x200u) &&
+      (!(hasBits_[1] & 0x200u) || defaultImportEnum == otherMessage->defaultImportEnum) &&
+      (hasBits_[1] & 0x400u) == (otherMessage->hasBits_[1] & 0x400u) &&
+      (!(hasBits_[1] & 0x400u) || [defaultStringPiece isEqual:otherMessage->defaultStringPiece]) &&
+      (hasBits_[1] & 0x800u) == (otherMessage->hasBits_[1] & 0x800u) &&
+      (!(hasBits_[1] & 0x800u) || [defaultCord isEqual:otherMessage->defaultCord]) &&
+      YES;
 }
 - (NSUInteger) hash {
-  NSUInteger hashCode = 7;
-  if (self.hasOptionalInt32) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithInt:self.optionalInt32] hash];
-  }
-  if (self.hasOptionalInt64) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithLongLong:self.optionalInt64] hash];
+  NSUInteger hash_ = PBGeneratedMessageGetMemoizedHash(&memoizedHash);
+  if (hash_ != 0) {
+    return hash_;
   }
-  if (self.hasOptionalUint32) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithInt:self.optionalUint32] hash];
-  }
-  if (self.hasOptionalUint64) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithLongLong:self.optionalUint64] hash];
-  }
-  if (self.hasOptionalSint32) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithInt:self.optionalSint32] hash];
-  }
-  if (self.hasOptionalSint64) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithLongLong:self.optionalSint64] hash];
-  }
-  if (self.hasOptionalFixed32) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithInt:self.optionalFixed32] hash];
+
+  uint64_t hashCode = 7;
+  if (hasBits_[0] & 0x1u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, (uint64_t)optionalInt32);
   }
-  if (self.hasOptionalFixed64) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithLongLong:self.optionalFixed64] hash];
+  if (hasBits_[0] & 0x2u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, (uint64_t)optionalInt64);
   }
-  if (self.hasOptionalSfixed32) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithInt:self.optionalSfixed32] hash];
+  if (hasBits_[0] & 0x4u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, (uint64_t)optionalUint32);
   }
-  if (self.hasOptionalSfixed64) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithLongLong:self.optionalSfixed64] hash];
+  if (hasBits_[0] & 0x8u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, (uint64_t)optionalUint64);
   }
-  if (self.hasOptionalFloat) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithFloat:self.optionalFloat] hash];
+  if (hasBits_[0] & 0x10u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, (uint64_t)optionalSint32);
   }
-  if (self.hasOptionalDouble) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithDouble:self.optionalDouble] hash];
+  if (hasBits_[0] & 0x20u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, (uint64_t)optionalSint64);
   }
-  if (self.hasOptionalBool) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithBool:self.optionalBool] hash];
+  if (hasBits_[0] & 0x40u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, (uint64_t)optionalFixed32);
   }
-  if (self.hasOptionalString) {
-    hashCode = hashCode * 31 + [self.optionalString hash];
+  if (hasBits_[0] & 0x80u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, (uint64_t)optionalFixed64);
   }
-  if (self.hasOptionalBytes) {
-    hashCode = hashCode * 31 + [self.optionalBytes hash];
+  if (hasBits_[0] & 0x100u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, (uint64_t)optionalSfixed32);
   }
-  if (self.hasOptionalGroup) {
-    hashCode = hashCode * 31 + [self.optionalGroup hash];
+  if (hasBits_[0] & 0x200u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, (uint64_t)optionalSfixed64);
   }
-  if (self.hasOptionalNestedMessage) {
-    hashCode = hashCode * 31 + [self.optionalNestedMessage hash];
+  if (hasBits_[0] & 0x400u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, PBGeneratedMessageHashFloat(optionalFloat));
   }
-  if (self.hasOptionalForeignMessage) {
-    hashCode = hashCode * 31 + [self.optionalForeignMessage hash];
+  if (hasBits_[0] & 0x800u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, PBGeneratedMessageHashDouble(optionalDouble));
   }
-  if (self.hasOptionalImportMessage) {
-    hashCode = hashCode * 31 + [self.optionalImportMessage hash];
+  if (hasBits_[0] & 0x1000u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, (uint64_t)!!optionalBool_);
   }
-  if (self.hasOptionalNestedEnum) {
-    hashCode = hashCode * 31 + self.optionalNestedEnum;
+  if (hasBits_[0] & 0x2000u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [optionalString hash]);
   }
-  if (self.hasOptionalForeignEnum) {
-    hashCode = hashCode * 31 + self.optionalForeignEnum;
+  if (hasBits_[0] & 0x4000u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [optionalBytes hash]);
   }
-  if (self.hasOptionalImportEnum) {
-    hashCode = hashCode * 31 + self.optionalImportEnum;
+  if (hasBits_[0] & 0x8000u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [optionalGroup hash]);
   }
-  if (self.hasOptionalStringPiece) {
-    hashCode = hashCode * 31 + [self.optionalStringPiece hash];
+  if (hasBits_[0] & 0x10000u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [optionalNestedMessage hash]);
   }
-  if (self.hasOptionalCord) {
-    hashCode = hashCode * 31 + [self.optionalCord hash];
+  if (hasBits_[0] & 0x20000u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [optionalForeignMessage hash]);
   }
-  for (NSNumber* value in self.repeatedInt32Array) {
-    hashCode = hashCode * 31 + [value intValue];
+  if (hasBits_[0] & 0x40000u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [optionalImportMessage hash]);
   }
-  for (NSNumber* value in self.repeatedInt64Array) {
-    hashCode = hashCode * 31 + [value intValue];
+  if (hasBits_[0] & 0x80000u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, (uint64_t)optionalNestedEnum);
   }
-  for (NSNumber* value in self.repeatedUint32Array) {
-    hashCode = hashCode * 31 + [value intValue];
+  if (hasBits_[0] & 0x100000u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, (uint64_t)optionalForeignEnum);
   }
-  for (NSNumber* value in self.repeatedUint64Array) {
-    hashCode = hashCode * 31 + [value intValue];
+  if (hasBits_[0] & 0x200000u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, (uint64_t)optionalImportEnum);
   }
-  for (NSNumber* value in self.repeatedSint32Array) {
-    hashCode = hashCode * 31 + [value intValue];
+  if (hasBits_[0] & 0x400000u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [optionalStringPiece hash]);
   }
-  for (NSNumber* value in self.repeatedSint64Array) {
-    hashCode = hashCode * 31 + [value intValue];
+  if (hasBits_[0] & 0x800000u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [optionalCord hash]);
   }
-  for (NSNumber* value in self.repeatedFixed32Array) {
-    hashCode = hashCode * 31 + [value intValue];
+  hashCode = PBGeneratedMessageHashMix(hashCode, [repeatedInt32Array hash64]);
+  hashCode = PBGeneratedMessageHashMix(hashCode, [repeatedInt64Array hash64]);
+  hashCode = PBGeneratedMessageHashMix(hashCode, [repeatedUint32Array hash64]);
+  hashCode = PBGeneratedMessageHashMix(hashCode, [repeatedUint64Array hash64]);
+  hashCode = PBGeneratedMessageHashMix(hashCode, [repeatedSint32Array hash64]);
+  hashCode = PBGeneratedMessageHashMix(hashCode, [repeatedSint64Array hash64]);
+  hashCode = PBGeneratedMessageHashMix(hashCode, [repeatedFixed32Array hash64]);
+  hashCode = PBGeneratedMessageHashMix(hashCode, [repeatedFixed64Array hash64]);
+  hashCode = PBGeneratedMessageHashMix(hashCode, [repeatedSfixed32Array hash64]);
+  hashCode = PBGeneratedMessageHashMix(hashCode, [repeatedSfixed64Array hash64]);
+  hashCode = PBGeneratedMessageHashMix(hashCode, [repeatedFloatArray hash64]);
+  hashCode = PBGeneratedMessageHashMix(hashCode, [repeatedDoubleArray hash64]);
+  hashCode = PBGeneratedMessageHashMix(hashCode, [repeatedBoolArray hash64]);
+  hashCode = PBGeneratedMessageHashMix(hashCode, [repeatedStringArray hash64]);
+  hashCode = PBGeneratedMessageHashMix(hashCode, [repeatedBytesArray hash64]);
+  for (TestAllTypesLite_RepeatedGroup* element in repeatedGroupArray) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [element hash]);
   }
-  for (NSNumber* value in self.repeatedFixed64Array) {
-    hashCode = hashCode * 31 + [value intValue];
+  for (TestAllTypesLite_NestedMessage* element in repeatedNestedMessageArray) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [element hash]);
   }
-  for (NSNumber* value in self.repeatedSfixed32Array) {
-    hashCode = hashCode * 31 + [value intValue];
+  for (ForeignMessageLite* element in repeatedForeignMessageArray) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [element hash]);
   }
-  for (NSNumber* value in self.repeatedSfixed64Array) {
-    hashCode = hashCode * 31 + [value intValue];
+  for (ImportMessageLite* element in repeatedImportMessageArray) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [element hash]);
   }
-  for (NSNumber* value in self.repeatedFloatArray) {
-    hashCode = hashCode * 31 + [value intValue];
+  hashCode = PBGeneratedMessageHashMix(hashCode, [repeatedNestedEnumArray hash64]);
+  hashCode = PBGeneratedMessageHashMix(hashCode, [repeatedForeignEnumArray hash64]);
+  hashCode = PBGeneratedMessageHashMix(hashCode, [repeatedImportEnumArray hash64]);
+  hashCode = PBGeneratedMessageHashMix(hashCode, [repeatedStringPieceArray hash64]);
+  hashCode = PBGeneratedMessageHashMix(hashCode, [repeatedCordArray hash64]);
+  if (hasBits_[0] & 0x1000000u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, (uint64_t)defaultInt32);
   }
-  for (NSNumber* value in self.repeatedDoubleArray) {
-    hashCode = hashCode * 31 + [value intValue];
+  if (hasBits_[0] & 0x2000000u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, (uint64_t)defaultInt64);
   }
-  for (NSNumber* value in self.repeatedBoolArray) {
-    hashCode = hashCode * 31 + [value intValue];
+  if (hasBits_[0] & 0x4000000u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, (uint64_t)defaultUint32);
   }
-  for (NSString* element in self.repeatedStringArray) {
-    hashCode = hashCode * 31 + [element hash];
+  if (hasBits_[0] & 0x8000000u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, (uint64_t)defaultUint64);
   }
-  for (NSData* element in self.repeatedBytesArray) {
-    hashCode = hashCode * 31 + [element hash];
+  if (hasBits_[0] & 0x10000000u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, (uint64_t)defaultSint32);
   }
-  for (TestAllTypesLite_RepeatedGroup* element in self.repeatedGroupArray) {
-    hashCode = hashCode * 31 + [element hash];
+  if (hasBits_[0] & 0x20000000u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, (uint64_t)defaultSint64);
   }
-  for (TestAllTypesLite_NestedMessage* element in self.repeatedNestedMessageArray) {
-    hashCode = hashCode * 31 + [element hash];
+  if (hasBits_[0] & 0x40000000u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, (uint64_t)defaultFixed32);
   }
-  for (ForeignMessageLite* element in self.repeatedForeignMessageArray) {
-    hashCode = hashCode * 31 + [element hash];
+  if (hasBits_[0] & 0x80000000u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, (uint64_t)defaultFixed64);
   }
-  for (ImportMessageLite* element in self.repeatedImportMessageArray) {
-    hashCode = hashCode * 31 + [element hash];
+  if (hasBits_[1] & 0x1u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, (uint64_t)defaultSfixed32);
   }
-  for (NSNumber* element in self.repeatedNestedEnumArray) {
-    hashCode = hashCode * 31 + element.intValue;
+  if (hasBits_[1] & 0x2u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, (uint64_t)defaultSfixed64);
   }
-  for (NSNumber* element in self.repeatedForeignEnumArray) {
-    hashCode = hashCode * 31 + element.intValue;
+  if (hasBits_[1] & 0x4u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, PBGeneratedMessageHashFloat(defaultFloat));
   }
-  for (NSNumber* element in self.repeatedImportEnumArray) {
-    hashCode = hashCode * 31 + element.intValue;
+  if (hasBits_[1] & 0x8u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, PBGeneratedMessageHashDouble(defaultDouble));
   }
-  for (NSString* element in self.repeatedStringPieceArray) {
-    hashCode = hashCode * 31 + [element hash];
+  if (hasBits_[1] & 0x10u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, (uint64_t)!!defaultBool_);
   }
-  for (NSString* element in self.repeatedCordArray) {
-    hashCode = hashCode * 31 + [element hash];
+  if (hasBits_[1] & 0x20u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [defaultString hash]);
   }
-  if (self.hasDefaultInt32) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithInt:self.defaultInt32] hash];
+  if (hasBits_[1] & 0x40u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [defaultBytes hash]);
   }
-  if (self.hasDefaultInt64) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithLongLong:self.defaultInt64] hash];
+  if (hasBits_[1] & 0x80u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, (uint64_t)defaultNestedEnum);
   }
-  if (self.hasDefaultUint32) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithInt:self.defaultUint32] hash];
+  if (hasBits_[1] & 0x100u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, (uint64_t)defaultForeignEnum);
   }
-  if (self.hasDefaultUint64) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithLongLong:self.defaultUint64] hash];
+  if (hasBits_[1] & 0x200u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, (uint64_t)defaultImportEnum);
   }
-  if (self.hasDefaultSint32) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithInt:self.defaultSint32] hash];
+  if (hasBits_[1] & 0x400u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [defaultStringPiece hash]);
   }
-  if (self.hasDefaultSint64) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithLongLong:self.defaultSint64] hash];
+  if (hasBits_[1] & 0x800u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [defaultCord hash]);
   }
-  if (self.hasDefaultFixed32) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithInt:self.defaultFixed32] hash];
+  hash_ = PBGeneratedMessageHashFinish(hashCode);
+  PBGeneratedMessageSetMemoizedHash(&memoizedHash, hash_);
+  return hash_;
+}
+@end
+
+BOOL TestAllTypesLite_NestedEnumIsValidValue(TestAllTypesLite_NestedEnum value) {
+  switch (value) {
+    case TestAllTypesLite_NestedEnumFoo:
+    case TestAllTypesLite_NestedEnumBar:
+    case TestAllTypesLite_NestedEnumBaz:
+      return YES;
+    default:
+      return NO;
   }
-  if (self.hasDefaultFixed64) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithLongLong:self.defaultFixed64] hash];
-  }
-  if (self.hasDefaultSfixed32) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithInt:self.defaultSfixed32] hash];
-  }
-  if (self.hasDefaultSfixed64) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithLongLong:self.defaultSfixed64] hash];
-  }
-  if (self.hasDefaultFloat) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithFloat:self.defaultFloat] hash];
-  }
-  if (self.hasDefaultDouble) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithDouble:self.defaultDouble] hash];
-  }
-  if (self.hasDefaultBool) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithBool:self.defaultBool] hash];
-  }
-  if (self.hasDefaultString) {
-    hashCode = hashCode * 31 + [self.defaultString hash];
-  }
-  if (self.hasDefaultBytes) {
-    hashCode = hashCode * 31 + [self.defaultBytes hash];
-  }
-  if (self.hasDefaultNestedEnum) {
-    hashCode = hashCode * 31 + self.defaultNestedEnum;
-  }
-  if (self.hasDefaultForeignEnum) {
-    hashCode = hashCode * 31 + self.defaultForeignEnum;
-  }
-  if (self.hasDefaultImportEnum) {
-    hashCode = hashCode * 31 + self.defaultImportEnum;
-  }
-  if (self.hasDefaultStringPiece) {
-    hashCode = hashCode * 31 + [self.defaultStringPiece hash];
-  }
-  if (self.hasDefaultCord) {
-    hashCode = hashCode * 31 + [self.defaultCord hash];
-  }
-  hashCode = hashCode * 31 + [self.unknownFields hash];
-  return hashCode;
 }
+@interface TestAllTypesLite_NestedMessage ()
+@property (nonatomic) int32_t bb;
 @end
 
-BOOL TestAllTypesLite_NestedEnumIsValidValue(TestAllTypesLite_NestedEnum value) {
-  switch (value) {
-    case TestAllTypesLite_NestedEnumFoo:
-    case TestAllTypesLite_NestedEnumBar:
-    case TestAllTypesLite_NestedEnumBaz:
-      return YES;
-    default:
-      return NO;
-  }
-}
-@interface TestAllTypesLite_NestedMessage ()
-@property int32_t bb;
+@interface TestAllTypesLite_NestedMessage_Builder()
+@property (nonatomic, retain) TestAllTypesLite_NestedMessage* result;
+- (id) initWithPrototype:(TestAllTypesLite_NestedMessage*) prototype;
+- (void) detachFromPrototype;
 @end
 
 @implementation TestAllTypesLite_NestedMessage
 
 - (BOOL) hasBb {
-  return !!hasBb_;
+  return (hasBits_[0] & 0x1u) != 0;
 }
-- (void) setHasBb:(BOOL) value {
-  hasBb_ = !!value;
+- (void) setHasBb:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x1u;
+  } else {
+    hasBits_[0] &= ~0x1u;
+  }
 }
 @synthesize bb;
 - (void) dealloc {
   [super dealloc];
 }
-- (id) init {
-  if ((self = [super init])) {
-    self.bb = 0;
-  }
-  return self;
+- (void) clearForReuse {
+  [super clearForReuse];
+  memset(hasBits_, 0, sizeof(hasBits_));
+  bb = 0;
 }
 static TestAllTypesLite_NestedMessage* defaultTestAllTypesLite_NestedMessageInstance = nil;
-+ (void) initialize {
-  if (self == [TestAllTypesLite_NestedMessage class]) {
-    defaultTestAllTypesLite_NestedMessageInstance = [[TestAllTypesLite_NestedMessage alloc] init];
-  }
-}
 + (TestAllTypesLite_NestedMessage*) defaultInstance {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultTestAllTypesLite_NestedMessageInstance = [[TestAllTypesLite_NestedMessage alloc] init];
+  });
   return defaultTestAllTypesLite_NestedMessageInstance;
 }
 - (TestAllTypesLite_NestedMessage*) defaultInstance {
-  return defaultTestAllTypesLite_NestedMessageInstance;
+  return [TestAllTypesLite_NestedMessage defaultInstance];
 }
 - (BOOL) isInitialized {
   return YES;
 }
 - (void) writeToCodedOutputStream:(PBCodedOutputStream*) output {
-  if (self.hasBb) {
-    [output writeInt32:1 value:self.bb];
+  if (hasBits_[0] & 0x1u) {
+    [output writeInt32:1 value:bb];
   }
-  [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = PBGeneratedMessageGetMemoizedSize(&memoizedSerializedSize);
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
-  if (self.hasBb) {
-    size += computeInt32Size(1, self.bb);
+  size_ = 0;
+  if (hasBits_[0] & 0x1u) {
+    size_ += computeInt32Size(1, bb);
   }
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
+  PBGeneratedMessageSetMemoizedSize(&memoizedSerializedSize, size_);
+  return size_;
 }
 + (TestAllTypesLite_NestedMessage*) parseFromData:(NSData*) data {
   return (TestAllTypesLite_NestedMessage*)[[[TestAllTypesLite_NestedMessage builder] mergeFromData:data] build];
@@ -3242,7 +3241,7 @@ static TestAllTypesLite_NestedMessage* defaultTestAllTypesLite_NestedMessageInst
   return [[[TestAllTypesLite_NestedMessage_Builder alloc] init] autorelease];
 }
 + (TestAllTypesLite_NestedMessage_Builder*) builderWithPrototype:(TestAllTypesLite_NestedMessage*) prototype {
-  return [[TestAllTypesLite_NestedMessage builder] mergeFrom:prototype];
+  return [[[TestAllTypesLite_NestedMessage_Builder alloc] initWithPrototype:prototype] autorelease];
 }
 - (TestAllTypesLite_NestedMessage_Builder*) builder {
   return [TestAllTypesLite_NestedMessage builder];
@@ -3250,12 +3249,6 @@ static TestAllTypesLite_NestedMessage* defaultTestAllTypesLite_NestedMessageInst
 - (TestAllTypesLite_NestedMessage_Builder*) toBuilder {
   return [TestAllTypesLite_NestedMessage builderWithPrototype:self];
 }
-- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
-  if (self.hasBb) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"bb", [NSNumber numberWithInt:self.bb]];
-  }
-  [self.unknownFields writeDescriptionTo:output withIndent:indent];
-}
 - (BOOL) isEqual:(id)other {
   if (other == self) {
     return YES;
@@ -3265,46 +3258,98 @@ static TestAllTypesLite_NestedMessage* defaultTestAllTypesLite_NestedMessageInst
   }
   TestAllTypesLite_NestedMessage *otherMessage = other;
   return
-      self.hasBb == otherMessage.hasBb &&
-      (!self.hasBb || self.bb == otherMessage.bb) &&
-      
-      (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
+      (hasBits_[0] & 0x1u) == (otherMessage->hasBits_[0] & 0x1u) &&
+      (!(hasBits_[0] & 0x1u) || bb == otherMessage->bb) &&
+      YES;
 }
 - (NSUInteger) hash {
-  NSUInteger hashCode = 7;
-  if (self.hasBb) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithInt:self.bb] hash];
+  NSUInteger hash_ = PBGeneratedMessageGetMemoizedHash(&memoizedHash);
+  if (hash_ != 0) {
+    return hash_;
   }
-  hashCode = hashCode * 31 + [self.unknownFields hash];
-  return hashCode;
-}
-@end
 
-@interface TestAllTypesLite_NestedMessage_Builder()
-@property (retain) TestAllTypesLite_NestedMessage* result;
+  uint64_t hashCode = 7;
+  if (hasBits_[0] & 0x1u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, (uint64_t)bb);
+  }
+  hash_ = PBGeneratedMessageHashFinish(hashCode);
+  PBGeneratedMessageSetMemoizedHash(&memoizedHash, hash_);
+  return hash_;
+}
 @end
 
 @implementation TestAllTypesLite_NestedMessage_Builder
 @synthesize result;
 - (void) dealloc {
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
   self.result = nil;
+  [prototype_ release];
   [super dealloc];
 }
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[[TestAllTypesLite_NestedMessage alloc] init] autorelease];
+    result = [TestAllTypesLite_NestedMessage recycledInstance];
+  }
+  return self;
+}
+- (id) initWithPrototype:(TestAllTypesLite_NestedMessage*) prototype {
+  if ((self = [super init])) {
+    self.result = prototype;
+    prototype_ = [prototype retain];
   }
   return self;
 }
+- (void) detachFromPrototype {
+  TestAllTypesLite_NestedMessage* prototype = prototype_;
+  prototype_ = nil;
+  self.result = [[[TestAllTypesLite_NestedMessage alloc] init] autorelease];
+  [self mergeFrom:prototype];
+  [prototype release];
+}
+- (PBGeneratedMessage*) internalGetMutableResult {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return [self internalGetResult];
+}
 - (PBGeneratedMessage*) internalGetResult {
   return result;
 }
 - (TestAllTypesLite_NestedMessage_Builder*) clear {
-  self.result = [[[TestAllTypesLite_NestedMessage alloc] init] autorelease];
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = [[TestAllTypesLite_NestedMessage recycledInstance] autorelease];
   return self;
 }
 - (TestAllTypesLite_NestedMessage_Builder*) clone {
-  return [TestAllTypesLite_NestedMessage builderWithPrototype:result];
+  if (prototype_ != nil) {
+    return [[[TestAllTypesLite_NestedMessage_Builder alloc] initWithPrototype:prototype_] autorelease];
+  }
+  return [[TestAllTypesLite_NestedMessage builder] mergeFrom:result];
+}
+- (TestAllTypesLite_NestedMessage_Builder*) reset {
+  if (result == nil || prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    self.result = [[TestAllTypesLite_NestedMessage recycledInstance] autorelease];
+  } else {
+    [result clearForReuse];
+  }
+  return self;
+}
+- (TestAllTypesLite_NestedMessage_Builder*) recycle:(TestAllTypesLite_NestedMessage*) message {
+  if (message == [TestAllTypesLite_NestedMessage defaultInstance]) {
+    @throw [NSException exceptionWithName:@"IllegalArgument" reason:@"Cannot recycle the default instance" userInfo:nil];
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = message;
+  return [self reset];
 }
 - (TestAllTypesLite_NestedMessage*) defaultInstance {
   return [TestAllTypesLite_NestedMessage defaultInstance];
@@ -3314,36 +3359,49 @@ static TestAllTypesLite_NestedMessage* defaultTestAllTypesLite_NestedMessageInst
   return [self buildPartial];
 }
 - (TestAllTypesLite_NestedMessage*) buildPartial {
-  TestAllTypesLite_NestedMessage* returnMe = [[result retain] autorelease];
-  self.result = nil;
+  return [[self newBuildPartial] autorelease];
+}
+- (TestAllTypesLite_NestedMessage*) newBuildPartial {
+  if (prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    TestAllTypesLite_NestedMessage* returnMe = result;
+    result = nil;
+    return returnMe;
+  }
+  TestAllTypesLite_NestedMessage* returnMe = result;
+  result = nil;
   return returnMe;
 }
 - (TestAllTypesLite_NestedMessage_Builder*) mergeFrom:(TestAllTypesLite_NestedMessage*) other {
   if (other == [TestAllTypesLite_NestedMessage defaultInstance]) {
     return self;
   }
-  if (other.hasBb) {
-    [self setBb:other.bb];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (other->hasBits_[0] & 0x1u) {
+    [self setBb:other->bb];
   }
-  [self mergeUnknownFields:other.unknownFields];
   return self;
 }
 - (TestAllTypesLite_NestedMessage_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input {
   return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
 }
 - (TestAllTypesLite_NestedMessage_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
   while (YES) {
     int32_t tag = [input readTag];
     switch (tag) {
       case 0:
-        [self setUnknownFields:[unknownFields build]];
         return self;
       default: {
-        if (![self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag]) {
-          [self setUnknownFields:[unknownFields build]];
+        if (PBWireFormatGetTagWireType(tag) == PBWireFormatEndGroup) {
           return self;
         }
+        [input skipField:tag];
         break;
       }
       case 8: {
@@ -3354,79 +3412,91 @@ static TestAllTypesLite_NestedMessage* defaultTestAllTypesLite_NestedMessageInst
   }
 }
 - (BOOL) hasBb {
-  return result.hasBb;
+  return (result->hasBits_[0] & 0x1u) != 0;
 }
 - (int32_t) bb {
-  return result.bb;
+  return result->bb;
 }
 - (TestAllTypesLite_NestedMessage_Builder*) setBb:(int32_t) value {
-  result.hasBb = YES;
-  result.bb = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x1u;
+  result->bb = value;
   return self;
 }
 - (TestAllTypesLite_NestedMessage_Builder*) clearBb {
-  result.hasBb = NO;
-  result.bb = 0;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x1u;
+  result->bb = 0;
   return self;
 }
 @end
 
 @interface TestAllTypesLite_OptionalGroup ()
-@property int32_t a;
+@property (nonatomic) int32_t a;
+@end
+
+@interface TestAllTypesLite_OptionalGroup_Builder()
+@property (nonatomic, retain) TestAllTypesLite_OptionalGroup* result;
+- (id) initWithPrototype:(TestAllTypesLite_OptionalGroup*) prototype;
+- (void) detachFromPrototype;
 @end
 
 @implementation TestAllTypesLite_OptionalGroup
 
 - (BOOL) hasA {
-  return !!hasA_;
+  return (hasBits_[0] & 0x1u) != 0;
 }
-- (void) setHasA:(BOOL) value {
-  hasA_ = !!value;
+- (void) setHasA:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x1u;
+  } else {
+    hasBits_[0] &= ~0x1u;
+  }
 }
 @synthesize a;
 - (void) dealloc {
   [super dealloc];
 }
-- (id) init {
-  if ((self = [super init])) {
-    self.a = 0;
-  }
-  return self;
+- (void) clearForReuse {
+  [super clearForReuse];
+  memset(hasBits_, 0, sizeof(hasBits_));
+  a = 0;
 }
 static TestAllTypesLite_OptionalGroup* defaultTestAllTypesLite_OptionalGroupInstance = nil;
-+ (void) initialize {
-  if (self == [TestAllTypesLite_OptionalGroup class]) {
-    defaultTestAllTypesLite_OptionalGroupInstance = [[TestAllTypesLite_OptionalGroup alloc] init];
-  }
-}
 + (TestAllTypesLite_OptionalGroup*) defaultInstance {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultTestAllTypesLite_OptionalGroupInstance = [[TestAllTypesLite_OptionalGroup alloc] init];
+  });
   return defaultTestAllTypesLite_OptionalGroupInstance;
 }
 - (TestAllTypesLite_OptionalGroup*) defaultInstance {
-  return defaultTestAllTypesLite_OptionalGroupInstance;
+  return [TestAllTypesLite_OptionalGroup defaultInstance];
 }
 - (BOOL) isInitialized {
   return YES;
 }
 - (void) writeToCodedOutputStream:(PBCodedOutputStream*) output {
-  if (self.hasA) {
-    [output writeInt32:17 value:self.a];
+  if (hasBits_[0] & 0x1u) {
+    [output writeInt32:17 value:a];
   }
-  [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = PBGeneratedMessageGetMemoizedSize(&memoizedSerializedSize);
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
-  if (self.hasA) {
-    size += computeInt32Size(17, self.a);
+  size_ = 0;
+  if (hasBits_[0] & 0x1u) {
+    size_ += computeInt32Size(17, a);
   }
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
+  PBGeneratedMessageSetMemoizedSize(&memoizedSerializedSize, size_);
+  return size_;
 }
 + (TestAllTypesLite_OptionalGroup*) parseFromData:(NSData*) data {
   return (TestAllTypesLite_OptionalGroup*)[[[TestAllTypesLite_OptionalGroup builder] mergeFromData:data] build];
@@ -3450,7 +3520,7 @@ static TestAllTypesLite_OptionalGroup* defaultTestAllTypesLite_OptionalGroupInst
   return [[[TestAllTypesLite_OptionalGroup_Builder alloc] init] autorelease];
 }
 + (TestAllTypesLite_OptionalGroup_Builder*) builderWithPrototype:(TestAllTypesLite_OptionalGroup*) prototype {
-  return [[TestAllTypesLite_OptionalGroup builder] mergeFrom:prototype];
+  return [[[TestAllTypesLite_OptionalGroup_Builder alloc] initWithPrototype:prototype] autorelease];
 }
 - (TestAllTypesLite_OptionalGroup_Builder*) builder {
   return [TestAllTypesLite_OptionalGroup builder];
@@ -3458,12 +3528,6 @@ static TestAllTypesLite_OptionalGroup* defaultTestAllTypesLite_OptionalGroupInst
 - (TestAllTypesLite_OptionalGroup_Builder*) toBuilder {
   return [TestAllTypesLite_OptionalGroup builderWithPrototype:self];
 }
-- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
-  if (self.hasA) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"a", [NSNumber numberWithInt:self.a]];
-  }
-  [self.unknownFields writeDescriptionTo:output withIndent:indent];
-}
 - (BOOL) isEqual:(id)other {
   if (other == self) {
     return YES;
@@ -3473,46 +3537,98 @@ static TestAllTypesLite_OptionalGroup* defaultTestAllTypesLite_OptionalGroupInst
   }
   TestAllTypesLite_OptionalGroup *otherMessage = other;
   return
-      self.hasA == otherMessage.hasA &&
-      (!self.hasA || self.a == otherMessage.a) &&
-      
-      (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
+      (hasBits_[0] & 0x1u) == (otherMessage->hasBits_[0] & 0x1u) &&
+      (!(hasBits_[0] & 0x1u) || a == otherMessage->a) &&
+      YES;
 }
 - (NSUInteger) hash {
-  NSUInteger hashCode = 7;
-  if (self.hasA) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithInt:self.a] hash];
+  NSUInteger hash_ = PBGeneratedMessageGetMemoizedHash(&memoizedHash);
+  if (hash_ != 0) {
+    return hash_;
   }
-  hashCode = hashCode * 31 + [self.unknownFields hash];
-  return hashCode;
-}
-@end
 
-@interface TestAllTypesLite_OptionalGroup_Builder()
-@property (retain) TestAllTypesLite_OptionalGroup* result;
+  uint64_t hashCode = 7;
+  if (hasBits_[0] & 0x1u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, (uint64_t)a);
+  }
+  hash_ = PBGeneratedMessageHashFinish(hashCode);
+  PBGeneratedMessageSetMemoizedHash(&memoizedHash, hash_);
+  return hash_;
+}
 @end
 
 @implementation TestAllTypesLite_OptionalGroup_Builder
 @synthesize result;
 - (void) dealloc {
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
   self.result = nil;
+  [prototype_ release];
   [super dealloc];
 }
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[[TestAllTypesLite_OptionalGroup alloc] init] autorelease];
+    result = [TestAllTypesLite_OptionalGroup recycledInstance];
+  }
+  return self;
+}
+- (id) initWithPrototype:(TestAllTypesLite_OptionalGroup*) prototype {
+  if ((self = [super init])) {
+    self.result = prototype;
+    prototype_ = [prototype retain];
   }
   return self;
 }
+- (void) detachFromPrototype {
+  TestAllTypesLite_OptionalGroup* prototype = prototype_;
+  prototype_ = nil;
+  self.result = [[[TestAllTypesLite_OptionalGroup alloc] init] autorelease];
+  [self mergeFrom:prototype];
+  [prototype release];
+}
+- (PBGeneratedMessage*) internalGetMutableResult {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return [self internalGetResult];
+}
 - (PBGeneratedMessage*) internalGetResult {
   return result;
 }
 - (TestAllTypesLite_OptionalGroup_Builder*) clear {
-  self.result = [[[TestAllTypesLite_OptionalGroup alloc] init] autorelease];
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = [[TestAllTypesLite_OptionalGroup recycledInstance] autorelease];
   return self;
 }
 - (TestAllTypesLite_OptionalGroup_Builder*) clone {
-  return [TestAllTypesLite_OptionalGroup builderWithPrototype:result];
+  if (prototype_ != nil) {
+    return [[[TestAllTypesLite_OptionalGroup_Builder alloc] initWithPrototype:prototype_] autorelease];
+  }
+  return [[TestAllTypesLite_OptionalGroup builder] mergeFrom:result];
+}
+- (TestAllTypesLite_OptionalGroup_Builder*) reset {
+  if (result == nil || prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    self.result = [[TestAllTypesLite_OptionalGroup recycledInstance] autorelease];
+  } else {
+    [result clearForReuse];
+  }
+  return self;
+}
+- (TestAllTypesLite_OptionalGroup_Builder*) recycle:(TestAllTypesLite_OptionalGroup*) message {
+  if (message == [TestAllTypesLite_OptionalGroup defaultInstance]) {
+    @throw [NSException exceptionWithName:@"IllegalArgument" reason:@"Cannot recycle the default instance" userInfo:nil];
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = message;
+  return [self reset];
 }
 - (TestAllTypesLite_OptionalGroup*) defaultInstance {
   return [TestAllTypesLite_OptionalGroup defaultInstance];
@@ -3522,36 +3638,49 @@ static TestAllTypesLite_OptionalGroup* defaultTestAllTypesLite_OptionalGroupInst
   return [self buildPartial];
 }
 - (TestAllTypesLite_OptionalGroup*) buildPartial {
-  TestAllTypesLite_OptionalGroup* returnMe = [[result retain] autorelease];
-  self.result = nil;
+  return [[self newBuildPartial] autorelease];
+}
+- (TestAllTypesLite_OptionalGroup*) newBuildPartial {
+  if (prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    TestAllTypesLite_OptionalGroup* returnMe = result;
+    result = nil;
+    return returnMe;
+  }
+  TestAllTypesLite_OptionalGroup* returnMe = result;
+  result = nil;
   return returnMe;
 }
 - (TestAllTypesLite_OptionalGroup_Builder*) mergeFrom:(TestAllTypesLite_OptionalGroup*) other {
   if (other == [TestAllTypesLite_OptionalGroup defaultInstance]) {
     return self;
   }
-  if (other.hasA) {
-    [self setA:other.a];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (other->hasBits_[0] & 0x1u) {
+    [self setA:other->a];
   }
-  [self mergeUnknownFields:other.unknownFields];
   return self;
 }
 - (TestAllTypesLite_OptionalGroup_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input {
   return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
 }
 - (TestAllTypesLite_OptionalGroup_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
   while (YES) {
     int32_t tag = [input readTag];
     switch (tag) {
       case 0:
-        [self setUnknownFields:[unknownFields build]];
         return self;
       default: {
-        if (![self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag]) {
-          [self setUnknownFields:[unknownFields build]];
+        if (PBWireFormatGetTagWireType(tag) == PBWireFormatEndGroup) {
           return self;
         }
+        [input skipField:tag];
         break;
       }
       case 136: {
@@ -3562,79 +3691,91 @@ static TestAllTypesLite_OptionalGroup* defaultTestAllTypesLite_OptionalGroupInst
   }
 }
 - (BOOL) hasA {
-  return result.hasA;
+  return (result->hasBits_[0] & 0x1u) != 0;
 }
 - (int32_t) a {
-  return result.a;
+  return result->a;
 }
 - (TestAllTypesLite_OptionalGroup_Builder*) setA:(int32_t) value {
-  result.hasA = YES;
-  result.a = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x1u;
+  result->a = value;
   return self;
 }
 - (TestAllTypesLite_OptionalGroup_Builder*) clearA {
-  result.hasA = NO;
-  result.a = 0;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x1u;
+  result->a = 0;
   return self;
 }
 @end
 
 @interface TestAllTypesLite_RepeatedGroup ()
-@property int32_t a;
+@property (nonatomic) int32_t a;
+@end
+
+@interface TestAllTypesLite_RepeatedGroup_Builder()
+@property (nonatomic, retain) TestAllTypesLite_RepeatedGroup* result;
+- (id) initWithPrototype:(TestAllTypesLite_RepeatedGroup*) prototype;
+- (void) detachFromPrototype;
 @end
 
 @implementation TestAllTypesLite_RepeatedGroup
 
 - (BOOL) hasA {
-  return !!hasA_;
+  return (hasBits_[0] & 0x1u) != 0;
 }
-- (void) setHasA:(BOOL) value {
-  hasA_ = !!value;
+- (void) setHasA:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x1u;
+  } else {
+    hasBits_[0] &= ~0x1u;
+  }
 }
 @synthesize a;
 - (void) dealloc {
   [super dealloc];
 }
-- (id) init {
-  if ((self = [super init])) {
-    self.a = 0;
-  }
-  return self;
+- (void) clearForReuse {
+  [super clearForReuse];
+  memset(hasBits_, 0, sizeof(hasBits_));
+  a = 0;
 }
 static TestAllTypesLite_RepeatedGroup* defaultTestAllTypesLite_RepeatedGroupInstance = nil;
-+ (void) initialize {
-  if (self == [TestAllTypesLite_RepeatedGroup class]) {
-    defaultTestAllTypesLite_RepeatedGroupInstance = [[TestAllTypesLite_RepeatedGroup alloc] init];
-  }
-}
 + (TestAllTypesLite_RepeatedGroup*) defaultInstance {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultTestAllTypesLite_RepeatedGroupInstance = [[TestAllTypesLite_RepeatedGroup alloc] init];
+  });
   return defaultTestAllTypesLite_RepeatedGroupInstance;
 }
 - (TestAllTypesLite_RepeatedGroup*) defaultInstance {
-  return defaultTestAllTypesLite_RepeatedGroupInstance;
+  return [TestAllTypesLite_RepeatedGroup defaultInstance];
 }
 - (BOOL) isInitialized {
   return YES;
 }
 - (void) writeToCodedOutputStream:(PBCodedOutputStream*) output {
-  if (self.hasA) {
-    [output writeInt32:47 value:self.a];
+  if (hasBits_[0] & 0x1u) {
+    [output writeInt32:47 value:a];
   }
-  [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = PBGeneratedMessageGetMemoizedSize(&memoizedSerializedSize);
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
-  if (self.hasA) {
-    size += computeInt32Size(47, self.a);
+  size_ = 0;
+  if (hasBits_[0] & 0x1u) {
+    size_ += computeInt32Size(47, a);
   }
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
+  PBGeneratedMessageSetMemoizedSize(&memoizedSerializedSize, size_);
+  return size_;
 }
 + (TestAllTypesLite_RepeatedGroup*) parseFromData:(NSData*) data {
   return (TestAllTypesLite_RepeatedGroup*)[[[TestAllTypesLite_RepeatedGroup builder] mergeFromData:data] build];
@@ -3658,7 +3799,7 @@ static TestAllTypesLite_RepeatedGroup* defaultTestAllTypesLite_RepeatedGroupInst
   return [[[TestAllTypesLite_RepeatedGroup_Builder alloc] init] autorelease];
 }
 + (TestAllTypesLite_RepeatedGroup_Builder*) builderWithPrototype:(TestAllTypesLite_RepeatedGroup*) prototype {
-  return [[TestAllTypesLite_RepeatedGroup builder] mergeFrom:prototype];
+  return [[[TestAllTypesLite_RepeatedGroup_Builder alloc] initWithPrototype:prototype] autorelease];
 }
 - (TestAllTypesLite_RepeatedGroup_Builder*) builder {
   return [TestAllTypesLite_RepeatedGroup builder];
@@ -3666,12 +3807,6 @@ static TestAllTypesLite_RepeatedGroup* defaultTestAllTypesLite_RepeatedGroupInst
 - (TestAllTypesLite_RepeatedGroup_Builder*) toBuilder {
   return [TestAllTypesLite_RepeatedGroup builderWithPrototype:self];
 }
-- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
-  if (self.hasA) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"a", [NSNumber numberWithInt:self.a]];
-  }
-  [self.unknownFields writeDescriptionTo:output withIndent:indent];
-}
 - (BOOL) isEqual:(id)other {
   if (other == self) {
     return YES;
@@ -3681,46 +3816,98 @@ static TestAllTypesLite_RepeatedGroup* defaultTestAllTypesLite_RepeatedGroupInst
   }
   TestAllTypesLite_RepeatedGroup *otherMessage = other;
   return
-      self.hasA == otherMessage.hasA &&
-      (!self.hasA || self.a == otherMessage.a) &&
-      
-      (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
+      (hasBits_[0] & 0x1u) == (otherMessage->hasBits_[0] & 0x1u) &&
+      (!(hasBits_[0] & 0x1u) || a == otherMessage->a) &&
+      YES;
 }
 - (NSUInteger) hash {
-  NSUInteger hashCode = 7;
-  if (self.hasA) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithInt:self.a] hash];
+  NSUInteger hash_ = PBGeneratedMessageGetMemoizedHash(&memoizedHash);
+  if (hash_ != 0) {
+    return hash_;
   }
-  hashCode = hashCode * 31 + [self.unknownFields hash];
-  return hashCode;
-}
-@end
 
-@interface TestAllTypesLite_RepeatedGroup_Builder()
-@property (retain) TestAllTypesLite_RepeatedGroup* result;
+  uint64_t hashCode = 7;
+  if (hasBits_[0] & 0x1u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, (uint64_t)a);
+  }
+  hash_ = PBGeneratedMessageHashFinish(hashCode);
+  PBGeneratedMessageSetMemoizedHash(&memoizedHash, hash_);
+  return hash_;
+}
 @end
 
 @implementation TestAllTypesLite_RepeatedGroup_Builder
 @synthesize result;
 - (void) dealloc {
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
   self.result = nil;
+  [prototype_ release];
   [super dealloc];
 }
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[[TestAllTypesLite_RepeatedGroup alloc] init] autorelease];
+    result = [TestAllTypesLite_RepeatedGroup recycledInstance];
+  }
+  return self;
+}
+- (id) initWithPrototype:(TestAllTypesLite_RepeatedGroup*) prototype {
+  if ((self = [super init])) {
+    self.result = prototype;
+    prototype_ = [prototype retain];
   }
   return self;
 }
+- (void) detachFromPrototype {
+  TestAllTypesLite_RepeatedGroup* prototype = prototype_;
+  prototype_ = nil;
+  self.result = [[[TestAllTypesLite_RepeatedGroup alloc] init] autorelease];
+  [self mergeFrom:prototype];
+  [prototype release];
+}
+- (PBGeneratedMessage*) internalGetMutableResult {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return [self internalGetResult];
+}
 - (PBGeneratedMessage*) internalGetResult {
   return result;
 }
 - (TestAllTypesLite_RepeatedGroup_Builder*) clear {
-  self.result = [[[TestAllTypesLite_RepeatedGroup alloc] init] autorelease];
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = [[TestAllTypesLite_RepeatedGroup recycledInstance] autorelease];
   return self;
 }
 - (TestAllTypesLite_RepeatedGroup_Builder*) clone {
-  return [TestAllTypesLite_RepeatedGroup builderWithPrototype:result];
+  if (prototype_ != nil) {
+    return [[[TestAllTypesLite_RepeatedGroup_Builder alloc] initWithPrototype:prototype_] autorelease];
+  }
+  return [[TestAllTypesLite_RepeatedGroup builder] mergeFrom:result];
+}
+- (TestAllTypesLite_RepeatedGroup_Builder*) reset {
+  if (result == nil || prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    self.result = [[TestAllTypesLite_RepeatedGroup recycledInstance] autorelease];
+  } else {
+    [result clearForReuse];
+  }
+  return self;
+}
+- (TestAllTypesLite_RepeatedGroup_Builder*) recycle:(TestAllTypesLite_RepeatedGroup*) message {
+  if (message == [TestAllTypesLite_RepeatedGroup defaultInstance]) {
+    @throw [NSException exceptionWithName:@"IllegalArgument" reason:@"Cannot recycle the default instance" userInfo:nil];
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = message;
+  return [self reset];
 }
 - (TestAllTypesLite_RepeatedGroup*) defaultInstance {
   return [TestAllTypesLite_RepeatedGroup defaultInstance];
@@ -3730,36 +3917,49 @@ static TestAllTypesLite_RepeatedGroup* defaultTestAllTypesLite_RepeatedGroupInst
   return [self buildPartial];
 }
 - (TestAllTypesLite_RepeatedGroup*) buildPartial {
-  TestAllTypesLite_RepeatedGroup* returnMe = [[result retain] autorelease];
-  self.result = nil;
+  return [[self newBuildPartial] autorelease];
+}
+- (TestAllTypesLite_RepeatedGroup*) newBuildPartial {
+  if (prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    TestAllTypesLite_RepeatedGroup* returnMe = result;
+    result = nil;
+    return returnMe;
+  }
+  TestAllTypesLite_RepeatedGroup* returnMe = result;
+  result = nil;
   return returnMe;
 }
 - (TestAllTypesLite_RepeatedGroup_Builder*) mergeFrom:(TestAllTypesLite_RepeatedGroup*) other {
   if (other == [TestAllTypesLite_RepeatedGroup defaultInstance]) {
     return self;
   }
-  if (other.hasA) {
-    [self setA:other.a];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (other->hasBits_[0] & 0x1u) {
+    [self setA:other->a];
   }
-  [self mergeUnknownFields:other.unknownFields];
   return self;
 }
 - (TestAllTypesLite_RepeatedGroup_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input {
   return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
 }
 - (TestAllTypesLite_RepeatedGroup_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
   while (YES) {
     int32_t tag = [input readTag];
     switch (tag) {
       case 0:
-        [self setUnknownFields:[unknownFields build]];
         return self;
       default: {
-        if (![self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag]) {
-          [self setUnknownFields:[unknownFields build]];
+        if (PBWireFormatGetTagWireType(tag) == PBWireFormatEndGroup) {
           return self;
         }
+        [input skipField:tag];
         break;
       }
       case 376: {
@@ -3770,48 +3970,180 @@ static TestAllTypesLite_RepeatedGroup* defaultTestAllTypesLite_RepeatedGroupInst
   }
 }
 - (BOOL) hasA {
-  return result.hasA;
+  return (result->hasBits_[0] & 0x1u) != 0;
 }
 - (int32_t) a {
-  return result.a;
+  return result->a;
 }
 - (TestAllTypesLite_RepeatedGroup_Builder*) setA:(int32_t) value {
-  result.hasA = YES;
-  result.a = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x1u;
+  result->a = value;
   return self;
 }
 - (TestAllTypesLite_RepeatedGroup_Builder*) clearA {
-  result.hasA = NO;
-  result.a = 0;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x1u;
+  result->a = 0;
   return self;
 }
 @end
 
-@interface TestAllTypesLite_Builder()
-@property (retain) TestAllTypesLite* result;
-@end
-
 @implementation TestAllTypesLite_Builder
 @synthesize result;
 - (void) dealloc {
+  [self dropSubBuilders];
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
   self.result = nil;
+  [prototype_ release];
   [super dealloc];
 }
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[[TestAllTypesLite alloc] init] autorelease];
+    result = [TestAllTypesLite recycledInstance];
+  }
+  return self;
+}
+- (id) initWithPrototype:(TestAllTypesLite*) prototype {
+  if ((self = [super init])) {
+    self.result = prototype;
+    prototype_ = [prototype retain];
   }
   return self;
 }
+- (void) detachFromPrototype {
+  TestAllTypesLite* prototype = prototype_;
+  prototype_ = nil;
+  self.result = [[[TestAllTypesLite alloc] init] autorelease];
+  [self mergeFrom:prototype];
+  [prototype release];
+}
+- (PBGeneratedMessage*) internalGetMutableResult {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return [self internalGetResult];
+}
+- (void) freezeSubBuilders {
+  if (optionalGroupBuilder_ != nil) {
+    TestAllTypesLite_OptionalGroup* value = [optionalGroupBuilder_ newBuildPartial];
+    result.optionalGroup = value;
+    [value release];
+    [optionalGroupBuilder_ release];
+    optionalGroupBuilder_ = nil;
+  }
+  if (optionalNestedMessageBuilder_ != nil) {
+    TestAllTypesLite_NestedMessage* value = [optionalNestedMessageBuilder_ newBuildPartial];
+    result.optionalNestedMessage = value;
+    [value release];
+    [optionalNestedMessageBuilder_ release];
+    optionalNestedMessageBuilder_ = nil;
+  }
+  if (optionalForeignMessageBuilder_ != nil) {
+    ForeignMessageLite* value = [optionalForeignMessageBuilder_ newBuildPartial];
+    result.optionalForeignMessage = value;
+    [value release];
+    [optionalForeignMessageBuilder_ release];
+    optionalForeignMessageBuilder_ = nil;
+  }
+  if (optionalImportMessageBuilder_ != nil) {
+    ImportMessageLite* value = [optionalImportMessageBuilder_ newBuildPartial];
+    result.optionalImportMessage = value;
+    [value release];
+    [optionalImportMessageBuilder_ release];
+    optionalImportMessageBuilder_ = nil;
+  }
+}
+- (void) dropSubBuilders {
+  [optionalGroupBuilder_ release];
+  optionalGroupBuilder_ = nil;
+  [optionalGroupSpareBuilder_ release];
+  optionalGroupSpareBuilder_ = nil;
+  [optionalNestedMessageBuilder_ release];
+  optionalNestedMessageBuilder_ = nil;
+  [optionalNestedMessageSpareBuilder_ release];
+  optionalNestedMessageSpareBuilder_ = nil;
+  [optionalForeignMessageBuilder_ release];
+  optionalForeignMessageBuilder_ = nil;
+  [optionalForeignMessageSpareBuilder_ release];
+  optionalForeignMessageSpareBuilder_ = nil;
+  [optionalImportMessageBuilder_ release];
+  optionalImportMessageBuilder_ = nil;
+  [optionalImportMessageSpareBuilder_ release];
+  optionalImportMessageSpareBuilder_ = nil;
+}
+- (void) resetSubBuilders {
+  if (optionalGroupBuilder_ != nil) {
+    [optionalGroupBuilder_ reset];
+    [optionalGroupSpareBuilder_ release];
+    optionalGroupSpareBuilder_ = optionalGroupBuilder_;
+    optionalGroupBuilder_ = nil;
+  }
+  if (optionalNestedMessageBuilder_ != nil) {
+    [optionalNestedMessageBuilder_ reset];
+    [optionalNestedMessageSpareBuilder_ release];
+    optionalNestedMessageSpareBuilder_ = optionalNestedMessageBuilder_;
+    optionalNestedMessageBuilder_ = nil;
+  }
+  if (optionalForeignMessageBuilder_ != nil) {
+    [optionalForeignMessageBuilder_ reset];
+    [optionalForeignMessageSpareBuilder_ release];
+    optionalForeignMessageSpareBuilder_ = optionalForeignMessageBuilder_;
+    optionalForeignMessageBuilder_ = nil;
+  }
+  if (optionalImportMessageBuilder_ != nil) {
+    [optionalImportMessageBuilder_ reset];
+    [optionalImportMessageSpareBuilder_ release];
+    optionalImportMessageSpareBuilder_ = optionalImportMessageBuilder_;
+    optionalImportMessageBuilder_ = nil;
+  }
+}
 - (PBGeneratedMessage*) internalGetResult {
+  [self freezeSubBuilders];
   return result;
 }
 - (TestAllTypesLite_Builder*) clear {
-  self.result = [[[TestAllTypesLite alloc] init] autorelease];
+  [self dropSubBuilders];
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = [[TestAllTypesLite recycledInstance] autorelease];
   return self;
 }
 - (TestAllTypesLite_Builder*) clone {
-  return [TestAllTypesLite builderWithPrototype:result];
+  if (prototype_ != nil) {
+    return [[[TestAllTypesLite_Builder alloc] initWithPrototype:prototype_] autorelease];
+  }
+  [self freezeSubBuilders];
+  return [[TestAllTypesLite builder] mergeFrom:result];
+}
+- (TestAllTypesLite_Builder*) reset {
+  [self resetSubBuilders];
+  if (result == nil || prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    self.result = [[TestAllTypesLite recycledInstance] autorelease];
+  } else {
+    [result clearForReuse];
+  }
+  return self;
+}
+- (TestAllTypesLite_Builder*) recycle:(TestAllTypesLite*) message {
+  if (message == [TestAllTypesLite defaultInstance]) {
+    @throw [NSException exceptionWithName:@"IllegalArgument" reason:@"Cannot recycle the default instance" userInfo:nil];
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = message;
+  return [self reset];
 }
 - (TestAllTypesLite*) defaultInstance {
   return [TestAllTypesLite defaultInstance];
@@ -3821,333 +4153,371 @@ static TestAllTypesLite_RepeatedGroup* defaultTestAllTypesLite_RepeatedGroupInst
   return [self buildPartial];
 }
 - (TestAllTypesLite*) buildPartial {
-  TestAllTypesLite* returnMe = [[result retain] autorelease];
-  self.result = nil;
+  return [[self newBuildPartial] autorelease];
+}
+- (TestAllTypesLite*) newBuildPartial {
+  if (prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    TestAllTypesLite* returnMe = result;
+    result = nil;
+    return returnMe;
+  }
+  [self freezeSubBuilders];
+  [result->repeatedInt32Array shrinkToFit];
+  [result->repeatedInt64Array shrinkToFit];
+  [result->repeatedUint32Array shrinkToFit];
+  [result->repeatedUint64Array shrinkToFit];
+  [result->repeatedSint32Array shrinkToFit];
+  [result->repeatedSint64Array shrinkToFit];
+  [result->repeatedFixed32Array shrinkToFit];
+  [result->repeatedFixed64Array shrinkToFit];
+  [result->repeatedSfixed32Array shrinkToFit];
+  [result->repeatedSfixed64Array shrinkToFit];
+  [result->repeatedFloatArray shrinkToFit];
+  [result->repeatedDoubleArray shrinkToFit];
+  [result->repeatedBoolArray shrinkToFit];
+  [result->repeatedStringArray shrinkToFit];
+  [result->repeatedBytesArray shrinkToFit];
+  [result->repeatedGroupArray shrinkToFit];
+  [result->repeatedNestedMessageArray shrinkToFit];
+  [result->repeatedForeignMessageArray shrinkToFit];
+  [result->repeatedImportMessageArray shrinkToFit];
+  [result->repeatedNestedEnumArray shrinkToFit];
+  [result->repeatedForeignEnumArray shrinkToFit];
+  [result->repeatedImportEnumArray shrinkToFit];
+  [result->repeatedStringPieceArray shrinkToFit];
+  [result->repeatedCordArray shrinkToFit];
+  TestAllTypesLite* returnMe = result;
+  result = nil;
   return returnMe;
 }
 - (TestAllTypesLite_Builder*) mergeFrom:(TestAllTypesLite*) other {
   if (other == [TestAllTypesLite defaultInstance]) {
     return self;
   }
-  if (other.hasOptionalInt32) {
-    [self setOptionalInt32:other.optionalInt32];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  if (other.hasOptionalInt64) {
-    [self setOptionalInt64:other.optionalInt64];
+  if (other->hasBits_[0] & 0x1u) {
+    [self setOptionalInt32:other->optionalInt32];
   }
-  if (other.hasOptionalUint32) {
-    [self setOptionalUint32:other.optionalUint32];
+  if (other->hasBits_[0] & 0x2u) {
+    [self setOptionalInt64:other->optionalInt64];
   }
-  if (other.hasOptionalUint64) {
-    [self setOptionalUint64:other.optionalUint64];
+  if (other->hasBits_[0] & 0x4u) {
+    [self setOptionalUint32:other->optionalUint32];
   }
-  if (other.hasOptionalSint32) {
-    [self setOptionalSint32:other.optionalSint32];
+  if (other->hasBits_[0] & 0x8u) {
+    [self setOptionalUint64:other->optionalUint64];
   }
-  if (other.hasOptionalSint64) {
-    [self setOptionalSint64:other.optionalSint64];
+  if (other->hasBits_[0] & 0x10u) {
+    [self setOptionalSint32:other->optionalSint32];
   }
-  if (other.hasOptionalFixed32) {
-    [self setOptionalFixed32:other.optionalFixed32];
+  if (other->hasBits_[0] & 0x20u) {
+    [self setOptionalSint64:other->optionalSint64];
   }
-  if (other.hasOptionalFixed64) {
-    [self setOptionalFixed64:other.optionalFixed64];
+  if (other->hasBits_[0] & 0x40u) {
+    [self setOptionalFixed32:other->optionalFixed32];
   }
-  if (other.hasOptionalSfixed32) {
-    [self setOptionalSfixed32:other.optionalSfixed32];
+  if (other->hasBits_[0] & 0x80u) {
+    [self setOptionalFixed64:other->optionalFixed64];
   }
-  if (other.hasOptionalSfixed64) {
-    [self setOptionalSfixed64:other.optionalSfixed64];
+  if (other->hasBits_[0] & 0x100u) {
+    [self setOptionalSfixed32:other->optionalSfixed32];
   }
-  if (other.hasOptionalFloat) {
-    [self setOptionalFloat:other.optionalFloat];
+  if (other->hasBits_[0] & 0x200u) {
+    [self setOptionalSfixed64:other->optionalSfixed64];
   }
-  if (other.hasOptionalDouble) {
-    [self setOptionalDouble:other.optionalDouble];
+  if (other->hasBits_[0] & 0x400u) {
+    [self setOptionalFloat:other->optionalFloat];
   }
-  if (other.hasOptionalBool) {
-    [self setOptionalBool:other.optionalBool];
+  if (other->hasBits_[0] & 0x800u) {
+    [self setOptionalDouble:other->optionalDouble];
   }
-  if (other.hasOptionalString) {
-    [self setOptionalString:other.optionalString];
+  if (other->hasBits_[0] & 0x1000u) {
+    [self setOptionalBool:other->optionalBool_];
   }
-  if (other.hasOptionalBytes) {
-    [self setOptionalBytes:other.optionalBytes];
+  if (other->hasBits_[0] & 0x2000u) {
+    [self setOptionalString:other->optionalString];
   }
-  if (other.hasOptionalGroup) {
-    [self mergeOptionalGroup:other.optionalGroup];
+  if (other->hasBits_[0] & 0x4000u) {
+    [self setOptionalBytes:other->optionalBytes];
   }
-  if (other.hasOptionalNestedMessage) {
-    [self mergeOptionalNestedMessage:other.optionalNestedMessage];
+  if (other->hasBits_[0] & 0x8000u) {
+    [self mergeOptionalGroup:other->optionalGroup];
   }
-  if (other.hasOptionalForeignMessage) {
-    [self mergeOptionalForeignMessage:other.optionalForeignMessage];
+  if (other->hasBits_[0] & 0x10000u) {
+    [self mergeOptionalNestedMessage:other->optionalNestedMessage];
   }
-  if (other.hasOptionalImportMessage) {
-    [self mergeOptionalImportMessage:other.optionalImportMessage];
+  if (other->hasBits_[0] & 0x20000u) {
+    [self mergeOptionalForeignMessage:other->optionalForeignMessage];
   }
-  if (other.hasOptionalNestedEnum) {
-    [self setOptionalNestedEnum:other.optionalNestedEnum];
+  if (other->hasBits_[0] & 0x40000u) {
+    [self mergeOptionalImportMessage:other->optionalImportMessage];
   }
-  if (other.hasOptionalForeignEnum) {
-    [self setOptionalForeignEnum:other.optionalForeignEnum];
+  if (other->hasBits_[0] & 0x80000u) {
+    [self setOptionalNestedEnum:other->optionalNestedEnum];
   }
-  if (other.hasOptionalImportEnum) {
-    [self setOptionalImportEnum:other.optionalImportEnum];
+  if (other->hasBits_[0] & 0x100000u) {
+    [self setOptionalForeignEnum:other->optionalForeignEnum];
   }
-  if (other.hasOptionalStringPiece) {
-    [self setOptionalStringPiece:other.optionalStringPiece];
+  if (other->hasBits_[0] & 0x200000u) {
+    [self setOptionalImportEnum:other->optionalImportEnum];
   }
-  if (other.hasOptionalCord) {
-    [self setOptionalCord:other.optionalCord];
+  if (other->hasBits_[0] & 0x400000u) {
+    [self setOptionalStringPiece:other->optionalStringPiece];
   }
-  if (other.repeatedInt32Array.count > 0) {
-    if (result.repeatedInt32Array == nil) {
-      result.repeatedInt32Array = [[other.repeatedInt32Array copyWithZone:[other.repeatedInt32Array zone]] autorelease];
+  if (other->hasBits_[0] & 0x800000u) {
+    [self setOptionalCord:other->optionalCord];
+  }
+  if (other->repeatedInt32Array.count > 0) {
+    if (result->repeatedInt32Array == nil) {
+      result.repeatedInt32Array = [[other->repeatedInt32Array copyWithZone:[other->repeatedInt32Array zone]] autorelease];
     } else {
-      [result.repeatedInt32Array appendArray:other.repeatedInt32Array];
+      [result->repeatedInt32Array appendArray:other->repeatedInt32Array];
     }
   }
-  if (other.repeatedInt64Array.count > 0) {
-    if (result.repeatedInt64Array == nil) {
-      result.repeatedInt64Array = [[other.repeatedInt64Array copyWithZone:[other.repeatedInt64Array zone]] autorelease];
+  if (other->repeatedInt64Array.count > 0) {
+    if (result->repeatedInt64Array == nil) {
+      result.repeatedInt64Array = [[other->repeatedInt64Array copyWithZone:[other->repeatedInt64Array zone]] autorelease];
     } else {
-      [result.repeatedInt64Array appendArray:other.repeatedInt64Array];
+      [result->repeatedInt64Array appendArray:other->repeatedInt64Array];
     }
   }
-  if (other.repeatedUint32Array.count > 0) {
-    if (result.repeatedUint32Array == nil) {
-      result.repeatedUint32Array = [[other.repeatedUint32Array copyWithZone:[other.repeatedUint32Array zone]] autorelease];
+  if (other->repeatedUint32Array.count > 0) {
+    if (result->repeatedUint32Array == nil) {
+      result.repeatedUint32Array = [[other->repeatedUint32Array copyWithZone:[other->repeatedUint32Array zone]] autorelease];
     } else {
-      [result.repeatedUint32Array appendArray:other.repeatedUint32Array];
+      [result->repeatedUint32Array appendArray:other->repeatedUint32Array];
     }
   }
-  if (other.repeatedUint64Array.count > 0) {
-    if (result.repeatedUint64Array == nil) {
-      result.repeatedUint64Array = [[other.repeatedUint64Array copyWithZone:[other.repeatedUint64Array zone]] autorelease];
+  if (other->repeatedUint64Array.count > 0) {
+    if (result->repeatedUint64Array == nil) {
+      result.repeatedUint64Array = [[other->repeatedUint64Array copyWithZone:[other->repeatedUint64Array zone]] autorelease];
     } else {
-      [result.repeatedUint64Array appendArray:other.repeatedUint64Array];
+      [result->repeatedUint64Array appendArray:other->repeatedUint64Array];
     }
   }
-  if (other.repeatedSint32Array.count > 0) {
-    if (result.repeatedSint32Array == nil) {
-      result.repeatedSint32Array = [[other.repeatedSint32Array copyWithZone:[other.repeatedSint32Array zone]] autorelease];
+  if (other->repeatedSint32Array.count > 0) {
+    if (result->repeatedSint32Array == nil) {
+      result.repeatedSint32Array = [[other->repeatedSint32Array copyWithZone:[other->repeatedSint32Array zone]] autorelease];
     } else {
-      [result.repeatedSint32Array appendArray:other.repeatedSint32Array];
+      [result->repeatedSint32Array appendArray:other->repeatedSint32Array];
     }
   }
-  if (other.repeatedSint64Array.count > 0) {
-    if (result.repeatedSint64Array == nil) {
-      result.repeatedSint64Array = [[other.repeatedSint64Array copyWithZone:[other.repeatedSint64Array zone]] autorelease];
+  if (other->repeatedSint64Array.count > 0) {
+    if (result->repeatedSint64Array == nil) {
+      result.repeatedSint64Array = [[other->repeatedSint64Array copyWithZone:[other->repeatedSint64Array zone]] autorelease];
     } else {
-      [result.repeatedSint64Array appendArray:other.repeatedSint64Array];
+      [result->repeatedSint64Array appendArray:other->repeatedSint64Array];
     }
   }
-  if (other.repeatedFixed32Array.count > 0) {
-    if (result.repeatedFixed32Array == nil) {
-      result.repeatedFixed32Array = [[other.repeatedFixed32Array copyWithZone:[other.repeatedFixed32Array zone]] autorelease];
+  if (other->repeatedFixed32Array.count > 0) {
+    if (result->repeatedFixed32Array == nil) {
+      result.repeatedFixed32Array = [[other->repeatedFixed32Array copyWithZone:[other->repeatedFixed32Array zone]] autorelease];
     } else {
-      [result.repeatedFixed32Array appendArray:other.repeatedFixed32Array];
+      [result->repeatedFixed32Array appendArray:other->repeatedFixed32Array];
     }
   }
-  if (other.repeatedFixed64Array.count > 0) {
-    if (result.repeatedFixed64Array == nil) {
-      result.repeatedFixed64Array = [[other.repeatedFixed64Array copyWithZone:[other.repeatedFixed64Array zone]] autorelease];
+  if (other->repeatedFixed64Array.count > 0) {
+    if (result->repeatedFixed64Array == nil) {
+      result.repeatedFixed64Array = [[other->repeatedFixed64Array copyWithZone:[other->repeatedFixed64Array zone]] autorelease];
     } else {
-      [result.repeatedFixed64Array appendArray:other.repeatedFixed64Array];
+      [result->repeatedFixed64Array appendArray:other->repeatedFixed64Array];
     }
   }
-  if (other.repeatedSfixed32Array.count > 0) {
-    if (result.repeatedSfixed32Array == nil) {
-      result.repeatedSfixed32Array = [[other.repeatedSfixed32Array copyWithZone:[other.repeatedSfixed32Array zone]] autorelease];
+  if (other->repeatedSfixed32Array.count > 0) {
+    if (result->repeatedSfixed32Array == nil) {
+      result.repeatedSfixed32Array = [[other->repeatedSfixed32Array copyWithZone:[other->repeatedSfixed32Array zone]] autorelease];
     } else {
-      [result.repeatedSfixed32Array appendArray:other.repeatedSfixed32Array];
+      [result->repeatedSfixed32Array appendArray:other->repeatedSfixed32Array];
     }
   }
-  if (other.repeatedSfixed64Array.count > 0) {
-    if (result.repeatedSfixed64Array == nil) {
-      result.repeatedSfixed64Array = [[other.repeatedSfixed64Array copyWithZone:[other.repeatedSfixed64Array zone]] autorelease];
+  if (other->repeatedSfixed64Array.count > 0) {
+    if (result->repeatedSfixed64Array == nil) {
+      result.repeatedSfixed64Array = [[other->repeatedSfixed64Array copyWithZone:[other->repeatedSfixed64Array zone]] autorelease];
     } else {
-      [result.repeatedSfixed64Array appendArray:other.repeatedSfixed64Array];
+      [result->repeatedSfixed64Array appendArray:other->repeatedSfixed64Array];
     }
   }
-  if (other.repeatedFloatArray.count > 0) {
-    if (result.repeatedFloatArray == nil) {
-      result.repeatedFloatArray = [[other.repeatedFloatArray copyWithZone:[other.repeatedFloatArray zone]] autorelease];
+  if (other->repeatedFloatArray.count > 0) {
+    if (result->repeatedFloatArray == nil) {
+      result.repeatedFloatArray = [[other->repeatedFloatArray copyWithZone:[other->repeatedFloatArray zone]] autorelease];
     } else {
-      [result.repeatedFloatArray appendArray:other.repeatedFloatArray];
+      [result->repeatedFloatArray appendArray:other->repeatedFloatArray];
     }
   }
-  if (other.repeatedDoubleArray.count > 0) {
-    if (result.repeatedDoubleArray == nil) {
-      result.repeatedDoubleArray = [[other.repeatedDoubleArray copyWithZone:[other.repeatedDoubleArray zone]] autorelease];
+  if (other->repeatedDoubleArray.count > 0) {
+    if (result->repeatedDoubleArray == nil) {
+      result.repeatedDoubleArray = [[other->repeatedDoubleArray copyWithZone:[other->repeatedDoubleArray zone]] autorelease];
     } else {
-      [result.repeatedDoubleArray appendArray:other.repeatedDoubleArray];
+      [result->repeatedDoubleArray appendArray:other->repeatedDoubleArray];
     }
   }
-  if (other.repeatedBoolArray.count > 0) {
-    if (result.repeatedBoolArray == nil) {
-      result.repeatedBoolArray = [[other.repeatedBoolArray copyWithZone:[other.repeatedBoolArray zone]] autorelease];
+  if (other->repeatedBoolArray.count > 0) {
+    if (result->repeatedBoolArray == nil) {
+      result.repeatedBoolArray = [[other->repeatedBoolArray copyWithZone:[other->repeatedBoolArray zone]] autorelease];
     } else {
-      [result.repeatedBoolArray appendArray:other.repeatedBoolArray];
+      [result->repeatedBoolArray appendArray:other->repeatedBoolArray];
     }
   }
-  if (other.repeatedStringArray.count > 0) {
-    if (result.repeatedStringArray == nil) {
-      result.repeatedStringArray = [[other.repeatedStringArray copyWithZone:[other.repeatedStringArray zone]] autorelease];
+  if (other->repeatedStringArray.count > 0) {
+    if (result->repeatedStringArray == nil) {
+      result.repeatedStringArray = [[other->repeatedStringArray copyWithZone:[other->repeatedStringArray zone]] autorelease];
     } else {
-      [result.repeatedStringArray appendArray:other.repeatedStringArray];
+      [result->repeatedStringArray appendArray:other->repeatedStringArray];
     }
   }
-  if (other.repeatedBytesArray.count > 0) {
-    if (result.repeatedBytesArray == nil) {
-      result.repeatedBytesArray = [[other.repeatedBytesArray copyWithZone:[other.repeatedBytesArray zone]] autorelease];
+  if (other->repeatedBytesArray.count > 0) {
+    if (result->repeatedBytesArray == nil) {
+      result.repeatedBytesArray = [[other->repeatedBytesArray copyWithZone:[other->repeatedBytesArray zone]] autorelease];
     } else {
-      [result.repeatedBytesArray appendArray:other.repeatedBytesArray];
+      [result->repeatedBytesArray appendArray:other->repeatedBytesArray];
     }
   }
-  if (other.repeatedGroupArray.count > 0) {
-    if (result.repeatedGroupArray == nil) {
-      result.repeatedGroupArray = [[other.repeatedGroupArray copyWithZone:[other.repeatedGroupArray zone]] autorelease];
+  if (other->repeatedGroupArray.count > 0) {
+    if (result->repeatedGroupArray == nil) {
+      result.repeatedGroupArray = [[other->repeatedGroupArray copyWithZone:[other->repeatedGroupArray zone]] autorelease];
     } else {
-      [result.repeatedGroupArray appendArray:other.repeatedGroupArray];
+      [result->repeatedGroupArray appendArray:other->repeatedGroupArray];
     }
   }
-  if (other.repeatedNestedMessageArray.count > 0) {
-    if (result.repeatedNestedMessageArray == nil) {
-      result.repeatedNestedMessageArray = [[other.repeatedNestedMessageArray copyWithZone:[other.repeatedNestedMessageArray zone]] autorelease];
+  if (other->repeatedNestedMessageArray.count > 0) {
+    if (result->repeatedNestedMessageArray == nil) {
+      result.repeatedNestedMessageArray = [[other->repeatedNestedMessageArray copyWithZone:[other->repeatedNestedMessageArray zone]] autorelease];
     } else {
-      [result.repeatedNestedMessageArray appendArray:other.repeatedNestedMessageArray];
+      [result->repeatedNestedMessageArray appendArray:other->repeatedNestedMessageArray];
     }
   }
-  if (other.repeatedForeignMessageArray.count > 0) {
-    if (result.repeatedForeignMessageArray == nil) {
-      result.repeatedForeignMessageArray = [[other.repeatedForeignMessageArray copyWithZone:[other.repeatedForeignMessageArray zone]] autorelease];
+  if (other->repeatedForeignMessageArray.count > 0) {
+    if (result->repeatedForeignMessageArray == nil) {
+      result.repeatedForeignMessageArray = [[other->repeatedForeignMessageArray copyWithZone:[other->repeatedForeignMessageArray zone]] autorelease];
     } else {
-      [result.repeatedForeignMessageArray appendArray:other.repeatedForeignMessageArray];
+      [result->repeatedForeignMessageArray appendArray:other->repeatedForeignMessageArray];
     }
   }
-  if (other.repeatedImportMessageArray.count > 0) {
-    if (result.repeatedImportMessageArray == nil) {
-      result.repeatedImportMessageArray = [[other.repeatedImportMessageArray copyWithZone:[other.repeatedImportMessageArray zone]] autorelease];
+  if (other->repeatedImportMessageArray.count > 0) {
+    if (result->repeatedImportMessageArray == nil) {
+      result.repeatedImportMessageArray = [[other->repeatedImportMessageArray copyWithZone:[other->repeatedImportMessageArray zone]] autorelease];
     } else {
-      [result.repeatedImportMessageArray appendArray:other.repeatedImportMessageArray];
+      [result->repeatedImportMessageArray appendArray:other->repeatedImportMessageArray];
     }
   }
-  if (other.repeatedNestedEnumArray.count > 0) {
-    if (result.repeatedNestedEnumArray == nil) {
-      result.repeatedNestedEnumArray = [[other.repeatedNestedEnumArray copyWithZone:[other.repeatedNestedEnumArray zone]] autorelease];
+  if (other->repeatedNestedEnumArray.count > 0) {
+    if (result->repeatedNestedEnumArray == nil) {
+      result.repeatedNestedEnumArray = [[other->repeatedNestedEnumArray copyWithZone:[other->repeatedNestedEnumArray zone]] autorelease];
     } else {
-      [result.repeatedNestedEnumArray appendArray:other.repeatedNestedEnumArray];
+      [result->repeatedNestedEnumArray appendArray:other->repeatedNestedEnumArray];
     }
   }
-  if (other.repeatedForeignEnumArray.count > 0) {
-    if (result.repeatedForeignEnumArray == nil) {
-      result.repeatedForeignEnumArray = [[other.repeatedForeignEnumArray copyWithZone:[other.repeatedForeignEnumArray zone]] autorelease];
+  if (other->repeatedForeignEnumArray.count > 0) {
+    if (result->repeatedForeignEnumArray == nil) {
+      result.repeatedForeignEnumArray = [[other->repeatedForeignEnumArray copyWithZone:[other->repeatedForeignEnumArray zone]] autorelease];
     } else {
-      [result.repeatedForeignEnumArray appendArray:other.repeatedForeignEnumArray];
+      [result->repeatedForeignEnumArray appendArray:other->repeatedForeignEnumArray];
     }
   }
-  if (other.repeatedImportEnumArray.count > 0) {
-    if (result.repeatedImportEnumArray == nil) {
-      result.repeatedImportEnumArray = [[other.repeatedImportEnumArray copyWithZone:[other.repeatedImportEnumArray zone]] autorelease];
+  if (other->repeatedImportEnumArray.count > 0) {
+    if (result->repeatedImportEnumArray == nil) {
+      result.repeatedImportEnumArray = [[other->repeatedImportEnumArray copyWithZone:[other->repeatedImportEnumArray zone]] autorelease];
     } else {
-      [result.repeatedImportEnumArray appendArray:other.repeatedImportEnumArray];
+      [result->repeatedImportEnumArray appendArray:other->repeatedImportEnumArray];
     }
   }
-  if (other.repeatedStringPieceArray.count > 0) {
-    if (result.repeatedStringPieceArray == nil) {
-      result.repeatedStringPieceArray = [[other.repeatedStringPieceArray copyWithZone:[other.repeatedStringPieceArray zone]] autorelease];
+  if (other->repeatedStringPieceArray.count > 0) {
+    if (result->repeatedStringPieceArray == nil) {
+      result.repeatedStringPieceArray = [[other->repeatedStringPieceArray copyWithZone:[other->repeatedStringPieceArray zone]] autorelease];
     } else {
-      [result.repeatedStringPieceArray appendArray:other.repeatedStringPieceArray];
+      [result->repeatedStringPieceArray appendArray:other->repeatedStringPieceArray];
     }
   }
-  if (other.repeatedCordArray.count > 0) {
-    if (result.repeatedCordArray == nil) {
-      result.repeatedCordArray = [[other.repeatedCordArray copyWithZone:[other.repeatedCordArray zone]] autorelease];
+  if (other->repeatedCordArray.count > 0) {
+    if (result->repeatedCordArray == nil) {
+      result.repeatedCordArray = [[other->repeatedCordArray copyWithZone:[other->repeatedCordArray zone]] autorelease];
     } else {
-      [result.repeatedCordArray appendArray:other.repeatedCordArray];
+      [result->repeatedCordArray appendArray:other->repeatedCordArray];
     }
   }
-  if (other.hasDefaultInt32) {
-    [self setDefaultInt32:other.defaultInt32];
+  if (other->hasBits_[0] & 0x1000000u) {
+    [self setDefaultInt32:other->defaultInt32];
   }
-  if (other.hasDefaultInt64) {
-    [self setDefaultInt64:other.defaultInt64];
+  if (other->hasBits_[0] & 0x2000000u) {
+    [self setDefaultInt64:other->defaultInt64];
   }
-  if (other.hasDefaultUint32) {
-    [self setDefaultUint32:other.defaultUint32];
+  if (other->hasBits_[0] & 0x4000000u) {
+    [self setDefaultUint32:other->defaultUint32];
   }
-  if (other.hasDefaultUint64) {
-    [self setDefaultUint64:other.defaultUint64];
+  if (other->hasBits_[0] & 0x8000000u) {
+    [self setDefaultUint64:other->defaultUint64];
   }
-  if (other.hasDefaultSint32) {
-    [self setDefaultSint32:other.defaultSint32];
+  if (other->hasBits_[0] & 0x10000000u) {
+    [self setDefaultSint32:other->defaultSint32];
   }
-  if (other.hasDefaultSint64) {
-    [self setDefaultSint64:other.defaultSint64];
+  if (other->hasBits_[0] & 0x20000000u) {
+    [self setDefaultSint64:other->defaultSint64];
   }
-  if (other.hasDefaultFixed32) {
-    [self setDefaultFixed32:other.defaultFixed32];
+  if (other->hasBits_[0] & 0x40000000u) {
+    [self setDefaultFixed32:other->defaultFixed32];
   }
-  if (other.hasDefaultFixed64) {
-    [self setDefaultFixed64:other.defaultFixed64];
+  if (other->hasBits_[0] & 0x80000000u) {
+    [self setDefaultFixed64:other->defaultFixed64];
   }
-  if (other.hasDefaultSfixed32) {
-    [self setDefaultSfixed32:other.defaultSfixed32];
+  if (other->hasBits_[1] & 0x1u) {
+    [self setDefaultSfixed32:other->defaultSfixed32];
   }
-  if (other.hasDefaultSfixed64) {
-    [self setDefaultSfixed64:other.defaultSfixed64];
+  if (other->hasBits_[1] & 0x2u) {
+    [self setDefaultSfixed64:other->defaultSfixed64];
   }
-  if (other.hasDefaultFloat) {
-    [self setDefaultFloat:other.defaultFloat];
+  if (other->hasBits_[1] & 0x4u) {
+    [self setDefaultFloat:other->defaultFloat];
   }
-  if (other.hasDefaultDouble) {
-    [self setDefaultDouble:other.defaultDouble];
+  if (other->hasBits_[1] & 0x8u) {
+    [self setDefaultDouble:other->defaultDouble];
   }
-  if (other.hasDefaultBool) {
-    [self setDefaultBool:other.defaultBool];
+  if (other->hasBits_[1] & 0x10u) {
+    [self setDefaultBool:other->defaultBool_];
   }
-  if (other.hasDefaultString) {
-    [self setDefaultString:other.defaultString];
+  if (other->hasBits_[1] & 0x20u) {
+    [self setDefaultString:other->defaultString];
   }
-  if (other.hasDefaultBytes) {
-    [self setDefaultBytes:other.defaultBytes];
+  if (other->hasBits_[1] & 0x40u) {
+    [self setDefaultBytes:other->defaultBytes];
   }
-  if (other.hasDefaultNestedEnum) {
-    [self setDefaultNestedEnum:other.defaultNestedEnum];
+  if (other->hasBits_[1] & 0x80u) {
+    [self setDefaultNestedEnum:other->defaultNestedEnum];
   }
-  if (other.hasDefaultForeignEnum) {
-    [self setDefaultForeignEnum:other.defaultForeignEnum];
+  if (other->hasBits_[1] & 0x100u) {
+    [self setDefaultForeignEnum:other->defaultForeignEnum];
   }
-  if (other.hasDefaultImportEnum) {
-    [self setDefaultImportEnum:other.defaultImportEnum];
+  if (other->hasBits_[1] & 0x200u) {
+    [self setDefaultImportEnum:other->defaultImportEnum];
   }
-  if (other.hasDefaultStringPiece) {
-    [self setDefaultStringPiece:other.defaultStringPiece];
+  if (other->hasBits_[1] & 0x400u) {
+    [self setDefaultStringPiece:other->defaultStringPiece];
   }
-  if (other.hasDefaultCord) {
-    [self setDefaultCord:other.defaultCord];
+  if (other->hasBits_[1] & 0x800u) {
+    [self setDefaultCord:other->defaultCord];
   }
-  [self mergeUnknownFields:other.unknownFields];
   return self;
 }
 - (TestAllTypesLite_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input {
   return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
 }
 - (TestAllTypesLite_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
   while (YES) {
     int32_t tag = [input readTag];
     switch (tag) {
       case 0:
-        [self setUnknownFields:[unknownFields build]];
         return self;
       default: {
-        if (![self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag]) {
-          [self setUnknownFields:[unknownFields build]];
+        if (PBWireFormatGetTagWireType(tag) == PBWireFormatEndGroup) {
           return self;
         }
+        [input skipField:tag];
         break;
       }
       case 8: {
@@ -4203,55 +4573,69 @@ static TestAllTypesLite_RepeatedGroup* defaultTestAllTypesLite_RepeatedGroupInst
         break;
       }
       case 114: {
-        [self setOptionalString:[input readString]];
+        NSString* value = [input newString];
+        [self setOptionalString:value];
+        [value release];
         break;
       }
       case 122: {
-        [self setOptionalBytes:[input readData]];
+        NSData* value = [input newData];
+        [self setOptionalBytes:value];
+        [value release];
         break;
       }
       case 131: {
-        TestAllTypesLite_OptionalGroup_Builder* subBuilder = [TestAllTypesLite_OptionalGroup builder];
-        if (self.hasOptionalGroup) {
-          [subBuilder mergeFrom:self.optionalGroup];
+        if (optionalGroupBuilder_ == nil) {
+          optionalGroupBuilder_ = optionalGroupSpareBuilder_ != nil ? optionalGroupSpareBuilder_ : [[TestAllTypesLite_OptionalGroup_Builder alloc] init];
+          optionalGroupSpareBuilder_ = nil;
+          if (result->hasBits_[0] & 0x8000u) {
+            [optionalGroupBuilder_ mergeFrom:result->optionalGroup];
+          }
+          result->hasBits_[0] |= 0x8000u;
         }
-        [input readGroup:16 builder:subBuilder extensionRegistry:extensionRegistry];
-        [self setOptionalGroup:[subBuilder buildPartial]];
+        [input readGroup:16 builder:optionalGroupBuilder_ extensionRegistry:extensionRegistry];
         break;
       }
       case 146: {
-        TestAllTypesLite_NestedMessage_Builder* subBuilder = [TestAllTypesLite_NestedMessage builder];
-        if (self.hasOptionalNestedMessage) {
-          [subBuilder mergeFrom:self.optionalNestedMessage];
+        if (optionalNestedMessageBuilder_ == nil) {
+          optionalNestedMessageBuilder_ = optionalNestedMessageSpareBuilder_ != nil ? optionalNestedMessageSpareBuilder_ : [[TestAllTypesLite_NestedMessage_Builder alloc] init];
+          optionalNestedMessageSpareBuilder_ = nil;
+          if (result->hasBits_[0] & 0x10000u) {
+            [optionalNestedMessageBuilder_ mergeFrom:result->optionalNestedMessage];
+          }
+          result->hasBits_[0] |= 0x10000u;
         }
-        [input readMessage:subBuilder extensionRegistry:extensionRegistry];
-        [self setOptionalNestedMessage:[subBuilder buildPartial]];
+        [input readMessage:optionalNestedMessageBuilder_ extensionRegistry:extensionRegistry];
         break;
       }
       case 154: {
-        ForeignMessageLite_Builder* subBuilder = [ForeignMessageLite builder];
-        if (self.hasOptionalForeignMessage) {
-          [subBuilder mergeFrom:self.optionalForeignMessage];
+        if (optionalForeignMessageBuilder_ == nil) {
+          optionalForeignMessageBuilder_ = optionalForeignMessageSpareBuilder_ != nil ? optionalForeignMessageSpareBuilder_ : [[ForeignMessageLite_Builder alloc] init];
+          optionalForeignMessageSpareBuilder_ = nil;
+          if (result->hasBits_[0] & 0x20000u) {
+            [optionalForeignMessageBuilder_ mergeFrom:result->optionalForeignMessage];
+          }
+          result->hasBits_[0] |= 0x20000u;
         }
-        [input readMessage:subBuilder extensionRegistry:extensionRegistry];
-        [self setOptionalForeignMessage:[subBuilder buildPartial]];
+        [input readMessage:optionalForeignMessageBuilder_ extensionRegistry:extensionRegistry];
         break;
       }
       case 162: {
-        ImportMessageLite_Builder* subBuilder = [ImportMessageLite builder];
-        if (self.hasOptionalImportMessage) {
-          [subBuilder mergeFrom:self.optionalImportMessage];
+        if (optionalImportMessageBuilder_ == nil) {
+          optionalImportMessageBuilder_ = optionalImportMessageSpareBuilder_ != nil ? optionalImportMessageSpareBuilder_ : [[ImportMessageLite_Builder alloc] init];
+          optionalImportMessageSpareBuilder_ = nil;
+          if (result->hasBits_[0] & 0x40000u) {
+            [optionalImportMessageBuilder_ mergeFrom:result->optionalImportMessage];
+          }
+          result->hasBits_[0] |= 0x40000u;
         }
-        [input readMessage:subBuilder extensionRegistry:extensionRegistry];
-        [self setOptionalImportMessage:[subBuilder buildPartial]];
+        [input readMessage:optionalImportMessageBuilder_ extensionRegistry:extensionRegistry];
         break;
       }
       case 168: {
         int32_t value = [input readEnum];
         if (TestAllTypesLite_NestedEnumIsValidValue(value)) {
           [self setOptionalNestedEnum:value];
-        } else {
-          [unknownFields mergeVarintField:21 value:value];
         }
         break;
       }
@@ -4259,8 +4643,6 @@ static TestAllTypesLite_RepeatedGroup* defaultTestAllTypesLite_RepeatedGroupInst
         int32_t value = [input readEnum];
         if (ForeignEnumLiteIsValidValue(value)) {
           [self setOptionalForeignEnum:value];
-        } else {
-          [unknownFields mergeVarintField:22 value:value];
         }
         break;
       }
@@ -4268,136 +4650,324 @@ static TestAllTypesLite_RepeatedGroup* defaultTestAllTypesLite_RepeatedGroupInst
         int32_t value = [input readEnum];
         if (ImportEnumLiteIsValidValue(value)) {
           [self setOptionalImportEnum:value];
-        } else {
-          [unknownFields mergeVarintField:23 value:value];
         }
         break;
       }
       case 194: {
-        [self setOptionalStringPiece:[input readString]];
+        NSString* value = [input newString];
+        [self setOptionalStringPiece:value];
+        [value release];
         break;
       }
       case 202: {
-        [self setOptionalCord:[input readString]];
+        NSString* value = [input newString];
+        [self setOptionalCord:value];
+        [value release];
         break;
       }
       case 248: {
-        [self addRepeatedInt32:[input readInt32]];
+        if (result->repeatedInt32Array == nil) {
+          result.repeatedInt32Array = [PBInt32Array array];
+        }
+        PBInt32Array *values = result->repeatedInt32Array;
+        const int32_t count = [input countBufferedRepeatedField:248];
+        [values reserveCapacity:values.count + count inArena:input.arena];
+        PBInt32ArrayAddValue(values, [input readInt32]);
+        for (int32_t i = 1; i < count; ++i) {
+          [input readTag];
+          PBInt32ArrayAddValue(values, [input readInt32]);
+        }
         break;
       }
       case 256: {
-        [self addRepeatedInt64:[input readInt64]];
+        if (result->repeatedInt64Array == nil) {
+          result.repeatedInt64Array = [PBInt64Array array];
+        }
+        PBInt64Array *values = result->repeatedInt64Array;
+        const int32_t count = [input countBufferedRepeatedField:256];
+        [values reserveCapacity:values.count + count inArena:input.arena];
+        PBInt64ArrayAddValue(values, [input readInt64]);
+        for (int32_t i = 1; i < count; ++i) {
+          [input readTag];
+          PBInt64ArrayAddValue(values, [input readInt64]);
+        }
         break;
       }
       case 264: {
-        [self addRepeatedUint32:[input readUInt32]];
+        if (result->repeatedUint32Array == nil) {
+          result.repeatedUint32Array = [PBUInt32Array array];
+        }
+        PBUInt32Array *values = result->repeatedUint32Array;
+        const int32_t count = [input countBufferedRepeatedField:264];
+        [values reserveCapacity:values.count + count inArena:input.arena];
+        PBUInt32ArrayAddValue(values, [input readUInt32]);
+        for (int32_t i = 1; i < count; ++i) {
+          [input readTag];
+          PBUInt32ArrayAddValue(values, [input readUInt32]);
+        }
         break;
       }
       case 272: {
-        [self addRepeatedUint64:[input readUInt64]];
+        if (result->repeatedUint64Array == nil) {
+          result.repeatedUint64Array = [PBUInt64Array array];
+        }
+        PBUInt64Array *values = result->repeatedUint64Array;
+        const int32_t count = [input countBufferedRepeatedField:272];
+        [values reserveCapacity:values.count + count inArena:input.arena];
+        PBUInt64ArrayAddValue(values, [input readUInt64]);
+        for (int32_t i = 1; i < count; ++i) {
+          [input readTag];
+          PBUInt64ArrayAddValue(values, [input readUInt64]);
+        }
         break;
       }
       case 280: {
-        [self addRepeatedSint32:[input readSInt32]];
+        if (result->repeatedSint32Array == nil) {
+          result.repeatedSint32Array = [PBInt32Array array];
+        }
+        PBInt32Array *values = result->repeatedSint32Array;
+        const int32_t count = [input countBufferedRepeatedField:280];
+        [values reserveCapacity:values.count + count inArena:input.arena];
+        PBInt32ArrayAddValue(values, [input readSInt32]);
+        for (int32_t i = 1; i < count; ++i) {
+          [input readTag];
+          PBInt32ArrayAddValue(values, [input readSInt32]);
+        }
         break;
       }
       case 288: {
-        [self addRepeatedSint64:[input readSInt64]];
+        if (result->repeatedSint64Array == nil) {
+          result.repeatedSint64Array = [PBInt64Array array];
+        }
+        PBInt64Array *values = result->repeatedSint64Array;
+        const int32_t count = [input countBufferedRepeatedField:288];
+        [values reserveCapacity:values.count + count inArena:input.arena];
+        PBInt64ArrayAddValue(values, [input readSInt64]);
+        for (int32_t i = 1; i < count; ++i) {
+          [input readTag];
+          PBInt64ArrayAddValue(values, [input readSInt64]);
+        }
         break;
       }
       case 301: {
-        [self addRepeatedFixed32:[input readFixed32]];
+        if (result->repeatedFixed32Array == nil) {
+          result.repeatedFixed32Array = [PBUInt32Array array];
+        }
+        PBUInt32Array *values = result->repeatedFixed32Array;
+        const int32_t count = [input countBufferedRepeatedField:301];
+        [values reserveCapacity:values.count + count inArena:input.arena];
+        PBUInt32ArrayAddValue(values, [input readFixed32]);
+        for (int32_t i = 1; i < count; ++i) {
+          [input readTag];
+          PBUInt32ArrayAddValue(values, [input readFixed32]);
+        }
         break;
       }
       case 305: {
-        [self addRepeatedFixed64:[input readFixed64]];
+        if (result->repeatedFixed64Array == nil) {
+          result.repeatedFixed64Array = [PBUInt64Array array];
+        }
+        PBUInt64Array *values = result->repeatedFixed64Array;
+        const int32_t count = [input countBufferedRepeatedField:305];
+        [values reserveCapacity:values.count + count inArena:input.arena];
+        PBUInt64ArrayAddValue(values, [input readFixed64]);
+        for (int32_t i = 1; i < count; ++i) {
+          [input readTag];
+          PBUInt64ArrayAddValue(values, [input readFixed64]);
+        }
         break;
       }
       case 317: {
-        [self addRepeatedSfixed32:[input readSFixed32]];
+        if (result->repeatedSfixed32Array == nil) {
+          result.repeatedSfixed32Array = [PBInt32Array array];
+        }
+        PBInt32Array *values = result->repeatedSfixed32Array;
+        const int32_t count = [input countBufferedRepeatedField:317];
+        [values reserveCapacity:values.count + count inArena:input.arena];
+        PBInt32ArrayAddValue(values, [input readSFixed32]);
+        for (int32_t i = 1; i < count; ++i) {
+          [input readTag];
+          PBInt32ArrayAddValue(values, [input readSFixed32]);
+        }
         break;
       }
       case 321: {
-        [self addRepeatedSfixed64:[input readSFixed64]];
+        if (result->repeatedSfixed64Array == nil) {
+          result.repeatedSfixed64Array = [PBInt64Array array];
+        }
+        PBInt64Array *values = result->repeatedSfixed64Array;
+        const int32_t count = [input countBufferedRepeatedField:321];
+        [values reserveCapacity:values.count + count inArena:input.arena];
+        PBInt64ArrayAddValue(values, [input readSFixed64]);
+        for (int32_t i = 1; i < count; ++i) {
+          [input readTag];
+          PBInt64ArrayAddValue(values, [input readSFixed64]);
+        }
         break;
       }
       case 333: {
-        [self addRepeatedFloat:[input readFloat]];
+        if (result->repeatedFloatArray == nil) {
+          result.repeatedFloatArray = [PBFloatArray array];
+        }
+        PBFloatArray *values = result->repeatedFloatArray;
+        const int32_t count = [input countBufferedRepeatedField:333];
+        [values reserveCapacity:values.count + count inArena:input.arena];
+        PBFloatArrayAddValue(values, [input readFloat]);
+        for (int32_t i = 1; i < count; ++i) {
+          [input readTag];
+          PBFloatArrayAddValue(values, [input readFloat]);
+        }
         break;
       }
       case 337: {
-        [self addRepeatedDouble:[input readDouble]];
+        if (result->repeatedDoubleArray == nil) {
+          result.repeatedDoubleArray = [PBDoubleArray array];
+        }
+        PBDoubleArray *values = result->repeatedDoubleArray;
+        const int32_t count = [input countBufferedRepeatedField:337];
+        [values reserveCapacity:values.count + count inArena:input.arena];
+        PBDoubleArrayAddValue(values, [input readDouble]);
+        for (int32_t i = 1; i < count; ++i) {
+          [input readTag];
+          PBDoubleArrayAddValue(values, [input readDouble]);
+        }
         break;
       }
       case 344: {
-        [self addRepeatedBool:[input readBool]];
+        if (result->repeatedBoolArray == nil) {
+          result.repeatedBoolArray = [PBBoolArray array];
+        }
+        PBBoolArray *values = result->repeatedBoolArray;
+        const int32_t count = [input countBufferedRepeatedField:344];
+        [values reserveCapacity:values.count + count inArena:input.arena];
+        PBBoolArrayAddValue(values, [input readBool]);
+        for (int32_t i = 1; i < count; ++i) {
+          [input readTag];
+          PBBoolArrayAddValue(values, [input readBool]);
+        }
         break;
       }
       case 354: {
-        [self addRepeatedString:[input readString]];
+        NSString* value = [input newString];
+        [self addRepeatedString:value];
+        [value release];
         break;
       }
       case 362: {
-        [self addRepeatedBytes:[input readData]];
+        NSData* value = [input newData];
+        [self addRepeatedBytes:value];
+        [value release];
         break;
       }
       case 371: {
-        TestAllTypesLite_RepeatedGroup_Builder* subBuilder = [TestAllTypesLite_RepeatedGroup builder];
-        [input readGroup:46 builder:subBuilder extensionRegistry:extensionRegistry];
-        [self addRepeatedGroup:[subBuilder buildPartial]];
+        TestAllTypesLite_RepeatedGroup_Builder* subBuilder = [[TestAllTypesLite_RepeatedGroup_Builder alloc] init];
+        @try {
+          [input readGroup:46 builder:subBuilder extensionRegistry:extensionRegistry];
+          TestAllTypesLite_RepeatedGroup* value = [subBuilder newBuildPartial];
+          [self addRepeatedGroup:value];
+          [value release];
+        } @finally {
+          [subBuilder release];
+        }
         break;
       }
       case 386: {
-        TestAllTypesLite_NestedMessage_Builder* subBuilder = [TestAllTypesLite_NestedMessage builder];
-        [input readMessage:subBuilder extensionRegistry:extensionRegistry];
-        [self addRepeatedNestedMessage:[subBuilder buildPartial]];
+        TestAllTypesLite_NestedMessage_Builder* subBuilder = [[TestAllTypesLite_NestedMessage_Builder alloc] init];
+        @try {
+          [input readMessage:subBuilder extensionRegistry:extensionRegistry];
+          TestAllTypesLite_NestedMessage* value = [subBuilder newBuildPartial];
+          [self addRepeatedNestedMessage:value];
+          [value release];
+        } @finally {
+          [subBuilder release];
+        }
         break;
       }
       case 394: {
-        ForeignMessageLite_Builder* subBuilder = [ForeignMessageLite builder];
-        [input readMessage:subBuilder extensionRegistry:extensionRegistry];
-        [self addRepeatedForeignMessage:[subBuilder buildPartial]];
+        ForeignMessageLite_Builder* subBuilder = [[ForeignMessageLite_Builder alloc] init];
+        @try {
+          [input readMessage:subBuilder extensionRegistry:extensionRegistry];
+          ForeignMessageLite* value = [subBuilder newBuildPartial];
+          [self addRepeatedForeignMessage:value];
+          [value release];
+        } @finally {
+          [subBuilder release];
+        }
         break;
       }
       case 402: {
-        ImportMessageLite_Builder* subBuilder = [ImportMessageLite builder];
-        [input readMessage:subBuilder extensionRegistry:extensionRegistry];
-        [self addRepeatedImportMessage:[subBuilder buildPartial]];
+        ImportMessageLite_Builder* subBuilder = [[ImportMessageLite_Builder alloc] init];
+        @try {
+          [input readMessage:subBuilder extensionRegistry:extensionRegistry];
+          ImportMessageLite* value = [subBuilder newBuildPartial];
+          [self addRepeatedImportMessage:value];
+          [value release];
+        } @finally {
+          [subBuilder release];
+        }
         break;
       }
       case 408: {
-        int32_t value = [input readEnum];
-        if (TestAllTypesLite_NestedEnumIsValidValue(value)) {
-          [self addRepeatedNestedEnum:value];
-        } else {
-          [unknownFields mergeVarintField:51 value:value];
+        if (result->repeatedNestedEnumArray == nil) {
+          result.repeatedNestedEnumArray = [PBInt32Array array];
+        }
+        const int32_t count = [input countBufferedRepeatedField:408];
+        [result->repeatedNestedEnumArray reserveCapacity:result->repeatedNestedEnumArray.count + count inArena:input.arena];
+        for (int32_t i = 0; i < count; ++i) {
+          if (i > 0) {
+            [input readTag];
+          }
+          int32_t value = [input readEnum];
+          if (TestAllTypesLite_NestedEnumIsValidValue(value)) {
+            [self addRepeatedNestedEnum:value];
+          }
         }
         break;
       }
       case 416: {
-        int32_t value = [input readEnum];
-        if (ForeignEnumLiteIsValidValue(value)) {
-          [self addRepeatedForeignEnum:value];
-        } else {
-          [unknownFields mergeVarintField:52 value:value];
+        if (result->repeatedForeignEnumArray == nil) {
+          result.repeatedForeignEnumArray = [PBInt32Array array];
+        }
+        const int32_t count = [input countBufferedRepeatedField:416];
+        [result->repeatedForeignEnumArray reserveCapacity:result->repeatedForeignEnumArray.count + count inArena:input.arena];
+        for (int32_t i = 0; i < count; ++i) {
+          if (i > 0) {
+            [input readTag];
+          }
+          int32_t value = [input readEnum];
+          if (ForeignEnumLiteIsValidValue(value)) {
+            [self addRepeatedForeignEnum:value];
+          }
         }
         break;
       }
       case 424: {
-        int32_t value = [input readEnum];
-        if (ImportEnumLiteIsValidValue(value)) {
-          [self addRepeatedImportEnum:value];
-        } else {
-          [unknownFields mergeVarintField:53 value:value];
+        if (result->repeatedImportEnumArray == nil) {
+          result.repeatedImportEnumArray = [PBInt32Array array];
+        }
+        const int32_t count = [input countBufferedRepeatedField:424];
+        [result->repeatedImportEnumArray reserveCapacity:result->repeatedImportEnumArray.count + count inArena:input.arena];
+        for (int32_t i = 0; i < count; ++i) {
+          if (i > 0) {
+            [input readTag];
+          }
+          int32_t value = [input readEnum];
+          if (ImportEnumLiteIsValidValue(value)) {
+            [self addRepeatedImportEnum:value];
+          }
         }
         break;
       }
       case 434: {
-        [self addRepeatedStringPiece:[input readString]];
+        NSString* value = [input newString];
+        [self addRepeatedStringPiece:value];
+        [value release];
         break;
       }
       case 442: {
-        [self addRepeatedCord:[input readString]];
+        NSString* value = [input newString];
+        [self addRepeatedCord:value];
+        [value release];
         break;
       }
       case 488: {
@@ -4453,19 +5023,21 @@ static TestAllTypesLite_RepeatedGroup* defaultTestAllTypesLite_RepeatedGroupInst
         break;
       }
       case 594: {
-        [self setDefaultString:[input readString]];
+        NSString* value = [input newString];
+        [self setDefaultString:value];
+        [value release];
         break;
       }
       case 602: {
-        [self setDefaultBytes:[input readData]];
+        NSData* value = [input newData];
+        [self setDefaultBytes:value];
+        [value release];
         break;
       }
       case 648: {
         int32_t value = [input readEnum];
         if (TestAllTypesLite_NestedEnumIsValidValue(value)) {
           [self setDefaultNestedEnum:value];
-        } else {
-          [unknownFields mergeVarintField:81 value:value];
         }
         break;
       }
@@ -4473,8 +5045,6 @@ static TestAllTypesLite_RepeatedGroup* defaultTestAllTypesLite_RepeatedGroupInst
         int32_t value = [input readEnum];
         if (ForeignEnumLiteIsValidValue(value)) {
           [self setDefaultForeignEnum:value];
-        } else {
-          [unknownFields mergeVarintField:82 value:value];
         }
         break;
       }
@@ -4482,270 +5052,370 @@ static TestAllTypesLite_RepeatedGroup* defaultTestAllTypesLite_RepeatedGroupInst
         int32_t value = [input readEnum];
         if (ImportEnumLiteIsValidValue(value)) {
           [self setDefaultImportEnum:value];
-        } else {
-          [unknownFields mergeVarintField:83 value:value];
         }
         break;
       }
       case 674: {
-        [self setDefaultStringPiece:[input readString]];
+        NSString* value = [input newString];
+        [self setDefaultStringPiece:value];
+        [value release];
         break;
       }
       case 682: {
-        [self setDefaultCord:[input readString]];
+        NSString* value = [input newString];
+        [self setDefaultCord:value];
+        [value release];
         break;
       }
     }
   }
 }
 - (BOOL) hasOptionalInt32 {
-  return result.hasOptionalInt32;
+  return (result->hasBits_[0] & 0x1u) != 0;
 }
 - (int32_t) optionalInt32 {
-  return result.optionalInt32;
+  return result->optionalInt32;
 }
 - (TestAllTypesLite_Builder*) setOptionalInt32:(int32_t) value {
-  result.hasOptionalInt32 = YES;
-  result.optionalInt32 = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x1u;
+  result->optionalInt32 = value;
   return self;
 }
 - (TestAllTypesLite_Builder*) clearOptionalInt32 {
-  result.hasOptionalInt32 = NO;
-  result.optionalInt32 = 0;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x1u;
+  result->optionalInt32 = 0;
   return self;
 }
 - (BOOL) hasOptionalInt64 {
-  return result.hasOptionalInt64;
+  return (result->hasBits_[0] & 0x2u) != 0;
 }
 - (int64_t) optionalInt64 {
-  return result.optionalInt64;
+  return result->optionalInt64;
 }
 - (TestAllTypesLite_Builder*) setOptionalInt64:(int64_t) value {
-  result.hasOptionalInt64 = YES;
-  result.optionalInt64 = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x2u;
+  result->optionalInt64 = value;
   return self;
 }
 - (TestAllTypesLite_Builder*) clearOptionalInt64 {
-  result.hasOptionalInt64 = NO;
-  result.optionalInt64 = 0L;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x2u;
+  result->optionalInt64 = 0;
   return self;
 }
 - (BOOL) hasOptionalUint32 {
-  return result.hasOptionalUint32;
+  return (result->hasBits_[0] & 0x4u) != 0;
 }
 - (uint32_t) optionalUint32 {
-  return result.optionalUint32;
+  return result->optionalUint32;
 }
 - (TestAllTypesLite_Builder*) setOptionalUint32:(uint32_t) value {
-  result.hasOptionalUint32 = YES;
-  result.optionalUint32 = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x4u;
+  result->optionalUint32 = value;
   return self;
 }
 - (TestAllTypesLite_Builder*) clearOptionalUint32 {
-  result.hasOptionalUint32 = NO;
-  result.optionalUint32 = 0;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x4u;
+  result->optionalUint32 = 0;
   return self;
 }
 - (BOOL) hasOptionalUint64 {
-  return result.hasOptionalUint64;
+  return (result->hasBits_[0] & 0x8u) != 0;
 }
 - (uint64_t) optionalUint64 {
-  return result.optionalUint64;
+  return result->optionalUint64;
 }
 - (TestAllTypesLite_Builder*) setOptionalUint64:(uint64_t) value {
-  result.hasOptionalUint64 = YES;
-  result.optionalUint64 = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x8u;
+  result->optionalUint64 = value;
   return self;
 }
 - (TestAllTypesLite_Builder*) clearOptionalUint64 {
-  result.hasOptionalUint64 = NO;
-  result.optionalUint64 = 0L;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x8u;
+  result->optionalUint64 = 0;
   return self;
 }
 - (BOOL) hasOptionalSint32 {
-  return result.hasOptionalSint32;
+  return (result->hasBits_[0] & 0x10u) != 0;
 }
 - (int32_t) optionalSint32 {
-  return result.optionalSint32;
+  return result->optionalSint32;
 }
 - (TestAllTypesLite_Builder*) setOptionalSint32:(int32_t) value {
-  result.hasOptionalSint32 = YES;
-  result.optionalSint32 = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x10u;
+  result->optionalSint32 = value;
   return self;
 }
 - (TestAllTypesLite_Builder*) clearOptionalSint32 {
-  result.hasOptionalSint32 = NO;
-  result.optionalSint32 = 0;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x10u;
+  result->optionalSint32 = 0;
   return self;
 }
 - (BOOL) hasOptionalSint64 {
-  return result.hasOptionalSint64;
+  return (result->hasBits_[0] & 0x20u) != 0;
 }
 - (int64_t) optionalSint64 {
-  return result.optionalSint64;
+  return result->optionalSint64;
 }
 - (TestAllTypesLite_Builder*) setOptionalSint64:(int64_t) value {
-  result.hasOptionalSint64 = YES;
-  result.optionalSint64 = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x20u;
+  result->optionalSint64 = value;
   return self;
 }
 - (TestAllTypesLite_Builder*) clearOptionalSint64 {
-  result.hasOptionalSint64 = NO;
-  result.optionalSint64 = 0L;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x20u;
+  result->optionalSint64 = 0;
   return self;
 }
 - (BOOL) hasOptionalFixed32 {
-  return result.hasOptionalFixed32;
+  return (result->hasBits_[0] & 0x40u) != 0;
 }
 - (uint32_t) optionalFixed32 {
-  return result.optionalFixed32;
+  return result->optionalFixed32;
 }
 - (TestAllTypesLite_Builder*) setOptionalFixed32:(uint32_t) value {
-  result.hasOptionalFixed32 = YES;
-  result.optionalFixed32 = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x40u;
+  result->optionalFixed32 = value;
   return self;
 }
 - (TestAllTypesLite_Builder*) clearOptionalFixed32 {
-  result.hasOptionalFixed32 = NO;
-  result.optionalFixed32 = 0;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x40u;
+  result->optionalFixed32 = 0;
   return self;
 }
 - (BOOL) hasOptionalFixed64 {
-  return result.hasOptionalFixed64;
+  return (result->hasBits_[0] & 0x80u) != 0;
 }
 - (uint64_t) optionalFixed64 {
-  return result.optionalFixed64;
+  return result->optionalFixed64;
 }
 - (TestAllTypesLite_Builder*) setOptionalFixed64:(uint64_t) value {
-  result.hasOptionalFixed64 = YES;
-  result.optionalFixed64 = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x80u;
+  result->optionalFixed64 = value;
   return self;
 }
 - (TestAllTypesLite_Builder*) clearOptionalFixed64 {
-  result.hasOptionalFixed64 = NO;
-  result.optionalFixed64 = 0L;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x80u;
+  result->optionalFixed64 = 0;
   return self;
 }
 - (BOOL) hasOptionalSfixed32 {
-  return result.hasOptionalSfixed32;
+  return (result->hasBits_[0] & 0x100u) != 0;
 }
 - (int32_t) optionalSfixed32 {
-  return result.optionalSfixed32;
+  return result->optionalSfixed32;
 }
 - (TestAllTypesLite_Builder*) setOptionalSfixed32:(int32_t) value {
-  result.hasOptionalSfixed32 = YES;
-  result.optionalSfixed32 = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x100u;
+  result->optionalSfixed32 = value;
   return self;
 }
 - (TestAllTypesLite_Builder*) clearOptionalSfixed32 {
-  result.hasOptionalSfixed32 = NO;
-  result.optionalSfixed32 = 0;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x100u;
+  result->optionalSfixed32 = 0;
   return self;
 }
 - (BOOL) hasOptionalSfixed64 {
-  return result.hasOptionalSfixed64;
+  return (result->hasBits_[0] & 0x200u) != 0;
 }
 - (int64_t) optionalSfixed64 {
-  return result.optionalSfixed64;
+  return result->optionalSfixed64;
 }
 - (TestAllTypesLite_Builder*) setOptionalSfixed64:(int64_t) value {
-  result.hasOptionalSfixed64 = YES;
-  result.optionalSfixed64 = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x200u;
+  result->optionalSfixed64 = value;
   return self;
 }
 - (TestAllTypesLite_Builder*) clearOptionalSfixed64 {
-  result.hasOptionalSfixed64 = NO;
-  result.optionalSfixed64 = 0L;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x200u;
+  result->optionalSfixed64 = 0;
   return self;
 }
 - (BOOL) hasOptionalFloat {
-  return result.hasOptionalFloat;
+  return (result->hasBits_[0] & 0x400u) != 0;
 }
 - (Float32) optionalFloat {
-  return result.optionalFloat;
+  return result->optionalFloat;
 }
 - (TestAllTypesLite_Builder*) setOptionalFloat:(Float32) value {
-  result.hasOptionalFloat = YES;
-  result.optionalFloat = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x400u;
+  result->optionalFloat = value;
   return self;
 }
 - (TestAllTypesLite_Builder*) clearOptionalFloat {
-  result.hasOptionalFloat = NO;
-  result.optionalFloat = 0;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x400u;
+  result->optionalFloat = 0;
   return self;
 }
 - (BOOL) hasOptionalDouble {
-  return result.hasOptionalDouble;
+  return (result->hasBits_[0] & 0x800u) != 0;
 }
 - (Float64) optionalDouble {
-  return result.optionalDouble;
+  return result->optionalDouble;
 }
 - (TestAllTypesLite_Builder*) setOptionalDouble:(Float64) value {
-  result.hasOptionalDouble = YES;
-  result.optionalDouble = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x800u;
+  result->optionalDouble = value;
   return self;
 }
 - (TestAllTypesLite_Builder*) clearOptionalDouble {
-  result.hasOptionalDouble = NO;
-  result.optionalDouble = 0;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x800u;
+  result->optionalDouble = 0;
   return self;
 }
 - (BOOL) hasOptionalBool {
-  return result.hasOptionalBool;
+  return (result->hasBits_[0] & 0x1000u) != 0;
 }
 - (BOOL) optionalBool {
-  return result.optionalBool;
+  return !!result->optionalBool_;
 }
 - (TestAllTypesLite_Builder*) setOptionalBool:(BOOL) value {
-  result.hasOptionalBool = YES;
-  result.optionalBool = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x1000u;
+  result->optionalBool_ = !!value;
   return self;
 }
 - (TestAllTypesLite_Builder*) clearOptionalBool {
-  result.hasOptionalBool = NO;
-  result.optionalBool = NO;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x1000u;
+  result->optionalBool_ = 0;
   return self;
 }
 - (BOOL) hasOptionalString {
-  return result.hasOptionalString;
+  return (result->hasBits_[0] & 0x2000u) != 0;
 }
 - (NSString*) optionalString {
-  return result.optionalString;
+  return [result optionalString];
 }
 - (TestAllTypesLite_Builder*) setOptionalString:(NSString*) value {
-  result.hasOptionalString = YES;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x2000u;
   result.optionalString = value;
   return self;
 }
 - (TestAllTypesLite_Builder*) clearOptionalString {
-  result.hasOptionalString = NO;
-  result.optionalString = @"";
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x2000u;
+  [result->optionalString release];
+  result->optionalString = nil;
   return self;
 }
 - (BOOL) hasOptionalBytes {
-  return result.hasOptionalBytes;
+  return (result->hasBits_[0] & 0x4000u) != 0;
 }
 - (NSData*) optionalBytes {
-  return result.optionalBytes;
+  return [result optionalBytes];
 }
 - (TestAllTypesLite_Builder*) setOptionalBytes:(NSData*) value {
-  result.hasOptionalBytes = YES;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x4000u;
   result.optionalBytes = value;
   return self;
 }
 - (TestAllTypesLite_Builder*) clearOptionalBytes {
-  result.hasOptionalBytes = NO;
-  result.optionalBytes = [NSData data];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x4000u;
+  [result->optionalBytes release];
+  result->optionalBytes = nil;
   return self;
 }
 - (BOOL) hasOptionalGroup {
-  return result.hasOptionalGroup;
+  return (result->hasBits_[0] & 0x8000u) != 0;
 }
 - (TestAllTypesLite_OptionalGroup*) optionalGroup {
+  [self freezeSubBuilders];
   return result.optionalGroup;
 }
 - (TestAllTypesLite_Builder*) setOptionalGroup:(TestAllTypesLite_OptionalGroup*) value {
-  result.hasOptionalGroup = YES;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  [optionalGroupBuilder_ release];
+  optionalGroupBuilder_ = nil;
+  result->hasBits_[0] |= 0x8000u;
   result.optionalGroup = value;
   return self;
 }
@@ -4753,29 +5423,48 @@ static TestAllTypesLite_RepeatedGroup* defaultTestAllTypesLite_RepeatedGroupInst
   return [self setOptionalGroup:[builderForValue build]];
 }
 - (TestAllTypesLite_Builder*) mergeOptionalGroup:(TestAllTypesLite_OptionalGroup*) value {
-  if (result.hasOptionalGroup &&
-      result.optionalGroup != [TestAllTypesLite_OptionalGroup defaultInstance]) {
-    result.optionalGroup =
-      [[[TestAllTypesLite_OptionalGroup builderWithPrototype:result.optionalGroup] mergeFrom:value] buildPartial];
-  } else {
-    result.optionalGroup = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (optionalGroupBuilder_ == nil) {
+    if (!(result->hasBits_[0] & 0x8000u) ||
+        result->optionalGroup == [TestAllTypesLite_OptionalGroup defaultInstance]) {
+      result->hasBits_[0] |= 0x8000u;
+      result.optionalGroup = value;
+      return self;
+    }
+    optionalGroupBuilder_ = optionalGroupSpareBuilder_ != nil ? optionalGroupSpareBuilder_ : [[TestAllTypesLite_OptionalGroup_Builder alloc] init];
+    optionalGroupSpareBuilder_ = nil;
+    [optionalGroupBuilder_ mergeFrom:result->optionalGroup];
   }
-  result.hasOptionalGroup = YES;
+  [optionalGroupBuilder_ mergeFrom:value];
   return self;
 }
 - (TestAllTypesLite_Builder*) clearOptionalGroup {
-  result.hasOptionalGroup = NO;
-  result.optionalGroup = [TestAllTypesLite_OptionalGroup defaultInstance];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  [optionalGroupBuilder_ release];
+  optionalGroupBuilder_ = nil;
+  result->hasBits_[0] &= ~0x8000u;
+  [result->optionalGroup release];
+  result->optionalGroup = nil;
   return self;
 }
 - (BOOL) hasOptionalNestedMessage {
-  return result.hasOptionalNestedMessage;
+  return (result->hasBits_[0] & 0x10000u) != 0;
 }
 - (TestAllTypesLite_NestedMessage*) optionalNestedMessage {
+  [self freezeSubBuilders];
   return result.optionalNestedMessage;
 }
 - (TestAllTypesLite_Builder*) setOptionalNestedMessage:(TestAllTypesLite_NestedMessage*) value {
-  result.hasOptionalNestedMessage = YES;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  [optionalNestedMessageBuilder_ release];
+  optionalNestedMessageBuilder_ = nil;
+  result->hasBits_[0] |= 0x10000u;
   result.optionalNestedMessage = value;
   return self;
 }
@@ -4783,29 +5472,48 @@ static TestAllTypesLite_RepeatedGroup* defaultTestAllTypesLite_RepeatedGroupInst
   return [self setOptionalNestedMessage:[builderForValue build]];
 }
 - (TestAllTypesLite_Builder*) mergeOptionalNestedMessage:(TestAllTypesLite_NestedMessage*) value {
-  if (result.hasOptionalNestedMessage &&
-      result.optionalNestedMessage != [TestAllTypesLite_NestedMessage defaultInstance]) {
-    result.optionalNestedMessage =
-      [[[TestAllTypesLite_NestedMessage builderWithPrototype:result.optionalNestedMessage] mergeFrom:value] buildPartial];
-  } else {
-    result.optionalNestedMessage = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (optionalNestedMessageBuilder_ == nil) {
+    if (!(result->hasBits_[0] & 0x10000u) ||
+        result->optionalNestedMessage == [TestAllTypesLite_NestedMessage defaultInstance]) {
+      result->hasBits_[0] |= 0x10000u;
+      result.optionalNestedMessage = value;
+      return self;
+    }
+    optionalNestedMessageBuilder_ = optionalNestedMessageSpareBuilder_ != nil ? optionalNestedMessageSpareBuilder_ : [[TestAllTypesLite_NestedMessage_Builder alloc] init];
+    optionalNestedMessageSpareBuilder_ = nil;
+    [optionalNestedMessageBuilder_ mergeFrom:result->optionalNestedMessage];
   }
-  result.hasOptionalNestedMessage = YES;
+  [optionalNestedMessageBuilder_ mergeFrom:value];
   return self;
 }
 - (TestAllTypesLite_Builder*) clearOptionalNestedMessage {
-  result.hasOptionalNestedMessage = NO;
-  result.optionalNestedMessage = [TestAllTypesLite_NestedMessage defaultInstance];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  [optionalNestedMessageBuilder_ release];
+  optionalNestedMessageBuilder_ = nil;
+  result->hasBits_[0] &= ~0x10000u;
+  [result->optionalNestedMessage release];
+  result->optionalNestedMessage = nil;
   return self;
 }
 - (BOOL) hasOptionalForeignMessage {
-  return result.hasOptionalForeignMessage;
+  return (result->hasBits_[0] & 0x20000u) != 0;
 }
 - (ForeignMessageLite*) optionalForeignMessage {
+  [self freezeSubBuilders];
   return result.optionalForeignMessage;
 }
 - (TestAllTypesLite_Builder*) setOptionalForeignMessage:(ForeignMessageLite*) value {
-  result.hasOptionalForeignMessage = YES;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  [optionalForeignMessageBuilder_ release];
+  optionalForeignMessageBuilder_ = nil;
+  result->hasBits_[0] |= 0x20000u;
   result.optionalForeignMessage = value;
   return self;
 }
@@ -4813,29 +5521,48 @@ static TestAllTypesLite_RepeatedGroup* defaultTestAllTypesLite_RepeatedGroupInst
   return [self setOptionalForeignMessage:[builderForValue build]];
 }
 - (TestAllTypesLite_Builder*) mergeOptionalForeignMessage:(ForeignMessageLite*) value {
-  if (result.hasOptionalForeignMessage &&
-      result.optionalForeignMessage != [ForeignMessageLite defaultInstance]) {
-    result.optionalForeignMessage =
-      [[[ForeignMessageLite builderWithPrototype:result.optionalForeignMessage] mergeFrom:value] buildPartial];
-  } else {
-    result.optionalForeignMessage = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (optionalForeignMessageBuilder_ == nil) {
+    if (!(result->hasBits_[0] & 0x20000u) ||
+        result->optionalForeignMessage == [ForeignMessageLite defaultInstance]) {
+      result->hasBits_[0] |= 0x20000u;
+      result.optionalForeignMessage = value;
+      return self;
+    }
+    optionalForeignMessageBuilder_ = optionalForeignMessageSpareBuilder_ != nil ? optionalForeignMessageSpareBuilder_ : [[ForeignMessageLite_Builder alloc] init];
+    optionalForeignMessageSpareBuilder_ = nil;
+    [optionalForeignMessageBuilder_ mergeFrom:result->optionalForeignMessage];
   }
-  result.hasOptionalForeignMessage = YES;
+  [optionalForeignMessageBuilder_ mergeFrom:value];
   return self;
 }
 - (TestAllTypesLite_Builder*) clearOptionalForeignMessage {
-  result.hasOptionalForeignMessage = NO;
-  result.optionalForeignMessage = [ForeignMessageLite defaultInstance];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  [optionalForeignMessageBuilder_ release];
+  optionalForeignMessageBuilder_ = nil;
+  result->hasBits_[0] &= ~0x20000u;
+  [result->optionalForeignMessage release];
+  result->optionalForeignMessage = nil;
   return self;
 }
 - (BOOL) hasOptionalImportMessage {
-  return result.hasOptionalImportMessage;
+  return (result->hasBits_[0] & 0x40000u) != 0;
 }
 - (ImportMessageLite*) optionalImportMessage {
+  [self freezeSubBuilders];
   return result.optionalImportMessage;
 }
 - (TestAllTypesLite_Builder*) setOptionalImportMessage:(ImportMessageLite*) value {
-  result.hasOptionalImportMessage = YES;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  [optionalImportMessageBuilder_ release];
+  optionalImportMessageBuilder_ = nil;
+  result->hasBits_[0] |= 0x40000u;
   result.optionalImportMessage = value;
   return self;
 }
@@ -4843,1079 +5570,1754 @@ static TestAllTypesLite_RepeatedGroup* defaultTestAllTypesLite_RepeatedGroupInst
   return [self setOptionalImportMessage:[builderForValue build]];
 }
 - (TestAllTypesLite_Builder*) mergeOptionalImportMessage:(ImportMessageLite*) value {
-  if (result.hasOptionalImportMessage &&
-      result.optionalImportMessage != [ImportMessageLite defaultInstance]) {
-    result.optionalImportMessage =
-      [[[ImportMessageLite builderWithPrototype:result.optionalImportMessage] mergeFrom:value] buildPartial];
-  } else {
-    result.optionalImportMessage = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (optionalImportMessageBuilder_ == nil) {
+    if (!(result->hasBits_[0] & 0x40000u) ||
+        result->optionalImportMessage == [ImportMessageLite defaultInstance]) {
+      result->hasBits_[0] |= 0x40000u;
+      result.optionalImportMessage = value;
+      return self;
+    }
+    optionalImportMessageBuilder_ = optionalImportMessageSpareBuilder_ != nil ? optionalImportMessageSpareBuilder_ : [[ImportMessageLite_Builder alloc] init];
+    optionalImportMessageSpareBuilder_ = nil;
+    [optionalImportMessageBuilder_ mergeFrom:result->optionalImportMessage];
   }
-  result.hasOptionalImportMessage = YES;
+  [optionalImportMessageBuilder_ mergeFrom:value];
   return self;
 }
 - (TestAllTypesLite_Builder*) clearOptionalImportMessage {
-  result.hasOptionalImportMessage = NO;
-  result.optionalImportMessage = [ImportMessageLite defaultInstance];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  [optionalImportMessageBuilder_ release];
+  optionalImportMessageBuilder_ = nil;
+  result->hasBits_[0] &= ~0x40000u;
+  [result->optionalImportMessage release];
+  result->optionalImportMessage = nil;
   return self;
 }
 - (BOOL) hasOptionalNestedEnum {
-  return result.hasOptionalNestedEnum;
+  return (result->hasBits_[0] & 0x80000u) != 0;
 }
 - (TestAllTypesLite_NestedEnum) optionalNestedEnum {
-  return result.optionalNestedEnum;
+  return (result->hasBits_[0] & 0x80000u) ? result->optionalNestedEnum : TestAllTypesLite_NestedEnumFoo;
 }
 - (TestAllTypesLite_Builder*) setOptionalNestedEnum:(TestAllTypesLite_NestedEnum) value {
-  result.hasOptionalNestedEnum = YES;
-  result.optionalNestedEnum = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x80000u;
+  result->optionalNestedEnum = value;
   return self;
 }
 - (TestAllTypesLite_Builder*) clearOptionalNestedEnum {
-  result.hasOptionalNestedEnum = NO;
-  result.optionalNestedEnum = TestAllTypesLite_NestedEnumFoo;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x80000u;
+  result->optionalNestedEnum = 0;
   return self;
 }
 - (BOOL) hasOptionalForeignEnum {
-  return result.hasOptionalForeignEnum;
+  return (result->hasBits_[0] & 0x100000u) != 0;
 }
 - (ForeignEnumLite) optionalForeignEnum {
-  return result.optionalForeignEnum;
+  return (result->hasBits_[0] & 0x100000u) ? result->optionalForeignEnum : ForeignEnumLiteForeignLiteFoo;
 }
 - (TestAllTypesLite_Builder*) setOptionalForeignEnum:(ForeignEnumLite) value {
-  result.hasOptionalForeignEnum = YES;
-  result.optionalForeignEnum = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x100000u;
+  result->optionalForeignEnum = value;
   return self;
 }
 - (TestAllTypesLite_Builder*) clearOptionalForeignEnum {
-  result.hasOptionalForeignEnum = NO;
-  result.optionalForeignEnum = ForeignEnumLiteForeignLiteFoo;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x100000u;
+  result->optionalForeignEnum = 0;
   return self;
 }
 - (BOOL) hasOptionalImportEnum {
-  return result.hasOptionalImportEnum;
+  return (result->hasBits_[0] & 0x200000u) != 0;
 }
 - (ImportEnumLite) optionalImportEnum {
-  return result.optionalImportEnum;
+  return (result->hasBits_[0] & 0x200000u) ? result->optionalImportEnum : ImportEnumLiteImportLiteFoo;
 }
 - (TestAllTypesLite_Builder*) setOptionalImportEnum:(ImportEnumLite) value {
-  result.hasOptionalImportEnum = YES;
-  result.optionalImportEnum = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x200000u;
+  result->optionalImportEnum = value;
   return self;
 }
 - (TestAllTypesLite_Builder*) clearOptionalImportEnum {
-  result.hasOptionalImportEnum = NO;
-  result.optionalImportEnum = ImportEnumLiteImportLiteFoo;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x200000u;
+  result->optionalImportEnum = 0;
   return self;
 }
 - (BOOL) hasOptionalStringPiece {
-  return result.hasOptionalStringPiece;
+  return (result->hasBits_[0] & 0x400000u) != 0;
 }
 - (NSString*) optionalStringPiece {
-  return result.optionalStringPiece;
+  return [result optionalStringPiece];
 }
 - (TestAllTypesLite_Builder*) setOptionalStringPiece:(NSString*) value {
-  result.hasOptionalStringPiece = YES;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x400000u;
   result.optionalStringPiece = value;
   return self;
 }
 - (TestAllTypesLite_Builder*) clearOptionalStringPiece {
-  result.hasOptionalStringPiece = NO;
-  result.optionalStringPiece = @"";
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x400000u;
+  [result->optionalStringPiece release];
+  result->optionalStringPiece = nil;
   return self;
 }
 - (BOOL) hasOptionalCord {
-  return result.hasOptionalCord;
+  return (result->hasBits_[0] & 0x800000u) != 0;
 }
 - (NSString*) optionalCord {
-  return result.optionalCord;
+  return [result optionalCord];
 }
 - (TestAllTypesLite_Builder*) setOptionalCord:(NSString*) value {
-  result.hasOptionalCord = YES;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x800000u;
   result.optionalCord = value;
   return self;
 }
 - (TestAllTypesLite_Builder*) clearOptionalCord {
-  result.hasOptionalCord = NO;
-  result.optionalCord = @"";
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x800000u;
+  [result->optionalCord release];
+  result->optionalCord = nil;
   return self;
 }
 - (PBAppendableArray *)repeatedInt32 {
-  return result.repeatedInt32Array;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return result->repeatedInt32Array;
 }
 - (int32_t)repeatedInt32AtIndex:(NSUInteger)index {
   return [result repeatedInt32AtIndex:index];
 }
 - (TestAllTypesLite_Builder *)addRepeatedInt32:(int32_t)value {
-  if (result.repeatedInt32Array == nil) {
-    result.repeatedInt32Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeInt32];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  [result.repeatedInt32Array addInt32:value];
+  if (result->repeatedInt32Array == nil) {
+    result.repeatedInt32Array = [PBInt32Array array];
+  }
+  PBInt32ArrayAddValue(result->repeatedInt32Array, value);
   return self;
 }
 - (TestAllTypesLite_Builder *)setRepeatedInt32Array:(NSArray *)array {
-  result.repeatedInt32Array = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeInt32];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.repeatedInt32Array = [PBInt32Array arrayWithArray:array valueType:PBArrayValueTypeInt32];
+  return self;
+}
+- (TestAllTypesLite_Builder *)setRepeatedInt32:(PBArray *)array {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.repeatedInt32Array = array ? [PBInt32Array arrayWithStorageOfArray:array] : nil;
   return self;
 }
 - (TestAllTypesLite_Builder *)setRepeatedInt32Values:(const int32_t *)values count:(NSUInteger)count {
-  result.repeatedInt32Array = [PBAppendableArray arrayWithValues:values count:count valueType:PBArrayValueTypeInt32];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.repeatedInt32Array = [PBInt32Array arrayWithValues:values count:count valueType:PBArrayValueTypeInt32];
   return self;
 }
 - (TestAllTypesLite_Builder *)clearRepeatedInt32 {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
   result.repeatedInt32Array = nil;
   return self;
 }
 - (PBAppendableArray *)repeatedInt64 {
-  return result.repeatedInt64Array;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return result->repeatedInt64Array;
 }
 - (int64_t)repeatedInt64AtIndex:(NSUInteger)index {
   return [result repeatedInt64AtIndex:index];
 }
 - (TestAllTypesLite_Builder *)addRepeatedInt64:(int64_t)value {
-  if (result.repeatedInt64Array == nil) {
-    result.repeatedInt64Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeInt64];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  [result.repeatedInt64Array addInt64:value];
+  if (result->repeatedInt64Array == nil) {
+    result.repeatedInt64Array = [PBInt64Array array];
+  }
+  PBInt64ArrayAddValue(result->repeatedInt64Array, value);
   return self;
 }
 - (TestAllTypesLite_Builder *)setRepeatedInt64Array:(NSArray *)array {
-  result.repeatedInt64Array = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeInt64];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.repeatedInt64Array = [PBInt64Array arrayWithArray:array valueType:PBArrayValueTypeInt64];
+  return self;
+}
+- (TestAllTypesLite_Builder *)setRepeatedInt64:(PBArray *)array {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.repeatedInt64Array = array ? [PBInt64Array arrayWithStorageOfArray:array] : nil;
   return self;
 }
 - (TestAllTypesLite_Builder *)setRepeatedInt64Values:(const int64_t *)values count:(NSUInteger)count {
-  result.repeatedInt64Array = [PBAppendableArray arrayWithValues:values count:count valueType:PBArrayValueTypeInt64];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.repeatedInt64Array = [PBInt64Array arrayWithValues:values count:count valueType:PBArrayValueTypeInt64];
   return self;
 }
 - (TestAllTypesLite_Builder *)clearRepeatedInt64 {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
   result.repeatedInt64Array = nil;
   return self;
 }
 - (PBAppendableArray *)repeatedUint32 {
-  return result.repeatedUint32Array;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return result->repeatedUint32Array;
 }
 - (uint32_t)repeatedUint32AtIndex:(NSUInteger)index {
   return [result repeatedUint32AtIndex:index];
 }
 - (TestAllTypesLite_Builder *)addRepeatedUint32:(uint32_t)value {
-  if (result.repeatedUint32Array == nil) {
-    result.repeatedUint32Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeUInt32];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  [result.repeatedUint32Array addUint32:value];
+  if (result->repeatedUint32Array == nil) {
+    result.repeatedUint32Array = [PBUInt32Array array];
+  }
+  PBUInt32ArrayAddValue(result->repeatedUint32Array, value);
   return self;
 }
 - (TestAllTypesLite_Builder *)setRepeatedUint32Array:(NSArray *)array {
-  result.repeatedUint32Array = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeUInt32];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.repeatedUint32Array = [PBUInt32Array arrayWithArray:array valueType:PBArrayValueTypeUInt32];
+  return self;
+}
+- (TestAllTypesLite_Builder *)setRepeatedUint32:(PBArray *)array {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.repeatedUint32Array = array ? [PBUInt32Array arrayWithStorageOfArray:array] : nil;
   return self;
 }
 - (TestAllTypesLite_Builder *)setRepeatedUint32Values:(const uint32_t *)values count:(NSUInteger)count {
-  result.repeatedUint32Array = [PBAppendableArray arrayWithValues:values count:count valueType:PBArrayValueTypeUInt32];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.repeatedUint32Array = [PBUInt32Array arrayWithValues:values count:count valueType:PBArrayValueTypeUInt32];
   return self;
 }
 - (TestAllTypesLite_Builder *)clearRepeatedUint32 {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
   result.repeatedUint32Array = nil;
   return self;
 }
 - (PBAppendableArray *)repeatedUint64 {
-  return result.repeatedUint64Array;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return result->repeatedUint64Array;
 }
 - (uint64_t)repeatedUint64AtIndex:(NSUInteger)index {
   return [result repeatedUint64AtIndex:index];
 }
 - (TestAllTypesLite_Builder *)addRepeatedUint64:(uint64_t)value {
-  if (result.repeatedUint64Array == nil) {
-    result.repeatedUint64Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeUInt64];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  [result.repeatedUint64Array addUint64:value];
+  if (result->repeatedUint64Array == nil) {
+    result.repeatedUint64Array = [PBUInt64Array array];
+  }
+  PBUInt64ArrayAddValue(result->repeatedUint64Array, value);
   return self;
 }
 - (TestAllTypesLite_Builder *)setRepeatedUint64Array:(NSArray *)array {
-  result.repeatedUint64Array = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeUInt64];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.repeatedUint64Array = [PBUInt64Array arrayWithArray:array valueType:PBArrayValueTypeUInt64];
+  return self;
+}
+- (TestAllTypesLite_Builder *)setRepeatedUint64:(PBArray *)array {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.repeatedUint64Array = array ? [PBUInt64Array arrayWithStorageOfArray:array] : nil;
   return self;
 }
 - (TestAllTypesLite_Builder *)setRepeatedUint64Values:(const uint64_t *)values count:(NSUInteger)count {
-  result.repeatedUint64Array = [PBAppendableArray arrayWithValues:values count:count valueType:PBArrayValueTypeUInt64];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.repeatedUint64Array = [PBUInt64Array arrayWithValues:values count:count valueType:PBArrayValueTypeUInt64];
   return self;
 }
 - (TestAllTypesLite_Builder *)clearRepeatedUint64 {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
   result.repeatedUint64Array = nil;
   return self;
 }
 - (PBAppendableArray *)repeatedSint32 {
-  return result.repeatedSint32Array;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return result->repeatedSint32Array;
 }
 - (int32_t)repeatedSint32AtIndex:(NSUInteger)index {
   return [result repeatedSint32AtIndex:index];
 }
 - (TestAllTypesLite_Builder *)addRepeatedSint32:(int32_t)value {
-  if (result.repeatedSint32Array == nil) {
-    result.repeatedSint32Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeInt32];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  [result.repeatedSint32Array addInt32:value];
+  if (result->repeatedSint32Array == nil) {
+    result.repeatedSint32Array = [PBInt32Array array];
+  }
+  PBInt32ArrayAddValue(result->repeatedSint32Array, value);
   return self;
 }
 - (TestAllTypesLite_Builder *)setRepeatedSint32Array:(NSArray *)array {
-  result.repeatedSint32Array = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeInt32];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.repeatedSint32Array = [PBInt32Array arrayWithArray:array valueType:PBArrayValueTypeInt32];
+  return self;
+}
+- (TestAllTypesLite_Builder *)setRepeatedSint32:(PBArray *)array {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.repeatedSint32Array = array ? [PBInt32Array arrayWithStorageOfArray:array] : nil;
   return self;
 }
 - (TestAllTypesLite_Builder *)setRepeatedSint32Values:(const int32_t *)values count:(NSUInteger)count {
-  result.repeatedSint32Array = [PBAppendableArray arrayWithValues:values count:count valueType:PBArrayValueTypeInt32];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.repeatedSint32Array = [PBInt32Array arrayWithValues:values count:count valueType:PBArrayValueTypeInt32];
   return self;
 }
 - (TestAllTypesLite_Builder *)clearRepeatedSint32 {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
   result.repeatedSint32Array = nil;
   return self;
 }
 - (PBAppendableArray *)repeatedSint64 {
-  return result.repeatedSint64Array;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return result->repeatedSint64Array;
 }
 - (int64_t)repeatedSint64AtIndex:(NSUInteger)index {
   return [result repeatedSint64AtIndex:index];
 }
 - (TestAllTypesLite_Builder *)addRepeatedSint64:(int64_t)value {
-  if (result.repeatedSint64Array == nil) {
-    result.repeatedSint64Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeInt64];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  [result.repeatedSint64Array addInt64:value];
+  if (result->repeatedSint64Array == nil) {
+    result.repeatedSint64Array = [PBInt64Array array];
+  }
+  PBInt64ArrayAddValue(result->repeatedSint64Array, value);
   return self;
 }
 - (TestAllTypesLite_Builder *)setRepeatedSint64Array:(NSArray *)array {
-  result.repeatedSint64Array = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeInt64];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.repeatedSint64Array = [PBInt64Array arrayWithArray:array valueType:PBArrayValueTypeInt64];
+  return self;
+}
+- (TestAllTypesLite_Builder *)setRepeatedSint64:(PBArray *)array {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.repeatedSint64Array = array ? [PBInt64Array arrayWithStorageOfArray:array] : nil;
   return self;
 }
 - (TestAllTypesLite_Builder *)setRepeatedSint64Values:(const int64_t *)values count:(NSUInteger)count {
-  result.repeatedSint64Array = [PBAppendableArray arrayWithValues:values count:count valueType:PBArrayValueTypeInt64];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.repeatedSint64Array = [PBInt64Array arrayWithValues:values count:count valueType:PBArrayValueTypeInt64];
   return self;
 }
 - (TestAllTypesLite_Builder *)clearRepeatedSint64 {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
   result.repeatedSint64Array = nil;
   return self;
 }
 - (PBAppendableArray *)repeatedFixed32 {
-  return result.repeatedFixed32Array;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return result->repeatedFixed32Array;
 }
 - (uint32_t)repeatedFixed32AtIndex:(NSUInteger)index {
   return [result repeatedFixed32AtIndex:index];
 }
 - (TestAllTypesLite_Builder *)addRepeatedFixed32:(uint32_t)value {
-  if (result.repeatedFixed32Array == nil) {
-    result.repeatedFixed32Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeUInt32];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  [result.repeatedFixed32Array addUint32:value];
+  if (result->repeatedFixed32Array == nil) {
+    result.repeatedFixed32Array = [PBUInt32Array array];
+  }
+  PBUInt32ArrayAddValue(result->repeatedFixed32Array, value);
   return self;
 }
 - (TestAllTypesLite_Builder *)setRepeatedFixed32Array:(NSArray *)array {
-  result.repeatedFixed32Array = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeUInt32];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.repeatedFixed32Array = [PBUInt32Array arrayWithArray:array valueType:PBArrayValueTypeUInt32];
+  return self;
+}
+- (TestAllTypesLite_Builder *)setRepeatedFixed32:(PBArray *)array {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.repeatedFixed32Array = array ? [PBUInt32Array arrayWithStorageOfArray:array] : nil;
   return self;
 }
 - (TestAllTypesLite_Builder *)setRepeatedFixed32Values:(const uint32_t *)values count:(NSUInteger)count {
-  result.repeatedFixed32Array = [PBAppendableArray arrayWithValues:values count:count valueType:PBArrayValueTypeUInt32];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.repeatedFixed32Array = [PBUInt32Array arrayWithValues:values count:count valueType:PBArrayValueTypeUInt32];
   return self;
 }
 - (TestAllTypesLite_Builder *)clearRepeatedFixed32 {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
   result.repeatedFixed32Array = nil;
   return self;
 }
 - (PBAppendableArray *)repeatedFixed64 {
-  return result.repeatedFixed64Array;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return result->repeatedFixed64Array;
 }
 - (uint64_t)repeatedFixed64AtIndex:(NSUInteger)index {
   return [result repeatedFixed64AtIndex:index];
 }
 - (TestAllTypesLite_Builder *)addRepeatedFixed64:(uint64_t)value {
-  if (result.repeatedFixed64Array == nil) {
-    result.repeatedFixed64Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeUInt64];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  [result.repeatedFixed64Array addUint64:value];
+  if (result->repeatedFixed64Array == nil) {
+    result.repeatedFixed64Array = [PBUInt64Array array];
+  }
+  PBUInt64ArrayAddValue(result->repeatedFixed64Array, value);
   return self;
 }
 - (TestAllTypesLite_Builder *)setRepeatedFixed64Array:(NSArray *)array {
-  result.repeatedFixed64Array = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeUInt64];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.repeatedFixed64Array = [PBUInt64Array arrayWithArray:array valueType:PBArrayValueTypeUInt64];
+  return self;
+}
+- (TestAllTypesLite_Builder *)setRepeatedFixed64:(PBArray *)array {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.repeatedFixed64Array = array ? [PBUInt64Array arrayWithStorageOfArray:array] : nil;
   return self;
 }
 - (TestAllTypesLite_Builder *)setRepeatedFixed64Values:(const uint64_t *)values count:(NSUInteger)count {
-  result.repeatedFixed64Array = [PBAppendableArray arrayWithValues:values count:count valueType:PBArrayValueTypeUInt64];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.repeatedFixed64Array = [PBUInt64Array arrayWithValues:values count:count valueType:PBArrayValueTypeUInt64];
   return self;
 }
 - (TestAllTypesLite_Builder *)clearRepeatedFixed64 {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
   result.repeatedFixed64Array = nil;
   return self;
 }
 - (PBAppendableArray *)repeatedSfixed32 {
-  return result.repeatedSfixed32Array;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return result->repeatedSfixed32Array;
 }
 - (int32_t)repeatedSfixed32AtIndex:(NSUInteger)index {
   return [result repeatedSfixed32AtIndex:index];
 }
 - (TestAllTypesLite_Builder *)addRepeatedSfixed32:(int32_t)value {
-  if (result.repeatedSfixed32Array == nil) {
-    result.repeatedSfixed32Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeInt32];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  [result.repeatedSfixed32Array addInt32:value];
+  if (result->repeatedSfixed32Array == nil) {
+    result.repeatedSfixed32Array = [PBInt32Array array];
+  }
+  PBInt32ArrayAddValue(result->repeatedSfixed32Array, value);
   return self;
 }
 - (TestAllTypesLite_Builder *)setRepeatedSfixed32Array:(NSArray *)array {
-  result.repeatedSfixed32Array = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeInt32];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.repeatedSfixed32Array = [PBInt32Array arrayWithArray:array valueType:PBArrayValueTypeInt32];
+  return self;
+}
+- (TestAllTypesLite_Builder *)setRepeatedSfixed32:(PBArray *)array {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.repeatedSfixed32Array = array ? [PBInt32Array arrayWithStorageOfArray:array] : nil;
   return self;
 }
 - (TestAllTypesLite_Builder *)setRepeatedSfixed32Values:(const int32_t *)values count:(NSUInteger)count {
-  result.repeatedSfixed32Array = [PBAppendableArray arrayWithValues:values count:count valueType:PBArrayValueTypeInt32];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.repeatedSfixed32Array = [PBInt32Array arrayWithValues:values count:count valueType:PBArrayValueTypeInt32];
   return self;
 }
 - (TestAllTypesLite_Builder *)clearRepeatedSfixed32 {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
   result.repeatedSfixed32Array = nil;
   return self;
 }
 - (PBAppendableArray *)repeatedSfixed64 {
-  return result.repeatedSfixed64Array;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return result->repeatedSfixed64Array;
 }
 - (int64_t)repeatedSfixed64AtIndex:(NSUInteger)index {
   return [result repeatedSfixed64AtIndex:index];
 }
 - (TestAllTypesLite_Builder *)addRepeatedSfixed64:(int64_t)value {
-  if (result.repeatedSfixed64Array == nil) {
-    result.repeatedSfixed64Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeInt64];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  [result.repeatedSfixed64Array addInt64:value];
+  if (result->repeatedSfixed64Array == nil) {
+    result.repeatedSfixed64Array = [PBInt64Array array];
+  }
+  PBInt64ArrayAddValue(result->repeatedSfixed64Array, value);
   return self;
 }
 - (TestAllTypesLite_Builder *)setRepeatedSfixed64Array:(NSArray *)array {
-  result.repeatedSfixed64Array = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeInt64];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.repeatedSfixed64Array = [PBInt64Array arrayWithArray:array valueType:PBArrayValueTypeInt64];
+  return self;
+}
+- (TestAllTypesLite_Builder *)setRepeatedSfixed64:(PBArray *)array {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.repeatedSfixed64Array = array ? [PBInt64Array arrayWithStorageOfArray:array] : nil;
   return self;
 }
 - (TestAllTypesLite_Builder *)setRepeatedSfixed64Values:(const int64_t *)values count:(NSUInteger)count {
-  result.repeatedSfixed64Array = [PBAppendableArray arrayWithValues:values count:count valueType:PBArrayValueTypeInt64];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.repeatedSfixed64Array = [PBInt64Array arrayWithValues:values count:count valueType:PBArrayValueTypeInt64];
   return self;
 }
 - (TestAllTypesLite_Builder *)clearRepeatedSfixed64 {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
   result.repeatedSfixed64Array = nil;
   return self;
 }
 - (PBAppendableArray *)repeatedFloat {
-  return result.repeatedFloatArray;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return result->repeatedFloatArray;
 }
 - (Float32)repeatedFloatAtIndex:(NSUInteger)index {
   return [result repeatedFloatAtIndex:index];
 }
 - (TestAllTypesLite_Builder *)addRepeatedFloat:(Float32)value {
-  if (result.repeatedFloatArray == nil) {
-    result.repeatedFloatArray = [PBAppendableArray arrayWithValueType:PBArrayValueTypeFloat];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  [result.repeatedFloatArray addFloat:value];
+  if (result->repeatedFloatArray == nil) {
+    result.repeatedFloatArray = [PBFloatArray array];
+  }
+  PBFloatArrayAddValue(result->repeatedFloatArray, value);
   return self;
 }
 - (TestAllTypesLite_Builder *)setRepeatedFloatArray:(NSArray *)array {
-  result.repeatedFloatArray = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeFloat];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.repeatedFloatArray = [PBFloatArray arrayWithArray:array valueType:PBArrayValueTypeFloat];
+  return self;
+}
+- (TestAllTypesLite_Builder *)setRepeatedFloat:(PBArray *)array {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.repeatedFloatArray = array ? [PBFloatArray arrayWithStorageOfArray:array] : nil;
   return self;
 }
 - (TestAllTypesLite_Builder *)setRepeatedFloatValues:(const Float32 *)values count:(NSUInteger)count {
-  result.repeatedFloatArray = [PBAppendableArray arrayWithValues:values count:count valueType:PBArrayValueTypeFloat];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.repeatedFloatArray = [PBFloatArray arrayWithValues:values count:count valueType:PBArrayValueTypeFloat];
   return self;
 }
 - (TestAllTypesLite_Builder *)clearRepeatedFloat {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
   result.repeatedFloatArray = nil;
   return self;
 }
 - (PBAppendableArray *)repeatedDouble {
-  return result.repeatedDoubleArray;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return result->repeatedDoubleArray;
 }
 - (Float64)repeatedDoubleAtIndex:(NSUInteger)index {
   return [result repeatedDoubleAtIndex:index];
 }
 - (TestAllTypesLite_Builder *)addRepeatedDouble:(Float64)value {
-  if (result.repeatedDoubleArray == nil) {
-    result.repeatedDoubleArray = [PBAppendableArray arrayWithValueType:PBArrayValueTypeDouble];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  [result.repeatedDoubleArray addDouble:value];
+  if (result->repeatedDoubleArray == nil) {
+    result.repeatedDoubleArray = [PBDoubleArray array];
+  }
+  PBDoubleArrayAddValue(result->repeatedDoubleArray, value);
   return self;
 }
 - (TestAllTypesLite_Builder *)setRepeatedDoubleArray:(NSArray *)array {
-  result.repeatedDoubleArray = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeDouble];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.repeatedDoubleArray = [PBDoubleArray arrayWithArray:array valueType:PBArrayValueTypeDouble];
+  return self;
+}
+- (TestAllTypesLite_Builder *)setRepeatedDouble:(PBArray *)array {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.repeatedDoubleArray = array ? [PBDoubleArray arrayWithStorageOfArray:array] : nil;
   return self;
 }
 - (TestAllTypesLite_Builder *)setRepeatedDoubleValues:(const Float64 *)values count:(NSUInteger)count {
-  result.repeatedDoubleArray = [PBAppendableArray arrayWithValues:values count:count valueType:PBArrayValueTypeDouble];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.repeatedDoubleArray = [PBDoubleArray arrayWithValues:values count:count valueType:PBArrayValueTypeDouble];
   return self;
 }
 - (TestAllTypesLite_Builder *)clearRepeatedDouble {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
   result.repeatedDoubleArray = nil;
   return self;
 }
 - (PBAppendableArray *)repeatedBool {
-  return result.repeatedBoolArray;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return result->repeatedBoolArray;
 }
 - (BOOL)repeatedBoolAtIndex:(NSUInteger)index {
   return [result repeatedBoolAtIndex:index];
 }
 - (TestAllTypesLite_Builder *)addRepeatedBool:(BOOL)value {
-  if (result.repeatedBoolArray == nil) {
-    result.repeatedBoolArray = [PBAppendableArray arrayWithValueType:PBArrayValueTypeBool];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  [result.repeatedBoolArray addBool:value];
+  if (result->repeatedBoolArray == nil) {
+    result.repeatedBoolArray = [PBBoolArray array];
+  }
+  PBBoolArrayAddValue(result->repeatedBoolArray, value);
   return self;
 }
 - (TestAllTypesLite_Builder *)setRepeatedBoolArray:(NSArray *)array {
-  result.repeatedBoolArray = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeBool];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.repeatedBoolArray = [PBBoolArray arrayWithArray:array valueType:PBArrayValueTypeBool];
+  return self;
+}
+- (TestAllTypesLite_Builder *)setRepeatedBool:(PBArray *)array {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.repeatedBoolArray = array ? [PBBoolArray arrayWithStorageOfArray:array] : nil;
   return self;
 }
 - (TestAllTypesLite_Builder *)setRepeatedBoolValues:(const BOOL *)values count:(NSUInteger)count {
-  result.repeatedBoolArray = [PBAppendableArray arrayWithValues:values count:count valueType:PBArrayValueTypeBool];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.repeatedBoolArray = [PBBoolArray arrayWithValues:values count:count valueType:PBArrayValueTypeBool];
   return self;
 }
 - (TestAllTypesLite_Builder *)clearRepeatedBool {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
   result.repeatedBoolArray = nil;
   return self;
 }
 - (PBAppendableArray *)repeatedString {
-  return result.repeatedStringArray;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return result->repeatedStringArray;
 }
 - (NSString*)repeatedStringAtIndex:(NSUInteger)index {
   return [result repeatedStringAtIndex:index];
 }
 - (TestAllTypesLite_Builder *)addRepeatedString:(NSString*)value {
-  if (result.repeatedStringArray == nil) {
-    result.repeatedStringArray = [PBAppendableArray arrayWithValueType:PBArrayValueTypeObject];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  [result.repeatedStringArray addObject:value];
+  if (result->repeatedStringArray == nil) {
+    result.repeatedStringArray = [PBObjectArray array];
+  }
+  PBObjectArrayAddValue(result->repeatedStringArray, value);
   return self;
 }
 - (TestAllTypesLite_Builder *)setRepeatedStringArray:(NSArray *)array {
-  result.repeatedStringArray = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeObject];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.repeatedStringArray = [PBObjectArray arrayWithArray:array valueType:PBArrayValueTypeObject];
+  return self;
+}
+- (TestAllTypesLite_Builder *)setRepeatedString:(PBArray *)array {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.repeatedStringArray = array ? [PBObjectArray arrayWithStorageOfArray:array] : nil;
   return self;
 }
 - (TestAllTypesLite_Builder *)setRepeatedStringValues:(const NSString* *)values count:(NSUInteger)count {
-  result.repeatedStringArray = [PBAppendableArray arrayWithValues:values count:count valueType:PBArrayValueTypeObject];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.repeatedStringArray = [PBObjectArray arrayWithValues:values count:count valueType:PBArrayValueTypeObject];
   return self;
 }
 - (TestAllTypesLite_Builder *)clearRepeatedString {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
   result.repeatedStringArray = nil;
   return self;
 }
 - (PBAppendableArray *)repeatedBytes {
-  return result.repeatedBytesArray;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return result->repeatedBytesArray;
 }
 - (NSData*)repeatedBytesAtIndex:(NSUInteger)index {
   return [result repeatedBytesAtIndex:index];
 }
 - (TestAllTypesLite_Builder *)addRepeatedBytes:(NSData*)value {
-  if (result.repeatedBytesArray == nil) {
-    result.repeatedBytesArray = [PBAppendableArray arrayWithValueType:PBArrayValueTypeObject];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  [result.repeatedBytesArray addObject:value];
+  if (result->repeatedBytesArray == nil) {
+    result.repeatedBytesArray = [PBObjectArray array];
+  }
+  PBObjectArrayAddValue(result->repeatedBytesArray, value);
   return self;
 }
 - (TestAllTypesLite_Builder *)setRepeatedBytesArray:(NSArray *)array {
-  result.repeatedBytesArray = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeObject];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.repeatedBytesArray = [PBObjectArray arrayWithArray:array valueType:PBArrayValueTypeObject];
+  return self;
+}
+- (TestAllTypesLite_Builder *)setRepeatedBytes:(PBArray *)array {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.repeatedBytesArray = array ? [PBObjectArray arrayWithStorageOfArray:array] : nil;
   return self;
 }
 - (TestAllTypesLite_Builder *)setRepeatedBytesValues:(const NSData* *)values count:(NSUInteger)count {
-  result.repeatedBytesArray = [PBAppendableArray arrayWithValues:values count:count valueType:PBArrayValueTypeObject];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.repeatedBytesArray = [PBObjectArray arrayWithValues:values count:count valueType:PBArrayValueTypeObject];
   return self;
 }
 - (TestAllTypesLite_Builder *)clearRepeatedBytes {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
   result.repeatedBytesArray = nil;
   return self;
 }
 - (PBAppendableArray *)repeatedGroup {
-  return result.repeatedGroupArray;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return result->repeatedGroupArray;
 }
 - (TestAllTypesLite_RepeatedGroup*)repeatedGroupAtIndex:(NSUInteger)index {
   return [result repeatedGroupAtIndex:index];
 }
 - (TestAllTypesLite_Builder *)addRepeatedGroup:(TestAllTypesLite_RepeatedGroup*)value {
-  if (result.repeatedGroupArray == nil) {
-    result.repeatedGroupArray = [PBAppendableArray arrayWithValueType:PBArrayValueTypeObject];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  [result.repeatedGroupArray addObject:value];
+  if (result->repeatedGroupArray == nil) {
+    result.repeatedGroupArray = [PBObjectArray array];
+  }
+  PBObjectArrayAddValue(result->repeatedGroupArray, value);
   return self;
 }
 - (TestAllTypesLite_Builder *)setRepeatedGroupArray:(NSArray *)array {
-  result.repeatedGroupArray = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeObject];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.repeatedGroupArray = [PBObjectArray arrayWithArray:array valueType:PBArrayValueTypeObject];
   return self;
 }
 - (TestAllTypesLite_Builder *)setRepeatedGroupValues:(const TestAllTypesLite_RepeatedGroup* *)values count:(NSUInteger)count {
-  result.repeatedGroupArray = [PBAppendableArray arrayWithValues:values count:count valueType:PBArrayValueTypeObject];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.repeatedGroupArray = [PBObjectArray arrayWithValues:values count:count valueType:PBArrayValueTypeObject];
   return self;
 }
 - (TestAllTypesLite_Builder *)clearRepeatedGroup {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
   result.repeatedGroupArray = nil;
   return self;
 }
 - (PBAppendableArray *)repeatedNestedMessage {
-  return result.repeatedNestedMessageArray;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return result->repeatedNestedMessageArray;
 }
 - (TestAllTypesLite_NestedMessage*)repeatedNestedMessageAtIndex:(NSUInteger)index {
   return [result repeatedNestedMessageAtIndex:index];
 }
 - (TestAllTypesLite_Builder *)addRepeatedNestedMessage:(TestAllTypesLite_NestedMessage*)value {
-  if (result.repeatedNestedMessageArray == nil) {
-    result.repeatedNestedMessageArray = [PBAppendableArray arrayWithValueType:PBArrayValueTypeObject];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (result->repeatedNestedMessageArray == nil) {
+    result.repeatedNestedMessageArray = [PBObjectArray array];
   }
-  [result.repeatedNestedMessageArray addObject:value];
+  PBObjectArrayAddValue(result->repeatedNestedMessageArray, value);
   return self;
 }
 - (TestAllTypesLite_Builder *)setRepeatedNestedMessageArray:(NSArray *)array {
-  result.repeatedNestedMessageArray = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeObject];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.repeatedNestedMessageArray = [PBObjectArray arrayWithArray:array valueType:PBArrayValueTypeObject];
   return self;
 }
 - (TestAllTypesLite_Builder *)setRepeatedNestedMessageValues:(const TestAllTypesLite_NestedMessage* *)values count:(NSUInteger)count {
-  result.repeatedNestedMessageArray = [PBAppendableArray arrayWithValues:values count:count valueType:PBArrayValueTypeObject];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.repeatedNestedMessageArray = [PBObjectArray arrayWithValues:values count:count valueType:PBArrayValueTypeObject];
   return self;
 }
 - (TestAllTypesLite_Builder *)clearRepeatedNestedMessage {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
   result.repeatedNestedMessageArray = nil;
   return self;
 }
 - (PBAppendableArray *)repeatedForeignMessage {
-  return result.repeatedForeignMessageArray;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return result->repeatedForeignMessageArray;
 }
 - (ForeignMessageLite*)repeatedForeignMessageAtIndex:(NSUInteger)index {
   return [result repeatedForeignMessageAtIndex:index];
 }
 - (TestAllTypesLite_Builder *)addRepeatedForeignMessage:(ForeignMessageLite*)value {
-  if (result.repeatedForeignMessageArray == nil) {
-    result.repeatedForeignMessageArray = [PBAppendableArray arrayWithValueType:PBArrayValueTypeObject];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  [result.repeatedForeignMessageArray addObject:value];
+  if (result->repeatedForeignMessageArray == nil) {
+    result.repeatedForeignMessageArray = [PBObjectArray array];
+  }
+  PBObjectArrayAddValue(result->repeatedForeignMessageArray, value);
   return self;
 }
 - (TestAllTypesLite_Builder *)setRepeatedForeignMessageArray:(NSArray *)array {
-  result.repeatedForeignMessageArray = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeObject];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.repeatedForeignMessageArray = [PBObjectArray arrayWithArray:array valueType:PBArrayValueTypeObject];
   return self;
 }
 - (TestAllTypesLite_Builder *)setRepeatedForeignMessageValues:(const ForeignMessageLite* *)values count:(NSUInteger)count {
-  result.repeatedForeignMessageArray = [PBAppendableArray arrayWithValues:values count:count valueType:PBArrayValueTypeObject];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.repeatedForeignMessageArray = [PBObjectArray arrayWithValues:values count:count valueType:PBArrayValueTypeObject];
   return self;
 }
 - (TestAllTypesLite_Builder *)clearRepeatedForeignMessage {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
   result.repeatedForeignMessageArray = nil;
   return self;
 }
 - (PBAppendableArray *)repeatedImportMessage {
-  return result.repeatedImportMessageArray;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return result->repeatedImportMessageArray;
 }
 - (ImportMessageLite*)repeatedImportMessageAtIndex:(NSUInteger)index {
   return [result repeatedImportMessageAtIndex:index];
 }
 - (TestAllTypesLite_Builder *)addRepeatedImportMessage:(ImportMessageLite*)value {
-  if (result.repeatedImportMessageArray == nil) {
-    result.repeatedImportMessageArray = [PBAppendableArray arrayWithValueType:PBArrayValueTypeObject];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (result->repeatedImportMessageArray == nil) {
+    result.repeatedImportMessageArray = [PBObjectArray array];
   }
-  [result.repeatedImportMessageArray addObject:value];
+  PBObjectArrayAddValue(result->repeatedImportMessageArray, value);
   return self;
 }
 - (TestAllTypesLite_Builder *)setRepeatedImportMessageArray:(NSArray *)array {
-  result.repeatedImportMessageArray = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeObject];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.repeatedImportMessageArray = [PBObjectArray arrayWithArray:array valueType:PBArrayValueTypeObject];
   return self;
 }
 - (TestAllTypesLite_Builder *)setRepeatedImportMessageValues:(const ImportMessageLite* *)values count:(NSUInteger)count {
-  result.repeatedImportMessageArray = [PBAppendableArray arrayWithValues:values count:count valueType:PBArrayValueTypeObject];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.repeatedImportMessageArray = [PBObjectArray arrayWithValues:values count:count valueType:PBArrayValueTypeObject];
   return self;
 }
 - (TestAllTypesLite_Builder *)clearRepeatedImportMessage {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
   result.repeatedImportMessageArray = nil;
   return self;
 }
 - (PBAppendableArray *)repeatedNestedEnum {
-  return result.repeatedNestedEnumArray;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return result->repeatedNestedEnumArray;
 }
 - (TestAllTypesLite_NestedEnum)repeatedNestedEnumAtIndex:(NSUInteger)index {
   return [result repeatedNestedEnumAtIndex:index];
 }
 - (TestAllTypesLite_Builder *)addRepeatedNestedEnum:(TestAllTypesLite_NestedEnum)value {
-  if (result.repeatedNestedEnumArray == nil) {
-    result.repeatedNestedEnumArray = [PBAppendableArray arrayWithValueType:PBArrayValueTypeInt32];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  [result.repeatedNestedEnumArray addInt32:value];
+  if (result->repeatedNestedEnumArray == nil) {
+    result.repeatedNestedEnumArray = [PBInt32Array array];
+  }
+  PBInt32ArrayAddValue(result->repeatedNestedEnumArray, value);
   return self;
 }
 - (TestAllTypesLite_Builder *)setRepeatedNestedEnumArray:(NSArray *)array {
-  result.repeatedNestedEnumArray = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeInt32];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.repeatedNestedEnumArray = [PBInt32Array arrayWithArray:array valueType:PBArrayValueTypeInt32];
+  return self;
+}
+- (TestAllTypesLite_Builder *)setRepeatedNestedEnum:(PBArray *)array {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.repeatedNestedEnumArray = array ? [PBInt32Array arrayWithStorageOfArray:array] : nil;
   return self;
 }
 - (TestAllTypesLite_Builder *)setRepeatedNestedEnumValues:(const TestAllTypesLite_NestedEnum *)values count:(NSUInteger)count {
-  result.repeatedNestedEnumArray = [PBAppendableArray arrayWithValues:values count:count valueType:PBArrayValueTypeInt32];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.repeatedNestedEnumArray = [PBInt32Array arrayWithValues:values count:count valueType:PBArrayValueTypeInt32];
   return self;
 }
 - (TestAllTypesLite_Builder *)clearRepeatedNestedEnum {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
   result.repeatedNestedEnumArray = nil;
   return self;
 }
 - (PBAppendableArray *)repeatedForeignEnum {
-  return result.repeatedForeignEnumArray;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return result->repeatedForeignEnumArray;
 }
 - (ForeignEnumLite)repeatedForeignEnumAtIndex:(NSUInteger)index {
   return [result repeatedForeignEnumAtIndex:index];
 }
 - (TestAllTypesLite_Builder *)addRepeatedForeignEnum:(ForeignEnumLite)value {
-  if (result.repeatedForeignEnumArray == nil) {
-    result.repeatedForeignEnumArray = [PBAppendableArray arrayWithValueType:PBArrayValueTypeInt32];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  [result.repeatedForeignEnumArray addInt32:value];
+  if (result->repeatedForeignEnumArray == nil) {
+    result.repeatedForeignEnumArray = [PBInt32Array array];
+  }
+  PBInt32ArrayAddValue(result->repeatedForeignEnumArray, value);
   return self;
 }
 - (TestAllTypesLite_Builder *)setRepeatedForeignEnumArray:(NSArray *)array {
-  result.repeatedForeignEnumArray = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeInt32];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.repeatedForeignEnumArray = [PBInt32Array arrayWithArray:array valueType:PBArrayValueTypeInt32];
+  return self;
+}
+- (TestAllTypesLite_Builder *)setRepeatedForeignEnum:(PBArray *)array {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.repeatedForeignEnumArray = array ? [PBInt32Array arrayWithStorageOfArray:array] : nil;
   return self;
 }
 - (TestAllTypesLite_Builder *)setRepeatedForeignEnumValues:(const ForeignEnumLite *)values count:(NSUInteger)count {
-  result.repeatedForeignEnumArray = [PBAppendableArray arrayWithValues:values count:count valueType:PBArrayValueTypeInt32];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.repeatedForeignEnumArray = [PBInt32Array arrayWithValues:values count:count valueType:PBArrayValueTypeInt32];
   return self;
 }
 - (TestAllTypesLite_Builder *)clearRepeatedForeignEnum {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
   result.repeatedForeignEnumArray = nil;
   return self;
 }
 - (PBAppendableArray *)repeatedImportEnum {
-  return result.repeatedImportEnumArray;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return result->repeatedImportEnumArray;
 }
 - (ImportEnumLite)repeatedImportEnumAtIndex:(NSUInteger)index {
   return [result repeatedImportEnumAtIndex:index];
 }
 - (TestAllTypesLite_Builder *)addRepeatedImportEnum:(ImportEnumLite)value {
-  if (result.repeatedImportEnumArray == nil) {
-    result.repeatedImportEnumArray = [PBAppendableArray arrayWithValueType:PBArrayValueTypeInt32];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  [result.repeatedImportEnumArray addInt32:value];
+  if (result->repeatedImportEnumArray == nil) {
+    result.repeatedImportEnumArray = [PBInt32Array array];
+  }
+  PBInt32ArrayAddValue(result->repeatedImportEnumArray, value);
   return self;
 }
 - (TestAllTypesLite_Builder *)setRepeatedImportEnumArray:(NSArray *)array {
-  result.repeatedImportEnumArray = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeInt32];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.repeatedImportEnumArray = [PBInt32Array arrayWithArray:array valueType:PBArrayValueTypeInt32];
+  return self;
+}
+- (TestAllTypesLite_Builder *)setRepeatedImportEnum:(PBArray *)array {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.repeatedImportEnumArray = array ? [PBInt32Array arrayWithStorageOfArray:array] : nil;
   return self;
 }
 - (TestAllTypesLite_Builder *)setRepeatedImportEnumValues:(const ImportEnumLite *)values count:(NSUInteger)count {
-  result.repeatedImportEnumArray = [PBAppendableArray arrayWithValues:values count:count valueType:PBArrayValueTypeInt32];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.repeatedImportEnumArray = [PBInt32Array arrayWithValues:values count:count valueType:PBArrayValueTypeInt32];
   return self;
 }
 - (TestAllTypesLite_Builder *)clearRepeatedImportEnum {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
   result.repeatedImportEnumArray = nil;
   return self;
 }
 - (PBAppendableArray *)repeatedStringPiece {
-  return result.repeatedStringPieceArray;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return result->repeatedStringPieceArray;
 }
 - (NSString*)repeatedStringPieceAtIndex:(NSUInteger)index {
   return [result repeatedStringPieceAtIndex:index];
 }
 - (TestAllTypesLite_Builder *)addRepeatedStringPiece:(NSString*)value {
-  if (result.repeatedStringPieceArray == nil) {
-    result.repeatedStringPieceArray = [PBAppendableArray arrayWithValueType:PBArrayValueTypeObject];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  [result.repeatedStringPieceArray addObject:value];
+  if (result->repeatedStringPieceArray == nil) {
+    result.repeatedStringPieceArray = [PBObjectArray array];
+  }
+  PBObjectArrayAddValue(result->repeatedStringPieceArray, value);
   return self;
 }
 - (TestAllTypesLite_Builder *)setRepeatedStringPieceArray:(NSArray *)array {
-  result.repeatedStringPieceArray = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeObject];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.repeatedStringPieceArray = [PBObjectArray arrayWithArray:array valueType:PBArrayValueTypeObject];
+  return self;
+}
+- (TestAllTypesLite_Builder *)setRepeatedStringPiece:(PBArray *)array {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.repeatedStringPieceArray = array ? [PBObjectArray arrayWithStorageOfArray:array] : nil;
   return self;
 }
 - (TestAllTypesLite_Builder *)setRepeatedStringPieceValues:(const NSString* *)values count:(NSUInteger)count {
-  result.repeatedStringPieceArray = [PBAppendableArray arrayWithValues:values count:count valueType:PBArrayValueTypeObject];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.repeatedStringPieceArray = [PBObjectArray arrayWithValues:values count:count valueType:PBArrayValueTypeObject];
   return self;
 }
 - (TestAllTypesLite_Builder *)clearRepeatedStringPiece {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
   result.repeatedStringPieceArray = nil;
   return self;
 }
 - (PBAppendableArray *)repeatedCord {
-  return result.repeatedCordArray;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return result->repeatedCordArray;
 }
 - (NSString*)repeatedCordAtIndex:(NSUInteger)index {
   return [result repeatedCordAtIndex:index];
 }
 - (TestAllTypesLite_Builder *)addRepeatedCord:(NSString*)value {
-  if (result.repeatedCordArray == nil) {
-    result.repeatedCordArray = [PBAppendableArray arrayWithValueType:PBArrayValueTypeObject];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  [result.repeatedCordArray addObject:value];
+  if (result->repeatedCordArray == nil) {
+    result.repeatedCordArray = [PBObjectArray array];
+  }
+  PBObjectArrayAddValue(result->repeatedCordArray, value);
   return self;
 }
 - (TestAllTypesLite_Builder *)setRepeatedCordArray:(NSArray *)array {
-  result.repeatedCordArray = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeObject];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.repeatedCordArray = [PBObjectArray arrayWithArray:array valueType:PBArrayValueTypeObject];
+  return self;
+}
+- (TestAllTypesLite_Builder *)setRepeatedCord:(PBArray *)array {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.repeatedCordArray = array ? [PBObjectArray arrayWithStorageOfArray:array] : nil;
   return self;
 }
 - (TestAllTypesLite_Builder *)setRepeatedCordValues:(const NSString* *)values count:(NSUInteger)count {
-  result.repeatedCordArray = [PBAppendableArray arrayWithValues:values count:count valueType:PBArrayValueTypeObject];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.repeatedCordArray = [PBObjectArray arrayWithValues:values count:count valueType:PBArrayValueTypeObject];
   return self;
 }
 - (TestAllTypesLite_Builder *)clearRepeatedCord {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
   result.repeatedCordArray = nil;
   return self;
 }
 - (BOOL) hasDefaultInt32 {
-  return result.hasDefaultInt32;
+  return (result->hasBits_[0] & 0x1000000u) != 0;
 }
 - (int32_t) defaultInt32 {
-  return result.defaultInt32;
+  return (result->hasBits_[0] & 0x1000000u) ? result->defaultInt32 : 41;
 }
 - (TestAllTypesLite_Builder*) setDefaultInt32:(int32_t) value {
-  result.hasDefaultInt32 = YES;
-  result.defaultInt32 = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x1000000u;
+  result->defaultInt32 = value;
   return self;
 }
 - (TestAllTypesLite_Builder*) clearDefaultInt32 {
-  result.hasDefaultInt32 = NO;
-  result.defaultInt32 = 41;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x1000000u;
+  result->defaultInt32 = 0;
   return self;
 }
 - (BOOL) hasDefaultInt64 {
-  return result.hasDefaultInt64;
+  return (result->hasBits_[0] & 0x2000000u) != 0;
 }
 - (int64_t) defaultInt64 {
-  return result.defaultInt64;
+  return (result->hasBits_[0] & 0x2000000u) ? result->defaultInt64 : 42L;
 }
 - (TestAllTypesLite_Builder*) setDefaultInt64:(int64_t) value {
-  result.hasDefaultInt64 = YES;
-  result.defaultInt64 = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x2000000u;
+  result->defaultInt64 = value;
   return self;
 }
 - (TestAllTypesLite_Builder*) clearDefaultInt64 {
-  result.hasDefaultInt64 = NO;
-  result.defaultInt64 = 42L;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x2000000u;
+  result->defaultInt64 = 0;
   return self;
 }
 - (BOOL) hasDefaultUint32 {
-  return result.hasDefaultUint32;
+  return (result->hasBits_[0] & 0x4000000u) != 0;
 }
 - (uint32_t) defaultUint32 {
-  return result.defaultUint32;
+  return (result->hasBits_[0] & 0x4000000u) ? result->defaultUint32 : 43;
 }
 - (TestAllTypesLite_Builder*) setDefaultUint32:(uint32_t) value {
-  result.hasDefaultUint32 = YES;
-  result.defaultUint32 = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x4000000u;
+  result->defaultUint32 = value;
   return self;
 }
 - (TestAllTypesLite_Builder*) clearDefaultUint32 {
-  result.hasDefaultUint32 = NO;
-  result.defaultUint32 = 43;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x4000000u;
+  result->defaultUint32 = 0;
   return self;
 }
 - (BOOL) hasDefaultUint64 {
-  return result.hasDefaultUint64;
+  return (result->hasBits_[0] & 0x8000000u) != 0;
 }
 - (uint64_t) defaultUint64 {
-  return result.defaultUint64;
+  return (result->hasBits_[0] & 0x8000000u) ? result->defaultUint64 : 44L;
 }
 - (TestAllTypesLite_Builder*) setDefaultUint64:(uint64_t) value {
-  result.hasDefaultUint64 = YES;
-  result.defaultUint64 = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x8000000u;
+  result->defaultUint64 = value;
   return self;
 }
 - (TestAllTypesLite_Builder*) clearDefaultUint64 {
-  result.hasDefaultUint64 = NO;
-  result.defaultUint64 = 44L;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x8000000u;
+  result->defaultUint64 = 0;
   return self;
 }
 - (BOOL) hasDefaultSint32 {
-  return result.hasDefaultSint32;
+  return (result->hasBits_[0] & 0x10000000u) != 0;
 }
 - (int32_t) defaultSint32 {
-  return result.defaultSint32;
+  return (result->hasBits_[0] & 0x10000000u) ? result->defaultSint32 : -45;
 }
 - (TestAllTypesLite_Builder*) setDefaultSint32:(int32_t) value {
-  result.hasDefaultSint32 = YES;
-  result.defaultSint32 = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x10000000u;
+  result->defaultSint32 = value;
   return self;
 }
 - (TestAllTypesLite_Builder*) clearDefaultSint32 {
-  result.hasDefaultSint32 = NO;
-  result.defaultSint32 = -45;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x10000000u;
+  result->defaultSint32 = 0;
   return self;
 }
 - (BOOL) hasDefaultSint64 {
-  return result.hasDefaultSint64;
+  return (result->hasBits_[0] & 0x20000000u) != 0;
 }
 - (int64_t) defaultSint64 {
-  return result.defaultSint64;
+  return (result->hasBits_[0] & 0x20000000u) ? result->defaultSint64 : 46L;
 }
 - (TestAllTypesLite_Builder*) setDefaultSint64:(int64_t) value {
-  result.hasDefaultSint64 = YES;
-  result.defaultSint64 = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x20000000u;
+  result->defaultSint64 = value;
   return self;
 }
 - (TestAllTypesLite_Builder*) clearDefaultSint64 {
-  result.hasDefaultSint64 = NO;
-  result.defaultSint64 = 46L;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x20000000u;
+  result->defaultSint64 = 0;
   return self;
 }
 - (BOOL) hasDefaultFixed32 {
-  return result.hasDefaultFixed32;
+  return (result->hasBits_[0] & 0x40000000u) != 0;
 }
 - (uint32_t) defaultFixed32 {
-  return result.defaultFixed32;
+  return (result->hasBits_[0] & 0x40000000u) ? result->defaultFixed32 : 47;
 }
 - (TestAllTypesLite_Builder*) setDefaultFixed32:(uint32_t) value {
-  result.hasDefaultFixed32 = YES;
-  result.defaultFixed32 = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x40000000u;
+  result->defaultFixed32 = value;
   return self;
 }
 - (TestAllTypesLite_Builder*) clearDefaultFixed32 {
-  result.hasDefaultFixed32 = NO;
-  result.defaultFixed32 = 47;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x40000000u;
+  result->defaultFixed32 = 0;
   return self;
 }
 - (BOOL) hasDefaultFixed64 {
-  return result.hasDefaultFixed64;
+  return (result->hasBits_[0] & 0x80000000u) != 0;
 }
 - (uint64_t) defaultFixed64 {
-  return result.defaultFixed64;
+  return (result->hasBits_[0] & 0x80000000u) ? result->defaultFixed64 : 48L;
 }
 - (TestAllTypesLite_Builder*) setDefaultFixed64:(uint64_t) value {
-  result.hasDefaultFixed64 = YES;
-  result.defaultFixed64 = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x80000000u;
+  result->defaultFixed64 = value;
   return self;
 }
 - (TestAllTypesLite_Builder*) clearDefaultFixed64 {
-  result.hasDefaultFixed64 = NO;
-  result.defaultFixed64 = 48L;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x80000000u;
+  result->defaultFixed64 = 0;
   return self;
 }
 - (BOOL) hasDefaultSfixed32 {
-  return result.hasDefaultSfixed32;
+  return (result->hasBits_[1] & 0x1u) != 0;
 }
 - (int32_t) defaultSfixed32 {
-  return result.defaultSfixed32;
+  return (result->hasBits_[1] & 0x1u) ? result->defaultSfixed32 : 49;
 }
 - (TestAllTypesLite_Builder*) setDefaultSfixed32:(int32_t) value {
-  result.hasDefaultSfixed32 = YES;
-  result.defaultSfixed32 = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[1] |= 0x1u;
+  result->defaultSfixed32 = value;
   return self;
 }
 - (TestAllTypesLite_Builder*) clearDefaultSfixed32 {
-  result.hasDefaultSfixed32 = NO;
-  result.defaultSfixed32 = 49;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[1] &= ~0x1u;
+  result->defaultSfixed32 = 0;
   return self;
 }
 - (BOOL) hasDefaultSfixed64 {
-  return result.hasDefaultSfixed64;
+  return (result->hasBits_[1] & 0x2u) != 0;
 }
 - (int64_t) defaultSfixed64 {
-  return result.defaultSfixed64;
+  return (result->hasBits_[1] & 0x2u) ? result->defaultSfixed64 : -50L;
 }
 - (TestAllTypesLite_Builder*) setDefaultSfixed64:(int64_t) value {
-  result.hasDefaultSfixed64 = YES;
-  result.defaultSfixed64 = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[1] |= 0x2u;
+  result->defaultSfixed64 = value;
   return self;
 }
 - (TestAllTypesLite_Builder*) clearDefaultSfixed64 {
-  result.hasDefaultSfixed64 = NO;
-  result.defaultSfixed64 = -50L;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[1] &= ~0x2u;
+  result->defaultSfixed64 = 0;
   return self;
 }
 - (BOOL) hasDefaultFloat {
-  return result.hasDefaultFloat;
+  return (result->hasBits_[1] & 0x4u) != 0;
 }
 - (Float32) defaultFloat {
-  return result.defaultFloat;
+  return (result->hasBits_[1] & 0x4u) ? result->defaultFloat : 51.5;
 }
 - (TestAllTypesLite_Builder*) setDefaultFloat:(Float32) value {
-  result.hasDefaultFloat = YES;
-  result.defaultFloat = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[1] |= 0x4u;
+  result->defaultFloat = value;
   return self;
 }
 - (TestAllTypesLite_Builder*) clearDefaultFloat {
-  result.hasDefaultFloat = NO;
-  result.defaultFloat = 51.5;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[1] &= ~0x4u;
+  result->defaultFloat = 0;
   return self;
 }
 - (BOOL) hasDefaultDouble {
-  return result.hasDefaultDouble;
+  return (result->hasBits_[1] & 0x8u) != 0;
 }
 - (Float64) defaultDouble {
-  return result.defaultDouble;
+  return (result->hasBits_[1] & 0x8u) ? result->defaultDouble : 52000;
 }
 - (TestAllTypesLite_Builder*) setDefaultDouble:(Float64) value {
-  result.hasDefaultDouble = YES;
-  result.defaultDouble = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[1] |= 0x8u;
+  result->defaultDouble = value;
   return self;
 }
 - (TestAllTypesLite_Builder*) clearDefaultDouble {
-  result.hasDefaultDouble = NO;
-  result.defaultDouble = 52000;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[1] &= ~0x8u;
+  result->defaultDouble = 0;
   return self;
 }
 - (BOOL) hasDefaultBool {
-  return result.hasDefaultBool;
+  return (result->hasBits_[1] & 0x10u) != 0;
 }
 - (BOOL) defaultBool {
-  return result.defaultBool;
+  return (result->hasBits_[1] & 0x10u) ? !!result->defaultBool_ : YES;
 }
 - (TestAllTypesLite_Builder*) setDefaultBool:(BOOL) value {
-  result.hasDefaultBool = YES;
-  result.defaultBool = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[1] |= 0x10u;
+  result->defaultBool_ = !!value;
   return self;
 }
 - (TestAllTypesLite_Builder*) clearDefaultBool {
-  result.hasDefaultBool = NO;
-  result.defaultBool = YES;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[1] &= ~0x10u;
+  result->defaultBool_ = 0;
   return self;
 }
 - (BOOL) hasDefaultString {
-  return result.hasDefaultString;
+  return (result->hasBits_[1] & 0x20u) != 0;
 }
 - (NSString*) defaultString {
-  return result.defaultString;
+  return [result defaultString];
 }
 - (TestAllTypesLite_Builder*) setDefaultString:(NSString*) value {
-  result.hasDefaultString = YES;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[1] |= 0x20u;
   result.defaultString = value;
   return self;
 }
 - (TestAllTypesLite_Builder*) clearDefaultString {
-  result.hasDefaultString = NO;
-  result.defaultString = @"hello";
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[1] &= ~0x20u;
+  [result->defaultString release];
+  result->defaultString = nil;
   return self;
 }
 - (BOOL) hasDefaultBytes {
-  return result.hasDefaultBytes;
+  return (result->hasBits_[1] & 0x40u) != 0;
 }
 - (NSData*) defaultBytes {
-  return result.defaultBytes;
+  return [result defaultBytes];
 }
 - (TestAllTypesLite_Builder*) setDefaultBytes:(NSData*) value {
-  result.hasDefaultBytes = YES;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[1] |= 0x40u;
   result.defaultBytes = value;
   return self;
 }
 - (TestAllTypesLite_Builder*) clearDefaultBytes {
-  result.hasDefaultBytes = NO;
-  result.defaultBytes = [NSData dataWithBytes:"world" length:5];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[1] &= ~0x40u;
+  [result->defaultBytes release];
+  result->defaultBytes = nil;
   return self;
 }
 - (BOOL) hasDefaultNestedEnum {
-  return result.hasDefaultNestedEnum;
+  return (result->hasBits_[1] & 0x80u) != 0;
 }
 - (TestAllTypesLite_NestedEnum) defaultNestedEnum {
-  return result.defaultNestedEnum;
+  return (result->hasBits_[1] & 0x80u) ? result->defaultNestedEnum : TestAllTypesLite_NestedEnumBar;
 }
 - (TestAllTypesLite_Builder*) setDefaultNestedEnum:(TestAllTypesLite_NestedEnum) value {
-  result.hasDefaultNestedEnum = YES;
-  result.defaultNestedEnum = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[1] |= 0x80u;
+  result->defaultNestedEnum = value;
   return self;
 }
 - (TestAllTypesLite_Builder*) clearDefaultNestedEnum {
-  result.hasDefaultNestedEnum = NO;
-  result.defaultNestedEnum = TestAllTypesLite_NestedEnumBar;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[1] &= ~0x80u;
+  result->defaultNestedEnum = 0;
   return self;
 }
 - (BOOL) hasDefaultForeignEnum {
-  return result.hasDefaultForeignEnum;
+  return (result->hasBits_[1] & 0x100u) != 0;
 }
 - (ForeignEnumLite) defaultForeignEnum {
-  return result.defaultForeignEnum;
+  return (result->hasBits_[1] & 0x100u) ? result->defaultForeignEnum : ForeignEnumLiteForeignLiteBar;
 }
 - (TestAllTypesLite_Builder*) setDefaultForeignEnum:(ForeignEnumLite) value {
-  result.hasDefaultForeignEnum = YES;
-  result.defaultForeignEnum = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[1] |= 0x100u;
+  result->defaultForeignEnum = value;
   return self;
 }
 - (TestAllTypesLite_Builder*) clearDefaultForeignEnum {
-  result.hasDefaultForeignEnum = NO;
-  result.defaultForeignEnum = ForeignEnumLiteForeignLiteBar;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[1] &= ~0x100u;
+  result->defaultForeignEnum = 0;
   return self;
 }
 - (BOOL) hasDefaultImportEnum {
-  return result.hasDefaultImportEnum;
+  return (result->hasBits_[1] & 0x200u) != 0;
 }
 - (ImportEnumLite) defaultImportEnum {
-  return result.defaultImportEnum;
+  return (result->hasBits_[1] & 0x200u) ? result->defaultImportEnum : ImportEnumLiteImportLiteBar;
 }
 - (TestAllTypesLite_Builder*) setDefaultImportEnum:(ImportEnumLite) value {
-  result.hasDefaultImportEnum = YES;
-  result.defaultImportEnum = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[1] |= 0x200u;
+  result->defaultImportEnum = value;
   return self;
 }
 - (TestAllTypesLite_Builder*) clearDefaultImportEnum {
-  result.hasDefaultImportEnum = NO;
-  result.defaultImportEnum = ImportEnumLiteImportLiteBar;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[1] &= ~0x200u;
+  result->defaultImportEnum = 0;
   return self;
 }
 - (BOOL) hasDefaultStringPiece {
-  return result.hasDefaultStringPiece;
+  return (result->hasBits_[1] & 0x400u) != 0;
 }
 - (NSString*) defaultStringPiece {
-  return result.defaultStringPiece;
+  return [result defaultStringPiece];
 }
 - (TestAllTypesLite_Builder*) setDefaultStringPiece:(NSString*) value {
-  result.hasDefaultStringPiece = YES;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[1] |= 0x400u;
   result.defaultStringPiece = value;
   return self;
 }
 - (TestAllTypesLite_Builder*) clearDefaultStringPiece {
-  result.hasDefaultStringPiece = NO;
-  result.defaultStringPiece = @"abc";
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[1] &= ~0x400u;
+  [result->defaultStringPiece release];
+  result->defaultStringPiece = nil;
   return self;
 }
 - (BOOL) hasDefaultCord {
-  return result.hasDefaultCord;
+  return (result->hasBits_[1] & 0x800u) != 0;
 }
 - (NSString*) defaultCord {
-  return result.defaultCord;
+  return [result defaultCord];
 }
 - (TestAllTypesLite_Builder*) setDefaultCord:(NSString*) value {
-  result.hasDefaultCord = YES;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[1] |= 0x800u;
   result.defaultCord = value;
   return self;
 }
 - (TestAllTypesLite_Builder*) clearDefaultCord {
-  result.hasDefaultCord = NO;
-  result.defaultCord = @"123";
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[1] &= ~0x800u;
+  [result->defaultCord release];
+  result->defaultCord = nil;
   return self;
 }
 @end
 
 @interface ForeignMessageLite ()
-@property int32_t c;
+@property (nonatomic) int32_t c;
+@end
+
+@interface ForeignMessageLite_Builder()
+@property (nonatomic, retain) ForeignMessageLite* result;
+- (id) initWithPrototype:(ForeignMessageLite*) prototype;
+- (void) detachFromPrototype;
 @end
 
 @implementation ForeignMessageLite
 
 - (BOOL) hasC {
-  return !!hasC_;
+  return (hasBits_[0] & 0x1u) != 0;
 }
-- (void) setHasC:(BOOL) value {
-  hasC_ = !!value;
+- (void) setHasC:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x1u;
+  } else {
+    hasBits_[0] &= ~0x1u;
+  }
 }
 @synthesize c;
 - (void) dealloc {
   [super dealloc];
 }
-- (id) init {
-  if ((self = [super init])) {
-    self.c = 0;
-  }
-  return self;
+- (void) clearForReuse {
+  [super clearForReuse];
+  memset(hasBits_, 0, sizeof(hasBits_));
+  c = 0;
 }
 static ForeignMessageLite* defaultForeignMessageLiteInstance = nil;
-+ (void) initialize {
-  if (self == [ForeignMessageLite class]) {
-    defaultForeignMessageLiteInstance = [[ForeignMessageLite alloc] init];
-  }
-}
 + (ForeignMessageLite*) defaultInstance {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultForeignMessageLiteInstance = [[ForeignMessageLite alloc] init];
+  });
   return defaultForeignMessageLiteInstance;
 }
 - (ForeignMessageLite*) defaultInstance {
-  return defaultForeignMessageLiteInstance;
+  return [ForeignMessageLite defaultInstance];
 }
 - (BOOL) isInitialized {
   return YES;
 }
 - (void) writeToCodedOutputStream:(PBCodedOutputStream*) output {
-  if (self.hasC) {
-    [output writeInt32:1 value:self.c];
+  if (hasBits_[0] & 0x1u) {
+    [output writeInt32:1 value:c];
   }
-  [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = PBGeneratedMessageGetMemoizedSize(&memoizedSerializedSize);
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
-  if (self.hasC) {
-    size += computeInt32Size(1, self.c);
+  size_ = 0;
+  if (hasBits_[0] & 0x1u) {
+    size_ += computeInt32Size(1, c);
   }
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
+  PBGeneratedMessageSetMemoizedSize(&memoizedSerializedSize, size_);
+  return size_;
 }
 + (ForeignMessageLite*) parseFromData:(NSData*) data {
   return (ForeignMessageLite*)[[[ForeignMessageLite builder] mergeFromData:data] build];
@@ -5939,7 +7341,7 @@ static ForeignMessageLite* defaultForeignMessageLiteInstance = nil;
   return [[[ForeignMessageLite_Builder alloc] init] autorelease];
 }
 + (ForeignMessageLite_Builder*) builderWithPrototype:(ForeignMessageLite*) prototype {
-  return [[ForeignMessageLite builder] mergeFrom:prototype];
+  return [[[ForeignMessageLite_Builder alloc] initWithPrototype:prototype] autorelease];
 }
 - (ForeignMessageLite_Builder*) builder {
   return [ForeignMessageLite builder];
@@ -5947,12 +7349,6 @@ static ForeignMessageLite* defaultForeignMessageLiteInstance = nil;
 - (ForeignMessageLite_Builder*) toBuilder {
   return [ForeignMessageLite builderWithPrototype:self];
 }
-- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
-  if (self.hasC) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"c", [NSNumber numberWithInt:self.c]];
-  }
-  [self.unknownFields writeDescriptionTo:output withIndent:indent];
-}
 - (BOOL) isEqual:(id)other {
   if (other == self) {
     return YES;
@@ -5962,46 +7358,98 @@ static ForeignMessageLite* defaultForeignMessageLiteInstance = nil;
   }
   ForeignMessageLite *otherMessage = other;
   return
-      self.hasC == otherMessage.hasC &&
-      (!self.hasC || self.c == otherMessage.c) &&
-      
-      (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
+      (hasBits_[0] & 0x1u) == (otherMessage->hasBits_[0] & 0x1u) &&
+      (!(hasBits_[0] & 0x1u) || c == otherMessage->c) &&
+      YES;
 }
 - (NSUInteger) hash {
-  NSUInteger hashCode = 7;
-  if (self.hasC) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithInt:self.c] hash];
+  NSUInteger hash_ = PBGeneratedMessageGetMemoizedHash(&memoizedHash);
+  if (hash_ != 0) {
+    return hash_;
   }
-  hashCode = hashCode * 31 + [self.unknownFields hash];
-  return hashCode;
-}
-@end
 
-@interface ForeignMessageLite_Builder()
-@property (retain) ForeignMessageLite* result;
+  uint64_t hashCode = 7;
+  if (hasBits_[0] & 0x1u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, (uint64_t)c);
+  }
+  hash_ = PBGeneratedMessageHashFinish(hashCode);
+  PBGeneratedMessageSetMemoizedHash(&memoizedHash, hash_);
+  return hash_;
+}
 @end
 
 @implementation ForeignMessageLite_Builder
 @synthesize result;
 - (void) dealloc {
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
   self.result = nil;
+  [prototype_ release];
   [super dealloc];
 }
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[[ForeignMessageLite alloc] init] autorelease];
+    result = [ForeignMessageLite recycledInstance];
+  }
+  return self;
+}
+- (id) initWithPrototype:(ForeignMessageLite*) prototype {
+  if ((self = [super init])) {
+    self.result = prototype;
+    prototype_ = [prototype retain];
   }
   return self;
 }
+- (void) detachFromPrototype {
+  ForeignMessageLite* prototype = prototype_;
+  prototype_ = nil;
+  self.result = [[[ForeignMessageLite alloc] init] autorelease];
+  [self mergeFrom:prototype];
+  [prototype release];
+}
+- (PBGeneratedMessage*) internalGetMutableResult {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return [self internalGetResult];
+}
 - (PBGeneratedMessage*) internalGetResult {
   return result;
 }
 - (ForeignMessageLite_Builder*) clear {
-  self.result = [[[ForeignMessageLite alloc] init] autorelease];
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = [[ForeignMessageLite recycledInstance] autorelease];
   return self;
 }
 - (ForeignMessageLite_Builder*) clone {
-  return [ForeignMessageLite builderWithPrototype:result];
+  if (prototype_ != nil) {
+    return [[[ForeignMessageLite_Builder alloc] initWithPrototype:prototype_] autorelease];
+  }
+  return [[ForeignMessageLite builder] mergeFrom:result];
+}
+- (ForeignMessageLite_Builder*) reset {
+  if (result == nil || prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    self.result = [[ForeignMessageLite recycledInstance] autorelease];
+  } else {
+    [result clearForReuse];
+  }
+  return self;
+}
+- (ForeignMessageLite_Builder*) recycle:(ForeignMessageLite*) message {
+  if (message == [ForeignMessageLite defaultInstance]) {
+    @throw [NSException exceptionWithName:@"IllegalArgument" reason:@"Cannot recycle the default instance" userInfo:nil];
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = message;
+  return [self reset];
 }
 - (ForeignMessageLite*) defaultInstance {
   return [ForeignMessageLite defaultInstance];
@@ -6011,36 +7459,49 @@ static ForeignMessageLite* defaultForeignMessageLiteInstance = nil;
   return [self buildPartial];
 }
 - (ForeignMessageLite*) buildPartial {
-  ForeignMessageLite* returnMe = [[result retain] autorelease];
-  self.result = nil;
+  return [[self newBuildPartial] autorelease];
+}
+- (ForeignMessageLite*) newBuildPartial {
+  if (prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    ForeignMessageLite* returnMe = result;
+    result = nil;
+    return returnMe;
+  }
+  ForeignMessageLite* returnMe = result;
+  result = nil;
   return returnMe;
 }
 - (ForeignMessageLite_Builder*) mergeFrom:(ForeignMessageLite*) other {
   if (other == [ForeignMessageLite defaultInstance]) {
     return self;
   }
-  if (other.hasC) {
-    [self setC:other.c];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (other->hasBits_[0] & 0x1u) {
+    [self setC:other->c];
   }
-  [self mergeUnknownFields:other.unknownFields];
   return self;
 }
 - (ForeignMessageLite_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input {
   return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
 }
 - (ForeignMessageLite_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
   while (YES) {
     int32_t tag = [input readTag];
     switch (tag) {
       case 0:
-        [self setUnknownFields:[unknownFields build]];
         return self;
       default: {
-        if (![self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag]) {
-          [self setUnknownFields:[unknownFields build]];
+        if (PBWireFormatGetTagWireType(tag) == PBWireFormatEndGroup) {
           return self;
         }
+        [input skipField:tag];
         break;
       }
       case 8: {
@@ -6051,38 +7512,50 @@ static ForeignMessageLite* defaultForeignMessageLiteInstance = nil;
   }
 }
 - (BOOL) hasC {
-  return result.hasC;
+  return (result->hasBits_[0] & 0x1u) != 0;
 }
 - (int32_t) c {
-  return result.c;
+  return result->c;
 }
 - (ForeignMessageLite_Builder*) setC:(int32_t) value {
-  result.hasC = YES;
-  result.c = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x1u;
+  result->c = value;
   return self;
 }
 - (ForeignMessageLite_Builder*) clearC {
-  result.hasC = NO;
-  result.c = 0;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x1u;
+  result->c = 0;
   return self;
 }
 @end
 
 @interface TestPackedTypesLite ()
-@property (retain) PBAppendableArray * packedInt32Array;
-@property (retain) PBAppendableArray * packedInt64Array;
-@property (retain) PBAppendableArray * packedUint32Array;
-@property (retain) PBAppendableArray * packedUint64Array;
-@property (retain) PBAppendableArray * packedSint32Array;
-@property (retain) PBAppendableArray * packedSint64Array;
-@property (retain) PBAppendableArray * packedFixed32Array;
-@property (retain) PBAppendableArray * packedFixed64Array;
-@property (retain) PBAppendableArray * packedSfixed32Array;
-@property (retain) PBAppendableArray * packedSfixed64Array;
-@property (retain) PBAppendableArray * packedFloatArray;
-@property (retain) PBAppendableArray * packedDoubleArray;
-@property (retain) PBAppendableArray * packedBoolArray;
-@property (retain) PBAppendableArray * packedEnumArray;
+@property (nonatomic, retain) PBInt32Array * packedInt32Array;
+@property (nonatomic, retain) PBInt64Array * packedInt64Array;
+@property (nonatomic, retain) PBUInt32Array * packedUint32Array;
+@property (nonatomic, retain) PBUInt64Array * packedUint64Array;
+@property (nonatomic, retain) PBInt32Array * packedSint32Array;
+@property (nonatomic, retain) PBInt64Array * packedSint64Array;
+@property (nonatomic, retain) PBUInt32Array * packedFixed32Array;
+@property (nonatomic, retain) PBUInt64Array * packedFixed64Array;
+@property (nonatomic, retain) PBInt32Array * packedSfixed32Array;
+@property (nonatomic, retain) PBInt64Array * packedSfixed64Array;
+@property (nonatomic, retain) PBFloatArray * packedFloatArray;
+@property (nonatomic, retain) PBDoubleArray * packedDoubleArray;
+@property (nonatomic, retain) PBBoolArray * packedBoolArray;
+@property (nonatomic, retain) PBInt32Array * packedEnumArray;
+@end
+
+@interface TestPackedTypesLite_Builder()
+@property (nonatomic, retain) TestPackedTypesLite* result;
+- (id) initWithPrototype:(TestPackedTypesLite*) prototype;
+- (void) detachFromPrototype;
 @end
 
 @implementation TestPackedTypesLite
@@ -6116,440 +7589,451 @@ static ForeignMessageLite* defaultForeignMessageLiteInstance = nil;
 @synthesize packedEnumArray;
 @dynamic packedEnum;
 - (void) dealloc {
-  self.packedInt32Array = nil;
-  self.packedInt64Array = nil;
-  self.packedUint32Array = nil;
-  self.packedUint64Array = nil;
-  self.packedSint32Array = nil;
-  self.packedSint64Array = nil;
-  self.packedFixed32Array = nil;
-  self.packedFixed64Array = nil;
-  self.packedSfixed32Array = nil;
-  self.packedSfixed64Array = nil;
-  self.packedFloatArray = nil;
-  self.packedDoubleArray = nil;
-  self.packedBoolArray = nil;
-  self.packedEnumArray = nil;
+  [packedInt32Array release];
+  [packedInt64Array release];
+  [packedUint32Array release];
+  [packedUint64Array release];
+  [packedSint32Array release];
+  [packedSint64Array release];
+  [packedFixed32Array release];
+  [packedFixed64Array release];
+  [packedSfixed32Array release];
+  [packedSfixed64Array release];
+  [packedFloatArray release];
+  [packedDoubleArray release];
+  [packedBoolArray release];
+  [packedEnumArray release];
   [super dealloc];
 }
-- (id) init {
-  if ((self = [super init])) {
-  }
-  return self;
+- (void) clearForReuse {
+  [super clearForReuse];
+  memset(hasBits_, 0, sizeof(hasBits_));
+  packedInt32Array = PBAppendableArrayReuse(packedInt32Array);
+  packedInt64Array = PBAppendableArrayReuse(packedInt64Array);
+  packedUint32Array = PBAppendableArrayReuse(packedUint32Array);
+  packedUint64Array = PBAppendableArrayReuse(packedUint64Array);
+  packedSint32Array = PBAppendableArrayReuse(packedSint32Array);
+  packedSint64Array = PBAppendableArrayReuse(packedSint64Array);
+  packedFixed32Array = PBAppendableArrayReuse(packedFixed32Array);
+  packedFixed64Array = PBAppendableArrayReuse(packedFixed64Array);
+  packedSfixed32Array = PBAppendableArrayReuse(packedSfixed32Array);
+  packedSfixed64Array = PBAppendableArrayReuse(packedSfixed64Array);
+  packedFloatArray = PBAppendableArrayReuse(packedFloatArray);
+  packedDoubleArray = PBAppendableArrayReuse(packedDoubleArray);
+  packedBoolArray = PBAppendableArrayReuse(packedBoolArray);
+  packedEnumArray = PBAppendableArrayReuse(packedEnumArray);
 }
 static TestPackedTypesLite* defaultTestPackedTypesLiteInstance = nil;
-+ (void) initialize {
-  if (self == [TestPackedTypesLite class]) {
-    defaultTestPackedTypesLiteInstance = [[TestPackedTypesLite alloc] init];
-  }
-}
 + (TestPackedTypesLite*) defaultInstance {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultTestPackedTypesLiteInstance = [[TestPackedTypesLite alloc] init];
+  });
   return defaultTestPackedTypesLiteInstance;
 }
 - (TestPackedTypesLite*) defaultInstance {
-  return defaultTestPackedTypesLiteInstance;
+  return [TestPackedTypesLite defaultInstance];
 }
 - (PBArray *)packedInt32 {
   return packedInt32Array;
 }
 - (int32_t)packedInt32AtIndex:(NSUInteger)index {
-  return [packedInt32Array int32AtIndex:index];
+  return PBInt32ArrayValueAtIndex(packedInt32Array, index);
 }
 - (PBArray *)packedInt64 {
   return packedInt64Array;
 }
 - (int64_t)packedInt64AtIndex:(NSUInteger)index {
-  return [packedInt64Array int64AtIndex:index];
+  return PBInt64ArrayValueAtIndex(packedInt64Array, index);
 }
 - (PBArray *)packedUint32 {
   return packedUint32Array;
 }
 - (uint32_t)packedUint32AtIndex:(NSUInteger)index {
-  return [packedUint32Array uint32AtIndex:index];
+  return PBUInt32ArrayValueAtIndex(packedUint32Array, index);
 }
 - (PBArray *)packedUint64 {
   return packedUint64Array;
 }
 - (uint64_t)packedUint64AtIndex:(NSUInteger)index {
-  return [packedUint64Array uint64AtIndex:index];
+  return PBUInt64ArrayValueAtIndex(packedUint64Array, index);
 }
 - (PBArray *)packedSint32 {
   return packedSint32Array;
 }
 - (int32_t)packedSint32AtIndex:(NSUInteger)index {
-  return [packedSint32Array int32AtIndex:index];
+  return PBInt32ArrayValueAtIndex(packedSint32Array, index);
 }
 - (PBArray *)packedSint64 {
   return packedSint64Array;
 }
 - (int64_t)packedSint64AtIndex:(NSUInteger)index {
-  return [packedSint64Array int64AtIndex:index];
+  return PBInt64ArrayValueAtIndex(packedSint64Array, index);
 }
 - (PBArray *)packedFixed32 {
   return packedFixed32Array;
 }
 - (uint32_t)packedFixed32AtIndex:(NSUInteger)index {
-  return [packedFixed32Array uint32AtIndex:index];
+  return PBUInt32ArrayValueAtIndex(packedFixed32Array, index);
 }
 - (PBArray *)packedFixed64 {
   return packedFixed64Array;
 }
 - (uint64_t)packedFixed64AtIndex:(NSUInteger)index {
-  return [packedFixed64Array uint64AtIndex:index];
+  return PBUInt64ArrayValueAtIndex(packedFixed64Array, index);
 }
 - (PBArray *)packedSfixed32 {
   return packedSfixed32Array;
 }
 - (int32_t)packedSfixed32AtIndex:(NSUInteger)index {
-  return [packedSfixed32Array int32AtIndex:index];
+  return PBInt32ArrayValueAtIndex(packedSfixed32Array, index);
 }
 - (PBArray *)packedSfixed64 {
   return packedSfixed64Array;
 }
 - (int64_t)packedSfixed64AtIndex:(NSUInteger)index {
-  return [packedSfixed64Array int64AtIndex:index];
+  return PBInt64ArrayValueAtIndex(packedSfixed64Array, index);
 }
 - (PBArray *)packedFloat {
   return packedFloatArray;
 }
 - (Float32)packedFloatAtIndex:(NSUInteger)index {
-  return [packedFloatArray floatAtIndex:index];
+  return PBFloatArrayValueAtIndex(packedFloatArray, index);
 }
 - (PBArray *)packedDouble {
   return packedDoubleArray;
 }
 - (Float64)packedDoubleAtIndex:(NSUInteger)index {
-  return [packedDoubleArray doubleAtIndex:index];
+  return PBDoubleArrayValueAtIndex(packedDoubleArray, index);
 }
 - (PBArray *)packedBool {
   return packedBoolArray;
 }
 - (BOOL)packedBoolAtIndex:(NSUInteger)index {
-  return [packedBoolArray boolAtIndex:index];
+  return PBBoolArrayValueAtIndex(packedBoolArray, index);
 }
 - (PBArray *)packedEnum {
   return packedEnumArray;
 }
 - (ForeignEnumLite)packedEnumAtIndex:(NSUInteger)index {
-  return [packedEnumArray int32AtIndex:index];
+  return PBInt32ArrayValueAtIndex(packedEnumArray, index);
 }
 - (BOOL) isInitialized {
   return YES;
 }
 - (void) writeToCodedOutputStream:(PBCodedOutputStream*) output {
-  const NSUInteger packedInt32ArrayCount = self.packedInt32Array.count;
+  [self serializedSize];
+  const NSUInteger packedInt32ArrayCount = packedInt32Array.count;
   if (packedInt32ArrayCount > 0) {
-    const int32_t *values = (const int32_t *)self.packedInt32Array.data;
+    const int32_t *values = (const int32_t *)packedInt32Array.data;
     [output writeRawVarint32:722];
-    [output writeRawVarint32:packedInt32MemoizedSerializedSize];
+    [output writeRawVarint32:PBGeneratedMessageGetMemoizedSize(&packedInt32MemoizedSerializedSize)];
     for (NSUInteger i = 0; i < packedInt32ArrayCount; ++i) {
       [output writeInt32NoTag:values[i]];
     }
   }
-  const NSUInteger packedInt64ArrayCount = self.packedInt64Array.count;
+  const NSUInteger packedInt64ArrayCount = packedInt64Array.count;
   if (packedInt64ArrayCount > 0) {
-    const int64_t *values = (const int64_t *)self.packedInt64Array.data;
+    const int64_t *values = (const int64_t *)packedInt64Array.data;
     [output writeRawVarint32:730];
-    [output writeRawVarint32:packedInt64MemoizedSerializedSize];
+    [output writeRawVarint32:PBGeneratedMessageGetMemoizedSize(&packedInt64MemoizedSerializedSize)];
     for (NSUInteger i = 0; i < packedInt64ArrayCount; ++i) {
       [output writeInt64NoTag:values[i]];
     }
   }
-  const NSUInteger packedUint32ArrayCount = self.packedUint32Array.count;
+  const NSUInteger packedUint32ArrayCount = packedUint32Array.count;
   if (packedUint32ArrayCount > 0) {
-    const uint32_t *values = (const uint32_t *)self.packedUint32Array.data;
+    const uint32_t *values = (const uint32_t *)packedUint32Array.data;
     [output writeRawVarint32:738];
-    [output writeRawVarint32:packedUint32MemoizedSerializedSize];
+    [output writeRawVarint32:PBGeneratedMessageGetMemoizedSize(&packedUint32MemoizedSerializedSize)];
     for (NSUInteger i = 0; i < packedUint32ArrayCount; ++i) {
       [output writeUInt32NoTag:values[i]];
     }
   }
-  const NSUInteger packedUint64ArrayCount = self.packedUint64Array.count;
+  const NSUInteger packedUint64ArrayCount = packedUint64Array.count;
   if (packedUint64ArrayCount > 0) {
-    const uint64_t *values = (const uint64_t *)self.packedUint64Array.data;
+    const uint64_t *values = (const uint64_t *)packedUint64Array.data;
     [output writeRawVarint32:746];
-    [output writeRawVarint32:packedUint64MemoizedSerializedSize];
+    [output writeRawVarint32:PBGeneratedMessageGetMemoizedSize(&packedUint64MemoizedSerializedSize)];
     for (NSUInteger i = 0; i < packedUint64ArrayCount; ++i) {
       [output writeUInt64NoTag:values[i]];
     }
   }
-  const NSUInteger packedSint32ArrayCount = self.packedSint32Array.count;
+  const NSUInteger packedSint32ArrayCount = packedSint32Array.count;
   if (packedSint32ArrayCount > 0) {
-    const int32_t *values = (const int32_t *)self.packedSint32Array.data;
+    const int32_t *values = (const int32_t *)packedSint32Array.data;
     [output writeRawVarint32:754];
-    [output writeRawVarint32:packedSint32MemoizedSerializedSize];
+    [output writeRawVarint32:PBGeneratedMessageGetMemoizedSize(&packedSint32MemoizedSerializedSize)];
     for (NSUInteger i = 0; i < packedSint32ArrayCount; ++i) {
       [output writeSInt32NoTag:values[i]];
     }
   }
-  const NSUInteger packedSint64ArrayCount = self.packedSint64Array.count;
+  const NSUInteger packedSint64ArrayCount = packedSint64Array.count;
   if (packedSint64ArrayCount > 0) {
-    const int64_t *values = (const int64_t *)self.packedSint64Array.data;
+    const int64_t *values = (const int64_t *)packedSint64Array.data;
     [output writeRawVarint32:762];
-    [output writeRawVarint32:packedSint64MemoizedSerializedSize];
+    [output writeRawVarint32:PBGeneratedMessageGetMemoizedSize(&packedSint64MemoizedSerializedSize)];
     for (NSUInteger i = 0; i < packedSint64ArrayCount; ++i) {
       [output writeSInt64NoTag:values[i]];
     }
   }
-  const NSUInteger packedFixed32ArrayCount = self.packedFixed32Array.count;
+  const NSUInteger packedFixed32ArrayCount = packedFixed32Array.count;
   if (packedFixed32ArrayCount > 0) {
-    const uint32_t *values = (const uint32_t *)self.packedFixed32Array.data;
+    const uint32_t *values = (const uint32_t *)packedFixed32Array.data;
     [output writeRawVarint32:770];
-    [output writeRawVarint32:packedFixed32MemoizedSerializedSize];
+    [output writeRawVarint32:PBGeneratedMessageGetMemoizedSize(&packedFixed32MemoizedSerializedSize)];
     for (NSUInteger i = 0; i < packedFixed32ArrayCount; ++i) {
       [output writeFixed32NoTag:values[i]];
     }
   }
-  const NSUInteger packedFixed64ArrayCount = self.packedFixed64Array.count;
+  const NSUInteger packedFixed64ArrayCount = packedFixed64Array.count;
   if (packedFixed64ArrayCount > 0) {
-    const uint64_t *values = (const uint64_t *)self.packedFixed64Array.data;
+    const uint64_t *values = (const uint64_t *)packedFixed64Array.data;
     [output writeRawVarint32:778];
-    [output writeRawVarint32:packedFixed64MemoizedSerializedSize];
+    [output writeRawVarint32:PBGeneratedMessageGetMemoizedSize(&packedFixed64MemoizedSerializedSize)];
     for (NSUInteger i = 0; i < packedFixed64ArrayCount; ++i) {
       [output writeFixed64NoTag:values[i]];
     }
   }
-  const NSUInteger packedSfixed32ArrayCount = self.packedSfixed32Array.count;
+  const NSUInteger packedSfixed32ArrayCount = packedSfixed32Array.count;
   if (packedSfixed32ArrayCount > 0) {
-    const int32_t *values = (const int32_t *)self.packedSfixed32Array.data;
+    const int32_t *values = (const int32_t *)packedSfixed32Array.data;
     [output writeRawVarint32:786];
-    [output writeRawVarint32:packedSfixed32MemoizedSerializedSize];
+    [output writeRawVarint32:PBGeneratedMessageGetMemoizedSize(&packedSfixed32MemoizedSerializedSize)];
     for (NSUInteger i = 0; i < packedSfixed32ArrayCount; ++i) {
       [output writeSFixed32NoTag:values[i]];
     }
   }
-  const NSUInteger packedSfixed64ArrayCount = self.packedSfixed64Array.count;
+  const NSUInteger packedSfixed64ArrayCount = packedSfixed64Array.count;
   if (packedSfixed64ArrayCount > 0) {
-    const int64_t *values = (const int64_t *)self.packedSfixed64Array.data;
+    const int64_t *values = (const int64_t *)packedSfixed64Array.data;
     [output writeRawVarint32:794];
-    [output writeRawVarint32:packedSfixed64MemoizedSerializedSize];
+    [output writeRawVarint32:PBGeneratedMessageGetMemoizedSize(&packedSfixed64MemoizedSerializedSize)];
     for (NSUInteger i = 0; i < packedSfixed64ArrayCount; ++i) {
       [output writeSFixed64NoTag:values[i]];
     }
   }
-  const NSUInteger packedFloatArrayCount = self.packedFloatArray.count;
+  const NSUInteger packedFloatArrayCount = packedFloatArray.count;
   if (packedFloatArrayCount > 0) {
-    const Float32 *values = (const Float32 *)self.packedFloatArray.data;
+    const Float32 *values = (const Float32 *)packedFloatArray.data;
     [output writeRawVarint32:802];
-    [output writeRawVarint32:packedFloatMemoizedSerializedSize];
+    [output writeRawVarint32:PBGeneratedMessageGetMemoizedSize(&packedFloatMemoizedSerializedSize)];
     for (NSUInteger i = 0; i < packedFloatArrayCount; ++i) {
       [output writeFloatNoTag:values[i]];
     }
   }
-  const NSUInteger packedDoubleArrayCount = self.packedDoubleArray.count;
+  const NSUInteger packedDoubleArrayCount = packedDoubleArray.count;
   if (packedDoubleArrayCount > 0) {
-    const Float64 *values = (const Float64 *)self.packedDoubleArray.data;
+    const Float64 *values = (const Float64 *)packedDoubleArray.data;
     [output writeRawVarint32:810];
-    [output writeRawVarint32:packedDoubleMemoizedSerializedSize];
+    [output writeRawVarint32:PBGeneratedMessageGetMemoizedSize(&packedDoubleMemoizedSerializedSize)];
     for (NSUInteger i = 0; i < packedDoubleArrayCount; ++i) {
       [output writeDoubleNoTag:values[i]];
     }
   }
-  const NSUInteger packedBoolArrayCount = self.packedBoolArray.count;
+  const NSUInteger packedBoolArrayCount = packedBoolArray.count;
   if (packedBoolArrayCount > 0) {
-    const BOOL *values = (const BOOL *)self.packedBoolArray.data;
+    const BOOL *values = (const BOOL *)packedBoolArray.data;
     [output writeRawVarint32:818];
-    [output writeRawVarint32:packedBoolMemoizedSerializedSize];
+    [output writeRawVarint32:PBGeneratedMessageGetMemoizedSize(&packedBoolMemoizedSerializedSize)];
     for (NSUInteger i = 0; i < packedBoolArrayCount; ++i) {
       [output writeBoolNoTag:values[i]];
     }
   }
-  const NSUInteger packedEnumArrayCount = self.packedEnumArray.count;
-  const ForeignEnumLite *packedEnumArrayValues = (const ForeignEnumLite *)self.packedEnumArray.data;
-  if (self.packedEnumArray.count > 0) {
+  const NSUInteger packedEnumArrayCount = packedEnumArray.count;
+  const ForeignEnumLite *packedEnumArrayValues = (const ForeignEnumLite *)packedEnumArray.data;
+  if (packedEnumArray.count > 0) {
     [output writeRawVarint32:826];
-    [output writeRawVarint32:packedEnumMemoizedSerializedSize];
+    [output writeRawVarint32:PBGeneratedMessageGetMemoizedSize(&packedEnumMemoizedSerializedSize)];
   }
   for (NSUInteger i = 0; i < packedEnumArrayCount; ++i) {
     [output writeEnumNoTag:packedEnumArrayValues[i]];
   }
-  [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = PBGeneratedMessageGetMemoizedSize(&memoizedSerializedSize);
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
+  size_ = 0;
   {
     int32_t dataSize = 0;
-    const NSUInteger count = self.packedInt32Array.count;
-    const int32_t *values = (const int32_t *)self.packedInt32Array.data;
+    const NSUInteger count = packedInt32Array.count;
+    const int32_t *values = (const int32_t *)packedInt32Array.data;
     for (NSUInteger i = 0; i < count; ++i) {
       dataSize += computeInt32SizeNoTag(values[i]);
     }
-    size += dataSize;
+    size_ += dataSize;
     if (count > 0) {
-      size += 2;
-      size += computeInt32SizeNoTag(dataSize);
+      size_ += 2;
+      size_ += computeInt32SizeNoTag(dataSize);
     }
-    packedInt32MemoizedSerializedSize = dataSize;
+    PBGeneratedMessageSetMemoizedSize(&packedInt32MemoizedSerializedSize, dataSize);
   }
   {
     int32_t dataSize = 0;
-    const NSUInteger count = self.packedInt64Array.count;
-    const int64_t *values = (const int64_t *)self.packedInt64Array.data;
+    const NSUInteger count = packedInt64Array.count;
+    const int64_t *values = (const int64_t *)packedInt64Array.data;
     for (NSUInteger i = 0; i < count; ++i) {
       dataSize += computeInt64SizeNoTag(values[i]);
     }
-    size += dataSize;
+    size_ += dataSize;
     if (count > 0) {
-      size += 2;
-      size += computeInt32SizeNoTag(dataSize);
+      size_ += 2;
+      size_ += computeInt32SizeNoTag(dataSize);
     }
-    packedInt64MemoizedSerializedSize = dataSize;
+    PBGeneratedMessageSetMemoizedSize(&packedInt64MemoizedSerializedSize, dataSize);
   }
   {
     int32_t dataSize = 0;
-    const NSUInteger count = self.packedUint32Array.count;
-    const uint32_t *values = (const uint32_t *)self.packedUint32Array.data;
+    const NSUInteger count = packedUint32Array.count;
+    const uint32_t *values = (const uint32_t *)packedUint32Array.data;
     for (NSUInteger i = 0; i < count; ++i) {
       dataSize += computeUInt32SizeNoTag(values[i]);
     }
-    size += dataSize;
+    size_ += dataSize;
     if (count > 0) {
-      size += 2;
-      size += computeInt32SizeNoTag(dataSize);
+      size_ += 2;
+      size_ += computeInt32SizeNoTag(dataSize);
     }
-    packedUint32MemoizedSerializedSize = dataSize;
+    PBGeneratedMessageSetMemoizedSize(&packedUint32MemoizedSerializedSize, dataSize);
   }
   {
     int32_t dataSize = 0;
-    const NSUInteger count = self.packedUint64Array.count;
-    const uint64_t *values = (const uint64_t *)self.packedUint64Array.data;
+    const NSUInteger count = packedUint64Array.count;
+    const uint64_t *values = (const uint64_t *)packedUint64Array.data;
     for (NSUInteger i = 0; i < count; ++i) {
       dataSize += computeUInt64SizeNoTag(values[i]);
     }
-    size += dataSize;
+    size_ += dataSize;
     if (count > 0) {
-      size += 2;
-      size += computeInt32SizeNoTag(dataSize);
+      size_ += 2;
+      size_ += computeInt32SizeNoTag(dataSize);
     }
-    packedUint64MemoizedSerializedSize = dataSize;
+    PBGeneratedMessageSetMemoizedSize(&packedUint64MemoizedSerializedSize, dataSize);
   }
   {
     int32_t dataSize = 0;
-    const NSUInteger count = self.packedSint32Array.count;
-    const int32_t *values = (const int32_t *)self.packedSint32Array.data;
+    const NSUInteger count = packedSint32Array.count;
+    const int32_t *values = (const int32_t *)packedSint32Array.data;
     for (NSUInteger i = 0; i < count; ++i) {
       dataSize += computeSInt32SizeNoTag(values[i]);
     }
-    size += dataSize;
+    size_ += dataSize;
     if (count > 0) {
-      size += 2;
-      size += computeInt32SizeNoTag(dataSize);
+      size_ += 2;
+      size_ += computeInt32SizeNoTag(dataSize);
     }
-    packedSint32MemoizedSerializedSize = dataSize;
+    PBGeneratedMessageSetMemoizedSize(&packedSint32MemoizedSerializedSize, dataSize);
   }
   {
     int32_t dataSize = 0;
-    const NSUInteger count = self.packedSint64Array.count;
-    const int64_t *values = (const int64_t *)self.packedSint64Array.data;
+    const NSUInteger count = packedSint64Array.count;
+    const int64_t *values = (const int64_t *)packedSint64Array.data;
     for (NSUInteger i = 0; i < count; ++i) {
       dataSize += computeSInt64SizeNoTag(values[i]);
     }
-    size += dataSize;
+    size_ += dataSize;
     if (count > 0) {
-      size += 2;
-      size += computeInt32SizeNoTag(dataSize);
+      size_ += 2;
+      size_ += computeInt32SizeNoTag(dataSize);
     }
-    packedSint64MemoizedSerializedSize = dataSize;
+    PBGeneratedMessageSetMemoizedSize(&packedSint64MemoizedSerializedSize, dataSize);
   }
   {
     int32_t dataSize = 0;
-    const NSUInteger count = self.packedFixed32Array.count;
+    const NSUInteger count = packedFixed32Array.count;
     dataSize = 4 * count;
-    size += dataSize;
+    size_ += dataSize;
     if (count > 0) {
-      size += 2;
-      size += computeInt32SizeNoTag(dataSize);
+      size_ += 2;
+      size_ += computeInt32SizeNoTag(dataSize);
     }
-    packedFixed32MemoizedSerializedSize = dataSize;
+    PBGeneratedMessageSetMemoizedSize(&packedFixed32MemoizedSerializedSize, dataSize);
   }
   {
     int32_t dataSize = 0;
-    const NSUInteger count = self.packedFixed64Array.count;
+    const NSUInteger count = packedFixed64Array.count;
     dataSize = 8 * count;
-    size += dataSize;
+    size_ += dataSize;
     if (count > 0) {
-      size += 2;
-      size += computeInt32SizeNoTag(dataSize);
+      size_ += 2;
+      size_ += computeInt32SizeNoTag(dataSize);
     }
-    packedFixed64MemoizedSerializedSize = dataSize;
+    PBGeneratedMessageSetMemoizedSize(&packedFixed64MemoizedSerializedSize, dataSize);
   }
   {
     int32_t dataSize = 0;
-    const NSUInteger count = self.packedSfixed32Array.count;
+    const NSUInteger count = packedSfixed32Array.count;
     dataSize = 4 * count;
-    size += dataSize;
+    size_ += dataSize;
     if (count > 0) {
-      size += 2;
-      size += computeInt32SizeNoTag(dataSize);
+      size_ += 2;
+      size_ += computeInt32SizeNoTag(dataSize);
     }
-    packedSfixed32MemoizedSerializedSize = dataSize;
+    PBGeneratedMessageSetMemoizedSize(&packedSfixed32MemoizedSerializedSize, dataSize);
   }
   {
     int32_t dataSize = 0;
-    const NSUInteger count = self.packedSfixed64Array.count;
+    const NSUInteger count = packedSfixed64Array.count;
     dataSize = 8 * count;
-    size += dataSize;
+    size_ += dataSize;
     if (count > 0) {
-      size += 2;
-      size += computeInt32SizeNoTag(dataSize);
+      size_ += 2;
+      size_ += computeInt32SizeNoTag(dataSize);
     }
-    packedSfixed64MemoizedSerializedSize = dataSize;
+    PBGeneratedMessageSetMemoizedSize(&packedSfixed64MemoizedSerializedSize, dataSize);
   }
   {
     int32_t dataSize = 0;
-    const NSUInteger count = self.packedFloatArray.count;
+    const NSUInteger count = packedFloatArray.count;
     dataSize = 4 * count;
-    size += dataSize;
+    size_ += dataSize;
     if (count > 0) {
-      size += 2;
-      size += computeInt32SizeNoTag(dataSize);
+      size_ += 2;
+      size_ += computeInt32SizeNoTag(dataSize);
     }
-    packedFloatMemoizedSerializedSize = dataSize;
+    PBGeneratedMessageSetMemoizedSize(&packedFloatMemoizedSerializedSize, dataSize);
   }
   {
     int32_t dataSize = 0;
-    const NSUInteger count = self.packedDoubleArray.count;
+    const NSUInteger count = packedDoubleArray.count;
     dataSize = 8 * count;
-    size += dataSize;
+    size_ += dataSize;
     if (count > 0) {
-      size += 2;
-      size += computeInt32SizeNoTag(dataSize);
+      size_ += 2;
+      size_ += computeInt32SizeNoTag(dataSize);
     }
-    packedDoubleMemoizedSerializedSize = dataSize;
+    PBGeneratedMessageSetMemoizedSize(&packedDoubleMemoizedSerializedSize, dataSize);
   }
   {
     int32_t dataSize = 0;
-    const NSUInteger count = self.packedBoolArray.count;
+    const NSUInteger count = packedBoolArray.count;
     dataSize = 1 * count;
-    size += dataSize;
+    size_ += dataSize;
     if (count > 0) {
-      size += 2;
-      size += computeInt32SizeNoTag(dataSize);
+      size_ += 2;
+      size_ += computeInt32SizeNoTag(dataSize);
     }
-    packedBoolMemoizedSerializedSize = dataSize;
+    PBGeneratedMessageSetMemoizedSize(&packedBoolMemoizedSerializedSize, dataSize);
   }
   {
     int32_t dataSize = 0;
-    const NSUInteger count = self.packedEnumArray.count;
-    const ForeignEnumLite *values = (const ForeignEnumLite *)self.packedEnumArray.data;
+    const NSUInteger count = packedEnumArray.count;
+    const ForeignEnumLite *values = (const ForeignEnumLite *)packedEnumArray.data;
     for (NSUInteger i = 0; i < count; ++i) {
       dataSize += computeEnumSizeNoTag(values[i]);
     }
-    size += dataSize;
+    size_ += dataSize;
     if (count > 0) {
-      size += 2;
-      size += computeRawVarint32Size(dataSize);
+      size_ += 2;
+      size_ += computeRawVarint32Size(dataSize);
     }
-    packedEnumMemoizedSerializedSize = dataSize;
+    PBGeneratedMessageSetMemoizedSize(&packedEnumMemoizedSerializedSize, dataSize);
   }
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
+  PBGeneratedMessageSetMemoizedSize(&memoizedSerializedSize, size_);
+  return size_;
 }
 + (TestPackedTypesLite*) parseFromData:(NSData*) data {
   return (TestPackedTypesLite*)[[[TestPackedTypesLite builder] mergeFromData:data] build];
@@ -6573,7 +8057,7 @@ static TestPackedTypesLite* defaultTestPackedTypesLiteInstance = nil;
   return [[[TestPackedTypesLite_Builder alloc] init] autorelease];
 }
 + (TestPackedTypesLite_Builder*) builderWithPrototype:(TestPackedTypesLite*) prototype {
-  return [[TestPackedTypesLite builder] mergeFrom:prototype];
+  return [[[TestPackedTypesLite_Builder alloc] initWithPrototype:prototype] autorelease];
 }
 - (TestPackedTypesLite_Builder*) builder {
   return [TestPackedTypesLite builder];
@@ -6581,51 +8065,6 @@ static TestPackedTypesLite* defaultTestPackedTypesLiteInstance = nil;
 - (TestPackedTypesLite_Builder*) toBuilder {
   return [TestPackedTypesLite builderWithPrototype:self];
 }
-- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
-  for (NSNumber* value in self.packedInt32Array) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"packedInt32", value];
-  }
-  for (NSNumber* value in self.packedInt64Array) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"packedInt64", value];
-  }
-  for (NSNumber* value in self.packedUint32Array) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"packedUint32", value];
-  }
-  for (NSNumber* value in self.packedUint64Array) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"packedUint64", value];
-  }
-  for (NSNumber* value in self.packedSint32Array) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"packedSint32", value];
-  }
-  for (NSNumber* value in self.packedSint64Array) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"packedSint64", value];
-  }
-  for (NSNumber* value in self.packedFixed32Array) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"packedFixed32", value];
-  }
-  for (NSNumber* value in self.packedFixed64Array) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"packedFixed64", value];
-  }
-  for (NSNumber* value in self.packedSfixed32Array) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"packedSfixed32", value];
-  }
-  for (NSNumber* value in self.packedSfixed64Array) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"packedSfixed64", value];
-  }
-  for (NSNumber* value in self.packedFloatArray) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"packedFloat", value];
-  }
-  for (NSNumber* value in self.packedDoubleArray) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"packedDouble", value];
-  }
-  for (NSNumber* value in self.packedBoolArray) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"packedBool", value];
-  }
-  for (NSNumber* element in self.packedEnumArray) {
-    [output appendFormat:@"%@%@: %d\n", indent, @"packedEnum", element.intValue];
-  }
-  [self.unknownFields writeDescriptionTo:output withIndent:indent];
-}
 - (BOOL) isEqual:(id)other {
   if (other == self) {
     return YES;
@@ -6635,110 +8074,121 @@ static TestPackedTypesLite* defaultTestPackedTypesLiteInstance = nil;
   }
   TestPackedTypesLite *otherMessage = other;
   return
-      [self.packedInt32Array isEqualToArray:otherMessage.packedInt32Array] &&
-      
-      [self.packedInt64Array isEqualToArray:otherMessage.packedInt64Array] &&
-      
-      [self.packedUint32Array isEqualToArray:otherMessage.packedUint32Array] &&
-      
-      [self.packedUint64Array isEqualToArray:otherMessage.packedUint64Array] &&
-      
-      [self.packedSint32Array isEqualToArray:otherMessage.packedSint32Array] &&
-      
-      [self.packedSint64Array isEqualToArray:otherMessage.packedSint64Array] &&
-      
-      [self.packedFixed32Array isEqualToArray:otherMessage.packedFixed32Array] &&
-      
-      [self.packedFixed64Array isEqualToArray:otherMessage.packedFixed64Array] &&
-      
-      [self.packedSfixed32Array isEqualToArray:otherMessage.packedSfixed32Array] &&
-      
-      [self.packedSfixed64Array isEqualToArray:otherMessage.packedSfixed64Array] &&
-      
-      [self.packedFloatArray isEqualToArray:otherMessage.packedFloatArray] &&
-      
-      [self.packedDoubleArray isEqualToArray:otherMessage.packedDoubleArray] &&
-      
-      [self.packedBoolArray isEqualToArray:otherMessage.packedBoolArray] &&
-      
-      [self.packedEnumArray isEqualToArray:otherMessage.packedEnumArray] &&
-      
-      (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
+      (packedInt32Array.count == 0 ? otherMessage->packedInt32Array.count == 0 : [packedInt32Array isEqualToArray:otherMessage->packedInt32Array]) &&
+      (packedInt64Array.count == 0 ? otherMessage->packedInt64Array.count == 0 : [packedInt64Array isEqualToArray:otherMessage->packedInt64Array]) &&
+      (packedUint32Array.count == 0 ? otherMessage->packedUint32Array.count == 0 : [packedUint32Array isEqualToArray:otherMessage->packedUint32Array]) &&
+      (packedUint64Array.count == 0 ? otherMessage->packedUint64Array.count == 0 : [packedUint64Array isEqualToArray:otherMessage->packedUint64Array]) &&
+      (packedSint32Array.count == 0 ? otherMessage->packedSint32Array.count == 0 : [packedSint32Array isEqualToArray:otherMessage->packedSint32Array]) &&
+      (packedSint64Array.count == 0 ? otherMessage->packedSint64Array.count == 0 : [packedSint64Array isEqualToArray:otherMessage->packedSint64Array]) &&
+      (packedFixed32Array.count == 0 ? otherMessage->packedFixed32Array.count == 0 : [packedFixed32Array isEqualToArray:otherMessage->packedFixed32Array]) &&
+      (packedFixed64Array.count == 0 ? otherMessage->packedFixed64Array.count == 0 : [packedFixed64Array isEqualToArray:otherMessage->packedFixed64Array]) &&
+      (packedSfixed32Array.count == 0 ? otherMessage->packedSfixed32Array.count == 0 : [packedSfixed32Array isEqualToArray:otherMessage->packedSfixed32Array]) &&
+      (packedSfixed64Array.count == 0 ? otherMessage->packedSfixed64Array.count == 0 : [packedSfixed64Array isEqualToArray:otherMessage->packedSfixed64Array]) &&
+      (packedFloatArray.count == 0 ? otherMessage->packedFloatArray.count == 0 : [packedFloatArray isEqualToArray:otherMessage->packedFloatArray]) &&
+      (packedDoubleArray.count == 0 ? otherMessage->packedDoubleArray.count == 0 : [packedDoubleArray isEqualToArray:otherMessage->packedDoubleArray]) &&
+      (packedBoolArray.count == 0 ? otherMessage->packedBoolArray.count == 0 : [packedBoolArray isEqualToArray:otherMessage->packedBoolArray]) &&
+      (packedEnumArray.count == 0 ? otherMessage->packedEnumArray.count == 0 : [packedEnumArray isEqualToArray:otherMessage->packedEnumArray]) &&
+      YES;
 }
 - (NSUInteger) hash {
-  NSUInteger hashCode = 7;
-  for (NSNumber* value in self.packedInt32Array) {
-    hashCode = hashCode * 31 + [value intValue];
-  }
-  for (NSNumber* value in self.packedInt64Array) {
-    hashCode = hashCode * 31 + [value intValue];
-  }
-  for (NSNumber* value in self.packedUint32Array) {
-    hashCode = hashCode * 31 + [value intValue];
-  }
-  for (NSNumber* value in self.packedUint64Array) {
-    hashCode = hashCode * 31 + [value intValue];
-  }
-  for (NSNumber* value in self.packedSint32Array) {
-    hashCode = hashCode * 31 + [value intValue];
-  }
-  for (NSNumber* value in self.packedSint64Array) {
-    hashCode = hashCode * 31 + [value intValue];
-  }
-  for (NSNumber* value in self.packedFixed32Array) {
-    hashCode = hashCode * 31 + [value intValue];
-  }
-  for (NSNumber* value in self.packedFixed64Array) {
-    hashCode = hashCode * 31 + [value intValue];
-  }
-  for (NSNumber* value in self.packedSfixed32Array) {
-    hashCode = hashCode * 31 + [value intValue];
+  NSUInteger hash_ = PBGeneratedMessageGetMemoizedHash(&memoizedHash);
+  if (hash_ != 0) {
+    return hash_;
   }
-  for (NSNumber* value in self.packedSfixed64Array) {
-    hashCode = hashCode * 31 + [value intValue];
-  }
-  for (NSNumber* value in self.packedFloatArray) {
-    hashCode = hashCode * 31 + [value intValue];
-  }
-  for (NSNumber* value in self.packedDoubleArray) {
-    hashCode = hashCode * 31 + [value intValue];
-  }
-  for (NSNumber* value in self.packedBoolArray) {
-    hashCode = hashCode * 31 + [value intValue];
-  }
-  for (NSNumber* element in self.packedEnumArray) {
-    hashCode = hashCode * 31 + element.intValue;
-  }
-  hashCode = hashCode * 31 + [self.unknownFields hash];
-  return hashCode;
-}
-@end
 
-@interface TestPackedTypesLite_Builder()
-@property (retain) TestPackedTypesLite* result;
+  uint64_t hashCode = 7;
+  hashCode = PBGeneratedMessageHashMix(hashCode, [packedInt32Array hash64]);
+  hashCode = PBGeneratedMessageHashMix(hashCode, [packedInt64Array hash64]);
+  hashCode = PBGeneratedMessageHashMix(hashCode, [packedUint32Array hash64]);
+  hashCode = PBGeneratedMessageHashMix(hashCode, [packedUint64Array hash64]);
+  hashCode = PBGeneratedMessageHashMix(hashCode, [packedSint32Array hash64]);
+  hashCode = PBGeneratedMessageHashMix(hashCode, [packedSint64Array hash64]);
+  hashCode = PBGeneratedMessageHashMix(hashCode, [packedFixed32Array hash64]);
+  hashCode = PBGeneratedMessageHashMix(hashCode, [packedFixed64Array hash64]);
+  hashCode = PBGeneratedMessageHashMix(hashCode, [packedSfixed32Array hash64]);
+  hashCode = PBGeneratedMessageHashMix(hashCode, [packedSfixed64Array hash64]);
+  hashCode = PBGeneratedMessageHashMix(hashCode, [packedFloatArray hash64]);
+  hashCode = PBGeneratedMessageHashMix(hashCode, [packedDoubleArray hash64]);
+  hashCode = PBGeneratedMessageHashMix(hashCode, [packedBoolArray hash64]);
+  hashCode = PBGeneratedMessageHashMix(hashCode, [packedEnumArray hash64]);
+  hash_ = PBGeneratedMessageHashFinish(hashCode);
+  PBGeneratedMessageSetMemoizedHash(&memoizedHash, hash_);
+  return hash_;
+}
 @end
 
 @implementation TestPackedTypesLite_Builder
 @synthesize result;
 - (void) dealloc {
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
   self.result = nil;
+  [prototype_ release];
   [super dealloc];
 }
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[[TestPackedTypesLite alloc] init] autorelease];
+    result = [TestPackedTypesLite recycledInstance];
+  }
+  return self;
+}
+- (id) initWithPrototype:(TestPackedTypesLite*) prototype {
+  if ((self = [super init])) {
+    self.result = prototype;
+    prototype_ = [prototype retain];
   }
   return self;
 }
+- (void) detachFromPrototype {
+  TestPackedTypesLite* prototype = prototype_;
+  prototype_ = nil;
+  self.result = [[[TestPackedTypesLite alloc] init] autorelease];
+  [self mergeFrom:prototype];
+  [prototype release];
+}
+- (PBGeneratedMessage*) internalGetMutableResult {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return [self internalGetResult];
+}
 - (PBGeneratedMessage*) internalGetResult {
   return result;
 }
 - (TestPackedTypesLite_Builder*) clear {
-  self.result = [[[TestPackedTypesLite alloc] init] autorelease];
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = [[TestPackedTypesLite recycledInstance] autorelease];
   return self;
 }
 - (TestPackedTypesLite_Builder*) clone {
-  return [TestPackedTypesLite builderWithPrototype:result];
+  if (prototype_ != nil) {
+    return [[[TestPackedTypesLite_Builder alloc] initWithPrototype:prototype_] autorelease];
+  }
+  return [[TestPackedTypesLite builder] mergeFrom:result];
+}
+- (TestPackedTypesLite_Builder*) reset {
+  if (result == nil || prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    self.result = [[TestPackedTypesLite recycledInstance] autorelease];
+  } else {
+    [result clearForReuse];
+  }
+  return self;
+}
+- (TestPackedTypesLite_Builder*) recycle:(TestPackedTypesLite*) message {
+  if (message == [TestPackedTypesLite defaultInstance]) {
+    @throw [NSException exceptionWithName:@"IllegalArgument" reason:@"Cannot recycle the default instance" userInfo:nil];
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = message;
+  return [self reset];
 }
 - (TestPackedTypesLite*) defaultInstance {
   return [TestPackedTypesLite defaultInstance];
@@ -6748,141 +8198,170 @@ static TestPackedTypesLite* defaultTestPackedTypesLiteInstance = nil;
   return [self buildPartial];
 }
 - (TestPackedTypesLite*) buildPartial {
-  TestPackedTypesLite* returnMe = [[result retain] autorelease];
-  self.result = nil;
+  return [[self newBuildPartial] autorelease];
+}
+- (TestPackedTypesLite*) newBuildPartial {
+  if (prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    TestPackedTypesLite* returnMe = result;
+    result = nil;
+    return returnMe;
+  }
+  [result->packedInt32Array shrinkToFit];
+  [result->packedInt64Array shrinkToFit];
+  [result->packedUint32Array shrinkToFit];
+  [result->packedUint64Array shrinkToFit];
+  [result->packedSint32Array shrinkToFit];
+  [result->packedSint64Array shrinkToFit];
+  [result->packedFixed32Array shrinkToFit];
+  [result->packedFixed64Array shrinkToFit];
+  [result->packedSfixed32Array shrinkToFit];
+  [result->packedSfixed64Array shrinkToFit];
+  [result->packedFloatArray shrinkToFit];
+  [result->packedDoubleArray shrinkToFit];
+  [result->packedBoolArray shrinkToFit];
+  [result->packedEnumArray shrinkToFit];
+  TestPackedTypesLite* returnMe = result;
+  result = nil;
   return returnMe;
 }
 - (TestPackedTypesLite_Builder*) mergeFrom:(TestPackedTypesLite*) other {
   if (other == [TestPackedTypesLite defaultInstance]) {
     return self;
   }
-  if (other.packedInt32Array.count > 0) {
-    if (result.packedInt32Array == nil) {
-      result.packedInt32Array = [[other.packedInt32Array copyWithZone:[other.packedInt32Array zone]] autorelease];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (other->packedInt32Array.count > 0) {
+    if (result->packedInt32Array == nil) {
+      result.packedInt32Array = [[other->packedInt32Array copyWithZone:[other->packedInt32Array zone]] autorelease];
     } else {
-      [result.packedInt32Array appendArray:other.packedInt32Array];
+      [result->packedInt32Array appendArray:other->packedInt32Array];
     }
   }
-  if (other.packedInt64Array.count > 0) {
-    if (result.packedInt64Array == nil) {
-      result.packedInt64Array = [[other.packedInt64Array copyWithZone:[other.packedInt64Array zone]] autorelease];
+  if (other->packedInt64Array.count > 0) {
+    if (result->packedInt64Array == nil) {
+      result.packedInt64Array = [[other->packedInt64Array copyWithZone:[other->packedInt64Array zone]] autorelease];
     } else {
-      [result.packedInt64Array appendArray:other.packedInt64Array];
+      [result->packedInt64Array appendArray:other->packedInt64Array];
     }
   }
-  if (other.packedUint32Array.count > 0) {
-    if (result.packedUint32Array == nil) {
-      result.packedUint32Array = [[other.packedUint32Array copyWithZone:[other.packedUint32Array zone]] autorelease];
+  if (other->packedUint32Array.count > 0) {
+    if (result->packedUint32Array == nil) {
+      result.packedUint32Array = [[other->packedUint32Array copyWithZone:[other->packedUint32Array zone]] autorelease];
     } else {
-      [result.packedUint32Array appendArray:other.packedUint32Array];
+      [result->packedUint32Array appendArray:other->packedUint32Array];
     }
   }
-  if (other.packedUint64Array.count > 0) {
-    if (result.packedUint64Array == nil) {
-      result.packedUint64Array = [[other.packedUint64Array copyWithZone:[other.packedUint64Array zone]] autorelease];
+  if (other->packedUint64Array.count > 0) {
+    if (result->packedUint64Array == nil) {
+      result.packedUint64Array = [[other->packedUint64Array copyWithZone:[other->packedUint64Array zone]] autorelease];
     } else {
-      [result.packedUint64Array appendArray:other.packedUint64Array];
+      [result->packedUint64Array appendArray:other->packedUint64Array];
     }
   }
-  if (other.packedSint32Array.count > 0) {
-    if (result.packedSint32Array == nil) {
-      result.packedSint32Array = [[other.packedSint32Array copyWithZone:[other.packedSint32Array zone]] autorelease];
+  if (other->packedSint32Array.count > 0) {
+    if (result->packedSint32Array == nil) {
+      result.packedSint32Array = [[other->packedSint32Array copyWithZone:[other->packedSint32Array zone]] autorelease];
     } else {
-      [result.packedSint32Array appendArray:other.packedSint32Array];
+      [result->packedSint32Array appendArray:other->packedSint32Array];
     }
   }
-  if (other.packedSint64Array.count > 0) {
-    if (result.packedSint64Array == nil) {
-      result.packedSint64Array = [[other.packedSint64Array copyWithZone:[other.packedSint64Array zone]] autorelease];
+  if (other->packedSint64Array.count > 0) {
+    if (result->packedSint64Array == nil) {
+      result.packedSint64Array = [[other->packedSint64Array copyWithZone:[other->packedSint64Array zone]] autorelease];
     } else {
-      [result.packedSint64Array appendArray:other.packedSint64Array];
+      [result->packedSint64Array appendArray:other->packedSint64Array];
     }
   }
-  if (other.packedFixed32Array.count > 0) {
-    if (result.packedFixed32Array == nil) {
-      result.packedFixed32Array = [[other.packedFixed32Array copyWithZone:[other.packedFixed32Array zone]] autorelease];
+  if (other->packedFixed32Array.count > 0) {
+    if (result->packedFixed32Array == nil) {
+      result.packedFixed32Array = [[other->packedFixed32Array copyWithZone:[other->packedFixed32Array zone]] autorelease];
     } else {
-      [result.packedFixed32Array appendArray:other.packedFixed32Array];
+      [result->packedFixed32Array appendArray:other->packedFixed32Array];
     }
   }
-  if (other.packedFixed64Array.count > 0) {
-    if (result.packedFixed64Array == nil) {
-      result.packedFixed64Array = [[other.packedFixed64Array copyWithZone:[other.packedFixed64Array zone]] autorelease];
+  if (other->packedFixed64Array.count > 0) {
+    if (result->packedFixed64Array == nil) {
+      result.packedFixed64Array = [[other->packedFixed64Array copyWithZone:[other->packedFixed64Array zone]] autorelease];
     } else {
-      [result.packedFixed64Array appendArray:other.packedFixed64Array];
+      [result->packedFixed64Array appendArray:other->packedFixed64Array];
     }
   }
-  if (other.packedSfixed32Array.count > 0) {
-    if (result.packedSfixed32Array == nil) {
-      result.packedSfixed32Array = [[other.packedSfixed32Array copyWithZone:[other.packedSfixed32Array zone]] autorelease];
+  if (other->packedSfixed32Array.count > 0) {
+    if (result->packedSfixed32Array == nil) {
+      result.packedSfixed32Array = [[other->packedSfixed32Array copyWithZone:[other->packedSfixed32Array zone]] autorelease];
     } else {
-      [result.packedSfixed32Array appendArray:other.packedSfixed32Array];
+      [result->packedSfixed32Array appendArray:other->packedSfixed32Array];
     }
   }
-  if (other.packedSfixed64Array.count > 0) {
-    if (result.packedSfixed64Array == nil) {
-      result.packedSfixed64Array = [[other.packedSfixed64Array copyWithZone:[other.packedSfixed64Array zone]] autorelease];
+  if (other->packedSfixed64Array.count > 0) {
+    if (result->packedSfixed64Array == nil) {
+      result.packedSfixed64Array = [[other->packedSfixed64Array copyWithZone:[other->packedSfixed64Array zone]] autorelease];
     } else {
-      [result.packedSfixed64Array appendArray:other.packedSfixed64Array];
+      [result->packedSfixed64Array appendArray:other->packedSfixed64Array];
     }
   }
-  if (other.packedFloatArray.count > 0) {
-    if (result.packedFloatArray == nil) {
-      result.packedFloatArray = [[other.packedFloatArray copyWithZone:[other.packedFloatArray zone]] autorelease];
+  if (other->packedFloatArray.count > 0) {
+    if (result->packedFloatArray == nil) {
+      result.packedFloatArray = [[other->packedFloatArray copyWithZone:[other->packedFloatArray zone]] autorelease];
     } else {
-      [result.packedFloatArray appendArray:other.packedFloatArray];
+      [result->packedFloatArray appendArray:other->packedFloatArray];
     }
   }
-  if (other.packedDoubleArray.count > 0) {
-    if (result.packedDoubleArray == nil) {
-      result.packedDoubleArray = [[other.packedDoubleArray copyWithZone:[other.packedDoubleArray zone]] autorelease];
+  if (other->packedDoubleArray.count > 0) {
+    if (result->packedDoubleArray == nil) {
+      result.packedDoubleArray = [[other->packedDoubleArray copyWithZone:[other->packedDoubleArray zone]] autorelease];
     } else {
-      [result.packedDoubleArray appendArray:other.packedDoubleArray];
+      [result->packedDoubleArray appendArray:other->packedDoubleArray];
     }
   }
-  if (other.packedBoolArray.count > 0) {
-    if (result.packedBoolArray == nil) {
-      result.packedBoolArray = [[other.packedBoolArray copyWithZone:[other.packedBoolArray zone]] autorelease];
+  if (other->packedBoolArray.count > 0) {
+    if (result->packedBoolArray == nil) {
+      result.packedBoolArray = [[other->packedBoolArray copyWithZone:[other->packedBoolArray zone]] autorelease];
     } else {
-      [result.packedBoolArray appendArray:other.packedBoolArray];
+      [result->packedBoolArray appendArray:other->packedBoolArray];
     }
   }
-  if (other.packedEnumArray.count > 0) {
-    if (result.packedEnumArray == nil) {
-      result.packedEnumArray = [[other.packedEnumArray copyWithZone:[other.packedEnumArray zone]] autorelease];
+  if (other->packedEnumArray.count > 0) {
+    if (result->packedEnumArray == nil) {
+      result.packedEnumArray = [[other->packedEnumArray copyWithZone:[other->packedEnumArray zone]] autorelease];
     } else {
-      [result.packedEnumArray appendArray:other.packedEnumArray];
+      [result->packedEnumArray appendArray:other->packedEnumArray];
     }
   }
-  [self mergeUnknownFields:other.unknownFields];
   return self;
 }
 - (TestPackedTypesLite_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input {
   return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
 }
 - (TestPackedTypesLite_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
   while (YES) {
     int32_t tag = [input readTag];
     switch (tag) {
       case 0:
-        [self setUnknownFields:[unknownFields build]];
         return self;
       default: {
-        if (![self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag]) {
-          [self setUnknownFields:[unknownFields build]];
+        if (PBWireFormatGetTagWireType(tag) == PBWireFormatEndGroup) {
           return self;
         }
+        [input skipField:tag];
         break;
       }
       case 722: {
         int32_t length = [input readRawVarint32];
         int32_t limit = [input pushLimit:length];
-        if (result.packedInt32Array == nil) {
-          result.packedInt32Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeInt32];
+        if (result->packedInt32Array == nil) {
+          result.packedInt32Array = [PBInt32Array array];
         }
+        PBInt32Array *values = result->packedInt32Array;
+        [values reserveCapacity:values.count + input.bytesBufferedUntilLimit inArena:input.arena];
         while (input.bytesUntilLimit > 0) {
-          [result.packedInt32Array addInt32:[input readInt32]];
+          PBInt32ArrayAddValue(values, [input readInt32]);
         }
         [input popLimit:limit];
         break;
@@ -6890,11 +8369,13 @@ static TestPackedTypesLite* defaultTestPackedTypesLiteInstance = nil;
       case 730: {
         int32_t length = [input readRawVarint32];
         int32_t limit = [input pushLimit:length];
-        if (result.packedInt64Array == nil) {
-          result.packedInt64Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeInt64];
+        if (result->packedInt64Array == nil) {
+          result.packedInt64Array = [PBInt64Array array];
         }
+        PBInt64Array *values = result->packedInt64Array;
+        [values reserveCapacity:values.count + input.bytesBufferedUntilLimit inArena:input.arena];
         while (input.bytesUntilLimit > 0) {
-          [result.packedInt64Array addInt64:[input readInt64]];
+          PBInt64ArrayAddValue(values, [input readInt64]);
         }
         [input popLimit:limit];
         break;
@@ -6902,11 +8383,13 @@ static TestPackedTypesLite* defaultTestPackedTypesLiteInstance = nil;
       case 738: {
         int32_t length = [input readRawVarint32];
         int32_t limit = [input pushLimit:length];
-        if (result.packedUint32Array == nil) {
-          result.packedUint32Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeUInt32];
+        if (result->packedUint32Array == nil) {
+          result.packedUint32Array = [PBUInt32Array array];
         }
+        PBUInt32Array *values = result->packedUint32Array;
+        [values reserveCapacity:values.count + input.bytesBufferedUntilLimit inArena:input.arena];
         while (input.bytesUntilLimit > 0) {
-          [result.packedUint32Array addUint32:[input readUInt32]];
+          PBUInt32ArrayAddValue(values, [input readUInt32]);
         }
         [input popLimit:limit];
         break;
@@ -6914,11 +8397,13 @@ static TestPackedTypesLite* defaultTestPackedTypesLiteInstance = nil;
       case 746: {
         int32_t length = [input readRawVarint32];
         int32_t limit = [input pushLimit:length];
-        if (result.packedUint64Array == nil) {
-          result.packedUint64Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeUInt64];
+        if (result->packedUint64Array == nil) {
+          result.packedUint64Array = [PBUInt64Array array];
         }
+        PBUInt64Array *values = result->packedUint64Array;
+        [values reserveCapacity:values.count + input.bytesBufferedUntilLimit inArena:input.arena];
         while (input.bytesUntilLimit > 0) {
-          [result.packedUint64Array addUint64:[input readUInt64]];
+          PBUInt64ArrayAddValue(values, [input readUInt64]);
         }
         [input popLimit:limit];
         break;
@@ -6926,11 +8411,13 @@ static TestPackedTypesLite* defaultTestPackedTypesLiteInstance = nil;
       case 754: {
         int32_t length = [input readRawVarint32];
         int32_t limit = [input pushLimit:length];
-        if (result.packedSint32Array == nil) {
-          result.packedSint32Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeInt32];
+        if (result->packedSint32Array == nil) {
+          result.packedSint32Array = [PBInt32Array array];
         }
+        PBInt32Array *values = result->packedSint32Array;
+        [values reserveCapacity:values.count + input.bytesBufferedUntilLimit inArena:input.arena];
         while (input.bytesUntilLimit > 0) {
-          [result.packedSint32Array addInt32:[input readSInt32]];
+          PBInt32ArrayAddValue(values, [input readSInt32]);
         }
         [input popLimit:limit];
         break;
@@ -6938,11 +8425,13 @@ static TestPackedTypesLite* defaultTestPackedTypesLiteInstance = nil;
       case 762: {
         int32_t length = [input readRawVarint32];
         int32_t limit = [input pushLimit:length];
-        if (result.packedSint64Array == nil) {
-          result.packedSint64Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeInt64];
+        if (result->packedSint64Array == nil) {
+          result.packedSint64Array = [PBInt64Array array];
         }
+        PBInt64Array *values = result->packedSint64Array;
+        [values reserveCapacity:values.count + input.bytesBufferedUntilLimit inArena:input.arena];
         while (input.bytesUntilLimit > 0) {
-          [result.packedSint64Array addInt64:[input readSInt64]];
+          PBInt64ArrayAddValue(values, [input readSInt64]);
         }
         [input popLimit:limit];
         break;
@@ -6950,11 +8439,13 @@ static TestPackedTypesLite* defaultTestPackedTypesLiteInstance = nil;
       case 770: {
         int32_t length = [input readRawVarint32];
         int32_t limit = [input pushLimit:length];
-        if (result.packedFixed32Array == nil) {
-          result.packedFixed32Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeUInt32];
+        if (result->packedFixed32Array == nil) {
+          result.packedFixed32Array = [PBUInt32Array array];
         }
+        PBUInt32Array *values = result->packedFixed32Array;
+        [values reserveCapacity:values.count + input.bytesBufferedUntilLimit / 4 inArena:input.arena];
         while (input.bytesUntilLimit > 0) {
-          [result.packedFixed32Array addUint32:[input readFixed32]];
+          PBUInt32ArrayAddValue(values, [input readFixed32]);
         }
         [input popLimit:limit];
         break;
@@ -6962,11 +8453,13 @@ static TestPackedTypesLite* defaultTestPackedTypesLiteInstance = nil;
       case 778: {
         int32_t length = [input readRawVarint32];
         int32_t limit = [input pushLimit:length];
-        if (result.packedFixed64Array == nil) {
-          result.packedFixed64Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeUInt64];
+        if (result->packedFixed64Array == nil) {
+          result.packedFixed64Array = [PBUInt64Array array];
         }
+        PBUInt64Array *values = result->packedFixed64Array;
+        [values reserveCapacity:values.count + input.bytesBufferedUntilLimit / 8 inArena:input.arena];
         while (input.bytesUntilLimit > 0) {
-          [result.packedFixed64Array addUint64:[input readFixed64]];
+          PBUInt64ArrayAddValue(values, [input readFixed64]);
         }
         [input popLimit:limit];
         break;
@@ -6974,11 +8467,13 @@ static TestPackedTypesLite* defaultTestPackedTypesLiteInstance = nil;
       case 786: {
         int32_t length = [input readRawVarint32];
         int32_t limit = [input pushLimit:length];
-        if (result.packedSfixed32Array == nil) {
-          result.packedSfixed32Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeInt32];
+        if (result->packedSfixed32Array == nil) {
+          result.packedSfixed32Array = [PBInt32Array array];
         }
+        PBInt32Array *values = result->packedSfixed32Array;
+        [values reserveCapacity:values.count + input.bytesBufferedUntilLimit / 4 inArena:input.arena];
         while (input.bytesUntilLimit > 0) {
-          [result.packedSfixed32Array addInt32:[input readSFixed32]];
+          PBInt32ArrayAddValue(values, [input readSFixed32]);
         }
         [input popLimit:limit];
         break;
@@ -6986,11 +8481,13 @@ static TestPackedTypesLite* defaultTestPackedTypesLiteInstance = nil;
       case 794: {
         int32_t length = [input readRawVarint32];
         int32_t limit = [input pushLimit:length];
-        if (result.packedSfixed64Array == nil) {
-          result.packedSfixed64Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeInt64];
+        if (result->packedSfixed64Array == nil) {
+          result.packedSfixed64Array = [PBInt64Array array];
         }
+        PBInt64Array *values = result->packedSfixed64Array;
+        [values reserveCapacity:values.count + input.bytesBufferedUntilLimit / 8 inArena:input.arena];
         while (input.bytesUntilLimit > 0) {
-          [result.packedSfixed64Array addInt64:[input readSFixed64]];
+          PBInt64ArrayAddValue(values, [input readSFixed64]);
         }
         [input popLimit:limit];
         break;
@@ -6998,11 +8495,13 @@ static TestPackedTypesLite* defaultTestPackedTypesLiteInstance = nil;
       case 802: {
         int32_t length = [input readRawVarint32];
         int32_t limit = [input pushLimit:length];
-        if (result.packedFloatArray == nil) {
-          result.packedFloatArray = [PBAppendableArray arrayWithValueType:PBArrayValueTypeFloat];
+        if (result->packedFloatArray == nil) {
+          result.packedFloatArray = [PBFloatArray array];
         }
+        PBFloatArray *values = result->packedFloatArray;
+        [values reserveCapacity:values.count + input.bytesBufferedUntilLimit / 4 inArena:input.arena];
         while (input.bytesUntilLimit > 0) {
-          [result.packedFloatArray addFloat:[input readFloat]];
+          PBFloatArrayAddValue(values, [input readFloat]);
         }
         [input popLimit:limit];
         break;
@@ -7010,11 +8509,13 @@ static TestPackedTypesLite* defaultTestPackedTypesLiteInstance = nil;
       case 810: {
         int32_t length = [input readRawVarint32];
         int32_t limit = [input pushLimit:length];
-        if (result.packedDoubleArray == nil) {
-          result.packedDoubleArray = [PBAppendableArray arrayWithValueType:PBArrayValueTypeDouble];
+        if (result->packedDoubleArray == nil) {
+          result.packedDoubleArray = [PBDoubleArray array];
         }
+        PBDoubleArray *values = result->packedDoubleArray;
+        [values reserveCapacity:values.count + input.bytesBufferedUntilLimit / 8 inArena:input.arena];
         while (input.bytesUntilLimit > 0) {
-          [result.packedDoubleArray addDouble:[input readDouble]];
+          PBDoubleArrayAddValue(values, [input readDouble]);
         }
         [input popLimit:limit];
         break;
@@ -7022,24 +8523,28 @@ static TestPackedTypesLite* defaultTestPackedTypesLiteInstance = nil;
       case 818: {
         int32_t length = [input readRawVarint32];
         int32_t limit = [input pushLimit:length];
-        if (result.packedBoolArray == nil) {
-          result.packedBoolArray = [PBAppendableArray arrayWithValueType:PBArrayValueTypeBool];
+        if (result->packedBoolArray == nil) {
+          result.packedBoolArray = [PBBoolArray array];
         }
+        PBBoolArray *values = result->packedBoolArray;
+        [values reserveCapacity:values.count + input.bytesBufferedUntilLimit / 1 inArena:input.arena];
         while (input.bytesUntilLimit > 0) {
-          [result.packedBoolArray addBool:[input readBool]];
+          PBBoolArrayAddValue(values, [input readBool]);
         }
         [input popLimit:limit];
         break;
       }
       case 826: {
+        if (result->packedEnumArray == nil) {
+          result.packedEnumArray = [PBInt32Array array];
+        }
         int32_t length = [input readRawVarint32];
         int32_t oldLimit = [input pushLimit:length];
+        [result->packedEnumArray reserveCapacity:result->packedEnumArray.count + input.bytesBufferedUntilLimit inArena:input.arena];
         while (input.bytesUntilLimit > 0) {
           int32_t value = [input readEnum];
           if (ForeignEnumLiteIsValidValue(value)) {
             [self addPackedEnum:value];
-          } else {
-            [unknownFields mergeVarintField:103 value:value];
           }
         }
         [input popLimit:oldLimit];
@@ -7049,358 +8554,673 @@ static TestPackedTypesLite* defaultTestPackedTypesLiteInstance = nil;
   }
 }
 - (PBAppendableArray *)packedInt32 {
-  return result.packedInt32Array;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return result->packedInt32Array;
 }
 - (int32_t)packedInt32AtIndex:(NSUInteger)index {
   return [result packedInt32AtIndex:index];
 }
 - (TestPackedTypesLite_Builder *)addPackedInt32:(int32_t)value {
-  if (result.packedInt32Array == nil) {
-    result.packedInt32Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeInt32];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  [result.packedInt32Array addInt32:value];
+  if (result->packedInt32Array == nil) {
+    result.packedInt32Array = [PBInt32Array array];
+  }
+  PBInt32ArrayAddValue(result->packedInt32Array, value);
   return self;
 }
 - (TestPackedTypesLite_Builder *)setPackedInt32Array:(NSArray *)array {
-  result.packedInt32Array = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeInt32];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.packedInt32Array = [PBInt32Array arrayWithArray:array valueType:PBArrayValueTypeInt32];
+  return self;
+}
+- (TestPackedTypesLite_Builder *)setPackedInt32:(PBArray *)array {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.packedInt32Array = array ? [PBInt32Array arrayWithStorageOfArray:array] : nil;
   return self;
 }
 - (TestPackedTypesLite_Builder *)setPackedInt32Values:(const int32_t *)values count:(NSUInteger)count {
-  result.packedInt32Array = [PBAppendableArray arrayWithValues:values count:count valueType:PBArrayValueTypeInt32];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.packedInt32Array = [PBInt32Array arrayWithValues:values count:count valueType:PBArrayValueTypeInt32];
   return self;
 }
 - (TestPackedTypesLite_Builder *)clearPackedInt32 {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
   result.packedInt32Array = nil;
   return self;
 }
 - (PBAppendableArray *)packedInt64 {
-  return result.packedInt64Array;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return result->packedInt64Array;
 }
 - (int64_t)packedInt64AtIndex:(NSUInteger)index {
   return [result packedInt64AtIndex:index];
 }
 - (TestPackedTypesLite_Builder *)addPackedInt64:(int64_t)value {
-  if (result.packedInt64Array == nil) {
-    result.packedInt64Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeInt64];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  [result.packedInt64Array addInt64:value];
+  if (result->packedInt64Array == nil) {
+    result.packedInt64Array = [PBInt64Array array];
+  }
+  PBInt64ArrayAddValue(result->packedInt64Array, value);
   return self;
 }
 - (TestPackedTypesLite_Builder *)setPackedInt64Array:(NSArray *)array {
-  result.packedInt64Array = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeInt64];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.packedInt64Array = [PBInt64Array arrayWithArray:array valueType:PBArrayValueTypeInt64];
+  return self;
+}
+- (TestPackedTypesLite_Builder *)setPackedInt64:(PBArray *)array {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.packedInt64Array = array ? [PBInt64Array arrayWithStorageOfArray:array] : nil;
   return self;
 }
 - (TestPackedTypesLite_Builder *)setPackedInt64Values:(const int64_t *)values count:(NSUInteger)count {
-  result.packedInt64Array = [PBAppendableArray arrayWithValues:values count:count valueType:PBArrayValueTypeInt64];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.packedInt64Array = [PBInt64Array arrayWithValues:values count:count valueType:PBArrayValueTypeInt64];
   return self;
 }
 - (TestPackedTypesLite_Builder *)clearPackedInt64 {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
   result.packedInt64Array = nil;
   return self;
 }
 - (PBAppendableArray *)packedUint32 {
-  return result.packedUint32Array;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return result->packedUint32Array;
 }
 - (uint32_t)packedUint32AtIndex:(NSUInteger)index {
   return [result packedUint32AtIndex:index];
 }
 - (TestPackedTypesLite_Builder *)addPackedUint32:(uint32_t)value {
-  if (result.packedUint32Array == nil) {
-    result.packedUint32Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeUInt32];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  [result.packedUint32Array addUint32:value];
+  if (result->packedUint32Array == nil) {
+    result.packedUint32Array = [PBUInt32Array array];
+  }
+  PBUInt32ArrayAddValue(result->packedUint32Array, value);
   return self;
 }
 - (TestPackedTypesLite_Builder *)setPackedUint32Array:(NSArray *)array {
-  result.packedUint32Array = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeUInt32];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.packedUint32Array = [PBUInt32Array arrayWithArray:array valueType:PBArrayValueTypeUInt32];
+  return self;
+}
+- (TestPackedTypesLite_Builder *)setPackedUint32:(PBArray *)array {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.packedUint32Array = array ? [PBUInt32Array arrayWithStorageOfArray:array] : nil;
   return self;
 }
 - (TestPackedTypesLite_Builder *)setPackedUint32Values:(const uint32_t *)values count:(NSUInteger)count {
-  result.packedUint32Array = [PBAppendableArray arrayWithValues:values count:count valueType:PBArrayValueTypeUInt32];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.packedUint32Array = [PBUInt32Array arrayWithValues:values count:count valueType:PBArrayValueTypeUInt32];
   return self;
 }
 - (TestPackedTypesLite_Builder *)clearPackedUint32 {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
   result.packedUint32Array = nil;
   return self;
 }
 - (PBAppendableArray *)packedUint64 {
-  return result.packedUint64Array;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return result->packedUint64Array;
 }
 - (uint64_t)packedUint64AtIndex:(NSUInteger)index {
   return [result packedUint64AtIndex:index];
 }
 - (TestPackedTypesLite_Builder *)addPackedUint64:(uint64_t)value {
-  if (result.packedUint64Array == nil) {
-    result.packedUint64Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeUInt64];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  [result.packedUint64Array addUint64:value];
+  if (result->packedUint64Array == nil) {
+    result.packedUint64Array = [PBUInt64Array array];
+  }
+  PBUInt64ArrayAddValue(result->packedUint64Array, value);
   return self;
 }
 - (TestPackedTypesLite_Builder *)setPackedUint64Array:(NSArray *)array {
-  result.packedUint64Array = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeUInt64];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.packedUint64Array = [PBUInt64Array arrayWithArray:array valueType:PBArrayValueTypeUInt64];
+  return self;
+}
+- (TestPackedTypesLite_Builder *)setPackedUint64:(PBArray *)array {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.packedUint64Array = array ? [PBUInt64Array arrayWithStorageOfArray:array] : nil;
   return self;
 }
 - (TestPackedTypesLite_Builder *)setPackedUint64Values:(const uint64_t *)values count:(NSUInteger)count {
-  result.packedUint64Array = [PBAppendableArray arrayWithValues:values count:count valueType:PBArrayValueTypeUInt64];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.packedUint64Array = [PBUInt64Array arrayWithValues:values count:count valueType:PBArrayValueTypeUInt64];
   return self;
 }
 - (TestPackedTypesLite_Builder *)clearPackedUint64 {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
   result.packedUint64Array = nil;
   return self;
 }
 - (PBAppendableArray *)packedSint32 {
-  return result.packedSint32Array;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return result->packedSint32Array;
 }
 - (int32_t)packedSint32AtIndex:(NSUInteger)index {
   return [result packedSint32AtIndex:index];
 }
 - (TestPackedTypesLite_Builder *)addPackedSint32:(int32_t)value {
-  if (result.packedSint32Array == nil) {
-    result.packedSint32Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeInt32];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  [result.packedSint32Array addInt32:value];
+  if (result->packedSint32Array == nil) {
+    result.packedSint32Array = [PBInt32Array array];
+  }
+  PBInt32ArrayAddValue(result->packedSint32Array, value);
   return self;
 }
 - (TestPackedTypesLite_Builder *)setPackedSint32Array:(NSArray *)array {
-  result.packedSint32Array = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeInt32];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.packedSint32Array = [PBInt32Array arrayWithArray:array valueType:PBArrayValueTypeInt32];
+  return self;
+}
+- (TestPackedTypesLite_Builder *)setPackedSint32:(PBArray *)array {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.packedSint32Array = array ? [PBInt32Array arrayWithStorageOfArray:array] : nil;
   return self;
 }
 - (TestPackedTypesLite_Builder *)setPackedSint32Values:(const int32_t *)values count:(NSUInteger)count {
-  result.packedSint32Array = [PBAppendableArray arrayWithValues:values count:count valueType:PBArrayValueTypeInt32];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.packedSint32Array = [PBInt32Array arrayWithValues:values count:count valueType:PBArrayValueTypeInt32];
   return self;
 }
 - (TestPackedTypesLite_Builder *)clearPackedSint32 {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
   result.packedSint32Array = nil;
   return self;
 }
 - (PBAppendableArray *)packedSint64 {
-  return result.packedSint64Array;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return result->packedSint64Array;
 }
 - (int64_t)packedSint64AtIndex:(NSUInteger)index {
   return [result packedSint64AtIndex:index];
 }
 - (TestPackedTypesLite_Builder *)addPackedSint64:(int64_t)value {
-  if (result.packedSint64Array == nil) {
-    result.packedSint64Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeInt64];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  [result.packedSint64Array addInt64:value];
+  if (result->packedSint64Array == nil) {
+    result.packedSint64Array = [PBInt64Array array];
+  }
+  PBInt64ArrayAddValue(result->packedSint64Array, value);
   return self;
 }
 - (TestPackedTypesLite_Builder *)setPackedSint64Array:(NSArray *)array {
-  result.packedSint64Array = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeInt64];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.packedSint64Array = [PBInt64Array arrayWithArray:array valueType:PBArrayValueTypeInt64];
+  return self;
+}
+- (TestPackedTypesLite_Builder *)setPackedSint64:(PBArray *)array {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.packedSint64Array = array ? [PBInt64Array arrayWithStorageOfArray:array] : nil;
   return self;
 }
 - (TestPackedTypesLite_Builder *)setPackedSint64Values:(const int64_t *)values count:(NSUInteger)count {
-  result.packedSint64Array = [PBAppendableArray arrayWithValues:values count:count valueType:PBArrayValueTypeInt64];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.packedSint64Array = [PBInt64Array arrayWithValues:values count:count valueType:PBArrayValueTypeInt64];
   return self;
 }
 - (TestPackedTypesLite_Builder *)clearPackedSint64 {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
   result.packedSint64Array = nil;
   return self;
 }
 - (PBAppendableArray *)packedFixed32 {
-  return result.packedFixed32Array;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return result->packedFixed32Array;
 }
 - (uint32_t)packedFixed32AtIndex:(NSUInteger)index {
   return [result packedFixed32AtIndex:index];
 }
 - (TestPackedTypesLite_Builder *)addPackedFixed32:(uint32_t)value {
-  if (result.packedFixed32Array == nil) {
-    result.packedFixed32Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeUInt32];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  [result.packedFixed32Array addUint32:value];
+  if (result->packedFixed32Array == nil) {
+    result.packedFixed32Array = [PBUInt32Array array];
+  }
+  PBUInt32ArrayAddValue(result->packedFixed32Array, value);
   return self;
 }
 - (TestPackedTypesLite_Builder *)setPackedFixed32Array:(NSArray *)array {
-  result.packedFixed32Array = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeUInt32];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.packedFixed32Array = [PBUInt32Array arrayWithArray:array valueType:PBArrayValueTypeUInt32];
+  return self;
+}
+- (TestPackedTypesLite_Builder *)setPackedFixed32:(PBArray *)array {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.packedFixed32Array = array ? [PBUInt32Array arrayWithStorageOfArray:array] : nil;
   return self;
 }
 - (TestPackedTypesLite_Builder *)setPackedFixed32Values:(const uint32_t *)values count:(NSUInteger)count {
-  result.packedFixed32Array = [PBAppendableArray arrayWithValues:values count:count valueType:PBArrayValueTypeUInt32];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.packedFixed32Array = [PBUInt32Array arrayWithValues:values count:count valueType:PBArrayValueTypeUInt32];
   return self;
 }
 - (TestPackedTypesLite_Builder *)clearPackedFixed32 {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
   result.packedFixed32Array = nil;
   return self;
 }
 - (PBAppendableArray *)packedFixed64 {
-  return result.packedFixed64Array;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return result->packedFixed64Array;
 }
 - (uint64_t)packedFixed64AtIndex:(NSUInteger)index {
   return [result packedFixed64AtIndex:index];
 }
 - (TestPackedTypesLite_Builder *)addPackedFixed64:(uint64_t)value {
-  if (result.packedFixed64Array == nil) {
-    result.packedFixed64Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeUInt64];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  [result.packedFixed64Array addUint64:value];
+  if (result->packedFixed64Array == nil) {
+    result.packedFixed64Array = [PBUInt64Array array];
+  }
+  PBUInt64ArrayAddValue(result->packedFixed64Array, value);
   return self;
 }
 - (TestPackedTypesLite_Builder *)setPackedFixed64Array:(NSArray *)array {
-  result.packedFixed64Array = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeUInt64];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.packedFixed64Array = [PBUInt64Array arrayWithArray:array valueType:PBArrayValueTypeUInt64];
+  return self;
+}
+- (TestPackedTypesLite_Builder *)setPackedFixed64:(PBArray *)array {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.packedFixed64Array = array ? [PBUInt64Array arrayWithStorageOfArray:array] : nil;
   return self;
 }
 - (TestPackedTypesLite_Builder *)setPackedFixed64Values:(const uint64_t *)values count:(NSUInteger)count {
-  result.packedFixed64Array = [PBAppendableArray arrayWithValues:values count:count valueType:PBArrayValueTypeUInt64];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.packedFixed64Array = [PBUInt64Array arrayWithValues:values count:count valueType:PBArrayValueTypeUInt64];
   return self;
 }
 - (TestPackedTypesLite_Builder *)clearPackedFixed64 {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
   result.packedFixed64Array = nil;
   return self;
 }
 - (PBAppendableArray *)packedSfixed32 {
-  return result.packedSfixed32Array;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return result->packedSfixed32Array;
 }
 - (int32_t)packedSfixed32AtIndex:(NSUInteger)index {
   return [result packedSfixed32AtIndex:index];
 }
 - (TestPackedTypesLite_Builder *)addPackedSfixed32:(int32_t)value {
-  if (result.packedSfixed32Array == nil) {
-    result.packedSfixed32Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeInt32];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  [result.packedSfixed32Array addInt32:value];
+  if (result->packedSfixed32Array == nil) {
+    result.packedSfixed32Array = [PBInt32Array array];
+  }
+  PBInt32ArrayAddValue(result->packedSfixed32Array, value);
   return self;
 }
 - (TestPackedTypesLite_Builder *)setPackedSfixed32Array:(NSArray *)array {
-  result.packedSfixed32Array = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeInt32];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.packedSfixed32Array = [PBInt32Array arrayWithArray:array valueType:PBArrayValueTypeInt32];
+  return self;
+}
+- (TestPackedTypesLite_Builder *)setPackedSfixed32:(PBArray *)array {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.packedSfixed32Array = array ? [PBInt32Array arrayWithStorageOfArray:array] : nil;
   return self;
 }
 - (TestPackedTypesLite_Builder *)setPackedSfixed32Values:(const int32_t *)values count:(NSUInteger)count {
-  result.packedSfixed32Array = [PBAppendableArray arrayWithValues:values count:count valueType:PBArrayValueTypeInt32];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.packedSfixed32Array = [PBInt32Array arrayWithValues:values count:count valueType:PBArrayValueTypeInt32];
   return self;
 }
 - (TestPackedTypesLite_Builder *)clearPackedSfixed32 {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
   result.packedSfixed32Array = nil;
   return self;
 }
 - (PBAppendableArray *)packedSfixed64 {
-  return result.packedSfixed64Array;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return result->packedSfixed64Array;
 }
 - (int64_t)packedSfixed64AtIndex:(NSUInteger)index {
   return [result packedSfixed64AtIndex:index];
 }
 - (TestPackedTypesLite_Builder *)addPackedSfixed64:(int64_t)value {
-  if (result.packedSfixed64Array == nil) {
-    result.packedSfixed64Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeInt64];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  [result.packedSfixed64Array addInt64:value];
+  if (result->packedSfixed64Array == nil) {
+    result.packedSfixed64Array = [PBInt64Array array];
+  }
+  PBInt64ArrayAddValue(result->packedSfixed64Array, value);
   return self;
 }
 - (TestPackedTypesLite_Builder *)setPackedSfixed64Array:(NSArray *)array {
-  result.packedSfixed64Array = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeInt64];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.packedSfixed64Array = [PBInt64Array arrayWithArray:array valueType:PBArrayValueTypeInt64];
+  return self;
+}
+- (TestPackedTypesLite_Builder *)setPackedSfixed64:(PBArray *)array {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.packedSfixed64Array = array ? [PBInt64Array arrayWithStorageOfArray:array] : nil;
   return self;
 }
 - (TestPackedTypesLite_Builder *)setPackedSfixed64Values:(const int64_t *)values count:(NSUInteger)count {
-  result.packedSfixed64Array = [PBAppendableArray arrayWithValues:values count:count valueType:PBArrayValueTypeInt64];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.packedSfixed64Array = [PBInt64Array arrayWithValues:values count:count valueType:PBArrayValueTypeInt64];
   return self;
 }
 - (TestPackedTypesLite_Builder *)clearPackedSfixed64 {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
   result.packedSfixed64Array = nil;
   return self;
 }
 - (PBAppendableArray *)packedFloat {
-  return result.packedFloatArray;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return result->packedFloatArray;
 }
 - (Float32)packedFloatAtIndex:(NSUInteger)index {
   return [result packedFloatAtIndex:index];
 }
 - (TestPackedTypesLite_Builder *)addPackedFloat:(Float32)value {
-  if (result.packedFloatArray == nil) {
-    result.packedFloatArray = [PBAppendableArray arrayWithValueType:PBArrayValueTypeFloat];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  [result.packedFloatArray addFloat:value];
+  if (result->packedFloatArray == nil) {
+    result.packedFloatArray = [PBFloatArray array];
+  }
+  PBFloatArrayAddValue(result->packedFloatArray, value);
   return self;
 }
 - (TestPackedTypesLite_Builder *)setPackedFloatArray:(NSArray *)array {
-  result.packedFloatArray = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeFloat];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.packedFloatArray = [PBFloatArray arrayWithArray:array valueType:PBArrayValueTypeFloat];
+  return self;
+}
+- (TestPackedTypesLite_Builder *)setPackedFloat:(PBArray *)array {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.packedFloatArray = array ? [PBFloatArray arrayWithStorageOfArray:array] : nil;
   return self;
 }
 - (TestPackedTypesLite_Builder *)setPackedFloatValues:(const Float32 *)values count:(NSUInteger)count {
-  result.packedFloatArray = [PBAppendableArray arrayWithValues:values count:count valueType:PBArrayValueTypeFloat];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.packedFloatArray = [PBFloatArray arrayWithValues:values count:count valueType:PBArrayValueTypeFloat];
   return self;
 }
 - (TestPackedTypesLite_Builder *)clearPackedFloat {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
   result.packedFloatArray = nil;
   return self;
 }
 - (PBAppendableArray *)packedDouble {
-  return result.packedDoubleArray;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return result->packedDoubleArray;
 }
 - (Float64)packedDoubleAtIndex:(NSUInteger)index {
   return [result packedDoubleAtIndex:index];
 }
 - (TestPackedTypesLite_Builder *)addPackedDouble:(Float64)value {
-  if (result.packedDoubleArray == nil) {
-    result.packedDoubleArray = [PBAppendableArray arrayWithValueType:PBArrayValueTypeDouble];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  [result.packedDoubleArray addDouble:value];
+  if (result->packedDoubleArray == nil) {
+    result.packedDoubleArray = [PBDoubleArray array];
+  }
+  PBDoubleArrayAddValue(result->packedDoubleArray, value);
   return self;
 }
 - (TestPackedTypesLite_Builder *)setPackedDoubleArray:(NSArray *)array {
-  result.packedDoubleArray = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeDouble];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.packedDoubleArray = [PBDoubleArray arrayWithArray:array valueType:PBArrayValueTypeDouble];
+  return self;
+}
+- (TestPackedTypesLite_Builder *)setPackedDouble:(PBArray *)array {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.packedDoubleArray = array ? [PBDoubleArray arrayWithStorageOfArray:array] : nil;
   return self;
 }
 - (TestPackedTypesLite_Builder *)setPackedDoubleValues:(const Float64 *)values count:(NSUInteger)count {
-  result.packedDoubleArray = [PBAppendableArray arrayWithValues:values count:count valueType:PBArrayValueTypeDouble];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.packedDoubleArray = [PBDoubleArray arrayWithValues:values count:count valueType:PBArrayValueTypeDouble];
   return self;
 }
 - (TestPackedTypesLite_Builder *)clearPackedDouble {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
   result.packedDoubleArray = nil;
   return self;
 }
 - (PBAppendableArray *)packedBool {
-  return result.packedBoolArray;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return result->packedBoolArray;
 }
 - (BOOL)packedBoolAtIndex:(NSUInteger)index {
   return [result packedBoolAtIndex:index];
 }
 - (TestPackedTypesLite_Builder *)addPackedBool:(BOOL)value {
-  if (result.packedBoolArray == nil) {
-    result.packedBoolArray = [PBAppendableArray arrayWithValueType:PBArrayValueTypeBool];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  [result.packedBoolArray addBool:value];
+  if (result->packedBoolArray == nil) {
+    result.packedBoolArray = [PBBoolArray array];
+  }
+  PBBoolArrayAddValue(result->packedBoolArray, value);
   return self;
 }
 - (TestPackedTypesLite_Builder *)setPackedBoolArray:(NSArray *)array {
-  result.packedBoolArray = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeBool];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.packedBoolArray = [PBBoolArray arrayWithArray:array valueType:PBArrayValueTypeBool];
+  return self;
+}
+- (TestPackedTypesLite_Builder *)setPackedBool:(PBArray *)array {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.packedBoolArray = array ? [PBBoolArray arrayWithStorageOfArray:array] : nil;
   return self;
 }
 - (TestPackedTypesLite_Builder *)setPackedBoolValues:(const BOOL *)values count:(NSUInteger)count {
-  result.packedBoolArray = [PBAppendableArray arrayWithValues:values count:count valueType:PBArrayValueTypeBool];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.packedBoolArray = [PBBoolArray arrayWithValues:values count:count valueType:PBArrayValueTypeBool];
   return self;
 }
 - (TestPackedTypesLite_Builder *)clearPackedBool {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
   result.packedBoolArray = nil;
   return self;
 }
 - (PBAppendableArray *)packedEnum {
-  return result.packedEnumArray;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return result->packedEnumArray;
 }
 - (ForeignEnumLite)packedEnumAtIndex:(NSUInteger)index {
   return [result packedEnumAtIndex:index];
 }
 - (TestPackedTypesLite_Builder *)addPackedEnum:(ForeignEnumLite)value {
-  if (result.packedEnumArray == nil) {
-    result.packedEnumArray = [PBAppendableArray arrayWithValueType:PBArrayValueTypeInt32];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  [result.packedEnumArray addInt32:value];
+  if (result->packedEnumArray == nil) {
+    result.packedEnumArray = [PBInt32Array array];
+  }
+  PBInt32ArrayAddValue(result->packedEnumArray, value);
   return self;
 }
 - (TestPackedTypesLite_Builder *)setPackedEnumArray:(NSArray *)array {
-  result.packedEnumArray = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeInt32];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.packedEnumArray = [PBInt32Array arrayWithArray:array valueType:PBArrayValueTypeInt32];
+  return self;
+}
+- (TestPackedTypesLite_Builder *)setPackedEnum:(PBArray *)array {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.packedEnumArray = array ? [PBInt32Array arrayWithStorageOfArray:array] : nil;
   return self;
 }
 - (TestPackedTypesLite_Builder *)setPackedEnumValues:(const ForeignEnumLite *)values count:(NSUInteger)count {
-  result.packedEnumArray = [PBAppendableArray arrayWithValues:values count:count valueType:PBArrayValueTypeInt32];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.packedEnumArray = [PBInt32Array arrayWithValues:values count:count valueType:PBArrayValueTypeInt32];
   return self;
 }
 - (TestPackedTypesLite_Builder *)clearPackedEnum {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
   result.packedEnumArray = nil;
   return self;
 }
 @end
 
 @interface TestAllExtensionsLite ()
+- (void) setInitialized;
+@end
+
+@interface TestAllExtensionsLite_Builder()
+@property (nonatomic, retain) TestAllExtensionsLite* result;
+- (id) initWithPrototype:(TestAllExtensionsLite*) prototype;
+- (void) detachFromPrototype;
 @end
 
 @implementation TestAllExtensionsLite
@@ -7408,24 +9228,28 @@ static TestPackedTypesLite* defaultTestPackedTypesLiteInstance = nil;
 - (void) dealloc {
   [super dealloc];
 }
-- (id) init {
-  if ((self = [super init])) {
-  }
-  return self;
+- (void) clearForReuse {
+  [super clearForReuse];
+  memset(hasBits_, 0, sizeof(hasBits_));
 }
 static TestAllExtensionsLite* defaultTestAllExtensionsLiteInstance = nil;
-+ (void) initialize {
-  if (self == [TestAllExtensionsLite class]) {
-    defaultTestAllExtensionsLiteInstance = [[TestAllExtensionsLite alloc] init];
-  }
-}
 + (TestAllExtensionsLite*) defaultInstance {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultTestAllExtensionsLiteInstance = [[TestAllExtensionsLite alloc] init];
+  });
   return defaultTestAllExtensionsLiteInstance;
 }
 - (TestAllExtensionsLite*) defaultInstance {
-  return defaultTestAllExtensionsLiteInstance;
+  return [TestAllExtensionsLite defaultInstance];
+}
+- (void) setInitialized {
+  hasBits_[0] |= 0x1u;
 }
 - (BOOL) isInitialized {
+  if ((hasBits_[0] & 0x1u) != 0) {
+    return YES;
+  }
   if (!self.extensionsAreInitialized) {
     return NO;
   }
@@ -7435,19 +9259,17 @@ static TestAllExtensionsLite* defaultTestAllExtensionsLiteInstance = nil;
   [self writeExtensionsToCodedOutputStream:output
                                       from:1
                                         to:536870912];
-  [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = PBGeneratedMessageGetMemoizedSize(&memoizedSerializedSize);
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
-  size += [self extensionsSerializedSize];
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
+  size_ = 0;
+  size_ += [self extensionsSerializedSize];
+  PBGeneratedMessageSetMemoizedSize(&memoizedSerializedSize, size_);
+  return size_;
 }
 + (TestAllExtensionsLite*) parseFromData:(NSData*) data {
   return (TestAllExtensionsLite*)[[[TestAllExtensionsLite builder] mergeFromData:data] build];
@@ -7471,7 +9293,7 @@ static TestAllExtensionsLite* defaultTestAllExtensionsLiteInstance = nil;
   return [[[TestAllExtensionsLite_Builder alloc] init] autorelease];
 }
 + (TestAllExtensionsLite_Builder*) builderWithPrototype:(TestAllExtensionsLite*) prototype {
-  return [[TestAllExtensionsLite builder] mergeFrom:prototype];
+  return [[[TestAllExtensionsLite_Builder alloc] initWithPrototype:prototype] autorelease];
 }
 - (TestAllExtensionsLite_Builder*) builder {
   return [TestAllExtensionsLite builder];
@@ -7479,13 +9301,6 @@ static TestAllExtensionsLite* defaultTestAllExtensionsLiteInstance = nil;
 - (TestAllExtensionsLite_Builder*) toBuilder {
   return [TestAllExtensionsLite builderWithPrototype:self];
 }
-- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
-  [self writeExtensionDescriptionToMutableString:(NSMutableString*)output
-                                            from:1
-                                              to:536870912
-                                      withIndent:indent];
-  [self.unknownFields writeDescriptionTo:output withIndent:indent];
-}
 - (BOOL) isEqual:(id)other {
   if (other == self) {
     return YES;
@@ -7496,79 +9311,150 @@ static TestAllExtensionsLite* defaultTestAllExtensionsLiteInstance = nil;
   TestAllExtensionsLite *otherMessage = other;
   return
       [self isEqualExtensionsInOther:otherMessage from:1 to:536870912] &&
-      
-      (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
+
+      YES;
 }
 - (NSUInteger) hash {
-  NSUInteger hashCode = 7;
-  hashCode = hashCode * 31 + [self hashExtensionsFrom:1 to:536870912];
-  hashCode = hashCode * 31 + [self.unknownFields hash];
-  return hashCode;
-}
-@end
+  NSUInteger hash_ = PBGeneratedMessageGetMemoizedHash(&memoizedHash);
+  if (hash_ != 0) {
+    return hash_;
+  }
 
-@interface TestAllExtensionsLite_Builder()
-@property (retain) TestAllExtensionsLite* result;
+  uint64_t hashCode = 7;
+  hashCode = PBGeneratedMessageHashMix(hashCode, [self hashExtensionsFrom:1 to:536870912]);
+  hash_ = PBGeneratedMessageHashFinish(hashCode);
+  PBGeneratedMessageSetMemoizedHash(&memoizedHash, hash_);
+  return hash_;
+}
 @end
 
 @implementation TestAllExtensionsLite_Builder
 @synthesize result;
 - (void) dealloc {
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
   self.result = nil;
+  [prototype_ release];
   [super dealloc];
 }
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[[TestAllExtensionsLite alloc] init] autorelease];
+    result = [TestAllExtensionsLite recycledInstance];
   }
   return self;
 }
+- (id) initWithPrototype:(TestAllExtensionsLite*) prototype {
+  if ((self = [super init])) {
+    self.result = prototype;
+    prototype_ = [prototype retain];
+  }
+  return self;
+}
+- (void) detachFromPrototype {
+  TestAllExtensionsLite* prototype = prototype_;
+  prototype_ = nil;
+  self.result = [[[TestAllExtensionsLite alloc] init] autorelease];
+  [self mergeFrom:prototype];
+  [prototype release];
+}
+- (PBExtendableMessage*) internalGetMutableResult {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return [self internalGetResult];
+}
 - (PBExtendableMessage*) internalGetResult {
   return result;
 }
 - (TestAllExtensionsLite_Builder*) clear {
-  self.result = [[[TestAllExtensionsLite alloc] init] autorelease];
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = [[TestAllExtensionsLite recycledInstance] autorelease];
   return self;
 }
 - (TestAllExtensionsLite_Builder*) clone {
-  return [TestAllExtensionsLite builderWithPrototype:result];
+  if (prototype_ != nil) {
+    return [[[TestAllExtensionsLite_Builder alloc] initWithPrototype:prototype_] autorelease];
+  }
+  return [[TestAllExtensionsLite builder] mergeFrom:result];
+}
+- (TestAllExtensionsLite_Builder*) reset {
+  if (result == nil || prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    self.result = [[TestAllExtensionsLite recycledInstance] autorelease];
+  } else {
+    [result clearForReuse];
+  }
+  return self;
+}
+- (TestAllExtensionsLite_Builder*) recycle:(TestAllExtensionsLite*) message {
+  if (message == [TestAllExtensionsLite defaultInstance]) {
+    @throw [NSException exceptionWithName:@"IllegalArgument" reason:@"Cannot recycle the default instance" userInfo:nil];
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = message;
+  return [self reset];
 }
 - (TestAllExtensionsLite*) defaultInstance {
   return [TestAllExtensionsLite defaultInstance];
 }
 - (TestAllExtensionsLite*) build {
   [self checkInitialized];
-  return [self buildPartial];
+  BOOL shared = prototype_ != nil;
+  TestAllExtensionsLite* returnMe = [self buildPartial];
+  if (!shared) {
+    [returnMe setInitialized];
+  }
+  return returnMe;
 }
 - (TestAllExtensionsLite*) buildPartial {
-  TestAllExtensionsLite* returnMe = [[result retain] autorelease];
-  self.result = nil;
+  return [[self newBuildPartial] autorelease];
+}
+- (TestAllExtensionsLite*) newBuildPartial {
+  if (prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    TestAllExtensionsLite* returnMe = result;
+    result = nil;
+    return returnMe;
+  }
+  TestAllExtensionsLite* returnMe = result;
+  result = nil;
   return returnMe;
 }
 - (TestAllExtensionsLite_Builder*) mergeFrom:(TestAllExtensionsLite*) other {
   if (other == [TestAllExtensionsLite defaultInstance]) {
     return self;
   }
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
   [self mergeExtensionFields:other];
-  [self mergeUnknownFields:other.unknownFields];
   return self;
 }
 - (TestAllExtensionsLite_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input {
   return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
 }
 - (TestAllExtensionsLite_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
   while (YES) {
     int32_t tag = [input readTag];
     switch (tag) {
       case 0:
-        [self setUnknownFields:[unknownFields build]];
         return self;
       default: {
-        if (![self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag]) {
-          [self setUnknownFields:[unknownFields build]];
+        if (PBWireFormatGetTagWireType(tag) == PBWireFormatEndGroup) {
           return self;
         }
+        [self parseUnknownField:input unknownFields:nil extensionRegistry:extensionRegistry tag:tag];
         break;
       }
     }
@@ -7577,61 +9463,67 @@ static TestAllExtensionsLite* defaultTestAllExtensionsLiteInstance = nil;
 @end
 
 @interface OptionalGroup_extension_lite ()
-@property int32_t a;
+@property (nonatomic) int32_t a;
+@end
+
+@interface OptionalGroup_extension_lite_Builder()
+@property (nonatomic, retain) OptionalGroup_extension_lite* result;
+- (id) initWithPrototype:(OptionalGroup_extension_lite*) prototype;
+- (void) detachFromPrototype;
 @end
 
 @implementation OptionalGroup_extension_lite
 
 - (BOOL) hasA {
-  return !!hasA_;
+  return (hasBits_[0] & 0x1u) != 0;
 }
-- (void) setHasA:(BOOL) value {
-  hasA_ = !!value;
+- (void) setHasA:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x1u;
+  } else {
+    hasBits_[0] &= ~0x1u;
+  }
 }
 @synthesize a;
 - (void) dealloc {
   [super dealloc];
 }
-- (id) init {
-  if ((self = [super init])) {
-    self.a = 0;
-  }
-  return self;
+- (void) clearForReuse {
+  [super clearForReuse];
+  memset(hasBits_, 0, sizeof(hasBits_));
+  a = 0;
 }
 static OptionalGroup_extension_lite* defaultOptionalGroup_extension_liteInstance = nil;
-+ (void) initialize {
-  if (self == [OptionalGroup_extension_lite class]) {
-    defaultOptionalGroup_extension_liteInstance = [[OptionalGroup_extension_lite alloc] init];
-  }
-}
 + (OptionalGroup_extension_lite*) defaultInstance {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultOptionalGroup_extension_liteInstance = [[OptionalGroup_extension_lite alloc] init];
+  });
   return defaultOptionalGroup_extension_liteInstance;
 }
 - (OptionalGroup_extension_lite*) defaultInstance {
-  return defaultOptionalGroup_extension_liteInstance;
+  return [OptionalGroup_extension_lite defaultInstance];
 }
 - (BOOL) isInitialized {
   return YES;
 }
 - (void) writeToCodedOutputStream:(PBCodedOutputStream*) output {
-  if (self.hasA) {
-    [output writeInt32:17 value:self.a];
+  if (hasBits_[0] & 0x1u) {
+    [output writeInt32:17 value:a];
   }
-  [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = PBGeneratedMessageGetMemoizedSize(&memoizedSerializedSize);
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
-  if (self.hasA) {
-    size += computeInt32Size(17, self.a);
+  size_ = 0;
+  if (hasBits_[0] & 0x1u) {
+    size_ += computeInt32Size(17, a);
   }
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
+  PBGeneratedMessageSetMemoizedSize(&memoizedSerializedSize, size_);
+  return size_;
 }
 + (OptionalGroup_extension_lite*) parseFromData:(NSData*) data {
   return (OptionalGroup_extension_lite*)[[[OptionalGroup_extension_lite builder] mergeFromData:data] build];
@@ -7655,7 +9547,7 @@ static OptionalGroup_extension_lite* defaultOptionalGroup_extension_liteInstance
   return [[[OptionalGroup_extension_lite_Builder alloc] init] autorelease];
 }
 + (OptionalGroup_extension_lite_Builder*) builderWithPrototype:(OptionalGroup_extension_lite*) prototype {
-  return [[OptionalGroup_extension_lite builder] mergeFrom:prototype];
+  return [[[OptionalGroup_extension_lite_Builder alloc] initWithPrototype:prototype] autorelease];
 }
 - (OptionalGroup_extension_lite_Builder*) builder {
   return [OptionalGroup_extension_lite builder];
@@ -7663,12 +9555,6 @@ static OptionalGroup_extension_lite* defaultOptionalGroup_extension_liteInstance
 - (OptionalGroup_extension_lite_Builder*) toBuilder {
   return [OptionalGroup_extension_lite builderWithPrototype:self];
 }
-- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
-  if (self.hasA) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"a", [NSNumber numberWithInt:self.a]];
-  }
-  [self.unknownFields writeDescriptionTo:output withIndent:indent];
-}
 - (BOOL) isEqual:(id)other {
   if (other == self) {
     return YES;
@@ -7678,46 +9564,98 @@ static OptionalGroup_extension_lite* defaultOptionalGroup_extension_liteInstance
   }
   OptionalGroup_extension_lite *otherMessage = other;
   return
-      self.hasA == otherMessage.hasA &&
-      (!self.hasA || self.a == otherMessage.a) &&
-      
-      (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
+      (hasBits_[0] & 0x1u) == (otherMessage->hasBits_[0] & 0x1u) &&
+      (!(hasBits_[0] & 0x1u) || a == otherMessage->a) &&
+      YES;
 }
 - (NSUInteger) hash {
-  NSUInteger hashCode = 7;
-  if (self.hasA) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithInt:self.a] hash];
+  NSUInteger hash_ = PBGeneratedMessageGetMemoizedHash(&memoizedHash);
+  if (hash_ != 0) {
+    return hash_;
   }
-  hashCode = hashCode * 31 + [self.unknownFields hash];
-  return hashCode;
-}
-@end
 
-@interface OptionalGroup_extension_lite_Builder()
-@property (retain) OptionalGroup_extension_lite* result;
+  uint64_t hashCode = 7;
+  if (hasBits_[0] & 0x1u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, (uint64_t)a);
+  }
+  hash_ = PBGeneratedMessageHashFinish(hashCode);
+  PBGeneratedMessageSetMemoizedHash(&memoizedHash, hash_);
+  return hash_;
+}
 @end
 
 @implementation OptionalGroup_extension_lite_Builder
 @synthesize result;
 - (void) dealloc {
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
   self.result = nil;
+  [prototype_ release];
   [super dealloc];
 }
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[[OptionalGroup_extension_lite alloc] init] autorelease];
+    result = [OptionalGroup_extension_lite recycledInstance];
+  }
+  return self;
+}
+- (id) initWithPrototype:(OptionalGroup_extension_lite*) prototype {
+  if ((self = [super init])) {
+    self.result = prototype;
+    prototype_ = [prototype retain];
   }
   return self;
 }
+- (void) detachFromPrototype {
+  OptionalGroup_extension_lite* prototype = prototype_;
+  prototype_ = nil;
+  self.result = [[[OptionalGroup_extension_lite alloc] init] autorelease];
+  [self mergeFrom:prototype];
+  [prototype release];
+}
+- (PBGeneratedMessage*) internalGetMutableResult {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return [self internalGetResult];
+}
 - (PBGeneratedMessage*) internalGetResult {
   return result;
 }
 - (OptionalGroup_extension_lite_Builder*) clear {
-  self.result = [[[OptionalGroup_extension_lite alloc] init] autorelease];
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = [[OptionalGroup_extension_lite recycledInstance] autorelease];
   return self;
 }
 - (OptionalGroup_extension_lite_Builder*) clone {
-  return [OptionalGroup_extension_lite builderWithPrototype:result];
+  if (prototype_ != nil) {
+    return [[[OptionalGroup_extension_lite_Builder alloc] initWithPrototype:prototype_] autorelease];
+  }
+  return [[OptionalGroup_extension_lite builder] mergeFrom:result];
+}
+- (OptionalGroup_extension_lite_Builder*) reset {
+  if (result == nil || prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    self.result = [[OptionalGroup_extension_lite recycledInstance] autorelease];
+  } else {
+    [result clearForReuse];
+  }
+  return self;
+}
+- (OptionalGroup_extension_lite_Builder*) recycle:(OptionalGroup_extension_lite*) message {
+  if (message == [OptionalGroup_extension_lite defaultInstance]) {
+    @throw [NSException exceptionWithName:@"IllegalArgument" reason:@"Cannot recycle the default instance" userInfo:nil];
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = message;
+  return [self reset];
 }
 - (OptionalGroup_extension_lite*) defaultInstance {
   return [OptionalGroup_extension_lite defaultInstance];
@@ -7727,36 +9665,49 @@ static OptionalGroup_extension_lite* defaultOptionalGroup_extension_liteInstance
   return [self buildPartial];
 }
 - (OptionalGroup_extension_lite*) buildPartial {
-  OptionalGroup_extension_lite* returnMe = [[result retain] autorelease];
-  self.result = nil;
+  return [[self newBuildPartial] autorelease];
+}
+- (OptionalGroup_extension_lite*) newBuildPartial {
+  if (prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    OptionalGroup_extension_lite* returnMe = result;
+    result = nil;
+    return returnMe;
+  }
+  OptionalGroup_extension_lite* returnMe = result;
+  result = nil;
   return returnMe;
 }
 - (OptionalGroup_extension_lite_Builder*) mergeFrom:(OptionalGroup_extension_lite*) other {
   if (other == [OptionalGroup_extension_lite defaultInstance]) {
     return self;
   }
-  if (other.hasA) {
-    [self setA:other.a];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (other->hasBits_[0] & 0x1u) {
+    [self setA:other->a];
   }
-  [self mergeUnknownFields:other.unknownFields];
   return self;
 }
 - (OptionalGroup_extension_lite_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input {
   return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
 }
 - (OptionalGroup_extension_lite_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
   while (YES) {
     int32_t tag = [input readTag];
     switch (tag) {
       case 0:
-        [self setUnknownFields:[unknownFields build]];
         return self;
       default: {
-        if (![self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag]) {
-          [self setUnknownFields:[unknownFields build]];
+        if (PBWireFormatGetTagWireType(tag) == PBWireFormatEndGroup) {
           return self;
         }
+        [input skipField:tag];
         break;
       }
       case 136: {
@@ -7767,79 +9718,91 @@ static OptionalGroup_extension_lite* defaultOptionalGroup_extension_liteInstance
   }
 }
 - (BOOL) hasA {
-  return result.hasA;
+  return (result->hasBits_[0] & 0x1u) != 0;
 }
 - (int32_t) a {
-  return result.a;
+  return result->a;
 }
 - (OptionalGroup_extension_lite_Builder*) setA:(int32_t) value {
-  result.hasA = YES;
-  result.a = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x1u;
+  result->a = value;
   return self;
 }
 - (OptionalGroup_extension_lite_Builder*) clearA {
-  result.hasA = NO;
-  result.a = 0;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x1u;
+  result->a = 0;
   return self;
 }
 @end
 
 @interface RepeatedGroup_extension_lite ()
-@property int32_t a;
+@property (nonatomic) int32_t a;
+@end
+
+@interface RepeatedGroup_extension_lite_Builder()
+@property (nonatomic, retain) RepeatedGroup_extension_lite* result;
+- (id) initWithPrototype:(RepeatedGroup_extension_lite*) prototype;
+- (void) detachFromPrototype;
 @end
 
 @implementation RepeatedGroup_extension_lite
 
 - (BOOL) hasA {
-  return !!hasA_;
+  return (hasBits_[0] & 0x1u) != 0;
 }
-- (void) setHasA:(BOOL) value {
-  hasA_ = !!value;
+- (void) setHasA:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x1u;
+  } else {
+    hasBits_[0] &= ~0x1u;
+  }
 }
 @synthesize a;
 - (void) dealloc {
   [super dealloc];
 }
-- (id) init {
-  if ((self = [super init])) {
-    self.a = 0;
-  }
-  return self;
+- (void) clearForReuse {
+  [super clearForReuse];
+  memset(hasBits_, 0, sizeof(hasBits_));
+  a = 0;
 }
 static RepeatedGroup_extension_lite* defaultRepeatedGroup_extension_liteInstance = nil;
-+ (void) initialize {
-  if (self == [RepeatedGroup_extension_lite class]) {
-    defaultRepeatedGroup_extension_liteInstance = [[RepeatedGroup_extension_lite alloc] init];
-  }
-}
 + (RepeatedGroup_extension_lite*) defaultInstance {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultRepeatedGroup_extension_liteInstance = [[RepeatedGroup_extension_lite alloc] init];
+  });
   return defaultRepeatedGroup_extension_liteInstance;
 }
 - (RepeatedGroup_extension_lite*) defaultInstance {
-  return defaultRepeatedGroup_extension_liteInstance;
+  return [RepeatedGroup_extension_lite defaultInstance];
 }
 - (BOOL) isInitialized {
   return YES;
 }
 - (void) writeToCodedOutputStream:(PBCodedOutputStream*) output {
-  if (self.hasA) {
-    [output writeInt32:47 value:self.a];
+  if (hasBits_[0] & 0x1u) {
+    [output writeInt32:47 value:a];
   }
-  [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = PBGeneratedMessageGetMemoizedSize(&memoizedSerializedSize);
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
-  if (self.hasA) {
-    size += computeInt32Size(47, self.a);
+  size_ = 0;
+  if (hasBits_[0] & 0x1u) {
+    size_ += computeInt32Size(47, a);
   }
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
+  PBGeneratedMessageSetMemoizedSize(&memoizedSerializedSize, size_);
+  return size_;
 }
 + (RepeatedGroup_extension_lite*) parseFromData:(NSData*) data {
   return (RepeatedGroup_extension_lite*)[[[RepeatedGroup_extension_lite builder] mergeFromData:data] build];
@@ -7863,7 +9826,7 @@ static RepeatedGroup_extension_lite* defaultRepeatedGroup_extension_liteInstance
   return [[[RepeatedGroup_extension_lite_Builder alloc] init] autorelease];
 }
 + (RepeatedGroup_extension_lite_Builder*) builderWithPrototype:(RepeatedGroup_extension_lite*) prototype {
-  return [[RepeatedGroup_extension_lite builder] mergeFrom:prototype];
+  return [[[RepeatedGroup_extension_lite_Builder alloc] initWithPrototype:prototype] autorelease];
 }
 - (RepeatedGroup_extension_lite_Builder*) builder {
   return [RepeatedGroup_extension_lite builder];
@@ -7871,12 +9834,6 @@ static RepeatedGroup_extension_lite* defaultRepeatedGroup_extension_liteInstance
 - (RepeatedGroup_extension_lite_Builder*) toBuilder {
   return [RepeatedGroup_extension_lite builderWithPrototype:self];
 }
-- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
-  if (self.hasA) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"a", [NSNumber numberWithInt:self.a]];
-  }
-  [self.unknownFields writeDescriptionTo:output withIndent:indent];
-}
 - (BOOL) isEqual:(id)other {
   if (other == self) {
     return YES;
@@ -7886,46 +9843,98 @@ static RepeatedGroup_extension_lite* defaultRepeatedGroup_extension_liteInstance
   }
   RepeatedGroup_extension_lite *otherMessage = other;
   return
-      self.hasA == otherMessage.hasA &&
-      (!self.hasA || self.a == otherMessage.a) &&
-      
-      (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
+      (hasBits_[0] & 0x1u) == (otherMessage->hasBits_[0] & 0x1u) &&
+      (!(hasBits_[0] & 0x1u) || a == otherMessage->a) &&
+      YES;
 }
 - (NSUInteger) hash {
-  NSUInteger hashCode = 7;
-  if (self.hasA) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithInt:self.a] hash];
+  NSUInteger hash_ = PBGeneratedMessageGetMemoizedHash(&memoizedHash);
+  if (hash_ != 0) {
+    return hash_;
   }
-  hashCode = hashCode * 31 + [self.unknownFields hash];
-  return hashCode;
-}
-@end
 
-@interface RepeatedGroup_extension_lite_Builder()
-@property (retain) RepeatedGroup_extension_lite* result;
+  uint64_t hashCode = 7;
+  if (hasBits_[0] & 0x1u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, (uint64_t)a);
+  }
+  hash_ = PBGeneratedMessageHashFinish(hashCode);
+  PBGeneratedMessageSetMemoizedHash(&memoizedHash, hash_);
+  return hash_;
+}
 @end
 
 @implementation RepeatedGroup_extension_lite_Builder
 @synthesize result;
 - (void) dealloc {
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
   self.result = nil;
+  [prototype_ release];
   [super dealloc];
 }
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[[RepeatedGroup_extension_lite alloc] init] autorelease];
+    result = [RepeatedGroup_extension_lite recycledInstance];
+  }
+  return self;
+}
+- (id) initWithPrototype:(RepeatedGroup_extension_lite*) prototype {
+  if ((self = [super init])) {
+    self.result = prototype;
+    prototype_ = [prototype retain];
   }
   return self;
 }
+- (void) detachFromPrototype {
+  RepeatedGroup_extension_lite* prototype = prototype_;
+  prototype_ = nil;
+  self.result = [[[RepeatedGroup_extension_lite alloc] init] autorelease];
+  [self mergeFrom:prototype];
+  [prototype release];
+}
+- (PBGeneratedMessage*) internalGetMutableResult {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return [self internalGetResult];
+}
 - (PBGeneratedMessage*) internalGetResult {
   return result;
 }
 - (RepeatedGroup_extension_lite_Builder*) clear {
-  self.result = [[[RepeatedGroup_extension_lite alloc] init] autorelease];
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = [[RepeatedGroup_extension_lite recycledInstance] autorelease];
   return self;
 }
 - (RepeatedGroup_extension_lite_Builder*) clone {
-  return [RepeatedGroup_extension_lite builderWithPrototype:result];
+  if (prototype_ != nil) {
+    return [[[RepeatedGroup_extension_lite_Builder alloc] initWithPrototype:prototype_] autorelease];
+  }
+  return [[RepeatedGroup_extension_lite builder] mergeFrom:result];
+}
+- (RepeatedGroup_extension_lite_Builder*) reset {
+  if (result == nil || prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    self.result = [[RepeatedGroup_extension_lite recycledInstance] autorelease];
+  } else {
+    [result clearForReuse];
+  }
+  return self;
+}
+- (RepeatedGroup_extension_lite_Builder*) recycle:(RepeatedGroup_extension_lite*) message {
+  if (message == [RepeatedGroup_extension_lite defaultInstance]) {
+    @throw [NSException exceptionWithName:@"IllegalArgument" reason:@"Cannot recycle the default instance" userInfo:nil];
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = message;
+  return [self reset];
 }
 - (RepeatedGroup_extension_lite*) defaultInstance {
   return [RepeatedGroup_extension_lite defaultInstance];
@@ -7935,36 +9944,49 @@ static RepeatedGroup_extension_lite* defaultRepeatedGroup_extension_liteInstance
   return [self buildPartial];
 }
 - (RepeatedGroup_extension_lite*) buildPartial {
-  RepeatedGroup_extension_lite* returnMe = [[result retain] autorelease];
-  self.result = nil;
+  return [[self newBuildPartial] autorelease];
+}
+- (RepeatedGroup_extension_lite*) newBuildPartial {
+  if (prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    RepeatedGroup_extension_lite* returnMe = result;
+    result = nil;
+    return returnMe;
+  }
+  RepeatedGroup_extension_lite* returnMe = result;
+  result = nil;
   return returnMe;
 }
 - (RepeatedGroup_extension_lite_Builder*) mergeFrom:(RepeatedGroup_extension_lite*) other {
   if (other == [RepeatedGroup_extension_lite defaultInstance]) {
     return self;
   }
-  if (other.hasA) {
-    [self setA:other.a];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (other->hasBits_[0] & 0x1u) {
+    [self setA:other->a];
   }
-  [self mergeUnknownFields:other.unknownFields];
   return self;
 }
 - (RepeatedGroup_extension_lite_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input {
   return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
 }
 - (RepeatedGroup_extension_lite_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
   while (YES) {
     int32_t tag = [input readTag];
     switch (tag) {
       case 0:
-        [self setUnknownFields:[unknownFields build]];
         return self;
       default: {
-        if (![self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag]) {
-          [self setUnknownFields:[unknownFields build]];
+        if (PBWireFormatGetTagWireType(tag) == PBWireFormatEndGroup) {
           return self;
         }
+        [input skipField:tag];
         break;
       }
       case 376: {
@@ -7975,24 +9997,37 @@ static RepeatedGroup_extension_lite* defaultRepeatedGroup_extension_liteInstance
   }
 }
 - (BOOL) hasA {
-  return result.hasA;
+  return (result->hasBits_[0] & 0x1u) != 0;
 }
 - (int32_t) a {
-  return result.a;
+  return result->a;
 }
 - (RepeatedGroup_extension_lite_Builder*) setA:(int32_t) value {
-  result.hasA = YES;
-  result.a = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x1u;
+  result->a = value;
   return self;
 }
 - (RepeatedGroup_extension_lite_Builder*) clearA {
-  result.hasA = NO;
-  result.a = 0;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x1u;
+  result->a = 0;
   return self;
 }
 @end
 
 @interface TestPackedExtensionsLite ()
+- (void) setInitialized;
+@end
+
+@interface TestPackedExtensionsLite_Builder()
+@property (nonatomic, retain) TestPackedExtensionsLite* result;
+- (id) initWithPrototype:(TestPackedExtensionsLite*) prototype;
+- (void) detachFromPrototype;
 @end
 
 @implementation TestPackedExtensionsLite
@@ -8000,24 +10035,28 @@ static RepeatedGroup_extension_lite* defaultRepeatedGroup_extension_liteInstance
 - (void) dealloc {
   [super dealloc];
 }
-- (id) init {
-  if ((self = [super init])) {
-  }
-  return self;
+- (void) clearForReuse {
+  [super clearForReuse];
+  memset(hasBits_, 0, sizeof(hasBits_));
 }
 static TestPackedExtensionsLite* defaultTestPackedExtensionsLiteInstance = nil;
-+ (void) initialize {
-  if (self == [TestPackedExtensionsLite class]) {
-    defaultTestPackedExtensionsLiteInstance = [[TestPackedExtensionsLite alloc] init];
-  }
-}
 + (TestPackedExtensionsLite*) defaultInstance {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultTestPackedExtensionsLiteInstance = [[TestPackedExtensionsLite alloc] init];
+  });
   return defaultTestPackedExtensionsLiteInstance;
 }
 - (TestPackedExtensionsLite*) defaultInstance {
-  return defaultTestPackedExtensionsLiteInstance;
+  return [TestPackedExtensionsLite defaultInstance];
+}
+- (void) setInitialized {
+  hasBits_[0] |= 0x1u;
 }
 - (BOOL) isInitialized {
+  if ((hasBits_[0] & 0x1u) != 0) {
+    return YES;
+  }
   if (!self.extensionsAreInitialized) {
     return NO;
   }
@@ -8027,19 +10066,17 @@ static TestPackedExtensionsLite* defaultTestPackedExtensionsLiteInstance = nil;
   [self writeExtensionsToCodedOutputStream:output
                                       from:1
                                         to:536870912];
-  [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = PBGeneratedMessageGetMemoizedSize(&memoizedSerializedSize);
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
-  size += [self extensionsSerializedSize];
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
+  size_ = 0;
+  size_ += [self extensionsSerializedSize];
+  PBGeneratedMessageSetMemoizedSize(&memoizedSerializedSize, size_);
+  return size_;
 }
 + (TestPackedExtensionsLite*) parseFromData:(NSData*) data {
   return (TestPackedExtensionsLite*)[[[TestPackedExtensionsLite builder] mergeFromData:data] build];
@@ -8063,7 +10100,7 @@ static TestPackedExtensionsLite* defaultTestPackedExtensionsLiteInstance = nil;
   return [[[TestPackedExtensionsLite_Builder alloc] init] autorelease];
 }
 + (TestPackedExtensionsLite_Builder*) builderWithPrototype:(TestPackedExtensionsLite*) prototype {
-  return [[TestPackedExtensionsLite builder] mergeFrom:prototype];
+  return [[[TestPackedExtensionsLite_Builder alloc] initWithPrototype:prototype] autorelease];
 }
 - (TestPackedExtensionsLite_Builder*) builder {
   return [TestPackedExtensionsLite builder];
@@ -8071,13 +10108,6 @@ static TestPackedExtensionsLite* defaultTestPackedExtensionsLiteInstance = nil;
 - (TestPackedExtensionsLite_Builder*) toBuilder {
   return [TestPackedExtensionsLite builderWithPrototype:self];
 }
-- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
-  [self writeExtensionDescriptionToMutableString:(NSMutableString*)output
-                                            from:1
-                                              to:536870912
-                                      withIndent:indent];
-  [self.unknownFields writeDescriptionTo:output withIndent:indent];
-}
 - (BOOL) isEqual:(id)other {
   if (other == self) {
     return YES;
@@ -8088,79 +10118,150 @@ static TestPackedExtensionsLite* defaultTestPackedExtensionsLiteInstance = nil;
   TestPackedExtensionsLite *otherMessage = other;
   return
       [self isEqualExtensionsInOther:otherMessage from:1 to:536870912] &&
-      
-      (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
+
+      YES;
 }
 - (NSUInteger) hash {
-  NSUInteger hashCode = 7;
-  hashCode = hashCode * 31 + [self hashExtensionsFrom:1 to:536870912];
-  hashCode = hashCode * 31 + [self.unknownFields hash];
-  return hashCode;
-}
-@end
+  NSUInteger hash_ = PBGeneratedMessageGetMemoizedHash(&memoizedHash);
+  if (hash_ != 0) {
+    return hash_;
+  }
 
-@interface TestPackedExtensionsLite_Builder()
-@property (retain) TestPackedExtensionsLite* result;
+  uint64_t hashCode = 7;
+  hashCode = PBGeneratedMessageHashMix(hashCode, [self hashExtensionsFrom:1 to:536870912]);
+  hash_ = PBGeneratedMessageHashFinish(hashCode);
+  PBGeneratedMessageSetMemoizedHash(&memoizedHash, hash_);
+  return hash_;
+}
 @end
 
 @implementation TestPackedExtensionsLite_Builder
 @synthesize result;
 - (void) dealloc {
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
   self.result = nil;
+  [prototype_ release];
   [super dealloc];
 }
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[[TestPackedExtensionsLite alloc] init] autorelease];
+    result = [TestPackedExtensionsLite recycledInstance];
+  }
+  return self;
+}
+- (id) initWithPrototype:(TestPackedExtensionsLite*) prototype {
+  if ((self = [super init])) {
+    self.result = prototype;
+    prototype_ = [prototype retain];
   }
   return self;
 }
+- (void) detachFromPrototype {
+  TestPackedExtensionsLite* prototype = prototype_;
+  prototype_ = nil;
+  self.result = [[[TestPackedExtensionsLite alloc] init] autorelease];
+  [self mergeFrom:prototype];
+  [prototype release];
+}
+- (PBExtendableMessage*) internalGetMutableResult {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return [self internalGetResult];
+}
 - (PBExtendableMessage*) internalGetResult {
   return result;
 }
 - (TestPackedExtensionsLite_Builder*) clear {
-  self.result = [[[TestPackedExtensionsLite alloc] init] autorelease];
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = [[TestPackedExtensionsLite recycledInstance] autorelease];
   return self;
 }
 - (TestPackedExtensionsLite_Builder*) clone {
-  return [TestPackedExtensionsLite builderWithPrototype:result];
+  if (prototype_ != nil) {
+    return [[[TestPackedExtensionsLite_Builder alloc] initWithPrototype:prototype_] autorelease];
+  }
+  return [[TestPackedExtensionsLite builder] mergeFrom:result];
+}
+- (TestPackedExtensionsLite_Builder*) reset {
+  if (result == nil || prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    self.result = [[TestPackedExtensionsLite recycledInstance] autorelease];
+  } else {
+    [result clearForReuse];
+  }
+  return self;
+}
+- (TestPackedExtensionsLite_Builder*) recycle:(TestPackedExtensionsLite*) message {
+  if (message == [TestPackedExtensionsLite defaultInstance]) {
+    @throw [NSException exceptionWithName:@"IllegalArgument" reason:@"Cannot recycle the default instance" userInfo:nil];
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = message;
+  return [self reset];
 }
 - (TestPackedExtensionsLite*) defaultInstance {
   return [TestPackedExtensionsLite defaultInstance];
 }
 - (TestPackedExtensionsLite*) build {
   [self checkInitialized];
-  return [self buildPartial];
+  BOOL shared = prototype_ != nil;
+  TestPackedExtensionsLite* returnMe = [self buildPartial];
+  if (!shared) {
+    [returnMe setInitialized];
+  }
+  return returnMe;
 }
 - (TestPackedExtensionsLite*) buildPartial {
-  TestPackedExtensionsLite* returnMe = [[result retain] autorelease];
-  self.result = nil;
+  return [[self newBuildPartial] autorelease];
+}
+- (TestPackedExtensionsLite*) newBuildPartial {
+  if (prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    TestPackedExtensionsLite* returnMe = result;
+    result = nil;
+    return returnMe;
+  }
+  TestPackedExtensionsLite* returnMe = result;
+  result = nil;
   return returnMe;
 }
 - (TestPackedExtensionsLite_Builder*) mergeFrom:(TestPackedExtensionsLite*) other {
   if (other == [TestPackedExtensionsLite defaultInstance]) {
     return self;
   }
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
   [self mergeExtensionFields:other];
-  [self mergeUnknownFields:other.unknownFields];
   return self;
 }
 - (TestPackedExtensionsLite_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input {
   return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
 }
 - (TestPackedExtensionsLite_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
   while (YES) {
     int32_t tag = [input readTag];
     switch (tag) {
       case 0:
-        [self setUnknownFields:[unknownFields build]];
         return self;
       default: {
-        if (![self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag]) {
-          [self setUnknownFields:[unknownFields build]];
+        if (PBWireFormatGetTagWireType(tag) == PBWireFormatEndGroup) {
           return self;
         }
+        [self parseUnknownField:input unknownFields:nil extensionRegistry:extensionRegistry tag:tag];
         break;
       }
     }
@@ -8171,47 +10272,49 @@ static TestPackedExtensionsLite* defaultTestPackedExtensionsLiteInstance = nil;
 @interface TestNestedExtensionLite ()
 @end
 
+@interface TestNestedExtensionLite_Builder()
+@property (nonatomic, retain) TestNestedExtensionLite* result;
+- (id) initWithPrototype:(TestNestedExtensionLite*) prototype;
+- (void) detachFromPrototype;
+@end
+
 @implementation TestNestedExtensionLite
 
 - (void) dealloc {
   [super dealloc];
 }
-- (id) init {
-  if ((self = [super init])) {
-  }
-  return self;
+- (void) clearForReuse {
+  [super clearForReuse];
+  memset(hasBits_, 0, sizeof(hasBits_));
 }
 + (id<PBExtensionField>) nestedExtension {
   return TestNestedExtensionLite_nestedExtension;
 }
 static TestNestedExtensionLite* defaultTestNestedExtensionLiteInstance = nil;
-+ (void) initialize {
-  if (self == [TestNestedExtensionLite class]) {
-    defaultTestNestedExtensionLiteInstance = [[TestNestedExtensionLite alloc] init];
-  }
-}
 + (TestNestedExtensionLite*) defaultInstance {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultTestNestedExtensionLiteInstance = [[TestNestedExtensionLite alloc] init];
+  });
   return defaultTestNestedExtensionLiteInstance;
 }
 - (TestNestedExtensionLite*) defaultInstance {
-  return defaultTestNestedExtensionLiteInstance;
+  return [TestNestedExtensionLite defaultInstance];
 }
 - (BOOL) isInitialized {
   return YES;
 }
 - (void) writeToCodedOutputStream:(PBCodedOutputStream*) output {
-  [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = PBGeneratedMessageGetMemoizedSize(&memoizedSerializedSize);
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
+  size_ = 0;
+  PBGeneratedMessageSetMemoizedSize(&memoizedSerializedSize, size_);
+  return size_;
 }
 + (TestNestedExtensionLite*) parseFromData:(NSData*) data {
   return (TestNestedExtensionLite*)[[[TestNestedExtensionLite builder] mergeFromData:data] build];
@@ -8235,7 +10338,7 @@ static TestNestedExtensionLite* defaultTestNestedExtensionLiteInstance = nil;
   return [[[TestNestedExtensionLite_Builder alloc] init] autorelease];
 }
 + (TestNestedExtensionLite_Builder*) builderWithPrototype:(TestNestedExtensionLite*) prototype {
-  return [[TestNestedExtensionLite builder] mergeFrom:prototype];
+  return [[[TestNestedExtensionLite_Builder alloc] initWithPrototype:prototype] autorelease];
 }
 - (TestNestedExtensionLite_Builder*) builder {
   return [TestNestedExtensionLite builder];
@@ -8243,9 +10346,6 @@ static TestNestedExtensionLite* defaultTestNestedExtensionLiteInstance = nil;
 - (TestNestedExtensionLite_Builder*) toBuilder {
   return [TestNestedExtensionLite builderWithPrototype:self];
 }
-- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
-  [self.unknownFields writeDescriptionTo:output withIndent:indent];
-}
 - (BOOL) isEqual:(id)other {
   if (other == self) {
     return YES;
@@ -8255,40 +10355,93 @@ static TestNestedExtensionLite* defaultTestNestedExtensionLiteInstance = nil;
   }
   TestNestedExtensionLite *otherMessage = other;
   return
-      (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
+      YES;
 }
 - (NSUInteger) hash {
-  NSUInteger hashCode = 7;
-  hashCode = hashCode * 31 + [self.unknownFields hash];
-  return hashCode;
-}
-@end
+  NSUInteger hash_ = PBGeneratedMessageGetMemoizedHash(&memoizedHash);
+  if (hash_ != 0) {
+    return hash_;
+  }
 
-@interface TestNestedExtensionLite_Builder()
-@property (retain) TestNestedExtensionLite* result;
+  uint64_t hashCode = 7;
+  hash_ = PBGeneratedMessageHashFinish(hashCode);
+  PBGeneratedMessageSetMemoizedHash(&memoizedHash, hash_);
+  return hash_;
+}
 @end
 
 @implementation TestNestedExtensionLite_Builder
 @synthesize result;
 - (void) dealloc {
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
   self.result = nil;
+  [prototype_ release];
   [super dealloc];
 }
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[[TestNestedExtensionLite alloc] init] autorelease];
+    result = [TestNestedExtensionLite recycledInstance];
   }
   return self;
 }
+- (id) initWithPrototype:(TestNestedExtensionLite*) prototype {
+  if ((self = [super init])) {
+    self.result = prototype;
+    prototype_ = [prototype retain];
+  }
+  return self;
+}
+- (void) detachFromPrototype {
+  TestNestedExtensionLite* prototype = prototype_;
+  prototype_ = nil;
+  self.result = [[[TestNestedExtensionLite alloc] init] autorelease];
+  [self mergeFrom:prototype];
+  [prototype release];
+}
+- (PBGeneratedMessage*) internalGetMutableResult {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return [self internalGetResult];
+}
 - (PBGeneratedMessage*) internalGetResult {
   return result;
 }
 - (TestNestedExtensionLite_Builder*) clear {
-  self.result = [[[TestNestedExtensionLite alloc] init] autorelease];
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = [[TestNestedExtensionLite recycledInstance] autorelease];
   return self;
 }
 - (TestNestedExtensionLite_Builder*) clone {
-  return [TestNestedExtensionLite builderWithPrototype:result];
+  if (prototype_ != nil) {
+    return [[[TestNestedExtensionLite_Builder alloc] initWithPrototype:prototype_] autorelease];
+  }
+  return [[TestNestedExtensionLite builder] mergeFrom:result];
+}
+- (TestNestedExtensionLite_Builder*) reset {
+  if (result == nil || prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    self.result = [[TestNestedExtensionLite recycledInstance] autorelease];
+  } else {
+    [result clearForReuse];
+  }
+  return self;
+}
+- (TestNestedExtensionLite_Builder*) recycle:(TestNestedExtensionLite*) message {
+  if (message == [TestNestedExtensionLite defaultInstance]) {
+    @throw [NSException exceptionWithName:@"IllegalArgument" reason:@"Cannot recycle the default instance" userInfo:nil];
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = message;
+  return [self reset];
 }
 - (TestNestedExtensionLite*) defaultInstance {
   return [TestNestedExtensionLite defaultInstance];
@@ -8298,33 +10451,46 @@ static TestNestedExtensionLite* defaultTestNestedExtensionLiteInstance = nil;
   return [self buildPartial];
 }
 - (TestNestedExtensionLite*) buildPartial {
-  TestNestedExtensionLite* returnMe = [[result retain] autorelease];
-  self.result = nil;
+  return [[self newBuildPartial] autorelease];
+}
+- (TestNestedExtensionLite*) newBuildPartial {
+  if (prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    TestNestedExtensionLite* returnMe = result;
+    result = nil;
+    return returnMe;
+  }
+  TestNestedExtensionLite* returnMe = result;
+  result = nil;
   return returnMe;
 }
 - (TestNestedExtensionLite_Builder*) mergeFrom:(TestNestedExtensionLite*) other {
   if (other == [TestNestedExtensionLite defaultInstance]) {
     return self;
   }
-  [self mergeUnknownFields:other.unknownFields];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
   return self;
 }
 - (TestNestedExtensionLite_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input {
   return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
 }
 - (TestNestedExtensionLite_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
   while (YES) {
     int32_t tag = [input readTag];
     switch (tag) {
       case 0:
-        [self setUnknownFields:[unknownFields build]];
         return self;
       default: {
-        if (![self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag]) {
-          [self setUnknownFields:[unknownFields build]];
+        if (PBWireFormatGetTagWireType(tag) == PBWireFormatEndGroup) {
           return self;
         }
+        [input skipField:tag];
         break;
       }
     }
@@ -8333,61 +10499,67 @@ static TestNestedExtensionLite* defaultTestNestedExtensionLiteInstance = nil;
 @end
 
 @interface TestDeprecatedLite ()
-@property int32_t deprecatedField;
+@property (nonatomic) int32_t deprecatedField;
+@end
+
+@interface TestDeprecatedLite_Builder()
+@property (nonatomic, retain) TestDeprecatedLite* result;
+- (id) initWithPrototype:(TestDeprecatedLite*) prototype;
+- (void) detachFromPrototype;
 @end
 
 @implementation TestDeprecatedLite
 
 - (BOOL) hasDeprecatedField {
-  return !!hasDeprecatedField_;
+  return (hasBits_[0] & 0x1u) != 0;
 }
-- (void) setHasDeprecatedField:(BOOL) value {
-  hasDeprecatedField_ = !!value;
+- (void) setHasDeprecatedField:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x1u;
+  } else {
+    hasBits_[0] &= ~0x1u;
+  }
 }
 @synthesize deprecatedField;
 - (void) dealloc {
   [super dealloc];
 }
-- (id) init {
-  if ((self = [super init])) {
-    self.deprecatedField = 0;
-  }
-  return self;
+- (void) clearForReuse {
+  [super clearForReuse];
+  memset(hasBits_, 0, sizeof(hasBits_));
+  deprecatedField = 0;
 }
 static TestDeprecatedLite* defaultTestDeprecatedLiteInstance = nil;
-+ (void) initialize {
-  if (self == [TestDeprecatedLite class]) {
-    defaultTestDeprecatedLiteInstance = [[TestDeprecatedLite alloc] init];
-  }
-}
 + (TestDeprecatedLite*) defaultInstance {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultTestDeprecatedLiteInstance = [[TestDeprecatedLite alloc] init];
+  });
   return defaultTestDeprecatedLiteInstance;
 }
 - (TestDeprecatedLite*) defaultInstance {
-  return defaultTestDeprecatedLiteInstance;
+  return [TestDeprecatedLite defaultInstance];
 }
 - (BOOL) isInitialized {
   return YES;
 }
 - (void) writeToCodedOutputStream:(PBCodedOutputStream*) output {
-  if (self.hasDeprecatedField) {
-    [output writeInt32:1 value:self.deprecatedField];
+  if (hasBits_[0] & 0x1u) {
+    [output writeInt32:1 value:deprecatedField];
   }
-  [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = PBGeneratedMessageGetMemoizedSize(&memoizedSerializedSize);
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
-  if (self.hasDeprecatedField) {
-    size += computeInt32Size(1, self.deprecatedField);
+  size_ = 0;
+  if (hasBits_[0] & 0x1u) {
+    size_ += computeInt32Size(1, deprecatedField);
   }
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
+  PBGeneratedMessageSetMemoizedSize(&memoizedSerializedSize, size_);
+  return size_;
 }
 + (TestDeprecatedLite*) parseFromData:(NSData*) data {
   return (TestDeprecatedLite*)[[[TestDeprecatedLite builder] mergeFromData:data] build];
@@ -8411,7 +10583,7 @@ static TestDeprecatedLite* defaultTestDeprecatedLiteInstance = nil;
   return [[[TestDeprecatedLite_Builder alloc] init] autorelease];
 }
 + (TestDeprecatedLite_Builder*) builderWithPrototype:(TestDeprecatedLite*) prototype {
-  return [[TestDeprecatedLite builder] mergeFrom:prototype];
+  return [[[TestDeprecatedLite_Builder alloc] initWithPrototype:prototype] autorelease];
 }
 - (TestDeprecatedLite_Builder*) builder {
   return [TestDeprecatedLite builder];
@@ -8419,12 +10591,6 @@ static TestDeprecatedLite* defaultTestDeprecatedLiteInstance = nil;
 - (TestDeprecatedLite_Builder*) toBuilder {
   return [TestDeprecatedLite builderWithPrototype:self];
 }
-- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
-  if (self.hasDeprecatedField) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"deprecatedField", [NSNumber numberWithInt:self.deprecatedField]];
-  }
-  [self.unknownFields writeDescriptionTo:output withIndent:indent];
-}
 - (BOOL) isEqual:(id)other {
   if (other == self) {
     return YES;
@@ -8434,46 +10600,98 @@ static TestDeprecatedLite* defaultTestDeprecatedLiteInstance = nil;
   }
   TestDeprecatedLite *otherMessage = other;
   return
-      self.hasDeprecatedField == otherMessage.hasDeprecatedField &&
-      (!self.hasDeprecatedField || self.deprecatedField == otherMessage.deprecatedField) &&
-      
-      (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
+      (hasBits_[0] & 0x1u) == (otherMessage->hasBits_[0] & 0x1u) &&
+      (!(hasBits_[0] & 0x1u) || deprecatedField == otherMessage->deprecatedField) &&
+      YES;
 }
 - (NSUInteger) hash {
-  NSUInteger hashCode = 7;
-  if (self.hasDeprecatedField) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithInt:self.deprecatedField] hash];
+  NSUInteger hash_ = PBGeneratedMessageGetMemoizedHash(&memoizedHash);
+  if (hash_ != 0) {
+    return hash_;
   }
-  hashCode = hashCode * 31 + [self.unknownFields hash];
-  return hashCode;
-}
-@end
 
-@interface TestDeprecatedLite_Builder()
-@property (retain) TestDeprecatedLite* result;
+  uint64_t hashCode = 7;
+  if (hasBits_[0] & 0x1u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, (uint64_t)deprecatedField);
+  }
+  hash_ = PBGeneratedMessageHashFinish(hashCode);
+  PBGeneratedMessageSetMemoizedHash(&memoizedHash, hash_);
+  return hash_;
+}
 @end
 
 @implementation TestDeprecatedLite_Builder
 @synthesize result;
 - (void) dealloc {
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
   self.result = nil;
+  [prototype_ release];
   [super dealloc];
 }
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[[TestDeprecatedLite alloc] init] autorelease];
+    result = [TestDeprecatedLite recycledInstance];
+  }
+  return self;
+}
+- (id) initWithPrototype:(TestDeprecatedLite*) prototype {
+  if ((self = [super init])) {
+    self.result = prototype;
+    prototype_ = [prototype retain];
   }
   return self;
 }
+- (void) detachFromPrototype {
+  TestDeprecatedLite* prototype = prototype_;
+  prototype_ = nil;
+  self.result = [[[TestDeprecatedLite alloc] init] autorelease];
+  [self mergeFrom:prototype];
+  [prototype release];
+}
+- (PBGeneratedMessage*) internalGetMutableResult {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return [self internalGetResult];
+}
 - (PBGeneratedMessage*) internalGetResult {
   return result;
 }
 - (TestDeprecatedLite_Builder*) clear {
-  self.result = [[[TestDeprecatedLite alloc] init] autorelease];
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = [[TestDeprecatedLite recycledInstance] autorelease];
   return self;
 }
 - (TestDeprecatedLite_Builder*) clone {
-  return [TestDeprecatedLite builderWithPrototype:result];
+  if (prototype_ != nil) {
+    return [[[TestDeprecatedLite_Builder alloc] initWithPrototype:prototype_] autorelease];
+  }
+  return [[TestDeprecatedLite builder] mergeFrom:result];
+}
+- (TestDeprecatedLite_Builder*) reset {
+  if (result == nil || prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    self.result = [[TestDeprecatedLite recycledInstance] autorelease];
+  } else {
+    [result clearForReuse];
+  }
+  return self;
+}
+- (TestDeprecatedLite_Builder*) recycle:(TestDeprecatedLite*) message {
+  if (message == [TestDeprecatedLite defaultInstance]) {
+    @throw [NSException exceptionWithName:@"IllegalArgument" reason:@"Cannot recycle the default instance" userInfo:nil];
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = message;
+  return [self reset];
 }
 - (TestDeprecatedLite*) defaultInstance {
   return [TestDeprecatedLite defaultInstance];
@@ -8483,36 +10701,49 @@ static TestDeprecatedLite* defaultTestDeprecatedLiteInstance = nil;
   return [self buildPartial];
 }
 - (TestDeprecatedLite*) buildPartial {
-  TestDeprecatedLite* returnMe = [[result retain] autorelease];
-  self.result = nil;
+  return [[self newBuildPartial] autorelease];
+}
+- (TestDeprecatedLite*) newBuildPartial {
+  if (prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    TestDeprecatedLite* returnMe = result;
+    result = nil;
+    return returnMe;
+  }
+  TestDeprecatedLite* returnMe = result;
+  result = nil;
   return returnMe;
 }
 - (TestDeprecatedLite_Builder*) mergeFrom:(TestDeprecatedLite*) other {
   if (other == [TestDeprecatedLite defaultInstance]) {
     return self;
   }
-  if (other.hasDeprecatedField) {
-    [self setDeprecatedField:other.deprecatedField];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (other->hasBits_[0] & 0x1u) {
+    [self setDeprecatedField:other->deprecatedField];
   }
-  [self mergeUnknownFields:other.unknownFields];
   return self;
 }
 - (TestDeprecatedLite_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input {
   return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
 }
 - (TestDeprecatedLite_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
   while (YES) {
     int32_t tag = [input readTag];
     switch (tag) {
       case 0:
-        [self setUnknownFields:[unknownFields build]];
         return self;
       default: {
-        if (![self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag]) {
-          [self setUnknownFields:[unknownFields build]];
+        if (PBWireFormatGetTagWireType(tag) == PBWireFormatEndGroup) {
           return self;
         }
+        [input skipField:tag];
         break;
       }
       case 8: {
@@ -8523,19 +10754,25 @@ static TestDeprecatedLite* defaultTestDeprecatedLiteInstance = nil;
   }
 }
 - (BOOL) hasDeprecatedField {
-  return result.hasDeprecatedField;
+  return (result->hasBits_[0] & 0x1u) != 0;
 }
 - (int32_t) deprecatedField {
-  return result.deprecatedField;
+  return result->deprecatedField;
 }
 - (TestDeprecatedLite_Builder*) setDeprecatedField:(int32_t) value {
-  result.hasDeprecatedField = YES;
-  result.deprecatedField = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x1u;
+  result->deprecatedField = value;
   return self;
 }
 - (TestDeprecatedLite_Builder*) clearDeprecatedField {
-  result.hasDeprecatedField = NO;
-  result.deprecatedField = 0;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x1u;
+  result->deprecatedField = 0;
   return self;
 }
 @end
@@ -110,12 +110,12 @@
 @end
 
 @interface TestLiteImportsNonlite : PBGeneratedMessage {
-@private
-  BOOL hasMessage_:1;
+@package
+  uint32_t hasBits_[1];
   TestAllTypes* message;
 }
 - (BOOL) hasMessage;
-@property (readonly, retain) TestAllTypes* message;
+@property (nonatomic, readonly, retain) TestAllTypes* message;
 
 + (TestLiteImportsNonlite*) defaultInstance;
 - (TestLiteImportsNonlite*) defaultInstance;
@@ -138,15 +138,26 @@
 @interface TestLiteImportsNonlite_Builder : PBGeneratedMessage_Builder {
 @private
   TestLiteImportsNonlite* result;
+  TestLiteImportsNonlite* prototype_;
+  TestAllTypes_Builder* messageBuilder_;
+  TestAllTypes_Builder* messageSpareBuilder_;
 }
 
 - (TestLiteImportsNonlite*) defaultInstance;
 
 - (TestLiteImportsNonlite_Builder*) clear;
 - (TestLiteImportsNonlite_Builder*) clone;
+- (TestLiteImportsNonlite_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (TestLiteImportsNonlite_Builder*) recycle:(TestLiteImportsNonlite*) message;
 
 - (TestLiteImportsNonlite*) build;
 - (TestLiteImportsNonlite*) buildPartial;
+- (TestLiteImportsNonlite*) newBuildPartial;
 
 - (TestLiteImportsNonlite_Builder*) mergeFrom:(TestLiteImportsNonlite*) other;
 - (TestLiteImportsNonlite_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -5,15 +5,18 @@
 @implementation UnittestLiteImportsNonliteRoot
 static PBExtensionRegistry* extensionRegistry = nil;
 + (PBExtensionRegistry*) extensionRegistry {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    PBMutableExtensionRegistry* registry = [PBMutableExtensionRegistry registry];
+    [UnittestLiteImportsNonliteRoot registerAllExtensions:registry];
+    [UnittestRoot registerAllExtensions:registry];
+    extensionRegistry = [registry retain];
+  });
   return extensionRegistry;
 }
 
 + (void) initialize {
   if (self == [UnittestLiteImportsNonliteRoot class]) {
-    PBMutableExtensionRegistry* registry = [PBMutableExtensionRegistry registry];
-    [self registerAllExtensions:registry];
-    [UnittestRoot registerAllExtensions:registry];
-    extensionRegistry = [registry retain];
   }
 }
 + (void) registerAllExtensions:(PBMutableExtensionRegistry*) registry {
@@ -21,62 +24,75 @@ static PBExtensionRegistry* extensionRegistry = nil;
 @end
 
 @interface TestLiteImportsNonlite ()
-@property (retain) TestAllTypes* message;
+@property (nonatomic, retain) TestAllTypes* message;
+@end
+
+@interface TestLiteImportsNonlite_Builder()
+@property (nonatomic, retain) TestLiteImportsNonlite* result;
+- (id) initWithPrototype:(TestLiteImportsNonlite*) prototype;
+- (void) detachFromPrototype;
+- (void) freezeSubBuilders;
+- (void) dropSubBuilders;
+- (void) resetSubBuilders;
 @end
 
 @implementation TestLiteImportsNonlite
 
 - (BOOL) hasMessage {
-  return !!hasMessage_;
+  return (hasBits_[0] & 0x1u) != 0;
 }
-- (void) setHasMessage:(BOOL) value {
-  hasMessage_ = !!value;
+- (void) setHasMessage:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x1u;
+  } else {
+    hasBits_[0] &= ~0x1u;
+  }
 }
 @synthesize message;
+- (TestAllTypes*) message {
+  return message != nil ? message : [TestAllTypes defaultInstance];
+}
 - (void) dealloc {
-  self.message = nil;
+  [message release];
   [super dealloc];
 }
-- (id) init {
-  if ((self = [super init])) {
-    self.message = [TestAllTypes defaultInstance];
-  }
-  return self;
+- (void) clearForReuse {
+  [super clearForReuse];
+  memset(hasBits_, 0, sizeof(hasBits_));
+  [message release];
+  message = nil;
 }
 static TestLiteImportsNonlite* defaultTestLiteImportsNonliteInstance = nil;
-+ (void) initialize {
-  if (self == [TestLiteImportsNonlite class]) {
-    defaultTestLiteImportsNonliteInstance = [[TestLiteImportsNonlite alloc] init];
-  }
-}
 + (TestLiteImportsNonlite*) defaultInstance {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultTestLiteImportsNonliteInstance = [[TestLiteImportsNonlite alloc] init];
+  });
   return defaultTestLiteImportsNonliteInstance;
 }
 - (TestLiteImportsNonlite*) defaultInstance {
-  return defaultTestLiteImportsNonliteInstance;
+  return [TestLiteImportsNonlite defaultInstance];
 }
 - (BOOL) isInitialized {
   return YES;
 }
 - (void) writeToCodedOutputStream:(PBCodedOutputStream*) output {
-  if (self.hasMessage) {
-    [output writeMessage:1 value:self.message];
+  if (hasBits_[0] & 0x1u) {
+    [output writeMessage:1 value:message];
   }
-  [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = PBGeneratedMessageGetMemoizedSize(&memoizedSerializedSize);
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
-  if (self.hasMessage) {
-    size += computeMessageSize(1, self.message);
+  size_ = 0;
+  if (hasBits_[0] & 0x1u) {
+    size_ += computeMessageSize(1, message);
   }
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
+  PBGeneratedMessageSetMemoizedSize(&memoizedSerializedSize, size_);
+  return size_;
 }
 + (TestLiteImportsNonlite*) parseFromData:(NSData*) data {
   return (TestLiteImportsNonlite*)[[[TestLiteImportsNonlite builder] mergeFromData:data] build];
@@ -100,7 +116,7 @@ static TestLiteImportsNonlite* defaultTestLiteImportsNonliteInstance = nil;
   return [[[TestLiteImportsNonlite_Builder alloc] init] autorelease];
 }
 + (TestLiteImportsNonlite_Builder*) builderWithPrototype:(TestLiteImportsNonlite*) prototype {
-  return [[TestLiteImportsNonlite builder] mergeFrom:prototype];
+  return [[[TestLiteImportsNonlite_Builder alloc] initWithPrototype:prototype] autorelease];
 }
 - (TestLiteImportsNonlite_Builder*) builder {
   return [TestLiteImportsNonlite builder];
@@ -108,15 +124,6 @@ static TestLiteImportsNonlite* defaultTestLiteImportsNonliteInstance = nil;
 - (TestLiteImportsNonlite_Builder*) toBuilder {
   return [TestLiteImportsNonlite builderWithPrototype:self];
 }
-- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
-  if (self.hasMessage) {
-    [output appendFormat:@"%@%@ {\n", indent, @"message"];
-    [self.message writeDescriptionTo:output
-                         withIndent:[NSString stringWithFormat:@"%@  ", indent]];
-    [output appendFormat:@"%@}\n", indent];
-  }
-  [self.unknownFields writeDescriptionTo:output withIndent:indent];
-}
 - (BOOL) isEqual:(id)other {
   if (other == self) {
     return YES;
@@ -126,46 +133,126 @@ static TestLiteImportsNonlite* defaultTestLiteImportsNonliteInstance = nil;
   }
   TestLiteImportsNonlite *otherMessage = other;
   return
-      self.hasMessage == otherMessage.hasMessage &&
-      (!self.hasMessage || [self.message isEqual:otherMessage.message]) &&
-      
-      (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
+      (hasBits_[0] & 0x1u) == (otherMessage->hasBits_[0] & 0x1u) &&
+      (!(hasBits_[0] & 0x1u) || [message isEqual:otherMessage->message]) &&
+      YES;
 }
 - (NSUInteger) hash {
-  NSUInteger hashCode = 7;
-  if (self.hasMessage) {
-    hashCode = hashCode * 31 + [self.message hash];
+  NSUInteger hash_ = PBGeneratedMessageGetMemoizedHash(&memoizedHash);
+  if (hash_ != 0) {
+    return hash_;
   }
-  hashCode = hashCode * 31 + [self.unknownFields hash];
-  return hashCode;
-}
-@end
 
-@interface TestLiteImportsNonlite_Builder()
-@property (retain) TestLiteImportsNonlite* result;
+  uint64_t hashCode = 7;
+  if (hasBits_[0] & 0x1u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [message hash]);
+  }
+  hash_ = PBGeneratedMessageHashFinish(hashCode);
+  PBGeneratedMessageSetMemoizedHash(&memoizedHash, hash_);
+  return hash_;
+}
 @end
 
 @implementation TestLiteImportsNonlite_Builder
 @synthesize result;
 - (void) dealloc {
+  [self dropSubBuilders];
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
   self.result = nil;
+  [prototype_ release];
   [super dealloc];
 }
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[[TestLiteImportsNonlite alloc] init] autorelease];
+    result = [TestLiteImportsNonlite recycledInstance];
   }
   return self;
 }
+- (id) initWithPrototype:(TestLiteImportsNonlite*) prototype {
+  if ((self = [super init])) {
+    self.result = prototype;
+    prototype_ = [prototype retain];
+  }
+  return self;
+}
+- (void) detachFromPrototype {
+  TestLiteImportsNonlite* prototype = prototype_;
+  prototype_ = nil;
+  self.result = [[[TestLiteImportsNonlite alloc] init] autorelease];
+  [self mergeFrom:prototype];
+  [prototype release];
+}
+- (PBGeneratedMessage*) internalGetMutableResult {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return [self internalGetResult];
+}
+- (void) freezeSubBuilders {
+  if (messageBuilder_ != nil) {
+    TestAllTypes* value = [messageBuilder_ newBuildPartial];
+    result.message = value;
+    [value release];
+    [messageBuilder_ release];
+    messageBuilder_ = nil;
+  }
+}
+- (void) dropSubBuilders {
+  [messageBuilder_ release];
+  messageBuilder_ = nil;
+  [messageSpareBuilder_ release];
+  messageSpareBuilder_ = nil;
+}
+- (void) resetSubBuilders {
+  if (messageBuilder_ != nil) {
+    [messageBuilder_ reset];
+    [messageSpareBuilder_ release];
+    messageSpareBuilder_ = messageBuilder_;
+    messageBuilder_ = nil;
+  }
+}
 - (PBGeneratedMessage*) internalGetResult {
+  [self freezeSubBuilders];
   return result;
 }
 - (TestLiteImportsNonlite_Builder*) clear {
-  self.result = [[[TestLiteImportsNonlite alloc] init] autorelease];
+  [self dropSubBuilders];
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = [[TestLiteImportsNonlite recycledInstance] autorelease];
   return self;
 }
 - (TestLiteImportsNonlite_Builder*) clone {
-  return [TestLiteImportsNonlite builderWithPrototype:result];
+  if (prototype_ != nil) {
+    return [[[TestLiteImportsNonlite_Builder alloc] initWithPrototype:prototype_] autorelease];
+  }
+  [self freezeSubBuilders];
+  return [[TestLiteImportsNonlite builder] mergeFrom:result];
+}
+- (TestLiteImportsNonlite_Builder*) reset {
+  [self resetSubBuilders];
+  if (result == nil || prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    self.result = [[TestLiteImportsNonlite recycledInstance] autorelease];
+  } else {
+    [result clearForReuse];
+  }
+  return self;
+}
+- (TestLiteImportsNonlite_Builder*) recycle:(TestLiteImportsNonlite*) message {
+  if (message == [TestLiteImportsNonlite defaultInstance]) {
+    @throw [NSException exceptionWithName:@"IllegalArgument" reason:@"Cannot recycle the default instance" userInfo:nil];
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = message;
+  return [self reset];
 }
 - (TestLiteImportsNonlite*) defaultInstance {
   return [TestLiteImportsNonlite defaultInstance];
@@ -175,58 +262,81 @@ static TestLiteImportsNonlite* defaultTestLiteImportsNonliteInstance = nil;
   return [self buildPartial];
 }
 - (TestLiteImportsNonlite*) buildPartial {
-  TestLiteImportsNonlite* returnMe = [[result retain] autorelease];
-  self.result = nil;
+  return [[self newBuildPartial] autorelease];
+}
+- (TestLiteImportsNonlite*) newBuildPartial {
+  if (prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    TestLiteImportsNonlite* returnMe = result;
+    result = nil;
+    return returnMe;
+  }
+  [self freezeSubBuilders];
+  TestLiteImportsNonlite* returnMe = result;
+  result = nil;
   return returnMe;
 }
 - (TestLiteImportsNonlite_Builder*) mergeFrom:(TestLiteImportsNonlite*) other {
   if (other == [TestLiteImportsNonlite defaultInstance]) {
     return self;
   }
-  if (other.hasMessage) {
-    [self mergeMessage:other.message];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (other->hasBits_[0] & 0x1u) {
+    [self mergeMessage:other->message];
   }
-  [self mergeUnknownFields:other.unknownFields];
   return self;
 }
 - (TestLiteImportsNonlite_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input {
   return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
 }
 - (TestLiteImportsNonlite_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
   while (YES) {
     int32_t tag = [input readTag];
     switch (tag) {
       case 0:
-        [self setUnknownFields:[unknownFields build]];
         return self;
       default: {
-        if (![self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag]) {
-          [self setUnknownFields:[unknownFields build]];
+        if (PBWireFormatGetTagWireType(tag) == PBWireFormatEndGroup) {
           return self;
         }
+        [input skipField:tag];
         break;
       }
       case 10: {
-        TestAllTypes_Builder* subBuilder = [TestAllTypes builder];
-        if (self.hasMessage) {
-          [subBuilder mergeFrom:self.message];
+        if (messageBuilder_ == nil) {
+          messageBuilder_ = messageSpareBuilder_ != nil ? messageSpareBuilder_ : [[TestAllTypes_Builder alloc] init];
+          messageSpareBuilder_ = nil;
+          if (result->hasBits_[0] & 0x1u) {
+            [messageBuilder_ mergeFrom:result->message];
+          }
+          result->hasBits_[0] |= 0x1u;
         }
-        [input readMessage:subBuilder extensionRegistry:extensionRegistry];
-        [self setMessage:[subBuilder buildPartial]];
+        [input readMessage:messageBuilder_ extensionRegistry:extensionRegistry];
         break;
       }
     }
   }
 }
 - (BOOL) hasMessage {
-  return result.hasMessage;
+  return (result->hasBits_[0] & 0x1u) != 0;
 }
 - (TestAllTypes*) message {
+  [self freezeSubBuilders];
   return result.message;
 }
 - (TestLiteImportsNonlite_Builder*) setMessage:(TestAllTypes*) value {
-  result.hasMessage = YES;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  [messageBuilder_ release];
+  messageBuilder_ = nil;
+  result->hasBits_[0] |= 0x1u;
   result.message = value;
   return self;
 }
@@ -234,19 +344,32 @@ static TestLiteImportsNonlite* defaultTestLiteImportsNonliteInstance = nil;
   return [self setMessage:[builderForValue build]];
 }
 - (TestLiteImportsNonlite_Builder*) mergeMessage:(TestAllTypes*) value {
-  if (result.hasMessage &&
-      result.message != [TestAllTypes defaultInstance]) {
-    result.message =
-      [[[TestAllTypes builderWithPrototype:result.message] mergeFrom:value] buildPartial];
-  } else {
-    result.message = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  result.hasMessage = YES;
+  if (messageBuilder_ == nil) {
+    if (!(result->hasBits_[0] & 0x1u) ||
+        result->message == [TestAllTypes defaultInstance]) {
+      result->hasBits_[0] |= 0x1u;
+      result.message = value;
+      return self;
+    }
+    messageBuilder_ = messageSpareBuilder_ != nil ? messageSpareBuilder_ : [[TestAllTypes_Builder alloc] init];
+    messageSpareBuilder_ = nil;
+    [messageBuilder_ mergeFrom:result->message];
+  }
+  [messageBuilder_ mergeFrom:value];
   return self;
 }
 - (TestLiteImportsNonlite_Builder*) clearMessage {
-  result.hasMessage = NO;
-  result.message = [TestAllTypes defaultInstance];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  [messageBuilder_ release];
+  messageBuilder_ = nil;
+  result->hasBits_[0] &= ~0x1u;
+  [result->message release];
+  result->message = nil;
   return self;
 }
 @end
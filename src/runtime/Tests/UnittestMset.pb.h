@@ -34,7 +34,8 @@
 @end
 
 @interface TestMessageSet : PBExtendableMessage {
-@private
+@package
+  uint32_t hasBits_[1];
 }
 
 + (TestMessageSet*) defaultInstance;
@@ -58,15 +59,24 @@
 @interface TestMessageSet_Builder : PBExtendableMessage_Builder {
 @private
   TestMessageSet* result;
+  TestMessageSet* prototype_;
 }
 
 - (TestMessageSet*) defaultInstance;
 
 - (TestMessageSet_Builder*) clear;
 - (TestMessageSet_Builder*) clone;
+- (TestMessageSet_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (TestMessageSet_Builder*) recycle:(TestMessageSet*) message;
 
 - (TestMessageSet*) build;
 - (TestMessageSet*) buildPartial;
+- (TestMessageSet*) newBuildPartial;
 
 - (TestMessageSet_Builder*) mergeFrom:(TestMessageSet*) other;
 - (TestMessageSet_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -74,12 +84,12 @@
 @end
 
 @interface TestMessageSetContainer : PBGeneratedMessage {
-@private
-  BOOL hasMessageSet_:1;
+@package
+  uint32_t hasBits_[1];
   TestMessageSet* messageSet;
 }
 - (BOOL) hasMessageSet;
-@property (readonly, retain) TestMessageSet* messageSet;
+@property (nonatomic, readonly, retain) TestMessageSet* messageSet;
 
 + (TestMessageSetContainer*) defaultInstance;
 - (TestMessageSetContainer*) defaultInstance;
@@ -102,15 +112,26 @@
 @interface TestMessageSetContainer_Builder : PBGeneratedMessage_Builder {
 @private
   TestMessageSetContainer* result;
+  TestMessageSetContainer* prototype_;
+  TestMessageSet_Builder* messageSetBuilder_;
+  TestMessageSet_Builder* messageSetSpareBuilder_;
 }
 
 - (TestMessageSetContainer*) defaultInstance;
 
 - (TestMessageSetContainer_Builder*) clear;
 - (TestMessageSetContainer_Builder*) clone;
+- (TestMessageSetContainer_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (TestMessageSetContainer_Builder*) recycle:(TestMessageSetContainer*) message;
 
 - (TestMessageSetContainer*) build;
 - (TestMessageSetContainer*) buildPartial;
+- (TestMessageSetContainer*) newBuildPartial;
 
 - (TestMessageSetContainer_Builder*) mergeFrom:(TestMessageSetContainer*) other;
 - (TestMessageSetContainer_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -125,12 +146,12 @@
 @end
 
 @interface TestMessageSetExtension1 : PBGeneratedMessage {
-@private
-  BOOL hasI_:1;
+@package
+  uint32_t hasBits_[1];
   int32_t i;
 }
 - (BOOL) hasI;
-@property (readonly) int32_t i;
+@property (nonatomic, readonly) int32_t i;
 
 + (TestMessageSetExtension1*) defaultInstance;
 - (TestMessageSetExtension1*) defaultInstance;
@@ -154,15 +175,24 @@
 @interface TestMessageSetExtension1_Builder : PBGeneratedMessage_Builder {
 @private
   TestMessageSetExtension1* result;
+  TestMessageSetExtension1* prototype_;
 }
 
 - (TestMessageSetExtension1*) defaultInstance;
 
 - (TestMessageSetExtension1_Builder*) clear;
 - (TestMessageSetExtension1_Builder*) clone;
+- (TestMessageSetExtension1_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (TestMessageSetExtension1_Builder*) recycle:(TestMessageSetExtension1*) message;
 
 - (TestMessageSetExtension1*) build;
 - (TestMessageSetExtension1*) buildPartial;
+- (TestMessageSetExtension1*) newBuildPartial;
 
 - (TestMessageSetExtension1_Builder*) mergeFrom:(TestMessageSetExtension1*) other;
 - (TestMessageSetExtension1_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -175,12 +205,12 @@
 @end
 
 @interface TestMessageSetExtension2 : PBGeneratedMessage {
-@private
-  BOOL hasStr_:1;
+@package
+  uint32_t hasBits_[1];
   NSString* str;
 }
 - (BOOL) hasStr;
-@property (readonly, retain) NSString* str;
+@property (nonatomic, readonly, retain) NSString* str;
 
 + (TestMessageSetExtension2*) defaultInstance;
 - (TestMessageSetExtension2*) defaultInstance;
@@ -204,15 +234,24 @@
 @interface TestMessageSetExtension2_Builder : PBGeneratedMessage_Builder {
 @private
   TestMessageSetExtension2* result;
+  TestMessageSetExtension2* prototype_;
 }
 
 - (TestMessageSetExtension2*) defaultInstance;
 
 - (TestMessageSetExtension2_Builder*) clear;
 - (TestMessageSetExtension2_Builder*) clone;
+- (TestMessageSetExtension2_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (TestMessageSetExtension2_Builder*) recycle:(TestMessageSetExtension2*) message;
 
 - (TestMessageSetExtension2*) build;
 - (TestMessageSetExtension2*) buildPartial;
+- (TestMessageSetExtension2*) newBuildPartial;
 
 - (TestMessageSetExtension2_Builder*) mergeFrom:(TestMessageSetExtension2*) other;
 - (TestMessageSetExtension2_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -225,10 +264,11 @@
 @end
 
 @interface RawMessageSet : PBGeneratedMessage {
-@private
-  PBAppendableArray * itemArray;
+@package
+  uint32_t hasBits_[1];
+  PBObjectArray * itemArray;
 }
-@property (readonly, retain) PBArray * item;
+@property (nonatomic, readonly, retain) PBArray * item;
 - (RawMessageSet_Item*)itemAtIndex:(NSUInteger)index;
 
 + (RawMessageSet*) defaultInstance;
@@ -250,16 +290,15 @@
 @end
 
 @interface RawMessageSet_Item : PBGeneratedMessage {
-@private
-  BOOL hasTypeId_:1;
-  BOOL hasMessage_:1;
+@package
+  uint32_t hasBits_[1];
   int32_t typeId;
   NSData* message;
 }
 - (BOOL) hasTypeId;
 - (BOOL) hasMessage;
-@property (readonly) int32_t typeId;
-@property (readonly, retain) NSData* message;
+@property (nonatomic, readonly) int32_t typeId;
+@property (nonatomic, readonly, retain) NSData* message;
 
 + (RawMessageSet_Item*) defaultInstance;
 - (RawMessageSet_Item*) defaultInstance;
@@ -282,15 +321,24 @@
 @interface RawMessageSet_Item_Builder : PBGeneratedMessage_Builder {
 @private
   RawMessageSet_Item* result;
+  RawMessageSet_Item* prototype_;
 }
 
 - (RawMessageSet_Item*) defaultInstance;
 
 - (RawMessageSet_Item_Builder*) clear;
 - (RawMessageSet_Item_Builder*) clone;
+- (RawMessageSet_Item_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (RawMessageSet_Item_Builder*) recycle:(RawMessageSet_Item*) message;
 
 - (RawMessageSet_Item*) build;
 - (RawMessageSet_Item*) buildPartial;
+- (RawMessageSet_Item*) newBuildPartial;
 
 - (RawMessageSet_Item_Builder*) mergeFrom:(RawMessageSet_Item*) other;
 - (RawMessageSet_Item_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -310,15 +358,24 @@
 @interface RawMessageSet_Builder : PBGeneratedMessage_Builder {
 @private
   RawMessageSet* result;
+  RawMessageSet* prototype_;
 }
 
 - (RawMessageSet*) defaultInstance;
 
 - (RawMessageSet_Builder*) clear;
 - (RawMessageSet_Builder*) clone;
+- (RawMessageSet_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (RawMessageSet_Builder*) recycle:(RawMessageSet*) message;
 
 - (RawMessageSet*) build;
 - (RawMessageSet*) buildPartial;
+- (RawMessageSet*) newBuildPartial;
 
 - (RawMessageSet_Builder*) mergeFrom:(RawMessageSet*) other;
 - (RawMessageSet_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
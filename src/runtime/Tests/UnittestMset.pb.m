@@ -7,6 +7,12 @@ static id<PBExtensionField> TestMessageSetExtension1_messageSetExtension = nil;
 static id<PBExtensionField> TestMessageSetExtension2_messageSetExtension = nil;
 static PBExtensionRegistry* extensionRegistry = nil;
 + (PBExtensionRegistry*) extensionRegistry {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    PBMutableExtensionRegistry* registry = [PBMutableExtensionRegistry registry];
+    [UnittestMsetRoot registerAllExtensions:registry];
+    extensionRegistry = [registry retain];
+  });
   return extensionRegistry;
 }
 
@@ -30,9 +36,6 @@ static PBExtensionRegistry* extensionRegistry = nil;
                                         isRepeated:NO
                                           isPacked:NO
                             isMessageSetWireFormat:YES] retain];
-    PBMutableExtensionRegistry* registry = [PBMutableExtensionRegistry registry];
-    [self registerAllExtensions:registry];
-    extensionRegistry = [registry retain];
   }
 }
 + (void) registerAllExtensions:(PBMutableExtensionRegistry*) registry {
@@ -42,6 +45,13 @@ static PBExtensionRegistry* extensionRegistry = nil;
 @end
 
 @interface TestMessageSet ()
+- (void) setInitialized;
+@end
+
+@interface TestMessageSet_Builder()
+@property (nonatomic, retain) TestMessageSet* result;
+- (id) initWithPrototype:(TestMessageSet*) prototype;
+- (void) detachFromPrototype;
 @end
 
 @implementation TestMessageSet
@@ -49,24 +59,28 @@ static PBExtensionRegistry* extensionRegistry = nil;
 - (void) dealloc {
   [super dealloc];
 }
-- (id) init {
-  if ((self = [super init])) {
-  }
-  return self;
+- (void) clearForReuse {
+  [super clearForReuse];
+  memset(hasBits_, 0, sizeof(hasBits_));
 }
 static TestMessageSet* defaultTestMessageSetInstance = nil;
-+ (void) initialize {
-  if (self == [TestMessageSet class]) {
-    defaultTestMessageSetInstance = [[TestMessageSet alloc] init];
-  }
-}
 + (TestMessageSet*) defaultInstance {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultTestMessageSetInstance = [[TestMessageSet alloc] init];
+  });
   return defaultTestMessageSetInstance;
 }
 - (TestMessageSet*) defaultInstance {
-  return defaultTestMessageSetInstance;
+  return [TestMessageSet defaultInstance];
+}
+- (void) setInitialized {
+  hasBits_[0] |= 0x1u;
 }
 - (BOOL) isInitialized {
+  if ((hasBits_[0] & 0x1u) != 0) {
+    return YES;
+  }
   if (!self.extensionsAreInitialized) {
     return NO;
   }
@@ -75,20 +89,20 @@ static TestMessageSet* defaultTestMessageSetInstance = nil;
 - (void) writeToCodedOutputStream:(PBCodedOutputStream*) output {
   [self writeExtensionsToCodedOutputStream:output
                                       from:4
-                                        to:536870912];
+                                        to:2147483647];
   [self.unknownFields writeAsMessageSetTo:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = PBGeneratedMessageGetMemoizedSize(&memoizedSerializedSize);
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
-  size += [self extensionsSerializedSize];
-  size += self.unknownFields.serializedSizeAsMessageSet;
-  memoizedSerializedSize = size;
-  return size;
+  size_ = 0;
+  size_ += [self extensionsSerializedSize];
+  size_ += self.unknownFields.serializedSizeAsMessageSet;
+  PBGeneratedMessageSetMemoizedSize(&memoizedSerializedSize, size_);
+  return size_;
 }
 + (TestMessageSet*) parseFromData:(NSData*) data {
   return (TestMessageSet*)[[[TestMessageSet builder] mergeFromData:data] build];
@@ -112,7 +126,7 @@ static TestMessageSet* defaultTestMessageSetInstance = nil;
   return [[[TestMessageSet_Builder alloc] init] autorelease];
 }
 + (TestMessageSet_Builder*) builderWithPrototype:(TestMessageSet*) prototype {
-  return [[TestMessageSet builder] mergeFrom:prototype];
+  return [[[TestMessageSet_Builder alloc] initWithPrototype:prototype] autorelease];
 }
 - (TestMessageSet_Builder*) builder {
   return [TestMessageSet builder];
@@ -123,7 +137,7 @@ static TestMessageSet* defaultTestMessageSetInstance = nil;
 - (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
   [self writeExtensionDescriptionToMutableString:(NSMutableString*)output
                                             from:4
-                                              to:536870912
+                                              to:2147483647
                                       withIndent:indent];
   [self.unknownFields writeDescriptionTo:output withIndent:indent];
 }
@@ -136,60 +150,132 @@ static TestMessageSet* defaultTestMessageSetInstance = nil;
   }
   TestMessageSet *otherMessage = other;
   return
-      [self isEqualExtensionsInOther:otherMessage from:4 to:536870912] &&
-      
+      [self isEqualExtensionsInOther:otherMessage from:4 to:2147483647] &&
+
       (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
 }
 - (NSUInteger) hash {
-  NSUInteger hashCode = 7;
-  hashCode = hashCode * 31 + [self hashExtensionsFrom:4 to:536870912];
-  hashCode = hashCode * 31 + [self.unknownFields hash];
-  return hashCode;
-}
-@end
+  NSUInteger hash_ = PBGeneratedMessageGetMemoizedHash(&memoizedHash);
+  if (hash_ != 0) {
+    return hash_;
+  }
 
-@interface TestMessageSet_Builder()
-@property (retain) TestMessageSet* result;
+  uint64_t hashCode = 7;
+  hashCode = PBGeneratedMessageHashMix(hashCode, [self hashExtensionsFrom:4 to:2147483647]);
+  hashCode = PBGeneratedMessageHashMix(hashCode, [self.unknownFields hash]);
+  hash_ = PBGeneratedMessageHashFinish(hashCode);
+  PBGeneratedMessageSetMemoizedHash(&memoizedHash, hash_);
+  return hash_;
+}
 @end
 
 @implementation TestMessageSet_Builder
 @synthesize result;
 - (void) dealloc {
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
   self.result = nil;
+  [prototype_ release];
   [super dealloc];
 }
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[[TestMessageSet alloc] init] autorelease];
+    result = [TestMessageSet recycledInstance];
+  }
+  return self;
+}
+- (id) initWithPrototype:(TestMessageSet*) prototype {
+  if ((self = [super init])) {
+    self.result = prototype;
+    prototype_ = [prototype retain];
   }
   return self;
 }
+- (void) detachFromPrototype {
+  TestMessageSet* prototype = prototype_;
+  prototype_ = nil;
+  self.result = [[[TestMessageSet alloc] init] autorelease];
+  [self mergeFrom:prototype];
+  [prototype release];
+}
+- (PBExtendableMessage*) internalGetMutableResult {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return [self internalGetResult];
+}
 - (PBExtendableMessage*) internalGetResult {
   return result;
 }
 - (TestMessageSet_Builder*) clear {
-  self.result = [[[TestMessageSet alloc] init] autorelease];
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = [[TestMessageSet recycledInstance] autorelease];
   return self;
 }
 - (TestMessageSet_Builder*) clone {
-  return [TestMessageSet builderWithPrototype:result];
+  if (prototype_ != nil) {
+    return [[[TestMessageSet_Builder alloc] initWithPrototype:prototype_] autorelease];
+  }
+  return [[TestMessageSet builder] mergeFrom:result];
+}
+- (TestMessageSet_Builder*) reset {
+  if (result == nil || prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    self.result = [[TestMessageSet recycledInstance] autorelease];
+  } else {
+    [result clearForReuse];
+  }
+  return self;
+}
+- (TestMessageSet_Builder*) recycle:(TestMessageSet*) message {
+  if (message == [TestMessageSet defaultInstance]) {
+    @throw [NSException exceptionWithName:@"IllegalArgument" reason:@"Cannot recycle the default instance" userInfo:nil];
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = message;
+  return [self reset];
 }
 - (TestMessageSet*) defaultInstance {
   return [TestMessageSet defaultInstance];
 }
 - (TestMessageSet*) build {
   [self checkInitialized];
-  return [self buildPartial];
+  BOOL shared = prototype_ != nil;
+  TestMessageSet* returnMe = [self buildPartial];
+  if (!shared) {
+    [returnMe setInitialized];
+  }
+  return returnMe;
 }
 - (TestMessageSet*) buildPartial {
-  TestMessageSet* returnMe = [[result retain] autorelease];
-  self.result = nil;
+  return [[self newBuildPartial] autorelease];
+}
+- (TestMessageSet*) newBuildPartial {
+  if (prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    TestMessageSet* returnMe = result;
+    result = nil;
+    return returnMe;
+  }
+  TestMessageSet* returnMe = result;
+  result = nil;
   return returnMe;
 }
 - (TestMessageSet_Builder*) mergeFrom:(TestMessageSet*) other {
   if (other == [TestMessageSet defaultInstance]) {
     return self;
   }
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
   [self mergeExtensionFields:other];
   [self mergeUnknownFields:other.unknownFields];
   return self;
@@ -198,18 +284,29 @@ static TestMessageSet* defaultTestMessageSetInstance = nil;
   return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
 }
 - (TestMessageSet_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  PBUnknownFieldSet_Builder* unknownFields = nil;
   while (YES) {
     int32_t tag = [input readTag];
     switch (tag) {
       case 0:
-        [self setUnknownFields:[unknownFields build]];
+        if (unknownFields != nil) {
+          [self setUnknownFields:[unknownFields build]];
+        }
         return self;
       default: {
-        if (![self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag]) {
-          [self setUnknownFields:[unknownFields build]];
+        if (PBWireFormatGetTagWireType(tag) == PBWireFormatEndGroup) {
+          if (unknownFields != nil) {
+            [self setUnknownFields:[unknownFields build]];
+          }
           return self;
         }
+        if (unknownFields == nil) {
+          unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+        }
+        [self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag];
         break;
       }
     }
@@ -218,67 +315,89 @@ static TestMessageSet* defaultTestMessageSetInstance = nil;
 @end
 
 @interface TestMessageSetContainer ()
-@property (retain) TestMessageSet* messageSet;
+@property (nonatomic, retain) TestMessageSet* messageSet;
+- (void) setInitialized;
+@end
+
+@interface TestMessageSetContainer_Builder()
+@property (nonatomic, retain) TestMessageSetContainer* result;
+- (id) initWithPrototype:(TestMessageSetContainer*) prototype;
+- (void) detachFromPrototype;
+- (void) freezeSubBuilders;
+- (void) dropSubBuilders;
+- (void) resetSubBuilders;
 @end
 
 @implementation TestMessageSetContainer
 
 - (BOOL) hasMessageSet {
-  return !!hasMessageSet_;
+  return (hasBits_[0] & 0x1u) != 0;
 }
-- (void) setHasMessageSet:(BOOL) value {
-  hasMessageSet_ = !!value;
+- (void) setHasMessageSet:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x1u;
+  } else {
+    hasBits_[0] &= ~0x1u;
+  }
 }
 @synthesize messageSet;
+- (TestMessageSet*) messageSet {
+  return messageSet != nil ? messageSet : [TestMessageSet defaultInstance];
+}
 - (void) dealloc {
-  self.messageSet = nil;
+  [messageSet release];
   [super dealloc];
 }
-- (id) init {
-  if ((self = [super init])) {
-    self.messageSet = [TestMessageSet defaultInstance];
-  }
-  return self;
+- (void) clearForReuse {
+  [super clearForReuse];
+  memset(hasBits_, 0, sizeof(hasBits_));
+  [messageSet release];
+  messageSet = nil;
 }
 static TestMessageSetContainer* defaultTestMessageSetContainerInstance = nil;
-+ (void) initialize {
-  if (self == [TestMessageSetContainer class]) {
-    defaultTestMessageSetContainerInstance = [[TestMessageSetContainer alloc] init];
-  }
-}
 + (TestMessageSetContainer*) defaultInstance {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultTestMessageSetContainerInstance = [[TestMessageSetContainer alloc] init];
+  });
   return defaultTestMessageSetContainerInstance;
 }
 - (TestMessageSetContainer*) defaultInstance {
-  return defaultTestMessageSetContainerInstance;
+  return [TestMessageSetContainer defaultInstance];
+}
+- (void) setInitialized {
+  hasBits_[0] |= 0x2u;
 }
 - (BOOL) isInitialized {
-  if (self.hasMessageSet) {
-    if (!self.messageSet.isInitialized) {
+  if ((hasBits_[0] & 0x2u) != 0) {
+    return YES;
+  }
+  if ((hasBits_[0] & 0x1u) != 0) {
+    if (!messageSet.isInitialized) {
       return NO;
     }
   }
   return YES;
 }
 - (void) writeToCodedOutputStream:(PBCodedOutputStream*) output {
-  if (self.hasMessageSet) {
-    [output writeMessage:1 value:self.messageSet];
+  if (hasBits_[0] & 0x1u) {
+    [output writeMessage:1 value:messageSet];
   }
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = PBGeneratedMessageGetMemoizedSize(&memoizedSerializedSize);
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
-  if (self.hasMessageSet) {
-    size += computeMessageSize(1, self.messageSet);
+  size_ = 0;
+  if (hasBits_[0] & 0x1u) {
+    size_ += computeMessageSize(1, messageSet);
   }
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
+  size_ += self.unknownFields.serializedSize;
+  PBGeneratedMessageSetMemoizedSize(&memoizedSerializedSize, size_);
+  return size_;
 }
 + (TestMessageSetContainer*) parseFromData:(NSData*) data {
   return (TestMessageSetContainer*)[[[TestMessageSetContainer builder] mergeFromData:data] build];
@@ -302,7 +421,7 @@ static TestMessageSetContainer* defaultTestMessageSetContainerInstance = nil;
   return [[[TestMessageSetContainer_Builder alloc] init] autorelease];
 }
 + (TestMessageSetContainer_Builder*) builderWithPrototype:(TestMessageSetContainer*) prototype {
-  return [[TestMessageSetContainer builder] mergeFrom:prototype];
+  return [[[TestMessageSetContainer_Builder alloc] initWithPrototype:prototype] autorelease];
 }
 - (TestMessageSetContainer_Builder*) builder {
   return [TestMessageSetContainer builder];
@@ -311,9 +430,9 @@ static TestMessageSetContainer* defaultTestMessageSetContainerInstance = nil;
   return [TestMessageSetContainer builderWithPrototype:self];
 }
 - (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
-  if (self.hasMessageSet) {
+  if (hasBits_[0] & 0x1u) {
     [output appendFormat:@"%@%@ {\n", indent, @"messageSet"];
-    [self.messageSet writeDescriptionTo:output
+    [messageSet writeDescriptionTo:output
                          withIndent:[NSString stringWithFormat:@"%@  ", indent]];
     [output appendFormat:@"%@}\n", indent];
   }
@@ -328,65 +447,165 @@ static TestMessageSetContainer* defaultTestMessageSetContainerInstance = nil;
   }
   TestMessageSetContainer *otherMessage = other;
   return
-      self.hasMessageSet == otherMessage.hasMessageSet &&
-      (!self.hasMessageSet || [self.messageSet isEqual:otherMessage.messageSet]) &&
-      
+      (hasBits_[0] & 0x1u) == (otherMessage->hasBits_[0] & 0x1u) &&
+      (!(hasBits_[0] & 0x1u) || [messageSet isEqual:otherMessage->messageSet]) &&
       (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
 }
 - (NSUInteger) hash {
-  NSUInteger hashCode = 7;
-  if (self.hasMessageSet) {
-    hashCode = hashCode * 31 + [self.messageSet hash];
+  NSUInteger hash_ = PBGeneratedMessageGetMemoizedHash(&memoizedHash);
+  if (hash_ != 0) {
+    return hash_;
   }
-  hashCode = hashCode * 31 + [self.unknownFields hash];
-  return hashCode;
-}
-@end
 
-@interface TestMessageSetContainer_Builder()
-@property (retain) TestMessageSetContainer* result;
+  uint64_t hashCode = 7;
+  if (hasBits_[0] & 0x1u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [messageSet hash]);
+  }
+  hashCode = PBGeneratedMessageHashMix(hashCode, [self.unknownFields hash]);
+  hash_ = PBGeneratedMessageHashFinish(hashCode);
+  PBGeneratedMessageSetMemoizedHash(&memoizedHash, hash_);
+  return hash_;
+}
 @end
 
 @implementation TestMessageSetContainer_Builder
 @synthesize result;
 - (void) dealloc {
+  [self dropSubBuilders];
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
   self.result = nil;
+  [prototype_ release];
   [super dealloc];
 }
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[[TestMessageSetContainer alloc] init] autorelease];
+    result = [TestMessageSetContainer recycledInstance];
+  }
+  return self;
+}
+- (id) initWithPrototype:(TestMessageSetContainer*) prototype {
+  if ((self = [super init])) {
+    self.result = prototype;
+    prototype_ = [prototype retain];
   }
   return self;
 }
+- (void) detachFromPrototype {
+  TestMessageSetContainer* prototype = prototype_;
+  prototype_ = nil;
+  self.result = [[[TestMessageSetContainer alloc] init] autorelease];
+  [self mergeFrom:prototype];
+  [prototype release];
+}
+- (PBGeneratedMessage*) internalGetMutableResult {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return [self internalGetResult];
+}
+- (void) freezeSubBuilders {
+  if (messageSetBuilder_ != nil) {
+    TestMessageSet* value = [messageSetBuilder_ newBuildPartial];
+    result.messageSet = value;
+    [value release];
+    [messageSetBuilder_ release];
+    messageSetBuilder_ = nil;
+  }
+}
+- (void) dropSubBuilders {
+  [messageSetBuilder_ release];
+  messageSetBuilder_ = nil;
+  [messageSetSpareBuilder_ release];
+  messageSetSpareBuilder_ = nil;
+}
+- (void) resetSubBuilders {
+  if (messageSetBuilder_ != nil) {
+    [messageSetBuilder_ reset];
+    [messageSetSpareBuilder_ release];
+    messageSetSpareBuilder_ = messageSetBuilder_;
+    messageSetBuilder_ = nil;
+  }
+}
 - (PBGeneratedMessage*) internalGetResult {
+  [self freezeSubBuilders];
   return result;
 }
 - (TestMessageSetContainer_Builder*) clear {
-  self.result = [[[TestMessageSetContainer alloc] init] autorelease];
+  [self dropSubBuilders];
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = [[TestMessageSetContainer recycledInstance] autorelease];
   return self;
 }
 - (TestMessageSetContainer_Builder*) clone {
-  return [TestMessageSetContainer builderWithPrototype:result];
+  if (prototype_ != nil) {
+    return [[[TestMessageSetContainer_Builder alloc] initWithPrototype:prototype_] autorelease];
+  }
+  [self freezeSubBuilders];
+  return [[TestMessageSetContainer builder] mergeFrom:result];
+}
+- (TestMessageSetContainer_Builder*) reset {
+  [self resetSubBuilders];
+  if (result == nil || prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    self.result = [[TestMessageSetContainer recycledInstance] autorelease];
+  } else {
+    [result clearForReuse];
+  }
+  return self;
+}
+- (TestMessageSetContainer_Builder*) recycle:(TestMessageSetContainer*) message {
+  if (message == [TestMessageSetContainer defaultInstance]) {
+    @throw [NSException exceptionWithName:@"IllegalArgument" reason:@"Cannot recycle the default instance" userInfo:nil];
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = message;
+  return [self reset];
 }
 - (TestMessageSetContainer*) defaultInstance {
   return [TestMessageSetContainer defaultInstance];
 }
 - (TestMessageSetContainer*) build {
   [self checkInitialized];
-  return [self buildPartial];
+  BOOL shared = prototype_ != nil;
+  TestMessageSetContainer* returnMe = [self buildPartial];
+  if (!shared) {
+    [returnMe setInitialized];
+  }
+  return returnMe;
 }
 - (TestMessageSetContainer*) buildPartial {
-  TestMessageSetContainer* returnMe = [[result retain] autorelease];
-  self.result = nil;
+  return [[self newBuildPartial] autorelease];
+}
+- (TestMessageSetContainer*) newBuildPartial {
+  if (prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    TestMessageSetContainer* returnMe = result;
+    result = nil;
+    return returnMe;
+  }
+  [self freezeSubBuilders];
+  TestMessageSetContainer* returnMe = result;
+  result = nil;
   return returnMe;
 }
 - (TestMessageSetContainer_Builder*) mergeFrom:(TestMessageSetContainer*) other {
   if (other == [TestMessageSetContainer defaultInstance]) {
     return self;
   }
-  if (other.hasMessageSet) {
-    [self mergeMessageSet:other.messageSet];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (other->hasBits_[0] & 0x1u) {
+    [self mergeMessageSet:other->messageSet];
   }
   [self mergeUnknownFields:other.unknownFields];
   return self;
@@ -395,40 +614,60 @@ static TestMessageSetContainer* defaultTestMessageSetContainerInstance = nil;
   return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
 }
 - (TestMessageSetContainer_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  PBUnknownFieldSet_Builder* unknownFields = nil;
   while (YES) {
     int32_t tag = [input readTag];
     switch (tag) {
       case 0:
-        [self setUnknownFields:[unknownFields build]];
+        if (unknownFields != nil) {
+          [self setUnknownFields:[unknownFields build]];
+        }
         return self;
       default: {
-        if (![self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag]) {
-          [self setUnknownFields:[unknownFields build]];
+        if (PBWireFormatGetTagWireType(tag) == PBWireFormatEndGroup) {
+          if (unknownFields != nil) {
+            [self setUnknownFields:[unknownFields build]];
+          }
           return self;
         }
+        if (unknownFields == nil) {
+          unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+        }
+        [self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag];
         break;
       }
       case 10: {
-        TestMessageSet_Builder* subBuilder = [TestMessageSet builder];
-        if (self.hasMessageSet) {
-          [subBuilder mergeFrom:self.messageSet];
+        if (messageSetBuilder_ == nil) {
+          messageSetBuilder_ = messageSetSpareBuilder_ != nil ? messageSetSpareBuilder_ : [[TestMessageSet_Builder alloc] init];
+          messageSetSpareBuilder_ = nil;
+          if (result->hasBits_[0] & 0x1u) {
+            [messageSetBuilder_ mergeFrom:result->messageSet];
+          }
+          result->hasBits_[0] |= 0x1u;
         }
-        [input readMessage:subBuilder extensionRegistry:extensionRegistry];
-        [self setMessageSet:[subBuilder buildPartial]];
+        [input readMessage:messageSetBuilder_ extensionRegistry:extensionRegistry];
         break;
       }
     }
   }
 }
 - (BOOL) hasMessageSet {
-  return result.hasMessageSet;
+  return (result->hasBits_[0] & 0x1u) != 0;
 }
 - (TestMessageSet*) messageSet {
+  [self freezeSubBuilders];
   return result.messageSet;
 }
 - (TestMessageSetContainer_Builder*) setMessageSet:(TestMessageSet*) value {
-  result.hasMessageSet = YES;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  [messageSetBuilder_ release];
+  messageSetBuilder_ = nil;
+  result->hasBits_[0] |= 0x1u;
   result.messageSet = value;
   return self;
 }
@@ -436,82 +675,103 @@ static TestMessageSetContainer* defaultTestMessageSetContainerInstance = nil;
   return [self setMessageSet:[builderForValue build]];
 }
 - (TestMessageSetContainer_Builder*) mergeMessageSet:(TestMessageSet*) value {
-  if (result.hasMessageSet &&
-      result.messageSet != [TestMessageSet defaultInstance]) {
-    result.messageSet =
-      [[[TestMessageSet builderWithPrototype:result.messageSet] mergeFrom:value] buildPartial];
-  } else {
-    result.messageSet = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (messageSetBuilder_ == nil) {
+    if (!(result->hasBits_[0] & 0x1u) ||
+        result->messageSet == [TestMessageSet defaultInstance]) {
+      result->hasBits_[0] |= 0x1u;
+      result.messageSet = value;
+      return self;
+    }
+    messageSetBuilder_ = messageSetSpareBuilder_ != nil ? messageSetSpareBuilder_ : [[TestMessageSet_Builder alloc] init];
+    messageSetSpareBuilder_ = nil;
+    [messageSetBuilder_ mergeFrom:result->messageSet];
   }
-  result.hasMessageSet = YES;
+  [messageSetBuilder_ mergeFrom:value];
   return self;
 }
 - (TestMessageSetContainer_Builder*) clearMessageSet {
-  result.hasMessageSet = NO;
-  result.messageSet = [TestMessageSet defaultInstance];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  [messageSetBuilder_ release];
+  messageSetBuilder_ = nil;
+  result->hasBits_[0] &= ~0x1u;
+  [result->messageSet release];
+  result->messageSet = nil;
   return self;
 }
 @end
 
 @interface TestMessageSetExtension1 ()
-@property int32_t i;
+@property (nonatomic) int32_t i;
+@end
+
+@interface TestMessageSetExtension1_Builder()
+@property (nonatomic, retain) TestMessageSetExtension1* result;
+- (id) initWithPrototype:(TestMessageSetExtension1*) prototype;
+- (void) detachFromPrototype;
 @end
 
 @implementation TestMessageSetExtension1
 
 - (BOOL) hasI {
-  return !!hasI_;
+  return (hasBits_[0] & 0x1u) != 0;
 }
-- (void) setHasI:(BOOL) value {
-  hasI_ = !!value;
+- (void) setHasI:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x1u;
+  } else {
+    hasBits_[0] &= ~0x1u;
+  }
 }
 @synthesize i;
 - (void) dealloc {
   [super dealloc];
 }
-- (id) init {
-  if ((self = [super init])) {
-    self.i = 0;
-  }
-  return self;
+- (void) clearForReuse {
+  [super clearForReuse];
+  memset(hasBits_, 0, sizeof(hasBits_));
+  i = 0;
 }
 + (id<PBExtensionField>) messageSetExtension {
   return TestMessageSetExtension1_messageSetExtension;
 }
 static TestMessageSetExtension1* defaultTestMessageSetExtension1Instance = nil;
-+ (void) initialize {
-  if (self == [TestMessageSetExtension1 class]) {
-    defaultTestMessageSetExtension1Instance = [[TestMessageSetExtension1 alloc] init];
-  }
-}
 + (TestMessageSetExtension1*) defaultInstance {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultTestMessageSetExtension1Instance = [[TestMessageSetExtension1 alloc] init];
+  });
   return defaultTestMessageSetExtension1Instance;
 }
 - (TestMessageSetExtension1*) defaultInstance {
-  return defaultTestMessageSetExtension1Instance;
+  return [TestMessageSetExtension1 defaultInstance];
 }
 - (BOOL) isInitialized {
   return YES;
 }
 - (void) writeToCodedOutputStream:(PBCodedOutputStream*) output {
-  if (self.hasI) {
-    [output writeInt32:15 value:self.i];
+  if (hasBits_[0] & 0x1u) {
+    [output writeInt32:15 value:i];
   }
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = PBGeneratedMessageGetMemoizedSize(&memoizedSerializedSize);
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
-  if (self.hasI) {
-    size += computeInt32Size(15, self.i);
+  size_ = 0;
+  if (hasBits_[0] & 0x1u) {
+    size_ += computeInt32Size(15, i);
   }
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
+  size_ += self.unknownFields.serializedSize;
+  PBGeneratedMessageSetMemoizedSize(&memoizedSerializedSize, size_);
+  return size_;
 }
 + (TestMessageSetExtension1*) parseFromData:(NSData*) data {
   return (TestMessageSetExtension1*)[[[TestMessageSetExtension1 builder] mergeFromData:data] build];
@@ -535,7 +795,7 @@ static TestMessageSetExtension1* defaultTestMessageSetExtension1Instance = nil;
   return [[[TestMessageSetExtension1_Builder alloc] init] autorelease];
 }
 + (TestMessageSetExtension1_Builder*) builderWithPrototype:(TestMessageSetExtension1*) prototype {
-  return [[TestMessageSetExtension1 builder] mergeFrom:prototype];
+  return [[[TestMessageSetExtension1_Builder alloc] initWithPrototype:prototype] autorelease];
 }
 - (TestMessageSetExtension1_Builder*) builder {
   return [TestMessageSetExtension1 builder];
@@ -544,8 +804,8 @@ static TestMessageSetExtension1* defaultTestMessageSetExtension1Instance = nil;
   return [TestMessageSetExtension1 builderWithPrototype:self];
 }
 - (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
-  if (self.hasI) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"i", [NSNumber numberWithInt:self.i]];
+  if (hasBits_[0] & 0x1u) {
+    [output appendFormat:@"%@%@: %@\n", indent, @"i", [NSNumber numberWithInt:i]];
   }
   [self.unknownFields writeDescriptionTo:output withIndent:indent];
 }
@@ -558,46 +818,99 @@ static TestMessageSetExtension1* defaultTestMessageSetExtension1Instance = nil;
   }
   TestMessageSetExtension1 *otherMessage = other;
   return
-      self.hasI == otherMessage.hasI &&
-      (!self.hasI || self.i == otherMessage.i) &&
-      
+      (hasBits_[0] & 0x1u) == (otherMessage->hasBits_[0] & 0x1u) &&
+      (!(hasBits_[0] & 0x1u) || i == otherMessage->i) &&
       (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
 }
 - (NSUInteger) hash {
-  NSUInteger hashCode = 7;
-  if (self.hasI) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithInt:self.i] hash];
+  NSUInteger hash_ = PBGeneratedMessageGetMemoizedHash(&memoizedHash);
+  if (hash_ != 0) {
+    return hash_;
   }
-  hashCode = hashCode * 31 + [self.unknownFields hash];
-  return hashCode;
-}
-@end
 
-@interface TestMessageSetExtension1_Builder()
-@property (retain) TestMessageSetExtension1* result;
+  uint64_t hashCode = 7;
+  if (hasBits_[0] & 0x1u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, (uint64_t)i);
+  }
+  hashCode = PBGeneratedMessageHashMix(hashCode, [self.unknownFields hash]);
+  hash_ = PBGeneratedMessageHashFinish(hashCode);
+  PBGeneratedMessageSetMemoizedHash(&memoizedHash, hash_);
+  return hash_;
+}
 @end
 
 @implementation TestMessageSetExtension1_Builder
 @synthesize result;
 - (void) dealloc {
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
   self.result = nil;
+  [prototype_ release];
   [super dealloc];
 }
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[[TestMessageSetExtension1 alloc] init] autorelease];
+    result = [TestMessageSetExtension1 recycledInstance];
+  }
+  return self;
+}
+- (id) initWithPrototype:(TestMessageSetExtension1*) prototype {
+  if ((self = [super init])) {
+    self.result = prototype;
+    prototype_ = [prototype retain];
   }
   return self;
 }
+- (void) detachFromPrototype {
+  TestMessageSetExtension1* prototype = prototype_;
+  prototype_ = nil;
+  self.result = [[[TestMessageSetExtension1 alloc] init] autorelease];
+  [self mergeFrom:prototype];
+  [prototype release];
+}
+- (PBGeneratedMessage*) internalGetMutableResult {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return [self internalGetResult];
+}
 - (PBGeneratedMessage*) internalGetResult {
   return result;
 }
 - (TestMessageSetExtension1_Builder*) clear {
-  self.result = [[[TestMessageSetExtension1 alloc] init] autorelease];
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = [[TestMessageSetExtension1 recycledInstance] autorelease];
   return self;
 }
 - (TestMessageSetExtension1_Builder*) clone {
-  return [TestMessageSetExtension1 builderWithPrototype:result];
+  if (prototype_ != nil) {
+    return [[[TestMessageSetExtension1_Builder alloc] initWithPrototype:prototype_] autorelease];
+  }
+  return [[TestMessageSetExtension1 builder] mergeFrom:result];
+}
+- (TestMessageSetExtension1_Builder*) reset {
+  if (result == nil || prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    self.result = [[TestMessageSetExtension1 recycledInstance] autorelease];
+  } else {
+    [result clearForReuse];
+  }
+  return self;
+}
+- (TestMessageSetExtension1_Builder*) recycle:(TestMessageSetExtension1*) message {
+  if (message == [TestMessageSetExtension1 defaultInstance]) {
+    @throw [NSException exceptionWithName:@"IllegalArgument" reason:@"Cannot recycle the default instance" userInfo:nil];
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = message;
+  return [self reset];
 }
 - (TestMessageSetExtension1*) defaultInstance {
   return [TestMessageSetExtension1 defaultInstance];
@@ -607,16 +920,29 @@ static TestMessageSetExtension1* defaultTestMessageSetExtension1Instance = nil;
   return [self buildPartial];
 }
 - (TestMessageSetExtension1*) buildPartial {
-  TestMessageSetExtension1* returnMe = [[result retain] autorelease];
-  self.result = nil;
+  return [[self newBuildPartial] autorelease];
+}
+- (TestMessageSetExtension1*) newBuildPartial {
+  if (prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    TestMessageSetExtension1* returnMe = result;
+    result = nil;
+    return returnMe;
+  }
+  TestMessageSetExtension1* returnMe = result;
+  result = nil;
   return returnMe;
 }
 - (TestMessageSetExtension1_Builder*) mergeFrom:(TestMessageSetExtension1*) other {
   if (other == [TestMessageSetExtension1 defaultInstance]) {
     return self;
   }
-  if (other.hasI) {
-    [self setI:other.i];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (other->hasBits_[0] & 0x1u) {
+    [self setI:other->i];
   }
   [self mergeUnknownFields:other.unknownFields];
   return self;
@@ -625,18 +951,29 @@ static TestMessageSetExtension1* defaultTestMessageSetExtension1Instance = nil;
   return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
 }
 - (TestMessageSetExtension1_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  PBUnknownFieldSet_Builder* unknownFields = nil;
   while (YES) {
     int32_t tag = [input readTag];
     switch (tag) {
       case 0:
-        [self setUnknownFields:[unknownFields build]];
+        if (unknownFields != nil) {
+          [self setUnknownFields:[unknownFields build]];
+        }
         return self;
       default: {
-        if (![self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag]) {
-          [self setUnknownFields:[unknownFields build]];
+        if (PBWireFormatGetTagWireType(tag) == PBWireFormatEndGroup) {
+          if (unknownFields != nil) {
+            [self setUnknownFields:[unknownFields build]];
+          }
           return self;
         }
+        if (unknownFields == nil) {
+          unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+        }
+        [self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag];
         break;
       }
       case 120: {
@@ -647,83 +984,101 @@ static TestMessageSetExtension1* defaultTestMessageSetExtension1Instance = nil;
   }
 }
 - (BOOL) hasI {
-  return result.hasI;
+  return (result->hasBits_[0] & 0x1u) != 0;
 }
 - (int32_t) i {
-  return result.i;
+  return result->i;
 }
 - (TestMessageSetExtension1_Builder*) setI:(int32_t) value {
-  result.hasI = YES;
-  result.i = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x1u;
+  result->i = value;
   return self;
 }
 - (TestMessageSetExtension1_Builder*) clearI {
-  result.hasI = NO;
-  result.i = 0;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x1u;
+  result->i = 0;
   return self;
 }
 @end
 
 @interface TestMessageSetExtension2 ()
-@property (retain) NSString* str;
+@property (nonatomic, retain) NSString* str;
+@end
+
+@interface TestMessageSetExtension2_Builder()
+@property (nonatomic, retain) TestMessageSetExtension2* result;
+- (id) initWithPrototype:(TestMessageSetExtension2*) prototype;
+- (void) detachFromPrototype;
 @end
 
 @implementation TestMessageSetExtension2
 
 - (BOOL) hasStr {
-  return !!hasStr_;
+  return (hasBits_[0] & 0x1u) != 0;
 }
-- (void) setHasStr:(BOOL) value {
-  hasStr_ = !!value;
+- (void) setHasStr:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x1u;
+  } else {
+    hasBits_[0] &= ~0x1u;
+  }
 }
 @synthesize str;
+- (NSString*) str {
+  return (hasBits_[0] & 0x1u) ? str : @"";
+}
 - (void) dealloc {
-  self.str = nil;
+  [str release];
   [super dealloc];
 }
-- (id) init {
-  if ((self = [super init])) {
-    self.str = @"";
-  }
-  return self;
+- (void) clearForReuse {
+  [super clearForReuse];
+  memset(hasBits_, 0, sizeof(hasBits_));
+  [str release];
+  str = nil;
 }
 + (id<PBExtensionField>) messageSetExtension {
   return TestMessageSetExtension2_messageSetExtension;
 }
 static TestMessageSetExtension2* defaultTestMessageSetExtension2Instance = nil;
-+ (void) initialize {
-  if (self == [TestMessageSetExtension2 class]) {
-    defaultTestMessageSetExtension2Instance = [[TestMessageSetExtension2 alloc] init];
-  }
-}
 + (TestMessageSetExtension2*) defaultInstance {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultTestMessageSetExtension2Instance = [[TestMessageSetExtension2 alloc] init];
+  });
   return defaultTestMessageSetExtension2Instance;
 }
 - (TestMessageSetExtension2*) defaultInstance {
-  return defaultTestMessageSetExtension2Instance;
+  return [TestMessageSetExtension2 defaultInstance];
 }
 - (BOOL) isInitialized {
   return YES;
 }
 - (void) writeToCodedOutputStream:(PBCodedOutputStream*) output {
-  if (self.hasStr) {
-    [output writeString:25 value:self.str];
+  if (hasBits_[0] & 0x1u) {
+    [output writeString:25 value:str];
   }
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = PBGeneratedMessageGetMemoizedSize(&memoizedSerializedSize);
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
-  if (self.hasStr) {
-    size += computeStringSize(25, self.str);
+  size_ = 0;
+  if (hasBits_[0] & 0x1u) {
+    size_ += computeStringSize(25, str);
   }
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
+  size_ += self.unknownFields.serializedSize;
+  PBGeneratedMessageSetMemoizedSize(&memoizedSerializedSize, size_);
+  return size_;
 }
 + (TestMessageSetExtension2*) parseFromData:(NSData*) data {
   return (TestMessageSetExtension2*)[[[TestMessageSetExtension2 builder] mergeFromData:data] build];
@@ -747,7 +1102,7 @@ static TestMessageSetExtension2* defaultTestMessageSetExtension2Instance = nil;
   return [[[TestMessageSetExtension2_Builder alloc] init] autorelease];
 }
 + (TestMessageSetExtension2_Builder*) builderWithPrototype:(TestMessageSetExtension2*) prototype {
-  return [[TestMessageSetExtension2 builder] mergeFrom:prototype];
+  return [[[TestMessageSetExtension2_Builder alloc] initWithPrototype:prototype] autorelease];
 }
 - (TestMessageSetExtension2_Builder*) builder {
   return [TestMessageSetExtension2 builder];
@@ -756,8 +1111,8 @@ static TestMessageSetExtension2* defaultTestMessageSetExtension2Instance = nil;
   return [TestMessageSetExtension2 builderWithPrototype:self];
 }
 - (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
-  if (self.hasStr) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"str", self.str];
+  if (hasBits_[0] & 0x1u) {
+    [output appendFormat:@"%@%@: %@\n", indent, @"str", str];
   }
   [self.unknownFields writeDescriptionTo:output withIndent:indent];
 }
@@ -770,46 +1125,99 @@ static TestMessageSetExtension2* defaultTestMessageSetExtension2Instance = nil;
   }
   TestMessageSetExtension2 *otherMessage = other;
   return
-      self.hasStr == otherMessage.hasStr &&
-      (!self.hasStr || [self.str isEqual:otherMessage.str]) &&
-      
+      (hasBits_[0] & 0x1u) == (otherMessage->hasBits_[0] & 0x1u) &&
+      (!(hasBits_[0] & 0x1u) || [str isEqual:otherMessage->str]) &&
       (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
 }
 - (NSUInteger) hash {
-  NSUInteger hashCode = 7;
-  if (self.hasStr) {
-    hashCode = hashCode * 31 + [self.str hash];
+  NSUInteger hash_ = PBGeneratedMessageGetMemoizedHash(&memoizedHash);
+  if (hash_ != 0) {
+    return hash_;
   }
-  hashCode = hashCode * 31 + [self.unknownFields hash];
-  return hashCode;
-}
-@end
 
-@interface TestMessageSetExtension2_Builder()
-@property (retain) TestMessageSetExtension2* result;
+  uint64_t hashCode = 7;
+  if (hasBits_[0] & 0x1u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [str hash]);
+  }
+  hashCode = PBGeneratedMessageHashMix(hashCode, [self.unknownFields hash]);
+  hash_ = PBGeneratedMessageHashFinish(hashCode);
+  PBGeneratedMessageSetMemoizedHash(&memoizedHash, hash_);
+  return hash_;
+}
 @end
 
 @implementation TestMessageSetExtension2_Builder
 @synthesize result;
 - (void) dealloc {
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
   self.result = nil;
+  [prototype_ release];
   [super dealloc];
 }
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[[TestMessageSetExtension2 alloc] init] autorelease];
+    result = [TestMessageSetExtension2 recycledInstance];
+  }
+  return self;
+}
+- (id) initWithPrototype:(TestMessageSetExtension2*) prototype {
+  if ((self = [super init])) {
+    self.result = prototype;
+    prototype_ = [prototype retain];
   }
   return self;
 }
+- (void) detachFromPrototype {
+  TestMessageSetExtension2* prototype = prototype_;
+  prototype_ = nil;
+  self.result = [[[TestMessageSetExtension2 alloc] init] autorelease];
+  [self mergeFrom:prototype];
+  [prototype release];
+}
+- (PBGeneratedMessage*) internalGetMutableResult {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return [self internalGetResult];
+}
 - (PBGeneratedMessage*) internalGetResult {
   return result;
 }
 - (TestMessageSetExtension2_Builder*) clear {
-  self.result = [[[TestMessageSetExtension2 alloc] init] autorelease];
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = [[TestMessageSetExtension2 recycledInstance] autorelease];
   return self;
 }
 - (TestMessageSetExtension2_Builder*) clone {
-  return [TestMessageSetExtension2 builderWithPrototype:result];
+  if (prototype_ != nil) {
+    return [[[TestMessageSetExtension2_Builder alloc] initWithPrototype:prototype_] autorelease];
+  }
+  return [[TestMessageSetExtension2 builder] mergeFrom:result];
+}
+- (TestMessageSetExtension2_Builder*) reset {
+  if (result == nil || prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    self.result = [[TestMessageSetExtension2 recycledInstance] autorelease];
+  } else {
+    [result clearForReuse];
+  }
+  return self;
+}
+- (TestMessageSetExtension2_Builder*) recycle:(TestMessageSetExtension2*) message {
+  if (message == [TestMessageSetExtension2 defaultInstance]) {
+    @throw [NSException exceptionWithName:@"IllegalArgument" reason:@"Cannot recycle the default instance" userInfo:nil];
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = message;
+  return [self reset];
 }
 - (TestMessageSetExtension2*) defaultInstance {
   return [TestMessageSetExtension2 defaultInstance];
@@ -819,16 +1227,29 @@ static TestMessageSetExtension2* defaultTestMessageSetExtension2Instance = nil;
   return [self buildPartial];
 }
 - (TestMessageSetExtension2*) buildPartial {
-  TestMessageSetExtension2* returnMe = [[result retain] autorelease];
-  self.result = nil;
+  return [[self newBuildPartial] autorelease];
+}
+- (TestMessageSetExtension2*) newBuildPartial {
+  if (prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    TestMessageSetExtension2* returnMe = result;
+    result = nil;
+    return returnMe;
+  }
+  TestMessageSetExtension2* returnMe = result;
+  result = nil;
   return returnMe;
 }
 - (TestMessageSetExtension2_Builder*) mergeFrom:(TestMessageSetExtension2*) other {
   if (other == [TestMessageSetExtension2 defaultInstance]) {
     return self;
   }
-  if (other.hasStr) {
-    [self setStr:other.str];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (other->hasBits_[0] & 0x1u) {
+    [self setStr:other->str];
   }
   [self mergeUnknownFields:other.unknownFields];
   return self;
@@ -837,47 +1258,74 @@ static TestMessageSetExtension2* defaultTestMessageSetExtension2Instance = nil;
   return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
 }
 - (TestMessageSetExtension2_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  PBUnknownFieldSet_Builder* unknownFields = nil;
   while (YES) {
     int32_t tag = [input readTag];
     switch (tag) {
       case 0:
-        [self setUnknownFields:[unknownFields build]];
+        if (unknownFields != nil) {
+          [self setUnknownFields:[unknownFields build]];
+        }
         return self;
       default: {
-        if (![self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag]) {
-          [self setUnknownFields:[unknownFields build]];
+        if (PBWireFormatGetTagWireType(tag) == PBWireFormatEndGroup) {
+          if (unknownFields != nil) {
+            [self setUnknownFields:[unknownFields build]];
+          }
           return self;
         }
+        if (unknownFields == nil) {
+          unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+        }
+        [self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag];
         break;
       }
       case 202: {
-        [self setStr:[input readString]];
+        NSString* value = [input newString];
+        [self setStr:value];
+        [value release];
         break;
       }
     }
   }
 }
 - (BOOL) hasStr {
-  return result.hasStr;
+  return (result->hasBits_[0] & 0x1u) != 0;
 }
 - (NSString*) str {
-  return result.str;
+  return [result str];
 }
 - (TestMessageSetExtension2_Builder*) setStr:(NSString*) value {
-  result.hasStr = YES;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x1u;
   result.str = value;
   return self;
 }
 - (TestMessageSetExtension2_Builder*) clearStr {
-  result.hasStr = NO;
-  result.str = @"";
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x1u;
+  [result->str release];
+  result->str = nil;
   return self;
 }
 @end
 
 @interface RawMessageSet ()
-@property (retain) PBAppendableArray * itemArray;
+@property (nonatomic, retain) PBObjectArray * itemArray;
+- (void) setInitialized;
+@end
+
+@interface RawMessageSet_Builder()
+@property (nonatomic, retain) RawMessageSet* result;
+- (id) initWithPrototype:(RawMessageSet*) prototype;
+- (void) detachFromPrototype;
 @end
 
 @implementation RawMessageSet
@@ -885,34 +1333,39 @@ static TestMessageSetExtension2* defaultTestMessageSetExtension2Instance = nil;
 @synthesize itemArray;
 @dynamic item;
 - (void) dealloc {
-  self.itemArray = nil;
+  [itemArray release];
   [super dealloc];
 }
-- (id) init {
-  if ((self = [super init])) {
-  }
-  return self;
+- (void) clearForReuse {
+  [super clearForReuse];
+  memset(hasBits_, 0, sizeof(hasBits_));
+  itemArray = PBAppendableArrayReuse(itemArray);
 }
 static RawMessageSet* defaultRawMessageSetInstance = nil;
-+ (void) initialize {
-  if (self == [RawMessageSet class]) {
-    defaultRawMessageSetInstance = [[RawMessageSet alloc] init];
-  }
-}
 + (RawMessageSet*) defaultInstance {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultRawMessageSetInstance = [[RawMessageSet alloc] init];
+  });
   return defaultRawMessageSetInstance;
 }
 - (RawMessageSet*) defaultInstance {
-  return defaultRawMessageSetInstance;
+  return [RawMessageSet defaultInstance];
 }
 - (PBArray *)item {
   return itemArray;
 }
 - (RawMessageSet_Item*)itemAtIndex:(NSUInteger)index {
-  return [itemArray objectAtIndex:index];
+  return PBObjectArrayValueAtIndex(itemArray, index);
+}
+- (void) setInitialized {
+  hasBits_[0] |= 0x1u;
 }
 - (BOOL) isInitialized {
-  for (RawMessageSet_Item* element in self.item) {
+  if ((hasBits_[0] & 0x1u) != 0) {
+    return YES;
+  }
+  for (RawMessageSet_Item* element in itemArray) {
     if (!element.isInitialized) {
       return NO;
     }
@@ -920,24 +1373,24 @@ static RawMessageSet* defaultRawMessageSetInstance = nil;
   return YES;
 }
 - (void) writeToCodedOutputStream:(PBCodedOutputStream*) output {
-  for (RawMessageSet_Item *element in self.itemArray) {
+  for (RawMessageSet_Item *element in itemArray) {
     [output writeGroup:1 value:element];
   }
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = PBGeneratedMessageGetMemoizedSize(&memoizedSerializedSize);
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
-  for (RawMessageSet_Item *element in self.itemArray) {
-    size += computeGroupSize(1, element);
+  size_ = 0;
+  for (RawMessageSet_Item *element in itemArray) {
+    size_ += computeGroupSize(1, element);
   }
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
+  size_ += self.unknownFields.serializedSize;
+  PBGeneratedMessageSetMemoizedSize(&memoizedSerializedSize, size_);
+  return size_;
 }
 + (RawMessageSet*) parseFromData:(NSData*) data {
   return (RawMessageSet*)[[[RawMessageSet builder] mergeFromData:data] build];
@@ -961,7 +1414,7 @@ static RawMessageSet* defaultRawMessageSetInstance = nil;
   return [[[RawMessageSet_Builder alloc] init] autorelease];
 }
 + (RawMessageSet_Builder*) builderWithPrototype:(RawMessageSet*) prototype {
-  return [[RawMessageSet builder] mergeFrom:prototype];
+  return [[[RawMessageSet_Builder alloc] initWithPrototype:prototype] autorelease];
 }
 - (RawMessageSet_Builder*) builder {
   return [RawMessageSet builder];
@@ -970,7 +1423,7 @@ static RawMessageSet* defaultRawMessageSetInstance = nil;
   return [RawMessageSet builderWithPrototype:self];
 }
 - (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
-  for (RawMessageSet_Item* element in self.itemArray) {
+  for (RawMessageSet_Item* element in itemArray) {
     [output appendFormat:@"%@%@ {\n", indent, @"item"];
     [element writeDescriptionTo:output
                      withIndent:[NSString stringWithFormat:@"%@  ", indent]];
@@ -987,98 +1440,132 @@ static RawMessageSet* defaultRawMessageSetInstance = nil;
   }
   RawMessageSet *otherMessage = other;
   return
-      [self.itemArray isEqualToArray:otherMessage.itemArray] &&
-      
+      (itemArray.count == 0 ? otherMessage->itemArray.count == 0 : [itemArray isEqualToArray:otherMessage->itemArray]) &&
       (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
 }
 - (NSUInteger) hash {
-  NSUInteger hashCode = 7;
-  for (RawMessageSet_Item* element in self.itemArray) {
-    hashCode = hashCode * 31 + [element hash];
+  NSUInteger hash_ = PBGeneratedMessageGetMemoizedHash(&memoizedHash);
+  if (hash_ != 0) {
+    return hash_;
+  }
+
+  uint64_t hashCode = 7;
+  for (RawMessageSet_Item* element in itemArray) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [element hash]);
   }
-  hashCode = hashCode * 31 + [self.unknownFields hash];
-  return hashCode;
+  hashCode = PBGeneratedMessageHashMix(hashCode, [self.unknownFields hash]);
+  hash_ = PBGeneratedMessageHashFinish(hashCode);
+  PBGeneratedMessageSetMemoizedHash(&memoizedHash, hash_);
+  return hash_;
 }
 @end
 
 @interface RawMessageSet_Item ()
-@property int32_t typeId;
-@property (retain) NSData* message;
+@property (nonatomic) int32_t typeId;
+@property (nonatomic, retain) NSData* message;
+- (void) setInitialized;
+@end
+
+@interface RawMessageSet_Item_Builder()
+@property (nonatomic, retain) RawMessageSet_Item* result;
+- (id) initWithPrototype:(RawMessageSet_Item*) prototype;
+- (void) detachFromPrototype;
 @end
 
 @implementation RawMessageSet_Item
 
 - (BOOL) hasTypeId {
-  return !!hasTypeId_;
+  return (hasBits_[0] & 0x1u) != 0;
 }
-- (void) setHasTypeId:(BOOL) value {
-  hasTypeId_ = !!value;
+- (void) setHasTypeId:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x1u;
+  } else {
+    hasBits_[0] &= ~0x1u;
+  }
 }
 @synthesize typeId;
 - (BOOL) hasMessage {
-  return !!hasMessage_;
+  return (hasBits_[0] & 0x2u) != 0;
 }
-- (void) setHasMessage:(BOOL) value {
-  hasMessage_ = !!value;
+- (void) setHasMessage:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x2u;
+  } else {
+    hasBits_[0] &= ~0x2u;
+  }
 }
 @synthesize message;
+- (NSData*) message {
+  if (hasBits_[0] & 0x2u) {
+    return message;
+  }
+  static NSData* defaultValue = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultValue = [[NSData data] retain];
+  });
+  return defaultValue;
+}
 - (void) dealloc {
-  self.message = nil;
+  [message release];
   [super dealloc];
 }
-- (id) init {
-  if ((self = [super init])) {
-    self.typeId = 0;
-    self.message = [NSData data];
-  }
-  return self;
+- (void) clearForReuse {
+  [super clearForReuse];
+  memset(hasBits_, 0, sizeof(hasBits_));
+  typeId = 0;
+  [message release];
+  message = nil;
 }
 static RawMessageSet_Item* defaultRawMessageSet_ItemInstance = nil;
-+ (void) initialize {
-  if (self == [RawMessageSet_Item class]) {
-    defaultRawMessageSet_ItemInstance = [[RawMessageSet_Item alloc] init];
-  }
-}
 + (RawMessageSet_Item*) defaultInstance {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultRawMessageSet_ItemInstance = [[RawMessageSet_Item alloc] init];
+  });
   return defaultRawMessageSet_ItemInstance;
 }
 - (RawMessageSet_Item*) defaultInstance {
-  return defaultRawMessageSet_ItemInstance;
+  return [RawMessageSet_Item defaultInstance];
+}
+- (void) setInitialized {
+  hasBits_[0] |= 0x4u;
 }
 - (BOOL) isInitialized {
-  if (!self.hasTypeId) {
-    return NO;
+  if ((hasBits_[0] & 0x4u) != 0) {
+    return YES;
   }
-  if (!self.hasMessage) {
+  if ((hasBits_[0] & 0x3u) != 0x3u) {
     return NO;
   }
   return YES;
 }
 - (void) writeToCodedOutputStream:(PBCodedOutputStream*) output {
-  if (self.hasTypeId) {
-    [output writeInt32:2 value:self.typeId];
+  if (hasBits_[0] & 0x1u) {
+    [output writeInt32:2 value:typeId];
   }
-  if (self.hasMessage) {
-    [output writeData:3 value:self.message];
+  if (hasBits_[0] & 0x2u) {
+    [output writeData:3 value:message];
   }
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = PBGeneratedMessageGetMemoizedSize(&memoizedSerializedSize);
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
-  if (self.hasTypeId) {
-    size += computeInt32Size(2, self.typeId);
+  size_ = 0;
+  if (hasBits_[0] & 0x1u) {
+    size_ += computeInt32Size(2, typeId);
   }
-  if (self.hasMessage) {
-    size += computeDataSize(3, self.message);
+  if (hasBits_[0] & 0x2u) {
+    size_ += computeDataSize(3, message);
   }
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
+  size_ += self.unknownFields.serializedSize;
+  PBGeneratedMessageSetMemoizedSize(&memoizedSerializedSize, size_);
+  return size_;
 }
 + (RawMessageSet_Item*) parseFromData:(NSData*) data {
   return (RawMessageSet_Item*)[[[RawMessageSet_Item builder] mergeFromData:data] build];
@@ -1102,7 +1589,7 @@ static RawMessageSet_Item* defaultRawMessageSet_ItemInstance = nil;
   return [[[RawMessageSet_Item_Builder alloc] init] autorelease];
 }
 + (RawMessageSet_Item_Builder*) builderWithPrototype:(RawMessageSet_Item*) prototype {
-  return [[RawMessageSet_Item builder] mergeFrom:prototype];
+  return [[[RawMessageSet_Item_Builder alloc] initWithPrototype:prototype] autorelease];
 }
 - (RawMessageSet_Item_Builder*) builder {
   return [RawMessageSet_Item builder];
@@ -1111,11 +1598,11 @@ static RawMessageSet_Item* defaultRawMessageSet_ItemInstance = nil;
   return [RawMessageSet_Item builderWithPrototype:self];
 }
 - (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
-  if (self.hasTypeId) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"typeId", [NSNumber numberWithInt:self.typeId]];
+  if (hasBits_[0] & 0x1u) {
+    [output appendFormat:@"%@%@: %@\n", indent, @"typeId", [NSNumber numberWithInt:typeId]];
   }
-  if (self.hasMessage) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"message", self.message];
+  if (hasBits_[0] & 0x2u) {
+    [output appendFormat:@"%@%@: %@\n", indent, @"message", message];
   }
   [self.unknownFields writeDescriptionTo:output withIndent:indent];
 }
@@ -1128,74 +1615,144 @@ static RawMessageSet_Item* defaultRawMessageSet_ItemInstance = nil;
   }
   RawMessageSet_Item *otherMessage = other;
   return
-      self.hasTypeId == otherMessage.hasTypeId &&
-      (!self.hasTypeId || self.typeId == otherMessage.typeId) &&
-      
-      self.hasMessage == otherMessage.hasMessage &&
-      (!self.hasMessage || [self.message isEqual:otherMessage.message]) &&
-      
+      (hasBits_[0] & 0x1u) == (otherMessage->hasBits_[0] & 0x1u) &&
+      (!(hasBits_[0] & 0x1u) || typeId == otherMessage->typeId) &&
+      (hasBits_[0] & 0x2u) == (otherMessage->hasBits_[0] & 0x2u) &&
+      (!(hasBits_[0] & 0x2u) || [message isEqual:otherMessage->message]) &&
       (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
 }
 - (NSUInteger) hash {
-  NSUInteger hashCode = 7;
-  if (self.hasTypeId) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithInt:self.typeId] hash];
+  NSUInteger hash_ = PBGeneratedMessageGetMemoizedHash(&memoizedHash);
+  if (hash_ != 0) {
+    return hash_;
+  }
+
+  uint64_t hashCode = 7;
+  if (hasBits_[0] & 0x1u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, (uint64_t)typeId);
   }
-  if (self.hasMessage) {
-    hashCode = hashCode * 31 + [self.message hash];
+  if (hasBits_[0] & 0x2u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [message hash]);
   }
-  hashCode = hashCode * 31 + [self.unknownFields hash];
-  return hashCode;
+  hashCode = PBGeneratedMessageHashMix(hashCode, [self.unknownFields hash]);
+  hash_ = PBGeneratedMessageHashFinish(hashCode);
+  PBGeneratedMessageSetMemoizedHash(&memoizedHash, hash_);
+  return hash_;
 }
 @end
 
-@interface RawMessageSet_Item_Builder()
-@property (retain) RawMessageSet_Item* result;
-@end
-
 @implementation RawMessageSet_Item_Builder
 @synthesize result;
 - (void) dealloc {
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
   self.result = nil;
+  [prototype_ release];
   [super dealloc];
 }
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[[RawMessageSet_Item alloc] init] autorelease];
+    result = [RawMessageSet_Item recycledInstance];
+  }
+  return self;
+}
+- (id) initWithPrototype:(RawMessageSet_Item*) prototype {
+  if ((self = [super init])) {
+    self.result = prototype;
+    prototype_ = [prototype retain];
   }
   return self;
 }
+- (void) detachFromPrototype {
+  RawMessageSet_Item* prototype = prototype_;
+  prototype_ = nil;
+  self.result = [[[RawMessageSet_Item alloc] init] autorelease];
+  [self mergeFrom:prototype];
+  [prototype release];
+}
+- (PBGeneratedMessage*) internalGetMutableResult {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return [self internalGetResult];
+}
 - (PBGeneratedMessage*) internalGetResult {
   return result;
 }
 - (RawMessageSet_Item_Builder*) clear {
-  self.result = [[[RawMessageSet_Item alloc] init] autorelease];
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = [[RawMessageSet_Item recycledInstance] autorelease];
   return self;
 }
 - (RawMessageSet_Item_Builder*) clone {
-  return [RawMessageSet_Item builderWithPrototype:result];
+  if (prototype_ != nil) {
+    return [[[RawMessageSet_Item_Builder alloc] initWithPrototype:prototype_] autorelease];
+  }
+  return [[RawMessageSet_Item builder] mergeFrom:result];
+}
+- (RawMessageSet_Item_Builder*) reset {
+  if (result == nil || prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    self.result = [[RawMessageSet_Item recycledInstance] autorelease];
+  } else {
+    [result clearForReuse];
+  }
+  return self;
+}
+- (RawMessageSet_Item_Builder*) recycle:(RawMessageSet_Item*) message {
+  if (message == [RawMessageSet_Item defaultInstance]) {
+    @throw [NSException exceptionWithName:@"IllegalArgument" reason:@"Cannot recycle the default instance" userInfo:nil];
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = message;
+  return [self reset];
 }
 - (RawMessageSet_Item*) defaultInstance {
   return [RawMessageSet_Item defaultInstance];
 }
 - (RawMessageSet_Item*) build {
   [self checkInitialized];
-  return [self buildPartial];
+  BOOL shared = prototype_ != nil;
+  RawMessageSet_Item* returnMe = [self buildPartial];
+  if (!shared) {
+    [returnMe setInitialized];
+  }
+  return returnMe;
 }
 - (RawMessageSet_Item*) buildPartial {
-  RawMessageSet_Item* returnMe = [[result retain] autorelease];
-  self.result = nil;
+  return [[self newBuildPartial] autorelease];
+}
+- (RawMessageSet_Item*) newBuildPartial {
+  if (prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    RawMessageSet_Item* returnMe = result;
+    result = nil;
+    return returnMe;
+  }
+  RawMessageSet_Item* returnMe = result;
+  result = nil;
   return returnMe;
 }
 - (RawMessageSet_Item_Builder*) mergeFrom:(RawMessageSet_Item*) other {
   if (other == [RawMessageSet_Item defaultInstance]) {
     return self;
   }
-  if (other.hasTypeId) {
-    [self setTypeId:other.typeId];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (other->hasBits_[0] & 0x1u) {
+    [self setTypeId:other->typeId];
   }
-  if (other.hasMessage) {
-    [self setMessage:other.message];
+  if (other->hasBits_[0] & 0x2u) {
+    [self setMessage:other->message];
   }
   [self mergeUnknownFields:other.unknownFields];
   return self;
@@ -1204,18 +1761,29 @@ static RawMessageSet_Item* defaultRawMessageSet_ItemInstance = nil;
   return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
 }
 - (RawMessageSet_Item_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  PBUnknownFieldSet_Builder* unknownFields = nil;
   while (YES) {
     int32_t tag = [input readTag];
     switch (tag) {
       case 0:
-        [self setUnknownFields:[unknownFields build]];
+        if (unknownFields != nil) {
+          [self setUnknownFields:[unknownFields build]];
+        }
         return self;
       default: {
-        if (![self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag]) {
-          [self setUnknownFields:[unknownFields build]];
+        if (PBWireFormatGetTagWireType(tag) == PBWireFormatEndGroup) {
+          if (unknownFields != nil) {
+            [self setUnknownFields:[unknownFields build]];
+          }
           return self;
         }
+        if (unknownFields == nil) {
+          unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+        }
+        [self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag];
         break;
       }
       case 16: {
@@ -1223,93 +1791,174 @@ static RawMessageSet_Item* defaultRawMessageSet_ItemInstance = nil;
         break;
       }
       case 26: {
-        [self setMessage:[input readData]];
+        NSData* value = [input newData];
+        [self setMessage:value];
+        [value release];
         break;
       }
     }
   }
 }
 - (BOOL) hasTypeId {
-  return result.hasTypeId;
+  return (result->hasBits_[0] & 0x1u) != 0;
 }
 - (int32_t) typeId {
-  return result.typeId;
+  return result->typeId;
 }
 - (RawMessageSet_Item_Builder*) setTypeId:(int32_t) value {
-  result.hasTypeId = YES;
-  result.typeId = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x1u;
+  result->typeId = value;
   return self;
 }
 - (RawMessageSet_Item_Builder*) clearTypeId {
-  result.hasTypeId = NO;
-  result.typeId = 0;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x1u;
+  result->typeId = 0;
   return self;
 }
 - (BOOL) hasMessage {
-  return result.hasMessage;
+  return (result->hasBits_[0] & 0x2u) != 0;
 }
 - (NSData*) message {
-  return result.message;
+  return [result message];
 }
 - (RawMessageSet_Item_Builder*) setMessage:(NSData*) value {
-  result.hasMessage = YES;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x2u;
   result.message = value;
   return self;
 }
 - (RawMessageSet_Item_Builder*) clearMessage {
-  result.hasMessage = NO;
-  result.message = [NSData data];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x2u;
+  [result->message release];
+  result->message = nil;
   return self;
 }
 @end
 
-@interface RawMessageSet_Builder()
-@property (retain) RawMessageSet* result;
-@end
-
 @implementation RawMessageSet_Builder
 @synthesize result;
 - (void) dealloc {
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
   self.result = nil;
+  [prototype_ release];
   [super dealloc];
 }
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[[RawMessageSet alloc] init] autorelease];
+    result = [RawMessageSet recycledInstance];
   }
   return self;
 }
+- (id) initWithPrototype:(RawMessageSet*) prototype {
+  if ((self = [super init])) {
+    self.result = prototype;
+    prototype_ = [prototype retain];
+  }
+  return self;
+}
+- (void) detachFromPrototype {
+  RawMessageSet* prototype = prototype_;
+  prototype_ = nil;
+  self.result = [[[RawMessageSet alloc] init] autorelease];
+  [self mergeFrom:prototype];
+  [prototype release];
+}
+- (PBGeneratedMessage*) internalGetMutableResult {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return [self internalGetResult];
+}
 - (PBGeneratedMessage*) internalGetResult {
   return result;
 }
 - (RawMessageSet_Builder*) clear {
-  self.result = [[[RawMessageSet alloc] init] autorelease];
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = [[RawMessageSet recycledInstance] autorelease];
   return self;
 }
 - (RawMessageSet_Builder*) clone {
-  return [RawMessageSet builderWithPrototype:result];
+  if (prototype_ != nil) {
+    return [[[RawMessageSet_Builder alloc] initWithPrototype:prototype_] autorelease];
+  }
+  return [[RawMessageSet builder] mergeFrom:result];
+}
+- (RawMessageSet_Builder*) reset {
+  if (result == nil || prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    self.result = [[RawMessageSet recycledInstance] autorelease];
+  } else {
+    [result clearForReuse];
+  }
+  return self;
+}
+- (RawMessageSet_Builder*) recycle:(RawMessageSet*) message {
+  if (message == [RawMessageSet defaultInstance]) {
+    @throw [NSException exceptionWithName:@"IllegalArgument" reason:@"Cannot recycle the default instance" userInfo:nil];
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = message;
+  return [self reset];
 }
 - (RawMessageSet*) defaultInstance {
   return [RawMessageSet defaultInstance];
 }
 - (RawMessageSet*) build {
   [self checkInitialized];
-  return [self buildPartial];
+  BOOL shared = prototype_ != nil;
+  RawMessageSet* returnMe = [self buildPartial];
+  if (!shared) {
+    [returnMe setInitialized];
+  }
+  return returnMe;
 }
 - (RawMessageSet*) buildPartial {
-  RawMessageSet* returnMe = [[result retain] autorelease];
-  self.result = nil;
+  return [[self newBuildPartial] autorelease];
+}
+- (RawMessageSet*) newBuildPartial {
+  if (prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    RawMessageSet* returnMe = result;
+    result = nil;
+    return returnMe;
+  }
+  [result->itemArray shrinkToFit];
+  RawMessageSet* returnMe = result;
+  result = nil;
   return returnMe;
 }
 - (RawMessageSet_Builder*) mergeFrom:(RawMessageSet*) other {
   if (other == [RawMessageSet defaultInstance]) {
     return self;
   }
-  if (other.itemArray.count > 0) {
-    if (result.itemArray == nil) {
-      result.itemArray = [[other.itemArray copyWithZone:[other.itemArray zone]] autorelease];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (other->itemArray.count > 0) {
+    if (result->itemArray == nil) {
+      result.itemArray = [[other->itemArray copyWithZone:[other->itemArray zone]] autorelease];
     } else {
-      [result.itemArray appendArray:other.itemArray];
+      [result->itemArray appendArray:other->itemArray];
     }
   }
   [self mergeUnknownFields:other.unknownFields];
@@ -1319,51 +1968,83 @@ static RawMessageSet_Item* defaultRawMessageSet_ItemInstance = nil;
   return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
 }
 - (RawMessageSet_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  PBUnknownFieldSet_Builder* unknownFields = nil;
   while (YES) {
     int32_t tag = [input readTag];
     switch (tag) {
       case 0:
-        [self setUnknownFields:[unknownFields build]];
+        if (unknownFields != nil) {
+          [self setUnknownFields:[unknownFields build]];
+        }
         return self;
       default: {
-        if (![self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag]) {
-          [self setUnknownFields:[unknownFields build]];
+        if (PBWireFormatGetTagWireType(tag) == PBWireFormatEndGroup) {
+          if (unknownFields != nil) {
+            [self setUnknownFields:[unknownFields build]];
+          }
           return self;
         }
+        if (unknownFields == nil) {
+          unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+        }
+        [self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag];
         break;
       }
       case 11: {
-        RawMessageSet_Item_Builder* subBuilder = [RawMessageSet_Item builder];
-        [input readGroup:1 builder:subBuilder extensionRegistry:extensionRegistry];
-        [self addItem:[subBuilder buildPartial]];
+        RawMessageSet_Item_Builder* subBuilder = [[RawMessageSet_Item_Builder alloc] init];
+        @try {
+          [input readGroup:1 builder:subBuilder extensionRegistry:extensionRegistry];
+          RawMessageSet_Item* value = [subBuilder newBuildPartial];
+          [self addItem:value];
+          [value release];
+        } @finally {
+          [subBuilder release];
+        }
         break;
       }
     }
   }
 }
 - (PBAppendableArray *)item {
-  return result.itemArray;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return result->itemArray;
 }
 - (RawMessageSet_Item*)itemAtIndex:(NSUInteger)index {
   return [result itemAtIndex:index];
 }
 - (RawMessageSet_Builder *)addItem:(RawMessageSet_Item*)value {
-  if (result.itemArray == nil) {
-    result.itemArray = [PBAppendableArray arrayWithValueType:PBArrayValueTypeObject];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (result->itemArray == nil) {
+    result.itemArray = [PBObjectArray array];
   }
-  [result.itemArray addObject:value];
+  PBObjectArrayAddValue(result->itemArray, value);
   return self;
 }
 - (RawMessageSet_Builder *)setItemArray:(NSArray *)array {
-  result.itemArray = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeObject];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.itemArray = [PBObjectArray arrayWithArray:array valueType:PBArrayValueTypeObject];
   return self;
 }
 - (RawMessageSet_Builder *)setItemValues:(const RawMessageSet_Item* *)values count:(NSUInteger)count {
-  result.itemArray = [PBAppendableArray arrayWithValues:values count:count valueType:PBArrayValueTypeObject];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.itemArray = [PBObjectArray arrayWithValues:values count:count valueType:PBArrayValueTypeObject];
   return self;
 }
 - (RawMessageSet_Builder *)clearItem {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
   result.itemArray = nil;
   return self;
 }
@@ -0,0 +1,260 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+
+#import <ProtocolBuffers/ProtocolBuffers.h>
+
+#import "ObjectivecDescriptor.pb.h"
+
+@class ObjectiveCFileOptions;
+@class ObjectiveCFileOptions_Builder;
+@class PBDescriptorProto;
+@class PBDescriptorProto_Builder;
+@class PBDescriptorProto_ExtensionRange;
+@class PBDescriptorProto_ExtensionRange_Builder;
+@class PBEnumDescriptorProto;
+@class PBEnumDescriptorProto_Builder;
+@class PBEnumOptions;
+@class PBEnumOptions_Builder;
+@class PBEnumValueDescriptorProto;
+@class PBEnumValueDescriptorProto_Builder;
+@class PBEnumValueOptions;
+@class PBEnumValueOptions_Builder;
+@class PBFieldDescriptorProto;
+@class PBFieldDescriptorProto_Builder;
+@class PBFieldOptions;
+@class PBFieldOptions_Builder;
+@class PBFileDescriptorProto;
+@class PBFileDescriptorProto_Builder;
+@class PBFileDescriptorSet;
+@class PBFileDescriptorSet_Builder;
+@class PBFileOptions;
+@class PBFileOptions_Builder;
+@class PBMessageOptions;
+@class PBMessageOptions_Builder;
+@class PBMethodDescriptorProto;
+@class PBMethodDescriptorProto_Builder;
+@class PBMethodOptions;
+@class PBMethodOptions_Builder;
+@class PBServiceDescriptorProto;
+@class PBServiceDescriptorProto_Builder;
+@class PBServiceOptions;
+@class PBServiceOptions_Builder;
+@class PBSourceCodeInfo;
+@class PBSourceCodeInfo_Builder;
+@class PBSourceCodeInfo_Location;
+@class PBSourceCodeInfo_Location_Builder;
+@class PBUninterpretedOption;
+@class PBUninterpretedOption_Builder;
+@class PBUninterpretedOption_NamePart;
+@class PBUninterpretedOption_NamePart_Builder;
+@class TestMutableChild;
+@class TestMutableChild_Builder;
+@class TestMutableMessage;
+@class TestMutableMessage_Builder;
+#ifndef __has_feature
+  #define __has_feature(x) 0 // Compatibility with non-clang compilers.
+#endif // __has_feature
+
+#ifndef NS_RETURNS_NOT_RETAINED
+  #if __has_feature(attribute_ns_returns_not_retained)
+    #define NS_RETURNS_NOT_RETAINED __attribute__((ns_returns_not_retained))
+  #else
+    #define NS_RETURNS_NOT_RETAINED
+  #endif
+#endif
+
+
+@interface UnittestMutableRoot : NSObject {
+}
++ (PBExtensionRegistry*) extensionRegistry;
++ (void) registerAllExtensions:(PBMutableExtensionRegistry*) registry;
+@end
+
+@interface TestMutableChild : PBGeneratedMessage <NSCopying, NSMutableCopying> {
+@package
+  uint32_t hasBits_[1];
+  int32_t value;
+  PBObjectArray * namesArray;
+}
+- (BOOL) hasValue;
+@property (nonatomic, readonly) int32_t value;
+@property (nonatomic, readonly, retain) PBArray * names;
+- (NSString*)namesAtIndex:(NSUInteger)index;
+
+- (void) setValue:(int32_t) value;
+- (void) clearValue;
+- (void)addNames:(NSString*)value;
+- (void)setNames:(PBArray *)array;
+- (void)clearNames;
+
++ (TestMutableChild*) defaultInstance;
+- (TestMutableChild*) defaultInstance;
+
+- (BOOL) isInitialized;
+- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output;
+- (TestMutableChild_Builder*) builder;
++ (TestMutableChild_Builder*) builder;
++ (TestMutableChild_Builder*) builderWithPrototype:(TestMutableChild*) prototype;
+- (TestMutableChild_Builder*) toBuilder;
+
++ (TestMutableChild*) parseFromData:(NSData*) data;
++ (TestMutableChild*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
++ (TestMutableChild*) parseFromInputStream:(NSInputStream*) input;
++ (TestMutableChild*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
++ (TestMutableChild*) parseFromCodedInputStream:(PBCodedInputStream*) input;
++ (TestMutableChild*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
+@end
+
+@interface TestMutableChild_Builder : PBGeneratedMessage_Builder {
+@private
+  TestMutableChild* result;
+  TestMutableChild* prototype_;
+}
+
+- (TestMutableChild*) defaultInstance;
+
+- (TestMutableChild_Builder*) clear;
+- (TestMutableChild_Builder*) clone;
+- (TestMutableChild_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (TestMutableChild_Builder*) recycle:(TestMutableChild*) message;
+
+- (TestMutableChild*) build;
+- (TestMutableChild*) buildPartial;
+- (TestMutableChild*) newBuildPartial;
+
+- (TestMutableChild_Builder*) mergeFrom:(TestMutableChild*) other;
+- (TestMutableChild_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
+- (TestMutableChild_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
+
+- (BOOL) hasValue;
+- (int32_t) value;
+- (TestMutableChild_Builder*) setValue:(int32_t) value;
+- (TestMutableChild_Builder*) clearValue;
+
+- (PBAppendableArray *)names;
+- (NSString*)namesAtIndex:(NSUInteger)index;
+- (TestMutableChild_Builder *)addNames:(NSString*)value;
+- (TestMutableChild_Builder *)setNamesArray:(NSArray *)array;
+- (TestMutableChild_Builder *)setNames:(PBArray *)array;
+- (TestMutableChild_Builder *)setNamesValues:(const NSString* *)values count:(NSUInteger)count;
+- (TestMutableChild_Builder *)clearNames;
+@end
+
+@interface TestMutableMessage : PBGeneratedMessage <NSCopying, NSMutableCopying> {
+@package
+  uint32_t hasBits_[1];
+  int32_t int32Value;
+  NSString* stringValue;
+  TestMutableChild* child;
+  PBInt32Array * numbersArray;
+  PBObjectArray * childrenArray;
+}
+- (BOOL) hasInt32Value;
+- (BOOL) hasStringValue;
+- (BOOL) hasChild;
+@property (nonatomic, readonly) int32_t int32Value;
+@property (nonatomic, readonly, retain) NSString* stringValue;
+@property (nonatomic, readonly, retain) TestMutableChild* child;
+@property (nonatomic, readonly, retain) PBArray * numbers;
+@property (nonatomic, readonly, retain) PBArray * children;
+- (int32_t)numbersAtIndex:(NSUInteger)index;
+- (TestMutableChild*)childrenAtIndex:(NSUInteger)index;
+
+- (void) setInt32Value:(int32_t) value;
+- (void) clearInt32Value;
+- (void) setStringValue:(NSString*) value;
+- (void) clearStringValue;
+- (void) setChild:(TestMutableChild*) value;
+- (void) clearChild;
+/** The field's value, set to an unfrozen copy first if need be. */
+- (TestMutableChild*) mutableChild;
+- (void)addNumbers:(int32_t)value;
+- (void)setNumbers:(PBArray *)array;
+- (void)clearNumbers;
+- (void)addChildren:(TestMutableChild*)value;
+- (void)setChildren:(NSArray *)array;
+- (void)clearChildren;
+
++ (TestMutableMessage*) defaultInstance;
+- (TestMutableMessage*) defaultInstance;
+
+- (BOOL) isInitialized;
+- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output;
+- (TestMutableMessage_Builder*) builder;
++ (TestMutableMessage_Builder*) builder;
++ (TestMutableMessage_Builder*) builderWithPrototype:(TestMutableMessage*) prototype;
+- (TestMutableMessage_Builder*) toBuilder;
+
++ (TestMutableMessage*) parseFromData:(NSData*) data;
++ (TestMutableMessage*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
++ (TestMutableMessage*) parseFromInputStream:(NSInputStream*) input;
++ (TestMutableMessage*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
++ (TestMutableMessage*) parseFromCodedInputStream:(PBCodedInputStream*) input;
++ (TestMutableMessage*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
+@end
+
+@interface TestMutableMessage_Builder : PBGeneratedMessage_Builder {
+@private
+  TestMutableMessage* result;
+  TestMutableMessage* prototype_;
+  TestMutableChild_Builder* childBuilder_;
+  TestMutableChild_Builder* childSpareBuilder_;
+}
+
+- (TestMutableMessage*) defaultInstance;
+
+- (TestMutableMessage_Builder*) clear;
+- (TestMutableMessage_Builder*) clone;
+- (TestMutableMessage_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (TestMutableMessage_Builder*) recycle:(TestMutableMessage*) message;
+
+- (TestMutableMessage*) build;
+- (TestMutableMessage*) buildPartial;
+- (TestMutableMessage*) newBuildPartial;
+
+- (TestMutableMessage_Builder*) mergeFrom:(TestMutableMessage*) other;
+- (TestMutableMessage_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
+- (TestMutableMessage_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
+
+- (BOOL) hasInt32Value;
+- (int32_t) int32Value;
+- (TestMutableMessage_Builder*) setInt32Value:(int32_t) value;
+- (TestMutableMessage_Builder*) clearInt32Value;
+
+- (BOOL) hasStringValue;
+- (NSString*) stringValue;
+- (TestMutableMessage_Builder*) setStringValue:(NSString*) value;
+- (TestMutableMessage_Builder*) clearStringValue;
+
+- (BOOL) hasChild;
+- (TestMutableChild*) child;
+- (TestMutableMessage_Builder*) setChild:(TestMutableChild*) value;
+- (TestMutableMessage_Builder*) setChildBuilder:(TestMutableChild_Builder*) builderForValue;
+- (TestMutableMessage_Builder*) mergeChild:(TestMutableChild*) value;
+- (TestMutableMessage_Builder*) clearChild;
+
+- (PBAppendableArray *)numbers;
+- (int32_t)numbersAtIndex:(NSUInteger)index;
+- (TestMutableMessage_Builder *)addNumbers:(int32_t)value;
+- (TestMutableMessage_Builder *)setNumbersArray:(NSArray *)array;
+- (TestMutableMessage_Builder *)setNumbers:(PBArray *)array;
+- (TestMutableMessage_Builder *)setNumbersValues:(const int32_t *)values count:(NSUInteger)count;
+- (TestMutableMessage_Builder *)clearNumbers;
+
+- (PBAppendableArray *)children;
+- (TestMutableChild*)childrenAtIndex:(NSUInteger)index;
+- (TestMutableMessage_Builder *)addChildren:(TestMutableChild*)value;
+- (TestMutableMessage_Builder *)setChildrenArray:(NSArray *)array;
+- (TestMutableMessage_Builder *)setChildrenValues:(const TestMutableChild* *)values count:(NSUInteger)count;
+- (TestMutableMessage_Builder *)clearChildren;
+@end
+
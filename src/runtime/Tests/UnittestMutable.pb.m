@@ -0,0 +1,1324 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+
+#import "UnittestMutable.pb.h"
+
+@implementation UnittestMutableRoot
+static PBExtensionRegistry* extensionRegistry = nil;
++ (PBExtensionRegistry*) extensionRegistry {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    PBMutableExtensionRegistry* registry = [PBMutableExtensionRegistry registry];
+    [UnittestMutableRoot registerAllExtensions:registry];
+    [ObjectivecDescriptorRoot registerAllExtensions:registry];
+    extensionRegistry = [registry retain];
+  });
+  return extensionRegistry;
+}
+
++ (void) initialize {
+  if (self == [UnittestMutableRoot class]) {
+  }
+}
++ (void) registerAllExtensions:(PBMutableExtensionRegistry*) registry {
+}
+@end
+
+@interface TestMutableChild ()
+@property (nonatomic) int32_t value;
+@property (nonatomic, retain) PBObjectArray * namesArray;
+@end
+
+@interface TestMutableChild_Builder()
+@property (nonatomic, retain) TestMutableChild* result;
+- (id) initWithPrototype:(TestMutableChild*) prototype;
+- (void) detachFromPrototype;
+@end
+
+@implementation TestMutableChild
+
+- (BOOL) hasValue {
+  return (hasBits_[0] & 0x1u) != 0;
+}
+- (void) setHasValue:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x1u;
+  } else {
+    hasBits_[0] &= ~0x1u;
+  }
+}
+@synthesize value;
+@synthesize namesArray;
+@dynamic names;
+- (void) dealloc {
+  [namesArray release];
+  [super dealloc];
+}
+- (void) clearForReuse {
+  [super clearForReuse];
+  memset(hasBits_, 0, sizeof(hasBits_));
+  value = 0;
+  namesArray = PBAppendableArrayReuse(namesArray);
+}
+static TestMutableChild* defaultTestMutableChildInstance = nil;
++ (TestMutableChild*) defaultInstance {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultTestMutableChildInstance = [[TestMutableChild alloc] init];
+    [defaultTestMutableChildInstance freeze];
+  });
+  return defaultTestMutableChildInstance;
+}
+- (TestMutableChild*) defaultInstance {
+  return [TestMutableChild defaultInstance];
+}
+- (PBArray *)names {
+  return namesArray;
+}
+- (NSString*)namesAtIndex:(NSUInteger)index {
+  return PBObjectArrayValueAtIndex(namesArray, index);
+}
+- (void) setValue:(int32_t) value_ {
+  if (hasBits_[0] & 0x4u) {
+    PBGeneratedMessageThrowFrozen(self);
+  }
+  hasBits_[0] |= 0x1u;
+  value = value_;
+}
+- (void) clearValue {
+  if (hasBits_[0] & 0x4u) {
+    PBGeneratedMessageThrowFrozen(self);
+  }
+  hasBits_[0] &= ~0x1u;
+  value = 0;
+}
+- (void)addNames:(NSString*)value {
+  if (hasBits_[0] & 0x4u) {
+    PBGeneratedMessageThrowFrozen(self);
+  }
+  if (namesArray == nil) {
+    self.namesArray = [PBObjectArray array];
+  }
+  PBObjectArrayAddValue(namesArray, value);
+}
+- (void)setNames:(PBArray *)array {
+  if (hasBits_[0] & 0x4u) {
+    PBGeneratedMessageThrowFrozen(self);
+  }
+  self.namesArray = array ? [PBObjectArray arrayWithStorageOfArray:array] : nil;
+}
+- (void)clearNames {
+  if (hasBits_[0] & 0x4u) {
+    PBGeneratedMessageThrowFrozen(self);
+  }
+  self.namesArray = nil;
+}
+- (void) freeze {
+  if (hasBits_[0] & 0x4u) {
+    return;
+  }
+  hasBits_[0] |= 0x4u;
+  [super freeze];
+}
+- (BOOL) isFrozen {
+  return (hasBits_[0] & 0x4u) != 0;
+}
+- (id) copyWithZone:(NSZone*) zone {
+  if (hasBits_[0] & 0x4u) {
+    return [self retain];
+  }
+  TestMutableChild* copy = [self mutableCopyWithZone:zone];
+  [copy freeze];
+  return copy;
+}
+- (id) mutableCopyWithZone:(NSZone*) zone {
+  TestMutableChild_Builder* builder = [[TestMutableChild_Builder allocWithZone:zone] init];
+  [builder mergeFrom:self];
+  TestMutableChild* copy = [builder newBuildPartial];
+  [builder release];
+  return copy;
+}
+- (BOOL) isInitialized {
+  return YES;
+}
+- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output {
+  if (hasBits_[0] & 0x1u) {
+    [output writeInt32:1 value:value];
+  }
+  const NSUInteger namesArrayCount = namesArray.count;
+  if (namesArrayCount > 0) {
+    const NSString* *values = (const NSString* *)namesArray.data;
+    for (NSUInteger i = 0; i < namesArrayCount; ++i) {
+      [output writeString:2 value:values[i]];
+    }
+  }
+  [self.unknownFields writeToCodedOutputStream:output];
+}
+- (int32_t) serializedSize {
+  int32_t size_ = PBGeneratedMessageGetMemoizedSize(&memoizedSerializedSize);
+  if (size_ != -1) {
+    return size_;
+  }
+
+  size_ = 0;
+  if (hasBits_[0] & 0x1u) {
+    size_ += computeInt32Size(1, value);
+  }
+  {
+    int32_t dataSize = 0;
+    const NSUInteger count = namesArray.count;
+    const NSString* *values = (const NSString* *)namesArray.data;
+    for (NSUInteger i = 0; i < count; ++i) {
+      dataSize += computeStringSizeNoTag(values[i]);
+    }
+    size_ += dataSize;
+    size_ += 1 * count;
+  }
+  size_ += self.unknownFields.serializedSize;
+  if (hasBits_[0] & 0x4u) {
+    PBGeneratedMessageSetMemoizedSize(&memoizedSerializedSize, size_);
+  }
+  return size_;
+}
++ (TestMutableChild*) parseFromData:(NSData*) data {
+  return (TestMutableChild*)[[[TestMutableChild builder] mergeFromData:data] build];
+}
++ (TestMutableChild*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
+  return (TestMutableChild*)[[[TestMutableChild builder] mergeFromData:data extensionRegistry:extensionRegistry] build];
+}
++ (TestMutableChild*) parseFromInputStream:(NSInputStream*) input {
+  return (TestMutableChild*)[[[TestMutableChild builder] mergeFromInputStream:input] build];
+}
++ (TestMutableChild*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
+  return (TestMutableChild*)[[[TestMutableChild builder] mergeFromInputStream:input extensionRegistry:extensionRegistry] build];
+}
++ (TestMutableChild*) parseFromCodedInputStream:(PBCodedInputStream*) input {
+  return (TestMutableChild*)[[[TestMutableChild builder] mergeFromCodedInputStream:input] build];
+}
++ (TestMutableChild*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
+  return (TestMutableChild*)[[[TestMutableChild builder] mergeFromCodedInputStream:input extensionRegistry:extensionRegistry] build];
+}
++ (TestMutableChild_Builder*) builder {
+  return [[[TestMutableChild_Builder alloc] init] autorelease];
+}
++ (TestMutableChild_Builder*) builderWithPrototype:(TestMutableChild*) prototype {
+  if (![prototype isFrozen]) {
+    return [[TestMutableChild builder] mergeFrom:prototype];
+  }
+  return [[[TestMutableChild_Builder alloc] initWithPrototype:prototype] autorelease];
+}
+- (TestMutableChild_Builder*) builder {
+  return [TestMutableChild builder];
+}
+- (TestMutableChild_Builder*) toBuilder {
+  return [TestMutableChild builderWithPrototype:self];
+}
+- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
+  if (hasBits_[0] & 0x1u) {
+    [output appendFormat:@"%@%@: %@\n", indent, @"value", [NSNumber numberWithInt:value]];
+  }
+  for (NSString* element in namesArray) {
+    [output appendFormat:@"%@%@: %@\n", indent, @"names", element];
+  }
+  [self.unknownFields writeDescriptionTo:output withIndent:indent];
+}
+- (BOOL) isEqual:(id)other {
+  if (other == self) {
+    return YES;
+  }
+  if (![other isKindOfClass:[TestMutableChild class]]) {
+    return NO;
+  }
+  TestMutableChild *otherMessage = other;
+  return
+      (hasBits_[0] & 0x1u) == (otherMessage->hasBits_[0] & 0x1u) &&
+      (!(hasBits_[0] & 0x1u) || value == otherMessage->value) &&
+      (namesArray.count == 0 ? otherMessage->namesArray.count == 0 : [namesArray isEqualToArray:otherMessage->namesArray]) &&
+      (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
+}
+- (NSUInteger) hash {
+  NSUInteger hash_ = PBGeneratedMessageGetMemoizedHash(&memoizedHash);
+  if (hash_ != 0) {
+    return hash_;
+  }
+
+  uint64_t hashCode = 7;
+  if (hasBits_[0] & 0x1u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, (uint64_t)value);
+  }
+  hashCode = PBGeneratedMessageHashMix(hashCode, [namesArray hash64]);
+  hashCode = PBGeneratedMessageHashMix(hashCode, [self.unknownFields hash]);
+  hash_ = PBGeneratedMessageHashFinish(hashCode);
+  if (hasBits_[0] & 0x4u) {
+    PBGeneratedMessageSetMemoizedHash(&memoizedHash, hash_);
+  }
+  return hash_;
+}
+@end
+
+@implementation TestMutableChild_Builder
+@synthesize result;
+- (void) dealloc {
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
+  self.result = nil;
+  [prototype_ release];
+  [super dealloc];
+}
+- (id) init {
+  if ((self = [super init])) {
+    result = [TestMutableChild recycledInstance];
+  }
+  return self;
+}
+- (id) initWithPrototype:(TestMutableChild*) prototype {
+  if ((self = [super init])) {
+    self.result = prototype;
+    prototype_ = [prototype retain];
+  }
+  return self;
+}
+- (void) detachFromPrototype {
+  TestMutableChild* prototype = prototype_;
+  prototype_ = nil;
+  self.result = [[[TestMutableChild alloc] init] autorelease];
+  [self mergeFrom:prototype];
+  [prototype release];
+}
+- (PBGeneratedMessage*) internalGetMutableResult {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return [self internalGetResult];
+}
+- (PBGeneratedMessage*) internalGetResult {
+  return result;
+}
+- (TestMutableChild_Builder*) clear {
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = [[TestMutableChild recycledInstance] autorelease];
+  return self;
+}
+- (TestMutableChild_Builder*) clone {
+  if (prototype_ != nil) {
+    return [[[TestMutableChild_Builder alloc] initWithPrototype:prototype_] autorelease];
+  }
+  return [[TestMutableChild builder] mergeFrom:result];
+}
+- (TestMutableChild_Builder*) reset {
+  if (result == nil || prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    self.result = [[TestMutableChild recycledInstance] autorelease];
+  } else {
+    [result clearForReuse];
+  }
+  return self;
+}
+- (TestMutableChild_Builder*) recycle:(TestMutableChild*) message {
+  if (message == [TestMutableChild defaultInstance]) {
+    @throw [NSException exceptionWithName:@"IllegalArgument" reason:@"Cannot recycle the default instance" userInfo:nil];
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = message;
+  return [self reset];
+}
+- (TestMutableChild*) defaultInstance {
+  return [TestMutableChild defaultInstance];
+}
+- (TestMutableChild*) build {
+  [self checkInitialized];
+  return [self buildPartial];
+}
+- (TestMutableChild*) buildPartial {
+  return [[self newBuildPartial] autorelease];
+}
+- (TestMutableChild*) newBuildPartial {
+  if (prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    TestMutableChild* returnMe = result;
+    result = nil;
+    return returnMe;
+  }
+  [result->namesArray shrinkToFit];
+  TestMutableChild* returnMe = result;
+  result = nil;
+  return returnMe;
+}
+- (TestMutableChild_Builder*) mergeFrom:(TestMutableChild*) other {
+  if (other == [TestMutableChild defaultInstance]) {
+    return self;
+  }
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (other->hasBits_[0] & 0x1u) {
+    [self setValue:other->value];
+  }
+  if (other->namesArray.count > 0) {
+    if (result->namesArray == nil) {
+      result.namesArray = [[other->namesArray copyWithZone:[other->namesArray zone]] autorelease];
+    } else {
+      [result->namesArray appendArray:other->namesArray];
+    }
+  }
+  [self mergeUnknownFields:other.unknownFields];
+  return self;
+}
+- (TestMutableChild_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input {
+  return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
+}
+- (TestMutableChild_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  PBUnknownFieldSet_Builder* unknownFields = nil;
+  while (YES) {
+    int32_t tag = [input readTag];
+    switch (tag) {
+      case 0:
+        if (unknownFields != nil) {
+          [self setUnknownFields:[unknownFields build]];
+        }
+        return self;
+      default: {
+        if (PBWireFormatGetTagWireType(tag) == PBWireFormatEndGroup) {
+          if (unknownFields != nil) {
+            [self setUnknownFields:[unknownFields build]];
+          }
+          return self;
+        }
+        if (unknownFields == nil) {
+          unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+        }
+        [self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag];
+        break;
+      }
+      case 8: {
+        [self setValue:[input readInt32]];
+        break;
+      }
+      case 18: {
+        NSString* value = [input newString];
+        [self addNames:value];
+        [value release];
+        break;
+      }
+    }
+  }
+}
+- (BOOL) hasValue {
+  return (result->hasBits_[0] & 0x1u) != 0;
+}
+- (int32_t) value {
+  return result->value;
+}
+- (TestMutableChild_Builder*) setValue:(int32_t) value {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x1u;
+  result->value = value;
+  return self;
+}
+- (TestMutableChild_Builder*) clearValue {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x1u;
+  result->value = 0;
+  return self;
+}
+- (PBAppendableArray *)names {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return result->namesArray;
+}
+- (NSString*)namesAtIndex:(NSUInteger)index {
+  return [result namesAtIndex:index];
+}
+- (TestMutableChild_Builder *)addNames:(NSString*)value {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (result->namesArray == nil) {
+    result.namesArray = [PBObjectArray array];
+  }
+  PBObjectArrayAddValue(result->namesArray, value);
+  return self;
+}
+- (TestMutableChild_Builder *)setNamesArray:(NSArray *)array {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.namesArray = [PBObjectArray arrayWithArray:array valueType:PBArrayValueTypeObject];
+  return self;
+}
+- (TestMutableChild_Builder *)setNames:(PBArray *)array {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.namesArray = array ? [PBObjectArray arrayWithStorageOfArray:array] : nil;
+  return self;
+}
+- (TestMutableChild_Builder *)setNamesValues:(const NSString* *)values count:(NSUInteger)count {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.namesArray = [PBObjectArray arrayWithValues:values count:count valueType:PBArrayValueTypeObject];
+  return self;
+}
+- (TestMutableChild_Builder *)clearNames {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.namesArray = nil;
+  return self;
+}
+@end
+
+@interface TestMutableMessage ()
+@property (nonatomic) int32_t int32Value;
+@property (nonatomic, retain) NSString* stringValue;
+@property (nonatomic, retain) TestMutableChild* child;
+@property (nonatomic, retain) PBInt32Array * numbersArray;
+@property (nonatomic, retain) PBObjectArray * childrenArray;
+@end
+
+@interface TestMutableMessage_Builder()
+@property (nonatomic, retain) TestMutableMessage* result;
+- (id) initWithPrototype:(TestMutableMessage*) prototype;
+- (void) detachFromPrototype;
+- (void) freezeSubBuilders;
+- (void) dropSubBuilders;
+- (void) resetSubBuilders;
+@end
+
+@implementation TestMutableMessage
+
+- (BOOL) hasInt32Value {
+  return (hasBits_[0] & 0x1u) != 0;
+}
+- (void) setHasInt32Value:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x1u;
+  } else {
+    hasBits_[0] &= ~0x1u;
+  }
+}
+@synthesize int32Value;
+- (BOOL) hasStringValue {
+  return (hasBits_[0] & 0x2u) != 0;
+}
+- (void) setHasStringValue:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x2u;
+  } else {
+    hasBits_[0] &= ~0x2u;
+  }
+}
+@synthesize stringValue;
+- (NSString*) stringValue {
+  return (hasBits_[0] & 0x2u) ? stringValue : @"";
+}
+- (BOOL) hasChild {
+  return (hasBits_[0] & 0x4u) != 0;
+}
+- (void) setHasChild:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x4u;
+  } else {
+    hasBits_[0] &= ~0x4u;
+  }
+}
+@synthesize child;
+- (TestMutableChild*) child {
+  return child != nil ? child : [TestMutableChild defaultInstance];
+}
+@synthesize numbersArray;
+@dynamic numbers;
+@synthesize childrenArray;
+@dynamic children;
+- (void) dealloc {
+  [stringValue release];
+  [child release];
+  [numbersArray release];
+  [childrenArray release];
+  [super dealloc];
+}
+- (void) clearForReuse {
+  [super clearForReuse];
+  memset(hasBits_, 0, sizeof(hasBits_));
+  int32Value = 0;
+  [stringValue release];
+  stringValue = nil;
+  [child release];
+  child = nil;
+  numbersArray = PBAppendableArrayReuse(numbersArray);
+  childrenArray = PBAppendableArrayReuse(childrenArray);
+}
+static TestMutableMessage* defaultTestMutableMessageInstance = nil;
++ (TestMutableMessage*) defaultInstance {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultTestMutableMessageInstance = [[TestMutableMessage alloc] init];
+    [defaultTestMutableMessageInstance freeze];
+  });
+  return defaultTestMutableMessageInstance;
+}
+- (TestMutableMessage*) defaultInstance {
+  return [TestMutableMessage defaultInstance];
+}
+- (PBArray *)numbers {
+  return numbersArray;
+}
+- (int32_t)numbersAtIndex:(NSUInteger)index {
+  return PBInt32ArrayValueAtIndex(numbersArray, index);
+}
+- (PBArray *)children {
+  return childrenArray;
+}
+- (TestMutableChild*)childrenAtIndex:(NSUInteger)index {
+  return PBObjectArrayValueAtIndex(childrenArray, index);
+}
+- (void) setInt32Value:(int32_t) value_ {
+  if (hasBits_[0] & 0x10u) {
+    PBGeneratedMessageThrowFrozen(self);
+  }
+  hasBits_[0] |= 0x1u;
+  int32Value = value_;
+}
+- (void) clearInt32Value {
+  if (hasBits_[0] & 0x10u) {
+    PBGeneratedMessageThrowFrozen(self);
+  }
+  hasBits_[0] &= ~0x1u;
+  int32Value = 0;
+}
+- (void) setStringValue:(NSString*) value_ {
+  if (hasBits_[0] & 0x10u) {
+    PBGeneratedMessageThrowFrozen(self);
+  }
+  hasBits_[0] |= 0x2u;
+  [value_ retain];
+  [stringValue release];
+  stringValue = value_;
+}
+- (void) clearStringValue {
+  if (hasBits_[0] & 0x10u) {
+    PBGeneratedMessageThrowFrozen(self);
+  }
+  hasBits_[0] &= ~0x2u;
+  [stringValue release];
+  stringValue = nil;
+}
+- (void) setChild:(TestMutableChild*) value_ {
+  if (hasBits_[0] & 0x10u) {
+    PBGeneratedMessageThrowFrozen(self);
+  }
+  hasBits_[0] |= 0x4u;
+  [value_ retain];
+  [child release];
+  child = value_;
+}
+- (void) clearChild {
+  if (hasBits_[0] & 0x10u) {
+    PBGeneratedMessageThrowFrozen(self);
+  }
+  hasBits_[0] &= ~0x4u;
+  [child release];
+  child = nil;
+}
+- (TestMutableChild*) mutableChild {
+  if (hasBits_[0] & 0x10u) {
+    PBGeneratedMessageThrowFrozen(self);
+  }
+  if (child == nil) {
+    child = [[TestMutableChild alloc] init];
+  } else if ([child isFrozen]) {
+    TestMutableChild* value_ = [child mutableCopy];
+    [child release];
+    child = value_;
+  }
+  hasBits_[0] |= 0x4u;
+  return child;
+}
+- (void)addNumbers:(int32_t)value {
+  if (hasBits_[0] & 0x10u) {
+    PBGeneratedMessageThrowFrozen(self);
+  }
+  if (numbersArray == nil) {
+    self.numbersArray = [PBInt32Array array];
+  }
+  PBInt32ArrayAddValue(numbersArray, value);
+}
+- (void)setNumbers:(PBArray *)array {
+  if (hasBits_[0] & 0x10u) {
+    PBGeneratedMessageThrowFrozen(self);
+  }
+  self.numbersArray = array ? [PBInt32Array arrayWithStorageOfArray:array] : nil;
+}
+- (void)clearNumbers {
+  if (hasBits_[0] & 0x10u) {
+    PBGeneratedMessageThrowFrozen(self);
+  }
+  self.numbersArray = nil;
+}
+- (void)addChildren:(TestMutableChild*)value {
+  if (hasBits_[0] & 0x10u) {
+    PBGeneratedMessageThrowFrozen(self);
+  }
+  if (childrenArray == nil) {
+    self.childrenArray = [PBObjectArray array];
+  }
+  PBObjectArrayAddValue(childrenArray, value);
+}
+- (void)setChildren:(NSArray *)array {
+  if (hasBits_[0] & 0x10u) {
+    PBGeneratedMessageThrowFrozen(self);
+  }
+  self.childrenArray = array ? [PBObjectArray arrayWithArray:array valueType:PBArrayValueTypeObject] : nil;
+}
+- (void)clearChildren {
+  if (hasBits_[0] & 0x10u) {
+    PBGeneratedMessageThrowFrozen(self);
+  }
+  self.childrenArray = nil;
+}
+- (void) freeze {
+  if (hasBits_[0] & 0x10u) {
+    return;
+  }
+  hasBits_[0] |= 0x10u;
+  [super freeze];
+  [child freeze];
+  for (TestMutableChild* element in childrenArray) {
+    [element freeze];
+  }
+}
+- (BOOL) isFrozen {
+  return (hasBits_[0] & 0x10u) != 0;
+}
+- (id) copyWithZone:(NSZone*) zone {
+  if (hasBits_[0] & 0x10u) {
+    return [self retain];
+  }
+  TestMutableMessage* copy = [self mutableCopyWithZone:zone];
+  [copy freeze];
+  return copy;
+}
+- (id) mutableCopyWithZone:(NSZone*) zone {
+  TestMutableMessage_Builder* builder = [[TestMutableMessage_Builder allocWithZone:zone] init];
+  [builder mergeFrom:self];
+  TestMutableMessage* copy = [builder newBuildPartial];
+  [builder release];
+  if (copy->child != nil && ![copy->child isFrozen]) {
+    TestMutableChild* value = [copy->child mutableCopyWithZone:zone];
+    [copy->child release];
+    copy->child = value;
+  }
+  if (copy->childrenArray.count > 0) {
+    PBObjectArray* values = [PBObjectArray array];
+    for (TestMutableChild* element in copy->childrenArray) {
+      TestMutableChild* value = [element isFrozen] ? [element retain] : [element mutableCopyWithZone:zone];
+      PBObjectArrayAddValue(values, value);
+      [value release];
+    }
+    copy.childrenArray = values;
+  }
+  return copy;
+}
+- (BOOL) isInitialized {
+  return YES;
+}
+- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output {
+  if (hasBits_[0] & 0x1u) {
+    [output writeInt32:1 value:int32Value];
+  }
+  if (hasBits_[0] & 0x2u) {
+    [output writeString:2 value:stringValue];
+  }
+  if (hasBits_[0] & 0x4u) {
+    [output writeMessage:3 value:child];
+  }
+  const NSUInteger numbersArrayCount = numbersArray.count;
+  if (numbersArrayCount > 0) {
+    const int32_t *values = (const int32_t *)numbersArray.data;
+    for (NSUInteger i = 0; i < numbersArrayCount; ++i) {
+      [output writeInt32:4 value:values[i]];
+    }
+  }
+  for (TestMutableChild *element in childrenArray) {
+    [output writeMessage:5 value:element];
+  }
+  [self.unknownFields writeToCodedOutputStream:output];
+}
+- (int32_t) serializedSize {
+  int32_t size_ = PBGeneratedMessageGetMemoizedSize(&memoizedSerializedSize);
+  if (size_ != -1) {
+    return size_;
+  }
+
+  size_ = 0;
+  if (hasBits_[0] & 0x1u) {
+    size_ += computeInt32Size(1, int32Value);
+  }
+  if (hasBits_[0] & 0x2u) {
+    size_ += computeStringSize(2, stringValue);
+  }
+  if (hasBits_[0] & 0x4u) {
+    size_ += computeMessageSize(3, child);
+  }
+  {
+    int32_t dataSize = 0;
+    const NSUInteger count = numbersArray.count;
+    const int32_t *values = (const int32_t *)numbersArray.data;
+    for (NSUInteger i = 0; i < count; ++i) {
+      dataSize += computeInt32SizeNoTag(values[i]);
+    }
+    size_ += dataSize;
+    size_ += 1 * count;
+  }
+  for (TestMutableChild *element in childrenArray) {
+    size_ += computeMessageSize(5, element);
+  }
+  size_ += self.unknownFields.serializedSize;
+  if (hasBits_[0] & 0x10u) {
+    PBGeneratedMessageSetMemoizedSize(&memoizedSerializedSize, size_);
+  }
+  return size_;
+}
++ (TestMutableMessage*) parseFromData:(NSData*) data {
+  return (TestMutableMessage*)[[[TestMutableMessage builder] mergeFromData:data] build];
+}
++ (TestMutableMessage*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
+  return (TestMutableMessage*)[[[TestMutableMessage builder] mergeFromData:data extensionRegistry:extensionRegistry] build];
+}
++ (TestMutableMessage*) parseFromInputStream:(NSInputStream*) input {
+  return (TestMutableMessage*)[[[TestMutableMessage builder] mergeFromInputStream:input] build];
+}
++ (TestMutableMessage*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
+  return (TestMutableMessage*)[[[TestMutableMessage builder] mergeFromInputStream:input extensionRegistry:extensionRegistry] build];
+}
++ (TestMutableMessage*) parseFromCodedInputStream:(PBCodedInputStream*) input {
+  return (TestMutableMessage*)[[[TestMutableMessage builder] mergeFromCodedInputStream:input] build];
+}
++ (TestMutableMessage*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
+  return (TestMutableMessage*)[[[TestMutableMessage builder] mergeFromCodedInputStream:input extensionRegistry:extensionRegistry] build];
+}
++ (TestMutableMessage_Builder*) builder {
+  return [[[TestMutableMessage_Builder alloc] init] autorelease];
+}
++ (TestMutableMessage_Builder*) builderWithPrototype:(TestMutableMessage*) prototype {
+  if (![prototype isFrozen]) {
+    return [[TestMutableMessage builder] mergeFrom:prototype];
+  }
+  return [[[TestMutableMessage_Builder alloc] initWithPrototype:prototype] autorelease];
+}
+- (TestMutableMessage_Builder*) builder {
+  return [TestMutableMessage builder];
+}
+- (TestMutableMessage_Builder*) toBuilder {
+  return [TestMutableMessage builderWithPrototype:self];
+}
+- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
+  if (hasBits_[0] & 0x1u) {
+    [output appendFormat:@"%@%@: %@\n", indent, @"int32Value", [NSNumber numberWithInt:int32Value]];
+  }
+  if (hasBits_[0] & 0x2u) {
+    [output appendFormat:@"%@%@: %@\n", indent, @"stringValue", stringValue];
+  }
+  if (hasBits_[0] & 0x4u) {
+    [output appendFormat:@"%@%@ {\n", indent, @"child"];
+    [child writeDescriptionTo:output
+                         withIndent:[NSString stringWithFormat:@"%@  ", indent]];
+    [output appendFormat:@"%@}\n", indent];
+  }
+  [numbersArray enumerateInt32sUsingBlock:^(int32_t value, NSUInteger idx, BOOL *stop) {
+    [output appendFormat:@"%@%@: %d\n", indent, @"numbers", value];
+  }];
+  for (TestMutableChild* element in childrenArray) {
+    [output appendFormat:@"%@%@ {\n", indent, @"children"];
+    [element writeDescriptionTo:output
+                     withIndent:[NSString stringWithFormat:@"%@  ", indent]];
+    [output appendFormat:@"%@}\n", indent];
+  }
+  [self.unknownFields writeDescriptionTo:output withIndent:indent];
+}
+- (BOOL) isEqual:(id)other {
+  if (other == self) {
+    return YES;
+  }
+  if (![other isKindOfClass:[TestMutableMessage class]]) {
+    return NO;
+  }
+  TestMutableMessage *otherMessage = other;
+  return
+      (hasBits_[0] & 0x1u) == (otherMessage->hasBits_[0] & 0x1u) &&
+      (!(hasBits_[0] & 0x1u) || int32Value == otherMessage->int32Value) &&
+      (hasBits_[0] & 0x2u) == (otherMessage->hasBits_[0] & 0x2u) &&
+      (!(hasBits_[0] & 0x2u) || [stringValue isEqual:otherMessage->stringValue]) &&
+      (hasBits_[0] & 0x4u) == (otherMessage->hasBits_[0] & 0x4u) &&
+      (!(hasBits_[0] & 0x4u) || [child isEqual:otherMessage->child]) &&
+      (numbersArray.count == 0 ? otherMessage->numbersArray.count == 0 : [numbersArray isEqualToArray:otherMessage->numbersArray]) &&
+      (childrenArray.count == 0 ? otherMessage->childrenArray.count == 0 : [childrenArray isEqualToArray:otherMessage->childrenArray]) &&
+      (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
+}
+- (NSUInteger) hash {
+  NSUInteger hash_ = PBGeneratedMessageGetMemoizedHash(&memoizedHash);
+  if (hash_ != 0) {
+    return hash_;
+  }
+
+  uint64_t hashCode = 7;
+  if (hasBits_[0] & 0x1u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, (uint64_t)int32Value);
+  }
+  if (hasBits_[0] & 0x2u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [stringValue hash]);
+  }
+  if (hasBits_[0] & 0x4u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [child hash]);
+  }
+  hashCode = PBGeneratedMessageHashMix(hashCode, [numbersArray hash64]);
+  for (TestMutableChild* element in childrenArray) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, [element hash]);
+  }
+  hashCode = PBGeneratedMessageHashMix(hashCode, [self.unknownFields hash]);
+  hash_ = PBGeneratedMessageHashFinish(hashCode);
+  if (hasBits_[0] & 0x10u) {
+    PBGeneratedMessageSetMemoizedHash(&memoizedHash, hash_);
+  }
+  return hash_;
+}
+@end
+
+@implementation TestMutableMessage_Builder
+@synthesize result;
+- (void) dealloc {
+  [self dropSubBuilders];
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
+  self.result = nil;
+  [prototype_ release];
+  [super dealloc];
+}
+- (id) init {
+  if ((self = [super init])) {
+    result = [TestMutableMessage recycledInstance];
+  }
+  return self;
+}
+- (id) initWithPrototype:(TestMutableMessage*) prototype {
+  if ((self = [super init])) {
+    self.result = prototype;
+    prototype_ = [prototype retain];
+  }
+  return self;
+}
+- (void) detachFromPrototype {
+  TestMutableMessage* prototype = prototype_;
+  prototype_ = nil;
+  self.result = [[[TestMutableMessage alloc] init] autorelease];
+  [self mergeFrom:prototype];
+  [prototype release];
+}
+- (PBGeneratedMessage*) internalGetMutableResult {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return [self internalGetResult];
+}
+- (void) freezeSubBuilders {
+  if (childBuilder_ != nil) {
+    TestMutableChild* value = [childBuilder_ newBuildPartial];
+    result.child = value;
+    [value release];
+    [childBuilder_ release];
+    childBuilder_ = nil;
+  }
+}
+- (void) dropSubBuilders {
+  [childBuilder_ release];
+  childBuilder_ = nil;
+  [childSpareBuilder_ release];
+  childSpareBuilder_ = nil;
+}
+- (void) resetSubBuilders {
+  if (childBuilder_ != nil) {
+    [childBuilder_ reset];
+    [childSpareBuilder_ release];
+    childSpareBuilder_ = childBuilder_;
+    childBuilder_ = nil;
+  }
+}
+- (PBGeneratedMessage*) internalGetResult {
+  [self freezeSubBuilders];
+  return result;
+}
+- (TestMutableMessage_Builder*) clear {
+  [self dropSubBuilders];
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = [[TestMutableMessage recycledInstance] autorelease];
+  return self;
+}
+- (TestMutableMessage_Builder*) clone {
+  if (prototype_ != nil) {
+    return [[[TestMutableMessage_Builder alloc] initWithPrototype:prototype_] autorelease];
+  }
+  [self freezeSubBuilders];
+  return [[TestMutableMessage builder] mergeFrom:result];
+}
+- (TestMutableMessage_Builder*) reset {
+  [self resetSubBuilders];
+  if (result == nil || prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    self.result = [[TestMutableMessage recycledInstance] autorelease];
+  } else {
+    [result clearForReuse];
+  }
+  return self;
+}
+- (TestMutableMessage_Builder*) recycle:(TestMutableMessage*) message {
+  if (message == [TestMutableMessage defaultInstance]) {
+    @throw [NSException exceptionWithName:@"IllegalArgument" reason:@"Cannot recycle the default instance" userInfo:nil];
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = message;
+  return [self reset];
+}
+- (TestMutableMessage*) defaultInstance {
+  return [TestMutableMessage defaultInstance];
+}
+- (TestMutableMessage*) build {
+  [self checkInitialized];
+  return [self buildPartial];
+}
+- (TestMutableMessage*) buildPartial {
+  return [[self newBuildPartial] autorelease];
+}
+- (TestMutableMessage*) newBuildPartial {
+  if (prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    TestMutableMessage* returnMe = result;
+    result = nil;
+    return returnMe;
+  }
+  [self freezeSubBuilders];
+  [result->numbersArray shrinkToFit];
+  [result->childrenArray shrinkToFit];
+  TestMutableMessage* returnMe = result;
+  result = nil;
+  return returnMe;
+}
+- (TestMutableMessage_Builder*) mergeFrom:(TestMutableMessage*) other {
+  if (other == [TestMutableMessage defaultInstance]) {
+    return self;
+  }
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (other->hasBits_[0] & 0x1u) {
+    [self setInt32Value:other->int32Value];
+  }
+  if (other->hasBits_[0] & 0x2u) {
+    [self setStringValue:other->stringValue];
+  }
+  if (other->hasBits_[0] & 0x4u) {
+    [self mergeChild:other->child];
+  }
+  if (other->numbersArray.count > 0) {
+    if (result->numbersArray == nil) {
+      result.numbersArray = [[other->numbersArray copyWithZone:[other->numbersArray zone]] autorelease];
+    } else {
+      [result->numbersArray appendArray:other->numbersArray];
+    }
+  }
+  if (other->childrenArray.count > 0) {
+    if (result->childrenArray == nil) {
+      result.childrenArray = [[other->childrenArray copyWithZone:[other->childrenArray zone]] autorelease];
+    } else {
+      [result->childrenArray appendArray:other->childrenArray];
+    }
+  }
+  [self mergeUnknownFields:other.unknownFields];
+  return self;
+}
+- (TestMutableMessage_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input {
+  return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
+}
+- (TestMutableMessage_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  PBUnknownFieldSet_Builder* unknownFields = nil;
+  while (YES) {
+    int32_t tag = [input readTag];
+    switch (tag) {
+      case 0:
+        if (unknownFields != nil) {
+          [self setUnknownFields:[unknownFields build]];
+        }
+        return self;
+      default: {
+        if (PBWireFormatGetTagWireType(tag) == PBWireFormatEndGroup) {
+          if (unknownFields != nil) {
+            [self setUnknownFields:[unknownFields build]];
+          }
+          return self;
+        }
+        if (unknownFields == nil) {
+          unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+        }
+        [self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag];
+        break;
+      }
+      case 8: {
+        [self setInt32Value:[input readInt32]];
+        break;
+      }
+      case 18: {
+        NSString* value = [input newString];
+        [self setStringValue:value];
+        [value release];
+        break;
+      }
+      case 26: {
+        if (childBuilder_ == nil) {
+          childBuilder_ = childSpareBuilder_ != nil ? childSpareBuilder_ : [[TestMutableChild_Builder alloc] init];
+          childSpareBuilder_ = nil;
+          if (result->hasBits_[0] & 0x4u) {
+            [childBuilder_ mergeFrom:result->child];
+          }
+          result->hasBits_[0] |= 0x4u;
+        }
+        [input readMessage:childBuilder_ extensionRegistry:extensionRegistry];
+        break;
+      }
+      case 32: {
+        if (result->numbersArray == nil) {
+          result.numbersArray = [PBInt32Array array];
+        }
+        PBInt32Array *values = result->numbersArray;
+        const int32_t count = [input countBufferedRepeatedField:32];
+        [values reserveCapacity:values.count + count inArena:input.arena];
+        PBInt32ArrayAddValue(values, [input readInt32]);
+        for (int32_t i = 1; i < count; ++i) {
+          [input readTag];
+          PBInt32ArrayAddValue(values, [input readInt32]);
+        }
+        break;
+      }
+      case 42: {
+        TestMutableChild_Builder* subBuilder = [[TestMutableChild_Builder alloc] init];
+        @try {
+          [input readMessage:subBuilder extensionRegistry:extensionRegistry];
+          TestMutableChild* value = [subBuilder newBuildPartial];
+          [self addChildren:value];
+          [value release];
+        } @finally {
+          [subBuilder release];
+        }
+        break;
+      }
+    }
+  }
+}
+- (BOOL) hasInt32Value {
+  return (result->hasBits_[0] & 0x1u) != 0;
+}
+- (int32_t) int32Value {
+  return result->int32Value;
+}
+- (TestMutableMessage_Builder*) setInt32Value:(int32_t) value {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x1u;
+  result->int32Value = value;
+  return self;
+}
+- (TestMutableMessage_Builder*) clearInt32Value {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x1u;
+  result->int32Value = 0;
+  return self;
+}
+- (BOOL) hasStringValue {
+  return (result->hasBits_[0] & 0x2u) != 0;
+}
+- (NSString*) stringValue {
+  return [result stringValue];
+}
+- (TestMutableMessage_Builder*) setStringValue:(NSString*) value {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x2u;
+  result.stringValue = value;
+  return self;
+}
+- (TestMutableMessage_Builder*) clearStringValue {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x2u;
+  [result->stringValue release];
+  result->stringValue = nil;
+  return self;
+}
+- (BOOL) hasChild {
+  return (result->hasBits_[0] & 0x4u) != 0;
+}
+- (TestMutableChild*) child {
+  [self freezeSubBuilders];
+  return result.child;
+}
+- (TestMutableMessage_Builder*) setChild:(TestMutableChild*) value {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  [childBuilder_ release];
+  childBuilder_ = nil;
+  result->hasBits_[0] |= 0x4u;
+  result.child = value;
+  return self;
+}
+- (TestMutableMessage_Builder*) setChildBuilder:(TestMutableChild_Builder*) builderForValue {
+  return [self setChild:[builderForValue build]];
+}
+- (TestMutableMessage_Builder*) mergeChild:(TestMutableChild*) value {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (childBuilder_ == nil) {
+    if (!(result->hasBits_[0] & 0x4u) ||
+        result->child == [TestMutableChild defaultInstance]) {
+      result->hasBits_[0] |= 0x4u;
+      result.child = value;
+      return self;
+    }
+    childBuilder_ = childSpareBuilder_ != nil ? childSpareBuilder_ : [[TestMutableChild_Builder alloc] init];
+    childSpareBuilder_ = nil;
+    [childBuilder_ mergeFrom:result->child];
+  }
+  [childBuilder_ mergeFrom:value];
+  return self;
+}
+- (TestMutableMessage_Builder*) clearChild {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  [childBuilder_ release];
+  childBuilder_ = nil;
+  result->hasBits_[0] &= ~0x4u;
+  [result->child release];
+  result->child = nil;
+  return self;
+}
+- (PBAppendableArray *)numbers {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return result->numbersArray;
+}
+- (int32_t)numbersAtIndex:(NSUInteger)index {
+  return [result numbersAtIndex:index];
+}
+- (TestMutableMessage_Builder *)addNumbers:(int32_t)value {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (result->numbersArray == nil) {
+    result.numbersArray = [PBInt32Array array];
+  }
+  PBInt32ArrayAddValue(result->numbersArray, value);
+  return self;
+}
+- (TestMutableMessage_Builder *)setNumbersArray:(NSArray *)array {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.numbersArray = [PBInt32Array arrayWithArray:array valueType:PBArrayValueTypeInt32];
+  return self;
+}
+- (TestMutableMessage_Builder *)setNumbers:(PBArray *)array {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.numbersArray = array ? [PBInt32Array arrayWithStorageOfArray:array] : nil;
+  return self;
+}
+- (TestMutableMessage_Builder *)setNumbersValues:(const int32_t *)values count:(NSUInteger)count {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.numbersArray = [PBInt32Array arrayWithValues:values count:count valueType:PBArrayValueTypeInt32];
+  return self;
+}
+- (TestMutableMessage_Builder *)clearNumbers {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.numbersArray = nil;
+  return self;
+}
+- (PBAppendableArray *)children {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return result->childrenArray;
+}
+- (TestMutableChild*)childrenAtIndex:(NSUInteger)index {
+  return [result childrenAtIndex:index];
+}
+- (TestMutableMessage_Builder *)addChildren:(TestMutableChild*)value {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (result->childrenArray == nil) {
+    result.childrenArray = [PBObjectArray array];
+  }
+  PBObjectArrayAddValue(result->childrenArray, value);
+  return self;
+}
+- (TestMutableMessage_Builder *)setChildrenArray:(NSArray *)array {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.childrenArray = [PBObjectArray arrayWithArray:array valueType:PBArrayValueTypeObject];
+  return self;
+}
+- (TestMutableMessage_Builder *)setChildrenValues:(const TestMutableChild* *)values count:(NSUInteger)count {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.childrenArray = [PBObjectArray arrayWithValues:values count:count valueType:PBArrayValueTypeObject];
+  return self;
+}
+- (TestMutableMessage_Builder *)clearChildren {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result.childrenArray = nil;
+  return self;
+}
+@end
+
@@ -31,12 +31,12 @@ BOOL TestEnumIsValidValue(TestEnum value);
 @end
 
 @interface TestMessage : PBExtendableMessage {
-@private
-  BOOL hasA_:1;
+@package
+  uint32_t hasBits_[1];
   int32_t a;
 }
 - (BOOL) hasA;
-@property (readonly) int32_t a;
+@property (nonatomic, readonly) int32_t a;
 
 + (TestMessage*) defaultInstance;
 - (TestMessage*) defaultInstance;
@@ -59,15 +59,24 @@ BOOL TestEnumIsValidValue(TestEnum value);
 @interface TestMessage_Builder : PBExtendableMessage_Builder {
 @private
   TestMessage* result;
+  TestMessage* prototype_;
 }
 
 - (TestMessage*) defaultInstance;
 
 - (TestMessage_Builder*) clear;
 - (TestMessage_Builder*) clone;
+- (TestMessage_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (TestMessage_Builder*) recycle:(TestMessage*) message;
 
 - (TestMessage*) build;
 - (TestMessage*) buildPartial;
+- (TestMessage*) newBuildPartial;
 
 - (TestMessage_Builder*) mergeFrom:(TestMessage*) other;
 - (TestMessage_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
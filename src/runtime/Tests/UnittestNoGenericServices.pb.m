@@ -6,6 +6,12 @@
 static id<PBExtensionField> UnittestNoGenericServicesRoot_testExtension = nil;
 static PBExtensionRegistry* extensionRegistry = nil;
 + (PBExtensionRegistry*) extensionRegistry {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    PBMutableExtensionRegistry* registry = [PBMutableExtensionRegistry registry];
+    [UnittestNoGenericServicesRoot registerAllExtensions:registry];
+    extensionRegistry = [registry retain];
+  });
   return extensionRegistry;
 }
 
@@ -20,9 +26,6 @@ static PBExtensionRegistry* extensionRegistry = nil;
                                         isRepeated:NO
                                           isPacked:NO
                             isMessageSetWireFormat:NO] retain];
-    PBMutableExtensionRegistry* registry = [PBMutableExtensionRegistry registry];
-    [self registerAllExtensions:registry];
-    extensionRegistry = [registry retain];
   }
 }
 + (void) registerAllExtensions:(PBMutableExtensionRegistry*) registry {
@@ -42,48 +45,63 @@ BOOL TestEnumIsValidValue(TestEnum value) {
   }
 }
 @interface TestMessage ()
-@property int32_t a;
+@property (nonatomic) int32_t a;
+- (void) setInitialized;
+@end
+
+@interface TestMessage_Builder()
+@property (nonatomic, retain) TestMessage* result;
+- (id) initWithPrototype:(TestMessage*) prototype;
+- (void) detachFromPrototype;
 @end
 
 @implementation TestMessage
 
 - (BOOL) hasA {
-  return !!hasA_;
+  return (hasBits_[0] & 0x1u) != 0;
 }
-- (void) setHasA:(BOOL) value {
-  hasA_ = !!value;
+- (void) setHasA:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x1u;
+  } else {
+    hasBits_[0] &= ~0x1u;
+  }
 }
 @synthesize a;
 - (void) dealloc {
   [super dealloc];
 }
-- (id) init {
-  if ((self = [super init])) {
-    self.a = 0;
-  }
-  return self;
+- (void) clearForReuse {
+  [super clearForReuse];
+  memset(hasBits_, 0, sizeof(hasBits_));
+  a = 0;
 }
 static TestMessage* defaultTestMessageInstance = nil;
-+ (void) initialize {
-  if (self == [TestMessage class]) {
-    defaultTestMessageInstance = [[TestMessage alloc] init];
-  }
-}
 + (TestMessage*) defaultInstance {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultTestMessageInstance = [[TestMessage alloc] init];
+  });
   return defaultTestMessageInstance;
 }
 - (TestMessage*) defaultInstance {
-  return defaultTestMessageInstance;
+  return [TestMessage defaultInstance];
+}
+- (void) setInitialized {
+  hasBits_[0] |= 0x2u;
 }
 - (BOOL) isInitialized {
+  if ((hasBits_[0] & 0x2u) != 0) {
+    return YES;
+  }
   if (!self.extensionsAreInitialized) {
     return NO;
   }
   return YES;
 }
 - (void) writeToCodedOutputStream:(PBCodedOutputStream*) output {
-  if (self.hasA) {
-    [output writeInt32:1 value:self.a];
+  if (hasBits_[0] & 0x1u) {
+    [output writeInt32:1 value:a];
   }
   [self writeExtensionsToCodedOutputStream:output
                                       from:1000
@@ -91,19 +109,19 @@ static TestMessage* defaultTestMessageInstance = nil;
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = PBGeneratedMessageGetMemoizedSize(&memoizedSerializedSize);
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
-  if (self.hasA) {
-    size += computeInt32Size(1, self.a);
+  size_ = 0;
+  if (hasBits_[0] & 0x1u) {
+    size_ += computeInt32Size(1, a);
   }
-  size += [self extensionsSerializedSize];
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
+  size_ += [self extensionsSerializedSize];
+  size_ += self.unknownFields.serializedSize;
+  PBGeneratedMessageSetMemoizedSize(&memoizedSerializedSize, size_);
+  return size_;
 }
 + (TestMessage*) parseFromData:(NSData*) data {
   return (TestMessage*)[[[TestMessage builder] mergeFromData:data] build];
@@ -127,7 +145,7 @@ static TestMessage* defaultTestMessageInstance = nil;
   return [[[TestMessage_Builder alloc] init] autorelease];
 }
 + (TestMessage_Builder*) builderWithPrototype:(TestMessage*) prototype {
-  return [[TestMessage builder] mergeFrom:prototype];
+  return [[[TestMessage_Builder alloc] initWithPrototype:prototype] autorelease];
 }
 - (TestMessage_Builder*) builder {
   return [TestMessage builder];
@@ -136,8 +154,8 @@ static TestMessage* defaultTestMessageInstance = nil;
   return [TestMessage builderWithPrototype:self];
 }
 - (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
-  if (self.hasA) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"a", [NSNumber numberWithInt:self.a]];
+  if (hasBits_[0] & 0x1u) {
+    [output appendFormat:@"%@%@: %@\n", indent, @"a", [NSNumber numberWithInt:a]];
   }
   [self writeExtensionDescriptionToMutableString:(NSMutableString*)output
                                             from:1000
@@ -154,68 +172,139 @@ static TestMessage* defaultTestMessageInstance = nil;
   }
   TestMessage *otherMessage = other;
   return
-      self.hasA == otherMessage.hasA &&
-      (!self.hasA || self.a == otherMessage.a) &&
-      
+      (hasBits_[0] & 0x1u) == (otherMessage->hasBits_[0] & 0x1u) &&
+      (!(hasBits_[0] & 0x1u) || a == otherMessage->a) &&
       [self isEqualExtensionsInOther:otherMessage from:1000 to:536870912] &&
-      
+
       (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
 }
 - (NSUInteger) hash {
-  NSUInteger hashCode = 7;
-  if (self.hasA) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithInt:self.a] hash];
+  NSUInteger hash_ = PBGeneratedMessageGetMemoizedHash(&memoizedHash);
+  if (hash_ != 0) {
+    return hash_;
   }
-  hashCode = hashCode * 31 + [self hashExtensionsFrom:1000 to:536870912];
-  hashCode = hashCode * 31 + [self.unknownFields hash];
-  return hashCode;
-}
-@end
 
-@interface TestMessage_Builder()
-@property (retain) TestMessage* result;
+  uint64_t hashCode = 7;
+  if (hasBits_[0] & 0x1u) {
+    hashCode = PBGeneratedMessageHashMix(hashCode, (uint64_t)a);
+  }
+  hashCode = PBGeneratedMessageHashMix(hashCode, [self hashExtensionsFrom:1000 to:536870912]);
+  hashCode = PBGeneratedMessageHashMix(hashCode, [self.unknownFields hash]);
+  hash_ = PBGeneratedMessageHashFinish(hashCode);
+  PBGeneratedMessageSetMemoizedHash(&memoizedHash, hash_);
+  return hash_;
+}
 @end
 
 @implementation TestMessage_Builder
 @synthesize result;
 - (void) dealloc {
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
   self.result = nil;
+  [prototype_ release];
   [super dealloc];
 }
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[[TestMessage alloc] init] autorelease];
+    result = [TestMessage recycledInstance];
   }
   return self;
 }
+- (id) initWithPrototype:(TestMessage*) prototype {
+  if ((self = [super init])) {
+    self.result = prototype;
+    prototype_ = [prototype retain];
+  }
+  return self;
+}
+- (void) detachFromPrototype {
+  TestMessage* prototype = prototype_;
+  prototype_ = nil;
+  self.result = [[[TestMessage alloc] init] autorelease];
+  [self mergeFrom:prototype];
+  [prototype release];
+}
+- (PBExtendableMessage*) internalGetMutableResult {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return [self internalGetResult];
+}
 - (PBExtendableMessage*) internalGetResult {
   return result;
 }
 - (TestMessage_Builder*) clear {
-  self.result = [[[TestMessage alloc] init] autorelease];
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = [[TestMessage recycledInstance] autorelease];
   return self;
 }
 - (TestMessage_Builder*) clone {
-  return [TestMessage builderWithPrototype:result];
+  if (prototype_ != nil) {
+    return [[[TestMessage_Builder alloc] initWithPrototype:prototype_] autorelease];
+  }
+  return [[TestMessage builder] mergeFrom:result];
+}
+- (TestMessage_Builder*) reset {
+  if (result == nil || prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    self.result = [[TestMessage recycledInstance] autorelease];
+  } else {
+    [result clearForReuse];
+  }
+  return self;
+}
+- (TestMessage_Builder*) recycle:(TestMessage*) message {
+  if (message == [TestMessage defaultInstance]) {
+    @throw [NSException exceptionWithName:@"IllegalArgument" reason:@"Cannot recycle the default instance" userInfo:nil];
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = message;
+  return [self reset];
 }
 - (TestMessage*) defaultInstance {
   return [TestMessage defaultInstance];
 }
 - (TestMessage*) build {
   [self checkInitialized];
-  return [self buildPartial];
+  BOOL shared = prototype_ != nil;
+  TestMessage* returnMe = [self buildPartial];
+  if (!shared) {
+    [returnMe setInitialized];
+  }
+  return returnMe;
 }
 - (TestMessage*) buildPartial {
-  TestMessage* returnMe = [[result retain] autorelease];
-  self.result = nil;
+  return [[self newBuildPartial] autorelease];
+}
+- (TestMessage*) newBuildPartial {
+  if (prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    TestMessage* returnMe = result;
+    result = nil;
+    return returnMe;
+  }
+  TestMessage* returnMe = result;
+  result = nil;
   return returnMe;
 }
 - (TestMessage_Builder*) mergeFrom:(TestMessage*) other {
   if (other == [TestMessage defaultInstance]) {
     return self;
   }
-  if (other.hasA) {
-    [self setA:other.a];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (other->hasBits_[0] & 0x1u) {
+    [self setA:other->a];
   }
   [self mergeExtensionFields:other];
   [self mergeUnknownFields:other.unknownFields];
@@ -225,18 +314,29 @@ static TestMessage* defaultTestMessageInstance = nil;
   return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
 }
 - (TestMessage_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  PBUnknownFieldSet_Builder* unknownFields = nil;
   while (YES) {
     int32_t tag = [input readTag];
     switch (tag) {
       case 0:
-        [self setUnknownFields:[unknownFields build]];
+        if (unknownFields != nil) {
+          [self setUnknownFields:[unknownFields build]];
+        }
         return self;
       default: {
-        if (![self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag]) {
-          [self setUnknownFields:[unknownFields build]];
+        if (PBWireFormatGetTagWireType(tag) == PBWireFormatEndGroup) {
+          if (unknownFields != nil) {
+            [self setUnknownFields:[unknownFields build]];
+          }
           return self;
         }
+        if (unknownFields == nil) {
+          unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
+        }
+        [self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag];
         break;
       }
       case 8: {
@@ -247,19 +347,25 @@ static TestMessage* defaultTestMessageInstance = nil;
   }
 }
 - (BOOL) hasA {
-  return result.hasA;
+  return (result->hasBits_[0] & 0x1u) != 0;
 }
 - (int32_t) a {
-  return result.a;
+  return result->a;
 }
 - (TestMessage_Builder*) setA:(int32_t) value {
-  result.hasA = YES;
-  result.a = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x1u;
+  result->a = value;
   return self;
 }
 - (TestMessage_Builder*) clearA {
-  result.hasA = NO;
-  result.a = 0;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x1u;
+  result->a = 0;
   return self;
 }
 @end
@@ -114,16 +114,15 @@
 @end
 
 @interface TestOptimizedForSize : PBExtendableMessage {
-@private
-  BOOL hasI_:1;
-  BOOL hasMsg_:1;
+@package
+  uint32_t hasBits_[1];
   int32_t i;
   ForeignMessage* msg;
 }
 - (BOOL) hasI;
 - (BOOL) hasMsg;
-@property (readonly) int32_t i;
-@property (readonly, retain) ForeignMessage* msg;
+@property (nonatomic, readonly) int32_t i;
+@property (nonatomic, readonly, retain) ForeignMessage* msg;
 
 + (TestOptimizedForSize*) defaultInstance;
 - (TestOptimizedForSize*) defaultInstance;
@@ -148,15 +147,26 @@
 @interface TestOptimizedForSize_Builder : PBExtendableMessage_Builder {
 @private
   TestOptimizedForSize* result;
+  TestOptimizedForSize* prototype_;
+  ForeignMessage_Builder* msgBuilder_;
+  ForeignMessage_Builder* msgSpareBuilder_;
 }
 
 - (TestOptimizedForSize*) defaultInstance;
 
 - (TestOptimizedForSize_Builder*) clear;
 - (TestOptimizedForSize_Builder*) clone;
+- (TestOptimizedForSize_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (TestOptimizedForSize_Builder*) recycle:(TestOptimizedForSize*) message;
 
 - (TestOptimizedForSize*) build;
 - (TestOptimizedForSize*) buildPartial;
+- (TestOptimizedForSize*) newBuildPartial;
 
 - (TestOptimizedForSize_Builder*) mergeFrom:(TestOptimizedForSize*) other;
 - (TestOptimizedForSize_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -176,12 +186,12 @@
 @end
 
 @interface TestRequiredOptimizedForSize : PBGeneratedMessage {
-@private
-  BOOL hasX_:1;
+@package
+  uint32_t hasBits_[1];
   int32_t x;
 }
 - (BOOL) hasX;
-@property (readonly) int32_t x;
+@property (nonatomic, readonly) int32_t x;
 
 + (TestRequiredOptimizedForSize*) defaultInstance;
 - (TestRequiredOptimizedForSize*) defaultInstance;
@@ -204,15 +214,24 @@
 @interface TestRequiredOptimizedForSize_Builder : PBGeneratedMessage_Builder {
 @private
   TestRequiredOptimizedForSize* result;
+  TestRequiredOptimizedForSize* prototype_;
 }
 
 - (TestRequiredOptimizedForSize*) defaultInstance;
 
 - (TestRequiredOptimizedForSize_Builder*) clear;
 - (TestRequiredOptimizedForSize_Builder*) clone;
+- (TestRequiredOptimizedForSize_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (TestRequiredOptimizedForSize_Builder*) recycle:(TestRequiredOptimizedForSize*) message;
 
 - (TestRequiredOptimizedForSize*) build;
 - (TestRequiredOptimizedForSize*) buildPartial;
+- (TestRequiredOptimizedForSize*) newBuildPartial;
 
 - (TestRequiredOptimizedForSize_Builder*) mergeFrom:(TestRequiredOptimizedForSize*) other;
 - (TestRequiredOptimizedForSize_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
@@ -225,12 +244,12 @@
 @end
 
 @interface TestOptionalOptimizedForSize : PBGeneratedMessage {
-@private
-  BOOL hasO_:1;
+@package
+  uint32_t hasBits_[1];
   TestRequiredOptimizedForSize* o;
 }
 - (BOOL) hasO;
-@property (readonly, retain) TestRequiredOptimizedForSize* o;
+@property (nonatomic, readonly, retain) TestRequiredOptimizedForSize* o;
 
 + (TestOptionalOptimizedForSize*) defaultInstance;
 - (TestOptionalOptimizedForSize*) defaultInstance;
@@ -253,15 +272,26 @@
 @interface TestOptionalOptimizedForSize_Builder : PBGeneratedMessage_Builder {
 @private
   TestOptionalOptimizedForSize* result;
+  TestOptionalOptimizedForSize* prototype_;
+  TestRequiredOptimizedForSize_Builder* oBuilder_;
+  TestRequiredOptimizedForSize_Builder* oSpareBuilder_;
 }
 
 - (TestOptionalOptimizedForSize*) defaultInstance;
 
 - (TestOptionalOptimizedForSize_Builder*) clear;
 - (TestOptionalOptimizedForSize_Builder*) clone;
+- (TestOptionalOptimizedForSize_Builder*) reset;
+/**
+ * Clears message in place and makes it the result.  The caller must own
+ * the only reference to message: nothing else may hold it, including an
+ * enclosing message or a builder made from it with toBuilder.
+ */
+- (TestOptionalOptimizedForSize_Builder*) recycle:(TestOptionalOptimizedForSize*) message;
 
 - (TestOptionalOptimizedForSize*) build;
 - (TestOptionalOptimizedForSize*) buildPartial;
+- (TestOptionalOptimizedForSize*) newBuildPartial;
 
 - (TestOptionalOptimizedForSize_Builder*) mergeFrom:(TestOptionalOptimizedForSize*) other;
 - (TestOptionalOptimizedForSize_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
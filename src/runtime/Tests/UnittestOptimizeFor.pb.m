@@ -7,6 +7,13 @@ static id<PBExtensionField> TestOptimizedForSize_testExtension = nil;
 static id<PBExtensionField> TestOptimizedForSize_testExtension2 = nil;
 static PBExtensionRegistry* extensionRegistry = nil;
 + (PBExtensionRegistry*) extensionRegistry {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    PBMutableExtensionRegistry* registry = [PBMutableExtensionRegistry registry];
+    [UnittestOptimizeForRoot registerAllExtensions:registry];
+    [UnittestRoot registerAllExtensions:registry];
+    extensionRegistry = [registry retain];
+  });
   return extensionRegistry;
 }
 
@@ -30,10 +37,6 @@ static PBExtensionRegistry* extensionRegistry = nil;
                                         isRepeated:NO
                                           isPacked:NO
                             isMessageSetWireFormat:NO] retain];
-    PBMutableExtensionRegistry* registry = [PBMutableExtensionRegistry registry];
-    [self registerAllExtensions:registry];
-    [UnittestRoot registerAllExtensions:registry];
-    extensionRegistry = [registry retain];
   }
 }
 + (void) registerAllExtensions:(PBMutableExtensionRegistry*) registry {
@@ -42,37 +45,69 @@ static PBExtensionRegistry* extensionRegistry = nil;
 }
 @end
 
+static PBFieldTableEntry TestOptimizedForSize_fieldEntries[] = {
+  { 1, PBExtensionTypeInt32, 0, 0, "i", NULL, NULL },
+  { 19, PBExtensionTypeMessage, 0, 1, "msg", "ForeignMessage_Builder", NULL },
+};
+static const int32_t TestOptimizedForSize_extensionRanges[] = {
+  1000, 536870912,
+};
+static PBFieldTable TestOptimizedForSize_fieldTable = {
+  TestOptimizedForSize_fieldEntries, 2, TestOptimizedForSize_extensionRanges, 1
+};
+
 @interface TestOptimizedForSize ()
-@property int32_t i;
-@property (retain) ForeignMessage* msg;
+@property (nonatomic) int32_t i;
+@property (nonatomic, retain) ForeignMessage* msg;
+- (void) setInitialized;
+@end
+
+@interface TestOptimizedForSize_Builder()
+@property (nonatomic, retain) TestOptimizedForSize* result;
+- (id) initWithPrototype:(TestOptimizedForSize*) prototype;
+- (void) detachFromPrototype;
+- (void) freezeSubBuilders;
+- (void) dropSubBuilders;
+- (void) resetSubBuilders;
 @end
 
 @implementation TestOptimizedForSize
 
 - (BOOL) hasI {
-  return !!hasI_;
+  return (hasBits_[0] & 0x1u) != 0;
 }
-- (void) setHasI:(BOOL) value {
-  hasI_ = !!value;
+- (void) setHasI:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x1u;
+  } else {
+    hasBits_[0] &= ~0x1u;
+  }
 }
 @synthesize i;
 - (BOOL) hasMsg {
-  return !!hasMsg_;
+  return (hasBits_[0] & 0x2u) != 0;
 }
-- (void) setHasMsg:(BOOL) value {
-  hasMsg_ = !!value;
+- (void) setHasMsg:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x2u;
+  } else {
+    hasBits_[0] &= ~0x2u;
+  }
 }
 @synthesize msg;
+- (ForeignMessage*) msg {
+  return msg != nil ? msg : [ForeignMessage defaultInstance];
+}
 - (void) dealloc {
-  self.msg = nil;
+  [msg release];
   [super dealloc];
 }
-- (id) init {
-  if ((self = [super init])) {
-    self.i = 0;
-    self.msg = [ForeignMessage defaultInstance];
-  }
-  return self;
+- (void) clearForReuse {
+  [super clearForReuse];
+  memset(hasBits_, 0, sizeof(hasBits_));
+  i = 0;
+  [msg release];
+  msg = nil;
 }
 + (id<PBExtensionField>) testExtension {
   return TestOptimizedForSize_testExtension;
@@ -80,53 +115,49 @@ static PBExtensionRegistry* extensionRegistry = nil;
 + (id<PBExtensionField>) testExtension2 {
   return TestOptimizedForSize_testExtension2;
 }
-static TestOptimizedForSize* defaultTestOptimizedForSizeInstance = nil;
 + (void) initialize {
   if (self == [TestOptimizedForSize class]) {
-    defaultTestOptimizedForSizeInstance = [[TestOptimizedForSize alloc] init];
+    PBFieldTableResolve(&TestOptimizedForSize_fieldTable, self);
   }
 }
+static TestOptimizedForSize* defaultTestOptimizedForSizeInstance = nil;
 + (TestOptimizedForSize*) defaultInstance {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultTestOptimizedForSizeInstance = [[TestOptimizedForSize alloc] init];
+  });
   return defaultTestOptimizedForSizeInstance;
 }
 - (TestOptimizedForSize*) defaultInstance {
-  return defaultTestOptimizedForSizeInstance;
+  return [TestOptimizedForSize defaultInstance];
+}
+- (void) setInitialized {
+  hasBits_[0] |= 0x4u;
 }
 - (BOOL) isInitialized {
+  if ((hasBits_[0] & 0x4u) != 0) {
+    return YES;
+  }
   if (!self.extensionsAreInitialized) {
     return NO;
   }
   return YES;
 }
 - (void) writeToCodedOutputStream:(PBCodedOutputStream*) output {
-  if (self.hasI) {
-    [output writeInt32:1 value:self.i];
-  }
-  if (self.hasMsg) {
-    [output writeMessage:19 value:self.msg];
-  }
-  [self writeExtensionsToCodedOutputStream:output
-                                      from:1000
-                                        to:536870912];
+  PBFieldTableWriteTo(&TestOptimizedForSize_fieldTable, self, output);
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = PBGeneratedMessageGetMemoizedSize(&memoizedSerializedSize);
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
-  if (self.hasI) {
-    size += computeInt32Size(1, self.i);
-  }
-  if (self.hasMsg) {
-    size += computeMessageSize(19, self.msg);
-  }
-  size += [self extensionsSerializedSize];
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
+  size_ = PBFieldTableSerializedSize(&TestOptimizedForSize_fieldTable, self);
+  size_ += [self extensionsSerializedSize];
+  size_ += self.unknownFields.serializedSize;
+  PBGeneratedMessageSetMemoizedSize(&memoizedSerializedSize, size_);
+  return size_;
 }
 + (TestOptimizedForSize*) parseFromData:(NSData*) data {
   return (TestOptimizedForSize*)[[[TestOptimizedForSize builder] mergeFromData:data] build];
@@ -150,7 +181,7 @@ static TestOptimizedForSize* defaultTestOptimizedForSizeInstance = nil;
   return [[[TestOptimizedForSize_Builder alloc] init] autorelease];
 }
 + (TestOptimizedForSize_Builder*) builderWithPrototype:(TestOptimizedForSize*) prototype {
-  return [[TestOptimizedForSize builder] mergeFrom:prototype];
+  return [[[TestOptimizedForSize_Builder alloc] initWithPrototype:prototype] autorelease];
 }
 - (TestOptimizedForSize_Builder*) builder {
   return [TestOptimizedForSize builder];
@@ -159,12 +190,12 @@ static TestOptimizedForSize* defaultTestOptimizedForSizeInstance = nil;
   return [TestOptimizedForSize builderWithPrototype:self];
 }
 - (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
-  if (self.hasI) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"i", [NSNumber numberWithInt:self.i]];
+  if (hasBits_[0] & 0x1u) {
+    [output appendFormat:@"%@%@: %@\n", indent, @"i", [NSNumber numberWithInt:i]];
   }
-  if (self.hasMsg) {
+  if (hasBits_[0] & 0x2u) {
     [output appendFormat:@"%@%@ {\n", indent, @"msg"];
-    [self.msg writeDescriptionTo:output
+    [msg writeDescriptionTo:output
                          withIndent:[NSString stringWithFormat:@"%@  ", indent]];
     [output appendFormat:@"%@}\n", indent];
   }
@@ -183,77 +214,166 @@ static TestOptimizedForSize* defaultTestOptimizedForSizeInstance = nil;
   }
   TestOptimizedForSize *otherMessage = other;
   return
-      self.hasI == otherMessage.hasI &&
-      (!self.hasI || self.i == otherMessage.i) &&
-      
-      self.hasMsg == otherMessage.hasMsg &&
-      (!self.hasMsg || [self.msg isEqual:otherMessage.msg]) &&
-      
+      PBFieldTableIsEqual(&TestOptimizedForSize_fieldTable, self, otherMessage) &&
       [self isEqualExtensionsInOther:otherMessage from:1000 to:536870912] &&
-      
       (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
 }
 - (NSUInteger) hash {
-  NSUInteger hashCode = 7;
-  if (self.hasI) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithInt:self.i] hash];
+  NSUInteger hash_ = PBGeneratedMessageGetMemoizedHash(&memoizedHash);
+  if (hash_ != 0) {
+    return hash_;
   }
-  if (self.hasMsg) {
-    hashCode = hashCode * 31 + [self.msg hash];
-  }
-  hashCode = hashCode * 31 + [self hashExtensionsFrom:1000 to:536870912];
-  hashCode = hashCode * 31 + [self.unknownFields hash];
-  return hashCode;
-}
-@end
 
-@interface TestOptimizedForSize_Builder()
-@property (retain) TestOptimizedForSize* result;
+  uint64_t hashCode = PBFieldTableHash(&TestOptimizedForSize_fieldTable, self);
+  hashCode = PBGeneratedMessageHashMix(hashCode, [self hashExtensionsFrom:1000 to:536870912]);
+  hashCode = PBGeneratedMessageHashMix(hashCode, [self.unknownFields hash]);
+  hash_ = PBGeneratedMessageHashFinish(hashCode);
+  PBGeneratedMessageSetMemoizedHash(&memoizedHash, hash_);
+  return hash_;
+}
 @end
 
 @implementation TestOptimizedForSize_Builder
 @synthesize result;
 - (void) dealloc {
+  [self dropSubBuilders];
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
   self.result = nil;
+  [prototype_ release];
   [super dealloc];
 }
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[[TestOptimizedForSize alloc] init] autorelease];
+    result = [TestOptimizedForSize recycledInstance];
+  }
+  return self;
+}
+- (id) initWithPrototype:(TestOptimizedForSize*) prototype {
+  if ((self = [super init])) {
+    self.result = prototype;
+    prototype_ = [prototype retain];
   }
   return self;
 }
+- (void) detachFromPrototype {
+  TestOptimizedForSize* prototype = prototype_;
+  prototype_ = nil;
+  self.result = [[[TestOptimizedForSize alloc] init] autorelease];
+  [self mergeFrom:prototype];
+  [prototype release];
+}
+- (PBExtendableMessage*) internalGetMutableResult {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return [self internalGetResult];
+}
+- (void) freezeSubBuilders {
+  if (msgBuilder_ != nil) {
+    ForeignMessage* value = [msgBuilder_ newBuildPartial];
+    result.msg = value;
+    [value release];
+    [msgBuilder_ release];
+    msgBuilder_ = nil;
+  }
+}
+- (void) dropSubBuilders {
+  [msgBuilder_ release];
+  msgBuilder_ = nil;
+  [msgSpareBuilder_ release];
+  msgSpareBuilder_ = nil;
+}
+- (void) resetSubBuilders {
+  if (msgBuilder_ != nil) {
+    [msgBuilder_ reset];
+    [msgSpareBuilder_ release];
+    msgSpareBuilder_ = msgBuilder_;
+    msgBuilder_ = nil;
+  }
+}
 - (PBExtendableMessage*) internalGetResult {
+  [self freezeSubBuilders];
   return result;
 }
 - (TestOptimizedForSize_Builder*) clear {
-  self.result = [[[TestOptimizedForSize alloc] init] autorelease];
+  [self dropSubBuilders];
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = [[TestOptimizedForSize recycledInstance] autorelease];
   return self;
 }
 - (TestOptimizedForSize_Builder*) clone {
-  return [TestOptimizedForSize builderWithPrototype:result];
+  if (prototype_ != nil) {
+    return [[[TestOptimizedForSize_Builder alloc] initWithPrototype:prototype_] autorelease];
+  }
+  [self freezeSubBuilders];
+  return [[TestOptimizedForSize builder] mergeFrom:result];
+}
+- (TestOptimizedForSize_Builder*) reset {
+  [self resetSubBuilders];
+  if (result == nil || prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    self.result = [[TestOptimizedForSize recycledInstance] autorelease];
+  } else {
+    [result clearForReuse];
+  }
+  return self;
+}
+- (TestOptimizedForSize_Builder*) recycle:(TestOptimizedForSize*) message {
+  if (message == [TestOptimizedForSize defaultInstance]) {
+    @throw [NSException exceptionWithName:@"IllegalArgument" reason:@"Cannot recycle the default instance" userInfo:nil];
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = message;
+  return [self reset];
 }
 - (TestOptimizedForSize*) defaultInstance {
   return [TestOptimizedForSize defaultInstance];
 }
 - (TestOptimizedForSize*) build {
   [self checkInitialized];
-  return [self buildPartial];
+  BOOL shared = prototype_ != nil;
+  TestOptimizedForSize* returnMe = [self buildPartial];
+  if (!shared) {
+    [returnMe setInitialized];
+  }
+  return returnMe;
 }
 - (TestOptimizedForSize*) buildPartial {
-  TestOptimizedForSize* returnMe = [[result retain] autorelease];
-  self.result = nil;
+  return [[self newBuildPartial] autorelease];
+}
+- (TestOptimizedForSize*) newBuildPartial {
+  if (prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    TestOptimizedForSize* returnMe = result;
+    result = nil;
+    return returnMe;
+  }
+  [self freezeSubBuilders];
+  TestOptimizedForSize* returnMe = result;
+  result = nil;
   return returnMe;
 }
 - (TestOptimizedForSize_Builder*) mergeFrom:(TestOptimizedForSize*) other {
   if (other == [TestOptimizedForSize defaultInstance]) {
     return self;
   }
-  if (other.hasI) {
-    [self setI:other.i];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (other->hasBits_[0] & 0x1u) {
+    [self setI:other->i];
   }
-  if (other.hasMsg) {
-    [self mergeMsg:other.msg];
+  if (other->hasBits_[0] & 0x2u) {
+    [self mergeMsg:other->msg];
   }
   [self mergeExtensionFields:other];
   [self mergeUnknownFields:other.unknownFields];
@@ -263,60 +383,49 @@ static TestOptimizedForSize* defaultTestOptimizedForSizeInstance = nil;
   return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
 }
 - (TestOptimizedForSize_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
-  while (YES) {
-    int32_t tag = [input readTag];
-    switch (tag) {
-      case 0:
-        [self setUnknownFields:[unknownFields build]];
-        return self;
-      default: {
-        if (![self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag]) {
-          [self setUnknownFields:[unknownFields build]];
-          return self;
-        }
-        break;
-      }
-      case 8: {
-        [self setI:[input readInt32]];
-        break;
-      }
-      case 154: {
-        ForeignMessage_Builder* subBuilder = [ForeignMessage builder];
-        if (self.hasMsg) {
-          [subBuilder mergeFrom:self.msg];
-        }
-        [input readMessage:subBuilder extensionRegistry:extensionRegistry];
-        [self setMsg:[subBuilder buildPartial]];
-        break;
-      }
-    }
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
+  [self freezeSubBuilders];
+  PBFieldTableMergeFromCodedInputStream(&TestOptimizedForSize_fieldTable, self, result, input, extensionRegistry);
+  return self;
 }
 - (BOOL) hasI {
-  return result.hasI;
+  return (result->hasBits_[0] & 0x1u) != 0;
 }
 - (int32_t) i {
-  return result.i;
+  return result->i;
 }
 - (TestOptimizedForSize_Builder*) setI:(int32_t) value {
-  result.hasI = YES;
-  result.i = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x1u;
+  result->i = value;
   return self;
 }
 - (TestOptimizedForSize_Builder*) clearI {
-  result.hasI = NO;
-  result.i = 0;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x1u;
+  result->i = 0;
   return self;
 }
 - (BOOL) hasMsg {
-  return result.hasMsg;
+  return (result->hasBits_[0] & 0x2u) != 0;
 }
 - (ForeignMessage*) msg {
+  [self freezeSubBuilders];
   return result.msg;
 }
 - (TestOptimizedForSize_Builder*) setMsg:(ForeignMessage*) value {
-  result.hasMsg = YES;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  [msgBuilder_ release];
+  msgBuilder_ = nil;
+  result->hasBits_[0] |= 0x2u;
   result.msg = value;
   return self;
 }
@@ -324,82 +433,117 @@ static TestOptimizedForSize* defaultTestOptimizedForSizeInstance = nil;
   return [self setMsg:[builderForValue build]];
 }
 - (TestOptimizedForSize_Builder*) mergeMsg:(ForeignMessage*) value {
-  if (result.hasMsg &&
-      result.msg != [ForeignMessage defaultInstance]) {
-    result.msg =
-      [[[ForeignMessage builderWithPrototype:result.msg] mergeFrom:value] buildPartial];
-  } else {
-    result.msg = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  result.hasMsg = YES;
+  if (msgBuilder_ == nil) {
+    if (!(result->hasBits_[0] & 0x2u) ||
+        result->msg == [ForeignMessage defaultInstance]) {
+      result->hasBits_[0] |= 0x2u;
+      result.msg = value;
+      return self;
+    }
+    msgBuilder_ = msgSpareBuilder_ != nil ? msgSpareBuilder_ : [[ForeignMessage_Builder alloc] init];
+    msgSpareBuilder_ = nil;
+    [msgBuilder_ mergeFrom:result->msg];
+  }
+  [msgBuilder_ mergeFrom:value];
   return self;
 }
 - (TestOptimizedForSize_Builder*) clearMsg {
-  result.hasMsg = NO;
-  result.msg = [ForeignMessage defaultInstance];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  [msgBuilder_ release];
+  msgBuilder_ = nil;
+  result->hasBits_[0] &= ~0x2u;
+  [result->msg release];
+  result->msg = nil;
   return self;
 }
 @end
 
+static PBFieldTableEntry TestRequiredOptimizedForSize_fieldEntries[] = {
+  { 1, PBExtensionTypeInt32, 0, 0, "x", NULL, NULL },
+};
+static PBFieldTable TestRequiredOptimizedForSize_fieldTable = {
+  TestRequiredOptimizedForSize_fieldEntries, 1, NULL, 0
+};
+
 @interface TestRequiredOptimizedForSize ()
-@property int32_t x;
+@property (nonatomic) int32_t x;
+- (void) setInitialized;
+@end
+
+@interface TestRequiredOptimizedForSize_Builder()
+@property (nonatomic, retain) TestRequiredOptimizedForSize* result;
+- (id) initWithPrototype:(TestRequiredOptimizedForSize*) prototype;
+- (void) detachFromPrototype;
 @end
 
 @implementation TestRequiredOptimizedForSize
 
 - (BOOL) hasX {
-  return !!hasX_;
+  return (hasBits_[0] & 0x1u) != 0;
 }
-- (void) setHasX:(BOOL) value {
-  hasX_ = !!value;
+- (void) setHasX:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x1u;
+  } else {
+    hasBits_[0] &= ~0x1u;
+  }
 }
 @synthesize x;
 - (void) dealloc {
   [super dealloc];
 }
-- (id) init {
-  if ((self = [super init])) {
-    self.x = 0;
-  }
-  return self;
+- (void) clearForReuse {
+  [super clearForReuse];
+  memset(hasBits_, 0, sizeof(hasBits_));
+  x = 0;
 }
-static TestRequiredOptimizedForSize* defaultTestRequiredOptimizedForSizeInstance = nil;
 + (void) initialize {
   if (self == [TestRequiredOptimizedForSize class]) {
-    defaultTestRequiredOptimizedForSizeInstance = [[TestRequiredOptimizedForSize alloc] init];
+    PBFieldTableResolve(&TestRequiredOptimizedForSize_fieldTable, self);
   }
 }
+static TestRequiredOptimizedForSize* defaultTestRequiredOptimizedForSizeInstance = nil;
 + (TestRequiredOptimizedForSize*) defaultInstance {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultTestRequiredOptimizedForSizeInstance = [[TestRequiredOptimizedForSize alloc] init];
+  });
   return defaultTestRequiredOptimizedForSizeInstance;
 }
 - (TestRequiredOptimizedForSize*) defaultInstance {
-  return defaultTestRequiredOptimizedForSizeInstance;
+  return [TestRequiredOptimizedForSize defaultInstance];
+}
+- (void) setInitialized {
+  hasBits_[0] |= 0x2u;
 }
 - (BOOL) isInitialized {
-  if (!self.hasX) {
+  if ((hasBits_[0] & 0x2u) != 0) {
+    return YES;
+  }
+  if ((hasBits_[0] & 0x1u) != 0x1u) {
     return NO;
   }
   return YES;
 }
 - (void) writeToCodedOutputStream:(PBCodedOutputStream*) output {
-  if (self.hasX) {
-    [output writeInt32:1 value:self.x];
-  }
+  PBFieldTableWriteTo(&TestRequiredOptimizedForSize_fieldTable, self, output);
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = PBGeneratedMessageGetMemoizedSize(&memoizedSerializedSize);
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
-  if (self.hasX) {
-    size += computeInt32Size(1, self.x);
-  }
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
+  size_ = PBFieldTableSerializedSize(&TestRequiredOptimizedForSize_fieldTable, self);
+  size_ += self.unknownFields.serializedSize;
+  PBGeneratedMessageSetMemoizedSize(&memoizedSerializedSize, size_);
+  return size_;
 }
 + (TestRequiredOptimizedForSize*) parseFromData:(NSData*) data {
   return (TestRequiredOptimizedForSize*)[[[TestRequiredOptimizedForSize builder] mergeFromData:data] build];
@@ -423,7 +567,7 @@ static TestRequiredOptimizedForSize* defaultTestRequiredOptimizedForSizeInstance
   return [[[TestRequiredOptimizedForSize_Builder alloc] init] autorelease];
 }
 + (TestRequiredOptimizedForSize_Builder*) builderWithPrototype:(TestRequiredOptimizedForSize*) prototype {
-  return [[TestRequiredOptimizedForSize builder] mergeFrom:prototype];
+  return [[[TestRequiredOptimizedForSize_Builder alloc] initWithPrototype:prototype] autorelease];
 }
 - (TestRequiredOptimizedForSize_Builder*) builder {
   return [TestRequiredOptimizedForSize builder];
@@ -432,8 +576,8 @@ static TestRequiredOptimizedForSize* defaultTestRequiredOptimizedForSizeInstance
   return [TestRequiredOptimizedForSize builderWithPrototype:self];
 }
 - (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
-  if (self.hasX) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"x", [NSNumber numberWithInt:self.x]];
+  if (hasBits_[0] & 0x1u) {
+    [output appendFormat:@"%@%@: %@\n", indent, @"x", [NSNumber numberWithInt:x]];
   }
   [self.unknownFields writeDescriptionTo:output withIndent:indent];
 }
@@ -446,65 +590,132 @@ static TestRequiredOptimizedForSize* defaultTestRequiredOptimizedForSizeInstance
   }
   TestRequiredOptimizedForSize *otherMessage = other;
   return
-      self.hasX == otherMessage.hasX &&
-      (!self.hasX || self.x == otherMessage.x) &&
-      
+      PBFieldTableIsEqual(&TestRequiredOptimizedForSize_fieldTable, self, otherMessage) &&
       (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
 }
 - (NSUInteger) hash {
-  NSUInteger hashCode = 7;
-  if (self.hasX) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithInt:self.x] hash];
+  NSUInteger hash_ = PBGeneratedMessageGetMemoizedHash(&memoizedHash);
+  if (hash_ != 0) {
+    return hash_;
   }
-  hashCode = hashCode * 31 + [self.unknownFields hash];
-  return hashCode;
-}
-@end
 
-@interface TestRequiredOptimizedForSize_Builder()
-@property (retain) TestRequiredOptimizedForSize* result;
+  uint64_t hashCode = PBFieldTableHash(&TestRequiredOptimizedForSize_fieldTable, self);
+  hashCode = PBGeneratedMessageHashMix(hashCode, [self.unknownFields hash]);
+  hash_ = PBGeneratedMessageHashFinish(hashCode);
+  PBGeneratedMessageSetMemoizedHash(&memoizedHash, hash_);
+  return hash_;
+}
 @end
 
 @implementation TestRequiredOptimizedForSize_Builder
 @synthesize result;
 - (void) dealloc {
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
   self.result = nil;
+  [prototype_ release];
   [super dealloc];
 }
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[[TestRequiredOptimizedForSize alloc] init] autorelease];
+    result = [TestRequiredOptimizedForSize recycledInstance];
   }
   return self;
 }
+- (id) initWithPrototype:(TestRequiredOptimizedForSize*) prototype {
+  if ((self = [super init])) {
+    self.result = prototype;
+    prototype_ = [prototype retain];
+  }
+  return self;
+}
+- (void) detachFromPrototype {
+  TestRequiredOptimizedForSize* prototype = prototype_;
+  prototype_ = nil;
+  self.result = [[[TestRequiredOptimizedForSize alloc] init] autorelease];
+  [self mergeFrom:prototype];
+  [prototype release];
+}
+- (PBGeneratedMessage*) internalGetMutableResult {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return [self internalGetResult];
+}
 - (PBGeneratedMessage*) internalGetResult {
   return result;
 }
 - (TestRequiredOptimizedForSize_Builder*) clear {
-  self.result = [[[TestRequiredOptimizedForSize alloc] init] autorelease];
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = [[TestRequiredOptimizedForSize recycledInstance] autorelease];
   return self;
 }
 - (TestRequiredOptimizedForSize_Builder*) clone {
-  return [TestRequiredOptimizedForSize builderWithPrototype:result];
+  if (prototype_ != nil) {
+    return [[[TestRequiredOptimizedForSize_Builder alloc] initWithPrototype:prototype_] autorelease];
+  }
+  return [[TestRequiredOptimizedForSize builder] mergeFrom:result];
+}
+- (TestRequiredOptimizedForSize_Builder*) reset {
+  if (result == nil || prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    self.result = [[TestRequiredOptimizedForSize recycledInstance] autorelease];
+  } else {
+    [result clearForReuse];
+  }
+  return self;
+}
+- (TestRequiredOptimizedForSize_Builder*) recycle:(TestRequiredOptimizedForSize*) message {
+  if (message == [TestRequiredOptimizedForSize defaultInstance]) {
+    @throw [NSException exceptionWithName:@"IllegalArgument" reason:@"Cannot recycle the default instance" userInfo:nil];
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = message;
+  return [self reset];
 }
 - (TestRequiredOptimizedForSize*) defaultInstance {
   return [TestRequiredOptimizedForSize defaultInstance];
 }
 - (TestRequiredOptimizedForSize*) build {
   [self checkInitialized];
-  return [self buildPartial];
+  BOOL shared = prototype_ != nil;
+  TestRequiredOptimizedForSize* returnMe = [self buildPartial];
+  if (!shared) {
+    [returnMe setInitialized];
+  }
+  return returnMe;
 }
 - (TestRequiredOptimizedForSize*) buildPartial {
-  TestRequiredOptimizedForSize* returnMe = [[result retain] autorelease];
-  self.result = nil;
+  return [[self newBuildPartial] autorelease];
+}
+- (TestRequiredOptimizedForSize*) newBuildPartial {
+  if (prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    TestRequiredOptimizedForSize* returnMe = result;
+    result = nil;
+    return returnMe;
+  }
+  TestRequiredOptimizedForSize* returnMe = result;
+  result = nil;
   return returnMe;
 }
 - (TestRequiredOptimizedForSize_Builder*) mergeFrom:(TestRequiredOptimizedForSize*) other {
   if (other == [TestRequiredOptimizedForSize defaultInstance]) {
     return self;
   }
-  if (other.hasX) {
-    [self setX:other.x];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (other->hasBits_[0] & 0x1u) {
+    [self setX:other->x];
   }
   [self mergeUnknownFields:other.unknownFields];
   return self;
@@ -513,107 +724,127 @@ static TestRequiredOptimizedForSize* defaultTestRequiredOptimizedForSizeInstance
   return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
 }
 - (TestRequiredOptimizedForSize_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
-  while (YES) {
-    int32_t tag = [input readTag];
-    switch (tag) {
-      case 0:
-        [self setUnknownFields:[unknownFields build]];
-        return self;
-      default: {
-        if (![self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag]) {
-          [self setUnknownFields:[unknownFields build]];
-          return self;
-        }
-        break;
-      }
-      case 8: {
-        [self setX:[input readInt32]];
-        break;
-      }
-    }
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
+  PBFieldTableMergeFromCodedInputStream(&TestRequiredOptimizedForSize_fieldTable, self, result, input, extensionRegistry);
+  return self;
 }
 - (BOOL) hasX {
-  return result.hasX;
+  return (result->hasBits_[0] & 0x1u) != 0;
 }
 - (int32_t) x {
-  return result.x;
+  return result->x;
 }
 - (TestRequiredOptimizedForSize_Builder*) setX:(int32_t) value {
-  result.hasX = YES;
-  result.x = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] |= 0x1u;
+  result->x = value;
   return self;
 }
 - (TestRequiredOptimizedForSize_Builder*) clearX {
-  result.hasX = NO;
-  result.x = 0;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  result->hasBits_[0] &= ~0x1u;
+  result->x = 0;
   return self;
 }
 @end
 
+static PBFieldTableEntry TestOptionalOptimizedForSize_fieldEntries[] = {
+  { 1, PBExtensionTypeMessage, 0, 0, "o", "TestRequiredOptimizedForSize_Builder", NULL },
+};
+static PBFieldTable TestOptionalOptimizedForSize_fieldTable = {
+  TestOptionalOptimizedForSize_fieldEntries, 1, NULL, 0
+};
+
 @interface TestOptionalOptimizedForSize ()
-@property (retain) TestRequiredOptimizedForSize* o;
+@property (nonatomic, retain) TestRequiredOptimizedForSize* o;
+- (void) setInitialized;
+@end
+
+@interface TestOptionalOptimizedForSize_Builder()
+@property (nonatomic, retain) TestOptionalOptimizedForSize* result;
+- (id) initWithPrototype:(TestOptionalOptimizedForSize*) prototype;
+- (void) detachFromPrototype;
+- (void) freezeSubBuilders;
+- (void) dropSubBuilders;
+- (void) resetSubBuilders;
 @end
 
 @implementation TestOptionalOptimizedForSize
 
 - (BOOL) hasO {
-  return !!hasO_;
+  return (hasBits_[0] & 0x1u) != 0;
 }
-- (void) setHasO:(BOOL) value {
-  hasO_ = !!value;
+- (void) setHasO:(BOOL) value_ {
+  if (value_) {
+    hasBits_[0] |= 0x1u;
+  } else {
+    hasBits_[0] &= ~0x1u;
+  }
 }
 @synthesize o;
+- (TestRequiredOptimizedForSize*) o {
+  return o != nil ? o : [TestRequiredOptimizedForSize defaultInstance];
+}
 - (void) dealloc {
-  self.o = nil;
+  [o release];
   [super dealloc];
 }
-- (id) init {
-  if ((self = [super init])) {
-    self.o = [TestRequiredOptimizedForSize defaultInstance];
-  }
-  return self;
+- (void) clearForReuse {
+  [super clearForReuse];
+  memset(hasBits_, 0, sizeof(hasBits_));
+  [o release];
+  o = nil;
 }
-static TestOptionalOptimizedForSize* defaultTestOptionalOptimizedForSizeInstance = nil;
 + (void) initialize {
   if (self == [TestOptionalOptimizedForSize class]) {
-    defaultTestOptionalOptimizedForSizeInstance = [[TestOptionalOptimizedForSize alloc] init];
+    PBFieldTableResolve(&TestOptionalOptimizedForSize_fieldTable, self);
   }
 }
+static TestOptionalOptimizedForSize* defaultTestOptionalOptimizedForSizeInstance = nil;
 + (TestOptionalOptimizedForSize*) defaultInstance {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultTestOptionalOptimizedForSizeInstance = [[TestOptionalOptimizedForSize alloc] init];
+  });
   return defaultTestOptionalOptimizedForSizeInstance;
 }
 - (TestOptionalOptimizedForSize*) defaultInstance {
-  return defaultTestOptionalOptimizedForSizeInstance;
+  return [TestOptionalOptimizedForSize defaultInstance];
+}
+- (void) setInitialized {
+  hasBits_[0] |= 0x2u;
 }
 - (BOOL) isInitialized {
-  if (self.hasO) {
-    if (!self.o.isInitialized) {
+  if ((hasBits_[0] & 0x2u) != 0) {
+    return YES;
+  }
+  if ((hasBits_[0] & 0x1u) != 0) {
+    if (!o.isInitialized) {
       return NO;
     }
   }
   return YES;
 }
 - (void) writeToCodedOutputStream:(PBCodedOutputStream*) output {
-  if (self.hasO) {
-    [output writeMessage:1 value:self.o];
-  }
+  PBFieldTableWriteTo(&TestOptionalOptimizedForSize_fieldTable, self, output);
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = PBGeneratedMessageGetMemoizedSize(&memoizedSerializedSize);
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
-  if (self.hasO) {
-    size += computeMessageSize(1, self.o);
-  }
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
+  size_ = PBFieldTableSerializedSize(&TestOptionalOptimizedForSize_fieldTable, self);
+  size_ += self.unknownFields.serializedSize;
+  PBGeneratedMessageSetMemoizedSize(&memoizedSerializedSize, size_);
+  return size_;
 }
 + (TestOptionalOptimizedForSize*) parseFromData:(NSData*) data {
   return (TestOptionalOptimizedForSize*)[[[TestOptionalOptimizedForSize builder] mergeFromData:data] build];
@@ -637,7 +868,7 @@ static TestOptionalOptimizedForSize* defaultTestOptionalOptimizedForSizeInstance
   return [[[TestOptionalOptimizedForSize_Builder alloc] init] autorelease];
 }
 + (TestOptionalOptimizedForSize_Builder*) builderWithPrototype:(TestOptionalOptimizedForSize*) prototype {
-  return [[TestOptionalOptimizedForSize builder] mergeFrom:prototype];
+  return [[[TestOptionalOptimizedForSize_Builder alloc] initWithPrototype:prototype] autorelease];
 }
 - (TestOptionalOptimizedForSize_Builder*) builder {
   return [TestOptionalOptimizedForSize builder];
@@ -646,9 +877,9 @@ static TestOptionalOptimizedForSize* defaultTestOptionalOptimizedForSizeInstance
   return [TestOptionalOptimizedForSize builderWithPrototype:self];
 }
 - (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
-  if (self.hasO) {
+  if (hasBits_[0] & 0x1u) {
     [output appendFormat:@"%@%@ {\n", indent, @"o"];
-    [self.o writeDescriptionTo:output
+    [o writeDescriptionTo:output
                          withIndent:[NSString stringWithFormat:@"%@  ", indent]];
     [output appendFormat:@"%@}\n", indent];
   }
@@ -663,65 +894,161 @@ static TestOptionalOptimizedForSize* defaultTestOptionalOptimizedForSizeInstance
   }
   TestOptionalOptimizedForSize *otherMessage = other;
   return
-      self.hasO == otherMessage.hasO &&
-      (!self.hasO || [self.o isEqual:otherMessage.o]) &&
-      
+      PBFieldTableIsEqual(&TestOptionalOptimizedForSize_fieldTable, self, otherMessage) &&
       (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
 }
 - (NSUInteger) hash {
-  NSUInteger hashCode = 7;
-  if (self.hasO) {
-    hashCode = hashCode * 31 + [self.o hash];
+  NSUInteger hash_ = PBGeneratedMessageGetMemoizedHash(&memoizedHash);
+  if (hash_ != 0) {
+    return hash_;
   }
-  hashCode = hashCode * 31 + [self.unknownFields hash];
-  return hashCode;
-}
-@end
 
-@interface TestOptionalOptimizedForSize_Builder()
-@property (retain) TestOptionalOptimizedForSize* result;
+  uint64_t hashCode = PBFieldTableHash(&TestOptionalOptimizedForSize_fieldTable, self);
+  hashCode = PBGeneratedMessageHashMix(hashCode, [self.unknownFields hash]);
+  hash_ = PBGeneratedMessageHashFinish(hashCode);
+  PBGeneratedMessageSetMemoizedHash(&memoizedHash, hash_);
+  return hash_;
+}
 @end
 
 @implementation TestOptionalOptimizedForSize_Builder
 @synthesize result;
 - (void) dealloc {
+  [self dropSubBuilders];
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
   self.result = nil;
+  [prototype_ release];
   [super dealloc];
 }
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[[TestOptionalOptimizedForSize alloc] init] autorelease];
+    result = [TestOptionalOptimizedForSize recycledInstance];
+  }
+  return self;
+}
+- (id) initWithPrototype:(TestOptionalOptimizedForSize*) prototype {
+  if ((self = [super init])) {
+    self.result = prototype;
+    prototype_ = [prototype retain];
   }
   return self;
 }
+- (void) detachFromPrototype {
+  TestOptionalOptimizedForSize* prototype = prototype_;
+  prototype_ = nil;
+  self.result = [[[TestOptionalOptimizedForSize alloc] init] autorelease];
+  [self mergeFrom:prototype];
+  [prototype release];
+}
+- (PBGeneratedMessage*) internalGetMutableResult {
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  return [self internalGetResult];
+}
+- (void) freezeSubBuilders {
+  if (oBuilder_ != nil) {
+    TestRequiredOptimizedForSize* value = [oBuilder_ newBuildPartial];
+    result.o = value;
+    [value release];
+    [oBuilder_ release];
+    oBuilder_ = nil;
+  }
+}
+- (void) dropSubBuilders {
+  [oBuilder_ release];
+  oBuilder_ = nil;
+  [oSpareBuilder_ release];
+  oSpareBuilder_ = nil;
+}
+- (void) resetSubBuilders {
+  if (oBuilder_ != nil) {
+    [oBuilder_ reset];
+    [oSpareBuilder_ release];
+    oSpareBuilder_ = oBuilder_;
+    oBuilder_ = nil;
+  }
+}
 - (PBGeneratedMessage*) internalGetResult {
+  [self freezeSubBuilders];
   return result;
 }
 - (TestOptionalOptimizedForSize_Builder*) clear {
-  self.result = [[[TestOptionalOptimizedForSize alloc] init] autorelease];
+  [self dropSubBuilders];
+  if (prototype_ == nil) {
+    PBGeneratedMessageRecycle(result);
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = [[TestOptionalOptimizedForSize recycledInstance] autorelease];
   return self;
 }
 - (TestOptionalOptimizedForSize_Builder*) clone {
-  return [TestOptionalOptimizedForSize builderWithPrototype:result];
+  if (prototype_ != nil) {
+    return [[[TestOptionalOptimizedForSize_Builder alloc] initWithPrototype:prototype_] autorelease];
+  }
+  [self freezeSubBuilders];
+  return [[TestOptionalOptimizedForSize builder] mergeFrom:result];
+}
+- (TestOptionalOptimizedForSize_Builder*) reset {
+  [self resetSubBuilders];
+  if (result == nil || prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    self.result = [[TestOptionalOptimizedForSize recycledInstance] autorelease];
+  } else {
+    [result clearForReuse];
+  }
+  return self;
+}
+- (TestOptionalOptimizedForSize_Builder*) recycle:(TestOptionalOptimizedForSize*) message {
+  if (message == [TestOptionalOptimizedForSize defaultInstance]) {
+    @throw [NSException exceptionWithName:@"IllegalArgument" reason:@"Cannot recycle the default instance" userInfo:nil];
+  }
+  [prototype_ release];
+  prototype_ = nil;
+  self.result = message;
+  return [self reset];
 }
 - (TestOptionalOptimizedForSize*) defaultInstance {
   return [TestOptionalOptimizedForSize defaultInstance];
 }
 - (TestOptionalOptimizedForSize*) build {
   [self checkInitialized];
-  return [self buildPartial];
+  BOOL shared = prototype_ != nil;
+  TestOptionalOptimizedForSize* returnMe = [self buildPartial];
+  if (!shared) {
+    [returnMe setInitialized];
+  }
+  return returnMe;
 }
 - (TestOptionalOptimizedForSize*) buildPartial {
-  TestOptionalOptimizedForSize* returnMe = [[result retain] autorelease];
-  self.result = nil;
+  return [[self newBuildPartial] autorelease];
+}
+- (TestOptionalOptimizedForSize*) newBuildPartial {
+  if (prototype_ != nil) {
+    [prototype_ release];
+    prototype_ = nil;
+    TestOptionalOptimizedForSize* returnMe = result;
+    result = nil;
+    return returnMe;
+  }
+  [self freezeSubBuilders];
+  TestOptionalOptimizedForSize* returnMe = result;
+  result = nil;
   return returnMe;
 }
 - (TestOptionalOptimizedForSize_Builder*) mergeFrom:(TestOptionalOptimizedForSize*) other {
   if (other == [TestOptionalOptimizedForSize defaultInstance]) {
     return self;
   }
-  if (other.hasO) {
-    [self mergeO:other.o];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  if (other->hasBits_[0] & 0x1u) {
+    [self mergeO:other->o];
   }
   [self mergeUnknownFields:other.unknownFields];
   return self;
@@ -730,40 +1057,27 @@ static TestOptionalOptimizedForSize* defaultTestOptionalOptimizedForSizeInstance
   return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
 }
 - (TestOptionalOptimizedForSize_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
-  while (YES) {
-    int32_t tag = [input readTag];
-    switch (tag) {
-      case 0:
-        [self setUnknownFields:[unknownFields build]];
-        return self;
-      default: {
-        if (![self parseUnknownField:input unknownFields:unknownFields extensionRegistry:extensionRegistry tag:tag]) {
-          [self setUnknownFields:[unknownFields build]];
-          return self;
-        }
-        break;
-      }
-      case 10: {
-        TestRequiredOptimizedForSize_Builder* subBuilder = [TestRequiredOptimizedForSize builder];
-        if (self.hasO) {
-          [subBuilder mergeFrom:self.o];
-        }
-        [input readMessage:subBuilder extensionRegistry:extensionRegistry];
-        [self setO:[subBuilder buildPartial]];
-        break;
-      }
-    }
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
+  [self freezeSubBuilders];
+  PBFieldTableMergeFromCodedInputStream(&TestOptionalOptimizedForSize_fieldTable, self, result, input, extensionRegistry);
+  return self;
 }
 - (BOOL) hasO {
-  return result.hasO;
+  return (result->hasBits_[0] & 0x1u) != 0;
 }
 - (TestRequiredOptimizedForSize*) o {
+  [self freezeSubBuilders];
   return result.o;
 }
 - (TestOptionalOptimizedForSize_Builder*) setO:(TestRequiredOptimizedForSize*) value {
-  result.hasO = YES;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  [oBuilder_ release];
+  oBuilder_ = nil;
+  result->hasBits_[0] |= 0x1u;
   result.o = value;
   return self;
 }
@@ -771,19 +1085,32 @@ static TestOptionalOptimizedForSize* defaultTestOptionalOptimizedForSizeInstance
   return [self setO:[builderForValue build]];
 }
 - (TestOptionalOptimizedForSize_Builder*) mergeO:(TestRequiredOptimizedForSize*) value {
-  if (result.hasO &&
-      result.o != [TestRequiredOptimizedForSize defaultInstance]) {
-    result.o =
-      [[[TestRequiredOptimizedForSize builderWithPrototype:result.o] mergeFrom:value] buildPartial];
-  } else {
-    result.o = value;
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
   }
-  result.hasO = YES;
+  if (oBuilder_ == nil) {
+    if (!(result->hasBits_[0] & 0x1u) ||
+        result->o == [TestRequiredOptimizedForSize defaultInstance]) {
+      result->hasBits_[0] |= 0x1u;
+      result.o = value;
+      return self;
+    }
+    oBuilder_ = oSpareBuilder_ != nil ? oSpareBuilder_ : [[TestRequiredOptimizedForSize_Builder alloc] init];
+    oSpareBuilder_ = nil;
+    [oBuilder_ mergeFrom:result->o];
+  }
+  [oBuilder_ mergeFrom:value];
   return self;
 }
 - (TestOptionalOptimizedForSize_Builder*) clearO {
-  result.hasO = NO;
-  result.o = [TestRequiredOptimizedForSize defaultInstance];
+  if (prototype_ != nil) {
+    [self detachFromPrototype];
+  }
+  [oBuilder_ release];
+  oBuilder_ = nil;
+  result->hasBits_[0] &= ~0x1u;
+  [result->o release];
+  result->o = nil;
   return self;
 }
 @end